@@ -82,6 +82,7 @@ static void Build_Forkit(abt::FSyscmd *next_cmd) {
 static void RevealOutput(algo::Fildes a, algo::Fildes b, bool scan) {
     algo_lib::MmapFile mmap;
     if (MmapFile_LoadFd(mmap,a)) {
+        algo_lib::FlushLog();
         WriteFile(b,(u8*)mmap.text.elems,mmap.text.n_elems);
         mmap.fd.fd = algo::Fildes();// forget it -- avoid double close
     }
@@ -357,6 +357,7 @@ static void Main_ReadSrcfile() {
         abt::zs_srcfile_read_RemoveFirst();
     }
     if (algo_lib::_db.exit_code > 0) {
+        algo_lib::FlushLog();
         _exit(1); // exit right away. nothing smarter can be done. TODO: something smarter.
     }
 }
@@ -28,8 +28,12 @@
 
 // -----------------------------------------------------------------------------
 
-static void CheckArgs_Rec(acr::FRec &rec, acr::FCtype &ctype, acr::FCheck &check) {
-    check.n_record++;
+// Check attributes of record REC; return number of errors found.
+// If CHECK is non-NULL, errors are also counted and reported through it.
+// Runs on check threads when CHECK is NULL.
+static int CheckArgs_Rec(acr::FRec &rec, acr::FCtype &ctype, acr::FCheck *check) {
+    int nerr = 0;
+    algo::cstring value;
     ind_beg(acr::ctype_c_field_curs,  field, ctype){
         if (Attr *attr = attr_Find(rec.tuple,name_Get(field), 0)) {
             int maxlen = field.max_attr_len;
@@ -38,9 +42,11 @@ static void CheckArgs_Rec(acr::FRec &rec, acr::FCtype &ctype, acr::FCheck &check
             }
             int attrlen = 0;
             if (maxlen) {
-                attrlen = ch_N(EvalAttr(rec.tuple, field));
+                EvalAttr(rec.tuple, field, value);
+                attrlen = ch_N(value);
                 if (maxlen && attrlen > maxlen) {
-                    if (++check.n_err < acr::_db.cmdline.maxshow) {
+                    nerr++;
+                    if (check && ++check->n_err < acr::_db.cmdline.maxshow) {
                         NoteErr(NULL,&rec,&field
                                 ,tempstr()<<"acr.attr_too_long"
                                 <<Keyval("field",field.field)
@@ -51,7 +57,8 @@ static void CheckArgs_Rec(acr::FRec &rec, acr::FCtype &ctype, acr::FCheck &check
                 }
             }
             if (field.arg == "char" && ch_N(attr->value) != 1) {
-                if (++check.n_err < acr::_db.cmdline.maxshow) {
+                nerr++;
+                if (check && ++check->n_err < acr::_db.cmdline.maxshow) {
                     NoteErr(NULL,&rec,&field
                             ,tempstr()<<"Attribute '"<<name_Get(field)
                             <<"' must have length 1");
@@ -59,22 +66,28 @@ static void CheckArgs_Rec(acr::FRec &rec, acr::FCtype &ctype, acr::FCheck &check
             }
         }
     }ind_end;
+    return nerr;
 }
 
 // -----------------------------------------------------------------------------
 
+// Report errors found by check threads in CTYPE.C_BAD_REC
 static void CheckArgs(acr::FCheck &check) {
-    ind_beg(acr::_db_zd_sel_ctype_curs, ctype, acr::_db) {
+    ind_beg(acr::_db_zd_sel_ctype_curs, ctype, acr::_db) if (ctype.check) {
         ind_beg(acr::ctype_zd_selrec_curs,  rec, ctype) {
-            CheckArgs_Rec(rec,ctype,check);
+            (void)rec;
+            check.n_record++;
+        }ind_end;
+        ind_beg(acr::ctype_c_bad_rec_curs,  rec, ctype) {
+            (void)CheckArgs_Rec(rec,ctype,&check);
         }ind_end;
     }ind_end;
 }
 
 // -----------------------------------------------------------------------------
 
-static void SuggestAlternatives(acr::FCtype &ctype, acr::FField &field, acr::FCheck &check) {
-    ind_beg(acr::check_c_bad_rec_curs,rec,check) {
+static void SuggestAlternatives(acr::FCtype &ctype, acr::FField &field) {
+    ind_beg(acr::field_c_bad_rec_curs,rec,field) {
         NoteErr(NULL,&rec,&field
                 ,tempstr()<< "Invalid value "<<name_Get(field)
                 <<":"<<EvalAttr(rec.tuple, field));
@@ -96,20 +109,12 @@ static void SuggestAlternatives(acr::FCtype &ctype, acr::FField &field, acr::FCh
 
 // -----------------------------------------------------------------------------
 
+// Report invalid references found by check threads in FIELD.C_BAD_REC
 static void CheckXref_Field(acr::FCtype &ctype, acr::FField &field, acr::FCheck &check) {
-    if (RecordsLoadedQ(*field.p_arg)) {// don't check ssimfiles that are not loaded
-        acr::c_bad_rec_RemoveAll(check);
-        ind_beg(acr::ctype_zd_selrec_curs, rec, ctype) {// loop through all records for this ctype
-            tempstr attr(EvalAttr(rec.tuple, field));// find attribute value
-            if (!acr::ind_rec_Find(*field.p_arg,attr)) {// check index for pkey
-                c_bad_rec_Insert(check, rec);
-            }
-        }ind_end;
-        if (c_bad_rec_N(check)) {
-            check.n_err++;
-            if (check.n_err < acr::_db.cmdline.maxshow) {
-                SuggestAlternatives(ctype,field,check);
-            }
+    if (c_bad_rec_N(field)) {
+        check.n_err++;
+        if (check.n_err < acr::_db.cmdline.maxshow) {
+            SuggestAlternatives(ctype,field);
         }
     }
 }
@@ -117,7 +122,7 @@ static void CheckXref_Field(acr::FCtype &ctype, acr::FField &field, acr::FCheck
 // -----------------------------------------------------------------------------
 
 static void CheckXrefs(acr::FCheck &check) {
-    ind_beg(acr::_db_zd_sel_ctype_curs, ctype, acr::_db) {
+    ind_beg(acr::_db_zd_sel_ctype_curs, ctype, acr::_db) if (ctype.check) {
         int nbefore = check.n_err;
         ind_beg(acr::ctype_c_field_curs, field, ctype) {
             if (field.reftype == dmmeta_Reftype_reftype_Pkey) {
@@ -136,7 +141,7 @@ static void CheckXrefs(acr::FCheck &check) {
 // -----------------------------------------------------------------------------
 
 static void CheckFunique() {
-    ind_beg(acr::_db_zd_sel_ctype_curs, ctype, acr::_db) {
+    ind_beg(acr::_db_zd_sel_ctype_curs, ctype, acr::_db) if (ctype.check) {
         ind_beg(acr::ctype_c_field_curs, field, ctype) if (field.unique) {
             // compute key: it is field + field value
             ind_beg(acr::ctype_zd_selrec_curs, rec, ctype) {// loop through all records for this ctype
@@ -158,7 +163,7 @@ static void CheckFunique() {
 // -----------------------------------------------------------------------------
 
 static void CheckPkey() {
-    ind_beg(acr::_db_zd_sel_ctype_curs, ctype, acr::_db) if (ctype.c_ssimfile) {
+    ind_beg(acr::_db_zd_sel_ctype_curs, ctype, acr::_db) if (ctype.check && ctype.c_ssimfile) {
         ind_beg(acr::ctype_c_field_curs,  field, ctype){
             if (field.reftype == dmmeta_Reftype_reftype_Val && field.p_arg->c_ssimfile) {
                 NoteErr(NULL, NULL, &field, tempstr()<<"Relational"
@@ -193,10 +198,192 @@ static void ShowErrRecs() {
 
 // -----------------------------------------------------------------------------
 
+// Find bad records of CTYPE: records with invalid attributes (CTYPE.C_BAD_REC)
+// and records with an invalid reference, per field (FIELD.C_BAD_REC).
+// Runs on a check thread: only CTYPE and its fields are modified;
+// errors are reported later, in ctype order, by the calling thread.
+static void CheckCtype(acr::FCtype &ctype) {
+    c_bad_rec_RemoveAll(ctype);
+    ind_beg(acr::ctype_zd_selrec_curs,  rec, ctype) {
+        if (CheckArgs_Rec(rec,ctype,NULL) > 0) {
+            c_bad_rec_Insert(ctype, rec);
+        }
+    }ind_end;
+    ind_beg(acr::ctype_c_field_curs, field, ctype) {
+        c_bad_rec_RemoveAll(field);
+        // don't check ssimfiles that are not loaded
+        if (field.reftype == dmmeta_Reftype_reftype_Pkey && RecordsLoadedQ(*field.p_arg)) {
+            algo::cstring attr;// reused for all records
+            ind_beg(acr::ctype_zd_selrec_curs, rec, ctype) {// loop through all records for this ctype
+                EvalAttr(rec.tuple, field, attr);// find attribute value
+                if (!acr::ind_rec_Find(*field.p_arg,attr)) {// check index for pkey
+                    c_bad_rec_Insert(field, rec);
+                }
+            }ind_end;
+        }
+    }ind_end;
+}
+
+// Claim and check queued ctypes until none are left
+static void CheckAll() {
+    u32 i;
+    while ((i = algo::IncrMT(&acr::_db.check_next, u32(1)) - 1) < u32(acr::c_check_N())) {
+        CheckCtype(*acr::c_check_Find(i));
+    }
+}
+
+static void *CheckThread(void *) {
+    algo_lib::BeginWorker();
+    CheckAll();
+    algo_lib::EndWorker();
+    return NULL;
+}
+
+// Find bad records of all ctypes marked for checking,
+// one ctype per thread at a time (see -nthread)
+static void CheckParallel() {
+    acr::c_check_RemoveAll();
+    // FCtype.check is stored as a column: scan it without touching the rows
+    ind_beg(acr::_db_ctype_check_curs, check, acr::_db) if (check) {
+        acr::FCtype &ctype = acr::ctype_qFind(i32(ind_curs(check).index));
+        if (zd_sel_ctype_InLlistQ(ctype)) {
+            acr::c_check_Insert(ctype);
+        }
+    }ind_end;
+    acr::_db.check_next = 0;
+    int nthread = acr::Nthread(acr::c_check_N());
+    pthread_t *thread = (pthread_t*)alloca(sizeof(pthread_t) * nthread);
+    bool *started = (bool*)alloca(nthread);
+    for (int i = 1; i < nthread; i++) {
+        started[i] = pthread_create(&thread[i], NULL, CheckThread, NULL) == 0;
+    }
+    CheckAll();// if a thread could not be started, its share is done here
+    for (int i = 1; i < nthread; i++) {
+        if (started[i]) {
+            pthread_join(thread[i], NULL);
+        }
+    }
+    acr::c_check_RemoveAll();
+}
+
+// -----------------------------------------------------------------------------
+
+// Check stamps are kept only for a data directory, and if there is a temp directory
+static bool CheckStampQ() {
+    return acr::_db.cmdline.changed
+        && !acr::FileInputQ()
+        && DirectoryQ(acr::_db.cmdline.in)
+        && DirectoryQ("temp");
+}
+
+// Name of file with check stamps for the data directory
+// e.g. temp/acr_check/data.ssim
+static tempstr CheckStampFname() {
+    tempstr ret("temp/acr_check/");
+    tempstr name(acr::_db.cmdline.in);
+    Replace(name, "/", ".");
+    ret << name << ".ssim";
+    return ret;
+}
+
+// Modification time and size of ssimfile SSIMFILE, or empty string if it doesn't exist
+static tempstr CheckStamp(acr::FSsimfile &ssimfile) {
+    tempstr ret;
+    struct stat st;
+    if (stat(Zeroterm(tempstr(SsimFname(acr::_db.cmdline.in, ssimfile.ssimfile))), &st) == 0) {
+        ret << (i64(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec) << "." << i64(st.st_size);
+    }
+    return ret;
+}
+
+// Load stamps saved by the last successful check,
+// and find ssimfiles that haven't changed since (FSsimfile.unchanged)
+static void ReadCheckStamps() {
+    ind_beg(algo::FileLine_curs, line, CheckStampFname()) {
+        Tuple tuple;
+        if (Tuple_ReadStrptrMaybe(tuple, line)) {
+            if (acr::FSsimfile *ssimfile = acr::ind_ssimfile_Find(attr_GetString(tuple, "ssimfile"))) {
+                ssimfile->unchanged = attr_GetString(tuple, "stamp") == CheckStamp(*ssimfile);
+            }
+        }
+    }ind_end;
+}
+
+// True if all records of CTYPE are selected
+static bool AllSelectedQ(acr::FCtype &ctype) {
+    bool ret = true;
+    ind_beg(acr::ctype_zd_trec_curs, rec, ctype) {
+        if (!zd_selrec_InLlistQ(rec)) {
+            ret = false;
+            break;
+        }
+    }ind_end;
+    return ret;
+}
+
+// True if ssimfile of CTYPE is unchanged since the last successful check
+static bool UnchangedQ(acr::FCtype &ctype) {
+    return ctype.c_ssimfile && ctype.c_ssimfile->unchanged;
+}
+
+// Mark ctypes whose selected records are checked (CTYPE.CHECK).
+// With -changed, a ctype is skipped if neither its ssimfile, nor any ssimfile
+// it references, nor the schema (dmmeta ssimfiles) changed since the last successful check.
+static void SelectCheckCtypes() {
+    bool all = true;
+    if (CheckStampQ()) {
+        ReadCheckStamps();
+        all = false;
+        ind_beg(acr::_db_ssimfile_curs, ssimfile, acr::_db) {
+            if (StartsWithQ(ssimfile.ssimfile, "dmmeta.") && !ssimfile.unchanged) {
+                all = true;
+            }
+        }ind_end;
+    }
+    ind_beg(acr::_db_ssimfile_curs, ssimfile, acr::_db) {
+        ssimfile.check_all = RecordsLoadedQ(*ssimfile.p_ctype) && AllSelectedQ(*ssimfile.p_ctype);
+    }ind_end;
+    ind_beg(acr::_db_zd_sel_ctype_curs, ctype, acr::_db) {
+        bool unchanged = !all && UnchangedQ(ctype);
+        ind_beg(acr::ctype_c_field_curs, field, ctype) {
+            if (field.reftype == dmmeta_Reftype_reftype_Pkey && field.p_arg->c_ssimfile) {
+                unchanged = unchanged && UnchangedQ(*field.p_arg);
+            }
+        }ind_end;
+        ctype.check = !unchanged;
+    }ind_end;
+}
+
+// With -check -changed, save stamps of ssimfiles that passed the check
+// (ssimfiles that were loaded and selected entirely, see FSsimfile.check_all),
+// for use by the next -changed. A -check without -changed writes nothing.
+// Called after the -write step (if any), so that rewritten files get their new stamps.
+void acr::WriteCheckStamps() {
+    if (CheckStampQ() && !acr::_db.check_failed) {
+        cstring out;
+        ind_beg(acr::_db_ssimfile_curs, ssimfile, acr::_db) {
+            if (ssimfile.check_all) {
+                out << "acr.checkstamp"
+                    << Keyval("ssimfile",ssimfile.ssimfile)
+                    << Keyval("stamp",CheckStamp(ssimfile))
+                    << eol;
+            }
+        }ind_end;
+        (void)mkdir("temp/acr_check",0755);
+        (void)SafeStringToFile(out, CheckStampFname());
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 void acr::Main_Check() {
     acr::FCheck check;
+    SelectCheckCtypes();
     CheckPkey();
 
+    // Find bad records on multiple threads; errors are reported below,
+    // in the same order as if each check ran over all selected records in turn
+    CheckParallel();
     CheckArgs(check);
 
     // Uniqueness check for secondary fields
@@ -64,6 +64,7 @@ static acr::FRec* ReadTupleX(Tuple &tuple, acr::FFile &file, bool insert) {
         // subsequently insert new records as long as undeleted records stay
         // in the index.
         if (!file.autoloaded && ctype->n_insert == 0 && acr::_db.cmdline.trunc) {
+            acr::AttrvalInvalidate(*ctype);
             while (acr::FRec *rec = acr::zd_trec_First(*ctype)) {
                 acr::rec_Delete(*rec);
             }
@@ -188,6 +189,7 @@ acr::FRec *acr::CreateRec(acr::FFile &file, acr::FCtype *ctype, algo::Tuple &tup
     //
     // records are written to disk in rowid order.
     float rowid   = ret ? ret->sortkey.rowid : ctype->next_rowid;
+    acr::AttrvalInvalidate(*ctype);
     if (insert) {
         ctype->next_rowid = float_Max(ctype->next_rowid, rowid + 1);
         algo::Attr *rowid_attr = attr_Find(tuple, "acr.rowid");
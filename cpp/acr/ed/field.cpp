@@ -378,7 +378,8 @@ void acr_ed::InsertFieldExtras(strptr field, strptr arg, strptr reftype) {
         tary.field   = field;
         acr_ed::_db.out_ssim << tary << eol;
     } else if (reftype == dmmeta_Reftype_reftype_Bheap ||
-               reftype == dmmeta_Reftype_reftype_Atree) {
+               reftype == dmmeta_Reftype_reftype_Atree ||
+               reftype == dmmeta_Reftype_reftype_Btree) {
         dmmeta::Sortfld sortfld;
         sortfld.field   = field;
         sortfld.sortfld   = GuessSortfld(arg);
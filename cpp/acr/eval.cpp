@@ -128,10 +128,18 @@ void acr::EvalAttrDflt(Tuple &tuple, acr::FField &field, cstring &ret) {
 // can this function be shared?
 // I see it is being implemented in three different places
 tempstr acr::EvalAttr(Tuple &tuple, acr::FField &field) {
+    tempstr ret;
+    EvalAttr(tuple, field, ret);
+    return ret;
+}
+
+// -----------------------------------------------------------------------------
+
+// Same as above, but the value is written to caller-owned string RET,
+// whose buffer can be reused from one call to the next.
+void acr::EvalAttr(Tuple &tuple, acr::FField &field, cstring &ret) {
     acr::FEvalattr evalattr;
     evalattr.field = &field;
     Evalattr_Step(evalattr, tuple);
-    tempstr ret;
     ret = evalattr.value;
-    return ret;
 }
@@ -28,28 +28,244 @@
 
 // -----------------------------------------------------------------------------
 
+// True if NAME is the name of FIELD
+// (same as name_Get(field) == NAME, without constructing the name)
+static bool FieldNameQ(acr::FField &field, strptr name) {
+    strptr fld = field.field;
+    int n = elems_N(name);
+    return n < elems_N(fld)
+        && fld[elems_N(fld)-n-1] == '.'
+        && EndsWithQ(fld, name);
+}
+
+// True if printing record REC according to schema produces the same
+// attributes as the line it was read from: all non-fldfunc fields are present,
+// in schema order, bools are normalized, and there are no other attributes.
+// NATTR is the number of attributes on the line; if reading the tuple removed
+// some of them (acr.rowid), the line cannot be reused.
+static bool CanonAttrsQ(acr::FRec &rec, int nattr) {
+    bool ret = nattr == attrs_N(rec.tuple) && ch_N(rec.tuple.head.name) == 0;
+    int i = 0;
+    ind_beg(acr::ctype_c_field_curs, field, *rec.p_ctype) if (ret && !field.isfldfunc) {
+        algo::Attr *attr = i < nattr ? &attrs_qFind(rec.tuple, i) : NULL;
+        ret = attr && FieldNameQ(field, attr->name)
+            && (field.arg != strptr("bool",4) || attr->value == "Y" || attr->value == "N");
+        i++;
+    }ind_end;
+    return ret && i == nattr;
+}
+
+// Remember LINE, the input line from which record REC was read,
+// so that acr::WriteFiles can copy it back if the record is not modified.
+// The line is kept only if it is what printing the record would produce
+// (up to quoting and spacing, see CanonAttrsQ).
+// NATTR is the number of attributes on the line.
+void acr::SetOrigline(acr::FRec &rec, strptr line, int nattr) {
+    bool keep = elems_N(line) > 0
+        && !algo_lib::WhiteCharQ(u8(line[elems_N(line)-1]))
+        && CanonAttrsQ(rec, nattr);
+    rec.origline = keep ? line : strptr();
+}
+
+// -----------------------------------------------------------------------------
+
+// Insert TUPLE, read from LINE of FILE of ssimfile SSIMFILE.
+// When COMPLETE is set, the ssimfile was partially loaded (see acr::LoadPkey);
+// records that are already in memory are skipped, keeping their rowids.
+static void LoadTuple(acr::FSsimfile &ssimfile, acr::FFile &file, Tuple &tuple, strptr line, bool complete) {
+    acr::FCtype &ctype = *ssimfile.p_ctype;
+    acr::FRec *rec = NULL;
+    if (complete && c_field_N(ctype) > 0) {
+        if (algo::Attr *attr = attr_Find(tuple, name_Get(*c_field_Find(ctype, 0)))) {
+            rec = acr::ind_rec_Find(ctype, attr->value);
+        }
+    }
+    if (rec) {
+        ctype.next_rowid = float_Max(ctype.next_rowid, rec->sortkey.rowid + 1);
+    } else {
+        int nattr = attrs_N(tuple);
+        rec = ReadTuple(tuple, file, true);
+        if (rec) {
+            SetOrigline(*rec, line, nattr);
+        }
+        if (rec && complete) {
+            PlaceRec(*rec);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Insert tuples parsed by a loader thread into FILE, in file order
+static void LoadStagerows(acr::FSsimfile &ssimfile, acr::FFile &file, bool complete) {
+    if (ssimfile.stage_ok) {
+        file.modtime = ssimfile.stage_modtime;
+        verblog("acr.load"<<Keyval("fname",file.file)<<Keyval("staged",true));
+        algo::TempstrScope tempstr_scope;
+        ind_beg(acr::ssimfile_stagerow_curs,row,ssimfile) {
+            file.lineno = row.lineno;
+            LoadTuple(ssimfile, file, row.tuple, row.line, complete);
+        }ind_end;
+    }
+    stagerow_RemoveAll(ssimfile);
+    ch_RemoveAll(ssimfile.stage_fname);
+    ssimfile.stage_ok = false;
+}
+
 // Load input records for ssimfile SSIMFILE
 // and create an approprate FILE record.
+// If the ssimfile was parsed by acr::LoadStaged, staged tuples are used.
+// A partially loaded ssimfile (see acr::LoadPkey) is completed.
 void acr::LoadSsimfile(acr::FSsimfile& ssimfile) {
     acr::FFile *file = ssimfile.c_file;
-    if (!FileInputQ() && !file) {
-        file = &acr::ind_file_GetOrCreate(SsimFname(acr::_db.cmdline.in, ssimfile.ssimfile));
-        ssimfile.c_file = file;
-        file->autoloaded = true;
-        file->filename = file->file; // save filename
-        MmapFile in;
-        if (MmapFile_Load(in, file->file)) {
-            file->modtime = FdModTime(in.fd.fd);
-            verblog("acr.load"<<Keyval("fname",file->file));
-            ind_beg(Line_curs,line,in.text) {
-                Tuple tuple;
-                if (Tuple_ReadStrptrMaybe(tuple, line)) {
-                    ssimfile.c_file->lineno = ind_curs(line).i+1;
-                    ReadTuple(tuple, *ssimfile.c_file, true);
-                }
-            }ind_end;
+    if (!FileInputQ() && (!file || ssimfile.partial)) {
+        u64 start = get_cycles();
+        if (!file) {
+            file = &acr::ind_file_GetOrCreate(SsimFname(acr::_db.cmdline.in, ssimfile.ssimfile));
+            ssimfile.c_file = file;
+            file->autoloaded = true;
+            file->filename = file->file; // save filename
+        }
+        bool complete = ssimfile.partial;
+        if (complete) {
+            ssimfile.partial = false;
+            ssimfile.p_ctype->next_rowid = 0;
+        }
+        if (ch_N(ssimfile.stage_fname) > 0) {
+            LoadStagerows(ssimfile, *file, complete);
+        } else {
+            // the mapping is kept: loaded records refer to their lines.
+            // a partially loaded ssimfile is already mapped.
+            if (ValidQ(ssimfile.mmap.fd.fd) || MmapFile_Load(ssimfile.mmap, file->file)) {
+                file->modtime = FdModTime(ssimfile.mmap.fd.fd);
+                verblog("acr.load"<<Keyval("fname",file->file));
+                algo::TempstrScope tempstr_scope;
+                ind_beg(Line_curs,line,ssimfile.mmap.text) {
+                    Tuple tuple;
+                    if (Tuple_ReadStrptrMaybe(tuple, line)) {
+                        file->lineno = ind_curs(line).i+1;
+                        LoadTuple(ssimfile, *file, tuple, line, complete);
+                    }
+                }ind_end;
+            }
+        }
+        acr::_db.stats.n_file++;
+        acr::_db.stats.n_byte += elems_N(ssimfile.mmap.text);
+        acr::AddTime(acr::_db.stats.load_time, start);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Discard records of ssimfile SSIMFILE and unmap the file,
+// so that the next acr::LoadSsimfile reads it again.
+// Used by the query server (see acr::Main_Serve) when the file changes.
+void acr::UnloadSsimfile(acr::FSsimfile &ssimfile) {
+    acr::FCtype &ctype = *ssimfile.p_ctype;
+    AttrvalInvalidate(ctype);
+    while (acr::FRec *rec = acr::zd_trec_First(ctype)) {
+        acr::rec_Delete(*rec);
+    }
+    ctype.next_rowid = 0;
+    ssimfile.c_file = NULL;// file record is reused by acr::LoadSsimfile
+    ssimfile.partial = false;
+    // records referred to the mapping; now they are gone
+    algo_lib::mem_Cleanup(ssimfile.mmap.map);
+    ssimfile.mmap.map.mem = algo::memptr();
+    ssimfile.mmap.text = algo::strptr();
+    algo_lib::fd_Cleanup(ssimfile.mmap.fd);
+}
+
+// -----------------------------------------------------------------------------
+
+// Read and parse ssimfile SSIMFILE into its staging array.
+// Runs on a loader thread: only SSIMFILE is modified, and the only
+// allocations are strings (algo_lib lpool, which has per-thread magazines)
+// and malloc'd arrays.
+// The file stays mapped (see FSsimfile.mmap); a partially loaded ssimfile is already mapped.
+static void StageParse(acr::FSsimfile &ssimfile) {
+    ssimfile.stage_ok = ValidQ(ssimfile.mmap.fd.fd);
+    if (!ssimfile.stage_ok) {
+        algo::Fildes fd(open(Zeroterm(ssimfile.stage_fname), O_RDONLY));
+        ssimfile.stage_ok = ValidQ(fd) && MmapFile_LoadFd(ssimfile.mmap, fd);
+    }
+    if (ssimfile.stage_ok) {
+        ssimfile.stage_modtime = acr::FdModTime(ssimfile.mmap.fd.fd);
+        ind_beg(Line_curs,line,ssimfile.mmap.text) {
+            acr::FStagerow &row = stagerow_Alloc(ssimfile);
+            if (Tuple_ReadStrptrMaybe(row.tuple, line)) {
+                row.lineno = ind_curs(line).i+1;
+                row.line = line;
+            } else {
+                stagerow_RemoveLast(ssimfile);
+            }
+        }ind_end;
+    }
+}
+
+// Claim and parse queued ssimfiles until none are left
+static void StageParseAll() {
+    u32 i;
+    while ((i = algo::IncrMT(&acr::_db.stage_next, u32(1)) - 1) < u32(acr::c_stage_N())) {
+        StageParse(*acr::c_stage_Find(i));
+    }
+}
+
+static void *StageThread(void *) {
+    algo_lib::BeginWorker();
+    StageParseAll();
+    algo_lib::EndWorker();
+    return NULL;
+}
+
+// Number of threads to use for N independent units of work (see -nthread)
+int acr::Nthread(int n) {
+    int nthread = acr::_db.cmdline.nthread;
+    if (nthread <= 0) {
+        nthread = i32_Min(int(sysconf(_SC_NPROCESSORS_ONLN)), 16);
+    }
+    return i32_Max(1, i32_Min(nthread, n));
+}
+
+// -----------------------------------------------------------------------------
+
+// Queue ssimfile SSIMFILE for loading by acr::LoadStaged
+void acr::StageSsimfile(acr::FSsimfile &ssimfile) {
+    if (!FileInputQ() && (!ssimfile.c_file || ssimfile.partial)) {
+        acr::c_stage_Insert(ssimfile);
+    }
+}
+
+// Load all ssimfiles queued with acr::StageSsimfile.
+// With more than one thread (see -nthread), the files are read and parsed
+// into per-file staging arrays by loader threads; the calling thread
+// then inserts staged tuples in queue order, so the resulting database
+// (rowids, file order) is the same as with sequential loading.
+void acr::LoadStaged() {
+    int nthread = acr::Nthread(acr::c_stage_N());
+    if (nthread > 1) {
+        u64 start = get_cycles();
+        ind_beg(acr::_db_c_stage_curs, ssimfile, acr::_db) {
+            ssimfile.stage_fname = SsimFname(acr::_db.cmdline.in, ssimfile.ssimfile);
+        }ind_end;
+        acr::_db.stage_next = 0;
+        pthread_t *thread = (pthread_t*)alloca(sizeof(pthread_t) * nthread);
+        bool *started = (bool*)alloca(nthread);
+        for (int i = 1; i < nthread; i++) {
+            started[i] = pthread_create(&thread[i], NULL, StageThread, NULL) == 0;
+        }
+        StageParseAll();// if a thread could not be started, its share is done here
+        for (int i = 1; i < nthread; i++) {
+            if (started[i]) {
+                pthread_join(thread[i], NULL);
+            }
         }
+        acr::AddTime(acr::_db.stats.load_time, start);
     }
+    ind_beg(acr::_db_c_stage_curs, ssimfile, acr::_db) {
+        LoadSsimfile(ssimfile);
+    }ind_end;
+    acr::c_stage_RemoveAll();
 }
 
 // -----------------------------------------------------------------------------
@@ -58,6 +274,7 @@ void acr::LoadSsimfile(acr::FSsimfile& ssimfile) {
 // Associate loaded records with record FILE.
 void acr::ReadLines(acr::FFile &file, algo_lib::InTextFile &in) {
     strptr line;
+    algo::TempstrScope tempstr_scope;
     while (ReadLine(in,line)) {
         Tuple tuple;
         if (Tuple_ReadStrptrMaybe(tuple,line)) {
@@ -122,5 +339,5 @@ bool acr::FileInputQ() {
 // Return true if all records for specified ctype are available and in memory
 bool acr::RecordsLoadedQ(acr::FCtype &ctype) {
     return FileInputQ()
-        || (ctype.c_ssimfile && ctype.c_ssimfile->c_file);
+        || (ctype.c_ssimfile && ctype.c_ssimfile->c_file && !ctype.c_ssimfile->partial);
 }
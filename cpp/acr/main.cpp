@@ -164,16 +164,27 @@ static void Main_BuildRefmap() {
         ind_beg(acr::ctype_c_field_curs, field, ctype) {
             acr::c_child_Insert(*field.p_arg, ctype);
         }ind_end;
+    }ind_end;
+}
+
+// -----------------------------------------------------------------------------
+
+// Set FCtype.show_rowid according to command line
+static void InitShowRowid() {
+    ind_beg(acr::_db_ctype_curs, ctype,acr::_db) {
         // determine if ssimfile requires rowid.
         // do not show rowid if sort is enabled, and sort field is the primary key.
-        ctype.show_rowid = acr::_db.cmdline.rowid;
+        bool show_rowid = acr::_db.cmdline.rowid;
         acr::FField *first_fld = c_field_Find(ctype, 0);
-        if (ctype.show_rowid && first_fld) {
-            ctype.show_rowid = !ctype.c_ssimfile || !(ctype.c_ssimfile->c_ssimsort && ctype.c_ssimfile->c_ssimsort->sortfld == first_fld->field);
+        if (show_rowid && first_fld) {
+            show_rowid = !ctype.c_ssimfile || !(ctype.c_ssimfile->c_ssimsort && ctype.c_ssimfile->c_ssimsort->sortfld == first_fld->field);
+        }
+        // store only if changed: request processes of the query server
+        // share memory with the server until they write to it
+        if (ctype.show_rowid != show_rowid) {
+            ctype.show_rowid = show_rowid;
         }
     }ind_end;
-    // If -in is a file or stdin, load tuples from stdin.
-    // Otherwise, they will be loaded on-demand during query run.
 }
 
 // -----------------------------------------------------------------------------
@@ -203,6 +214,7 @@ static void PrintReport() {
         out << acr::_db.report;
         prlog(out);
     }
+    verblog(algo_lib::_db.temppool.stats);
 }
 
 // -----------------------------------------------------------------------------
@@ -254,15 +266,20 @@ static void InitFieldProps() {
 
 // -----------------------------------------------------------------------------
 
-void acr::Main() {
+// Execute command line acr::_db.cmdline.
+// The schema must already be loaded (see acr::Main).
+// The query server (see acr::Main_Serve) calls this once per request,
+// in a child process.
+void acr::Main_Query() {
     Main_RewriteOpts();
     // determine input/output modes
     // see FileInputQ(), FileOutputQ(), GetOutPath()
     acr::_db.file_input = FileQ(acr::_db.cmdline.in);
 
-    Main_BuildRefmap();
+    InitShowRowid();
+    // If -in is a file or stdin, load tuples from stdin.
+    // Otherwise, they will be loaded on-demand during query run.
     Main_ReadIn();
-    InitFieldProps();
 
     // create main query
     if (acr::_db.cmdline.select || ch_N(acr::_db.cmdline.rename)) {
@@ -292,6 +309,7 @@ void acr::Main() {
         acr::Main_AcrEdit();
     }
     // print command to be executed for each matching tuple
+    u64 start = get_cycles();
     if (ch_N(acr::_db.cmdline.cmd)>0) {
         Main_Cmd();
     }
@@ -302,8 +320,14 @@ void acr::Main() {
     } else if (acr::_db.cmdline.print) {
         Main_Print();
     }
+    acr::AddTime(acr::_db.stats.print_time, start);
     if (acr::_db.cmdline.write) {
+        start = get_cycles();
         acr::WriteFiles();
+        acr::AddTime(acr::_db.stats.write_time, start);
+    }
+    if (acr::_db.cmdline.check && acr::_db.cmdline.changed) {
+        acr::WriteCheckStamps();
     }
     // in interactive mode, return # of files modified
     // amc -e mode uses this flag
@@ -311,5 +335,28 @@ void acr::Main() {
 
         algo_lib::_db.exit_code = acr::_db.report.n_file_mod;
     }
+    if (acr::_db.cmdline.stats) {
+        acr::PrintStatsTotal();
+    }
     PrintReport();
 }
+
+// -----------------------------------------------------------------------------
+
+void acr::Main() {
+    if (algo_lib::_db.cmdline.verbose) {
+        algo_lib::TempstrStatsEnable();// printed by PrintReport
+    }
+    // a running query server answers without loading anything here
+    if (!acr::Main_Client()) {
+        vrfy(acr::LoadTuplesMaybe(acr::_db.cmdline.schema)
+             ,tempstr()<<"where:load_input  "<<algo_lib::DetachBadTags());
+        Main_BuildRefmap();
+        InitFieldProps();// used when loading records (see acr::SetOrigline)
+        if (ch_N(acr::_db.cmdline.serve) > 0) {
+            acr::Main_Serve();
+        } else {
+            acr::Main_Query();
+        }
+    }
+}
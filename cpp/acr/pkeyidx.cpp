@@ -0,0 +1,452 @@
+// (C) 2017-2019 NYSE | Intercontinental Exchange
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contacting ICE: <https://www.theice.com/contact>
+//
+// Target: acr (exe) -- Algo Cross-Reference - ssimfile database & update tool
+// Exceptions: NO
+// Source: cpp/acr/pkeyidx.cpp -- Sidecar pkey index, demand-driven load
+//
+// A read-only acr invocation doesn't have to load an entire ssimfile
+// to find a few records. For each ssimfile, a sidecar index
+// temp/acr_pkey/<path>.pkeyidx maps primary keys, and values of fields that
+// reference other ssimfiles, to the offset, line number and rowid of the
+// line defining the record; it is rebuilt whenever size or modification time
+// of the ssimfile, or the definition of its ctype, changes.
+// Records loaded this way get the same rowids as with a full load;
+// the ssimfile is marked partial, and acr::LoadSsimfile loads the rest of it
+// if a scan turns out to be necessary.
+// Sidecar layout: acr::PkeyidxHdr, NFLD x acr::PkeyidxFld,
+// NENT x acr::PkeyidxEnt sorted by primary key,
+// NREF x acr::PkeyidxEnt (one section per reference field, sorted by field value),
+// key area.
+
+#include "include/acr.h"
+
+// -----------------------------------------------------------------------------
+
+// Lazy loading is only used by read-only invocations with a directory input;
+// anything that modifies, checks or edits the data set
+// sees fully loaded ssimfiles.
+static bool LazyModeQ() {
+    command::acr &cmdline = acr::_db.cmdline;
+    return cmdline.lazy
+        && !acr::FileInputQ()
+        && DirectoryQ(cmdline.in)
+        && DirectoryQ("temp")
+        && !cmdline.write
+        && !cmdline.check
+        && !cmdline.e
+        && !cmdline.my
+        && !cmdline.del
+        && !cmdline.insert
+        && !cmdline.replace
+        && !cmdline.merge
+        && !cmdline.trunc
+        && !cmdline.meta
+        && !ch_N(cmdline.rename);
+}
+
+// Name of sidecar index file for ssimfile FNAME
+static tempstr PkeyidxFname(strptr fname) {
+    tempstr ret("temp/acr_pkey/");
+    tempstr name(fname);
+    Replace(name, "/", ".");
+    ret << name << ".pkeyidx";
+    return ret;
+}
+
+// True if values of FIELD (other than the primary key) are indexed
+static bool RefFieldQ(acr::FField &field) {
+    return &field != c_field_Find(*field.p_ctype, 0) && field.p_arg->c_ssimfile;
+}
+
+// Hash of field definitions of CTYPE that the index depends on
+static u32 PkeyidxSignature(acr::FCtype &ctype) {
+    u32 ret = 0;
+    ind_beg(acr::ctype_c_field_curs, field, ctype) {
+        ret = strptr_Hash(ret, field.field);
+        ret = strptr_Hash(ret, RefFieldQ(field) ? "ref" : "");
+        if (field.c_substr) {
+            ret = strptr_Hash(ret, field.c_substr->srcfield);
+            ret = strptr_Hash(ret, field.c_substr->expr.value);
+        }
+    }ind_end;
+    return ret;
+}
+
+// Header that a current index of SSIMFILE must have
+static acr::PkeyidxHdr PkeyidxHdrFor(acr::FSsimfile &ssimfile) {
+    acr::PkeyidxHdr hdr;
+    struct stat st;
+    if (fstat(ssimfile.mmap.fd.fd.value, &st) == 0) {
+        hdr.mtime = i64(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+        hdr.size  = u64(st.st_size);
+    }
+    hdr.signature = PkeyidxSignature(*ssimfile.p_ctype);
+    return hdr;
+}
+
+// -----------------------------------------------------------------------------
+
+static acr::PkeyidxHdr GetHdr(strptr pkeyidx) {
+    acr::PkeyidxHdr hdr;
+    memcpy(&hdr, pkeyidx.elems, sizeof(hdr));
+    return hdr;
+}
+
+// Get reference field section IDX of index PKEYIDX
+static acr::PkeyidxFld GetFld(strptr pkeyidx, u32 idx) {
+    acr::PkeyidxFld fld;
+    memcpy(&fld, pkeyidx.elems + sizeof(acr::PkeyidxHdr) + sizeof(acr::PkeyidxFld) * idx, sizeof(fld));
+    return fld;
+}
+
+// Get entry IDX of index PKEYIDX
+static acr::PkeyidxEnt GetEnt(strptr pkeyidx, acr::PkeyidxHdr &hdr, u32 idx) {
+    acr::PkeyidxEnt ent;
+    memcpy(&ent, pkeyidx.elems + sizeof(hdr) + sizeof(acr::PkeyidxFld) * hdr.nfld + sizeof(ent) * idx, sizeof(ent));
+    return ent;
+}
+
+// Key of entry ENT of index PKEYIDX
+static strptr GetKey(strptr pkeyidx, acr::PkeyidxHdr &hdr, acr::PkeyidxEnt &ent) {
+    return strptr(pkeyidx.elems + sizeof(hdr) + sizeof(acr::PkeyidxFld) * hdr.nfld
+                  + sizeof(acr::PkeyidxEnt) * (hdr.nent + hdr.nref) + ent.keyoff, ent.keylen);
+}
+
+// -----------------------------------------------------------------------------
+
+// Check that PKEYIDX is a usable index matching header WANT,
+// and that all of its sections and entries point inside the index and the ssimfile.
+static bool PkeyidxValidQ(strptr pkeyidx, acr::PkeyidxHdr &want) {
+    acr::PkeyidxHdr hdr;
+    u64 keyoff = 0;
+    bool ok = elems_N(pkeyidx) >= i32(sizeof(hdr));
+    if (ok) {
+        hdr = GetHdr(pkeyidx);
+        keyoff = sizeof(hdr) + u64(sizeof(acr::PkeyidxFld)) * hdr.nfld
+            + u64(sizeof(acr::PkeyidxEnt)) * (u64(hdr.nent) + hdr.nref);
+        ok = hdr.magic == want.magic
+            && hdr.version == want.version
+            && hdr.mtime == want.mtime
+            && hdr.size == want.size
+            && hdr.signature == want.signature
+            && u64(elems_N(pkeyidx)) >= keyoff;
+    }
+    for (u32 i = 0; ok && i < hdr.nfld; i++) {
+        acr::PkeyidxFld fld = GetFld(pkeyidx, i);
+        ok = fld.beg >= hdr.nent && u64(fld.beg) + fld.n <= u64(hdr.nent) + hdr.nref;
+    }
+    for (u32 i = 0; ok && i < hdr.nent + hdr.nref; i++) {
+        acr::PkeyidxEnt ent = GetEnt(pkeyidx, hdr, i);
+        ok = keyoff + ent.keyoff + ent.keylen <= u64(elems_N(pkeyidx))
+            && u64(ent.lineoff) + ent.linelen <= want.size;
+    }
+    return ok;
+}
+
+// -----------------------------------------------------------------------------
+
+// Sort entries of BUILD by key and append them to ENTS and KEYS
+static void PkeyidxAppend(acr::FPkeybuild &build, cstring &ents, cstring &keys) {
+    ent_QuickSort(build);
+    ind_beg(acr::pkeybuild_ent_curs, ent, build) {
+        acr::PkeyidxEnt idxent;
+        idxent.keyoff  = ch_N(keys);
+        idxent.keylen  = ch_N(ent.key);
+        idxent.lineoff = ent.lineoff;
+        idxent.linelen = ent.linelen;
+        idxent.lineno  = ent.lineno;
+        idxent.rowid   = ent.rowid;
+        ents << strptr((char*)&idxent, sizeof(idxent));
+        keys << ent.key;
+    }ind_end;
+}
+
+// Build index of ssimfile SSIMFILE (mapped into SSIMFILE.PKEYDATA) into OUT.
+// The index is marked unusable unless each line either defines a record of the ssimfile
+// with a distinct primary key, or doesn't define a record at all --
+// only then does a record loaded by itself get the same rowid as with a full load.
+static void PkeyidxBuild(acr::FSsimfile &ssimfile, acr::PkeyidxHdr &hdr, cstring &out) {
+    acr::FCtype &ctype = *ssimfile.p_ctype;
+    acr::FPkeybuild build;
+    strptr text = ssimfile.mmap.text;
+    algo::Smallstr50 pkeyname = name_Get(*c_field_Find(ctype, 0));
+    bool usable = u64(elems_N(text)) == hdr.size;
+    u32 nfld = 0;
+    ind_beg(acr::ctype_c_field_curs, field, ctype) {
+        nfld += RefFieldQ(field);
+    }ind_end;
+    ind_beg(Line_curs,line,text) {
+        algo::Tuple tuple;
+        if (usable && Tuple_ReadStrptrMaybe(tuple, line) && ch_N(tuple.head.value) > 0) {
+            algo::Attr *attr = attr_Find(tuple, pkeyname);
+            usable = tuple.head.value == strptr(ssimfile.ssimfile)
+                && attr
+                && !attr_Find(tuple, "acr.rowid");
+            if (usable) {
+                acr::FPkeyent &ent = ent_Alloc(build);
+                ent.key     = attr->value;
+                ent.lineoff = u32(line.elems - text.elems);
+                ent.linelen = u32(elems_N(line));
+                ent.lineno  = ind_curs(line).i+1;
+                ent.rowid   = ent_N(build)-1;
+                ind_beg(acr::ctype_c_field_curs, field, ctype) if (RefFieldQ(field)) {
+                    acr::FPkeyent &ref = ref_Alloc(build);
+                    ref         = ent;
+                    ref.key     = acr::EvalAttr(tuple, field);
+                }ind_end;
+            }
+        }
+    }ind_end;
+    tempstr flds, ents, keys;
+    if (usable) {
+        PkeyidxAppend(build, ents, keys);
+        for (int i = 1; usable && i < ent_N(build); i++) {
+            usable = ent_qFind(build, i-1).key != ent_qFind(build, i).key;
+        }
+    }
+    hdr.nent = usable ? ent_N(build) : 0;
+    hdr.nref = 0;
+    hdr.nfld = 0;
+    if (usable) {
+        u32 ifld = 0;
+        ind_beg(acr::ctype_c_field_curs, field, ctype) if (RefFieldQ(field)) {
+            ent_RemoveAll(build);
+            for (int i = ifld; i < ref_N(build); i += nfld) {
+                ent_Alloc(build) = ref_qFind(build, i);
+            }
+            acr::PkeyidxFld fld;
+            fld.field = ind_curs(field).index;
+            fld.beg   = hdr.nent + hdr.nref;
+            fld.n     = ent_N(build);
+            flds << strptr((char*)&fld, sizeof(fld));
+            PkeyidxAppend(build, ents, keys);
+            hdr.nref += fld.n;
+            hdr.nfld++;
+            ifld++;
+        }ind_end;
+    } else {
+        ch_RemoveAll(ents);
+        ch_RemoveAll(keys);
+    }
+    hdr.usable = usable;
+    ch_RemoveAll(out);
+    out << strptr((char*)&hdr, sizeof(hdr)) << flds << ents << keys;
+}
+
+// Write index PKEYIDX to FNAME, replacing it atomically.
+// Failure is not an error: the index is rebuilt next time.
+static void PkeyidxSave(strptr fname, strptr pkeyidx) {
+    tempstr dirname(GetDirName(fname));
+    if (!FileObjectExistsQ(dirname)) {
+        (void)mkdir(Zeroterm(dirname),0755);
+    }
+    tempstr newfile;
+    newfile << fname << "." << getpid();
+    algo_lib::FFildes fildes;
+    fildes.fd = OpenWrite(newfile);
+    bool ok = ValidQ(fildes.fd)
+        && WriteFile(fildes.fd, (u8*)pkeyidx.elems, elems_N(pkeyidx));
+    ok = ok && rename(Zeroterm(newfile), Zeroterm(tempstr() << fname)) == 0;
+    if (!ok) {
+        (void)unlink(Zeroterm(newfile));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Open (or build) the pkey index of SSIMFILE.
+// Return TRUE if the index can be used to load records individually.
+static bool PkeyidxQ(acr::FSsimfile &ssimfile) {
+    if (bool_Update(ssimfile.pkeyidx_tried, true)
+        && LazyModeQ()
+        && c_field_N(*ssimfile.p_ctype) > 0
+        && MmapFile_Load(ssimfile.mmap, SsimFname(acr::_db.cmdline.in, ssimfile.ssimfile))) {
+        acr::PkeyidxHdr hdr = PkeyidxHdrFor(ssimfile);
+        tempstr fname(PkeyidxFname(SsimFname(acr::_db.cmdline.in, ssimfile.ssimfile)));
+        strptr pkeyidx;
+        if (hdr.size > u64(UINT32_MAX)) {
+            // line offsets in the index are 32-bit; such a file is always loaded in full
+            verblog("acr.pkeyidx"
+                    <<Keyval("fname",fname)
+                    <<Keyval("comment","ssimfile too large for pkey index"));
+        } else if (MmapFile_Load(ssimfile.pkeyidx_map, fname) && PkeyidxValidQ(ssimfile.pkeyidx_map.text, hdr)) {
+            pkeyidx = ssimfile.pkeyidx_map.text;
+        } else {
+            PkeyidxBuild(ssimfile, hdr, ssimfile.pkeyidx_buf);
+            PkeyidxSave(fname, ssimfile.pkeyidx_buf);
+            pkeyidx = ssimfile.pkeyidx_buf;
+            verblog("acr.pkeyidx"
+                    <<Keyval("fname",fname)
+                    <<Keyval("nent",hdr.nent)
+                    <<Keyval("nref",hdr.nref)
+                    <<Keyval("usable",bool(hdr.usable)));
+        }
+        if (elems_N(pkeyidx) > 0 && GetHdr(pkeyidx).usable) {
+            ssimfile.pkeyidx = pkeyidx;
+        }
+    }
+    return elems_N(ssimfile.pkeyidx) > 0;
+}
+
+// -----------------------------------------------------------------------------
+
+// True if records of SSIMFILE that are not yet in memory
+// should be loaded one by one using acr::LoadPkey
+bool acr::LazyLoadQ(acr::FSsimfile &ssimfile) {
+    return !FileInputQ()
+        && (!ssimfile.c_file || ssimfile.partial)
+        && PkeyidxQ(ssimfile);
+}
+
+// Number of records in SSIMFILE according to its pkey index.
+// SSIMFILE must have a usable index (e.g. be partially loaded).
+u32 acr::LazyNrec(acr::FSsimfile &ssimfile) {
+    return GetHdr(ssimfile.pkeyidx).nent;
+}
+
+// Associate an input file with SSIMFILE without loading any records
+static void BeginPartial(acr::FSsimfile &ssimfile) {
+    if (!ssimfile.c_file) {
+        acr::FFile &file = acr::ind_file_GetOrCreate(SsimFname(acr::_db.cmdline.in, ssimfile.ssimfile));
+        ssimfile.c_file = &file;
+        file.autoloaded = true;
+        file.filename = file.file; // save filename
+        file.modtime = acr::FdModTime(ssimfile.mmap.fd.fd);
+        ssimfile.partial = true;
+        verblog("acr.load"<<Keyval("fname",file.file)<<Keyval("partial",true));
+    }
+}
+
+// Records of a partially loaded ssimfile are loaded out of order.
+// Move record REC, which was just loaded, within list of records of its ctype
+// so that the list is in rowid order -- the same order as with a full load.
+void acr::PlaceRec(acr::FRec &rec) {
+    acr::FRec *first = NULL;
+    for (acr::FRec *prev = zd_trec_Prev(rec); prev && prev->sortkey.rowid > rec.sortkey.rowid; prev = zd_trec_Prev(*prev)) {
+        first = prev;
+    }
+    // move records that belong after REC to the end of the list
+    while (first && first != &rec) {
+        acr::FRec *next = zd_trec_Next(*first);
+        zd_trec_Remove(*rec.p_ctype, *first);
+        zd_trec_Insert(*rec.p_ctype, *first);
+        first = next;
+    }
+}
+
+// Load record described by index entry ENT, unless it's already loaded
+static void LoadEnt(acr::FSsimfile &ssimfile, acr::PkeyidxEnt &ent) {
+    acr::FCtype &ctype = *ssimfile.p_ctype;
+    BeginPartial(ssimfile);
+    algo::Tuple tuple;
+    strptr line = qGetRegion(ssimfile.mmap.text, ent.lineoff, ent.linelen);
+    if (Tuple_ReadStrptrMaybe(tuple, line)) {
+        algo::Attr *attr = attr_Find(tuple, name_Get(*c_field_Find(ctype, 0)));
+        if (attr && !acr::ind_rec_Find(ctype, attr->value)) {
+            float next_rowid = ctype.next_rowid;
+            ctype.next_rowid = ent.rowid;
+            ssimfile.c_file->lineno = ent.lineno;
+            int nattr = attrs_N(tuple);
+            if (acr::FRec *rec = acr::ReadTuple(tuple, *ssimfile.c_file, true)) {
+                acr::SetOrigline(*rec, line, nattr);
+                acr::PlaceRec(*rec);
+            }
+            ctype.next_rowid = float_Max(next_rowid, ctype.next_rowid);
+        }
+    }
+}
+
+// Index of first entry of PKEYIDX in range [BEG,END) whose key is not less than KEY
+static u32 LowerBound(strptr pkeyidx, acr::PkeyidxHdr &hdr, u32 beg, u32 end, strptr key) {
+    while (beg < end) {
+        u32 mid = beg + (end - beg) / 2;
+        acr::PkeyidxEnt ent = GetEnt(pkeyidx, hdr, mid);
+        if (strptr_Lt(GetKey(pkeyidx, hdr, ent), key)) {
+            beg = mid + 1;
+        } else {
+            end = mid;
+        }
+    }
+    return beg;
+}
+
+// Load records described by entries in range [BEG,END) of index of SSIMFILE
+// whose key equals KEY (or starts with KEY, if PREFIX is set)
+static void LoadRange(acr::FSsimfile &ssimfile, u32 beg, u32 end, strptr key, bool prefix) {
+    u64 start = get_cycles();
+    strptr pkeyidx = ssimfile.pkeyidx;
+    acr::PkeyidxHdr hdr = GetHdr(pkeyidx);
+    algo::TempstrScope tempstr_scope;
+    for (u32 idx = LowerBound(pkeyidx, hdr, beg, end, key); idx < end; idx++) {
+        acr::PkeyidxEnt ent = GetEnt(pkeyidx, hdr, idx);
+        strptr entkey = GetKey(pkeyidx, hdr, ent);
+        if (prefix ? !StartsWithQ(entkey, key) : entkey != key) {
+            break;
+        }
+        LoadEnt(ssimfile, ent);
+        acr::_db.stats.n_lazyrec++;
+    }
+    acr::AddTime(acr::_db.stats.load_time, start);
+}
+
+// -----------------------------------------------------------------------------
+
+// Find record of CTYPE with primary key PKEY, loading it from disk if necessary.
+// If the ssimfile has a usable pkey index, only the line defining the record is parsed;
+// otherwise the whole ssimfile is loaded.
+acr::FRec *acr::LoadPkey(acr::FCtype &ctype, strptr pkey) {
+    if (acr::FSsimfile *ssimfile = ctype.c_ssimfile) {
+        if (LazyLoadQ(*ssimfile)) {
+            LoadRange(*ssimfile, 0, GetHdr(ssimfile->pkeyidx).nent, pkey, false);
+        } else {
+            LoadSsimfile(*ssimfile);
+        }
+    }
+    return acr::ind_rec_Find(ctype, pkey);
+}
+
+// Make sure all records of CTYPE whose primary key starts with PREFIX are in memory.
+void acr::LoadPkeyPrefix(acr::FCtype &ctype, strptr prefix) {
+    if (acr::FSsimfile *ssimfile = ctype.c_ssimfile) {
+        if (LazyLoadQ(*ssimfile)) {
+            LoadRange(*ssimfile, 0, GetHdr(ssimfile->pkeyidx).nent, prefix, true);
+        } else {
+            LoadSsimfile(*ssimfile);
+        }
+    }
+}
+
+// Make sure all records of FIELD's ctype where FIELD has value VALUE are in memory.
+// FIELD must reference an ssimfile.
+void acr::LoadFieldValue(acr::FField &field, strptr value) {
+    if (acr::FSsimfile *ssimfile = field.p_ctype->c_ssimfile) {
+        if (&field == c_field_Find(*field.p_ctype, 0)) {
+            (void)LoadPkey(*field.p_ctype, value);
+        } else if (LazyLoadQ(*ssimfile)) {
+            acr::PkeyidxHdr hdr = GetHdr(ssimfile->pkeyidx);
+            for (u32 i = 0; i < hdr.nfld; i++) {
+                acr::PkeyidxFld fld = GetFld(ssimfile->pkeyidx, i);
+                if (c_field_Find(*field.p_ctype, fld.field) == &field) {
+                    LoadRange(*ssimfile, fld.beg, fld.beg + fld.n, value, false);
+                }
+            }
+        } else {
+            LoadSsimfile(*ssimfile);
+        }
+    }
+}
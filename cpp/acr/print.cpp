@@ -46,6 +46,9 @@
 // Then we enter plines into a heap index. The key is (#up-links, relation rank)
 // We take a record off the top of the heap, print it, then scan the down-links and reduce their
 // up-link count by 1. This is like a topological sort.
+// Without tree display, there are no up-links, and the heap order is simply (ctype rank, rowid).
+// In that case, records are printed ctype by ctype, and plines exist only for the current group,
+// so memory doesn't grow with the size of the selection, and output starts right away.
 
 #include "include/acr.h"
 
@@ -246,6 +249,17 @@ static void CreateCtypeRank() {
 
 // -----------------------------------------------------------------------------
 
+// Initialize RANK field for every known ctype, unless already done.
+// The query server (see acr::Main_Serve) does this before forking,
+// so that request processes don't have to.
+void acr::InitCtypeRank() {
+    if (bool_Update(acr::_db.ctype_rank_computed,true)) {
+        CreateCtypeRank();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 // Create a heap of all currently selected records
 static void CreateRecPline(acr::FPrint &print) {
     ind_beg(acr::_db_zd_all_selrec_curs, rec,acr::_db) {
@@ -378,6 +392,73 @@ static bool DetectNewGroup(acr::FPrint &print, acr::FPline *pline) {
 
 // -----------------------------------------------------------------------------
 
+// Make sure selected records of CTYPE are listed in rowid order.
+// Records are usually selected in the order they were loaded; if not,
+// reorder the list using the pline heap.
+static void SortSelrec(acr::FCtype &ctype) {
+    bool sorted = true;
+    acr::FRec *prev = NULL;
+    ind_beg(acr::ctype_zd_selrec_curs, rec, ctype) {
+        sorted = sorted && !(prev && rec.sortkey.rowid < prev->sortkey.rowid);
+        prev = &rec;
+    }ind_end;
+    if (!sorted) {
+        ind_beg(acr::ctype_zd_selrec_curs, rec, ctype) {
+            acr::FPline& pline = acr::pline_Alloc();
+            pline.key.rowid    = rec.sortkey.rowid;
+            pline.p_rec        = &rec;
+            (void)acr::pline_XrefMaybe(pline);
+            acr::bh_pline_Reheap(pline);
+        }ind_end;
+        while (acr::FPline *pline = acr::bh_pline_RemoveFirst()) {
+            acr::zd_selrec_Remove(ctype, *pline->p_rec);
+            acr::zd_selrec_Insert(ctype, *pline->p_rec);
+            acr::pline_Delete(*pline);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Print selected records without tree display.
+// Records are visited ctype by ctype, in the same order as the pline heap would produce,
+// and each group is printed and released as soon as it ends.
+static void StreamRecs(acr::FPrint &print) {
+    acr::c_ctype_RemoveAll(print);
+    ind_beg(acr::_db_ctype_curs, ctype, acr::_db) if (!zd_selrec_EmptyQ(ctype)) {
+        acr::c_ctype_Insert(print, ctype);
+    }ind_end;
+    acr::c_ctype_QuickSort(print);
+    ind_beg(acr::print_c_ctype_curs, ctype, print) {
+        SortSelrec(ctype);
+        ind_beg(acr::ctype_zd_selrec_curs, rec, ctype) if (print.showstatus || !rec.del) {
+            acr::FPline& pline   = acr::pline_Alloc();
+            pline.key.ctype_rank = ctype.rank;
+            pline.key.rowid      = rec.sortkey.rowid;
+            pline.p_rec          = &rec;
+            (void)acr::pline_XrefMaybe(pline);
+            bool end_group = DetectNewGroup(print,&pline);
+            if (end_group) {
+                EndGroup(print);
+                FlushStdout(print);
+                // plines of the printed group are no longer needed
+                while (acr::zd_pline_First() != &pline) {
+                    acr::pline_Delete(*acr::zd_pline_First());
+                }
+            }
+            if (!end_group && print.pretty) {
+                UpdateAttrWidth(pline,print);
+            }
+            c_pline_Insert(print, pline);
+        }ind_end;
+    }ind_end;
+    DetectNewGroup(print,NULL);
+    EndGroup(print);
+    acr::c_ctype_RemoveAll(print);
+}
+
+// -----------------------------------------------------------------------------
+
 // Print selected records using formatting options
 // specified on command line.
 void acr::Print(acr::FPrint &print) {
@@ -386,37 +467,39 @@ void acr::Print(acr::FPrint &print) {
         PrintCtypeComments(print);
     }
 
-    if (bool_Update(acr::_db.ctype_rank_computed,true)) {
-        CreateCtypeRank();
-    }
-
-    // create pline for each selected record
-    CreateRecPline(print);
+    acr::InitCtypeRank();
 
-    // print in groups.
-    // align with each group
-    acr::FPline *pline = NULL;
-    int iter = 0;
-
-    do {
-        pline = acr::bh_pline_RemoveFirst();
-        bool end_group = DetectNewGroup(print,pline);
-        if (end_group) {
-            EndGroup(print);
-        }
-        // update alignment -- compute width of all attributes in the tuple
-        if (!end_group && print.pretty) {
-            UpdateAttrWidth(*pline,print);
-        }
-        // add pline to c_pline list, release its children
-        if (pline) {
-            ReleaseChildren(*pline);
-            c_pline_Insert(print, *pline);
-        }
-        if (iter++ % 32 == 0) {
-            FlushStdout(print);
-        }
-    } while (pline);
+    if (!print.tree) {
+        StreamRecs(print);
+    } else {
+        // create pline for each selected record
+        CreateRecPline(print);
+
+        // print in groups.
+        // align with each group
+        acr::FPline *pline = NULL;
+        int iter = 0;
+
+        do {
+            pline = acr::bh_pline_RemoveFirst();
+            bool end_group = DetectNewGroup(print,pline);
+            if (end_group) {
+                EndGroup(print);
+            }
+            // update alignment -- compute width of all attributes in the tuple
+            if (!end_group && print.pretty) {
+                UpdateAttrWidth(*pline,print);
+            }
+            // add pline to c_pline list, release its children
+            if (pline) {
+                ReleaseChildren(*pline);
+                c_pline_Insert(print, *pline);
+            }
+            if (iter++ % 32 == 0) {
+                FlushStdout(print);
+            }
+        } while (pline);
+    }
 
     // Scan all selected records. Print something about each field.
     if (print.cmt) {
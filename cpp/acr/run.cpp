@@ -73,11 +73,115 @@ static void ScheduleCascadeUpdate(acr::FRec& rec, strptr old_val, strptr new_val
 
 // -----------------------------------------------------------------------------
 
+// Discard value indexes of CTYPE's fields, and resolved references
+// of CTYPE and of ctypes that reference CTYPE (see XrefBuild).
+// Must be called whenever a record of CTYPE is created, deleted, or modified.
+void acr::AttrvalInvalidate(acr::FCtype &ctype) {
+    if (ctype.attrval_built) {
+        ind_beg(acr::ctype_c_field_curs, field, ctype) if (field.attrval_built) {
+            while (acr::FAttrval *attrval = acr::tr_attrval_First(field)) {
+                acr::attrval_Delete(*attrval);
+            }
+            field.attrval_built = false;
+        }ind_end;
+        ctype.attrval_built = false;
+    }
+    ctype.xref_built = false;
+    if (ctype.xref_target) {
+        ind_beg(acr::ctype_c_child_curs, child, ctype) {
+            child.xref_built = false;
+        }ind_end;
+        ctype.xref_target = false;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Index all records of FIELD's ctype by value of FIELD.
+// The index is kept until a record of the ctype changes, so subsequent queries
+// on the same field are lookups.
+static void AttrvalBuild(acr::FField &field) {
+    if (!field.attrval_built) {
+        ind_beg(acr::ctype_zd_trec_curs, rec, *field.p_ctype) {
+            tempstr val(acr::EvalAttr(rec.tuple, field));
+            acr::FAttrval *attrval = acr::ind_attrval_Find(field, val);
+            if (!attrval) {
+                attrval          = &acr::attrval_Alloc();
+                attrval->value   = val;
+                attrval->p_field = &field;
+                (void)acr::attrval_XrefMaybe(*attrval);
+            }
+            c_rec_Insert(*attrval, rec);
+        }ind_end;
+        field.attrval_built          = true;
+        field.p_ctype->attrval_built = true;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Length of literal prefix of SQL expression VALUE (up to the first special character),
+// which any matching string starts with.
+// Return -1 if VALUE has no usable prefix (e.g. it starts with % or uses alternation),
+// or if it contains characters that Regx_ReadSql passes to the regex as-is
+// (+ [ ] and the reserved { } ^ $), which are handled by a scan instead.
+static int SqlPrefixN(strptr value) {
+    int n = elems_N(value);
+    int prefix = 0;
+    while (prefix < n && algo::FindChar("%_\\()|", value[prefix]) == -1) {
+        prefix++;
+    }
+    bool regx = false;
+    frep_(i,n) {
+        regx = regx || algo::FindChar("+[]{}^$", value[i]) != -1;
+    }
+    bool ok = !regx && (prefix == n || (prefix > 0 && FindChar(value, '(') == -1 && FindChar(value, '|') == -1));
+    return ok ? prefix : -1;
+}
+
+// -----------------------------------------------------------------------------
+
+// Add to RUN.C_REC candidate records for SQL expression VALUE using the value index of FIELD:
+// records with value equal to VALUE if it's a literal, or else starting with the literal prefix of VALUE
+// (VisitField then applies the full expression).
+// Return FALSE if VALUE has no usable prefix (e.g. it starts with % or uses alternation).
+static bool AttrvalSelect(acr::FRun &run, acr::FField &field, strptr value) {
+    int n = elems_N(value);
+    int prefix = SqlPrefixN(value);
+    bool ret = prefix >= 0;
+    if (ret) {
+        AttrvalBuild(field);
+        if (prefix == n) {
+            if (acr::FAttrval *attrval = acr::ind_attrval_Find(field, value)) {
+                ind_beg(acr::attrval_c_rec_curs, rec, *attrval) {
+                    c_rec_Insert(run, rec);
+                }ind_end;
+            }
+        } else {
+            tempstr lit(FirstN(value, prefix));
+            acr::FAttrval *attrval = acr::tr_attrval_FirstGe(field, lit);
+            for (; attrval && StartsWithQ(attrval->value, lit); attrval = acr::tr_attrval_Next(*attrval)) {
+                ind_beg(acr::attrval_c_rec_curs, rec, *attrval) {
+                    c_rec_Insert(run, rec);
+                }ind_end;
+            }
+        }
+    }
+    return ret;
+}
+
+// -----------------------------------------------------------------------------
+
 static void VisitField(acr::FQuery& query, acr::FRec& rec, acr::FField &field, algo_lib::Regx &value_regx) {
     acr::FEvalattr evalattr;
     evalattr.field = &field;
     Evalattr_Step(evalattr, rec.tuple);
     bool         match  = Regx_Match(value_regx, query.pk?rec.pkey:evalattr.value);
+    acr::_db.stats.n_field++;
+    acr::_db.stats.n_regx++;
+    if (match && query.queryop != acr_Queryop_value_select) {
+        acr::AttrvalInvalidate(*rec.p_ctype);
+    }
     if (match) {
         Attr   *attr      = attr_Find(rec.tuple, name_Get(field), 0);
         switch(value_GetEnum(query.queryop)) {
@@ -126,11 +230,83 @@ static void VisitField(acr::FQuery& query, acr::FRec& rec, acr::FField &field, a
 
 // -----------------------------------------------------------------------------
 
+// Number of records of CTYPE, including records of a partially loaded ssimfile
+// that are not yet in memory
+static u32 NrecTotal(acr::FCtype &ctype) {
+    acr::FSsimfile *ssimfile = ctype.c_ssimfile;
+    return ssimfile && ssimfile->partial ? acr::LazyNrec(*ssimfile) : u32(acr::ind_rec_N(ctype));
+}
+
+// True if records of CHILD that reference a selected record
+// can be loaded using the pkey index (see acr::LoadFieldValue).
+// A ctype that references itself must be scanned, since records selected
+// during the scan may be referenced by other records.
+// When a large part of a referenced ctype is selected, most of CHILD will be
+// loaded anyway, and loading the whole ssimfile (in parallel with others) is cheaper.
+static bool SelectDown_PkeyQ(acr::FCtype &child) {
+    bool ret = child.c_ssimfile && c_field_N(child) > 0 && !acr::RecordsLoadedQ(child);
+    ind_beg(acr::ctype_c_field_curs, field, child) {
+        ret = ret && field.p_arg != &child;
+    }ind_end;
+    ret = ret && acr::LazyLoadQ(*child.c_ssimfile);
+    ind_beg(acr::ctype_c_field_curs, field, child) if (ret && field.p_arg->c_ssimfile) {
+        u32 nsel = 0;
+        ind_beg(acr::ctype_zd_selrec_curs, parrec, *field.p_arg) {
+            nsel += parrec.seldist <= 0;
+        }ind_end;
+        ret = nsel < 64 || nsel * 4 < NrecTotal(*field.p_arg);
+    }ind_end;
+    return ret;
+}
+
+// Load records of CHILD that may reference a selected record
+static void SelectDown_LoadRefs(acr::FCtype &child) {
+    ind_beg(acr::ctype_c_field_curs, field, child) if (field.p_arg->c_ssimfile) {
+        ind_beg(acr::ctype_zd_selrec_curs, parrec, *field.p_arg) if (parrec.seldist <= 0) {
+            acr::LoadFieldValue(field, parrec.pkey);
+        }ind_end;
+    }ind_end;
+}
+
+// Resolve references of all records of CTYPE to parent records (FRec.c_parent).
+// References are resolved one field at a time, so the parent index is probed
+// in a tight loop, and a run of records with the same value is looked up once.
+// The result is kept until a record of CTYPE or of a parent ctype changes,
+// so each -ndown level and each subsequent query scans pointers only.
+static void XrefBuild(acr::FCtype &ctype) {
+    if (!ctype.xref_built) {
+        ind_beg(acr::ctype_zd_trec_curs, rec, ctype) {
+            c_parent_RemoveAll(rec);
+        }ind_end;
+        ind_beg(acr::ctype_c_field_curs, field, ctype) if (field.p_arg->c_ssimfile) {
+            field.p_arg->xref_target = true;
+            tempstr prev;
+            acr::FRec *parrec = NULL;
+            bool first = true;
+            ind_beg(acr::ctype_zd_trec_curs, rec, ctype) {
+                tempstr val(EvalAttr(rec.tuple, field));
+                if (first || val != prev) {
+                    parrec = acr::ind_rec_Find(*field.p_arg, val);
+                    prev = val;
+                    first = false;
+                }
+                if (parrec) {
+                    c_parent_Insert(rec, *parrec);
+                }
+            }ind_end;
+        }ind_end;
+        ctype.xref_built = true;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 // extend front down
 // if the select record is a pkey, and it is being referenced by another pkey,
 // we can select the source record with a direct lookup.
 // if the reference is from a non-indexed column, we must scan the ssimfile.
-// we currently always scan the entrie ssimfile.
+// with a pkey index, only child records that reference selected records
+// are loaded (see acr::LoadFieldValue); otherwise, child ssimfiles are loaded entirely.
 static int SelectDown(acr::FRun &run, acr::FQuery &query) {
     int nmatch=0;
     // find the set of all ssimfiles which may reference records selected so far.
@@ -150,15 +326,25 @@ static int SelectDown(acr::FRun &run, acr::FQuery &query) {
     // walk all records of each ssimfile
     // add records which reference one of selected records
     ind_beg(acr::run_c_child_curs, child, run) {
-        if (child.c_ssimfile && !child.c_ssimfile->c_file) {
+        if (child.c_ssimfile && !SelectDown_PkeyQ(child)) {
+            acr::StageSsimfile(*child.c_ssimfile);
+        }
+    }ind_end;
+    acr::LoadStaged();
+    ind_beg(acr::run_c_child_curs, child, run) {
+        // records selected earlier in this pass may be referenced by CHILD,
+        // so pkey loads are done just before CHILD is scanned
+        if (SelectDown_PkeyQ(child)) {
+            SelectDown_LoadRefs(child);
+        } else if (child.c_ssimfile) {
             acr::LoadSsimfile(*child.c_ssimfile);
         }
+        XrefBuild(child);
         ind_beg(acr::ctype_zd_trec_curs, rec, child) {
-            ind_beg(acr::ctype_c_field_curs,  field, child) if (field.p_arg->c_ssimfile) {
-                tempstr val(EvalAttr(rec.tuple, field));
-                acr::FRec *parrec = acr::ind_rec_Find(*field.p_arg, val);
-                bool good = parrec;
-                good = good && parrec->seldist <= 0;
+            acr::_db.stats.n_xrefrec++;
+            ind_beg(acr::rec_c_parent_curs, parrec_, rec) {
+                acr::FRec *parrec = &parrec_;
+                bool good = parrec->seldist <= 0;
                 good = good && acr::zd_all_selrec_InLlistQ(*parrec);
                 if (query.unused) {
                     // "unused" option -- instead of selecting child,
@@ -187,19 +373,29 @@ static int SelectDown(acr::FRun &run, acr::FQuery &query) {
 // -----------------------------------------------------------------------------
 
 static void SelectUp(acr::FRun &, acr::FQuery &query) {
+    // read referenced ssimfiles if necessary
+    ind_beg(acr::_db_zd_all_selrec_curs, rec,acr::_db) {
+        rec.p_ctype->visit=false;
+    }ind_end;
+    ind_beg(acr::_db_zd_all_selrec_curs, rec,acr::_db) {
+        if (rec.seldist >= 0 && rec.seldist < query.nup && bool_Update(rec.p_ctype->visit,true)) {
+            ind_beg(acr::ctype_c_field_curs,  field, *rec.p_ctype) if (field.p_arg->c_ssimfile) {
+                if (!acr::LazyLoadQ(*field.p_arg->c_ssimfile)) {// parents are looked up by pkey
+                    acr::StageSsimfile(*field.p_arg->c_ssimfile);
+                }
+            }ind_end;
+        }
+    }ind_end;
+    acr::LoadStaged();
     // run through selected records, add new ones to the front
     ind_beg(acr::_db_zd_all_selrec_curs, rec,acr::_db) {
         if (rec.seldist >= 0 && rec.seldist < query.nup) {
+            acr::_db.stats.n_xrefrec++;
             ind_beg(acr::ctype_c_field_curs,  field, *rec.p_ctype) if (field.p_arg->c_ssimfile) {
-                // read ssimfile if necessary
-                acr::FSsimfile *rel = field.p_arg->c_ssimfile;
-                if (!rel->c_file) {
-                    acr::LoadSsimfile(*rel);
-                }
-                // look up item in the parent record.
+                // look up item in the parent record, reading it from disk if necessary.
                 // if found -- add that record to the match set
                 tempstr val(EvalAttr(rec.tuple, field));
-                acr::FRec *parrec = acr::ind_rec_Find(*field.p_arg, val);
+                acr::FRec *parrec = acr::LoadPkey(*field.p_arg, val);
                 if (parrec && Rec_Select(*parrec)) {
                     parrec->seldist = rec.seldist + 1;
                 }
@@ -210,37 +406,65 @@ static void SelectUp(acr::FRun &, acr::FQuery &query) {
 
 // -----------------------------------------------------------------------------
 
-static void VisitRecords(acr::FRun &run, acr::FQuery &query) {
-    ind_beg(acr::run_c_ctype_curs, ctype, run) if (c_field_N(ctype) > 0) {
-        // specifying an
-        bool is_pkey = !ch_N(query.field);
-        is_pkey |= query.field == name_Get(*c_field_Find(ctype, 0));
-
-        // determine set of fields to scan
-        // if query is for pkey, we already have that indexed.
-        c_field_RemoveAll(run);
-        if (is_pkey) {
-            c_field_Insert(run, *c_field_Find(ctype, 0));
-        } else {
-            ind_beg(acr::ctype_c_field_curs, field, ctype) {
-                if (Regx_Match(run.field_regx, name_Get(field))) {
-                    c_field_Insert(run, field);
-                }
-            }ind_end;
+// Compute RUN.C_FIELD: fields of CTYPE to scan for QUERY.
+// Return TRUE if the query is on the primary key.
+static bool SelectFields(acr::FRun &run, acr::FCtype &ctype, acr::FQuery &query) {
+    // specifying an
+    bool is_pkey = !ch_N(query.field);
+    is_pkey |= query.field == name_Get(*c_field_Find(ctype, 0));
+
+    // determine set of fields to scan
+    // if query is for pkey, we already have that indexed.
+    c_field_RemoveAll(run);
+    if (is_pkey) {
+        c_field_Insert(run, *c_field_Find(ctype, 0));
+    } else {
+        ind_beg(acr::ctype_c_field_curs, field, ctype) {
+            acr::_db.stats.n_regx++;
+            if (Regx_Match(run.field_regx, name_Get(field))) {
+                c_field_Insert(run, field);
+            }
+        }ind_end;
+    }
+    return is_pkey;
+}
+
+// -----------------------------------------------------------------------------
+
+// Compute RUN.C_REC: records of CTYPE to scan for QUERY, using an index.
+// Return FALSE if no index applies, and all records of CTYPE must be scanned.
+static bool IndexSelect(acr::FRun &run, acr::FCtype &ctype, acr::FQuery &query, bool is_pkey) {
+    // a query for a single non-pkey field uses the value index, if possible
+    c_rec_RemoveAll(run);
+    bool use_attrval = !is_pkey && !query.pk && c_field_N(run) == 1 && !algo_lib::SqlRegxQ(query.field);
+    bool ret = true;
+    if (is_pkey && !algo_lib::SqlRegxQ(query.value)) {
+        acr::FRec *rec = acr::ind_rec_Find(ctype, query.value);
+        if (rec) {
+            c_rec_Insert(run, *rec);
         }
+    } else if (use_attrval && AttrvalSelect(run, *c_field_Find(run, 0), query.value)) {
+        // records selected via value index
+    } else {
+        ret = false;
+    }
+    acr::_db.stats.n_index += ret;
+    return ret;
+}
+
+// -----------------------------------------------------------------------------
 
+static void VisitRecords(acr::FRun &run, acr::FQuery &query) {
+    ind_beg(acr::run_c_ctype_curs, ctype, run) if (c_field_N(ctype) > 0) {
+        bool is_pkey = SelectFields(run, ctype, query);
         // determine set of records to scan
-        c_rec_RemoveAll(run);
-        if (is_pkey && !algo_lib::SqlRegxQ(query.value)) {
-            acr::FRec *rec = acr::ind_rec_Find(ctype, query.value);
-            if (rec) {
-                c_rec_Insert(run, *rec);
-            }
-        } else {
+        if (!IndexSelect(run, ctype, query, is_pkey)) {
             ind_beg(acr::ctype_zd_trec_curs, rec, ctype) {
                 c_rec_Insert(run, rec);
             }ind_end;
+            acr::_db.stats.n_scan++;
         }
+        acr::_db.stats.n_rec += c_rec_N(run);
 
         // scan records
         ind_beg(acr::run_c_rec_curs, rec, run) {
@@ -258,6 +482,7 @@ static void SelectCtypes(acr::FRun &run, acr::FQuery &query) {
         algo_lib::Regx ssimfile_regx;
         Regx_ReadSql(ssimfile_regx, query.regx_ssimfile, true);
         ind_beg(acr::_db_ssimfile_curs, ssimfile,acr::_db) {
+            acr::_db.stats.n_regx++;
             bool match = Regx_Match(ssimfile_regx, ssimfile.ssimfile);
             if (match) {
                 c_ctype_Insert(run, *ssimfile.p_ctype);
@@ -275,6 +500,7 @@ static void SelectCtypes(acr::FRun &run, acr::FQuery &query) {
         algo_lib::Regx ctype_regx;
         Regx_ReadSql(ctype_regx, query.ctype, true);
         ind_beg(acr::_db_ctype_curs, ctype,acr::_db) {
+            acr::_db.stats.n_regx++;
             bool match = Regx_Match(ctype_regx, ctype.ctype);
             if (match) {
                 c_ctype_Insert(run, ctype);
@@ -286,23 +512,52 @@ static void SelectCtypes(acr::FRun &run, acr::FQuery &query) {
             c_ctype_Insert(run, *ctype);
         }
     }
+    acr::_db.stats.n_ctype += c_ctype_N(run);
 }
 
 // -----------------------------------------------------------------------------
 
+// Length of the literal prefix of the primary key value of QUERY on CTYPE,
+// or -1 if QUERY is not on the primary key or the value has no usable prefix.
+static int PkeyPrefixN(acr::FCtype &ctype, acr::FQuery &query) {
+    bool is_pkey = c_field_N(ctype) > 0
+        && (!ch_N(query.field) || query.field == name_Get(*c_field_Find(ctype, 0)));
+    return is_pkey ? SqlPrefixN(query.value) : -1;
+}
+
+// -----------------------------------------------------------------------------
+
+// Load records of RUN's ctypes needed by queries RUN.C_QUERY.
+// A query on primary key loads just the records whose key starts with
+// the literal prefix of the query, if possible (see acr::LoadPkey);
+// other queries need all records of the ssimfile.
 static void LoadSsimfiles(acr::FRun &run) {
     if (!acr::FileInputQ()) {
-        ind_beg(acr::run_c_ctype_curs, ctype, run) {
-            if (ctype.c_ssimfile && !ctype.c_ssimfile->c_file) {
-                acr::LoadSsimfile(*ctype.c_ssimfile);
+        ind_beg(acr::run_c_ctype_curs, ctype, run) if (ctype.c_ssimfile) {
+            bool lazy = true;
+            ind_beg(acr::run_c_query_curs, query, run) {
+                lazy = lazy && PkeyPrefixN(ctype, query) >= 0;
+            }ind_end;
+            if (lazy && acr::LazyLoadQ(*ctype.c_ssimfile)) {
+                ind_beg(acr::run_c_query_curs, query, run) {
+                    if (algo_lib::SqlRegxQ(query.value)) {
+                        acr::LoadPkeyPrefix(ctype, ch_FirstN(query.value, PkeyPrefixN(ctype, query)));
+                    } else {
+                        (void)acr::LoadPkey(ctype, query.value);
+                    }
+                }ind_end;
+            } else {
+                acr::StageSsimfile(*ctype.c_ssimfile);
             }
         }ind_end;
+        acr::LoadStaged();
     }
 }
 
 // -----------------------------------------------------------------------------
 
 static void Xref(acr::FRun &run, acr::FQuery &query) {
+    u64 start = get_cycles();
     if (query.nup > 0) {
         SelectUp(run,query);
     }
@@ -314,6 +569,7 @@ static void Xref(acr::FRun &run, acr::FQuery &query) {
             break;
         }
     }
+    acr::AddTime(acr::_db.stats.xref_time, start);
 }
 
 // -----------------------------------------------------------------------------
@@ -329,6 +585,100 @@ static void MarkDelete(acr::FQuery &query) {
 
 // -----------------------------------------------------------------------------
 
+// True if REC matches QUERY in one of the fields RUN.C_FIELD
+// (the test VisitField applies)
+static bool MatchQ(acr::FRun &run, acr::FQuery &query, acr::FRec &rec) {
+    bool ret = false;
+    ind_beg(acr::run_c_field_curs, field, run) {
+        acr::FEvalattr evalattr;
+        evalattr.field = &field;
+        Evalattr_Step(evalattr, rec.tuple);
+        ret = Regx_Match(run.value_regx, query.pk ? strptr(rec.pkey) : strptr(evalattr.value));
+        acr::_db.stats.n_field++;
+        acr::_db.stats.n_regx++;
+        if (ret) {
+            break;
+        }
+    }ind_end;
+    return ret;
+}
+
+// -----------------------------------------------------------------------------
+
+// Find records matched by each query of the batch RUN.C_QUERY
+// (per-query state is in QUERY.RUN).
+// Queries that can use an index do so; the remaining queries
+// share a single pass over the records of each ctype.
+static void MatchBatch(acr::FRun &run) {
+    u64 start = get_cycles();
+    ind_beg(acr::run_c_ctype_curs, ctype, run) if (c_field_N(ctype) > 0) {
+        bool scan = false;
+        ind_beg(acr::run_c_query_curs, query, run) {
+            acr::FRun &qrun = query.run;
+            bool is_pkey = SelectFields(qrun, ctype, query);
+            qrun.scan = !IndexSelect(qrun, ctype, query, is_pkey);
+            scan = scan || qrun.scan;
+            if (!qrun.scan) {
+                acr::_db.stats.n_rec += c_rec_N(qrun);
+                ind_beg(acr::run_c_rec_curs, rec, qrun) {
+                    if (MatchQ(qrun, query, rec)) {
+                        c_match_Insert(qrun, rec);
+                    }
+                }ind_end;
+            }
+        }ind_end;
+        if (scan) {
+            acr::_db.stats.n_scan++;
+            ind_beg(acr::ctype_zd_trec_curs, rec, ctype) {
+                acr::_db.stats.n_rec++;
+                ind_beg(acr::run_c_query_curs, query, run) {
+                    if (query.run.scan && MatchQ(query.run, query, rec)) {
+                        c_match_Insert(query.run, rec);
+                    }
+                }ind_end;
+            }ind_end;
+        }
+    }ind_end;
+    acr::AddTime(acr::_db.stats.match_time, start);
+}
+
+// -----------------------------------------------------------------------------
+
+// Run select queries RUN.C_QUERY, which share ssimfile and ctype expressions,
+// with the same effect as running them one by one:
+// ctypes are computed and ssimfiles loaded once, records are matched by MatchBatch,
+// and then each query in turn selects its matches and follows cross-references.
+// Cross-referencing is the same for queries with equal nup, ndown and unused,
+// so a query that selects no new records after such a query adds nothing, and is skipped.
+static void RunBatch(acr::FRun &run) {
+    acr::FQuery &first = *c_query_Find(run, 0);
+    SelectCtypes(run, first);
+    LoadSsimfiles(run);
+    ind_beg(acr::run_c_query_curs, query, run) {
+        Regx_ReadSql(query.run.field_regx, query.field, true);
+        Regx_ReadSql(query.run.value_regx, query.value, true);
+    }ind_end;
+    MatchBatch(run);
+    acr::FQuery *prev = NULL;
+    ind_beg(acr::run_c_query_curs, query, run) {
+        acr::FRun &qrun = query.run;
+        int nsel = 0;
+        ind_beg(acr::run_c_match_curs, rec, qrun) {
+            nsel += acr::Rec_Select(rec);
+        }ind_end;
+        bool same_xref = prev && prev->nup == query.nup && prev->ndown == query.ndown
+            && prev->unused == query.unused;
+        if (nsel > 0 || !same_xref) {
+            Xref(qrun, query);
+        }
+        MarkDelete(query);
+        c_child_RemoveAll(qrun);
+        prev = &query;
+    }ind_end;
+}
+
+// -----------------------------------------------------------------------------
+
 // Visit all records matching QUERY.
 // Perform actions specified bu QUERY -- rename, delete, select, etc.
 // For selection:
@@ -347,11 +697,14 @@ void acr::RunQuery(acr::FQuery &query) {
         // compute list of potential ssimfiles that contain matches
         SelectCtypes(run,query);
         // load ssimfiles (if necessary)
+        c_query_Insert(run,query);
         LoadSsimfiles(run);
         // determine fields and records to scan
         Regx_ReadSql(run.field_regx  , query.field, true);
         Regx_ReadSql(run.value_regx  , query.value, true);
+        u64 start = get_cycles();
         VisitRecords(run,query);
+        acr::AddTime(acr::_db.stats.match_time, start);
         // next step -- x-ref the thing
         Xref(run,query);
         MarkDelete(query);
@@ -361,12 +714,102 @@ void acr::RunQuery(acr::FQuery &query) {
 
 // -----------------------------------------------------------------------------
 
+// Add time elapsed since START (value of get_cycles) to T
+void acr::AddTime(algo::UnDiff &t, u64 start) {
+    t.value += algo::ToUnDiff(algo::SchedTime(get_cycles() - start)).value;
+}
+
+// Add counters of statistics STATS to TOTAL
+static void AddStats(report::acr_query &total, report::acr_query &stats) {
+    total.n_query     += stats.n_query;
+    total.n_ctype     += stats.n_ctype;
+    total.n_index     += stats.n_index;
+    total.n_scan      += stats.n_scan;
+    total.n_rec       += stats.n_rec;
+    total.n_field     += stats.n_field;
+    total.n_regx      += stats.n_regx;
+    total.n_xrefrec   += stats.n_xrefrec;
+    total.n_file      += stats.n_file;
+    total.n_byte      += stats.n_byte;
+    total.n_lazyrec   += stats.n_lazyrec;
+    total.n_select    += stats.n_select;
+    total.load_time.value  += stats.load_time.value;
+    total.match_time.value += stats.match_time.value;
+    total.xref_time.value  += stats.xref_time.value;
+    total.print_time.value += stats.print_time.value;
+    total.write_time.value += stats.write_time.value;
+}
+
+// Move statistics collected so far (e.g. by the previous query) to _db.stats_total
+// and start collecting statistics for QUERY, which is run in a batch of N queries.
+static void BeginStats(acr::FQuery &query, int n) {
+    AddStats(acr::_db.stats_total, acr::_db.stats);
+    acr::_db.stats = report::acr_query();
+    acr::_db.stats.query << query.ctype;
+    if (ch_N(query.field)) {
+        acr::_db.stats.query << "." << query.field;
+    }
+    acr::_db.stats.query << ":" << query.value;
+    acr::_db.stats.n_query = n;
+}
+
+// Print query statistics (see -stats)
+void acr::PrintStats(report::acr_query &stats) {
+    tempstr out;
+    if (ch_N(acr::_db.cmdline.cmd)>0) {
+        out <<"# ";// hide report from bash execution
+    }
+    out << stats;
+    prlog(out);
+}
+
+// Print statistics of the entire invocation (see -stats)
+void acr::PrintStatsTotal() {
+    AddStats(acr::_db.stats_total, acr::_db.stats);
+    acr::_db.stats = report::acr_query();
+    acr::_db.stats_total.query = "total";
+    acr::PrintStats(acr::_db.stats_total);
+}
+
+// -----------------------------------------------------------------------------
+
+// True if query NEXT can be run in one batch with query FIRST
+static bool BatchQ(acr::FQuery &first, acr::FQuery &next) {
+    return first.queryop == acr_Queryop_value_select
+        && next.queryop == acr_Queryop_value_select
+        && next.regx_ssimfile == first.regx_ssimfile
+        && next.ctype == first.ctype;
+}
+
+// -----------------------------------------------------------------------------
+
+// Run all scheduled queries (see acr::RunQuery).
+// Consecutive select queries with identical ssimfile and ctype expressions
+// (such as those created by -meta) are run as one batch (see RunBatch).
 void acr::RunAllQueries() {
     // run all queries
     // pop next item off of todo list.
     // running one query may create additional queries.
     while (acr::FQuery *query=acr::zs_query_First()) {
-        RunQuery(*query);
-        acr::query_Delete(*query);
+        acr::FRun run;
+        for (acr::FQuery *next = query; next && BatchQ(*query, *next); next = acr::zs_query_Next(*next)) {
+            c_query_Insert(run, *next);
+        }
+        BeginStats(*query, c_query_N(run));
+        int nsel = acr::zd_all_selrec_N();
+        if (c_query_N(run) > 1) {
+            RunBatch(run);
+            ind_beg(acr::run_c_query_curs, batched, run) {
+                acr::query_Delete(batched);
+            }ind_end;
+        } else {
+            RunQuery(*query);
+            acr::query_Delete(*query);
+        }
+        // records deselected by the query (e.g. -unused) don't count
+        acr::_db.stats.n_select = u32(i32_Max(acr::zd_all_selrec_N() - nsel, 0));
+        if (acr::_db.cmdline.stats) {
+            acr::PrintStats(acr::_db.stats);
+        }
     }
 }
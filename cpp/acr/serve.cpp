@@ -0,0 +1,477 @@
+// (C) 2017-2019 NYSE | Intercontinental Exchange
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contacting ICE: <https://www.theice.com/contact>
+//
+// Target: acr (exe) -- Algo Cross-Reference - ssimfile database & update tool
+// Exceptions: NO
+// Source: cpp/acr/serve.cpp -- Query server and client
+//
+// acr -serve:SOCKET loads the schema and all ssimfiles once, and then
+// answers requests on Unix socket SOCKET. Ssimfile directories are watched
+// with inotify; a changed ssimfile is reloaded before the next request is accepted.
+// A change to dmmeta makes the server re-execute itself, since the schema is
+// compiled into acr's own tables.
+// Each request is executed by a child process forked from the server,
+// so the resident data set is never modified by a query.
+// The request is a tuple acr.request  cwd:DIR  query:QUERY  verbose:N  debug:N,
+// followed by the command.acr tuple to execute (with an empty query).
+// The client half-closes the connection after sending it.
+// The client passes its stdout and stderr along with the request (SCM_RIGHTS),
+// so output goes exactly where a local run would send it; if no
+// descriptors are passed, output is written to the connection.
+// The last line written to the connection is acr.reply  served:Y  exit_code:N.
+// served:N means the request was not executed (e.g. different -in),
+// and the client runs the command itself.
+
+#include "include/acr.h"
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// -----------------------------------------------------------------------------
+
+// True if the command line CMD can be executed by a query server:
+// its input is a directory, and it doesn't read stdin, interact with
+// the user, or write files (-check writes check stamps, see -changed).
+static bool ServableQ(command::acr &cmd) {
+    return DirectoryQ(cmd.in)
+        && !cmd.write
+        && !cmd.check
+        && !cmd.e
+        && !cmd.my
+        && !cmd.b
+        && !cmd.insert
+        && !cmd.replace
+        && !cmd.merge
+        && !ch_N(cmd.serve);
+}
+
+// Fill in socket address ADDR for socket path PATH.
+// Return false if the path doesn't fit.
+static bool SockAddr(struct sockaddr_un &addr, strptr path) {
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    bool ok = elems_N(path) > 0 && elems_N(path) < int(sizeof(addr.sun_path));
+    if (ok) {
+        memcpy(addr.sun_path, path.elems, elems_N(path));
+    }
+    return ok;
+}
+
+// Connect to Unix socket PATH.
+// Return an invalid descriptor if nobody is listening there.
+static algo::Fildes ConnectSock(strptr path) {
+    algo::Fildes ret;
+    struct sockaddr_un addr;
+    if (SockAddr(addr, path)) {
+        int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd != -1 && connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+            (void)close(fd);
+            fd = -1;
+        }
+        ret = algo::Fildes(fd);
+    }
+    return ret;
+}
+
+// Read from FD until end of file, appending to OUT.
+// At most LIMIT bytes are kept.
+static void ReadAll(algo::Fildes fd, cstring &out, int limit) {
+    char buf[4096];
+    ssize_t n;
+    while ((n = read(fd.value, buf, sizeof(buf))) > 0 || (n < 0 && errno == EINTR)) {
+        if (n > 0 && ch_N(out) < limit) {
+            out << strptr(buf, i32_Min(int(n), limit - ch_N(out)));
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Send DATA over Unix socket SOCK, along with NFD descriptors FDS.
+// Descriptors travel with the first byte; the rest is plain data.
+static bool SendFds(algo::Fildes sock, strptr data, int *fds, int nfd) {
+    char buf[CMSG_SPACE(sizeof(int) * 4)] __attribute__((aligned(__alignof__(struct cmsghdr))));
+    memset(buf, 0, sizeof(buf));
+    struct iovec iov;
+    iov.iov_base = (void*)data.elems;
+    iov.iov_len = elems_N(data);
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = buf;
+    msg.msg_controllen = CMSG_SPACE(sizeof(int) * nfd);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int) * nfd);
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * nfd);
+    ssize_t n = sendmsg(sock.value, &msg, MSG_NOSIGNAL);
+    return n > 0 && WriteFile(sock, (u8*)data.elems + n, elems_N(data) - int(n));
+}
+
+// Receive data from Unix socket SOCK, appending to OUT, until end of file
+// (or only the first chunk, if ALL is false).
+// Up to NFD descriptors that came with the data are saved in FDS;
+// other elements of FDS are set to -1.
+static void RecvFds(algo::Fildes sock, cstring &out, int *fds, int nfd, bool all) {
+    char data[4096];
+    char buf[CMSG_SPACE(sizeof(int) * 4)] __attribute__((aligned(__alignof__(struct cmsghdr))));
+    struct iovec iov;
+    iov.iov_base = data;
+    iov.iov_len = sizeof(data);
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = buf;
+    msg.msg_controllen = sizeof(buf);
+    ssize_t n;
+    while ((n = recvmsg(sock.value, &msg, MSG_CMSG_CLOEXEC)) < 0 && errno == EINTR) {
+    }
+    for (int i = 0; i < nfd; i++) {
+        fds[i] = -1;
+    }
+    if (n > 0) {
+        out << strptr(data, int(n));
+        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+        if (cmsg && cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+            int ngot = int((cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+            int *got = (int*)CMSG_DATA(cmsg);
+            for (int i = 0; i < ngot; i++) {
+                if (i < nfd) {
+                    fds[i] = got[i];
+                } else {
+                    (void)close(got[i]);
+                }
+            }
+        }
+        if (all) {
+            ReadAll(sock, out, 1<<20);
+        }
+    }
+}
+
+// Have the query server at -server execute this invocation, if the server
+// is running and the invocation is servable (see ServableQ).
+// Return true if the server executed it; exit code is then in algo_lib::_db.exit_code.
+// If the server cannot be reached, nothing happens and the caller runs the query itself.
+bool acr::Main_Client() {
+    command::acr &cmdline = acr::_db.cmdline;
+    bool ret = false;
+    if (ch_N(cmdline.server) > 0 && ServableQ(cmdline)) {
+        algo::Fildes sock = ConnectSock(cmdline.server);
+        if (ValidQ(sock)) {
+            // the query is printed as an anonymous attribute,
+            // which doesn't read back if it contains a colon -- send it separately
+            command::acr cmd(cmdline);
+            ch_RemoveAll(cmd.query);
+            tempstr req;
+            req << "acr.request"
+                << Keyval("cwd",algo::GetCurDir())
+                << Keyval("query",cmdline.query)
+                << Keyval("verbose",i32(algo_lib::_db.cmdline.verbose))
+                << Keyval("debug",i32(algo_lib::_db.cmdline.debug))
+                << eol;
+            command::acr_Print(cmd, req);
+            req << eol;
+            algo_lib::FlushLog();// output so far precedes the server's
+            int fds[2] = {1, 2};
+            if (SendFds(sock, req, fds, 2) && shutdown(sock.value, SHUT_WR) == 0) {
+                tempstr reply;
+                ReadAll(sock, reply, 4096);
+                algo::Tuple tuple;
+                ind_beg(Line_curs,line,reply) {
+                    (void)Tuple_ReadStrptrMaybe(tuple, line);
+                }ind_end;
+                if (tuple.head.value == "acr.reply") {
+                    ret = attr_GetString(tuple, "served") == "Y";
+                    algo_lib::_db.exit_code = algo::ParseI32(attr_GetString(tuple, "exit_code"), 1);
+                } else {
+                    // the request may have been partially executed; don't repeat it
+                    prerr("acr.client  server:"<<cmdline.server<<"  comment:'no reply from server'");
+                    algo_lib::_db.exit_code = 1;
+                    ret = true;
+                }
+            }
+            (void)close(sock.value);
+        }
+    }
+    return ret;
+}
+
+// -----------------------------------------------------------------------------
+
+// Execute request received on connection CONN (in a child process)
+// and send the reply.
+static void ServeRequest(algo::Fildes conn) {
+    // the client's stdout and stderr come with the request
+    tempstr req;
+    int fds[2];
+    RecvFds(conn, req, fds, 2, true);
+    algo::Fildes fd_out(fds[0]);
+    algo::Fildes fd_err(fds[1]);
+    tempstr cwd;
+    tempstr query;
+    int verbose = 0;
+    int debug = 0;
+    command::acr cmd;
+    bool have_cmd = false;
+    ind_beg(Line_curs,line,req) {
+        algo::Tuple tuple;
+        if (Tuple_ReadStrptrMaybe(tuple, line)) {
+            if (tuple.head.value == "acr.request") {
+                cwd = attr_GetString(tuple, "cwd");
+                query = attr_GetString(tuple, "query");
+                verbose = algo::ParseI32(attr_GetString(tuple, "verbose"), 0);
+                debug = algo::ParseI32(attr_GetString(tuple, "debug"), 0);
+            } else if (tuple.head.value == "command.acr") {
+                have_cmd = command::acr_ReadStrptrMaybe(cmd, line);
+            }
+        }
+    }ind_end;
+    // relative paths (-in, -schema, output files) must mean the same thing
+    bool served = have_cmd
+        && cwd == algo::GetCurDir()
+        && cmd.in == acr::_db.cmdline.in
+        && cmd.schema == acr::_db.cmdline.schema
+        && ServableQ(cmd);
+    if (served) {
+        algo_lib::FlushLog();
+        (void)dup2(ValidQ(fd_out) ? fd_out.value : conn.value, 1);
+        (void)dup2(ValidQ(fd_err) ? fd_err.value : conn.value, 2);
+        algo_lib::InitLogbuf();// buffering policy of the client's stdout
+        algo_lib::_db.cmdline.verbose = u8(verbose);
+        if (verbose) {
+            algo_lib::TempstrStatsEnable();
+        }
+        algo_lib::_db.cmdline.debug = u8(debug);
+        acr::_db.cmdline = cmd;
+        acr::_db.cmdline.query = query;
+        try {
+            acr::Main_Query();
+        } catch(algo_lib::ErrorX &x) {
+            prerr("acr.error  " << x);
+            algo_lib::_db.exit_code = 1;
+        }
+        algo_lib::FlushLog();
+    }
+    tempstr reply;
+    reply << "acr.reply"
+          << Keyval("served",served)
+          << Keyval("exit_code",algo_lib::_db.exit_code)
+          << eol;
+    (void)WriteFile(conn, (u8*)reply.ch_elems, ch_N(reply));
+}
+
+// -----------------------------------------------------------------------------
+
+// Watch directory DIR, where ssimfiles of namespace NS live, with inotify instance IFD
+static void AddWatch(algo::Fildes ifd, strptr dir, strptr ns) {
+    int wd = inotify_add_watch(ifd.value, Zeroterm(tempstr() << dir)
+                               , IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE
+                               | IN_DELETE_SELF | IN_MOVE_SELF);
+    if (wd >= 0) {
+        while (acr::watch_ns_N() <= wd) {// descriptors are allocated in increasing order
+            acr::watch_ns_Alloc() = ns;
+        }
+    }
+}
+
+// Watch namespace directories of the input, and the schema.
+// A namespace directory that doesn't exist yet implies a schema change.
+static void AddWatches(algo::Fildes ifd) {
+    ind_beg(acr::_db_ssimfile_curs, ssimfile, acr::_db) {
+        strptr ns = Pathcomp(ssimfile.ssimfile, ".LL");
+        tempstr dir = DirFileJoin(acr::_db.cmdline.in, ns);
+        if (DirectoryQ(dir)) {
+            AddWatch(ifd, dir, ns);// a repeated watch gets the same descriptor
+        }
+    }ind_end;
+    AddWatch(ifd, DirFileJoin(acr::_db.cmdline.schema, "dmmeta"), "dmmeta");
+}
+
+// Process pending inotify events from IFD.
+// Changed ssimfiles are unloaded and queued for loading.
+// Return true if the server must restart instead.
+static bool ReadWatch(algo::Fildes ifd) {
+    bool restart = false;
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t n;
+    while ((n = read(ifd.value, buf, sizeof(buf))) > 0) {
+        for (char *ptr = buf; ptr < buf + n; ) {
+            struct inotify_event *event = (struct inotify_event*)ptr;
+            ptr += sizeof(struct inotify_event) + event->len;
+            strptr ns = event->wd >= 0 && event->wd < acr::watch_ns_N() ? strptr(acr::watch_ns_qFind(event->wd)) : strptr();
+            strptr name = event->len ? strptr(event->name) : strptr();
+            if (event->mask & (IN_Q_OVERFLOW | IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) {
+                restart = true;// events lost or directory gone
+            } else if (GetFileExt(name) == ".ssim") {
+                if (ns == "dmmeta") {
+                    restart = true;
+                } else if (acr::FSsimfile *ssimfile = acr::ind_ssimfile_Find(tempstr() << ns << "." << StripExt(name))) {
+                    if (ssimfile->c_file) {
+                        prlog("acr.reload"<<Keyval("ssimfile",ssimfile->ssimfile));
+                        acr::UnloadSsimfile(*ssimfile);
+                        acr::StageSsimfile(*ssimfile);
+                    }
+                }
+            }
+        }
+    }
+    acr::LoadStaged();
+    return restart;
+}
+
+// Fork a child process that waits for a connection, passed by the server
+// over a socketpair, and executes the request on it (see ServeRequest).
+// Forking ahead of time keeps fork and exit off the client's critical path.
+// The child sees the data set as of the fork, so the server replaces
+// it after any change. Return the server's end of the socketpair.
+static algo::Fildes ForkSpare(algo::Fildes sock, algo::Fildes ifd) {
+    int sv[2];
+    errno_vrfy(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) == 0, "socketpair");
+    algo_lib::FlushLog();
+    pid_t pid = fork();
+    if (pid == 0) {
+        (void)close(sock.value);
+        (void)close(ifd.value);
+        (void)close(sv[0]);
+        signal(SIGCHLD, SIG_DFL);
+        tempstr msg;
+        int conn;
+        RecvFds(algo::Fildes(sv[1]), msg, &conn, 1, false);
+        if (conn != -1) {
+            ServeRequest(algo::Fildes(conn));
+        }
+        // readers of the output see end of file without waiting for exit
+        algo_lib::FlushLog();
+        (void)close(1);
+        (void)close(2);
+        (void)close(conn);
+        _exit(0);
+    }
+    (void)close(sv[1]);
+    errno_vrfy(pid != -1, "fork");
+    return algo::Fildes(sv[0]);
+}
+
+// True if the process at the other end of connection CONN
+// runs as the same user as the server.
+static bool PeerOkQ(int conn) {
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    return getsockopt(conn, SOL_SOCKET, SO_PEERCRED, &cred, &len) == 0
+        && cred.uid == getuid();
+}
+
+// Create listening socket at PATH.
+// Refuse to replace the socket of a running server.
+static algo::Fildes Listen(strptr path) {
+    struct sockaddr_un addr;
+    vrfy(SockAddr(addr, path), tempstr()<<"acr.serve  socket:"<<path<<"  comment:'socket path too long'");
+    algo::Fildes other = ConnectSock(path);
+    if (ValidQ(other)) {
+        (void)close(other.value);
+        vrfy(0, tempstr()<<"acr.serve  socket:"<<path<<"  comment:'server already running'");
+    }
+    (void)unlink(Zeroterm(tempstr() << path));
+    algo::Fildes fd(socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0));
+    errno_vrfy(ValidQ(fd), "socket");
+    // only the owner may connect (see also PeerOkQ)
+    mode_t mask = umask(0077);
+    int rc = bind(fd.value, (struct sockaddr*)&addr, sizeof(addr));
+    (void)umask(mask);
+    errno_vrfy(rc == 0, tempstr()<<"bind "<<path);
+    errno_vrfy(listen(fd.value, SOMAXCONN) == 0, "listen");
+    return fd;
+}
+
+// Serve queries on Unix socket -serve until interrupted (see top of file).
+void acr::Main_Serve() {
+    command::acr &cmdline = acr::_db.cmdline;
+    vrfy(DirectoryQ(cmdline.in), tempstr()<<"acr.serve  in:"<<cmdline.in<<"  comment:'input must be a directory'");
+    algo::Fildes ifd(inotify_init1(IN_CLOEXEC | IN_NONBLOCK));
+    errno_vrfy(ValidQ(ifd), "inotify_init1");
+    AddWatches(ifd);// before loading, so no change is missed
+    ind_beg(acr::_db_ssimfile_curs, ssimfile, acr::_db) {
+        acr::StageSsimfile(ssimfile);
+    }ind_end;
+    acr::LoadStaged();
+    acr::InitCtypeRank();
+    algo::Fildes sock = Listen(cmdline.serve);
+    algo::SetupExitSignals();
+    signal(SIGCHLD, SIG_IGN);// children are not waited for
+    prlog("acr.serve"
+          <<Keyval("socket",cmdline.serve)
+          <<Keyval("in",cmdline.in)
+          <<Keyval("n_ssimfile",acr::ssimfile_N()));
+    algo_lib::FlushLog();
+    bool restart = false;
+    algo::Fildes spare;
+    while (!restart && !algo_lib::_db.last_signal) {
+        if (!ValidQ(spare)) {
+            spare = ForkSpare(sock, ifd);
+        }
+        struct pollfd pfd[2];
+        pfd[0].fd = ifd.value;
+        pfd[0].events = POLLIN;
+        pfd[1].fd = sock.value;
+        pfd[1].events = POLLIN;
+        if (poll(pfd, 2, -1) > 0) {
+            // file changes that happened before a client connected
+            // are seen by its request
+            if (pfd[0].revents & POLLIN) {
+                restart = ReadWatch(ifd);
+                (void)close(spare.value);// spare exits
+                spare = algo::Fildes();
+            }
+            int conn = -1;
+            if (!restart && (pfd[1].revents & POLLIN)) {
+                conn = accept4(sock.value, NULL, NULL, SOCK_CLOEXEC);
+            }
+            if (conn != -1 && !PeerOkQ(conn)) {
+                prlog("acr.serve  comment:'connection from another user refused'");
+                (void)close(conn);
+                conn = -1;
+            }
+            if (conn != -1) {
+                if (!ValidQ(spare)) {
+                    spare = ForkSpare(sock, ifd);
+                }
+                // if the spare is gone, the client sees no reply
+                (void)SendFds(spare, "c", &conn, 1);
+                (void)close(conn);
+                (void)close(spare.value);
+                spare = algo::Fildes();
+            }
+        }
+    }
+    if (ValidQ(spare)) {
+        (void)close(spare.value);
+    }
+    (void)close(sock.value);
+    (void)close(ifd.value);
+    (void)unlink(Zeroterm(tempstr() << cmdline.serve));
+    if (restart) {
+        prlog("acr.serve  comment:'schema changed, restarting'");
+        algo_lib::FlushLog();
+        execvp(algo_lib::_db.argv[0], algo_lib::_db.argv);
+        errno_vrfy(0, "execvp");
+    }
+}
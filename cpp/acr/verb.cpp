@@ -152,7 +152,7 @@ void acr::Main_Browser() {
 
 static void SelectCtype(acr::FCtype &ctype_ctype, acr::FCtype &ctype) {
     acr::FRec *ctype_rec=ind_rec_Find(ctype_ctype,ctype.ctype);
-    if (ctype_rec && !zd_all_selrec_InLlistQ(*ctype_rec)) {
+    if (ctype_rec) {
         acr::FQuery& next  = acr::query_Alloc();
         next.queryop = acr_Queryop_value_select;
         next.ctype = "dmmeta.Ctype";
@@ -160,29 +160,32 @@ static void SelectCtype(acr::FCtype &ctype_ctype, acr::FCtype &ctype) {
         next.value = ctype.ctype;
         next.ndown = 100;
         (void)acr::query_XrefMaybe(next);
-        acr::RunAllQueries();
     }
 }
 
 // Select ctypes of selected records, deselect records themselves
+// One query is created per ctype, and all of them are run as a batch
+// (see acr::RunAllQueries)
 void acr::Main_SelectMeta() {
     // Find data record of 'ctype'
     acr::FCtype *ctype_ctype = acr::ind_ctype_Find("dmmeta.Ctype");
     vrfy(ctype_ctype, "acr.broken_metadata");
-    if (ctype_ctype->c_ssimfile && !ctype_ctype->c_ssimfile->c_file) {
+    if (ctype_ctype->c_ssimfile) {
         acr::LoadSsimfile(*ctype_ctype->c_ssimfile);
     }
     ind_beg(acr::_db_zd_all_selrec_curs,rec,acr::_db) {
         rec.metasel=true;
+        rec.p_ctype->visit=false;
     }ind_end;
     acr::Rec_DeselectAll();
     ind_beg(acr::_db_file_curs, file, acr::_db) {
         ind_beg(acr::file_zd_frec_curs,rec,file) {
-            if (rec.metasel) {
+            if (rec.metasel && bool_Update(rec.p_ctype->visit,true)) {
                 SelectCtype(*ctype_ctype,*rec.p_ctype);
             }
         }ind_end;
     }ind_end;
+    acr::RunAllQueries();
 }
 
 // -----------------------------------------------------------------------------
@@ -28,31 +28,56 @@
 
 // -----------------------------------------------------------------------------
 
+// True if REC can be saved by copying the line from which it was loaded
+// (see acr::SetOrigline). Lines are copied only into a file that has edits (EDITED);
+// a file without edits, and under -check every file, is rewritten by printing all records.
+static bool CopyLineQ(acr::FRec &rec, bool edited) {
+    return edited
+        && elems_N(rec.origline) > 0
+        && !rec.mod
+        && !rec.isnew
+        && !acr::_db.cmdline.check;
+}
+
+// -----------------------------------------------------------------------------
+
 // Save ssimfile (single table) back to disk.
 // Collect all records in file, sort them by sort field.
+// If the file has edits, records that were not modified are copied from the input file (see CopyLineQ),
+// so the cost of saving a large table is mostly proportional to the number of edits.
+// A file without edits is normalized.
 // Optionally create missing second-level directory (e.g. data/dmmeta).
 static void WriteFile(acr::FWrite &write, acr::FFile &file) {
     // collect records
     acr::c_cmtrec_RemoveAll(write);
+    bool edited = false;
     ind_beg(acr::file_zd_frec_curs, rec, file) {
+        edited = edited || rec.del || rec.mod || rec.isnew;
         if (!rec.del) {
             acr::c_cmtrec_Insert(write, rec);
         }
     }ind_end;
     cstring out;
-    // sort them by original rowid
-    acr::c_cmtrec_QuickSort(write);
+    // sort them by original rowid.
+    // records are usually loaded in order; only edits require sorting
+    if (!acr::c_cmtrec_SortedQ(write)) {
+        acr::c_cmtrec_QuickSort(write);
+    }
     ind_beg(acr::write_c_cmtrec_curs,rec,write) {
-        // print record to string according to schema
-        PrintAttr(out, rec.tuple.head.name, rec.tuple.head.value);
-        tempstr attr;
-        ind_beg(acr::ctype_c_field_curs, field, *rec.p_ctype) {
-            if (!field.isfldfunc) {
-                ch_RemoveAll(attr);
-                EvalAttrDflt(rec.tuple, field, attr);
-                PrintAttrSpace(out, name_Get(field), attr);
-            }
-        }ind_end;
+        if (CopyLineQ(rec, edited)) {
+            out << rec.origline;
+        } else {
+            // print record to string according to schema
+            PrintAttr(out, rec.tuple.head.name, rec.tuple.head.value);
+            tempstr attr;
+            ind_beg(acr::ctype_c_field_curs, field, *rec.p_ctype) {
+                if (!field.isfldfunc) {
+                    ch_RemoveAll(attr);
+                    EvalAttrDflt(rec.tuple, field, attr);
+                    PrintAttrSpace(out, name_Get(field), attr);
+                }
+            }ind_end;
+        }
         out << eol;
     }ind_end;
     acr::c_cmtrec_RemoveAll(write);
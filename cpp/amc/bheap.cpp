@@ -29,6 +29,10 @@
 // Each element gets an extra field representing its position in the heap.
 // -- thus, elements can be quickly removed from the heap by pointer,
 // and membership can also be determined.
+// With a dmmeta.bheap record, the heap becomes d-ary (arity children per node),
+// and with inlkey:Y each array element is a (key,row) pair, so that
+// upheap/downheap compare keys without dereferencing row pointers.
+// Without the record, the classic binary pointer heap is generated.
 // TODO:
 // Allow instantiating a bheap over any array type --
 // currently a Ptrary implementation is essentially force.
@@ -37,6 +41,31 @@
 
 #include "include/amc.h"
 
+// True if heap FIELD compares rows with the sort field's own comparison function
+static bool OwnfldQ(amc::FField &field) {
+    amc::FField &sortfld = *field.c_sortfld->p_sortfld;
+    amc::FCtype *base = GetBaseType(*field.p_arg,NULL);
+    return sortfld.c_fcmp && (sortfld.p_ctype == field.p_arg || (base && sortfld.p_ctype == base));
+}
+
+// True if heap FIELD stores copies of sort keys in the heap array
+static bool InlkeyQ(amc::FField &field) {
+    return field.c_bheap && field.c_bheap->inlkey;
+}
+
+// True if the sort key of heap FIELD can be copied into the heap array
+// and compared without the row: a builtin or cheap_copy type,
+// compared with < or with the type's own default comparison function.
+static bool InlkeyOkQ(amc::FField &field) {
+    amc::FField &sortfld = *field.c_sortfld->p_sortfld;
+    bool ok = sortfld.p_arg->c_bltin || CheapCopyQ(sortfld);
+    if (OwnfldQ(field)) {
+        amc::FFcmp &fcmp = *sortfld.c_fcmp;
+        ok = ok && sortfld.p_arg->c_ccmp && !fcmp.extrn && !fcmp.versionsort && fcmp.casesens;
+    }
+    return ok;
+}
+
 void amc::tclass_Bheap() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
     amc::FField &field = *amc::_db.genfield.p_field;
@@ -50,8 +79,28 @@ void amc::tclass_Bheap() {
     Set(R, "$Sortfldstore", sortfld.cpp_type);
     Set(R, "$inscond"  , field.c_xref ? strptr(field.c_xref->inscond.value) : strptr("true"));
 
+    // heap element: row pointer, or (key,row) pair with inline key
+    // $hrow: expression suffix to get from heap element to row pointer
+    // $hval/$hput: how to pass row to Upheap/Downheap, and store it in the heap array
+    bool inlkey = InlkeyQ(field);
+    if (inlkey && !InlkeyOkQ(field)) {
+        prerr("amc.bheap_inlkey"
+              <<Keyval("field",field.field)
+              <<Keyval("sortfld",sortfld.field)
+              <<Keyval("comment","inline key requires a builtin or cheap_copy sort field with default comparison"));
+        algo_lib::_db.exit_code++;
+    }
+    Set(R, "$Heapelem" , inlkey ? "$Parname_$name_elem" : "$Cpptype*");
+    Set(R, "$hrow"     , inlkey ? ".row" : "");
+    Set(R, "$hkey"     , FieldvalExpr(field.p_arg, sortfld, "row"));
+    Set(R, "$mkelem"   , inlkey ? "$Heapelem($hkey, &row)" : "&row");
+    Set(R, "$hval"     , field.c_bheap ? "elem" : "row");
+    Set(R, "$hput"     , field.c_bheap ? "elem" : "&row");
+    Set(R, "$arity"    , tempstr() << (field.c_bheap ? field.c_bheap->arity : 2));
+    vrfy(!field.c_bheap || field.c_bheap->arity >= 2, "amc.bheap: arity must be at least 2");
+
     // helper fields
-    InsVar(R, field.p_ctype     , "$Cpptype**", "$name_elems", "", "binary heap by $sortfld");
+    InsVar(R, field.p_ctype     , "$Heapelem*", "$name_elems", "", field.c_bheap ? "$arity-ary heap by $sortfld" : "binary heap by $sortfld");
     InsVar(R, field.p_ctype     , "i32", "$name_n", "", "number of elements in the heap");
     InsVar(R, field.p_ctype     , "i32", "$name_max", "", "max elements in $name_elems");
 
@@ -65,11 +114,35 @@ void amc::tclass_Bheap() {
     Ins(&R, child_init->body  , "$fname.$name_idx = -1; // ($field) not-in-heap");
 }
 
+// Upheap for d-ary heap (dmmeta.bheap)
+static void GenUpheapDary(algo_lib::Replscope &R, amc::FFunc &up) {
+    Ins(&R, up.ret  , "int", false);
+    Ins(&R, up.proto, "$name_Upheap($Parent, $Heapelem elem, int idx)", false);
+    Ins(&R, up.comment, "Find and return index of new location for heap element ELEM, starting at index IDX.");
+    Ins(&R, up.comment, "Move any elements along the way but do not store ELEM.");
+    Ins(&R, up.body, "$Heapelem *elems = $parname.$name_elems;");
+    Ins(&R, up.body, "while (idx>0) {");
+    Ins(&R, up.body, "    int j = (idx-1)/$arity;");
+    Ins(&R, up.body, "    if (!$name_HeapLt($pararg, elem, elems[j])) {");
+    Ins(&R, up.body, "        break;");
+    Ins(&R, up.body, "    }");
+    Ins(&R, up.body, "    elems[idx] = elems[j];");
+    Ins(&R, up.body, "    elems[idx]$hrow->$name_idx = idx;");
+    Ins(&R, up.body, "    idx = j;");
+    Ins(&R, up.body, "}");
+    Ins(&R, up.body, "return idx;");
+}
+
 void amc::tfunc_Bheap_Upheap() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
 
     amc::FFunc& up = amc::CreateCurFunc();
     up.priv=true;
+    if (field.c_bheap) {
+        GenUpheapDary(R, up);
+        return;
+    }
     Ins(&R, up.ret  , "int", false);
     Ins(&R, up.proto, "$name_Upheap($Parent, $Cpptype& row, int idx)", false);
     Ins(&R, up.comment, "Find and return index of new location for element ROW in the heap, starting at index IDX.");
@@ -88,11 +161,45 @@ void amc::tfunc_Bheap_Upheap() {
     Ins(&R, up.body, "return idx;");
 }
 
+// Downheap for d-ary heap (dmmeta.bheap)
+// All children of a node are adjacent in the array, so the scan
+// for the smallest child touches few cache lines, esp. with inline keys.
+static void GenDownheapDary(algo_lib::Replscope &R, amc::FFunc &down) {
+    Ins(&R, down.comment, "Find new location for heap element ELEM starting at IDX");
+    Ins(&R, down.comment, "NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.");
+    Ins(&R, down.ret  , "int", false);
+    Ins(&R, down.proto, "$name_Downheap($Parent, $Heapelem elem, int idx)", false);
+    Ins(&R, down.body, "$Heapelem *elems = $parname.$name_elems;");
+    Ins(&R, down.body, "int n = $parname.$name_n;");
+    Ins(&R, down.body, "int child = idx*$arity+1;");
+    Ins(&R, down.body, "while (child < n) {");
+    Ins(&R, down.body, "    int lim = child+$arity < n ? child+$arity : n;");
+    Ins(&R, down.body, "    for (int i = child+1; i < lim; i++) { // pick smallest child");
+    Ins(&R, down.body, "        if ($name_HeapLt($pararg, elems[i], elems[child])) {");
+    Ins(&R, down.body, "            child = i;");
+    Ins(&R, down.body, "        }");
+    Ins(&R, down.body, "    }");
+    Ins(&R, down.body, "    if (!$name_HeapLt($pararg, elems[child], elem)) {");
+    Ins(&R, down.body, "        break;");
+    Ins(&R, down.body, "    }");
+    Ins(&R, down.body, "    elems[idx] = elems[child];");
+    Ins(&R, down.body, "    elems[idx]$hrow->$name_idx = idx;");
+    Ins(&R, down.body, "    idx        = child;");
+    Ins(&R, down.body, "    child      = idx*$arity+1;");
+    Ins(&R, down.body, "}");
+    Ins(&R, down.body, "return idx;");
+}
+
 void amc::tfunc_Bheap_Downheap() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
 
     amc::FFunc& down = amc::CreateCurFunc();
     down.priv=true;
+    if (field.c_bheap) {
+        GenDownheapDary(R, down);
+        return;
+    }
     Ins(&R, down.comment, "Find new location for ROW starting at IDX");
     Ins(&R, down.comment, "NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.");
     Ins(&R, down.ret  , "int", false);
@@ -136,12 +243,15 @@ void amc::tfunc_Bheap_Reheap() {
     Ins(&R, reheap.body    , "    $name_Reserve($pararg, 1);");
     Ins(&R, reheap.body    , "    old_idx = $parname.$name_n++;");
     Ins(&R, reheap.body    , "}");
-    Ins(&R, reheap.body    , "int new_idx = $name_Upheap($pararg, row, old_idx);");
+    if (field.c_bheap) {
+        Ins(&R, reheap.body, "$Heapelem elem = $mkelem;");
+    }
+    Ins(&R, reheap.body    , "int new_idx = $name_Upheap($pararg, $hval, old_idx);");
     Ins(&R, reheap.body    , "if (!isnew && new_idx == old_idx) {");
-    Ins(&R, reheap.body    , "    new_idx = $name_Downheap($pararg, row, old_idx);");
+    Ins(&R, reheap.body    , "    new_idx = $name_Downheap($pararg, $hval, old_idx);");
     Ins(&R, reheap.body    , "}");
     Ins(&R, reheap.body    , "row.$name_idx = new_idx;");
-    Ins(&R, reheap.body    , "$parname.$name_elems[new_idx] = &row;");
+    Ins(&R, reheap.body    , "$parname.$name_elems[new_idx] = $hput;");
     if (field.need_firstchanged) {
         Ins(&R, reheap.comment, "If first item of the is changed, update fstep:$field");
         Ins(&R, reheap.body, "bool changed = new_idx==0 || old_idx==0;");
@@ -163,10 +273,13 @@ void amc::tfunc_Bheap_ReheapFirst() {
     Ins(&R, reheapfirst.comment, "Heap must be non-empty or behavior is undefined.");
     Ins(&R, reheapfirst.ret  , "i32", false);
     Ins(&R, reheapfirst.proto, "$name_ReheapFirst($Parent)", false);
-    Ins(&R, reheapfirst.body    , "$Cpptype &row = *$parname.$name_elems[0];");
-    Ins(&R, reheapfirst.body    , "i32 new_idx = $name_Downheap($pararg, row, 0);");
+    Ins(&R, reheapfirst.body    , "$Cpptype &row = *$parname.$name_elems[0]$hrow;");
+    if (field.c_bheap) {
+        Ins(&R, reheapfirst.body, "$Heapelem elem = $mkelem;");
+    }
+    Ins(&R, reheapfirst.body    , "i32 new_idx = $name_Downheap($pararg, $hval, 0);");
     Ins(&R, reheapfirst.body    , "row.$name_idx = new_idx;");
-    Ins(&R, reheapfirst.body    , "$parname.$name_elems[new_idx] = &row;");
+    Ins(&R, reheapfirst.body    , "$parname.$name_elems[new_idx] = $hput;");
     if (field.need_firstchanged) {
         Ins(&R, reheapfirst.comment, "Update fstep:$field");
         Ins(&R, reheapfirst.body, "if (new_idx != 0) {");
@@ -240,7 +353,7 @@ void amc::tfunc_Bheap_Cascdel() {
         Ins(&R, cascdel.body, "i32 n = $parname.$name_n;");
         Ins(&R, cascdel.body, "while (n > 0) {");
         Ins(&R, cascdel.body, "    n--;");
-        Ins(&R, cascdel.body, "    $Cpptype &elem = *$parname.$name_elems[n]; // pick cheapest element to remove");
+        Ins(&R, cascdel.body, "    $Cpptype &elem = *$parname.$name_elems[n]$hrow; // pick cheapest element to remove");
         Ins(&R, cascdel.body, "    elem.$name_idx = -1; // mark not-in-heap");
         Ins(&R, cascdel.body, "    $parname.$name_n = n;");
         Ins(&R, cascdel.body, DeleteExpr(field,"$pararg","elem")<<";");
@@ -258,15 +371,22 @@ void amc::tfunc_Bheap_RemoveFirst() {
     Ins(&R, remfirst.proto, "$name_RemoveFirst($Parent)", false);
     Ins(&R, remfirst.body, "$Cpptype *row = NULL;");
     Ins(&R, remfirst.body, "if ($parname.$name_n > 0) {");
-    Ins(&R, remfirst.body, "    row = $parname.$name_elems[0];");
+    Ins(&R, remfirst.body, "    row = $parname.$name_elems[0]$hrow;");
     Ins(&R, remfirst.body, "    row->$name_idx = -1;           // mark not in heap");
     Ins(&R, remfirst.body, "    i32 n = $parname.$name_n - 1; // index of last element in heap");
     Ins(&R, remfirst.body, "    $parname.$name_n = n;         // decrease count");
     Ins(&R, remfirst.body, "    if (n) {");
-    Ins(&R, remfirst.body, "        $Cpptype &elem = *$parname.$name_elems[n];");
-    Ins(&R, remfirst.body, "        int new_idx = $name_Downheap($pararg, elem, 0);");
-    Ins(&R, remfirst.body, "        elem.$name_idx = new_idx;");
-    Ins(&R, remfirst.body, "        $parname.$name_elems[new_idx] = &elem;");
+    if (field.c_bheap) {
+        Ins(&R, remfirst.body, "        $Heapelem elem = $parname.$name_elems[n];");
+        Ins(&R, remfirst.body, "        int new_idx = $name_Downheap($pararg, elem, 0);");
+        Ins(&R, remfirst.body, "        elem$hrow->$name_idx = new_idx;");
+        Ins(&R, remfirst.body, "        $parname.$name_elems[new_idx] = elem;");
+    } else {
+        Ins(&R, remfirst.body, "        $Cpptype &elem = *$parname.$name_elems[n];");
+        Ins(&R, remfirst.body, "        int new_idx = $name_Downheap($pararg, elem, 0);");
+        Ins(&R, remfirst.body, "        elem.$name_idx = new_idx;");
+        Ins(&R, remfirst.body, "        $parname.$name_elems[new_idx] = &elem;");
+    }
     Ins(&R, remfirst.body, "    }");
     if (field.need_firstchanged) {
         Ins(&R, remfirst.body, "    $name_FirstChanged($pararg);");
@@ -281,7 +401,7 @@ void amc::tfunc_Bheap_First() {
         AddRetval(first,Subst(R,"$Cpptype*"),"row","NULL");
     }
     Ins(&R, first.body , "if ($parname.$name_n > 0) {");
-    Ins(&R, first.body , "    row = $parname.$name_elems[0];");
+    Ins(&R, first.body , "    row = $parname.$name_elems[0]$hrow;");
     Ins(&R, first.body , "}");
 }
 
@@ -309,9 +429,12 @@ void amc::tfunc_Bheap_Insert() {
     Ins(&R, insert.body,     "    $name_Reserve($pararg, 1);");
     Ins(&R, insert.body,     "    int n = $parname.$name_n;");
     Ins(&R, insert.body,     "    $parname.$name_n = n + 1;");
-    Ins(&R, insert.body,     "    int new_idx = $name_Upheap($pararg, row, n);");
+    if (field.c_bheap) {
+        Ins(&R, insert.body, "    $Heapelem elem = $mkelem;");
+    }
+    Ins(&R, insert.body,     "    int new_idx = $name_Upheap($pararg, $hval, n);");
     Ins(&R, insert.body,     "    row.$name_idx = new_idx;");
-    Ins(&R, insert.body,     "    $parname.$name_elems[new_idx] = &row;");
+    Ins(&R, insert.body,     "    $parname.$name_elems[new_idx] = $hput;");
     if (field.need_firstchanged) {
         Ins(&R, insert.body, "    if (new_idx==0) {");
         Ins(&R, insert.body, "        $name_FirstChanged($pararg);");
@@ -329,11 +452,11 @@ void amc::tfunc_Bheap_Compact() {
         Ins(&R, compact.body, "if (i32_Max($parname.$name_n * 4,8) < $parname.$name_max) {");
         Ins(&R, compact.body, "    u32 old_max  = $parname.$name_max;");
         Ins(&R, compact.body, "    u32 new_max  = $parname.$name_max / 2; // reduce max by 2x");
-        Ins(&R, compact.body, "    u32 old_size = old_max * sizeof($Cpptype*);");
-        Ins(&R, compact.body, "    u32 new_size = new_max * sizeof($Cpptype*);");
+        Ins(&R, compact.body, "    u32 old_size = old_max * sizeof($Heapelem);");
+        Ins(&R, compact.body, "    u32 new_size = new_max * sizeof($Heapelem);");
         Ins(&R, compact.body, "    void *new_mem = $basepool_ReallocMem($parname.$name_elems, old_size, new_size);");
         Ins(&R, compact.body, "    if (new_mem) {");
-        Ins(&R, compact.body, "        $parname.$name_elems = ($Cpptype**)new_mem;");
+        Ins(&R, compact.body, "        $parname.$name_elems = ($Heapelem*)new_mem;");
         Ins(&R, compact.body, "        $parname.$name_max = new_max;");
         Ins(&R, compact.body, "        retval = true;");
         Ins(&R, compact.body, "    }");
@@ -350,17 +473,30 @@ void amc::tfunc_Bheap_Remove() {
     Ins(&R,  remove.proto, "$name_Remove($Parent, $Cpptype& row)", false);
     Ins(&R,  remove.body    , "if ($name_InBheapQ(row)) {");
     Ins(&R,  remove.body    , "    int old_idx = row.$name_idx;");
-    Ins(&R,  remove.body    , "    if ($parname.$name_elems[old_idx] == &row) { // sanity check: heap points back to row");
+    if (field.c_bheap) {
+        Ins(&R,  remove.body, "    if (&row == $parname.$name_elems[old_idx]$hrow) { // sanity check: heap points back to row");
+    } else {
+        Ins(&R,  remove.body, "    if ($parname.$name_elems[old_idx] == &row) { // sanity check: heap points back to row");
+    }
     Ins(&R,  remove.body    , "        row.$name_idx = -1;           // mark not in heap");
     Ins(&R,  remove.body    , "        i32 n = $parname.$name_n - 1; // index of last element in heap");
     Ins(&R,  remove.body    , "        $parname.$name_n = n;         // decrease count");
     Ins(&R,  remove.body    , "        if (old_idx != n) {");
-    Ins(&R,  remove.body    , "            $Cpptype *elem = $parname.$name_elems[n];");
-    Ins(&R,  remove.body    , "            int new_idx = $name_Upheap($pararg, *elem, old_idx);");
-    Ins(&R,  remove.body    , "            if (new_idx == old_idx) {");
-    Ins(&R,  remove.body    , "                new_idx = $name_Downheap($pararg, *elem, old_idx);");
-    Ins(&R,  remove.body    , "            }");
-    Ins(&R,  remove.body    , "            elem->$name_idx = new_idx;");
+    if (field.c_bheap) {
+        Ins(&R,  remove.body, "            $Heapelem elem = $parname.$name_elems[n];");
+        Ins(&R,  remove.body, "            int new_idx = $name_Upheap($pararg, elem, old_idx);");
+        Ins(&R,  remove.body, "            if (new_idx == old_idx) {");
+        Ins(&R,  remove.body, "                new_idx = $name_Downheap($pararg, elem, old_idx);");
+        Ins(&R,  remove.body, "            }");
+        Ins(&R,  remove.body, "            elem$hrow->$name_idx = new_idx;");
+    } else {
+        Ins(&R,  remove.body, "            $Cpptype *elem = $parname.$name_elems[n];");
+        Ins(&R,  remove.body, "            int new_idx = $name_Upheap($pararg, *elem, old_idx);");
+        Ins(&R,  remove.body, "            if (new_idx == old_idx) {");
+        Ins(&R,  remove.body, "                new_idx = $name_Downheap($pararg, *elem, old_idx);");
+        Ins(&R,  remove.body, "            }");
+        Ins(&R,  remove.body, "            elem->$name_idx = new_idx;");
+    }
     Ins(&R,  remove.body    , "            $parname.$name_elems[new_idx] = elem;");
     Ins(&R,  remove.body    , "        }");
     if (field.c_fcompact) {
@@ -405,7 +541,7 @@ void amc::tfunc_Bheap_RemoveAll() {
     Ins(&R, flush.proto, "$name_RemoveAll($Parent)", false);
     Ins(&R, flush.body    , "int n = $parname.$name_n;");
     Ins(&R, flush.body    , "for (int i = n - 1; i>=0; i--) {");
-    Ins(&R, flush.body    , "    $parname.$name_elems[i]->$name_idx = -1; // mark not-in-heap");
+    Ins(&R, flush.body    , "    $parname.$name_elems[i]$hrow->$name_idx = -1; // mark not-in-heap");
     Ins(&R, flush.body    , "}");
     Ins(&R, flush.body    , "$parname.$name_n = 0;");
     if (field.need_firstchanged) {
@@ -423,7 +559,7 @@ void amc::tfunc_Bheap_Dealloc() {
     Ins(&R, dealloc.ret  , "void", false);
     Ins(&R, dealloc.proto, "$name_Dealloc($Parent)", false);
     Ins(&R, dealloc.body, "$name_RemoveAll($pararg);");
-    Ins(&R, dealloc.body, "$basepool_FreeMem($parname.$name_elems, sizeof($Cpptype*)*$parname.$name_max);");
+    Ins(&R, dealloc.body, "$basepool_FreeMem($parname.$name_elems, sizeof($Heapelem)*$parname.$name_max);");
     Ins(&R, dealloc.body, "$parname.$name_max   = 0;");
     Ins(&R, dealloc.body, "$parname.$name_elems = NULL;");
 }
@@ -437,13 +573,13 @@ void amc::tfunc_Bheap_Reserve() {
     Ins(&R, reserve.body, "i32 old_max = $parname.$name_max;");
     Ins(&R, reserve.body, "if (UNLIKELY($parname.$name_n + n > old_max)) {");
     Ins(&R, reserve.body, "    u32 new_max  = u32_Max(4, old_max * 2);");
-    Ins(&R, reserve.body, "    u32 old_size = old_max * sizeof($Cpptype*);");
-    Ins(&R, reserve.body, "    u32 new_size = new_max * sizeof($Cpptype*);");
+    Ins(&R, reserve.body, "    u32 old_size = old_max * sizeof($Heapelem);");
+    Ins(&R, reserve.body, "    u32 new_size = new_max * sizeof($Heapelem);");
     Ins(&R, reserve.body, "    void *new_mem = $basepool_ReallocMem($parname.$name_elems, old_size, new_size);");
     Ins(&R, reserve.body, "    if (UNLIKELY(!new_mem)) {");
     Ins(&R, reserve.body, "        FatalErrorExit(\"$ns.out_of_memory  field:$field\");");
     Ins(&R, reserve.body, "    }");
-    Ins(&R, reserve.body, "    $parname.$name_elems = ($Cpptype**)new_mem;");
+    Ins(&R, reserve.body, "    $parname.$name_elems = ($Heapelem*)new_mem;");
     Ins(&R, reserve.body, "    $parname.$name_max = new_max;");
     Ins(&R, reserve.body, "}");
 }
@@ -465,7 +601,7 @@ void amc::tfunc_Bheap_Uninit() {
     if (field.p_ctype == field.p_ctype->p_ns->c_globfld->p_ctype) {
         Ins(&R, uninit.body, "// skip destruction in global scope");
     } else {
-        Ins(&R, uninit.body, "$basepool_FreeMem((u8*)$parname.$name_elems, sizeof($Cpptype*)*$parname.$name_max); // ($field)");
+        Ins(&R, uninit.body, "$basepool_FreeMem((u8*)$parname.$name_elems, sizeof($Heapelem)*$parname.$name_max); // ($field)");
     }
 }
 
@@ -480,10 +616,7 @@ void amc::tfunc_Bheap_ElemLt() {
     Ins(&R, lt.ret  , "bool",false);
     Ins(&R, lt.proto, "$name_ElemLt($Parent, $Cpptype &a, $Cpptype &b)",false);
     Ins(&R, lt.body, "(void)$parname;");
-    amc::FCtype *base = GetBaseType(*field.p_arg,NULL);
-
-    bool ownfld = sortfld.c_fcmp && (sortfld.p_ctype == field.p_arg || (base && sortfld.p_ctype == base));
-    if (ownfld) {
+    if (OwnfldQ(field)) {
         Ins(&R, lt.body, "return $sortfld_Lt(a, b);");// direct field of child type
     } else {
         Set(R, "$aval", FieldvalExpr(field.p_arg, sortfld, "a"));
@@ -511,6 +644,48 @@ void amc::tfunc_Bheap_ElemLtval() {
     }
 }
 
+// Comparison of heap array elements, used by d-ary heaps.
+// Inline keys are compared directly without touching the rows.
+void amc::tfunc_Bheap_HeapLt() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
+
+    if (field.c_bheap) {
+        amc::FFunc& lt = amc::CreateCurFunc();
+        lt.priv = true;
+        Ins(&R, lt.ret  , "bool",false);
+        Ins(&R, lt.proto, "$name_HeapLt($Parent, $Heapelem a, $Heapelem b)",false);
+        if (InlkeyQ(field) && OwnfldQ(field)) {
+            Set(R, "$Keytype", field.c_sortfld->p_sortfld->p_arg->cpp_type);
+            Ins(&R, lt.body, "(void)$parname;");
+            Ins(&R, lt.body, "return $Keytype_Lt(a.key, b.key);");
+        } else if (InlkeyQ(field)) {
+            Ins(&R, lt.body, "(void)$parname;");
+            Ins(&R, lt.body, "return a.key < b.key;");
+        } else {
+            Ins(&R, lt.body, "return $name_ElemLt($pararg, *a, *b);");
+        }
+    }
+}
+
+// Heap array element with inline copy of the sort key
+void amc::tfunc_Bheap_elem() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
+    amc::FNs &ns = *field.p_ctype->p_ns;
+
+    if (InlkeyQ(field)) {
+        Ins(&R, ns.curstext, "");
+        Ins(&R, ns.curstext, "struct $Heapelem {// heap element with inline key ($field)");
+        Ins(&R, ns.curstext, "    $Sortfldstore key; // copy of row's $sortfld");
+        Ins(&R, ns.curstext, "    $Cpptype* row;");
+        Ins(&R, ns.curstext, "    $Heapelem() : row(NULL) {}");
+        Ins(&R, ns.curstext, "    $Heapelem(const $Sortfldstore &in_key, $Cpptype *in_row) : key(in_key), row(in_row) {}");
+        Ins(&R, ns.curstext, "};");
+        Ins(&R, ns.curstext, "");
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 static bool HasUnordCursQ(amc::FField &field) {
@@ -537,7 +712,7 @@ void amc::tfunc_Bheap_unordcurs() {
             Ins(&R, ns.curstext, "");
             Ins(&R, ns.curstext, "struct $Parname_$name_unordcurs {// unordered cursor -- iterate over heap in arbitrary order");
             Ins(&R, ns.curstext, "    typedef $Cpptype ChildType;");
-            Ins(&R, ns.curstext, "    $Cpptype** elems;");
+            Ins(&R, ns.curstext, "    $Heapelem* elems;");
             Ins(&R, ns.curstext, "    u32 n_elems;");
             Ins(&R, ns.curstext, "    u32 index;");
             Ins(&R, ns.curstext, "    $Parname_$name_unordcurs() { elems=NULL; n_elems=0; index=0; }");
@@ -579,7 +754,7 @@ void amc::tfunc_Bheap_unordcurs() {
             Ins(&R, curs_access.comment, "item access");
             Ins(&R, curs_access.ret  , "$Cpptype&", false);
             Ins(&R, curs_access.proto, "$Parname_$name_unordcurs_Access($Parname_$name_unordcurs &unordcurs)", false);
-            Ins(&R, curs_access.body, "return *unordcurs.elems[unordcurs.index];");
+            Ins(&R, curs_access.body, "return *unordcurs.elems[unordcurs.index]$hrow;");
         }
     }
 }
@@ -661,7 +836,7 @@ void amc::tfunc_Bheap_curs() {
         Ins(&R, curs_reset.body, "$Parname_$name_curs_Reserve(curs, $name_N($curspararg));");
         Ins(&R, curs_reset.body, "curs.temp_n = 0;");
         Ins(&R, curs_reset.body, "if (parent.$name_n > 0) {");
-        Ins(&R, curs_reset.body, "    $Cpptype &first = *parent.$name_elems[0];");
+        Ins(&R, curs_reset.body, "    $Cpptype &first = *parent.$name_elems[0]$hrow;");
         Ins(&R, curs_reset.body, "    curs.temp_elems[0] = &first; // insert first element in heap");
         Ins(&R, curs_reset.body, "    curs.temp_n = 1;");
         Ins(&R, curs_reset.body, "}");
@@ -701,15 +876,24 @@ void amc::tfunc_Bheap_curs() {
         Ins(&R, curs_next.body, "    } while (i < n);");
         Ins(&R, curs_next.body, "    curs.temp_n = n-1;");
         Ins(&R, curs_next.body, "    int index = dead->$name_idx;");
-        Ins(&R, curs_next.body, "    i = (index*2+1);");
-        Ins(&R, curs_next.body, "    if (i < $name_N($curspararg)) {");
-        Ins(&R, curs_next.body, "        $Cpptype &elem = *curs.parent->$name_elems[i];");
-        Ins(&R, curs_next.body, "        $Parname_$name_curs_Add(curs, elem);");
-        Ins(&R, curs_next.body, "    }");
-        Ins(&R, curs_next.body, "    if (i+1 < $name_N($curspararg)) {");
-        Ins(&R, curs_next.body, "        $Cpptype &elem = *curs.parent->$name_elems[i + 1];");
-        Ins(&R, curs_next.body, "        $Parname_$name_curs_Add(curs, elem);");
-        Ins(&R, curs_next.body, "    }");
+        if (field.c_bheap) {
+            Ins(&R, curs_next.body, "    i = (index*$arity+1);");
+            Ins(&R, curs_next.body, "    int lim = i+$arity < $name_N($curspararg) ? i+$arity : $name_N($curspararg);");
+            Ins(&R, curs_next.body, "    for (; i < lim; i++) {");
+            Ins(&R, curs_next.body, "        $Cpptype &elem = *curs.parent->$name_elems[i]$hrow;");
+            Ins(&R, curs_next.body, "        $Parname_$name_curs_Add(curs, elem);");
+            Ins(&R, curs_next.body, "    }");
+        } else {
+            Ins(&R, curs_next.body, "    i = (index*2+1);");
+            Ins(&R, curs_next.body, "    if (i < $name_N($curspararg)) {");
+            Ins(&R, curs_next.body, "        $Cpptype &elem = *curs.parent->$name_elems[i];");
+            Ins(&R, curs_next.body, "        $Parname_$name_curs_Add(curs, elem);");
+            Ins(&R, curs_next.body, "    }");
+            Ins(&R, curs_next.body, "    if (i+1 < $name_N($curspararg)) {");
+            Ins(&R, curs_next.body, "        $Cpptype &elem = *curs.parent->$name_elems[i + 1];");
+            Ins(&R, curs_next.body, "        $Parname_$name_curs_Add(curs, elem);");
+            Ins(&R, curs_next.body, "    }");
+        }
         Ins(&R, curs_next.body, "}");
     }
 
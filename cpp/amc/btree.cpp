@@ -0,0 +1,576 @@
+// (C) 2018-2019 NYSE | Intercontinental Exchange
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contacting ICE: <https://www.theice.com/contact>
+//
+// Target: amc (exe) -- Algo Model Compiler: generate code under include/gen and cpp/gen
+// Exceptions: NO
+// Source: cpp/amc/btree.cpp -- B+tree index
+//
+// The B+tree stores copies of the sort keys together with row pointers in wide
+// nodes (~256 bytes, i.e. 4 cache lines), so that lookups and range scans
+// touch few cache lines and row memory is only accessed for matching rows.
+// Leaves are linked in both directions for range scans.
+// Each row keeps a pointer to its leaf, so Remove doesn't need to search the tree
+// (and works even if the row's key has been modified since insertion).
+// Nodes are freed when they become empty; there is no merging of underfull nodes.
+
+#include "include/amc.h"
+#include "include/gen/amc_gen.h"
+
+// -----------------------------------------------------------------------------
+
+void amc::tclass_Btree() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
+    vrfy(field.c_sortfld, "amc.btree: sortfield must be specified through sortfld table");
+    amc::FField &sortfld = *field.c_sortfld->p_sortfld;
+    vrfy(sortfld.p_arg->c_bltin, "amc.btree: sortfld must be a builtin type (keys are stored in the nodes)");
+
+    Set(R, "$Sortstore" , sortfld.cpp_type);
+    Set(R, "$Node"      , "$Parname_$name_node");
+    Set(R, "$Root"      , "$parname.$name_root");
+    Set(R, "$NElem"     , "$parname.$name_n");
+    Set(R, "$rowkey"    , FieldvalExpr(field.p_arg, sortfld, "row"));
+
+    InsVar(R, field.p_ctype     , "$Node*", "$name_root", "", "Root node");
+    InsVar(R, field.p_ctype     , "i32", "$name_n", "", "Number of elements in the tree");
+
+    InsVar(R, field.p_arg       , "$Node*", "$name_leaf", "", "Leaf containing the row; NULL if not in tree");
+    amc::FFunc *child_init = amc::init_GetOrCreate(*field.p_arg);
+    Set(R, "$fname"     , Refname(*field.p_arg));
+    Ins(&R, child_init->body  , "$fname.$name_leaf = NULL; // ($field) not in tree");
+}
+
+// -----------------------------------------------------------------------------
+
+// Node layout. max_keys is computed by the C++ compiler so that
+// the node occupies approximately 256 bytes.
+void amc::tfunc_Btree_node() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField& field = *_db.genfield.p_field;
+    amc::FNs &ns = *field.p_ctype->p_ns;
+    Ins(&R, ns.curstext    , "");
+    Ins(&R, ns.curstext    , "struct $Node {// B+tree node ($field)");
+    Ins(&R, ns.curstext    , "    enum { max_keys = (256 - 32) / (sizeof($Sortstore) + sizeof(void*)) };");
+    Ins(&R, ns.curstext    , "    i32 n;  // number of rows (leaf) or children (internal node)");
+    Ins(&R, ns.curstext    , "    bool leaf;  // row[] is valid in leaves, child[] in internal nodes");
+    Ins(&R, ns.curstext    , "    $Node* parent;  // NULL for root");
+    Ins(&R, ns.curstext    , "    $Node* next;  // next leaf (leaves only)");
+    Ins(&R, ns.curstext    , "    $Node* prev;  // previous leaf (leaves only)");
+    Ins(&R, ns.curstext    , "    // leaf: key of row[i]");
+    Ins(&R, ns.curstext    , "    // internal node: key[i] (i>0) is <= all keys in child[i] and >= all keys in child[i-1]");
+    Ins(&R, ns.curstext    , "    $Sortstore key[max_keys];");
+    Ins(&R, ns.curstext    , "    union {");
+    Ins(&R, ns.curstext    , "        $Cpptype* row[max_keys];");
+    Ins(&R, ns.curstext    , "        $Node* child[max_keys];");
+    Ins(&R, ns.curstext    , "    };");
+    Ins(&R, ns.curstext    , "};");
+    Ins(&R, ns.curstext    , "");
+}
+
+// -----------------------------------------------------------------------------
+
+void amc::tfunc_Btree_Init() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.body, "$Root = NULL; // ($field)");
+    Ins(&R, func.body, "$NElem = 0;");
+}
+
+void amc::tfunc_Btree_Uninit() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
+    amc::FFunc& func = amc::CreateCurFunc();
+    if (field.p_ctype == field.p_ctype->p_ns->c_globfld->p_ctype) {
+        Ins(&R, func.body, "// skip destruction in global scope");
+    } else {
+        Ins(&R, func.body, "$name_RemoveAll($pararg); // ($field)");
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void amc::tfunc_Btree_AllocNode() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    func.priv = true;
+    Ins(&R, func.ret  , "$ns::$Node*", false);
+    Ins(&R, func.proto, "$name_AllocNode($Parent, bool leaf)", false);
+    Ins(&R, func.body, "(void)$parname;");
+    Ins(&R, func.body, "$Node *node = ($Node*)$basepool_AllocMem(sizeof($Node));");
+    Ins(&R, func.body, "if (UNLIKELY(!node)) {");
+    Ins(&R, func.body, "    FatalErrorExit(\"$ns.out_of_memory  field:$field\");");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "node->n      = 0;");
+    Ins(&R, func.body, "node->leaf   = leaf;");
+    Ins(&R, func.body, "node->parent = NULL;");
+    Ins(&R, func.body, "node->next   = NULL;");
+    Ins(&R, func.body, "node->prev   = NULL;");
+    Ins(&R, func.body, "return node;");
+}
+
+void amc::tfunc_Btree_FreeNode() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    func.priv = true;
+    Ins(&R, func.ret  , "void", false);
+    Ins(&R, func.proto, "$name_FreeNode($Parent, $Node *node)", false);
+    Ins(&R, func.body, "if (!node->leaf) {");
+    Ins(&R, func.body, "    for (int i = 0; i < node->n; i++) {");
+    Ins(&R, func.body, "        $name_FreeNode($pararg, node->child[i]);");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "$basepool_FreeMem(node, sizeof($Node));");
+}
+
+// Insert node RIGHT into the parent of LEFT immediately after LEFT,
+// splitting the parent if it is full. When the root is split, the tree grows by one level.
+void amc::tfunc_Btree_InsertChild() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    func.priv = true;
+    Ins(&R, func.ret  , "void", false);
+    Ins(&R, func.proto, "$name_InsertChild($Parent, $Node &left, $Sortstore sep, $Node &right)", false);
+    Ins(&R, func.body, "$Node *par = left.parent;");
+    Ins(&R, func.body, "if (!par) {");
+    Ins(&R, func.body, "    par           = $name_AllocNode($pararg, false);");
+    Ins(&R, func.body, "    par->n        = 1;");
+    Ins(&R, func.body, "    par->key[0]   = sep;");
+    Ins(&R, func.body, "    par->child[0] = &left;");
+    Ins(&R, func.body, "    left.parent   = par;");
+    Ins(&R, func.body, "    $Root = par;");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "int pos = 1;");
+    Ins(&R, func.body, "while (par->child[pos-1] != &left) {");
+    Ins(&R, func.body, "    pos++;");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "if (par->n == $Node::max_keys) {");
+    Ins(&R, func.body, "    // split; sib->key[0] becomes the separator between par and sib");
+    Ins(&R, func.body, "    $Node *sib = $name_AllocNode($pararg, false);");
+    Ins(&R, func.body, "    int h = par->n / 2;");
+    Ins(&R, func.body, "    sib->n = par->n - h;");
+    Ins(&R, func.body, "    memcpy(sib->key, par->key + h, sib->n * sizeof(par->key[0]));");
+    Ins(&R, func.body, "    memcpy(sib->child, par->child + h, sib->n * sizeof(par->child[0]));");
+    Ins(&R, func.body, "    par->n = h;");
+    Ins(&R, func.body, "    for (int i = 0; i < sib->n; i++) {");
+    Ins(&R, func.body, "        sib->child[i]->parent = sib;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    $name_InsertChild($pararg, *par, sib->key[0], *sib);");
+    Ins(&R, func.body, "    if (pos > h) {");
+    Ins(&R, func.body, "        pos -= h;");
+    Ins(&R, func.body, "        par = sib;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "memmove(par->key + pos + 1, par->key + pos, (par->n - pos) * sizeof(par->key[0]));");
+    Ins(&R, func.body, "memmove(par->child + pos + 1, par->child + pos, (par->n - pos) * sizeof(par->child[0]));");
+    Ins(&R, func.body, "par->key[pos]   = sep;");
+    Ins(&R, func.body, "par->child[pos] = &right;");
+    Ins(&R, func.body, "par->n++;");
+    Ins(&R, func.body, "right.parent = par;");
+}
+
+// Unlink empty node from the leaf list and from its parent, then free it.
+// A parent left without children is removed in the same way.
+void amc::tfunc_Btree_RemoveNode() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    func.priv = true;
+    Ins(&R, func.ret  , "void", false);
+    Ins(&R, func.proto, "$name_RemoveNode($Parent, $Node &node)", false);
+    Ins(&R, func.body, "if (node.leaf) {");
+    Ins(&R, func.body, "    if (node.prev) {");
+    Ins(&R, func.body, "        node.prev->next = node.next;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    if (node.next) {");
+    Ins(&R, func.body, "        node.next->prev = node.prev;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "$Node *par = node.parent;");
+    Ins(&R, func.body, "if (!par) {");
+    Ins(&R, func.body, "    $Root = NULL;");
+    Ins(&R, func.body, "} else if (par->n == 1) {");
+    Ins(&R, func.body, "    $name_RemoveNode($pararg, *par);");
+    Ins(&R, func.body, "} else {");
+    Ins(&R, func.body, "    int pos = 0;");
+    Ins(&R, func.body, "    while (par->child[pos] != &node) {");
+    Ins(&R, func.body, "        pos++;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    // removing child 0 drops separator 1; otherwise the separator to the left of the child goes");
+    Ins(&R, func.body, "    int kpos = i32_Max(pos, 1);");
+    Ins(&R, func.body, "    memmove(par->key + kpos, par->key + kpos + 1, (par->n - kpos - 1) * sizeof(par->key[0]));");
+    Ins(&R, func.body, "    memmove(par->child + pos, par->child + pos + 1, (par->n - pos - 1) * sizeof(par->child[0]));");
+    Ins(&R, func.body, "    par->n--;");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "$basepool_FreeMem(&node, sizeof($Node));");
+}
+
+// -----------------------------------------------------------------------------
+
+void amc::tfunc_Btree_FindLeaf() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    func.priv = true;
+    Ins(&R, func.ret  , "$ns::$Node*", false);
+    Ins(&R, func.proto, "$name_FindLeaf($Parent, $Sortstore val, int &pos)", false);
+    Ins(&R, func.body, "$Node *node = $Root;");
+    Ins(&R, func.body, "pos = 0;");
+    Ins(&R, func.body, "if (node) {");
+    Ins(&R, func.body, "    while (!node->leaf) {");
+    Ins(&R, func.body, "        int i = 1;");
+    Ins(&R, func.body, "        while (i < node->n && node->key[i] < val) {");
+    Ins(&R, func.body, "            i++;");
+    Ins(&R, func.body, "        }");
+    Ins(&R, func.body, "        node = node->child[i-1];");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    while (pos < node->n && node->key[pos] < val) {");
+    Ins(&R, func.body, "        pos++;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    // all keys in this leaf are smaller; next leaf starts with a key >= val");
+    Ins(&R, func.body, "    if (pos == node->n) {");
+    Ins(&R, func.body, "        node = node->next;");
+    Ins(&R, func.body, "        pos  = 0;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "return node;");
+}
+
+void amc::tfunc_Btree_Find() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "$Cpptype*", false);
+    Ins(&R, func.proto, "$name_Find($Parent, $Sortstore val)", false);
+    Ins(&R, func.body, "int pos;");
+    Ins(&R, func.body, "$Node *node = $name_FindLeaf($pararg, val, pos);");
+    Ins(&R, func.body, "return node && !(val < node->key[pos]) ? node->row[pos] : NULL;");
+}
+
+void amc::tfunc_Btree_LowerBound() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "$Cpptype*", false);
+    Ins(&R, func.proto, "$name_LowerBound($Parent, $Sortstore val)", false);
+    Ins(&R, func.body, "int pos;");
+    Ins(&R, func.body, "$Node *node = $name_FindLeaf($pararg, val, pos);");
+    Ins(&R, func.body, "return node ? node->row[pos] : NULL;");
+}
+
+void amc::tfunc_Btree_First() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "$Cpptype*", false);
+    Ins(&R, func.proto, "$name_First($Parent)", false);
+    Ins(&R, func.body, "$Node *node = $Root;");
+    Ins(&R, func.body, "while (node && !node->leaf) {");
+    Ins(&R, func.body, "    node = node->child[0];");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "return node ? node->row[0] : NULL;");
+}
+
+void amc::tfunc_Btree_Last() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "$Cpptype*", false);
+    Ins(&R, func.proto, "$name_Last($Parent)", false);
+    Ins(&R, func.body, "$Node *node = $Root;");
+    Ins(&R, func.body, "while (node && !node->leaf) {");
+    Ins(&R, func.body, "    node = node->child[node->n - 1];");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "return node ? node->row[node->n - 1] : NULL;");
+}
+
+void amc::tfunc_Btree_EmptyQ() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "bool", false);
+    Ins(&R, func.proto, "$name_EmptyQ($Parent)", false);
+    Ins(&R, func.body, "return $Root == NULL;");
+}
+
+void amc::tfunc_Btree_N() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "i32", false);
+    Ins(&R, func.proto, "$name_N($Cparent)", false);
+    Ins(&R, func.body, "return $NElem;");
+}
+
+void amc::tfunc_Btree_InTreeQ() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "bool", false);
+    Ins(&R, func.proto, "$name_InTreeQ($Cpptype& row)", false);
+    Ins(&R, func.body, "return row.$name_leaf != NULL;");
+}
+
+// -----------------------------------------------------------------------------
+
+// Rows with equal keys are kept in insertion order.
+void amc::tfunc_Btree_Insert() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "void", false);
+    Ins(&R, func.proto, "$name_Insert($Parent, $Cpptype& row)", false);
+    Ins(&R, func.body, "if (!row.$name_leaf) {");
+    Ins(&R, func.body, "    $Sortstore val = $rowkey;");
+    Ins(&R, func.body, "    $Node *node = $Root;");
+    Ins(&R, func.body, "    if (!node) {");
+    Ins(&R, func.body, "        node = $name_AllocNode($pararg, true);");
+    Ins(&R, func.body, "        $Root = node;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    // descend to the leaf, going right past equal keys");
+    Ins(&R, func.body, "    while (!node->leaf) {");
+    Ins(&R, func.body, "        int i = 1;");
+    Ins(&R, func.body, "        while (i < node->n && !(val < node->key[i])) {");
+    Ins(&R, func.body, "            i++;");
+    Ins(&R, func.body, "        }");
+    Ins(&R, func.body, "        node = node->child[i-1];");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    int pos = 0;");
+    Ins(&R, func.body, "    while (pos < node->n && !(val < node->key[pos])) {");
+    Ins(&R, func.body, "        pos++;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    if (node->n == $Node::max_keys) {");
+    Ins(&R, func.body, "        // split full leaf; upper half moves to a new leaf on the right");
+    Ins(&R, func.body, "        $Node *right = $name_AllocNode($pararg, true);");
+    Ins(&R, func.body, "        int h = node->n / 2;");
+    Ins(&R, func.body, "        right->n = node->n - h;");
+    Ins(&R, func.body, "        memcpy(right->key, node->key + h, right->n * sizeof(node->key[0]));");
+    Ins(&R, func.body, "        memcpy(right->row, node->row + h, right->n * sizeof(node->row[0]));");
+    Ins(&R, func.body, "        node->n = h;");
+    Ins(&R, func.body, "        for (int i = 0; i < right->n; i++) {");
+    Ins(&R, func.body, "            right->row[i]->$name_leaf = right;");
+    Ins(&R, func.body, "        }");
+    Ins(&R, func.body, "        right->prev = node;");
+    Ins(&R, func.body, "        right->next = node->next;");
+    Ins(&R, func.body, "        if (node->next) {");
+    Ins(&R, func.body, "            node->next->prev = right;");
+    Ins(&R, func.body, "        }");
+    Ins(&R, func.body, "        node->next = right;");
+    Ins(&R, func.body, "        $name_InsertChild($pararg, *node, right->key[0], *right);");
+    Ins(&R, func.body, "        if (pos > h) {");
+    Ins(&R, func.body, "            pos -= h;");
+    Ins(&R, func.body, "            node = right;");
+    Ins(&R, func.body, "        }");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    memmove(node->key + pos + 1, node->key + pos, (node->n - pos) * sizeof(node->key[0]));");
+    Ins(&R, func.body, "    memmove(node->row + pos + 1, node->row + pos, (node->n - pos) * sizeof(node->row[0]));");
+    Ins(&R, func.body, "    node->key[pos] = val;");
+    Ins(&R, func.body, "    node->row[pos] = &row;");
+    Ins(&R, func.body, "    node->n++;");
+    Ins(&R, func.body, "    row.$name_leaf = node;");
+    Ins(&R, func.body, "    $NElem++;");
+    Ins(&R, func.body, "}");
+}
+
+// The row is located through its leaf pointer, so its key is not consulted.
+// If the root is left with a single child, the tree shrinks by one level.
+void amc::tfunc_Btree_Remove() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "void", false);
+    Ins(&R, func.proto, "$name_Remove($Parent, $Cpptype& row)", false);
+    Ins(&R, func.body, "$Node *node = row.$name_leaf;");
+    Ins(&R, func.body, "if (node) {");
+    Ins(&R, func.body, "    int pos = 0;");
+    Ins(&R, func.body, "    while (node->row[pos] != &row) {");
+    Ins(&R, func.body, "        pos++;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    node->n--;");
+    Ins(&R, func.body, "    memmove(node->key + pos, node->key + pos + 1, (node->n - pos) * sizeof(node->key[0]));");
+    Ins(&R, func.body, "    memmove(node->row + pos, node->row + pos + 1, (node->n - pos) * sizeof(node->row[0]));");
+    Ins(&R, func.body, "    row.$name_leaf = NULL;");
+    Ins(&R, func.body, "    $NElem--;");
+    Ins(&R, func.body, "    if (node->n == 0) {");
+    Ins(&R, func.body, "        $name_RemoveNode($pararg, *node);");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "    while ($Root && !$Root->leaf && $Root->n == 1) {");
+    Ins(&R, func.body, "        $Node *root = $Root;");
+    Ins(&R, func.body, "        $Root = root->child[0];");
+    Ins(&R, func.body, "        $Root->parent = NULL;");
+    Ins(&R, func.body, "        $basepool_FreeMem(root, sizeof($Node));");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "}");
+}
+
+// Detach all rows from the tree, then free the nodes.
+// Rows are detached before any of them is deleted, so that xref removal
+// triggered by the deletion finds them already out of the tree.
+void amc::tfunc_Btree_RemoveAllImpl() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField& field = *_db.genfield.p_field;
+    amc::FFunc& func = amc::CreateCurFunc();
+    func.priv = true;
+    Ins(&R, func.ret  , "void", false);
+    Ins(&R, func.proto, "$name_RemoveAllImpl($Parent, bool del)", false);
+    Ins(&R, func.body, "$Node *root = $Root;");
+    Ins(&R, func.body, "$Node *first = root;");
+    Ins(&R, func.body, "while (first && !first->leaf) {");
+    Ins(&R, func.body, "    first = first->child[0];");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "$Root = NULL;");
+    Ins(&R, func.body, "$NElem = 0;");
+    Ins(&R, func.body, "for ($Node *node = first; node; node = node->next) {");
+    Ins(&R, func.body, "    for (int i = 0; i < node->n; i++) {");
+    Ins(&R, func.body, "        node->row[i]->$name_leaf = NULL;");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "}");
+    if (field.c_cascdel) {
+        Ins(&R, func.body, "if (del) {");
+        Ins(&R, func.body, "    for ($Node *node = first; node; node = node->next) {");
+        Ins(&R, func.body, "        for (int i = 0; i < node->n; i++) {");
+        Ins(&R, func.body, "            $Cpptype &row = *node->row[i];");
+        Ins(&R, func.body,              DeleteExpr(field,"$pararg","row")<<";");
+        Ins(&R, func.body, "        }");
+        Ins(&R, func.body, "    }");
+        Ins(&R, func.body, "}");
+    } else {
+        Ins(&R, func.body, "(void)del;");
+    }
+    Ins(&R, func.body, "if (root) {");
+    Ins(&R, func.body, "    $name_FreeNode($pararg, root);");
+    Ins(&R, func.body, "}");
+}
+
+void amc::tfunc_Btree_Cascdel() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
+    if (field.c_cascdel) {
+        amc::FFunc& func = amc::CreateCurFunc();
+        Ins(&R, func.body, "$name_RemoveAllImpl($pararg, true);");
+    }
+}
+
+void amc::tfunc_Btree_RemoveAll() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "void", false);
+    Ins(&R, func.proto, "$name_RemoveAll($Parent)", false);
+    Ins(&R, func.body, "$name_RemoveAllImpl($pararg, false);");
+}
+
+void amc::tfunc_Btree_RemoveFirst() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "$Cpptype*", false);
+    Ins(&R, func.proto, "$name_RemoveFirst($Parent)", false);
+    Ins(&R, func.body, "$Cpptype *row = $name_First($pararg);");
+    Ins(&R, func.body, "if (row) {");
+    Ins(&R, func.body, "    $name_Remove($pararg, *row);");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "return row;");
+}
+
+void amc::tfunc_Btree_Reinsert() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "void", false);
+    Ins(&R, func.proto, "$name_Reinsert($Parent, $Cpptype& row)", false);
+    Ins(&R, func.body, "$name_Remove($pararg, row);");
+    Ins(&R, func.body, "$name_Insert($pararg, row);");
+}
+
+// -----------------------------------------------------------------------------
+
+// Forward (curs) and backward (rcurs) cursors.
+// Both can be positioned in the middle of the tree with _Seek, e.g.
+// for (curs_Seek(curs, parent, lo); curs_ValidQ(curs) && curs_Access(curs).key < hi; curs_Next(curs))
+// Modifying the tree invalidates cursors.
+static void GenCurs(bool forward) {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField& field = *amc::_db.genfield.p_field;
+    amc::FNs &ns = *field.p_ctype->p_ns;
+    Set(R, "$curs"   , forward ? "curs" : "rcurs");
+    // cursor functions always name the parent 'parent'
+    Set(R, "$Seekarg", GlobalQ(*field.p_ctype) ? "" : "parent");
+    Ins(&R, ns.curstext    , "");
+    Ins(&R, ns.curstext    , "struct $Parname_$name_$curs {// cursor");
+    Ins(&R, ns.curstext    , "    typedef $Cpptype ChildType;");
+    Ins(&R, ns.curstext    , "    $Node* node;");
+    Ins(&R, ns.curstext    , "    int index;");
+    Ins(&R, ns.curstext    , "    $Parname_$name_$curs() { node=NULL; index=0; }");
+    Ins(&R, ns.curstext    , "};");
+    Ins(&R, ns.curstext    , "");
+
+    amc::FFunc& curs_reset = amc::ind_func_GetOrCreate(Subst(R,"$field_$curs.Reset"));
+    curs_reset.inl = true;
+    Ins(&R, curs_reset.comment, forward ? "position cursor at the first row" : "position cursor at the last row");
+    Ins(&R, curs_reset.ret  , "void", false);
+    Ins(&R, curs_reset.proto, "$Parname_$name_$curs_Reset($Parname_$name_$curs &curs, $Partype& parent)", false);
+    Ins(&R, curs_reset.body, "$Node *node = parent.$name_root;");
+    Ins(&R, curs_reset.body, "while (node && !node->leaf) {");
+    Ins(&R, curs_reset.body, forward ? "    node = node->child[0];" : "    node = node->child[node->n - 1];");
+    Ins(&R, curs_reset.body, "}");
+    Ins(&R, curs_reset.body, "curs.node  = node;");
+    Ins(&R, curs_reset.body, forward ? "curs.index = 0;" : "curs.index = node ? node->n - 1 : 0;");
+
+    amc::FFunc& curs_seek = amc::ind_func_GetOrCreate(Subst(R,"$field_$curs.Seek"));
+    Ins(&R, curs_seek.comment, forward ? "position cursor at the first row with key >= VAL" : "position cursor at the last row with key < VAL");
+    Ins(&R, curs_seek.ret  , "void", false);
+    Ins(&R, curs_seek.proto, "$Parname_$name_$curs_Seek($Parname_$name_$curs &curs, $Partype& parent, $Sortstore val)", false);
+    Ins(&R, curs_seek.body, "curs.node = $name_FindLeaf($Seekarg, val, curs.index);");
+    if (!forward) {
+        Ins(&R, curs_seek.body, "if (!curs.node) {");
+        Ins(&R, curs_seek.body, "    $Parname_$name_$curs_Reset(curs, parent);");
+        Ins(&R, curs_seek.body, "} else if (curs.index > 0) {");
+        Ins(&R, curs_seek.body, "    curs.index--;");
+        Ins(&R, curs_seek.body, "} else {");
+        Ins(&R, curs_seek.body, "    curs.node  = curs.node->prev;");
+        Ins(&R, curs_seek.body, "    curs.index = curs.node ? curs.node->n - 1 : 0;");
+        Ins(&R, curs_seek.body, "}");
+    }
+    MaybeUnused(curs_seek, "parent");
+
+    amc::FFunc& curs_validq = amc::ind_func_GetOrCreate(Subst(R,"$field_$curs.ValidQ"));
+    curs_validq.inl = true;
+    Ins(&R, curs_validq.comment, "cursor points to valid item");
+    Ins(&R, curs_validq.ret  , "bool", false);
+    Ins(&R, curs_validq.proto, "$Parname_$name_$curs_ValidQ($Parname_$name_$curs &curs)", false);
+    Ins(&R, curs_validq.body, "return curs.node != NULL;");
+
+    amc::FFunc& curs_next = amc::ind_func_GetOrCreate(Subst(R,"$field_$curs.Next"));
+    curs_next.inl = true;
+    Ins(&R, curs_next.comment, "proceed to next item");
+    Ins(&R, curs_next.ret  , "void", false);
+    Ins(&R, curs_next.proto, "$Parname_$name_$curs_Next($Parname_$name_$curs &curs)", false);
+    if (forward) {
+        Ins(&R, curs_next.body, "curs.index++;");
+        Ins(&R, curs_next.body, "if (curs.index == curs.node->n) {");
+        Ins(&R, curs_next.body, "    curs.node  = curs.node->next;");
+        Ins(&R, curs_next.body, "    curs.index = 0;");
+        Ins(&R, curs_next.body, "}");
+    } else {
+        Ins(&R, curs_next.body, "curs.index--;");
+        Ins(&R, curs_next.body, "if (curs.index < 0) {");
+        Ins(&R, curs_next.body, "    curs.node  = curs.node->prev;");
+        Ins(&R, curs_next.body, "    curs.index = curs.node ? curs.node->n - 1 : 0;");
+        Ins(&R, curs_next.body, "}");
+    }
+
+    amc::FFunc& curs_access = amc::ind_func_GetOrCreate(Subst(R,"$field_$curs.Access"));
+    curs_access.inl = true;
+    Ins(&R, curs_access.comment, "item access");
+    Ins(&R, curs_access.ret  , "$Cpptype&", false);
+    Ins(&R, curs_access.proto, "$Parname_$name_$curs_Access($Parname_$name_$curs &curs)", false);
+    Ins(&R, curs_access.body, "return *curs.node->row[curs.index];");
+}
+
+void amc::tfunc_Btree_curs() {
+    GenCurs(true);
+}
+
+void amc::tfunc_Btree_rcurs() {
+    GenCurs(false);
+}
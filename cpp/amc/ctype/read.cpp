@@ -79,6 +79,30 @@ static void Ctype_ReadStrptrMaybe_Ssim(algo_lib::Replscope &R, amc::FCtype &ctyp
     if (n_anon > 0) {
         Ins(&R, readstrptr.body , "int anon_idx = 0;");
     }
+    // ssimfile tuples are normally printed with attributes in declaration order.
+    // Read such tuples directly into the fields, without Attr_curs and FieldId lookup;
+    // any other order falls back to the generic loop below.
+    bool fast = ctype.c_ssimfile && n_anon == 0 && !ctype.c_varlenfld;
+    if (fast) {
+        Ins(&R, readstrptr.body , "algo::StringIter iter(in_str);");
+        Ins(&R, readstrptr.body , "algo::strptr value;");
+        Ins(&R, readstrptr.body , "algo::tempstr buf;");
+        Ins(&R, readstrptr.body , "bool inorder = retval;");
+        ind_beg(amc::ctype_c_field_curs, field,ctype) {
+            if (amc::ind_func_Find(dmmeta::Func_Concat_field_name(field.field,"ReadStrptrMaybe"))) {
+                Set(R, "$name", name_Get(field));
+                Set(R, "$Fldtype", field.cpp_type);
+                Ins(&R, readstrptr.body , "inorder = inorder && algo::SsimAttrExpect(iter, \"$name\", value, buf);");
+                if (field.ctype_read) {
+                    Ins(&R, readstrptr.body , "inorder = inorder && $Fldtype_ReadStrptrMaybe(parent.$name, value);");
+                } else {
+                    Ins(&R, readstrptr.body , "inorder = inorder && $name_ReadStrptrMaybe(parent, value);");
+                }
+            }
+        }ind_end;
+        Ins(&R, readstrptr.body , "inorder = inorder && algo::SsimAttrEndQ(iter);");
+        Ins(&R, readstrptr.body , "if (retval && !inorder) {");
+    }
     Ins(&R, readstrptr.body     , "ind_beg(algo::Attr_curs, attr, in_str) {");
     if (n_anon > 0) {
         Ins(&R, readstrptr.body , "    if (ch_N(attr.name) == 0) {");
@@ -87,6 +111,9 @@ static void Ctype_ReadStrptrMaybe_Ssim(algo_lib::Replscope &R, amc::FCtype &ctyp
     }
     Ins(&R, readstrptr.body     , "    retval = retval && $Name_ReadFieldMaybe(parent, attr.name, attr.value);");
     Ins(&R, readstrptr.body     , " }ind_end;");
+    if (fast) {
+        Ins(&R, readstrptr.body , "}");
+    }
     if (n_anon > 0) {
         MaybeUnused(readstrptr, "anon_idx");
     }
@@ -76,6 +76,20 @@ static void Fwddecl_GenStructNs(amc::FNs &ns) {
                 tempstr parname = pool ? tempstr(name_Get(*pool)) : tempstr(name_Get(ctype));
                 amc::ind_fwddecl_GetOrCreate(tempstr()<<ns.ns<<"."<<ns.ns<<"."<<parname<<"_"<<name_Get(field)<<"_"<<name_Get(tfunc));
             }ind_end;
+            // column cursors of a Lary
+            if (field.reftype == dmmeta_Reftype_reftype_Lary) {
+                ind_beg(amc::ctype_c_field_curs, col, *field.p_arg) if (col.c_fcolumn) {
+                    amc::FField *pool = FirstInst(ctype);
+                    tempstr parname = pool ? tempstr(name_Get(*pool)) : tempstr(name_Get(ctype));
+                    amc::ind_fwddecl_GetOrCreate(tempstr()<<ns.ns<<"."<<ns.ns<<"."<<parname<<"_"<<name_Get(field)<<"_"<<name_Get(col)<<"_curs");
+                }ind_end;
+            }
+            // heap elements with inline keys
+            if (field.c_bheap && field.c_bheap->inlkey) {
+                amc::FField *pool = FirstInst(ctype);
+                tempstr parname = pool ? tempstr(name_Get(*pool)) : tempstr(name_Get(ctype));
+                amc::ind_fwddecl_GetOrCreate(tempstr()<<ns.ns<<"."<<ns.ns<<"."<<parname<<"_"<<name_Get(field)<<"_elem");
+            }
         }ind_end;
     }ind_end;
     ind_beg(amc::ns_c_fwddecl_curs,fwddecl,ns) {
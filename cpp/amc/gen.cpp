@@ -393,6 +393,7 @@ void amc::gen_check_reftype() {
         }
     }ind_end;
     if (algo_lib::_db.exit_code>0) {
+        algo_lib::FlushLog();
         _exit(1);
     }
 }
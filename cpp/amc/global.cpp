@@ -74,12 +74,18 @@ void amc::tfunc_Global_Init() {
             AddRetval(func, "void", "", "");
             func.inl = false;
             Ins(&R, func.body, "algo_lib::_db.last_signal             = 0;");
-            Ins(&R, func.body, "ary_beg(cstring, str, algo_lib::temp_strings_Getary()) {");
+            Ins(&R, func.body, "algo_lib::FTempclass &tempclass = algo_lib::tempclass_qFind(algo_lib::_db.temppool, 0);");
+            Ins(&R, func.body, "ary_beg(cstring, str, str_Getary(tempclass)) {");
             Ins(&R, func.body, "    ch_Reserve(str, 256);");
             Ins(&R, func.body, "}ary_end;");
-            Ins(&R, func.body, "algo_lib::_db.n_temp = algo_lib::temp_strings_N();");
+            Ins(&R, func.body, "tempclass.n = str_N(tempclass);");
+            Ins(&R, func.body, "algo_lib::_db.temppool.mask = 1;");
+            Ins(&R, func.body, "algo::CharsetNibble_Build(algo_lib::_db.SsimBreakNameNib, algo_lib::_db.SsimBreakName);");
+            Ins(&R, func.body, "algo::CharsetNibble_Build(algo_lib::_db.SsimBreakValueNib, algo_lib::_db.SsimBreakValue);");
+            Ins(&R, func.body, "algo_lib::InitHugepage();");
             Ins(&R, func.body, "algo_lib::bh_timehook_Reserve(32);");
             Ins(&R, func.body, "algo_lib::InitCpuHz();");
+            Ins(&R, func.body, "algo_lib::InitLogbuf();");
             Ins(&R, func.body, "algo_lib::_db.eol          = true;");
         }
     }
@@ -115,7 +121,10 @@ static void GenLoadTuples(amc::FFunc &ldt, algo_lib::Replscope &R, amc::FField &
         }
     }ind_end;
     ldt.body << "\n" << ls << "NULL" << "};\n";
-    Ins(&R, ldt.body, "retval = algo_lib::DoLoadTuples(root, $ns::InsertStrptrMaybe, ssimfiles, true);");
+    // key binary snapshot by input signature -- see gen_prep_signature
+    Set(R, "$signature", tempstr() << field.p_ctype->p_ns->signature_input);
+    Ins(&R, ldt.body, "retval = algo_lib::DoLoadTuplesSnap(root, \"$ns\", \"$signature\"");
+    Ins(&R, ldt.body, "    , $ns::InsertStrptrMaybe, $ns::InsertSnapMaybe, ssimfiles, true);");
 }
 
 // -----------------------------------------------------------------------------
@@ -193,6 +202,15 @@ void amc::tfunc_Global_InsertStrptrMaybe() {
             Ins(&R, fcn.body    , "case $ns_TableId_$basens_$basename: { // finput:$finput");
             Ins(&R, fcn.body    , "    $Elemtype elem;");
             Ins(&R, fcn.body    , "    retval = $Elemtype_ReadStrptrMaybe(elem, str);");
+            // record row image for binary snapshot, or the tuple itself
+            // if the row can't be copied as bytes
+            Ins(&R, fcn.body    , "    if (retval && algo_lib::_db.snap_rec) {");
+            if (PlainQ(*base)) {
+                Ins(&R, fcn.body, "        algo_lib::SnapRecord($ns_TableId_$basens_$basename, &elem, sizeof(elem));");
+            } else {
+                Ins(&R, fcn.body, "        algo_lib::SnapRecord(-1, str.elems, elems_N(str));");
+            }
+            Ins(&R, fcn.body    , "    }");
             Ins(&R, fcn.body    , "    retval = retval && $instname_InputMaybe(elem);");
             // non-strict mode -- always succeed
             if (!inst.c_finput->strict) {
@@ -202,6 +220,7 @@ void amc::tfunc_Global_InsertStrptrMaybe() {
             Ins(&R, fcn.body    , "}");
         }ind_end;
         Ins(&R, fcn.body    , "default:");
+        Ins(&R, fcn.body        , "    algo_lib::_db.snap_rec = false; // tuple cannot be recorded");
         if (ns_Get(*field.p_ctype) != "algo_lib") {
             Ins(&R, fcn.body    , "    retval = algo_lib::InsertStrptrMaybe(str);");
         }
@@ -215,6 +234,50 @@ void amc::tfunc_Global_InsertStrptrMaybe() {
 
 // -----------------------------------------------------------------------------
 
+// Counterpart of InsertStrptrMaybe for binary snapshots:
+// row image recorded by InsertStrptrMaybe is copied into the base type
+// and passed to the same input function.
+// Tables whose base type is not plain are recorded as text and don't appear here.
+void amc::tfunc_Global_InsertSnapMaybe() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
+
+    if (amc::HasFinputsQ(*field.p_ctype->p_ns)) {
+        amc::FFunc& fcn = amc::CreateCurFunc(true); {
+            AddProtoArg(fcn, "i32", "table_id");
+            AddProtoArg(fcn, "algo::memptr", "row");
+            AddRetval(fcn, "bool", "retval", "true");
+        }
+        Ins(&R, fcn.body   , "switch (table_id) {");
+        ind_beg(amc::ctype_c_field_curs, inst, *field.p_ctype) if (inst.c_finput && PlainQ(*GetBaseType(*inst.p_arg,inst.p_arg))) {
+            amc::FCtype *base  = GetBaseType(*inst.p_arg,inst.p_arg);
+            Set(R, "$basens" , ns_Get(*base));
+            Set(R, "$basename" , name_Get(*base));
+            Set(R, "$instname"   , name_Get(inst));
+            Set(R, "$finput"   , inst.field);
+            Set(R, "$Elemtype"  , amc::NsToCpp(base->ctype));
+            Ins(&R, fcn.body    , "case $ns_TableId_$basens_$basename: { // finput:$finput");
+            Ins(&R, fcn.body    , "    $Elemtype elem;");
+            Ins(&R, fcn.body    , "    retval = elems_N(row) == i32(sizeof(elem));");
+            Ins(&R, fcn.body    , "    if (retval) {");
+            Ins(&R, fcn.body    , "        memcpy((void*)&elem, row.elems, sizeof(elem));");
+            Ins(&R, fcn.body    , "        retval = $instname_InputMaybe(elem);");
+            if (!inst.c_finput->strict) {
+                Ins(&R, fcn.body, "        retval = true; // finput strict:N");
+            }
+            Ins(&R, fcn.body    , "    }");
+            Ins(&R, fcn.body    , "    break;");
+            Ins(&R, fcn.body    , "}");
+        }ind_end;
+        Ins(&R, fcn.body        , "default:");
+        Ins(&R, fcn.body        , "    retval = false;");
+        Ins(&R, fcn.body        , "    break;");
+        Ins(&R, fcn.body        , "} //switch");
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 void amc::tfunc_Global_InitReflection() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
     amc::FField &field = *amc::_db.genfield.p_field;
@@ -583,6 +646,10 @@ static void GenReadArgv(amc::FNs &ns, amc::FCtype &ctype) {
     // add standard options
     table << "    -verbose\t\tEnable verbose mode"<<eol;
     table << "    -debug\t\tEnable debug mode"<<eol;
+    table << "    -unbuffered\t\tDisable buffering of output"<<eol;
+    table << "    -snap\t\tLoad inputs from binary snapshots in temp/"<<eol;
+    table << "    -nommap\t\tRead input files instead of mapping them"<<eol;
+    table << "    -linebuf\tint\tMax. read buffer for piped input. default: 1048576"<<eol;
     table << "    -version\t\tShow version information"<<eol;
     table << "    -sig\t\tPrint SHA1 signatures for dispatches"<<eol;
     table << "    -help\t\tPrint this screen and exit"<<eol;
@@ -29,6 +29,89 @@
 
 // -----------------------------------------------------------------------------
 
+// Return Lary pool of CTYPE, or NULL if there is none
+amc::FField *amc::LaryColumnPool(amc::FCtype &ctype) {
+    amc::FField *ret = NULL;
+    ind_beg(amc::ctype_zd_inst_curs,inst,ctype) if (inst.reftype == dmmeta_Reftype_reftype_Lary) {
+        ret = &inst;
+        break;
+    }ind_end;
+    return ret;
+}
+
+// Return field of CTYPE tagged with dmmeta.rowid, or NULL if there is none
+amc::FField *amc::LaryRowidField(amc::FCtype &ctype) {
+    amc::FField *ret = NULL;
+    ind_beg(amc::ctype_c_field_curs,field,ctype) if (field.c_rowid) {
+        ret = &field;
+        break;
+    }ind_end;
+    return ret;
+}
+
+// True if some field of CTYPE is stored in a column (see dmmeta.fcolumn)
+bool amc::HasColumnQ(amc::FCtype &ctype) {
+    bool ret = false;
+    ind_beg(amc::ctype_c_field_curs,field,ctype) if (field.c_fcolumn) {
+        ret = true;
+        break;
+    }ind_end;
+    return ret;
+}
+
+// Check that column field FIELD can be stored in a separate array of its pool.
+// The row must be created only through a Lary, must have a rowid field
+// through which the column is indexed, and the value must be cheap to copy.
+bool amc::CheckFcolumnQ(amc::FField &field) {
+    amc::FCtype &ctype = *field.p_ctype;
+    amc::FField *pool = LaryColumnPool(ctype);
+    amc::FField *rowid = LaryRowidField(ctype);
+    tempstr err;
+    if (!pool || zd_inst_N(ctype) != 1) {
+        err << "column requires the row to be allocated only from a Lary";
+    } else if (!rowid || rowid->c_fcolumn || !rowid->p_arg->c_bltin) {
+        err << "column requires an integer dmmeta.rowid field that is not itself a column";
+    } else if (!field.p_arg->c_bltin && !CheapCopyQ(field)) {
+        err << "column type must be a builtin or a cheap_copy cpptype";
+    } else if (FldfuncQ(field) || field.c_fbigend || field.c_bitfld || field.c_xref || PadQ(field)) {
+        err << "column may not be computed, big-endian, a bitfield, an xref or padding";
+    }
+    if (ch_N(err)) {
+        prerr("amc.fcolumn"
+              <<Keyval("field",field.field)
+              <<Keyval("comment",err));
+        algo_lib::_db.exit_code++;
+    }
+    return !ch_N(err);
+}
+
+// Set $colname, $Coltype for column field COL
+static void SetColumnVars(algo_lib::Replscope &R, amc::FField &col) {
+    Set(R, "$colname", name_Get(col));
+    Set(R, "$Coltype", col.cpp_type);
+}
+
+// Member initializer list of the default constructor of CTYPE, binding
+// each column field (a reference) to its slot in the column arrays.
+// Rows are constructed only by the Lary's AllocMaybe, after AllocMem has
+// bumped the element count, so the new row's id is <pool>_N() - 1.
+// Return empty string if CTYPE has no columns.
+tempstr amc::LaryColumnCtorInit(amc::FCtype &ctype) {
+    tempstr ret;
+    amc::FField *pool = LaryColumnPool(ctype);
+    ListSep ls(", ");
+    ind_beg(amc::ctype_c_field_curs,col,ctype) if (col.c_fcolumn && pool) {
+        if (!ch_N(ret)) {
+            ret << " : ";
+        }
+        ret << ls << name_Get(col) << "(" << name_Get(*pool) << "_" << name_Get(col) << "_qFind("
+            << EvalRowid(ctype) << "(" << name_Get(*pool) << "_N() - 1)))";
+    }ind_end;
+    return ret;
+}
+
+// -----------------------------------------------------------------------------
+
 void amc::tclass_Lary() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
     amc::FField &field = *amc::_db.genfield.p_field;
@@ -41,12 +124,18 @@ void amc::tclass_Lary() {
     GenTclass(amc_tclass_Pool);
     InsVar(R, field.p_ctype, "$Cpptype*", "$name_lary[$nlevels]", "", "level array");
     InsVar(R, field.p_ctype, "i32", "$name_n", "", "number of elements in array");
+    // column fields are stored in separate level arrays, allocated in lockstep with rows
+    ind_beg(amc::ctype_c_field_curs,col,*field.p_arg) if (col.c_fcolumn) {
+        SetColumnVars(R, col);
+        InsVar(R, field.p_ctype, "$Coltype*", "$name_$colname_lary[$nlevels]", "", "level array for column $colname");
+    }ind_end;
     vrfy(field.p_ctype->p_ns->c_globfld != NULL
          , tempstr()<<"Lary "<<field.arg<<" requires global FDb._db in namespace "<<ns_Get(*field.p_ctype));
 }
 
 void amc::tfunc_Lary_AllocMem() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
 
     amc::FFunc& alloc = amc::CreateCurFunc();
     Ins(&R, alloc.ret  , "void*", false);
@@ -62,8 +151,34 @@ void amc::tfunc_Lary_AllocMem() {
     Ins(&R, alloc.body, "if (bsr < $nlevels) {");
     Ins(&R, alloc.body, "    lev = $parname.$name_lary[bsr];");
     Ins(&R, alloc.body, "    if (!lev) {");
-    Ins(&R, alloc.body, "        lev=($Cpptype*)$basepool_AllocMem(sizeof($Cpptype) * (u64(1)<<bsr));");
-    Ins(&R, alloc.body, "        $parname.$name_lary[bsr] = lev;");
+    if (HasColumnQ(*field.p_arg)) {
+        // column levels are created before the row level, so that the row level
+        // exists only if all of its columns do; on failure, release what was created
+        Ins(&R, alloc.body, "        bool ok = true;");
+        ind_beg(amc::ctype_c_field_curs,col,*field.p_arg) if (col.c_fcolumn) {
+            SetColumnVars(R, col);
+            Ins(&R, alloc.body, "        if (ok) {");
+            Ins(&R, alloc.body, "            $parname.$name_$colname_lary[bsr] = ($Coltype*)$basepool_AllocMem(sizeof($Coltype) * (u64(1)<<bsr));");
+            Ins(&R, alloc.body, "            ok = $parname.$name_$colname_lary[bsr] != NULL;");
+            Ins(&R, alloc.body, "        }");
+        }ind_end;
+        Ins(&R, alloc.body, "        if (ok) {");
+        Ins(&R, alloc.body, "            lev=($Cpptype*)$basepool_AllocMem(sizeof($Cpptype) * (u64(1)<<bsr));");
+        Ins(&R, alloc.body, "            $parname.$name_lary[bsr] = lev;");
+        Ins(&R, alloc.body, "        }");
+        Ins(&R, alloc.body, "        if (!lev) {");
+        ind_beg(amc::ctype_c_field_curs,col,*field.p_arg) if (col.c_fcolumn) {
+            SetColumnVars(R, col);
+            Ins(&R, alloc.body, "            if ($parname.$name_$colname_lary[bsr]) {");
+            Ins(&R, alloc.body, "                $basepool_FreeMem($parname.$name_$colname_lary[bsr], sizeof($Coltype) * (u64(1)<<bsr));");
+            Ins(&R, alloc.body, "                $parname.$name_$colname_lary[bsr] = NULL;");
+            Ins(&R, alloc.body, "            }");
+        }ind_end;
+        Ins(&R, alloc.body, "        }");
+    } else {
+        Ins(&R, alloc.body, "        lev=($Cpptype*)$basepool_AllocMem(sizeof($Cpptype) * (u64(1)<<bsr));");
+        Ins(&R, alloc.body, "        $parname.$name_lary[bsr] = lev;");
+    }
     Ins(&R, alloc.body, "    }");
     Ins(&R, alloc.body, "}");
     Ins(&R, alloc.body, "// allocate element from this level");
@@ -103,6 +218,7 @@ void amc::tfunc_Lary_Find() {
 
 void amc::tfunc_Lary_Init() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
 
     amc::FFunc& init = amc::CreateCurFunc();
     init.inl = false;
@@ -117,6 +233,19 @@ void amc::tfunc_Lary_Init() {
     Ins(&R, init.body, "    $parname.$name_lary[i]  = $name_first;");
     Ins(&R, init.body, "    $name_first    += 1ULL<<i;");
     Ins(&R, init.body, "}");
+    ind_beg(amc::ctype_c_field_curs,col,*field.p_arg) if (col.c_fcolumn) {
+        SetColumnVars(R, col);
+        Ins(&R, init.body, "// column $colname");
+        Ins(&R, init.body, "memset($parname.$name_$colname_lary, 0, sizeof($parname.$name_$colname_lary));");
+        Ins(&R, init.body, "$Coltype* $name_$colname_first = ($Coltype*)$basepool_AllocMem(sizeof($Coltype) * (u64(1)<<$prealloc));");
+        Ins(&R, init.body, "if (!$name_$colname_first) {");
+        Ins(&R, init.body, "    FatalErrorExit(\"out of memory\");");
+        Ins(&R, init.body, "}");
+        Ins(&R, init.body, "for (int i = 0; i < $prealloc; i++) {");
+        Ins(&R, init.body, "    $parname.$name_$colname_lary[i]  = $name_$colname_first;");
+        Ins(&R, init.body, "    $name_$colname_first    += 1ULL<<i;");
+        Ins(&R, init.body, "}");
+    }ind_end;
 }
 
 void amc::tfunc_Lary_Last() {
@@ -213,11 +342,20 @@ void amc::tfunc_Lary_Uninit() {
         Ins(&R, uninit.body, "for (u64 i = $prealloc; i < $nlevels && $parname.$name_lary[i]; i++) {");
         Ins(&R, uninit.body, "    $basepool_FreeMem($parname.$name_lary[i],sizeof($Cpptype) * (u64(1)<<i));");
         Ins(&R, uninit.body, "}");
+        ind_beg(amc::ctype_c_field_curs,col,*field.p_arg) if (col.c_fcolumn) {
+            SetColumnVars(R, col);
+            Ins(&R, uninit.body, "// destroy levels of column $colname");
+            Ins(&R, uninit.body, "$basepool_FreeMem($parname.$name_$colname_lary[0],sizeof($Coltype) * (u64(1)<<$prealloc));");
+            Ins(&R, uninit.body, "for (u64 i = $prealloc; i < $nlevels && $parname.$name_$colname_lary[i]; i++) {");
+            Ins(&R, uninit.body, "    $basepool_FreeMem($parname.$name_$colname_lary[i],sizeof($Coltype) * (u64(1)<<i));");
+            Ins(&R, uninit.body, "}");
+        }ind_end;
     }
 }
 
 void amc::tfunc_Lary_qFind() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
 
     amc::FFunc& qfind = amc::CreateCurFunc();
     qfind.inl = true;
@@ -228,6 +366,21 @@ void amc::tfunc_Lary_qFind() {
     Ins(&R, qfind.body, "u64 base  = u64(1)<<bsr;");
     Ins(&R, qfind.body, "u64 index = x-base;");
     Ins(&R, qfind.body, "return $parname.$name_lary[bsr][index];");
+
+    // access to column values by row id
+    ind_beg(amc::ctype_c_field_curs,col,*field.p_arg) if (col.c_fcolumn) {
+        SetColumnVars(R, col);
+        amc::FFunc& colfind = amc::ind_func_GetOrCreate(Subst(R,"$field.$colname_qFind"));
+        colfind.inl = true;
+        Ins(&R, colfind.comment, "'quick' Access value of column $colname by row id. No bounds checking.");
+        Ins(&R, colfind.ret  , "$Coltype&", false);
+        Ins(&R, colfind.proto, "$name_$colname_qFind($Parent, $Rowid t)", false);
+        Ins(&R, colfind.body, "u64 x = t + 1;");
+        Ins(&R, colfind.body, "u64 bsr   = algo::u64_BitScanReverse(x);");
+        Ins(&R, colfind.body, "u64 base  = u64(1)<<bsr;");
+        Ins(&R, colfind.body, "u64 index = x-base;");
+        Ins(&R, colfind.body, "return $parname.$name_$colname_lary[bsr][index];");
+    }ind_end;
 }
 
 void amc::tfunc_Lary_qLast() {
@@ -296,4 +449,59 @@ void amc::tfunc_Lary_curs() {
         Ins(&R, curs_access.proto, "$Parname_$name_curs_Access($Parname_$name_curs &curs)", false);
         Ins(&R, curs_access.body, "return $name_qFind($curspararg, $Rowid(curs.index));");
     }
+
+    // column cursors visit values of a single column level by level,
+    // without touching the rows. curs.index is the row id of the current value.
+    ind_beg(amc::ctype_c_field_curs,col,*field.p_arg) if (col.c_fcolumn) {
+        SetColumnVars(R, col);
+        Ins(&R, ns.curstext    , "");
+        Ins(&R, ns.curstext    , "struct $Parname_$name_$colname_curs {// column cursor");
+        Ins(&R, ns.curstext    , "    typedef $Coltype ChildType;");
+        Ins(&R, ns.curstext    , "    $Partype *parent;");
+        Ins(&R, ns.curstext    , "    $Coltype *elems; // current level");
+        Ins(&R, ns.curstext    , "    i64 index; // row id of current element");
+        Ins(&R, ns.curstext    , "    i64 i; // index on current level");
+        Ins(&R, ns.curstext    , "    i32 level;");
+        Ins(&R, ns.curstext    , "    $Parname_$name_$colname_curs(){ parent=NULL; elems=NULL; index=0; i=0; level=0; }");
+        Ins(&R, ns.curstext    , "};");
+        Ins(&R, ns.curstext    , "");
+
+        amc::FFunc& colcurs_reset = amc::ind_func_GetOrCreate(Subst(R,"$field_$colname_curs.Reset"));
+        colcurs_reset.inl = true;
+        Ins(&R, colcurs_reset.comment, "Position cursor at the value of row 0 in column $colname");
+        Ins(&R, colcurs_reset.ret  , "void", false);
+        Ins(&R, colcurs_reset.proto, "$Parname_$name_$colname_curs_Reset($Parname_$name_$colname_curs &curs, $Partype &parent)", false);
+        Ins(&R, colcurs_reset.body, "curs.parent = &parent;");
+        Ins(&R, colcurs_reset.body, "curs.elems = $cursparent.$name_$colname_lary[0];");
+        Ins(&R, colcurs_reset.body, "curs.index = 0;");
+        Ins(&R, colcurs_reset.body, "curs.i = 0;");
+        Ins(&R, colcurs_reset.body, "curs.level = 0;");
+
+        amc::FFunc& colcurs_validq = amc::ind_func_GetOrCreate(Subst(R,"$field_$colname_curs.ValidQ"));
+        colcurs_validq.inl = true;
+        Ins(&R, colcurs_validq.comment, "cursor points to valid item");
+        Ins(&R, colcurs_validq.ret  , "bool", false);
+        Ins(&R, colcurs_validq.proto, "$Parname_$name_$colname_curs_ValidQ($Parname_$name_$colname_curs &curs)", false);
+        Ins(&R, colcurs_validq.body, "return curs.index < $cursparent.$name_n;");
+
+        amc::FFunc& colcurs_next = amc::ind_func_GetOrCreate(Subst(R,"$field_$colname_curs.Next"));
+        colcurs_next.inl = true;
+        Ins(&R, colcurs_next.comment, "proceed to next item");
+        Ins(&R, colcurs_next.ret  , "void", false);
+        Ins(&R, colcurs_next.proto, "$Parname_$name_$colname_curs_Next($Parname_$name_$colname_curs &curs)", false);
+        Ins(&R, colcurs_next.body, "curs.index++;");
+        Ins(&R, colcurs_next.body, "curs.i++;");
+        Ins(&R, colcurs_next.body, "if (curs.i == (i64(1) << curs.level)) {// proceed to next level");
+        Ins(&R, colcurs_next.body, "    curs.level++;");
+        Ins(&R, colcurs_next.body, "    curs.i = 0;");
+        Ins(&R, colcurs_next.body, "    curs.elems = $cursparent.$name_$colname_lary[curs.level];");
+        Ins(&R, colcurs_next.body, "}");
+
+        amc::FFunc& colcurs_access = amc::ind_func_GetOrCreate(Subst(R,"$field_$colname_curs.Access"));
+        colcurs_access.inl = true;
+        Ins(&R, colcurs_access.comment, "item access");
+        Ins(&R, colcurs_access.ret  , "$Coltype&", false);
+        Ins(&R, colcurs_access.proto, "$Parname_$name_$colname_curs_Access($Parname_$name_$colname_curs &curs)", false);
+        Ins(&R, colcurs_access.body, "return curs.elems[curs.i];");
+    }ind_end;
 }
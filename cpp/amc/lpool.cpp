@@ -34,6 +34,29 @@ static bool HaveCountQ(amc::FField &field) {
     return field.arg != "u8";
 }
 
+// With dmmeta.magazine, each thread caches up to $magsize free blocks per size class
+// (for blocks up to 2^$magcell bytes). Larger blocks, refills and spills
+// go to the shared free lists under a mutex.
+static void SetMagazineVars(algo_lib::Replscope &R, amc::FField &field) {
+    if (!GlobalQ(*field.p_ctype)) {
+        prerr("amc.magazine_global"
+              <<Keyval("field",field.field)
+              <<Keyval("comment","per-thread magazine requires a pool in the global namespace struct"));
+        algo_lib::_db.exit_code++;
+    }
+    u32 size = u32_Max(field.c_magazine->size, 2);
+    Set(R, "$magsize", tempstr() << size);
+    Set(R, "$magbatch", tempstr() << size/2);
+    Set(R, "$magcell", "16");
+}
+
+// Lock shared free lists (magazine only)
+static void InsLock(algo_lib::Replscope &R, amc::FFunc &func, bool lock) {
+    if (amc::_db.genfield.p_field->c_magazine) {
+        Ins(&R, func.body, lock ? "pthread_mutex_lock(&$parname.$name_lock);" : "pthread_mutex_unlock(&$parname.$name_lock);");
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 void amc::tclass_Lpool() {
@@ -52,15 +75,82 @@ void amc::tclass_Lpool() {
         InsVar(R, field.p_ctype, "i64", "$name_n", "", "Number of elements");
     }
     InsVar(R, field.p_ctype, "$name_Lpblock*", "$name_free[$nlevels]", "", "Lpool levels");
+    if (field.c_magazine) {
+        SetMagazineVars(R, field);
+        InsVar(R, field.p_ctype, "pthread_mutex_t", "$name_lock", "", "Protects $name_free in multi-threaded use");
+        InsVar(R, field.p_ctype, "u64", "$name_n_maghit", "", "Allocations served from per-thread magazines");
+        InsVar(R, field.p_ctype, "u64", "$name_n_refill", "", "Number of magazine refills from shared free lists");
+        InsVar(R, field.p_ctype, "u64", "$name_n_spill", "", "Number of magazine spills to shared free lists");
+        Ins(&R, *ns.hdr, "struct $name_Lpmag {// per-thread cache of free blocks ($field)");
+        Ins(&R, *ns.hdr, "    $name_Lpblock* head[$magcell+1];  // free blocks by size class");
+        Ins(&R, *ns.hdr, "    i32 n[$magcell+1];  // number of blocks in each list");
+        Ins(&R, *ns.hdr, "    u64 n_hit;  // allocations from magazine, not yet added to $name_n_maghit");
+        Ins(&R, *ns.hdr, "};");
+        Ins(&R, *ns.cpp, "static thread_local $ns::$name_Lpmag $ns_$name_lpmag; // ($field) per-thread magazine");
+    }
 }
 
 // -----------------------------------------------------------------------------
 
+static void GenFreeMemMag(algo_lib::Replscope &R, amc::FFunc &func) {
+    Ins(&R, func.comment, "Thread-safe: small blocks go to the calling thread's magazine.");
+    Ins(&R, func.body, "if (mem) {");
+    Ins(&R, func.body, "    size = u64_Max(size,16); // enforce alignment");
+    Ins(&R, func.body, "    u64 cell = u64_BitScanReverse(size-1) + 1;");
+    Ins(&R, func.body, "    $name_Lpblock *temp = ($name_Lpblock*)mem;");
+    Ins(&R, func.body, "    if (cell <= $magcell) {");
+    Ins(&R, func.body, "        $ns::$name_Lpmag &mag = $ns_$name_lpmag;");
+    Ins(&R, func.body, "        temp->next = mag.head[cell];");
+    Ins(&R, func.body, "        mag.head[cell] = temp;");
+    Ins(&R, func.body, "        mag.n[cell]++;");
+    Ins(&R, func.body, "        if (UNLIKELY(mag.n[cell] > $magsize)) {");
+    Ins(&R, func.body, "            $name_Spill($pararg, mag, cell, $magbatch);");
+    Ins(&R, func.body, "        }");
+    Ins(&R, func.body, "    } else {");
+    Ins(&R, func.body, "        pthread_mutex_lock(&$parname.$name_lock);");
+    Ins(&R, func.body, "        $name_FreeShared($pararg, temp, cell);");
+    Ins(&R, func.body, "        pthread_mutex_unlock(&$parname.$name_lock);");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "}");
+
+    amc::FFunc& shared = amc::ind_func_GetOrCreate(Subst(R,"$field.FreeShared"));
+    shared.priv = true;
+    Ins(&R, shared.comment, "Push block onto shared free list for size class CELL. Caller holds the lock.");
+    Ins(&R, shared.ret  , "void", false);
+    Ins(&R, shared.proto, "$name_FreeShared($Parent, $name_Lpblock *blk, u64 cell)", false);
+    Ins(&R, shared.body, "blk->next = $parname.$name_free[cell];");
+    Ins(&R, shared.body, "$parname.$name_free[cell] = blk;");
+    if (HaveCountQ(*amc::_db.genfield.p_field)) {
+        Ins(&R, shared.body, "$parname.$name_n--;");
+    }
+
+    amc::FFunc& spill = amc::ind_func_GetOrCreate(Subst(R,"$field.Spill"));
+    spill.priv = true;
+    Ins(&R, spill.comment, "Move N blocks of size class CELL from magazine MAG to the shared free list");
+    Ins(&R, spill.ret  , "void", false);
+    Ins(&R, spill.proto, "$name_Spill($Parent, $ns::$name_Lpmag &mag, u64 cell, int n)", false);
+    Ins(&R, spill.body, "pthread_mutex_lock(&$parname.$name_lock);");
+    Ins(&R, spill.body, "$parname.$name_n_maghit += mag.n_hit;");
+    Ins(&R, spill.body, "mag.n_hit = 0;");
+    Ins(&R, spill.body, "$parname.$name_n_spill++;");
+    Ins(&R, spill.body, "for (; n > 0 && mag.head[cell]; n--) {");
+    Ins(&R, spill.body, "    $name_Lpblock *blk = mag.head[cell];");
+    Ins(&R, spill.body, "    mag.head[cell] = blk->next;");
+    Ins(&R, spill.body, "    mag.n[cell]--;");
+    Ins(&R, spill.body, "    $name_FreeShared($pararg, blk, cell);");
+    Ins(&R, spill.body, "}");
+    Ins(&R, spill.body, "pthread_mutex_unlock(&$parname.$name_lock);");
+}
+
 void amc::tfunc_Lpool_FreeMem() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
     amc::FFunc& func = amc::CreateCurFunc();
     Ins(&R, func.ret  , "void", false);
     Ins(&R, func.proto, "$name_FreeMem($Parent, void *mem, u64 size)", false);
+    if (amc::_db.genfield.p_field->c_magazine) {
+        GenFreeMemMag(R, func);
+        return;
+    }
     Ins(&R, func.body, "if (mem) {");
     Ins(&R, func.body, "    size = u64_Max(size,16); // enforce alignment");
     Ins(&R, func.body, "    u64 cell = u64_BitScanReverse(size-1) + 1;");
@@ -75,16 +165,8 @@ void amc::tfunc_Lpool_FreeMem() {
 
 // -----------------------------------------------------------------------------
 
-void amc::tfunc_Lpool_AllocMem() {
-    algo_lib::Replscope &R = amc::_db.genfield.R;
-    amc::FFunc& func = amc::CreateCurFunc();
-    Ins(&R, func.ret  , "void*", false);
-    Ins(&R, func.proto, "$name_AllocMem($Parent, u64 size)", false);
-    Ins(&R, func.comment, "Allocate new piece of memory at least SIZE bytes long.");
-    Ins(&R, func.comment, "If not successful, return NULL");
-    Ins(&R, func.comment, "The allocated block is 16-byte aligned");
-    Ins(&R, func.body, "size     = u64_Max(size,16); // enforce alignment");
-    Ins(&R, func.body, "u64 cell = u64_BitScanReverse(size-1)+1;");
+// Allocation from the shared free lists, given size class CELL
+static void GenAllocBody(algo_lib::Replscope &R, amc::FFunc &func) {
     Ins(&R, func.body, "u64 i    = cell;");
     Ins(&R, func.body, "u8 *retval = NULL;");
     Ins(&R, func.body, "// try to find a block that's at least as large as required.");
@@ -117,6 +199,78 @@ void amc::tfunc_Lpool_AllocMem() {
     if (HaveCountQ(*amc::_db.genfield.p_field)) {
         Ins(&R, func.body, "$parname.$name_n += retval != NULL;");
     }
+}
+
+static void GenAllocMemMag(algo_lib::Replscope &R, amc::FFunc &func) {
+    Ins(&R, func.comment, "Thread-safe: small blocks come from the calling thread's magazine.");
+    Ins(&R, func.body, "size     = u64_Max(size,16); // enforce alignment");
+    Ins(&R, func.body, "u64 cell = u64_BitScanReverse(size-1)+1;");
+    Ins(&R, func.body, "u8 *retval = NULL;");
+    Ins(&R, func.body, "if (cell <= $magcell) {");
+    Ins(&R, func.body, "    $ns::$name_Lpmag &mag = $ns_$name_lpmag;");
+    Ins(&R, func.body, "    $name_Lpblock *blk = mag.head[cell];");
+    Ins(&R, func.body, "    if (LIKELY(blk)) {");
+    Ins(&R, func.body, "        mag.head[cell] = blk->next;");
+    Ins(&R, func.body, "        mag.n[cell]--;");
+    Ins(&R, func.body, "        mag.n_hit++;");
+    Ins(&R, func.body, "        retval = (u8*)blk;");
+    Ins(&R, func.body, "    } else {");
+    Ins(&R, func.body, "        retval = $name_Refill($pararg, mag, cell);");
+    Ins(&R, func.body, "    }");
+    Ins(&R, func.body, "} else {");
+    Ins(&R, func.body, "    pthread_mutex_lock(&$parname.$name_lock);");
+    Ins(&R, func.body, "    retval = $name_AllocShared($pararg, cell);");
+    Ins(&R, func.body, "    pthread_mutex_unlock(&$parname.$name_lock);");
+    Ins(&R, func.body, "}");
+    Ins(&R, func.body, "return retval;");
+
+    amc::FFunc& shared = amc::ind_func_GetOrCreate(Subst(R,"$field.AllocShared"));
+    shared.priv = true;
+    Ins(&R, shared.comment, "Allocate block of size class CELL from the shared free lists. Caller holds the lock.");
+    Ins(&R, shared.ret  , "u8*", false);
+    Ins(&R, shared.proto, "$name_AllocShared($Parent, u64 cell)", false);
+    GenAllocBody(R, shared);
+    Ins(&R, shared.body, "return retval;");
+
+    amc::FFunc& refill = amc::ind_func_GetOrCreate(Subst(R,"$field.Refill"));
+    refill.priv = true;
+    Ins(&R, refill.comment, "Magazine MAG has no blocks of size class CELL: move up to $magbatch blocks");
+    Ins(&R, refill.comment, "from the shared free lists into MAG, and return one more block (NULL if out of memory).");
+    Ins(&R, refill.ret  , "u8*", false);
+    Ins(&R, refill.proto, "$name_Refill($Parent, $ns::$name_Lpmag &mag, u64 cell)", false);
+    Ins(&R, refill.body, "pthread_mutex_lock(&$parname.$name_lock);");
+    Ins(&R, refill.body, "$parname.$name_n_maghit += mag.n_hit;");
+    Ins(&R, refill.body, "mag.n_hit = 0;");
+    Ins(&R, refill.body, "$parname.$name_n_refill++;");
+    Ins(&R, refill.body, "u8 *ret = $name_AllocShared($pararg, cell);");
+    Ins(&R, refill.body, "for (int i = 0; ret && i < $magbatch; i++) {");
+    Ins(&R, refill.body, "    $name_Lpblock *blk = ($name_Lpblock*)$name_AllocShared($pararg, cell);");
+    Ins(&R, refill.body, "    if (!blk) {");
+    Ins(&R, refill.body, "        break;");
+    Ins(&R, refill.body, "    }");
+    Ins(&R, refill.body, "    blk->next = mag.head[cell];");
+    Ins(&R, refill.body, "    mag.head[cell] = blk;");
+    Ins(&R, refill.body, "    mag.n[cell]++;");
+    Ins(&R, refill.body, "}");
+    Ins(&R, refill.body, "pthread_mutex_unlock(&$parname.$name_lock);");
+    Ins(&R, refill.body, "return ret;");
+}
+
+void amc::tfunc_Lpool_AllocMem() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FFunc& func = amc::CreateCurFunc();
+    Ins(&R, func.ret  , "void*", false);
+    Ins(&R, func.proto, "$name_AllocMem($Parent, u64 size)", false);
+    Ins(&R, func.comment, "Allocate new piece of memory at least SIZE bytes long.");
+    Ins(&R, func.comment, "If not successful, return NULL");
+    Ins(&R, func.comment, "The allocated block is 16-byte aligned");
+    if (amc::_db.genfield.p_field->c_magazine) {
+        GenAllocMemMag(R, func);
+        return;
+    }
+    Ins(&R, func.body, "size     = u64_Max(size,16); // enforce alignment");
+    Ins(&R, func.body, "u64 cell = u64_BitScanReverse(size-1)+1;");
+    GenAllocBody(R, func);
     Ins(&R, func.body, "return retval;");
 }
 
@@ -128,6 +282,7 @@ void amc::tfunc_Lpool_ReserveBuffers() {
     Ins(&R, func.ret  , "bool", false);
     Ins(&R, func.proto, "$name_ReserveBuffers($Parent, int nbuf, u64 bufsize)", false);
     Ins(&R, func.body, "bool retval = true;");
+    InsLock(R, func, true);
     Ins(&R, func.body, "bufsize = u64_Max(bufsize, 16);");
     Ins(&R, func.body, "for (int i = 0; i < nbuf; i++) {");
     Ins(&R, func.body, "    u64     cell = u64_BitScanReverse(bufsize-1)+1;");
@@ -141,6 +296,7 @@ void amc::tfunc_Lpool_ReserveBuffers() {
     Ins(&R, func.body, "        $parname.$name_free[cell] = temp;");
     Ins(&R, func.body, "    }");
     Ins(&R, func.body, "}");
+    InsLock(R, func, false);
     Ins(&R, func.body, "return retval;");
 }
 
@@ -177,6 +333,30 @@ void amc::tfunc_Lpool_Init() {
     if (HaveCountQ(*amc::_db.genfield.p_field)) {
         Ins(&R, func.body, "$parname.$name_n = 0;");
     }
+    if (amc::_db.genfield.p_field->c_magazine) {
+        Ins(&R, func.body, "pthread_mutex_init(&$parname.$name_lock, NULL);");
+        Ins(&R, func.body, "$parname.$name_n_maghit = 0;");
+        Ins(&R, func.body, "$parname.$name_n_refill = 0;");
+        Ins(&R, func.body, "$parname.$name_n_spill = 0;");
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void amc::tfunc_Lpool_FlushMag() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    if (amc::_db.genfield.p_field->c_magazine) {
+        amc::FFunc& func = amc::CreateCurFunc();
+        Ins(&R, func.comment, "A thread should call this before exiting; otherwise its cached blocks are lost.");
+        Ins(&R, func.ret  , "void", false);
+        Ins(&R, func.proto, "$name_FlushMag($Parent)", false);
+        Ins(&R, func.body, "$ns::$name_Lpmag &mag = $ns_$name_lpmag;");
+        Ins(&R, func.body, "for (u64 cell = 0; cell <= $magcell; cell++) {");
+        Ins(&R, func.body, "    if (mag.n[cell] > 0) {");
+        Ins(&R, func.body, "        $name_Spill($pararg, mag, cell, mag.n[cell]);");
+        Ins(&R, func.body, "    }");
+        Ins(&R, func.body, "}");
+    }
 }
 
 // -----------------------------------------------------------------------------
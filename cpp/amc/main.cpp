@@ -221,6 +221,27 @@ bool amc::HasFinputsQ(amc::FNs &ns) {
     return ret;
 }
 
+// True if values of CTYPE can be saved and restored as raw bytes:
+// every field is stored in-place and recursively consists of built-in types.
+bool amc::PlainQ(amc::FCtype &ctype) {
+    bool ret = ctype.c_bltin || !ctype.c_cextern;
+    ind_beg(amc::ctype_c_field_curs, field, ctype) if (ret) {
+        if (field.reftype == dmmeta_Reftype_reftype_Pkey) {
+            amc::FField *key = c_field_Find(*field.p_arg, 0);
+            ret = key && PlainQ(*key->p_arg);
+        } else if (field.reftype == dmmeta_Reftype_reftype_Val
+                   || field.reftype == dmmeta_Reftype_reftype_Smallstr
+                   || field.reftype == dmmeta_Reftype_reftype_Inlary
+                   || field.reftype == dmmeta_Reftype_reftype_Bitfld
+                   || field.reftype == dmmeta_Reftype_reftype_Base) {
+            ret = PlainQ(*field.p_arg);
+        } else {
+            ret = false;
+        }
+    }ind_end;
+    return ret;
+}
+
 tempstr amc::PkeyCppident(algo::Tuple &tuple) {
     tempstr ret;
     algo::Attr *attr = &attrs_qFind(tuple,0);
@@ -1074,6 +1095,7 @@ static void Main_Edit() {
     int rc = acr_Exec(acr);
     if (rc==0) {
         // acr did nothing, exit as quickly as possible
+        algo_lib::FlushLog();
         _exit(0);
     }
     amc::_db.cmdline.query = "";// revert to a normal run
@@ -1090,6 +1112,7 @@ static void Main_Report() {
     if (amc::_db.cmdline.report) {
         prlog(amc::_db.report);
     }
+    verblog(algo_lib::_db.temppool.stats);
 }
 
 // -----------------------------------------------------------------------------
@@ -1121,6 +1144,9 @@ static void Main_Gen() {
 // OUTPUT        Generate files for the namespace(s)
 
 void amc::Main() {
+    if (algo_lib::_db.cmdline.verbose) {
+        algo_lib::TempstrStatsEnable();// printed by Main_Report
+    }
     // create default malloc pool for each imd
     // set imd->c_malloc to point to this pool
     amc::_db.c_malloc = amc::ind_field_Find("algo_lib.FDb.malloc");
@@ -34,10 +34,14 @@ void amc::tclass_Sbrk() {
 
     include_Alloc(ns) << "#include <sys/wait.h>";
     include_Alloc(ns) << "#include <sys/mman.h>";
+    include_Alloc(ns) << "#include <sys/syscall.h>";
 
     InsVar(R, field.p_ctype, "u64", "$name_huge_limit", "", "Huge page limit in bytes -- set to 0 with fork!");
     InsVar(R, field.p_ctype, "u64", "$name_huge_alloc", "", "Huge page bytes allocated");
     InsVar(R, field.p_ctype, "bool", "$name_zeromem", "", "Zero allocated memory");
+    InsVar(R, field.p_ctype, "bool", "$name_thp", "", "Back big blocks with transparent huge pages (madvise)");
+    InsVar(R, field.p_ctype, "i32", "$name_numa_node", "", "If >= 0, bind big blocks to this NUMA node");
+    InsVar(R, field.p_ctype, "u64", "$name_thp_alloc", "", "Bytes advised as transparent huge pages");
 }
 
 void amc::tfunc_Sbrk_AllocMem() {
@@ -74,6 +78,9 @@ void amc::tfunc_Sbrk_AllocMem() {
     Ins(&R, allocmem.body    , "            $parname.$name_huge_alloc += size;");
     Ins(&R, allocmem.body    , "        }");
     Ins(&R, allocmem.body    , "    }");
+    Ins(&R, allocmem.body    , "    if (ret == MAP_FAILED && ($parname.$name_thp || $parname.$name_numa_node >= 0)) {");
+    Ins(&R, allocmem.body    , "        ret = $name_MapAdvised($pararg, size);");
+    Ins(&R, allocmem.body    , "    }");
     Ins(&R, allocmem.body    , "    if (ret == MAP_FAILED) { // try regular mmap");
     Ins(&R, allocmem.body    , "        $parname.$name_huge_limit = 0; // don't try huge pages again");
     Ins(&R, allocmem.body    , "        ret = mmap(0x0, size, prot, flags, 0, 0);");
@@ -94,6 +101,49 @@ void amc::tfunc_Sbrk_AllocMem() {
     Ins(&R, allocmem.body    , "    memset(ret,0,size); // touch all bytes in the new memory block");
     Ins(&R, allocmem.body    , "}");
     Ins(&R, allocmem.body    , "return ret;");
+
+    amc::FFunc& mapadv = amc::ind_func_GetOrCreate(Subst(R,"$field.MapAdvised"));
+    mapadv.priv = true;
+    Ins(&R, mapadv.comment, "Map SIZE bytes at a 2MB boundary, so that the whole block can be backed by huge pages.");
+    Ins(&R, mapadv.comment, "Advise transparent huge pages and bind to NUMA node as configured, then populate.");
+    Ins(&R, mapadv.comment, "Failure of madvise or mbind is not an error: the block is then backed by regular pages.");
+    Ins(&R, mapadv.comment, "Return MAP_FAILED if out of memory.");
+    Ins(&R, mapadv.ret  , "void*", false);
+    Ins(&R, mapadv.proto, "$name_MapAdvised($Parent, u32 size)", false);
+    Ins(&R, mapadv.body, "#if defined(__MACH__) || __FreeBSD__>0");
+    Ins(&R, mapadv.body, "(void)size;");
+    Ins(&R, mapadv.body, "return MAP_FAILED;");
+    Ins(&R, mapadv.body, "#else");
+    Ins(&R, mapadv.body, "u64 align = 1024*2048;");
+    Ins(&R, mapadv.body, "u8 *base = (u8*)mmap(0x0, size + align, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);");
+    Ins(&R, mapadv.body, "if (base == MAP_FAILED) {");
+    Ins(&R, mapadv.body, "    return MAP_FAILED;");
+    Ins(&R, mapadv.body, "}");
+    Ins(&R, mapadv.body, "// trim to 2MB boundary");
+    Ins(&R, mapadv.body, "u8 *ret = (u8*)((u64(base) + align - 1) & ~(align - 1));");
+    Ins(&R, mapadv.body, "if (ret > base) {");
+    Ins(&R, mapadv.body, "    munmap(base, ret - base);");
+    Ins(&R, mapadv.body, "}");
+    Ins(&R, mapadv.body, "munmap(ret + size, base + align - ret);");
+    Ins(&R, mapadv.body, "#ifdef MADV_HUGEPAGE");
+    Ins(&R, mapadv.body, "if ($parname.$name_thp && madvise(ret, size, MADV_HUGEPAGE) == 0) {");
+    Ins(&R, mapadv.body, "    $parname.$name_thp_alloc += size;");
+    Ins(&R, mapadv.body, "}");
+    Ins(&R, mapadv.body, "#endif");
+    Ins(&R, mapadv.body, "#ifdef SYS_mbind");
+    Ins(&R, mapadv.body, "unsigned long nodemask[16] = {}; // up to 1024 nodes; a node outside of the mask is not bound");
+    Ins(&R, mapadv.body, "u32 nodebits = sizeof(nodemask[0])*8;");
+    Ins(&R, mapadv.body, "if ($parname.$name_numa_node >= 0 && u32($parname.$name_numa_node) < sizeof(nodemask)*8) {");
+    Ins(&R, mapadv.body, "    nodemask[$parname.$name_numa_node / nodebits] |= 1UL << ($parname.$name_numa_node % nodebits);");
+    Ins(&R, mapadv.body, "    // the kernel reads MAXNODE-1 bits");
+    Ins(&R, mapadv.body, "    (void)syscall(SYS_mbind, ret, size, 1/*MPOL_PREFERRED*/, nodemask, sizeof(nodemask)*8 + 1, 0);");
+    Ins(&R, mapadv.body, "}");
+    Ins(&R, mapadv.body, "#endif");
+    Ins(&R, mapadv.body, "for (u64 i = 0; i < size; i += 4096) { // populate, like MAP_POPULATE");
+    Ins(&R, mapadv.body, "    ret[i] = 0;");
+    Ins(&R, mapadv.body, "}");
+    Ins(&R, mapadv.body, "return ret;");
+    Ins(&R, mapadv.body, "#endif");
 }
 
 void amc::tfunc_Sbrk_FreeMem() {
@@ -121,4 +171,7 @@ void amc::tfunc_Sbrk_Init() {
     Ins(&R, init.body, "$parname.$name_huge_limit = 0;");
     Ins(&R, init.body, "$parname.$name_huge_alloc = 0;");
     Ins(&R, init.body, "$parname.$name_zeromem = false;");
+    Ins(&R, init.body, "$parname.$name_thp = false;");
+    Ins(&R, init.body, "$parname.$name_numa_node = -1;");
+    Ins(&R, init.body, "$parname.$name_thp_alloc = 0;");
 }
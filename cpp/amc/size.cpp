@@ -87,8 +87,8 @@ static void CountStructField(amc::FCtype &ctype, strptr name, amc::FCtype *ftype
 static amc::FCtype *LookupCppType(strptr s) {
     tempstr fieldtype(s);
     Replace(fieldtype,"::",".");
-    // handle pointers as u64
-    return EndsWithQ(fieldtype,"*")
+    // handle pointers and references as u64
+    return EndsWithQ(fieldtype,"*") || EndsWithQ(fieldtype,"&")
         ? amc::_db.c_u64
         : amc::ind_ctype_Find(fieldtype);
 }
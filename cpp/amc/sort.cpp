@@ -29,6 +29,18 @@
 
 #include "include/amc.h"
 
+// QuickSort machinery is also needed by ParallelSort (to sort each run)
+static bool NeedQuickSortQ(amc::FFsort &fsort) {
+    return fsort.sorttype == dmmeta_Sorttype_sorttype_QuickSort
+        || fsort.sorttype == dmmeta_Sorttype_sorttype_ParallelSort;
+}
+
+// If the sort field is a Smallstr-like ctype, return its string field
+static amc::FField *RadixStrfield(amc::FField &sortfld) {
+    amc::FField *strfld = c_field_Find(*sortfld.p_arg, 0);
+    return strfld && strfld->c_smallstr ? strfld : NULL;
+}
+
 void amc::tclass_Sort() {
     algo_lib::Replscope &R          = amc::_db.genfield.R;
     amc::FField         &field      = *amc::_db.genfield.p_field;
@@ -60,6 +72,20 @@ void amc::tclass_Sort() {
     Set(R, "$*"  , (is_ptr ? "*"   : ""));
     // empty substitution eats whitespace! so must define $aryelemtype separately
     Set(R, "$aryelemtype" , "$Tgttype$*");
+
+    if (fsort.sorttype == dmmeta_Sorttype_sorttype_RadixSort) {
+        amc::FField &sortfld = *fsort.p_sortfld;
+        amc::FBltin *bltin = sortfld.p_arg->c_bltin;
+        bool int_ok = bltin && bltin->ctype != "pad_byte" && bltin->ctype != "u128";
+        vrfy(!sortfld.c_fcmp, "RadixSort cannot be used with a custom comparison function");
+        vrfy(int_ok || RadixStrfield(sortfld)
+             , "RadixSort requires an integer, floating-point or Smallstr sort field");
+        // number of 64-bit key words: 1 for numbers; for strings, one per 8 chars + length
+        amc::FField *strfld = RadixStrfield(sortfld);
+        int nword = strfld ? (strfld->c_smallstr->length + 7) / 8 : 0;
+        Set(R, "$nword", tempstr() << nword);
+        Set(R, "$nkey" , tempstr() << nword + 1);
+    }
 }
 
 void amc::tfunc_Sort_Swap() {
@@ -169,7 +195,7 @@ void amc::tfunc_Sort_IntInsertionSort() {
     amc::FFsort          &fsort       = *field.c_fsort;
     bool                 is_ptr     = (field.reftype == dmmeta_Reftype_reftype_Ptrary);
     bool                 cheap_copy = amc::CheapCopyQ(field);
-    bool                 need_quick = (fsort.sorttype == dmmeta_Sorttype_sorttype_QuickSort);
+    bool                 need_quick = NeedQuickSortQ(fsort);
     bool                 need_ins   = (fsort.sorttype == dmmeta_Sorttype_sorttype_InsertionSort) || need_quick;
     // InsertionSort
     // Three types are provided:
@@ -213,7 +239,7 @@ void amc::tfunc_Sort_IntHeapSort() {
     algo_lib::Replscope &R          = amc::_db.genfield.R;
     amc::FField         &field      = *amc::_db.genfield.p_field;
     amc::FFsort          &fsort       = *field.c_fsort;
-    bool                 need_quick = (fsort.sorttype == dmmeta_Sorttype_sorttype_QuickSort);
+    bool                 need_quick = NeedQuickSortQ(fsort);
     bool                 need_heap  = (fsort.sorttype == dmmeta_Sorttype_sorttype_HeapSort) || need_quick;
     // IntHeapSort
     if (need_heap) {
@@ -261,7 +287,7 @@ void amc::tfunc_Sort_IntQuickSort() {
     amc::FFsort          &fsort       = *field.c_fsort;
     bool                 is_ptr     = (field.reftype == dmmeta_Reftype_reftype_Ptrary);
     bool                 cheap_copy = amc::CheapCopyQ(field);
-    bool                 need_quick = (fsort.sorttype == dmmeta_Sorttype_sorttype_QuickSort);
+    bool                 need_quick = NeedQuickSortQ(fsort);
     // IntQuickSort
     if (need_quick) {
         amc::FFunc& iqsort = amc::CreateCurFunc();
@@ -324,7 +350,7 @@ void amc::tfunc_Sort_InsertionSort() {
     algo_lib::Replscope &R          = amc::_db.genfield.R;
     amc::FField         &field      = *amc::_db.genfield.p_field;
     amc::FFsort          &fsort       = *field.c_fsort;
-    bool                 need_quick = (fsort.sorttype == dmmeta_Sorttype_sorttype_QuickSort);
+    bool                 need_quick = NeedQuickSortQ(fsort);
     bool                 need_ins   = (fsort.sorttype == dmmeta_Sorttype_sorttype_InsertionSort) || need_quick;
     // Insertion Sort
     if (need_ins) {
@@ -342,7 +368,7 @@ void amc::tfunc_Sort_HeapSort() {
     algo_lib::Replscope &R          = amc::_db.genfield.R;
     amc::FField         &field      = *amc::_db.genfield.p_field;
     amc::FFsort          &fsort       = *field.c_fsort;
-    bool                 need_quick = (fsort.sorttype == dmmeta_Sorttype_sorttype_QuickSort);
+    bool                 need_quick = NeedQuickSortQ(fsort);
     bool                 need_heap  = (fsort.sorttype == dmmeta_Sorttype_sorttype_HeapSort) || need_quick;
     // Heap Sort
     if (need_heap) {
@@ -360,7 +386,7 @@ void amc::tfunc_Sort_QuickSort() {
     algo_lib::Replscope &R          = amc::_db.genfield.R;
     amc::FField         &field      = *amc::_db.genfield.p_field;
     amc::FFsort          &fsort       = *field.c_fsort;
-    bool                 need_quick = (fsort.sorttype == dmmeta_Sorttype_sorttype_QuickSort);
+    bool                 need_quick = NeedQuickSortQ(fsort);
     // Quick Sort
     if (need_quick) {
         amc::FFunc& qsort = amc::CreateCurFunc();
@@ -374,3 +400,145 @@ void amc::tfunc_Sort_QuickSort() {
         Ins(&R, qsort.body, "$name_IntQuickSort(elems, n, max_depth);");
     }
 }
+
+void amc::tfunc_Sort_RadixKey() {
+    algo_lib::Replscope &R          = amc::_db.genfield.R;
+    amc::FField         &field      = *amc::_db.genfield.p_field;
+    amc::FFsort         &fsort      = *field.c_fsort;
+    amc::FField         &sortfld    = *fsort.p_sortfld;
+    amc::FCtype         &tgttype    = *fsort.p_field->p_arg;
+    if (fsort.sorttype == dmmeta_Sorttype_sorttype_RadixSort) {
+        amc::FField *strfld = RadixStrfield(sortfld);
+        amc::FBltin *bltin  = sortfld.p_arg->c_bltin;
+        Set(R, "$elem_val", FieldvalExpr(&tgttype, sortfld, "elem"));
+        amc::FFunc& func = amc::CreateCurFunc();
+        Ins(&R, func.comment, "Extract radix key word WORD (0=most significant) from ELEM.");
+        Ins(&R, func.comment, "Unsigned comparison of keys gives the same order as $name_Lt.");
+        func.priv = true;
+        func.inl = true;
+        Ins(&R, func.ret  , "u64",false);
+        Ins(&R, func.proto, "$name_RadixKey($Tgttype &elem, int word)",false);
+        if (strfld) {
+            // string key: one word per 8 characters, then length
+            Set(R, "$strfld", name_Get(*strfld));
+            Ins(&R, func.body, "algo::strptr str = $strfld_Getary($elem_val);");
+            Ins(&R, func.body, "return word < $nword ? algo_lib::RadixKeyStr(str, word) : u64(str.n_elems);");
+        } else if (bltin->ctype == "double" || bltin->ctype == "float") {
+            // negative values: flip all bits; positive values: flip sign bit
+            Ins(&R, func.body, "(void)word;");
+            Ins(&R, func.body, "double val = $elem_val;");
+            Ins(&R, func.body, "u64 bits;");
+            Ins(&R, func.body, "memcpy(&bits, &val, sizeof(bits));");
+            Ins(&R, func.body, "return bits ^ (u64(i64(bits) >> 63) | (u64(1) << 63));");
+        } else if (bltin->issigned) {
+            Ins(&R, func.body, "(void)word;");
+            Ins(&R, func.body, "return u64(i64($elem_val)) ^ (u64(1) << 63);");
+        } else {
+            Ins(&R, func.body, "(void)word;");
+            Ins(&R, func.body, "return u64($elem_val);");
+        }
+    }
+}
+
+void amc::tfunc_Sort_RadixSort() {
+    algo_lib::Replscope &R          = amc::_db.genfield.R;
+    amc::FField         &field      = *amc::_db.genfield.p_field;
+    amc::FFsort         &fsort      = *field.c_fsort;
+    if (fsort.sorttype == dmmeta_Sorttype_sorttype_RadixSort) {
+        amc::FFunc& func = amc::CreateCurFunc();
+        Ins(&R, func.comment, "Radix sort (stable)");
+        Ins(&R, func.comment, "Keys are extracted into a temp array, sorted with LSD byte radix");
+        Ins(&R, func.comment, "(one round per key word, least significant first), then elements");
+        Ins(&R, func.comment, "are moved to their final positions in one pass.");
+        Ins(&R, func.ret  , "void",false);
+        Ins(&R, func.proto, "$name_RadixSort($Parent)",false);
+        Ins(&R, func.body, "$aryelemtype *elems = $name_Getary($pararg).elems;");
+        Ins(&R, func.body, "int n = $name_N($pararg);");
+        Ins(&R, func.body, "if (n < 2) {");
+        Ins(&R, func.body, "    return;");
+        Ins(&R, func.body, "}");
+        Ins(&R, func.body, "algo::RadixKey *buf = (algo::RadixKey*)algo_lib::malloc_AllocMem(sizeof(algo::RadixKey) * n * 2);");
+        Ins(&R, func.body, "algo::RadixKey *keys = buf;");
+        Ins(&R, func.body, "algo::RadixKey *tmp = buf + n;");
+        Ins(&R, func.body, "for (int i = 0; i < n; i++) {");
+        Ins(&R, func.body, "    keys[i].idx = i;");
+        Ins(&R, func.body, "}");
+        Ins(&R, func.body, "for (int word = $nkey - 1; word >= 0; word--) {");
+        Ins(&R, func.body, "    for (int i = 0; i < n; i++) {");
+        Ins(&R, func.body, "        keys[i].key = $name_RadixKey($*elems[keys[i].idx], word);");
+        Ins(&R, func.body, "    }");
+        Ins(&R, func.body, "    algo_lib::RadixSortKeys(keys, tmp, n);");
+        Ins(&R, func.body, "}");
+        Ins(&R, func.body, "// move elements into place (bitwise, as in Swap)");
+        Ins(&R, func.body, "$aryelemtype *copy = ($aryelemtype*)algo_lib::malloc_AllocMem(sizeof($aryelemtype) * n);");
+        Ins(&R, func.body, "memcpy((void*)copy, (void*)elems, sizeof($aryelemtype) * n);");
+        Ins(&R, func.body, "for (int i = 0; i < n; i++) {");
+        Ins(&R, func.body, "    memcpy((void*)(elems + i), (void*)(copy + keys[i].idx), sizeof($aryelemtype));");
+        Ins(&R, func.body, "}");
+        Ins(&R, func.body, "algo_lib::malloc_FreeMem(copy, sizeof($aryelemtype) * n);");
+        Ins(&R, func.body, "algo_lib::malloc_FreeMem(buf, sizeof(algo::RadixKey) * n * 2);");
+    }
+}
+
+void amc::tfunc_Sort_SortRun() {
+    algo_lib::Replscope &R          = amc::_db.genfield.R;
+    amc::FField         &field      = *amc::_db.genfield.p_field;
+    amc::FFsort         &fsort      = *field.c_fsort;
+    if (fsort.sorttype == dmmeta_Sorttype_sorttype_ParallelSort) {
+        amc::FFunc& func = amc::CreateCurFunc();
+        Ins(&R, func.comment, "Sort one run of elements (callback for algo_lib::ParallelSort)");
+        func.priv = true;
+        Ins(&R, func.ret  , "void",false);
+        Ins(&R, func.proto, "$name_SortRun(void *elems, int n)",false);
+        Ins(&R, func.body, "int max_depth = CeilingLog2(u32(n + 1)) + 3;");
+        Ins(&R, func.body, "$name_IntQuickSort(($aryelemtype*)elems, n, max_depth);");
+    }
+}
+
+void amc::tfunc_Sort_MergeRuns() {
+    algo_lib::Replscope &R          = amc::_db.genfield.R;
+    amc::FField         &field      = *amc::_db.genfield.p_field;
+    amc::FFsort         &fsort      = *field.c_fsort;
+    if (fsort.sorttype == dmmeta_Sorttype_sorttype_ParallelSort) {
+        amc::FFunc& func = amc::CreateCurFunc();
+        Ins(&R, func.comment, "Merge sorted runs A and B into DST (callback for algo_lib::ParallelSort)");
+        Ins(&R, func.comment, "Elements are moved bitwise, as in Swap.");
+        func.priv = true;
+        Ins(&R, func.ret  , "void",false);
+        Ins(&R, func.proto, "$name_MergeRuns(void *dst, void *a, int na, void *b, int nb)",false);
+        Ins(&R, func.body, "$aryelemtype *out = ($aryelemtype*)dst;");
+        Ins(&R, func.body, "$aryelemtype *pa = ($aryelemtype*)a;");
+        Ins(&R, func.body, "$aryelemtype *pb = ($aryelemtype*)b;");
+        Ins(&R, func.body, "$aryelemtype *ea = pa + na;");
+        Ins(&R, func.body, "$aryelemtype *eb = pb + nb;");
+        Ins(&R, func.body, "while (pa < ea && pb < eb) {");
+        Ins(&R, func.body, "    // take from A unless B is strictly less -- keeps merge stable");
+        Ins(&R, func.body, "    if ($name_Lt($*pb[0], $*pa[0])) {");
+        Ins(&R, func.body, "        memcpy((void*)out++, (void*)pb++, sizeof($aryelemtype));");
+        Ins(&R, func.body, "    } else {");
+        Ins(&R, func.body, "        memcpy((void*)out++, (void*)pa++, sizeof($aryelemtype));");
+        Ins(&R, func.body, "    }");
+        Ins(&R, func.body, "}");
+        Ins(&R, func.body, "memcpy((void*)out, (void*)pa, (ea - pa) * sizeof($aryelemtype));");
+        Ins(&R, func.body, "out += ea - pa;");
+        Ins(&R, func.body, "memcpy((void*)out, (void*)pb, (eb - pb) * sizeof($aryelemtype));");
+    }
+}
+
+void amc::tfunc_Sort_ParallelSort() {
+    algo_lib::Replscope &R          = amc::_db.genfield.R;
+    amc::FField         &field      = *amc::_db.genfield.p_field;
+    amc::FFsort         &fsort      = *field.c_fsort;
+    if (fsort.sorttype == dmmeta_Sorttype_sorttype_ParallelSort) {
+        amc::FFunc& func = amc::CreateCurFunc();
+        Ins(&R, func.comment, "Parallel sort");
+        Ins(&R, func.comment, "Large arrays are split into runs, which are sorted in separate threads");
+        Ins(&R, func.comment, "with quick sort, and merged; small arrays are quick-sorted in the calling thread.");
+        Ins(&R, func.comment, "$name_Lt must be thread-safe.");
+        Ins(&R, func.ret  , "void",false);
+        Ins(&R, func.proto, "$name_ParallelSort($Parent)",false);
+        Ins(&R, func.body, "$aryelemtype *elems = $name_Getary($pararg).elems;");
+        Ins(&R, func.body, "int n = $name_N($pararg);");
+        Ins(&R, func.body, "algo_lib::ParallelSort(elems, n, sizeof($aryelemtype), $name_SortRun, $name_MergeRuns);");
+    }
+}
@@ -34,6 +34,7 @@ static bool PassFieldViaArgQ(amc::FField &field, amc::FCtype &ctype) {
         && !(field.c_typefld && ctype.c_msgtype)
         && !(GetLenfld(field) && ctype.c_msgtype)
         && !FldfuncQ(field)
+        && !field.c_fcolumn
         && (&field != ctype.c_varlenfld);// stack constructor doesn't accept varlen or optional fields
     return ok;
 }
@@ -221,7 +222,7 @@ static void GenStruct_Ctor2(algo_lib::Replscope &R, amc::FCtype &ctype) {
     }
 
     Ins(&R, *ns.hdr, "    $Name();");
-    Ins(&R, *ns.inl, "inline $Cpptype::$Name() {");
+    Ins(&R, *ns.inl, tempstr() << Subst(R,"inline $Cpptype::$Name()") << LaryColumnCtorInit(ctype) << " {");
     // call init function
     if (init) {
         Ins(&R, *ns.inl, "    $ns::$Name_Init(*this);");
@@ -265,7 +266,11 @@ static void GenStruct_Ctor2(algo_lib::Replscope &R, amc::FCtype &ctype) {
                 break;
             }
         }ind_end;
-        Ins(&R, *ns.hdr, "    $Name(const $Name&){ /*disallow copy constructor */}");
+        if (HasColumnQ(ctype)) {// column references can't be left unbound
+            Ins(&R, *ns.hdr, "    $Name(const $Name&); // disallow copy constructor (not defined)");
+        } else {
+            Ins(&R, *ns.hdr, "    $Name(const $Name&){ /*disallow copy constructor */}");
+        }
         Ins(&R, *ns.hdr, "    void operator =(const $Name&){ /*disallow direct assignment */}");
     }
     // make main cosntructor private if:
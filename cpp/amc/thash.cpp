@@ -76,6 +76,27 @@ static void Thash_Check(amc::FField &field) {
             //algo_lib::_db.exit_code=1;
         }
     }
+    if (thash.incremental && thash.openaddr) {
+        prerr("amc.thash_incremental"
+              <<Keyval("thash",field.field)
+              <<Keyval("comment","Incremental rehash is only supported for chained hashes (openaddr:N)"));
+        algo_lib::_db.exit_code=1;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// During an incremental rehash, a row lives in the old bucket array
+// if and only if its old bucket has not been migrated yet.
+// Emit code that redirects bucket pointer VAR (computed from HASH against the new array)
+// to the old array when that is the case.
+static void InsOldBucket(algo_lib::Replscope &R, algo::cstring &body, strptr var) {
+    Ins(&R, body, "if ($parname.$name_old_elems) { // incremental rehash in progress");
+    Ins(&R, body, "    u32 old_index = hash & ($parname.$name_old_n - 1);");
+    Ins(&R, body, "    if (old_index >= u32($parname.$name_old_pos)) { // bucket not migrated yet");
+    Ins(&R, body, tempstr() << "        " << var << " = &$parname.$name_old_elems[old_index];");
+    Ins(&R, body, "    }");
+    Ins(&R, body, "}");
 }
 
 // -----------------------------------------------------------------------------
@@ -91,14 +112,32 @@ void amc::tclass_Thash() {
     Set(R, "$rethashfld" , FieldvalExpr(field.p_arg, *hashfld,"(*ret)"));
     Set(R, "$gethashfld" , FieldvalExpr(field.p_arg, *hashfld,"row"));
 
-    InsVar(R, field.p_ctype     , "$Cpptype**", "$name_buckets_elems", "", "pointer to bucket array");
-    InsVar(R, field.p_ctype     , "i32", "$name_buckets_n", "", "number of elements in bucket array");
-    InsVar(R, field.p_ctype     , "i32", "$name_n", "", "number of elements in the hash table");
-    InsVar(R, field.p_arg       , "$Cpptype*", "$name_next", "", "hash next");
-
     amc::FFunc *child_init = amc::init_GetOrCreate(*field.p_arg);
     Set(R, "$fname"     , Refname(*field.p_arg));
-    Ins(&R, child_init->body, "$fname.$name_next = ($Cpptype*)-1; // ($field) not-in-hash");
+    if (thash.openaddr) {
+        // open addressing: rows live in a contiguous array of (hash,row) slots,
+        // probed linearly. No per-row chain pointer is needed.
+        InsVar(R, field.p_ctype     , "algo::Hashslot*", "$name_slots_elems", "", "pointer to slot array");
+        InsVar(R, field.p_ctype     , "i32", "$name_slots_n", "", "number of elements in slot array");
+        InsVar(R, field.p_ctype     , "i32", "$name_n", "", "number of elements in the hash table");
+        InsVar(R, field.p_arg       , "bool", "$name_in", "", "row is in hash");
+        Ins(&R, child_init->body, "$fname.$name_in = false; // ($field) not-in-hash");
+    } else {
+        InsVar(R, field.p_ctype     , "$Cpptype**", "$name_buckets_elems", "", "pointer to bucket array");
+        InsVar(R, field.p_ctype     , "i32", "$name_buckets_n", "", "number of elements in bucket array");
+        InsVar(R, field.p_ctype     , "i32", "$name_n", "", "number of elements in the hash table");
+        InsVar(R, field.p_arg       , "$Cpptype*", "$name_next", "", "hash next");
+        Ins(&R, child_init->body, "$fname.$name_next = ($Cpptype*)-1; // ($field) not-in-hash");
+        if (thash.incremental) {
+            InsVar(R, field.p_ctype , "$Cpptype**", "$name_old_elems", "", "old bucket array during incremental rehash");
+            InsVar(R, field.p_ctype , "i32", "$name_old_n", "", "number of elements in old bucket array");
+            InsVar(R, field.p_ctype , "i32", "$name_old_pos", "", "next old bucket to migrate");
+        }
+        if (thash.cachehash) {
+            InsVar(R, field.p_arg   , "u32", "$name_hashval", "", "hash value");
+            Ins(&R, child_init->body, "$fname.$name_hashval = 0; // stored hash value");
+        }
+    }
 
     Thash_Check(field);
 }
@@ -108,19 +147,45 @@ void amc::tclass_Thash() {
 void amc::tfunc_Thash_Find() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
 
+    amc::FField &field = *amc::_db.genfield.p_field;
+    amc::FThash &thash = *field.c_thash;
+
     amc::FFunc& find = amc::CreateCurFunc();
     Ins(&R, find.ret  , "$Cpptype*", false);
     Ins(&R, find.proto, "$name_Find($Parent, $Hashfldarg key)", false);
-    Ins(&R, find.body, "u32 index = $Hashfldtype_Hash(0, key) & ($parname.$name_buckets_n - 1);");
-    Ins(&R, find.body, "$Cpptype* *e = &$parname.$name_buckets_elems[index];");
-    Ins(&R, find.body, "$Cpptype* ret=NULL;");
-    Ins(&R, find.body, "do {");
-    Ins(&R, find.body, "    ret       = *e;");
-    Ins(&R, find.body, "    bool done = !ret || $rethashfld == key;");
-    Ins(&R, find.body, "    if (done) break;");
-    Ins(&R, find.body, "    e         = &ret->$name_next;");
-    Ins(&R, find.body, "} while (true);");
-    Ins(&R, find.body, "return ret;");
+    if (thash.openaddr) {
+        Ins(&R, find.body, "u32 hash  = $Hashfldtype_Hash(0, key);");
+        Ins(&R, find.body, "u32 mask  = $parname.$name_slots_n - 1;");
+        Ins(&R, find.body, "u32 index = hash & mask;");
+        Ins(&R, find.body, "$Cpptype* ret=NULL;");
+        Ins(&R, find.body, "do {");
+        Ins(&R, find.body, "    algo::Hashslot &slot = $parname.$name_slots_elems[index];");
+        Ins(&R, find.body, "    ret       = ($Cpptype*)slot.row;");
+        Ins(&R, find.body, "    bool done = !ret || (slot.hash == hash && $rethashfld == key);");
+        Ins(&R, find.body, "    if (done) break;");
+        Ins(&R, find.body, "    index     = (index + 1) & mask;");
+        Ins(&R, find.body, "} while (true);");
+        Ins(&R, find.body, "return ret;");
+    } else {
+        Ins(&R, find.body, "u32 hash  = $Hashfldtype_Hash(0, key);");
+        Ins(&R, find.body, "u32 index = hash & ($parname.$name_buckets_n - 1);");
+        Ins(&R, find.body, "$Cpptype* *e = &$parname.$name_buckets_elems[index];");
+        if (thash.incremental) {
+            InsOldBucket(R, find.body, "e");
+        }
+        Ins(&R, find.body, "$Cpptype* ret=NULL;");
+        Ins(&R, find.body, "do {");
+        Ins(&R, find.body, "    ret       = *e;");
+        if (thash.cachehash) {
+            Ins(&R, find.body, "    bool done = !ret || (ret->$name_hashval == hash && $rethashfld == key);");
+        } else {
+            Ins(&R, find.body, "    bool done = !ret || $rethashfld == key;");
+        }
+        Ins(&R, find.body, "    if (done) break;");
+        Ins(&R, find.body, "    e         = &ret->$name_next;");
+        Ins(&R, find.body, "} while (true);");
+        Ins(&R, find.body, "return ret;");
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -141,9 +206,68 @@ void amc::tfunc_Thash_FindX() {
 void amc::tfunc_Thash_Reserve() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
 
+    amc::FField &field = *amc::_db.genfield.p_field;
+    amc::FThash &thash = *field.c_thash;
+
     amc::FFunc& reserve = amc::CreateCurFunc();
     Ins(&R, reserve.ret  , "void", false);
     Ins(&R, reserve.proto, "$name_Reserve($Parent, int n)", false);
+    if (thash.openaddr) {
+        Ins(&R, reserve.body, "u32 old_nslots = $parname.$name_slots_n;");
+        Ins(&R, reserve.body, "u32 new_nelems = $parname.$name_n + n;");
+        Ins(&R, reserve.body, "// keep load factor at or below 1/2 so that probe sequences stay short");
+        Ins(&R, reserve.body, "if (new_nelems * 2 > old_nslots) {");
+        Ins(&R, reserve.body, "    u32 new_nslots = u32_Max(BumpToPow2(new_nelems * 2), u32(8));");
+        Ins(&R, reserve.body, "    u32 new_mask   = new_nslots - 1;");
+        Ins(&R, reserve.body, "    u32 old_size   = old_nslots * sizeof(algo::Hashslot);");
+        Ins(&R, reserve.body, "    u32 new_size   = new_nslots * sizeof(algo::Hashslot);");
+        Ins(&R, reserve.body, "    algo::Hashslot *new_slots = (algo::Hashslot*)$basepool_AllocMem(new_size);");
+        Ins(&R, reserve.body, "    if (UNLIKELY(!new_slots)) {");
+        Ins(&R, reserve.body, "        FatalErrorExit(\"$ns.out_of_memory  field:$field\");");
+        Ins(&R, reserve.body, "    }");
+        Ins(&R, reserve.body, "    memset(new_slots, 0, new_size); // clear slots");
+        Ins(&R, reserve.body, "    // re-insert all entries using the stored hash values");
+        Ins(&R, reserve.body, "    for (u32 i = 0; i < old_nslots; i++) {");
+        Ins(&R, reserve.body, "        algo::Hashslot &slot = $parname.$name_slots_elems[i];");
+        Ins(&R, reserve.body, "        if (slot.row) {");
+        Ins(&R, reserve.body, "            u32 index = slot.hash & new_mask;");
+        Ins(&R, reserve.body, "            while (new_slots[index].row) {");
+        Ins(&R, reserve.body, "                index = (index + 1) & new_mask;");
+        Ins(&R, reserve.body, "            }");
+        Ins(&R, reserve.body, "            new_slots[index] = slot;");
+        Ins(&R, reserve.body, "        }");
+        Ins(&R, reserve.body, "    }");
+        Ins(&R, reserve.body, "    // free old array");
+        Ins(&R, reserve.body, "    $basepool_FreeMem($parname.$name_slots_elems, old_size);");
+        Ins(&R, reserve.body, "    $parname.$name_slots_elems = new_slots;");
+        Ins(&R, reserve.body, "    $parname.$name_slots_n = new_nslots;");
+        Ins(&R, reserve.body, "}");
+        return;
+    }
+    Set(R, "$rowhash", Subst(R, thash.cachehash ? "row.$name_hashval" : "$Hashfldtype_Hash(0, $gethashfld)"));
+    if (thash.incremental) {
+        Ins(&R, reserve.body, "u32 old_nbuckets = $parname.$name_buckets_n;");
+        Ins(&R, reserve.body, "u32 new_nelems   = $parname.$name_n + n;");
+        Ins(&R, reserve.body, "// # of elements has to be roughly equal to the number of buckets");
+        Ins(&R, reserve.body, "if (new_nelems > old_nbuckets) {");
+        Ins(&R, reserve.body, "    $name_Rehash($pararg, $parname.$name_old_n); // complete previous rehash, if any");
+        Ins(&R, reserve.body, "    int new_nbuckets = i32_Max(BumpToPow2(new_nelems), u32(4));");
+        Ins(&R, reserve.body, "    u32 new_size = new_nbuckets * sizeof($Cpptype*);");
+        Ins(&R, reserve.body, "    $Cpptype* *new_buckets = ($Cpptype**)$basepool_AllocMem(new_size);");
+        Ins(&R, reserve.body, "    if (UNLIKELY(!new_buckets)) {");
+        Ins(&R, reserve.body, "        FatalErrorExit(\"$ns.out_of_memory  field:$field\");");
+        Ins(&R, reserve.body, "    }");
+        Ins(&R, reserve.body, "    memset(new_buckets, 0, new_size); // clear pointers");
+        Ins(&R, reserve.body, "    // existing entries stay in the old array and are migrated");
+        Ins(&R, reserve.body, "    // a few buckets at a time by subsequent inserts");
+        Ins(&R, reserve.body, "    $parname.$name_old_elems = $parname.$name_buckets_elems;");
+        Ins(&R, reserve.body, "    $parname.$name_old_n = $parname.$name_buckets_n;");
+        Ins(&R, reserve.body, "    $parname.$name_old_pos = 0;");
+        Ins(&R, reserve.body, "    $parname.$name_buckets_elems = new_buckets;");
+        Ins(&R, reserve.body, "    $parname.$name_buckets_n = new_nbuckets;");
+        Ins(&R, reserve.body, "}");
+        return;
+    }
     Ins(&R, reserve.body, "u32 old_nbuckets = $parname.$name_buckets_n;");
     Ins(&R, reserve.body, "u32 new_nelems   = $parname.$name_n + n;");
     Ins(&R, reserve.body, "// # of elements has to be roughly equal to the number of buckets");
@@ -164,7 +288,7 @@ void amc::tfunc_Thash_Reserve() {
     Ins(&R, reserve.body, "        while (elem) {");
     Ins(&R, reserve.body, "            $Cpptype &row        = *elem;");
     Ins(&R, reserve.body, "            $Cpptype* next       = row.$name_next;");
-    Ins(&R, reserve.body, "            u32 index          = $Hashfldtype_Hash(0, $gethashfld) & (new_nbuckets-1);");
+    Ins(&R, reserve.body, "            u32 index          = $rowhash & (new_nbuckets-1);");
     Ins(&R, reserve.body, "            row.$name_next     = new_buckets[index];");
     Ins(&R, reserve.body, "            new_buckets[index] = &row;");
     Ins(&R, reserve.body, "            elem               = next;");
@@ -179,6 +303,42 @@ void amc::tfunc_Thash_Reserve() {
 
 // -----------------------------------------------------------------------------
 
+void amc::tfunc_Thash_Rehash() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
+    amc::FThash &thash = *field.c_thash;
+
+    if (thash.incremental) {
+        Set(R, "$rowhash", Subst(R, thash.cachehash ? "row.$name_hashval" : "$Hashfldtype_Hash(0, $gethashfld)"));
+        amc::FFunc& rehash = amc::CreateCurFunc();
+        Ins(&R, rehash.ret  , "void", false);
+        Ins(&R, rehash.proto, "$name_Rehash($Parent, int n)", false);
+        Ins(&R, rehash.body, "while (n > 0 && $parname.$name_old_elems) {");
+        Ins(&R, rehash.body, "    $Cpptype* *bucket = &$parname.$name_old_elems[$parname.$name_old_pos];");
+        Ins(&R, rehash.body, "    $Cpptype* elem = *bucket;");
+        Ins(&R, rehash.body, "    while (elem) {");
+        Ins(&R, rehash.body, "        $Cpptype &row        = *elem;");
+        Ins(&R, rehash.body, "        $Cpptype* next       = row.$name_next;");
+        Ins(&R, rehash.body, "        u32 index          = $rowhash & ($parname.$name_buckets_n - 1);");
+        Ins(&R, rehash.body, "        row.$name_next     = $parname.$name_buckets_elems[index];");
+        Ins(&R, rehash.body, "        $parname.$name_buckets_elems[index] = &row;");
+        Ins(&R, rehash.body, "        elem               = next;");
+        Ins(&R, rehash.body, "    }");
+        Ins(&R, rehash.body, "    *bucket = NULL;");
+        Ins(&R, rehash.body, "    $parname.$name_old_pos++;");
+        Ins(&R, rehash.body, "    n--;");
+        Ins(&R, rehash.body, "    if ($parname.$name_old_pos == $parname.$name_old_n) { // done, free old array");
+        Ins(&R, rehash.body, "        $basepool_FreeMem($parname.$name_old_elems, $parname.$name_old_n * sizeof($Cpptype*));");
+        Ins(&R, rehash.body, "        $parname.$name_old_elems = NULL;");
+        Ins(&R, rehash.body, "        $parname.$name_old_n = 0;");
+        Ins(&R, rehash.body, "        $parname.$name_old_pos = 0;");
+        Ins(&R, rehash.body, "    }");
+        Ins(&R, rehash.body, "}");
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 // Check if GetOrCreate can be generated for hash FIELD
 // The target type is FIELD.ARG
 static bool CanGetOrCreateQ(amc::FField &field) {
@@ -298,17 +458,55 @@ void amc::tfunc_Thash_InsertMaybe() {
     Ins(&R, ins.ret  , "bool", false);
     Ins(&R, ins.proto, "$name_InsertMaybe($Parent, $Cpptype& row)", false);
     Ins(&R, ins.body    , "$name_Reserve($pararg, 1);");
+    if (thash.incremental) {
+        Ins(&R, ins.body, "$name_Rehash($pararg, 2); // migrate old buckets faster than inserts can fill new ones");
+    }
     Ins(&R, ins.body    , "bool retval = true; // if already in hash, InsertMaybe returns true");
+    if (thash.openaddr) {
+        Ins(&R, ins.body    , "if (LIKELY(!row.$name_in)) {// check if in hash already");
+        Ins(&R, ins.body    , "    u32 hash  = $Hashfldtype_Hash(0, $gethashfld);");
+        Ins(&R, ins.body    , "    u32 mask  = $parname.$name_slots_n - 1;");
+        Ins(&R, ins.body    , "    u32 index = hash & mask;");
+        Ins(&R, ins.body    , "    algo::Hashslot *slot = &$parname.$name_slots_elems[index];");
+        Ins(&R, ins.body    , "    while (slot->row) { // probe until empty slot");
+        if (thash.unique) {
+            Ins(&R, ins.body, "        $Cpptype* ret = ($Cpptype*)slot->row;");
+            Ins(&R, ins.body, "        if (slot->hash == hash && $rethashfld == $gethashfld) { // found matching key");
+            Ins(&R, ins.body, "            retval = false;");
+            Ins(&R, ins.body, "            break;");
+            Ins(&R, ins.body, "        }");
+        }
+        Ins(&R, ins.body    , "        index = (index + 1) & mask;");
+        Ins(&R, ins.body    , "        slot  = &$parname.$name_slots_elems[index];");
+        Ins(&R, ins.body    , "    }");
+        Ins(&R, ins.body    , "    if (retval) {");
+        Ins(&R, ins.body    , "        slot->hash = hash;");
+        Ins(&R, ins.body    , "        slot->row  = (u8*)&row;");
+        Ins(&R, ins.body    , "        row.$name_in = true;");
+        Ins(&R, ins.body    , "        $parname.$name_n++;");
+        Ins(&R, ins.body    , "    }");
+        Ins(&R, ins.body    , "}");
+        Ins(&R, ins.body    , "return retval;");
+        return;
+    }
     Ins(&R, ins.body    , "if (LIKELY(row.$name_next == ($Cpptype*)-1)) {// check if in hash already");
-    Ins(&R, ins.body    , "    u32 index = $Hashfldtype_Hash(0, $gethashfld) & ($parname.$name_buckets_n - 1);");
+    Ins(&R, ins.body    , "    u32 hash  = $Hashfldtype_Hash(0, $gethashfld);");
+    Ins(&R, ins.body    , "    u32 index = hash & ($parname.$name_buckets_n - 1);");
     Ins(&R, ins.body    , "    $Cpptype* *prev = &$parname.$name_buckets_elems[index];");
+    if (thash.incremental) {
+        InsOldBucket(R, ins.body, "prev");
+    }
     if (thash.unique) {
         Ins(&R, ins.body, "    do {");
         Ins(&R, ins.body, "        $Cpptype* ret = *prev;");
         Ins(&R, ins.body, "        if (!ret) { // exit condition 1: reached the end of the list");
         Ins(&R, ins.body, "            break;");
         Ins(&R, ins.body, "        }");
-        Ins(&R, ins.body, "        if ($rethashfld == $gethashfld) { // exit condition 2: found matching key");
+        if (thash.cachehash) {
+            Ins(&R, ins.body, "        if (ret->$name_hashval == hash && $rethashfld == $gethashfld) { // exit condition 2: found matching key");
+        } else {
+            Ins(&R, ins.body, "        if ($rethashfld == $gethashfld) { // exit condition 2: found matching key");
+        }
         Ins(&R, ins.body, "            retval = false;");
         Ins(&R, ins.body, "            break;");
         Ins(&R, ins.body, "        }");
@@ -317,6 +515,9 @@ void amc::tfunc_Thash_InsertMaybe() {
     }
     Ins(&R, ins.body    , "    if (retval) {");
     Ins(&R, ins.body    , "        row.$name_next = *prev;");
+    if (thash.cachehash) {
+        Ins(&R, ins.body, "        row.$name_hashval = hash;");
+    }
     Ins(&R, ins.body    , "        $parname.$name_n++;");
     Ins(&R, ins.body    , "        *prev = &row;");
     Ins(&R, ins.body    , "    }");
@@ -328,7 +529,21 @@ void amc::tfunc_Thash_Cascdel() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
     amc::FField &field = *amc::_db.genfield.p_field;
 
-    if (field.c_cascdel) {
+    if (field.c_cascdel && field.c_thash->openaddr) {
+        amc::FFunc& cascdel = amc::CreateCurFunc();// already exists!
+        // deleting a row shifts later rows of the same probe run back into its slot,
+        // so the slot is re-examined until it is empty
+        Ins(&R, cascdel.body, "if ($parname.$name_n) {");
+        Ins(&R, cascdel.body, "    for (int i = 0; i < $parname.$name_slots_n; ) {");
+        Ins(&R, cascdel.body, "        $Cpptype *elem = ($Cpptype*)$parname.$name_slots_elems[i].row;");
+        Ins(&R, cascdel.body, "        if (elem) {");
+        Ins(&R, cascdel.body, DeleteExpr(field, "$pararg", "*elem") << ";");
+        Ins(&R, cascdel.body, "        } else {");
+        Ins(&R, cascdel.body, "            i++;");
+        Ins(&R, cascdel.body, "        }");
+        Ins(&R, cascdel.body, "    }");
+        Ins(&R, cascdel.body, "}");
+    } else if (field.c_cascdel) {
         amc::FFunc& cascdel = amc::CreateCurFunc();// already exists!
         Ins(&R, cascdel.body, "if ($parname.$name_n) {");
         Ins(&R, cascdel.body, "    for (int i = 0; i < $parname.$name_buckets_n; i++) {");
@@ -339,6 +554,16 @@ void amc::tfunc_Thash_Cascdel() {
         Ins(&R, cascdel.body, "            elem = next;");
         Ins(&R, cascdel.body, "        }");
         Ins(&R, cascdel.body, "    }");
+        if (field.c_thash->incremental) {
+            Ins(&R, cascdel.body, "    for (int i = 0; i < $parname.$name_old_n; i++) { // buckets not yet migrated");
+            Ins(&R, cascdel.body, "        $Cpptype *elem = $parname.$name_old_elems[i];");
+            Ins(&R, cascdel.body, "        while (elem) {");
+            Ins(&R, cascdel.body, "            $Cpptype *next = elem->$name_next;");
+            Ins(&R, cascdel.body, DeleteExpr(field, "$pararg", "*elem") << ";");
+            Ins(&R, cascdel.body, "            elem = next;");
+            Ins(&R, cascdel.body, "        }");
+            Ins(&R, cascdel.body, "    }");
+        }
         Ins(&R, cascdel.body, "}");
     }
 }
@@ -346,12 +571,47 @@ void amc::tfunc_Thash_Cascdel() {
 void amc::tfunc_Thash_Remove() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
 
+    amc::FField &field = *amc::_db.genfield.p_field;
+    amc::FThash &thash = *field.c_thash;
+
     amc::FFunc& rem = amc::CreateCurFunc();
     Ins(&R, rem.ret  , "void", false);
     Ins(&R, rem.proto, "$name_Remove($Parent, $Cpptype& row)", false);
+    if (thash.openaddr) {
+        // backward-shift deletion: no tombstones, so Find never probes past
+        // the end of a run
+        Ins(&R, rem.body, "if (LIKELY(row.$name_in)) {// check if in hash already");
+        Ins(&R, rem.body, "    u32 mask  = $parname.$name_slots_n - 1;");
+        Ins(&R, rem.body, "    u32 index = $Hashfldtype_Hash(0, $gethashfld) & mask;");
+        Ins(&R, rem.body, "    while ($parname.$name_slots_elems[index].row != (u8*)&row) { // scan the probe run for our element");
+        Ins(&R, rem.body, "        index = (index + 1) & mask;");
+        Ins(&R, rem.body, "    }");
+        Ins(&R, rem.body, "    u32 hole = index;");
+        Ins(&R, rem.body, "    u32 next = (hole + 1) & mask;");
+        Ins(&R, rem.body, "    while ($parname.$name_slots_elems[next].row) {");
+        Ins(&R, rem.body, "        u32 home = $parname.$name_slots_elems[next].hash & mask;");
+        Ins(&R, rem.body, "        // move entry into the hole unless its home slot lies in (hole, next]");
+        Ins(&R, rem.body, "        if (((next - home) & mask) >= ((next - hole) & mask)) {");
+        Ins(&R, rem.body, "            $parname.$name_slots_elems[hole] = $parname.$name_slots_elems[next];");
+        Ins(&R, rem.body, "            hole = next;");
+        Ins(&R, rem.body, "        }");
+        Ins(&R, rem.body, "        next = (next + 1) & mask;");
+        Ins(&R, rem.body, "    }");
+        Ins(&R, rem.body, "    $parname.$name_slots_elems[hole].hash = 0;");
+        Ins(&R, rem.body, "    $parname.$name_slots_elems[hole].row  = NULL;");
+        Ins(&R, rem.body, "    $parname.$name_n--;");
+        Ins(&R, rem.body, "    row.$name_in = false; // not-in-hash");
+        Ins(&R, rem.body, "}");
+        return;
+    }
+    Set(R, "$rowhash", Subst(R, thash.cachehash ? "row.$name_hashval" : "$Hashfldtype_Hash(0, $gethashfld)"));
     Ins(&R, rem.body, "if (LIKELY(row.$name_next != ($Cpptype*)-1)) {// check if in hash already");
-    Ins(&R, rem.body, "    u32 index = $Hashfldtype_Hash(0, $gethashfld) & ($parname.$name_buckets_n - 1);");
+    Ins(&R, rem.body, "    u32 hash  = $rowhash;");
+    Ins(&R, rem.body, "    u32 index = hash & ($parname.$name_buckets_n - 1);");
     Ins(&R, rem.body, "    $Cpptype* *prev = &$parname.$name_buckets_elems[index]; // addr of pointer to current element");
+    if (thash.incremental) {
+        InsOldBucket(R, rem.body, "prev");
+    }
     Ins(&R, rem.body, "    while ($Cpptype *next = *prev) {                          // scan the collision chain for our element");
     Ins(&R, rem.body, "        if (next == &row) {        // found it?");
     Ins(&R, rem.body, "            *prev = next->$name_next; // unlink (singly linked list)");
@@ -368,16 +628,33 @@ void amc::tfunc_Thash_FindRemove() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
     amc::FField &field = *amc::_db.genfield.p_field;
 
-    if (field.c_findrem) {
+    if (field.c_findrem && field.c_thash->openaddr) {
         amc::FFunc& findrem = amc::CreateCurFunc();
         Ins(&R, findrem.ret  , "$Cpptype*", false);
         Ins(&R, findrem.proto, "$name_FindRemove($Parent, $Hashfldarg key)", false);
-        Ins(&R, findrem.body, "u32 index = $Hashfldtype_Hash(0, key) & ($parname.$name_buckets_n - 1);");
+        Ins(&R, findrem.body, "$Cpptype* ret = $name_Find($pararg, key);");
+        Ins(&R, findrem.body, "if (ret) {");
+        Ins(&R, findrem.body, "    $name_Remove($pararg, *ret);");
+        Ins(&R, findrem.body, "}");
+        Ins(&R, findrem.body, "return ret;");
+    } else if (field.c_findrem) {
+        amc::FFunc& findrem = amc::CreateCurFunc();
+        Ins(&R, findrem.ret  , "$Cpptype*", false);
+        Ins(&R, findrem.proto, "$name_FindRemove($Parent, $Hashfldarg key)", false);
+        Ins(&R, findrem.body, "u32 hash  = $Hashfldtype_Hash(0, key);");
+        Ins(&R, findrem.body, "u32 index = hash & ($parname.$name_buckets_n - 1);");
         Ins(&R, findrem.body, "$Cpptype* *prev = &$parname.$name_buckets_elems[index];");
+        if (field.c_thash->incremental) {
+            InsOldBucket(R, findrem.body, "prev");
+        }
         Ins(&R, findrem.body, "$Cpptype* ret=NULL;");
         Ins(&R, findrem.body, "do {");
         Ins(&R, findrem.body, "    ret       = *prev;");
-        Ins(&R, findrem.body, "    bool done = !ret || $rethashfld == key;");
+        if (field.c_thash->cachehash) {
+            Ins(&R, findrem.body, "    bool done = !ret || (ret->$name_hashval == hash && $rethashfld == key);");
+        } else {
+            Ins(&R, findrem.body, "    bool done = !ret || $rethashfld == key;");
+        }
         Ins(&R, findrem.body, "    if (done) break;");
         Ins(&R, findrem.body, "    prev         = &ret->$name_next;");
         Ins(&R, findrem.body, "} while (true);");
@@ -397,6 +674,16 @@ void amc::tfunc_Thash_Init() {
     init.inl = false;
     init.priv = true;// static
     Ins(&R, init.body, "// initialize hash table for $Cpptype;");
+    if (amc::_db.genfield.p_field->c_thash->openaddr) {
+        Ins(&R, init.body, "$parname.$name_n           \t= 0; // ($field)");
+        Ins(&R, init.body, "$parname.$name_slots_n     \t= 8; // ($field)");
+        Ins(&R, init.body, "$parname.$name_slots_elems \t= (algo::Hashslot*)$basepool_AllocMem(sizeof(algo::Hashslot)*$parname.$name_slots_n); // initial slots ($field)");
+        Ins(&R, init.body, "if (!$parname.$name_slots_elems) {");
+        Ins(&R, init.body, "    FatalErrorExit(\"out of memory\"); // ($field)");
+        Ins(&R, init.body, "}");
+        Ins(&R, init.body, "memset($parname.$name_slots_elems, 0, sizeof(algo::Hashslot)*$parname.$name_slots_n); // ($field)");
+        return;
+    }
     Ins(&R, init.body, "$parname.$name_n             \t= 0; // ($field)");
     Ins(&R, init.body, "$parname.$name_buckets_n     \t= 4; // ($field)");
     Ins(&R, init.body, "$parname.$name_buckets_elems \t= ($Cpptype**)$basepool_AllocMem(sizeof($Cpptype*)*$parname.$name_buckets_n); // initial buckets ($field)");
@@ -404,6 +691,11 @@ void amc::tfunc_Thash_Init() {
     Ins(&R, init.body, "    FatalErrorExit(\"out of memory\"); // ($field)");
     Ins(&R, init.body, "}");
     Ins(&R, init.body, "memset($parname.$name_buckets_elems, 0, sizeof($Cpptype*)*$parname.$name_buckets_n); // ($field)");
+    if (amc::_db.genfield.p_field->c_thash->incremental) {
+        Ins(&R, init.body, "$parname.$name_old_elems \t= NULL; // ($field)");
+        Ins(&R, init.body, "$parname.$name_old_n     \t= 0; // ($field)");
+        Ins(&R, init.body, "$parname.$name_old_pos   \t= 0; // ($field)");
+    }
 }
 
 void amc::tfunc_Thash_Uninit() {
@@ -413,8 +705,15 @@ void amc::tfunc_Thash_Uninit() {
     amc::FFunc& uninit = amc::CreateCurFunc();
     if (GlobalQ(*field.p_ctype)) {
         Ins(&R, uninit.body, "// skip destruction of $name in global scope");
+    } else if (field.c_thash->openaddr) {
+        Ins(&R, uninit.body, "$basepool_FreeMem($parname.$name_slots_elems, sizeof(algo::Hashslot)*$parname.$name_slots_n); // ($field)");
     } else {
         Ins(&R, uninit.body, "$basepool_FreeMem($parname.$name_buckets_elems, sizeof($Cpptype*)*$parname.$name_buckets_n); // ($field)");
+        if (field.c_thash->incremental) {
+            Ins(&R, uninit.body, "if ($parname.$name_old_elems) {");
+            Ins(&R, uninit.body, "    $basepool_FreeMem($parname.$name_old_elems, sizeof($Cpptype*)*$parname.$name_old_n); // ($field)");
+            Ins(&R, uninit.body, "}");
+        }
     }
 }
 
@@ -435,7 +734,55 @@ void amc::tfunc_Thash_curs() {
     Set(R, "$curspararg", ch_N(Subst(R,"$pararg")) ? "*curs.$parname" : "");
 
     // zero-density hash shouldn't need a cursor
-    if (CursN(field)>0) {
+    if (CursN(field)>0 && field.c_thash->openaddr) {
+        Ins(&R, ns.curstext    , "");
+        Ins(&R, ns.curstext    , "struct $Parname_$name_curs {// cursor");
+        Ins(&R, ns.curstext    , "    typedef $Cpptype ChildType;");
+        Ins(&R, ns.curstext    , "    $Partype *parent;");
+        Ins(&R, ns.curstext    , "    int index;");
+        Ins(&R, ns.curstext    , "    $Parname_$name_curs() { parent=NULL; index=0; }");
+        Ins(&R, ns.curstext    , "};");
+        Ins(&R, ns.curstext    , "");
+
+        {
+            amc::FFunc& reset = amc::ind_func_GetOrCreate(Subst(R,"$field_curs.Reset"));
+            Ins(&R, reset.ret  , "void", false);
+            Ins(&R, reset.proto, "$Parname_$name_curs_Reset($Parname_$name_curs &curs, $Partype &parent)", false);
+            Ins(&R, reset.body, "curs.index = 0;");
+            Ins(&R, reset.body, "curs.parent = &parent;");
+            Ins(&R, reset.body, "while (curs.index < parent.$name_slots_n && !parent.$name_slots_elems[curs.index].row) {");
+            Ins(&R, reset.body, "    curs.index += 1;");
+            Ins(&R, reset.body, "}");
+        }
+
+        {
+            amc::FFunc& curs_validq = amc::ind_func_GetOrCreate(Subst(R,"$field_curs.ValidQ"));
+            curs_validq.inl = true;
+            Ins(&R, curs_validq.comment, "cursor points to valid item");
+            Ins(&R, curs_validq.ret  , "bool", false);
+            Ins(&R, curs_validq.proto, "$Parname_$name_curs_ValidQ($Parname_$name_curs &curs)", false);
+            Ins(&R, curs_validq.body, "return curs.index < curs.parent->$name_slots_n;");
+        }
+
+        {
+            amc::FFunc& curs_next = amc::ind_func_GetOrCreate(Subst(R,"$field_curs.Next"));
+            curs_next.inl = true;
+            Ins(&R, curs_next.comment, "proceed to next item");
+            Ins(&R, curs_next.ret  , "void", false);
+            Ins(&R, curs_next.proto, "$Parname_$name_curs_Next($Parname_$name_curs &curs)", false);
+            Ins(&R, curs_next.body, "curs.index += 1;");
+            Ins(&R, curs_next.body, "while (curs.index < curs.parent->$name_slots_n && !curs.parent->$name_slots_elems[curs.index].row) {");
+            Ins(&R, curs_next.body, "    curs.index += 1;");
+            Ins(&R, curs_next.body, "}");
+        }
+
+        amc::FFunc& curs_access = amc::ind_func_GetOrCreate(Subst(R,"$field_curs.Access"));
+        curs_access.inl = true;
+        Ins(&R, curs_access.comment, "item access");
+        Ins(&R, curs_access.ret  , "$Cpptype&", false);
+        Ins(&R, curs_access.proto, "$Parname_$name_curs_Access($Parname_$name_curs &curs)", false);
+        Ins(&R, curs_access.body, "return *($Cpptype*)curs.parent->$name_slots_elems[curs.index].row;");
+    } else if (CursN(field)>0) {
         Ins(&R, ns.curstext    , "");
         Ins(&R, ns.curstext    , "struct $Parname_$name_curs {// cursor");
         Ins(&R, ns.curstext    , "    typedef $Cpptype ChildType;");
@@ -455,8 +802,14 @@ void amc::tfunc_Thash_curs() {
             Ins(&R, reset.body, "curs.prow = &parent.$name_buckets_elems[0]; // hash never has zero buckets");
             Ins(&R, reset.body, "while (!*curs.prow) {");
             Ins(&R, reset.body, "    curs.bucket += 1;");
-            Ins(&R, reset.body, "    if (curs.bucket == parent.$name_buckets_n) break;");
-            Ins(&R, reset.body, "    curs.prow = &parent.$name_buckets_elems[curs.bucket];");
+            if (field.c_thash->incremental) {
+                // buckets of the new array, followed by buckets of the old array
+                Ins(&R, reset.body, "    if (curs.bucket == parent.$name_buckets_n + parent.$name_old_n) break;");
+                Ins(&R, reset.body, "    curs.prow = curs.bucket < parent.$name_buckets_n ? &parent.$name_buckets_elems[curs.bucket] : &parent.$name_old_elems[curs.bucket - parent.$name_buckets_n];");
+            } else {
+                Ins(&R, reset.body, "    if (curs.bucket == parent.$name_buckets_n) break;");
+                Ins(&R, reset.body, "    curs.prow = &parent.$name_buckets_elems[curs.bucket];");
+            }
             Ins(&R, reset.body, "}");
         }
 
@@ -478,8 +831,13 @@ void amc::tfunc_Thash_curs() {
             Ins(&R, curs_next.body, "curs.prow = &(*curs.prow)->$name_next;");
             Ins(&R, curs_next.body, "while (!*curs.prow) {");
             Ins(&R, curs_next.body, "    curs.bucket += 1;");
-            Ins(&R, curs_next.body, "    if (curs.bucket >= curs.parent->$name_buckets_n) break;");
-            Ins(&R, curs_next.body, "    curs.prow = &curs.parent->$name_buckets_elems[curs.bucket];");
+            if (field.c_thash->incremental) {
+                Ins(&R, curs_next.body, "    if (curs.bucket >= curs.parent->$name_buckets_n + curs.parent->$name_old_n) break;");
+                Ins(&R, curs_next.body, "    curs.prow = curs.bucket < curs.parent->$name_buckets_n ? &curs.parent->$name_buckets_elems[curs.bucket] : &curs.parent->$name_old_elems[curs.bucket - curs.parent->$name_buckets_n];");
+            } else {
+                Ins(&R, curs_next.body, "    if (curs.bucket >= curs.parent->$name_buckets_n) break;");
+                Ins(&R, curs_next.body, "    curs.prow = &curs.parent->$name_buckets_elems[curs.bucket];");
+            }
             Ins(&R, curs_next.body, "}");
         }
 
@@ -33,6 +33,23 @@ static bool MtfreeQ(amc::FField &field) {
     return false;
 }
 
+// Per-thread magazine (dmmeta.magazine):
+// Each thread keeps up to $magsize free elements in a thread-local list.
+// AllocMem and FreeMem only touch the thread's own list; when the list is empty,
+// $magbatch elements are moved from the shared free list (Refill), and when it overflows,
+// $magbatch elements are returned to it (Spill). The shared list is protected by a mutex.
+static void SetMagazineVars(algo_lib::Replscope &R, amc::FField &field) {
+    if (!GlobalQ(*field.p_ctype)) {
+        prerr("amc.magazine_global"
+              <<Keyval("field",field.field)
+              <<Keyval("comment","per-thread magazine requires a pool in the global namespace struct"));
+        algo_lib::_db.exit_code++;
+    }
+    u32 size = u32_Max(field.c_magazine->size, 2);
+    Set(R, "$magsize", tempstr() << size);
+    Set(R, "$magbatch", tempstr() << size/2);
+}
+
 void amc::tclass_Tpool() {
     algo_lib::Replscope &R = amc::_db.genfield.R;
     amc::FField &field = *amc::_db.genfield.p_field;
@@ -46,6 +63,20 @@ void amc::tclass_Tpool() {
     if (mtfree) {
         InsVar(R, field.p_ctype, "$Cpptype* volatile", "$name_free_mt", "", "");
     }
+    if (field.c_magazine) {
+        amc::FNs &ns = *field.p_ctype->p_ns;
+        SetMagazineVars(R, field);
+        InsVar(R, field.p_ctype, "pthread_mutex_t", "$name_lock", "", "Protects $name_free in multi-threaded use");
+        InsVar(R, field.p_ctype, "u64", "$name_n_maghit", "", "Allocations served from per-thread magazines");
+        InsVar(R, field.p_ctype, "u64", "$name_n_refill", "", "Number of magazine refills from shared free list");
+        InsVar(R, field.p_ctype, "u64", "$name_n_spill", "", "Number of magazine spills to shared free list");
+        Ins(&R, *ns.hdr, "struct $name_Tpmag {// per-thread cache of free elements ($field)");
+        Ins(&R, *ns.hdr, "    $Cpptype* head;  // linked via $name_next");
+        Ins(&R, *ns.hdr, "    i32 n;  // number of elements in magazine");
+        Ins(&R, *ns.hdr, "    u64 n_hit;  // allocations from magazine, not yet added to $name_n_maghit");
+        Ins(&R, *ns.hdr, "};");
+        Ins(&R, *ns.cpp, "static thread_local $ns::$name_Tpmag $ns_$name_tpmag; // ($field) per-thread magazine");
+    }
 
     if (!GlobalQ(*field.p_ctype)) {
         prerr("amc.nonglobal_tpool"
@@ -112,6 +143,52 @@ void amc::tfunc_Tpool_AllocMem() {
     Ins(&R, allocmem.comment, "If no memory available, return NULL.");
     Ins(&R, allocmem.ret  , "void*", false);
     Ins(&R, allocmem.proto, "$name_AllocMem($Parent)", false);
+    if (field.c_magazine) {
+        Ins(&R, allocmem.comment, "Thread-safe: element is taken from the calling thread's magazine.");
+        Ins(&R, allocmem.body, "$ns::$name_Tpmag &mag = $ns_$name_tpmag;");
+        Ins(&R, allocmem.body, "$Cpptype *row = mag.head;");
+        Ins(&R, allocmem.body, "if (LIKELY(row)) {");
+        Ins(&R, allocmem.body, "    mag.head = row->$name_next;");
+        Ins(&R, allocmem.body, "    mag.n--;");
+        Ins(&R, allocmem.body, "    mag.n_hit++;");
+        Ins(&R, allocmem.body, "} else {");
+        Ins(&R, allocmem.body, "    row = $name_Refill($pararg, mag);");
+        Ins(&R, allocmem.body, "}");
+        Ins(&R, allocmem.body, "return row;");
+
+        amc::FFunc& refill = amc::ind_func_GetOrCreate(Subst(R,"$field.Refill"));
+        refill.priv = true;
+        Ins(&R, refill.comment, "Magazine MAG is empty: move up to $magbatch elements from the shared free list");
+        Ins(&R, refill.comment, "into MAG, and return one more element (NULL if out of memory).");
+        Ins(&R, refill.ret  , "$Cpptype*", false);
+        Ins(&R, refill.proto, "$name_Refill($Parent, $ns::$name_Tpmag &mag)", false);
+        Ins(&R, refill.body, "$Cpptype *row = NULL;");
+        Ins(&R, refill.body, "pthread_mutex_lock(&$parname.$name_lock);");
+        Ins(&R, refill.body, "$parname.$name_n_maghit += mag.n_hit;");
+        Ins(&R, refill.body, "mag.n_hit = 0;");
+        Ins(&R, refill.body, "$parname.$name_n_refill++;");
+        Ins(&R, refill.body, "for (int i = 0; i <= $magbatch; i++) {");
+        Ins(&R, refill.body, "    $Cpptype *elem = $parname.$name_free;");
+        Ins(&R, refill.body, "    if (UNLIKELY(!elem)) {");
+        Ins(&R, refill.body, "        $name_Reserve($pararg,1);");
+        Ins(&R, refill.body, "        elem = $parname.$name_free;");
+        Ins(&R, refill.body, "        if (!elem) {");
+        Ins(&R, refill.body, "            break;");
+        Ins(&R, refill.body, "        }");
+        Ins(&R, refill.body, "    }");
+        Ins(&R, refill.body, "    $parname.$name_free = elem->$name_next;");
+        Ins(&R, refill.body, "    if (row) {");
+        Ins(&R, refill.body, "        elem->$name_next = mag.head;");
+        Ins(&R, refill.body, "        mag.head = elem;");
+        Ins(&R, refill.body, "        mag.n++;");
+        Ins(&R, refill.body, "    } else {");
+        Ins(&R, refill.body, "        row = elem;");
+        Ins(&R, refill.body, "    }");
+        Ins(&R, refill.body, "}");
+        Ins(&R, refill.body, "pthread_mutex_unlock(&$parname.$name_lock);");
+        Ins(&R, refill.body, "return row;");
+        return;
+    }
     Ins(&R, allocmem.body    , "$Cpptype *row = $parname.$name_free;");
     if (mtfree) {
         Ins(&R, allocmem.body, "// empty thread-safe free list.");
@@ -141,7 +218,34 @@ void amc::tfunc_Tpool_FreeMem() {
     Ins(&R, freemem.body        , "if (UNLIKELY(row.$name_next != ($Cpptype*)-1)) {");
     Ins(&R, freemem.body        , "    FatalErrorExit(\"$ns.tpool_double_delete  pool:$field  comment:'double deletion caught'\");");
     Ins(&R, freemem.body        , "}");
-    if (mtfree) {
+    if (field.c_magazine) {
+        Ins(&R, freemem.comment , "Thread-safe: element goes to the calling thread's magazine.");
+        Ins(&R, freemem.body    , "$ns::$name_Tpmag &mag = $ns_$name_tpmag;");
+        Ins(&R, freemem.body    , "row.$name_next = mag.head; // insert into magazine");
+        Ins(&R, freemem.body    , "mag.head = &row;");
+        Ins(&R, freemem.body    , "mag.n++;");
+        Ins(&R, freemem.body    , "if (UNLIKELY(mag.n > $magsize)) {");
+        Ins(&R, freemem.body    , "    $name_Spill($pararg, mag, $magbatch);");
+        Ins(&R, freemem.body    , "}");
+
+        amc::FFunc& spill = amc::ind_func_GetOrCreate(Subst(R,"$field.Spill"));
+        spill.priv = true;
+        Ins(&R, spill.comment, "Move N elements from magazine MAG to the shared free list");
+        Ins(&R, spill.ret  , "void", false);
+        Ins(&R, spill.proto, "$name_Spill($Parent, $ns::$name_Tpmag &mag, int n)", false);
+        Ins(&R, spill.body, "pthread_mutex_lock(&$parname.$name_lock);");
+        Ins(&R, spill.body, "$parname.$name_n_maghit += mag.n_hit;");
+        Ins(&R, spill.body, "mag.n_hit = 0;");
+        Ins(&R, spill.body, "$parname.$name_n_spill++;");
+        Ins(&R, spill.body, "for (; n > 0 && mag.head; n--) {");
+        Ins(&R, spill.body, "    $Cpptype *elem = mag.head;");
+        Ins(&R, spill.body, "    mag.head = elem->$name_next;");
+        Ins(&R, spill.body, "    mag.n--;");
+        Ins(&R, spill.body, "    elem->$name_next = $parname.$name_free;");
+        Ins(&R, spill.body, "    $parname.$name_free = elem;");
+        Ins(&R, spill.body, "}");
+        Ins(&R, spill.body, "pthread_mutex_unlock(&$parname.$name_lock);");
+    } else if (mtfree) {
         Ins(&R, freemem.body    , "// OK to free from another thread.");
         Ins(&R, freemem.body    , "$Cpptype* temp = $parname.$name_free_mt; // insert into thread-safe free list");
         Ins(&R, freemem.body    , "do {");
@@ -167,4 +271,24 @@ void amc::tfunc_Tpool_Init() {
     }
     Ins(&R, init.body, "$parname.$name_free      = NULL;");
     Ins(&R, init.body, "$parname.$name_blocksize = BumpToPow2(64 * sizeof($Cpptype)); // allocate 64-127 elements at a time");
+    if (field.c_magazine) {
+        Ins(&R, init.body, "pthread_mutex_init(&$parname.$name_lock, NULL);");
+        Ins(&R, init.body, "$parname.$name_n_maghit = 0;");
+        Ins(&R, init.body, "$parname.$name_n_refill = 0;");
+        Ins(&R, init.body, "$parname.$name_n_spill = 0;");
+    }
+}
+
+void amc::tfunc_Tpool_FlushMag() {
+    algo_lib::Replscope &R = amc::_db.genfield.R;
+    amc::FField &field = *amc::_db.genfield.p_field;
+
+    if (field.c_magazine) {
+        amc::FFunc& flush = amc::CreateCurFunc();
+        Ins(&R, flush.comment, "A thread should call this before exiting; otherwise its cached elements are lost.");
+        Ins(&R, flush.ret  , "void", false);
+        Ins(&R, flush.proto, "$name_FlushMag($Parent)", false);
+        Ins(&R, flush.body, "$ns::$name_Tpmag &mag = $ns_$name_tpmag;");
+        Ins(&R, flush.body, "$name_Spill($pararg, mag, mag.n);");
+    }
 }
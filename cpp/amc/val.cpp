@@ -66,8 +66,11 @@ void amc::tclass_Val() {
         algo_lib::_db.exit_code++;
     }
 
-    // data field
-    if (!FldfuncQ(field)) {
+    // column field: value lives in a per-field array of the Lary pool;
+    // the row holds a reference to it, bound by the constructor
+    if (field.c_fcolumn && CheckFcolumnQ(field)) {
+        InsVar(R, field.p_ctype, "$Fldtype&", "$name", dflt, "$comment (column)");
+    } else if (!FldfuncQ(field) && !field.c_fcolumn) {// data field
         InsVar(R, field.p_ctype, "$Fldtype", "$name$suffix", dflt, "$comment");
     }
 }
@@ -255,3 +255,158 @@ void atf_amc::amctest_BhFirstChanged3() {
     vrfy_(107 == atf_amc::_db.bh_count);
 #endif
 }
+
+// -----------------------------------------------------------------------------
+
+// Check that heaps return the same sequence of keys as the reference binary heap
+static void CheckHeaprowOrder() {
+    atf_amc::_db_bh_heaprow_curs ref;
+    atf_amc::_db_bh_heaprow_inl_curs inl;
+    atf_amc::_db_bh_heaprow_ptr_curs ptr;
+    _db_bh_heaprow_curs_Reset(ref, atf_amc::_db);
+    _db_bh_heaprow_inl_curs_Reset(inl, atf_amc::_db);
+    _db_bh_heaprow_ptr_curs_Reset(ptr, atf_amc::_db);
+    int n = 0;
+    u64 prev = 0;
+    for (; _db_bh_heaprow_curs_ValidQ(ref); n++) {
+        vrfy_(_db_bh_heaprow_inl_curs_ValidQ(inl) && _db_bh_heaprow_ptr_curs_ValidQ(ptr));
+        u64 key = _db_bh_heaprow_curs_Access(ref).key;
+        vrfy_(key >= prev);
+        vrfyeq_(_db_bh_heaprow_inl_curs_Access(inl).key, key);
+        vrfyeq_(_db_bh_heaprow_ptr_curs_Access(ptr).key, key);
+        prev = key;
+        _db_bh_heaprow_curs_Next(ref);
+        _db_bh_heaprow_inl_curs_Next(inl);
+        _db_bh_heaprow_ptr_curs_Next(ptr);
+    }
+    vrfy_(!_db_bh_heaprow_inl_curs_ValidQ(inl) && !_db_bh_heaprow_ptr_curs_ValidQ(ptr));
+    vrfyeq_(n, atf_amc::bh_heaprow_N());
+    vrfyeq_(n, atf_amc::bh_heaprow_inl_N());
+    vrfyeq_(n, atf_amc::bh_heaprow_ptr_N());
+}
+
+// Apply random inserts, removals and key changes to a 4-ary heap
+// with inline keys and an 8-ary pointer heap, and cross-check them against
+// the binary heap
+void atf_amc::amctest_BheapDary() {
+    int n = 1000;
+    frep_(i,n) {
+        atf_amc::FHeaprow &row = atf_amc::heaprow_Alloc();
+        row.key = i32_WeakRandom(n);
+    }
+    frep_(iter,20000) {
+        atf_amc::FHeaprow &row = atf_amc::heaprow_qFind(i32_WeakRandom(n));
+        switch (i32_WeakRandom(4)) {
+        case 0:
+            atf_amc::bh_heaprow_Insert(row);
+            atf_amc::bh_heaprow_inl_Insert(row);
+            atf_amc::bh_heaprow_ptr_Insert(row);
+            break;
+        case 1:
+            atf_amc::bh_heaprow_Remove(row);
+            atf_amc::bh_heaprow_inl_Remove(row);
+            atf_amc::bh_heaprow_ptr_Remove(row);
+            break;
+        case 2:
+            row.key = i32_WeakRandom(n);
+            atf_amc::bh_heaprow_Reheap(row);
+            atf_amc::bh_heaprow_inl_Reheap(row);
+            atf_amc::bh_heaprow_ptr_Reheap(row);
+            break;
+        case 3: {
+            // rows with equal keys may come out in different order,
+            // so compare keys and put each row back into its own heap
+            atf_amc::FHeaprow *ref = atf_amc::bh_heaprow_RemoveFirst();
+            atf_amc::FHeaprow *inl = atf_amc::bh_heaprow_inl_RemoveFirst();
+            atf_amc::FHeaprow *ptr = atf_amc::bh_heaprow_ptr_RemoveFirst();
+            vrfyeq_(ref==NULL, inl==NULL);
+            vrfyeq_(ref==NULL, ptr==NULL);
+            if (ref) {
+                vrfyeq_(inl->key, ref->key);
+                vrfyeq_(ptr->key, ref->key);
+                vrfy_(!atf_amc::bh_heaprow_inl_InBheapQ(*inl) && !atf_amc::bh_heaprow_ptr_InBheapQ(*ptr));
+                atf_amc::bh_heaprow_Insert(*ref);
+                atf_amc::bh_heaprow_inl_Insert(*inl);
+                atf_amc::bh_heaprow_ptr_Insert(*ptr);
+            }
+        }break;
+        }
+        vrfyeq_(atf_amc::bh_heaprow_inl_N(), atf_amc::bh_heaprow_N());
+        vrfyeq_(atf_amc::bh_heaprow_ptr_N(), atf_amc::bh_heaprow_N());
+        if (iter % 1000 == 0) {
+            CheckHeaprowOrder();
+        }
+    }
+    CheckHeaprowOrder();
+    // ReheapFirst picks up the modified key of the first element
+    if (atf_amc::FHeaprow *first = atf_amc::bh_heaprow_inl_First()) {
+        first->key = n;
+        atf_amc::bh_heaprow_inl_ReheapFirst();
+        atf_amc::bh_heaprow_ptr_Reheap(*first);
+        atf_amc::bh_heaprow_Reheap(*first);
+        CheckHeaprowOrder();
+    }
+    // unordered cursor visits every row exactly once
+    int nvisit = 0;
+    ind_beg(atf_amc::_db_bh_heaprow_inl_unordcurs,row,atf_amc::_db) {
+        vrfy_(atf_amc::bh_heaprow_InBheapQ(row));
+        nvisit++;
+    }ind_end;
+    vrfyeq_(nvisit, atf_amc::bh_heaprow_N());
+    atf_amc::bh_heaprow_RemoveAll();
+    atf_amc::bh_heaprow_inl_Dealloc();
+    atf_amc::bh_heaprow_ptr_RemoveAll();
+    ind_beg(atf_amc::_db_heaprow_curs,row,atf_amc::_db) {
+        vrfy_(!atf_amc::bh_heaprow_inl_InBheapQ(row) && !atf_amc::bh_heaprow_ptr_InBheapQ(row));
+    }ind_end;
+    atf_amc::heaprow_RemoveAll();
+}
+
+// -----------------------------------------------------------------------------
+
+// Time a scheduler-like workload on each heap flavor in turn:
+// remove first element, assign it a later key and put it back.
+void atf_amc::amctest_PerfBheapDary() {
+    int n = 1000000;
+    int niter = 2000000;
+    frep_(i,n) {
+        atf_amc::FHeaprow &row = atf_amc::heaprow_Alloc();
+        (void)row;
+    }
+    frep_(kind,3) {
+        // same starting keys for each heap
+        srandom(1);
+        ind_beg(atf_amc::_db_heaprow_curs,row,atf_amc::_db) {
+            row.key = u64(i32_WeakRandom(1<<30));
+            switch (kind) {
+            case 0: atf_amc::bh_heaprow_Insert(row); break;
+            case 1: atf_amc::bh_heaprow_inl_Insert(row); break;
+            case 2: atf_amc::bh_heaprow_ptr_Insert(row); break;
+            }
+        }ind_end;
+        u64 c = algo::get_cycles();
+        frep_(i,niter) {
+            atf_amc::FHeaprow *row = NULL;
+            switch (kind) {
+            case 0: row = atf_amc::bh_heaprow_RemoveFirst(); break;
+            case 1: row = atf_amc::bh_heaprow_inl_RemoveFirst(); break;
+            case 2: row = atf_amc::bh_heaprow_ptr_RemoveFirst(); break;
+            }
+            row->key += u64(i32_WeakRandom(1<<20));
+            switch (kind) {
+            case 0: atf_amc::bh_heaprow_Insert(*row); break;
+            case 1: atf_amc::bh_heaprow_inl_Insert(*row); break;
+            case 2: atf_amc::bh_heaprow_ptr_Insert(*row); break;
+            }
+        }
+        c = algo::get_cycles() - c;
+        strptr name = kind==0 ? strptr("binary pointer heap")
+            : kind==1 ? strptr("4-ary heap, inline keys")
+            : strptr("8-ary pointer heap");
+        prlog(name<<": "<<c/niter<<" cycles per RemoveFirst+Insert, "<<n<<" elements");
+        atf_amc::bh_heaprow_RemoveAll();
+        atf_amc::bh_heaprow_inl_RemoveAll();
+        atf_amc::bh_heaprow_ptr_RemoveAll();
+    }
+    atf_amc::heaprow_RemoveAll();
+}
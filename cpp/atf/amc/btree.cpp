@@ -0,0 +1,273 @@
+// (C) 2018-2019 NYSE | Intercontinental Exchange
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contacting ICE: <https://www.theice.com/contact>
+//
+// Target: atf_amc (exe) -- Unit tests for amc (see amctest table)
+// Exceptions: NO
+// Source: cpp/atf/amc/btree.cpp
+//
+
+#include "include/atf_amc.h"
+
+// -----------------------------------------------------------------------------
+
+static u64 RandomKey(u64 range) {
+    return (u64(i32_WeakRandom(1<<30)) << 30 | u64(i32_WeakRandom(1<<30))) % range;
+}
+
+// Create N rows with random keys in [0,RANGE); don't index them
+static void CreateTreerows(int n, u64 range) {
+    frep_(i,n) {
+        atf_amc::FTreerow &row = atf_amc::treerow_Alloc();
+        row.key = RandomKey(range);
+    }
+}
+
+static void DeleteTreerows() {
+    atf_amc::bt_treerow_RemoveAll();
+    atf_amc::tr_treerow_RemoveAll();
+    atf_amc::treerow_RemoveAll();
+}
+
+// Check structure of subtree rooted at NODE:
+// parent pointers, leaf pointers of rows, key order, separators.
+// All keys in the subtree must be in [lo, hi]. Return number of rows in the subtree.
+static int CheckBtreeNode(atf_amc::_db_bt_treerow_node &node, u64 lo, u64 hi) {
+    int ret = 0;
+    vrfy_(node.n > 0 && node.n <= atf_amc::_db_bt_treerow_node::max_keys);
+    if (node.leaf) {
+        frep_(i,node.n) {
+            vrfy_(node.row[i]->key == node.key[i]);
+            vrfy_(node.row[i]->bt_treerow_leaf == &node);
+            vrfy_(lo <= node.key[i] && node.key[i] <= hi);
+            vrfy_(i == 0 || node.key[i-1] <= node.key[i]);
+        }
+        ret = node.n;
+    } else {
+        frep_(i,node.n) {
+            vrfy_(node.child[i]->parent == &node);
+            u64 clo = i > 0 ? node.key[i] : lo;
+            u64 chi = i+1 < node.n ? node.key[i+1] : hi;
+            vrfy_(lo <= clo && clo <= chi && chi <= hi);
+            ret += CheckBtreeNode(*node.child[i], clo, chi);
+        }
+    }
+    return ret;
+}
+
+// Check that the Btree is well-formed and contains the same keys
+// in the same order as the reference Atree
+static void CheckBtree() {
+    atf_amc::_db_bt_treerow_node *root = atf_amc::_db.bt_treerow_root;
+    vrfyeq_(root ? CheckBtreeNode(*root, 0, ~u64(0)) : 0, atf_amc::bt_treerow_N());
+    vrfy_(!root || root->parent == NULL);
+    vrfyeq_(atf_amc::bt_treerow_N(), atf_amc::_db.tr_treerow_n);
+    vrfyeq_(atf_amc::bt_treerow_EmptyQ(), atf_amc::tr_treerow_EmptyQ());
+    // forward cursor visits keys in the same order as the Atree
+    atf_amc::FTreerow *ref = atf_amc::tr_treerow_First();
+    int n = 0;
+    ind_beg(atf_amc::_db_bt_treerow_curs,row,atf_amc::_db) {
+        vrfy_(ref && ref->key == row.key);
+        vrfy_(atf_amc::bt_treerow_InTreeQ(row));
+        ref = atf_amc::tr_treerow_Next(*ref);
+        n++;
+    }ind_end;
+    vrfyeq_(n, atf_amc::bt_treerow_N());
+    // backward cursor
+    ref = atf_amc::tr_treerow_Last();
+    ind_beg(atf_amc::_db_bt_treerow_rcurs,row,atf_amc::_db) {
+        vrfy_(ref && ref->key == row.key);
+        ref = atf_amc::tr_treerow_Prev(*ref);
+    }ind_end;
+    vrfy_(ref == NULL);
+    ind_beg(atf_amc::_db_treerow_curs,row,atf_amc::_db) {
+        vrfyeq_(atf_amc::bt_treerow_InTreeQ(row), atf_amc::tr_treerow_InTreeQ(row));
+    }ind_end;
+}
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_Btree() {
+    int n = 20000;
+    u64 range = 5000;// plenty of duplicate keys
+    CreateTreerows(n, range);
+    frep_(iter,100000) {
+        atf_amc::FTreerow &row = atf_amc::treerow_qFind(i32_WeakRandom(n));
+        switch (i32_WeakRandom(4)) {
+        case 0:
+            atf_amc::bt_treerow_Remove(row);
+            atf_amc::tr_treerow_Remove(row);
+            break;
+        case 1:// change key of a row that may be in the tree
+            row.key = RandomKey(range);
+            atf_amc::bt_treerow_Reinsert(row);
+            atf_amc::tr_treerow_Reinsert(row);
+            break;
+        default:
+            atf_amc::bt_treerow_Insert(row);
+            atf_amc::tr_treerow_Insert(row);
+            break;
+        }
+        if (iter % 10000 == 0) {
+            CheckBtree();
+        }
+    }
+    CheckBtree();
+    // lookups
+    frep_(i,10000) {
+        u64 val = RandomKey(range + 10);
+        atf_amc::FTreerow *ref = atf_amc::tr_treerow_FirstGe(val);
+        atf_amc::FTreerow *lb = atf_amc::bt_treerow_LowerBound(val);
+        vrfyeq_(lb ? lb->key : u64(-1), ref ? ref->key : u64(-1));
+        atf_amc::FTreerow *found = atf_amc::bt_treerow_Find(val);
+        vrfyeq_(found != NULL, ref && ref->key == val);
+        vrfy_(!found || found->key == val);
+    }
+    // drain the tree from the front
+    while (atf_amc::FTreerow *row = atf_amc::bt_treerow_RemoveFirst()) {
+        vrfy_(row == atf_amc::tr_treerow_First() || row->key == atf_amc::tr_treerow_First()->key);
+        atf_amc::tr_treerow_Remove(*row);
+        if (atf_amc::bt_treerow_N() % 1000 == 0) {
+            CheckBtree();
+        }
+    }
+    vrfy_(atf_amc::_db.bt_treerow_root == NULL);
+    DeleteTreerows();
+}
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_BtreeCurs() {
+    // even keys 0..1998
+    frep_(i,1000) {
+        atf_amc::FTreerow &row = atf_amc::treerow_Alloc();
+        row.key = i*2;
+        atf_amc::bt_treerow_Insert(row);
+    }
+    vrfyeq_(atf_amc::bt_treerow_First()->key, u64(0));
+    vrfyeq_(atf_amc::bt_treerow_Last()->key, u64(1998));
+    vrfyeq_(atf_amc::bt_treerow_Find(501), (atf_amc::FTreerow*)NULL);
+    vrfyeq_(atf_amc::bt_treerow_Find(502)->key, u64(502));
+    vrfyeq_(atf_amc::bt_treerow_LowerBound(501)->key, u64(502));
+    vrfyeq_(atf_amc::bt_treerow_LowerBound(2000), (atf_amc::FTreerow*)NULL);
+    // forward range [501, 601)
+    {
+        atf_amc::_db_bt_treerow_curs curs;
+        u64 expect = 502;
+        for (atf_amc::_db_bt_treerow_curs_Seek(curs, atf_amc::_db, 501); atf_amc::_db_bt_treerow_curs_ValidQ(curs); atf_amc::_db_bt_treerow_curs_Next(curs)) {
+            if (atf_amc::_db_bt_treerow_curs_Access(curs).key >= 601) {
+                break;
+            }
+            vrfyeq_(atf_amc::_db_bt_treerow_curs_Access(curs).key, expect);
+            expect += 2;
+        }
+        vrfyeq_(expect, u64(602));
+        atf_amc::_db_bt_treerow_curs_Seek(curs, atf_amc::_db, 1999);
+        vrfy_(!atf_amc::_db_bt_treerow_curs_ValidQ(curs));
+    }
+    // backward range, keys < 501
+    {
+        atf_amc::_db_bt_treerow_rcurs curs;
+        u64 expect = 500;
+        int n = 0;
+        for (atf_amc::_db_bt_treerow_rcurs_Seek(curs, atf_amc::_db, 501); atf_amc::_db_bt_treerow_rcurs_ValidQ(curs); atf_amc::_db_bt_treerow_rcurs_Next(curs)) {
+            vrfyeq_(atf_amc::_db_bt_treerow_rcurs_Access(curs).key, expect);
+            expect -= 2;
+            n++;
+        }
+        vrfyeq_(n, 251);
+        atf_amc::_db_bt_treerow_rcurs_Seek(curs, atf_amc::_db, 0);
+        vrfy_(!atf_amc::_db_bt_treerow_rcurs_ValidQ(curs));
+        atf_amc::_db_bt_treerow_rcurs_Seek(curs, atf_amc::_db, 5000);
+        vrfyeq_(atf_amc::_db_bt_treerow_rcurs_Access(curs).key, u64(1998));
+    }
+    // remove all; rows are not deleted
+    atf_amc::bt_treerow_RemoveAll();
+    vrfy_(atf_amc::bt_treerow_EmptyQ());
+    vrfyeq_(atf_amc::bt_treerow_N(), 0);
+    ind_beg(atf_amc::_db_treerow_curs,row,atf_amc::_db) {
+        vrfy_(!atf_amc::bt_treerow_InTreeQ(row));
+    }ind_end;
+    DeleteTreerows();
+}
+
+// -----------------------------------------------------------------------------
+
+// Measure cycles per operation for Btree and Atree built over the same N rows
+static void PerfBtree(int n) {
+    CreateTreerows(n, ~u64(0));
+    int nfind = 1000000;
+    u64 *keys = new u64[1024];
+    frep_(i,1024) {
+        keys[i] = atf_amc::treerow_qFind(i32_WeakRandom(n)).key;
+    }
+    u64 c;
+    u64 sum = 0;
+    prlog("--------------------------------------------------------------------------------");
+    prlog("n:"<<n);
+    // insert
+    c = algo::get_cycles();
+    ind_beg(atf_amc::_db_treerow_curs,row,atf_amc::_db) {
+        atf_amc::bt_treerow_Insert(row);
+    }ind_end;
+    prlog("Btree insert: "<<(algo::get_cycles()-c)/n<<" cycles/insert");
+    c = algo::get_cycles();
+    ind_beg(atf_amc::_db_treerow_curs,row,atf_amc::_db) {
+        atf_amc::tr_treerow_Insert(row);
+    }ind_end;
+    prlog("Atree insert: "<<(algo::get_cycles()-c)/n<<" cycles/insert");
+    // find
+    c = algo::get_cycles();
+    frep_(j,nfind) {
+        sum += atf_amc::bt_treerow_LowerBound(keys[j & 1023])->key;
+    }
+    prlog("Btree find: "<<(algo::get_cycles()-c)/nfind<<" cycles/find");
+    c = algo::get_cycles();
+    frep_(j,nfind) {
+        sum += atf_amc::tr_treerow_FirstGe(keys[j & 1023])->key;
+    }
+    prlog("Atree find: "<<(algo::get_cycles()-c)/nfind<<" cycles/find");
+    // full scan
+    c = algo::get_cycles();
+    ind_beg(atf_amc::_db_bt_treerow_curs,row,atf_amc::_db) {
+        sum += row.key;
+    }ind_end;
+    prlog("Btree scan: "<<(algo::get_cycles()-c)/n<<" cycles/row");
+    c = algo::get_cycles();
+    ind_beg(atf_amc::_db_tr_treerow_curs,row,atf_amc::_db) {
+        sum += row.key;
+    }ind_end;
+    prlog("Atree scan: "<<(algo::get_cycles()-c)/n<<" cycles/row");
+    // remove
+    c = algo::get_cycles();
+    ind_beg(atf_amc::_db_treerow_curs,row,atf_amc::_db) {
+        atf_amc::bt_treerow_Remove(row);
+    }ind_end;
+    prlog("Btree remove: "<<(algo::get_cycles()-c)/n<<" cycles/remove");
+    c = algo::get_cycles();
+    ind_beg(atf_amc::_db_treerow_curs,row,atf_amc::_db) {
+        atf_amc::tr_treerow_Remove(row);
+    }ind_end;
+    prlog("Atree remove: "<<(algo::get_cycles()-c)/n<<" cycles/remove");
+    vrfy_(sum != 0);
+    delete[] keys;
+    DeleteTreerows();
+}
+
+void atf_amc::amctest_PerfBtree() {
+    PerfBtree(1000000);
+    PerfBtree(10000000);
+}
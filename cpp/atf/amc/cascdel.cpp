@@ -242,3 +242,38 @@ void atf_amc::amctest_CascdelAtree() {
     // verify
     vrfy_(!ary_Sum1s(atf_amc::_db.cascdel_check));
 }
+
+// btree
+void atf_amc::amctest_CascdelBtree() {
+    // setup
+    atf_amc::_db.cascdel_next_key=0;
+    ary_RemoveAll(atf_amc::_db.cascdel_check);
+    atf_amc::FCascdel &x = NewCascdel(NULL,atf_amc_FCascdel_type_btree);
+    frep_(i,100) {
+        NewCascdel(&x,atf_amc_FCascdel_type_btree);
+    }
+    vrfy_(ary_Sum1s(atf_amc::_db.cascdel_check)==atf_amc::_db.cascdel_next_key);
+    vrfy_(bt_child_btree_N(x) == 100);
+    // examine
+    cascdel_Delete(x);
+    // verify
+    vrfy_(!ary_Sum1s(atf_amc::_db.cascdel_check));
+}
+
+// btree - chain
+void atf_amc::amctest_CascdelBtreeChain() {
+    // setup
+    atf_amc::_db.cascdel_next_key=0;
+    ary_RemoveAll(atf_amc::_db.cascdel_check);
+    atf_amc::FCascdel &x = NewCascdel(NULL,atf_amc_FCascdel_type_btree);
+    atf_amc::FCascdel *y = &x;
+    frep_(i,100) {
+        y = &NewCascdel(y,atf_amc_FCascdel_type_btree);
+    }
+    vrfy_(ary_Sum1s(atf_amc::_db.cascdel_check)==atf_amc::_db.cascdel_next_key);
+    vrfy_(bt_child_btree_N(x) == 1);
+    // examine
+    cascdel_Delete(x);
+    // verify
+    vrfy_(!ary_Sum1s(atf_amc::_db.cascdel_check));
+}
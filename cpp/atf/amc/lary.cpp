@@ -0,0 +1,105 @@
+// (C) 2018-2019 NYSE | Intercontinental Exchange
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contacting ICE: <https://www.theice.com/contact>
+//
+// Target: atf_amc (exe) -- Unit tests for amc (see amctest table)
+// Exceptions: NO
+// Source: cpp/atf/amc/lary.cpp
+//
+
+#include "include/atf_amc.h"
+
+// -----------------------------------------------------------------------------
+
+// Create N rows; price and weight are derived from row index
+static void CreateColrows(int n) {
+    frep_(i,n) {
+        atf_amc::FColrow &row = atf_amc::colrow_Alloc();
+        row.key = tempstr() << "key_" << i;
+        row.weight = i;
+        row.price = i * 0.5;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_LaryColumn() {
+    int n = 1000;
+    CreateColrows(n);
+    vrfyeq_(atf_amc::colrow_N(), n);
+    // row.fld refers to the row's slot in the column array
+    frep_(i,n) {
+        atf_amc::FColrow &row = atf_amc::colrow_qFind(i);
+        vrfyeq_(row.rowid, i);
+        vrfy_(&row.price == &atf_amc::colrow_price_qFind(i));
+        vrfyeq_(row.price, i * 0.5);
+        vrfyeq_(row.qty, 1);// default
+        row.qty = i;
+        vrfyeq_(atf_amc::colrow_qty_qFind(i), i);
+    }
+    // column cursor visits the values in row id order
+    int nvisit = 0;
+    ind_beg(atf_amc::_db_colrow_price_curs,price,atf_amc::_db) {
+        vrfyeq_(ind_curs(price).index, nvisit);
+        vrfyeq_(price, atf_amc::colrow_qFind(nvisit).weight * 0.5);
+        price = -price;
+        nvisit++;
+    }ind_end;
+    vrfyeq_(nvisit, n);
+    vrfyeq_(atf_amc::colrow_qFind(7).price, -3.5);
+    // column values of re-allocated rows are reset to defaults
+    atf_amc::colrow_RemoveLast();
+    atf_amc::FColrow &row = atf_amc::colrow_Alloc();
+    vrfyeq_(row.rowid, n-1);
+    vrfyeq_(row.price, 0.0);
+    vrfyeq_(row.qty, 1);
+    atf_amc::colrow_RemoveAll();
+    nvisit = 0;
+    ind_beg(atf_amc::_db_colrow_qty_curs,qty,atf_amc::_db) {
+        (void)qty;
+        nvisit++;
+    }ind_end;
+    vrfyeq_(nvisit, 0);
+}
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_PerfLaryColumn() {
+    int n = 1<<22;
+    CreateColrows(n);
+    frep_(i,2) {
+        prlog("--------------------------------------------------------------------------------");
+        {
+            double sum = 0;
+            u64 c = algo::get_cycles();
+            ind_beg(atf_amc::_db_colrow_curs,row,atf_amc::_db) {
+                sum += row.price;
+            }ind_end;
+            c = algo::get_cycles() - c;
+            prlog("Lary column access through rows: "<<c/n<<" cycles/row  sum:"<<sum);
+        }
+        {
+            double sum = 0;
+            u64 c = algo::get_cycles();
+            ind_beg(atf_amc::_db_colrow_price_curs,price,atf_amc::_db) {
+                sum += price;
+            }ind_end;
+            c = algo::get_cycles() - c;
+            prlog("Lary column scan: "<<c/n<<" cycles/row  sum:"<<sum);
+        }
+    }
+    atf_amc::colrow_RemoveAll();
+}
@@ -0,0 +1,114 @@
+// (C) 2018-2019 NYSE | Intercontinental Exchange
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contacting ICE: <https://www.theice.com/contact>
+//
+// Target: atf_amc (exe) -- Unit tests for amc (see amctest table)
+// Exceptions: NO
+// Source: cpp/atf/amc/magazine.cpp
+//
+
+#include "include/atf_amc.h"
+
+#define MAG_NTHREAD 4
+#define MAG_NROW    1000
+
+// Rows allocated by each thread, freed by the next thread
+struct MagSlot {
+    int                index;
+    atf_amc::FMagrow  *row[MAG_NROW];
+    u8                *blk[MAG_NROW];
+    int                nerr;
+};
+static MagSlot mag_slot[MAG_NTHREAD];
+
+// Block size for row I, covering several Lpool size classes
+static u64 MagBlksize(int i) {
+    return 16 << (i % 5);
+}
+
+// Phase 1: allocate rows and blocks, churning through the magazine in between
+static void *MagAllocThread(void *arg) {
+    MagSlot &slot = *(MagSlot*)arg;
+    frep_(i,MAG_NROW) {
+        frep_(k,8) {// alloc/free pairs, served from the magazine
+            atf_amc::FMagrow *tmp = &atf_amc::magrow_Alloc();
+            atf_amc::magrow_Delete(*tmp);
+            atf_amc::maglpool_FreeMem(atf_amc::maglpool_AllocMem(MagBlksize(k)), MagBlksize(k));
+        }
+        atf_amc::FMagrow &row = atf_amc::magrow_Alloc();
+        row.owner = slot.index;
+        row.seq = i;
+        slot.row[i] = &row;
+        u64 size = MagBlksize(i);
+        slot.blk[i] = (u8*)atf_amc::maglpool_AllocMem(size);
+        memset(slot.blk[i], u8(slot.index*MAG_NROW + i), size);
+    }
+    atf_amc::magrow_FlushMag();
+    atf_amc::maglpool_FlushMag();
+    return NULL;
+}
+
+// Phase 2: verify and free rows allocated by another thread
+static void *MagFreeThread(void *arg) {
+    MagSlot &slot = *(MagSlot*)arg;
+    int owner = (slot.index + 1) % MAG_NTHREAD;
+    MagSlot &from = mag_slot[owner];
+    frep_(i,MAG_NROW) {
+        atf_amc::FMagrow &row = *from.row[i];
+        slot.nerr += row.owner != owner || row.seq != i;
+        u64 size = MagBlksize(i);
+        frep_(k,int(size)) {
+            slot.nerr += from.blk[i][k] != u8(owner*MAG_NROW + i);
+        }
+        atf_amc::magrow_Delete(row);
+        atf_amc::maglpool_FreeMem(from.blk[i], size);
+    }
+    atf_amc::magrow_FlushMag();
+    atf_amc::maglpool_FlushMag();
+    return NULL;
+}
+
+static void MagRunThreads(void *(*fcn)(void*)) {
+    pthread_t thread[MAG_NTHREAD];
+    frep_(t,MAG_NTHREAD) {
+        vrfy_(pthread_create(&thread[t], NULL, fcn, &mag_slot[t]) == 0);
+    }
+    frep_(t,MAG_NTHREAD) {
+        pthread_join(thread[t], NULL);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_MagazineMT() {
+    frep_(t,MAG_NTHREAD) {
+        mag_slot[t].index = t;
+        mag_slot[t].nerr = 0;
+    }
+    frep_(round,5) {
+        MagRunThreads(MagAllocThread);
+        MagRunThreads(MagFreeThread);
+    }
+    frep_(t,MAG_NTHREAD) {
+        vrfyeq_(mag_slot[t].nerr, 0);
+    }
+    vrfy_(atf_amc::_db.magrow_n_maghit > 0);
+    vrfy_(atf_amc::_db.magrow_n_refill > 0);
+    vrfy_(atf_amc::_db.magrow_n_spill > 0);
+    vrfy_(atf_amc::_db.maglpool_n_maghit > 0);
+    vrfy_(atf_amc::_db.maglpool_n_refill > 0);
+    vrfy_(atf_amc::_db.maglpool_n_spill > 0);
+}
@@ -374,8 +374,11 @@ void atf_amc::amctest_MsgLength() {
 
 void atf_amc::Main() {
     int nmatch=0;
+    // manual tests (e.g. long benchmarks) are skipped by the default selection
+    bool all = atf_amc::_db.cmdline.amctest.expr == "%";
     ind_beg(atf_amc::_db_amctest_curs,amctest, atf_amc::_db) {
-        amctest.select = Regx_Match(atf_amc::_db.cmdline.amctest, amctest.amctest);
+        amctest.select = Regx_Match(atf_amc::_db.cmdline.amctest, amctest.amctest)
+            && !(all && amctest.manual);
         nmatch += amctest.select;
     }ind_end;
     ind_beg(atf_amc::_db_amctest_curs,amctest, atf_amc::_db) if (amctest.select) {
@@ -205,3 +205,88 @@ void atf_amc::amctest_PerfSortString() {
         }
     }
 }
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_AmcSortRadix() {
+    atf_amc::FUnitSort frame;
+    int n = 1000;
+    // radix sort by value, signed keys; check against quick sort
+    {
+        frep_(i,n) {
+            atf_amc::TypeA &val = radix_Alloc(frame);
+            val.typea = (i*7919) % 2001 - 1000;
+            tary_Alloc(frame) = val;
+        }
+        vrfy_(!radix_SortedQ(frame));
+        radix_RadixSort(frame);
+        tary_QuickSort(frame);
+        vrfy_(radix_SortedQ(frame));
+        frep_(i,n) {
+            vrfyeq_(radix_qFind(frame,i).typea, tary_qFind(frame,i).typea);
+        }
+    }
+
+    // radix sort by pointer; duplicate keys keep their original order
+    {
+        frep_(i,n) {
+            radix_qFind(frame,i).typea = (i*73) % 10 - 5;
+            c_radix_Insert(frame,radix_qFind(frame,i));
+        }
+        c_radix_RadixSort(frame);
+        vrfy_(c_radix_SortedQ(frame));
+        for (int i = 1; i < n; i++) {
+            atf_amc::TypeA *a = c_radix_Find(frame,i-1);
+            atf_amc::TypeA *b = c_radix_Find(frame,i);
+            vrfy_(a->typea < b->typea || (a->typea == b->typea && a < b));
+        }
+        c_radix_RemoveAll(frame);
+    }
+
+    // radix sort of Smallstr keys, including prefixes, empty strings,
+    // and high-bit characters
+    {
+        const char *keys[] = {"", "b", "ab", "a", "abcdefghij", "abcdefgh", "abcdefgh\x80", "\xe9t\xe9"
+                              , "abcdefghi", "Z", "a\x01", "zzzzzzzzzzzzzzzzz", "abcdefgh" };
+        int nkey = int(sizeof(keys)/sizeof(keys[0]));
+        frep_(i,nkey) {
+            strkey_Alloc(frame).key = strptr(keys[i]);
+        }
+        strkey_RadixSort(frame);
+        vrfy_(strkey_SortedQ(frame));
+        vrfyeq_(strkey_N(frame), nkey);
+        for (int i = 1; i < nkey; i++) {
+            vrfy_(!algo::strptr_Lt(ch_Getary(strkey_qFind(frame,i).key), ch_Getary(strkey_qFind(frame,i-1).key)));
+        }
+        vrfyeq_(strptr(strkey_qFind(frame,0).key), strptr(""));
+        vrfyeq_(strptr(strkey_qFind(frame,1).key), strptr(keys[7]));// negative chars sort first
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_AmcSortParallel() {
+    atf_amc::FUnitSort frame;
+    // large enough to be split across threads
+    int n = 300000;
+    frep_(i,n) {
+        atf_amc::TypeA &val = parallel_Alloc(frame);
+        val.typea = i32_WeakRandom(n/2) - n/4;
+        tary_Alloc(frame) = val;
+    }
+    parallel_ParallelSort(frame);
+    tary_QuickSort(frame);
+    vrfy_(parallel_SortedQ(frame));
+    frep_(i,n) {
+        vrfyeq_(parallel_qFind(frame,i).typea, tary_qFind(frame,i).typea);
+    }
+    // small array is sorted in the calling thread
+    parallel_RemoveAll(frame);
+    frep_(i,100) {
+        parallel_Alloc(frame).typea = (i*73) % 100;
+    }
+    parallel_ParallelSort(frame);
+    frep_(i,100) {
+        vrfyeq_(parallel_qFind(frame,i).typea, i);
+    }
+}
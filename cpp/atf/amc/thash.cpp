@@ -0,0 +1,318 @@
+// (C) 2018-2019 NYSE | Intercontinental Exchange
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contacting ICE: <https://www.theice.com/contact>
+//
+// Target: atf_amc (exe) -- Unit tests for amc (see amctest table)
+// Exceptions: NO
+// Source: cpp/atf/amc/thash.cpp
+//
+
+#include "include/atf_amc.h"
+
+// -----------------------------------------------------------------------------
+
+// Create N rows with distinct keys; don't index them
+static void CreateHashrows(int n) {
+    frep_(i,n) {
+        atf_amc::FHashrow &row = atf_amc::hashrow_Alloc();
+        row.key = tempstr() << "key_" << i;
+    }
+}
+
+// Remove all rows from all hash indexes and delete them
+static void DeleteHashrows() {
+    ind_beg(atf_amc::_db_hashrow_curs,row,atf_amc::_db) {
+        atf_amc::ind_hashrow_Remove(row);
+        atf_amc::ind_hashrow_cached_Remove(row);
+        atf_amc::ind_hashrow_oa_Remove(row);
+        atf_amc::ind_hashrow_incr_Remove(row);
+    }ind_end;
+    vrfyeq_(atf_amc::ind_hashrow_N(), 0);
+    vrfyeq_(atf_amc::ind_hashrow_cached_N(), 0);
+    vrfyeq_(atf_amc::ind_hashrow_oa_N(), 0);
+    vrfyeq_(atf_amc::ind_hashrow_incr_N(), 0);
+    atf_amc::hashrow_RemoveAll();
+}
+
+// Check that index contents match the chained index ind_hashrow
+static void CheckHashrows() {
+    vrfyeq_(atf_amc::ind_hashrow_cached_N(), atf_amc::ind_hashrow_N());
+    vrfyeq_(atf_amc::ind_hashrow_oa_N(), atf_amc::ind_hashrow_N());
+    ind_beg(atf_amc::_db_hashrow_curs,row,atf_amc::_db) {
+        atf_amc::FHashrow *expect = atf_amc::ind_hashrow_Find(row.key);
+        vrfyeq_(atf_amc::ind_hashrow_cached_Find(row.key), expect);
+        vrfyeq_(atf_amc::ind_hashrow_oa_Find(row.key), expect);
+        vrfyeq_(row.ind_hashrow_oa_in, expect != NULL);
+    }ind_end;
+    int n=0;
+    ind_beg(atf_amc::_db_ind_hashrow_oa_curs,row,atf_amc::_db) {
+        vrfyeq_(atf_amc::ind_hashrow_Find(row.key), &row);
+        n++;
+    }ind_end;
+    vrfyeq_(n, atf_amc::ind_hashrow_N());
+}
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_ThashCachehash() {
+    int n = 1000;
+    CreateHashrows(n);
+    ind_beg(atf_amc::_db_hashrow_curs,row,atf_amc::_db) {
+        vrfy_(atf_amc::ind_hashrow_cached_InsertMaybe(row));
+        vrfyeq_(row.ind_hashrow_cached_hashval, algo::cstring_Hash(0, row.key));
+    }ind_end;
+    vrfyeq_(atf_amc::ind_hashrow_cached_N(), n);
+    // a second row with an existing key is rejected
+    atf_amc::FHashrow &dup = atf_amc::hashrow_Alloc();
+    dup.key = "key_7";
+    vrfy_(!atf_amc::ind_hashrow_cached_InsertMaybe(dup));
+    vrfyeq_(atf_amc::ind_hashrow_cached_Find("key_7"), &atf_amc::hashrow_qFind(7));
+    atf_amc::hashrow_RemoveLast();
+    // remove every other row, check lookups
+    frep_(i,n) {
+        if (i % 2 == 0) {
+            atf_amc::ind_hashrow_cached_Remove(atf_amc::hashrow_qFind(i));
+        }
+    }
+    vrfyeq_(atf_amc::ind_hashrow_cached_N(), n/2);
+    frep_(i,n) {
+        atf_amc::FHashrow *row = atf_amc::ind_hashrow_cached_Find(tempstr() << "key_" << i);
+        vrfyeq_(row, i % 2 ? &atf_amc::hashrow_qFind(i) : NULL);
+    }
+    vrfyeq_(atf_amc::ind_hashrow_cached_Find("nonexistent"), (atf_amc::FHashrow*)NULL);
+    DeleteHashrows();
+}
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_ThashOpenaddr() {
+    int n = 2000;
+    CreateHashrows(n);
+    // random mix of inserts and removes, applied to all three indexes;
+    // the chained index is the reference
+    frep_(iter,20000) {
+        atf_amc::FHashrow &row = atf_amc::hashrow_qFind(i32_WeakRandom(n));
+        if (i32_WeakRandom(3) == 0) {
+            atf_amc::ind_hashrow_Remove(row);
+            atf_amc::ind_hashrow_cached_Remove(row);
+            atf_amc::ind_hashrow_oa_Remove(row);
+        } else {
+            bool ins = atf_amc::ind_hashrow_InsertMaybe(row);
+            vrfyeq_(atf_amc::ind_hashrow_cached_InsertMaybe(row), ins);
+            vrfyeq_(atf_amc::ind_hashrow_oa_InsertMaybe(row), ins);
+        }
+        if (iter % 1000 == 0) {
+            CheckHashrows();
+        }
+    }
+    CheckHashrows();
+    // remove every third row (exercises backward-shift deletion)
+    for (int i = 0; i < n; i += 3) {
+        atf_amc::FHashrow &row = atf_amc::hashrow_qFind(i);
+        atf_amc::ind_hashrow_Remove(row);
+        atf_amc::ind_hashrow_cached_Remove(row);
+        atf_amc::ind_hashrow_oa_Remove(row);
+    }
+    CheckHashrows();
+    DeleteHashrows();
+}
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_PerfThash() {
+    int n = 100000;
+    int nfind = 1000000;
+    CreateHashrows(n);
+    ind_beg(atf_amc::_db_hashrow_curs,row,atf_amc::_db) {
+        atf_amc::ind_hashrow_InsertMaybe(row);
+        atf_amc::ind_hashrow_cached_InsertMaybe(row);
+        atf_amc::ind_hashrow_oa_InsertMaybe(row);
+    }ind_end;
+    // half the probes hit, half miss
+    algo::cstring *keys = new algo::cstring[1024];
+    frep_(i,1024) {
+        keys[i] = tempstr() << (i % 2 ? "key_" : "nokey_") << i32_WeakRandom(n);
+    }
+    frep_(i,2) {
+        prlog("--------------------------------------------------------------------------------");
+        {
+            int nfound = 0;
+            u64 c = algo::get_cycles();
+            frep_(j,nfind) {
+                nfound += atf_amc::ind_hashrow_Find(keys[j & 1023]) != NULL;
+            }
+            c = algo::get_cycles() - c;
+            prlog("Thash chained: "<<c/nfind<<" cycles/find  nfound:"<<nfound);
+        }
+        {
+            int nfound = 0;
+            u64 c = algo::get_cycles();
+            frep_(j,nfind) {
+                nfound += atf_amc::ind_hashrow_cached_Find(keys[j & 1023]) != NULL;
+            }
+            c = algo::get_cycles() - c;
+            prlog("Thash cachehash: "<<c/nfind<<" cycles/find  nfound:"<<nfound);
+        }
+        {
+            int nfound = 0;
+            u64 c = algo::get_cycles();
+            frep_(j,nfind) {
+                nfound += atf_amc::ind_hashrow_oa_Find(keys[j & 1023]) != NULL;
+            }
+            c = algo::get_cycles() - c;
+            prlog("Thash openaddr: "<<c/nfind<<" cycles/find  nfound:"<<nfound);
+        }
+    }
+    delete[] keys;
+    DeleteHashrows();
+}
+
+// -----------------------------------------------------------------------------
+
+// Check that every row of the pool is reachable through ind_hashrow_incr
+// exactly when it is reachable through ind_hashrow, both via Find and via cursor
+static void CheckHashrowsIncr() {
+    vrfyeq_(atf_amc::ind_hashrow_incr_N(), atf_amc::ind_hashrow_N());
+    ind_beg(atf_amc::_db_hashrow_curs,row,atf_amc::_db) {
+        vrfyeq_(atf_amc::ind_hashrow_incr_Find(row.key), atf_amc::ind_hashrow_Find(row.key));
+    }ind_end;
+    int n=0;
+    ind_beg(atf_amc::_db_ind_hashrow_incr_curs,row,atf_amc::_db) {
+        vrfyeq_(atf_amc::ind_hashrow_Find(row.key), &row);
+        n++;
+    }ind_end;
+    vrfyeq_(n, atf_amc::ind_hashrow_N());
+}
+
+void atf_amc::amctest_ThashIncremental() {
+    int n = 3000;
+    int nchecked = 0;
+    CreateHashrows(n);
+    frep_(i,n) {
+        atf_amc::FHashrow &row = atf_amc::hashrow_qFind(i);
+        vrfy_(atf_amc::ind_hashrow_InsertMaybe(row));
+        vrfy_(atf_amc::ind_hashrow_incr_InsertMaybe(row));
+        // duplicate key is detected whether the original is in the old or new array
+        atf_amc::FHashrow &dup = atf_amc::hashrow_Alloc();
+        dup.key = atf_amc::hashrow_qFind(i32_WeakRandom(i+1)).key;
+        vrfy_(!atf_amc::ind_hashrow_incr_InsertMaybe(dup));
+        atf_amc::hashrow_RemoveLast();
+        if (atf_amc::_db.ind_hashrow_incr_old_elems && i % 7 == 0) {
+            CheckHashrowsIncr();
+            nchecked++;
+        }
+    }
+    vrfy_(nchecked > 0);// some checks happened mid-rehash
+    // grow the table once more, then remove rows while the rehash is in progress
+    atf_amc::ind_hashrow_incr_Reserve(n);
+    vrfy_(atf_amc::_db.ind_hashrow_incr_old_elems != NULL);
+    for (int i = 0; i < n; i += 5) {
+        atf_amc::FHashrow &row = atf_amc::hashrow_qFind(i);
+        atf_amc::ind_hashrow_Remove(row);
+        atf_amc::ind_hashrow_incr_Remove(row);
+    }
+    CheckHashrowsIncr();
+    // re-insert; each insert migrates some of the remaining buckets
+    for (int i = 0; i < n; i += 5) {
+        atf_amc::FHashrow &row = atf_amc::hashrow_qFind(i);
+        atf_amc::ind_hashrow_InsertMaybe(row);
+        atf_amc::ind_hashrow_incr_InsertMaybe(row);
+    }
+    CheckHashrowsIncr();
+    DeleteHashrows();
+}
+
+// -----------------------------------------------------------------------------
+
+void atf_amc::amctest_PerfThashIncremental() {
+    int n = 1<<20;
+    CreateHashrows(n);
+    {
+        u64 maxc = 0;
+        u64 total = algo::get_cycles();
+        ind_beg(atf_amc::_db_hashrow_curs,row,atf_amc::_db) {
+            u64 c = algo::get_cycles();
+            atf_amc::ind_hashrow_InsertMaybe(row);
+            maxc = u64_Max(maxc, algo::get_cycles() - c);
+        }ind_end;
+        total = algo::get_cycles() - total;
+        prlog("Thash full rehash: "<<total/n<<" cycles/insert  max:"<<maxc<<" cycles");
+    }
+    {
+        u64 maxc = 0;
+        u64 total = algo::get_cycles();
+        ind_beg(atf_amc::_db_hashrow_curs,row,atf_amc::_db) {
+            u64 c = algo::get_cycles();
+            atf_amc::ind_hashrow_incr_InsertMaybe(row);
+            maxc = u64_Max(maxc, algo::get_cycles() - c);
+        }ind_end;
+        total = algo::get_cycles() - total;
+        prlog("Thash incremental rehash: "<<total/n<<" cycles/insert  max:"<<maxc<<" cycles");
+    }
+    DeleteHashrows();
+}
+
+// -----------------------------------------------------------------------------
+
+// Time random Find in ind_hugerow (THP false) or ind_hugerow_thp (THP true)
+static void PerfHugerowFind(bool thp, int n) {
+    int nfind = 4000000;
+    int nfound = 0;
+    u64 c = algo::get_cycles();
+    if (thp) {
+        frep_(j,nfind) {
+            nfound += atf_amc::ind_hugerow_thp_Find(n + i32_WeakRandom(n)) != NULL;
+        }
+    } else {
+        frep_(j,nfind) {
+            nfound += atf_amc::ind_hugerow_Find(i32_WeakRandom(n)) != NULL;
+        }
+    }
+    c = algo::get_cycles() - c;
+    prlog("Thash find, "<<(thp ? "huge pages" : "regular pages")<<": "<<c/nfind<<" cycles/find  nfound:"<<nfound);
+}
+
+// Rows [0,n) and their index ind_hugerow are allocated with regular pages,
+// rows [n,2n) and ind_hugerow_thp with transparent huge pages.
+// With 32MB of rows and 32MB of buckets per index, lookups with regular pages
+// miss the TLB on nearly every probe.
+// To compare whole-process behavior, run atf_amc with ALGO_HUGEPAGE=thp instead.
+void atf_amc::amctest_PerfHugepage() {
+    int n = 1<<21;
+    bool thp = algo_lib::_db.sbrk_thp;
+    frep_(i,2*n) {
+        algo_lib::_db.sbrk_thp = thp || i >= n;
+        atf_amc::FHugerow &row = atf_amc::hugerow_Alloc();
+        row.key = i;
+        if (i < n) {
+            vrfy_(atf_amc::ind_hugerow_InsertMaybe(row));
+        } else {
+            vrfy_(atf_amc::ind_hugerow_thp_InsertMaybe(row));
+        }
+    }
+    algo_lib::_db.sbrk_thp = thp;
+    prlog("sbrk thp_alloc:"<<algo_lib::_db.sbrk_thp_alloc);
+    frep_(i,2) {
+        prlog("--------------------------------------------------------------------------------");
+        PerfHugerowFind(false, n);
+        PerfHugerowFind(true, n);
+    }
+    ind_beg(atf_amc::_db_hugerow_curs,row,atf_amc::_db) {
+        atf_amc::ind_hugerow_Remove(row);
+        atf_amc::ind_hugerow_thp_Remove(row);
+    }ind_end;
+    atf_amc::hugerow_RemoveAll();
+}
@@ -30,12 +30,11 @@
 
 // -----------------------------------------------------------------------------
 
-static void _CheckQuery(const char *file, int line, strptr source, strptr query, strptr extraargs, strptr expect) {
-    const char *fname = "temp/x";
-    StringToFile(source, fname);
+// Run acr with input IN (a file or a data directory), and check its output
+static void CheckAcr(const char *file, int line, strptr in, strptr query, strptr extraargs, strptr expect) {
     command::acr acr;
     acr.report = false;
-    acr.in = fname;
+    acr.in = in;
     acr.pretty = false;
     acr.query = query;
     acr.report = false;
@@ -51,8 +50,61 @@ static void _CheckQuery(const char *file, int line, strptr source, strptr query,
          <<Keyval("expected",expect));
 }
 
+static void _CheckQuery(const char *file, int line, strptr source, strptr query, strptr extraargs, strptr expect) {
+    const char *fname = "temp/x";
+    StringToFile(source, fname);
+    CheckAcr(file, line, fname, query, extraargs, expect);
+}
+
 #define CheckQuery(source,query,extraargs,expect) _CheckQuery(__FILE__,__LINE__,source,query,extraargs,expect)
 
+// Replace contents of data directory DIR with records of SOURCE,
+// one ssimfile per type tag (e.g. dmmeta.ctype records go to DIR/dmmeta/ctype.ssim)
+static void WriteDataDir(strptr dir, strptr source) {
+    RemDirRecurse(dir, true);
+    ind_beg(algo::Line_curs, line, source) {
+        strptr tag = Pathcomp(line, " LL");
+        bool first = ch_N(tag) > 0;
+        ind_beg(algo::Line_curs, prev, source) if (first && ind_curs(prev).i < ind_curs(line).i) {
+            first = Pathcomp(prev, " LL") != tag;
+        }ind_end;
+        if (first) {// write all records with this tag
+            tempstr text;
+            ind_beg(algo::Line_curs, rec, source) if (Pathcomp(rec, " LL") == tag) {
+                text << rec << eol;
+            }ind_end;
+            tempstr fname;
+            fname << dir << "/" << Pathcomp(tag, ".LL") << "/" << Pathcomp(tag, ".LR") << ".ssim";
+            CreateDirRecurse(GetDirName(fname));
+            StringToFile(text, fname);
+        }
+    }ind_end;
+}
+
+// Same as CheckQuery, but SOURCE is loaded from a data directory,
+// so that the ssimfiles are loaded in parallel or by pkey (see -nthread, -lazy)
+static void _CheckQueryDir(const char *file, int line, strptr source, strptr query, strptr extraargs, strptr expect) {
+    const char *dir = "temp/acr_in";
+    WriteDataDir(dir, source);
+    CheckAcr(file, line, dir, query, extraargs, expect);
+}
+
+#define CheckQueryDir(source,query,extraargs,expect) _CheckQueryDir(__FILE__,__LINE__,source,query,extraargs,expect)
+
+// Run acr command CMD on the full data set with ARGS1 and with ARGS2,
+// and check that the outputs are the same (and not empty).
+// The exit code is not checked, so CMD may report errors (e.g. -check)
+static void _CheckSameOutput(const char *file, int line, strptr cmd, strptr args1, strptr args2) {
+    tempstr out1(SysEval(tempstr()<<cmd<<" "<<args1,FailokQ(true),1024*1024*10));
+    tempstr out2(SysEval(tempstr()<<cmd<<" "<<args2,FailokQ(true),1024*1024*10));
+    vrfy(ch_N(out1) > 0 && out1 == out2, tempstr()<<file<<":"<<line<<": atf_unit.acr  "
+         <<Keyval("success","N")
+         <<Keyval("command",cmd)
+         <<Keyval("comment",tempstr()<<"output differs with "<<args2<<" and "<<args1));
+}
+
+#define CheckSameOutput(cmd,args1,args2) _CheckSameOutput(__FILE__,__LINE__,cmd,args1,args2)
+
 // -----------------------------------------------------------------------------
 
 // Check selecting a single tuple from file.
@@ -122,6 +174,178 @@ void atf_unit::unittest_acr_Read5() {
                , "");
 }
 
+// --------------------------------------------------------------------------------
+
+// Check counters printed by -stats for an indexed and a scanning query
+// (times are not compared)
+void atf_unit::unittest_acr_Stats1() {
+    strptr source = "dmmeta.ctype  ctype:X  comment:a\n"
+        "dmmeta.ctype  ctype:Y  comment:b\n";
+    CheckQuery(source
+               , "dmmeta.ctype:Y"
+               , "-stats -print:N | sed 's/  load_time.*//'"
+               , "report.acr_query  query:dmmeta.ctype:Y  n_query:1  n_ctype:1  n_index:1  n_scan:0  n_rec:1  n_field:1  n_regx:1"
+               "  n_xrefrec:0  n_file:0  n_byte:0  n_lazyrec:0  n_select:1\n"
+               "report.acr_query  query:total  n_query:1  n_ctype:1  n_index:1  n_scan:0  n_rec:1  n_field:1  n_regx:1"
+               "  n_xrefrec:0  n_file:0  n_byte:0  n_lazyrec:0  n_select:1\n"
+               );
+    CheckQuery(source
+               , "dmmeta.ctype.comment:%b"
+               , "-stats -print:N | sed 's/  load_time.*//' | grep total"
+               , "report.acr_query  query:total  n_query:1  n_ctype:1  n_index:0  n_scan:1  n_rec:2  n_field:2  n_regx:6"
+               "  n_xrefrec:0  n_file:0  n_byte:0  n_lazyrec:0  n_select:1\n"
+               );
+    // -unused deselects X (referenced by X.k): n_select counts only what remains selected
+    CheckQuery("dmmeta.ctype  ctype:X  comment:a\n"
+               "dmmeta.ctype  ctype:Y  comment:b\n"
+               "dmmeta.field  field:X.k  arg:i32\n"
+               , "dmmeta.ctype:%"
+               , "-unused -stats -print:N | grep total | grep -o 'n_select:[0-9]*'"
+               , "n_select:1\n"
+               );
+}
+
+// --------------------------------------------------------------------------------
+
+// Check that -maxgroup limits the size of an aligned block
+void atf_unit::unittest_acr_Maxgroup1() {
+    CheckQuery("dmmeta.ctype  ctype:X\n"
+               "dmmeta.field field:X.b  reftype:B\n"
+               "dmmeta.field field:X.c  reftype:C\n"
+               "dmmeta.field field:X.d  reftype:D\n"
+               , "%"
+               , "-maxgroup:1"
+               , "dmmeta.ctype  ctype:X  comment:\"\"\n\n"
+               "dmmeta.field  field:X.b  arg:\"\"  reftype:B  dflt:\"\"  comment:\"\"\n"
+               "dmmeta.field  field:X.c  arg:\"\"  reftype:C  dflt:\"\"  comment:\"\"\n\n"
+               "dmmeta.field  field:X.d  arg:\"\"  reftype:D  dflt:\"\"  comment:\"\"\n"
+               );
+}
+
+// --------------------------------------------------------------------------------
+
+// Check non-pkey selection by prefix and with wildcards (uses value index)
+void atf_unit::unittest_acr_Read6() {
+    strptr source = "dmmeta.field field:X.a  reftype:Lary\n"
+        "dmmeta.field field:X.b  reftype:Lpool\n"
+        "dmmeta.field field:X.c  reftype:Tpool\n"
+        "dmmeta.field field:X.d  reftype:Lpool\n";
+    CheckQuery(source
+               , "dmmeta.field.reftype:Lp%"
+               , ""
+               , "dmmeta.field  field:X.b  arg:\"\"  reftype:Lpool  dflt:\"\"  comment:\"\"\n"
+               "dmmeta.field  field:X.d  arg:\"\"  reftype:Lpool  dflt:\"\"  comment:\"\"\n"
+               );
+    CheckQuery(source
+               , "dmmeta.field.reftype:L_ry"
+               , ""
+               , "dmmeta.field  field:X.a  arg:\"\"  reftype:Lary  dflt:\"\"  comment:\"\"\n"
+               );
+    CheckQuery(source
+               , "dmmeta.field.reftype:L%pool"
+               , ""
+               , "dmmeta.field  field:X.b  arg:\"\"  reftype:Lpool  dflt:\"\"  comment:\"\"\n"
+               "dmmeta.field  field:X.d  arg:\"\"  reftype:Lpool  dflt:\"\"  comment:\"\"\n"
+               );
+    // + and [...] keep their regex meaning, so the value is not a literal
+    CheckQuery(source
+               , "dmmeta.field.reftype:Lpo+l"
+               , ""
+               , "dmmeta.field  field:X.b  arg:\"\"  reftype:Lpool  dflt:\"\"  comment:\"\"\n"
+               "dmmeta.field  field:X.d  arg:\"\"  reftype:Lpool  dflt:\"\"  comment:\"\"\n"
+               );
+    CheckQuery(source
+               , "dmmeta.field.reftype:[LT]%y"
+               , ""
+               , "dmmeta.field  field:X.a  arg:\"\"  reftype:Lary  dflt:\"\"  comment:\"\"\n"
+               );
+}
+
+// -----------------------------------------------------------------------------
+
+// Check that loading ssimfiles on parallel loader threads
+// gives the same result as sequential loading
+void atf_unit::unittest_acr_Nthread1() {
+    CheckQueryDir("dmmeta.ns  ns:a\n"
+                  "dmmeta.ctype  ctype:a.X\n"
+                  "dmmeta.ctype  ctype:a.Y\n"
+                  "dmmeta.field  field:a.X.k  arg:i32  reftype:Val\n"
+                  "dmmeta.field  field:a.Y.k  arg:a.X  reftype:Pkey\n"
+                  "dmmeta.ssimfile  ssimfile:a.x  ctype:a.X\n"
+                  , "%"
+                  , "-nthread:4"
+                  , "dmmeta.ns  ns:a  nstype:\"\"  comment:\"\"\n\n"
+                  "dmmeta.ctype  ctype:a.X  comment:\"\"\n"
+                  "dmmeta.ctype  ctype:a.Y  comment:\"\"\n\n"
+                  "dmmeta.field  field:a.X.k  arg:i32  reftype:Val  dflt:\"\"  comment:\"\"\n"
+                  "dmmeta.field  field:a.Y.k  arg:a.X  reftype:Pkey  dflt:\"\"  comment:\"\"\n\n"
+                  "dmmeta.ssimfile  ssimfile:a.x  ctype:a.X\n"
+                  );
+    CheckSameOutput("bin/acr ns:acr -t -report:N", "-nthread:1", "-nthread:4");
+}
+
+// -----------------------------------------------------------------------------
+
+// Check that loading records by pkey (using sidecar index)
+// gives the same result as loading entire ssimfiles
+void atf_unit::unittest_acr_Lazy1() {
+    strptr source = "dmmeta.ns  ns:a\n"
+        "dmmeta.ctype  ctype:a.X\n"
+        "dmmeta.ctype  ctype:a.Y\n"
+        "dmmeta.ctype  ctype:a.Z\n"
+        "dmmeta.field  field:a.X.k  arg:i32  reftype:Val\n"
+        "dmmeta.field  field:a.Y.k  arg:a.X  reftype:Pkey\n"
+        "dmmeta.field  field:a.Z.k  arg:a.Y  reftype:Pkey\n";
+    strptr expect = "dmmeta.ns  ns:a  nstype:\"\"  comment:\"\"\n"
+        "  dmmeta.ctype  ctype:a.Y  comment:\"\"\n"
+        "    dmmeta.field  field:a.Y.k  arg:a.X  reftype:Pkey  dflt:\"\"  comment:\"\"\n\n"
+        "dmmeta.field  field:a.Z.k  arg:a.Y  reftype:Pkey  dflt:\"\"  comment:\"\"\n";
+    CheckQueryDir(source, "ctype:a.Y", "-t -lazy:N", expect);
+    CheckQueryDir(source, "ctype:a.Y", "-t -lazy:Y", expect);
+    // with -lazy:Y, no ssimfile is read in full
+    CheckQueryDir(source
+                  , "ctype:a.Y"
+                  , "-t -lazy:Y -stats -print:N | grep query:total | grep -o 'n_byte:[0-9]*  n_lazyrec:[0-9]*'"
+                  , "n_byte:0  n_lazyrec:6");
+    CheckQueryDir(source
+                  , "ctype:a.Y"
+                  , "-t -lazy:N -stats -print:N | grep query:total | grep -o 'n_byte:[0-9]*  n_lazyrec:[0-9]*'"
+                  , "n_byte:234  n_lazyrec:0");
+    CheckSameOutput("bin/acr ctype:acr.FDb -t -report:N -cmd:'echo $ctype'", "-lazy:N", "-lazy:Y");
+}
+
+// -----------------------------------------------------------------------------
+
+// Selecting all records of a ctype loads referencing ssimfiles in full
+// instead of key by key; output is the same
+void atf_unit::unittest_acr_Lazy2() {
+    // 64 ctypes, each with one field
+    tempstr source;
+    source << "dmmeta.ns  ns:a\n";
+    for (int i = 0; i < 64; i++) {
+        tempstr ctype("a.T");
+        i64_PrintPadLeft(i, ctype, 2);
+        source << "dmmeta.ctype  ctype:" << ctype << "\n";
+        source << "dmmeta.field  field:" << ctype << ".k  arg:i32  reftype:Val\n";
+    }
+    CheckQueryDir(source
+                  , "ctype:a.T01"
+                  , "-ndown:1 -lazy:Y"
+                  , "dmmeta.ctype  ctype:a.T01  comment:\"\"\n\n"
+                  "dmmeta.field  field:a.T01.k  arg:i32  reftype:Val  dflt:\"\"  comment:\"\"\n");
+    // a few ctypes: fields are looked up by key
+    CheckQueryDir(source
+                  , "ctype:a.T0%"
+                  , "-ndown:1 -lazy:Y -stats -print:N | grep query:total | grep -o 'n_byte:[0-9]*  n_lazyrec:[0-9]*  n_select:[0-9]*'"
+                  , "n_byte:0  n_lazyrec:20  n_select:20");
+    // all ctypes: field.ssim is loaded in full, ctypes are still loaded by key
+    CheckQueryDir(source
+                  , "ctype:a.%"
+                  , "-ndown:1 -lazy:Y -stats -print:N | grep query:total | grep -o 'n_byte:[0-9]*  n_lazyrec:[0-9]*  n_select:[0-9]*'"
+                  , "n_byte:3200  n_lazyrec:64  n_select:128");
+    CheckSameOutput("bin/acr ns:% -ndown:2 -report:N", "-lazy:N", "-lazy:Y");
+}
+
 // -----------------------------------------------------------------------------
 
 // Test re-writing a single file specified with -in
@@ -148,6 +372,53 @@ void atf_unit::unittest_acr_Write2() {
 
 // --------------------------------------------------------------------------------
 
+// Check that saving a data set, where unmodified records are copied
+// from the input file, gives the same result as printing every record (-check -write)
+void atf_unit::unittest_acr_Write3() {
+    tempstr dir("temp/acr_write3");
+    tempstr fname(tempstr()<<dir<<"/dmmeta/field.ssim");
+    tempstr cmd;
+    cmd << "rm -rf "<<dir<<" && mkdir -p "<<dir<<" && cp -r data/dmmeta "<<dir<<"/"
+        // a line with a missing attribute must be printed
+        << " && sed -i 's/^\\(dmmeta.field  field:acr.FRec.mod  .*\\)  dflt:false/\\1/' "<<fname
+        << " && echo 'dmmeta.field  field:acr.FRec.lineno  comment:x'"
+        << " | bin/acr -in:"<<dir<<" -merge -write -print:N -report:N"
+        << " && cp "<<fname<<" "<<dir<<"/field.ssim"
+        << " && bin/acr -in:"<<dir<<" dmmeta.field:% -check -write -print:N -report:N"
+        << " && cmp "<<fname<<" "<<dir<<"/field.ssim && echo same";
+    tempstr out(SysEval(cmd,FailokQ(true),1024*1024));
+    vrfy(out == "same\n", tempstr()<<"atf_unit.acr  "
+         <<Keyval("success","N")
+         <<Keyval("command",cmd)
+         <<Keyval("output",out)
+         <<Keyval("comment","-write output differs from -check -write"));
+}
+
+// --------------------------------------------------------------------------------
+
+// Check that -write preserves the spacing of unmodified lines in a file with edits,
+// and normalizes a file without edits
+void atf_unit::unittest_acr_Write4() {
+    tempstr dir("temp/acr_write4");
+    tempstr fname(tempstr()<<dir<<"/dmmeta/ns.ssim");
+    tempstr cmd;
+    cmd << "rm -rf "<<dir<<" && mkdir -p "<<dir<<" && cp -r data/dmmeta "<<dir<<"/"
+        << " && sed -i 's/^dmmeta.ns  ns:algo_lib  nstype/dmmeta.ns  ns:algo_lib   nstype/' "<<fname
+        << " && echo 'dmmeta.ns  ns:acr  comment:x'"
+        << " | bin/acr -in:"<<dir<<" -merge -write -print:N -report:N"
+        << " ; grep -c 'ns:algo_lib   nstype' "<<fname
+        << " ; bin/acr -in:"<<dir<<" dmmeta.ns:% -write -print:N -report:N"
+        << " ; grep -c 'ns:algo_lib   nstype' "<<fname;
+    tempstr out(SysEval(cmd,FailokQ(true),1024*1024));
+    vrfy(out == "1\n0\n", tempstr()<<"atf_unit.acr  "
+         <<Keyval("success","N")
+         <<Keyval("command",cmd)
+         <<Keyval("output",out)
+         <<Keyval("comment","-write must copy lines only into an edited file"));
+}
+
+// --------------------------------------------------------------------------------
+
 // Test that -insert -trunc removes all existing records of a given type
 // upon first insertion
 void atf_unit::unittest_acr_Insert1() {
@@ -193,6 +464,76 @@ void atf_unit::unittest_acr_Check1() {
 
 // --------------------------------------------------------------------------------
 
+// Check that -check -changed skips ssimfiles that haven't changed since the last
+// successful check, and checks records that reference a changed ssimfile.
+// A plain -check leaves no stamps.
+void atf_unit::unittest_acr_Check2() {
+    tempstr dir("temp/acr_check2");
+    tempstr check(tempstr()<<"bin/acr -in:"<<dir<<" %.% -check -changed 2>&1 | grep -o 'errors:[0-9]*'");
+    tempstr cmd;
+    cmd << "rm -rf "<<dir<<" temp/acr_check/temp.acr_check2.ssim"
+        << " && mkdir -p "<<dir<<" && cp -r data/* "<<dir<<"/"
+        << " && bin/acr -in:"<<dir<<" %.% -check > /dev/null"
+        << " && (test -e temp/acr_check/temp.acr_check2.ssim && echo stamped || true)"
+        << " && "<<check
+        << " && bin/acr -in:"<<dir<<" %.% -check -changed | grep -o 'records:[0-9]*'"
+        << " && sed -i '/target:acr_ed$/d' "<<dir<<"/dev/target.ssim"
+        << " && bin/acr -in:"<<dir<<" %.% -check -changed 2>&1 | grep -o 'acr.badrefs  ctype:dev.Targsrc'";
+    tempstr out(SysEval(cmd,FailokQ(true),1024*1024));
+    vrfy(out == "errors:0\nrecords:0\nacr.badrefs  ctype:dev.Targsrc\n", tempstr()<<"atf_unit.acr  "
+         <<Keyval("success","N")
+         <<Keyval("command",cmd)
+         <<Keyval("output",out)
+         <<Keyval("comment","-changed must check just the records affected by a change"
+                  ", and a plain -check must not write stamps"));
+}
+
+// --------------------------------------------------------------------------------
+
+// Check that -check on multiple threads reports the same records and errors
+// as a single thread, on the full data set and on a copy with bad references
+void atf_unit::unittest_acr_Check3() {
+    CheckSameOutput("bin/acr %.% -check", "-nthread:1 2>&1 | grep report.acr_check", "-nthread:4 2>&1 | grep report.acr_check");
+    tempstr dir("temp/acr_check3");
+    SysCmd(tempstr()<<"rm -rf "<<dir
+           <<" && mkdir -p "<<dir<<" && cp -r data/* "<<dir<<"/"
+           <<" && sed -i '/target:acr_ed$/d' "<<dir<<"/dev/target.ssim"
+           ,FailokQ(false));
+    CheckSameOutput(tempstr()<<"bin/acr -in:"<<dir<<" %.% -check -report:N", "-nthread:1 2>&1", "-nthread:4 2>&1");
+}
+
+// --------------------------------------------------------------------------------
+
+// Start a query server on a copy of data, and check that it answers
+// (the client doesn't load anything itself) and picks up a changed ssimfile.
+// The socket is private to the owner, and -check always runs locally.
+void atf_unit::unittest_acr_Serve1() {
+    tempstr dir("temp/acr_serve1");
+    tempstr sock("temp/acr_serve1.sock");
+    tempstr acr(tempstr()<<"bin/acr -in:"<<dir<<" -server:"<<sock);
+    tempstr cmd;
+    cmd << "rm -rf "<<dir<<" "<<sock
+        << " && mkdir -p "<<dir<<" && cp -r data/* "<<dir<<"/"
+        << " && (bin/acr -in:"<<dir<<" -serve:"<<sock<<" > "<<dir<<".log 2>&1 & echo $! > "<<dir<<".pid)"
+        << " && for i in $(seq 100); do test -S "<<sock<<" && break; sleep 0.05; done"
+        << " && "<<acr<<" ctype:acr.FRec -report:N"
+        << " && ("<<acr<<" ctype:acr.FRec -v 2>&1 | grep -c acr.load || true)"
+        << " && stat -c %a "<<sock
+        << " && ("<<acr<<" ctype:acr.FRec -check -v 2>&1 | grep -q acr.load && echo check:local)"
+        << " && sed -i '/acr.serve.cpp/d' "<<dir<<"/dev/targsrc.ssim"
+        << " && "<<acr<<" targsrc:acr/cpp/acr/serve.cpp -report:N"
+        << " && grep -o 'acr.reload  ssimfile:dev.targsrc' "<<dir<<".log"
+        << "; kill $(cat "<<dir<<".pid)";
+    tempstr out(SysEval(cmd,FailokQ(true),1024*1024));
+    vrfy(out == "dmmeta.ctype  ctype:acr.FRec  comment:\"\"\n0\n700\ncheck:local\nacr.reload  ssimfile:dev.targsrc\n", tempstr()<<"atf_unit.acr  "
+         <<Keyval("success","N")
+         <<Keyval("command",cmd)
+         <<Keyval("output",out)
+         <<Keyval("comment","query server must answer, and reload changed ssimfiles"));
+}
+
+// --------------------------------------------------------------------------------
+
 // Check that -unused deselects records that are referred to
 void atf_unit::unittest_acr_Unused1() {
     CheckQuery("dmmeta.ns  ns:a\n"
@@ -313,3 +654,24 @@ void atf_unit::unittest_acr_Meta1() {
     tempstr result=SysEval("acr ctype:u8 -meta | head -1",FailokQ(false),1024*1024);
     TESTCMP(strptr(result), strptr("dmmeta.ctype  ctype:dmmeta.Ctype  comment:\"C structure\"\n"));
 }
+
+// --------------------------------------------------------------------------------
+
+// Check -meta on records of several ctypes:
+// the ctype queries are run as one batch, with the same result as running them one by one
+void atf_unit::unittest_acr_Meta2() {
+    CheckQuery("dmmeta.ctype ctype:dmmeta.Ctype\n"
+               "dmmeta.ctype ctype:dmmeta.Field\n"
+               "dmmeta.field field:dmmeta.Ctype.ctype  reftype:Val\n"
+               "dmmeta.field field:dmmeta.Field.field  reftype:Val\n"
+               "dmmeta.field field:dmmeta.Field.ctype  reftype:Val\n"
+               , "%"
+               , "-meta"
+               , "dmmeta.ctype  ctype:dmmeta.Ctype  comment:\"\"\n"
+               "  dmmeta.field  field:dmmeta.Ctype.ctype  arg:\"\"  reftype:Val  dflt:\"\"  comment:\"\"\n"
+               "\n"
+               "dmmeta.ctype  ctype:dmmeta.Field  comment:\"\"\n"
+               "  dmmeta.field  field:dmmeta.Field.field  arg:\"\"  reftype:Val  dflt:\"\"  comment:\"\"\n"
+               "  dmmeta.field  field:dmmeta.Field.ctype  arg:\"\"  reftype:Val  dflt:\"\"  comment:\"\"\n"
+               );
+}
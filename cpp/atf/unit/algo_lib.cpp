@@ -1909,6 +1909,89 @@ void atf_unit::unittest_algo_lib_PerfParseDouble() {
                      );
         DO_PERF_TEST("atof",d=atof("0.1"));
     }
+    {
+        strptr data("1234567.890123");
+        double d;
+        DO_PERF_TEST("ParseDouble 1234567.890123",
+                     vrfy(double_ReadStrptrMaybe(d, data), algo_lib::_db.errtext)
+                     );
+        DO_PERF_TEST("atof",d=atof("1234567.890123"));
+    }
+    {
+        strptr data("1234567890123456");
+        i64 d;
+        DO_PERF_TEST("ParseI64 1234567890123456",
+                     vrfy(i64_ReadStrptrMaybe(d, data), algo_lib::_db.errtext)
+                     );
+        DO_PERF_TEST("atoll",d=atoll("1234567890123456"));
+    }
+    {
+        cstring out;
+        DO_PERF_TEST("i64_PrintPadLeft 1234567890123",
+                     ch_RemoveAll(out);
+                     i64_PrintPadLeft(1234567890123LL, out, 16)
+                     );
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Random decimal number: up to 25 integer digits, optional fraction, optional exponent
+static tempstr RandomDecimal() {
+    tempstr ret;
+    int nint = i32_WeakRandom(26);
+    int nfrac = i32_WeakRandom(3)==0 ? -1 : i32_WeakRandom(26);
+    if (nint == 0 && nfrac <= 0) {
+        nint = 1;
+    }
+    if (i32_WeakRandom(4) == 0) {
+        ret << '-';
+    }
+    rep_(i,nint) {
+        ret << char('0' + i32_WeakRandom(10));
+    }
+    if (nfrac >= 0) {
+        ret << '.';
+        rep_(i,nfrac) {
+            ret << char('0' + i32_WeakRandom(10));
+        }
+    }
+    if (i32_WeakRandom(2) == 0) {
+        ret << 'e' << i32_WeakRandom(700) - 350;
+    }
+    return ret;
+}
+
+// Compare number parsing and printing against the C library:
+// doubles must be bit-identical to strtod (correctly rounded),
+// integers must round-trip and match snprintf.
+void atf_unit::unittest_algo_lib_ParseNumberExact() {
+    rep_(iter,100000) {
+        tempstr str(RandomDecimal());
+        double d = 0;
+        vrfy(double_ReadStrptrMaybe(d, str), str);
+        double expect = strtod(Zeroterm(str), NULL);
+        vrfy(memcmp(&d, &expect, sizeof(d)) == 0, tempstr() << str << " parsed as " << d << ", expected " << expect);
+    }
+    rep_(iter,100000) {
+        u64 u = (u64(u32(i32_WeakRandom(INT_MAX))) << 33) ^ u64(u32(i32_WeakRandom(INT_MAX)));
+        u >>= i32_WeakRandom(64);
+        i64 i = i32_WeakRandom(2) ? -i64(u >> 1) : i64(u >> 1);
+        char buf[64];
+        tempstr str;
+        u64_Print(u, str);
+        snprintf(buf, sizeof(buf), "%llu", (unsigned long long)u);
+        vrfy_(str == strptr(buf));
+        u64 u2 = 0;
+        vrfy_(u64_ReadStrptrMaybe(u2, str) && u2 == u);
+        ch_RemoveAll(str);
+        int wid = i32_WeakRandom(24);
+        i64_PrintPadLeft(i, str, wid);
+        snprintf(buf, sizeof(buf), "%0*lld", wid, (long long)i);
+        vrfy(str == strptr(buf), tempstr() << str << " vs " << buf);
+        i64 i2 = 0;
+        vrfy_(i64_ReadStrptrMaybe(i2, str) && i2 == i);
+    }
 }
 
 namespace atf_unit {
@@ -1925,6 +2008,7 @@ void atf_unit::unittest_algo_lib_PerfSort() {
     frep_(input,5) {
         int N = 100000;
         const char *method = "";
+        orig_RemoveAll(frame);
         frep_(i,N) {
             atf_unit::Dbl &elem = orig_Alloc(frame);
             switch(input) {
@@ -1948,12 +2032,31 @@ void atf_unit::unittest_algo_lib_PerfSort() {
             sorted_QuickSort(frame);
             u64 amc_cycles_elem = (get_cycles() - c)/N;
 
+            radix_RemoveAll(frame);
+            radix_Addary(frame, orig_Getary(frame));
+            c = get_cycles();
+            radix_RadixSort(frame);
+            u64 radix_cycles_elem = (get_cycles() - c)/N;
+
+            parallel_RemoveAll(frame);
+            parallel_Addary(frame, orig_Getary(frame));
+            c = get_cycles();
+            parallel_ParallelSort(frame);
+            u64 parallel_cycles_elem = (get_cycles() - c)/N;
+
+            // all sorts must agree
+            frep_(i,sorted_N(frame)) {
+                vrfyeq_(radix_qFind(frame,i).val, sorted_qFind(frame,i).val);
+                vrfyeq_(parallel_qFind(frame,i).val, sorted_qFind(frame,i).val);
+            }
             prlog("atf_unit.PerfSort"
                   <<Keyval("method",method)
                   <<Keyval("N",N)
                   <<Keyval("iteration",iter)
                   <<Keyval("stl_cycles_elem",stl_cycles_elem)
-                  <<Keyval("amc_cycles_elem",amc_cycles_elem));
+                  <<Keyval("amc_cycles_elem",amc_cycles_elem)
+                  <<Keyval("radix_cycles_elem",radix_cycles_elem)
+                  <<Keyval("parallel_cycles_elem",parallel_cycles_elem));
         }
     }
 }
@@ -2244,3 +2347,245 @@ void atf_unit::unittest_algo_lib_PrintWithCommas() {
     TestPrintWithCommas("2341234123412341234123412341234","2,341,234,123,412,341,234,123,412,341,234");
     TestPrintWithCommas("1.11111","1.11111");
 }
+
+// --------------------------------------------------------------------------------
+
+// Redirect stdout to a temp file, print lines through a buffered logbuf,
+// check that the output is intact and took few write calls.
+void atf_unit::unittest_algo_lib_PrlogBuffered() {
+    algo_lib::FlushLog();
+    algo_lib::FTempfile tempfile;
+    TempfileInitX(tempfile,"prlog");
+    int saved_fd = dup(1);
+    vrfy_(saved_fd != -1);
+    (void)dup2(tempfile.fildes.fd.value, 1);
+
+    algo_lib::FLogbuf &logbuf = algo_lib::logbuf_qFind(1);
+    i32 saved_lim = logbuf.flush_lim;
+    logbuf.flush_lim = 4096;
+    u64 n_write = logbuf.n_write;
+    int nline = 10000;
+    frep_(i,nline) {
+        prlog("line "<<i);
+    }
+    algo_lib::FlushLog();
+    u64 n_buffered_write = logbuf.n_write - n_write;
+
+    // unbuffered: every line is a write
+    logbuf.flush_lim = 0;
+    n_write = logbuf.n_write;
+    prlog("last");
+    u64 n_direct_write = logbuf.n_write - n_write;
+    logbuf.flush_lim = saved_lim;
+    (void)dup2(saved_fd, 1);
+    (void)close(saved_fd);
+
+    vrfyeq_(n_direct_write, u64(1));
+    vrfy_(n_buffered_write > 0 && n_buffered_write < u64(nline/100));
+    tempstr expect;
+    frep_(i,nline) {
+        expect << "line "<<i<<eol;
+    }
+    expect << "last" << eol;
+    vrfy_(FileToString(tempfile.filename) == expect);
+}
+
+// -----------------------------------------------------------------------------
+
+static tempstr TempstrNest(int depth) {
+    tempstr ret;
+    ret << "depth "<<depth;
+    if (depth > 0) {
+        ret << " " << TempstrNest(depth-1);
+    }
+    return ret;
+}
+
+// Check that tempstr buffers are recycled through the size-classed pool,
+// that a TempstrScope absorbs nesting deeper than the pool,
+// and that buffers over the size cap are not pooled.
+void atf_unit::unittest_algo_lib_TempstrPool() {
+    algo_lib::FTemppool &pool = algo_lib::_db.temppool;
+    report::tempstr &stats = pool.stats;
+    algo_lib::TempstrStatsEnable();
+    {
+        // warm up
+        tempstr big;
+        ch_Reserve(big, 64*1024);
+    }
+    u64 n_miss = stats.n_miss;
+    for (int i=0; i<1000; i++) {
+        tempstr str;
+        str << "iteration "<<i;
+    }
+    vrfy_(stats.n_miss == n_miss);
+    {
+        // the large buffer is handed out first
+        tempstr str;
+        vrfy_(ch_Max(str) >= 64*1024);
+    }
+    vrfy_(stats.peak_bytes >= stats.pool_bytes);
+    {
+        // too large to keep
+        u64 n_drop = stats.n_drop;
+        {
+            tempstr huge;
+            ch_Reserve(huge, 1024*1024);
+        }
+        vrfy_(stats.n_drop == n_drop + 1);
+        tempstr str;
+        vrfy_(ch_Max(str) < 1024*1024);
+    }
+
+    // nesting deeper than a size class holds: released buffers spill over
+    {
+        algo::TempstrScope scope;
+        vrfy_(ch_N(TempstrNest(20)) > 0);
+        u64 n_drop = stats.n_drop;
+        n_miss = stats.n_miss;
+        for (int i=0; i<100; i++) {
+            vrfy_(ch_N(TempstrNest(20)) > 0);
+        }
+        // spilled buffers are reused on subsequent passes
+        vrfy_(stats.n_miss == n_miss);
+        vrfy_(stats.n_drop == n_drop);
+        vrfy_(spill_N(pool) > 0);
+    }
+    vrfy_(spill_N(pool) == 0);
+}
+
+// -----------------------------------------------------------------------------
+
+static void *TempstrThread(void *arg) {
+    bool &ok = *(bool*)arg;
+    for (int i=0; i<10000; i++) {
+        algo::TempstrScope scope;
+        tempstr str;
+        str << TempstrNest(i % 20);
+        ok = ok && StartsWithQ(str, tempstr() << "depth " << (i % 20));
+    }
+    return NULL;
+}
+
+// Each thread has its own tempstr pool:
+// threads don't disturb each other or the main thread's pool
+void atf_unit::unittest_algo_lib_TempstrThread() {
+    algo_lib::FTemppool &pool = algo_lib::_db.temppool;
+    tempstr mark;
+    mark << "main";
+    u32 mask = pool.mask;
+    pthread_t thread[4];
+    bool ok[4];
+    for (int i=0; i<4; i++) {
+        ok[i] = true;
+        vrfy_(pthread_create(&thread[i], NULL, TempstrThread, &ok[i]) == 0);
+    }
+    for (int i=0; i<4; i++) {
+        pthread_join(thread[i], NULL);
+        vrfy_(ok[i]);
+    }
+    vrfy_(pool.mask == mask);
+    vrfy_(mark == "main");
+}
+
+// -----------------------------------------------------------------------------
+
+static int snap_ntext;
+static int snap_nrow;
+static i64 snap_sum;
+
+// Tuples "n:<num>" are recorded as row images, all others as text
+static bool SnapTestLoad(strptr str) {
+    snap_ntext++;
+    i64 val = 0;
+    if (StartsWithQ(str, "n:") && i64_ReadStrptrMaybe(val, RestFrom(str, 2))) {
+        snap_sum += val;
+        if (algo_lib::_db.snap_rec) {
+            algo_lib::SnapRecord(1, &val, sizeof(val));
+        }
+    } else if (algo_lib::_db.snap_rec) {
+        algo_lib::SnapRecord(-1, str.elems, elems_N(str));
+    }
+    return true;
+}
+
+static bool SnapTestRow(i32 table_id, algo::memptr row) {
+    i64 val = 0;
+    bool ok = table_id == 1 && elems_N(row) == i32(sizeof(val));
+    if (ok) {
+        memcpy(&val, row.elems, sizeof(val));
+        snap_sum += val;
+        snap_nrow++;
+    }
+    return ok;
+}
+
+static void SnapTestRun(strptr root, const char **ssimfiles) {
+    snap_ntext = 0;
+    snap_nrow = 0;
+    snap_sum = 0;
+    vrfy_(algo_lib::DoLoadTuplesSnap(root, "atf_unit_test", "sig", SnapTestLoad, SnapTestRow, ssimfiles, true));
+}
+
+// Snapshot file of namespace atf_unit_test for data set ROOT
+static tempstr SnapTestFname(strptr root) {
+    return tempstr() << "temp/atf_unit_test." << strptr_Hash(0, root) << ".ssimsnap";
+}
+
+// With -snap, a binary input snapshot is written after a text load, replaces the text load
+// while inputs are unchanged, and is discarded once an input file changes.
+// Each data set gets its own snapshot; without -snap, everything goes through text.
+void atf_unit::unittest_algo_lib_SsimSnapshot() {
+    strptr root = "temp/atf_unit_snap";
+    strptr root2 = "temp/atf_unit_snap2";
+    const char *ssimfiles[] = {"snap.a", "snap.b", NULL};
+    RemDirRecurse(root, true);
+    RemDirRecurse(root2, true);
+    CreateDirRecurse(tempstr() << root << "/snap");
+    CreateDirRecurse(tempstr() << root2 << "/snap");
+    (void)unlink(Zeroterm(SnapTestFname(root)));
+    (void)unlink(Zeroterm(SnapTestFname(root2)));
+    StringToFile("n:1\nn:20\ntext\n", SsimFname(root, "snap.a"));
+    StringToFile("n:300\n", SsimFname(root, "snap.b"));
+    StringToFile("n:5\n", SsimFname(root2, "snap.a"));
+
+    // snapshots are off by default
+    SnapTestRun(root, ssimfiles);
+    vrfyeq_(snap_ntext, 4);
+    vrfy_(!FileQ(SnapTestFname(root)));
+
+    algo_lib::_db.cmdline.snap = true;
+    SnapTestRun(root, ssimfiles);
+    vrfyeq_(snap_ntext, 4);
+    vrfyeq_(snap_sum, 321);
+    vrfy_(FileQ(SnapTestFname(root)));
+
+    // unchanged inputs: rows come from the snapshot, text tuple is reparsed
+    SnapTestRun(root, ssimfiles);
+    vrfyeq_(snap_nrow, 3);
+    vrfyeq_(snap_ntext, 1);
+    vrfyeq_(snap_sum, 321);
+
+    // another data set doesn't replace the first one's snapshot
+    SnapTestRun(root2, ssimfiles);
+    vrfyeq_(snap_sum, 5);
+    vrfy_(FileQ(SnapTestFname(root2)));
+    SnapTestRun(root, ssimfiles);
+    vrfyeq_(snap_nrow, 3);
+    vrfyeq_(snap_sum, 321);
+
+    // stale snapshot: text is loaded again and the snapshot rewritten
+    StringToFile("n:1\nn:20\ntext\nn:4000\n", SsimFname(root, "snap.a"));
+    SnapTestRun(root, ssimfiles);
+    vrfyeq_(snap_nrow, 0);
+    vrfyeq_(snap_sum, 4321);
+    SnapTestRun(root, ssimfiles);
+    vrfyeq_(snap_nrow, 4);
+    vrfyeq_(snap_sum, 4321);
+    algo_lib::_db.cmdline.snap = false;
+
+    RemDirRecurse(root, true);
+    RemDirRecurse(root2, true);
+    (void)unlink(Zeroterm(SnapTestFname(root)));
+    (void)unlink(Zeroterm(SnapTestFname(root2)));
+}
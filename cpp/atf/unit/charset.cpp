@@ -109,3 +109,93 @@ void atf_unit::unittest_algo_lib_Charset() {
         vrfy_(_LowerCharQ(i) == algo_lib::LowerCharQ(i));
     }
 }
+
+// -----------------------------------------------------------------------------
+
+static int FindFirstInCharsetScalar(strptr s, Charset &cs) {
+    rep_(i,elems_N(s)) {
+        if (ch_qGetBit(cs, u8(s.elems[i]))) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Compare SIMD charset search against a plain bit test,
+// for random charsets of varying density (including ones with >8 distinct nibble rows)
+void atf_unit::unittest_algo_lib_CharsetFindFirst() {
+    char buf[200];
+    rep_(iter,500) {
+        Charset cs;
+        int nbit = i32_WeakRandom(iter % 4 == 0 ? 128 : 8);
+        rep_(k,nbit) {
+            ch_qSetBit(cs, i32_WeakRandom(256));
+        }
+        algo::CharsetNibble nib;
+        CharsetNibble_Build(nib, cs);
+        rep_(i,256) {
+            char ch = char(i);
+            vrfy_(FindFirstInCharset(strptr(&ch,1), nib) == (ch_qGetBit(cs,i) ? 0 : -1));
+        }
+        rep_(k,int(sizeof(buf))) {
+            buf[k] = char(i32_WeakRandom(256));
+        }
+        rep_(from,40) {
+            strptr str(buf + from, i32_WeakRandom(int(sizeof(buf)) - from));
+            int expect = FindFirstInCharsetScalar(str, cs);
+            vrfy_(FindFirstInCharset(str, nib) == expect);
+            vrfy_(FindFirstInCharset(str, cs) == expect);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Throughput of ssim token scanning and tuple parsing over a large ssimfile
+void atf_unit::unittest_algo_lib_PerfCharsetScan() {
+    cstring text(FileToString("data/dmmeta/field.ssim"));
+    Charset &cs = algo_lib::_db.SsimBreakValue;
+    algo::CharsetNibble &nib = algo_lib::_db.SsimBreakValueNib;
+    int niter = 20;
+    u64 nbyte = u64(ch_N(text)) * niter;
+    u64 ntok_scalar = 0;
+    u64 ntok_simd = 0;
+    u64 c = algo::get_cycles();
+    rep_(iter,niter) {
+        strptr rest(text);
+        int i;
+        while ((i = FindFirstInCharsetScalar(rest, cs)) != -1) {
+            rest = RestFrom(rest, i + 1);
+            ntok_scalar++;
+        }
+    }
+    u64 scalar_cycles = algo::get_cycles() - c;
+    c = algo::get_cycles();
+    rep_(iter,niter) {
+        strptr rest(text);
+        int i;
+        while ((i = FindFirstInCharset(rest, nib)) != -1) {
+            rest = RestFrom(rest, i + 1);
+            ntok_simd++;
+        }
+    }
+    u64 simd_cycles = algo::get_cycles() - c;
+    vrfy_(ntok_scalar == ntok_simd);
+    c = algo::get_cycles();
+    u64 nattr = 0;
+    rep_(iter,niter) {
+        ind_beg(Line_curs,line,text) {
+            Tuple tuple;
+            if (Tuple_ReadStrptrMaybe(tuple, line)) {
+                nattr += attrs_N(tuple);
+            }
+        }ind_end;
+    }
+    u64 tuple_cycles = algo::get_cycles() - c;
+    prlog("charset scan"
+          <<Keyval("bytes",nbyte)
+          <<Keyval("scalar_cycles_per_byte",double(scalar_cycles)/nbyte)
+          <<Keyval("simd_cycles_per_byte",double(simd_cycles)/nbyte)
+          <<Keyval("tuple_cycles_per_byte",double(tuple_cycles)/nbyte)
+          <<Keyval("nattr",nattr));
+}
@@ -135,12 +135,71 @@ static void CheckFileLine4(strptr text, int nline, bool blocking) {
 
 // -----------------------------------------------------------------------------
 
+// Check that the mapped and the buffered (-nommap) modes of InTextFile return identical lines,
+// that mapped lines point into the mapping, that tiny read buffers (-linebuf) work,
+// and that a re-opened InTextFile selects its input mode again
+static void CheckFileLine5(strptr filename, strptr text, int nline) {
+    algo_lib::Cmdline saved = algo_lib::_db.cmdline;
+    rep_(bufsize,3) {
+        algo_lib::InTextFile mapped;
+        mapped.file.fd = OpenRead(filename);
+        algo_lib::InTextFile buffered;
+        buffered.file.fd = OpenRead(filename);
+        strptr line, line2;
+        algo_lib::_db.cmdline.nommap = false;
+        bool ok = ReadLine(mapped,line);// input mode is selected on first read
+        algo_lib::_db.cmdline.nommap = true;
+        algo_lib::_db.cmdline.linebuf = bufsize == 0 ? 1 : bufsize == 1 ? 7 : 1024*1024;
+        bool ok2 = ReadLine(buffered,line2);
+        algo_lib::_db.cmdline = saved;
+        int n=0;
+        strptr rest = text;
+        for (; ok; ok = ReadLine(mapped,line), ok2 = ReadLine(buffered,line2)) {
+            vrfy_(ok2);
+            vrfy_(line == line2);
+            vrfy_(FirstN(rest,line.n_elems)==line);
+            vrfy_(line.elems >= (char*)mapped.map.mem.elems
+                  && line.elems + line.n_elems <= (char*)mapped.map.mem.elems + mapped.map.mem.n_elems);
+            rest = TrimLeadingNewLine(RestFrom(rest,line.n_elems));
+            n++;
+        }
+        vrfy_(!ok2);
+        vrfy_(n==nline);
+        vrfy_(rest=="");
+        vrfy_(mapped.map.mem.elems != NULL || text.n_elems == 0);
+        vrfy_(buffered.map.mem.elems == NULL);
+        vrfy_(i32(buffered.temp_buf_max) <= i32_Max(buffered.bufsize,4));
+        // reuse the buffered reader for the same file: it is now mapped
+        algo_lib::InTextFile_Open(buffered, OpenRead(filename), true);
+        n=0;
+        for (strptr line3; ReadLine(buffered,line3); ) {
+            vrfy_(line3.elems >= (char*)buffered.map.mem.elems
+                  && line3.elems + line3.n_elems <= (char*)buffered.map.mem.elems + buffered.map.mem.n_elems);
+            n++;
+        }
+        vrfy_(n==nline);
+    }
+    if (text.n_elems > 2) {
+        // mapping starts at current file offset
+        algo_lib::InTextFile mapped;
+        mapped.file.fd = OpenRead(filename);
+        (void)lseek(mapped.file.fd.value, 2, SEEK_SET);
+        strptr line;
+        vrfy_(ReadLine(mapped,line));
+        vrfy_(FirstN(RestFrom(text,2),line.n_elems) == line);
+        vrfy_(lseek(mapped.file.fd.value, 0, SEEK_CUR) == text.n_elems);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 static void CheckFileLine(strptr filename, strptr text, int nline) {
     StringToFile(text,filename);
     static int nextfd = NextFd();
     CheckFileLine1(filename,text,nline);
     CheckFileLine2(filename,text,nline);
     CheckFileLine3(filename,text,nline);
+    CheckFileLine5(filename,text,nline);
     // pipe test is slow, don't waste minutes on it
     if (text.n_elems < 1000) {
         // blocking
@@ -164,6 +223,7 @@ void atf_unit::unittest_algo_lib_FileLine_curs() {
 
     CheckFileLine(tempfile.filename, "\r", 1);// doesn't count as newlnie
     CheckFileLine(tempfile.filename, "\r\n", 1);// doesn't count as newlnie
+    CheckFileLine(tempfile.filename, "a\r\nb\r\n\r\nc\r", 4);
 
     {
         // large line (but not too large)
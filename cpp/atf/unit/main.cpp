@@ -132,6 +132,7 @@ void atf_unit::Main() {
 
     if (atf_unit::_db.cmdline.debug) {
         Main_Debug();
+        algo_lib::FlushLog();
         _exit(0);
     }
 
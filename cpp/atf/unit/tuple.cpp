@@ -62,6 +62,29 @@ void atf_unit::unittest_algo_lib_Argtuple_ReadArgv() {
 
 // -----------------------------------------------------------------------------
 
+// Built-in option -linebuf takes its value as -linebuf:N or as -linebuf N
+void atf_unit::unittest_algo_lib_Argtuple_Linebuf() {
+    algo_lib::Cmdline saved = algo_lib::_db.cmdline;
+    const char *argv1[] = {"progname","-linebuf:7","abc"};
+    const char *argv2[] = {"progname","-linebuf","9","abc"};
+    Argtuple iter1;
+    Argtuple_ReadArgv(iter1, 3, (char**)argv1, " [str_fld1]:string=\"\"\n", "");
+    i32 linebuf1 = algo_lib::_db.cmdline.linebuf;
+    Argtuple iter2;
+    Argtuple_ReadArgv(iter2, 4, (char**)argv2, " [str_fld1]:string=\"\"\n", "");
+    i32 linebuf2 = algo_lib::_db.cmdline.linebuf;
+    algo_lib::_db.cmdline = saved;
+    atf_unit::TestArgtuple1 arg1, arg2;
+    TestArgtuple1_ReadTupleMaybe(arg1, iter1.tuple);
+    TestArgtuple1_ReadTupleMaybe(arg2, iter2.tuple);
+    vrfyeq_(linebuf1, 7);
+    vrfyeq_(linebuf2, 9);
+    vrfyeq_(arg1.str_fld1, "abc");
+    vrfyeq_(arg2.str_fld1, "abc");// the value is not taken as a positional argument
+}
+
+// -----------------------------------------------------------------------------
+
 void atf_unit::unittest_algo_lib_Argtuple_ReadStrptr() {
     atf_unit::TestArgtuple1 arg;
     TestArgtuple1_ReadStrptrMaybe(arg, "atf_unit.TestArgtuple1  \"blah\"  0.3  xyz:4 test2:56 x:Y");
@@ -142,3 +165,102 @@ void atf_unit::unittest_algo_lib_Tuple() {
     Set(R,"$T","A");
     vrfyeq_(algo_lib::Tuple_Subst(R,"a:b  $S:c  e:\"fff$Tzzz\""), "a:b  abc:c  e:fffAzzz");
 }
+
+// -----------------------------------------------------------------------------
+
+// Read tuple STR into UNITTEST attribute by attribute,
+// the way generated readers do when attributes are out of order
+static bool ReadUnittestGeneric(atfdb::Unittest &unittest, strptr str) {
+    bool retval = algo::StripTypeTag(str, "atfdb.unittest");
+    ind_beg(algo::Attr_curs, attr, str) {
+        retval = retval && Unittest_ReadFieldMaybe(unittest, attr.name, attr.value);
+    }ind_end;
+    return retval;
+}
+
+// Generated ssim reader must produce the same result as the generic
+// attribute loop, whether or not it can take the in-order path
+void atf_unit::unittest_algo_lib_SsimReadInorder() {
+    const char *lines[] = {
+        "atfdb.unittest  unittest:algo_lib.X  comment:\"some comment\""
+        , "atfdb.unittest  unittest:algo_lib.X  comment:plain"
+        , "atfdb.unittest unittest:'a.b'  comment:\"esc\\\"aped\\n\""
+        , "atfdb.unittest  comment:reversed  unittest:algo_lib.Y"
+        , "atfdb.unittest  unittest:algo_lib.X"
+        , "atfdb.unittest  unittest:algo_lib.X  comment:x  extra:1"
+        , "atfdb.unittest  unittest:algo_lib.X  comment:\"\"  # trailing comment"
+        , "atfdb.unittest  unittest:algo_lib.X  comment:\"unterminated"
+        , "atfdb.unittest  anonvalue  unittest:algo_lib.X  comment:x"
+        , "atfdb.unittest\tunittest:algo_lib.X\tcomment:\"tabs\"\t"
+        , "atfdb.unittest  unittest:algo_lib.X  comment:''"
+        , "atfdb.xyz  unittest:algo_lib.X  comment:x"
+        , NULL
+    };
+    for (int i=0; lines[i]; i++) {
+        atfdb::Unittest fast;
+        atfdb::Unittest generic;
+        bool fast_ok = Unittest_ReadStrptrMaybe(fast, lines[i]);
+        bool generic_ok = ReadUnittestGeneric(generic, lines[i]);
+        vrfy(fast_ok == generic_ok, tempstr()<<"line:"<<lines[i]);
+        vrfy(fast.unittest == generic.unittest, tempstr()<<"line:"<<lines[i]);
+        vrfy(fast.comment.value == generic.comment.value, tempstr()<<"line:"<<lines[i]);
+    }
+    // values without escapes are returned in place
+    algo::StringIter iter("  unittest:abc  comment:\"x y\"");
+    strptr value;
+    tempstr buf;
+    vrfy_(!algo::SsimAttrExpect(iter, "comment", value, buf));
+    vrfy_(algo::SsimAttrExpect(iter, "unittest", value, buf));
+    vrfyeq_(value, "abc");
+    vrfy_(value.elems > iter.expr.elems && value.elems < iter.expr.elems + elems_N(iter.expr));
+    vrfy_(algo::SsimAttrExpect(iter, "comment", value, buf));
+    vrfyeq_(value, "x y");
+    vrfyeq_(ch_N(buf), 0);
+    vrfy_(algo::SsimAttrEndQ(iter));
+}
+
+// -----------------------------------------------------------------------------
+
+// Compare generated ssim reader with the generic attribute loop.
+// Cost of line iteration and row construction is measured separately
+// and excluded from the reported speedup.
+void atf_unit::unittest_algo_lib_PerfSsimRead() {
+    cstring text(FileToString("data/atfdb/unittest.ssim"));
+    int niter = 1000;
+    u64 nline = 0;
+    u64 nfast = 0;
+    u64 ngeneric = 0;
+    u64 c = algo::get_cycles();
+    rep_(iter,niter) {
+        ind_beg(Line_curs,line,text) {
+            atfdb::Unittest unittest;
+            nline += elems_N(line) >= 0;
+        }ind_end;
+    }
+    u64 base_cycles = algo::get_cycles() - c;
+    c = algo::get_cycles();
+    rep_(iter,niter) {
+        ind_beg(Line_curs,line,text) {
+            atfdb::Unittest unittest;
+            nfast += Unittest_ReadStrptrMaybe(unittest, line);
+        }ind_end;
+    }
+    u64 fast_cycles = algo::get_cycles() - c;
+    c = algo::get_cycles();
+    rep_(iter,niter) {
+        ind_beg(Line_curs,line,text) {
+            atfdb::Unittest unittest;
+            ngeneric += ReadUnittestGeneric(unittest, line);
+        }ind_end;
+    }
+    u64 generic_cycles = algo::get_cycles() - c;
+    vrfyeq_(nfast, ngeneric);
+    i64 fast = i64(fast_cycles) - i64(base_cycles);
+    i64 generic = i64(generic_cycles) - i64(base_cycles);
+    prlog("ssim read"
+          <<Keyval("lines",nline)
+          <<Keyval("base_cycles",base_cycles)
+          <<Keyval("inorder_cycles",fast_cycles)
+          <<Keyval("generic_cycles",generic_cycles)
+          <<Keyval("speedup",double(generic)/i64_Max(fast,1)));
+}
@@ -35,35 +35,39 @@ namespace abt {
 const char *abt_help =
 "abt: Algo Build Tool (build system)\n"
 "Usage: abt [options]\n"
-"    [target]   string  Regx of target name\n"
-"    -in        string  Root of input ssim dir. default: \"data\"\n"
-"    -out_dir   string  Output directory\n"
-"    -cfg       string  Set config\n"
-"    -compiler  string  Set compiler.\n"
-"    -uname     string  Set uname (default: guess)\n"
-"    -arch      string  Set architecture (default: guess)\n"
-"    -ood               List out-of-date source files. default: false\n"
-"    -list              List target files. default: false\n"
-"    -listincl          List includes. default: false\n"
-"    -build             If set, build specified target (all necessary steps). default: false\n"
-"    -preproc           Preprocess file, produce .i file. default: false\n"
-"    -clean             Delete all output files. default: false\n"
-"    -dry_run           Print actions, do not perform. default: false\n"
-"    -maxjobs   int     Maximum number of child build processes. 0=pick good default. default: 0\n"
-"    -printcmd          Print commands. Do not execute. default: false\n"
-"    -force             Assume all files are out-of-date. default: false\n"
-"    -testgen           Run generator (amc) in test directory and report diff. default: false\n"
-"    -install           Update soft-link under bin/. default: false\n"
-"    -coverity          Run abt in coverity mode. default: false\n"
-"    -package   string  Package tag\n"
-"    -maxerr    int     Max failing commands before rest of pipeline is forced to fail. default: 100\n"
-"    -disas     string  Regex of function to disassemble\n"
-"    -report            Print final report. default: true\n"
-"    -verbose           Enable verbose mode\n"
-"    -debug             Enable debug mode\n"
-"    -version           Show version information\n"
-"    -sig               Print SHA1 signatures for dispatches\n"
-"    -help              Print this screen and exit\n"
+"    [target]     string  Regx of target name\n"
+"    -in          string  Root of input ssim dir. default: \"data\"\n"
+"    -out_dir     string  Output directory\n"
+"    -cfg         string  Set config\n"
+"    -compiler    string  Set compiler.\n"
+"    -uname       string  Set uname (default: guess)\n"
+"    -arch        string  Set architecture (default: guess)\n"
+"    -ood                 List out-of-date source files. default: false\n"
+"    -list                List target files. default: false\n"
+"    -listincl            List includes. default: false\n"
+"    -build               If set, build specified target (all necessary steps). default: false\n"
+"    -preproc             Preprocess file, produce .i file. default: false\n"
+"    -clean               Delete all output files. default: false\n"
+"    -dry_run             Print actions, do not perform. default: false\n"
+"    -maxjobs     int     Maximum number of child build processes. 0=pick good default. default: 0\n"
+"    -printcmd            Print commands. Do not execute. default: false\n"
+"    -force               Assume all files are out-of-date. default: false\n"
+"    -testgen             Run generator (amc) in test directory and report diff. default: false\n"
+"    -install             Update soft-link under bin/. default: false\n"
+"    -coverity            Run abt in coverity mode. default: false\n"
+"    -package     string  Package tag\n"
+"    -maxerr      int     Max failing commands before rest of pipeline is forced to fail. default: 100\n"
+"    -disas       string  Regex of function to disassemble\n"
+"    -report              Print final report. default: true\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -112,14 +116,16 @@ namespace abt {
     static bool          uname_InputMaybe(dev::Uname &elem) __attribute__((nothrow));
     static bool          compiler_InputMaybe(dev::Compiler &elem) __attribute__((nothrow));
     static bool          arch_InputMaybe(dev::Arch &elem) __attribute__((nothrow));
-    // Find new location for ROW starting at IDX
-    // NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
-    static int           bh_syscmd_Downheap(abt::FSyscmd& row, int idx) __attribute__((nothrow));
-    // Find and return index of new location for element ROW in the heap, starting at index IDX.
-    // Move any elements along the way but do not modify ROW.
-    static int           bh_syscmd_Upheap(abt::FSyscmd& row, int idx) __attribute__((nothrow));
+    // Find new location for heap element ELEM starting at IDX
+    // NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.
+    static int           bh_syscmd_Downheap(_db_bh_syscmd_elem elem, int idx) __attribute__((nothrow));
+    // Find and return index of new location for heap element ELEM, starting at index IDX.
+    // Move any elements along the way but do not store ELEM.
+    static int           bh_syscmd_Upheap(_db_bh_syscmd_elem elem, int idx) __attribute__((nothrow));
     static bool          bh_syscmd_ElemLt(abt::FSyscmd &a, abt::FSyscmd &b) __attribute__((nothrow));
     static void          _db_bh_syscmd_curs_Add(_db_bh_syscmd_curs &curs, abt::FSyscmd& row);
+    // Compare two heap elements (dmmeta.bheap heaps only)
+    static bool          bh_syscmd_HeapLt(_db_bh_syscmd_elem a, _db_bh_syscmd_elem b) __attribute__((nothrow));
     static bool          targsyslib_InputMaybe(dev::Targsyslib &elem) __attribute__((nothrow));
     static bool          syslib_InputMaybe(dev::Syslib &elem) __attribute__((nothrow));
     static bool          include_InputMaybe(dev::Include &elem) __attribute__((nothrow));
@@ -591,7 +597,8 @@ bool abt::tool_opt_XrefMaybe(abt::FToolOpt &row) {
 // --- abt.FDb.ind_target.Find
 // Find row by key. Return NULL if not found.
 abt::FTarget* abt::ind_target_Find(const algo::strptr& key) {
-    u32 index = Smallstr16_Hash(0, key) & (_db.ind_target_buckets_n - 1);
+    u32 hash  = Smallstr16_Hash(0, key);
+    u32 index = hash & (_db.ind_target_buckets_n - 1);
     abt::FTarget* *e = &_db.ind_target_buckets_elems[index];
     abt::FTarget* ret=NULL;
     do {
@@ -625,7 +632,8 @@ bool abt::ind_target_InsertMaybe(abt::FTarget& row) {
     ind_target_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_target_next == (abt::FTarget*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.target) & (_db.ind_target_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.target);
+        u32 index = hash & (_db.ind_target_buckets_n - 1);
         abt::FTarget* *prev = &_db.ind_target_buckets_elems[index];
         do {
             abt::FTarget* ret = *prev;
@@ -651,7 +659,8 @@ bool abt::ind_target_InsertMaybe(abt::FTarget& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_target_Remove(abt::FTarget& row) {
     if (LIKELY(row.ind_target_next != (abt::FTarget*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.target) & (_db.ind_target_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.target);
+        u32 index = hash & (_db.ind_target_buckets_n - 1);
         abt::FTarget* *prev = &_db.ind_target_buckets_elems[index]; // addr of pointer to current element
         while (abt::FTarget *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -810,7 +819,8 @@ bool abt::target_XrefMaybe(abt::FTarget &row) {
 // --- abt.FDb.ind_targsrc.Find
 // Find row by key. Return NULL if not found.
 abt::FTargsrc* abt::ind_targsrc_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_targsrc_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_targsrc_buckets_n - 1);
     abt::FTargsrc* *e = &_db.ind_targsrc_buckets_elems[index];
     abt::FTargsrc* ret=NULL;
     do {
@@ -844,7 +854,8 @@ bool abt::ind_targsrc_InsertMaybe(abt::FTargsrc& row) {
     ind_targsrc_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_targsrc_next == (abt::FTargsrc*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.targsrc) & (_db.ind_targsrc_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.targsrc);
+        u32 index = hash & (_db.ind_targsrc_buckets_n - 1);
         abt::FTargsrc* *prev = &_db.ind_targsrc_buckets_elems[index];
         do {
             abt::FTargsrc* ret = *prev;
@@ -870,7 +881,8 @@ bool abt::ind_targsrc_InsertMaybe(abt::FTargsrc& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_targsrc_Remove(abt::FTargsrc& row) {
     if (LIKELY(row.ind_targsrc_next != (abt::FTargsrc*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.targsrc) & (_db.ind_targsrc_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.targsrc);
+        u32 index = hash & (_db.ind_targsrc_buckets_n - 1);
         abt::FTargsrc* *prev = &_db.ind_targsrc_buckets_elems[index]; // addr of pointer to current element
         while (abt::FTargsrc *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1314,88 +1326,131 @@ bool abt::InsertStrptrMaybe(algo::strptr str) {
         case abt_TableId_dev_Targdep: { // finput:abt.FDb.targdep
             dev::Targdep elem;
             retval = dev::Targdep_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_Targdep, &elem, sizeof(elem));
+            }
             retval = retval && targdep_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_ToolOpt: { // finput:abt.FDb.tool_opt
             dev::ToolOpt elem;
             retval = dev::ToolOpt_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_ToolOpt, &elem, sizeof(elem));
+            }
             retval = retval && tool_opt_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Target: { // finput:abt.FDb.target
             dev::Target elem;
             retval = dev::Target_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_Target, &elem, sizeof(elem));
+            }
             retval = retval && target_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Targsrc: { // finput:abt.FDb.targsrc
             dev::Targsrc elem;
             retval = dev::Targsrc_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_Targsrc, &elem, sizeof(elem));
+            }
             retval = retval && targsrc_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Syscmddep: { // finput:abt.FDb.syscmddep
             dev::Syscmddep elem;
             retval = dev::Syscmddep_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_Syscmddep, &elem, sizeof(elem));
+            }
             retval = retval && syscmddep_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Syscmd: { // finput:abt.FDb.syscmd
             dev::Syscmd elem;
             retval = dev::Syscmd_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(-1, str.elems, elems_N(str));
+            }
             retval = retval && syscmd_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Cfg: { // finput:abt.FDb.cfg
             dev::Cfg elem;
             retval = dev::Cfg_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_Cfg, &elem, sizeof(elem));
+            }
             retval = retval && cfg_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Uname: { // finput:abt.FDb.uname
             dev::Uname elem;
             retval = dev::Uname_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_Uname, &elem, sizeof(elem));
+            }
             retval = retval && uname_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Compiler: { // finput:abt.FDb.compiler
             dev::Compiler elem;
             retval = dev::Compiler_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_Compiler, &elem, sizeof(elem));
+            }
             retval = retval && compiler_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Arch: { // finput:abt.FDb.arch
             dev::Arch elem;
             retval = dev::Arch_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_Arch, &elem, sizeof(elem));
+            }
             retval = retval && arch_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Targsyslib: { // finput:abt.FDb.targsyslib
             dev::Targsyslib elem;
             retval = dev::Targsyslib_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(-1, str.elems, elems_N(str));
+            }
             retval = retval && targsyslib_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Syslib: { // finput:abt.FDb.syslib
             dev::Syslib elem;
             retval = dev::Syslib_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_Syslib, &elem, sizeof(elem));
+            }
             retval = retval && syslib_InputMaybe(elem);
             break;
         }
         case abt_TableId_dev_Include: { // finput:abt.FDb.include
             dev::Include elem;
             retval = dev::Include_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dev_Include, &elem, sizeof(elem));
+            }
             retval = retval && include_InputMaybe(elem);
             break;
         }
         case abt_TableId_dmmeta_Ns: { // finput:abt.FDb.ns
             dmmeta::Ns elem;
             retval = dmmeta::Ns_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(abt_TableId_dmmeta_Ns, &elem, sizeof(elem));
+            }
             retval = retval && ns_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -1405,6 +1460,126 @@ bool abt::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- abt.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool abt::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case abt_TableId_dev_Targdep: { // finput:abt.FDb.targdep
+            dev::Targdep elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = targdep_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dev_ToolOpt: { // finput:abt.FDb.tool_opt
+            dev::ToolOpt elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = tool_opt_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dev_Target: { // finput:abt.FDb.target
+            dev::Target elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = target_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dev_Targsrc: { // finput:abt.FDb.targsrc
+            dev::Targsrc elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = targsrc_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dev_Syscmddep: { // finput:abt.FDb.syscmddep
+            dev::Syscmddep elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = syscmddep_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dev_Cfg: { // finput:abt.FDb.cfg
+            dev::Cfg elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = cfg_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dev_Uname: { // finput:abt.FDb.uname
+            dev::Uname elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = uname_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dev_Compiler: { // finput:abt.FDb.compiler
+            dev::Compiler elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = compiler_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dev_Arch: { // finput:abt.FDb.arch
+            dev::Arch elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = arch_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dev_Syslib: { // finput:abt.FDb.syslib
+            dev::Syslib elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = syslib_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dev_Include: { // finput:abt.FDb.include
+            dev::Include elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = include_InputMaybe(elem);
+            }
+            break;
+        }
+        case abt_TableId_dmmeta_Ns: { // finput:abt.FDb.ns
+            dmmeta::Ns elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ns_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- abt.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool abt::LoadTuplesMaybe(algo::strptr root) {
@@ -1414,7 +1589,8 @@ bool abt::LoadTuplesMaybe(algo::strptr root) {
         , "dev.syslib", "dev.target", "dev.targdep", "dev.targsrc"
         , "dev.targsyslib", "dev.tool_opt", "dev.uname"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, abt::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "abt", "74b970ebe53274a949865c248ef979af72de93bf"
+        , abt::InsertStrptrMaybe, abt::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -1439,7 +1615,8 @@ bool abt::_db_XrefMaybe() {
 // --- abt.FDb.ind_syscmd.Find
 // Find row by key. Return NULL if not found.
 abt::FSyscmd* abt::ind_syscmd_Find(i64 key) {
-    u32 index = i64_Hash(0, key) & (_db.ind_syscmd_buckets_n - 1);
+    u32 hash  = i64_Hash(0, key);
+    u32 index = hash & (_db.ind_syscmd_buckets_n - 1);
     abt::FSyscmd* *e = &_db.ind_syscmd_buckets_elems[index];
     abt::FSyscmd* ret=NULL;
     do {
@@ -1473,7 +1650,8 @@ bool abt::ind_syscmd_InsertMaybe(abt::FSyscmd& row) {
     ind_syscmd_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_syscmd_next == (abt::FSyscmd*)-1)) {// check if in hash already
-        u32 index = i64_Hash(0, row.syscmd) & (_db.ind_syscmd_buckets_n - 1);
+        u32 hash  = i64_Hash(0, row.syscmd);
+        u32 index = hash & (_db.ind_syscmd_buckets_n - 1);
         abt::FSyscmd* *prev = &_db.ind_syscmd_buckets_elems[index];
         do {
             abt::FSyscmd* ret = *prev;
@@ -1499,7 +1677,8 @@ bool abt::ind_syscmd_InsertMaybe(abt::FSyscmd& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_syscmd_Remove(abt::FSyscmd& row) {
     if (LIKELY(row.ind_syscmd_next != (abt::FSyscmd*)-1)) {// check if in hash already
-        u32 index = i64_Hash(0, row.syscmd) & (_db.ind_syscmd_buckets_n - 1);
+        u32 hash  = i64_Hash(0, row.syscmd);
+        u32 index = hash & (_db.ind_syscmd_buckets_n - 1);
         abt::FSyscmd* *prev = &_db.ind_syscmd_buckets_elems[index]; // addr of pointer to current element
         while (abt::FSyscmd *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1552,7 +1731,8 @@ void abt::ind_syscmd_Reserve(int n) {
 // --- abt.FDb.ind_running.Find
 // Find row by key. Return NULL if not found.
 abt::FSyscmd* abt::ind_running_Find(i32 key) {
-    u32 index = i32_Hash(0, key) & (_db.ind_running_buckets_n - 1);
+    u32 hash  = i32_Hash(0, key);
+    u32 index = hash & (_db.ind_running_buckets_n - 1);
     abt::FSyscmd* *e = &_db.ind_running_buckets_elems[index];
     abt::FSyscmd* ret=NULL;
     do {
@@ -1586,7 +1766,8 @@ bool abt::ind_running_InsertMaybe(abt::FSyscmd& row) {
     ind_running_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_running_next == (abt::FSyscmd*)-1)) {// check if in hash already
-        u32 index = i32_Hash(0, row.pid) & (_db.ind_running_buckets_n - 1);
+        u32 hash  = i32_Hash(0, row.pid);
+        u32 index = hash & (_db.ind_running_buckets_n - 1);
         abt::FSyscmd* *prev = &_db.ind_running_buckets_elems[index];
         do {
             abt::FSyscmd* ret = *prev;
@@ -1612,7 +1793,8 @@ bool abt::ind_running_InsertMaybe(abt::FSyscmd& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_running_Remove(abt::FSyscmd& row) {
     if (LIKELY(row.ind_running_next != (abt::FSyscmd*)-1)) {// check if in hash already
-        u32 index = i32_Hash(0, row.pid) & (_db.ind_running_buckets_n - 1);
+        u32 hash  = i32_Hash(0, row.pid);
+        u32 index = hash & (_db.ind_running_buckets_n - 1);
         abt::FSyscmd* *prev = &_db.ind_running_buckets_elems[index]; // addr of pointer to current element
         while (abt::FSyscmd *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1665,7 +1847,8 @@ void abt::ind_running_Reserve(int n) {
 // --- abt.FDb.ind_srcfile.Find
 // Find row by key. Return NULL if not found.
 abt::FSrcfile* abt::ind_srcfile_Find(const algo::strptr& key) {
-    u32 index = Smallstr200_Hash(0, key) & (_db.ind_srcfile_buckets_n - 1);
+    u32 hash  = Smallstr200_Hash(0, key);
+    u32 index = hash & (_db.ind_srcfile_buckets_n - 1);
     abt::FSrcfile* *e = &_db.ind_srcfile_buckets_elems[index];
     abt::FSrcfile* ret=NULL;
     do {
@@ -1699,7 +1882,8 @@ bool abt::ind_srcfile_InsertMaybe(abt::FSrcfile& row) {
     ind_srcfile_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_srcfile_next == (abt::FSrcfile*)-1)) {// check if in hash already
-        u32 index = Smallstr200_Hash(0, row.srcfile) & (_db.ind_srcfile_buckets_n - 1);
+        u32 hash  = Smallstr200_Hash(0, row.srcfile);
+        u32 index = hash & (_db.ind_srcfile_buckets_n - 1);
         abt::FSrcfile* *prev = &_db.ind_srcfile_buckets_elems[index];
         do {
             abt::FSrcfile* ret = *prev;
@@ -1725,7 +1909,8 @@ bool abt::ind_srcfile_InsertMaybe(abt::FSrcfile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_srcfile_Remove(abt::FSrcfile& row) {
     if (LIKELY(row.ind_srcfile_next != (abt::FSrcfile*)-1)) {// check if in hash already
-        u32 index = Smallstr200_Hash(0, row.srcfile) & (_db.ind_srcfile_buckets_n - 1);
+        u32 hash  = Smallstr200_Hash(0, row.srcfile);
+        u32 index = hash & (_db.ind_srcfile_buckets_n - 1);
         abt::FSrcfile* *prev = &_db.ind_srcfile_buckets_elems[index]; // addr of pointer to current element
         while (abt::FSrcfile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1875,7 +2060,8 @@ bool abt::cfg_XrefMaybe(abt::FCfg &row) {
 // --- abt.FDb.ind_cfg.Find
 // Find row by key. Return NULL if not found.
 abt::FCfg* abt::ind_cfg_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_cfg_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_cfg_buckets_n - 1);
     abt::FCfg* *e = &_db.ind_cfg_buckets_elems[index];
     abt::FCfg* ret=NULL;
     do {
@@ -1909,7 +2095,8 @@ bool abt::ind_cfg_InsertMaybe(abt::FCfg& row) {
     ind_cfg_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_cfg_next == (abt::FCfg*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.cfg) & (_db.ind_cfg_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.cfg);
+        u32 index = hash & (_db.ind_cfg_buckets_n - 1);
         abt::FCfg* *prev = &_db.ind_cfg_buckets_elems[index];
         do {
             abt::FCfg* ret = *prev;
@@ -1935,7 +2122,8 @@ bool abt::ind_cfg_InsertMaybe(abt::FCfg& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_cfg_Remove(abt::FCfg& row) {
     if (LIKELY(row.ind_cfg_next != (abt::FCfg*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.cfg) & (_db.ind_cfg_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.cfg);
+        u32 index = hash & (_db.ind_cfg_buckets_n - 1);
         abt::FCfg* *prev = &_db.ind_cfg_buckets_elems[index]; // addr of pointer to current element
         while (abt::FCfg *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2085,7 +2273,8 @@ bool abt::uname_XrefMaybe(abt::FUname &row) {
 // --- abt.FDb.ind_uname.Find
 // Find row by key. Return NULL if not found.
 abt::FUname* abt::ind_uname_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_uname_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_uname_buckets_n - 1);
     abt::FUname* *e = &_db.ind_uname_buckets_elems[index];
     abt::FUname* ret=NULL;
     do {
@@ -2119,7 +2308,8 @@ bool abt::ind_uname_InsertMaybe(abt::FUname& row) {
     ind_uname_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_uname_next == (abt::FUname*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.uname) & (_db.ind_uname_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.uname);
+        u32 index = hash & (_db.ind_uname_buckets_n - 1);
         abt::FUname* *prev = &_db.ind_uname_buckets_elems[index];
         do {
             abt::FUname* ret = *prev;
@@ -2145,7 +2335,8 @@ bool abt::ind_uname_InsertMaybe(abt::FUname& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_uname_Remove(abt::FUname& row) {
     if (LIKELY(row.ind_uname_next != (abt::FUname*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.uname) & (_db.ind_uname_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.uname);
+        u32 index = hash & (_db.ind_uname_buckets_n - 1);
         abt::FUname* *prev = &_db.ind_uname_buckets_elems[index]; // addr of pointer to current element
         while (abt::FUname *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2295,7 +2486,8 @@ bool abt::compiler_XrefMaybe(abt::FCompiler &row) {
 // --- abt.FDb.ind_compiler.Find
 // Find row by key. Return NULL if not found.
 abt::FCompiler* abt::ind_compiler_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_compiler_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_compiler_buckets_n - 1);
     abt::FCompiler* *e = &_db.ind_compiler_buckets_elems[index];
     abt::FCompiler* ret=NULL;
     do {
@@ -2329,7 +2521,8 @@ bool abt::ind_compiler_InsertMaybe(abt::FCompiler& row) {
     ind_compiler_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_compiler_next == (abt::FCompiler*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.compiler) & (_db.ind_compiler_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.compiler);
+        u32 index = hash & (_db.ind_compiler_buckets_n - 1);
         abt::FCompiler* *prev = &_db.ind_compiler_buckets_elems[index];
         do {
             abt::FCompiler* ret = *prev;
@@ -2355,7 +2548,8 @@ bool abt::ind_compiler_InsertMaybe(abt::FCompiler& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_compiler_Remove(abt::FCompiler& row) {
     if (LIKELY(row.ind_compiler_next != (abt::FCompiler*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.compiler) & (_db.ind_compiler_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.compiler);
+        u32 index = hash & (_db.ind_compiler_buckets_n - 1);
         abt::FCompiler* *prev = &_db.ind_compiler_buckets_elems[index]; // addr of pointer to current element
         while (abt::FCompiler *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2505,7 +2699,8 @@ bool abt::arch_XrefMaybe(abt::FArch &row) {
 // --- abt.FDb.ind_arch.Find
 // Find row by key. Return NULL if not found.
 abt::FArch* abt::ind_arch_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_arch_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_arch_buckets_n - 1);
     abt::FArch* *e = &_db.ind_arch_buckets_elems[index];
     abt::FArch* ret=NULL;
     do {
@@ -2539,7 +2734,8 @@ bool abt::ind_arch_InsertMaybe(abt::FArch& row) {
     ind_arch_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_arch_next == (abt::FArch*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.arch) & (_db.ind_arch_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.arch);
+        u32 index = hash & (_db.ind_arch_buckets_n - 1);
         abt::FArch* *prev = &_db.ind_arch_buckets_elems[index];
         do {
             abt::FArch* ret = *prev;
@@ -2565,7 +2761,8 @@ bool abt::ind_arch_InsertMaybe(abt::FArch& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_arch_Remove(abt::FArch& row) {
     if (LIKELY(row.ind_arch_next != (abt::FArch*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.arch) & (_db.ind_arch_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.arch);
+        u32 index = hash & (_db.ind_arch_buckets_n - 1);
         abt::FArch* *prev = &_db.ind_arch_buckets_elems[index]; // addr of pointer to current element
         while (abt::FArch *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2619,35 +2816,32 @@ void abt::ind_arch_Reserve(int n) {
 // Remove all elements from heap and free memory used by the array.
 void abt::bh_syscmd_Dealloc() {
     bh_syscmd_RemoveAll();
-    abt::lpool_FreeMem(_db.bh_syscmd_elems, sizeof(abt::FSyscmd*)*_db.bh_syscmd_max);
+    abt::lpool_FreeMem(_db.bh_syscmd_elems, sizeof(_db_bh_syscmd_elem)*_db.bh_syscmd_max);
     _db.bh_syscmd_max   = 0;
     _db.bh_syscmd_elems = NULL;
 }
 
 // --- abt.FDb.bh_syscmd.Downheap
-// Find new location for ROW starting at IDX
-// NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
-static int abt::bh_syscmd_Downheap(abt::FSyscmd& row, int idx) {
-    abt::FSyscmd* *elems = _db.bh_syscmd_elems;
+// Find new location for heap element ELEM starting at IDX
+// NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.
+static int abt::bh_syscmd_Downheap(_db_bh_syscmd_elem elem, int idx) {
+    _db_bh_syscmd_elem *elems = _db.bh_syscmd_elems;
     int n = _db.bh_syscmd_n;
-    int child = idx*2+1;
+    int child = idx*4+1;
     while (child < n) {
-        abt::FSyscmd* p = elems[child]; // left child
-        int rchild = child+1;
-        if (rchild < n) {
-            abt::FSyscmd* q = elems[rchild]; // right child
-            if (bh_syscmd_ElemLt(*q,*p)) {
-                child = rchild;
-                p     = q;
+        int lim = child+4 < n ? child+4 : n;
+        for (int i = child+1; i < lim; i++) { // pick smallest child
+            if (bh_syscmd_HeapLt(elems[i], elems[child])) {
+                child = i;
             }
         }
-        if (!bh_syscmd_ElemLt(*p,row)) {
+        if (!bh_syscmd_HeapLt(elems[child], elem)) {
             break;
         }
-        p->bh_syscmd_idx   = idx;
-        elems[idx]     = p;
-        idx            = child;
-        child          = idx*2+1;
+        elems[idx] = elems[child];
+        elems[idx].row->bh_syscmd_idx = idx;
+        idx        = child;
+        child      = idx*4+1;
     }
     return idx;
 }
@@ -2659,9 +2853,10 @@ void abt::bh_syscmd_Insert(abt::FSyscmd& row) {
         bh_syscmd_Reserve(1);
         int n = _db.bh_syscmd_n;
         _db.bh_syscmd_n = n + 1;
-        int new_idx = bh_syscmd_Upheap(row, n);
+        _db_bh_syscmd_elem elem = _db_bh_syscmd_elem(execkey_Get(row), &row);
+        int new_idx = bh_syscmd_Upheap(elem, n);
         row.bh_syscmd_idx = new_idx;
-        _db.bh_syscmd_elems[new_idx] = &row;
+        _db.bh_syscmd_elems[new_idx] = elem;
     }
 }
 
@@ -2675,12 +2870,13 @@ i32 abt::bh_syscmd_Reheap(abt::FSyscmd& row) {
         bh_syscmd_Reserve(1);
         old_idx = _db.bh_syscmd_n++;
     }
-    int new_idx = bh_syscmd_Upheap(row, old_idx);
+    _db_bh_syscmd_elem elem = _db_bh_syscmd_elem(execkey_Get(row), &row);
+    int new_idx = bh_syscmd_Upheap(elem, old_idx);
     if (!isnew && new_idx == old_idx) {
-        new_idx = bh_syscmd_Downheap(row, old_idx);
+        new_idx = bh_syscmd_Downheap(elem, old_idx);
     }
     row.bh_syscmd_idx = new_idx;
-    _db.bh_syscmd_elems[new_idx] = &row;
+    _db.bh_syscmd_elems[new_idx] = elem;
     return new_idx;
 }
 
@@ -2690,10 +2886,11 @@ i32 abt::bh_syscmd_Reheap(abt::FSyscmd& row) {
 // Return new position of item in the heap (0=top).
 // Heap must be non-empty or behavior is undefined.
 i32 abt::bh_syscmd_ReheapFirst() {
-    abt::FSyscmd &row = *_db.bh_syscmd_elems[0];
-    i32 new_idx = bh_syscmd_Downheap(row, 0);
+    abt::FSyscmd &row = *_db.bh_syscmd_elems[0].row;
+    _db_bh_syscmd_elem elem = _db_bh_syscmd_elem(execkey_Get(row), &row);
+    i32 new_idx = bh_syscmd_Downheap(elem, 0);
     row.bh_syscmd_idx = new_idx;
-    _db.bh_syscmd_elems[new_idx] = &row;
+    _db.bh_syscmd_elems[new_idx] = elem;
     return new_idx;
 }
 
@@ -2702,17 +2899,17 @@ i32 abt::bh_syscmd_ReheapFirst() {
 void abt::bh_syscmd_Remove(abt::FSyscmd& row) {
     if (bh_syscmd_InBheapQ(row)) {
         int old_idx = row.bh_syscmd_idx;
-        if (_db.bh_syscmd_elems[old_idx] == &row) { // sanity check: heap points back to row
+        if (&row == _db.bh_syscmd_elems[old_idx].row) { // sanity check: heap points back to row
             row.bh_syscmd_idx = -1;           // mark not in heap
             i32 n = _db.bh_syscmd_n - 1; // index of last element in heap
             _db.bh_syscmd_n = n;         // decrease count
             if (old_idx != n) {
-                abt::FSyscmd *elem = _db.bh_syscmd_elems[n];
-                int new_idx = bh_syscmd_Upheap(*elem, old_idx);
+                _db_bh_syscmd_elem elem = _db.bh_syscmd_elems[n];
+                int new_idx = bh_syscmd_Upheap(elem, old_idx);
                 if (new_idx == old_idx) {
-                    new_idx = bh_syscmd_Downheap(*elem, old_idx);
+                    new_idx = bh_syscmd_Downheap(elem, old_idx);
                 }
-                elem->bh_syscmd_idx = new_idx;
+                elem.row->bh_syscmd_idx = new_idx;
                 _db.bh_syscmd_elems[new_idx] = elem;
             }
         }
@@ -2724,7 +2921,7 @@ void abt::bh_syscmd_Remove(abt::FSyscmd& row) {
 void abt::bh_syscmd_RemoveAll() {
     int n = _db.bh_syscmd_n;
     for (int i = n - 1; i>=0; i--) {
-        _db.bh_syscmd_elems[i]->bh_syscmd_idx = -1; // mark not-in-heap
+        _db.bh_syscmd_elems[i].row->bh_syscmd_idx = -1; // mark not-in-heap
     }
     _db.bh_syscmd_n = 0;
 }
@@ -2735,15 +2932,15 @@ void abt::bh_syscmd_RemoveAll() {
 abt::FSyscmd* abt::bh_syscmd_RemoveFirst() {
     abt::FSyscmd *row = NULL;
     if (_db.bh_syscmd_n > 0) {
-        row = _db.bh_syscmd_elems[0];
+        row = _db.bh_syscmd_elems[0].row;
         row->bh_syscmd_idx = -1;           // mark not in heap
         i32 n = _db.bh_syscmd_n - 1; // index of last element in heap
         _db.bh_syscmd_n = n;         // decrease count
         if (n) {
-            abt::FSyscmd &elem = *_db.bh_syscmd_elems[n];
+            _db_bh_syscmd_elem elem = _db.bh_syscmd_elems[n];
             int new_idx = bh_syscmd_Downheap(elem, 0);
-            elem.bh_syscmd_idx = new_idx;
-            _db.bh_syscmd_elems[new_idx] = &elem;
+            elem.row->bh_syscmd_idx = new_idx;
+            _db.bh_syscmd_elems[new_idx] = elem;
         }
     }
     return row;
@@ -2755,30 +2952,29 @@ void abt::bh_syscmd_Reserve(int n) {
     i32 old_max = _db.bh_syscmd_max;
     if (UNLIKELY(_db.bh_syscmd_n + n > old_max)) {
         u32 new_max  = u32_Max(4, old_max * 2);
-        u32 old_size = old_max * sizeof(abt::FSyscmd*);
-        u32 new_size = new_max * sizeof(abt::FSyscmd*);
+        u32 old_size = old_max * sizeof(_db_bh_syscmd_elem);
+        u32 new_size = new_max * sizeof(_db_bh_syscmd_elem);
         void *new_mem = abt::lpool_ReallocMem(_db.bh_syscmd_elems, old_size, new_size);
         if (UNLIKELY(!new_mem)) {
             FatalErrorExit("abt.out_of_memory  field:abt.FDb.bh_syscmd");
         }
-        _db.bh_syscmd_elems = (abt::FSyscmd**)new_mem;
+        _db.bh_syscmd_elems = (_db_bh_syscmd_elem*)new_mem;
         _db.bh_syscmd_max = new_max;
     }
 }
 
 // --- abt.FDb.bh_syscmd.Upheap
-// Find and return index of new location for element ROW in the heap, starting at index IDX.
-// Move any elements along the way but do not modify ROW.
-static int abt::bh_syscmd_Upheap(abt::FSyscmd& row, int idx) {
-    abt::FSyscmd* *elems = _db.bh_syscmd_elems;
+// Find and return index of new location for heap element ELEM, starting at index IDX.
+// Move any elements along the way but do not store ELEM.
+static int abt::bh_syscmd_Upheap(_db_bh_syscmd_elem elem, int idx) {
+    _db_bh_syscmd_elem *elems = _db.bh_syscmd_elems;
     while (idx>0) {
-        int j = (idx-1)/2;
-        abt::FSyscmd* p = elems[j];
-        if (!bh_syscmd_ElemLt(row, *p)) {
+        int j = (idx-1)/4;
+        if (!bh_syscmd_HeapLt(elem, elems[j])) {
             break;
         }
-        p->bh_syscmd_idx = idx;
-        elems[idx] = p;
+        elems[idx] = elems[j];
+        elems[idx].row->bh_syscmd_idx = idx;
         idx = j;
     }
     return idx;
@@ -2790,6 +2986,13 @@ inline static bool abt::bh_syscmd_ElemLt(abt::FSyscmd &a, abt::FSyscmd &b) {
     return execkey_Get(a) < execkey_Get(b);
 }
 
+// --- abt.FDb.bh_syscmd.HeapLt
+// Compare two heap elements (dmmeta.bheap heaps only)
+inline static bool abt::bh_syscmd_HeapLt(_db_bh_syscmd_elem a, _db_bh_syscmd_elem b) {
+    (void)_db;
+    return a.key < b.key;
+}
+
 // --- abt.FDb.zs_srcfile_read.Insert
 // Insert row into linked list. If row is already in linked list, do nothing.
 void abt::zs_srcfile_read_Insert(abt::FSrcfile& row) {
@@ -3274,7 +3477,8 @@ bool abt::syslib_XrefMaybe(abt::FSyslib &row) {
 // --- abt.FDb.ind_syslib.Find
 // Find row by key. Return NULL if not found.
 abt::FSyslib* abt::ind_syslib_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_syslib_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_syslib_buckets_n - 1);
     abt::FSyslib* *e = &_db.ind_syslib_buckets_elems[index];
     abt::FSyslib* ret=NULL;
     do {
@@ -3308,7 +3512,8 @@ bool abt::ind_syslib_InsertMaybe(abt::FSyslib& row) {
     ind_syslib_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_syslib_next == (abt::FSyslib*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.syslib) & (_db.ind_syslib_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.syslib);
+        u32 index = hash & (_db.ind_syslib_buckets_n - 1);
         abt::FSyslib* *prev = &_db.ind_syslib_buckets_elems[index];
         do {
             abt::FSyslib* ret = *prev;
@@ -3334,7 +3539,8 @@ bool abt::ind_syslib_InsertMaybe(abt::FSyslib& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_syslib_Remove(abt::FSyslib& row) {
     if (LIKELY(row.ind_syslib_next != (abt::FSyslib*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.syslib) & (_db.ind_syslib_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.syslib);
+        u32 index = hash & (_db.ind_syslib_buckets_n - 1);
         abt::FSyslib* *prev = &_db.ind_syslib_buckets_elems[index]; // addr of pointer to current element
         while (abt::FSyslib *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -3502,7 +3708,8 @@ bool abt::include_XrefMaybe(abt::FInclude &row) {
 // --- abt.FDb.ind_include.Find
 // Find row by key. Return NULL if not found.
 abt::FInclude* abt::ind_include_Find(const algo::strptr& key) {
-    u32 index = Smallstr200_Hash(0, key) & (_db.ind_include_buckets_n - 1);
+    u32 hash  = Smallstr200_Hash(0, key);
+    u32 index = hash & (_db.ind_include_buckets_n - 1);
     abt::FInclude* *e = &_db.ind_include_buckets_elems[index];
     abt::FInclude* ret=NULL;
     do {
@@ -3536,7 +3743,8 @@ bool abt::ind_include_InsertMaybe(abt::FInclude& row) {
     ind_include_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_include_next == (abt::FInclude*)-1)) {// check if in hash already
-        u32 index = Smallstr200_Hash(0, row.include) & (_db.ind_include_buckets_n - 1);
+        u32 hash  = Smallstr200_Hash(0, row.include);
+        u32 index = hash & (_db.ind_include_buckets_n - 1);
         abt::FInclude* *prev = &_db.ind_include_buckets_elems[index];
         do {
             abt::FInclude* ret = *prev;
@@ -3562,7 +3770,8 @@ bool abt::ind_include_InsertMaybe(abt::FInclude& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_include_Remove(abt::FInclude& row) {
     if (LIKELY(row.ind_include_next != (abt::FInclude*)-1)) {// check if in hash already
-        u32 index = Smallstr200_Hash(0, row.include) & (_db.ind_include_buckets_n - 1);
+        u32 hash  = Smallstr200_Hash(0, row.include);
+        u32 index = hash & (_db.ind_include_buckets_n - 1);
         abt::FInclude* *prev = &_db.ind_include_buckets_elems[index]; // addr of pointer to current element
         while (abt::FInclude *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -3876,7 +4085,8 @@ bool abt::ns_XrefMaybe(abt::FNs &row) {
 // --- abt.FDb.ind_ns.Find
 // Find row by key. Return NULL if not found.
 abt::FNs* abt::ind_ns_Find(const algo::strptr& key) {
-    u32 index = Smallstr16_Hash(0, key) & (_db.ind_ns_buckets_n - 1);
+    u32 hash  = Smallstr16_Hash(0, key);
+    u32 index = hash & (_db.ind_ns_buckets_n - 1);
     abt::FNs* *e = &_db.ind_ns_buckets_elems[index];
     abt::FNs* ret=NULL;
     do {
@@ -3910,7 +4120,8 @@ bool abt::ind_ns_InsertMaybe(abt::FNs& row) {
     ind_ns_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ns_next == (abt::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         abt::FNs* *prev = &_db.ind_ns_buckets_elems[index];
         do {
             abt::FNs* ret = *prev;
@@ -3936,7 +4147,8 @@ bool abt::ind_ns_InsertMaybe(abt::FNs& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_ns_Remove(abt::FNs& row) {
     if (LIKELY(row.ind_ns_next != (abt::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         abt::FNs* *prev = &_db.ind_ns_buckets_elems[index]; // addr of pointer to current element
         while (abt::FNs *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -4075,7 +4287,8 @@ bool abt::filestat_XrefMaybe(abt::FFilestat &row) {
 // --- abt.FDb.ind_filestat.Find
 // Find row by key. Return NULL if not found.
 abt::FFilestat* abt::ind_filestat_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_filestat_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_filestat_buckets_n - 1);
     abt::FFilestat* *e = &_db.ind_filestat_buckets_elems[index];
     abt::FFilestat* ret=NULL;
     do {
@@ -4109,7 +4322,8 @@ bool abt::ind_filestat_InsertMaybe(abt::FFilestat& row) {
     ind_filestat_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_filestat_next == (abt::FFilestat*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.filename) & (_db.ind_filestat_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.filename);
+        u32 index = hash & (_db.ind_filestat_buckets_n - 1);
         abt::FFilestat* *prev = &_db.ind_filestat_buckets_elems[index];
         do {
             abt::FFilestat* ret = *prev;
@@ -4135,7 +4349,8 @@ bool abt::ind_filestat_InsertMaybe(abt::FFilestat& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void abt::ind_filestat_Remove(abt::FFilestat& row) {
     if (LIKELY(row.ind_filestat_next != (abt::FFilestat*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.filename) & (_db.ind_filestat_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.filename);
+        u32 index = hash & (_db.ind_filestat_buckets_n - 1);
         abt::FFilestat* *prev = &_db.ind_filestat_buckets_elems[index]; // addr of pointer to current element
         while (abt::FFilestat *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -4235,7 +4450,7 @@ void abt::_db_bh_syscmd_curs_Reset(_db_bh_syscmd_curs &curs, abt::FDb &parent) {
     _db_bh_syscmd_curs_Reserve(curs, bh_syscmd_N());
     curs.temp_n = 0;
     if (parent.bh_syscmd_n > 0) {
-        abt::FSyscmd &first = *parent.bh_syscmd_elems[0];
+        abt::FSyscmd &first = *parent.bh_syscmd_elems[0].row;
         curs.temp_elems[0] = &first; // insert first element in heap
         curs.temp_n = 1;
     }
@@ -4273,13 +4488,10 @@ void abt::_db_bh_syscmd_curs_Next(_db_bh_syscmd_curs &curs) {
         } while (i < n);
         curs.temp_n = n-1;
         int index = dead->bh_syscmd_idx;
-        i = (index*2+1);
-        if (i < bh_syscmd_N()) {
-            abt::FSyscmd &elem = *curs.parent->bh_syscmd_elems[i];
-            _db_bh_syscmd_curs_Add(curs, elem);
-        }
-        if (i+1 < bh_syscmd_N()) {
-            abt::FSyscmd &elem = *curs.parent->bh_syscmd_elems[i + 1];
+        i = (index*4+1);
+        int lim = i+4 < bh_syscmd_N() ? i+4 : bh_syscmd_N();
+        for (; i < lim; i++) {
+            abt::FSyscmd &elem = *curs.parent->bh_syscmd_elems[i].row;
             _db_bh_syscmd_curs_Add(curs, elem);
         }
     }
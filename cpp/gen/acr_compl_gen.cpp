@@ -31,15 +31,19 @@ namespace acr_compl {
 const char *acr_compl_help =
 "acr_compl: ACR shell auto-complete for all targets\n"
 "Usage: acr_compl [options]\n"
-"    -line     string  Simulates COMP_LINE (debug)\n"
-"    -point    string  Simulates COMP_POINT (debug). default: whole line\n"
-"    -type     string  Simulates COMP_TYPE (debug). default: \"9\"\n"
-"    -install          Produce bash commands to install the handler. default: false\n"
-"    -verbose          Enable verbose mode\n"
-"    -debug            Enable debug mode\n"
-"    -version          Show version information\n"
-"    -sig              Print SHA1 signatures for dispatches\n"
-"    -help             Print this screen and exit\n"
+"    -line        string  Simulates COMP_LINE (debug)\n"
+"    -point       string  Simulates COMP_POINT (debug). default: whole line\n"
+"    -type        string  Simulates COMP_TYPE (debug). default: \"9\"\n"
+"    -install             Produce bash commands to install the handler. default: false\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -508,34 +512,50 @@ bool acr_compl::InsertStrptrMaybe(algo::strptr str) {
         case acr_compl_TableId_dmmeta_Ctype: { // finput:acr_compl.FDb.ctype
             dmmeta::Ctype elem;
             retval = dmmeta::Ctype_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_compl_TableId_dmmeta_Ctype, &elem, sizeof(elem));
+            }
             retval = retval && ctype_InputMaybe(elem);
             break;
         }
         case acr_compl_TableId_dmmeta_Field: { // finput:acr_compl.FDb.field
             dmmeta::Field elem;
             retval = dmmeta::Field_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_compl_TableId_dmmeta_Field, &elem, sizeof(elem));
+            }
             retval = retval && field_InputMaybe(elem);
             break;
         }
         case acr_compl_TableId_dmmeta_Ssimfile: { // finput:acr_compl.FDb.ssimfile
             dmmeta::Ssimfile elem;
             retval = dmmeta::Ssimfile_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_compl_TableId_dmmeta_Ssimfile, &elem, sizeof(elem));
+            }
             retval = retval && ssimfile_InputMaybe(elem);
             break;
         }
         case acr_compl_TableId_dmmeta_Anonfld: { // finput:acr_compl.FDb.anonfld
             dmmeta::Anonfld elem;
             retval = dmmeta::Anonfld_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_compl_TableId_dmmeta_Anonfld, &elem, sizeof(elem));
+            }
             retval = retval && anonfld_InputMaybe(elem);
             break;
         }
         case acr_compl_TableId_dmmeta_Ns: { // finput:acr_compl.FDb.ns
             dmmeta::Ns elem;
             retval = dmmeta::Ns_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_compl_TableId_dmmeta_Ns, &elem, sizeof(elem));
+            }
             retval = retval && ns_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -545,6 +565,63 @@ bool acr_compl::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- acr_compl.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool acr_compl::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case acr_compl_TableId_dmmeta_Ctype: { // finput:acr_compl.FDb.ctype
+            dmmeta::Ctype elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ctype_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_compl_TableId_dmmeta_Field: { // finput:acr_compl.FDb.field
+            dmmeta::Field elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = field_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_compl_TableId_dmmeta_Ssimfile: { // finput:acr_compl.FDb.ssimfile
+            dmmeta::Ssimfile elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ssimfile_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_compl_TableId_dmmeta_Anonfld: { // finput:acr_compl.FDb.anonfld
+            dmmeta::Anonfld elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = anonfld_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_compl_TableId_dmmeta_Ns: { // finput:acr_compl.FDb.ns
+            dmmeta::Ns elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ns_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- acr_compl.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool acr_compl::LoadTuplesMaybe(algo::strptr root) {
@@ -553,7 +630,8 @@ bool acr_compl::LoadTuplesMaybe(algo::strptr root) {
         "dmmeta.ctype", "dmmeta.field", "dmmeta.anonfld", "dmmeta.ns"
         , "dmmeta.ssimfile"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, acr_compl::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "acr_compl", "870f0deeccaad257b35d181bf41a816ebc7258dc"
+        , acr_compl::InsertStrptrMaybe, acr_compl::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -764,7 +842,8 @@ bool acr_compl::ctype_XrefMaybe(acr_compl::FCtype &row) {
 // --- acr_compl.FDb.ind_ctype.Find
 // Find row by key. Return NULL if not found.
 acr_compl::FCtype* acr_compl::ind_ctype_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ctype_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ctype_buckets_n - 1);
     acr_compl::FCtype* *e = &_db.ind_ctype_buckets_elems[index];
     acr_compl::FCtype* ret=NULL;
     do {
@@ -798,7 +877,8 @@ bool acr_compl::ind_ctype_InsertMaybe(acr_compl::FCtype& row) {
     ind_ctype_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ctype_next == (acr_compl::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         acr_compl::FCtype* *prev = &_db.ind_ctype_buckets_elems[index];
         do {
             acr_compl::FCtype* ret = *prev;
@@ -824,7 +904,8 @@ bool acr_compl::ind_ctype_InsertMaybe(acr_compl::FCtype& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_compl::ind_ctype_Remove(acr_compl::FCtype& row) {
     if (LIKELY(row.ind_ctype_next != (acr_compl::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         acr_compl::FCtype* *prev = &_db.ind_ctype_buckets_elems[index]; // addr of pointer to current element
         while (acr_compl::FCtype *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -992,7 +1073,8 @@ bool acr_compl::field_XrefMaybe(acr_compl::FField &row) {
 // --- acr_compl.FDb.ind_field.Find
 // Find row by key. Return NULL if not found.
 acr_compl::FField* acr_compl::ind_field_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_field_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_field_buckets_n - 1);
     acr_compl::FField* *e = &_db.ind_field_buckets_elems[index];
     acr_compl::FField* ret=NULL;
     do {
@@ -1010,7 +1092,8 @@ bool acr_compl::ind_field_InsertMaybe(acr_compl::FField& row) {
     ind_field_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_field_next == (acr_compl::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         acr_compl::FField* *prev = &_db.ind_field_buckets_elems[index];
         do {
             acr_compl::FField* ret = *prev;
@@ -1036,7 +1119,8 @@ bool acr_compl::ind_field_InsertMaybe(acr_compl::FField& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_compl::ind_field_Remove(acr_compl::FField& row) {
     if (LIKELY(row.ind_field_next != (acr_compl::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         acr_compl::FField* *prev = &_db.ind_field_buckets_elems[index]; // addr of pointer to current element
         while (acr_compl::FField *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1204,7 +1288,8 @@ bool acr_compl::ssimfile_XrefMaybe(acr_compl::FSsimfile &row) {
 // --- acr_compl.FDb.ind_ssimfile.Find
 // Find row by key. Return NULL if not found.
 acr_compl::FSsimfile* acr_compl::ind_ssimfile_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ssimfile_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
     acr_compl::FSsimfile* *e = &_db.ind_ssimfile_buckets_elems[index];
     acr_compl::FSsimfile* ret=NULL;
     do {
@@ -1222,7 +1307,8 @@ bool acr_compl::ind_ssimfile_InsertMaybe(acr_compl::FSsimfile& row) {
     ind_ssimfile_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ssimfile_next == (acr_compl::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         acr_compl::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index];
         do {
             acr_compl::FSsimfile* ret = *prev;
@@ -1248,7 +1334,8 @@ bool acr_compl::ind_ssimfile_InsertMaybe(acr_compl::FSsimfile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_compl::ind_ssimfile_Remove(acr_compl::FSsimfile& row) {
     if (LIKELY(row.ind_ssimfile_next != (acr_compl::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         acr_compl::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index]; // addr of pointer to current element
         while (acr_compl::FSsimfile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
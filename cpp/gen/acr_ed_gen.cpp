@@ -33,52 +33,56 @@ namespace acr_ed {
 const char *acr_ed_help =
 "acr_ed: ACR Editor Set of useful recipes, uses acr, abt, git, and other tools\n"
 "Usage: acr_ed [options]\n"
-"    -in         string  Input directory or filename, - for stdin. default: \"data\"\n"
-"    -create             Create new entity (-finput, -target, -ctype, -field). default: false\n"
-"    -del                Delete mode. default: false\n"
-"    -rename     string  Rename to something else\n"
-"    -replace            Use acr -replace (default is -insert, fails on duplicate). default: false\n"
-"    -finput             Create in-memory table based on ssimfile. default: false\n"
-"    -srcfile    string      Create source file\n"
-"    -gstatic            Like -finput, but data is loaded at compile time. default: false\n"
-"    -indexed            (with -finput) Add hash index. default: false\n"
-"    -target     string  Create new target\n"
-"    -nstype     string  (with -create -target): exe,lib,etc.. default: \"exe\"\n"
-"    -ctype      string  Create new ctype\n"
-"    -pooltype   string   Pool reftype (Lary,Lpool etc) for finput/ctype\n"
-"    -ssimfile   string    Ssimfile for new ctype\n"
-"    -subset     string    Primary key is a subset of this ctype\n"
-"    -subset2    string    Primary key is also a subset of this ctype\n"
-"    -separator  string      Key separator. default: \".\"\n"
-"    -field      string  Create field\n"
-"    -arg        string    Field type (e.g. u32, etc)\n"
-"    -dflt       string    Field default value\n"
-"    -anon                 Anonymous field (use with command lines). default: false\n"
-"    -bigend               Big-endian field. default: false\n"
-"    -cascdel              Field is cascdel. default: false\n"
-"    -before     string    Place field before this one\n"
-"    -substr     string    New field is a substring\n"
-"    -srcfield   string    Source field for bitfld/substr\n"
-"    -fstep      string    Add fstep record\n"
-"    -inscond    string    Insert condition (for xref). default: \"true\"\n"
-"    -reftype    string    Reftype (e.g. Val, Thash, Llist, etc)\n"
-"    -hashfld    string      (-reftype:Thash) Hash field\n"
-"    -sortfld    string      (-reftype:Bheap) Sort field\n"
-"    -unittest   string  Create unit test, <ns>.<functionname>\n"
-"    -normcheck  string  Create normalization check\n"
-"    -cppfunc    string  Field is a cppfunc, pass c++ expression as argument\n"
-"    -xref                   X-ref with field type. default: false\n"
-"    -via        string        X-ref argument (index, pointer, or index/key)\n"
-"    -showcpp            Show resulting C++ code. default: false\n"
-"    -write              Commit output to disk. default: false\n"
-"    -e                   (with -create -unittest) Edit new testcase. default: false\n"
-"    -comment    string  Comment for new entity\n"
-"    -sandbox            Make changes in sandbox. default: false\n"
-"    -verbose            Enable verbose mode\n"
-"    -debug              Enable debug mode\n"
-"    -version            Show version information\n"
-"    -sig                Print SHA1 signatures for dispatches\n"
-"    -help               Print this screen and exit\n"
+"    -in          string  Input directory or filename, - for stdin. default: \"data\"\n"
+"    -create              Create new entity (-finput, -target, -ctype, -field). default: false\n"
+"    -del                 Delete mode. default: false\n"
+"    -rename      string  Rename to something else\n"
+"    -replace             Use acr -replace (default is -insert, fails on duplicate). default: false\n"
+"    -finput              Create in-memory table based on ssimfile. default: false\n"
+"    -srcfile     string      Create source file\n"
+"    -gstatic             Like -finput, but data is loaded at compile time. default: false\n"
+"    -indexed             (with -finput) Add hash index. default: false\n"
+"    -target      string  Create new target\n"
+"    -nstype      string  (with -create -target): exe,lib,etc.. default: \"exe\"\n"
+"    -ctype       string  Create new ctype\n"
+"    -pooltype    string   Pool reftype (Lary,Lpool etc) for finput/ctype\n"
+"    -ssimfile    string    Ssimfile for new ctype\n"
+"    -subset      string    Primary key is a subset of this ctype\n"
+"    -subset2     string    Primary key is also a subset of this ctype\n"
+"    -separator   string      Key separator. default: \".\"\n"
+"    -field       string  Create field\n"
+"    -arg         string    Field type (e.g. u32, etc)\n"
+"    -dflt        string    Field default value\n"
+"    -anon                  Anonymous field (use with command lines). default: false\n"
+"    -bigend                Big-endian field. default: false\n"
+"    -cascdel               Field is cascdel. default: false\n"
+"    -before      string    Place field before this one\n"
+"    -substr      string    New field is a substring\n"
+"    -srcfield    string    Source field for bitfld/substr\n"
+"    -fstep       string    Add fstep record\n"
+"    -inscond     string    Insert condition (for xref). default: \"true\"\n"
+"    -reftype     string    Reftype (e.g. Val, Thash, Llist, etc)\n"
+"    -hashfld     string      (-reftype:Thash) Hash field\n"
+"    -sortfld     string      (-reftype:Bheap) Sort field\n"
+"    -unittest    string  Create unit test, <ns>.<functionname>\n"
+"    -normcheck   string  Create normalization check\n"
+"    -cppfunc     string  Field is a cppfunc, pass c++ expression as argument\n"
+"    -xref                    X-ref with field type. default: false\n"
+"    -via         string        X-ref argument (index, pointer, or index/key)\n"
+"    -showcpp             Show resulting C++ code. default: false\n"
+"    -write               Commit output to disk. default: false\n"
+"    -e                    (with -create -unittest) Edit new testcase. default: false\n"
+"    -comment     string  Comment for new entity\n"
+"    -sandbox             Make changes in sandbox. default: false\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -377,7 +381,8 @@ bool acr_ed::ns_XrefMaybe(acr_ed::FNs &row) {
 // --- acr_ed.FDb.ind_ns.Find
 // Find row by key. Return NULL if not found.
 acr_ed::FNs* acr_ed::ind_ns_Find(const algo::strptr& key) {
-    u32 index = Smallstr16_Hash(0, key) & (_db.ind_ns_buckets_n - 1);
+    u32 hash  = Smallstr16_Hash(0, key);
+    u32 index = hash & (_db.ind_ns_buckets_n - 1);
     acr_ed::FNs* *e = &_db.ind_ns_buckets_elems[index];
     acr_ed::FNs* ret=NULL;
     do {
@@ -419,7 +424,8 @@ bool acr_ed::ind_ns_InsertMaybe(acr_ed::FNs& row) {
     ind_ns_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ns_next == (acr_ed::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         acr_ed::FNs* *prev = &_db.ind_ns_buckets_elems[index];
         do {
             acr_ed::FNs* ret = *prev;
@@ -445,7 +451,8 @@ bool acr_ed::ind_ns_InsertMaybe(acr_ed::FNs& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_ed::ind_ns_Remove(acr_ed::FNs& row) {
     if (LIKELY(row.ind_ns_next != (acr_ed::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         acr_ed::FNs* *prev = &_db.ind_ns_buckets_elems[index]; // addr of pointer to current element
         while (acr_ed::FNs *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -558,58 +565,86 @@ bool acr_ed::InsertStrptrMaybe(algo::strptr str) {
         case acr_ed_TableId_dmmeta_Ns: { // finput:acr_ed.FDb.ns
             dmmeta::Ns elem;
             retval = dmmeta::Ns_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_ed_TableId_dmmeta_Ns, &elem, sizeof(elem));
+            }
             retval = retval && ns_InputMaybe(elem);
             break;
         }
         case acr_ed_TableId_dmmeta_Field: { // finput:acr_ed.FDb.field
             dmmeta::Field elem;
             retval = dmmeta::Field_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_ed_TableId_dmmeta_Field, &elem, sizeof(elem));
+            }
             retval = retval && field_InputMaybe(elem);
             break;
         }
         case acr_ed_TableId_dmmeta_Ctype: { // finput:acr_ed.FDb.ctype
             dmmeta::Ctype elem;
             retval = dmmeta::Ctype_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_ed_TableId_dmmeta_Ctype, &elem, sizeof(elem));
+            }
             retval = retval && ctype_InputMaybe(elem);
             break;
         }
         case acr_ed_TableId_dmmeta_Ssimfile: { // finput:acr_ed.FDb.ssimfile
             dmmeta::Ssimfile elem;
             retval = dmmeta::Ssimfile_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_ed_TableId_dmmeta_Ssimfile, &elem, sizeof(elem));
+            }
             retval = retval && ssimfile_InputMaybe(elem);
             break;
         }
         case acr_ed_TableId_dmmeta_Cstr: { // finput:acr_ed.FDb.cstr
             dmmeta::Cstr elem;
             retval = dmmeta::Cstr_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_ed_TableId_dmmeta_Cstr, &elem, sizeof(elem));
+            }
             retval = retval && cstr_InputMaybe(elem);
             break;
         }
         case acr_ed_TableId_dmmeta_Listtype: { // finput:acr_ed.FDb.listtype
             dmmeta::Listtype elem;
             retval = dmmeta::Listtype_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_ed_TableId_dmmeta_Listtype, &elem, sizeof(elem));
+            }
             retval = retval && listtype_InputMaybe(elem);
             break;
         }
         case acr_ed_TableId_dmmeta_Fprefix: { // finput:acr_ed.FDb.fprefix
             dmmeta::Fprefix elem;
             retval = dmmeta::Fprefix_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_ed_TableId_dmmeta_Fprefix, &elem, sizeof(elem));
+            }
             retval = retval && fprefix_InputMaybe(elem);
             break;
         }
         case acr_ed_TableId_dev_Target: { // finput:acr_ed.FDb.target
             dev::Target elem;
             retval = dev::Target_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_ed_TableId_dev_Target, &elem, sizeof(elem));
+            }
             retval = retval && target_InputMaybe(elem);
             break;
         }
         case acr_ed_TableId_dev_Targsrc: { // finput:acr_ed.FDb.targsrc
             dev::Targsrc elem;
             retval = dev::Targsrc_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_ed_TableId_dev_Targsrc, &elem, sizeof(elem));
+            }
             retval = retval && targsrc_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -619,6 +654,99 @@ bool acr_ed::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- acr_ed.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool acr_ed::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case acr_ed_TableId_dmmeta_Ns: { // finput:acr_ed.FDb.ns
+            dmmeta::Ns elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ns_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_ed_TableId_dmmeta_Field: { // finput:acr_ed.FDb.field
+            dmmeta::Field elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = field_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_ed_TableId_dmmeta_Ctype: { // finput:acr_ed.FDb.ctype
+            dmmeta::Ctype elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ctype_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_ed_TableId_dmmeta_Ssimfile: { // finput:acr_ed.FDb.ssimfile
+            dmmeta::Ssimfile elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ssimfile_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_ed_TableId_dmmeta_Cstr: { // finput:acr_ed.FDb.cstr
+            dmmeta::Cstr elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = cstr_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_ed_TableId_dmmeta_Listtype: { // finput:acr_ed.FDb.listtype
+            dmmeta::Listtype elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = listtype_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_ed_TableId_dmmeta_Fprefix: { // finput:acr_ed.FDb.fprefix
+            dmmeta::Fprefix elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = fprefix_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_ed_TableId_dev_Target: { // finput:acr_ed.FDb.target
+            dev::Target elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = target_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_ed_TableId_dev_Targsrc: { // finput:acr_ed.FDb.targsrc
+            dev::Targsrc elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = targsrc_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- acr_ed.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool acr_ed::LoadTuplesMaybe(algo::strptr root) {
@@ -628,7 +756,8 @@ bool acr_ed::LoadTuplesMaybe(algo::strptr root) {
         , "dmmeta.fprefix", "dmmeta.listtype", "dmmeta.ssimfile", "dev.target"
         , "dev.targsrc"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, acr_ed::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "acr_ed", "4a62829eabcceb6a0156ada29e54841bfb759772"
+        , acr_ed::InsertStrptrMaybe, acr_ed::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -782,7 +911,8 @@ bool acr_ed::field_XrefMaybe(acr_ed::FField &row) {
 // --- acr_ed.FDb.ind_field.Find
 // Find row by key. Return NULL if not found.
 acr_ed::FField* acr_ed::ind_field_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_field_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_field_buckets_n - 1);
     acr_ed::FField* *e = &_db.ind_field_buckets_elems[index];
     acr_ed::FField* ret=NULL;
     do {
@@ -808,7 +938,8 @@ bool acr_ed::ind_field_InsertMaybe(acr_ed::FField& row) {
     ind_field_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_field_next == (acr_ed::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         acr_ed::FField* *prev = &_db.ind_field_buckets_elems[index];
         do {
             acr_ed::FField* ret = *prev;
@@ -834,7 +965,8 @@ bool acr_ed::ind_field_InsertMaybe(acr_ed::FField& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_ed::ind_field_Remove(acr_ed::FField& row) {
     if (LIKELY(row.ind_field_next != (acr_ed::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         acr_ed::FField* *prev = &_db.ind_field_buckets_elems[index]; // addr of pointer to current element
         while (acr_ed::FField *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -993,7 +1125,8 @@ bool acr_ed::ctype_XrefMaybe(acr_ed::FCtype &row) {
 // --- acr_ed.FDb.ind_ctype.Find
 // Find row by key. Return NULL if not found.
 acr_ed::FCtype* acr_ed::ind_ctype_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ctype_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ctype_buckets_n - 1);
     acr_ed::FCtype* *e = &_db.ind_ctype_buckets_elems[index];
     acr_ed::FCtype* ret=NULL;
     do {
@@ -1019,7 +1152,8 @@ bool acr_ed::ind_ctype_InsertMaybe(acr_ed::FCtype& row) {
     ind_ctype_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ctype_next == (acr_ed::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         acr_ed::FCtype* *prev = &_db.ind_ctype_buckets_elems[index];
         do {
             acr_ed::FCtype* ret = *prev;
@@ -1045,7 +1179,8 @@ bool acr_ed::ind_ctype_InsertMaybe(acr_ed::FCtype& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_ed::ind_ctype_Remove(acr_ed::FCtype& row) {
     if (LIKELY(row.ind_ctype_next != (acr_ed::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         acr_ed::FCtype* *prev = &_db.ind_ctype_buckets_elems[index]; // addr of pointer to current element
         while (acr_ed::FCtype *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1204,7 +1339,8 @@ bool acr_ed::ssimfile_XrefMaybe(acr_ed::FSsimfile &row) {
 // --- acr_ed.FDb.ind_ssimfile.Find
 // Find row by key. Return NULL if not found.
 acr_ed::FSsimfile* acr_ed::ind_ssimfile_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ssimfile_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
     acr_ed::FSsimfile* *e = &_db.ind_ssimfile_buckets_elems[index];
     acr_ed::FSsimfile* ret=NULL;
     do {
@@ -1230,7 +1366,8 @@ bool acr_ed::ind_ssimfile_InsertMaybe(acr_ed::FSsimfile& row) {
     ind_ssimfile_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ssimfile_next == (acr_ed::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         acr_ed::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index];
         do {
             acr_ed::FSsimfile* ret = *prev;
@@ -1256,7 +1393,8 @@ bool acr_ed::ind_ssimfile_InsertMaybe(acr_ed::FSsimfile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_ed::ind_ssimfile_Remove(acr_ed::FSsimfile& row) {
     if (LIKELY(row.ind_ssimfile_next != (acr_ed::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         acr_ed::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index]; // addr of pointer to current element
         while (acr_ed::FSsimfile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1597,7 +1735,8 @@ bool acr_ed::listtype_XrefMaybe(acr_ed::FListtype &row) {
 // --- acr_ed.FDb.ind_listtype.Find
 // Find row by key. Return NULL if not found.
 acr_ed::FListtype* acr_ed::ind_listtype_Find(const algo::strptr& key) {
-    u32 index = Smallstr5_Hash(0, key) & (_db.ind_listtype_buckets_n - 1);
+    u32 hash  = Smallstr5_Hash(0, key);
+    u32 index = hash & (_db.ind_listtype_buckets_n - 1);
     acr_ed::FListtype* *e = &_db.ind_listtype_buckets_elems[index];
     acr_ed::FListtype* ret=NULL;
     do {
@@ -1639,7 +1778,8 @@ bool acr_ed::ind_listtype_InsertMaybe(acr_ed::FListtype& row) {
     ind_listtype_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_listtype_next == (acr_ed::FListtype*)-1)) {// check if in hash already
-        u32 index = Smallstr5_Hash(0, row.listtype) & (_db.ind_listtype_buckets_n - 1);
+        u32 hash  = Smallstr5_Hash(0, row.listtype);
+        u32 index = hash & (_db.ind_listtype_buckets_n - 1);
         acr_ed::FListtype* *prev = &_db.ind_listtype_buckets_elems[index];
         do {
             acr_ed::FListtype* ret = *prev;
@@ -1665,7 +1805,8 @@ bool acr_ed::ind_listtype_InsertMaybe(acr_ed::FListtype& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_ed::ind_listtype_Remove(acr_ed::FListtype& row) {
     if (LIKELY(row.ind_listtype_next != (acr_ed::FListtype*)-1)) {// check if in hash already
-        u32 index = Smallstr5_Hash(0, row.listtype) & (_db.ind_listtype_buckets_n - 1);
+        u32 hash  = Smallstr5_Hash(0, row.listtype);
+        u32 index = hash & (_db.ind_listtype_buckets_n - 1);
         acr_ed::FListtype* *prev = &_db.ind_listtype_buckets_elems[index]; // addr of pointer to current element
         while (acr_ed::FListtype *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1815,7 +1956,8 @@ bool acr_ed::fprefix_XrefMaybe(acr_ed::FFprefix &row) {
 // --- acr_ed.FDb.ind_fprefix.Find
 // Find row by key. Return NULL if not found.
 acr_ed::FFprefix* acr_ed::ind_fprefix_Find(const algo::strptr& key) {
-    u32 index = Smallstr5_Hash(0, key) & (_db.ind_fprefix_buckets_n - 1);
+    u32 hash  = Smallstr5_Hash(0, key);
+    u32 index = hash & (_db.ind_fprefix_buckets_n - 1);
     acr_ed::FFprefix* *e = &_db.ind_fprefix_buckets_elems[index];
     acr_ed::FFprefix* ret=NULL;
     do {
@@ -1857,7 +1999,8 @@ bool acr_ed::ind_fprefix_InsertMaybe(acr_ed::FFprefix& row) {
     ind_fprefix_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_fprefix_next == (acr_ed::FFprefix*)-1)) {// check if in hash already
-        u32 index = Smallstr5_Hash(0, row.fprefix) & (_db.ind_fprefix_buckets_n - 1);
+        u32 hash  = Smallstr5_Hash(0, row.fprefix);
+        u32 index = hash & (_db.ind_fprefix_buckets_n - 1);
         acr_ed::FFprefix* *prev = &_db.ind_fprefix_buckets_elems[index];
         do {
             acr_ed::FFprefix* ret = *prev;
@@ -1883,7 +2026,8 @@ bool acr_ed::ind_fprefix_InsertMaybe(acr_ed::FFprefix& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_ed::ind_fprefix_Remove(acr_ed::FFprefix& row) {
     if (LIKELY(row.ind_fprefix_next != (acr_ed::FFprefix*)-1)) {// check if in hash already
-        u32 index = Smallstr5_Hash(0, row.fprefix) & (_db.ind_fprefix_buckets_n - 1);
+        u32 hash  = Smallstr5_Hash(0, row.fprefix);
+        u32 index = hash & (_db.ind_fprefix_buckets_n - 1);
         acr_ed::FFprefix* *prev = &_db.ind_fprefix_buckets_elems[index]; // addr of pointer to current element
         while (acr_ed::FFprefix *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2033,7 +2177,8 @@ bool acr_ed::target_XrefMaybe(acr_ed::FTarget &row) {
 // --- acr_ed.FDb.ind_target.Find
 // Find row by key. Return NULL if not found.
 acr_ed::FTarget* acr_ed::ind_target_Find(const algo::strptr& key) {
-    u32 index = Smallstr16_Hash(0, key) & (_db.ind_target_buckets_n - 1);
+    u32 hash  = Smallstr16_Hash(0, key);
+    u32 index = hash & (_db.ind_target_buckets_n - 1);
     acr_ed::FTarget* *e = &_db.ind_target_buckets_elems[index];
     acr_ed::FTarget* ret=NULL;
     do {
@@ -2075,7 +2220,8 @@ bool acr_ed::ind_target_InsertMaybe(acr_ed::FTarget& row) {
     ind_target_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_target_next == (acr_ed::FTarget*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.target) & (_db.ind_target_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.target);
+        u32 index = hash & (_db.ind_target_buckets_n - 1);
         acr_ed::FTarget* *prev = &_db.ind_target_buckets_elems[index];
         do {
             acr_ed::FTarget* ret = *prev;
@@ -2101,7 +2247,8 @@ bool acr_ed::ind_target_InsertMaybe(acr_ed::FTarget& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_ed::ind_target_Remove(acr_ed::FTarget& row) {
     if (LIKELY(row.ind_target_next != (acr_ed::FTarget*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.target) & (_db.ind_target_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.target);
+        u32 index = hash & (_db.ind_target_buckets_n - 1);
         acr_ed::FTarget* *prev = &_db.ind_target_buckets_elems[index]; // addr of pointer to current element
         while (acr_ed::FTarget *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -35,45 +35,55 @@ namespace acr {
 const char *acr_help =
 "acr: Algo Cross-Reference - ssimfile database & update tool\n"
 "Usage: acr [options]\n"
-"    [query]    string  Regx to match record\n"
-"    -select            Select records matching query (default). default: true\n"
-"    -del               Delete found item. default: false\n"
-"    -insert            Read input and insert tuples. default: false\n"
-"    -replace           Read stdin and replace tuples. default: false\n"
-"    -merge             Like replace, but merge tuple attributes. default: false\n"
-"    -unused            Only select records which are not referenced.. default: false\n"
-"    -trunc             (with insert or rename): truncate table on first write. default: false\n"
-"    -check             Run cross-reference check on selection. default: false\n"
-"    -maxshow   int     Limit number of errors per table. default: 100\n"
-"    -write             Write data back to disk.. default: false\n"
-"    -rename    string  Change value of found item\n"
-"    -nup       int     Number of levels to go up. default: 0\n"
-"    -ndown     int     Number of levels to go down. default: 0\n"
-"    -xref              Short for -nup 100 -ndown 100. default: false\n"
-"    -fldfunc           Evaluate fldfunc when printing tuple. default: false\n"
-"    -maxgroup  int     Max. items per group. default: 25\n"
-"    -pretty            Align output in blocks. default: true\n"
-"    -tree              Print as tree. default: false\n"
-"    -loose             Allow printing a record before its references (used with -e). default: false\n"
-"    -my                Invoke acr_my -e (using acr_my directly is faster). default: false\n"
-"    -schema    string  Directory for initializing acr meta-data. default: \"data\"\n"
-"    -e                 Open selection in editor, write back when done.. default: false\n"
-"    -b                 Short for -serve 0.0.0.0:6769; start browser.. default: false\n"
-"    -t                 Short for -tree -xref -loose. default: false\n"
-"    -rowid             Print/respect acr.rowid attribute. default: false\n"
-"    -in        string  Input directory or filename, - for stdin. default: \"data\"\n"
-"    -cmt               Print comments for all columns referenced in output. default: false\n"
-"    -report            Show final report. default: true\n"
-"    -print             Print selected records. default: true\n"
-"    -cmd       string  Print script with command execution for each selected row\n"
-"    -field     string  Comma-separated list of fields to select\n"
-"    -regxof    string  Single field: output regx of matching field values\n"
-"    -meta              Select meta-data for selected records. default: false\n"
-"    -verbose           Enable verbose mode\n"
-"    -debug             Enable debug mode\n"
-"    -version           Show version information\n"
-"    -sig               Print SHA1 signatures for dispatches\n"
-"    -help              Print this screen and exit\n"
+"    [query]      string  Regx to match record\n"
+"    -select              Select records matching query (default). default: true\n"
+"    -del                 Delete found item. default: false\n"
+"    -insert              Read input and insert tuples. default: false\n"
+"    -replace             Read stdin and replace tuples. default: false\n"
+"    -merge               Like replace, but merge tuple attributes. default: false\n"
+"    -unused              Only select records which are not referenced.. default: false\n"
+"    -trunc               (with insert or rename): truncate table on first write. default: false\n"
+"    -check               Run cross-reference check on selection. default: false\n"
+"    -maxshow     int     Limit number of errors per table. default: 100\n"
+"    -write               Write data back to disk.. default: false\n"
+"    -rename      string  Change value of found item\n"
+"    -nup         int     Number of levels to go up. default: 0\n"
+"    -ndown       int     Number of levels to go down. default: 0\n"
+"    -xref                Short for -nup 100 -ndown 100. default: false\n"
+"    -fldfunc             Evaluate fldfunc when printing tuple. default: false\n"
+"    -maxgroup    int     Max. items per group. default: 25\n"
+"    -pretty              Align output in blocks. default: true\n"
+"    -tree                Print as tree. default: false\n"
+"    -loose               Allow printing a record before its references (used with -e). default: false\n"
+"    -my                  Invoke acr_my -e (using acr_my directly is faster). default: false\n"
+"    -schema      string  Directory for initializing acr meta-data. default: \"data\"\n"
+"    -e                   Open selection in editor, write back when done.. default: false\n"
+"    -b                   Short for -serve 0.0.0.0:6769; start browser.. default: false\n"
+"    -t                   Short for -tree -xref -loose. default: false\n"
+"    -rowid               Print/respect acr.rowid attribute. default: false\n"
+"    -in          string  Input directory or filename, - for stdin. default: \"data\"\n"
+"    -cmt                 Print comments for all columns referenced in output. default: false\n"
+"    -report              Show final report. default: true\n"
+"    -print               Print selected records. default: true\n"
+"    -cmd         string  Print script with command execution for each selected row\n"
+"    -field       string  Comma-separated list of fields to select\n"
+"    -regxof      string  Single field: output regx of matching field values\n"
+"    -meta                Select meta-data for selected records. default: false\n"
+"    -nthread     int     Number of threads for loading and checking ssimfiles (0=one per core). default: 0\n"
+"    -lazy                Load records by primary key when possible (uses sidecar index in temp/acr_pkey). default: false\n"
+"    -changed             With -check: only check ssimfiles changed since last successful check. default: false\n"
+"    -serve       string  Serve queries on this Unix socket, keeping the data set in memory\n"
+"    -server      string  Socket of query server to use when one is running\n"
+"    -stats               Print statistics (report.acr_query) for each query. default: false\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -112,6 +122,12 @@ const char *acr_syntax =
 " -field:string=\n"
 " -regxof:string=\n"
 " -meta:flag\n"
+" -nthread:int=0\n"
+" -lazy:flag\n"
+" -changed:flag\n"
+" -serve:string=\n"
+" -server:string=\n"
+" -stats:flag\n"
 ;
 } // namespace acr
 acr::_db_bh_pline_curs::~_db_bh_pline_curs() {
@@ -125,6 +141,8 @@ acr::_db_bh_ctype_topo_curs::~_db_bh_ctype_topo_curs() {
 }
 
 namespace acr {
+    // Extract next character from STR and advance IDX
+    static int           value_Nextchar(const acr::FAttrval& attrval, strptr &str, int &idx) __attribute__((nothrow));
     static bool          ctype_InputMaybe(dmmeta::Ctype &elem) __attribute__((nothrow));
     static bool          anonfld_InputMaybe(dmmeta::Anonfld &elem) __attribute__((nothrow));
     static bool          cdflt_InputMaybe(dmmeta::Cdflt &elem) __attribute__((nothrow));
@@ -158,6 +176,43 @@ namespace acr {
     static algo::ImrowPtr trace_RowidFind(int t) __attribute__((nothrow));
     // Function return 1
     static i32           trace_N() __attribute__((__warn_unused_result__, nothrow, pure));
+    // Returns the child that has greater height.
+    static acr::FAttrval* tr_attrval_TallerChild(acr::FAttrval& node) __attribute__((nothrow));
+    // Disconnects the subtree(branch) from the parent
+    static void          tr_attrval_Disconnect(acr::FAttrval& node) __attribute__((nothrow));
+    static bool          tr_attrval_ElemLt(acr::FField& field, acr::FAttrval &a, acr::FAttrval &b) __attribute__((nothrow));
+    static void          tr_attrval_updateDepth(acr::FAttrval& node) __attribute__((nothrow));
+    // rotates the tree in from->to direction
+    static void          tr_attrval_Turn(acr::FAttrval& from, acr::FAttrval& to) __attribute__((nothrow));
+    static void          tr_attrval_Connect(acr::FAttrval* parent, acr::FAttrval* child, bool left) __attribute__((nothrow));
+    // Swap values elem_a and elem_b
+    static void          ent_Swap(acr::FPkeyent &elem_a, acr::FPkeyent &elem_b) __attribute__((nothrow));
+    // Left circular shift of three-tuple
+    static void          ent_Rotleft(acr::FPkeyent &elem_a, acr::FPkeyent &elem_b, acr::FPkeyent &elem_c) __attribute__((nothrow));
+    // Compare values elem_a and elem_b
+    // The comparison function must be anti-symmetric: if a>b, then !(b>a).
+    // If not, mayhem results.
+    static bool          ent_Lt(acr::FPkeyent &elem_a, acr::FPkeyent &elem_b) __attribute__((nothrow));
+    // Internal insertion sort
+    static void          ent_IntInsertionSort(acr::FPkeyent *elems, int n) __attribute__((nothrow));
+    // Internal heap sort
+    static void          ent_IntHeapSort(acr::FPkeyent *elems, int n) __attribute__((nothrow));
+    // Quick sort engine
+    static void          ent_IntQuickSort(acr::FPkeyent *elems, int n, int depth) __attribute__((nothrow));
+    // Swap values elem_a and elem_b
+    static void          c_ctype_Swap(acr::FCtype* &elem_a, acr::FCtype* &elem_b) __attribute__((nothrow));
+    // Left circular shift of three-tuple
+    static void          c_ctype_Rotleft(acr::FCtype* &elem_a, acr::FCtype* &elem_b, acr::FCtype* &elem_c) __attribute__((nothrow));
+    // Compare values elem_a and elem_b
+    // The comparison function must be anti-symmetric: if a>b, then !(b>a).
+    // If not, mayhem results.
+    static bool          c_ctype_Lt(acr::FCtype &elem_a, acr::FCtype &elem_b) __attribute__((nothrow));
+    // Internal insertion sort
+    static void          c_ctype_IntInsertionSort(acr::FCtype* *elems, int n) __attribute__((nothrow));
+    // Internal heap sort
+    static void          c_ctype_IntHeapSort(acr::FCtype* *elems, int n) __attribute__((nothrow));
+    // Quick sort engine
+    static void          c_ctype_IntQuickSort(acr::FCtype* *elems, int n, int depth) __attribute__((nothrow));
     // Swap values elem_a and elem_b
     static void          c_cmtrec_Swap(acr::FRec* &elem_a, acr::FRec* &elem_b) __attribute__((nothrow));
     // Left circular shift of three-tuple
@@ -217,86 +272,59 @@ void acr::anonfld_CopyIn(acr::FAnonfld &row, dmmeta::Anonfld &in) {
     // comment stripped, see dmmeta.fbase:acr.FAnonfld.base
 }
 
-// --- acr.FBltin.base.CopyIn
-// Copy fields in to row
-void acr::bltin_CopyIn(acr::FBltin &row, amcdb::Bltin &in) {
-    row.ctype = in.ctype;
-    row.likeu64 = in.likeu64;
-    row.bigendok = in.bigendok;
-    row.issigned = in.issigned;
-    // comment stripped, see dmmeta.fbase:acr.FBltin.base
-}
-
-// --- acr.FBltin..Uninit
-void acr::FBltin_Uninit(acr::FBltin& bltin) {
-    acr::FBltin &row = bltin; (void)row;
-    acr::FCtype* p_ctype = acr::ind_ctype_Find(row.ctype);
-    if (p_ctype)  {
-        c_bltin_Remove(*p_ctype, row);// remove bltin from index c_bltin
-    }
-}
-
-// --- acr.FCdflt.base.CopyIn
-// Copy fields in to row
-void acr::cdflt_CopyIn(acr::FCdflt &row, dmmeta::Cdflt &in) {
-    row.ctype = in.ctype;
-    row.dflt = in.dflt;
-    row.cppdflt = in.cppdflt;
-    row.ssimdflt = in.ssimdflt;
-    // comment stripped, see dmmeta.fbase:acr.FCdflt.base
-}
-
-// --- acr.FCdflt..Uninit
-void acr::FCdflt_Uninit(acr::FCdflt& cdflt) {
-    acr::FCdflt &row = cdflt; (void)row;
-    acr::FCtype* p_ctype = acr::ind_ctype_Find(row.ctype);
-    if (p_ctype)  {
-        c_cdflt_Remove(*p_ctype, row);// remove cdflt from index c_cdflt
-    }
+// --- acr.FAttrval.value.Nextchar
+// Extract next character from STR and advance IDX
+inline static int acr::value_Nextchar(const acr::FAttrval& attrval, strptr &str, int &idx) {
+    (void)attrval;
+    int i = idx;
+    int ch = str.elems[i];
+    i++;
+    idx = i;
+    return ch;
 }
 
-// --- acr.FCheck.c_bad_rec.Insert
+// --- acr.FAttrval.c_rec.Insert
 // Insert pointer to row into array. Row must not already be in array.
 // If pointer is already in the array, it may be inserted twice.
-void acr::c_bad_rec_Insert(acr::FCheck& check, acr::FRec& row) {
+void acr::c_rec_Insert(acr::FAttrval& attrval, acr::FRec& row) {
     // reserve space
-    c_bad_rec_Reserve(check, 1);
-    u32 n  = check.c_bad_rec_n;
+    c_rec_Reserve(attrval, 1);
+    u32 n  = attrval.c_rec_n;
     u32 at = n;
-    acr::FRec* *elems = check.c_bad_rec_elems;
+    acr::FRec* *elems = attrval.c_rec_elems;
     elems[at] = &row;
-    check.c_bad_rec_n = n+1;
+    attrval.c_rec_n = n+1;
 
 }
 
-// --- acr.FCheck.c_bad_rec.ScanInsertMaybe
+// --- acr.FAttrval.c_rec.ScanInsertMaybe
 // Insert pointer to row in array.
 // If row is already in the array, do nothing.
 // Linear search is used to locate the element.
 // Return value: whether element was inserted into array.
-bool acr::c_bad_rec_ScanInsertMaybe(acr::FCheck& check, acr::FRec& row) {
+bool acr::c_rec_ScanInsertMaybe(acr::FAttrval& attrval, acr::FRec& row) {
     bool retval = true;
-    u32 n  = check.c_bad_rec_n;
+    u32 n  = attrval.c_rec_n;
     for (u32 i = 0; i < n; i++) {
-        if (check.c_bad_rec_elems[i] == &row) {
+        if (attrval.c_rec_elems[i] == &row) {
             retval = false;
             break;
         }
     }
     if (retval) {
         // reserve space
-        c_bad_rec_Reserve(check, 1);
-        check.c_bad_rec_elems[n] = &row;
-        check.c_bad_rec_n = n+1;
+        c_rec_Reserve(attrval, 1);
+        attrval.c_rec_elems[n] = &row;
+        attrval.c_rec_n = n+1;
     }
     return retval;
 }
 
-// --- acr.FCheck.c_bad_rec.Remove
+// --- acr.FAttrval.c_rec.Remove
 // Find element using linear scan. If element is in array, remove, otherwise do nothing
-void acr::c_bad_rec_Remove(acr::FCheck& check, acr::FRec& row) {
-    int lim = check.c_bad_rec_n;
-    acr::FRec* *elems = check.c_bad_rec_elems;
+void acr::c_rec_Remove(acr::FAttrval& attrval, acr::FRec& row) {
+    int lim = attrval.c_rec_n;
+    acr::FRec* *elems = attrval.c_rec_elems;
     // search backward, so that most recently added element is found first.
     // if found, shift array.
     for (int i = lim-1; i>=0; i--) {
@@ -305,26 +333,79 @@ void acr::c_bad_rec_Remove(acr::FCheck& check, acr::FRec& row) {
             int j = i + 1;
             size_t nbytes = sizeof(acr::FRec*) * (lim - j);
             memmove(elems + i, elems + j, nbytes);
-            check.c_bad_rec_n = lim - 1;
+            attrval.c_rec_n = lim - 1;
             break;
         }
     }
 }
 
-// --- acr.FCheck.c_bad_rec.Reserve
+// --- acr.FAttrval.c_rec.Reserve
 // Reserve space in index for N more elements;
-void acr::c_bad_rec_Reserve(acr::FCheck& check, u32 n) {
-    u32 old_max = check.c_bad_rec_max;
-    if (UNLIKELY(check.c_bad_rec_n + n > old_max)) {
+void acr::c_rec_Reserve(acr::FAttrval& attrval, u32 n) {
+    u32 old_max = attrval.c_rec_max;
+    if (UNLIKELY(attrval.c_rec_n + n > old_max)) {
         u32 new_max  = u32_Max(4, old_max * 2);
         u32 old_size = old_max * sizeof(acr::FRec*);
         u32 new_size = new_max * sizeof(acr::FRec*);
-        void *new_mem = algo_lib::malloc_ReallocMem(check.c_bad_rec_elems, old_size, new_size);
+        void *new_mem = algo_lib::malloc_ReallocMem(attrval.c_rec_elems, old_size, new_size);
         if (UNLIKELY(!new_mem)) {
-            FatalErrorExit("acr.out_of_memory  field:acr.FCheck.c_bad_rec");
+            FatalErrorExit("acr.out_of_memory  field:acr.FAttrval.c_rec");
         }
-        check.c_bad_rec_elems = (acr::FRec**)new_mem;
-        check.c_bad_rec_max = new_max;
+        attrval.c_rec_elems = (acr::FRec**)new_mem;
+        attrval.c_rec_max = new_max;
+    }
+}
+
+// --- acr.FAttrval..Uninit
+void acr::FAttrval_Uninit(acr::FAttrval& attrval) {
+    acr::FAttrval &row = attrval; (void)row;
+    acr::FField* p_p_field = row.p_field;
+    if (p_p_field)  {
+        ind_attrval_Remove(*p_p_field, row);// remove attrval from index ind_attrval
+    }
+    if (p_p_field)  {
+        tr_attrval_Remove(*p_p_field, row);// remove attrval from index tr_attrval
+    }
+
+    // acr.FAttrval.c_rec.Uninit (Ptrary)  //Records with this value, in zd_trec order
+    algo_lib::malloc_FreeMem(attrval.c_rec_elems, sizeof(acr::FRec*)*attrval.c_rec_max); // (acr.FAttrval.c_rec)
+}
+
+// --- acr.FBltin.base.CopyIn
+// Copy fields in to row
+void acr::bltin_CopyIn(acr::FBltin &row, amcdb::Bltin &in) {
+    row.ctype = in.ctype;
+    row.likeu64 = in.likeu64;
+    row.bigendok = in.bigendok;
+    row.issigned = in.issigned;
+    // comment stripped, see dmmeta.fbase:acr.FBltin.base
+}
+
+// --- acr.FBltin..Uninit
+void acr::FBltin_Uninit(acr::FBltin& bltin) {
+    acr::FBltin &row = bltin; (void)row;
+    acr::FCtype* p_ctype = acr::ind_ctype_Find(row.ctype);
+    if (p_ctype)  {
+        c_bltin_Remove(*p_ctype, row);// remove bltin from index c_bltin
+    }
+}
+
+// --- acr.FCdflt.base.CopyIn
+// Copy fields in to row
+void acr::cdflt_CopyIn(acr::FCdflt &row, dmmeta::Cdflt &in) {
+    row.ctype = in.ctype;
+    row.dflt = in.dflt;
+    row.cppdflt = in.cppdflt;
+    row.ssimdflt = in.ssimdflt;
+    // comment stripped, see dmmeta.fbase:acr.FCdflt.base
+}
+
+// --- acr.FCdflt..Uninit
+void acr::FCdflt_Uninit(acr::FCdflt& cdflt) {
+    acr::FCdflt &row = cdflt; (void)row;
+    acr::FCtype* p_ctype = acr::ind_ctype_Find(row.ctype);
+    if (p_ctype)  {
+        c_cdflt_Remove(*p_ctype, row);// remove cdflt from index c_cdflt
     }
 }
 
@@ -438,9 +519,6 @@ void acr::FCheck_Uninit(acr::FCheck& check) {
     ary_name_RemoveAll(check);
     // free memory for Tary acr.FCheck.ary_name
     algo_lib::malloc_FreeMem(check.ary_name_elems, sizeof(algo::cstring)*check.ary_name_max); // (acr.FCheck.ary_name)
-
-    // acr.FCheck.c_bad_rec.Uninit (Ptrary)  //
-    algo_lib::malloc_FreeMem(check.c_bad_rec_elems, sizeof(acr::FRec*)*check.c_bad_rec_max); // (acr.FCheck.c_bad_rec)
 }
 
 // --- acr.FCppfunc.base.CopyOut
@@ -618,7 +696,8 @@ acr::FRec* acr::zd_trec_RemoveFirst(acr::FCtype& ctype) {
 // --- acr.FCtype.ind_rec.Find
 // Find row by key. Return NULL if not found.
 acr::FRec* acr::ind_rec_Find(acr::FCtype& ctype, const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (ctype.ind_rec_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (ctype.ind_rec_buckets_n - 1);
     acr::FRec* *e = &ctype.ind_rec_buckets_elems[index];
     acr::FRec* ret=NULL;
     do {
@@ -636,7 +715,8 @@ bool acr::ind_rec_InsertMaybe(acr::FCtype& ctype, acr::FRec& row) {
     ind_rec_Reserve(ctype, 1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_rec_next == (acr::FRec*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.pkey) & (ctype.ind_rec_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.pkey);
+        u32 index = hash & (ctype.ind_rec_buckets_n - 1);
         acr::FRec* *prev = &ctype.ind_rec_buckets_elems[index];
         do {
             acr::FRec* ret = *prev;
@@ -662,7 +742,8 @@ bool acr::ind_rec_InsertMaybe(acr::FCtype& ctype, acr::FRec& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr::ind_rec_Remove(acr::FCtype& ctype, acr::FRec& row) {
     if (LIKELY(row.ind_rec_next != (acr::FRec*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.pkey) & (ctype.ind_rec_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.pkey);
+        u32 index = hash & (ctype.ind_rec_buckets_n - 1);
         acr::FRec* *prev = &ctype.ind_rec_buckets_elems[index]; // addr of pointer to current element
         while (acr::FRec *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -925,6 +1006,79 @@ acr::FField* acr::zd_arg_RemoveFirst(acr::FCtype& ctype) {
     return row;
 }
 
+// --- acr.FCtype.c_bad_rec.Insert
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void acr::c_bad_rec_Insert(acr::FCtype& ctype, acr::FRec& row) {
+    // reserve space
+    c_bad_rec_Reserve(ctype, 1);
+    u32 n  = ctype.c_bad_rec_n;
+    u32 at = n;
+    acr::FRec* *elems = ctype.c_bad_rec_elems;
+    elems[at] = &row;
+    ctype.c_bad_rec_n = n+1;
+
+}
+
+// --- acr.FCtype.c_bad_rec.ScanInsertMaybe
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool acr::c_bad_rec_ScanInsertMaybe(acr::FCtype& ctype, acr::FRec& row) {
+    bool retval = true;
+    u32 n  = ctype.c_bad_rec_n;
+    for (u32 i = 0; i < n; i++) {
+        if (ctype.c_bad_rec_elems[i] == &row) {
+            retval = false;
+            break;
+        }
+    }
+    if (retval) {
+        // reserve space
+        c_bad_rec_Reserve(ctype, 1);
+        ctype.c_bad_rec_elems[n] = &row;
+        ctype.c_bad_rec_n = n+1;
+    }
+    return retval;
+}
+
+// --- acr.FCtype.c_bad_rec.Remove
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void acr::c_bad_rec_Remove(acr::FCtype& ctype, acr::FRec& row) {
+    int lim = ctype.c_bad_rec_n;
+    acr::FRec* *elems = ctype.c_bad_rec_elems;
+    // search backward, so that most recently added element is found first.
+    // if found, shift array.
+    for (int i = lim-1; i>=0; i--) {
+        acr::FRec* elem = elems[i]; // fetch element
+        if (elem == &row) {
+            int j = i + 1;
+            size_t nbytes = sizeof(acr::FRec*) * (lim - j);
+            memmove(elems + i, elems + j, nbytes);
+            ctype.c_bad_rec_n = lim - 1;
+            break;
+        }
+    }
+}
+
+// --- acr.FCtype.c_bad_rec.Reserve
+// Reserve space in index for N more elements;
+void acr::c_bad_rec_Reserve(acr::FCtype& ctype, u32 n) {
+    u32 old_max = ctype.c_bad_rec_max;
+    if (UNLIKELY(ctype.c_bad_rec_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(acr::FRec*);
+        u32 new_size = new_max * sizeof(acr::FRec*);
+        void *new_mem = algo_lib::malloc_ReallocMem(ctype.c_bad_rec_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("acr.out_of_memory  field:acr.FCtype.c_bad_rec");
+        }
+        ctype.c_bad_rec_elems = (acr::FRec**)new_mem;
+        ctype.c_bad_rec_max = new_max;
+    }
+}
+
 // --- acr.FCtype.ind_rec_curs.Reset
 void acr::ctype_ind_rec_curs_Reset(ctype_ind_rec_curs &curs, acr::FCtype &parent) {
     curs.bucket = 0;
@@ -972,6 +1126,13 @@ void acr::FCtype_Init(acr::FCtype& ctype) {
     ctype.zd_arg_tail = NULL; // (acr.FCtype.zd_arg)
     ctype.rowid = i32(0);
     ctype.visit = bool(false);
+    ctype.attrval_built = bool(false);
+    ctype.c_bad_rec_elems = NULL; // (acr.FCtype.c_bad_rec)
+    ctype.c_bad_rec_n = 0; // (acr.FCtype.c_bad_rec)
+    ctype.c_bad_rec_max = 0; // (acr.FCtype.c_bad_rec)
+    ctype.check = bool(false);
+    ctype.xref_built = bool(false);
+    ctype.xref_target = bool(false);
     ctype.run_c_child_in_ary = bool(false);
     ctype.ind_ctype_next = (acr::FCtype*)-1; // (acr.FDb.ind_ctype) not-in-hash
     ctype.zd_sel_ctype_next = (acr::FCtype*)-1; // (acr.FDb.zd_sel_ctype) not-in-list
@@ -986,6 +1147,9 @@ void acr::FCtype_Uninit(acr::FCtype& ctype) {
     zd_sel_ctype_Remove(row); // remove ctype from index zd_sel_ctype
     bh_ctype_topo_Remove(row); // remove ctype from index bh_ctype_topo
 
+    // acr.FCtype.c_bad_rec.Uninit (Ptrary)  //Records with invalid attributes (found by check thread)
+    algo_lib::malloc_FreeMem(ctype.c_bad_rec_elems, sizeof(acr::FRec*)*ctype.c_bad_rec_max); // (acr.FCtype.c_bad_rec)
+
     // acr.FCtype.c_child.Uninit (Ptrary)  //all tables that reference this table
     algo_lib::malloc_FreeMem(ctype.c_child_elems, sizeof(acr::FCtype*)*ctype.c_child_max); // (acr.FCtype.c_child)
 
@@ -1427,8 +1591,21 @@ void* acr::ctype_AllocMem() {
     if (bsr < 32) {
         lev = _db.ctype_lary[bsr];
         if (!lev) {
-            lev=(acr::FCtype*)algo_lib::malloc_AllocMem(sizeof(acr::FCtype) * (u64(1)<<bsr));
-            _db.ctype_lary[bsr] = lev;
+            bool ok = true;
+            if (ok) {
+                _db.ctype_check_lary[bsr] = (bool*)algo_lib::malloc_AllocMem(sizeof(bool) * (u64(1)<<bsr));
+                ok = _db.ctype_check_lary[bsr] != NULL;
+            }
+            if (ok) {
+                lev=(acr::FCtype*)algo_lib::malloc_AllocMem(sizeof(acr::FCtype) * (u64(1)<<bsr));
+                _db.ctype_lary[bsr] = lev;
+            }
+            if (!lev) {
+                if (_db.ctype_check_lary[bsr]) {
+                    algo_lib::malloc_FreeMem(_db.ctype_check_lary[bsr], sizeof(bool) * (u64(1)<<bsr));
+                    _db.ctype_check_lary[bsr] = NULL;
+                }
+            }
         }
     }
     // allocate element from this level
@@ -2322,8 +2499,6 @@ void acr::MainArgs(int argc, char **argv) {
     Argtuple argtuple;
     Argtuple_ReadArgv(argtuple, argc,argv,acr_syntax, acr_help);
     vrfy(acr_ReadTupleMaybe(acr::_db.cmdline, argtuple.tuple),"where:read_cmdline");
-    vrfy(acr::LoadTuplesMaybe(acr::_db.cmdline.schema)
-    ,tempstr()<<"where:load_input  "<<algo_lib::DetachBadTags());
     acr::Main(); // call through to user-defined main
 }
 
@@ -2360,7 +2535,7 @@ static void acr::InitReflection() {
 
 
     // -- load signatures of existing dispatches --
-    algo_lib::InsertStrptrMaybe("dmmeta.Dispsigcheck  dispsig:'acr.Input'  signature:'d017798c923e992bdb4a0e62987d4fdcb8cb49d1'");
+    algo_lib::InsertStrptrMaybe("dmmeta.Dispsigcheck  dispsig:'acr.Input'  signature:'33467cbcc127d1d5f4355f1b44460444795ec1ed'");
 }
 
 // --- acr.FDb._db.StaticCheck
@@ -2379,6 +2554,9 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_dmmeta_Ctype: { // finput:acr.FDb.ctype
             dmmeta::Ctype elem;
             retval = dmmeta::Ctype_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_dmmeta_Ctype, &elem, sizeof(elem));
+            }
             retval = retval && ctype_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -2386,6 +2564,9 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_dmmeta_Anonfld: { // finput:acr.FDb.anonfld
             dmmeta::Anonfld elem;
             retval = dmmeta::Anonfld_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_dmmeta_Anonfld, &elem, sizeof(elem));
+            }
             retval = retval && anonfld_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -2393,6 +2574,9 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_dmmeta_Cdflt: { // finput:acr.FDb.cdflt
             dmmeta::Cdflt elem;
             retval = dmmeta::Cdflt_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_dmmeta_Cdflt, &elem, sizeof(elem));
+            }
             retval = retval && cdflt_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -2400,6 +2584,9 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_dmmeta_Field: { // finput:acr.FDb.field
             dmmeta::Field elem;
             retval = dmmeta::Field_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_dmmeta_Field, &elem, sizeof(elem));
+            }
             retval = retval && field_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -2407,6 +2594,9 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_dmmeta_Substr: { // finput:acr.FDb.substr
             dmmeta::Substr elem;
             retval = dmmeta::Substr_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_dmmeta_Substr, &elem, sizeof(elem));
+            }
             retval = retval && substr_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -2414,6 +2604,9 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_dmmeta_Ssimfile: { // finput:acr.FDb.ssimfile
             dmmeta::Ssimfile elem;
             retval = dmmeta::Ssimfile_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_dmmeta_Ssimfile, &elem, sizeof(elem));
+            }
             retval = retval && ssimfile_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -2421,6 +2614,9 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_dmmeta_Ssimsort: { // finput:acr.FDb.ssimsort
             dmmeta::Ssimsort elem;
             retval = dmmeta::Ssimsort_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_dmmeta_Ssimsort, &elem, sizeof(elem));
+            }
             retval = retval && ssimsort_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -2428,6 +2624,9 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_dmmeta_Smallstr: { // finput:acr.FDb.smallstr
             dmmeta::Smallstr elem;
             retval = dmmeta::Smallstr_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_dmmeta_Smallstr, &elem, sizeof(elem));
+            }
             retval = retval && smallstr_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -2435,6 +2634,9 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_dmmeta_Funique: { // finput:acr.FDb.funique
             dmmeta::Funique elem;
             retval = dmmeta::Funique_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_dmmeta_Funique, &elem, sizeof(elem));
+            }
             retval = retval && funique_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -2442,6 +2644,9 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_amcdb_Bltin: { // finput:acr.FDb.bltin
             amcdb::Bltin elem;
             retval = amcdb::Bltin_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_amcdb_Bltin, &elem, sizeof(elem));
+            }
             retval = retval && bltin_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -2449,11 +2654,15 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
         case acr_TableId_dmmeta_Cppfunc: { // finput:acr.FDb.cppfunc
             dmmeta::Cppfunc elem;
             retval = dmmeta::Cppfunc_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_TableId_dmmeta_Cppfunc, &elem, sizeof(elem));
+            }
             retval = retval && cppfunc_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -2463,16 +2672,139 @@ bool acr::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- acr.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool acr::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case acr_TableId_dmmeta_Ctype: { // finput:acr.FDb.ctype
+            dmmeta::Ctype elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ctype_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case acr_TableId_dmmeta_Anonfld: { // finput:acr.FDb.anonfld
+            dmmeta::Anonfld elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = anonfld_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case acr_TableId_dmmeta_Cdflt: { // finput:acr.FDb.cdflt
+            dmmeta::Cdflt elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = cdflt_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case acr_TableId_dmmeta_Field: { // finput:acr.FDb.field
+            dmmeta::Field elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = field_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case acr_TableId_dmmeta_Substr: { // finput:acr.FDb.substr
+            dmmeta::Substr elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = substr_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case acr_TableId_dmmeta_Ssimfile: { // finput:acr.FDb.ssimfile
+            dmmeta::Ssimfile elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ssimfile_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case acr_TableId_dmmeta_Ssimsort: { // finput:acr.FDb.ssimsort
+            dmmeta::Ssimsort elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ssimsort_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case acr_TableId_dmmeta_Smallstr: { // finput:acr.FDb.smallstr
+            dmmeta::Smallstr elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = smallstr_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case acr_TableId_dmmeta_Funique: { // finput:acr.FDb.funique
+            dmmeta::Funique elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = funique_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case acr_TableId_amcdb_Bltin: { // finput:acr.FDb.bltin
+            amcdb::Bltin elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = bltin_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case acr_TableId_dmmeta_Cppfunc: { // finput:acr.FDb.cppfunc
+            dmmeta::Cppfunc elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = cppfunc_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- acr.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool acr::LoadTuplesMaybe(algo::strptr root) {
     bool retval = true;
     static const char *ssimfiles[] = {
-        "dmmeta.anonfld", "dmmeta.ctype", "amcdb.bltin", "dmmeta.cdflt"
-        , "dmmeta.cppfunc", "dmmeta.field", "dmmeta.funique", "dmmeta.smallstr"
+        "dmmeta.anonfld", "dmmeta.ctype", "dmmeta.field", "amcdb.bltin"
+        , "dmmeta.cdflt", "dmmeta.cppfunc", "dmmeta.funique", "dmmeta.smallstr"
         , "dmmeta.ssimfile", "dmmeta.ssimsort", "dmmeta.substr"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, acr::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "acr", "33467cbcc127d1d5f4355f1b44460444795ec1ed"
+        , acr::InsertStrptrMaybe, acr::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -2497,7 +2829,8 @@ bool acr::_db_XrefMaybe() {
 // --- acr.FDb.ind_ctype.Find
 // Find row by key. Return NULL if not found.
 acr::FCtype* acr::ind_ctype_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ctype_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ctype_buckets_n - 1);
     acr::FCtype* *e = &_db.ind_ctype_buckets_elems[index];
     acr::FCtype* ret=NULL;
     do {
@@ -2515,7 +2848,8 @@ bool acr::ind_ctype_InsertMaybe(acr::FCtype& row) {
     ind_ctype_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ctype_next == (acr::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         acr::FCtype* *prev = &_db.ind_ctype_buckets_elems[index];
         do {
             acr::FCtype* ret = *prev;
@@ -2541,7 +2875,8 @@ bool acr::ind_ctype_InsertMaybe(acr::FCtype& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr::ind_ctype_Remove(acr::FCtype& row) {
     if (LIKELY(row.ind_ctype_next != (acr::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         acr::FCtype* *prev = &_db.ind_ctype_buckets_elems[index]; // addr of pointer to current element
         while (acr::FCtype *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2594,7 +2929,8 @@ void acr::ind_ctype_Reserve(int n) {
 // --- acr.FDb.ind_field.Find
 // Find row by key. Return NULL if not found.
 acr::FField* acr::ind_field_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_field_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_field_buckets_n - 1);
     acr::FField* *e = &_db.ind_field_buckets_elems[index];
     acr::FField* ret=NULL;
     do {
@@ -2612,7 +2948,8 @@ bool acr::ind_field_InsertMaybe(acr::FField& row) {
     ind_field_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_field_next == (acr::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         acr::FField* *prev = &_db.ind_field_buckets_elems[index];
         do {
             acr::FField* ret = *prev;
@@ -2638,7 +2975,8 @@ bool acr::ind_field_InsertMaybe(acr::FField& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr::ind_field_Remove(acr::FField& row) {
     if (LIKELY(row.ind_field_next != (acr::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         acr::FField* *prev = &_db.ind_field_buckets_elems[index]; // addr of pointer to current element
         while (acr::FField *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2691,7 +3029,8 @@ void acr::ind_field_Reserve(int n) {
 // --- acr.FDb.ind_file.Find
 // Find row by key. Return NULL if not found.
 acr::FFile* acr::ind_file_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_file_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_file_buckets_n - 1);
     acr::FFile* *e = &_db.ind_file_buckets_elems[index];
     acr::FFile* ret=NULL;
     do {
@@ -2725,7 +3064,8 @@ bool acr::ind_file_InsertMaybe(acr::FFile& row) {
     ind_file_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_file_next == (acr::FFile*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.file) & (_db.ind_file_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.file);
+        u32 index = hash & (_db.ind_file_buckets_n - 1);
         acr::FFile* *prev = &_db.ind_file_buckets_elems[index];
         do {
             acr::FFile* ret = *prev;
@@ -2751,7 +3091,8 @@ bool acr::ind_file_InsertMaybe(acr::FFile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr::ind_file_Remove(acr::FFile& row) {
     if (LIKELY(row.ind_file_next != (acr::FFile*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.file) & (_db.ind_file_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.file);
+        u32 index = hash & (_db.ind_file_buckets_n - 1);
         acr::FFile* *prev = &_db.ind_file_buckets_elems[index]; // addr of pointer to current element
         while (acr::FFile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -3494,7 +3835,8 @@ bool acr::tempkey_XrefMaybe(acr::FTempkey &row) {
 // --- acr.FDb.ind_tempkey.Find
 // Find row by key. Return NULL if not found.
 acr::FTempkey* acr::ind_tempkey_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_tempkey_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_tempkey_buckets_n - 1);
     acr::FTempkey* *e = &_db.ind_tempkey_buckets_elems[index];
     acr::FTempkey* ret=NULL;
     do {
@@ -3528,7 +3870,8 @@ bool acr::ind_tempkey_InsertMaybe(acr::FTempkey& row) {
     ind_tempkey_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_tempkey_next == (acr::FTempkey*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.tempkey) & (_db.ind_tempkey_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.tempkey);
+        u32 index = hash & (_db.ind_tempkey_buckets_n - 1);
         acr::FTempkey* *prev = &_db.ind_tempkey_buckets_elems[index];
         do {
             acr::FTempkey* ret = *prev;
@@ -3554,7 +3897,8 @@ bool acr::ind_tempkey_InsertMaybe(acr::FTempkey& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr::ind_tempkey_Remove(acr::FTempkey& row) {
     if (LIKELY(row.ind_tempkey_next != (acr::FTempkey*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.tempkey) & (_db.ind_tempkey_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.tempkey);
+        u32 index = hash & (_db.ind_tempkey_buckets_n - 1);
         acr::FTempkey* *prev = &_db.ind_tempkey_buckets_elems[index]; // addr of pointer to current element
         while (acr::FTempkey *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -3607,7 +3951,8 @@ void acr::ind_tempkey_Reserve(int n) {
 // --- acr.FDb.ind_ssimfile.Find
 // Find row by key. Return NULL if not found.
 acr::FSsimfile* acr::ind_ssimfile_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ssimfile_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
     acr::FSsimfile* *e = &_db.ind_ssimfile_buckets_elems[index];
     acr::FSsimfile* ret=NULL;
     do {
@@ -3625,7 +3970,8 @@ bool acr::ind_ssimfile_InsertMaybe(acr::FSsimfile& row) {
     ind_ssimfile_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ssimfile_next == (acr::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         acr::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index];
         do {
             acr::FSsimfile* ret = *prev;
@@ -3651,7 +3997,8 @@ bool acr::ind_ssimfile_InsertMaybe(acr::FSsimfile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr::ind_ssimfile_Remove(acr::FSsimfile& row) {
     if (LIKELY(row.ind_ssimfile_next != (acr::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         acr::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index]; // addr of pointer to current element
         while (acr::FSsimfile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -3998,7 +4345,8 @@ bool acr::ssimsort_XrefMaybe(acr::FSsimsort &row) {
 // --- acr.FDb.ind_ssimsort.Find
 // Find row by key. Return NULL if not found.
 acr::FSsimsort* acr::ind_ssimsort_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ssimsort_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ssimsort_buckets_n - 1);
     acr::FSsimsort* *e = &_db.ind_ssimsort_buckets_elems[index];
     acr::FSsimsort* ret=NULL;
     do {
@@ -4016,7 +4364,8 @@ bool acr::ind_ssimsort_InsertMaybe(acr::FSsimsort& row) {
     ind_ssimsort_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ssimsort_next == (acr::FSsimsort*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimsort_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimsort_buckets_n - 1);
         acr::FSsimsort* *prev = &_db.ind_ssimsort_buckets_elems[index];
         do {
             acr::FSsimsort* ret = *prev;
@@ -4042,7 +4391,8 @@ bool acr::ind_ssimsort_InsertMaybe(acr::FSsimsort& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr::ind_ssimsort_Remove(acr::FSsimsort& row) {
     if (LIKELY(row.ind_ssimsort_next != (acr::FSsimsort*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimsort_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimsort_buckets_n - 1);
         acr::FSsimsort* *prev = &_db.ind_ssimsort_buckets_elems[index]; // addr of pointer to current element
         while (acr::FSsimsort *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -4280,7 +4630,8 @@ bool acr::funique_XrefMaybe(acr::FFunique &row) {
 // --- acr.FDb.ind_uniqueattr.Find
 // Find row by key. Return NULL if not found.
 acr::FUniqueattr* acr::ind_uniqueattr_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_uniqueattr_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_uniqueattr_buckets_n - 1);
     acr::FUniqueattr* *e = &_db.ind_uniqueattr_buckets_elems[index];
     acr::FUniqueattr* ret=NULL;
     do {
@@ -4314,7 +4665,8 @@ bool acr::ind_uniqueattr_InsertMaybe(acr::FUniqueattr& row) {
     ind_uniqueattr_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_uniqueattr_next == (acr::FUniqueattr*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.uniqueattr) & (_db.ind_uniqueattr_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.uniqueattr);
+        u32 index = hash & (_db.ind_uniqueattr_buckets_n - 1);
         acr::FUniqueattr* *prev = &_db.ind_uniqueattr_buckets_elems[index];
         do {
             acr::FUniqueattr* ret = *prev;
@@ -4340,7 +4692,8 @@ bool acr::ind_uniqueattr_InsertMaybe(acr::FUniqueattr& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr::ind_uniqueattr_Remove(acr::FUniqueattr& row) {
     if (LIKELY(row.ind_uniqueattr_next != (acr::FUniqueattr*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.uniqueattr) & (_db.ind_uniqueattr_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.uniqueattr);
+        u32 index = hash & (_db.ind_uniqueattr_buckets_n - 1);
         acr::FUniqueattr* *prev = &_db.ind_uniqueattr_buckets_elems[index]; // addr of pointer to current element
         while (acr::FUniqueattr *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -4765,37 +5118,385 @@ bool acr::cppfunc_XrefMaybe(acr::FCppfunc &row) {
     return retval;
 }
 
-// --- acr.FDb.trace.RowidFind
-// find trace by row id (used to implement reflection)
-static algo::ImrowPtr acr::trace_RowidFind(int t) {
-    return algo::ImrowPtr(t==0 ? u64(&_db.trace) : u64(0));
+// --- acr.FDb.attrval.Alloc
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+acr::FAttrval& acr::attrval_Alloc() {
+    acr::FAttrval* row = attrval_AllocMaybe();
+    if (UNLIKELY(row == NULL)) {
+        FatalErrorExit("acr.out_of_mem  field:acr.FDb.attrval  comment:'Alloc failed'");
+    }
+    return *row;
 }
 
-// --- acr.FDb.trace.N
-// Function return 1
-inline static i32 acr::trace_N() {
-    return 1;
+// --- acr.FDb.attrval.AllocMaybe
+// Allocate memory for new element. If out of memory, return NULL.
+acr::FAttrval* acr::attrval_AllocMaybe() {
+    acr::FAttrval *row = (acr::FAttrval*)attrval_AllocMem();
+    if (row) {
+        new (row) acr::FAttrval; // call constructor
+    }
+    return row;
 }
 
-// --- acr.FDb.bh_pline_curs.Add
-static void acr::_db_bh_pline_curs_Add(_db_bh_pline_curs &curs, acr::FPline& row) {
-    u32 n = curs.temp_n;
-    int i = n;
-    curs.temp_n = n+1;
-    acr::FPline* *elems = curs.temp_elems;
-    while (i>0) {
-        int j = (i-1)/2;
-        acr::FPline* p = elems[j];
-        if (!bh_pline_ElemLt(row,*p)) {
-            break;
-        }
-        elems[i]=p;
-        i=j;
-    }
-    elems[i]=&row;
+// --- acr.FDb.attrval.Delete
+// Remove row from all global and cross indices, then deallocate row
+void acr::attrval_Delete(acr::FAttrval &row) {
+    row.~FAttrval();
+    attrval_FreeMem(row);
 }
 
-// --- acr.FDb.bh_pline_curs.Reserve
+// --- acr.FDb.attrval.AllocMem
+// Allocate space for one element
+// If no memory available, return NULL.
+void* acr::attrval_AllocMem() {
+    acr::FAttrval *row = _db.attrval_free;
+    if (UNLIKELY(!row)) {
+        attrval_Reserve(1);
+        row = _db.attrval_free;
+    }
+    if (row) {
+        _db.attrval_free = row->attrval_next;
+    }
+    return row;
+}
+
+// --- acr.FDb.attrval.FreeMem
+// Remove mem from all global and cross indices, then deallocate mem
+void acr::attrval_FreeMem(acr::FAttrval &row) {
+    if (UNLIKELY(row.attrval_next != (acr::FAttrval*)-1)) {
+        FatalErrorExit("acr.tpool_double_delete  pool:acr.FDb.attrval  comment:'double deletion caught'");
+    }
+    row.attrval_next = _db.attrval_free; // insert into free list
+    _db.attrval_free  = &row;
+}
+
+// --- acr.FDb.attrval.Reserve
+// Preallocate memory for N more elements
+// Return number of elements actually reserved.
+u64 acr::attrval_Reserve(u64 n_elems) {
+    u64 ret = 0;
+    while (ret < n_elems) {
+        u64 size = _db.attrval_blocksize; // underlying allocator is probably Lpool
+        u64 reserved = attrval_ReserveMem(size);
+        ret += reserved;
+        if (reserved == 0) {
+            break;
+        }
+    }
+    return ret;
+}
+
+// --- acr.FDb.attrval.ReserveMem
+// Allocate block of given size, break up into small elements and append to free list.
+// Return number of elements reserved.
+u64 acr::attrval_ReserveMem(u64 size) {
+    u64 ret = 0;
+    if (size >= sizeof(acr::FAttrval)) {
+        acr::FAttrval *mem = (acr::FAttrval*)algo_lib::malloc_AllocMem(size);
+        ret = mem ? size / sizeof(acr::FAttrval) : 0;
+        // add newly allocated elements to the free list;
+        for (u64 i=0; i < ret; i++) {
+            mem[i].attrval_next = _db.attrval_free;
+            _db.attrval_free = mem+i;
+        }
+    }
+    return ret;
+}
+
+// --- acr.FDb.attrval.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool acr::attrval_XrefMaybe(acr::FAttrval &row) {
+    bool retval = true;
+    (void)row;
+    acr::FField* p_p_field = row.p_field;
+    if (UNLIKELY(!p_p_field)) {
+        algo_lib::ResetErrtext() << "acr.null_ref  xref:acr.FField.ind_attrval";
+        return false;
+    }
+    // insert attrval into index ind_attrval
+    if (true) { // user-defined insert condition
+        bool success = ind_attrval_InsertMaybe(*p_p_field, row);
+        if (UNLIKELY(!success)) {
+            ch_RemoveAll(algo_lib::_db.errtext);
+            algo_lib::_db.errtext << "acr.duplicate_key  xref:acr.FField.ind_attrval"; // check for duplicate key
+            return false;
+        }
+    }
+    // insert attrval into index tr_attrval
+    if (true) { // user-defined insert condition
+        tr_attrval_Insert(*p_p_field, row);
+    }
+    return retval;
+}
+
+// --- acr.FDb.c_stage.Insert
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void acr::c_stage_Insert(acr::FSsimfile& row) {
+    if (bool_Update(row._db_c_stage_in_ary,true)) {
+        // reserve space
+        c_stage_Reserve(1);
+        u32 n  = _db.c_stage_n;
+        u32 at = n;
+        acr::FSsimfile* *elems = _db.c_stage_elems;
+        elems[at] = &row;
+        _db.c_stage_n = n+1;
+
+    }
+}
+
+// --- acr.FDb.c_stage.InsertMaybe
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Return value: whether element was inserted into array.
+bool acr::c_stage_InsertMaybe(acr::FSsimfile& row) {
+    bool retval = !row._db_c_stage_in_ary;
+    c_stage_Insert(row); // check is performed in _Insert again
+    return retval;
+}
+
+// --- acr.FDb.c_stage.Remove
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void acr::c_stage_Remove(acr::FSsimfile& row) {
+    if (bool_Update(row._db_c_stage_in_ary,false)) {
+        int lim = _db.c_stage_n;
+        acr::FSsimfile* *elems = _db.c_stage_elems;
+        // search backward, so that most recently added element is found first.
+        // if found, shift array.
+        for (int i = lim-1; i>=0; i--) {
+            acr::FSsimfile* elem = elems[i]; // fetch element
+            if (elem == &row) {
+                int j = i + 1;
+                size_t nbytes = sizeof(acr::FSsimfile*) * (lim - j);
+                memmove(elems + i, elems + j, nbytes);
+                _db.c_stage_n = lim - 1;
+                break;
+            }
+        }
+    }
+}
+
+// --- acr.FDb.c_stage.Reserve
+// Reserve space in index for N more elements;
+void acr::c_stage_Reserve(u32 n) {
+    u32 old_max = _db.c_stage_max;
+    if (UNLIKELY(_db.c_stage_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(acr::FSsimfile*);
+        u32 new_size = new_max * sizeof(acr::FSsimfile*);
+        void *new_mem = algo_lib::malloc_ReallocMem(_db.c_stage_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("acr.out_of_memory  field:acr.FDb.c_stage");
+        }
+        _db.c_stage_elems = (acr::FSsimfile**)new_mem;
+        _db.c_stage_max = new_max;
+    }
+}
+
+// --- acr.FDb.pkeybuild.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool acr::pkeybuild_XrefMaybe(acr::FPkeybuild &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- acr.FDb.c_check.Insert
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void acr::c_check_Insert(acr::FCtype& row) {
+    // reserve space
+    c_check_Reserve(1);
+    u32 n  = _db.c_check_n;
+    u32 at = n;
+    acr::FCtype* *elems = _db.c_check_elems;
+    elems[at] = &row;
+    _db.c_check_n = n+1;
+
+}
+
+// --- acr.FDb.c_check.ScanInsertMaybe
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool acr::c_check_ScanInsertMaybe(acr::FCtype& row) {
+    bool retval = true;
+    u32 n  = _db.c_check_n;
+    for (u32 i = 0; i < n; i++) {
+        if (_db.c_check_elems[i] == &row) {
+            retval = false;
+            break;
+        }
+    }
+    if (retval) {
+        // reserve space
+        c_check_Reserve(1);
+        _db.c_check_elems[n] = &row;
+        _db.c_check_n = n+1;
+    }
+    return retval;
+}
+
+// --- acr.FDb.c_check.Remove
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void acr::c_check_Remove(acr::FCtype& row) {
+    int lim = _db.c_check_n;
+    acr::FCtype* *elems = _db.c_check_elems;
+    // search backward, so that most recently added element is found first.
+    // if found, shift array.
+    for (int i = lim-1; i>=0; i--) {
+        acr::FCtype* elem = elems[i]; // fetch element
+        if (elem == &row) {
+            int j = i + 1;
+            size_t nbytes = sizeof(acr::FCtype*) * (lim - j);
+            memmove(elems + i, elems + j, nbytes);
+            _db.c_check_n = lim - 1;
+            break;
+        }
+    }
+}
+
+// --- acr.FDb.c_check.Reserve
+// Reserve space in index for N more elements;
+void acr::c_check_Reserve(u32 n) {
+    u32 old_max = _db.c_check_max;
+    if (UNLIKELY(_db.c_check_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(acr::FCtype*);
+        u32 new_size = new_max * sizeof(acr::FCtype*);
+        void *new_mem = algo_lib::malloc_ReallocMem(_db.c_check_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("acr.out_of_memory  field:acr.FDb.c_check");
+        }
+        _db.c_check_elems = (acr::FCtype**)new_mem;
+        _db.c_check_max = new_max;
+    }
+}
+
+// --- acr.FDb.watch_ns.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+algo::cstring& acr::watch_ns_Alloc() {
+    watch_ns_Reserve(1);
+    int n  = _db.watch_ns_n;
+    int at = n;
+    algo::cstring *elems = _db.watch_ns_elems;
+    new (elems + at) algo::cstring(); // construct new element, default initializer
+    _db.watch_ns_n = n+1;
+    return elems[at];
+}
+
+// --- acr.FDb.watch_ns.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+algo::cstring& acr::watch_ns_AllocAt(int at) {
+    watch_ns_Reserve(1);
+    int n  = _db.watch_ns_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("acr.bad_alloc_at  field:acr.FDb.watch_ns  comment:'index out of range'");
+    }
+    algo::cstring *elems = _db.watch_ns_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(algo::cstring));
+    new (elems + at) algo::cstring(); // construct element, default initializer
+    _db.watch_ns_n = n+1;
+    return elems[at];
+}
+
+// --- acr.FDb.watch_ns.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<algo::cstring> acr::watch_ns_AllocN(int n_elems) {
+    watch_ns_Reserve(n_elems);
+    int old_n  = _db.watch_ns_n;
+    int new_n = old_n + n_elems;
+    algo::cstring *elems = _db.watch_ns_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) algo::cstring(); // construct new element, default initialize
+    }
+    _db.watch_ns_n = new_n;
+    return algo::aryptr<algo::cstring>(elems + old_n, n_elems);
+}
+
+// --- acr.FDb.watch_ns.Remove
+// Remove item by index. If index outside of range, do nothing.
+void acr::watch_ns_Remove(u32 i) {
+    u32 lim = _db.watch_ns_n;
+    algo::cstring *elems = _db.watch_ns_elems;
+    if (i < lim) {
+        elems[i].~cstring(); // destroy element
+        memmove(elems + i, elems + (i + 1), sizeof(algo::cstring) * (lim - (i + 1)));
+        _db.watch_ns_n = lim - 1;
+    }
+}
+
+// --- acr.FDb.watch_ns.RemoveAll
+void acr::watch_ns_RemoveAll() {
+    u32 n = _db.watch_ns_n;
+    while (n > 0) {
+        n -= 1;
+        _db.watch_ns_elems[n].~cstring();
+        _db.watch_ns_n = n;
+    }
+}
+
+// --- acr.FDb.watch_ns.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void acr::watch_ns_RemoveLast() {
+    u64 n = _db.watch_ns_n;
+    if (n > 0) {
+        n -= 1;
+        watch_ns_qFind(u64(n)).~cstring();
+        _db.watch_ns_n = n;
+    }
+}
+
+// --- acr.FDb.watch_ns.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void acr::watch_ns_AbsReserve(int n) {
+    u32 old_max  = _db.watch_ns_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(_db.watch_ns_elems, old_max * sizeof(algo::cstring), new_max * sizeof(algo::cstring));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("acr.tary_nomem  field:acr.FDb.watch_ns  comment:'out of memory'");
+    }
+    _db.watch_ns_elems = (algo::cstring*)new_mem;
+    _db.watch_ns_max = new_max;
+}
+
+// --- acr.FDb.trace.RowidFind
+// find trace by row id (used to implement reflection)
+static algo::ImrowPtr acr::trace_RowidFind(int t) {
+    return algo::ImrowPtr(t==0 ? u64(&_db.trace) : u64(0));
+}
+
+// --- acr.FDb.trace.N
+// Function return 1
+inline static i32 acr::trace_N() {
+    return 1;
+}
+
+// --- acr.FDb.bh_pline_curs.Add
+static void acr::_db_bh_pline_curs_Add(_db_bh_pline_curs &curs, acr::FPline& row) {
+    u32 n = curs.temp_n;
+    int i = n;
+    curs.temp_n = n+1;
+    acr::FPline* *elems = curs.temp_elems;
+    while (i>0) {
+        int j = (i-1)/2;
+        acr::FPline* p = elems[j];
+        if (!bh_pline_ElemLt(row,*p)) {
+            break;
+        }
+        elems[i]=p;
+        i=j;
+    }
+    elems[i]=&row;
+}
+
+// --- acr.FDb.bh_pline_curs.Reserve
 void acr::_db_bh_pline_curs_Reserve(_db_bh_pline_curs &curs, int n) {
     if (n > curs.temp_max) {
         size_t old_size   = sizeof(void*) * curs.temp_max;
@@ -4977,6 +5678,16 @@ void acr::FDb_Init() {
         _db.ctype_lary[i]  = ctype_first;
         ctype_first    += 1ULL<<i;
     }
+    // column check
+    memset(_db.ctype_check_lary, 0, sizeof(_db.ctype_check_lary));
+    bool* ctype_check_first = (bool*)algo_lib::malloc_AllocMem(sizeof(bool) * (u64(1)<<4));
+    if (!ctype_check_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.ctype_check_lary[i]  = ctype_check_first;
+        ctype_check_first    += 1ULL<<i;
+    }
     // err: initialize Tpool
     _db.err_free      = NULL;
     _db.err_blocksize = BumpToPow2(64 * sizeof(acr::FErr)); // allocate 64-127 elements at a time
@@ -5198,6 +5909,20 @@ void acr::FDb_Init() {
         _db.cppfunc_lary[i]  = cppfunc_first;
         cppfunc_first    += 1ULL<<i;
     }
+    // attrval: initialize Tpool
+    _db.attrval_free      = NULL;
+    _db.attrval_blocksize = BumpToPow2(64 * sizeof(acr::FAttrval)); // allocate 64-127 elements at a time
+    _db.c_stage_elems = NULL; // (acr.FDb.c_stage)
+    _db.c_stage_n = 0; // (acr.FDb.c_stage)
+    _db.c_stage_max = 0; // (acr.FDb.c_stage)
+    _db.stage_next = u32(0);
+    _db.c_check_elems = NULL; // (acr.FDb.c_check)
+    _db.c_check_n = 0; // (acr.FDb.c_check)
+    _db.c_check_max = 0; // (acr.FDb.c_check)
+    _db.check_next = u32(0);
+    _db.watch_ns_elems 	= 0; // (acr.FDb.watch_ns)
+    _db.watch_ns_n     	= 0; // (acr.FDb.watch_ns)
+    _db.watch_ns_max   	= 0; // (acr.FDb.watch_ns)
 
     acr::InitReflection();
 }
@@ -5208,6 +5933,18 @@ void acr::FDb_Uninit() {
     zd_pdep_Cascdel(); // dmmeta.cascdel:acr.FDb.zd_pdep
     zd_pline_Cascdel(); // dmmeta.cascdel:acr.FDb.zd_pline
 
+    // acr.FDb.watch_ns.Uninit (Tary)  //Namespace watched by each inotify watch descriptor (see -serve)
+    // remove all elements from acr.FDb.watch_ns
+    watch_ns_RemoveAll();
+    // free memory for Tary acr.FDb.watch_ns
+    algo_lib::malloc_FreeMem(_db.watch_ns_elems, sizeof(algo::cstring)*_db.watch_ns_max); // (acr.FDb.watch_ns)
+
+    // acr.FDb.c_check.Uninit (Ptrary)  //Ctypes queued for checking by check threads
+    algo_lib::malloc_FreeMem(_db.c_check_elems, sizeof(acr::FCtype*)*_db.c_check_max); // (acr.FDb.c_check)
+
+    // acr.FDb.c_stage.Uninit (Ptrary)  //Ssimfiles queued for parallel loading
+    algo_lib::malloc_FreeMem(_db.c_stage_elems, sizeof(acr::FSsimfile*)*_db.c_stage_max); // (acr.FDb.c_stage)
+
     // acr.FDb.cppfunc.Uninit (Lary)  //
     // skip destruction in global scope
 
@@ -5333,36 +6070,500 @@ algo::Smallstr50 acr::name_Get(acr::FField& field) {
     return ret;
 }
 
-// --- acr.FField..Init
-// Set all fields to initial values.
-void acr::FField_Init(acr::FField& field) {
-    field.reftype = algo::strptr("Val");
-    field.p_ctype = NULL;
-    field.p_arg = NULL;
-    field.c_substr = NULL;
-    field.max_attr_len = u32(0);
-    field.col_width = u32(0);
-    field.isfldfunc = bool(false);
-    field.anon = bool(false);
-    field.unique = bool(false);
-    field.ctype_c_field_in_ary = bool(false);
-    field.zd_arg_next = (acr::FField*)-1; // (acr.FCtype.zd_arg) not-in-list
-    field.zd_arg_prev = NULL; // (acr.FCtype.zd_arg)
-    field.ind_field_next = (acr::FField*)-1; // (acr.FDb.ind_field) not-in-hash
+// --- acr.FField.ind_attrval.Find
+// Find row by key. Return NULL if not found.
+acr::FAttrval* acr::ind_attrval_Find(acr::FField& field, const algo::strptr& key) {
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (field.ind_attrval_buckets_n - 1);
+    acr::FAttrval* *e = &field.ind_attrval_buckets_elems[index];
+    acr::FAttrval* ret=NULL;
+    do {
+        ret       = *e;
+        bool done = !ret || (*ret).value == key;
+        if (done) break;
+        e         = &ret->ind_attrval_next;
+    } while (true);
+    return ret;
 }
 
-// --- acr.FField..Uninit
-void acr::FField_Uninit(acr::FField& field) {
-    acr::FField &row = field; (void)row;
-    acr::FCtype* p_ctype = acr::ind_ctype_Find(ctype_Get(row));
-    if (p_ctype)  {
-        c_field_Remove(*p_ctype, row);// remove field from index c_field
-    }
+// --- acr.FField.ind_attrval.InsertMaybe
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool acr::ind_attrval_InsertMaybe(acr::FField& field, acr::FAttrval& row) {
+    ind_attrval_Reserve(field, 1);
+    bool retval = true; // if already in hash, InsertMaybe returns true
+    if (LIKELY(row.ind_attrval_next == (acr::FAttrval*)-1)) {// check if in hash already
+        u32 hash  = cstring_Hash(0, row.value);
+        u32 index = hash & (field.ind_attrval_buckets_n - 1);
+        acr::FAttrval* *prev = &field.ind_attrval_buckets_elems[index];
+        do {
+            acr::FAttrval* ret = *prev;
+            if (!ret) { // exit condition 1: reached the end of the list
+                break;
+            }
+            if ((*ret).value == row.value) { // exit condition 2: found matching key
+                retval = false;
+                break;
+            }
+            prev = &ret->ind_attrval_next;
+        } while (true);
+        if (retval) {
+            row.ind_attrval_next = *prev;
+            field.ind_attrval_n++;
+            *prev = &row;
+        }
+    }
+    return retval;
+}
+
+// --- acr.FField.ind_attrval.Remove
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void acr::ind_attrval_Remove(acr::FField& field, acr::FAttrval& row) {
+    if (LIKELY(row.ind_attrval_next != (acr::FAttrval*)-1)) {// check if in hash already
+        u32 hash  = cstring_Hash(0, row.value);
+        u32 index = hash & (field.ind_attrval_buckets_n - 1);
+        acr::FAttrval* *prev = &field.ind_attrval_buckets_elems[index]; // addr of pointer to current element
+        while (acr::FAttrval *next = *prev) {                          // scan the collision chain for our element
+            if (next == &row) {        // found it?
+                *prev = next->ind_attrval_next; // unlink (singly linked list)
+                field.ind_attrval_n--;
+                row.ind_attrval_next = (acr::FAttrval*)-1;// not-in-hash
+                break;
+            }
+            prev = &next->ind_attrval_next;
+        }
+    }
+}
+
+// --- acr.FField.ind_attrval.Reserve
+// Reserve enough room in the hash for N more elements. Return success code.
+void acr::ind_attrval_Reserve(acr::FField& field, int n) {
+    u32 old_nbuckets = field.ind_attrval_buckets_n;
+    u32 new_nelems   = field.ind_attrval_n + n;
+    // # of elements has to be roughly equal to the number of buckets
+    if (new_nelems > old_nbuckets) {
+        int new_nbuckets = i32_Max(BumpToPow2(new_nelems), u32(4));
+        u32 old_size = old_nbuckets * sizeof(acr::FAttrval*);
+        u32 new_size = new_nbuckets * sizeof(acr::FAttrval*);
+        // allocate new array. we don't use Realloc since copying is not needed and factor of 2 probably
+        // means new memory will have to be allocated anyway
+        acr::FAttrval* *new_buckets = (acr::FAttrval**)algo_lib::malloc_AllocMem(new_size);
+        if (UNLIKELY(!new_buckets)) {
+            FatalErrorExit("acr.out_of_memory  field:acr.FField.ind_attrval");
+        }
+        memset(new_buckets, 0, new_size); // clear pointers
+        // rehash all entries
+        for (int i = 0; i < field.ind_attrval_buckets_n; i++) {
+            acr::FAttrval* elem = field.ind_attrval_buckets_elems[i];
+            while (elem) {
+                acr::FAttrval &row        = *elem;
+                acr::FAttrval* next       = row.ind_attrval_next;
+                u32 index          = cstring_Hash(0, row.value) & (new_nbuckets-1);
+                row.ind_attrval_next     = new_buckets[index];
+                new_buckets[index] = &row;
+                elem               = next;
+            }
+        }
+        // free old array
+        algo_lib::malloc_FreeMem(field.ind_attrval_buckets_elems, old_size);
+        field.ind_attrval_buckets_elems = new_buckets;
+        field.ind_attrval_buckets_n = new_nbuckets;
+    }
+}
+
+// --- acr.FField.tr_attrval.FirstImpl
+acr::FAttrval* acr::tr_attrval_FirstImpl(acr::FAttrval* root) {
+    acr::FAttrval *result = root;
+    while(result != NULL && result->tr_attrval_left != NULL){
+        result = result->tr_attrval_left;
+    }
+    return result;
+}
+
+// --- acr.FField.tr_attrval.First
+// Return pointer to the first(smallest) element in the tree
+acr::FAttrval* acr::tr_attrval_First(acr::FField& field) {
+    return tr_attrval_FirstImpl(field.tr_attrval_root);
+}
+
+// --- acr.FField.tr_attrval.InsertImpl
+// Insert row into the tree. If row is already in the tree, do nothing.
+void acr::tr_attrval_InsertImpl(acr::FField& field, acr::FAttrval* parent, acr::FAttrval& row) {
+    bool left = false;
+    while(parent != NULL){
+        left = tr_attrval_ElemLt(field, row, *parent);
+        acr::FAttrval* side = left ? parent->tr_attrval_left : parent->tr_attrval_right;
+        if(side == NULL){
+            break;
+        }
+        parent = side;
+    }
+    tr_attrval_Connect(parent, &row, left);
+}
+
+// --- acr.FField.tr_attrval.Insert
+// Insert row into the tree. If row is already in the tree, do nothing.
+void acr::tr_attrval_Insert(acr::FField& field, acr::FAttrval& row) {
+    if(!tr_attrval_InTreeQ(row)){
+        field.tr_attrval_n++;
+        tr_attrval_InsertImpl(field, field.tr_attrval_root, row);
+        field.tr_attrval_root = tr_attrval_Propagate(row);
+    }
+}
+
+// --- acr.FField.tr_attrval.Remove
+// Remove element from index. If element is not in index, do nothing.
+void acr::tr_attrval_Remove(acr::FField& field, acr::FAttrval& row) {
+    if(!tr_attrval_InTreeQ(row)){
+        return;
+    }
+    acr::FAttrval* next = NULL;
+    if(row.tr_attrval_depth > 1){
+        next = tr_attrval_Balance(row) < 0 ? tr_attrval_FirstImpl(row.tr_attrval_right) : tr_attrval_LastImpl(row.tr_attrval_left);
+        acr::FAttrval* leaf = tr_attrval_TallerChild(*next);
+        if(leaf){
+            tr_attrval_Turn(*leaf, *next);
+        }
+    }
+    acr::FAttrval* root = row.tr_attrval_up;
+    acr::FAttrval* prop = root;//propagate point
+    if(next){
+        prop = next->tr_attrval_up == &row ? next : next->tr_attrval_up;
+        tr_attrval_Disconnect(*next);
+        tr_attrval_Connect(next, row.tr_attrval_left, true);
+        tr_attrval_Connect(next, row.tr_attrval_right, false);
+    }
+    bool dir = root && root->tr_attrval_left == &row;
+    tr_attrval_Connect(root, next, dir);
+    field.tr_attrval_root = prop ? tr_attrval_Propagate(*prop) : NULL;
+    row.tr_attrval_depth = 0;
+    row.tr_attrval_left = NULL;
+    row.tr_attrval_right = NULL;
+    row.tr_attrval_up = (acr::FAttrval*)-1;
+    field.tr_attrval_n--;
+}
+
+// --- acr.FField.tr_attrval.RemoveFirst
+// If the tree is empty, return NULL. Otherwise unlink and return pointer to first element.
+void acr::tr_attrval_RemoveFirst(acr::FField& field) {
+    if(!tr_attrval_EmptyQ(field)){
+        tr_attrval_Remove(field, *tr_attrval_First(field));
+    }
+}
+
+// --- acr.FField.tr_attrval.Balance
+i32 acr::tr_attrval_Balance(acr::FAttrval& row) {
+    i32 left  = row.tr_attrval_left  ? row.tr_attrval_left->tr_attrval_depth  : 0;
+    i32 right = row.tr_attrval_right ? row.tr_attrval_right->tr_attrval_depth : 0;
+    return left - right;
+}
+
+// --- acr.FField.tr_attrval.Propagate
+// Recalculate depth and keep rebalancing if needed
+acr::FAttrval* acr::tr_attrval_Propagate(acr::FAttrval& pnode) {
+    acr::FAttrval *root = &pnode;
+    acr::FAttrval* node = &pnode;
+    while(node != NULL){
+        tr_attrval_updateDepth(*node);
+        tr_attrval_Rebalance(*node);
+        root = node;
+        node = node->tr_attrval_up;
+    }
+    return root;
+}
+
+// --- acr.FField.tr_attrval.TallerChild
+// Returns the child that has greater height.
+inline static acr::FAttrval* acr::tr_attrval_TallerChild(acr::FAttrval& node) {
+    return tr_attrval_Balance(node) < 0 ? node.tr_attrval_right : node.tr_attrval_left;
+}
+
+// --- acr.FField.tr_attrval.Disconnect
+// Disconnects the subtree(branch) from the parent
+static void acr::tr_attrval_Disconnect(acr::FAttrval& node) {
+    acr::FAttrval* parent = node.tr_attrval_up;
+    if(parent != NULL){
+        bool left = parent->tr_attrval_left == &node;
+        (left ? parent->tr_attrval_left : parent->tr_attrval_right) = NULL;
+    }
+    node.tr_attrval_up = NULL;
+}
+
+// --- acr.FField.tr_attrval.Rebalance
+// Rebalances the node if needed.
+void acr::tr_attrval_Rebalance(acr::FAttrval& node) {
+    if(Abs(tr_attrval_Balance(node)) > 1){
+        acr::FAttrval* deep1 = tr_attrval_TallerChild(node);
+        acr::FAttrval* deep2 = tr_attrval_TallerChild(*deep1);
+        bool turn = tr_attrval_Balance(*deep1)!=0 && (node.tr_attrval_left == deep1) != (deep1->tr_attrval_left == deep2);
+        if(turn){
+            tr_attrval_Turn(*deep2, *deep1);
+            TSwap(deep1, deep2);
+        }
+        tr_attrval_Turn(*deep1, node);
+        tr_attrval_updateDepth(node);
+        tr_attrval_updateDepth(*deep2);
+        tr_attrval_updateDepth(*deep1);
+    }
+}
+
+// --- acr.FField.tr_attrval.Next
+acr::FAttrval* acr::tr_attrval_Next(acr::FAttrval& node) {
+    acr::FAttrval *result = &node;
+    if(result->tr_attrval_right == NULL){
+        while(result->tr_attrval_up != NULL && result->tr_attrval_up->tr_attrval_right == result){
+            result = result->tr_attrval_up;
+        }
+        result = result->tr_attrval_up;
+    }else{
+        result = tr_attrval_FirstImpl(result->tr_attrval_right);
+    }
+    return result;
+}
+
+// --- acr.FField.tr_attrval.Prev
+acr::FAttrval* acr::tr_attrval_Prev(acr::FAttrval& node) {
+    acr::FAttrval *result = &node;
+    if(result->tr_attrval_left == NULL){
+        while(result->tr_attrval_up != NULL && result->tr_attrval_up->tr_attrval_left == result){
+            result = result->tr_attrval_up;
+        }
+        result = result->tr_attrval_up;
+    }else{
+        result = tr_attrval_LastImpl(result->tr_attrval_left);
+    }
+    return result;
+}
+
+// --- acr.FField.tr_attrval.LastImpl
+acr::FAttrval* acr::tr_attrval_LastImpl(acr::FAttrval* root) {
+    acr::FAttrval *result = root;
+    while(result != NULL && result->tr_attrval_right != NULL){
+        result = result->tr_attrval_right;
+    }
+    return result;
+}
+
+// --- acr.FField.tr_attrval.Last
+// Return pointer to the last(largest) element in tree
+acr::FAttrval* acr::tr_attrval_Last(acr::FField& field) {
+    return tr_attrval_LastImpl(field.tr_attrval_root);
+}
+
+// --- acr.FField.tr_attrval.ElemLt
+inline static bool acr::tr_attrval_ElemLt(acr::FField& field, acr::FAttrval &a, acr::FAttrval &b) {
+    (void)field;
+    return value_Lt(a, b);
+}
+
+// --- acr.FField.tr_attrval.UpdateDepth
+static void acr::tr_attrval_updateDepth(acr::FAttrval& node) {
+    i32 ldepth = node.tr_attrval_left  != NULL ? node.tr_attrval_left->tr_attrval_depth : 0;
+    i32 rdepth = node.tr_attrval_right != NULL ? node.tr_attrval_right->tr_attrval_depth : 0;
+    node.tr_attrval_depth = i32_Max(ldepth, rdepth) + 1;
+}
+
+// --- acr.FField.tr_attrval.Turn
+// rotates the tree in from->to direction
+static void acr::tr_attrval_Turn(acr::FAttrval& from, acr::FAttrval& to) {
+    acr::FAttrval* root = to.tr_attrval_up;
+    bool dir = root && root->tr_attrval_left == &to;
+    tr_attrval_Connect(root, &from, dir);
+    dir = to.tr_attrval_left == &from;
+    acr::FAttrval* orphan = (dir ? from.tr_attrval_right : from.tr_attrval_left);//other side
+    tr_attrval_Connect(&from, &to , !dir);
+    tr_attrval_Connect(&to, orphan, dir);
+}
+
+// --- acr.FField.tr_attrval.Connect
+inline static void acr::tr_attrval_Connect(acr::FAttrval* parent, acr::FAttrval* child, bool left) {
+    if(parent){
+        (left ? parent->tr_attrval_left : parent->tr_attrval_right) = child;
+    }
+    if(child){
+        child->tr_attrval_up = parent;
+    }
+}
+
+// --- acr.FField.tr_attrval.RemoveAllImpl
+// Empty the index. (rows may be deleted if cascdel)
+void acr::tr_attrval_RemoveAllImpl(acr::FField& field, acr::FAttrval* root, bool del) {
+    if(root != NULL){
+        tr_attrval_RemoveAllImpl(field, root->tr_attrval_left, del);
+        tr_attrval_RemoveAllImpl(field, root->tr_attrval_right, del);
+        tr_attrval_Disconnect(*root);
+        root->tr_attrval_depth = 0;//the pointers are taken care of by Disconnect
+        root->tr_attrval_up = (acr::FAttrval*)-1;//the pointers are taken care of by Disconnect
+    }
+}
+
+// --- acr.FField.tr_attrval.Reinsert
+// Reinsert a row with modified key(Reheap semantics)
+void acr::tr_attrval_Reinsert(acr::FField& field, acr::FAttrval& node) {
+    tr_attrval_Remove(field, node);
+    tr_attrval_Insert(field, node);
+}
+
+// --- acr.FField.tr_attrval.FirstGe
+// Find the first element that is greater or equal to a sortfld value
+acr::FAttrval* acr::tr_attrval_FirstGe(acr::FField& field, const algo::cstring& val) {
+    acr::FAttrval* result = field.tr_attrval_root;
+    bool left = false;
+    while(result){
+        left = !((*result).value < val);
+        acr::FAttrval* side = left ? result->tr_attrval_left : result->tr_attrval_right;
+        if(side==NULL){
+            break;
+        }
+        result = side;
+    }
+    while(result && (*result).value < val){
+        result = tr_attrval_Next(*result);
+    }
+    return result;
+}
+
+// --- acr.FField.tr_attrval.LastLt
+// Find the last element that is smaller or equal to a sortfld value
+acr::FAttrval* acr::tr_attrval_LastLt(acr::FField& field, const algo::cstring& val) {
+    acr::FAttrval* result = field.tr_attrval_root;
+    bool left = false;
+    while(result){
+        left = val < (*result).value;
+        acr::FAttrval* side = left ? result->tr_attrval_left : result->tr_attrval_right;
+        if(side==NULL){
+            break;
+        }
+        result = side;
+    }
+    while(result && !((*result).value < val)){
+        result = tr_attrval_Prev(*result);
+    }
+    return result;
+}
+
+// --- acr.FField.c_bad_rec.Insert
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void acr::c_bad_rec_Insert(acr::FField& field, acr::FRec& row) {
+    // reserve space
+    c_bad_rec_Reserve(field, 1);
+    u32 n  = field.c_bad_rec_n;
+    u32 at = n;
+    acr::FRec* *elems = field.c_bad_rec_elems;
+    elems[at] = &row;
+    field.c_bad_rec_n = n+1;
+
+}
+
+// --- acr.FField.c_bad_rec.ScanInsertMaybe
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool acr::c_bad_rec_ScanInsertMaybe(acr::FField& field, acr::FRec& row) {
+    bool retval = true;
+    u32 n  = field.c_bad_rec_n;
+    for (u32 i = 0; i < n; i++) {
+        if (field.c_bad_rec_elems[i] == &row) {
+            retval = false;
+            break;
+        }
+    }
+    if (retval) {
+        // reserve space
+        c_bad_rec_Reserve(field, 1);
+        field.c_bad_rec_elems[n] = &row;
+        field.c_bad_rec_n = n+1;
+    }
+    return retval;
+}
+
+// --- acr.FField.c_bad_rec.Remove
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void acr::c_bad_rec_Remove(acr::FField& field, acr::FRec& row) {
+    int lim = field.c_bad_rec_n;
+    acr::FRec* *elems = field.c_bad_rec_elems;
+    // search backward, so that most recently added element is found first.
+    // if found, shift array.
+    for (int i = lim-1; i>=0; i--) {
+        acr::FRec* elem = elems[i]; // fetch element
+        if (elem == &row) {
+            int j = i + 1;
+            size_t nbytes = sizeof(acr::FRec*) * (lim - j);
+            memmove(elems + i, elems + j, nbytes);
+            field.c_bad_rec_n = lim - 1;
+            break;
+        }
+    }
+}
+
+// --- acr.FField.c_bad_rec.Reserve
+// Reserve space in index for N more elements;
+void acr::c_bad_rec_Reserve(acr::FField& field, u32 n) {
+    u32 old_max = field.c_bad_rec_max;
+    if (UNLIKELY(field.c_bad_rec_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(acr::FRec*);
+        u32 new_size = new_max * sizeof(acr::FRec*);
+        void *new_mem = algo_lib::malloc_ReallocMem(field.c_bad_rec_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("acr.out_of_memory  field:acr.FField.c_bad_rec");
+        }
+        field.c_bad_rec_elems = (acr::FRec**)new_mem;
+        field.c_bad_rec_max = new_max;
+    }
+}
+
+// --- acr.FField..Init
+// Set all fields to initial values.
+void acr::FField_Init(acr::FField& field) {
+    field.reftype = algo::strptr("Val");
+    field.p_ctype = NULL;
+    field.p_arg = NULL;
+    field.c_substr = NULL;
+    field.max_attr_len = u32(0);
+    field.col_width = u32(0);
+    field.isfldfunc = bool(false);
+    field.anon = bool(false);
+    field.unique = bool(false);
+    // initialize hash table for acr::FAttrval;
+    field.ind_attrval_n             	= 0; // (acr.FField.ind_attrval)
+    field.ind_attrval_buckets_n     	= 4; // (acr.FField.ind_attrval)
+    field.ind_attrval_buckets_elems 	= (acr::FAttrval**)algo_lib::malloc_AllocMem(sizeof(acr::FAttrval*)*field.ind_attrval_buckets_n); // initial buckets (acr.FField.ind_attrval)
+    if (!field.ind_attrval_buckets_elems) {
+        FatalErrorExit("out of memory"); // (acr.FField.ind_attrval)
+    }
+    memset(field.ind_attrval_buckets_elems, 0, sizeof(acr::FAttrval*)*field.ind_attrval_buckets_n); // (acr.FField.ind_attrval)
+    field.tr_attrval_root = NULL; // (acr.FField.tr_attrval)
+    field.tr_attrval_n = 0;
+    field.attrval_built = bool(false);
+    field.c_bad_rec_elems = NULL; // (acr.FField.c_bad_rec)
+    field.c_bad_rec_n = 0; // (acr.FField.c_bad_rec)
+    field.c_bad_rec_max = 0; // (acr.FField.c_bad_rec)
+    field.ctype_c_field_in_ary = bool(false);
+    field.zd_arg_next = (acr::FField*)-1; // (acr.FCtype.zd_arg) not-in-list
+    field.zd_arg_prev = NULL; // (acr.FCtype.zd_arg)
+    field.ind_field_next = (acr::FField*)-1; // (acr.FDb.ind_field) not-in-hash
+}
+
+// --- acr.FField..Uninit
+void acr::FField_Uninit(acr::FField& field) {
+    acr::FField &row = field; (void)row;
+    acr::FCtype* p_ctype = acr::ind_ctype_Find(ctype_Get(row));
+    if (p_ctype)  {
+        c_field_Remove(*p_ctype, row);// remove field from index c_field
+    }
     ind_field_Remove(row); // remove field from index ind_field
     acr::FCtype* p_arg = acr::ind_ctype_Find(row.arg);
     if (p_arg)  {
         zd_arg_Remove(*p_arg, row);// remove field from index zd_arg
     }
+
+    // acr.FField.c_bad_rec.Uninit (Ptrary)  //Records with invalid reference (found by check thread)
+    algo_lib::malloc_FreeMem(field.c_bad_rec_elems, sizeof(acr::FRec*)*field.c_bad_rec_max); // (acr.FField.c_bad_rec)
+
+    // acr.FField.ind_attrval.Uninit (Thash)  //Secondary index of records by value (built on demand)
+    algo_lib::malloc_FreeMem(field.ind_attrval_buckets_elems, sizeof(acr::FAttrval*)*field.ind_attrval_buckets_n); // (acr.FField.ind_attrval)
 }
 
 // --- acr.FFile.zd_frec.Insert
@@ -5430,30 +6631,427 @@ acr::FRec* acr::zd_frec_RemoveFirst(acr::FFile& file) {
         *new_end = NULL;
         row->zd_frec_next = (acr::FRec*)-1; // mark as not-in-list
     }
-    return row;
+    return row;
+}
+
+// --- acr.FFile..Uninit
+void acr::FFile_Uninit(acr::FFile& file) {
+    acr::FFile &row = file; (void)row;
+    ind_file_Remove(row); // remove file from index ind_file
+}
+
+// --- acr.FFunique.base.CopyIn
+// Copy fields in to row
+void acr::funique_CopyIn(acr::FFunique &row, dmmeta::Funique &in) {
+    row.field = in.field;
+    // comment stripped, see dmmeta.fbase:acr.FFunique.base
+}
+
+// --- acr.FPdep..Uninit
+void acr::FPdep_Uninit(acr::FPdep& pdep) {
+    acr::FPdep &row = pdep; (void)row;
+    zd_pdep_Remove(row); // remove pdep from index zd_pdep
+    acr::FPline* p_p_parent = row.p_parent;
+    if (p_p_parent)  {
+        zd_child_Remove(*p_p_parent, row);// remove pdep from index zd_child
+    }
+}
+
+// --- acr.FPkeybuild.ent.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+acr::FPkeyent& acr::ent_Alloc(acr::FPkeybuild& pkeybuild) {
+    ent_Reserve(pkeybuild, 1);
+    int n  = pkeybuild.ent_n;
+    int at = n;
+    acr::FPkeyent *elems = pkeybuild.ent_elems;
+    new (elems + at) acr::FPkeyent(); // construct new element, default initializer
+    pkeybuild.ent_n = n+1;
+    return elems[at];
+}
+
+// --- acr.FPkeybuild.ent.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+acr::FPkeyent& acr::ent_AllocAt(acr::FPkeybuild& pkeybuild, int at) {
+    ent_Reserve(pkeybuild, 1);
+    int n  = pkeybuild.ent_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("acr.bad_alloc_at  field:acr.FPkeybuild.ent  comment:'index out of range'");
+    }
+    acr::FPkeyent *elems = pkeybuild.ent_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(acr::FPkeyent));
+    new (elems + at) acr::FPkeyent(); // construct element, default initializer
+    pkeybuild.ent_n = n+1;
+    return elems[at];
+}
+
+// --- acr.FPkeybuild.ent.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<acr::FPkeyent> acr::ent_AllocN(acr::FPkeybuild& pkeybuild, int n_elems) {
+    ent_Reserve(pkeybuild, n_elems);
+    int old_n  = pkeybuild.ent_n;
+    int new_n = old_n + n_elems;
+    acr::FPkeyent *elems = pkeybuild.ent_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) acr::FPkeyent(); // construct new element, default initialize
+    }
+    pkeybuild.ent_n = new_n;
+    return algo::aryptr<acr::FPkeyent>(elems + old_n, n_elems);
+}
+
+// --- acr.FPkeybuild.ent.Remove
+// Remove item by index. If index outside of range, do nothing.
+void acr::ent_Remove(acr::FPkeybuild& pkeybuild, u32 i) {
+    u32 lim = pkeybuild.ent_n;
+    acr::FPkeyent *elems = pkeybuild.ent_elems;
+    if (i < lim) {
+        elems[i].~FPkeyent(); // destroy element
+        memmove(elems + i, elems + (i + 1), sizeof(acr::FPkeyent) * (lim - (i + 1)));
+        pkeybuild.ent_n = lim - 1;
+    }
+}
+
+// --- acr.FPkeybuild.ent.RemoveAll
+void acr::ent_RemoveAll(acr::FPkeybuild& pkeybuild) {
+    u32 n = pkeybuild.ent_n;
+    while (n > 0) {
+        n -= 1;
+        pkeybuild.ent_elems[n].~FPkeyent();
+        pkeybuild.ent_n = n;
+    }
+}
+
+// --- acr.FPkeybuild.ent.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void acr::ent_RemoveLast(acr::FPkeybuild& pkeybuild) {
+    u64 n = pkeybuild.ent_n;
+    if (n > 0) {
+        n -= 1;
+        ent_qFind(pkeybuild, u64(n)).~FPkeyent();
+        pkeybuild.ent_n = n;
+    }
+}
+
+// --- acr.FPkeybuild.ent.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void acr::ent_AbsReserve(acr::FPkeybuild& pkeybuild, int n) {
+    u32 old_max  = pkeybuild.ent_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(pkeybuild.ent_elems, old_max * sizeof(acr::FPkeyent), new_max * sizeof(acr::FPkeyent));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("acr.tary_nomem  field:acr.FPkeybuild.ent  comment:'out of memory'");
+    }
+    pkeybuild.ent_elems = (acr::FPkeyent*)new_mem;
+    pkeybuild.ent_max = new_max;
+}
+
+// --- acr.FPkeybuild.ent.Setary
+// Copy contents of RHS to PARENT.
+void acr::ent_Setary(acr::FPkeybuild& pkeybuild, acr::FPkeybuild &rhs) {
+    ent_RemoveAll(pkeybuild);
+    int nnew = rhs.ent_n;
+    ent_Reserve(pkeybuild, nnew); // reserve space
+    for (int i = 0; i < nnew; i++) { // copy elements over
+        new (pkeybuild.ent_elems + i) acr::FPkeyent(ent_qFind(rhs, i));
+        pkeybuild.ent_n = i + 1;
+    }
+}
+
+// --- acr.FPkeybuild.ent.Swap
+// Swap values elem_a and elem_b
+inline static void acr::ent_Swap(acr::FPkeyent &elem_a, acr::FPkeyent &elem_b) {
+    u8 temp[sizeof(acr::FPkeyent)];
+    memcpy(&temp  , &elem_a, sizeof(acr::FPkeyent));
+    memcpy(&elem_a, &elem_b, sizeof(acr::FPkeyent));
+    memcpy(&elem_b, &temp  , sizeof(acr::FPkeyent));
+}
+
+// --- acr.FPkeybuild.ent.Rotleft
+// Left circular shift of three-tuple
+inline static void acr::ent_Rotleft(acr::FPkeyent &elem_a, acr::FPkeyent &elem_b, acr::FPkeyent &elem_c) {
+    u8 temp[sizeof(acr::FPkeyent)];
+    memcpy(&temp, &elem_a   , sizeof(acr::FPkeyent));
+    memcpy(&elem_a   , &elem_b   , sizeof(acr::FPkeyent));
+    memcpy(&elem_b   , &elem_c   , sizeof(acr::FPkeyent));
+    memcpy(&elem_c   , &temp, sizeof(acr::FPkeyent));
+}
+
+// --- acr.FPkeybuild.ent.Lt
+// Compare values elem_a and elem_b
+// The comparison function must be anti-symmetric: if a>b, then !(b>a).
+// If not, mayhem results.
+static bool acr::ent_Lt(acr::FPkeyent &elem_a, acr::FPkeyent &elem_b) {
+    bool ret;
+    ret = elem_a.key < elem_b.key;
+    return ret;
+}
+
+// --- acr.FPkeybuild.ent.SortedQ
+// Verify whether array is sorted
+bool acr::ent_SortedQ(acr::FPkeybuild& pkeybuild) {
+    acr::FPkeyent *elems = ent_Getary(pkeybuild).elems;
+    int n = ent_N(pkeybuild);
+    for (int i = 1; i < n; i++) {
+        if (ent_Lt(elems[i], elems[i-1])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// --- acr.FPkeybuild.ent.IntInsertionSort
+// Internal insertion sort
+static void acr::ent_IntInsertionSort(acr::FPkeyent *elems, int n) {
+    for (int i = 1; i < n; ++i) {
+        int j = i;
+        // find the spot for ith element.
+        while (j>0 && ent_Lt(elems[i], elems[j-1])) {
+            j--;
+        }
+        if (j<i) {
+            u8 tmp[sizeof(acr::FPkeyent)];
+            memcpy (tmp                       , &elems[i], sizeof(acr::FPkeyent)      );
+            memmove(&elems[j+1], &elems[j], sizeof(acr::FPkeyent)*(i-j));
+            memcpy (&elems[j]  , tmp                     , sizeof(acr::FPkeyent)      );
+        }
+    }
+}
+
+// --- acr.FPkeybuild.ent.IntHeapSort
+// Internal heap sort
+static void acr::ent_IntHeapSort(acr::FPkeyent *elems, int n) {
+    // construct max-heap.
+    // k=current element
+    // j=parent element
+    for (int i = 1; i < n; i++) {
+        int k=i;
+        int j=(i-1)/2;
+        while (ent_Lt(elems[j], elems[k])) {
+            ent_Swap(elems[k],elems[j]);
+            k=j;
+            j=(k-1)/2;
+        }
+    }
+    // remove elements from heap one-by-one,
+    // deposit them in reverse order starting at the end of ARY.
+    for (int i = n - 1; i>=0; i--) {
+        int k = 0;
+        int l = 1;
+        while (l<i) {
+            l += l<i-1 && ent_Lt(elems[l], elems[l+1]);
+            if (ent_Lt(elems[l], elems[i])) {
+                break;
+            }
+            ent_Swap(elems[k], elems[l]);
+            k = l;
+            l = k*2+1;
+        }
+        if (i != k) {
+            ent_Swap(elems[i],elems[k]);
+        }
+    }
+}
+
+// --- acr.FPkeybuild.ent.IntQuickSort
+// Quick sort engine
+static void acr::ent_IntQuickSort(acr::FPkeyent *elems, int n, int depth) {
+    while (n>16) {
+        // detect degenerate case and revert to heap sort
+        if (depth==0) {
+            ent_IntHeapSort(elems,n);
+            return;
+        }
+        // elements to sort initially to determine pivot.
+        // choose pp=n/2 in case the input is already sorted.
+        int pi = 0;
+        int pp = n/2;
+        int pj = n-1;
+        // insertion sort for 1st, middle and last element
+        if (ent_Lt(elems[pp], elems[pi])) {
+            ent_Swap(elems[pi], elems[pp]);
+        }
+        if (ent_Lt(elems[pj], elems[pp])) {
+            if (ent_Lt(elems[pj], elems[pi])) {
+                ent_Rotleft(elems[pi], elems[pj], elems[pp]);
+            } else {
+                ent_Swap(elems[pj], elems[pp]);
+            }
+        }
+        // deposit pivot near the end of the array and skip it.
+        ent_Swap(elems[--pj], elems[pp]);
+        // reference to pivot
+        acr::FPkeyent &pivot = elems[pj];
+        for(;;){
+            while (ent_Lt(elems[++pi], pivot)) {
+            }
+            while (ent_Lt(pivot, elems[--pj])) {
+            }
+            if (pj <= pi) {
+                break;
+            }
+            ent_Swap(elems[pi],elems[pj]);
+        }
+        depth -= 1;
+        ent_IntQuickSort(elems, pi, depth);
+        elems += pi;
+        n -= pi;
+    }
+    // sort the remainder of this section
+    ent_IntInsertionSort(elems,n);
+}
+
+// --- acr.FPkeybuild.ent.InsertionSort
+// Insertion sort
+void acr::ent_InsertionSort(acr::FPkeybuild& pkeybuild) {
+    acr::FPkeyent *elems = ent_Getary(pkeybuild).elems;
+    int n = ent_N(pkeybuild);
+    ent_IntInsertionSort(elems, n);
+}
+
+// --- acr.FPkeybuild.ent.HeapSort
+// Heap sort
+void acr::ent_HeapSort(acr::FPkeybuild& pkeybuild) {
+    acr::FPkeyent *elems = ent_Getary(pkeybuild).elems;
+    int n = ent_N(pkeybuild);
+    ent_IntHeapSort(elems, n);
+}
+
+// --- acr.FPkeybuild.ent.QuickSort
+// Quick sort
+void acr::ent_QuickSort(acr::FPkeybuild& pkeybuild) {
+    // compute max recursion depth based on number of elements in the array
+    int max_depth = CeilingLog2(u32(ent_N(pkeybuild) + 1)) + 3;
+    acr::FPkeyent *elems = ent_Getary(pkeybuild).elems;
+    int n = ent_N(pkeybuild);
+    ent_IntQuickSort(elems, n, max_depth);
+}
+
+// --- acr.FPkeybuild.ent.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool acr::ent_XrefMaybe(acr::FPkeyent &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- acr.FPkeybuild.ref.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+acr::FPkeyent& acr::ref_Alloc(acr::FPkeybuild& pkeybuild) {
+    ref_Reserve(pkeybuild, 1);
+    int n  = pkeybuild.ref_n;
+    int at = n;
+    acr::FPkeyent *elems = pkeybuild.ref_elems;
+    new (elems + at) acr::FPkeyent(); // construct new element, default initializer
+    pkeybuild.ref_n = n+1;
+    return elems[at];
+}
+
+// --- acr.FPkeybuild.ref.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+acr::FPkeyent& acr::ref_AllocAt(acr::FPkeybuild& pkeybuild, int at) {
+    ref_Reserve(pkeybuild, 1);
+    int n  = pkeybuild.ref_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("acr.bad_alloc_at  field:acr.FPkeybuild.ref  comment:'index out of range'");
+    }
+    acr::FPkeyent *elems = pkeybuild.ref_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(acr::FPkeyent));
+    new (elems + at) acr::FPkeyent(); // construct element, default initializer
+    pkeybuild.ref_n = n+1;
+    return elems[at];
+}
+
+// --- acr.FPkeybuild.ref.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<acr::FPkeyent> acr::ref_AllocN(acr::FPkeybuild& pkeybuild, int n_elems) {
+    ref_Reserve(pkeybuild, n_elems);
+    int old_n  = pkeybuild.ref_n;
+    int new_n = old_n + n_elems;
+    acr::FPkeyent *elems = pkeybuild.ref_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) acr::FPkeyent(); // construct new element, default initialize
+    }
+    pkeybuild.ref_n = new_n;
+    return algo::aryptr<acr::FPkeyent>(elems + old_n, n_elems);
+}
+
+// --- acr.FPkeybuild.ref.Remove
+// Remove item by index. If index outside of range, do nothing.
+void acr::ref_Remove(acr::FPkeybuild& pkeybuild, u32 i) {
+    u32 lim = pkeybuild.ref_n;
+    acr::FPkeyent *elems = pkeybuild.ref_elems;
+    if (i < lim) {
+        elems[i].~FPkeyent(); // destroy element
+        memmove(elems + i, elems + (i + 1), sizeof(acr::FPkeyent) * (lim - (i + 1)));
+        pkeybuild.ref_n = lim - 1;
+    }
+}
+
+// --- acr.FPkeybuild.ref.RemoveAll
+void acr::ref_RemoveAll(acr::FPkeybuild& pkeybuild) {
+    u32 n = pkeybuild.ref_n;
+    while (n > 0) {
+        n -= 1;
+        pkeybuild.ref_elems[n].~FPkeyent();
+        pkeybuild.ref_n = n;
+    }
+}
+
+// --- acr.FPkeybuild.ref.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void acr::ref_RemoveLast(acr::FPkeybuild& pkeybuild) {
+    u64 n = pkeybuild.ref_n;
+    if (n > 0) {
+        n -= 1;
+        ref_qFind(pkeybuild, u64(n)).~FPkeyent();
+        pkeybuild.ref_n = n;
+    }
+}
+
+// --- acr.FPkeybuild.ref.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void acr::ref_AbsReserve(acr::FPkeybuild& pkeybuild, int n) {
+    u32 old_max  = pkeybuild.ref_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(pkeybuild.ref_elems, old_max * sizeof(acr::FPkeyent), new_max * sizeof(acr::FPkeyent));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("acr.tary_nomem  field:acr.FPkeybuild.ref  comment:'out of memory'");
+    }
+    pkeybuild.ref_elems = (acr::FPkeyent*)new_mem;
+    pkeybuild.ref_max = new_max;
 }
 
-// --- acr.FFile..Uninit
-void acr::FFile_Uninit(acr::FFile& file) {
-    acr::FFile &row = file; (void)row;
-    ind_file_Remove(row); // remove file from index ind_file
+// --- acr.FPkeybuild.ref.Setary
+// Copy contents of RHS to PARENT.
+void acr::ref_Setary(acr::FPkeybuild& pkeybuild, acr::FPkeybuild &rhs) {
+    ref_RemoveAll(pkeybuild);
+    int nnew = rhs.ref_n;
+    ref_Reserve(pkeybuild, nnew); // reserve space
+    for (int i = 0; i < nnew; i++) { // copy elements over
+        new (pkeybuild.ref_elems + i) acr::FPkeyent(ref_qFind(rhs, i));
+        pkeybuild.ref_n = i + 1;
+    }
 }
 
-// --- acr.FFunique.base.CopyIn
-// Copy fields in to row
-void acr::funique_CopyIn(acr::FFunique &row, dmmeta::Funique &in) {
-    row.field = in.field;
-    // comment stripped, see dmmeta.fbase:acr.FFunique.base
-}
+// --- acr.FPkeybuild..Uninit
+void acr::FPkeybuild_Uninit(acr::FPkeybuild& pkeybuild) {
+    acr::FPkeybuild &row = pkeybuild; (void)row;
 
-// --- acr.FPdep..Uninit
-void acr::FPdep_Uninit(acr::FPdep& pdep) {
-    acr::FPdep &row = pdep; (void)row;
-    zd_pdep_Remove(row); // remove pdep from index zd_pdep
-    acr::FPline* p_p_parent = row.p_parent;
-    if (p_p_parent)  {
-        zd_child_Remove(*p_p_parent, row);// remove pdep from index zd_child
-    }
+    // acr.FPkeybuild.ref.Uninit (Tary)  //Values of reference fields, by record
+    // remove all elements from acr.FPkeybuild.ref
+    ref_RemoveAll(pkeybuild);
+    // free memory for Tary acr.FPkeybuild.ref
+    algo_lib::malloc_FreeMem(pkeybuild.ref_elems, sizeof(acr::FPkeyent)*pkeybuild.ref_max); // (acr.FPkeybuild.ref)
+
+    // acr.FPkeybuild.ent.Uninit (Tary)  //Entries of one index section, sorted by key
+    // remove all elements from acr.FPkeybuild.ent
+    ent_RemoveAll(pkeybuild);
+    // free memory for Tary acr.FPkeybuild.ent
+    algo_lib::malloc_FreeMem(pkeybuild.ent_elems, sizeof(acr::FPkeyent)*pkeybuild.ent_max); // (acr.FPkeybuild.ent)
 }
 
 // --- acr.PlineKey..Cmp
@@ -5610,7 +7208,8 @@ void acr::ind_printattr_Cascdel(acr::FPrint& print) {
 // --- acr.FPrint.ind_printattr.Find
 // Find row by key. Return NULL if not found.
 acr::FPrintAttr* acr::ind_printattr_Find(acr::FPrint& print, const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (print.ind_printattr_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (print.ind_printattr_buckets_n - 1);
     acr::FPrintAttr* *e = &print.ind_printattr_buckets_elems[index];
     acr::FPrintAttr* ret=NULL;
     do {
@@ -5628,7 +7227,8 @@ bool acr::ind_printattr_InsertMaybe(acr::FPrint& print, acr::FPrintAttr& row) {
     ind_printattr_Reserve(print, 1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_printattr_next == (acr::FPrintAttr*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (print.ind_printattr_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (print.ind_printattr_buckets_n - 1);
         acr::FPrintAttr* *prev = &print.ind_printattr_buckets_elems[index];
         do {
             acr::FPrintAttr* ret = *prev;
@@ -5654,7 +7254,8 @@ bool acr::ind_printattr_InsertMaybe(acr::FPrint& print, acr::FPrintAttr& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr::ind_printattr_Remove(acr::FPrint& print, acr::FPrintAttr& row) {
     if (LIKELY(row.ind_printattr_next != (acr::FPrintAttr*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (print.ind_printattr_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (print.ind_printattr_buckets_n - 1);
         acr::FPrintAttr* *prev = &print.ind_printattr_buckets_elems[index]; // addr of pointer to current element
         while (acr::FPrintAttr *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -5777,6 +7378,245 @@ void acr::c_pline_Reserve(acr::FPrint& print, u32 n) {
     }
 }
 
+// --- acr.FPrint.c_ctype.Insert
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void acr::c_ctype_Insert(acr::FPrint& print, acr::FCtype& row) {
+    // reserve space
+    c_ctype_Reserve(print, 1);
+    u32 n  = print.c_ctype_n;
+    u32 at = n;
+    acr::FCtype* *elems = print.c_ctype_elems;
+    elems[at] = &row;
+    print.c_ctype_n = n+1;
+
+}
+
+// --- acr.FPrint.c_ctype.ScanInsertMaybe
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool acr::c_ctype_ScanInsertMaybe(acr::FPrint& print, acr::FCtype& row) {
+    bool retval = true;
+    u32 n  = print.c_ctype_n;
+    for (u32 i = 0; i < n; i++) {
+        if (print.c_ctype_elems[i] == &row) {
+            retval = false;
+            break;
+        }
+    }
+    if (retval) {
+        // reserve space
+        c_ctype_Reserve(print, 1);
+        print.c_ctype_elems[n] = &row;
+        print.c_ctype_n = n+1;
+    }
+    return retval;
+}
+
+// --- acr.FPrint.c_ctype.Remove
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void acr::c_ctype_Remove(acr::FPrint& print, acr::FCtype& row) {
+    int lim = print.c_ctype_n;
+    acr::FCtype* *elems = print.c_ctype_elems;
+    // search backward, so that most recently added element is found first.
+    // if found, shift array.
+    for (int i = lim-1; i>=0; i--) {
+        acr::FCtype* elem = elems[i]; // fetch element
+        if (elem == &row) {
+            int j = i + 1;
+            size_t nbytes = sizeof(acr::FCtype*) * (lim - j);
+            memmove(elems + i, elems + j, nbytes);
+            print.c_ctype_n = lim - 1;
+            break;
+        }
+    }
+}
+
+// --- acr.FPrint.c_ctype.Reserve
+// Reserve space in index for N more elements;
+void acr::c_ctype_Reserve(acr::FPrint& print, u32 n) {
+    u32 old_max = print.c_ctype_max;
+    if (UNLIKELY(print.c_ctype_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(acr::FCtype*);
+        u32 new_size = new_max * sizeof(acr::FCtype*);
+        void *new_mem = algo_lib::malloc_ReallocMem(print.c_ctype_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("acr.out_of_memory  field:acr.FPrint.c_ctype");
+        }
+        print.c_ctype_elems = (acr::FCtype**)new_mem;
+        print.c_ctype_max = new_max;
+    }
+}
+
+// --- acr.FPrint.c_ctype.Swap
+// Swap values elem_a and elem_b
+inline static void acr::c_ctype_Swap(acr::FCtype* &elem_a, acr::FCtype* &elem_b) {
+    acr::FCtype *temp = elem_a;
+    elem_a = elem_b;
+    elem_b = temp;
+}
+
+// --- acr.FPrint.c_ctype.Rotleft
+// Left circular shift of three-tuple
+inline static void acr::c_ctype_Rotleft(acr::FCtype* &elem_a, acr::FCtype* &elem_b, acr::FCtype* &elem_c) {
+    acr::FCtype *temp = elem_a;
+    elem_a = elem_b;
+    elem_b = elem_c;
+    elem_c = temp;
+}
+
+// --- acr.FPrint.c_ctype.Lt
+// Compare values elem_a and elem_b
+// The comparison function must be anti-symmetric: if a>b, then !(b>a).
+// If not, mayhem results.
+static bool acr::c_ctype_Lt(acr::FCtype &elem_a, acr::FCtype &elem_b) {
+    bool ret;
+    ret = elem_a.rank < elem_b.rank;
+    return ret;
+}
+
+// --- acr.FPrint.c_ctype.SortedQ
+// Verify whether array is sorted
+bool acr::c_ctype_SortedQ(acr::FPrint& print) {
+    acr::FCtype* *elems = c_ctype_Getary(print).elems;
+    int n = c_ctype_N(print);
+    for (int i = 1; i < n; i++) {
+        if (c_ctype_Lt(*elems[i], *elems[i-1])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// --- acr.FPrint.c_ctype.IntInsertionSort
+// Internal insertion sort
+static void acr::c_ctype_IntInsertionSort(acr::FCtype* *elems, int n) {
+    for (int i = 1; i < n; ++i) {
+        int j = i;
+        acr::FCtype *tmp = elems[i];
+        // shift elements up by one
+        if (c_ctype_Lt(*tmp, *elems[j-1])) {
+            do {
+                elems[j] = elems[j-1];
+                j--;
+            } while (j>0 && c_ctype_Lt(*tmp, *elems[j-1]));
+            elems[j] = tmp;
+        }
+    }
+}
+
+// --- acr.FPrint.c_ctype.IntHeapSort
+// Internal heap sort
+static void acr::c_ctype_IntHeapSort(acr::FCtype* *elems, int n) {
+    // construct max-heap.
+    // k=current element
+    // j=parent element
+    for (int i = 1; i < n; i++) {
+        int k=i;
+        int j=(i-1)/2;
+        while (c_ctype_Lt(*elems[j], *elems[k])) {
+            c_ctype_Swap(elems[k],elems[j]);
+            k=j;
+            j=(k-1)/2;
+        }
+    }
+    // remove elements from heap one-by-one,
+    // deposit them in reverse order starting at the end of ARY.
+    for (int i = n - 1; i>=0; i--) {
+        int k = 0;
+        int l = 1;
+        while (l<i) {
+            l += l<i-1 && c_ctype_Lt(*elems[l], *elems[l+1]);
+            if (c_ctype_Lt(*elems[l], *elems[i])) {
+                break;
+            }
+            c_ctype_Swap(elems[k], elems[l]);
+            k = l;
+            l = k*2+1;
+        }
+        if (i != k) {
+            c_ctype_Swap(elems[i],elems[k]);
+        }
+    }
+}
+
+// --- acr.FPrint.c_ctype.IntQuickSort
+// Quick sort engine
+static void acr::c_ctype_IntQuickSort(acr::FCtype* *elems, int n, int depth) {
+    while (n>16) {
+        // detect degenerate case and revert to heap sort
+        if (depth==0) {
+            c_ctype_IntHeapSort(elems,n);
+            return;
+        }
+        // elements to sort initially to determine pivot.
+        // choose pp=n/2 in case the input is already sorted.
+        int pi = 0;
+        int pp = n/2;
+        int pj = n-1;
+        // insertion sort for 1st, middle and last element
+        if (c_ctype_Lt(*elems[pp], *elems[pi])) {
+            c_ctype_Swap(elems[pi], elems[pp]);
+        }
+        if (c_ctype_Lt(*elems[pj], *elems[pp])) {
+            if (c_ctype_Lt(*elems[pj], *elems[pi])) {
+                c_ctype_Rotleft(elems[pi], elems[pj], elems[pp]);
+            } else {
+                c_ctype_Swap(elems[pj], elems[pp]);
+            }
+        }
+        // deposit pivot near the end of the array and skip it.
+        c_ctype_Swap(elems[--pj], elems[pp]);
+        // copy pivot into temporary variable
+        acr::FCtype *pivot = elems[pj];
+        for(;;){
+            while (c_ctype_Lt(*elems[++pi], *pivot)) {
+            }
+            while (c_ctype_Lt(*pivot, *elems[--pj])) {
+            }
+            if (pj <= pi) {
+                break;
+            }
+            c_ctype_Swap(elems[pi],elems[pj]);
+        }
+        depth -= 1;
+        c_ctype_IntQuickSort(elems, pi, depth);
+        elems += pi;
+        n -= pi;
+    }
+    // sort the remainder of this section
+    c_ctype_IntInsertionSort(elems,n);
+}
+
+// --- acr.FPrint.c_ctype.InsertionSort
+// Insertion sort
+void acr::c_ctype_InsertionSort(acr::FPrint& print) {
+    acr::FCtype* *elems = c_ctype_Getary(print).elems;
+    int n = c_ctype_N(print);
+    c_ctype_IntInsertionSort(elems, n);
+}
+
+// --- acr.FPrint.c_ctype.HeapSort
+// Heap sort
+void acr::c_ctype_HeapSort(acr::FPrint& print) {
+    acr::FCtype* *elems = c_ctype_Getary(print).elems;
+    int n = c_ctype_N(print);
+    c_ctype_IntHeapSort(elems, n);
+}
+
+// --- acr.FPrint.c_ctype.QuickSort
+// Quick sort
+void acr::c_ctype_QuickSort(acr::FPrint& print) {
+    // compute max recursion depth based on number of elements in the array
+    int max_depth = CeilingLog2(u32(c_ctype_N(print) + 1)) + 3;
+    acr::FCtype* *elems = c_ctype_Getary(print).elems;
+    int n = c_ctype_N(print);
+    c_ctype_IntQuickSort(elems, n, max_depth);
+}
+
 // --- acr.FPrint..Init
 // Set all fields to initial values.
 void acr::FPrint_Init(acr::FPrint& print) {
@@ -5803,6 +7643,9 @@ void acr::FPrint_Init(acr::FPrint& print) {
     print.skip_line = i32(0);
     print.this_depth = i32(0);
     print.prev_depth = i32(0);
+    print.c_ctype_elems = NULL; // (acr.FPrint.c_ctype)
+    print.c_ctype_n = 0; // (acr.FPrint.c_ctype)
+    print.c_ctype_max = 0; // (acr.FPrint.c_ctype)
 }
 
 // --- acr.FPrint..Uninit
@@ -5810,6 +7653,9 @@ void acr::FPrint_Uninit(acr::FPrint& print) {
     acr::FPrint &row = print; (void)row;
     ind_printattr_Cascdel(print); // dmmeta.cascdel:acr.FPrint.ind_printattr
 
+    // acr.FPrint.c_ctype.Uninit (Ptrary)  //Ctypes of selected records, in rank order (non-tree print)
+    algo_lib::malloc_FreeMem(print.c_ctype_elems, sizeof(acr::FCtype*)*print.c_ctype_max); // (acr.FPrint.c_ctype)
+
     // acr.FPrint.c_pline.Uninit (Ptrary)  //Current print group
     algo_lib::malloc_FreeMem(print.c_pline_elems, sizeof(acr::FPline*)*print.c_pline_max); // (acr.FPrint.c_pline)
 
@@ -5882,129 +7728,45 @@ bool acr::value_SetStrptrMaybe(acr::Queryop& parent, algo::strptr rhs) {
                 case LE_STR8('d','e','l','_','a','t','t','r'): {
                     value_SetEnum(parent,acr_Queryop_value_del_attr); ret = true; break;
                 }
-                case LE_STR8('s','e','t','_','a','t','t','r'): {
-                    value_SetEnum(parent,acr_Queryop_value_set_attr); ret = true; break;
-                }
-            }
-            break;
-        }
-        case 11: {
-            switch (ReadLE64(rhs.elems)) {
-                case LE_STR8('r','e','n','a','m','e','_','a'): {
-                    if (memcmp(rhs.elems+8,"ttr",3)==0) { value_SetEnum(parent,acr_Queryop_value_rename_attr); ret = true; break; }
-                    break;
-                }
-            }
-            break;
-        }
-        case 19: {
-            switch (ReadLE64(rhs.elems)) {
-                case LE_STR8('f','i','n','i','s','h','_','r'): {
-                    if (memcmp(rhs.elems+8,"ename_field",11)==0) { value_SetEnum(parent,acr_Queryop_value_finish_rename_field); ret = true; break; }
-                    break;
-                }
-            }
-            break;
-        }
-    }
-    return ret;
-}
-
-// --- acr.Queryop.value.SetStrptr
-// Convert string to field.
-// If the string is invalid, set numeric value to DFLT
-void acr::value_SetStrptr(acr::Queryop& parent, algo::strptr rhs, acr_Queryop_value_Enum dflt) {
-    if (!value_SetStrptrMaybe(parent,rhs)) value_SetEnum(parent,dflt);
-}
-
-// --- acr.Queryop..Print
-// print string representation of acr::Queryop to string LHS, no header -- cprint:acr.Queryop.String
-void acr::Queryop_Print(acr::Queryop & row, algo::cstring &str) {
-    acr::value_Print(row, str);
-}
-
-// --- acr.FQuery..Init
-// Set all fields to initial values.
-void acr::FQuery_Init(acr::FQuery& query) {
-    query.field = algo::strptr("");
-    query.value = algo::strptr("");
-    query.new_val = algo::strptr("");
-    query.pk = bool(false);
-    query.nup = i32(0);
-    query.ndown = i32(0);
-    query.unused = bool(false);
-    query.regx_ssimfile = algo::strptr("");
-    query.ctype = algo::strptr("");
-    query.delrec = bool(false);
-    query.query_next = (acr::FQuery*)-1; // (acr.FDb.query) not-in-tpool's freelist
-    query.zs_query_next = (acr::FQuery*)-1; // (acr.FDb.zs_query) not-in-list
-}
-
-// --- acr.FQuery..Uninit
-void acr::FQuery_Uninit(acr::FQuery& query) {
-    acr::FQuery &row = query; (void)row;
-    zs_query_Remove(row); // remove query from index zs_query
-}
-
-// --- acr.RecSortkey..Print
-// print string representation of acr::RecSortkey to string LHS, no header -- cprint:acr.RecSortkey.String
-void acr::RecSortkey_Print(acr::RecSortkey & row, algo::cstring &str) {
-    algo::tempstr temp;
-    str << "acr.RecSortkey";
-
-    double_Print(row.num, temp);
-    PrintAttrSpaceReset(str,"num", temp);
-
-    algo::cstring_Print(row.str, temp);
-    PrintAttrSpaceReset(str,"str", temp);
-
-    float_Print(row.rowid, temp);
-    PrintAttrSpaceReset(str,"rowid", temp);
+                case LE_STR8('s','e','t','_','a','t','t','r'): {
+                    value_SetEnum(parent,acr_Queryop_value_set_attr); ret = true; break;
+                }
+            }
+            break;
+        }
+        case 11: {
+            switch (ReadLE64(rhs.elems)) {
+                case LE_STR8('r','e','n','a','m','e','_','a'): {
+                    if (memcmp(rhs.elems+8,"ttr",3)==0) { value_SetEnum(parent,acr_Queryop_value_rename_attr); ret = true; break; }
+                    break;
+                }
+            }
+            break;
+        }
+        case 19: {
+            switch (ReadLE64(rhs.elems)) {
+                case LE_STR8('f','i','n','i','s','h','_','r'): {
+                    if (memcmp(rhs.elems+8,"ename_field",11)==0) { value_SetEnum(parent,acr_Queryop_value_finish_rename_field); ret = true; break; }
+                    break;
+                }
+            }
+            break;
+        }
+    }
+    return ret;
 }
 
-// --- acr.FRec..Init
-// Set all fields to initial values.
-void acr::FRec_Init(acr::FRec& rec) {
-    rec.del = bool(false);
-    rec.mod = bool(false);
-    rec.metasel = bool(false);
-    rec.isnew = bool(false);
-    rec.seldist = i32(0);
-    rec.c_pline = NULL;
-    rec.p_outfile = NULL;
-    rec.p_infile = NULL;
-    rec.p_ctype = NULL;
-    rec.lineno = i32(0);
-    rec.zd_trec_next = (acr::FRec*)-1; // (acr.FCtype.zd_trec) not-in-list
-    rec.zd_trec_prev = NULL; // (acr.FCtype.zd_trec)
-    rec.ind_rec_next = (acr::FRec*)-1; // (acr.FCtype.ind_rec) not-in-hash
-    rec.zd_selrec_next = (acr::FRec*)-1; // (acr.FCtype.zd_selrec) not-in-list
-    rec.zd_selrec_prev = NULL; // (acr.FCtype.zd_selrec)
-    rec.rec_next = (acr::FRec*)-1; // (acr.FDb.rec) not-in-tpool's freelist
-    rec.zd_all_selrec_next = (acr::FRec*)-1; // (acr.FDb.zd_all_selrec) not-in-list
-    rec.zd_all_selrec_prev = NULL; // (acr.FDb.zd_all_selrec)
-    rec.zd_frec_next = (acr::FRec*)-1; // (acr.FFile.zd_frec) not-in-list
-    rec.zd_frec_prev = NULL; // (acr.FFile.zd_frec)
+// --- acr.Queryop.value.SetStrptr
+// Convert string to field.
+// If the string is invalid, set numeric value to DFLT
+void acr::value_SetStrptr(acr::Queryop& parent, algo::strptr rhs, acr_Queryop_value_Enum dflt) {
+    if (!value_SetStrptrMaybe(parent,rhs)) value_SetEnum(parent,dflt);
 }
 
-// --- acr.FRec..Uninit
-void acr::FRec_Uninit(acr::FRec& rec) {
-    acr::FRec &row = rec; (void)row;
-    zd_all_selrec_Remove(row); // remove rec from index zd_all_selrec
-    acr::FFile* p_p_outfile = row.p_outfile;
-    if (p_p_outfile)  {
-        zd_frec_Remove(*p_p_outfile, row);// remove rec from index zd_frec
-    }
-    acr::FCtype* p_p_ctype = row.p_ctype;
-    if (p_p_ctype)  {
-        ind_rec_Remove(*p_p_ctype, row);// remove rec from index ind_rec
-    }
-    if (p_p_ctype)  {
-        zd_selrec_Remove(*p_p_ctype, row);// remove rec from index zd_selrec
-    }
-    if (p_p_ctype)  {
-        zd_trec_Remove(*p_p_ctype, row);// remove rec from index zd_trec
-    }
+// --- acr.Queryop..Print
+// print string representation of acr::Queryop to string LHS, no header -- cprint:acr.Queryop.String
+void acr::Queryop_Print(acr::Queryop & row, algo::cstring &str) {
+    acr::value_Print(row, str);
 }
 
 // --- acr.FRun.c_ctype.Insert
@@ -6153,48 +7915,258 @@ void acr::c_field_Reserve(acr::FRun& run, u32 n) {
     }
 }
 
-// --- acr.FRun.c_rec.Insert
+// --- acr.FRun.c_rec.Insert
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void acr::c_rec_Insert(acr::FRun& run, acr::FRec& row) {
+    // reserve space
+    c_rec_Reserve(run, 1);
+    u32 n  = run.c_rec_n;
+    u32 at = n;
+    acr::FRec* *elems = run.c_rec_elems;
+    elems[at] = &row;
+    run.c_rec_n = n+1;
+
+}
+
+// --- acr.FRun.c_rec.ScanInsertMaybe
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool acr::c_rec_ScanInsertMaybe(acr::FRun& run, acr::FRec& row) {
+    bool retval = true;
+    u32 n  = run.c_rec_n;
+    for (u32 i = 0; i < n; i++) {
+        if (run.c_rec_elems[i] == &row) {
+            retval = false;
+            break;
+        }
+    }
+    if (retval) {
+        // reserve space
+        c_rec_Reserve(run, 1);
+        run.c_rec_elems[n] = &row;
+        run.c_rec_n = n+1;
+    }
+    return retval;
+}
+
+// --- acr.FRun.c_rec.Remove
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void acr::c_rec_Remove(acr::FRun& run, acr::FRec& row) {
+    int lim = run.c_rec_n;
+    acr::FRec* *elems = run.c_rec_elems;
+    // search backward, so that most recently added element is found first.
+    // if found, shift array.
+    for (int i = lim-1; i>=0; i--) {
+        acr::FRec* elem = elems[i]; // fetch element
+        if (elem == &row) {
+            int j = i + 1;
+            size_t nbytes = sizeof(acr::FRec*) * (lim - j);
+            memmove(elems + i, elems + j, nbytes);
+            run.c_rec_n = lim - 1;
+            break;
+        }
+    }
+}
+
+// --- acr.FRun.c_rec.Reserve
+// Reserve space in index for N more elements;
+void acr::c_rec_Reserve(acr::FRun& run, u32 n) {
+    u32 old_max = run.c_rec_max;
+    if (UNLIKELY(run.c_rec_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(acr::FRec*);
+        u32 new_size = new_max * sizeof(acr::FRec*);
+        void *new_mem = algo_lib::malloc_ReallocMem(run.c_rec_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("acr.out_of_memory  field:acr.FRun.c_rec");
+        }
+        run.c_rec_elems = (acr::FRec**)new_mem;
+        run.c_rec_max = new_max;
+    }
+}
+
+// --- acr.FRun.c_child.Insert
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void acr::c_child_Insert(acr::FRun& run, acr::FCtype& row) {
+    if (bool_Update(row.run_c_child_in_ary,true)) {
+        // reserve space
+        c_child_Reserve(run, 1);
+        u32 n  = run.c_child_n;
+        u32 at = n;
+        acr::FCtype* *elems = run.c_child_elems;
+        elems[at] = &row;
+        run.c_child_n = n+1;
+
+    }
+}
+
+// --- acr.FRun.c_child.InsertMaybe
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Return value: whether element was inserted into array.
+bool acr::c_child_InsertMaybe(acr::FRun& run, acr::FCtype& row) {
+    bool retval = !row.run_c_child_in_ary;
+    c_child_Insert(run,row); // check is performed in _Insert again
+    return retval;
+}
+
+// --- acr.FRun.c_child.Remove
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void acr::c_child_Remove(acr::FRun& run, acr::FCtype& row) {
+    if (bool_Update(row.run_c_child_in_ary,false)) {
+        int lim = run.c_child_n;
+        acr::FCtype* *elems = run.c_child_elems;
+        // search backward, so that most recently added element is found first.
+        // if found, shift array.
+        for (int i = lim-1; i>=0; i--) {
+            acr::FCtype* elem = elems[i]; // fetch element
+            if (elem == &row) {
+                int j = i + 1;
+                size_t nbytes = sizeof(acr::FCtype*) * (lim - j);
+                memmove(elems + i, elems + j, nbytes);
+                run.c_child_n = lim - 1;
+                break;
+            }
+        }
+    }
+}
+
+// --- acr.FRun.c_child.Reserve
+// Reserve space in index for N more elements;
+void acr::c_child_Reserve(acr::FRun& run, u32 n) {
+    u32 old_max = run.c_child_max;
+    if (UNLIKELY(run.c_child_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(acr::FCtype*);
+        u32 new_size = new_max * sizeof(acr::FCtype*);
+        void *new_mem = algo_lib::malloc_ReallocMem(run.c_child_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("acr.out_of_memory  field:acr.FRun.c_child");
+        }
+        run.c_child_elems = (acr::FCtype**)new_mem;
+        run.c_child_max = new_max;
+    }
+}
+
+// --- acr.FRun.c_query.Insert
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void acr::c_query_Insert(acr::FRun& run, acr::FQuery& row) {
+    // reserve space
+    c_query_Reserve(run, 1);
+    u32 n  = run.c_query_n;
+    u32 at = n;
+    acr::FQuery* *elems = run.c_query_elems;
+    elems[at] = &row;
+    run.c_query_n = n+1;
+
+}
+
+// --- acr.FRun.c_query.ScanInsertMaybe
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool acr::c_query_ScanInsertMaybe(acr::FRun& run, acr::FQuery& row) {
+    bool retval = true;
+    u32 n  = run.c_query_n;
+    for (u32 i = 0; i < n; i++) {
+        if (run.c_query_elems[i] == &row) {
+            retval = false;
+            break;
+        }
+    }
+    if (retval) {
+        // reserve space
+        c_query_Reserve(run, 1);
+        run.c_query_elems[n] = &row;
+        run.c_query_n = n+1;
+    }
+    return retval;
+}
+
+// --- acr.FRun.c_query.Remove
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void acr::c_query_Remove(acr::FRun& run, acr::FQuery& row) {
+    int lim = run.c_query_n;
+    acr::FQuery* *elems = run.c_query_elems;
+    // search backward, so that most recently added element is found first.
+    // if found, shift array.
+    for (int i = lim-1; i>=0; i--) {
+        acr::FQuery* elem = elems[i]; // fetch element
+        if (elem == &row) {
+            int j = i + 1;
+            size_t nbytes = sizeof(acr::FQuery*) * (lim - j);
+            memmove(elems + i, elems + j, nbytes);
+            run.c_query_n = lim - 1;
+            break;
+        }
+    }
+}
+
+// --- acr.FRun.c_query.Reserve
+// Reserve space in index for N more elements;
+void acr::c_query_Reserve(acr::FRun& run, u32 n) {
+    u32 old_max = run.c_query_max;
+    if (UNLIKELY(run.c_query_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(acr::FQuery*);
+        u32 new_size = new_max * sizeof(acr::FQuery*);
+        void *new_mem = algo_lib::malloc_ReallocMem(run.c_query_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("acr.out_of_memory  field:acr.FRun.c_query");
+        }
+        run.c_query_elems = (acr::FQuery**)new_mem;
+        run.c_query_max = new_max;
+    }
+}
+
+// --- acr.FRun.c_match.Insert
 // Insert pointer to row into array. Row must not already be in array.
 // If pointer is already in the array, it may be inserted twice.
-void acr::c_rec_Insert(acr::FRun& run, acr::FRec& row) {
+void acr::c_match_Insert(acr::FRun& run, acr::FRec& row) {
     // reserve space
-    c_rec_Reserve(run, 1);
-    u32 n  = run.c_rec_n;
+    c_match_Reserve(run, 1);
+    u32 n  = run.c_match_n;
     u32 at = n;
-    acr::FRec* *elems = run.c_rec_elems;
+    acr::FRec* *elems = run.c_match_elems;
     elems[at] = &row;
-    run.c_rec_n = n+1;
+    run.c_match_n = n+1;
 
 }
 
-// --- acr.FRun.c_rec.ScanInsertMaybe
+// --- acr.FRun.c_match.ScanInsertMaybe
 // Insert pointer to row in array.
 // If row is already in the array, do nothing.
 // Linear search is used to locate the element.
 // Return value: whether element was inserted into array.
-bool acr::c_rec_ScanInsertMaybe(acr::FRun& run, acr::FRec& row) {
+bool acr::c_match_ScanInsertMaybe(acr::FRun& run, acr::FRec& row) {
     bool retval = true;
-    u32 n  = run.c_rec_n;
+    u32 n  = run.c_match_n;
     for (u32 i = 0; i < n; i++) {
-        if (run.c_rec_elems[i] == &row) {
+        if (run.c_match_elems[i] == &row) {
             retval = false;
             break;
         }
     }
     if (retval) {
         // reserve space
-        c_rec_Reserve(run, 1);
-        run.c_rec_elems[n] = &row;
-        run.c_rec_n = n+1;
+        c_match_Reserve(run, 1);
+        run.c_match_elems[n] = &row;
+        run.c_match_n = n+1;
     }
     return retval;
 }
 
-// --- acr.FRun.c_rec.Remove
+// --- acr.FRun.c_match.Remove
 // Find element using linear scan. If element is in array, remove, otherwise do nothing
-void acr::c_rec_Remove(acr::FRun& run, acr::FRec& row) {
-    int lim = run.c_rec_n;
-    acr::FRec* *elems = run.c_rec_elems;
+void acr::c_match_Remove(acr::FRun& run, acr::FRec& row) {
+    int lim = run.c_match_n;
+    acr::FRec* *elems = run.c_match_elems;
     // search backward, so that most recently added element is found first.
     // if found, shift array.
     for (int i = lim-1; i>=0; i--) {
@@ -6203,108 +8175,213 @@ void acr::c_rec_Remove(acr::FRun& run, acr::FRec& row) {
             int j = i + 1;
             size_t nbytes = sizeof(acr::FRec*) * (lim - j);
             memmove(elems + i, elems + j, nbytes);
-            run.c_rec_n = lim - 1;
+            run.c_match_n = lim - 1;
             break;
         }
     }
 }
 
-// --- acr.FRun.c_rec.Reserve
+// --- acr.FRun.c_match.Reserve
 // Reserve space in index for N more elements;
-void acr::c_rec_Reserve(acr::FRun& run, u32 n) {
-    u32 old_max = run.c_rec_max;
-    if (UNLIKELY(run.c_rec_n + n > old_max)) {
+void acr::c_match_Reserve(acr::FRun& run, u32 n) {
+    u32 old_max = run.c_match_max;
+    if (UNLIKELY(run.c_match_n + n > old_max)) {
         u32 new_max  = u32_Max(4, old_max * 2);
         u32 old_size = old_max * sizeof(acr::FRec*);
         u32 new_size = new_max * sizeof(acr::FRec*);
-        void *new_mem = algo_lib::malloc_ReallocMem(run.c_rec_elems, old_size, new_size);
+        void *new_mem = algo_lib::malloc_ReallocMem(run.c_match_elems, old_size, new_size);
         if (UNLIKELY(!new_mem)) {
-            FatalErrorExit("acr.out_of_memory  field:acr.FRun.c_rec");
+            FatalErrorExit("acr.out_of_memory  field:acr.FRun.c_match");
         }
-        run.c_rec_elems = (acr::FRec**)new_mem;
-        run.c_rec_max = new_max;
+        run.c_match_elems = (acr::FRec**)new_mem;
+        run.c_match_max = new_max;
     }
 }
 
-// --- acr.FRun.c_child.Insert
+// --- acr.FRun..Uninit
+void acr::FRun_Uninit(acr::FRun& run) {
+    acr::FRun &row = run; (void)row;
+
+    // acr.FRun.c_match.Uninit (Ptrary)  //Records matched by batched query, in visiting order
+    algo_lib::malloc_FreeMem(run.c_match_elems, sizeof(acr::FRec*)*run.c_match_max); // (acr.FRun.c_match)
+
+    // acr.FRun.c_query.Uninit (Ptrary)  //Queries run as one batch (see RunAllQueries)
+    algo_lib::malloc_FreeMem(run.c_query_elems, sizeof(acr::FQuery*)*run.c_query_max); // (acr.FRun.c_query)
+
+    // acr.FRun.c_child.Uninit (Ptrary)  //Down front (for -ndown)
+    algo_lib::malloc_FreeMem(run.c_child_elems, sizeof(acr::FCtype*)*run.c_child_max); // (acr.FRun.c_child)
+
+    // acr.FRun.c_rec.Uninit (Ptrary)  //
+    algo_lib::malloc_FreeMem(run.c_rec_elems, sizeof(acr::FRec*)*run.c_rec_max); // (acr.FRun.c_rec)
+
+    // acr.FRun.c_field.Uninit (Ptrary)  //
+    algo_lib::malloc_FreeMem(run.c_field_elems, sizeof(acr::FField*)*run.c_field_max); // (acr.FRun.c_field)
+
+    // acr.FRun.c_ctype.Uninit (Ptrary)  //Array of ctypes to check
+    algo_lib::malloc_FreeMem(run.c_ctype_elems, sizeof(acr::FCtype*)*run.c_ctype_max); // (acr.FRun.c_ctype)
+}
+
+// --- acr.FQuery..Init
+// Set all fields to initial values.
+void acr::FQuery_Init(acr::FQuery& query) {
+    query.field = algo::strptr("");
+    query.value = algo::strptr("");
+    query.new_val = algo::strptr("");
+    query.pk = bool(false);
+    query.nup = i32(0);
+    query.ndown = i32(0);
+    query.unused = bool(false);
+    query.regx_ssimfile = algo::strptr("");
+    query.ctype = algo::strptr("");
+    query.delrec = bool(false);
+    query.query_next = (acr::FQuery*)-1; // (acr.FDb.query) not-in-tpool's freelist
+    query.zs_query_next = (acr::FQuery*)-1; // (acr.FDb.zs_query) not-in-list
+}
+
+// --- acr.FQuery..Uninit
+void acr::FQuery_Uninit(acr::FQuery& query) {
+    acr::FQuery &row = query; (void)row;
+    zs_query_Remove(row); // remove query from index zs_query
+}
+
+// --- acr.RecSortkey..Print
+// print string representation of acr::RecSortkey to string LHS, no header -- cprint:acr.RecSortkey.String
+void acr::RecSortkey_Print(acr::RecSortkey & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "acr.RecSortkey";
+
+    double_Print(row.num, temp);
+    PrintAttrSpaceReset(str,"num", temp);
+
+    algo::cstring_Print(row.str, temp);
+    PrintAttrSpaceReset(str,"str", temp);
+
+    float_Print(row.rowid, temp);
+    PrintAttrSpaceReset(str,"rowid", temp);
+}
+
+// --- acr.FRec.c_parent.Insert
 // Insert pointer to row into array. Row must not already be in array.
 // If pointer is already in the array, it may be inserted twice.
-void acr::c_child_Insert(acr::FRun& run, acr::FCtype& row) {
-    if (bool_Update(row.run_c_child_in_ary,true)) {
-        // reserve space
-        c_child_Reserve(run, 1);
-        u32 n  = run.c_child_n;
-        u32 at = n;
-        acr::FCtype* *elems = run.c_child_elems;
-        elems[at] = &row;
-        run.c_child_n = n+1;
+void acr::c_parent_Insert(acr::FRec& rec, acr::FRec& row) {
+    // reserve space
+    c_parent_Reserve(rec, 1);
+    u32 n  = rec.c_parent_n;
+    u32 at = n;
+    acr::FRec* *elems = rec.c_parent_elems;
+    elems[at] = &row;
+    rec.c_parent_n = n+1;
 
-    }
 }
 
-// --- acr.FRun.c_child.InsertMaybe
+// --- acr.FRec.c_parent.ScanInsertMaybe
 // Insert pointer to row in array.
 // If row is already in the array, do nothing.
+// Linear search is used to locate the element.
 // Return value: whether element was inserted into array.
-bool acr::c_child_InsertMaybe(acr::FRun& run, acr::FCtype& row) {
-    bool retval = !row.run_c_child_in_ary;
-    c_child_Insert(run,row); // check is performed in _Insert again
+bool acr::c_parent_ScanInsertMaybe(acr::FRec& rec, acr::FRec& row) {
+    bool retval = true;
+    u32 n  = rec.c_parent_n;
+    for (u32 i = 0; i < n; i++) {
+        if (rec.c_parent_elems[i] == &row) {
+            retval = false;
+            break;
+        }
+    }
+    if (retval) {
+        // reserve space
+        c_parent_Reserve(rec, 1);
+        rec.c_parent_elems[n] = &row;
+        rec.c_parent_n = n+1;
+    }
     return retval;
 }
 
-// --- acr.FRun.c_child.Remove
+// --- acr.FRec.c_parent.Remove
 // Find element using linear scan. If element is in array, remove, otherwise do nothing
-void acr::c_child_Remove(acr::FRun& run, acr::FCtype& row) {
-    if (bool_Update(row.run_c_child_in_ary,false)) {
-        int lim = run.c_child_n;
-        acr::FCtype* *elems = run.c_child_elems;
-        // search backward, so that most recently added element is found first.
-        // if found, shift array.
-        for (int i = lim-1; i>=0; i--) {
-            acr::FCtype* elem = elems[i]; // fetch element
-            if (elem == &row) {
-                int j = i + 1;
-                size_t nbytes = sizeof(acr::FCtype*) * (lim - j);
-                memmove(elems + i, elems + j, nbytes);
-                run.c_child_n = lim - 1;
-                break;
-            }
+void acr::c_parent_Remove(acr::FRec& rec, acr::FRec& row) {
+    int lim = rec.c_parent_n;
+    acr::FRec* *elems = rec.c_parent_elems;
+    // search backward, so that most recently added element is found first.
+    // if found, shift array.
+    for (int i = lim-1; i>=0; i--) {
+        acr::FRec* elem = elems[i]; // fetch element
+        if (elem == &row) {
+            int j = i + 1;
+            size_t nbytes = sizeof(acr::FRec*) * (lim - j);
+            memmove(elems + i, elems + j, nbytes);
+            rec.c_parent_n = lim - 1;
+            break;
         }
     }
 }
 
-// --- acr.FRun.c_child.Reserve
+// --- acr.FRec.c_parent.Reserve
 // Reserve space in index for N more elements;
-void acr::c_child_Reserve(acr::FRun& run, u32 n) {
-    u32 old_max = run.c_child_max;
-    if (UNLIKELY(run.c_child_n + n > old_max)) {
+void acr::c_parent_Reserve(acr::FRec& rec, u32 n) {
+    u32 old_max = rec.c_parent_max;
+    if (UNLIKELY(rec.c_parent_n + n > old_max)) {
         u32 new_max  = u32_Max(4, old_max * 2);
-        u32 old_size = old_max * sizeof(acr::FCtype*);
-        u32 new_size = new_max * sizeof(acr::FCtype*);
-        void *new_mem = algo_lib::malloc_ReallocMem(run.c_child_elems, old_size, new_size);
+        u32 old_size = old_max * sizeof(acr::FRec*);
+        u32 new_size = new_max * sizeof(acr::FRec*);
+        void *new_mem = algo_lib::malloc_ReallocMem(rec.c_parent_elems, old_size, new_size);
         if (UNLIKELY(!new_mem)) {
-            FatalErrorExit("acr.out_of_memory  field:acr.FRun.c_child");
+            FatalErrorExit("acr.out_of_memory  field:acr.FRec.c_parent");
         }
-        run.c_child_elems = (acr::FCtype**)new_mem;
-        run.c_child_max = new_max;
+        rec.c_parent_elems = (acr::FRec**)new_mem;
+        rec.c_parent_max = new_max;
     }
 }
 
-// --- acr.FRun..Uninit
-void acr::FRun_Uninit(acr::FRun& run) {
-    acr::FRun &row = run; (void)row;
-
-    // acr.FRun.c_child.Uninit (Ptrary)  //Down front (for -ndown)
-    algo_lib::malloc_FreeMem(run.c_child_elems, sizeof(acr::FCtype*)*run.c_child_max); // (acr.FRun.c_child)
-
-    // acr.FRun.c_rec.Uninit (Ptrary)  //
-    algo_lib::malloc_FreeMem(run.c_rec_elems, sizeof(acr::FRec*)*run.c_rec_max); // (acr.FRun.c_rec)
+// --- acr.FRec..Init
+// Set all fields to initial values.
+void acr::FRec_Init(acr::FRec& rec) {
+    rec.del = bool(false);
+    rec.mod = bool(false);
+    rec.metasel = bool(false);
+    rec.isnew = bool(false);
+    rec.seldist = i32(0);
+    rec.c_pline = NULL;
+    rec.p_outfile = NULL;
+    rec.p_infile = NULL;
+    rec.p_ctype = NULL;
+    rec.lineno = i32(0);
+    rec.c_parent_elems = NULL; // (acr.FRec.c_parent)
+    rec.c_parent_n = 0; // (acr.FRec.c_parent)
+    rec.c_parent_max = 0; // (acr.FRec.c_parent)
+    rec.zd_trec_next = (acr::FRec*)-1; // (acr.FCtype.zd_trec) not-in-list
+    rec.zd_trec_prev = NULL; // (acr.FCtype.zd_trec)
+    rec.ind_rec_next = (acr::FRec*)-1; // (acr.FCtype.ind_rec) not-in-hash
+    rec.zd_selrec_next = (acr::FRec*)-1; // (acr.FCtype.zd_selrec) not-in-list
+    rec.zd_selrec_prev = NULL; // (acr.FCtype.zd_selrec)
+    rec.rec_next = (acr::FRec*)-1; // (acr.FDb.rec) not-in-tpool's freelist
+    rec.zd_all_selrec_next = (acr::FRec*)-1; // (acr.FDb.zd_all_selrec) not-in-list
+    rec.zd_all_selrec_prev = NULL; // (acr.FDb.zd_all_selrec)
+    rec.zd_frec_next = (acr::FRec*)-1; // (acr.FFile.zd_frec) not-in-list
+    rec.zd_frec_prev = NULL; // (acr.FFile.zd_frec)
+}
 
-    // acr.FRun.c_field.Uninit (Ptrary)  //
-    algo_lib::malloc_FreeMem(run.c_field_elems, sizeof(acr::FField*)*run.c_field_max); // (acr.FRun.c_field)
+// --- acr.FRec..Uninit
+void acr::FRec_Uninit(acr::FRec& rec) {
+    acr::FRec &row = rec; (void)row;
+    zd_all_selrec_Remove(row); // remove rec from index zd_all_selrec
+    acr::FFile* p_p_outfile = row.p_outfile;
+    if (p_p_outfile)  {
+        zd_frec_Remove(*p_p_outfile, row);// remove rec from index zd_frec
+    }
+    acr::FCtype* p_p_ctype = row.p_ctype;
+    if (p_p_ctype)  {
+        ind_rec_Remove(*p_p_ctype, row);// remove rec from index ind_rec
+    }
+    if (p_p_ctype)  {
+        zd_selrec_Remove(*p_p_ctype, row);// remove rec from index zd_selrec
+    }
+    if (p_p_ctype)  {
+        zd_trec_Remove(*p_p_ctype, row);// remove rec from index zd_trec
+    }
 
-    // acr.FRun.c_ctype.Uninit (Ptrary)  //Array of ctypes to check
-    algo_lib::malloc_FreeMem(run.c_ctype_elems, sizeof(acr::FCtype*)*run.c_ctype_max); // (acr.FRun.c_ctype)
+    // acr.FRec.c_parent.Uninit (Ptrary)  //Records referenced by this record, in field order (see XrefBuild)
+    algo_lib::malloc_FreeMem(rec.c_parent_elems, sizeof(acr::FRec*)*rec.c_parent_max); // (acr.FRec.c_parent)
 }
 
 // --- acr.FSmallstr.base.CopyIn
@@ -6348,6 +8425,122 @@ algo::Smallstr50 acr::name_Get(acr::FSsimfile& ssimfile) {
     return ret;
 }
 
+// --- acr.FSsimfile.stagerow.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+acr::FStagerow& acr::stagerow_Alloc(acr::FSsimfile& ssimfile) {
+    stagerow_Reserve(ssimfile, 1);
+    int n  = ssimfile.stagerow_n;
+    int at = n;
+    acr::FStagerow *elems = ssimfile.stagerow_elems;
+    new (elems + at) acr::FStagerow(); // construct new element, default initializer
+    ssimfile.stagerow_n = n+1;
+    return elems[at];
+}
+
+// --- acr.FSsimfile.stagerow.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+acr::FStagerow& acr::stagerow_AllocAt(acr::FSsimfile& ssimfile, int at) {
+    stagerow_Reserve(ssimfile, 1);
+    int n  = ssimfile.stagerow_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("acr.bad_alloc_at  field:acr.FSsimfile.stagerow  comment:'index out of range'");
+    }
+    acr::FStagerow *elems = ssimfile.stagerow_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(acr::FStagerow));
+    new (elems + at) acr::FStagerow(); // construct element, default initializer
+    ssimfile.stagerow_n = n+1;
+    return elems[at];
+}
+
+// --- acr.FSsimfile.stagerow.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<acr::FStagerow> acr::stagerow_AllocN(acr::FSsimfile& ssimfile, int n_elems) {
+    stagerow_Reserve(ssimfile, n_elems);
+    int old_n  = ssimfile.stagerow_n;
+    int new_n = old_n + n_elems;
+    acr::FStagerow *elems = ssimfile.stagerow_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) acr::FStagerow(); // construct new element, default initialize
+    }
+    ssimfile.stagerow_n = new_n;
+    return algo::aryptr<acr::FStagerow>(elems + old_n, n_elems);
+}
+
+// --- acr.FSsimfile.stagerow.Remove
+// Remove item by index. If index outside of range, do nothing.
+void acr::stagerow_Remove(acr::FSsimfile& ssimfile, u32 i) {
+    u32 lim = ssimfile.stagerow_n;
+    acr::FStagerow *elems = ssimfile.stagerow_elems;
+    if (i < lim) {
+        elems[i].~FStagerow(); // destroy element
+        memmove(elems + i, elems + (i + 1), sizeof(acr::FStagerow) * (lim - (i + 1)));
+        ssimfile.stagerow_n = lim - 1;
+    }
+}
+
+// --- acr.FSsimfile.stagerow.RemoveAll
+void acr::stagerow_RemoveAll(acr::FSsimfile& ssimfile) {
+    u32 n = ssimfile.stagerow_n;
+    while (n > 0) {
+        n -= 1;
+        ssimfile.stagerow_elems[n].~FStagerow();
+        ssimfile.stagerow_n = n;
+    }
+}
+
+// --- acr.FSsimfile.stagerow.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void acr::stagerow_RemoveLast(acr::FSsimfile& ssimfile) {
+    u64 n = ssimfile.stagerow_n;
+    if (n > 0) {
+        n -= 1;
+        stagerow_qFind(ssimfile, u64(n)).~FStagerow();
+        ssimfile.stagerow_n = n;
+    }
+}
+
+// --- acr.FSsimfile.stagerow.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void acr::stagerow_AbsReserve(acr::FSsimfile& ssimfile, int n) {
+    u32 old_max  = ssimfile.stagerow_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(ssimfile.stagerow_elems, old_max * sizeof(acr::FStagerow), new_max * sizeof(acr::FStagerow));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("acr.tary_nomem  field:acr.FSsimfile.stagerow  comment:'out of memory'");
+    }
+    ssimfile.stagerow_elems = (acr::FStagerow*)new_mem;
+    ssimfile.stagerow_max = new_max;
+}
+
+// --- acr.FSsimfile.stagerow.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool acr::stagerow_XrefMaybe(acr::FStagerow &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- acr.FSsimfile..Init
+// Set all fields to initial values.
+void acr::FSsimfile_Init(acr::FSsimfile& ssimfile) {
+    ssimfile.c_file = NULL;
+    ssimfile.p_ctype = NULL;
+    ssimfile.c_ssimsort = NULL;
+    ssimfile.stage_ok = bool(false);
+    ssimfile.stagerow_elems 	= 0; // (acr.FSsimfile.stagerow)
+    ssimfile.stagerow_n     	= 0; // (acr.FSsimfile.stagerow)
+    ssimfile.stagerow_max   	= 0; // (acr.FSsimfile.stagerow)
+    ssimfile.partial = bool(false);
+    ssimfile.pkeyidx_tried = bool(false);
+    ssimfile.check_all = bool(false);
+    ssimfile.unchanged = bool(false);
+    ssimfile._db_c_stage_in_ary = bool(false);
+    ssimfile.ind_ssimfile_next = (acr::FSsimfile*)-1; // (acr.FDb.ind_ssimfile) not-in-hash
+}
+
 // --- acr.FSsimfile..Uninit
 void acr::FSsimfile_Uninit(acr::FSsimfile& ssimfile) {
     acr::FSsimfile &row = ssimfile; (void)row;
@@ -6356,6 +8549,12 @@ void acr::FSsimfile_Uninit(acr::FSsimfile& ssimfile) {
         c_ssimfile_Remove(*p_ctype, row);// remove ssimfile from index c_ssimfile
     }
     ind_ssimfile_Remove(row); // remove ssimfile from index ind_ssimfile
+
+    // acr.FSsimfile.stagerow.Uninit (Tary)  //Tuples parsed by loader thread, in file order
+    // remove all elements from acr.FSsimfile.stagerow
+    stagerow_RemoveAll(ssimfile);
+    // free memory for Tary acr.FSsimfile.stagerow
+    algo_lib::malloc_FreeMem(ssimfile.stagerow_elems, sizeof(acr::FStagerow)*ssimfile.stagerow_max); // (acr.FSsimfile.stagerow)
 }
 
 // --- acr.FSsimsort.base.CopyIn
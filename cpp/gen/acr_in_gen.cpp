@@ -44,6 +44,10 @@ const char *acr_in_help =
 "    -checkable            Ensure output passes acr -check. default: false\n"
 "    -verbose              Enable verbose mode\n"
 "    -debug                Enable debug mode\n"
+"    -unbuffered           Disable buffering of output\n"
+"    -snap                 Load inputs from binary snapshots in temp/\n"
+"    -nommap               Read input files instead of mapping them\n"
+"    -linebuf      int     Max. read buffer for piped input. default: 1048576\n"
 "    -version              Show version information\n"
 "    -sig                  Print SHA1 signatures for dispatches\n"
 "    -help                 Print this screen and exit\n"
@@ -376,7 +380,8 @@ bool acr_in::tuple_XrefMaybe(acr_in::FTuple &row) {
 // --- acr_in.FDb.ind_tuple.Find
 // Find row by key. Return NULL if not found.
 acr_in::FTuple* acr_in::ind_tuple_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_tuple_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_tuple_buckets_n - 1);
     acr_in::FTuple* *e = &_db.ind_tuple_buckets_elems[index];
     acr_in::FTuple* ret=NULL;
     do {
@@ -418,7 +423,8 @@ bool acr_in::ind_tuple_InsertMaybe(acr_in::FTuple& row) {
     ind_tuple_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_tuple_next == (acr_in::FTuple*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.key) & (_db.ind_tuple_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (_db.ind_tuple_buckets_n - 1);
         acr_in::FTuple* *prev = &_db.ind_tuple_buckets_elems[index];
         do {
             acr_in::FTuple* ret = *prev;
@@ -444,7 +450,8 @@ bool acr_in::ind_tuple_InsertMaybe(acr_in::FTuple& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_in::ind_tuple_Remove(acr_in::FTuple& row) {
     if (LIKELY(row.ind_tuple_next != (acr_in::FTuple*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.key) & (_db.ind_tuple_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (_db.ind_tuple_buckets_n - 1);
         acr_in::FTuple* *prev = &_db.ind_tuple_buckets_elems[index]; // addr of pointer to current element
         while (acr_in::FTuple *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -557,58 +564,86 @@ bool acr_in::InsertStrptrMaybe(algo::strptr str) {
         case acr_in_TableId_dmmeta_Finput: { // finput:acr_in.FDb.finput
             dmmeta::Finput elem;
             retval = dmmeta::Finput_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_in_TableId_dmmeta_Finput, &elem, sizeof(elem));
+            }
             retval = retval && finput_InputMaybe(elem);
             break;
         }
         case acr_in_TableId_dmmeta_Field: { // finput:acr_in.FDb.field
             dmmeta::Field elem;
             retval = dmmeta::Field_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_in_TableId_dmmeta_Field, &elem, sizeof(elem));
+            }
             retval = retval && field_InputMaybe(elem);
             break;
         }
         case acr_in_TableId_dmmeta_Ctype: { // finput:acr_in.FDb.ctype
             dmmeta::Ctype elem;
             retval = dmmeta::Ctype_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_in_TableId_dmmeta_Ctype, &elem, sizeof(elem));
+            }
             retval = retval && ctype_InputMaybe(elem);
             break;
         }
         case acr_in_TableId_dmmeta_Ssimfile: { // finput:acr_in.FDb.ssimfile
             dmmeta::Ssimfile elem;
             retval = dmmeta::Ssimfile_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_in_TableId_dmmeta_Ssimfile, &elem, sizeof(elem));
+            }
             retval = retval && ssimfile_InputMaybe(elem);
             break;
         }
         case acr_in_TableId_dmmeta_Ns: { // finput:acr_in.FDb.ns
             dmmeta::Ns elem;
             retval = dmmeta::Ns_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_in_TableId_dmmeta_Ns, &elem, sizeof(elem));
+            }
             retval = retval && ns_InputMaybe(elem);
             break;
         }
         case acr_in_TableId_dmmeta_Substr: { // finput:acr_in.FDb.substr
             dmmeta::Substr elem;
             retval = dmmeta::Substr_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_in_TableId_dmmeta_Substr, &elem, sizeof(elem));
+            }
             retval = retval && substr_InputMaybe(elem);
             break;
         }
         case acr_in_TableId_dmmeta_Dispsig: { // finput:acr_in.FDb.dispsig
             dmmeta::Dispsig elem;
             retval = dmmeta::Dispsig_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_in_TableId_dmmeta_Dispsig, &elem, sizeof(elem));
+            }
             retval = retval && dispsig_InputMaybe(elem);
             break;
         }
         case acr_in_TableId_dev_Target: { // finput:acr_in.FDb.target
             dev::Target elem;
             retval = dev::Target_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_in_TableId_dev_Target, &elem, sizeof(elem));
+            }
             retval = retval && target_InputMaybe(elem);
             break;
         }
         case acr_in_TableId_dev_Targdep: { // finput:acr_in.FDb.targdep
             dev::Targdep elem;
             retval = dev::Targdep_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_in_TableId_dev_Targdep, &elem, sizeof(elem));
+            }
             retval = retval && targdep_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -618,6 +653,99 @@ bool acr_in::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- acr_in.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool acr_in::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case acr_in_TableId_dmmeta_Finput: { // finput:acr_in.FDb.finput
+            dmmeta::Finput elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = finput_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_in_TableId_dmmeta_Field: { // finput:acr_in.FDb.field
+            dmmeta::Field elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = field_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_in_TableId_dmmeta_Ctype: { // finput:acr_in.FDb.ctype
+            dmmeta::Ctype elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ctype_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_in_TableId_dmmeta_Ssimfile: { // finput:acr_in.FDb.ssimfile
+            dmmeta::Ssimfile elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ssimfile_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_in_TableId_dmmeta_Ns: { // finput:acr_in.FDb.ns
+            dmmeta::Ns elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ns_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_in_TableId_dmmeta_Substr: { // finput:acr_in.FDb.substr
+            dmmeta::Substr elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = substr_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_in_TableId_dmmeta_Dispsig: { // finput:acr_in.FDb.dispsig
+            dmmeta::Dispsig elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = dispsig_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_in_TableId_dev_Target: { // finput:acr_in.FDb.target
+            dev::Target elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = target_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_in_TableId_dev_Targdep: { // finput:acr_in.FDb.targdep
+            dev::Targdep elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = targdep_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- acr_in.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool acr_in::LoadTuplesMaybe(algo::strptr root) {
@@ -627,7 +755,8 @@ bool acr_in::LoadTuplesMaybe(algo::strptr root) {
         , "dmmeta.finput", "dmmeta.ssimfile", "dmmeta.substr", "dev.target"
         , "dev.targdep"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, acr_in::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "acr_in", "921f0867652e8602d2f5e2203a234a6e634c2874"
+        , acr_in::InsertStrptrMaybe, acr_in::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -886,7 +1015,8 @@ bool acr_in::field_XrefMaybe(acr_in::FField &row) {
 // --- acr_in.FDb.ind_field.Find
 // Find row by key. Return NULL if not found.
 acr_in::FField* acr_in::ind_field_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_field_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_field_buckets_n - 1);
     acr_in::FField* *e = &_db.ind_field_buckets_elems[index];
     acr_in::FField* ret=NULL;
     do {
@@ -912,7 +1042,8 @@ bool acr_in::ind_field_InsertMaybe(acr_in::FField& row) {
     ind_field_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_field_next == (acr_in::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         acr_in::FField* *prev = &_db.ind_field_buckets_elems[index];
         do {
             acr_in::FField* ret = *prev;
@@ -938,7 +1069,8 @@ bool acr_in::ind_field_InsertMaybe(acr_in::FField& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_in::ind_field_Remove(acr_in::FField& row) {
     if (LIKELY(row.ind_field_next != (acr_in::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         acr_in::FField* *prev = &_db.ind_field_buckets_elems[index]; // addr of pointer to current element
         while (acr_in::FField *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1088,7 +1220,8 @@ bool acr_in::ctype_XrefMaybe(acr_in::FCtype &row) {
 // --- acr_in.FDb.ind_ctype.Find
 // Find row by key. Return NULL if not found.
 acr_in::FCtype* acr_in::ind_ctype_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ctype_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ctype_buckets_n - 1);
     acr_in::FCtype* *e = &_db.ind_ctype_buckets_elems[index];
     acr_in::FCtype* ret=NULL;
     do {
@@ -1130,7 +1263,8 @@ bool acr_in::ind_ctype_InsertMaybe(acr_in::FCtype& row) {
     ind_ctype_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ctype_next == (acr_in::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         acr_in::FCtype* *prev = &_db.ind_ctype_buckets_elems[index];
         do {
             acr_in::FCtype* ret = *prev;
@@ -1156,7 +1290,8 @@ bool acr_in::ind_ctype_InsertMaybe(acr_in::FCtype& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_in::ind_ctype_Remove(acr_in::FCtype& row) {
     if (LIKELY(row.ind_ctype_next != (acr_in::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         acr_in::FCtype* *prev = &_db.ind_ctype_buckets_elems[index]; // addr of pointer to current element
         while (acr_in::FCtype *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1412,7 +1547,8 @@ bool acr_in::ns_XrefMaybe(acr_in::FNs &row) {
 // --- acr_in.FDb.ind_ns.Find
 // Find row by key. Return NULL if not found.
 acr_in::FNs* acr_in::ind_ns_Find(const algo::strptr& key) {
-    u32 index = Smallstr16_Hash(0, key) & (_db.ind_ns_buckets_n - 1);
+    u32 hash  = Smallstr16_Hash(0, key);
+    u32 index = hash & (_db.ind_ns_buckets_n - 1);
     acr_in::FNs* *e = &_db.ind_ns_buckets_elems[index];
     acr_in::FNs* ret=NULL;
     do {
@@ -1454,7 +1590,8 @@ bool acr_in::ind_ns_InsertMaybe(acr_in::FNs& row) {
     ind_ns_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ns_next == (acr_in::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         acr_in::FNs* *prev = &_db.ind_ns_buckets_elems[index];
         do {
             acr_in::FNs* ret = *prev;
@@ -1480,7 +1617,8 @@ bool acr_in::ind_ns_InsertMaybe(acr_in::FNs& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_in::ind_ns_Remove(acr_in::FNs& row) {
     if (LIKELY(row.ind_ns_next != (acr_in::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         acr_in::FNs* *prev = &_db.ind_ns_buckets_elems[index]; // addr of pointer to current element
         while (acr_in::FNs *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1885,7 +2023,8 @@ bool acr_in::dispsig_XrefMaybe(acr_in::FDispsig &row) {
 // --- acr_in.FDb.ind_dispsig.Find
 // Find row by key. Return NULL if not found.
 acr_in::FDispsig* acr_in::ind_dispsig_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_dispsig_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_dispsig_buckets_n - 1);
     acr_in::FDispsig* *e = &_db.ind_dispsig_buckets_elems[index];
     acr_in::FDispsig* ret=NULL;
     do {
@@ -1911,7 +2050,8 @@ bool acr_in::ind_dispsig_InsertMaybe(acr_in::FDispsig& row) {
     ind_dispsig_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_dispsig_next == (acr_in::FDispsig*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.dispsig) & (_db.ind_dispsig_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.dispsig);
+        u32 index = hash & (_db.ind_dispsig_buckets_n - 1);
         acr_in::FDispsig* *prev = &_db.ind_dispsig_buckets_elems[index];
         do {
             acr_in::FDispsig* ret = *prev;
@@ -1937,7 +2077,8 @@ bool acr_in::ind_dispsig_InsertMaybe(acr_in::FDispsig& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_in::ind_dispsig_Remove(acr_in::FDispsig& row) {
     if (LIKELY(row.ind_dispsig_next != (acr_in::FDispsig*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.dispsig) & (_db.ind_dispsig_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.dispsig);
+        u32 index = hash & (_db.ind_dispsig_buckets_n - 1);
         acr_in::FDispsig* *prev = &_db.ind_dispsig_buckets_elems[index]; // addr of pointer to current element
         while (acr_in::FDispsig *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2206,7 +2347,8 @@ acr_in::FCtype* acr_in::zd_related_RemoveFirst() {
 // --- acr_in.FDb.ind_finput.Find
 // Find row by key. Return NULL if not found.
 acr_in::FFinput* acr_in::ind_finput_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_finput_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_finput_buckets_n - 1);
     acr_in::FFinput* *e = &_db.ind_finput_buckets_elems[index];
     acr_in::FFinput* ret=NULL;
     do {
@@ -2232,7 +2374,8 @@ bool acr_in::ind_finput_InsertMaybe(acr_in::FFinput& row) {
     ind_finput_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_finput_next == (acr_in::FFinput*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_finput_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_finput_buckets_n - 1);
         acr_in::FFinput* *prev = &_db.ind_finput_buckets_elems[index];
         do {
             acr_in::FFinput* ret = *prev;
@@ -2258,7 +2401,8 @@ bool acr_in::ind_finput_InsertMaybe(acr_in::FFinput& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_in::ind_finput_Remove(acr_in::FFinput& row) {
     if (LIKELY(row.ind_finput_next != (acr_in::FFinput*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_finput_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_finput_buckets_n - 1);
         acr_in::FFinput* *prev = &_db.ind_finput_buckets_elems[index]; // addr of pointer to current element
         while (acr_in::FFinput *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2426,7 +2570,8 @@ bool acr_in::target_XrefMaybe(acr_in::FTarget &row) {
 // --- acr_in.FDb.ind_target.Find
 // Find row by key. Return NULL if not found.
 acr_in::FTarget* acr_in::ind_target_Find(const algo::strptr& key) {
-    u32 index = Smallstr16_Hash(0, key) & (_db.ind_target_buckets_n - 1);
+    u32 hash  = Smallstr16_Hash(0, key);
+    u32 index = hash & (_db.ind_target_buckets_n - 1);
     acr_in::FTarget* *e = &_db.ind_target_buckets_elems[index];
     acr_in::FTarget* ret=NULL;
     do {
@@ -2452,7 +2597,8 @@ bool acr_in::ind_target_InsertMaybe(acr_in::FTarget& row) {
     ind_target_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_target_next == (acr_in::FTarget*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.target) & (_db.ind_target_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.target);
+        u32 index = hash & (_db.ind_target_buckets_n - 1);
         acr_in::FTarget* *prev = &_db.ind_target_buckets_elems[index];
         do {
             acr_in::FTarget* ret = *prev;
@@ -2478,7 +2624,8 @@ bool acr_in::ind_target_InsertMaybe(acr_in::FTarget& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void acr_in::ind_target_Remove(acr_in::FTarget& row) {
     if (LIKELY(row.ind_target_next != (acr_in::FTarget*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.target) & (_db.ind_target_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.target);
+        u32 index = hash & (_db.ind_target_buckets_n - 1);
         acr_in::FTarget* *prev = &_db.ind_target_buckets_elems[index]; // addr of pointer to current element
         while (acr_in::FTarget *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -31,22 +31,26 @@ namespace acr_my {
 const char *acr_my_help =
 "acr_my: ACR <-> MariaDB adaptor\n"
 "Usage: acr_my [options]\n"
-"    [nsdb]    string  Regx of ssim namespace (dmmeta.nsdb) to select\n"
-"    -in       string  Input directory or filename, - for stdin. default: \"data\"\n"
-"    -schema   string  Input directory or filename, - for stdin. default: \"data\"\n"
-"    -fldfunc          Evaluate fldfunc when printing tuple. default: false\n"
-"    -fkey             Enable foreign key constraints. default: false\n"
-"    -e                Alias for -start -shell -stop. default: false\n"
-"    -start            Start local mysql server. default: false\n"
-"    -stop             Stop local mysql server, saving data. default: false\n"
-"    -abort            Abort local mysql server, losing data. default: false\n"
-"    -shell            Connect to local mysql server. default: false\n"
-"    -serv             Start mysql with TCP/IP service enabled. default: false\n"
-"    -verbose          Enable verbose mode\n"
-"    -debug            Enable debug mode\n"
-"    -version          Show version information\n"
-"    -sig              Print SHA1 signatures for dispatches\n"
-"    -help             Print this screen and exit\n"
+"    [nsdb]       string  Regx of ssim namespace (dmmeta.nsdb) to select\n"
+"    -in          string  Input directory or filename, - for stdin. default: \"data\"\n"
+"    -schema      string  Input directory or filename, - for stdin. default: \"data\"\n"
+"    -fldfunc             Evaluate fldfunc when printing tuple. default: false\n"
+"    -fkey                Enable foreign key constraints. default: false\n"
+"    -e                   Alias for -start -shell -stop. default: false\n"
+"    -start               Start local mysql server. default: false\n"
+"    -stop                Stop local mysql server, saving data. default: false\n"
+"    -abort               Abort local mysql server, losing data. default: false\n"
+"    -shell               Connect to local mysql server. default: false\n"
+"    -serv                Start mysql with TCP/IP service enabled. default: false\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -236,16 +240,23 @@ bool acr_my::InsertStrptrMaybe(algo::strptr str) {
         case acr_my_TableId_dmmeta_Nsdb: { // finput:acr_my.FDb.nsdb
             dmmeta::Nsdb elem;
             retval = dmmeta::Nsdb_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_my_TableId_dmmeta_Nsdb, &elem, sizeof(elem));
+            }
             retval = retval && nsdb_InputMaybe(elem);
             break;
         }
         case acr_my_TableId_dmmeta_Ssimfile: { // finput:acr_my.FDb.ssimfile
             dmmeta::Ssimfile elem;
             retval = dmmeta::Ssimfile_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(acr_my_TableId_dmmeta_Ssimfile, &elem, sizeof(elem));
+            }
             retval = retval && ssimfile_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -255,6 +266,36 @@ bool acr_my::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- acr_my.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool acr_my::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case acr_my_TableId_dmmeta_Nsdb: { // finput:acr_my.FDb.nsdb
+            dmmeta::Nsdb elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = nsdb_InputMaybe(elem);
+            }
+            break;
+        }
+        case acr_my_TableId_dmmeta_Ssimfile: { // finput:acr_my.FDb.ssimfile
+            dmmeta::Ssimfile elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ssimfile_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- acr_my.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool acr_my::LoadTuplesMaybe(algo::strptr root) {
@@ -262,7 +303,8 @@ bool acr_my::LoadTuplesMaybe(algo::strptr root) {
     static const char *ssimfiles[] = {
         "dmmeta.nsdb", "dmmeta.ssimfile"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, acr_my::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "acr_my", "4af1104b912fd0ce532858d685766efe3c9836a6"
+        , acr_my::InsertStrptrMaybe, acr_my::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
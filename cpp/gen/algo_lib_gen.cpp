@@ -14,9 +14,12 @@
 #include "include/gen/algo_gen.inl.h"
 #include "include/gen/dmmeta_gen.h"
 #include "include/gen/dmmeta_gen.inl.h"
+#include "include/gen/report_gen.h"
+#include "include/gen/report_gen.inl.h"
 #include "include/gen/lib_prot_gen.h"
 #include "include/gen/lib_prot_gen.inl.h"
 //#pragma endinclude
+static thread_local algo_lib::lpool_Lpmag algo_lib_lpool_lpmag; // (algo_lib.FDb.lpool) per-thread magazine
 algo_lib::_db_bh_timehook_curs::~_db_bh_timehook_curs() {
     algo_lib::lpool_FreeMem(temp_elems, sizeof(void*) * temp_max);
 
@@ -24,17 +27,34 @@ algo_lib::_db_bh_timehook_curs::~_db_bh_timehook_curs() {
 
 #include <sys/wait.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
 namespace algo_lib {
+    // Map SIZE bytes at a 2MB boundary, so that the whole block can be backed by huge pages.
+    // Advise transparent huge pages and bind to NUMA node as configured, then populate.
+    // Failure of madvise or mbind is not an error: the block is then backed by regular pages.
+    // Return MAP_FAILED if out of memory.
+    static void*         sbrk_MapAdvised(u32 size);
+    // Push block onto shared free list for size class CELL. Caller holds the lock.
+    static void          lpool_FreeShared(lpool_Lpblock *blk, u64 cell);
+    // Move N blocks of size class CELL from magazine MAG to the shared free list
+    static void          lpool_Spill(algo_lib::lpool_Lpmag &mag, u64 cell, int n);
+    // Allocate block of size class CELL from the shared free lists. Caller holds the lock.
+    static u8*           lpool_AllocShared(u64 cell);
+    // Magazine MAG has no blocks of size class CELL: move up to 32 blocks
+    // from the shared free lists into MAG, and return one more block (NULL if out of memory).
+    static u8*           lpool_Refill(algo_lib::lpool_Lpmag &mag, u64 cell);
     // Load statically available data into tables, register tables and database.
     static void          InitReflection();
-    // Find new location for ROW starting at IDX
-    // NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
-    static int           bh_timehook_Downheap(algo_lib::FTimehook& row, int idx) __attribute__((nothrow));
-    // Find and return index of new location for element ROW in the heap, starting at index IDX.
-    // Move any elements along the way but do not modify ROW.
-    static int           bh_timehook_Upheap(algo_lib::FTimehook& row, int idx) __attribute__((nothrow));
+    // Find new location for heap element ELEM starting at IDX
+    // NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.
+    static int           bh_timehook_Downheap(_db_bh_timehook_elem elem, int idx) __attribute__((nothrow));
+    // Find and return index of new location for heap element ELEM, starting at index IDX.
+    // Move any elements along the way but do not store ELEM.
+    static int           bh_timehook_Upheap(_db_bh_timehook_elem elem, int idx) __attribute__((nothrow));
     static bool          bh_timehook_ElemLt(algo_lib::FTimehook &a, algo_lib::FTimehook &b) __attribute__((nothrow));
     static void          _db_bh_timehook_curs_Add(_db_bh_timehook_curs &curs, algo_lib::FTimehook& row);
+    // Compare two heap elements (dmmeta.bheap heaps only)
+    static bool          bh_timehook_HeapLt(_db_bh_timehook_elem a, _db_bh_timehook_elem b) __attribute__((nothrow));
     // find trace by row id (used to implement reflection)
     static algo::ImrowPtr trace_RowidFind(int t) __attribute__((nothrow));
     // Function return 1
@@ -203,6 +223,10 @@ bool algo_lib::Cmdline_ReadFieldMaybe(algo_lib::Cmdline &parent, algo::strptr fi
         case algo_lib_FieldId_version: retval = bool_ReadStrptrMaybe(parent.version, strval); break;
         case algo_lib_FieldId_sig: retval = bool_ReadStrptrMaybe(parent.sig, strval); break;
         case algo_lib_FieldId_signature: retval = bool_ReadStrptrMaybe(parent.signature, strval); break;
+        case algo_lib_FieldId_unbuffered: retval = bool_ReadStrptrMaybe(parent.unbuffered, strval); break;
+        case algo_lib_FieldId_nommap: retval = bool_ReadStrptrMaybe(parent.nommap, strval); break;
+        case algo_lib_FieldId_linebuf: retval = i32_ReadStrptrMaybe(parent.linebuf, strval); break;
+        case algo_lib_FieldId_snap: retval = bool_ReadStrptrMaybe(parent.snap, strval); break;
         default: break;
     }
     if (!retval) {
@@ -224,6 +248,21 @@ bool algo_lib::Cmdline_ReadTupleMaybe(algo_lib::Cmdline &parent, algo::Tuple &tu
     return retval;
 }
 
+// --- algo_lib.Cmdline..Init
+// Set all fields to initial values.
+void algo_lib::Cmdline_Init(algo_lib::Cmdline& parent) {
+    parent.verbose = u8(0);
+    parent.debug = u8(0);
+    parent.help = bool(false);
+    parent.version = bool(false);
+    parent.sig = bool(false);
+    parent.signature = bool(false);
+    parent.unbuffered = bool(false);
+    parent.nommap = bool(false);
+    parent.linebuf = i32(1048576);
+    parent.snap = bool(false);
+}
+
 // --- algo_lib.CsvParse.ary_tok.Alloc
 // Reserve space. Insert element at the end
 // The new element is initialized to a default value
@@ -334,6 +373,127 @@ void algo_lib::CsvParse_Print(algo_lib::CsvParse & row, algo::cstring &str) {
     PrintAttrSpaceReset(str,"sep", temp);
 }
 
+// --- algo_lib.FTemppool.tempclass.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool algo_lib::tempclass_XrefMaybe(algo_lib::FTempclass &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- algo_lib.FTemppool.spill.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+algo::cstring& algo_lib::spill_Alloc(algo_lib::FTemppool& parent) {
+    spill_Reserve(parent, 1);
+    int n  = parent.spill_n;
+    int at = n;
+    algo::cstring *elems = parent.spill_elems;
+    new (elems + at) algo::cstring(); // construct new element, default initializer
+    parent.spill_n = n+1;
+    return elems[at];
+}
+
+// --- algo_lib.FTemppool.spill.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+algo::cstring& algo_lib::spill_AllocAt(algo_lib::FTemppool& parent, int at) {
+    spill_Reserve(parent, 1);
+    int n  = parent.spill_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("algo_lib.bad_alloc_at  field:algo_lib.FTemppool.spill  comment:'index out of range'");
+    }
+    algo::cstring *elems = parent.spill_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(algo::cstring));
+    new (elems + at) algo::cstring(); // construct element, default initializer
+    parent.spill_n = n+1;
+    return elems[at];
+}
+
+// --- algo_lib.FTemppool.spill.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<algo::cstring> algo_lib::spill_AllocN(algo_lib::FTemppool& parent, int n_elems) {
+    spill_Reserve(parent, n_elems);
+    int old_n  = parent.spill_n;
+    int new_n = old_n + n_elems;
+    algo::cstring *elems = parent.spill_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) algo::cstring(); // construct new element, default initialize
+    }
+    parent.spill_n = new_n;
+    return algo::aryptr<algo::cstring>(elems + old_n, n_elems);
+}
+
+// --- algo_lib.FTemppool.spill.Remove
+// Remove item by index. If index outside of range, do nothing.
+void algo_lib::spill_Remove(algo_lib::FTemppool& parent, u32 i) {
+    u32 lim = parent.spill_n;
+    algo::cstring *elems = parent.spill_elems;
+    if (i < lim) {
+        elems[i].~cstring(); // destroy element
+        memmove(elems + i, elems + (i + 1), sizeof(algo::cstring) * (lim - (i + 1)));
+        parent.spill_n = lim - 1;
+    }
+}
+
+// --- algo_lib.FTemppool.spill.RemoveAll
+void algo_lib::spill_RemoveAll(algo_lib::FTemppool& parent) {
+    u32 n = parent.spill_n;
+    while (n > 0) {
+        n -= 1;
+        parent.spill_elems[n].~cstring();
+        parent.spill_n = n;
+    }
+}
+
+// --- algo_lib.FTemppool.spill.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void algo_lib::spill_RemoveLast(algo_lib::FTemppool& parent) {
+    u64 n = parent.spill_n;
+    if (n > 0) {
+        n -= 1;
+        spill_qFind(parent, u64(n)).~cstring();
+        parent.spill_n = n;
+    }
+}
+
+// --- algo_lib.FTemppool.spill.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void algo_lib::spill_AbsReserve(algo_lib::FTemppool& parent, int n) {
+    u32 old_max  = parent.spill_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::lpool_ReallocMem(parent.spill_elems, old_max * sizeof(algo::cstring), new_max * sizeof(algo::cstring));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("algo_lib.tary_nomem  field:algo_lib.FTemppool.spill  comment:'out of memory'");
+    }
+    parent.spill_elems = (algo::cstring*)new_mem;
+    parent.spill_max = new_max;
+}
+
+// --- algo_lib.FTemppool.spill.Setary
+// Copy contents of RHS to PARENT.
+void algo_lib::spill_Setary(algo_lib::FTemppool& parent, algo_lib::FTemppool &rhs) {
+    spill_RemoveAll(parent);
+    int nnew = rhs.spill_n;
+    spill_Reserve(parent, nnew); // reserve space
+    for (int i = 0; i < nnew; i++) { // copy elements over
+        new (parent.spill_elems + i) algo::cstring(spill_qFind(rhs, i));
+        parent.spill_n = i + 1;
+    }
+}
+
+// --- algo_lib.FTemppool..Uninit
+void algo_lib::FTemppool_Uninit(algo_lib::FTemppool& parent) {
+    algo_lib::FTemppool &row = parent; (void)row;
+
+    // algo_lib.FTemppool.spill.Uninit (Tary)  //Buffers released while a TempstrScope is open and the class is full
+    // remove all elements from algo_lib.FTemppool.spill
+    spill_RemoveAll(parent);
+    // free memory for Tary algo_lib.FTemppool.spill
+    algo_lib::lpool_FreeMem(parent.spill_elems, sizeof(algo::cstring)*parent.spill_max); // (algo_lib.FTemppool.spill)
+}
+
 // --- algo_lib.FFildes..Uninit
 void algo_lib::FFildes_Uninit(algo_lib::FFildes& fildes) {
     algo_lib::FFildes &row = fildes; (void)row;
@@ -473,6 +633,9 @@ void* algo_lib::sbrk_AllocMem(u32 size) {
                 _db.sbrk_huge_alloc += size;
             }
         }
+        if (ret == MAP_FAILED && (_db.sbrk_thp || _db.sbrk_numa_node >= 0)) {
+            ret = sbrk_MapAdvised(size);
+        }
         if (ret == MAP_FAILED) { // try regular mmap
             _db.sbrk_huge_limit = 0; // don't try huge pages again
             ret = mmap(0x0, size, prot, flags, 0, 0);
@@ -495,6 +658,48 @@ void* algo_lib::sbrk_AllocMem(u32 size) {
     return ret;
 }
 
+// --- algo_lib.FDb.sbrk.MapAdvised
+// Map SIZE bytes at a 2MB boundary, so that the whole block can be backed by huge pages.
+// Advise transparent huge pages and bind to NUMA node as configured, then populate.
+// Failure of madvise or mbind is not an error: the block is then backed by regular pages.
+// Return MAP_FAILED if out of memory.
+static void* algo_lib::sbrk_MapAdvised(u32 size) {
+#if defined(__MACH__) || __FreeBSD__>0
+    (void)size;
+    return MAP_FAILED;
+#else
+    u64 align = 1024*2048;
+    u8 *base = (u8*)mmap(0x0, size + align, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+    if (base == MAP_FAILED) {
+        return MAP_FAILED;
+    }
+    // trim to 2MB boundary
+    u8 *ret = (u8*)((u64(base) + align - 1) & ~(align - 1));
+    if (ret > base) {
+        munmap(base, ret - base);
+    }
+    munmap(ret + size, base + align - ret);
+#ifdef MADV_HUGEPAGE
+    if (_db.sbrk_thp && madvise(ret, size, MADV_HUGEPAGE) == 0) {
+        _db.sbrk_thp_alloc += size;
+    }
+#endif
+#ifdef SYS_mbind
+    unsigned long nodemask[16] = {}; // up to 1024 nodes; a node outside of the mask is not bound
+    u32 nodebits = sizeof(nodemask[0])*8;
+    if (_db.sbrk_numa_node >= 0 && u32(_db.sbrk_numa_node) < sizeof(nodemask)*8) {
+        nodemask[_db.sbrk_numa_node / nodebits] |= 1UL << (_db.sbrk_numa_node % nodebits);
+        // the kernel reads MAXNODE-1 bits
+        (void)syscall(SYS_mbind, ret, size, 1/*MPOL_PREFERRED*/, nodemask, sizeof(nodemask)*8 + 1, 0);
+    }
+#endif
+    for (u64 i = 0; i < size; i += 4096) { // populate, like MAP_POPULATE
+        ret[i] = 0;
+    }
+    return ret;
+#endif
+}
+
 // --- algo_lib.FDb.sbrk.FreeMem
 void algo_lib::sbrk_FreeMem(void *mem, u32 size) {
 #if defined(__MACH__) || __FreeBSD__>0
@@ -510,23 +715,82 @@ void algo_lib::sbrk_FreeMem(void *mem, u32 size) {
 
 // --- algo_lib.FDb.lpool.FreeMem
 // Free block of memory previously returned by Lpool.
+// Thread-safe: small blocks go to the calling thread's magazine.
 void algo_lib::lpool_FreeMem(void *mem, u64 size) {
     if (mem) {
         size = u64_Max(size,16); // enforce alignment
         u64 cell = u64_BitScanReverse(size-1) + 1;
-        lpool_Lpblock *temp = (lpool_Lpblock*)mem; // push  singly linked list
-        temp->next = _db.lpool_free[cell];
-        _db.lpool_free[cell] = temp;
+        lpool_Lpblock *temp = (lpool_Lpblock*)mem;
+        if (cell <= 16) {
+            algo_lib::lpool_Lpmag &mag = algo_lib_lpool_lpmag;
+            temp->next = mag.head[cell];
+            mag.head[cell] = temp;
+            mag.n[cell]++;
+            if (UNLIKELY(mag.n[cell] > 64)) {
+                lpool_Spill(mag, cell, 32);
+            }
+        } else {
+            pthread_mutex_lock(&_db.lpool_lock);
+            lpool_FreeShared(temp, cell);
+            pthread_mutex_unlock(&_db.lpool_lock);
+        }
     }
 }
 
+// --- algo_lib.FDb.lpool.FreeShared
+// Push block onto shared free list for size class CELL. Caller holds the lock.
+static void algo_lib::lpool_FreeShared(lpool_Lpblock *blk, u64 cell) {
+    blk->next = _db.lpool_free[cell];
+    _db.lpool_free[cell] = blk;
+}
+
+// --- algo_lib.FDb.lpool.Spill
+// Move N blocks of size class CELL from magazine MAG to the shared free list
+static void algo_lib::lpool_Spill(algo_lib::lpool_Lpmag &mag, u64 cell, int n) {
+    pthread_mutex_lock(&_db.lpool_lock);
+    _db.lpool_n_maghit += mag.n_hit;
+    mag.n_hit = 0;
+    _db.lpool_n_spill++;
+    for (; n > 0 && mag.head[cell]; n--) {
+        lpool_Lpblock *blk = mag.head[cell];
+        mag.head[cell] = blk->next;
+        mag.n[cell]--;
+        lpool_FreeShared(blk, cell);
+    }
+    pthread_mutex_unlock(&_db.lpool_lock);
+}
+
 // --- algo_lib.FDb.lpool.AllocMem
 // Allocate new piece of memory at least SIZE bytes long.
 // If not successful, return NULL
 // The allocated block is 16-byte aligned
+// Thread-safe: small blocks come from the calling thread's magazine.
 void* algo_lib::lpool_AllocMem(u64 size) {
     size     = u64_Max(size,16); // enforce alignment
     u64 cell = u64_BitScanReverse(size-1)+1;
+    u8 *retval = NULL;
+    if (cell <= 16) {
+        algo_lib::lpool_Lpmag &mag = algo_lib_lpool_lpmag;
+        lpool_Lpblock *blk = mag.head[cell];
+        if (LIKELY(blk)) {
+            mag.head[cell] = blk->next;
+            mag.n[cell]--;
+            mag.n_hit++;
+            retval = (u8*)blk;
+        } else {
+            retval = lpool_Refill(mag, cell);
+        }
+    } else {
+        pthread_mutex_lock(&_db.lpool_lock);
+        retval = lpool_AllocShared(cell);
+        pthread_mutex_unlock(&_db.lpool_lock);
+    }
+    return retval;
+}
+
+// --- algo_lib.FDb.lpool.AllocShared
+// Allocate block of size class CELL from the shared free lists. Caller holds the lock.
+static u8* algo_lib::lpool_AllocShared(u64 cell) {
     u64 i    = cell;
     u8 *retval = NULL;
     // try to find a block that's at least as large as required.
@@ -559,10 +823,33 @@ void* algo_lib::lpool_AllocMem(u64 size) {
     return retval;
 }
 
+// --- algo_lib.FDb.lpool.Refill
+// Magazine MAG has no blocks of size class CELL: move up to 32 blocks
+// from the shared free lists into MAG, and return one more block (NULL if out of memory).
+static u8* algo_lib::lpool_Refill(algo_lib::lpool_Lpmag &mag, u64 cell) {
+    pthread_mutex_lock(&_db.lpool_lock);
+    _db.lpool_n_maghit += mag.n_hit;
+    mag.n_hit = 0;
+    _db.lpool_n_refill++;
+    u8 *ret = lpool_AllocShared(cell);
+    for (int i = 0; ret && i < 32; i++) {
+        lpool_Lpblock *blk = (lpool_Lpblock*)lpool_AllocShared(cell);
+        if (!blk) {
+            break;
+        }
+        blk->next = mag.head[cell];
+        mag.head[cell] = blk;
+        mag.n[cell]++;
+    }
+    pthread_mutex_unlock(&_db.lpool_lock);
+    return ret;
+}
+
 // --- algo_lib.FDb.lpool.ReserveBuffers
 // Add N buffers of some size to the free store
 bool algo_lib::lpool_ReserveBuffers(int nbuf, u64 bufsize) {
     bool retval = true;
+    pthread_mutex_lock(&_db.lpool_lock);
     bufsize = u64_Max(bufsize, 16);
     for (int i = 0; i < nbuf; i++) {
         u64     cell = u64_BitScanReverse(bufsize-1)+1;
@@ -576,6 +863,7 @@ bool algo_lib::lpool_ReserveBuffers(int nbuf, u64 bufsize) {
             _db.lpool_free[cell] = temp;
         }
     }
+    pthread_mutex_unlock(&_db.lpool_lock);
     return retval;
 }
 
@@ -595,6 +883,18 @@ void* algo_lib::lpool_ReallocMem(void *oldmem, u64 old_size, u64 new_size) {
     return ret;
 }
 
+// --- algo_lib.FDb.lpool.FlushMag
+// Return blocks cached by the calling thread to the shared free lists
+// A thread should call this before exiting; otherwise its cached blocks are lost.
+void algo_lib::lpool_FlushMag() {
+    algo_lib::lpool_Lpmag &mag = algo_lib_lpool_lpmag;
+    for (u64 cell = 0; cell <= 16; cell++) {
+        if (mag.n[cell] > 0) {
+            lpool_Spill(mag, cell, mag.n[cell]);
+        }
+    }
+}
+
 // --- algo_lib.FDb.fildes.XrefMaybe
 // Insert row into all appropriate indices. If error occurs, store error
 // in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
@@ -651,10 +951,14 @@ bool algo_lib::InsertStrptrMaybe(algo::strptr str) {
         case algo_lib_TableId_dmmeta_Dispsigcheck: { // finput:algo_lib.FDb.dispsigcheck
             dmmeta::Dispsigcheck elem;
             retval = dmmeta::Dispsigcheck_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(algo_lib_TableId_dmmeta_Dispsigcheck, &elem, sizeof(elem));
+            }
             retval = retval && dispsigcheck_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         break;
     } //switch
     if (!retval) {
@@ -663,6 +967,27 @@ bool algo_lib::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- algo_lib.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool algo_lib::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case algo_lib_TableId_dmmeta_Dispsigcheck: { // finput:algo_lib.FDb.dispsigcheck
+            dmmeta::Dispsigcheck elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = dispsigcheck_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- algo_lib.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool algo_lib::LoadTuplesMaybe(algo::strptr root) {
@@ -670,19 +995,26 @@ bool algo_lib::LoadTuplesMaybe(algo::strptr root) {
     static const char *ssimfiles[] = {
 
         NULL};
-        retval = algo_lib::DoLoadTuples(root, algo_lib::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "algo_lib", "ddc07e859e7056e1a824df1ad0e6d08e12e89849"
+        , algo_lib::InsertStrptrMaybe, algo_lib::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
 // --- algo_lib.FDb._db.Init
 void algo_lib::Init() {
     algo_lib::_db.last_signal             = 0;
-    ary_beg(cstring, str, algo_lib::temp_strings_Getary()) {
+    algo_lib::FTempclass &tempclass = algo_lib::tempclass_qFind(algo_lib::_db.temppool, 0);
+    ary_beg(cstring, str, str_Getary(tempclass)) {
         ch_Reserve(str, 256);
     }ary_end;
-    algo_lib::_db.n_temp = algo_lib::temp_strings_N();
+    tempclass.n = str_N(tempclass);
+    algo_lib::_db.temppool.mask = 1;
+    algo::CharsetNibble_Build(algo_lib::_db.SsimBreakNameNib, algo_lib::_db.SsimBreakName);
+    algo::CharsetNibble_Build(algo_lib::_db.SsimBreakValueNib, algo_lib::_db.SsimBreakValue);
+    algo_lib::InitHugepage();
     algo_lib::bh_timehook_Reserve(32);
     algo_lib::InitCpuHz();
+    algo_lib::InitLogbuf();
     algo_lib::_db.eol          = true;
 }
 
@@ -807,7 +1139,8 @@ bool algo_lib::imtable_XrefMaybe(algo_lib::FImtable &row) {
 // --- algo_lib.FDb.ind_imtable.Find
 // Find row by key. Return NULL if not found.
 algo_lib::FImtable* algo_lib::ind_imtable_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_imtable_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_imtable_buckets_n - 1);
     algo_lib::FImtable* *e = &_db.ind_imtable_buckets_elems[index];
     algo_lib::FImtable* ret=NULL;
     do {
@@ -841,7 +1174,8 @@ bool algo_lib::ind_imtable_InsertMaybe(algo_lib::FImtable& row) {
     ind_imtable_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_imtable_next == (algo_lib::FImtable*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.imtable) & (_db.ind_imtable_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.imtable);
+        u32 index = hash & (_db.ind_imtable_buckets_n - 1);
         algo_lib::FImtable* *prev = &_db.ind_imtable_buckets_elems[index];
         do {
             algo_lib::FImtable* ret = *prev;
@@ -867,7 +1201,8 @@ bool algo_lib::ind_imtable_InsertMaybe(algo_lib::FImtable& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void algo_lib::ind_imtable_Remove(algo_lib::FImtable& row) {
     if (LIKELY(row.ind_imtable_next != (algo_lib::FImtable*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.imtable) & (_db.ind_imtable_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.imtable);
+        u32 index = hash & (_db.ind_imtable_buckets_n - 1);
         algo_lib::FImtable* *prev = &_db.ind_imtable_buckets_elems[index]; // addr of pointer to current element
         while (algo_lib::FImtable *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1047,39 +1382,45 @@ bool algo_lib::tabulate_XrefMaybe(algo_lib::Tabulate &row) {
     return retval;
 }
 
+// --- algo_lib.FDb.logbuf.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool algo_lib::logbuf_XrefMaybe(algo_lib::FLogbuf &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
 // --- algo_lib.FDb.bh_timehook.Dealloc
 // Remove all elements from heap and free memory used by the array.
 void algo_lib::bh_timehook_Dealloc() {
     bh_timehook_RemoveAll();
-    algo_lib::lpool_FreeMem(_db.bh_timehook_elems, sizeof(algo_lib::FTimehook*)*_db.bh_timehook_max);
+    algo_lib::lpool_FreeMem(_db.bh_timehook_elems, sizeof(_db_bh_timehook_elem)*_db.bh_timehook_max);
     _db.bh_timehook_max   = 0;
     _db.bh_timehook_elems = NULL;
 }
 
 // --- algo_lib.FDb.bh_timehook.Downheap
-// Find new location for ROW starting at IDX
-// NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
-static int algo_lib::bh_timehook_Downheap(algo_lib::FTimehook& row, int idx) {
-    algo_lib::FTimehook* *elems = _db.bh_timehook_elems;
+// Find new location for heap element ELEM starting at IDX
+// NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.
+static int algo_lib::bh_timehook_Downheap(_db_bh_timehook_elem elem, int idx) {
+    _db_bh_timehook_elem *elems = _db.bh_timehook_elems;
     int n = _db.bh_timehook_n;
-    int child = idx*2+1;
+    int child = idx*4+1;
     while (child < n) {
-        algo_lib::FTimehook* p = elems[child]; // left child
-        int rchild = child+1;
-        if (rchild < n) {
-            algo_lib::FTimehook* q = elems[rchild]; // right child
-            if (bh_timehook_ElemLt(*q,*p)) {
-                child = rchild;
-                p     = q;
+        int lim = child+4 < n ? child+4 : n;
+        for (int i = child+1; i < lim; i++) { // pick smallest child
+            if (bh_timehook_HeapLt(elems[i], elems[child])) {
+                child = i;
             }
         }
-        if (!bh_timehook_ElemLt(*p,row)) {
+        if (!bh_timehook_HeapLt(elems[child], elem)) {
             break;
         }
-        p->bh_timehook_idx   = idx;
-        elems[idx]     = p;
-        idx            = child;
-        child          = idx*2+1;
+        elems[idx] = elems[child];
+        elems[idx].row->bh_timehook_idx = idx;
+        idx        = child;
+        child      = idx*4+1;
     }
     return idx;
 }
@@ -1091,9 +1432,10 @@ void algo_lib::bh_timehook_Insert(algo_lib::FTimehook& row) {
         bh_timehook_Reserve(1);
         int n = _db.bh_timehook_n;
         _db.bh_timehook_n = n + 1;
-        int new_idx = bh_timehook_Upheap(row, n);
+        _db_bh_timehook_elem elem = _db_bh_timehook_elem(row.time, &row);
+        int new_idx = bh_timehook_Upheap(elem, n);
         row.bh_timehook_idx = new_idx;
-        _db.bh_timehook_elems[new_idx] = &row;
+        _db.bh_timehook_elems[new_idx] = elem;
         if (new_idx==0) {
             bh_timehook_FirstChanged();
         }
@@ -1111,12 +1453,13 @@ i32 algo_lib::bh_timehook_Reheap(algo_lib::FTimehook& row) {
         bh_timehook_Reserve(1);
         old_idx = _db.bh_timehook_n++;
     }
-    int new_idx = bh_timehook_Upheap(row, old_idx);
+    _db_bh_timehook_elem elem = _db_bh_timehook_elem(row.time, &row);
+    int new_idx = bh_timehook_Upheap(elem, old_idx);
     if (!isnew && new_idx == old_idx) {
-        new_idx = bh_timehook_Downheap(row, old_idx);
+        new_idx = bh_timehook_Downheap(elem, old_idx);
     }
     row.bh_timehook_idx = new_idx;
-    _db.bh_timehook_elems[new_idx] = &row;
+    _db.bh_timehook_elems[new_idx] = elem;
     bool changed = new_idx==0 || old_idx==0;
     if (changed) {
         bh_timehook_FirstChanged();
@@ -1131,10 +1474,11 @@ i32 algo_lib::bh_timehook_Reheap(algo_lib::FTimehook& row) {
 // Heap must be non-empty or behavior is undefined.
 // Update fstep:algo_lib.FDb.bh_timehook
 i32 algo_lib::bh_timehook_ReheapFirst() {
-    algo_lib::FTimehook &row = *_db.bh_timehook_elems[0];
-    i32 new_idx = bh_timehook_Downheap(row, 0);
+    algo_lib::FTimehook &row = *_db.bh_timehook_elems[0].row;
+    _db_bh_timehook_elem elem = _db_bh_timehook_elem(row.time, &row);
+    i32 new_idx = bh_timehook_Downheap(elem, 0);
     row.bh_timehook_idx = new_idx;
-    _db.bh_timehook_elems[new_idx] = &row;
+    _db.bh_timehook_elems[new_idx] = elem;
     if (new_idx != 0) {
         bh_timehook_FirstChanged();
     }
@@ -1146,17 +1490,17 @@ i32 algo_lib::bh_timehook_ReheapFirst() {
 void algo_lib::bh_timehook_Remove(algo_lib::FTimehook& row) {
     if (bh_timehook_InBheapQ(row)) {
         int old_idx = row.bh_timehook_idx;
-        if (_db.bh_timehook_elems[old_idx] == &row) { // sanity check: heap points back to row
+        if (&row == _db.bh_timehook_elems[old_idx].row) { // sanity check: heap points back to row
             row.bh_timehook_idx = -1;           // mark not in heap
             i32 n = _db.bh_timehook_n - 1; // index of last element in heap
             _db.bh_timehook_n = n;         // decrease count
             if (old_idx != n) {
-                algo_lib::FTimehook *elem = _db.bh_timehook_elems[n];
-                int new_idx = bh_timehook_Upheap(*elem, old_idx);
+                _db_bh_timehook_elem elem = _db.bh_timehook_elems[n];
+                int new_idx = bh_timehook_Upheap(elem, old_idx);
                 if (new_idx == old_idx) {
-                    new_idx = bh_timehook_Downheap(*elem, old_idx);
+                    new_idx = bh_timehook_Downheap(elem, old_idx);
                 }
-                elem->bh_timehook_idx = new_idx;
+                elem.row->bh_timehook_idx = new_idx;
                 _db.bh_timehook_elems[new_idx] = elem;
             }
             if (old_idx == 0) {
@@ -1171,7 +1515,7 @@ void algo_lib::bh_timehook_Remove(algo_lib::FTimehook& row) {
 void algo_lib::bh_timehook_RemoveAll() {
     int n = _db.bh_timehook_n;
     for (int i = n - 1; i>=0; i--) {
-        _db.bh_timehook_elems[i]->bh_timehook_idx = -1; // mark not-in-heap
+        _db.bh_timehook_elems[i].row->bh_timehook_idx = -1; // mark not-in-heap
     }
     _db.bh_timehook_n = 0;
     if (n > 0) {
@@ -1185,15 +1529,15 @@ void algo_lib::bh_timehook_RemoveAll() {
 algo_lib::FTimehook* algo_lib::bh_timehook_RemoveFirst() {
     algo_lib::FTimehook *row = NULL;
     if (_db.bh_timehook_n > 0) {
-        row = _db.bh_timehook_elems[0];
+        row = _db.bh_timehook_elems[0].row;
         row->bh_timehook_idx = -1;           // mark not in heap
         i32 n = _db.bh_timehook_n - 1; // index of last element in heap
         _db.bh_timehook_n = n;         // decrease count
         if (n) {
-            algo_lib::FTimehook &elem = *_db.bh_timehook_elems[n];
+            _db_bh_timehook_elem elem = _db.bh_timehook_elems[n];
             int new_idx = bh_timehook_Downheap(elem, 0);
-            elem.bh_timehook_idx = new_idx;
-            _db.bh_timehook_elems[new_idx] = &elem;
+            elem.row->bh_timehook_idx = new_idx;
+            _db.bh_timehook_elems[new_idx] = elem;
         }
         bh_timehook_FirstChanged();
     }
@@ -1206,30 +1550,29 @@ void algo_lib::bh_timehook_Reserve(int n) {
     i32 old_max = _db.bh_timehook_max;
     if (UNLIKELY(_db.bh_timehook_n + n > old_max)) {
         u32 new_max  = u32_Max(4, old_max * 2);
-        u32 old_size = old_max * sizeof(algo_lib::FTimehook*);
-        u32 new_size = new_max * sizeof(algo_lib::FTimehook*);
+        u32 old_size = old_max * sizeof(_db_bh_timehook_elem);
+        u32 new_size = new_max * sizeof(_db_bh_timehook_elem);
         void *new_mem = algo_lib::lpool_ReallocMem(_db.bh_timehook_elems, old_size, new_size);
         if (UNLIKELY(!new_mem)) {
             FatalErrorExit("algo_lib.out_of_memory  field:algo_lib.FDb.bh_timehook");
         }
-        _db.bh_timehook_elems = (algo_lib::FTimehook**)new_mem;
+        _db.bh_timehook_elems = (_db_bh_timehook_elem*)new_mem;
         _db.bh_timehook_max = new_max;
     }
 }
 
 // --- algo_lib.FDb.bh_timehook.Upheap
-// Find and return index of new location for element ROW in the heap, starting at index IDX.
-// Move any elements along the way but do not modify ROW.
-static int algo_lib::bh_timehook_Upheap(algo_lib::FTimehook& row, int idx) {
-    algo_lib::FTimehook* *elems = _db.bh_timehook_elems;
+// Find and return index of new location for heap element ELEM, starting at index IDX.
+// Move any elements along the way but do not store ELEM.
+static int algo_lib::bh_timehook_Upheap(_db_bh_timehook_elem elem, int idx) {
+    _db_bh_timehook_elem *elems = _db.bh_timehook_elems;
     while (idx>0) {
-        int j = (idx-1)/2;
-        algo_lib::FTimehook* p = elems[j];
-        if (!bh_timehook_ElemLt(row, *p)) {
+        int j = (idx-1)/4;
+        if (!bh_timehook_HeapLt(elem, elems[j])) {
             break;
         }
-        p->bh_timehook_idx = idx;
-        elems[idx] = p;
+        elems[idx] = elems[j];
+        elems[idx].row->bh_timehook_idx = idx;
         idx = j;
     }
     return idx;
@@ -1241,6 +1584,13 @@ inline static bool algo_lib::bh_timehook_ElemLt(algo_lib::FTimehook &a, algo_lib
     return time_Lt(a, b);
 }
 
+// --- algo_lib.FDb.bh_timehook.HeapLt
+// Compare two heap elements (dmmeta.bheap heaps only)
+inline static bool algo_lib::bh_timehook_HeapLt(_db_bh_timehook_elem a, _db_bh_timehook_elem b) {
+    (void)_db;
+    return algo::SchedTime_Lt(a.key, b.key);
+}
+
 // --- algo_lib.FDb.bh_timehook.FirstChanged
 // First element of index changed.
 void algo_lib::bh_timehook_FirstChanged() {
@@ -1349,7 +1699,8 @@ bool algo_lib::dispsigcheck_XrefMaybe(algo_lib::FDispsigcheck &row) {
 // --- algo_lib.FDb.ind_dispsigcheck.Find
 // Find row by key. Return NULL if not found.
 algo_lib::FDispsigcheck* algo_lib::ind_dispsigcheck_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_dispsigcheck_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_dispsigcheck_buckets_n - 1);
     algo_lib::FDispsigcheck* *e = &_db.ind_dispsigcheck_buckets_elems[index];
     algo_lib::FDispsigcheck* ret=NULL;
     do {
@@ -1383,7 +1734,8 @@ bool algo_lib::ind_dispsigcheck_InsertMaybe(algo_lib::FDispsigcheck& row) {
     ind_dispsigcheck_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_dispsigcheck_next == (algo_lib::FDispsigcheck*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.dispsig) & (_db.ind_dispsigcheck_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.dispsig);
+        u32 index = hash & (_db.ind_dispsigcheck_buckets_n - 1);
         algo_lib::FDispsigcheck* *prev = &_db.ind_dispsigcheck_buckets_elems[index];
         do {
             algo_lib::FDispsigcheck* ret = *prev;
@@ -1409,7 +1761,8 @@ bool algo_lib::ind_dispsigcheck_InsertMaybe(algo_lib::FDispsigcheck& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void algo_lib::ind_dispsigcheck_Remove(algo_lib::FDispsigcheck& row) {
     if (LIKELY(row.ind_dispsigcheck_next != (algo_lib::FDispsigcheck*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.dispsig) & (_db.ind_dispsigcheck_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.dispsig);
+        u32 index = hash & (_db.ind_dispsigcheck_buckets_n - 1);
         algo_lib::FDispsigcheck* *prev = &_db.ind_dispsigcheck_buckets_elems[index]; // addr of pointer to current element
         while (algo_lib::FDispsigcheck *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1527,7 +1880,8 @@ bool algo_lib::imdb_XrefMaybe(algo_lib::FImdb &row) {
 // --- algo_lib.FDb.ind_imdb.Find
 // Find row by key. Return NULL if not found.
 algo_lib::FImdb* algo_lib::ind_imdb_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_imdb_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_imdb_buckets_n - 1);
     algo_lib::FImdb* *e = &_db.ind_imdb_buckets_elems[index];
     algo_lib::FImdb* ret=NULL;
     do {
@@ -1561,7 +1915,8 @@ bool algo_lib::ind_imdb_InsertMaybe(algo_lib::FImdb& row) {
     ind_imdb_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_imdb_next == (algo_lib::FImdb*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.imdb) & (_db.ind_imdb_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.imdb);
+        u32 index = hash & (_db.ind_imdb_buckets_n - 1);
         algo_lib::FImdb* *prev = &_db.ind_imdb_buckets_elems[index];
         do {
             algo_lib::FImdb* ret = *prev;
@@ -1587,7 +1942,8 @@ bool algo_lib::ind_imdb_InsertMaybe(algo_lib::FImdb& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void algo_lib::ind_imdb_Remove(algo_lib::FImdb& row) {
     if (LIKELY(row.ind_imdb_next != (algo_lib::FImdb*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.imdb) & (_db.ind_imdb_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.imdb);
+        u32 index = hash & (_db.ind_imdb_buckets_n - 1);
         algo_lib::FImdb* *prev = &_db.ind_imdb_buckets_elems[index]; // addr of pointer to current element
         while (algo_lib::FImdb *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2137,7 +2493,7 @@ void algo_lib::_db_bh_timehook_curs_Reset(_db_bh_timehook_curs &curs, algo_lib::
     _db_bh_timehook_curs_Reserve(curs, bh_timehook_N());
     curs.temp_n = 0;
     if (parent.bh_timehook_n > 0) {
-        algo_lib::FTimehook &first = *parent.bh_timehook_elems[0];
+        algo_lib::FTimehook &first = *parent.bh_timehook_elems[0].row;
         curs.temp_elems[0] = &first; // insert first element in heap
         curs.temp_n = 1;
     }
@@ -2175,13 +2531,10 @@ void algo_lib::_db_bh_timehook_curs_Next(_db_bh_timehook_curs &curs) {
         } while (i < n);
         curs.temp_n = n-1;
         int index = dead->bh_timehook_idx;
-        i = (index*2+1);
-        if (i < bh_timehook_N()) {
-            algo_lib::FTimehook &elem = *curs.parent->bh_timehook_elems[i];
-            _db_bh_timehook_curs_Add(curs, elem);
-        }
-        if (i+1 < bh_timehook_N()) {
-            algo_lib::FTimehook &elem = *curs.parent->bh_timehook_elems[i + 1];
+        i = (index*4+1);
+        int lim = i+4 < bh_timehook_N() ? i+4 : bh_timehook_N();
+        for (; i < lim; i++) {
+            algo_lib::FTimehook &elem = *curs.parent->bh_timehook_elems[i].row;
             _db_bh_timehook_curs_Add(curs, elem);
         }
     }
@@ -2193,14 +2546,21 @@ void algo_lib::FDb_Init() {
     _db.sbrk_huge_limit = 0;
     _db.sbrk_huge_alloc = 0;
     _db.sbrk_zeromem = false;
+    _db.sbrk_thp = false;
+    _db.sbrk_numa_node = -1;
+    _db.sbrk_thp_alloc = 0;
     memset(_db.lpool_free, 0, sizeof(_db.lpool_free));
+    pthread_mutex_init(&_db.lpool_lock, NULL);
+    _db.lpool_n_maghit = 0;
+    _db.lpool_n_refill = 0;
+    _db.lpool_n_spill = 0;
     _db.limit = algo::SchedTime(0x7fffffffffffffff);
     _db.clocks_to_ms = double(0.0);
     _db.n_iohook = u32(0);
     _db.hz = double(0.0);
     _db.exit_code = i32(0);
     _db.clocks_to_ns = double(0.0);
-    _db.n_temp = u32(0);
+    _db.tempstr_stats_on = bool(false);
     _db.last_signal = u32(0);
     _db.eol = bool(false);
     _db.cpu_hz = u64(0);
@@ -2211,12 +2571,18 @@ void algo_lib::FDb_Init() {
     (void)Charset_ReadStrptrPlain(_db.SsimBreakValue, "[]{}()\t \r\n");
     (void)Charset_ReadStrptrMaybe(_db.SsimQuotesafe, "a-zA-Z0-9_;&*^%$@.!:,+/-");
     algo_lib::_db.last_signal             = 0;
-    ary_beg(cstring, str, algo_lib::temp_strings_Getary()) {
+    algo_lib::FTempclass &tempclass = algo_lib::tempclass_qFind(algo_lib::_db.temppool, 0);
+    ary_beg(cstring, str, str_Getary(tempclass)) {
         ch_Reserve(str, 256);
     }ary_end;
-    algo_lib::_db.n_temp = algo_lib::temp_strings_N();
+    tempclass.n = str_N(tempclass);
+    algo_lib::_db.temppool.mask = 1;
+    algo::CharsetNibble_Build(algo_lib::_db.SsimBreakNameNib, algo_lib::_db.SsimBreakName);
+    algo::CharsetNibble_Build(algo_lib::_db.SsimBreakValueNib, algo_lib::_db.SsimBreakValue);
+    algo_lib::InitHugepage();
     algo_lib::bh_timehook_Reserve(32);
     algo_lib::InitCpuHz();
+    algo_lib::InitLogbuf();
     algo_lib::_db.eol          = true;
     // initialize LAry imtable (algo_lib.FDb.imtable)
     _db.imtable_n = 0;
@@ -2291,6 +2657,7 @@ void algo_lib::FDb_Init() {
     _db.last_sleep_clocks = u64(0);
     _db.show_insert_err_lim = u32(0);
     (void)Charset_ReadStrptrMaybe(_db.Urlsafe, "0-9a-zA-Z_.~");
+    _db.snap_rec = bool(false);
 
     algo_lib::InitReflection();
     _db.h_fatalerror = NULL;
@@ -2300,6 +2667,7 @@ void algo_lib::FDb_Init() {
 // --- algo_lib.FDb..Uninit
 void algo_lib::FDb_Uninit() {
     algo_lib::FDb &row = _db; (void)row;
+    logbuf_Cleanup(); // dmmeta.fcleanup:algo_lib.FDb.logbuf
 
     // algo_lib.FDb.ind_imdb.Uninit (Thash)  //
     // skip destruction of ind_imdb in global scope
@@ -2832,6 +3200,10 @@ const char* algo_lib::value_ToCstr(const algo_lib::FieldId& parent) {
         case algo_lib_FieldId_version      : ret = "version";  break;
         case algo_lib_FieldId_sig          : ret = "sig";  break;
         case algo_lib_FieldId_signature    : ret = "signature";  break;
+        case algo_lib_FieldId_unbuffered   : ret = "unbuffered";  break;
+        case algo_lib_FieldId_nommap       : ret = "nommap";  break;
+        case algo_lib_FieldId_linebuf      : ret = "linebuf";  break;
+        case algo_lib_FieldId_snap         : ret = "snap";  break;
         case algo_lib_FieldId_expr         : ret = "expr";  break;
         case algo_lib_FieldId_state        : ret = "state";  break;
         case algo_lib_FieldId_front        : ret = "front";  break;
@@ -2880,6 +3252,9 @@ bool algo_lib::value_SetStrptrMaybe(algo_lib::FieldId& parent, algo::strptr rhs)
                 case LE_STR4('h','e','l','p'): {
                     value_SetEnum(parent,algo_lib_FieldId_help); ret = true; break;
                 }
+                case LE_STR4('s','n','a','p'): {
+                    value_SetEnum(parent,algo_lib_FieldId_snap); ret = true; break;
+                }
             }
             break;
         }
@@ -2908,11 +3283,17 @@ bool algo_lib::value_SetStrptrMaybe(algo_lib::FieldId& parent, algo::strptr rhs)
                 case LE_STR6('a','c','c','e','p','t'): {
                     value_SetEnum(parent,algo_lib_FieldId_accept); ret = true; break;
                 }
+                case LE_STR6('n','o','m','m','a','p'): {
+                    value_SetEnum(parent,algo_lib_FieldId_nommap); ret = true; break;
+                }
             }
             break;
         }
         case 7: {
             switch (u64(ReadLE32(rhs.elems))|(u64(ReadLE16(rhs.elems+4))<<32)|(u64(rhs[6])<<48)) {
+                case LE_STR7('l','i','n','e','b','u','f'): {
+                    value_SetEnum(parent,algo_lib_FieldId_linebuf); ret = true; break;
+                }
                 case LE_STR7('v','e','r','b','o','s','e'): {
                     value_SetEnum(parent,algo_lib_FieldId_verbose); ret = true; break;
                 }
@@ -2941,6 +3322,10 @@ bool algo_lib::value_SetStrptrMaybe(algo_lib::FieldId& parent, algo::strptr rhs)
                     if (memcmp(rhs.elems+8,"or",2)==0) { value_SetEnum(parent,algo_lib_FieldId_parseerror); ret = true; break; }
                     break;
                 }
+                case LE_STR8('u','n','b','u','f','f','e','r'): {
+                    if (memcmp(rhs.elems+8,"ed",2)==0) { value_SetEnum(parent,algo_lib_FieldId_unbuffered); ret = true; break; }
+                    break;
+                }
             }
             break;
         }
@@ -2990,10 +3375,62 @@ void algo_lib::FieldId_Print(algo_lib::FieldId & row, algo::cstring &str) {
     algo_lib::value_Print(row, str);
 }
 
-// --- algo_lib.InTextFile.temp_buf.RemoveAll
-// Destroy all elements of Inlary
-void algo_lib::temp_buf_RemoveAll(algo_lib::InTextFile& parent) {
-    parent.temp_buf_n = 0;
+// --- algo_lib.Mmap..Uninit
+void algo_lib::Mmap_Uninit(algo_lib::Mmap& parent) {
+    algo_lib::Mmap &row = parent; (void)row;
+    mem_Cleanup(parent); // dmmeta.fcleanup:algo_lib.Mmap.mem
+}
+
+// --- algo_lib.InTextFile.temp_buf.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+u8& algo_lib::temp_buf_Alloc(algo_lib::InTextFile& parent) {
+    temp_buf_Reserve(parent, 1);
+    int n  = parent.temp_buf_n;
+    int at = n;
+    u8 *elems = parent.temp_buf_elems;
+    new (elems + at) u8(0); // construct new element, default initializer
+    parent.temp_buf_n = n+1;
+    return elems[at];
+}
+
+// --- algo_lib.InTextFile.temp_buf.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+u8& algo_lib::temp_buf_AllocAt(algo_lib::InTextFile& parent, int at) {
+    temp_buf_Reserve(parent, 1);
+    int n  = parent.temp_buf_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("algo_lib.bad_alloc_at  field:algo_lib.InTextFile.temp_buf  comment:'index out of range'");
+    }
+    u8 *elems = parent.temp_buf_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(u8));
+    new (elems + at) u8(0); // construct element, default initializer
+    parent.temp_buf_n = n+1;
+    return elems[at];
+}
+
+// --- algo_lib.InTextFile.temp_buf.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<u8> algo_lib::temp_buf_AllocN(algo_lib::InTextFile& parent, int n_elems) {
+    temp_buf_Reserve(parent, n_elems);
+    int old_n  = parent.temp_buf_n;
+    int new_n = old_n + n_elems;
+    u8 *elems = parent.temp_buf_elems;
+    memset(elems + old_n, 0, new_n - old_n); // initialize new space
+    parent.temp_buf_n = new_n;
+    return algo::aryptr<u8>(elems + old_n, n_elems);
+}
+
+// --- algo_lib.InTextFile.temp_buf.Remove
+// Remove item by index. If index outside of range, do nothing.
+void algo_lib::temp_buf_Remove(algo_lib::InTextFile& parent, u32 i) {
+    u32 lim = parent.temp_buf_n;
+    u8 *elems = parent.temp_buf_elems;
+    if (i < lim) {
+        memmove(elems + i, elems + (i + 1), sizeof(u8) * (lim - (i + 1)));
+        parent.temp_buf_n = lim - 1;
+    }
 }
 
 // --- algo_lib.InTextFile.temp_buf.RemoveLast
@@ -3006,11 +3443,27 @@ void algo_lib::temp_buf_RemoveLast(algo_lib::InTextFile& parent) {
     }
 }
 
-// --- algo_lib.InTextFile..Init
-// Set all fields to initial values.
-void algo_lib::InTextFile_Init(algo_lib::InTextFile& parent) {
-    parent.own_fd = bool(true);
-    parent.temp_buf_n = 0; // temp_buf: initialize count
+// --- algo_lib.InTextFile.temp_buf.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void algo_lib::temp_buf_AbsReserve(algo_lib::InTextFile& parent, int n) {
+    u32 old_max  = parent.temp_buf_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::lpool_ReallocMem(parent.temp_buf_elems, old_max * sizeof(u8), new_max * sizeof(u8));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("algo_lib.tary_nomem  field:algo_lib.InTextFile.temp_buf  comment:'out of memory'");
+    }
+    parent.temp_buf_elems = (u8*)new_mem;
+    parent.temp_buf_max = new_max;
+}
+
+// --- algo_lib.InTextFile.temp_buf.Setary
+// Copy contents of RHS to PARENT.
+void algo_lib::temp_buf_Setary(algo_lib::InTextFile& parent, algo_lib::InTextFile &rhs) {
+    temp_buf_RemoveAll(parent);
+    int nnew = rhs.temp_buf_n;
+    temp_buf_Reserve(parent, nnew); // reserve space
+    memcpy(parent.temp_buf_elems, rhs.temp_buf_elems, nnew * sizeof(u8));
+    parent.temp_buf_n = nnew;
 }
 
 // --- algo_lib.InTextFile..Uninit
@@ -3018,14 +3471,11 @@ void algo_lib::InTextFile_Uninit(algo_lib::InTextFile& parent) {
     algo_lib::InTextFile &row = parent; (void)row;
     file_Cleanup(parent); // dmmeta.fcleanup:algo_lib.InTextFile.file
 
-    // algo_lib.InTextFile.temp_buf.Uninit (Inlary)  //
+    // algo_lib.InTextFile.temp_buf.Uninit (Tary)  //Read buffer for input that cannot be mapped
+    // remove all elements from algo_lib.InTextFile.temp_buf
     temp_buf_RemoveAll(parent);
-}
-
-// --- algo_lib.Mmap..Uninit
-void algo_lib::Mmap_Uninit(algo_lib::Mmap& parent) {
-    algo_lib::Mmap &row = parent; (void)row;
-    mem_Cleanup(parent); // dmmeta.fcleanup:algo_lib.Mmap.mem
+    // free memory for Tary algo_lib.InTextFile.temp_buf
+    algo_lib::lpool_FreeMem(parent.temp_buf_elems, sizeof(u8)*parent.temp_buf_max); // (algo_lib.InTextFile.temp_buf)
 }
 
 // --- algo_lib.Regx.state.Alloc
@@ -3608,7 +4058,8 @@ void algo_lib::ind_replvar_Cascdel(algo_lib::Replscope& replscope) {
 // --- algo_lib.Replscope.ind_replvar.Find
 // Find row by key. Return NULL if not found.
 algo_lib::FReplvar* algo_lib::ind_replvar_Find(algo_lib::Replscope& replscope, const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (replscope.ind_replvar_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (replscope.ind_replvar_buckets_n - 1);
     algo_lib::FReplvar* *e = &replscope.ind_replvar_buckets_elems[index];
     algo_lib::FReplvar* ret=NULL;
     do {
@@ -3626,7 +4077,8 @@ bool algo_lib::ind_replvar_InsertMaybe(algo_lib::Replscope& replscope, algo_lib:
     ind_replvar_Reserve(replscope, 1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_replvar_next == (algo_lib::FReplvar*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.key) & (replscope.ind_replvar_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (replscope.ind_replvar_buckets_n - 1);
         algo_lib::FReplvar* *prev = &replscope.ind_replvar_buckets_elems[index];
         do {
             algo_lib::FReplvar* ret = *prev;
@@ -3652,7 +4104,8 @@ bool algo_lib::ind_replvar_InsertMaybe(algo_lib::Replscope& replscope, algo_lib:
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void algo_lib::ind_replvar_Remove(algo_lib::Replscope& replscope, algo_lib::FReplvar& row) {
     if (LIKELY(row.ind_replvar_next != (algo_lib::FReplvar*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.key) & (replscope.ind_replvar_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (replscope.ind_replvar_buckets_n - 1);
         algo_lib::FReplvar* *prev = &replscope.ind_replvar_buckets_elems[index]; // addr of pointer to current element
         while (algo_lib::FReplvar *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -29,15 +29,19 @@ namespace amc_gc {
 const char *amc_gc_help =
 "amc_gc: Empirically eliminate unused records\n"
 "Usage: amc_gc [options]\n"
-"    -target   string  Target to test-build. default: \"%\"\n"
-"    -key      string  ACR query selecting records to eliminate\n"
-"    -include          Garbage collect includes for specified target. default: false\n"
-"    -in       string  Input directory or filename, - for stdin. default: \"data\"\n"
-"    -verbose          Enable verbose mode\n"
-"    -debug            Enable debug mode\n"
-"    -version          Show version information\n"
-"    -sig              Print SHA1 signatures for dispatches\n"
-"    -help             Print this screen and exit\n"
+"    -target      string  Target to test-build. default: \"%\"\n"
+"    -key         string  ACR query selecting records to eliminate\n"
+"    -include             Garbage collect includes for specified target. default: false\n"
+"    -in          string  Input directory or filename, - for stdin. default: \"data\"\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -133,7 +137,7 @@ int amc_gc::acr_Exec(amc_gc::Acr& parent) {
 // Call execv()
 // Call execv with specified parameters -- cprint:acr.Argv
 int amc_gc::acr_Execv(amc_gc::Acr& parent) {
-    char *argv[34+2]; // start of first arg (future pointer)
+    char *argv[40+2]; // start of first arg (future pointer)
     algo::tempstr temp;
     int n_argv=0;
     argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
@@ -377,6 +381,48 @@ int amc_gc::acr_Execv(amc_gc::Acr& parent) {
         bool_Print(parent.acr_cmd.meta, temp);
         ch_Alloc(temp) = 0;// NUL term for this arg
     }
+
+    if (parent.acr_cmd.nthread != 0) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-nthread:";
+        i32_Print(parent.acr_cmd.nthread, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.acr_cmd.lazy != false) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-lazy:";
+        bool_Print(parent.acr_cmd.lazy, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.acr_cmd.changed != false) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-changed:";
+        bool_Print(parent.acr_cmd.changed, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.acr_cmd.serve != "") {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-serve:";
+        cstring_Print(parent.acr_cmd.serve, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.acr_cmd.server != "") {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-server:";
+        cstring_Print(parent.acr_cmd.server, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.acr_cmd.stats != false) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-stats:";
+        bool_Print(parent.acr_cmd.stats, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
     for (int i=0; i+1 < algo_lib::_db.cmdline.verbose; i++) {
         argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
         temp << "-verbose";
@@ -491,7 +537,7 @@ int amc_gc::acr_Exec(amc_gc::Check& parent) {
 // Call execv()
 // Call execv with specified parameters -- cprint:acr.Argv
 int amc_gc::acr_Execv(amc_gc::Check& parent) {
-    char *argv[34+2]; // start of first arg (future pointer)
+    char *argv[40+2]; // start of first arg (future pointer)
     algo::tempstr temp;
     int n_argv=0;
     argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
@@ -735,6 +781,48 @@ int amc_gc::acr_Execv(amc_gc::Check& parent) {
         bool_Print(parent.acr_cmd.meta, temp);
         ch_Alloc(temp) = 0;// NUL term for this arg
     }
+
+    if (parent.acr_cmd.nthread != 0) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-nthread:";
+        i32_Print(parent.acr_cmd.nthread, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.acr_cmd.lazy != false) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-lazy:";
+        bool_Print(parent.acr_cmd.lazy, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.acr_cmd.changed != false) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-changed:";
+        bool_Print(parent.acr_cmd.changed, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.acr_cmd.serve != "") {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-serve:";
+        cstring_Print(parent.acr_cmd.serve, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.acr_cmd.server != "") {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-server:";
+        cstring_Print(parent.acr_cmd.server, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.acr_cmd.stats != false) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-stats:";
+        bool_Print(parent.acr_cmd.stats, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
     for (int i=0; i+1 < algo_lib::_db.cmdline.verbose; i++) {
         argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
         temp << "-verbose";
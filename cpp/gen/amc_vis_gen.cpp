@@ -31,19 +31,23 @@ namespace amc_vis {
 const char *amc_vis_help =
 "amc_vis: amc: draw access path diagrams\n"
 "Usage: amc_vis [options]\n"
-"    [ctype]   string  Ctype regexp to compute access path diagram. default: \"%\"\n"
-"    -in       string  Input directory or filename, - for stdin. default: \"data\"\n"
-"    -dot      string  Save dot file with specified filename\n"
-"    -xref             Include all ctypes referenced by selected ones. default: false\n"
-"    -xns              Cross namespace boundaries. default: false\n"
-"    -noinput          Deselect module inputs. default: false\n"
-"    -check            Check model for dependency problems. default: false\n"
-"    -render           Produce an ascii drawing. default: true\n"
-"    -verbose          Enable verbose mode\n"
-"    -debug            Enable debug mode\n"
-"    -version          Show version information\n"
-"    -sig              Print SHA1 signatures for dispatches\n"
-"    -help             Print this screen and exit\n"
+"    [ctype]      string  Ctype regexp to compute access path diagram. default: \"%\"\n"
+"    -in          string  Input directory or filename, - for stdin. default: \"data\"\n"
+"    -dot         string  Save dot file with specified filename\n"
+"    -xref                Include all ctypes referenced by selected ones. default: false\n"
+"    -xns                 Cross namespace boundaries. default: false\n"
+"    -noinput             Deselect module inputs. default: false\n"
+"    -check               Check model for dependency problems. default: false\n"
+"    -render              Produce an ascii drawing. default: true\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -581,28 +585,41 @@ bool amc_vis::InsertStrptrMaybe(algo::strptr str) {
         case amc_vis_TableId_dmmeta_Ctype: { // finput:amc_vis.FDb.ctype
             dmmeta::Ctype elem;
             retval = dmmeta::Ctype_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(amc_vis_TableId_dmmeta_Ctype, &elem, sizeof(elem));
+            }
             retval = retval && ctype_InputMaybe(elem);
             break;
         }
         case amc_vis_TableId_dmmeta_Field: { // finput:amc_vis.FDb.field
             dmmeta::Field elem;
             retval = dmmeta::Field_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(amc_vis_TableId_dmmeta_Field, &elem, sizeof(elem));
+            }
             retval = retval && field_InputMaybe(elem);
             break;
         }
         case amc_vis_TableId_dmmeta_Reftype: { // finput:amc_vis.FDb.reftype
             dmmeta::Reftype elem;
             retval = dmmeta::Reftype_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(amc_vis_TableId_dmmeta_Reftype, &elem, sizeof(elem));
+            }
             retval = retval && reftype_InputMaybe(elem);
             break;
         }
         case amc_vis_TableId_dmmeta_Finput: { // finput:amc_vis.FDb.finput
             dmmeta::Finput elem;
             retval = dmmeta::Finput_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(amc_vis_TableId_dmmeta_Finput, &elem, sizeof(elem));
+            }
             retval = retval && finput_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -612,6 +629,54 @@ bool amc_vis::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- amc_vis.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool amc_vis::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case amc_vis_TableId_dmmeta_Ctype: { // finput:amc_vis.FDb.ctype
+            dmmeta::Ctype elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ctype_InputMaybe(elem);
+            }
+            break;
+        }
+        case amc_vis_TableId_dmmeta_Field: { // finput:amc_vis.FDb.field
+            dmmeta::Field elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = field_InputMaybe(elem);
+            }
+            break;
+        }
+        case amc_vis_TableId_dmmeta_Reftype: { // finput:amc_vis.FDb.reftype
+            dmmeta::Reftype elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = reftype_InputMaybe(elem);
+            }
+            break;
+        }
+        case amc_vis_TableId_dmmeta_Finput: { // finput:amc_vis.FDb.finput
+            dmmeta::Finput elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = finput_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- amc_vis.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool amc_vis::LoadTuplesMaybe(algo::strptr root) {
@@ -620,7 +685,8 @@ bool amc_vis::LoadTuplesMaybe(algo::strptr root) {
         "dmmeta.ctype", "dmmeta.reftype", "dmmeta.field", "dmmeta.finput"
 
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, amc_vis::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "amc_vis", "76002ceb41bd908a4029a5ae4341364b2386489a"
+        , amc_vis::InsertStrptrMaybe, amc_vis::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -645,7 +711,8 @@ bool amc_vis::_db_XrefMaybe() {
 // --- amc_vis.FDb.ind_ctype.Find
 // Find row by key. Return NULL if not found.
 amc_vis::FCtype* amc_vis::ind_ctype_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ctype_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ctype_buckets_n - 1);
     amc_vis::FCtype* *e = &_db.ind_ctype_buckets_elems[index];
     amc_vis::FCtype* ret=NULL;
     do {
@@ -687,7 +754,8 @@ bool amc_vis::ind_ctype_InsertMaybe(amc_vis::FCtype& row) {
     ind_ctype_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ctype_next == (amc_vis::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         amc_vis::FCtype* *prev = &_db.ind_ctype_buckets_elems[index];
         do {
             amc_vis::FCtype* ret = *prev;
@@ -713,7 +781,8 @@ bool amc_vis::ind_ctype_InsertMaybe(amc_vis::FCtype& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void amc_vis::ind_ctype_Remove(amc_vis::FCtype& row) {
     if (LIKELY(row.ind_ctype_next != (amc_vis::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         amc_vis::FCtype* *prev = &_db.ind_ctype_buckets_elems[index]; // addr of pointer to current element
         while (amc_vis::FCtype *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -766,7 +835,8 @@ void amc_vis::ind_ctype_Reserve(int n) {
 // --- amc_vis.FDb.ind_field.Find
 // Find row by key. Return NULL if not found.
 amc_vis::FField* amc_vis::ind_field_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_field_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_field_buckets_n - 1);
     amc_vis::FField* *e = &_db.ind_field_buckets_elems[index];
     amc_vis::FField* ret=NULL;
     do {
@@ -792,7 +862,8 @@ bool amc_vis::ind_field_InsertMaybe(amc_vis::FField& row) {
     ind_field_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_field_next == (amc_vis::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         amc_vis::FField* *prev = &_db.ind_field_buckets_elems[index];
         do {
             amc_vis::FField* ret = *prev;
@@ -818,7 +889,8 @@ bool amc_vis::ind_field_InsertMaybe(amc_vis::FField& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void amc_vis::ind_field_Remove(amc_vis::FField& row) {
     if (LIKELY(row.ind_field_next != (amc_vis::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         amc_vis::FField* *prev = &_db.ind_field_buckets_elems[index]; // addr of pointer to current element
         while (amc_vis::FField *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -958,7 +1030,8 @@ bool amc_vis::node_XrefMaybe(amc_vis::FNode &row) {
 // --- amc_vis.FDb.ind_node.Find
 // Find row by key. Return NULL if not found.
 amc_vis::FNode* amc_vis::ind_node_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_node_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_node_buckets_n - 1);
     amc_vis::FNode* *e = &_db.ind_node_buckets_elems[index];
     amc_vis::FNode* ret=NULL;
     do {
@@ -1000,7 +1073,8 @@ bool amc_vis::ind_node_InsertMaybe(amc_vis::FNode& row) {
     ind_node_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_node_next == (amc_vis::FNode*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.node) & (_db.ind_node_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.node);
+        u32 index = hash & (_db.ind_node_buckets_n - 1);
         amc_vis::FNode* *prev = &_db.ind_node_buckets_elems[index];
         do {
             amc_vis::FNode* ret = *prev;
@@ -1026,7 +1100,8 @@ bool amc_vis::ind_node_InsertMaybe(amc_vis::FNode& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void amc_vis::ind_node_Remove(amc_vis::FNode& row) {
     if (LIKELY(row.ind_node_next != (amc_vis::FNode*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.node) & (_db.ind_node_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.node);
+        u32 index = hash & (_db.ind_node_buckets_n - 1);
         amc_vis::FNode* *prev = &_db.ind_node_buckets_elems[index]; // addr of pointer to current element
         while (amc_vis::FNode *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1183,7 +1258,8 @@ bool amc_vis::link_XrefMaybe(amc_vis::Link &row) {
 // --- amc_vis.FDb.ind_link.Find
 // Find row by key. Return NULL if not found.
 amc_vis::Link* amc_vis::ind_link_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_link_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_link_buckets_n - 1);
     amc_vis::Link* *e = &_db.ind_link_buckets_elems[index];
     amc_vis::Link* ret=NULL;
     do {
@@ -1209,7 +1285,8 @@ bool amc_vis::ind_link_InsertMaybe(amc_vis::Link& row) {
     ind_link_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_link_next == (amc_vis::Link*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.link) & (_db.ind_link_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.link);
+        u32 index = hash & (_db.ind_link_buckets_n - 1);
         amc_vis::Link* *prev = &_db.ind_link_buckets_elems[index];
         do {
             amc_vis::Link* ret = *prev;
@@ -1235,7 +1312,8 @@ bool amc_vis::ind_link_InsertMaybe(amc_vis::Link& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void amc_vis::ind_link_Remove(amc_vis::Link& row) {
     if (LIKELY(row.ind_link_next != (amc_vis::Link*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.link) & (_db.ind_link_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.link);
+        u32 index = hash & (_db.ind_link_buckets_n - 1);
         amc_vis::Link* *prev = &_db.ind_link_buckets_elems[index]; // addr of pointer to current element
         while (amc_vis::Link *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1895,7 +1973,8 @@ bool amc_vis::reftype_XrefMaybe(amc_vis::FReftype &row) {
 // --- amc_vis.FDb.ind_reftype.Find
 // Find row by key. Return NULL if not found.
 amc_vis::FReftype* amc_vis::ind_reftype_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_reftype_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_reftype_buckets_n - 1);
     amc_vis::FReftype* *e = &_db.ind_reftype_buckets_elems[index];
     amc_vis::FReftype* ret=NULL;
     do {
@@ -1937,7 +2016,8 @@ bool amc_vis::ind_reftype_InsertMaybe(amc_vis::FReftype& row) {
     ind_reftype_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_reftype_next == (amc_vis::FReftype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.reftype) & (_db.ind_reftype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.reftype);
+        u32 index = hash & (_db.ind_reftype_buckets_n - 1);
         amc_vis::FReftype* *prev = &_db.ind_reftype_buckets_elems[index];
         do {
             amc_vis::FReftype* ret = *prev;
@@ -1963,7 +2043,8 @@ bool amc_vis::ind_reftype_InsertMaybe(amc_vis::FReftype& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void amc_vis::ind_reftype_Remove(amc_vis::FReftype& row) {
     if (LIKELY(row.ind_reftype_next != (amc_vis::FReftype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.reftype) & (_db.ind_reftype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.reftype);
+        u32 index = hash & (_db.ind_reftype_buckets_n - 1);
         amc_vis::FReftype* *prev = &_db.ind_reftype_buckets_elems[index]; // addr of pointer to current element
         while (amc_vis::FReftype *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
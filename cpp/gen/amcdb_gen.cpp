@@ -24,6 +24,7 @@ const char *amcdb_Tclass_tclass_Bheap     = "Bheap";
 const char *amcdb_Tclass_tclass_Bitfld    = "Bitfld";
 const char *amcdb_Tclass_tclass_Bitset    = "Bitset";
 const char *amcdb_Tclass_tclass_Blkpool   = "Blkpool";
+const char *amcdb_Tclass_tclass_Btree     = "Btree";
 const char *amcdb_Tclass_tclass_Charset   = "Charset";
 const char *amcdb_Tclass_tclass_Cmp       = "Cmp";
 
@@ -101,9 +102,26 @@ bool amcdb::Bltin_ReadFieldMaybe(amcdb::Bltin &parent, algo::strptr field, algo:
 bool amcdb::Bltin_ReadStrptrMaybe(amcdb::Bltin &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "amcdb.bltin") || algo::StripTypeTag(in_str, "amcdb.Bltin");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Bltin_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "likeu64", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.likeu64, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "bigendok", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.bigendok, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "issigned", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.issigned, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Bltin_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -151,9 +169,20 @@ bool amcdb::Curs_ReadFieldMaybe(amcdb::Curs &parent, algo::strptr field, algo::s
 bool amcdb::Curs_ReadStrptrMaybe(amcdb::Curs &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "amcdb.curs") || algo::StripTypeTag(in_str, "amcdb.Curs");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Curs_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "curs", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.curs, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Curs_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -365,9 +394,22 @@ bool amcdb::Gen_ReadFieldMaybe(amcdb::Gen &parent, algo::strptr field, algo::str
 bool amcdb::Gen_ReadStrptrMaybe(amcdb::Gen &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "amcdb.gen") || algo::StripTypeTag(in_str, "amcdb.Gen");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Gen_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "gen", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.gen, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "perns", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.perns, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Gen_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -409,9 +451,20 @@ bool amcdb::Tclass_ReadFieldMaybe(amcdb::Tclass &parent, algo::strptr field, alg
 bool amcdb::Tclass_ReadStrptrMaybe(amcdb::Tclass &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "amcdb.tclass") || algo::StripTypeTag(in_str, "amcdb.Tclass");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Tclass_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "tclass", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.tclass, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Tclass_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -450,9 +503,20 @@ bool amcdb::Tcursor_ReadFieldMaybe(amcdb::Tcursor &parent, algo::strptr field, a
 bool amcdb::Tcursor_ReadStrptrMaybe(amcdb::Tcursor &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "amcdb.tcursor") || algo::StripTypeTag(in_str, "amcdb.Tcursor");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Tcursor_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "tfunc", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.tfunc, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Tcursor_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -527,9 +591,34 @@ bool amcdb::Tfunc_ReadFieldMaybe(amcdb::Tfunc &parent, algo::strptr field, algo:
 bool amcdb::Tfunc_ReadStrptrMaybe(amcdb::Tfunc &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "amcdb.tfunc") || algo::StripTypeTag(in_str, "amcdb.Tfunc");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Tfunc_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "tfunc", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.tfunc, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "hasthrow", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.hasthrow, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "leaf", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.leaf, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "poolfunc", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.poolfunc, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "inl", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.inl, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "wur", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.wur, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "pure", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.pure, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "ismacro", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.ismacro, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Tfunc_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
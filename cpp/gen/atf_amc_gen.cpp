@@ -46,13 +46,17 @@ namespace atf_amc {
 const char *atf_amc_help =
 "atf_amc: Unit tests for amc (see amctest table)\n"
 "Usage: atf_amc [options]\n"
-"    -in        string  Input directory or filename, - for stdin. default: \"data\"\n"
-"    [amctest]  string  SQL regex, selecting test to run. default: \"%\"\n"
-"    -verbose           Enable verbose mode\n"
-"    -debug             Enable debug mode\n"
-"    -version           Show version information\n"
-"    -sig               Print SHA1 signatures for dispatches\n"
-"    -help              Print this screen and exit\n"
+"    -in          string  Input directory or filename, - for stdin. default: \"data\"\n"
+"    [amctest]    string  SQL regex, selecting test to run. default: \"%\"\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -61,6 +65,23 @@ const char *atf_amc_syntax =
 " [amctest]:string=\"%\"\n"
 ;
 } // namespace atf_amc
+atf_amc::_db_bh_heaprow_curs::~_db_bh_heaprow_curs() {
+    algo_lib::malloc_FreeMem(temp_elems, sizeof(void*) * temp_max);
+
+}
+
+atf_amc::_db_bh_heaprow_inl_curs::~_db_bh_heaprow_inl_curs() {
+    algo_lib::malloc_FreeMem(temp_elems, sizeof(void*) * temp_max);
+
+}
+
+atf_amc::_db_bh_heaprow_ptr_curs::~_db_bh_heaprow_ptr_curs() {
+    algo_lib::malloc_FreeMem(temp_elems, sizeof(void*) * temp_max);
+
+}
+
+static thread_local atf_amc::magrow_Tpmag atf_amc_magrow_tpmag; // (atf_amc.FDb.magrow) per-thread magazine
+static thread_local atf_amc::maglpool_Lpmag atf_amc_maglpool_lpmag; // (atf_amc.FDb.maglpool) per-thread magazine
 atf_amc::typea_bh_typeb_curs::~typea_bh_typeb_curs() {
     algo_lib::malloc_FreeMem(temp_elems, sizeof(void*) * temp_max);
 
@@ -101,6 +122,18 @@ namespace atf_amc {
     // rotates the tree in from->to direction
     static void          tr_child_atree_Turn(atf_amc::FCascdel& from, atf_amc::FCascdel& to) __attribute__((nothrow));
     static void          tr_child_atree_Connect(atf_amc::FCascdel* parent, atf_amc::FCascdel* child, bool left) __attribute__((nothrow));
+    // Allocate empty node from the base pool
+    static atf_amc::cascdel_bt_child_btree_node* bt_child_btree_AllocNode(atf_amc::FCascdel& cascdel, bool leaf) __attribute__((nothrow));
+    // Return leaf and position of the first key >= VAL. Return NULL if there is no such key
+    static atf_amc::cascdel_bt_child_btree_node* bt_child_btree_FindLeaf(atf_amc::FCascdel& cascdel, u32 val, int &pos) __attribute__((__warn_unused_result__, nothrow));
+    // Free node and all nodes below it. Rows are not touched
+    static void          bt_child_btree_FreeNode(atf_amc::FCascdel& cascdel, cascdel_bt_child_btree_node *node) __attribute__((nothrow));
+    // Insert node RIGHT into parent of LEFT, immediately after LEFT
+    static void          bt_child_btree_InsertChild(atf_amc::FCascdel& cascdel, cascdel_bt_child_btree_node &left, u32 sep, cascdel_bt_child_btree_node &right) __attribute__((nothrow));
+    // Empty the index. (rows may be deleted if cascdel)
+    static void          bt_child_btree_RemoveAllImpl(atf_amc::FCascdel& cascdel, bool del) __attribute__((nothrow));
+    // Unlink empty node from the tree and free it
+    static void          bt_child_btree_RemoveNode(atf_amc::FCascdel& cascdel, cascdel_bt_child_btree_node &node) __attribute__((nothrow));
     // Find new location for ROW starting at IDX
     // NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
     static int           bh_typec_Downheap(atf_amc::FTypeC& row, int idx) __attribute__((nothrow));
@@ -129,6 +162,69 @@ namespace atf_amc {
     static void          tr_avl_Turn(atf_amc::FAvl& from, atf_amc::FAvl& to) __attribute__((nothrow));
     static void          tr_avl_Connect(atf_amc::FAvl* parent, atf_amc::FAvl* child, bool left) __attribute__((nothrow));
     static void          listtype_LoadStatic() __attribute__((nothrow));
+    // Allocate empty node from the base pool
+    static atf_amc::_db_bt_treerow_node* bt_treerow_AllocNode(bool leaf) __attribute__((nothrow));
+    // Return leaf and position of the first key >= VAL. Return NULL if there is no such key
+    static atf_amc::_db_bt_treerow_node* bt_treerow_FindLeaf(u64 val, int &pos) __attribute__((__warn_unused_result__, nothrow));
+    // Free node and all nodes below it. Rows are not touched
+    static void          bt_treerow_FreeNode(_db_bt_treerow_node *node) __attribute__((nothrow));
+    // Insert node RIGHT into parent of LEFT, immediately after LEFT
+    static void          bt_treerow_InsertChild(_db_bt_treerow_node &left, u64 sep, _db_bt_treerow_node &right) __attribute__((nothrow));
+    // Empty the index. (rows may be deleted if cascdel)
+    static void          bt_treerow_RemoveAllImpl(bool del) __attribute__((nothrow));
+    // Unlink empty node from the tree and free it
+    static void          bt_treerow_RemoveNode(_db_bt_treerow_node &node) __attribute__((nothrow));
+    // Returns the child that has greater height.
+    static atf_amc::FTreerow* tr_treerow_TallerChild(atf_amc::FTreerow& node) __attribute__((nothrow));
+    // Disconnects the subtree(branch) from the parent
+    static void          tr_treerow_Disconnect(atf_amc::FTreerow& node) __attribute__((nothrow));
+    static bool          tr_treerow_ElemLt(atf_amc::FTreerow &a, atf_amc::FTreerow &b) __attribute__((nothrow));
+    static void          tr_treerow_updateDepth(atf_amc::FTreerow& node) __attribute__((nothrow));
+    // rotates the tree in from->to direction
+    static void          tr_treerow_Turn(atf_amc::FTreerow& from, atf_amc::FTreerow& to) __attribute__((nothrow));
+    static void          tr_treerow_Connect(atf_amc::FTreerow* parent, atf_amc::FTreerow* child, bool left) __attribute__((nothrow));
+    // Find new location for ROW starting at IDX
+    // NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
+    static int           bh_heaprow_Downheap(atf_amc::FHeaprow& row, int idx) __attribute__((nothrow));
+    // Find and return index of new location for element ROW in the heap, starting at index IDX.
+    // Move any elements along the way but do not modify ROW.
+    static int           bh_heaprow_Upheap(atf_amc::FHeaprow& row, int idx) __attribute__((nothrow));
+    static bool          bh_heaprow_ElemLt(atf_amc::FHeaprow &a, atf_amc::FHeaprow &b) __attribute__((nothrow));
+    static void          _db_bh_heaprow_curs_Add(_db_bh_heaprow_curs &curs, atf_amc::FHeaprow& row);
+    // Find new location for heap element ELEM starting at IDX
+    // NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.
+    static int           bh_heaprow_inl_Downheap(_db_bh_heaprow_inl_elem elem, int idx) __attribute__((nothrow));
+    // Find and return index of new location for heap element ELEM, starting at index IDX.
+    // Move any elements along the way but do not store ELEM.
+    static int           bh_heaprow_inl_Upheap(_db_bh_heaprow_inl_elem elem, int idx) __attribute__((nothrow));
+    static bool          bh_heaprow_inl_ElemLt(atf_amc::FHeaprow &a, atf_amc::FHeaprow &b) __attribute__((nothrow));
+    static void          _db_bh_heaprow_inl_curs_Add(_db_bh_heaprow_inl_curs &curs, atf_amc::FHeaprow& row);
+    // Compare two heap elements (dmmeta.bheap heaps only)
+    static bool          bh_heaprow_inl_HeapLt(_db_bh_heaprow_inl_elem a, _db_bh_heaprow_inl_elem b) __attribute__((nothrow));
+    // Find new location for heap element ELEM starting at IDX
+    // NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.
+    static int           bh_heaprow_ptr_Downheap(atf_amc::FHeaprow* elem, int idx) __attribute__((nothrow));
+    // Find and return index of new location for heap element ELEM, starting at index IDX.
+    // Move any elements along the way but do not store ELEM.
+    static int           bh_heaprow_ptr_Upheap(atf_amc::FHeaprow* elem, int idx) __attribute__((nothrow));
+    static bool          bh_heaprow_ptr_ElemLt(atf_amc::FHeaprow &a, atf_amc::FHeaprow &b) __attribute__((nothrow));
+    static void          _db_bh_heaprow_ptr_curs_Add(_db_bh_heaprow_ptr_curs &curs, atf_amc::FHeaprow& row);
+    // Compare two heap elements (dmmeta.bheap heaps only)
+    static bool          bh_heaprow_ptr_HeapLt(atf_amc::FHeaprow* a, atf_amc::FHeaprow* b) __attribute__((nothrow));
+    // Magazine MAG is empty: move up to 32 elements from the shared free list
+    // into MAG, and return one more element (NULL if out of memory).
+    static atf_amc::FMagrow* magrow_Refill(atf_amc::magrow_Tpmag &mag);
+    // Move N elements from magazine MAG to the shared free list
+    static void          magrow_Spill(atf_amc::magrow_Tpmag &mag, int n);
+    // Push block onto shared free list for size class CELL. Caller holds the lock.
+    static void          maglpool_FreeShared(maglpool_Lpblock *blk, u64 cell);
+    // Move N blocks of size class CELL from magazine MAG to the shared free list
+    static void          maglpool_Spill(atf_amc::maglpool_Lpmag &mag, u64 cell, int n);
+    // Allocate block of size class CELL from the shared free lists. Caller holds the lock.
+    static u8*           maglpool_AllocShared(u64 cell);
+    // Magazine MAG has no blocks of size class CELL: move up to 16 blocks
+    // from the shared free lists into MAG, and return one more block (NULL if out of memory).
+    static u8*           maglpool_Refill(atf_amc::maglpool_Lpmag &mag, u64 cell);
     // find trace by row id (used to implement reflection)
     static algo::ImrowPtr trace_RowidFind(int t) __attribute__((nothrow));
     // Function return 1
@@ -197,6 +293,58 @@ namespace atf_amc {
     static void          fixary_IntHeapSort(atf_amc::TypeA *elems, int n) __attribute__((nothrow));
     // Quick sort engine
     static void          fixary_IntQuickSort(atf_amc::TypeA *elems, int n, int depth) __attribute__((nothrow));
+    // Swap values elem_a and elem_b
+    static void          radix_Swap(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) __attribute__((nothrow));
+    // Left circular shift of three-tuple
+    static void          radix_Rotleft(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b, atf_amc::TypeA &elem_c) __attribute__((nothrow));
+    // Compare values elem_a and elem_b
+    // The comparison function must be anti-symmetric: if a>b, then !(b>a).
+    // If not, mayhem results.
+    static bool          radix_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) __attribute__((nothrow));
+    // Extract radix key word WORD (0=most significant) from ELEM.
+    // Unsigned comparison of keys gives the same order as radix_Lt.
+    static u64           radix_RadixKey(atf_amc::TypeA &elem, int word) __attribute__((nothrow));
+    // Swap values elem_a and elem_b
+    static void          c_radix_Swap(atf_amc::TypeA* &elem_a, atf_amc::TypeA* &elem_b) __attribute__((nothrow));
+    // Left circular shift of three-tuple
+    static void          c_radix_Rotleft(atf_amc::TypeA* &elem_a, atf_amc::TypeA* &elem_b, atf_amc::TypeA* &elem_c) __attribute__((nothrow));
+    // Compare values elem_a and elem_b
+    // The comparison function must be anti-symmetric: if a>b, then !(b>a).
+    // If not, mayhem results.
+    static bool          c_radix_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) __attribute__((nothrow));
+    // Extract radix key word WORD (0=most significant) from ELEM.
+    // Unsigned comparison of keys gives the same order as c_radix_Lt.
+    static u64           c_radix_RadixKey(atf_amc::TypeA &elem, int word) __attribute__((nothrow));
+    // Swap values elem_a and elem_b
+    static void          strkey_Swap(atf_amc::Strkey &elem_a, atf_amc::Strkey &elem_b) __attribute__((nothrow));
+    // Left circular shift of three-tuple
+    static void          strkey_Rotleft(atf_amc::Strkey &elem_a, atf_amc::Strkey &elem_b, atf_amc::Strkey &elem_c) __attribute__((nothrow));
+    // Compare values elem_a and elem_b
+    // The comparison function must be anti-symmetric: if a>b, then !(b>a).
+    // If not, mayhem results.
+    static bool          strkey_Lt(atf_amc::Strkey &elem_a, atf_amc::Strkey &elem_b) __attribute__((nothrow));
+    // Extract radix key word WORD (0=most significant) from ELEM.
+    // Unsigned comparison of keys gives the same order as strkey_Lt.
+    static u64           strkey_RadixKey(atf_amc::Strkey &elem, int word) __attribute__((nothrow));
+    // Swap values elem_a and elem_b
+    static void          parallel_Swap(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) __attribute__((nothrow));
+    // Left circular shift of three-tuple
+    static void          parallel_Rotleft(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b, atf_amc::TypeA &elem_c) __attribute__((nothrow));
+    // Compare values elem_a and elem_b
+    // The comparison function must be anti-symmetric: if a>b, then !(b>a).
+    // If not, mayhem results.
+    static bool          parallel_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) __attribute__((nothrow));
+    // Internal insertion sort
+    static void          parallel_IntInsertionSort(atf_amc::TypeA *elems, int n) __attribute__((nothrow));
+    // Internal heap sort
+    static void          parallel_IntHeapSort(atf_amc::TypeA *elems, int n) __attribute__((nothrow));
+    // Quick sort engine
+    static void          parallel_IntQuickSort(atf_amc::TypeA *elems, int n, int depth) __attribute__((nothrow));
+    // Sort one run of elements (callback for algo_lib::ParallelSort)
+    static void          parallel_SortRun(void *elems, int n) __attribute__((nothrow));
+    // Merge sorted runs A and B into DST (callback for algo_lib::ParallelSort)
+    // Elements are moved bitwise, as in Swap.
+    static void          parallel_MergeRuns(void *dst, void *a, int na, void *b, int nb) __attribute__((nothrow));
     //
     static void          in_Scanmsg(atf_amc::Linebuf& linebuf) __attribute__((nothrow));
     // Shift existing bytes over to the beginning of the buffer
@@ -1009,6 +1157,7 @@ void atf_amc::DispType3_Print(atf_amc::DispType3 & row, algo::cstring &str) {
 // Copy fields out of row
 void atf_amc::amctest_CopyOut(atf_amc::FAmctest &row, atfdb::Amctest &out) {
     out.amctest = row.amctest;
+    out.manual = row.manual;
     out.comment = row.comment;
 }
 
@@ -1016,6 +1165,7 @@ void atf_amc::amctest_CopyOut(atf_amc::FAmctest &row, atfdb::Amctest &out) {
 // Copy fields in to row
 void atf_amc::amctest_CopyIn(atf_amc::FAmctest &row, atfdb::Amctest &in) {
     row.amctest = in.amctest;
+    row.manual = in.manual;
     row.comment = in.comment;
 }
 
@@ -1028,6 +1178,9 @@ void atf_amc::FAmctest_Print(atf_amc::FAmctest & row, algo::cstring &str) {
     algo::Smallstr50_Print(row.amctest, temp);
     PrintAttrSpaceReset(str,"amctest", temp);
 
+    bool_Print(row.manual, temp);
+    PrintAttrSpaceReset(str,"manual", temp);
+
     algo::Comment_Print(row.comment, temp);
     PrintAttrSpaceReset(str,"comment", temp);
 
@@ -1053,6 +1206,7 @@ const char* atf_amc::type_ToCstr(const atf_amc::FCascdel& cascdel) {
         case atf_amc_FCascdel_type_thash   : ret = "thash";  break;
         case atf_amc_FCascdel_type_bheap   : ret = "bheap";  break;
         case atf_amc_FCascdel_type_zdlist  : ret = "zdlist";  break;
+        case atf_amc_FCascdel_type_btree   : ret = "btree";  break;
     }
     return ret;
 }
@@ -1100,6 +1254,9 @@ bool atf_amc::type_SetStrptrMaybe(atf_amc::FCascdel& cascdel, algo::strptr rhs)
                 case LE_STR5('b','h','e','a','p'): {
                     type_SetEnum(cascdel,atf_amc_FCascdel_type_bheap); ret = true; break;
                 }
+                case LE_STR5('b','t','r','e','e'): {
+                    type_SetEnum(cascdel,atf_amc_FCascdel_type_btree); ret = true; break;
+                }
                 case LE_STR5('t','h','a','s','h'): {
                     type_SetEnum(cascdel,atf_amc_FCascdel_type_thash); ret = true; break;
                 }
@@ -1236,7 +1393,8 @@ void atf_amc::ind_child_thash_Cascdel(atf_amc::FCascdel& cascdel) {
 // --- atf_amc.FCascdel.ind_child_thash.Find
 // Find row by key. Return NULL if not found.
 atf_amc::FCascdel* atf_amc::ind_child_thash_Find(atf_amc::FCascdel& cascdel, u32 key) {
-    u32 index = u32_Hash(0, key) & (cascdel.ind_child_thash_buckets_n - 1);
+    u32 hash  = u32_Hash(0, key);
+    u32 index = hash & (cascdel.ind_child_thash_buckets_n - 1);
     atf_amc::FCascdel* *e = &cascdel.ind_child_thash_buckets_elems[index];
     atf_amc::FCascdel* ret=NULL;
     do {
@@ -1254,7 +1412,8 @@ bool atf_amc::ind_child_thash_InsertMaybe(atf_amc::FCascdel& cascdel, atf_amc::F
     ind_child_thash_Reserve(cascdel, 1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_child_thash_next == (atf_amc::FCascdel*)-1)) {// check if in hash already
-        u32 index = u32_Hash(0, row.key) & (cascdel.ind_child_thash_buckets_n - 1);
+        u32 hash  = u32_Hash(0, row.key);
+        u32 index = hash & (cascdel.ind_child_thash_buckets_n - 1);
         atf_amc::FCascdel* *prev = &cascdel.ind_child_thash_buckets_elems[index];
         do {
             atf_amc::FCascdel* ret = *prev;
@@ -1280,7 +1439,8 @@ bool atf_amc::ind_child_thash_InsertMaybe(atf_amc::FCascdel& cascdel, atf_amc::F
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void atf_amc::ind_child_thash_Remove(atf_amc::FCascdel& cascdel, atf_amc::FCascdel& row) {
     if (LIKELY(row.ind_child_thash_next != (atf_amc::FCascdel*)-1)) {// check if in hash already
-        u32 index = u32_Hash(0, row.key) & (cascdel.ind_child_thash_buckets_n - 1);
+        u32 hash  = u32_Hash(0, row.key);
+        u32 index = hash & (cascdel.ind_child_thash_buckets_n - 1);
         atf_amc::FCascdel* *prev = &cascdel.ind_child_thash_buckets_elems[index]; // addr of pointer to current element
         while (atf_amc::FCascdel *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1914,6 +2074,283 @@ atf_amc::FCascdel* atf_amc::tr_child_atree_LastLt(atf_amc::FCascdel& cascdel, co
     return result;
 }
 
+// --- atf_amc.FCascdel.bt_child_btree.Cascdel
+// Delete all elements in the tree.
+void atf_amc::bt_child_btree_Cascdel(atf_amc::FCascdel& cascdel) {
+    bt_child_btree_RemoveAllImpl(cascdel, true);
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.AllocNode
+// Allocate empty node from the base pool
+static atf_amc::cascdel_bt_child_btree_node* atf_amc::bt_child_btree_AllocNode(atf_amc::FCascdel& cascdel, bool leaf) {
+    (void)cascdel;
+    cascdel_bt_child_btree_node *node = (cascdel_bt_child_btree_node*)algo_lib::malloc_AllocMem(sizeof(cascdel_bt_child_btree_node));
+    if (UNLIKELY(!node)) {
+        FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FCascdel.bt_child_btree");
+    }
+    node->n      = 0;
+    node->leaf   = leaf;
+    node->parent = NULL;
+    node->next   = NULL;
+    node->prev   = NULL;
+    return node;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.Find
+// Return first row whose key is equal to VAL, or NULL if not found
+atf_amc::FCascdel* atf_amc::bt_child_btree_Find(atf_amc::FCascdel& cascdel, u32 val) {
+    int pos;
+    cascdel_bt_child_btree_node *node = bt_child_btree_FindLeaf(cascdel, val, pos);
+    return node && !(val < node->key[pos]) ? node->row[pos] : NULL;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.FindLeaf
+// Return leaf and position of the first key >= VAL. Return NULL if there is no such key
+static atf_amc::cascdel_bt_child_btree_node* atf_amc::bt_child_btree_FindLeaf(atf_amc::FCascdel& cascdel, u32 val, int &pos) {
+    cascdel_bt_child_btree_node *node = cascdel.bt_child_btree_root;
+    pos = 0;
+    if (node) {
+        while (!node->leaf) {
+            int i = 1;
+            while (i < node->n && node->key[i] < val) {
+                i++;
+            }
+            node = node->child[i-1];
+        }
+        while (pos < node->n && node->key[pos] < val) {
+            pos++;
+        }
+        // all keys in this leaf are smaller; next leaf starts with a key >= val
+        if (pos == node->n) {
+            node = node->next;
+            pos  = 0;
+        }
+    }
+    return node;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.FreeNode
+// Free node and all nodes below it. Rows are not touched
+static void atf_amc::bt_child_btree_FreeNode(atf_amc::FCascdel& cascdel, cascdel_bt_child_btree_node *node) {
+    if (!node->leaf) {
+        for (int i = 0; i < node->n; i++) {
+            bt_child_btree_FreeNode(cascdel, node->child[i]);
+        }
+    }
+    algo_lib::malloc_FreeMem(node, sizeof(cascdel_bt_child_btree_node));
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.InsertChild
+// Insert node RIGHT into parent of LEFT, immediately after LEFT
+static void atf_amc::bt_child_btree_InsertChild(atf_amc::FCascdel& cascdel, cascdel_bt_child_btree_node &left, u32 sep, cascdel_bt_child_btree_node &right) {
+    cascdel_bt_child_btree_node *par = left.parent;
+    if (!par) {
+        par           = bt_child_btree_AllocNode(cascdel, false);
+        par->n        = 1;
+        par->key[0]   = sep;
+        par->child[0] = &left;
+        left.parent   = par;
+        cascdel.bt_child_btree_root = par;
+    }
+    int pos = 1;
+    while (par->child[pos-1] != &left) {
+        pos++;
+    }
+    if (par->n == cascdel_bt_child_btree_node::max_keys) {
+        // split; sib->key[0] becomes the separator between par and sib
+        cascdel_bt_child_btree_node *sib = bt_child_btree_AllocNode(cascdel, false);
+        int h = par->n / 2;
+        sib->n = par->n - h;
+        memcpy(sib->key, par->key + h, sib->n * sizeof(par->key[0]));
+        memcpy(sib->child, par->child + h, sib->n * sizeof(par->child[0]));
+        par->n = h;
+        for (int i = 0; i < sib->n; i++) {
+            sib->child[i]->parent = sib;
+        }
+        bt_child_btree_InsertChild(cascdel, *par, sib->key[0], *sib);
+        if (pos > h) {
+            pos -= h;
+            par = sib;
+        }
+    }
+    memmove(par->key + pos + 1, par->key + pos, (par->n - pos) * sizeof(par->key[0]));
+    memmove(par->child + pos + 1, par->child + pos, (par->n - pos) * sizeof(par->child[0]));
+    par->key[pos]   = sep;
+    par->child[pos] = &right;
+    par->n++;
+    right.parent = par;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.Insert
+// Insert row into the tree. If row is already in the tree, do nothing.
+void atf_amc::bt_child_btree_Insert(atf_amc::FCascdel& cascdel, atf_amc::FCascdel& row) {
+    if (!row.bt_child_btree_leaf) {
+        u32 val = row.key;
+        cascdel_bt_child_btree_node *node = cascdel.bt_child_btree_root;
+        if (!node) {
+            node = bt_child_btree_AllocNode(cascdel, true);
+            cascdel.bt_child_btree_root = node;
+        }
+        // descend to the leaf, going right past equal keys
+        while (!node->leaf) {
+            int i = 1;
+            while (i < node->n && !(val < node->key[i])) {
+                i++;
+            }
+            node = node->child[i-1];
+        }
+        int pos = 0;
+        while (pos < node->n && !(val < node->key[pos])) {
+            pos++;
+        }
+        if (node->n == cascdel_bt_child_btree_node::max_keys) {
+            // split full leaf; upper half moves to a new leaf on the right
+            cascdel_bt_child_btree_node *right = bt_child_btree_AllocNode(cascdel, true);
+            int h = node->n / 2;
+            right->n = node->n - h;
+            memcpy(right->key, node->key + h, right->n * sizeof(node->key[0]));
+            memcpy(right->row, node->row + h, right->n * sizeof(node->row[0]));
+            node->n = h;
+            for (int i = 0; i < right->n; i++) {
+                right->row[i]->bt_child_btree_leaf = right;
+            }
+            right->prev = node;
+            right->next = node->next;
+            if (node->next) {
+                node->next->prev = right;
+            }
+            node->next = right;
+            bt_child_btree_InsertChild(cascdel, *node, right->key[0], *right);
+            if (pos > h) {
+                pos -= h;
+                node = right;
+            }
+        }
+        memmove(node->key + pos + 1, node->key + pos, (node->n - pos) * sizeof(node->key[0]));
+        memmove(node->row + pos + 1, node->row + pos, (node->n - pos) * sizeof(node->row[0]));
+        node->key[pos] = val;
+        node->row[pos] = &row;
+        node->n++;
+        row.bt_child_btree_leaf = node;
+        cascdel.bt_child_btree_n++;
+    }
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.LowerBound
+// Return first row whose key is >= VAL, or NULL
+atf_amc::FCascdel* atf_amc::bt_child_btree_LowerBound(atf_amc::FCascdel& cascdel, u32 val) {
+    int pos;
+    cascdel_bt_child_btree_node *node = bt_child_btree_FindLeaf(cascdel, val, pos);
+    return node ? node->row[pos] : NULL;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.Reinsert
+// Reinsert a row with modified key
+void atf_amc::bt_child_btree_Reinsert(atf_amc::FCascdel& cascdel, atf_amc::FCascdel& row) {
+    bt_child_btree_Remove(cascdel, row);
+    bt_child_btree_Insert(cascdel, row);
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.Remove
+// Remove element from index. If element is not in index, do nothing.
+void atf_amc::bt_child_btree_Remove(atf_amc::FCascdel& cascdel, atf_amc::FCascdel& row) {
+    cascdel_bt_child_btree_node *node = row.bt_child_btree_leaf;
+    if (node) {
+        int pos = 0;
+        while (node->row[pos] != &row) {
+            pos++;
+        }
+        node->n--;
+        memmove(node->key + pos, node->key + pos + 1, (node->n - pos) * sizeof(node->key[0]));
+        memmove(node->row + pos, node->row + pos + 1, (node->n - pos) * sizeof(node->row[0]));
+        row.bt_child_btree_leaf = NULL;
+        cascdel.bt_child_btree_n--;
+        if (node->n == 0) {
+            bt_child_btree_RemoveNode(cascdel, *node);
+        }
+        while (cascdel.bt_child_btree_root && !cascdel.bt_child_btree_root->leaf && cascdel.bt_child_btree_root->n == 1) {
+            cascdel_bt_child_btree_node *root = cascdel.bt_child_btree_root;
+            cascdel.bt_child_btree_root = root->child[0];
+            cascdel.bt_child_btree_root->parent = NULL;
+            algo_lib::malloc_FreeMem(root, sizeof(cascdel_bt_child_btree_node));
+        }
+    }
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.RemoveAll
+// Empty the index. (The rows are not deleted)
+void atf_amc::bt_child_btree_RemoveAll(atf_amc::FCascdel& cascdel) {
+    bt_child_btree_RemoveAllImpl(cascdel, false);
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.RemoveAllImpl
+// Empty the index. (rows may be deleted if cascdel)
+static void atf_amc::bt_child_btree_RemoveAllImpl(atf_amc::FCascdel& cascdel, bool del) {
+    cascdel_bt_child_btree_node *root = cascdel.bt_child_btree_root;
+    cascdel_bt_child_btree_node *first = root;
+    while (first && !first->leaf) {
+        first = first->child[0];
+    }
+    cascdel.bt_child_btree_root = NULL;
+    cascdel.bt_child_btree_n = 0;
+    for (cascdel_bt_child_btree_node *node = first; node; node = node->next) {
+        for (int i = 0; i < node->n; i++) {
+            node->row[i]->bt_child_btree_leaf = NULL;
+        }
+    }
+    if (del) {
+        for (cascdel_bt_child_btree_node *node = first; node; node = node->next) {
+            for (int i = 0; i < node->n; i++) {
+                atf_amc::FCascdel &row = *node->row[i];
+                cascdel_Delete(row);
+            }
+        }
+    }
+    if (root) {
+        bt_child_btree_FreeNode(cascdel, root);
+    }
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.RemoveFirst
+// If the tree is empty, return NULL. Otherwise unlink and return pointer to first element.
+atf_amc::FCascdel* atf_amc::bt_child_btree_RemoveFirst(atf_amc::FCascdel& cascdel) {
+    atf_amc::FCascdel *row = bt_child_btree_First(cascdel);
+    if (row) {
+        bt_child_btree_Remove(cascdel, *row);
+    }
+    return row;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.RemoveNode
+// Unlink empty node from the tree and free it
+static void atf_amc::bt_child_btree_RemoveNode(atf_amc::FCascdel& cascdel, cascdel_bt_child_btree_node &node) {
+    if (node.leaf) {
+        if (node.prev) {
+            node.prev->next = node.next;
+        }
+        if (node.next) {
+            node.next->prev = node.prev;
+        }
+    }
+    cascdel_bt_child_btree_node *par = node.parent;
+    if (!par) {
+        cascdel.bt_child_btree_root = NULL;
+    } else if (par->n == 1) {
+        bt_child_btree_RemoveNode(cascdel, *par);
+    } else {
+        int pos = 0;
+        while (par->child[pos] != &node) {
+            pos++;
+        }
+        // removing child 0 drops separator 1; otherwise the separator to the left of the child goes
+        int kpos = i32_Max(pos, 1);
+        memmove(par->key + kpos, par->key + kpos + 1, (par->n - kpos - 1) * sizeof(par->key[0]));
+        memmove(par->child + pos, par->child + pos + 1, (par->n - pos - 1) * sizeof(par->child[0]));
+        par->n--;
+    }
+    algo_lib::malloc_FreeMem(&node, sizeof(cascdel_bt_child_btree_node));
+}
+
 // --- atf_amc.FCascdel..Init
 // Set all fields to initial values.
 void atf_amc::FCascdel_Init(atf_amc::FCascdel& cascdel) {
@@ -1940,6 +2377,8 @@ void atf_amc::FCascdel_Init(atf_amc::FCascdel& cascdel) {
     cascdel.zd_childlist_tail = NULL; // (atf_amc.FCascdel.zd_childlist)
     cascdel.tr_child_atree_root = NULL; // (atf_amc.FCascdel.tr_child_atree)
     cascdel.tr_child_atree_n = 0;
+    cascdel.bt_child_btree_root = NULL; // (atf_amc.FCascdel.bt_child_btree)
+    cascdel.bt_child_btree_n = 0;
     cascdel.cascdel_c_child_ptrary_in_ary = bool(false);
     cascdel.ind_child_thash_next = (atf_amc::FCascdel*)-1; // (atf_amc.FCascdel.ind_child_thash) not-in-hash
     cascdel.bh_child_bheap_idx = -1; // (atf_amc.FCascdel.bh_child_bheap) not-in-heap
@@ -1949,6 +2388,7 @@ void atf_amc::FCascdel_Init(atf_amc::FCascdel& cascdel) {
     cascdel.tr_child_atree_left = NULL;
     cascdel.tr_child_atree_right = NULL;
     cascdel.tr_child_atree_depth = 0;
+    cascdel.bt_child_btree_leaf = NULL; // (atf_amc.FCascdel.bt_child_btree) not in tree
     cascdel.cascdel_next = (atf_amc::FCascdel*)-1; // (atf_amc.FDb.cascdel) not-in-tpool's freelist
 }
 
@@ -2040,9 +2480,30 @@ void atf_amc::cascdel_bh_child_bheap_curs_Next(cascdel_bh_child_bheap_curs &curs
     }
 }
 
+// --- atf_amc.FCascdel.bt_child_btree_curs.Seek
+// position cursor at the first row with key >= VAL
+void atf_amc::cascdel_bt_child_btree_curs_Seek(cascdel_bt_child_btree_curs &curs, atf_amc::FCascdel& parent, u32 val) {
+    curs.node = bt_child_btree_FindLeaf(parent, val, curs.index);
+}
+
+// --- atf_amc.FCascdel.bt_child_btree_rcurs.Seek
+// position cursor at the last row with key < VAL
+void atf_amc::cascdel_bt_child_btree_rcurs_Seek(cascdel_bt_child_btree_rcurs &curs, atf_amc::FCascdel& parent, u32 val) {
+    curs.node = bt_child_btree_FindLeaf(parent, val, curs.index);
+    if (!curs.node) {
+        cascdel_bt_child_btree_rcurs_Reset(curs, parent);
+    } else if (curs.index > 0) {
+        curs.index--;
+    } else {
+        curs.node  = curs.node->prev;
+        curs.index = curs.node ? curs.node->n - 1 : 0;
+    }
+}
+
 // --- atf_amc.FCascdel..Uninit
 void atf_amc::FCascdel_Uninit(atf_amc::FCascdel& cascdel) {
     atf_amc::FCascdel &row = cascdel; (void)row;
+    bt_child_btree_Cascdel(cascdel); // dmmeta.cascdel:atf_amc.FCascdel.bt_child_btree
     tr_child_atree_Cascdel(cascdel); // dmmeta.cascdel:atf_amc.FCascdel.tr_child_atree
     zd_childlist_Cascdel(cascdel); // dmmeta.cascdel:atf_amc.FCascdel.zd_childlist
     bh_child_bheap_Cascdel(cascdel); // dmmeta.cascdel:atf_amc.FCascdel.bh_child_bheap
@@ -2068,8 +2529,14 @@ void atf_amc::FCascdel_Uninit(atf_amc::FCascdel& cascdel) {
     if (p_p_parent)  {
         tr_child_atree_Remove(*p_p_parent, row);// remove cascdel from index tr_child_atree
     }
+    if (p_p_parent)  {
+        bt_child_btree_Remove(*p_p_parent, row);// remove cascdel from index bt_child_btree
+    }
     key_Cleanup(cascdel); // dmmeta.fcleanup:atf_amc.FCascdel.key
 
+    // atf_amc.FCascdel.bt_child_btree.Uninit (Btree)  //
+    bt_child_btree_RemoveAll(cascdel); // (atf_amc.FCascdel.bt_child_btree)
+
     // atf_amc.FCascdel.bh_child_bheap.Uninit (Bheap)  //
     algo_lib::malloc_FreeMem((u8*)cascdel.bh_child_bheap_elems, sizeof(atf_amc::FCascdel*)*cascdel.bh_child_bheap_max); // (atf_amc.FCascdel.bh_child_bheap)
 
@@ -3472,7 +3939,8 @@ bool atf_amc::types_XrefMaybe(atf_amc::FTypeS &row) {
 // --- atf_amc.FDb.ind_types.Find
 // Find row by key. Return NULL if not found.
 atf_amc::FTypeS* atf_amc::ind_types_Find(i32 key) {
-    u32 index = i32_Hash(0, key) & (_db.ind_types_buckets_n - 1);
+    u32 hash  = i32_Hash(0, key);
+    u32 index = hash & (_db.ind_types_buckets_n - 1);
     atf_amc::FTypeS* *e = &_db.ind_types_buckets_elems[index];
     atf_amc::FTypeS* ret=NULL;
     do {
@@ -3506,7 +3974,8 @@ bool atf_amc::ind_types_InsertMaybe(atf_amc::FTypeS& row) {
     ind_types_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_types_next == (atf_amc::FTypeS*)-1)) {// check if in hash already
-        u32 index = i32_Hash(0, row.types) & (_db.ind_types_buckets_n - 1);
+        u32 hash  = i32_Hash(0, row.types);
+        u32 index = hash & (_db.ind_types_buckets_n - 1);
         atf_amc::FTypeS* *prev = &_db.ind_types_buckets_elems[index];
         do {
             atf_amc::FTypeS* ret = *prev;
@@ -3532,7 +4001,8 @@ bool atf_amc::ind_types_InsertMaybe(atf_amc::FTypeS& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void atf_amc::ind_types_Remove(atf_amc::FTypeS& row) {
     if (LIKELY(row.ind_types_next != (atf_amc::FTypeS*)-1)) {// check if in hash already
-        u32 index = i32_Hash(0, row.types) & (_db.ind_types_buckets_n - 1);
+        u32 hash  = i32_Hash(0, row.types);
+        u32 index = hash & (_db.ind_types_buckets_n - 1);
         atf_amc::FTypeS* *prev = &_db.ind_types_buckets_elems[index]; // addr of pointer to current element
         while (atf_amc::FTypeS *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -3585,7 +4055,8 @@ void atf_amc::ind_types_Reserve(int n) {
 // --- atf_amc.FDb.ind_typea.Find
 // Find row by key. Return NULL if not found.
 atf_amc::FTypeA* atf_amc::ind_typea_Find(i32 key) {
-    u32 index = i32_Hash(0, key) & (_db.ind_typea_buckets_n - 1);
+    u32 hash  = i32_Hash(0, key);
+    u32 index = hash & (_db.ind_typea_buckets_n - 1);
     atf_amc::FTypeA* *e = &_db.ind_typea_buckets_elems[index];
     atf_amc::FTypeA* ret=NULL;
     do {
@@ -3619,7 +4090,8 @@ bool atf_amc::ind_typea_InsertMaybe(atf_amc::FTypeA& row) {
     ind_typea_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_typea_next == (atf_amc::FTypeA*)-1)) {// check if in hash already
-        u32 index = i32_Hash(0, row.typea) & (_db.ind_typea_buckets_n - 1);
+        u32 hash  = i32_Hash(0, row.typea);
+        u32 index = hash & (_db.ind_typea_buckets_n - 1);
         atf_amc::FTypeA* *prev = &_db.ind_typea_buckets_elems[index];
         do {
             atf_amc::FTypeA* ret = *prev;
@@ -3645,7 +4117,8 @@ bool atf_amc::ind_typea_InsertMaybe(atf_amc::FTypeA& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void atf_amc::ind_typea_Remove(atf_amc::FTypeA& row) {
     if (LIKELY(row.ind_typea_next != (atf_amc::FTypeA*)-1)) {// check if in hash already
-        u32 index = i32_Hash(0, row.typea) & (_db.ind_typea_buckets_n - 1);
+        u32 hash  = i32_Hash(0, row.typea);
+        u32 index = hash & (_db.ind_typea_buckets_n - 1);
         atf_amc::FTypeA* *prev = &_db.ind_typea_buckets_elems[index]; // addr of pointer to current element
         while (atf_amc::FTypeA *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -3791,16 +4264,23 @@ bool atf_amc::InsertStrptrMaybe(algo::strptr str) {
         case atf_amc_TableId_atf_amc_TypeS: { // finput:atf_amc.FDb.types
             atf_amc::TypeS elem;
             retval = atf_amc::TypeS_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(atf_amc_TableId_atf_amc_TypeS, &elem, sizeof(elem));
+            }
             retval = retval && types_InputMaybe(elem);
             break;
         }
         case atf_amc_TableId_atf_amc_TypeT: { // finput:atf_amc.FDb.typet
             atf_amc::TypeT elem;
             retval = atf_amc::TypeT_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(atf_amc_TableId_atf_amc_TypeT, &elem, sizeof(elem));
+            }
             retval = retval && typet_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -3810,6 +4290,36 @@ bool atf_amc::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- atf_amc.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool atf_amc::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case atf_amc_TableId_atf_amc_TypeS: { // finput:atf_amc.FDb.types
+            atf_amc::TypeS elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = types_InputMaybe(elem);
+            }
+            break;
+        }
+        case atf_amc_TableId_atf_amc_TypeT: { // finput:atf_amc.FDb.typet
+            atf_amc::TypeT elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = typet_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- atf_amc.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool atf_amc::LoadTuplesMaybe(algo::strptr root) {
@@ -3817,7 +4327,8 @@ bool atf_amc::LoadTuplesMaybe(algo::strptr root) {
     static const char *ssimfiles[] = {
 
         NULL};
-        retval = algo_lib::DoLoadTuples(root, atf_amc::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "atf_amc", "3b9943558be9b03e79fade60297ec50f1d4702a3"
+        , atf_amc::InsertStrptrMaybe, atf_amc::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -4049,7 +4560,8 @@ bool atf_amc::cstring_XrefMaybe(atf_amc::FCstring &row) {
 // --- atf_amc.FDb.ind_cstring.Find
 // Find row by key. Return NULL if not found.
 atf_amc::FCstring* atf_amc::ind_cstring_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_cstring_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_cstring_buckets_n - 1);
     atf_amc::FCstring* *e = &_db.ind_cstring_buckets_elems[index];
     atf_amc::FCstring* ret=NULL;
     do {
@@ -4083,7 +4595,8 @@ bool atf_amc::ind_cstring_InsertMaybe(atf_amc::FCstring& row) {
     ind_cstring_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_cstring_next == (atf_amc::FCstring*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.str) & (_db.ind_cstring_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.str);
+        u32 index = hash & (_db.ind_cstring_buckets_n - 1);
         atf_amc::FCstring* *prev = &_db.ind_cstring_buckets_elems[index];
         do {
             atf_amc::FCstring* ret = *prev;
@@ -4109,7 +4622,8 @@ bool atf_amc::ind_cstring_InsertMaybe(atf_amc::FCstring& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void atf_amc::ind_cstring_Remove(atf_amc::FCstring& row) {
     if (LIKELY(row.ind_cstring_next != (atf_amc::FCstring*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.str) & (_db.ind_cstring_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.str);
+        u32 index = hash & (_db.ind_cstring_buckets_n - 1);
         atf_amc::FCstring* *prev = &_db.ind_cstring_buckets_elems[index]; // addr of pointer to current element
         while (atf_amc::FCstring *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -4740,204 +5254,222 @@ static void atf_amc::amctest_LoadStatic() {
         const char *s;
         void (*step)();
     } data[] = {
-        { "atfdb.amctest  amctest:AmcSort  comment:\"\"", atf_amc::amctest_AmcSort }
-        ,{ "atfdb.amctest  amctest:BhFirstChanged1  comment:\"\"", atf_amc::amctest_BhFirstChanged1 }
-        ,{ "atfdb.amctest  amctest:BhFirstChanged2  comment:\"Insert 100 items in ascending order -- check that trigger fires once\"", atf_amc::amctest_BhFirstChanged2 }
-        ,{ "atfdb.amctest  amctest:BhFirstChanged3  comment:\"Insert 100 items in descending order -- check that trigger fires for each\"", atf_amc::amctest_BhFirstChanged3 }
-        ,{ "atfdb.amctest  amctest:BheapCursor  comment:\"Test for cascade deletion\"", atf_amc::amctest_BheapCursor }
-        ,{ "atfdb.amctest  amctest:BheapInsert100  comment:\"Ascending, descending, mixed\"", atf_amc::amctest_BheapInsert100 }
-        ,{ "atfdb.amctest  amctest:BigEndian  comment:\"\"", atf_amc::amctest_BigEndian }
-        ,{ "atfdb.amctest  amctest:BigendFconst  comment:\"\"", atf_amc::amctest_BigendFconst }
-        ,{ "atfdb.amctest  amctest:BitfldNet  comment:\"Test bitfield extraction/insertion (big-endian storage)\"", atf_amc::amctest_BitfldNet }
-        ,{ "atfdb.amctest  amctest:BitfldTuple  comment:\"Test bitfield extraction/insertion when reading tuple\"", atf_amc::amctest_BitfldTuple }
-        ,{ "atfdb.amctest  amctest:CascdelAtree  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelAtree }
-        ,{ "atfdb.amctest  amctest:CascdelBheap  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelBheap }
-        ,{ "atfdb.amctest  amctest:CascdelBheapChain  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelBheapChain }
-        ,{ "atfdb.amctest  amctest:CascdelPtr  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelPtr }
-        ,{ "atfdb.amctest  amctest:CascdelPtrary  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelPtrary }
-        ,{ "atfdb.amctest  amctest:CascdelPtraryChain  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelPtraryChain }
-        ,{ "atfdb.amctest  amctest:CascdelThash  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelThash }
-        ,{ "atfdb.amctest  amctest:CascdelThashChain  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelThashChain }
-        ,{ "atfdb.amctest  amctest:CascdelZdlist  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelZdlist }
-        ,{ "atfdb.amctest  amctest:CascdelZdlistChain  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelZdlistChain }
-        ,{ "atfdb.amctest  amctest:CascdelZslist  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelZslist }
-        ,{ "atfdb.amctest  amctest:CascdelZslistChain  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelZslistChain }
-        ,{ "atfdb.amctest  amctest:CastDown  comment:\"Cast from header to message\"", atf_amc::amctest_CastDown }
-        ,{ "atfdb.amctest  amctest:CastDownFail  comment:\"Cast from header to unrelated message type\"", atf_amc::amctest_CastDownFail }
-        ,{ "atfdb.amctest  amctest:CastDownTooShort  comment:\"Cast from header to message -- length too short\"", atf_amc::amctest_CastDownTooShort }
-        ,{ "atfdb.amctest  amctest:CastUp  comment:\"Cast from message to its header\"", atf_amc::amctest_CastUp }
-        ,{ "atfdb.amctest  amctest:CdlistDfltCtor  comment:\"\"", atf_amc::amctest_CdlistDfltCtor }
-        ,{ "atfdb.amctest  amctest:CdlistFlush100  comment:\"\"", atf_amc::amctest_CdlistFlush100 }
-        ,{ "atfdb.amctest  amctest:CdlistFlushEmpty  comment:\"\"", atf_amc::amctest_CdlistFlushEmpty }
-        ,{ "atfdb.amctest  amctest:CdlistInsert1  comment:\"\"", atf_amc::amctest_CdlistInsert1 }
-        ,{ "atfdb.amctest  amctest:CdlistInsert2  comment:\"\"", atf_amc::amctest_CdlistInsert2 }
-        ,{ "atfdb.amctest  amctest:CdlistInsert3  comment:\"\"", atf_amc::amctest_CdlistInsert3 }
-        ,{ "atfdb.amctest  amctest:CdlistInsertHead1  comment:\"\"", atf_amc::amctest_CdlistInsertHead1 }
-        ,{ "atfdb.amctest  amctest:CdlistInsertHead2  comment:\"\"", atf_amc::amctest_CdlistInsertHead2 }
-        ,{ "atfdb.amctest  amctest:CdlistInsertHead3  comment:\"\"", atf_amc::amctest_CdlistInsertHead3 }
-        ,{ "atfdb.amctest  amctest:CdlistInsertMaybe  comment:\"\"", atf_amc::amctest_CdlistInsertMaybe }
-        ,{ "atfdb.amctest  amctest:CdlistItemDfltCtor  comment:\"\"", atf_amc::amctest_CdlistItemDfltCtor }
-        ,{ "atfdb.amctest  amctest:CdlistRemove  comment:\"\"", atf_amc::amctest_CdlistRemove }
-        ,{ "atfdb.amctest  amctest:CdlistRemoveFirst  comment:\"\"", atf_amc::amctest_CdlistRemoveFirst }
-        ,{ "atfdb.amctest  amctest:CdlistRotateFirst  comment:\"\"", atf_amc::amctest_CdlistRotateFirst }
-        ,{ "atfdb.amctest  amctest:CleanupOrder  comment:\"\"", atf_amc::amctest_CleanupOrder }
-        ,{ "atfdb.amctest  amctest:CopyOut1  comment:Pre-check", atf_amc::amctest_CopyOut1 }
-        ,{ "atfdb.amctest  amctest:CopyOut2  comment:\"Check that derived fields were copied to base\"", atf_amc::amctest_CopyOut2 }
-        ,{ "atfdb.amctest  amctest:CopyOut3  comment:\"Check that type/length fields were not copied to base\"", atf_amc::amctest_CopyOut3 }
-        ,{ "atfdb.amctest  amctest:CslistFirstChangedFlush  comment:\"\"", atf_amc::amctest_CslistFirstChangedFlush }
-        ,{ "atfdb.amctest  amctest:CslistFirstChangedInsert  comment:\"\"", atf_amc::amctest_CslistFirstChangedInsert }
-        ,{ "atfdb.amctest  amctest:CslistFirstChangedRemove  comment:\"\"", atf_amc::amctest_CslistFirstChangedRemove }
-        ,{ "atfdb.amctest  amctest:CslistFirstChangedRemoveFirst  comment:\"\"", atf_amc::amctest_CslistFirstChangedRemoveFirst }
-        ,{ "atfdb.amctest  amctest:CslistHeadFirstChangedInsert  comment:\"\"", atf_amc::amctest_CslistHeadFirstChangedInsert }
-        ,{ "atfdb.amctest  amctest:CslistInsert1  comment:\"\"", atf_amc::amctest_CslistInsert1 }
-        ,{ "atfdb.amctest  amctest:CslistInsert2  comment:\"\"", atf_amc::amctest_CslistInsert2 }
-        ,{ "atfdb.amctest  amctest:CslistInsert3  comment:\"\"", atf_amc::amctest_CslistInsert3 }
-        ,{ "atfdb.amctest  amctest:CslistInsertHead1  comment:\"\"", atf_amc::amctest_CslistInsertHead1 }
-        ,{ "atfdb.amctest  amctest:CslistInsertHead2  comment:\"\"", atf_amc::amctest_CslistInsertHead2 }
-        ,{ "atfdb.amctest  amctest:CslistInsertHead3  comment:\"\"", atf_amc::amctest_CslistInsertHead3 }
-        ,{ "atfdb.amctest  amctest:CslistRemove  comment:\"\"", atf_amc::amctest_CslistRemove }
-        ,{ "atfdb.amctest  amctest:CslistRemoveFirst  comment:\"\"", atf_amc::amctest_CslistRemoveFirst }
-        ,{ "atfdb.amctest  amctest:CslistRotateFirst  comment:\"\"", atf_amc::amctest_CslistRotateFirst }
-        ,{ "atfdb.amctest  amctest:Delptr  comment:\"Test Delptr\"", atf_amc::amctest_Delptr }
-        ,{ "atfdb.amctest  amctest:DispRead1  comment:\"Read a message containing varlen char field\"", atf_amc::amctest_DispRead1 }
-        ,{ "atfdb.amctest  amctest:DispRead2  comment:\"Read a message containing several varlen fields\"", atf_amc::amctest_DispRead2 }
-        ,{ "atfdb.amctest  amctest:DispRead3  comment:\"Time reading\"", atf_amc::amctest_DispRead3 }
-        ,{ "atfdb.amctest  amctest:DispRead4  comment:\"Read Seqmsg with varlen payload\"", atf_amc::amctest_DispRead4 }
-        ,{ "atfdb.amctest  amctest:DispReadSsimfile  comment:\"Use a Dispatch to read several tuples\"", atf_amc::amctest_DispReadSsimfile }
-        ,{ "atfdb.amctest  amctest:ExecSh  comment:\"Execute subshell process\"", atf_amc::amctest_ExecSh }
-        ,{ "atfdb.amctest  amctest:Exec_Status  comment:\"Check return status of waitpid()\"", atf_amc::amctest_Exec_Status }
-        ,{ "atfdb.amctest  amctest:Fcmp  comment:\"Test string comparison functions as generated with fcmp\"", atf_amc::amctest_Fcmp }
-        ,{ "atfdb.amctest  amctest:Fconst  comment:\"Test for fconst\"", atf_amc::amctest_Fconst }
-        ,{ "atfdb.amctest  amctest:Hook1  comment:\"Test Hook functions\"", atf_amc::amctest_Hook1 }
-        ,{ "atfdb.amctest  amctest:Hook2  comment:\"Test Hook functions\"", atf_amc::amctest_Hook2 }
-        ,{ "atfdb.amctest  amctest:ImdXref  comment:\"\"", atf_amc::amctest_ImdXref }
-        ,{ "atfdb.amctest  amctest:Inlary_ReadPrint  comment:\"Check Inlary read/print\"", atf_amc::amctest_Inlary_ReadPrint }
-        ,{ "atfdb.amctest  amctest:LineIter  comment:\"Iterate over lines\"", atf_amc::amctest_LineIter }
-        ,{ "atfdb.amctest  amctest:Lpool  comment:\"\"", atf_amc::amctest_Lpool }
-        ,{ "atfdb.amctest  amctest:Minmax  comment:\"\"", atf_amc::amctest_Minmax }
-        ,{ "atfdb.amctest  amctest:MsgCurs  comment:\"Check message cursor over memptr\"", atf_amc::amctest_MsgCurs }
-        ,{ "atfdb.amctest  amctest:MsgCurs2  comment:\"\"", atf_amc::amctest_MsgCurs2 }
-        ,{ "atfdb.amctest  amctest:MsgCurs3  comment:\"\"", atf_amc::amctest_MsgCurs3 }
-        ,{ "atfdb.amctest  amctest:MsgCurs4  comment:\"\"", atf_amc::amctest_MsgCurs4 }
-        ,{ "atfdb.amctest  amctest:MsgLength  comment:\"Check GetMsgLength, GetMsgMemptr functions\"", atf_amc::amctest_MsgLength }
-        ,{ "atfdb.amctest  amctest:Numstr  comment:\"\"", atf_amc::amctest_Numstr }
-        ,{ "atfdb.amctest  amctest:NumstrCorruption  comment:\"Check that corruption doesn't occur during numstr formatting.\"", atf_amc::amctest_NumstrCorruption }
-        ,{ "atfdb.amctest  amctest:OptAlloc  comment:\"\"", atf_amc::amctest_OptAlloc }
-        ,{ "atfdb.amctest  amctest:OptG  comment:,", atf_amc::amctest_OptG }
-        ,{ "atfdb.amctest  amctest:OptG2  comment:\"Outer length too short\"", atf_amc::amctest_OptG2 }
-        ,{ "atfdb.amctest  amctest:OptG8  comment:\"Construct OptG in memptr\"", atf_amc::amctest_OptG8 }
-        ,{ "atfdb.amctest  amctest:OptG9  comment:\"Print struct with Opt member\"", atf_amc::amctest_OptG9 }
-        ,{ "atfdb.amctest  amctest:OptOptG3  comment:\"Access valid opt varlen field successfully\"", atf_amc::amctest_OptOptG3 }
-        ,{ "atfdb.amctest  amctest:OptOptG4  comment:\"??\"", atf_amc::amctest_OptOptG4 }
-        ,{ "atfdb.amctest  amctest:OptOptG5  comment:\"Inner length too short\"", atf_amc::amctest_OptOptG5 }
-        ,{ "atfdb.amctest  amctest:OptOptG6  comment:\"Inner length extends past outer length\"", atf_amc::amctest_OptOptG6 }
-        ,{ "atfdb.amctest  amctest:OptOptG7  comment:\"Fetch two optional elements\"", atf_amc::amctest_OptOptG7 }
-        ,{ "atfdb.amctest  amctest:OptOptG8  comment:\"Construct OptOptG in memptr\"", atf_amc::amctest_OptOptG8 }
-        ,{ "atfdb.amctest  amctest:OptOptG9  comment:\"Print struct with Opt member\"", atf_amc::amctest_OptOptG9 }
-        ,{ "atfdb.amctest  amctest:PerfSortString  comment:\"\"", atf_amc::amctest_PerfSortString }
-        ,{ "atfdb.amctest  amctest:PrintBase36  comment:\"\"", atf_amc::amctest_PrintBase36 }
-        ,{ "atfdb.amctest  amctest:PrintRawGconst  comment:\"Check that gconst field within tuple is printed as raw\"", atf_amc::amctest_PrintRawGconst }
-        ,{ "atfdb.amctest  amctest:PtraryInsert  comment:\"Insert/Remove invariants for Ptrary\"", atf_amc::amctest_PtraryInsert }
-        ,{ "atfdb.amctest  amctest:ReadProc  comment:\"Read from subprocess\"", atf_amc::amctest_ReadProc }
-        ,{ "atfdb.amctest  amctest:ReadTuple1  comment:\"A single field is printed without field name\"", atf_amc::amctest_ReadTuple1 }
-        ,{ "atfdb.amctest  amctest:ReadTuple2  comment:\"Two fields are printed as name-value pairs.\"", atf_amc::amctest_ReadTuple2 }
-        ,{ "atfdb.amctest  amctest:ReadTuple3  comment:Attr_curs", atf_amc::amctest_ReadTuple3 }
-        ,{ "atfdb.amctest  amctest:ReadTuple4  comment:\"Attr_curs -- empty string\"", atf_amc::amctest_ReadTuple4 }
-        ,{ "atfdb.amctest  amctest:ReadTuple5  comment:\"Attr_curs -- quoted strings\"", atf_amc::amctest_ReadTuple5 }
-        ,{ "atfdb.amctest  amctest:Scratch  comment:\"Scratch area for new test development\"", atf_amc::amctest_Scratch }
-        ,{ "atfdb.amctest  amctest:SetGetnumBase10  comment:\"\"", atf_amc::amctest_SetGetnumBase10 }
-        ,{ "atfdb.amctest  amctest:SubstrDfltval  comment:\"\"", atf_amc::amctest_SubstrDfltval }
-        ,{ "atfdb.amctest  amctest:TaryInit  comment:\"u32: Add element to Tary, check that it's initialized\"", atf_amc::amctest_TaryInit }
-        ,{ "atfdb.amctest  amctest:TaryInit2  comment:\"u32: Add N elements to Tary, check that they're initialized\"", atf_amc::amctest_TaryInit2 }
-        ,{ "atfdb.amctest  amctest:TaryInit3  comment:\"u8: Add element to Tary, check that it's initialized\"", atf_amc::amctest_TaryInit3 }
-        ,{ "atfdb.amctest  amctest:TaryInit4  comment:\"u8: Add N elements to Tary, check that they're initialized\"", atf_amc::amctest_TaryInit4 }
-        ,{ "atfdb.amctest  amctest:TaryReserve  comment:\"\"", atf_amc::amctest_TaryReserve }
-        ,{ "atfdb.amctest  amctest:TestBitfld  comment:\"U16 bitfields: Set values, check that they were set\"", atf_amc::amctest_TestBitfld }
-        ,{ "atfdb.amctest  amctest:TestBitfld2  comment:\"U128 bitfields: Set values, check that they were set\"", atf_amc::amctest_TestBitfld2 }
-        ,{ "atfdb.amctest  amctest:TestCstring1  comment:\"Basic test\"", atf_amc::amctest_TestCstring1 }
-        ,{ "atfdb.amctest  amctest:TestCstring2  comment:\"Insert cstring.\"", atf_amc::amctest_TestCstring2 }
-        ,{ "atfdb.amctest  amctest:TestDispFilter  comment:\"DispFilter Basic Match\"", atf_amc::amctest_TestDispFilter }
-        ,{ "atfdb.amctest  amctest:TestDispFilter2  comment:\"DispFilter Regx\"", atf_amc::amctest_TestDispFilter2 }
-        ,{ "atfdb.amctest  amctest:TestDispFilter3  comment:\"DispFilter Explicit int field\"", atf_amc::amctest_TestDispFilter3 }
-        ,{ "atfdb.amctest  amctest:TestDispFilter4  comment:\"DispFilter Date\"", atf_amc::amctest_TestDispFilter4 }
-        ,{ "atfdb.amctest  amctest:TestInsertX2  comment:\"Insert instance of TypeT, xrefing with type A\"", atf_amc::amctest_TestInsertX2 }
-        ,{ "atfdb.amctest  amctest:TestInsertX3  comment:\"Insert instance of TypeT, invalid xref with type A. Expect rollback\"", atf_amc::amctest_TestInsertX3 }
-        ,{ "atfdb.amctest  amctest:TestPmask1  comment:\"Default ctor, check that pmask field is !PresentQ\"", atf_amc::amctest_TestPmask1 }
-        ,{ "atfdb.amctest  amctest:TestPmask2  comment:\"Set field, check that field is PresentQ\"", atf_amc::amctest_TestPmask2 }
-        ,{ "atfdb.amctest  amctest:TestPmask3  comment:\"Read ctype from string that doesn't have pmask field. It must be !PresentQ\"", atf_amc::amctest_TestPmask3 }
-        ,{ "atfdb.amctest  amctest:TestPmask4  comment:\"Read ctype from string that has a pmask field. It must be PresentQ\"", atf_amc::amctest_TestPmask4 }
-        ,{ "atfdb.amctest  amctest:TestPmask5  comment:\"Check explicitly that pmask is being updated by Set\"", atf_amc::amctest_TestPmask5 }
-        ,{ "atfdb.amctest  amctest:TestPmask6  comment:\"Check that pmask isn't read from string\"", atf_amc::amctest_TestPmask6 }
-        ,{ "atfdb.amctest  amctest:TestPmask7  comment:\"Check that 128-bit pmask works.\"", atf_amc::amctest_TestPmask7 }
-        ,{ "atfdb.amctest  amctest:TestPmask8  comment:\"Check pmask-555.\"", atf_amc::amctest_TestPmask8 }
-        ,{ "atfdb.amctest  amctest:TestRegx1  comment:\"\"", atf_amc::amctest_TestRegx1 }
-        ,{ "atfdb.amctest  amctest:TestSep1  comment:\"Print Test\"", atf_amc::amctest_TestSep1 }
-        ,{ "atfdb.amctest  amctest:TestSep2  comment:\"Read Test\"", atf_amc::amctest_TestSep2 }
-        ,{ "atfdb.amctest  amctest:TestString  comment:\"\"", atf_amc::amctest_TestString }
-        ,{ "atfdb.amctest  amctest:Typetag  comment:\"\"", atf_amc::amctest_Typetag }
-        ,{ "atfdb.amctest  amctest:VarlenAlloc  comment:\"\"", atf_amc::amctest_VarlenAlloc }
-        ,{ "atfdb.amctest  amctest:VarlenExternLength  comment:\"\"", atf_amc::amctest_VarlenExternLength }
-        ,{ "atfdb.amctest  amctest:ZdlistDfltCtor  comment:\"\"", atf_amc::amctest_ZdlistDfltCtor }
-        ,{ "atfdb.amctest  amctest:ZdlistFlush100  comment:\"\"", atf_amc::amctest_ZdlistFlush100 }
-        ,{ "atfdb.amctest  amctest:ZdlistFlushEmpty  comment:\"\"", atf_amc::amctest_ZdlistFlushEmpty }
-        ,{ "atfdb.amctest  amctest:ZdlistInsert1  comment:\"\"", atf_amc::amctest_ZdlistInsert1 }
-        ,{ "atfdb.amctest  amctest:ZdlistInsert2  comment:\"\"", atf_amc::amctest_ZdlistInsert2 }
-        ,{ "atfdb.amctest  amctest:ZdlistInsert3  comment:\"\"", atf_amc::amctest_ZdlistInsert3 }
-        ,{ "atfdb.amctest  amctest:ZdlistInsertHead1  comment:\"\"", atf_amc::amctest_ZdlistInsertHead1 }
-        ,{ "atfdb.amctest  amctest:ZdlistInsertHead2  comment:\"\"", atf_amc::amctest_ZdlistInsertHead2 }
-        ,{ "atfdb.amctest  amctest:ZdlistInsertHead3  comment:\"\"", atf_amc::amctest_ZdlistInsertHead3 }
-        ,{ "atfdb.amctest  amctest:ZdlistInsertHeadNoTail1  comment:\"\"", atf_amc::amctest_ZdlistInsertHeadNoTail1 }
-        ,{ "atfdb.amctest  amctest:ZdlistInsertHeadNoTail2  comment:\"\"", atf_amc::amctest_ZdlistInsertHeadNoTail2 }
-        ,{ "atfdb.amctest  amctest:ZdlistInsertHeadNoTail3  comment:\"\"", atf_amc::amctest_ZdlistInsertHeadNoTail3 }
-        ,{ "atfdb.amctest  amctest:ZdlistInsertMaybe  comment:\"\"", atf_amc::amctest_ZdlistInsertMaybe }
-        ,{ "atfdb.amctest  amctest:ZdlistItemDfltCtor  comment:\"\"", atf_amc::amctest_ZdlistItemDfltCtor }
-        ,{ "atfdb.amctest  amctest:ZdlistRemove  comment:\"\"", atf_amc::amctest_ZdlistRemove }
-        ,{ "atfdb.amctest  amctest:ZdlistRemoveFirst  comment:\"\"", atf_amc::amctest_ZdlistRemoveFirst }
-        ,{ "atfdb.amctest  amctest:ZslistFirstChangedFlush  comment:\"\"", atf_amc::amctest_ZslistFirstChangedFlush }
-        ,{ "atfdb.amctest  amctest:ZslistFirstChangedInsert  comment:\"\"", atf_amc::amctest_ZslistFirstChangedInsert }
-        ,{ "atfdb.amctest  amctest:ZslistFirstChangedRemove  comment:\"\"", atf_amc::amctest_ZslistFirstChangedRemove }
-        ,{ "atfdb.amctest  amctest:ZslistFirstChangedRemoveFirst  comment:\"\"", atf_amc::amctest_ZslistFirstChangedRemoveFirst }
-        ,{ "atfdb.amctest  amctest:ZslistHeadFirstChangedInsert  comment:\"\"", atf_amc::amctest_ZslistHeadFirstChangedInsert }
-        ,{ "atfdb.amctest  amctest:ZslistInsert1  comment:\"\"", atf_amc::amctest_ZslistInsert1 }
-        ,{ "atfdb.amctest  amctest:ZslistInsert2  comment:\"\"", atf_amc::amctest_ZslistInsert2 }
-        ,{ "atfdb.amctest  amctest:ZslistInsert3  comment:\"\"", atf_amc::amctest_ZslistInsert3 }
-        ,{ "atfdb.amctest  amctest:ZslistInsertHead1  comment:\"\"", atf_amc::amctest_ZslistInsertHead1 }
-        ,{ "atfdb.amctest  amctest:ZslistInsertHead2  comment:\"\"", atf_amc::amctest_ZslistInsertHead2 }
-        ,{ "atfdb.amctest  amctest:ZslistInsertHead3  comment:\"\"", atf_amc::amctest_ZslistInsertHead3 }
-        ,{ "atfdb.amctest  amctest:ZslistRemove  comment:\"\"", atf_amc::amctest_ZslistRemove }
-        ,{ "atfdb.amctest  amctest:ZslistRemoveFirst  comment:\"\"", atf_amc::amctest_ZslistRemoveFirst }
-        ,{ "atfdb.amctest  amctest:Zslistmt1  comment:\"\"", atf_amc::amctest_Zslistmt1 }
-        ,{ "atfdb.amctest  amctest:Zslistmt2  comment:\"\"", atf_amc::amctest_Zslistmt2 }
-        ,{ "atfdb.amctest  amctest:Zslistmt3  comment:\"\"", atf_amc::amctest_Zslistmt3 }
-        ,{ "atfdb.amctest  amctest:ZslistmtDfltCtor  comment:\"\"", atf_amc::amctest_ZslistmtDfltCtor }
-        ,{ "atfdb.amctest  amctest:ZslistmtItemDfltCtor  comment:\"\"", atf_amc::amctest_ZslistmtItemDfltCtor }
-        ,{ "atfdb.amctest  amctest:atree_RangeSearch  comment:\"Range searching on atree\"", atf_amc::amctest_atree_RangeSearch }
-        ,{ "atfdb.amctest  amctest:atree_test1  comment:\"Play with the tree, constantly verify invariants\"", atf_amc::amctest_atree_test1 }
-        ,{ "atfdb.amctest  amctest:atree_test2  comment:\"Test FirstGe and LastLt\"", atf_amc::amctest_atree_test2 }
-        ,{ "atfdb.amctest  amctest:bytebuf_test1  comment:\"Initial state -- no data\"", atf_amc::amctest_bytebuf_test1 }
-        ,{ "atfdb.amctest  amctest:bytebuf_test2  comment:\"Write some bytes, read back\"", atf_amc::amctest_bytebuf_test2 }
-        ,{ "atfdb.amctest  amctest:fstep_Inline  comment:\"Check step type\"", atf_amc::amctest_fstep_Inline }
-        ,{ "atfdb.amctest  amctest:fstep_InlineOnce  comment:\"Check step type\"", atf_amc::amctest_fstep_InlineOnce }
-        ,{ "atfdb.amctest  amctest:fstep_InlineRecur  comment:\"Check step type\"", atf_amc::amctest_fstep_InlineRecur }
-        ,{ "atfdb.amctest  amctest:fstep_TimeHookRecur  comment:\"Check step type\"", atf_amc::amctest_fstep_TimeHookRecur }
-        ,{ "atfdb.amctest  amctest:linebuf_test1  comment:\"Initial state -- no line\"", atf_amc::amctest_linebuf_test1 }
-        ,{ "atfdb.amctest  amctest:linebuf_test2  comment:\"write a line, read line back\"", atf_amc::amctest_linebuf_test2 }
-        ,{ "atfdb.amctest  amctest:linebuf_test3  comment:\"write a line in two phases, no message in between\"", atf_amc::amctest_linebuf_test3 }
-        ,{ "atfdb.amctest  amctest:linebuf_test4  comment:\"Write an empty line, read line back\"", atf_amc::amctest_linebuf_test4 }
-        ,{ "atfdb.amctest  amctest:linebuf_test5  comment:\"Line too large -- will never fit. Set EOF\"", atf_amc::amctest_linebuf_test5 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test0  comment:\"initial state - no message\"", atf_amc::amctest_msgbuf_test0 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test1  comment:\"write message, read message back\"", atf_amc::amctest_msgbuf_test1 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test10  comment:\"Force 10,000 messages of various sizes through a pipe\"", atf_amc::amctest_msgbuf_test10 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test1_1  comment:\"write partial message, read should fail\"", atf_amc::amctest_msgbuf_test1_1 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test1_2  comment:\"write message, call RemoveAll, read should fail\"", atf_amc::amctest_msgbuf_test1_2 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test2  comment:\"good message, then not enough data.\"", atf_amc::amctest_msgbuf_test2 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test3  comment:\"good message, then not enough data\"", atf_amc::amctest_msgbuf_test3 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test4  comment:\"message, read partial message, supply new data, read message\"", atf_amc::amctest_msgbuf_test4 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test5  comment:\"If GetMsg returns NULL, buffer is removed from read list\"", atf_amc::amctest_msgbuf_test5 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test6  comment:\"Write runt message to buffer, check that eof and error flags are set\"", atf_amc::amctest_msgbuf_test6 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test7  comment:\"Write HUGE message to buffer, check that error flag is set\"", atf_amc::amctest_msgbuf_test7 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test8  comment:\"Write message to pipe, read it\"", atf_amc::amctest_msgbuf_test8 }
-        ,{ "atfdb.amctest  amctest:msgbuf_test9  comment:\"Write 2 messages to temp buffer. Feed them 1 by one through buffer\"", atf_amc::amctest_msgbuf_test9 }
+        { "atfdb.amctest  amctest:AmcSort  manual:N  comment:\"\"", atf_amc::amctest_AmcSort }
+        ,{ "atfdb.amctest  amctest:AmcSortParallel  manual:N  comment:\"\"", atf_amc::amctest_AmcSortParallel }
+        ,{ "atfdb.amctest  amctest:AmcSortRadix  manual:N  comment:\"\"", atf_amc::amctest_AmcSortRadix }
+        ,{ "atfdb.amctest  amctest:BhFirstChanged1  manual:N  comment:\"\"", atf_amc::amctest_BhFirstChanged1 }
+        ,{ "atfdb.amctest  amctest:BhFirstChanged2  manual:N  comment:\"Insert 100 items in ascending order -- check that trigger fires once\"", atf_amc::amctest_BhFirstChanged2 }
+        ,{ "atfdb.amctest  amctest:BhFirstChanged3  manual:N  comment:\"Insert 100 items in descending order -- check that trigger fires for each\"", atf_amc::amctest_BhFirstChanged3 }
+        ,{ "atfdb.amctest  amctest:BheapCursor  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_BheapCursor }
+        ,{ "atfdb.amctest  amctest:BheapDary  manual:N  comment:\"Randomized test of d-ary and inline-key Bheaps against binary Bheap\"", atf_amc::amctest_BheapDary }
+        ,{ "atfdb.amctest  amctest:BheapInsert100  manual:N  comment:\"Ascending, descending, mixed\"", atf_amc::amctest_BheapInsert100 }
+        ,{ "atfdb.amctest  amctest:BigEndian  manual:N  comment:\"\"", atf_amc::amctest_BigEndian }
+        ,{ "atfdb.amctest  amctest:BigendFconst  manual:N  comment:\"\"", atf_amc::amctest_BigendFconst }
+        ,{ "atfdb.amctest  amctest:BitfldNet  manual:N  comment:\"Test bitfield extraction/insertion (big-endian storage)\"", atf_amc::amctest_BitfldNet }
+        ,{ "atfdb.amctest  amctest:BitfldTuple  manual:N  comment:\"Test bitfield extraction/insertion when reading tuple\"", atf_amc::amctest_BitfldTuple }
+        ,{ "atfdb.amctest  amctest:Btree  manual:N  comment:\"Randomized test of Btree index against Atree\"", atf_amc::amctest_Btree }
+        ,{ "atfdb.amctest  amctest:BtreeCurs  manual:N  comment:\"Forward and backward Btree cursors, Seek\"", atf_amc::amctest_BtreeCurs }
+        ,{ "atfdb.amctest  amctest:CascdelAtree  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelAtree }
+        ,{ "atfdb.amctest  amctest:CascdelBheap  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelBheap }
+        ,{ "atfdb.amctest  amctest:CascdelBheapChain  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelBheapChain }
+        ,{ "atfdb.amctest  amctest:CascdelBtree  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelBtree }
+        ,{ "atfdb.amctest  amctest:CascdelBtreeChain  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelBtreeChain }
+        ,{ "atfdb.amctest  amctest:CascdelPtr  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelPtr }
+        ,{ "atfdb.amctest  amctest:CascdelPtrary  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelPtrary }
+        ,{ "atfdb.amctest  amctest:CascdelPtraryChain  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelPtraryChain }
+        ,{ "atfdb.amctest  amctest:CascdelThash  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelThash }
+        ,{ "atfdb.amctest  amctest:CascdelThashChain  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelThashChain }
+        ,{ "atfdb.amctest  amctest:CascdelZdlist  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelZdlist }
+        ,{ "atfdb.amctest  amctest:CascdelZdlistChain  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelZdlistChain }
+        ,{ "atfdb.amctest  amctest:CascdelZslist  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelZslist }
+        ,{ "atfdb.amctest  amctest:CascdelZslistChain  manual:N  comment:\"Test for cascade deletion\"", atf_amc::amctest_CascdelZslistChain }
+        ,{ "atfdb.amctest  amctest:CastDown  manual:N  comment:\"Cast from header to message\"", atf_amc::amctest_CastDown }
+        ,{ "atfdb.amctest  amctest:CastDownFail  manual:N  comment:\"Cast from header to unrelated message type\"", atf_amc::amctest_CastDownFail }
+        ,{ "atfdb.amctest  amctest:CastDownTooShort  manual:N  comment:\"Cast from header to message -- length too short\"", atf_amc::amctest_CastDownTooShort }
+        ,{ "atfdb.amctest  amctest:CastUp  manual:N  comment:\"Cast from message to its header\"", atf_amc::amctest_CastUp }
+        ,{ "atfdb.amctest  amctest:CdlistDfltCtor  manual:N  comment:\"\"", atf_amc::amctest_CdlistDfltCtor }
+        ,{ "atfdb.amctest  amctest:CdlistFlush100  manual:N  comment:\"\"", atf_amc::amctest_CdlistFlush100 }
+        ,{ "atfdb.amctest  amctest:CdlistFlushEmpty  manual:N  comment:\"\"", atf_amc::amctest_CdlistFlushEmpty }
+        ,{ "atfdb.amctest  amctest:CdlistInsert1  manual:N  comment:\"\"", atf_amc::amctest_CdlistInsert1 }
+        ,{ "atfdb.amctest  amctest:CdlistInsert2  manual:N  comment:\"\"", atf_amc::amctest_CdlistInsert2 }
+        ,{ "atfdb.amctest  amctest:CdlistInsert3  manual:N  comment:\"\"", atf_amc::amctest_CdlistInsert3 }
+        ,{ "atfdb.amctest  amctest:CdlistInsertHead1  manual:N  comment:\"\"", atf_amc::amctest_CdlistInsertHead1 }
+        ,{ "atfdb.amctest  amctest:CdlistInsertHead2  manual:N  comment:\"\"", atf_amc::amctest_CdlistInsertHead2 }
+        ,{ "atfdb.amctest  amctest:CdlistInsertHead3  manual:N  comment:\"\"", atf_amc::amctest_CdlistInsertHead3 }
+        ,{ "atfdb.amctest  amctest:CdlistInsertMaybe  manual:N  comment:\"\"", atf_amc::amctest_CdlistInsertMaybe }
+        ,{ "atfdb.amctest  amctest:CdlistItemDfltCtor  manual:N  comment:\"\"", atf_amc::amctest_CdlistItemDfltCtor }
+        ,{ "atfdb.amctest  amctest:CdlistRemove  manual:N  comment:\"\"", atf_amc::amctest_CdlistRemove }
+        ,{ "atfdb.amctest  amctest:CdlistRemoveFirst  manual:N  comment:\"\"", atf_amc::amctest_CdlistRemoveFirst }
+        ,{ "atfdb.amctest  amctest:CdlistRotateFirst  manual:N  comment:\"\"", atf_amc::amctest_CdlistRotateFirst }
+        ,{ "atfdb.amctest  amctest:CleanupOrder  manual:N  comment:\"\"", atf_amc::amctest_CleanupOrder }
+        ,{ "atfdb.amctest  amctest:CopyOut1  manual:N  comment:Pre-check", atf_amc::amctest_CopyOut1 }
+        ,{ "atfdb.amctest  amctest:CopyOut2  manual:N  comment:\"Check that derived fields were copied to base\"", atf_amc::amctest_CopyOut2 }
+        ,{ "atfdb.amctest  amctest:CopyOut3  manual:N  comment:\"Check that type/length fields were not copied to base\"", atf_amc::amctest_CopyOut3 }
+        ,{ "atfdb.amctest  amctest:CslistFirstChangedFlush  manual:N  comment:\"\"", atf_amc::amctest_CslistFirstChangedFlush }
+        ,{ "atfdb.amctest  amctest:CslistFirstChangedInsert  manual:N  comment:\"\"", atf_amc::amctest_CslistFirstChangedInsert }
+        ,{ "atfdb.amctest  amctest:CslistFirstChangedRemove  manual:N  comment:\"\"", atf_amc::amctest_CslistFirstChangedRemove }
+        ,{ "atfdb.amctest  amctest:CslistFirstChangedRemoveFirst  manual:N  comment:\"\"", atf_amc::amctest_CslistFirstChangedRemoveFirst }
+        ,{ "atfdb.amctest  amctest:CslistHeadFirstChangedInsert  manual:N  comment:\"\"", atf_amc::amctest_CslistHeadFirstChangedInsert }
+        ,{ "atfdb.amctest  amctest:CslistInsert1  manual:N  comment:\"\"", atf_amc::amctest_CslistInsert1 }
+        ,{ "atfdb.amctest  amctest:CslistInsert2  manual:N  comment:\"\"", atf_amc::amctest_CslistInsert2 }
+        ,{ "atfdb.amctest  amctest:CslistInsert3  manual:N  comment:\"\"", atf_amc::amctest_CslistInsert3 }
+        ,{ "atfdb.amctest  amctest:CslistInsertHead1  manual:N  comment:\"\"", atf_amc::amctest_CslistInsertHead1 }
+        ,{ "atfdb.amctest  amctest:CslistInsertHead2  manual:N  comment:\"\"", atf_amc::amctest_CslistInsertHead2 }
+        ,{ "atfdb.amctest  amctest:CslistInsertHead3  manual:N  comment:\"\"", atf_amc::amctest_CslistInsertHead3 }
+        ,{ "atfdb.amctest  amctest:CslistRemove  manual:N  comment:\"\"", atf_amc::amctest_CslistRemove }
+        ,{ "atfdb.amctest  amctest:CslistRemoveFirst  manual:N  comment:\"\"", atf_amc::amctest_CslistRemoveFirst }
+        ,{ "atfdb.amctest  amctest:CslistRotateFirst  manual:N  comment:\"\"", atf_amc::amctest_CslistRotateFirst }
+        ,{ "atfdb.amctest  amctest:Delptr  manual:N  comment:\"Test Delptr\"", atf_amc::amctest_Delptr }
+        ,{ "atfdb.amctest  amctest:DispRead1  manual:N  comment:\"Read a message containing varlen char field\"", atf_amc::amctest_DispRead1 }
+        ,{ "atfdb.amctest  amctest:DispRead2  manual:N  comment:\"Read a message containing several varlen fields\"", atf_amc::amctest_DispRead2 }
+        ,{ "atfdb.amctest  amctest:DispRead3  manual:N  comment:\"Time reading\"", atf_amc::amctest_DispRead3 }
+        ,{ "atfdb.amctest  amctest:DispRead4  manual:N  comment:\"Read Seqmsg with varlen payload\"", atf_amc::amctest_DispRead4 }
+        ,{ "atfdb.amctest  amctest:DispReadSsimfile  manual:N  comment:\"Use a Dispatch to read several tuples\"", atf_amc::amctest_DispReadSsimfile }
+        ,{ "atfdb.amctest  amctest:ExecSh  manual:N  comment:\"Execute subshell process\"", atf_amc::amctest_ExecSh }
+        ,{ "atfdb.amctest  amctest:Exec_Status  manual:N  comment:\"Check return status of waitpid()\"", atf_amc::amctest_Exec_Status }
+        ,{ "atfdb.amctest  amctest:Fcmp  manual:N  comment:\"Test string comparison functions as generated with fcmp\"", atf_amc::amctest_Fcmp }
+        ,{ "atfdb.amctest  amctest:Fconst  manual:N  comment:\"Test for fconst\"", atf_amc::amctest_Fconst }
+        ,{ "atfdb.amctest  amctest:Hook1  manual:N  comment:\"Test Hook functions\"", atf_amc::amctest_Hook1 }
+        ,{ "atfdb.amctest  amctest:Hook2  manual:N  comment:\"Test Hook functions\"", atf_amc::amctest_Hook2 }
+        ,{ "atfdb.amctest  amctest:ImdXref  manual:N  comment:\"\"", atf_amc::amctest_ImdXref }
+        ,{ "atfdb.amctest  amctest:Inlary_ReadPrint  manual:N  comment:\"Check Inlary read/print\"", atf_amc::amctest_Inlary_ReadPrint }
+        ,{ "atfdb.amctest  amctest:LaryColumn  manual:N  comment:\"Lary with column fields: row access, defaults, column cursor\"", atf_amc::amctest_LaryColumn }
+        ,{ "atfdb.amctest  amctest:LineIter  manual:N  comment:\"Iterate over lines\"", atf_amc::amctest_LineIter }
+        ,{ "atfdb.amctest  amctest:Lpool  manual:N  comment:\"\"", atf_amc::amctest_Lpool }
+        ,{ "atfdb.amctest  amctest:MagazineMT  manual:N  comment:\"Allocate and free from Tpool/Lpool magazines in several threads at once\"", atf_amc::amctest_MagazineMT }
+        ,{ "atfdb.amctest  amctest:Minmax  manual:N  comment:\"\"", atf_amc::amctest_Minmax }
+        ,{ "atfdb.amctest  amctest:MsgCurs  manual:N  comment:\"Check message cursor over memptr\"", atf_amc::amctest_MsgCurs }
+        ,{ "atfdb.amctest  amctest:MsgCurs2  manual:N  comment:\"\"", atf_amc::amctest_MsgCurs2 }
+        ,{ "atfdb.amctest  amctest:MsgCurs3  manual:N  comment:\"\"", atf_amc::amctest_MsgCurs3 }
+        ,{ "atfdb.amctest  amctest:MsgCurs4  manual:N  comment:\"\"", atf_amc::amctest_MsgCurs4 }
+        ,{ "atfdb.amctest  amctest:MsgLength  manual:N  comment:\"Check GetMsgLength, GetMsgMemptr functions\"", atf_amc::amctest_MsgLength }
+        ,{ "atfdb.amctest  amctest:Numstr  manual:N  comment:\"\"", atf_amc::amctest_Numstr }
+        ,{ "atfdb.amctest  amctest:NumstrCorruption  manual:N  comment:\"Check that corruption doesn't occur during numstr formatting.\"", atf_amc::amctest_NumstrCorruption }
+        ,{ "atfdb.amctest  amctest:OptAlloc  manual:N  comment:\"\"", atf_amc::amctest_OptAlloc }
+        ,{ "atfdb.amctest  amctest:OptG  manual:N  comment:,", atf_amc::amctest_OptG }
+        ,{ "atfdb.amctest  amctest:OptG2  manual:N  comment:\"Outer length too short\"", atf_amc::amctest_OptG2 }
+        ,{ "atfdb.amctest  amctest:OptG8  manual:N  comment:\"Construct OptG in memptr\"", atf_amc::amctest_OptG8 }
+        ,{ "atfdb.amctest  amctest:OptG9  manual:N  comment:\"Print struct with Opt member\"", atf_amc::amctest_OptG9 }
+        ,{ "atfdb.amctest  amctest:OptOptG3  manual:N  comment:\"Access valid opt varlen field successfully\"", atf_amc::amctest_OptOptG3 }
+        ,{ "atfdb.amctest  amctest:OptOptG4  manual:N  comment:\"??\"", atf_amc::amctest_OptOptG4 }
+        ,{ "atfdb.amctest  amctest:OptOptG5  manual:N  comment:\"Inner length too short\"", atf_amc::amctest_OptOptG5 }
+        ,{ "atfdb.amctest  amctest:OptOptG6  manual:N  comment:\"Inner length extends past outer length\"", atf_amc::amctest_OptOptG6 }
+        ,{ "atfdb.amctest  amctest:OptOptG7  manual:N  comment:\"Fetch two optional elements\"", atf_amc::amctest_OptOptG7 }
+        ,{ "atfdb.amctest  amctest:OptOptG8  manual:N  comment:\"Construct OptOptG in memptr\"", atf_amc::amctest_OptOptG8 }
+        ,{ "atfdb.amctest  amctest:OptOptG9  manual:N  comment:\"Print struct with Opt member\"", atf_amc::amctest_OptOptG9 }
+        ,{ "atfdb.amctest  amctest:PerfBheapDary  manual:Y  comment:\"Compare binary, 4-ary inline-key and 8-ary Bheaps at 1M elements\"", atf_amc::amctest_PerfBheapDary }
+        ,{ "atfdb.amctest  amctest:PerfBtree  manual:Y  comment:\"Compare Btree and Atree at 1M and 10M elements\"", atf_amc::amctest_PerfBtree }
+        ,{ "atfdb.amctest  amctest:PerfHugepage  manual:Y  comment:\"Compare Thash lookups into rows backed by regular and transparent huge pages\"", atf_amc::amctest_PerfHugepage }
+        ,{ "atfdb.amctest  amctest:PerfLaryColumn  manual:Y  comment:\"Compare scan of a column field through the rows with a column cursor scan\"", atf_amc::amctest_PerfLaryColumn }
+        ,{ "atfdb.amctest  amctest:PerfSortString  manual:N  comment:\"\"", atf_amc::amctest_PerfSortString }
+        ,{ "atfdb.amctest  amctest:PerfThash  manual:Y  comment:\"Compare Find speed of chained, cachehash and openaddr hash indexes\"", atf_amc::amctest_PerfThash }
+        ,{ "atfdb.amctest  amctest:PerfThashIncremental  manual:Y  comment:\"Compare worst-case insert latency of full and incremental rehash\"", atf_amc::amctest_PerfThashIncremental }
+        ,{ "atfdb.amctest  amctest:PrintBase36  manual:N  comment:\"\"", atf_amc::amctest_PrintBase36 }
+        ,{ "atfdb.amctest  amctest:PrintRawGconst  manual:N  comment:\"Check that gconst field within tuple is printed as raw\"", atf_amc::amctest_PrintRawGconst }
+        ,{ "atfdb.amctest  amctest:PtraryInsert  manual:N  comment:\"Insert/Remove invariants for Ptrary\"", atf_amc::amctest_PtraryInsert }
+        ,{ "atfdb.amctest  amctest:ReadProc  manual:N  comment:\"Read from subprocess\"", atf_amc::amctest_ReadProc }
+        ,{ "atfdb.amctest  amctest:ReadTuple1  manual:N  comment:\"A single field is printed without field name\"", atf_amc::amctest_ReadTuple1 }
+        ,{ "atfdb.amctest  amctest:ReadTuple2  manual:N  comment:\"Two fields are printed as name-value pairs.\"", atf_amc::amctest_ReadTuple2 }
+        ,{ "atfdb.amctest  amctest:ReadTuple3  manual:N  comment:Attr_curs", atf_amc::amctest_ReadTuple3 }
+        ,{ "atfdb.amctest  amctest:ReadTuple4  manual:N  comment:\"Attr_curs -- empty string\"", atf_amc::amctest_ReadTuple4 }
+        ,{ "atfdb.amctest  amctest:ReadTuple5  manual:N  comment:\"Attr_curs -- quoted strings\"", atf_amc::amctest_ReadTuple5 }
+        ,{ "atfdb.amctest  amctest:Scratch  manual:N  comment:\"Scratch area for new test development\"", atf_amc::amctest_Scratch }
+        ,{ "atfdb.amctest  amctest:SetGetnumBase10  manual:N  comment:\"\"", atf_amc::amctest_SetGetnumBase10 }
+        ,{ "atfdb.amctest  amctest:SubstrDfltval  manual:N  comment:\"\"", atf_amc::amctest_SubstrDfltval }
+        ,{ "atfdb.amctest  amctest:TaryInit  manual:N  comment:\"u32: Add element to Tary, check that it's initialized\"", atf_amc::amctest_TaryInit }
+        ,{ "atfdb.amctest  amctest:TaryInit2  manual:N  comment:\"u32: Add N elements to Tary, check that they're initialized\"", atf_amc::amctest_TaryInit2 }
+        ,{ "atfdb.amctest  amctest:TaryInit3  manual:N  comment:\"u8: Add element to Tary, check that it's initialized\"", atf_amc::amctest_TaryInit3 }
+        ,{ "atfdb.amctest  amctest:TaryInit4  manual:N  comment:\"u8: Add N elements to Tary, check that they're initialized\"", atf_amc::amctest_TaryInit4 }
+        ,{ "atfdb.amctest  amctest:TaryReserve  manual:N  comment:\"\"", atf_amc::amctest_TaryReserve }
+        ,{ "atfdb.amctest  amctest:TestBitfld  manual:N  comment:\"U16 bitfields: Set values, check that they were set\"", atf_amc::amctest_TestBitfld }
+        ,{ "atfdb.amctest  amctest:TestBitfld2  manual:N  comment:\"U128 bitfields: Set values, check that they were set\"", atf_amc::amctest_TestBitfld2 }
+        ,{ "atfdb.amctest  amctest:TestCstring1  manual:N  comment:\"Basic test\"", atf_amc::amctest_TestCstring1 }
+        ,{ "atfdb.amctest  amctest:TestCstring2  manual:N  comment:\"Insert cstring.\"", atf_amc::amctest_TestCstring2 }
+        ,{ "atfdb.amctest  amctest:TestDispFilter  manual:N  comment:\"DispFilter Basic Match\"", atf_amc::amctest_TestDispFilter }
+        ,{ "atfdb.amctest  amctest:TestDispFilter2  manual:N  comment:\"DispFilter Regx\"", atf_amc::amctest_TestDispFilter2 }
+        ,{ "atfdb.amctest  amctest:TestDispFilter3  manual:N  comment:\"DispFilter Explicit int field\"", atf_amc::amctest_TestDispFilter3 }
+        ,{ "atfdb.amctest  amctest:TestDispFilter4  manual:N  comment:\"DispFilter Date\"", atf_amc::amctest_TestDispFilter4 }
+        ,{ "atfdb.amctest  amctest:TestInsertX2  manual:N  comment:\"Insert instance of TypeT, xrefing with type A\"", atf_amc::amctest_TestInsertX2 }
+        ,{ "atfdb.amctest  amctest:TestInsertX3  manual:N  comment:\"Insert instance of TypeT, invalid xref with type A. Expect rollback\"", atf_amc::amctest_TestInsertX3 }
+        ,{ "atfdb.amctest  amctest:TestPmask1  manual:N  comment:\"Default ctor, check that pmask field is !PresentQ\"", atf_amc::amctest_TestPmask1 }
+        ,{ "atfdb.amctest  amctest:TestPmask2  manual:N  comment:\"Set field, check that field is PresentQ\"", atf_amc::amctest_TestPmask2 }
+        ,{ "atfdb.amctest  amctest:TestPmask3  manual:N  comment:\"Read ctype from string that doesn't have pmask field. It must be !PresentQ\"", atf_amc::amctest_TestPmask3 }
+        ,{ "atfdb.amctest  amctest:TestPmask4  manual:N  comment:\"Read ctype from string that has a pmask field. It must be PresentQ\"", atf_amc::amctest_TestPmask4 }
+        ,{ "atfdb.amctest  amctest:TestPmask5  manual:N  comment:\"Check explicitly that pmask is being updated by Set\"", atf_amc::amctest_TestPmask5 }
+        ,{ "atfdb.amctest  amctest:TestPmask6  manual:N  comment:\"Check that pmask isn't read from string\"", atf_amc::amctest_TestPmask6 }
+        ,{ "atfdb.amctest  amctest:TestPmask7  manual:N  comment:\"Check that 128-bit pmask works.\"", atf_amc::amctest_TestPmask7 }
+        ,{ "atfdb.amctest  amctest:TestPmask8  manual:N  comment:\"Check pmask-555.\"", atf_amc::amctest_TestPmask8 }
+        ,{ "atfdb.amctest  amctest:TestRegx1  manual:N  comment:\"\"", atf_amc::amctest_TestRegx1 }
+        ,{ "atfdb.amctest  amctest:TestSep1  manual:N  comment:\"Print Test\"", atf_amc::amctest_TestSep1 }
+        ,{ "atfdb.amctest  amctest:TestSep2  manual:N  comment:\"Read Test\"", atf_amc::amctest_TestSep2 }
+        ,{ "atfdb.amctest  amctest:TestString  manual:N  comment:\"\"", atf_amc::amctest_TestString }
+        ,{ "atfdb.amctest  amctest:ThashCachehash  manual:N  comment:\"Insert/find/remove through cachehash:Y index, compare with chained index\"", atf_amc::amctest_ThashCachehash }
+        ,{ "atfdb.amctest  amctest:ThashIncremental  manual:N  comment:\"Insert/find/remove/cursor through incremental:Y index while a rehash is in progress\"", atf_amc::amctest_ThashIncremental }
+        ,{ "atfdb.amctest  amctest:ThashOpenaddr  manual:N  comment:\"Randomized insert/find/remove/cursor through openaddr:Y index, compare with chained index\"", atf_amc::amctest_ThashOpenaddr }
+        ,{ "atfdb.amctest  amctest:Typetag  manual:N  comment:\"\"", atf_amc::amctest_Typetag }
+        ,{ "atfdb.amctest  amctest:VarlenAlloc  manual:N  comment:\"\"", atf_amc::amctest_VarlenAlloc }
+        ,{ "atfdb.amctest  amctest:VarlenExternLength  manual:N  comment:\"\"", atf_amc::amctest_VarlenExternLength }
+        ,{ "atfdb.amctest  amctest:ZdlistDfltCtor  manual:N  comment:\"\"", atf_amc::amctest_ZdlistDfltCtor }
+        ,{ "atfdb.amctest  amctest:ZdlistFlush100  manual:N  comment:\"\"", atf_amc::amctest_ZdlistFlush100 }
+        ,{ "atfdb.amctest  amctest:ZdlistFlushEmpty  manual:N  comment:\"\"", atf_amc::amctest_ZdlistFlushEmpty }
+        ,{ "atfdb.amctest  amctest:ZdlistInsert1  manual:N  comment:\"\"", atf_amc::amctest_ZdlistInsert1 }
+        ,{ "atfdb.amctest  amctest:ZdlistInsert2  manual:N  comment:\"\"", atf_amc::amctest_ZdlistInsert2 }
+        ,{ "atfdb.amctest  amctest:ZdlistInsert3  manual:N  comment:\"\"", atf_amc::amctest_ZdlistInsert3 }
+        ,{ "atfdb.amctest  amctest:ZdlistInsertHead1  manual:N  comment:\"\"", atf_amc::amctest_ZdlistInsertHead1 }
+        ,{ "atfdb.amctest  amctest:ZdlistInsertHead2  manual:N  comment:\"\"", atf_amc::amctest_ZdlistInsertHead2 }
+        ,{ "atfdb.amctest  amctest:ZdlistInsertHead3  manual:N  comment:\"\"", atf_amc::amctest_ZdlistInsertHead3 }
+        ,{ "atfdb.amctest  amctest:ZdlistInsertHeadNoTail1  manual:N  comment:\"\"", atf_amc::amctest_ZdlistInsertHeadNoTail1 }
+        ,{ "atfdb.amctest  amctest:ZdlistInsertHeadNoTail2  manual:N  comment:\"\"", atf_amc::amctest_ZdlistInsertHeadNoTail2 }
+        ,{ "atfdb.amctest  amctest:ZdlistInsertHeadNoTail3  manual:N  comment:\"\"", atf_amc::amctest_ZdlistInsertHeadNoTail3 }
+        ,{ "atfdb.amctest  amctest:ZdlistInsertMaybe  manual:N  comment:\"\"", atf_amc::amctest_ZdlistInsertMaybe }
+        ,{ "atfdb.amctest  amctest:ZdlistItemDfltCtor  manual:N  comment:\"\"", atf_amc::amctest_ZdlistItemDfltCtor }
+        ,{ "atfdb.amctest  amctest:ZdlistRemove  manual:N  comment:\"\"", atf_amc::amctest_ZdlistRemove }
+        ,{ "atfdb.amctest  amctest:ZdlistRemoveFirst  manual:N  comment:\"\"", atf_amc::amctest_ZdlistRemoveFirst }
+        ,{ "atfdb.amctest  amctest:ZslistFirstChangedFlush  manual:N  comment:\"\"", atf_amc::amctest_ZslistFirstChangedFlush }
+        ,{ "atfdb.amctest  amctest:ZslistFirstChangedInsert  manual:N  comment:\"\"", atf_amc::amctest_ZslistFirstChangedInsert }
+        ,{ "atfdb.amctest  amctest:ZslistFirstChangedRemove  manual:N  comment:\"\"", atf_amc::amctest_ZslistFirstChangedRemove }
+        ,{ "atfdb.amctest  amctest:ZslistFirstChangedRemoveFirst  manual:N  comment:\"\"", atf_amc::amctest_ZslistFirstChangedRemoveFirst }
+        ,{ "atfdb.amctest  amctest:ZslistHeadFirstChangedInsert  manual:N  comment:\"\"", atf_amc::amctest_ZslistHeadFirstChangedInsert }
+        ,{ "atfdb.amctest  amctest:ZslistInsert1  manual:N  comment:\"\"", atf_amc::amctest_ZslistInsert1 }
+        ,{ "atfdb.amctest  amctest:ZslistInsert2  manual:N  comment:\"\"", atf_amc::amctest_ZslistInsert2 }
+        ,{ "atfdb.amctest  amctest:ZslistInsert3  manual:N  comment:\"\"", atf_amc::amctest_ZslistInsert3 }
+        ,{ "atfdb.amctest  amctest:ZslistInsertHead1  manual:N  comment:\"\"", atf_amc::amctest_ZslistInsertHead1 }
+        ,{ "atfdb.amctest  amctest:ZslistInsertHead2  manual:N  comment:\"\"", atf_amc::amctest_ZslistInsertHead2 }
+        ,{ "atfdb.amctest  amctest:ZslistInsertHead3  manual:N  comment:\"\"", atf_amc::amctest_ZslistInsertHead3 }
+        ,{ "atfdb.amctest  amctest:ZslistRemove  manual:N  comment:\"\"", atf_amc::amctest_ZslistRemove }
+        ,{ "atfdb.amctest  amctest:ZslistRemoveFirst  manual:N  comment:\"\"", atf_amc::amctest_ZslistRemoveFirst }
+        ,{ "atfdb.amctest  amctest:Zslistmt1  manual:N  comment:\"\"", atf_amc::amctest_Zslistmt1 }
+        ,{ "atfdb.amctest  amctest:Zslistmt2  manual:N  comment:\"\"", atf_amc::amctest_Zslistmt2 }
+        ,{ "atfdb.amctest  amctest:Zslistmt3  manual:N  comment:\"\"", atf_amc::amctest_Zslistmt3 }
+        ,{ "atfdb.amctest  amctest:ZslistmtDfltCtor  manual:N  comment:\"\"", atf_amc::amctest_ZslistmtDfltCtor }
+        ,{ "atfdb.amctest  amctest:ZslistmtItemDfltCtor  manual:N  comment:\"\"", atf_amc::amctest_ZslistmtItemDfltCtor }
+        ,{ "atfdb.amctest  amctest:atree_RangeSearch  manual:N  comment:\"Range searching on atree\"", atf_amc::amctest_atree_RangeSearch }
+        ,{ "atfdb.amctest  amctest:atree_test1  manual:N  comment:\"Play with the tree, constantly verify invariants\"", atf_amc::amctest_atree_test1 }
+        ,{ "atfdb.amctest  amctest:atree_test2  manual:N  comment:\"Test FirstGe and LastLt\"", atf_amc::amctest_atree_test2 }
+        ,{ "atfdb.amctest  amctest:bytebuf_test1  manual:N  comment:\"Initial state -- no data\"", atf_amc::amctest_bytebuf_test1 }
+        ,{ "atfdb.amctest  amctest:bytebuf_test2  manual:N  comment:\"Write some bytes, read back\"", atf_amc::amctest_bytebuf_test2 }
+        ,{ "atfdb.amctest  amctest:fstep_Inline  manual:N  comment:\"Check step type\"", atf_amc::amctest_fstep_Inline }
+        ,{ "atfdb.amctest  amctest:fstep_InlineOnce  manual:N  comment:\"Check step type\"", atf_amc::amctest_fstep_InlineOnce }
+        ,{ "atfdb.amctest  amctest:fstep_InlineRecur  manual:N  comment:\"Check step type\"", atf_amc::amctest_fstep_InlineRecur }
+        ,{ "atfdb.amctest  amctest:fstep_TimeHookRecur  manual:N  comment:\"Check step type\"", atf_amc::amctest_fstep_TimeHookRecur }
+        ,{ "atfdb.amctest  amctest:linebuf_test1  manual:N  comment:\"Initial state -- no line\"", atf_amc::amctest_linebuf_test1 }
+        ,{ "atfdb.amctest  amctest:linebuf_test2  manual:N  comment:\"write a line, read line back\"", atf_amc::amctest_linebuf_test2 }
+        ,{ "atfdb.amctest  amctest:linebuf_test3  manual:N  comment:\"write a line in two phases, no message in between\"", atf_amc::amctest_linebuf_test3 }
+        ,{ "atfdb.amctest  amctest:linebuf_test4  manual:N  comment:\"Write an empty line, read line back\"", atf_amc::amctest_linebuf_test4 }
+        ,{ "atfdb.amctest  amctest:linebuf_test5  manual:N  comment:\"Line too large -- will never fit. Set EOF\"", atf_amc::amctest_linebuf_test5 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test0  manual:N  comment:\"initial state - no message\"", atf_amc::amctest_msgbuf_test0 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test1  manual:N  comment:\"write message, read message back\"", atf_amc::amctest_msgbuf_test1 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test10  manual:N  comment:\"Force 10,000 messages of various sizes through a pipe\"", atf_amc::amctest_msgbuf_test10 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test1_1  manual:N  comment:\"write partial message, read should fail\"", atf_amc::amctest_msgbuf_test1_1 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test1_2  manual:N  comment:\"write message, call RemoveAll, read should fail\"", atf_amc::amctest_msgbuf_test1_2 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test2  manual:N  comment:\"good message, then not enough data.\"", atf_amc::amctest_msgbuf_test2 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test3  manual:N  comment:\"good message, then not enough data\"", atf_amc::amctest_msgbuf_test3 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test4  manual:N  comment:\"message, read partial message, supply new data, read message\"", atf_amc::amctest_msgbuf_test4 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test5  manual:N  comment:\"If GetMsg returns NULL, buffer is removed from read list\"", atf_amc::amctest_msgbuf_test5 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test6  manual:N  comment:\"Write runt message to buffer, check that eof and error flags are set\"", atf_amc::amctest_msgbuf_test6 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test7  manual:N  comment:\"Write HUGE message to buffer, check that error flag is set\"", atf_amc::amctest_msgbuf_test7 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test8  manual:N  comment:\"Write message to pipe, read it\"", atf_amc::amctest_msgbuf_test8 }
+        ,{ "atfdb.amctest  amctest:msgbuf_test9  manual:N  comment:\"Write 2 messages to temp buffer. Feed them 1 by one through buffer\"", atf_amc::amctest_msgbuf_test9 }
         ,{NULL, NULL}
     };
     (void)data;
@@ -5092,6 +5624,10 @@ bool atf_amc::cascdel_XrefMaybe(atf_amc::FCascdel &row) {
     if (row.p_parent != &row && row.type==atf_amc_FCascdel_type_atree) { // user-defined insert condition
         tr_child_atree_Insert(*p_p_parent, row);
     }
+    // insert cascdel into index bt_child_btree
+    if (row.p_parent != &row && row.type==atf_amc_FCascdel_type_btree) { // user-defined insert condition
+        bt_child_btree_Insert(*p_p_parent, row);
+    }
     return retval;
 }
 
@@ -6014,112 +6550,2981 @@ bool atf_amc::listtype_XrefMaybe(atf_amc::FListtype &row) {
     return retval;
 }
 
-// --- atf_amc.FDb.trace.RowidFind
-// find trace by row id (used to implement reflection)
-static algo::ImrowPtr atf_amc::trace_RowidFind(int t) {
-    return algo::ImrowPtr(t==0 ? u64(&_db.trace) : u64(0));
-}
-
-// --- atf_amc.FDb.trace.N
-// Function return 1
-inline static i32 atf_amc::trace_N() {
-    return 1;
+// --- atf_amc.FDb.hashrow.Alloc
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FHashrow& atf_amc::hashrow_Alloc() {
+    atf_amc::FHashrow* row = hashrow_AllocMaybe();
+    if (UNLIKELY(row == NULL)) {
+        FatalErrorExit("atf_amc.out_of_mem  field:atf_amc.FDb.hashrow  comment:'Alloc failed'");
+    }
+    return *row;
 }
 
-// --- atf_amc.FDb.bh_typec_curs.Add
-static void atf_amc::_db_bh_typec_curs_Add(_db_bh_typec_curs &curs, atf_amc::FTypeC& row) {
-    u32 n = curs.temp_n;
-    int i = n;
-    curs.temp_n = n+1;
-    atf_amc::FTypeC* *elems = curs.temp_elems;
-    while (i>0) {
-        int j = (i-1)/2;
-        atf_amc::FTypeC* p = elems[j];
-        if (!bh_typec_ElemLt(row,*p)) {
-            break;
-        }
-        elems[i]=p;
-        i=j;
+// --- atf_amc.FDb.hashrow.AllocMaybe
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FHashrow* atf_amc::hashrow_AllocMaybe() {
+    atf_amc::FHashrow *row = (atf_amc::FHashrow*)hashrow_AllocMem();
+    if (row) {
+        new (row) atf_amc::FHashrow; // call constructor
     }
-    elems[i]=&row;
+    return row;
 }
 
-// --- atf_amc.FDb.bh_typec_curs.Reserve
-void atf_amc::_db_bh_typec_curs_Reserve(_db_bh_typec_curs &curs, int n) {
-    if (n > curs.temp_max) {
-        size_t old_size   = sizeof(void*) * curs.temp_max;
-        size_t new_size   = sizeof(void*) * bh_typec_N();
-        curs.temp_elems   = (atf_amc::FTypeC**)algo_lib::malloc_ReallocMem(curs.temp_elems, old_size, new_size);
-        if (!curs.temp_elems) {
-            algo::FatalErrorExit("atf_amc.cursor_out_of_memory  func:atf_amc.FDb.bh_typec_curs.Reserve");
+// --- atf_amc.FDb.hashrow.AllocMem
+// Allocate space for one element. If no memory available, return NULL.
+void* atf_amc::hashrow_AllocMem() {
+    u64 new_nelems     = _db.hashrow_n+1;
+    // compute level and index on level
+    u64 bsr   = algo::u64_BitScanReverse(new_nelems);
+    u64 base  = u64(1)<<bsr;
+    u64 index = new_nelems-base;
+    void *ret = NULL;
+    // if level doesn't exist yet, create it
+    atf_amc::FHashrow*  lev   = NULL;
+    if (bsr < 32) {
+        lev = _db.hashrow_lary[bsr];
+        if (!lev) {
+            lev=(atf_amc::FHashrow*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FHashrow) * (u64(1)<<bsr));
+            _db.hashrow_lary[bsr] = lev;
         }
-        curs.temp_max       = bh_typec_N();
     }
+    // allocate element from this level
+    if (lev) {
+        _db.hashrow_n = new_nelems;
+        ret = lev + index;
+    }
+    return ret;
 }
 
-// --- atf_amc.FDb.bh_typec_curs.Reset
-// Reset cursor. If HEAP is non-empty, add its top element to CURS.
-void atf_amc::_db_bh_typec_curs_Reset(_db_bh_typec_curs &curs, atf_amc::FDb &parent) {
-    curs.parent       = &parent;
-    _db_bh_typec_curs_Reserve(curs, bh_typec_N());
-    curs.temp_n = 0;
-    if (parent.bh_typec_n > 0) {
-        atf_amc::FTypeC &first = *parent.bh_typec_elems[0];
-        curs.temp_elems[0] = &first; // insert first element in heap
-        curs.temp_n = 1;
+// --- atf_amc.FDb.hashrow.RemoveAll
+// Remove all elements from Lary
+void atf_amc::hashrow_RemoveAll() {
+    for (u64 n = _db.hashrow_n; n>0; ) {
+        n--;
+        hashrow_qFind(u64(n)).~FHashrow(); // destroy last element
+        _db.hashrow_n = n;
     }
 }
 
-// --- atf_amc.FDb.bh_typec_curs.Next
-// Advance cursor.
-void atf_amc::_db_bh_typec_curs_Next(_db_bh_typec_curs &curs) {
-    atf_amc::FTypeC* *elems = curs.temp_elems;
-    int n = curs.temp_n;
+// --- atf_amc.FDb.hashrow.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_amc::hashrow_RemoveLast() {
+    u64 n = _db.hashrow_n;
     if (n > 0) {
-        // remove top element from heap
-        atf_amc::FTypeC* dead = elems[0];
-        int i       = 0;
-        atf_amc::FTypeC* last = curs.temp_elems[n-1];
-        // downheap last elem
-        do {
-            atf_amc::FTypeC* choose = last;
-            int l         = i*2+1;
-            if (l<n) {
-                atf_amc::FTypeC* el = elems[l];
-                int r     = l+1;
-                r        -= r==n;
-                atf_amc::FTypeC* er = elems[r];
-                if (bh_typec_ElemLt(*er,*el)) {
-                    el  = er;
-                    l   = r;
-                }
-                bool b = bh_typec_ElemLt(*el,*last);
-                if (b) choose = el;
-                if (!b) l = n;
-            }
-            elems[i] = choose;
-            i = l;
-        } while (i < n);
-        curs.temp_n = n-1;
-        int index = dead->bh_typec_idx;
-        i = (index*2+1);
-        if (i < bh_typec_N()) {
-            atf_amc::FTypeC &elem = *curs.parent->bh_typec_elems[i];
-            _db_bh_typec_curs_Add(curs, elem);
-        }
-        if (i+1 < bh_typec_N()) {
-            atf_amc::FTypeC &elem = *curs.parent->bh_typec_elems[i + 1];
-            _db_bh_typec_curs_Add(curs, elem);
-        }
+        n -= 1;
+        hashrow_qFind(u64(n)).~FHashrow();
+        _db.hashrow_n = n;
     }
 }
 
-// --- atf_amc.FDb..Init
-// Set all fields to initial values.
-void atf_amc::FDb_Init() {
-    _db.bh_typec_max   	= 0; // (atf_amc.FDb.bh_typec)
-    _db.bh_typec_n     	= 0; // (atf_amc.FDb.bh_typec)
-    _db.bh_typec_elems 	= NULL; // (atf_amc.FDb.bh_typec)
+// --- atf_amc.FDb.hashrow.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool atf_amc::hashrow_XrefMaybe(atf_amc::FHashrow &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- atf_amc.FDb.ind_hashrow.Find
+// Find row by key. Return NULL if not found.
+atf_amc::FHashrow* atf_amc::ind_hashrow_Find(const algo::strptr& key) {
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_hashrow_buckets_n - 1);
+    atf_amc::FHashrow* *e = &_db.ind_hashrow_buckets_elems[index];
+    atf_amc::FHashrow* ret=NULL;
+    do {
+        ret       = *e;
+        bool done = !ret || (*ret).key == key;
+        if (done) break;
+        e         = &ret->ind_hashrow_next;
+    } while (true);
+    return ret;
+}
+
+// --- atf_amc.FDb.ind_hashrow.GetOrCreate
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHashrow& atf_amc::ind_hashrow_GetOrCreate(const algo::strptr& key) {
+    atf_amc::FHashrow* ret = ind_hashrow_Find(key);
+    if (!ret) { //  if memory alloc fails, process dies; if insert fails, function returns NULL.
+        ret         = &hashrow_Alloc();
+        (*ret).key = key;
+        bool good = hashrow_XrefMaybe(*ret);
+        if (!good) {
+            hashrow_RemoveLast(); // delete offending row, any existing xrefs are cleared
+            ret = NULL;
+        }
+    }
+    return *ret;
+}
+
+// --- atf_amc.FDb.ind_hashrow.InsertMaybe
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool atf_amc::ind_hashrow_InsertMaybe(atf_amc::FHashrow& row) {
+    ind_hashrow_Reserve(1);
+    bool retval = true; // if already in hash, InsertMaybe returns true
+    if (LIKELY(row.ind_hashrow_next == (atf_amc::FHashrow*)-1)) {// check if in hash already
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (_db.ind_hashrow_buckets_n - 1);
+        atf_amc::FHashrow* *prev = &_db.ind_hashrow_buckets_elems[index];
+        do {
+            atf_amc::FHashrow* ret = *prev;
+            if (!ret) { // exit condition 1: reached the end of the list
+                break;
+            }
+            if ((*ret).key == row.key) { // exit condition 2: found matching key
+                retval = false;
+                break;
+            }
+            prev = &ret->ind_hashrow_next;
+        } while (true);
+        if (retval) {
+            row.ind_hashrow_next = *prev;
+            _db.ind_hashrow_n++;
+            *prev = &row;
+        }
+    }
+    return retval;
+}
+
+// --- atf_amc.FDb.ind_hashrow.Remove
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void atf_amc::ind_hashrow_Remove(atf_amc::FHashrow& row) {
+    if (LIKELY(row.ind_hashrow_next != (atf_amc::FHashrow*)-1)) {// check if in hash already
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (_db.ind_hashrow_buckets_n - 1);
+        atf_amc::FHashrow* *prev = &_db.ind_hashrow_buckets_elems[index]; // addr of pointer to current element
+        while (atf_amc::FHashrow *next = *prev) {                          // scan the collision chain for our element
+            if (next == &row) {        // found it?
+                *prev = next->ind_hashrow_next; // unlink (singly linked list)
+                _db.ind_hashrow_n--;
+                row.ind_hashrow_next = (atf_amc::FHashrow*)-1;// not-in-hash
+                break;
+            }
+            prev = &next->ind_hashrow_next;
+        }
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow.Reserve
+// Reserve enough room in the hash for N more elements. Return success code.
+void atf_amc::ind_hashrow_Reserve(int n) {
+    u32 old_nbuckets = _db.ind_hashrow_buckets_n;
+    u32 new_nelems   = _db.ind_hashrow_n + n;
+    // # of elements has to be roughly equal to the number of buckets
+    if (new_nelems > old_nbuckets) {
+        int new_nbuckets = i32_Max(BumpToPow2(new_nelems), u32(4));
+        u32 old_size = old_nbuckets * sizeof(atf_amc::FHashrow*);
+        u32 new_size = new_nbuckets * sizeof(atf_amc::FHashrow*);
+        // allocate new array. we don't use Realloc since copying is not needed and factor of 2 probably
+        // means new memory will have to be allocated anyway
+        atf_amc::FHashrow* *new_buckets = (atf_amc::FHashrow**)algo_lib::malloc_AllocMem(new_size);
+        if (UNLIKELY(!new_buckets)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FDb.ind_hashrow");
+        }
+        memset(new_buckets, 0, new_size); // clear pointers
+        // rehash all entries
+        for (int i = 0; i < _db.ind_hashrow_buckets_n; i++) {
+            atf_amc::FHashrow* elem = _db.ind_hashrow_buckets_elems[i];
+            while (elem) {
+                atf_amc::FHashrow &row        = *elem;
+                atf_amc::FHashrow* next       = row.ind_hashrow_next;
+                u32 index          = cstring_Hash(0, row.key) & (new_nbuckets-1);
+                row.ind_hashrow_next     = new_buckets[index];
+                new_buckets[index] = &row;
+                elem               = next;
+            }
+        }
+        // free old array
+        algo_lib::malloc_FreeMem(_db.ind_hashrow_buckets_elems, old_size);
+        _db.ind_hashrow_buckets_elems = new_buckets;
+        _db.ind_hashrow_buckets_n = new_nbuckets;
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_cached.Find
+// Find row by key. Return NULL if not found.
+atf_amc::FHashrow* atf_amc::ind_hashrow_cached_Find(const algo::strptr& key) {
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_hashrow_cached_buckets_n - 1);
+    atf_amc::FHashrow* *e = &_db.ind_hashrow_cached_buckets_elems[index];
+    atf_amc::FHashrow* ret=NULL;
+    do {
+        ret       = *e;
+        bool done = !ret || (ret->ind_hashrow_cached_hashval == hash && (*ret).key == key);
+        if (done) break;
+        e         = &ret->ind_hashrow_cached_next;
+    } while (true);
+    return ret;
+}
+
+// --- atf_amc.FDb.ind_hashrow_cached.GetOrCreate
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHashrow& atf_amc::ind_hashrow_cached_GetOrCreate(const algo::strptr& key) {
+    atf_amc::FHashrow* ret = ind_hashrow_cached_Find(key);
+    if (!ret) { //  if memory alloc fails, process dies; if insert fails, function returns NULL.
+        ret         = &hashrow_Alloc();
+        (*ret).key = key;
+        bool good = hashrow_XrefMaybe(*ret);
+        if (!good) {
+            hashrow_RemoveLast(); // delete offending row, any existing xrefs are cleared
+            ret = NULL;
+        }
+    }
+    return *ret;
+}
+
+// --- atf_amc.FDb.ind_hashrow_cached.InsertMaybe
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool atf_amc::ind_hashrow_cached_InsertMaybe(atf_amc::FHashrow& row) {
+    ind_hashrow_cached_Reserve(1);
+    bool retval = true; // if already in hash, InsertMaybe returns true
+    if (LIKELY(row.ind_hashrow_cached_next == (atf_amc::FHashrow*)-1)) {// check if in hash already
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (_db.ind_hashrow_cached_buckets_n - 1);
+        atf_amc::FHashrow* *prev = &_db.ind_hashrow_cached_buckets_elems[index];
+        do {
+            atf_amc::FHashrow* ret = *prev;
+            if (!ret) { // exit condition 1: reached the end of the list
+                break;
+            }
+            if (ret->ind_hashrow_cached_hashval == hash && (*ret).key == row.key) { // exit condition 2: found matching key
+                retval = false;
+                break;
+            }
+            prev = &ret->ind_hashrow_cached_next;
+        } while (true);
+        if (retval) {
+            row.ind_hashrow_cached_next = *prev;
+            row.ind_hashrow_cached_hashval = hash;
+            _db.ind_hashrow_cached_n++;
+            *prev = &row;
+        }
+    }
+    return retval;
+}
+
+// --- atf_amc.FDb.ind_hashrow_cached.Remove
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void atf_amc::ind_hashrow_cached_Remove(atf_amc::FHashrow& row) {
+    if (LIKELY(row.ind_hashrow_cached_next != (atf_amc::FHashrow*)-1)) {// check if in hash already
+        u32 hash  = row.ind_hashrow_cached_hashval;
+        u32 index = hash & (_db.ind_hashrow_cached_buckets_n - 1);
+        atf_amc::FHashrow* *prev = &_db.ind_hashrow_cached_buckets_elems[index]; // addr of pointer to current element
+        while (atf_amc::FHashrow *next = *prev) {                          // scan the collision chain for our element
+            if (next == &row) {        // found it?
+                *prev = next->ind_hashrow_cached_next; // unlink (singly linked list)
+                _db.ind_hashrow_cached_n--;
+                row.ind_hashrow_cached_next = (atf_amc::FHashrow*)-1;// not-in-hash
+                break;
+            }
+            prev = &next->ind_hashrow_cached_next;
+        }
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_cached.Reserve
+// Reserve enough room in the hash for N more elements. Return success code.
+void atf_amc::ind_hashrow_cached_Reserve(int n) {
+    u32 old_nbuckets = _db.ind_hashrow_cached_buckets_n;
+    u32 new_nelems   = _db.ind_hashrow_cached_n + n;
+    // # of elements has to be roughly equal to the number of buckets
+    if (new_nelems > old_nbuckets) {
+        int new_nbuckets = i32_Max(BumpToPow2(new_nelems), u32(4));
+        u32 old_size = old_nbuckets * sizeof(atf_amc::FHashrow*);
+        u32 new_size = new_nbuckets * sizeof(atf_amc::FHashrow*);
+        // allocate new array. we don't use Realloc since copying is not needed and factor of 2 probably
+        // means new memory will have to be allocated anyway
+        atf_amc::FHashrow* *new_buckets = (atf_amc::FHashrow**)algo_lib::malloc_AllocMem(new_size);
+        if (UNLIKELY(!new_buckets)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FDb.ind_hashrow_cached");
+        }
+        memset(new_buckets, 0, new_size); // clear pointers
+        // rehash all entries
+        for (int i = 0; i < _db.ind_hashrow_cached_buckets_n; i++) {
+            atf_amc::FHashrow* elem = _db.ind_hashrow_cached_buckets_elems[i];
+            while (elem) {
+                atf_amc::FHashrow &row        = *elem;
+                atf_amc::FHashrow* next       = row.ind_hashrow_cached_next;
+                u32 index          = row.ind_hashrow_cached_hashval & (new_nbuckets-1);
+                row.ind_hashrow_cached_next     = new_buckets[index];
+                new_buckets[index] = &row;
+                elem               = next;
+            }
+        }
+        // free old array
+        algo_lib::malloc_FreeMem(_db.ind_hashrow_cached_buckets_elems, old_size);
+        _db.ind_hashrow_cached_buckets_elems = new_buckets;
+        _db.ind_hashrow_cached_buckets_n = new_nbuckets;
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_oa.Find
+// Find row by key. Return NULL if not found.
+atf_amc::FHashrow* atf_amc::ind_hashrow_oa_Find(const algo::strptr& key) {
+    u32 hash  = cstring_Hash(0, key);
+    u32 mask  = _db.ind_hashrow_oa_slots_n - 1;
+    u32 index = hash & mask;
+    atf_amc::FHashrow* ret=NULL;
+    do {
+        algo::Hashslot &slot = _db.ind_hashrow_oa_slots_elems[index];
+        ret       = (atf_amc::FHashrow*)slot.row;
+        bool done = !ret || (slot.hash == hash && (*ret).key == key);
+        if (done) break;
+        index     = (index + 1) & mask;
+    } while (true);
+    return ret;
+}
+
+// --- atf_amc.FDb.ind_hashrow_oa.GetOrCreate
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHashrow& atf_amc::ind_hashrow_oa_GetOrCreate(const algo::strptr& key) {
+    atf_amc::FHashrow* ret = ind_hashrow_oa_Find(key);
+    if (!ret) { //  if memory alloc fails, process dies; if insert fails, function returns NULL.
+        ret         = &hashrow_Alloc();
+        (*ret).key = key;
+        bool good = hashrow_XrefMaybe(*ret);
+        if (!good) {
+            hashrow_RemoveLast(); // delete offending row, any existing xrefs are cleared
+            ret = NULL;
+        }
+    }
+    return *ret;
+}
+
+// --- atf_amc.FDb.ind_hashrow_oa.InsertMaybe
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool atf_amc::ind_hashrow_oa_InsertMaybe(atf_amc::FHashrow& row) {
+    ind_hashrow_oa_Reserve(1);
+    bool retval = true; // if already in hash, InsertMaybe returns true
+    if (LIKELY(!row.ind_hashrow_oa_in)) {// check if in hash already
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 mask  = _db.ind_hashrow_oa_slots_n - 1;
+        u32 index = hash & mask;
+        algo::Hashslot *slot = &_db.ind_hashrow_oa_slots_elems[index];
+        while (slot->row) { // probe until empty slot
+            atf_amc::FHashrow* ret = (atf_amc::FHashrow*)slot->row;
+            if (slot->hash == hash && (*ret).key == row.key) { // found matching key
+                retval = false;
+                break;
+            }
+            index = (index + 1) & mask;
+            slot  = &_db.ind_hashrow_oa_slots_elems[index];
+        }
+        if (retval) {
+            slot->hash = hash;
+            slot->row  = (u8*)&row;
+            row.ind_hashrow_oa_in = true;
+            _db.ind_hashrow_oa_n++;
+        }
+    }
+    return retval;
+}
+
+// --- atf_amc.FDb.ind_hashrow_oa.Remove
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void atf_amc::ind_hashrow_oa_Remove(atf_amc::FHashrow& row) {
+    if (LIKELY(row.ind_hashrow_oa_in)) {// check if in hash already
+        u32 mask  = _db.ind_hashrow_oa_slots_n - 1;
+        u32 index = cstring_Hash(0, row.key) & mask;
+        while (_db.ind_hashrow_oa_slots_elems[index].row != (u8*)&row) { // scan the probe run for our element
+            index = (index + 1) & mask;
+        }
+        u32 hole = index;
+        u32 next = (hole + 1) & mask;
+        while (_db.ind_hashrow_oa_slots_elems[next].row) {
+            u32 home = _db.ind_hashrow_oa_slots_elems[next].hash & mask;
+            // move entry into the hole unless its home slot lies in (hole, next]
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                _db.ind_hashrow_oa_slots_elems[hole] = _db.ind_hashrow_oa_slots_elems[next];
+                hole = next;
+            }
+            next = (next + 1) & mask;
+        }
+        _db.ind_hashrow_oa_slots_elems[hole].hash = 0;
+        _db.ind_hashrow_oa_slots_elems[hole].row  = NULL;
+        _db.ind_hashrow_oa_n--;
+        row.ind_hashrow_oa_in = false; // not-in-hash
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_oa.Reserve
+// Reserve enough room in the hash for N more elements. Return success code.
+void atf_amc::ind_hashrow_oa_Reserve(int n) {
+    u32 old_nslots = _db.ind_hashrow_oa_slots_n;
+    u32 new_nelems = _db.ind_hashrow_oa_n + n;
+    // keep load factor at or below 1/2 so that probe sequences stay short
+    if (new_nelems * 2 > old_nslots) {
+        u32 new_nslots = u32_Max(BumpToPow2(new_nelems * 2), u32(8));
+        u32 new_mask   = new_nslots - 1;
+        u32 old_size   = old_nslots * sizeof(algo::Hashslot);
+        u32 new_size   = new_nslots * sizeof(algo::Hashslot);
+        algo::Hashslot *new_slots = (algo::Hashslot*)algo_lib::malloc_AllocMem(new_size);
+        if (UNLIKELY(!new_slots)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FDb.ind_hashrow_oa");
+        }
+        memset(new_slots, 0, new_size); // clear slots
+        // re-insert all entries using the stored hash values
+        for (u32 i = 0; i < old_nslots; i++) {
+            algo::Hashslot &slot = _db.ind_hashrow_oa_slots_elems[i];
+            if (slot.row) {
+                u32 index = slot.hash & new_mask;
+                while (new_slots[index].row) {
+                    index = (index + 1) & new_mask;
+                }
+                new_slots[index] = slot;
+            }
+        }
+        // free old array
+        algo_lib::malloc_FreeMem(_db.ind_hashrow_oa_slots_elems, old_size);
+        _db.ind_hashrow_oa_slots_elems = new_slots;
+        _db.ind_hashrow_oa_slots_n = new_nslots;
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_incr.Find
+// Find row by key. Return NULL if not found.
+atf_amc::FHashrow* atf_amc::ind_hashrow_incr_Find(const algo::strptr& key) {
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_hashrow_incr_buckets_n - 1);
+    atf_amc::FHashrow* *e = &_db.ind_hashrow_incr_buckets_elems[index];
+    if (_db.ind_hashrow_incr_old_elems) { // incremental rehash in progress
+        u32 old_index = hash & (_db.ind_hashrow_incr_old_n - 1);
+        if (old_index >= u32(_db.ind_hashrow_incr_old_pos)) { // bucket not migrated yet
+            e = &_db.ind_hashrow_incr_old_elems[old_index];
+        }
+    }
+    atf_amc::FHashrow* ret=NULL;
+    do {
+        ret       = *e;
+        bool done = !ret || (*ret).key == key;
+        if (done) break;
+        e         = &ret->ind_hashrow_incr_next;
+    } while (true);
+    return ret;
+}
+
+// --- atf_amc.FDb.ind_hashrow_incr.GetOrCreate
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHashrow& atf_amc::ind_hashrow_incr_GetOrCreate(const algo::strptr& key) {
+    atf_amc::FHashrow* ret = ind_hashrow_incr_Find(key);
+    if (!ret) { //  if memory alloc fails, process dies; if insert fails, function returns NULL.
+        ret         = &hashrow_Alloc();
+        (*ret).key = key;
+        bool good = hashrow_XrefMaybe(*ret);
+        if (!good) {
+            hashrow_RemoveLast(); // delete offending row, any existing xrefs are cleared
+            ret = NULL;
+        }
+    }
+    return *ret;
+}
+
+// --- atf_amc.FDb.ind_hashrow_incr.InsertMaybe
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool atf_amc::ind_hashrow_incr_InsertMaybe(atf_amc::FHashrow& row) {
+    ind_hashrow_incr_Reserve(1);
+    ind_hashrow_incr_Rehash(2); // migrate old buckets faster than inserts can fill new ones
+    bool retval = true; // if already in hash, InsertMaybe returns true
+    if (LIKELY(row.ind_hashrow_incr_next == (atf_amc::FHashrow*)-1)) {// check if in hash already
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (_db.ind_hashrow_incr_buckets_n - 1);
+        atf_amc::FHashrow* *prev = &_db.ind_hashrow_incr_buckets_elems[index];
+        if (_db.ind_hashrow_incr_old_elems) { // incremental rehash in progress
+            u32 old_index = hash & (_db.ind_hashrow_incr_old_n - 1);
+            if (old_index >= u32(_db.ind_hashrow_incr_old_pos)) { // bucket not migrated yet
+                prev = &_db.ind_hashrow_incr_old_elems[old_index];
+            }
+        }
+        do {
+            atf_amc::FHashrow* ret = *prev;
+            if (!ret) { // exit condition 1: reached the end of the list
+                break;
+            }
+            if ((*ret).key == row.key) { // exit condition 2: found matching key
+                retval = false;
+                break;
+            }
+            prev = &ret->ind_hashrow_incr_next;
+        } while (true);
+        if (retval) {
+            row.ind_hashrow_incr_next = *prev;
+            _db.ind_hashrow_incr_n++;
+            *prev = &row;
+        }
+    }
+    return retval;
+}
+
+// --- atf_amc.FDb.ind_hashrow_incr.Remove
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void atf_amc::ind_hashrow_incr_Remove(atf_amc::FHashrow& row) {
+    if (LIKELY(row.ind_hashrow_incr_next != (atf_amc::FHashrow*)-1)) {// check if in hash already
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (_db.ind_hashrow_incr_buckets_n - 1);
+        atf_amc::FHashrow* *prev = &_db.ind_hashrow_incr_buckets_elems[index]; // addr of pointer to current element
+        if (_db.ind_hashrow_incr_old_elems) { // incremental rehash in progress
+            u32 old_index = hash & (_db.ind_hashrow_incr_old_n - 1);
+            if (old_index >= u32(_db.ind_hashrow_incr_old_pos)) { // bucket not migrated yet
+                prev = &_db.ind_hashrow_incr_old_elems[old_index];
+            }
+        }
+        while (atf_amc::FHashrow *next = *prev) {                          // scan the collision chain for our element
+            if (next == &row) {        // found it?
+                *prev = next->ind_hashrow_incr_next; // unlink (singly linked list)
+                _db.ind_hashrow_incr_n--;
+                row.ind_hashrow_incr_next = (atf_amc::FHashrow*)-1;// not-in-hash
+                break;
+            }
+            prev = &next->ind_hashrow_incr_next;
+        }
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_incr.Reserve
+// Reserve enough room in the hash for N more elements. Return success code.
+void atf_amc::ind_hashrow_incr_Reserve(int n) {
+    u32 old_nbuckets = _db.ind_hashrow_incr_buckets_n;
+    u32 new_nelems   = _db.ind_hashrow_incr_n + n;
+    // # of elements has to be roughly equal to the number of buckets
+    if (new_nelems > old_nbuckets) {
+        ind_hashrow_incr_Rehash(_db.ind_hashrow_incr_old_n); // complete previous rehash, if any
+        int new_nbuckets = i32_Max(BumpToPow2(new_nelems), u32(4));
+        u32 new_size = new_nbuckets * sizeof(atf_amc::FHashrow*);
+        atf_amc::FHashrow* *new_buckets = (atf_amc::FHashrow**)algo_lib::malloc_AllocMem(new_size);
+        if (UNLIKELY(!new_buckets)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FDb.ind_hashrow_incr");
+        }
+        memset(new_buckets, 0, new_size); // clear pointers
+        // existing entries stay in the old array and are migrated
+        // a few buckets at a time by subsequent inserts
+        _db.ind_hashrow_incr_old_elems = _db.ind_hashrow_incr_buckets_elems;
+        _db.ind_hashrow_incr_old_n = _db.ind_hashrow_incr_buckets_n;
+        _db.ind_hashrow_incr_old_pos = 0;
+        _db.ind_hashrow_incr_buckets_elems = new_buckets;
+        _db.ind_hashrow_incr_buckets_n = new_nbuckets;
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_incr.Rehash
+// Incremental rehash: migrate up to N buckets from old bucket array to new one
+void atf_amc::ind_hashrow_incr_Rehash(int n) {
+    while (n > 0 && _db.ind_hashrow_incr_old_elems) {
+        atf_amc::FHashrow* *bucket = &_db.ind_hashrow_incr_old_elems[_db.ind_hashrow_incr_old_pos];
+        atf_amc::FHashrow* elem = *bucket;
+        while (elem) {
+            atf_amc::FHashrow &row        = *elem;
+            atf_amc::FHashrow* next       = row.ind_hashrow_incr_next;
+            u32 index          = cstring_Hash(0, row.key) & (_db.ind_hashrow_incr_buckets_n - 1);
+            row.ind_hashrow_incr_next     = _db.ind_hashrow_incr_buckets_elems[index];
+            _db.ind_hashrow_incr_buckets_elems[index] = &row;
+            elem               = next;
+        }
+        *bucket = NULL;
+        _db.ind_hashrow_incr_old_pos++;
+        n--;
+        if (_db.ind_hashrow_incr_old_pos == _db.ind_hashrow_incr_old_n) { // done, free old array
+            algo_lib::malloc_FreeMem(_db.ind_hashrow_incr_old_elems, _db.ind_hashrow_incr_old_n * sizeof(atf_amc::FHashrow*));
+            _db.ind_hashrow_incr_old_elems = NULL;
+            _db.ind_hashrow_incr_old_n = 0;
+            _db.ind_hashrow_incr_old_pos = 0;
+        }
+    }
+}
+
+// --- atf_amc.FDb.treerow.Alloc
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FTreerow& atf_amc::treerow_Alloc() {
+    atf_amc::FTreerow* row = treerow_AllocMaybe();
+    if (UNLIKELY(row == NULL)) {
+        FatalErrorExit("atf_amc.out_of_mem  field:atf_amc.FDb.treerow  comment:'Alloc failed'");
+    }
+    return *row;
+}
+
+// --- atf_amc.FDb.treerow.AllocMaybe
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FTreerow* atf_amc::treerow_AllocMaybe() {
+    atf_amc::FTreerow *row = (atf_amc::FTreerow*)treerow_AllocMem();
+    if (row) {
+        new (row) atf_amc::FTreerow; // call constructor
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.treerow.AllocMem
+// Allocate space for one element. If no memory available, return NULL.
+void* atf_amc::treerow_AllocMem() {
+    u64 new_nelems     = _db.treerow_n+1;
+    // compute level and index on level
+    u64 bsr   = algo::u64_BitScanReverse(new_nelems);
+    u64 base  = u64(1)<<bsr;
+    u64 index = new_nelems-base;
+    void *ret = NULL;
+    // if level doesn't exist yet, create it
+    atf_amc::FTreerow*  lev   = NULL;
+    if (bsr < 32) {
+        lev = _db.treerow_lary[bsr];
+        if (!lev) {
+            lev=(atf_amc::FTreerow*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FTreerow) * (u64(1)<<bsr));
+            _db.treerow_lary[bsr] = lev;
+        }
+    }
+    // allocate element from this level
+    if (lev) {
+        _db.treerow_n = new_nelems;
+        ret = lev + index;
+    }
+    return ret;
+}
+
+// --- atf_amc.FDb.treerow.RemoveAll
+// Remove all elements from Lary
+void atf_amc::treerow_RemoveAll() {
+    for (u64 n = _db.treerow_n; n>0; ) {
+        n--;
+        treerow_qFind(u64(n)).~FTreerow(); // destroy last element
+        _db.treerow_n = n;
+    }
+}
+
+// --- atf_amc.FDb.treerow.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_amc::treerow_RemoveLast() {
+    u64 n = _db.treerow_n;
+    if (n > 0) {
+        n -= 1;
+        treerow_qFind(u64(n)).~FTreerow();
+        _db.treerow_n = n;
+    }
+}
+
+// --- atf_amc.FDb.treerow.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool atf_amc::treerow_XrefMaybe(atf_amc::FTreerow &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- atf_amc.FDb.bt_treerow.AllocNode
+// Allocate empty node from the base pool
+static atf_amc::_db_bt_treerow_node* atf_amc::bt_treerow_AllocNode(bool leaf) {
+    (void)_db;
+    _db_bt_treerow_node *node = (_db_bt_treerow_node*)algo_lib::malloc_AllocMem(sizeof(_db_bt_treerow_node));
+    if (UNLIKELY(!node)) {
+        FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FDb.bt_treerow");
+    }
+    node->n      = 0;
+    node->leaf   = leaf;
+    node->parent = NULL;
+    node->next   = NULL;
+    node->prev   = NULL;
+    return node;
+}
+
+// --- atf_amc.FDb.bt_treerow.Find
+// Return first row whose key is equal to VAL, or NULL if not found
+atf_amc::FTreerow* atf_amc::bt_treerow_Find(u64 val) {
+    int pos;
+    _db_bt_treerow_node *node = bt_treerow_FindLeaf(val, pos);
+    return node && !(val < node->key[pos]) ? node->row[pos] : NULL;
+}
+
+// --- atf_amc.FDb.bt_treerow.FindLeaf
+// Return leaf and position of the first key >= VAL. Return NULL if there is no such key
+static atf_amc::_db_bt_treerow_node* atf_amc::bt_treerow_FindLeaf(u64 val, int &pos) {
+    _db_bt_treerow_node *node = _db.bt_treerow_root;
+    pos = 0;
+    if (node) {
+        while (!node->leaf) {
+            int i = 1;
+            while (i < node->n && node->key[i] < val) {
+                i++;
+            }
+            node = node->child[i-1];
+        }
+        while (pos < node->n && node->key[pos] < val) {
+            pos++;
+        }
+        // all keys in this leaf are smaller; next leaf starts with a key >= val
+        if (pos == node->n) {
+            node = node->next;
+            pos  = 0;
+        }
+    }
+    return node;
+}
+
+// --- atf_amc.FDb.bt_treerow.FreeNode
+// Free node and all nodes below it. Rows are not touched
+static void atf_amc::bt_treerow_FreeNode(_db_bt_treerow_node *node) {
+    if (!node->leaf) {
+        for (int i = 0; i < node->n; i++) {
+            bt_treerow_FreeNode(node->child[i]);
+        }
+    }
+    algo_lib::malloc_FreeMem(node, sizeof(_db_bt_treerow_node));
+}
+
+// --- atf_amc.FDb.bt_treerow.InsertChild
+// Insert node RIGHT into parent of LEFT, immediately after LEFT
+static void atf_amc::bt_treerow_InsertChild(_db_bt_treerow_node &left, u64 sep, _db_bt_treerow_node &right) {
+    _db_bt_treerow_node *par = left.parent;
+    if (!par) {
+        par           = bt_treerow_AllocNode(false);
+        par->n        = 1;
+        par->key[0]   = sep;
+        par->child[0] = &left;
+        left.parent   = par;
+        _db.bt_treerow_root = par;
+    }
+    int pos = 1;
+    while (par->child[pos-1] != &left) {
+        pos++;
+    }
+    if (par->n == _db_bt_treerow_node::max_keys) {
+        // split; sib->key[0] becomes the separator between par and sib
+        _db_bt_treerow_node *sib = bt_treerow_AllocNode(false);
+        int h = par->n / 2;
+        sib->n = par->n - h;
+        memcpy(sib->key, par->key + h, sib->n * sizeof(par->key[0]));
+        memcpy(sib->child, par->child + h, sib->n * sizeof(par->child[0]));
+        par->n = h;
+        for (int i = 0; i < sib->n; i++) {
+            sib->child[i]->parent = sib;
+        }
+        bt_treerow_InsertChild(*par, sib->key[0], *sib);
+        if (pos > h) {
+            pos -= h;
+            par = sib;
+        }
+    }
+    memmove(par->key + pos + 1, par->key + pos, (par->n - pos) * sizeof(par->key[0]));
+    memmove(par->child + pos + 1, par->child + pos, (par->n - pos) * sizeof(par->child[0]));
+    par->key[pos]   = sep;
+    par->child[pos] = &right;
+    par->n++;
+    right.parent = par;
+}
+
+// --- atf_amc.FDb.bt_treerow.Insert
+// Insert row into the tree. If row is already in the tree, do nothing.
+void atf_amc::bt_treerow_Insert(atf_amc::FTreerow& row) {
+    if (!row.bt_treerow_leaf) {
+        u64 val = row.key;
+        _db_bt_treerow_node *node = _db.bt_treerow_root;
+        if (!node) {
+            node = bt_treerow_AllocNode(true);
+            _db.bt_treerow_root = node;
+        }
+        // descend to the leaf, going right past equal keys
+        while (!node->leaf) {
+            int i = 1;
+            while (i < node->n && !(val < node->key[i])) {
+                i++;
+            }
+            node = node->child[i-1];
+        }
+        int pos = 0;
+        while (pos < node->n && !(val < node->key[pos])) {
+            pos++;
+        }
+        if (node->n == _db_bt_treerow_node::max_keys) {
+            // split full leaf; upper half moves to a new leaf on the right
+            _db_bt_treerow_node *right = bt_treerow_AllocNode(true);
+            int h = node->n / 2;
+            right->n = node->n - h;
+            memcpy(right->key, node->key + h, right->n * sizeof(node->key[0]));
+            memcpy(right->row, node->row + h, right->n * sizeof(node->row[0]));
+            node->n = h;
+            for (int i = 0; i < right->n; i++) {
+                right->row[i]->bt_treerow_leaf = right;
+            }
+            right->prev = node;
+            right->next = node->next;
+            if (node->next) {
+                node->next->prev = right;
+            }
+            node->next = right;
+            bt_treerow_InsertChild(*node, right->key[0], *right);
+            if (pos > h) {
+                pos -= h;
+                node = right;
+            }
+        }
+        memmove(node->key + pos + 1, node->key + pos, (node->n - pos) * sizeof(node->key[0]));
+        memmove(node->row + pos + 1, node->row + pos, (node->n - pos) * sizeof(node->row[0]));
+        node->key[pos] = val;
+        node->row[pos] = &row;
+        node->n++;
+        row.bt_treerow_leaf = node;
+        _db.bt_treerow_n++;
+    }
+}
+
+// --- atf_amc.FDb.bt_treerow.LowerBound
+// Return first row whose key is >= VAL, or NULL
+atf_amc::FTreerow* atf_amc::bt_treerow_LowerBound(u64 val) {
+    int pos;
+    _db_bt_treerow_node *node = bt_treerow_FindLeaf(val, pos);
+    return node ? node->row[pos] : NULL;
+}
+
+// --- atf_amc.FDb.bt_treerow.Reinsert
+// Reinsert a row with modified key
+void atf_amc::bt_treerow_Reinsert(atf_amc::FTreerow& row) {
+    bt_treerow_Remove(row);
+    bt_treerow_Insert(row);
+}
+
+// --- atf_amc.FDb.bt_treerow.Remove
+// Remove element from index. If element is not in index, do nothing.
+void atf_amc::bt_treerow_Remove(atf_amc::FTreerow& row) {
+    _db_bt_treerow_node *node = row.bt_treerow_leaf;
+    if (node) {
+        int pos = 0;
+        while (node->row[pos] != &row) {
+            pos++;
+        }
+        node->n--;
+        memmove(node->key + pos, node->key + pos + 1, (node->n - pos) * sizeof(node->key[0]));
+        memmove(node->row + pos, node->row + pos + 1, (node->n - pos) * sizeof(node->row[0]));
+        row.bt_treerow_leaf = NULL;
+        _db.bt_treerow_n--;
+        if (node->n == 0) {
+            bt_treerow_RemoveNode(*node);
+        }
+        while (_db.bt_treerow_root && !_db.bt_treerow_root->leaf && _db.bt_treerow_root->n == 1) {
+            _db_bt_treerow_node *root = _db.bt_treerow_root;
+            _db.bt_treerow_root = root->child[0];
+            _db.bt_treerow_root->parent = NULL;
+            algo_lib::malloc_FreeMem(root, sizeof(_db_bt_treerow_node));
+        }
+    }
+}
+
+// --- atf_amc.FDb.bt_treerow.RemoveAll
+// Empty the index. (The rows are not deleted)
+void atf_amc::bt_treerow_RemoveAll() {
+    bt_treerow_RemoveAllImpl(false);
+}
+
+// --- atf_amc.FDb.bt_treerow.RemoveAllImpl
+// Empty the index. (rows may be deleted if cascdel)
+static void atf_amc::bt_treerow_RemoveAllImpl(bool del) {
+    _db_bt_treerow_node *root = _db.bt_treerow_root;
+    _db_bt_treerow_node *first = root;
+    while (first && !first->leaf) {
+        first = first->child[0];
+    }
+    _db.bt_treerow_root = NULL;
+    _db.bt_treerow_n = 0;
+    for (_db_bt_treerow_node *node = first; node; node = node->next) {
+        for (int i = 0; i < node->n; i++) {
+            node->row[i]->bt_treerow_leaf = NULL;
+        }
+    }
+    (void)del;
+    if (root) {
+        bt_treerow_FreeNode(root);
+    }
+}
+
+// --- atf_amc.FDb.bt_treerow.RemoveFirst
+// If the tree is empty, return NULL. Otherwise unlink and return pointer to first element.
+atf_amc::FTreerow* atf_amc::bt_treerow_RemoveFirst() {
+    atf_amc::FTreerow *row = bt_treerow_First();
+    if (row) {
+        bt_treerow_Remove(*row);
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.bt_treerow.RemoveNode
+// Unlink empty node from the tree and free it
+static void atf_amc::bt_treerow_RemoveNode(_db_bt_treerow_node &node) {
+    if (node.leaf) {
+        if (node.prev) {
+            node.prev->next = node.next;
+        }
+        if (node.next) {
+            node.next->prev = node.prev;
+        }
+    }
+    _db_bt_treerow_node *par = node.parent;
+    if (!par) {
+        _db.bt_treerow_root = NULL;
+    } else if (par->n == 1) {
+        bt_treerow_RemoveNode(*par);
+    } else {
+        int pos = 0;
+        while (par->child[pos] != &node) {
+            pos++;
+        }
+        // removing child 0 drops separator 1; otherwise the separator to the left of the child goes
+        int kpos = i32_Max(pos, 1);
+        memmove(par->key + kpos, par->key + kpos + 1, (par->n - kpos - 1) * sizeof(par->key[0]));
+        memmove(par->child + pos, par->child + pos + 1, (par->n - pos - 1) * sizeof(par->child[0]));
+        par->n--;
+    }
+    algo_lib::malloc_FreeMem(&node, sizeof(_db_bt_treerow_node));
+}
+
+// --- atf_amc.FDb.tr_treerow.FirstImpl
+atf_amc::FTreerow* atf_amc::tr_treerow_FirstImpl(atf_amc::FTreerow* root) {
+    atf_amc::FTreerow *result = root;
+    while(result != NULL && result->tr_treerow_left != NULL){
+        result = result->tr_treerow_left;
+    }
+    return result;
+}
+
+// --- atf_amc.FDb.tr_treerow.First
+// Return pointer to the first(smallest) element in the tree
+atf_amc::FTreerow* atf_amc::tr_treerow_First() {
+    return tr_treerow_FirstImpl(_db.tr_treerow_root);
+}
+
+// --- atf_amc.FDb.tr_treerow.InsertImpl
+// Insert row into the tree. If row is already in the tree, do nothing.
+void atf_amc::tr_treerow_InsertImpl(atf_amc::FTreerow* parent, atf_amc::FTreerow& row) {
+    bool left = false;
+    while(parent != NULL){
+        left = tr_treerow_ElemLt(row, *parent);
+        atf_amc::FTreerow* side = left ? parent->tr_treerow_left : parent->tr_treerow_right;
+        if(side == NULL){
+            break;
+        }
+        parent = side;
+    }
+    tr_treerow_Connect(parent, &row, left);
+}
+
+// --- atf_amc.FDb.tr_treerow.Insert
+// Insert row into the tree. If row is already in the tree, do nothing.
+void atf_amc::tr_treerow_Insert(atf_amc::FTreerow& row) {
+    if(!tr_treerow_InTreeQ(row)){
+        _db.tr_treerow_n++;
+        tr_treerow_InsertImpl(_db.tr_treerow_root, row);
+        _db.tr_treerow_root = tr_treerow_Propagate(row);
+    }
+}
+
+// --- atf_amc.FDb.tr_treerow.Remove
+// Remove element from index. If element is not in index, do nothing.
+void atf_amc::tr_treerow_Remove(atf_amc::FTreerow& row) {
+    if(!tr_treerow_InTreeQ(row)){
+        return;
+    }
+    atf_amc::FTreerow* next = NULL;
+    if(row.tr_treerow_depth > 1){
+        next = tr_treerow_Balance(row) < 0 ? tr_treerow_FirstImpl(row.tr_treerow_right) : tr_treerow_LastImpl(row.tr_treerow_left);
+        atf_amc::FTreerow* leaf = tr_treerow_TallerChild(*next);
+        if(leaf){
+            tr_treerow_Turn(*leaf, *next);
+        }
+    }
+    atf_amc::FTreerow* root = row.tr_treerow_up;
+    atf_amc::FTreerow* prop = root;//propagate point
+    if(next){
+        prop = next->tr_treerow_up == &row ? next : next->tr_treerow_up;
+        tr_treerow_Disconnect(*next);
+        tr_treerow_Connect(next, row.tr_treerow_left, true);
+        tr_treerow_Connect(next, row.tr_treerow_right, false);
+    }
+    bool dir = root && root->tr_treerow_left == &row;
+    tr_treerow_Connect(root, next, dir);
+    _db.tr_treerow_root = prop ? tr_treerow_Propagate(*prop) : NULL;
+    row.tr_treerow_depth = 0;
+    row.tr_treerow_left = NULL;
+    row.tr_treerow_right = NULL;
+    row.tr_treerow_up = (atf_amc::FTreerow*)-1;
+    _db.tr_treerow_n--;
+}
+
+// --- atf_amc.FDb.tr_treerow.RemoveFirst
+// If the tree is empty, return NULL. Otherwise unlink and return pointer to first element.
+void atf_amc::tr_treerow_RemoveFirst() {
+    if(!tr_treerow_EmptyQ()){
+        tr_treerow_Remove(*tr_treerow_First());
+    }
+}
+
+// --- atf_amc.FDb.tr_treerow.Balance
+i32 atf_amc::tr_treerow_Balance(atf_amc::FTreerow& row) {
+    i32 left  = row.tr_treerow_left  ? row.tr_treerow_left->tr_treerow_depth  : 0;
+    i32 right = row.tr_treerow_right ? row.tr_treerow_right->tr_treerow_depth : 0;
+    return left - right;
+}
+
+// --- atf_amc.FDb.tr_treerow.Propagate
+// Recalculate depth and keep rebalancing if needed
+atf_amc::FTreerow* atf_amc::tr_treerow_Propagate(atf_amc::FTreerow& pnode) {
+    atf_amc::FTreerow *root = &pnode;
+    atf_amc::FTreerow* node = &pnode;
+    while(node != NULL){
+        tr_treerow_updateDepth(*node);
+        tr_treerow_Rebalance(*node);
+        root = node;
+        node = node->tr_treerow_up;
+    }
+    return root;
+}
+
+// --- atf_amc.FDb.tr_treerow.TallerChild
+// Returns the child that has greater height.
+inline static atf_amc::FTreerow* atf_amc::tr_treerow_TallerChild(atf_amc::FTreerow& node) {
+    return tr_treerow_Balance(node) < 0 ? node.tr_treerow_right : node.tr_treerow_left;
+}
+
+// --- atf_amc.FDb.tr_treerow.Disconnect
+// Disconnects the subtree(branch) from the parent
+static void atf_amc::tr_treerow_Disconnect(atf_amc::FTreerow& node) {
+    atf_amc::FTreerow* parent = node.tr_treerow_up;
+    if(parent != NULL){
+        bool left = parent->tr_treerow_left == &node;
+        (left ? parent->tr_treerow_left : parent->tr_treerow_right) = NULL;
+    }
+    node.tr_treerow_up = NULL;
+}
+
+// --- atf_amc.FDb.tr_treerow.Rebalance
+// Rebalances the node if needed.
+void atf_amc::tr_treerow_Rebalance(atf_amc::FTreerow& node) {
+    if(Abs(tr_treerow_Balance(node)) > 1){
+        atf_amc::FTreerow* deep1 = tr_treerow_TallerChild(node);
+        atf_amc::FTreerow* deep2 = tr_treerow_TallerChild(*deep1);
+        bool turn = tr_treerow_Balance(*deep1)!=0 && (node.tr_treerow_left == deep1) != (deep1->tr_treerow_left == deep2);
+        if(turn){
+            tr_treerow_Turn(*deep2, *deep1);
+            TSwap(deep1, deep2);
+        }
+        tr_treerow_Turn(*deep1, node);
+        tr_treerow_updateDepth(node);
+        tr_treerow_updateDepth(*deep2);
+        tr_treerow_updateDepth(*deep1);
+    }
+}
+
+// --- atf_amc.FDb.tr_treerow.Next
+atf_amc::FTreerow* atf_amc::tr_treerow_Next(atf_amc::FTreerow& node) {
+    atf_amc::FTreerow *result = &node;
+    if(result->tr_treerow_right == NULL){
+        while(result->tr_treerow_up != NULL && result->tr_treerow_up->tr_treerow_right == result){
+            result = result->tr_treerow_up;
+        }
+        result = result->tr_treerow_up;
+    }else{
+        result = tr_treerow_FirstImpl(result->tr_treerow_right);
+    }
+    return result;
+}
+
+// --- atf_amc.FDb.tr_treerow.Prev
+atf_amc::FTreerow* atf_amc::tr_treerow_Prev(atf_amc::FTreerow& node) {
+    atf_amc::FTreerow *result = &node;
+    if(result->tr_treerow_left == NULL){
+        while(result->tr_treerow_up != NULL && result->tr_treerow_up->tr_treerow_left == result){
+            result = result->tr_treerow_up;
+        }
+        result = result->tr_treerow_up;
+    }else{
+        result = tr_treerow_LastImpl(result->tr_treerow_left);
+    }
+    return result;
+}
+
+// --- atf_amc.FDb.tr_treerow.LastImpl
+atf_amc::FTreerow* atf_amc::tr_treerow_LastImpl(atf_amc::FTreerow* root) {
+    atf_amc::FTreerow *result = root;
+    while(result != NULL && result->tr_treerow_right != NULL){
+        result = result->tr_treerow_right;
+    }
+    return result;
+}
+
+// --- atf_amc.FDb.tr_treerow.Last
+// Return pointer to the last(largest) element in tree
+atf_amc::FTreerow* atf_amc::tr_treerow_Last() {
+    return tr_treerow_LastImpl(_db.tr_treerow_root);
+}
+
+// --- atf_amc.FDb.tr_treerow.ElemLt
+inline static bool atf_amc::tr_treerow_ElemLt(atf_amc::FTreerow &a, atf_amc::FTreerow &b) {
+    (void)_db;
+    return a.key < b.key;
+}
+
+// --- atf_amc.FDb.tr_treerow.UpdateDepth
+static void atf_amc::tr_treerow_updateDepth(atf_amc::FTreerow& node) {
+    i32 ldepth = node.tr_treerow_left  != NULL ? node.tr_treerow_left->tr_treerow_depth : 0;
+    i32 rdepth = node.tr_treerow_right != NULL ? node.tr_treerow_right->tr_treerow_depth : 0;
+    node.tr_treerow_depth = i32_Max(ldepth, rdepth) + 1;
+}
+
+// --- atf_amc.FDb.tr_treerow.Turn
+// rotates the tree in from->to direction
+static void atf_amc::tr_treerow_Turn(atf_amc::FTreerow& from, atf_amc::FTreerow& to) {
+    atf_amc::FTreerow* root = to.tr_treerow_up;
+    bool dir = root && root->tr_treerow_left == &to;
+    tr_treerow_Connect(root, &from, dir);
+    dir = to.tr_treerow_left == &from;
+    atf_amc::FTreerow* orphan = (dir ? from.tr_treerow_right : from.tr_treerow_left);//other side
+    tr_treerow_Connect(&from, &to , !dir);
+    tr_treerow_Connect(&to, orphan, dir);
+}
+
+// --- atf_amc.FDb.tr_treerow.Connect
+inline static void atf_amc::tr_treerow_Connect(atf_amc::FTreerow* parent, atf_amc::FTreerow* child, bool left) {
+    if(parent){
+        (left ? parent->tr_treerow_left : parent->tr_treerow_right) = child;
+    }
+    if(child){
+        child->tr_treerow_up = parent;
+    }
+}
+
+// --- atf_amc.FDb.tr_treerow.RemoveAllImpl
+// Empty the index. (rows may be deleted if cascdel)
+void atf_amc::tr_treerow_RemoveAllImpl(atf_amc::FTreerow* root, bool del) {
+    if(root != NULL){
+        tr_treerow_RemoveAllImpl(root->tr_treerow_left, del);
+        tr_treerow_RemoveAllImpl(root->tr_treerow_right, del);
+        tr_treerow_Disconnect(*root);
+        root->tr_treerow_depth = 0;//the pointers are taken care of by Disconnect
+        root->tr_treerow_up = (atf_amc::FTreerow*)-1;//the pointers are taken care of by Disconnect
+    }
+}
+
+// --- atf_amc.FDb.tr_treerow.Reinsert
+// Reinsert a row with modified key(Reheap semantics)
+void atf_amc::tr_treerow_Reinsert(atf_amc::FTreerow& node) {
+    tr_treerow_Remove(node);
+    tr_treerow_Insert(node);
+}
+
+// --- atf_amc.FDb.tr_treerow.FirstGe
+// Find the first element that is greater or equal to a sortfld value
+atf_amc::FTreerow* atf_amc::tr_treerow_FirstGe(const u64& val) {
+    atf_amc::FTreerow* result = _db.tr_treerow_root;
+    bool left = false;
+    while(result){
+        left = !((*result).key < val);
+        atf_amc::FTreerow* side = left ? result->tr_treerow_left : result->tr_treerow_right;
+        if(side==NULL){
+            break;
+        }
+        result = side;
+    }
+    while(result && (*result).key < val){
+        result = tr_treerow_Next(*result);
+    }
+    return result;
+}
+
+// --- atf_amc.FDb.tr_treerow.LastLt
+// Find the last element that is smaller or equal to a sortfld value
+atf_amc::FTreerow* atf_amc::tr_treerow_LastLt(const u64& val) {
+    atf_amc::FTreerow* result = _db.tr_treerow_root;
+    bool left = false;
+    while(result){
+        left = val < (*result).key;
+        atf_amc::FTreerow* side = left ? result->tr_treerow_left : result->tr_treerow_right;
+        if(side==NULL){
+            break;
+        }
+        result = side;
+    }
+    while(result && !((*result).key < val)){
+        result = tr_treerow_Prev(*result);
+    }
+    return result;
+}
+
+// --- atf_amc.FDb.colrow.Alloc
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FColrow& atf_amc::colrow_Alloc() {
+    atf_amc::FColrow* row = colrow_AllocMaybe();
+    if (UNLIKELY(row == NULL)) {
+        FatalErrorExit("atf_amc.out_of_mem  field:atf_amc.FDb.colrow  comment:'Alloc failed'");
+    }
+    return *row;
+}
+
+// --- atf_amc.FDb.colrow.AllocMaybe
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FColrow* atf_amc::colrow_AllocMaybe() {
+    atf_amc::FColrow *row = (atf_amc::FColrow*)colrow_AllocMem();
+    if (row) {
+        new (row) atf_amc::FColrow; // call constructor
+        row->rowid = i32(colrow_N() - 1);
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.colrow.AllocMem
+// Allocate space for one element. If no memory available, return NULL.
+void* atf_amc::colrow_AllocMem() {
+    u64 new_nelems     = _db.colrow_n+1;
+    // compute level and index on level
+    u64 bsr   = algo::u64_BitScanReverse(new_nelems);
+    u64 base  = u64(1)<<bsr;
+    u64 index = new_nelems-base;
+    void *ret = NULL;
+    // if level doesn't exist yet, create it
+    atf_amc::FColrow*  lev   = NULL;
+    if (bsr < 32) {
+        lev = _db.colrow_lary[bsr];
+        if (!lev) {
+            bool ok = true;
+            if (ok) {
+                _db.colrow_price_lary[bsr] = (double*)algo_lib::malloc_AllocMem(sizeof(double) * (u64(1)<<bsr));
+                ok = _db.colrow_price_lary[bsr] != NULL;
+            }
+            if (ok) {
+                _db.colrow_qty_lary[bsr] = (i32*)algo_lib::malloc_AllocMem(sizeof(i32) * (u64(1)<<bsr));
+                ok = _db.colrow_qty_lary[bsr] != NULL;
+            }
+            if (ok) {
+                lev=(atf_amc::FColrow*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FColrow) * (u64(1)<<bsr));
+                _db.colrow_lary[bsr] = lev;
+            }
+            if (!lev) {
+                if (_db.colrow_price_lary[bsr]) {
+                    algo_lib::malloc_FreeMem(_db.colrow_price_lary[bsr], sizeof(double) * (u64(1)<<bsr));
+                    _db.colrow_price_lary[bsr] = NULL;
+                }
+                if (_db.colrow_qty_lary[bsr]) {
+                    algo_lib::malloc_FreeMem(_db.colrow_qty_lary[bsr], sizeof(i32) * (u64(1)<<bsr));
+                    _db.colrow_qty_lary[bsr] = NULL;
+                }
+            }
+        }
+    }
+    // allocate element from this level
+    if (lev) {
+        _db.colrow_n = new_nelems;
+        ret = lev + index;
+    }
+    return ret;
+}
+
+// --- atf_amc.FDb.colrow.RemoveAll
+// Remove all elements from Lary
+void atf_amc::colrow_RemoveAll() {
+    for (u64 n = _db.colrow_n; n>0; ) {
+        n--;
+        colrow_qFind(i32(n)).~FColrow(); // destroy last element
+        _db.colrow_n = n;
+    }
+}
+
+// --- atf_amc.FDb.colrow.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_amc::colrow_RemoveLast() {
+    u64 n = _db.colrow_n;
+    if (n > 0) {
+        n -= 1;
+        colrow_qFind(i32(n)).~FColrow();
+        _db.colrow_n = n;
+    }
+}
+
+// --- atf_amc.FDb.colrow.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool atf_amc::colrow_XrefMaybe(atf_amc::FColrow &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- atf_amc.FDb.heaprow.Alloc
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FHeaprow& atf_amc::heaprow_Alloc() {
+    atf_amc::FHeaprow* row = heaprow_AllocMaybe();
+    if (UNLIKELY(row == NULL)) {
+        FatalErrorExit("atf_amc.out_of_mem  field:atf_amc.FDb.heaprow  comment:'Alloc failed'");
+    }
+    return *row;
+}
+
+// --- atf_amc.FDb.heaprow.AllocMaybe
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FHeaprow* atf_amc::heaprow_AllocMaybe() {
+    atf_amc::FHeaprow *row = (atf_amc::FHeaprow*)heaprow_AllocMem();
+    if (row) {
+        new (row) atf_amc::FHeaprow; // call constructor
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.heaprow.AllocMem
+// Allocate space for one element. If no memory available, return NULL.
+void* atf_amc::heaprow_AllocMem() {
+    u64 new_nelems     = _db.heaprow_n+1;
+    // compute level and index on level
+    u64 bsr   = algo::u64_BitScanReverse(new_nelems);
+    u64 base  = u64(1)<<bsr;
+    u64 index = new_nelems-base;
+    void *ret = NULL;
+    // if level doesn't exist yet, create it
+    atf_amc::FHeaprow*  lev   = NULL;
+    if (bsr < 32) {
+        lev = _db.heaprow_lary[bsr];
+        if (!lev) {
+            lev=(atf_amc::FHeaprow*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FHeaprow) * (u64(1)<<bsr));
+            _db.heaprow_lary[bsr] = lev;
+        }
+    }
+    // allocate element from this level
+    if (lev) {
+        _db.heaprow_n = new_nelems;
+        ret = lev + index;
+    }
+    return ret;
+}
+
+// --- atf_amc.FDb.heaprow.RemoveAll
+// Remove all elements from Lary
+void atf_amc::heaprow_RemoveAll() {
+    for (u64 n = _db.heaprow_n; n>0; ) {
+        n--;
+        heaprow_qFind(u64(n)).~FHeaprow(); // destroy last element
+        _db.heaprow_n = n;
+    }
+}
+
+// --- atf_amc.FDb.heaprow.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_amc::heaprow_RemoveLast() {
+    u64 n = _db.heaprow_n;
+    if (n > 0) {
+        n -= 1;
+        heaprow_qFind(u64(n)).~FHeaprow();
+        _db.heaprow_n = n;
+    }
+}
+
+// --- atf_amc.FDb.heaprow.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool atf_amc::heaprow_XrefMaybe(atf_amc::FHeaprow &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- atf_amc.FDb.bh_heaprow.Dealloc
+// Remove all elements from heap and free memory used by the array.
+void atf_amc::bh_heaprow_Dealloc() {
+    bh_heaprow_RemoveAll();
+    algo_lib::malloc_FreeMem(_db.bh_heaprow_elems, sizeof(atf_amc::FHeaprow*)*_db.bh_heaprow_max);
+    _db.bh_heaprow_max   = 0;
+    _db.bh_heaprow_elems = NULL;
+}
+
+// --- atf_amc.FDb.bh_heaprow.Downheap
+// Find new location for ROW starting at IDX
+// NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
+static int atf_amc::bh_heaprow_Downheap(atf_amc::FHeaprow& row, int idx) {
+    atf_amc::FHeaprow* *elems = _db.bh_heaprow_elems;
+    int n = _db.bh_heaprow_n;
+    int child = idx*2+1;
+    while (child < n) {
+        atf_amc::FHeaprow* p = elems[child]; // left child
+        int rchild = child+1;
+        if (rchild < n) {
+            atf_amc::FHeaprow* q = elems[rchild]; // right child
+            if (bh_heaprow_ElemLt(*q,*p)) {
+                child = rchild;
+                p     = q;
+            }
+        }
+        if (!bh_heaprow_ElemLt(*p,row)) {
+            break;
+        }
+        p->bh_heaprow_idx   = idx;
+        elems[idx]     = p;
+        idx            = child;
+        child          = idx*2+1;
+    }
+    return idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow.Insert
+// Insert row. Row must not already be in index. If row is already in index, do nothing.
+void atf_amc::bh_heaprow_Insert(atf_amc::FHeaprow& row) {
+    if (LIKELY(row.bh_heaprow_idx == -1)) {
+        bh_heaprow_Reserve(1);
+        int n = _db.bh_heaprow_n;
+        _db.bh_heaprow_n = n + 1;
+        int new_idx = bh_heaprow_Upheap(row, n);
+        row.bh_heaprow_idx = new_idx;
+        _db.bh_heaprow_elems[new_idx] = &row;
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow.Reheap
+// If row is in heap, update its position. If row is not in heap, insert it.
+// Return new position of item in the heap (0=top)
+i32 atf_amc::bh_heaprow_Reheap(atf_amc::FHeaprow& row) {
+    int old_idx = row.bh_heaprow_idx;
+    bool isnew = old_idx == -1;
+    if (isnew) {
+        bh_heaprow_Reserve(1);
+        old_idx = _db.bh_heaprow_n++;
+    }
+    int new_idx = bh_heaprow_Upheap(row, old_idx);
+    if (!isnew && new_idx == old_idx) {
+        new_idx = bh_heaprow_Downheap(row, old_idx);
+    }
+    row.bh_heaprow_idx = new_idx;
+    _db.bh_heaprow_elems[new_idx] = &row;
+    return new_idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow.ReheapFirst
+// Key of first element in the heap changed. Move it.
+// This function does not check the insert condition.
+// Return new position of item in the heap (0=top).
+// Heap must be non-empty or behavior is undefined.
+i32 atf_amc::bh_heaprow_ReheapFirst() {
+    atf_amc::FHeaprow &row = *_db.bh_heaprow_elems[0];
+    i32 new_idx = bh_heaprow_Downheap(row, 0);
+    row.bh_heaprow_idx = new_idx;
+    _db.bh_heaprow_elems[new_idx] = &row;
+    return new_idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow.Remove
+// Remove element from index. If element is not in index, do nothing.
+void atf_amc::bh_heaprow_Remove(atf_amc::FHeaprow& row) {
+    if (bh_heaprow_InBheapQ(row)) {
+        int old_idx = row.bh_heaprow_idx;
+        if (_db.bh_heaprow_elems[old_idx] == &row) { // sanity check: heap points back to row
+            row.bh_heaprow_idx = -1;           // mark not in heap
+            i32 n = _db.bh_heaprow_n - 1; // index of last element in heap
+            _db.bh_heaprow_n = n;         // decrease count
+            if (old_idx != n) {
+                atf_amc::FHeaprow *elem = _db.bh_heaprow_elems[n];
+                int new_idx = bh_heaprow_Upheap(*elem, old_idx);
+                if (new_idx == old_idx) {
+                    new_idx = bh_heaprow_Downheap(*elem, old_idx);
+                }
+                elem->bh_heaprow_idx = new_idx;
+                _db.bh_heaprow_elems[new_idx] = elem;
+            }
+        }
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow.RemoveAll
+// Remove all elements from binary heap
+void atf_amc::bh_heaprow_RemoveAll() {
+    int n = _db.bh_heaprow_n;
+    for (int i = n - 1; i>=0; i--) {
+        _db.bh_heaprow_elems[i]->bh_heaprow_idx = -1; // mark not-in-heap
+    }
+    _db.bh_heaprow_n = 0;
+}
+
+// --- atf_amc.FDb.bh_heaprow.RemoveFirst
+// If index is empty, return NULL. Otherwise remove and return first key in index.
+//  Call 'head changed' trigger.
+atf_amc::FHeaprow* atf_amc::bh_heaprow_RemoveFirst() {
+    atf_amc::FHeaprow *row = NULL;
+    if (_db.bh_heaprow_n > 0) {
+        row = _db.bh_heaprow_elems[0];
+        row->bh_heaprow_idx = -1;           // mark not in heap
+        i32 n = _db.bh_heaprow_n - 1; // index of last element in heap
+        _db.bh_heaprow_n = n;         // decrease count
+        if (n) {
+            atf_amc::FHeaprow &elem = *_db.bh_heaprow_elems[n];
+            int new_idx = bh_heaprow_Downheap(elem, 0);
+            elem.bh_heaprow_idx = new_idx;
+            _db.bh_heaprow_elems[new_idx] = &elem;
+        }
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.bh_heaprow.Reserve
+// Reserve space in index for N more elements
+void atf_amc::bh_heaprow_Reserve(int n) {
+    i32 old_max = _db.bh_heaprow_max;
+    if (UNLIKELY(_db.bh_heaprow_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(atf_amc::FHeaprow*);
+        u32 new_size = new_max * sizeof(atf_amc::FHeaprow*);
+        void *new_mem = algo_lib::malloc_ReallocMem(_db.bh_heaprow_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FDb.bh_heaprow");
+        }
+        _db.bh_heaprow_elems = (atf_amc::FHeaprow**)new_mem;
+        _db.bh_heaprow_max = new_max;
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow.Upheap
+// Find and return index of new location for element ROW in the heap, starting at index IDX.
+// Move any elements along the way but do not modify ROW.
+static int atf_amc::bh_heaprow_Upheap(atf_amc::FHeaprow& row, int idx) {
+    atf_amc::FHeaprow* *elems = _db.bh_heaprow_elems;
+    while (idx>0) {
+        int j = (idx-1)/2;
+        atf_amc::FHeaprow* p = elems[j];
+        if (!bh_heaprow_ElemLt(row, *p)) {
+            break;
+        }
+        p->bh_heaprow_idx = idx;
+        elems[idx] = p;
+        idx = j;
+    }
+    return idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow.ElemLt
+inline static bool atf_amc::bh_heaprow_ElemLt(atf_amc::FHeaprow &a, atf_amc::FHeaprow &b) {
+    (void)_db;
+    return a.key < b.key;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.Dealloc
+// Remove all elements from heap and free memory used by the array.
+void atf_amc::bh_heaprow_inl_Dealloc() {
+    bh_heaprow_inl_RemoveAll();
+    algo_lib::malloc_FreeMem(_db.bh_heaprow_inl_elems, sizeof(_db_bh_heaprow_inl_elem)*_db.bh_heaprow_inl_max);
+    _db.bh_heaprow_inl_max   = 0;
+    _db.bh_heaprow_inl_elems = NULL;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.Downheap
+// Find new location for heap element ELEM starting at IDX
+// NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.
+static int atf_amc::bh_heaprow_inl_Downheap(_db_bh_heaprow_inl_elem elem, int idx) {
+    _db_bh_heaprow_inl_elem *elems = _db.bh_heaprow_inl_elems;
+    int n = _db.bh_heaprow_inl_n;
+    int child = idx*4+1;
+    while (child < n) {
+        int lim = child+4 < n ? child+4 : n;
+        for (int i = child+1; i < lim; i++) { // pick smallest child
+            if (bh_heaprow_inl_HeapLt(elems[i], elems[child])) {
+                child = i;
+            }
+        }
+        if (!bh_heaprow_inl_HeapLt(elems[child], elem)) {
+            break;
+        }
+        elems[idx] = elems[child];
+        elems[idx].row->bh_heaprow_inl_idx = idx;
+        idx        = child;
+        child      = idx*4+1;
+    }
+    return idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.Insert
+// Insert row. Row must not already be in index. If row is already in index, do nothing.
+void atf_amc::bh_heaprow_inl_Insert(atf_amc::FHeaprow& row) {
+    if (LIKELY(row.bh_heaprow_inl_idx == -1)) {
+        bh_heaprow_inl_Reserve(1);
+        int n = _db.bh_heaprow_inl_n;
+        _db.bh_heaprow_inl_n = n + 1;
+        _db_bh_heaprow_inl_elem elem = _db_bh_heaprow_inl_elem(row.key, &row);
+        int new_idx = bh_heaprow_inl_Upheap(elem, n);
+        row.bh_heaprow_inl_idx = new_idx;
+        _db.bh_heaprow_inl_elems[new_idx] = elem;
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.Reheap
+// If row is in heap, update its position. If row is not in heap, insert it.
+// Return new position of item in the heap (0=top)
+i32 atf_amc::bh_heaprow_inl_Reheap(atf_amc::FHeaprow& row) {
+    int old_idx = row.bh_heaprow_inl_idx;
+    bool isnew = old_idx == -1;
+    if (isnew) {
+        bh_heaprow_inl_Reserve(1);
+        old_idx = _db.bh_heaprow_inl_n++;
+    }
+    _db_bh_heaprow_inl_elem elem = _db_bh_heaprow_inl_elem(row.key, &row);
+    int new_idx = bh_heaprow_inl_Upheap(elem, old_idx);
+    if (!isnew && new_idx == old_idx) {
+        new_idx = bh_heaprow_inl_Downheap(elem, old_idx);
+    }
+    row.bh_heaprow_inl_idx = new_idx;
+    _db.bh_heaprow_inl_elems[new_idx] = elem;
+    return new_idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.ReheapFirst
+// Key of first element in the heap changed. Move it.
+// This function does not check the insert condition.
+// Return new position of item in the heap (0=top).
+// Heap must be non-empty or behavior is undefined.
+i32 atf_amc::bh_heaprow_inl_ReheapFirst() {
+    atf_amc::FHeaprow &row = *_db.bh_heaprow_inl_elems[0].row;
+    _db_bh_heaprow_inl_elem elem = _db_bh_heaprow_inl_elem(row.key, &row);
+    i32 new_idx = bh_heaprow_inl_Downheap(elem, 0);
+    row.bh_heaprow_inl_idx = new_idx;
+    _db.bh_heaprow_inl_elems[new_idx] = elem;
+    return new_idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.Remove
+// Remove element from index. If element is not in index, do nothing.
+void atf_amc::bh_heaprow_inl_Remove(atf_amc::FHeaprow& row) {
+    if (bh_heaprow_inl_InBheapQ(row)) {
+        int old_idx = row.bh_heaprow_inl_idx;
+        if (&row == _db.bh_heaprow_inl_elems[old_idx].row) { // sanity check: heap points back to row
+            row.bh_heaprow_inl_idx = -1;           // mark not in heap
+            i32 n = _db.bh_heaprow_inl_n - 1; // index of last element in heap
+            _db.bh_heaprow_inl_n = n;         // decrease count
+            if (old_idx != n) {
+                _db_bh_heaprow_inl_elem elem = _db.bh_heaprow_inl_elems[n];
+                int new_idx = bh_heaprow_inl_Upheap(elem, old_idx);
+                if (new_idx == old_idx) {
+                    new_idx = bh_heaprow_inl_Downheap(elem, old_idx);
+                }
+                elem.row->bh_heaprow_inl_idx = new_idx;
+                _db.bh_heaprow_inl_elems[new_idx] = elem;
+            }
+        }
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.RemoveAll
+// Remove all elements from binary heap
+void atf_amc::bh_heaprow_inl_RemoveAll() {
+    int n = _db.bh_heaprow_inl_n;
+    for (int i = n - 1; i>=0; i--) {
+        _db.bh_heaprow_inl_elems[i].row->bh_heaprow_inl_idx = -1; // mark not-in-heap
+    }
+    _db.bh_heaprow_inl_n = 0;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.RemoveFirst
+// If index is empty, return NULL. Otherwise remove and return first key in index.
+//  Call 'head changed' trigger.
+atf_amc::FHeaprow* atf_amc::bh_heaprow_inl_RemoveFirst() {
+    atf_amc::FHeaprow *row = NULL;
+    if (_db.bh_heaprow_inl_n > 0) {
+        row = _db.bh_heaprow_inl_elems[0].row;
+        row->bh_heaprow_inl_idx = -1;           // mark not in heap
+        i32 n = _db.bh_heaprow_inl_n - 1; // index of last element in heap
+        _db.bh_heaprow_inl_n = n;         // decrease count
+        if (n) {
+            _db_bh_heaprow_inl_elem elem = _db.bh_heaprow_inl_elems[n];
+            int new_idx = bh_heaprow_inl_Downheap(elem, 0);
+            elem.row->bh_heaprow_inl_idx = new_idx;
+            _db.bh_heaprow_inl_elems[new_idx] = elem;
+        }
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.Reserve
+// Reserve space in index for N more elements
+void atf_amc::bh_heaprow_inl_Reserve(int n) {
+    i32 old_max = _db.bh_heaprow_inl_max;
+    if (UNLIKELY(_db.bh_heaprow_inl_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(_db_bh_heaprow_inl_elem);
+        u32 new_size = new_max * sizeof(_db_bh_heaprow_inl_elem);
+        void *new_mem = algo_lib::malloc_ReallocMem(_db.bh_heaprow_inl_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FDb.bh_heaprow_inl");
+        }
+        _db.bh_heaprow_inl_elems = (_db_bh_heaprow_inl_elem*)new_mem;
+        _db.bh_heaprow_inl_max = new_max;
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.Upheap
+// Find and return index of new location for heap element ELEM, starting at index IDX.
+// Move any elements along the way but do not store ELEM.
+static int atf_amc::bh_heaprow_inl_Upheap(_db_bh_heaprow_inl_elem elem, int idx) {
+    _db_bh_heaprow_inl_elem *elems = _db.bh_heaprow_inl_elems;
+    while (idx>0) {
+        int j = (idx-1)/4;
+        if (!bh_heaprow_inl_HeapLt(elem, elems[j])) {
+            break;
+        }
+        elems[idx] = elems[j];
+        elems[idx].row->bh_heaprow_inl_idx = idx;
+        idx = j;
+    }
+    return idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.ElemLt
+inline static bool atf_amc::bh_heaprow_inl_ElemLt(atf_amc::FHeaprow &a, atf_amc::FHeaprow &b) {
+    (void)_db;
+    return a.key < b.key;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.HeapLt
+// Compare two heap elements (dmmeta.bheap heaps only)
+inline static bool atf_amc::bh_heaprow_inl_HeapLt(_db_bh_heaprow_inl_elem a, _db_bh_heaprow_inl_elem b) {
+    (void)_db;
+    return a.key < b.key;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.Dealloc
+// Remove all elements from heap and free memory used by the array.
+void atf_amc::bh_heaprow_ptr_Dealloc() {
+    bh_heaprow_ptr_RemoveAll();
+    algo_lib::malloc_FreeMem(_db.bh_heaprow_ptr_elems, sizeof(atf_amc::FHeaprow*)*_db.bh_heaprow_ptr_max);
+    _db.bh_heaprow_ptr_max   = 0;
+    _db.bh_heaprow_ptr_elems = NULL;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.Downheap
+// Find new location for heap element ELEM starting at IDX
+// NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.
+static int atf_amc::bh_heaprow_ptr_Downheap(atf_amc::FHeaprow* elem, int idx) {
+    atf_amc::FHeaprow* *elems = _db.bh_heaprow_ptr_elems;
+    int n = _db.bh_heaprow_ptr_n;
+    int child = idx*8+1;
+    while (child < n) {
+        int lim = child+8 < n ? child+8 : n;
+        for (int i = child+1; i < lim; i++) { // pick smallest child
+            if (bh_heaprow_ptr_HeapLt(elems[i], elems[child])) {
+                child = i;
+            }
+        }
+        if (!bh_heaprow_ptr_HeapLt(elems[child], elem)) {
+            break;
+        }
+        elems[idx] = elems[child];
+        elems[idx]->bh_heaprow_ptr_idx = idx;
+        idx        = child;
+        child      = idx*8+1;
+    }
+    return idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.Insert
+// Insert row. Row must not already be in index. If row is already in index, do nothing.
+void atf_amc::bh_heaprow_ptr_Insert(atf_amc::FHeaprow& row) {
+    if (LIKELY(row.bh_heaprow_ptr_idx == -1)) {
+        bh_heaprow_ptr_Reserve(1);
+        int n = _db.bh_heaprow_ptr_n;
+        _db.bh_heaprow_ptr_n = n + 1;
+        atf_amc::FHeaprow* elem = &row;
+        int new_idx = bh_heaprow_ptr_Upheap(elem, n);
+        row.bh_heaprow_ptr_idx = new_idx;
+        _db.bh_heaprow_ptr_elems[new_idx] = elem;
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.Reheap
+// If row is in heap, update its position. If row is not in heap, insert it.
+// Return new position of item in the heap (0=top)
+i32 atf_amc::bh_heaprow_ptr_Reheap(atf_amc::FHeaprow& row) {
+    int old_idx = row.bh_heaprow_ptr_idx;
+    bool isnew = old_idx == -1;
+    if (isnew) {
+        bh_heaprow_ptr_Reserve(1);
+        old_idx = _db.bh_heaprow_ptr_n++;
+    }
+    atf_amc::FHeaprow* elem = &row;
+    int new_idx = bh_heaprow_ptr_Upheap(elem, old_idx);
+    if (!isnew && new_idx == old_idx) {
+        new_idx = bh_heaprow_ptr_Downheap(elem, old_idx);
+    }
+    row.bh_heaprow_ptr_idx = new_idx;
+    _db.bh_heaprow_ptr_elems[new_idx] = elem;
+    return new_idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.ReheapFirst
+// Key of first element in the heap changed. Move it.
+// This function does not check the insert condition.
+// Return new position of item in the heap (0=top).
+// Heap must be non-empty or behavior is undefined.
+i32 atf_amc::bh_heaprow_ptr_ReheapFirst() {
+    atf_amc::FHeaprow &row = *_db.bh_heaprow_ptr_elems[0];
+    atf_amc::FHeaprow* elem = &row;
+    i32 new_idx = bh_heaprow_ptr_Downheap(elem, 0);
+    row.bh_heaprow_ptr_idx = new_idx;
+    _db.bh_heaprow_ptr_elems[new_idx] = elem;
+    return new_idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.Remove
+// Remove element from index. If element is not in index, do nothing.
+void atf_amc::bh_heaprow_ptr_Remove(atf_amc::FHeaprow& row) {
+    if (bh_heaprow_ptr_InBheapQ(row)) {
+        int old_idx = row.bh_heaprow_ptr_idx;
+        if (&row == _db.bh_heaprow_ptr_elems[old_idx]) { // sanity check: heap points back to row
+            row.bh_heaprow_ptr_idx = -1;           // mark not in heap
+            i32 n = _db.bh_heaprow_ptr_n - 1; // index of last element in heap
+            _db.bh_heaprow_ptr_n = n;         // decrease count
+            if (old_idx != n) {
+                atf_amc::FHeaprow* elem = _db.bh_heaprow_ptr_elems[n];
+                int new_idx = bh_heaprow_ptr_Upheap(elem, old_idx);
+                if (new_idx == old_idx) {
+                    new_idx = bh_heaprow_ptr_Downheap(elem, old_idx);
+                }
+                elem->bh_heaprow_ptr_idx = new_idx;
+                _db.bh_heaprow_ptr_elems[new_idx] = elem;
+            }
+        }
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.RemoveAll
+// Remove all elements from binary heap
+void atf_amc::bh_heaprow_ptr_RemoveAll() {
+    int n = _db.bh_heaprow_ptr_n;
+    for (int i = n - 1; i>=0; i--) {
+        _db.bh_heaprow_ptr_elems[i]->bh_heaprow_ptr_idx = -1; // mark not-in-heap
+    }
+    _db.bh_heaprow_ptr_n = 0;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.RemoveFirst
+// If index is empty, return NULL. Otherwise remove and return first key in index.
+//  Call 'head changed' trigger.
+atf_amc::FHeaprow* atf_amc::bh_heaprow_ptr_RemoveFirst() {
+    atf_amc::FHeaprow *row = NULL;
+    if (_db.bh_heaprow_ptr_n > 0) {
+        row = _db.bh_heaprow_ptr_elems[0];
+        row->bh_heaprow_ptr_idx = -1;           // mark not in heap
+        i32 n = _db.bh_heaprow_ptr_n - 1; // index of last element in heap
+        _db.bh_heaprow_ptr_n = n;         // decrease count
+        if (n) {
+            atf_amc::FHeaprow* elem = _db.bh_heaprow_ptr_elems[n];
+            int new_idx = bh_heaprow_ptr_Downheap(elem, 0);
+            elem->bh_heaprow_ptr_idx = new_idx;
+            _db.bh_heaprow_ptr_elems[new_idx] = elem;
+        }
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.Reserve
+// Reserve space in index for N more elements
+void atf_amc::bh_heaprow_ptr_Reserve(int n) {
+    i32 old_max = _db.bh_heaprow_ptr_max;
+    if (UNLIKELY(_db.bh_heaprow_ptr_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(atf_amc::FHeaprow*);
+        u32 new_size = new_max * sizeof(atf_amc::FHeaprow*);
+        void *new_mem = algo_lib::malloc_ReallocMem(_db.bh_heaprow_ptr_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FDb.bh_heaprow_ptr");
+        }
+        _db.bh_heaprow_ptr_elems = (atf_amc::FHeaprow**)new_mem;
+        _db.bh_heaprow_ptr_max = new_max;
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.Upheap
+// Find and return index of new location for heap element ELEM, starting at index IDX.
+// Move any elements along the way but do not store ELEM.
+static int atf_amc::bh_heaprow_ptr_Upheap(atf_amc::FHeaprow* elem, int idx) {
+    atf_amc::FHeaprow* *elems = _db.bh_heaprow_ptr_elems;
+    while (idx>0) {
+        int j = (idx-1)/8;
+        if (!bh_heaprow_ptr_HeapLt(elem, elems[j])) {
+            break;
+        }
+        elems[idx] = elems[j];
+        elems[idx]->bh_heaprow_ptr_idx = idx;
+        idx = j;
+    }
+    return idx;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.ElemLt
+inline static bool atf_amc::bh_heaprow_ptr_ElemLt(atf_amc::FHeaprow &a, atf_amc::FHeaprow &b) {
+    (void)_db;
+    return a.key < b.key;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.HeapLt
+// Compare two heap elements (dmmeta.bheap heaps only)
+inline static bool atf_amc::bh_heaprow_ptr_HeapLt(atf_amc::FHeaprow* a, atf_amc::FHeaprow* b) {
+    return bh_heaprow_ptr_ElemLt(*a, *b);
+}
+
+// --- atf_amc.FDb.magrow.Alloc
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FMagrow& atf_amc::magrow_Alloc() {
+    atf_amc::FMagrow* row = magrow_AllocMaybe();
+    if (UNLIKELY(row == NULL)) {
+        FatalErrorExit("atf_amc.out_of_mem  field:atf_amc.FDb.magrow  comment:'Alloc failed'");
+    }
+    return *row;
+}
+
+// --- atf_amc.FDb.magrow.AllocMaybe
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FMagrow* atf_amc::magrow_AllocMaybe() {
+    atf_amc::FMagrow *row = (atf_amc::FMagrow*)magrow_AllocMem();
+    if (row) {
+        new (row) atf_amc::FMagrow; // call constructor
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.magrow.Delete
+// Remove row from all global and cross indices, then deallocate row
+void atf_amc::magrow_Delete(atf_amc::FMagrow &row) {
+    row.~FMagrow();
+    magrow_FreeMem(row);
+}
+
+// --- atf_amc.FDb.magrow.AllocMem
+// Allocate space for one element
+// If no memory available, return NULL.
+// Thread-safe: element is taken from the calling thread's magazine.
+void* atf_amc::magrow_AllocMem() {
+    atf_amc::magrow_Tpmag &mag = atf_amc_magrow_tpmag;
+    atf_amc::FMagrow *row = mag.head;
+    if (LIKELY(row)) {
+        mag.head = row->magrow_next;
+        mag.n--;
+        mag.n_hit++;
+    } else {
+        row = magrow_Refill(mag);
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.magrow.Refill
+// Magazine MAG is empty: move up to 32 elements from the shared free list
+// into MAG, and return one more element (NULL if out of memory).
+static atf_amc::FMagrow* atf_amc::magrow_Refill(atf_amc::magrow_Tpmag &mag) {
+    atf_amc::FMagrow *row = NULL;
+    pthread_mutex_lock(&_db.magrow_lock);
+    _db.magrow_n_maghit += mag.n_hit;
+    mag.n_hit = 0;
+    _db.magrow_n_refill++;
+    for (int i = 0; i <= 32; i++) {
+        atf_amc::FMagrow *elem = _db.magrow_free;
+        if (UNLIKELY(!elem)) {
+            magrow_Reserve(1);
+            elem = _db.magrow_free;
+            if (!elem) {
+                break;
+            }
+        }
+        _db.magrow_free = elem->magrow_next;
+        if (row) {
+            elem->magrow_next = mag.head;
+            mag.head = elem;
+            mag.n++;
+        } else {
+            row = elem;
+        }
+    }
+    pthread_mutex_unlock(&_db.magrow_lock);
+    return row;
+}
+
+// --- atf_amc.FDb.magrow.FreeMem
+// Remove mem from all global and cross indices, then deallocate mem
+// Thread-safe: element goes to the calling thread's magazine.
+void atf_amc::magrow_FreeMem(atf_amc::FMagrow &row) {
+    if (UNLIKELY(row.magrow_next != (atf_amc::FMagrow*)-1)) {
+        FatalErrorExit("atf_amc.tpool_double_delete  pool:atf_amc.FDb.magrow  comment:'double deletion caught'");
+    }
+    atf_amc::magrow_Tpmag &mag = atf_amc_magrow_tpmag;
+    row.magrow_next = mag.head; // insert into magazine
+    mag.head = &row;
+    mag.n++;
+    if (UNLIKELY(mag.n > 64)) {
+        magrow_Spill(mag, 32);
+    }
+}
+
+// --- atf_amc.FDb.magrow.Spill
+// Move N elements from magazine MAG to the shared free list
+static void atf_amc::magrow_Spill(atf_amc::magrow_Tpmag &mag, int n) {
+    pthread_mutex_lock(&_db.magrow_lock);
+    _db.magrow_n_maghit += mag.n_hit;
+    mag.n_hit = 0;
+    _db.magrow_n_spill++;
+    for (; n > 0 && mag.head; n--) {
+        atf_amc::FMagrow *elem = mag.head;
+        mag.head = elem->magrow_next;
+        mag.n--;
+        elem->magrow_next = _db.magrow_free;
+        _db.magrow_free = elem;
+    }
+    pthread_mutex_unlock(&_db.magrow_lock);
+}
+
+// --- atf_amc.FDb.magrow.Reserve
+// Preallocate memory for N more elements
+// Return number of elements actually reserved.
+u64 atf_amc::magrow_Reserve(u64 n_elems) {
+    u64 ret = 0;
+    while (ret < n_elems) {
+        u64 size = _db.magrow_blocksize; // underlying allocator is probably Lpool
+        u64 reserved = magrow_ReserveMem(size);
+        ret += reserved;
+        if (reserved == 0) {
+            break;
+        }
+    }
+    return ret;
+}
+
+// --- atf_amc.FDb.magrow.ReserveMem
+// Allocate block of given size, break up into small elements and append to free list.
+// Return number of elements reserved.
+u64 atf_amc::magrow_ReserveMem(u64 size) {
+    u64 ret = 0;
+    if (size >= sizeof(atf_amc::FMagrow)) {
+        atf_amc::FMagrow *mem = (atf_amc::FMagrow*)algo_lib::malloc_AllocMem(size);
+        ret = mem ? size / sizeof(atf_amc::FMagrow) : 0;
+        // add newly allocated elements to the free list;
+        for (u64 i=0; i < ret; i++) {
+            mem[i].magrow_next = _db.magrow_free;
+            _db.magrow_free = mem+i;
+        }
+    }
+    return ret;
+}
+
+// --- atf_amc.FDb.magrow.FlushMag
+// Return elements cached by the calling thread to the shared free list
+// A thread should call this before exiting; otherwise its cached elements are lost.
+void atf_amc::magrow_FlushMag() {
+    atf_amc::magrow_Tpmag &mag = atf_amc_magrow_tpmag;
+    magrow_Spill(mag, mag.n);
+}
+
+// --- atf_amc.FDb.magrow.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool atf_amc::magrow_XrefMaybe(atf_amc::FMagrow &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- atf_amc.FDb.maglpool.FreeMem
+// Free block of memory previously returned by Lpool.
+// Thread-safe: small blocks go to the calling thread's magazine.
+void atf_amc::maglpool_FreeMem(void *mem, u64 size) {
+    if (mem) {
+        size = u64_Max(size,16); // enforce alignment
+        u64 cell = u64_BitScanReverse(size-1) + 1;
+        maglpool_Lpblock *temp = (maglpool_Lpblock*)mem;
+        if (cell <= 16) {
+            atf_amc::maglpool_Lpmag &mag = atf_amc_maglpool_lpmag;
+            temp->next = mag.head[cell];
+            mag.head[cell] = temp;
+            mag.n[cell]++;
+            if (UNLIKELY(mag.n[cell] > 32)) {
+                maglpool_Spill(mag, cell, 16);
+            }
+        } else {
+            pthread_mutex_lock(&_db.maglpool_lock);
+            maglpool_FreeShared(temp, cell);
+            pthread_mutex_unlock(&_db.maglpool_lock);
+        }
+    }
+}
+
+// --- atf_amc.FDb.maglpool.FreeShared
+// Push block onto shared free list for size class CELL. Caller holds the lock.
+static void atf_amc::maglpool_FreeShared(maglpool_Lpblock *blk, u64 cell) {
+    blk->next = _db.maglpool_free[cell];
+    _db.maglpool_free[cell] = blk;
+}
+
+// --- atf_amc.FDb.maglpool.Spill
+// Move N blocks of size class CELL from magazine MAG to the shared free list
+static void atf_amc::maglpool_Spill(atf_amc::maglpool_Lpmag &mag, u64 cell, int n) {
+    pthread_mutex_lock(&_db.maglpool_lock);
+    _db.maglpool_n_maghit += mag.n_hit;
+    mag.n_hit = 0;
+    _db.maglpool_n_spill++;
+    for (; n > 0 && mag.head[cell]; n--) {
+        maglpool_Lpblock *blk = mag.head[cell];
+        mag.head[cell] = blk->next;
+        mag.n[cell]--;
+        maglpool_FreeShared(blk, cell);
+    }
+    pthread_mutex_unlock(&_db.maglpool_lock);
+}
+
+// --- atf_amc.FDb.maglpool.AllocMem
+// Allocate new piece of memory at least SIZE bytes long.
+// If not successful, return NULL
+// The allocated block is 16-byte aligned
+// Thread-safe: small blocks come from the calling thread's magazine.
+void* atf_amc::maglpool_AllocMem(u64 size) {
+    size     = u64_Max(size,16); // enforce alignment
+    u64 cell = u64_BitScanReverse(size-1)+1;
+    u8 *retval = NULL;
+    if (cell <= 16) {
+        atf_amc::maglpool_Lpmag &mag = atf_amc_maglpool_lpmag;
+        maglpool_Lpblock *blk = mag.head[cell];
+        if (LIKELY(blk)) {
+            mag.head[cell] = blk->next;
+            mag.n[cell]--;
+            mag.n_hit++;
+            retval = (u8*)blk;
+        } else {
+            retval = maglpool_Refill(mag, cell);
+        }
+    } else {
+        pthread_mutex_lock(&_db.maglpool_lock);
+        retval = maglpool_AllocShared(cell);
+        pthread_mutex_unlock(&_db.maglpool_lock);
+    }
+    return retval;
+}
+
+// --- atf_amc.FDb.maglpool.AllocShared
+// Allocate block of size class CELL from the shared free lists. Caller holds the lock.
+static u8* atf_amc::maglpool_AllocShared(u64 cell) {
+    u64 i    = cell;
+    u8 *retval = NULL;
+    // try to find a block that's at least as large as required.
+    // if found, remove from free list
+    for (; i < 31; i++) {
+        maglpool_Lpblock *blk = _db.maglpool_free[i];
+        if (blk) {
+            _db.maglpool_free[i] = blk->next;
+            retval = (u8*)blk;
+            break;
+        }
+    }
+    // if suitable size block is not found, create a new one
+    // by requesting a block from the base allocator.
+    if (UNLIKELY(!retval)) {
+        i = u64_Max(cell, 21); // 2MB min -- allow huge page to be used
+        retval = (u8*)algo_lib::malloc_AllocMem(1<<i);
+    }
+    if (LIKELY(retval)) {
+        // if block is more than 2x as large as needed, return the upper half to the free
+        // list (repeatedly). meanwhile, retval doesn't change.
+        while (i > cell) {
+            i--;
+            int half = 1<<i;
+            maglpool_Lpblock *blk = (maglpool_Lpblock*)(retval + half);
+            blk->next = _db.maglpool_free[i];
+            _db.maglpool_free[i] = blk;
+        }
+    }
+    return retval;
+}
+
+// --- atf_amc.FDb.maglpool.Refill
+// Magazine MAG has no blocks of size class CELL: move up to 16 blocks
+// from the shared free lists into MAG, and return one more block (NULL if out of memory).
+static u8* atf_amc::maglpool_Refill(atf_amc::maglpool_Lpmag &mag, u64 cell) {
+    pthread_mutex_lock(&_db.maglpool_lock);
+    _db.maglpool_n_maghit += mag.n_hit;
+    mag.n_hit = 0;
+    _db.maglpool_n_refill++;
+    u8 *ret = maglpool_AllocShared(cell);
+    for (int i = 0; ret && i < 16; i++) {
+        maglpool_Lpblock *blk = (maglpool_Lpblock*)maglpool_AllocShared(cell);
+        if (!blk) {
+            break;
+        }
+        blk->next = mag.head[cell];
+        mag.head[cell] = blk;
+        mag.n[cell]++;
+    }
+    pthread_mutex_unlock(&_db.maglpool_lock);
+    return ret;
+}
+
+// --- atf_amc.FDb.maglpool.ReserveBuffers
+// Add N buffers of some size to the free store
+bool atf_amc::maglpool_ReserveBuffers(int nbuf, u64 bufsize) {
+    bool retval = true;
+    pthread_mutex_lock(&_db.maglpool_lock);
+    bufsize = u64_Max(bufsize, 16);
+    for (int i = 0; i < nbuf; i++) {
+        u64     cell = u64_BitScanReverse(bufsize-1)+1;
+        u64     size = 1ULL<<cell;
+        maglpool_Lpblock *temp = (maglpool_Lpblock*)algo_lib::malloc_AllocMem(size);
+        if (temp == NULL) {
+            retval = false;
+            break;// why continue?
+        } else {
+            temp->next = _db.maglpool_free[cell];
+            _db.maglpool_free[cell] = temp;
+        }
+    }
+    pthread_mutex_unlock(&_db.maglpool_lock);
+    return retval;
+}
+
+// --- atf_amc.FDb.maglpool.ReallocMem
+// Allocate new block, copy old to new, delete old.
+// New memory is always allocated (i.e. size reduction is not a no-op)
+// If no memory, return NULL: old memory untouched
+void* atf_amc::maglpool_ReallocMem(void *oldmem, u64 old_size, u64 new_size) {
+    void* ret = oldmem;
+    if (new_size != old_size) {
+        ret = maglpool_AllocMem(new_size);
+        if (ret) {
+            memcpy(ret,oldmem,u64_Min(new_size,old_size));
+            maglpool_FreeMem(oldmem, old_size);
+        }
+    }
+    return ret;
+}
+
+// --- atf_amc.FDb.maglpool.FlushMag
+// Return blocks cached by the calling thread to the shared free lists
+// A thread should call this before exiting; otherwise its cached blocks are lost.
+void atf_amc::maglpool_FlushMag() {
+    atf_amc::maglpool_Lpmag &mag = atf_amc_maglpool_lpmag;
+    for (u64 cell = 0; cell <= 16; cell++) {
+        if (mag.n[cell] > 0) {
+            maglpool_Spill(mag, cell, mag.n[cell]);
+        }
+    }
+}
+
+// --- atf_amc.FDb.hugerow.Alloc
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FHugerow& atf_amc::hugerow_Alloc() {
+    atf_amc::FHugerow* row = hugerow_AllocMaybe();
+    if (UNLIKELY(row == NULL)) {
+        FatalErrorExit("atf_amc.out_of_mem  field:atf_amc.FDb.hugerow  comment:'Alloc failed'");
+    }
+    return *row;
+}
+
+// --- atf_amc.FDb.hugerow.AllocMaybe
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FHugerow* atf_amc::hugerow_AllocMaybe() {
+    atf_amc::FHugerow *row = (atf_amc::FHugerow*)hugerow_AllocMem();
+    if (row) {
+        new (row) atf_amc::FHugerow; // call constructor
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.hugerow.AllocMem
+// Allocate space for one element. If no memory available, return NULL.
+void* atf_amc::hugerow_AllocMem() {
+    u64 new_nelems     = _db.hugerow_n+1;
+    // compute level and index on level
+    u64 bsr   = algo::u64_BitScanReverse(new_nelems);
+    u64 base  = u64(1)<<bsr;
+    u64 index = new_nelems-base;
+    void *ret = NULL;
+    // if level doesn't exist yet, create it
+    atf_amc::FHugerow*  lev   = NULL;
+    if (bsr < 32) {
+        lev = _db.hugerow_lary[bsr];
+        if (!lev) {
+            lev=(atf_amc::FHugerow*)algo_lib::sbrk_AllocMem(sizeof(atf_amc::FHugerow) * (u64(1)<<bsr));
+            _db.hugerow_lary[bsr] = lev;
+        }
+    }
+    // allocate element from this level
+    if (lev) {
+        _db.hugerow_n = new_nelems;
+        ret = lev + index;
+    }
+    return ret;
+}
+
+// --- atf_amc.FDb.hugerow.RemoveAll
+// Remove all elements from Lary
+void atf_amc::hugerow_RemoveAll() {
+    for (u64 n = _db.hugerow_n; n>0; ) {
+        n--;
+        hugerow_qFind(u64(n)).~FHugerow(); // destroy last element
+        _db.hugerow_n = n;
+    }
+}
+
+// --- atf_amc.FDb.hugerow.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_amc::hugerow_RemoveLast() {
+    u64 n = _db.hugerow_n;
+    if (n > 0) {
+        n -= 1;
+        hugerow_qFind(u64(n)).~FHugerow();
+        _db.hugerow_n = n;
+    }
+}
+
+// --- atf_amc.FDb.hugerow.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool atf_amc::hugerow_XrefMaybe(atf_amc::FHugerow &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- atf_amc.FDb.ind_hugerow.Find
+// Find row by key. Return NULL if not found.
+atf_amc::FHugerow* atf_amc::ind_hugerow_Find(u64 key) {
+    u32 hash  = u64_Hash(0, key);
+    u32 index = hash & (_db.ind_hugerow_buckets_n - 1);
+    atf_amc::FHugerow* *e = &_db.ind_hugerow_buckets_elems[index];
+    atf_amc::FHugerow* ret=NULL;
+    do {
+        ret       = *e;
+        bool done = !ret || (*ret).key == key;
+        if (done) break;
+        e         = &ret->ind_hugerow_next;
+    } while (true);
+    return ret;
+}
+
+// --- atf_amc.FDb.ind_hugerow.GetOrCreate
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHugerow& atf_amc::ind_hugerow_GetOrCreate(u64 key) {
+    atf_amc::FHugerow* ret = ind_hugerow_Find(key);
+    if (!ret) { //  if memory alloc fails, process dies; if insert fails, function returns NULL.
+        ret         = &hugerow_Alloc();
+        (*ret).key = key;
+        bool good = hugerow_XrefMaybe(*ret);
+        if (!good) {
+            hugerow_RemoveLast(); // delete offending row, any existing xrefs are cleared
+            ret = NULL;
+        }
+    }
+    return *ret;
+}
+
+// --- atf_amc.FDb.ind_hugerow.InsertMaybe
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool atf_amc::ind_hugerow_InsertMaybe(atf_amc::FHugerow& row) {
+    ind_hugerow_Reserve(1);
+    bool retval = true; // if already in hash, InsertMaybe returns true
+    if (LIKELY(row.ind_hugerow_next == (atf_amc::FHugerow*)-1)) {// check if in hash already
+        u32 hash  = u64_Hash(0, row.key);
+        u32 index = hash & (_db.ind_hugerow_buckets_n - 1);
+        atf_amc::FHugerow* *prev = &_db.ind_hugerow_buckets_elems[index];
+        do {
+            atf_amc::FHugerow* ret = *prev;
+            if (!ret) { // exit condition 1: reached the end of the list
+                break;
+            }
+            if ((*ret).key == row.key) { // exit condition 2: found matching key
+                retval = false;
+                break;
+            }
+            prev = &ret->ind_hugerow_next;
+        } while (true);
+        if (retval) {
+            row.ind_hugerow_next = *prev;
+            _db.ind_hugerow_n++;
+            *prev = &row;
+        }
+    }
+    return retval;
+}
+
+// --- atf_amc.FDb.ind_hugerow.Remove
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void atf_amc::ind_hugerow_Remove(atf_amc::FHugerow& row) {
+    if (LIKELY(row.ind_hugerow_next != (atf_amc::FHugerow*)-1)) {// check if in hash already
+        u32 hash  = u64_Hash(0, row.key);
+        u32 index = hash & (_db.ind_hugerow_buckets_n - 1);
+        atf_amc::FHugerow* *prev = &_db.ind_hugerow_buckets_elems[index]; // addr of pointer to current element
+        while (atf_amc::FHugerow *next = *prev) {                          // scan the collision chain for our element
+            if (next == &row) {        // found it?
+                *prev = next->ind_hugerow_next; // unlink (singly linked list)
+                _db.ind_hugerow_n--;
+                row.ind_hugerow_next = (atf_amc::FHugerow*)-1;// not-in-hash
+                break;
+            }
+            prev = &next->ind_hugerow_next;
+        }
+    }
+}
+
+// --- atf_amc.FDb.ind_hugerow.Reserve
+// Reserve enough room in the hash for N more elements. Return success code.
+void atf_amc::ind_hugerow_Reserve(int n) {
+    u32 old_nbuckets = _db.ind_hugerow_buckets_n;
+    u32 new_nelems   = _db.ind_hugerow_n + n;
+    // # of elements has to be roughly equal to the number of buckets
+    if (new_nelems > old_nbuckets) {
+        int new_nbuckets = i32_Max(BumpToPow2(new_nelems), u32(4));
+        u32 old_size = old_nbuckets * sizeof(atf_amc::FHugerow*);
+        u32 new_size = new_nbuckets * sizeof(atf_amc::FHugerow*);
+        // allocate new array. we don't use Realloc since copying is not needed and factor of 2 probably
+        // means new memory will have to be allocated anyway
+        atf_amc::FHugerow* *new_buckets = (atf_amc::FHugerow**)algo_lib::sbrk_AllocMem(new_size);
+        if (UNLIKELY(!new_buckets)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FDb.ind_hugerow");
+        }
+        memset(new_buckets, 0, new_size); // clear pointers
+        // rehash all entries
+        for (int i = 0; i < _db.ind_hugerow_buckets_n; i++) {
+            atf_amc::FHugerow* elem = _db.ind_hugerow_buckets_elems[i];
+            while (elem) {
+                atf_amc::FHugerow &row        = *elem;
+                atf_amc::FHugerow* next       = row.ind_hugerow_next;
+                u32 index          = u64_Hash(0, row.key) & (new_nbuckets-1);
+                row.ind_hugerow_next     = new_buckets[index];
+                new_buckets[index] = &row;
+                elem               = next;
+            }
+        }
+        // free old array
+        algo_lib::sbrk_FreeMem(_db.ind_hugerow_buckets_elems, old_size);
+        _db.ind_hugerow_buckets_elems = new_buckets;
+        _db.ind_hugerow_buckets_n = new_nbuckets;
+    }
+}
+
+// --- atf_amc.FDb.ind_hugerow_thp.Find
+// Find row by key. Return NULL if not found.
+atf_amc::FHugerow* atf_amc::ind_hugerow_thp_Find(u64 key) {
+    u32 hash  = u64_Hash(0, key);
+    u32 index = hash & (_db.ind_hugerow_thp_buckets_n - 1);
+    atf_amc::FHugerow* *e = &_db.ind_hugerow_thp_buckets_elems[index];
+    atf_amc::FHugerow* ret=NULL;
+    do {
+        ret       = *e;
+        bool done = !ret || (*ret).key == key;
+        if (done) break;
+        e         = &ret->ind_hugerow_thp_next;
+    } while (true);
+    return ret;
+}
+
+// --- atf_amc.FDb.ind_hugerow_thp.GetOrCreate
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHugerow& atf_amc::ind_hugerow_thp_GetOrCreate(u64 key) {
+    atf_amc::FHugerow* ret = ind_hugerow_thp_Find(key);
+    if (!ret) { //  if memory alloc fails, process dies; if insert fails, function returns NULL.
+        ret         = &hugerow_Alloc();
+        (*ret).key = key;
+        bool good = hugerow_XrefMaybe(*ret);
+        if (!good) {
+            hugerow_RemoveLast(); // delete offending row, any existing xrefs are cleared
+            ret = NULL;
+        }
+    }
+    return *ret;
+}
+
+// --- atf_amc.FDb.ind_hugerow_thp.InsertMaybe
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool atf_amc::ind_hugerow_thp_InsertMaybe(atf_amc::FHugerow& row) {
+    ind_hugerow_thp_Reserve(1);
+    bool retval = true; // if already in hash, InsertMaybe returns true
+    if (LIKELY(row.ind_hugerow_thp_next == (atf_amc::FHugerow*)-1)) {// check if in hash already
+        u32 hash  = u64_Hash(0, row.key);
+        u32 index = hash & (_db.ind_hugerow_thp_buckets_n - 1);
+        atf_amc::FHugerow* *prev = &_db.ind_hugerow_thp_buckets_elems[index];
+        do {
+            atf_amc::FHugerow* ret = *prev;
+            if (!ret) { // exit condition 1: reached the end of the list
+                break;
+            }
+            if ((*ret).key == row.key) { // exit condition 2: found matching key
+                retval = false;
+                break;
+            }
+            prev = &ret->ind_hugerow_thp_next;
+        } while (true);
+        if (retval) {
+            row.ind_hugerow_thp_next = *prev;
+            _db.ind_hugerow_thp_n++;
+            *prev = &row;
+        }
+    }
+    return retval;
+}
+
+// --- atf_amc.FDb.ind_hugerow_thp.Remove
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void atf_amc::ind_hugerow_thp_Remove(atf_amc::FHugerow& row) {
+    if (LIKELY(row.ind_hugerow_thp_next != (atf_amc::FHugerow*)-1)) {// check if in hash already
+        u32 hash  = u64_Hash(0, row.key);
+        u32 index = hash & (_db.ind_hugerow_thp_buckets_n - 1);
+        atf_amc::FHugerow* *prev = &_db.ind_hugerow_thp_buckets_elems[index]; // addr of pointer to current element
+        while (atf_amc::FHugerow *next = *prev) {                          // scan the collision chain for our element
+            if (next == &row) {        // found it?
+                *prev = next->ind_hugerow_thp_next; // unlink (singly linked list)
+                _db.ind_hugerow_thp_n--;
+                row.ind_hugerow_thp_next = (atf_amc::FHugerow*)-1;// not-in-hash
+                break;
+            }
+            prev = &next->ind_hugerow_thp_next;
+        }
+    }
+}
+
+// --- atf_amc.FDb.ind_hugerow_thp.Reserve
+// Reserve enough room in the hash for N more elements. Return success code.
+void atf_amc::ind_hugerow_thp_Reserve(int n) {
+    u32 old_nbuckets = _db.ind_hugerow_thp_buckets_n;
+    u32 new_nelems   = _db.ind_hugerow_thp_n + n;
+    // # of elements has to be roughly equal to the number of buckets
+    if (new_nelems > old_nbuckets) {
+        int new_nbuckets = i32_Max(BumpToPow2(new_nelems), u32(4));
+        u32 old_size = old_nbuckets * sizeof(atf_amc::FHugerow*);
+        u32 new_size = new_nbuckets * sizeof(atf_amc::FHugerow*);
+        // allocate new array. we don't use Realloc since copying is not needed and factor of 2 probably
+        // means new memory will have to be allocated anyway
+        atf_amc::FHugerow* *new_buckets = (atf_amc::FHugerow**)algo_lib::sbrk_AllocMem(new_size);
+        if (UNLIKELY(!new_buckets)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FDb.ind_hugerow_thp");
+        }
+        memset(new_buckets, 0, new_size); // clear pointers
+        // rehash all entries
+        for (int i = 0; i < _db.ind_hugerow_thp_buckets_n; i++) {
+            atf_amc::FHugerow* elem = _db.ind_hugerow_thp_buckets_elems[i];
+            while (elem) {
+                atf_amc::FHugerow &row        = *elem;
+                atf_amc::FHugerow* next       = row.ind_hugerow_thp_next;
+                u32 index          = u64_Hash(0, row.key) & (new_nbuckets-1);
+                row.ind_hugerow_thp_next     = new_buckets[index];
+                new_buckets[index] = &row;
+                elem               = next;
+            }
+        }
+        // free old array
+        algo_lib::sbrk_FreeMem(_db.ind_hugerow_thp_buckets_elems, old_size);
+        _db.ind_hugerow_thp_buckets_elems = new_buckets;
+        _db.ind_hugerow_thp_buckets_n = new_nbuckets;
+    }
+}
+
+// --- atf_amc.FDb.trace.RowidFind
+// find trace by row id (used to implement reflection)
+static algo::ImrowPtr atf_amc::trace_RowidFind(int t) {
+    return algo::ImrowPtr(t==0 ? u64(&_db.trace) : u64(0));
+}
+
+// --- atf_amc.FDb.trace.N
+// Function return 1
+inline static i32 atf_amc::trace_N() {
+    return 1;
+}
+
+// --- atf_amc.FDb.bh_typec_curs.Add
+static void atf_amc::_db_bh_typec_curs_Add(_db_bh_typec_curs &curs, atf_amc::FTypeC& row) {
+    u32 n = curs.temp_n;
+    int i = n;
+    curs.temp_n = n+1;
+    atf_amc::FTypeC* *elems = curs.temp_elems;
+    while (i>0) {
+        int j = (i-1)/2;
+        atf_amc::FTypeC* p = elems[j];
+        if (!bh_typec_ElemLt(row,*p)) {
+            break;
+        }
+        elems[i]=p;
+        i=j;
+    }
+    elems[i]=&row;
+}
+
+// --- atf_amc.FDb.bh_typec_curs.Reserve
+void atf_amc::_db_bh_typec_curs_Reserve(_db_bh_typec_curs &curs, int n) {
+    if (n > curs.temp_max) {
+        size_t old_size   = sizeof(void*) * curs.temp_max;
+        size_t new_size   = sizeof(void*) * bh_typec_N();
+        curs.temp_elems   = (atf_amc::FTypeC**)algo_lib::malloc_ReallocMem(curs.temp_elems, old_size, new_size);
+        if (!curs.temp_elems) {
+            algo::FatalErrorExit("atf_amc.cursor_out_of_memory  func:atf_amc.FDb.bh_typec_curs.Reserve");
+        }
+        curs.temp_max       = bh_typec_N();
+    }
+}
+
+// --- atf_amc.FDb.bh_typec_curs.Reset
+// Reset cursor. If HEAP is non-empty, add its top element to CURS.
+void atf_amc::_db_bh_typec_curs_Reset(_db_bh_typec_curs &curs, atf_amc::FDb &parent) {
+    curs.parent       = &parent;
+    _db_bh_typec_curs_Reserve(curs, bh_typec_N());
+    curs.temp_n = 0;
+    if (parent.bh_typec_n > 0) {
+        atf_amc::FTypeC &first = *parent.bh_typec_elems[0];
+        curs.temp_elems[0] = &first; // insert first element in heap
+        curs.temp_n = 1;
+    }
+}
+
+// --- atf_amc.FDb.bh_typec_curs.Next
+// Advance cursor.
+void atf_amc::_db_bh_typec_curs_Next(_db_bh_typec_curs &curs) {
+    atf_amc::FTypeC* *elems = curs.temp_elems;
+    int n = curs.temp_n;
+    if (n > 0) {
+        // remove top element from heap
+        atf_amc::FTypeC* dead = elems[0];
+        int i       = 0;
+        atf_amc::FTypeC* last = curs.temp_elems[n-1];
+        // downheap last elem
+        do {
+            atf_amc::FTypeC* choose = last;
+            int l         = i*2+1;
+            if (l<n) {
+                atf_amc::FTypeC* el = elems[l];
+                int r     = l+1;
+                r        -= r==n;
+                atf_amc::FTypeC* er = elems[r];
+                if (bh_typec_ElemLt(*er,*el)) {
+                    el  = er;
+                    l   = r;
+                }
+                bool b = bh_typec_ElemLt(*el,*last);
+                if (b) choose = el;
+                if (!b) l = n;
+            }
+            elems[i] = choose;
+            i = l;
+        } while (i < n);
+        curs.temp_n = n-1;
+        int index = dead->bh_typec_idx;
+        i = (index*2+1);
+        if (i < bh_typec_N()) {
+            atf_amc::FTypeC &elem = *curs.parent->bh_typec_elems[i];
+            _db_bh_typec_curs_Add(curs, elem);
+        }
+        if (i+1 < bh_typec_N()) {
+            atf_amc::FTypeC &elem = *curs.parent->bh_typec_elems[i + 1];
+            _db_bh_typec_curs_Add(curs, elem);
+        }
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_curs.Reset
+void atf_amc::_db_ind_hashrow_curs_Reset(_db_ind_hashrow_curs &curs, atf_amc::FDb &parent) {
+    curs.bucket = 0;
+    curs.parent = &parent;
+    curs.prow = &parent.ind_hashrow_buckets_elems[0]; // hash never has zero buckets
+    while (!*curs.prow) {
+        curs.bucket += 1;
+        if (curs.bucket == parent.ind_hashrow_buckets_n) break;
+        curs.prow = &parent.ind_hashrow_buckets_elems[curs.bucket];
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_oa_curs.Reset
+void atf_amc::_db_ind_hashrow_oa_curs_Reset(_db_ind_hashrow_oa_curs &curs, atf_amc::FDb &parent) {
+    curs.index = 0;
+    curs.parent = &parent;
+    while (curs.index < parent.ind_hashrow_oa_slots_n && !parent.ind_hashrow_oa_slots_elems[curs.index].row) {
+        curs.index += 1;
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_incr_curs.Reset
+void atf_amc::_db_ind_hashrow_incr_curs_Reset(_db_ind_hashrow_incr_curs &curs, atf_amc::FDb &parent) {
+    curs.bucket = 0;
+    curs.parent = &parent;
+    curs.prow = &parent.ind_hashrow_incr_buckets_elems[0]; // hash never has zero buckets
+    while (!*curs.prow) {
+        curs.bucket += 1;
+        if (curs.bucket == parent.ind_hashrow_incr_buckets_n + parent.ind_hashrow_incr_old_n) break;
+        curs.prow = curs.bucket < parent.ind_hashrow_incr_buckets_n ? &parent.ind_hashrow_incr_buckets_elems[curs.bucket] : &parent.ind_hashrow_incr_old_elems[curs.bucket - parent.ind_hashrow_incr_buckets_n];
+    }
+}
+
+// --- atf_amc.FDb.bt_treerow_curs.Seek
+// position cursor at the first row with key >= VAL
+void atf_amc::_db_bt_treerow_curs_Seek(_db_bt_treerow_curs &curs, atf_amc::FDb& parent, u64 val) {
+    curs.node = bt_treerow_FindLeaf(val, curs.index);
+    (void)parent;//only to avoid -Wunused-parameter
+}
+
+// --- atf_amc.FDb.bt_treerow_rcurs.Seek
+// position cursor at the last row with key < VAL
+void atf_amc::_db_bt_treerow_rcurs_Seek(_db_bt_treerow_rcurs &curs, atf_amc::FDb& parent, u64 val) {
+    curs.node = bt_treerow_FindLeaf(val, curs.index);
+    if (!curs.node) {
+        _db_bt_treerow_rcurs_Reset(curs, parent);
+    } else if (curs.index > 0) {
+        curs.index--;
+    } else {
+        curs.node  = curs.node->prev;
+        curs.index = curs.node ? curs.node->n - 1 : 0;
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_curs.Add
+static void atf_amc::_db_bh_heaprow_curs_Add(_db_bh_heaprow_curs &curs, atf_amc::FHeaprow& row) {
+    u32 n = curs.temp_n;
+    int i = n;
+    curs.temp_n = n+1;
+    atf_amc::FHeaprow* *elems = curs.temp_elems;
+    while (i>0) {
+        int j = (i-1)/2;
+        atf_amc::FHeaprow* p = elems[j];
+        if (!bh_heaprow_ElemLt(row,*p)) {
+            break;
+        }
+        elems[i]=p;
+        i=j;
+    }
+    elems[i]=&row;
+}
+
+// --- atf_amc.FDb.bh_heaprow_curs.Reserve
+void atf_amc::_db_bh_heaprow_curs_Reserve(_db_bh_heaprow_curs &curs, int n) {
+    if (n > curs.temp_max) {
+        size_t old_size   = sizeof(void*) * curs.temp_max;
+        size_t new_size   = sizeof(void*) * bh_heaprow_N();
+        curs.temp_elems   = (atf_amc::FHeaprow**)algo_lib::malloc_ReallocMem(curs.temp_elems, old_size, new_size);
+        if (!curs.temp_elems) {
+            algo::FatalErrorExit("atf_amc.cursor_out_of_memory  func:atf_amc.FDb.bh_heaprow_curs.Reserve");
+        }
+        curs.temp_max       = bh_heaprow_N();
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_curs.Reset
+// Reset cursor. If HEAP is non-empty, add its top element to CURS.
+void atf_amc::_db_bh_heaprow_curs_Reset(_db_bh_heaprow_curs &curs, atf_amc::FDb &parent) {
+    curs.parent       = &parent;
+    _db_bh_heaprow_curs_Reserve(curs, bh_heaprow_N());
+    curs.temp_n = 0;
+    if (parent.bh_heaprow_n > 0) {
+        atf_amc::FHeaprow &first = *parent.bh_heaprow_elems[0];
+        curs.temp_elems[0] = &first; // insert first element in heap
+        curs.temp_n = 1;
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_curs.Next
+// Advance cursor.
+void atf_amc::_db_bh_heaprow_curs_Next(_db_bh_heaprow_curs &curs) {
+    atf_amc::FHeaprow* *elems = curs.temp_elems;
+    int n = curs.temp_n;
+    if (n > 0) {
+        // remove top element from heap
+        atf_amc::FHeaprow* dead = elems[0];
+        int i       = 0;
+        atf_amc::FHeaprow* last = curs.temp_elems[n-1];
+        // downheap last elem
+        do {
+            atf_amc::FHeaprow* choose = last;
+            int l         = i*2+1;
+            if (l<n) {
+                atf_amc::FHeaprow* el = elems[l];
+                int r     = l+1;
+                r        -= r==n;
+                atf_amc::FHeaprow* er = elems[r];
+                if (bh_heaprow_ElemLt(*er,*el)) {
+                    el  = er;
+                    l   = r;
+                }
+                bool b = bh_heaprow_ElemLt(*el,*last);
+                if (b) choose = el;
+                if (!b) l = n;
+            }
+            elems[i] = choose;
+            i = l;
+        } while (i < n);
+        curs.temp_n = n-1;
+        int index = dead->bh_heaprow_idx;
+        i = (index*2+1);
+        if (i < bh_heaprow_N()) {
+            atf_amc::FHeaprow &elem = *curs.parent->bh_heaprow_elems[i];
+            _db_bh_heaprow_curs_Add(curs, elem);
+        }
+        if (i+1 < bh_heaprow_N()) {
+            atf_amc::FHeaprow &elem = *curs.parent->bh_heaprow_elems[i + 1];
+            _db_bh_heaprow_curs_Add(curs, elem);
+        }
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl_curs.Add
+static void atf_amc::_db_bh_heaprow_inl_curs_Add(_db_bh_heaprow_inl_curs &curs, atf_amc::FHeaprow& row) {
+    u32 n = curs.temp_n;
+    int i = n;
+    curs.temp_n = n+1;
+    atf_amc::FHeaprow* *elems = curs.temp_elems;
+    while (i>0) {
+        int j = (i-1)/2;
+        atf_amc::FHeaprow* p = elems[j];
+        if (!bh_heaprow_inl_ElemLt(row,*p)) {
+            break;
+        }
+        elems[i]=p;
+        i=j;
+    }
+    elems[i]=&row;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl_curs.Reserve
+void atf_amc::_db_bh_heaprow_inl_curs_Reserve(_db_bh_heaprow_inl_curs &curs, int n) {
+    if (n > curs.temp_max) {
+        size_t old_size   = sizeof(void*) * curs.temp_max;
+        size_t new_size   = sizeof(void*) * bh_heaprow_inl_N();
+        curs.temp_elems   = (atf_amc::FHeaprow**)algo_lib::malloc_ReallocMem(curs.temp_elems, old_size, new_size);
+        if (!curs.temp_elems) {
+            algo::FatalErrorExit("atf_amc.cursor_out_of_memory  func:atf_amc.FDb.bh_heaprow_inl_curs.Reserve");
+        }
+        curs.temp_max       = bh_heaprow_inl_N();
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl_curs.Reset
+// Reset cursor. If HEAP is non-empty, add its top element to CURS.
+void atf_amc::_db_bh_heaprow_inl_curs_Reset(_db_bh_heaprow_inl_curs &curs, atf_amc::FDb &parent) {
+    curs.parent       = &parent;
+    _db_bh_heaprow_inl_curs_Reserve(curs, bh_heaprow_inl_N());
+    curs.temp_n = 0;
+    if (parent.bh_heaprow_inl_n > 0) {
+        atf_amc::FHeaprow &first = *parent.bh_heaprow_inl_elems[0].row;
+        curs.temp_elems[0] = &first; // insert first element in heap
+        curs.temp_n = 1;
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl_curs.Next
+// Advance cursor.
+void atf_amc::_db_bh_heaprow_inl_curs_Next(_db_bh_heaprow_inl_curs &curs) {
+    atf_amc::FHeaprow* *elems = curs.temp_elems;
+    int n = curs.temp_n;
+    if (n > 0) {
+        // remove top element from heap
+        atf_amc::FHeaprow* dead = elems[0];
+        int i       = 0;
+        atf_amc::FHeaprow* last = curs.temp_elems[n-1];
+        // downheap last elem
+        do {
+            atf_amc::FHeaprow* choose = last;
+            int l         = i*2+1;
+            if (l<n) {
+                atf_amc::FHeaprow* el = elems[l];
+                int r     = l+1;
+                r        -= r==n;
+                atf_amc::FHeaprow* er = elems[r];
+                if (bh_heaprow_inl_ElemLt(*er,*el)) {
+                    el  = er;
+                    l   = r;
+                }
+                bool b = bh_heaprow_inl_ElemLt(*el,*last);
+                if (b) choose = el;
+                if (!b) l = n;
+            }
+            elems[i] = choose;
+            i = l;
+        } while (i < n);
+        curs.temp_n = n-1;
+        int index = dead->bh_heaprow_inl_idx;
+        i = (index*4+1);
+        int lim = i+4 < bh_heaprow_inl_N() ? i+4 : bh_heaprow_inl_N();
+        for (; i < lim; i++) {
+            atf_amc::FHeaprow &elem = *curs.parent->bh_heaprow_inl_elems[i].row;
+            _db_bh_heaprow_inl_curs_Add(curs, elem);
+        }
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr_curs.Add
+static void atf_amc::_db_bh_heaprow_ptr_curs_Add(_db_bh_heaprow_ptr_curs &curs, atf_amc::FHeaprow& row) {
+    u32 n = curs.temp_n;
+    int i = n;
+    curs.temp_n = n+1;
+    atf_amc::FHeaprow* *elems = curs.temp_elems;
+    while (i>0) {
+        int j = (i-1)/2;
+        atf_amc::FHeaprow* p = elems[j];
+        if (!bh_heaprow_ptr_ElemLt(row,*p)) {
+            break;
+        }
+        elems[i]=p;
+        i=j;
+    }
+    elems[i]=&row;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr_curs.Reserve
+void atf_amc::_db_bh_heaprow_ptr_curs_Reserve(_db_bh_heaprow_ptr_curs &curs, int n) {
+    if (n > curs.temp_max) {
+        size_t old_size   = sizeof(void*) * curs.temp_max;
+        size_t new_size   = sizeof(void*) * bh_heaprow_ptr_N();
+        curs.temp_elems   = (atf_amc::FHeaprow**)algo_lib::malloc_ReallocMem(curs.temp_elems, old_size, new_size);
+        if (!curs.temp_elems) {
+            algo::FatalErrorExit("atf_amc.cursor_out_of_memory  func:atf_amc.FDb.bh_heaprow_ptr_curs.Reserve");
+        }
+        curs.temp_max       = bh_heaprow_ptr_N();
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr_curs.Reset
+// Reset cursor. If HEAP is non-empty, add its top element to CURS.
+void atf_amc::_db_bh_heaprow_ptr_curs_Reset(_db_bh_heaprow_ptr_curs &curs, atf_amc::FDb &parent) {
+    curs.parent       = &parent;
+    _db_bh_heaprow_ptr_curs_Reserve(curs, bh_heaprow_ptr_N());
+    curs.temp_n = 0;
+    if (parent.bh_heaprow_ptr_n > 0) {
+        atf_amc::FHeaprow &first = *parent.bh_heaprow_ptr_elems[0];
+        curs.temp_elems[0] = &first; // insert first element in heap
+        curs.temp_n = 1;
+    }
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr_curs.Next
+// Advance cursor.
+void atf_amc::_db_bh_heaprow_ptr_curs_Next(_db_bh_heaprow_ptr_curs &curs) {
+    atf_amc::FHeaprow* *elems = curs.temp_elems;
+    int n = curs.temp_n;
+    if (n > 0) {
+        // remove top element from heap
+        atf_amc::FHeaprow* dead = elems[0];
+        int i       = 0;
+        atf_amc::FHeaprow* last = curs.temp_elems[n-1];
+        // downheap last elem
+        do {
+            atf_amc::FHeaprow* choose = last;
+            int l         = i*2+1;
+            if (l<n) {
+                atf_amc::FHeaprow* el = elems[l];
+                int r     = l+1;
+                r        -= r==n;
+                atf_amc::FHeaprow* er = elems[r];
+                if (bh_heaprow_ptr_ElemLt(*er,*el)) {
+                    el  = er;
+                    l   = r;
+                }
+                bool b = bh_heaprow_ptr_ElemLt(*el,*last);
+                if (b) choose = el;
+                if (!b) l = n;
+            }
+            elems[i] = choose;
+            i = l;
+        } while (i < n);
+        curs.temp_n = n-1;
+        int index = dead->bh_heaprow_ptr_idx;
+        i = (index*8+1);
+        int lim = i+8 < bh_heaprow_ptr_N() ? i+8 : bh_heaprow_ptr_N();
+        for (; i < lim; i++) {
+            atf_amc::FHeaprow &elem = *curs.parent->bh_heaprow_ptr_elems[i];
+            _db_bh_heaprow_ptr_curs_Add(curs, elem);
+        }
+    }
+}
+
+// --- atf_amc.FDb..Init
+// Set all fields to initial values.
+void atf_amc::FDb_Init() {
+    _db.bh_typec_max   	= 0; // (atf_amc.FDb.bh_typec)
+    _db.bh_typec_n     	= 0; // (atf_amc.FDb.bh_typec)
+    _db.bh_typec_elems 	= NULL; // (atf_amc.FDb.bh_typec)
     _db.zdl_h_typec_head = NULL; // (atf_amc.FDb.zdl_h_typec)
     _db.zdl_h_typec_n = 0; // (atf_amc.FDb.zdl_h_typec)
     _db.zdl_h_typec_tail = NULL; // (atf_amc.FDb.zdl_h_typec)
@@ -6154,1450 +9559,2364 @@ void atf_amc::FDb_Init() {
         FatalErrorExit("out of memory");
     }
     for (int i = 0; i < 4; i++) {
-        _db.typea_lary[i]  = typea_first;
-        typea_first    += 1ULL<<i;
+        _db.typea_lary[i]  = typea_first;
+        typea_first    += 1ULL<<i;
+    }
+    // initialize LAry types (atf_amc.FDb.types)
+    _db.types_n = 0;
+    memset(_db.types_lary, 0, sizeof(_db.types_lary)); // zero out all level pointers
+    atf_amc::FTypeS* types_first = (atf_amc::FTypeS*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FTypeS) * (u64(1)<<4));
+    if (!types_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.types_lary[i]  = types_first;
+        types_first    += 1ULL<<i;
+    }
+    // initialize hash table for atf_amc::FTypeS;
+    _db.ind_types_n             	= 0; // (atf_amc.FDb.ind_types)
+    _db.ind_types_buckets_n     	= 4; // (atf_amc.FDb.ind_types)
+    _db.ind_types_buckets_elems 	= (atf_amc::FTypeS**)algo_lib::malloc_AllocMem(sizeof(atf_amc::FTypeS*)*_db.ind_types_buckets_n); // initial buckets (atf_amc.FDb.ind_types)
+    if (!_db.ind_types_buckets_elems) {
+        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_types)
+    }
+    memset(_db.ind_types_buckets_elems, 0, sizeof(atf_amc::FTypeS*)*_db.ind_types_buckets_n); // (atf_amc.FDb.ind_types)
+    // initialize hash table for atf_amc::FTypeA;
+    _db.ind_typea_n             	= 0; // (atf_amc.FDb.ind_typea)
+    _db.ind_typea_buckets_n     	= 4; // (atf_amc.FDb.ind_typea)
+    _db.ind_typea_buckets_elems 	= (atf_amc::FTypeA**)algo_lib::malloc_AllocMem(sizeof(atf_amc::FTypeA*)*_db.ind_typea_buckets_n); // initial buckets (atf_amc.FDb.ind_typea)
+    if (!_db.ind_typea_buckets_elems) {
+        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_typea)
+    }
+    memset(_db.ind_typea_buckets_elems, 0, sizeof(atf_amc::FTypeA*)*_db.ind_typea_buckets_n); // (atf_amc.FDb.ind_typea)
+    _db.cs_h_count = i32(0);
+    _db.cs_t_count = i32(0);
+    _db.zs_h_count = i32(0);
+    _db.zs_t_count = i32(0);
+    _db.zs_mt_count = i32(0);
+    _db.bh_count = i32(0);
+    // initialize LAry typet (atf_amc.FDb.typet)
+    _db.typet_n = 0;
+    memset(_db.typet_lary, 0, sizeof(_db.typet_lary)); // zero out all level pointers
+    atf_amc::FTypeT* typet_first = (atf_amc::FTypeT*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FTypeT) * (u64(1)<<4));
+    if (!typet_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.typet_lary[i]  = typet_first;
+        typet_first    += 1ULL<<i;
+    }
+    // initialize LAry cstring (atf_amc.FDb.cstring)
+    _db.cstring_n = 0;
+    memset(_db.cstring_lary, 0, sizeof(_db.cstring_lary)); // zero out all level pointers
+    atf_amc::FCstring* cstring_first = (atf_amc::FCstring*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FCstring) * (u64(1)<<4));
+    if (!cstring_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.cstring_lary[i]  = cstring_first;
+        cstring_first    += 1ULL<<i;
+    }
+    // initialize hash table for atf_amc::FCstring;
+    _db.ind_cstring_n             	= 0; // (atf_amc.FDb.ind_cstring)
+    _db.ind_cstring_buckets_n     	= 4; // (atf_amc.FDb.ind_cstring)
+    _db.ind_cstring_buckets_elems 	= (atf_amc::FCstring**)algo_lib::malloc_AllocMem(sizeof(atf_amc::FCstring*)*_db.ind_cstring_buckets_n); // initial buckets (atf_amc.FDb.ind_cstring)
+    if (!_db.ind_cstring_buckets_elems) {
+        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_cstring)
+    }
+    memset(_db.ind_cstring_buckets_elems, 0, sizeof(atf_amc::FCstring*)*_db.ind_cstring_buckets_n); // (atf_amc.FDb.ind_cstring)
+    _db.cd_in_msg_head = NULL; // (atf_amc.FDb.cd_in_msg)
+    // typeb: initialize Tpool
+    _db.typeb_free      = NULL;
+    _db.typeb_blocksize = BumpToPow2(64 * sizeof(atf_amc::FTypeB)); // allocate 64-127 elements at a time
+    // pooledbe64: initialize Tpool
+    _db.pooledbe64_free      = NULL;
+    _db.pooledbe64_blocksize = BumpToPow2(64 * sizeof(atf_amc::PooledBE64)); // allocate 64-127 elements at a time
+    memset(_db.varlen_extern_free, 0, sizeof(_db.varlen_extern_free));
+    _db.varlen_extern_n = 0;
+    // initialize LAry amctest (atf_amc.FDb.amctest)
+    _db.amctest_n = 0;
+    memset(_db.amctest_lary, 0, sizeof(_db.amctest_lary)); // zero out all level pointers
+    atf_amc::FAmctest* amctest_first = (atf_amc::FAmctest*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FAmctest) * (u64(1)<<4));
+    if (!amctest_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.amctest_lary[i]  = amctest_first;
+        amctest_first    += 1ULL<<i;
+    }
+    // cascdel: initialize Tpool
+    _db.cascdel_free      = NULL;
+    _db.cascdel_blocksize = BumpToPow2(64 * sizeof(atf_amc::FCascdel)); // allocate 64-127 elements at a time
+    _db.cascdel_next_key = u32(0);
+    memset(_db.optalloc_free, 0, sizeof(_db.optalloc_free));
+    _db.optalloc_n = 0;
+    memset(_db.varlenalloc_free, 0, sizeof(_db.varlenalloc_free));
+    _db.varlenalloc_n = 0;
+    memset(_db.optg_free, 0, sizeof(_db.optg_free));
+    _db.optg_n = 0;
+    _db.c_typek_elems = NULL; // (atf_amc.FDb.c_typek)
+    _db.c_typek_n = 0; // (atf_amc.FDb.c_typek)
+    _db.c_typek_max = 0; // (atf_amc.FDb.c_typek)
+    // initialize LAry avl (atf_amc.FDb.avl)
+    _db.avl_n = 0;
+    memset(_db.avl_lary, 0, sizeof(_db.avl_lary)); // zero out all level pointers
+    atf_amc::FAvl* avl_first = (atf_amc::FAvl*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FAvl) * (u64(1)<<4));
+    if (!avl_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.avl_lary[i]  = avl_first;
+        avl_first    += 1ULL<<i;
     }
-    // initialize LAry types (atf_amc.FDb.types)
-    _db.types_n = 0;
-    memset(_db.types_lary, 0, sizeof(_db.types_lary)); // zero out all level pointers
-    atf_amc::FTypeS* types_first = (atf_amc::FTypeS*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FTypeS) * (u64(1)<<4));
-    if (!types_first) {
+    _db.tr_avl_root = NULL; // (atf_amc.FDb.tr_avl)
+    _db.tr_avl_n = 0;
+    _db.listtype_n = 0; // listtype: initialize count
+    // initialize LAry hashrow (atf_amc.FDb.hashrow)
+    _db.hashrow_n = 0;
+    memset(_db.hashrow_lary, 0, sizeof(_db.hashrow_lary)); // zero out all level pointers
+    atf_amc::FHashrow* hashrow_first = (atf_amc::FHashrow*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FHashrow) * (u64(1)<<4));
+    if (!hashrow_first) {
         FatalErrorExit("out of memory");
     }
     for (int i = 0; i < 4; i++) {
-        _db.types_lary[i]  = types_first;
-        types_first    += 1ULL<<i;
+        _db.hashrow_lary[i]  = hashrow_first;
+        hashrow_first    += 1ULL<<i;
+    }
+    // initialize hash table for atf_amc::FHashrow;
+    _db.ind_hashrow_n             	= 0; // (atf_amc.FDb.ind_hashrow)
+    _db.ind_hashrow_buckets_n     	= 4; // (atf_amc.FDb.ind_hashrow)
+    _db.ind_hashrow_buckets_elems 	= (atf_amc::FHashrow**)algo_lib::malloc_AllocMem(sizeof(atf_amc::FHashrow*)*_db.ind_hashrow_buckets_n); // initial buckets (atf_amc.FDb.ind_hashrow)
+    if (!_db.ind_hashrow_buckets_elems) {
+        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_hashrow)
+    }
+    memset(_db.ind_hashrow_buckets_elems, 0, sizeof(atf_amc::FHashrow*)*_db.ind_hashrow_buckets_n); // (atf_amc.FDb.ind_hashrow)
+    // initialize hash table for atf_amc::FHashrow;
+    _db.ind_hashrow_cached_n             	= 0; // (atf_amc.FDb.ind_hashrow_cached)
+    _db.ind_hashrow_cached_buckets_n     	= 4; // (atf_amc.FDb.ind_hashrow_cached)
+    _db.ind_hashrow_cached_buckets_elems 	= (atf_amc::FHashrow**)algo_lib::malloc_AllocMem(sizeof(atf_amc::FHashrow*)*_db.ind_hashrow_cached_buckets_n); // initial buckets (atf_amc.FDb.ind_hashrow_cached)
+    if (!_db.ind_hashrow_cached_buckets_elems) {
+        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_hashrow_cached)
+    }
+    memset(_db.ind_hashrow_cached_buckets_elems, 0, sizeof(atf_amc::FHashrow*)*_db.ind_hashrow_cached_buckets_n); // (atf_amc.FDb.ind_hashrow_cached)
+    // initialize hash table for atf_amc::FHashrow;
+    _db.ind_hashrow_oa_n           	= 0; // (atf_amc.FDb.ind_hashrow_oa)
+    _db.ind_hashrow_oa_slots_n     	= 8; // (atf_amc.FDb.ind_hashrow_oa)
+    _db.ind_hashrow_oa_slots_elems 	= (algo::Hashslot*)algo_lib::malloc_AllocMem(sizeof(algo::Hashslot)*_db.ind_hashrow_oa_slots_n); // initial slots (atf_amc.FDb.ind_hashrow_oa)
+    if (!_db.ind_hashrow_oa_slots_elems) {
+        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_hashrow_oa)
+    }
+    memset(_db.ind_hashrow_oa_slots_elems, 0, sizeof(algo::Hashslot)*_db.ind_hashrow_oa_slots_n); // (atf_amc.FDb.ind_hashrow_oa)
+    // initialize hash table for atf_amc::FHashrow;
+    _db.ind_hashrow_incr_n             	= 0; // (atf_amc.FDb.ind_hashrow_incr)
+    _db.ind_hashrow_incr_buckets_n     	= 4; // (atf_amc.FDb.ind_hashrow_incr)
+    _db.ind_hashrow_incr_buckets_elems 	= (atf_amc::FHashrow**)algo_lib::malloc_AllocMem(sizeof(atf_amc::FHashrow*)*_db.ind_hashrow_incr_buckets_n); // initial buckets (atf_amc.FDb.ind_hashrow_incr)
+    if (!_db.ind_hashrow_incr_buckets_elems) {
+        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_hashrow_incr)
+    }
+    memset(_db.ind_hashrow_incr_buckets_elems, 0, sizeof(atf_amc::FHashrow*)*_db.ind_hashrow_incr_buckets_n); // (atf_amc.FDb.ind_hashrow_incr)
+    _db.ind_hashrow_incr_old_elems 	= NULL; // (atf_amc.FDb.ind_hashrow_incr)
+    _db.ind_hashrow_incr_old_n     	= 0; // (atf_amc.FDb.ind_hashrow_incr)
+    _db.ind_hashrow_incr_old_pos   	= 0; // (atf_amc.FDb.ind_hashrow_incr)
+    // initialize LAry treerow (atf_amc.FDb.treerow)
+    _db.treerow_n = 0;
+    memset(_db.treerow_lary, 0, sizeof(_db.treerow_lary)); // zero out all level pointers
+    atf_amc::FTreerow* treerow_first = (atf_amc::FTreerow*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FTreerow) * (u64(1)<<4));
+    if (!treerow_first) {
+        FatalErrorExit("out of memory");
     }
-    // initialize hash table for atf_amc::FTypeS;
-    _db.ind_types_n             	= 0; // (atf_amc.FDb.ind_types)
-    _db.ind_types_buckets_n     	= 4; // (atf_amc.FDb.ind_types)
-    _db.ind_types_buckets_elems 	= (atf_amc::FTypeS**)algo_lib::malloc_AllocMem(sizeof(atf_amc::FTypeS*)*_db.ind_types_buckets_n); // initial buckets (atf_amc.FDb.ind_types)
-    if (!_db.ind_types_buckets_elems) {
-        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_types)
+    for (int i = 0; i < 4; i++) {
+        _db.treerow_lary[i]  = treerow_first;
+        treerow_first    += 1ULL<<i;
+    }
+    _db.bt_treerow_root = NULL; // (atf_amc.FDb.bt_treerow)
+    _db.bt_treerow_n = 0;
+    _db.tr_treerow_root = NULL; // (atf_amc.FDb.tr_treerow)
+    _db.tr_treerow_n = 0;
+    // initialize LAry colrow (atf_amc.FDb.colrow)
+    _db.colrow_n = 0;
+    memset(_db.colrow_lary, 0, sizeof(_db.colrow_lary)); // zero out all level pointers
+    atf_amc::FColrow* colrow_first = (atf_amc::FColrow*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FColrow) * (u64(1)<<4));
+    if (!colrow_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.colrow_lary[i]  = colrow_first;
+        colrow_first    += 1ULL<<i;
+    }
+    // column price
+    memset(_db.colrow_price_lary, 0, sizeof(_db.colrow_price_lary));
+    double* colrow_price_first = (double*)algo_lib::malloc_AllocMem(sizeof(double) * (u64(1)<<4));
+    if (!colrow_price_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.colrow_price_lary[i]  = colrow_price_first;
+        colrow_price_first    += 1ULL<<i;
+    }
+    // column qty
+    memset(_db.colrow_qty_lary, 0, sizeof(_db.colrow_qty_lary));
+    i32* colrow_qty_first = (i32*)algo_lib::malloc_AllocMem(sizeof(i32) * (u64(1)<<4));
+    if (!colrow_qty_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.colrow_qty_lary[i]  = colrow_qty_first;
+        colrow_qty_first    += 1ULL<<i;
+    }
+    // initialize LAry heaprow (atf_amc.FDb.heaprow)
+    _db.heaprow_n = 0;
+    memset(_db.heaprow_lary, 0, sizeof(_db.heaprow_lary)); // zero out all level pointers
+    atf_amc::FHeaprow* heaprow_first = (atf_amc::FHeaprow*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FHeaprow) * (u64(1)<<4));
+    if (!heaprow_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.heaprow_lary[i]  = heaprow_first;
+        heaprow_first    += 1ULL<<i;
+    }
+    _db.bh_heaprow_max   	= 0; // (atf_amc.FDb.bh_heaprow)
+    _db.bh_heaprow_n     	= 0; // (atf_amc.FDb.bh_heaprow)
+    _db.bh_heaprow_elems 	= NULL; // (atf_amc.FDb.bh_heaprow)
+    _db.bh_heaprow_inl_max   	= 0; // (atf_amc.FDb.bh_heaprow_inl)
+    _db.bh_heaprow_inl_n     	= 0; // (atf_amc.FDb.bh_heaprow_inl)
+    _db.bh_heaprow_inl_elems 	= NULL; // (atf_amc.FDb.bh_heaprow_inl)
+    _db.bh_heaprow_ptr_max   	= 0; // (atf_amc.FDb.bh_heaprow_ptr)
+    _db.bh_heaprow_ptr_n     	= 0; // (atf_amc.FDb.bh_heaprow_ptr)
+    _db.bh_heaprow_ptr_elems 	= NULL; // (atf_amc.FDb.bh_heaprow_ptr)
+    // magrow: initialize Tpool
+    _db.magrow_free      = NULL;
+    _db.magrow_blocksize = BumpToPow2(64 * sizeof(atf_amc::FMagrow)); // allocate 64-127 elements at a time
+    pthread_mutex_init(&_db.magrow_lock, NULL);
+    _db.magrow_n_maghit = 0;
+    _db.magrow_n_refill = 0;
+    _db.magrow_n_spill = 0;
+    memset(_db.maglpool_free, 0, sizeof(_db.maglpool_free));
+    pthread_mutex_init(&_db.maglpool_lock, NULL);
+    _db.maglpool_n_maghit = 0;
+    _db.maglpool_n_refill = 0;
+    _db.maglpool_n_spill = 0;
+    // initialize LAry hugerow (atf_amc.FDb.hugerow)
+    _db.hugerow_n = 0;
+    memset(_db.hugerow_lary, 0, sizeof(_db.hugerow_lary)); // zero out all level pointers
+    atf_amc::FHugerow* hugerow_first = (atf_amc::FHugerow*)algo_lib::sbrk_AllocMem(sizeof(atf_amc::FHugerow) * (u64(1)<<4));
+    if (!hugerow_first) {
+        FatalErrorExit("out of memory");
+    }
+    for (int i = 0; i < 4; i++) {
+        _db.hugerow_lary[i]  = hugerow_first;
+        hugerow_first    += 1ULL<<i;
+    }
+    // initialize hash table for atf_amc::FHugerow;
+    _db.ind_hugerow_n             	= 0; // (atf_amc.FDb.ind_hugerow)
+    _db.ind_hugerow_buckets_n     	= 4; // (atf_amc.FDb.ind_hugerow)
+    _db.ind_hugerow_buckets_elems 	= (atf_amc::FHugerow**)algo_lib::sbrk_AllocMem(sizeof(atf_amc::FHugerow*)*_db.ind_hugerow_buckets_n); // initial buckets (atf_amc.FDb.ind_hugerow)
+    if (!_db.ind_hugerow_buckets_elems) {
+        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_hugerow)
+    }
+    memset(_db.ind_hugerow_buckets_elems, 0, sizeof(atf_amc::FHugerow*)*_db.ind_hugerow_buckets_n); // (atf_amc.FDb.ind_hugerow)
+    // initialize hash table for atf_amc::FHugerow;
+    _db.ind_hugerow_thp_n             	= 0; // (atf_amc.FDb.ind_hugerow_thp)
+    _db.ind_hugerow_thp_buckets_n     	= 4; // (atf_amc.FDb.ind_hugerow_thp)
+    _db.ind_hugerow_thp_buckets_elems 	= (atf_amc::FHugerow**)algo_lib::sbrk_AllocMem(sizeof(atf_amc::FHugerow*)*_db.ind_hugerow_thp_buckets_n); // initial buckets (atf_amc.FDb.ind_hugerow_thp)
+    if (!_db.ind_hugerow_thp_buckets_elems) {
+        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_hugerow_thp)
+    }
+    memset(_db.ind_hugerow_thp_buckets_elems, 0, sizeof(atf_amc::FHugerow*)*_db.ind_hugerow_thp_buckets_n); // (atf_amc.FDb.ind_hugerow_thp)
+
+    atf_amc::InitReflection();
+    amctest_LoadStatic();
+    listtype_LoadStatic();
+}
+
+// --- atf_amc.FDb..Uninit
+void atf_amc::FDb_Uninit() {
+    atf_amc::FDb &row = _db; (void)row;
+
+    // atf_amc.FDb.ind_hugerow_thp.Uninit (Thash)  //Same as ind_hugerow, buckets allocated while sbrk_thp is set
+    // skip destruction of ind_hugerow_thp in global scope
+
+    // atf_amc.FDb.ind_hugerow.Uninit (Thash)  //Hash index with buckets in sbrk memory
+    // skip destruction of ind_hugerow in global scope
+
+    // atf_amc.FDb.hugerow.Uninit (Lary)  //Rows allocated from algo_lib sbrk
+    // skip destruction in global scope
+
+    // atf_amc.FDb.bh_heaprow_ptr.Uninit (Bheap)  //8-ary heap of pointers
+    // skip destruction in global scope
+
+    // atf_amc.FDb.bh_heaprow_inl.Uninit (Bheap)  //4-ary heap with inline keys
+    // skip destruction in global scope
+
+    // atf_amc.FDb.bh_heaprow.Uninit (Bheap)  //Binary heap of pointers
+    // skip destruction in global scope
+
+    // atf_amc.FDb.heaprow.Uninit (Lary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.colrow.Uninit (Lary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.bt_treerow.Uninit (Btree)  //B+tree index
+    // skip destruction in global scope
+
+    // atf_amc.FDb.treerow.Uninit (Lary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.ind_hashrow_incr.Uninit (Thash)  //Chained hash, incremental rehash
+    // skip destruction of ind_hashrow_incr in global scope
+
+    // atf_amc.FDb.ind_hashrow_oa.Uninit (Thash)  //Open-addressing hash
+    // skip destruction of ind_hashrow_oa in global scope
+
+    // atf_amc.FDb.ind_hashrow_cached.Uninit (Thash)  //Chained hash, cached hash value
+    // skip destruction of ind_hashrow_cached in global scope
+
+    // atf_amc.FDb.ind_hashrow.Uninit (Thash)  //Chained hash
+    // skip destruction of ind_hashrow in global scope
+
+    // atf_amc.FDb.hashrow.Uninit (Lary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.listtype.Uninit (Inlary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.avl.Uninit (Lary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.c_typek.Uninit (Ptrary)  //
+    algo_lib::malloc_FreeMem(_db.c_typek_elems, sizeof(atf_amc::FTypeK*)*_db.c_typek_max); // (atf_amc.FDb.c_typek)
+
+    // atf_amc.FDb.amctest.Uninit (Lary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.ind_cstring.Uninit (Thash)  //
+    // skip destruction of ind_cstring in global scope
+
+    // atf_amc.FDb.cstring.Uninit (Lary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.typet.Uninit (Lary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.ind_typea.Uninit (Thash)  //
+    // skip destruction of ind_typea in global scope
+
+    // atf_amc.FDb.ind_types.Uninit (Thash)  //
+    // skip destruction of ind_types in global scope
+
+    // atf_amc.FDb.types.Uninit (Lary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.typea.Uninit (Lary)  //
+    // skip destruction in global scope
+
+    // atf_amc.FDb.bh_typec.Uninit (Bheap)  //
+    // skip destruction in global scope
+}
+
+// --- atf_amc.FHashrow..Uninit
+void atf_amc::FHashrow_Uninit(atf_amc::FHashrow& hashrow) {
+    atf_amc::FHashrow &row = hashrow; (void)row;
+    ind_hashrow_Remove(row); // remove hashrow from index ind_hashrow
+    ind_hashrow_cached_Remove(row); // remove hashrow from index ind_hashrow_cached
+    ind_hashrow_oa_Remove(row); // remove hashrow from index ind_hashrow_oa
+    ind_hashrow_incr_Remove(row); // remove hashrow from index ind_hashrow_incr
+}
+
+// --- atf_amc.FHeaprow..Uninit
+void atf_amc::FHeaprow_Uninit(atf_amc::FHeaprow& heaprow) {
+    atf_amc::FHeaprow &row = heaprow; (void)row;
+    bh_heaprow_Remove(row); // remove heaprow from index bh_heaprow
+    bh_heaprow_inl_Remove(row); // remove heaprow from index bh_heaprow_inl
+    bh_heaprow_ptr_Remove(row); // remove heaprow from index bh_heaprow_ptr
+}
+
+// --- atf_amc.FHugerow..Uninit
+void atf_amc::FHugerow_Uninit(atf_amc::FHugerow& hugerow) {
+    atf_amc::FHugerow &row = hugerow; (void)row;
+    ind_hugerow_Remove(row); // remove hugerow from index ind_hugerow
+    ind_hugerow_thp_Remove(row); // remove hugerow from index ind_hugerow_thp
+}
+
+// --- atf_amc.TypeG..ReadStrptrMaybe
+// Read fields of atf_amc::TypeG from an ascii string.
+// The format of the string is the format of the atf_amc::TypeG's only field
+bool atf_amc::TypeG_ReadStrptrMaybe(atf_amc::TypeG &parent, algo::strptr in_str) {
+    bool retval = true;
+    retval = retval && i32_ReadStrptrMaybe(parent.typeg, in_str);
+    return retval;
+}
+
+// --- atf_amc.TypeG..Print
+// print string representation of atf_amc::TypeG to string LHS, no header -- cprint:atf_amc.TypeG.String
+void atf_amc::TypeG_Print(atf_amc::TypeG & row, algo::cstring &str) {
+    i32_Print(row.typeg, str);
+}
+
+// --- atf_amc.FOptG.optg.CopyOut
+// Copy fields out of row
+void atf_amc::optg_CopyOut(atf_amc::FOptG &row, atf_amc::OptG &out) {
+    (void)row;//only to avoid -Wunused-parameter
+    (void)out;//only to avoid -Wunused-parameter
+}
+
+// --- atf_amc.FOptG.optg.CopyIn
+// Copy fields in to row
+void atf_amc::optg_CopyIn(atf_amc::FOptG &row, atf_amc::OptG &in) {
+    (void)row;//only to avoid -Wunused-parameter
+    (void)in;//only to avoid -Wunused-parameter
+}
+
+// --- atf_amc.FOptG.typeg.Getary
+// Access optional portion as an array of bytes
+algo::aryptr<u8> atf_amc::typeg_Getary(atf_amc::FOptG& optg) {
+    u8 *end = (u8*)&optg + sizeof(atf_amc::FOptG);
+    return algo::aryptr<u8>(end, i32(optg.length) - ssizeof(atf_amc::FOptG));
+}
+
+// --- atf_amc.FPerfSortString.orig.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_amc::Cstr& atf_amc::orig_Alloc(atf_amc::FPerfSortString& parent) {
+    orig_Reserve(parent, 1);
+    int n  = parent.orig_n;
+    int at = n;
+    atf_amc::Cstr *elems = parent.orig_elems;
+    new (elems + at) atf_amc::Cstr(); // construct new element, default initializer
+    parent.orig_n = n+1;
+    return elems[at];
+}
+
+// --- atf_amc.FPerfSortString.orig.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_amc::Cstr& atf_amc::orig_AllocAt(atf_amc::FPerfSortString& parent, int at) {
+    orig_Reserve(parent, 1);
+    int n  = parent.orig_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("atf_amc.bad_alloc_at  field:atf_amc.FPerfSortString.orig  comment:'index out of range'");
+    }
+    atf_amc::Cstr *elems = parent.orig_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(atf_amc::Cstr));
+    new (elems + at) atf_amc::Cstr(); // construct element, default initializer
+    parent.orig_n = n+1;
+    return elems[at];
+}
+
+// --- atf_amc.FPerfSortString.orig.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_amc::Cstr> atf_amc::orig_AllocN(atf_amc::FPerfSortString& parent, int n_elems) {
+    orig_Reserve(parent, n_elems);
+    int old_n  = parent.orig_n;
+    int new_n = old_n + n_elems;
+    atf_amc::Cstr *elems = parent.orig_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) atf_amc::Cstr(); // construct new element, default initialize
+    }
+    parent.orig_n = new_n;
+    return algo::aryptr<atf_amc::Cstr>(elems + old_n, n_elems);
+}
+
+// --- atf_amc.FPerfSortString.orig.Remove
+// Remove item by index. If index outside of range, do nothing.
+void atf_amc::orig_Remove(atf_amc::FPerfSortString& parent, u32 i) {
+    u32 lim = parent.orig_n;
+    atf_amc::Cstr *elems = parent.orig_elems;
+    if (i < lim) {
+        elems[i].~Cstr(); // destroy element
+        memmove(elems + i, elems + (i + 1), sizeof(atf_amc::Cstr) * (lim - (i + 1)));
+        parent.orig_n = lim - 1;
+    }
+}
+
+// --- atf_amc.FPerfSortString.orig.RemoveAll
+void atf_amc::orig_RemoveAll(atf_amc::FPerfSortString& parent) {
+    u32 n = parent.orig_n;
+    while (n > 0) {
+        n -= 1;
+        parent.orig_elems[n].~Cstr();
+        parent.orig_n = n;
+    }
+}
+
+// --- atf_amc.FPerfSortString.orig.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_amc::orig_RemoveLast(atf_amc::FPerfSortString& parent) {
+    u64 n = parent.orig_n;
+    if (n > 0) {
+        n -= 1;
+        orig_qFind(parent, u64(n)).~Cstr();
+        parent.orig_n = n;
+    }
+}
+
+// --- atf_amc.FPerfSortString.orig.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void atf_amc::orig_AbsReserve(atf_amc::FPerfSortString& parent, int n) {
+    u32 old_max  = parent.orig_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(parent.orig_elems, old_max * sizeof(atf_amc::Cstr), new_max * sizeof(atf_amc::Cstr));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("atf_amc.tary_nomem  field:atf_amc.FPerfSortString.orig  comment:'out of memory'");
     }
-    memset(_db.ind_types_buckets_elems, 0, sizeof(atf_amc::FTypeS*)*_db.ind_types_buckets_n); // (atf_amc.FDb.ind_types)
-    // initialize hash table for atf_amc::FTypeA;
-    _db.ind_typea_n             	= 0; // (atf_amc.FDb.ind_typea)
-    _db.ind_typea_buckets_n     	= 4; // (atf_amc.FDb.ind_typea)
-    _db.ind_typea_buckets_elems 	= (atf_amc::FTypeA**)algo_lib::malloc_AllocMem(sizeof(atf_amc::FTypeA*)*_db.ind_typea_buckets_n); // initial buckets (atf_amc.FDb.ind_typea)
-    if (!_db.ind_typea_buckets_elems) {
-        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_typea)
+    parent.orig_elems = (atf_amc::Cstr*)new_mem;
+    parent.orig_max = new_max;
+}
+
+// --- atf_amc.FPerfSortString.orig.Setary
+// Copy contents of RHS to PARENT.
+void atf_amc::orig_Setary(atf_amc::FPerfSortString& parent, atf_amc::FPerfSortString &rhs) {
+    orig_RemoveAll(parent);
+    int nnew = rhs.orig_n;
+    orig_Reserve(parent, nnew); // reserve space
+    for (int i = 0; i < nnew; i++) { // copy elements over
+        new (parent.orig_elems + i) atf_amc::Cstr(orig_qFind(rhs, i));
+        parent.orig_n = i + 1;
     }
-    memset(_db.ind_typea_buckets_elems, 0, sizeof(atf_amc::FTypeA*)*_db.ind_typea_buckets_n); // (atf_amc.FDb.ind_typea)
-    _db.cs_h_count = i32(0);
-    _db.cs_t_count = i32(0);
-    _db.zs_h_count = i32(0);
-    _db.zs_t_count = i32(0);
-    _db.zs_mt_count = i32(0);
-    _db.bh_count = i32(0);
-    // initialize LAry typet (atf_amc.FDb.typet)
-    _db.typet_n = 0;
-    memset(_db.typet_lary, 0, sizeof(_db.typet_lary)); // zero out all level pointers
-    atf_amc::FTypeT* typet_first = (atf_amc::FTypeT*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FTypeT) * (u64(1)<<4));
-    if (!typet_first) {
-        FatalErrorExit("out of memory");
+}
+
+// --- atf_amc.FPerfSortString.orig.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool atf_amc::orig_XrefMaybe(atf_amc::Cstr &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- atf_amc.FPerfSortString.sorted1.Addary
+// Reserve space (this may move memory). Insert N element at the end.
+// Return aryptr to newly inserted block.
+// If the RHS argument aliases the array (refers to the same memory), exit program with fatal error.
+algo::aryptr<atf_amc::Cstr> atf_amc::sorted1_Addary(atf_amc::FPerfSortString& parent, algo::aryptr<atf_amc::Cstr> rhs) {
+    bool overlaps = rhs.n_elems>0 && rhs.elems >= parent.sorted1_elems && rhs.elems < parent.sorted1_elems + parent.sorted1_max;
+    if (UNLIKELY(overlaps)) {
+        FatalErrorExit("atf_amc.tary_alias  field:atf_amc.FPerfSortString.sorted1  comment:'alias error: sub-array is being appended to the whole'");
     }
-    for (int i = 0; i < 4; i++) {
-        _db.typet_lary[i]  = typet_first;
-        typet_first    += 1ULL<<i;
+    int nnew = rhs.n_elems;
+    sorted1_Reserve(parent, nnew); // reserve space
+    int at = parent.sorted1_n;
+    for (int i = 0; i < nnew; i++) {
+        new (parent.sorted1_elems + at + i) atf_amc::Cstr(rhs[i]);
+        parent.sorted1_n++;
     }
-    // initialize LAry cstring (atf_amc.FDb.cstring)
-    _db.cstring_n = 0;
-    memset(_db.cstring_lary, 0, sizeof(_db.cstring_lary)); // zero out all level pointers
-    atf_amc::FCstring* cstring_first = (atf_amc::FCstring*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FCstring) * (u64(1)<<4));
-    if (!cstring_first) {
-        FatalErrorExit("out of memory");
+    return algo::aryptr<atf_amc::Cstr>(parent.sorted1_elems + at, nnew);
+}
+
+// --- atf_amc.FPerfSortString.sorted1.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_amc::Cstr& atf_amc::sorted1_Alloc(atf_amc::FPerfSortString& parent) {
+    sorted1_Reserve(parent, 1);
+    int n  = parent.sorted1_n;
+    int at = n;
+    atf_amc::Cstr *elems = parent.sorted1_elems;
+    new (elems + at) atf_amc::Cstr(); // construct new element, default initializer
+    parent.sorted1_n = n+1;
+    return elems[at];
+}
+
+// --- atf_amc.FPerfSortString.sorted1.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_amc::Cstr& atf_amc::sorted1_AllocAt(atf_amc::FPerfSortString& parent, int at) {
+    sorted1_Reserve(parent, 1);
+    int n  = parent.sorted1_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("atf_amc.bad_alloc_at  field:atf_amc.FPerfSortString.sorted1  comment:'index out of range'");
     }
-    for (int i = 0; i < 4; i++) {
-        _db.cstring_lary[i]  = cstring_first;
-        cstring_first    += 1ULL<<i;
+    atf_amc::Cstr *elems = parent.sorted1_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(atf_amc::Cstr));
+    new (elems + at) atf_amc::Cstr(); // construct element, default initializer
+    parent.sorted1_n = n+1;
+    return elems[at];
+}
+
+// --- atf_amc.FPerfSortString.sorted1.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_amc::Cstr> atf_amc::sorted1_AllocN(atf_amc::FPerfSortString& parent, int n_elems) {
+    sorted1_Reserve(parent, n_elems);
+    int old_n  = parent.sorted1_n;
+    int new_n = old_n + n_elems;
+    atf_amc::Cstr *elems = parent.sorted1_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) atf_amc::Cstr(); // construct new element, default initialize
     }
-    // initialize hash table for atf_amc::FCstring;
-    _db.ind_cstring_n             	= 0; // (atf_amc.FDb.ind_cstring)
-    _db.ind_cstring_buckets_n     	= 4; // (atf_amc.FDb.ind_cstring)
-    _db.ind_cstring_buckets_elems 	= (atf_amc::FCstring**)algo_lib::malloc_AllocMem(sizeof(atf_amc::FCstring*)*_db.ind_cstring_buckets_n); // initial buckets (atf_amc.FDb.ind_cstring)
-    if (!_db.ind_cstring_buckets_elems) {
-        FatalErrorExit("out of memory"); // (atf_amc.FDb.ind_cstring)
+    parent.sorted1_n = new_n;
+    return algo::aryptr<atf_amc::Cstr>(elems + old_n, n_elems);
+}
+
+// --- atf_amc.FPerfSortString.sorted1.Remove
+// Remove item by index. If index outside of range, do nothing.
+void atf_amc::sorted1_Remove(atf_amc::FPerfSortString& parent, u32 i) {
+    u32 lim = parent.sorted1_n;
+    atf_amc::Cstr *elems = parent.sorted1_elems;
+    if (i < lim) {
+        elems[i].~Cstr(); // destroy element
+        memmove(elems + i, elems + (i + 1), sizeof(atf_amc::Cstr) * (lim - (i + 1)));
+        parent.sorted1_n = lim - 1;
     }
-    memset(_db.ind_cstring_buckets_elems, 0, sizeof(atf_amc::FCstring*)*_db.ind_cstring_buckets_n); // (atf_amc.FDb.ind_cstring)
-    _db.cd_in_msg_head = NULL; // (atf_amc.FDb.cd_in_msg)
-    // typeb: initialize Tpool
-    _db.typeb_free      = NULL;
-    _db.typeb_blocksize = BumpToPow2(64 * sizeof(atf_amc::FTypeB)); // allocate 64-127 elements at a time
-    // pooledbe64: initialize Tpool
-    _db.pooledbe64_free      = NULL;
-    _db.pooledbe64_blocksize = BumpToPow2(64 * sizeof(atf_amc::PooledBE64)); // allocate 64-127 elements at a time
-    memset(_db.varlen_extern_free, 0, sizeof(_db.varlen_extern_free));
-    _db.varlen_extern_n = 0;
-    // initialize LAry amctest (atf_amc.FDb.amctest)
-    _db.amctest_n = 0;
-    memset(_db.amctest_lary, 0, sizeof(_db.amctest_lary)); // zero out all level pointers
-    atf_amc::FAmctest* amctest_first = (atf_amc::FAmctest*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FAmctest) * (u64(1)<<4));
-    if (!amctest_first) {
-        FatalErrorExit("out of memory");
+}
+
+// --- atf_amc.FPerfSortString.sorted1.RemoveAll
+void atf_amc::sorted1_RemoveAll(atf_amc::FPerfSortString& parent) {
+    u32 n = parent.sorted1_n;
+    while (n > 0) {
+        n -= 1;
+        parent.sorted1_elems[n].~Cstr();
+        parent.sorted1_n = n;
     }
-    for (int i = 0; i < 4; i++) {
-        _db.amctest_lary[i]  = amctest_first;
-        amctest_first    += 1ULL<<i;
+}
+
+// --- atf_amc.FPerfSortString.sorted1.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_amc::sorted1_RemoveLast(atf_amc::FPerfSortString& parent) {
+    u64 n = parent.sorted1_n;
+    if (n > 0) {
+        n -= 1;
+        sorted1_qFind(parent, u64(n)).~Cstr();
+        parent.sorted1_n = n;
     }
-    // cascdel: initialize Tpool
-    _db.cascdel_free      = NULL;
-    _db.cascdel_blocksize = BumpToPow2(64 * sizeof(atf_amc::FCascdel)); // allocate 64-127 elements at a time
-    _db.cascdel_next_key = u32(0);
-    memset(_db.optalloc_free, 0, sizeof(_db.optalloc_free));
-    _db.optalloc_n = 0;
-    memset(_db.varlenalloc_free, 0, sizeof(_db.varlenalloc_free));
-    _db.varlenalloc_n = 0;
-    memset(_db.optg_free, 0, sizeof(_db.optg_free));
-    _db.optg_n = 0;
-    _db.c_typek_elems = NULL; // (atf_amc.FDb.c_typek)
-    _db.c_typek_n = 0; // (atf_amc.FDb.c_typek)
-    _db.c_typek_max = 0; // (atf_amc.FDb.c_typek)
-    // initialize LAry avl (atf_amc.FDb.avl)
-    _db.avl_n = 0;
-    memset(_db.avl_lary, 0, sizeof(_db.avl_lary)); // zero out all level pointers
-    atf_amc::FAvl* avl_first = (atf_amc::FAvl*)algo_lib::malloc_AllocMem(sizeof(atf_amc::FAvl) * (u64(1)<<4));
-    if (!avl_first) {
-        FatalErrorExit("out of memory");
+}
+
+// --- atf_amc.FPerfSortString.sorted1.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void atf_amc::sorted1_AbsReserve(atf_amc::FPerfSortString& parent, int n) {
+    u32 old_max  = parent.sorted1_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(parent.sorted1_elems, old_max * sizeof(atf_amc::Cstr), new_max * sizeof(atf_amc::Cstr));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("atf_amc.tary_nomem  field:atf_amc.FPerfSortString.sorted1  comment:'out of memory'");
     }
-    for (int i = 0; i < 4; i++) {
-        _db.avl_lary[i]  = avl_first;
-        avl_first    += 1ULL<<i;
+    parent.sorted1_elems = (atf_amc::Cstr*)new_mem;
+    parent.sorted1_max = new_max;
+}
+
+// --- atf_amc.FPerfSortString.sorted1.Setary
+// Copy contents of RHS to PARENT.
+void atf_amc::sorted1_Setary(atf_amc::FPerfSortString& parent, atf_amc::FPerfSortString &rhs) {
+    sorted1_RemoveAll(parent);
+    int nnew = rhs.sorted1_n;
+    sorted1_Reserve(parent, nnew); // reserve space
+    for (int i = 0; i < nnew; i++) { // copy elements over
+        new (parent.sorted1_elems + i) atf_amc::Cstr(sorted1_qFind(rhs, i));
+        parent.sorted1_n = i + 1;
     }
-    _db.tr_avl_root = NULL; // (atf_amc.FDb.tr_avl)
-    _db.tr_avl_n = 0;
-    _db.listtype_n = 0; // listtype: initialize count
+}
 
-    atf_amc::InitReflection();
-    amctest_LoadStatic();
-    listtype_LoadStatic();
+// --- atf_amc.FPerfSortString.sorted1.Setary2
+// Copy specified array into sorted1, discarding previous contents.
+// If the RHS argument aliases the array (refers to the same memory), throw exception.
+void atf_amc::sorted1_Setary(atf_amc::FPerfSortString& parent, const algo::aryptr<atf_amc::Cstr> &rhs) {
+    sorted1_RemoveAll(parent);
+    sorted1_Addary(parent, rhs);
 }
 
-// --- atf_amc.FDb..Uninit
-void atf_amc::FDb_Uninit() {
-    atf_amc::FDb &row = _db; (void)row;
+// --- atf_amc.FPerfSortString.sorted1.Swap
+// Swap values elem_a and elem_b
+inline static void atf_amc::sorted1_Swap(atf_amc::Cstr &elem_a, atf_amc::Cstr &elem_b) {
+    u8 temp[sizeof(atf_amc::Cstr)];
+    memcpy(&temp  , &elem_a, sizeof(atf_amc::Cstr));
+    memcpy(&elem_a, &elem_b, sizeof(atf_amc::Cstr));
+    memcpy(&elem_b, &temp  , sizeof(atf_amc::Cstr));
+}
 
-    // atf_amc.FDb.listtype.Uninit (Inlary)  //
-    // skip destruction in global scope
+// --- atf_amc.FPerfSortString.sorted1.Rotleft
+// Left circular shift of three-tuple
+inline static void atf_amc::sorted1_Rotleft(atf_amc::Cstr &elem_a, atf_amc::Cstr &elem_b, atf_amc::Cstr &elem_c) {
+    u8 temp[sizeof(atf_amc::Cstr)];
+    memcpy(&temp, &elem_a   , sizeof(atf_amc::Cstr));
+    memcpy(&elem_a   , &elem_b   , sizeof(atf_amc::Cstr));
+    memcpy(&elem_b   , &elem_c   , sizeof(atf_amc::Cstr));
+    memcpy(&elem_c   , &temp, sizeof(atf_amc::Cstr));
+}
+
+// --- atf_amc.FPerfSortString.sorted1.Lt
+// Compare values elem_a and elem_b
+// The comparison function must be anti-symmetric: if a>b, then !(b>a).
+// If not, mayhem results.
+static bool atf_amc::sorted1_Lt(atf_amc::Cstr &elem_a, atf_amc::Cstr &elem_b) {
+    bool ret;
+    ret = val_Lt(elem_a, elem_b);
+    return ret;
+}
 
-    // atf_amc.FDb.avl.Uninit (Lary)  //
-    // skip destruction in global scope
+// --- atf_amc.FPerfSortString.sorted1.SortedQ
+// Verify whether array is sorted
+bool atf_amc::sorted1_SortedQ(atf_amc::FPerfSortString& parent) {
+    atf_amc::Cstr *elems = sorted1_Getary(parent).elems;
+    int n = sorted1_N(parent);
+    for (int i = 1; i < n; i++) {
+        if (sorted1_Lt(elems[i], elems[i-1])) {
+            return false;
+        }
+    }
+    return true;
+}
 
-    // atf_amc.FDb.c_typek.Uninit (Ptrary)  //
-    algo_lib::malloc_FreeMem(_db.c_typek_elems, sizeof(atf_amc::FTypeK*)*_db.c_typek_max); // (atf_amc.FDb.c_typek)
+// --- atf_amc.FPerfSortString.sorted1.IntInsertionSort
+// Internal insertion sort
+static void atf_amc::sorted1_IntInsertionSort(atf_amc::Cstr *elems, int n) {
+    for (int i = 1; i < n; ++i) {
+        int j = i;
+        // find the spot for ith element.
+        while (j>0 && sorted1_Lt(elems[i], elems[j-1])) {
+            j--;
+        }
+        if (j<i) {
+            u8 tmp[sizeof(atf_amc::Cstr)];
+            memcpy (tmp                       , &elems[i], sizeof(atf_amc::Cstr)      );
+            memmove(&elems[j+1], &elems[j], sizeof(atf_amc::Cstr)*(i-j));
+            memcpy (&elems[j]  , tmp                     , sizeof(atf_amc::Cstr)      );
+        }
+    }
+}
 
-    // atf_amc.FDb.amctest.Uninit (Lary)  //
-    // skip destruction in global scope
+// --- atf_amc.FPerfSortString.sorted1.IntHeapSort
+// Internal heap sort
+static void atf_amc::sorted1_IntHeapSort(atf_amc::Cstr *elems, int n) {
+    // construct max-heap.
+    // k=current element
+    // j=parent element
+    for (int i = 1; i < n; i++) {
+        int k=i;
+        int j=(i-1)/2;
+        while (sorted1_Lt(elems[j], elems[k])) {
+            sorted1_Swap(elems[k],elems[j]);
+            k=j;
+            j=(k-1)/2;
+        }
+    }
+    // remove elements from heap one-by-one,
+    // deposit them in reverse order starting at the end of ARY.
+    for (int i = n - 1; i>=0; i--) {
+        int k = 0;
+        int l = 1;
+        while (l<i) {
+            l += l<i-1 && sorted1_Lt(elems[l], elems[l+1]);
+            if (sorted1_Lt(elems[l], elems[i])) {
+                break;
+            }
+            sorted1_Swap(elems[k], elems[l]);
+            k = l;
+            l = k*2+1;
+        }
+        if (i != k) {
+            sorted1_Swap(elems[i],elems[k]);
+        }
+    }
+}
 
-    // atf_amc.FDb.ind_cstring.Uninit (Thash)  //
-    // skip destruction of ind_cstring in global scope
+// --- atf_amc.FPerfSortString.sorted1.IntQuickSort
+// Quick sort engine
+static void atf_amc::sorted1_IntQuickSort(atf_amc::Cstr *elems, int n, int depth) {
+    while (n>16) {
+        // detect degenerate case and revert to heap sort
+        if (depth==0) {
+            sorted1_IntHeapSort(elems,n);
+            return;
+        }
+        // elements to sort initially to determine pivot.
+        // choose pp=n/2 in case the input is already sorted.
+        int pi = 0;
+        int pp = n/2;
+        int pj = n-1;
+        // insertion sort for 1st, middle and last element
+        if (sorted1_Lt(elems[pp], elems[pi])) {
+            sorted1_Swap(elems[pi], elems[pp]);
+        }
+        if (sorted1_Lt(elems[pj], elems[pp])) {
+            if (sorted1_Lt(elems[pj], elems[pi])) {
+                sorted1_Rotleft(elems[pi], elems[pj], elems[pp]);
+            } else {
+                sorted1_Swap(elems[pj], elems[pp]);
+            }
+        }
+        // deposit pivot near the end of the array and skip it.
+        sorted1_Swap(elems[--pj], elems[pp]);
+        // reference to pivot
+        atf_amc::Cstr &pivot = elems[pj];
+        for(;;){
+            while (sorted1_Lt(elems[++pi], pivot)) {
+            }
+            while (sorted1_Lt(pivot, elems[--pj])) {
+            }
+            if (pj <= pi) {
+                break;
+            }
+            sorted1_Swap(elems[pi],elems[pj]);
+        }
+        depth -= 1;
+        sorted1_IntQuickSort(elems, pi, depth);
+        elems += pi;
+        n -= pi;
+    }
+    // sort the remainder of this section
+    sorted1_IntInsertionSort(elems,n);
+}
 
-    // atf_amc.FDb.cstring.Uninit (Lary)  //
-    // skip destruction in global scope
+// --- atf_amc.FPerfSortString.sorted1.InsertionSort
+// Insertion sort
+void atf_amc::sorted1_InsertionSort(atf_amc::FPerfSortString& parent) {
+    atf_amc::Cstr *elems = sorted1_Getary(parent).elems;
+    int n = sorted1_N(parent);
+    sorted1_IntInsertionSort(elems, n);
+}
 
-    // atf_amc.FDb.typet.Uninit (Lary)  //
-    // skip destruction in global scope
+// --- atf_amc.FPerfSortString.sorted1.HeapSort
+// Heap sort
+void atf_amc::sorted1_HeapSort(atf_amc::FPerfSortString& parent) {
+    atf_amc::Cstr *elems = sorted1_Getary(parent).elems;
+    int n = sorted1_N(parent);
+    sorted1_IntHeapSort(elems, n);
+}
 
-    // atf_amc.FDb.ind_typea.Uninit (Thash)  //
-    // skip destruction of ind_typea in global scope
+// --- atf_amc.FPerfSortString.sorted1.QuickSort
+// Quick sort
+void atf_amc::sorted1_QuickSort(atf_amc::FPerfSortString& parent) {
+    // compute max recursion depth based on number of elements in the array
+    int max_depth = CeilingLog2(u32(sorted1_N(parent) + 1)) + 3;
+    atf_amc::Cstr *elems = sorted1_Getary(parent).elems;
+    int n = sorted1_N(parent);
+    sorted1_IntQuickSort(elems, n, max_depth);
+}
 
-    // atf_amc.FDb.ind_types.Uninit (Thash)  //
-    // skip destruction of ind_types in global scope
+// --- atf_amc.FPerfSortString..Uninit
+void atf_amc::FPerfSortString_Uninit(atf_amc::FPerfSortString& parent) {
+    atf_amc::FPerfSortString &row = parent; (void)row;
 
-    // atf_amc.FDb.types.Uninit (Lary)  //
-    // skip destruction in global scope
+    // atf_amc.FPerfSortString.sorted1.Uninit (Tary)  //
+    // remove all elements from atf_amc.FPerfSortString.sorted1
+    sorted1_RemoveAll(parent);
+    // free memory for Tary atf_amc.FPerfSortString.sorted1
+    algo_lib::malloc_FreeMem(parent.sorted1_elems, sizeof(atf_amc::Cstr)*parent.sorted1_max); // (atf_amc.FPerfSortString.sorted1)
 
-    // atf_amc.FDb.typea.Uninit (Lary)  //
-    // skip destruction in global scope
+    // atf_amc.FPerfSortString.orig.Uninit (Tary)  //
+    // remove all elements from atf_amc.FPerfSortString.orig
+    orig_RemoveAll(parent);
+    // free memory for Tary atf_amc.FPerfSortString.orig
+    algo_lib::malloc_FreeMem(parent.orig_elems, sizeof(atf_amc::Cstr)*parent.orig_max); // (atf_amc.FPerfSortString.orig)
+}
 
-    // atf_amc.FDb.bh_typec.Uninit (Bheap)  //
-    // skip destruction in global scope
+// --- atf_amc.FTreerow..Uninit
+void atf_amc::FTreerow_Uninit(atf_amc::FTreerow& treerow) {
+    atf_amc::FTreerow &row = treerow; (void)row;
+    bt_treerow_Remove(row); // remove treerow from index bt_treerow
+    tr_treerow_Remove(row); // remove treerow from index tr_treerow
 }
 
-// --- atf_amc.TypeG..ReadStrptrMaybe
-// Read fields of atf_amc::TypeG from an ascii string.
-// The format of the string is the format of the atf_amc::TypeG's only field
-bool atf_amc::TypeG_ReadStrptrMaybe(atf_amc::TypeG &parent, algo::strptr in_str) {
-    bool retval = true;
-    retval = retval && i32_ReadStrptrMaybe(parent.typeg, in_str);
-    return retval;
+// --- atf_amc.FTypeC.msghdr.CopyOut
+// Copy fields out of row
+void atf_amc::typec_CopyOut(atf_amc::FTypeC &row, atf_amc::TypeC &out) {
+    out.typec = row.typec;
 }
 
-// --- atf_amc.TypeG..Print
-// print string representation of atf_amc::TypeG to string LHS, no header -- cprint:atf_amc.TypeG.String
-void atf_amc::TypeG_Print(atf_amc::TypeG & row, algo::cstring &str) {
-    i32_Print(row.typeg, str);
+// --- atf_amc.FTypeC.msghdr.CopyIn
+// Copy fields in to row
+void atf_amc::typec_CopyIn(atf_amc::FTypeC &row, atf_amc::TypeC &in) {
+    row.typec = in.typec;
 }
 
-// --- atf_amc.FOptG.optg.CopyOut
-// Copy fields out of row
-void atf_amc::optg_CopyOut(atf_amc::FOptG &row, atf_amc::OptG &out) {
-    (void)row;//only to avoid -Wunused-parameter
-    (void)out;//only to avoid -Wunused-parameter
+// --- atf_amc.FTypeC..Uninit
+void atf_amc::FTypeC_Uninit(atf_amc::FTypeC& typec) {
+    atf_amc::FTypeC &row = typec; (void)row;
+    zsl_h_typec_Remove(row); // remove typec from index zsl_h_typec
+    zs_t_typec_Remove(row); // remove typec from index zs_t_typec
+    zs_mt_typec_Remove(row); // remove typec from index zs_mt_typec
+    bh_typec_Remove(row); // remove typec from index bh_typec
+    zdl_h_typec_Remove(row); // remove typec from index zdl_h_typec
+    zd_t_typec_Remove(row); // remove typec from index zd_t_typec
+    zdl_hnt_typec_Remove(row); // remove typec from index zdl_hnt_typec
+    csl_h_typec_Remove(row); // remove typec from index csl_h_typec
+    cs_t_typec_Remove(row); // remove typec from index cs_t_typec
+    cdl_h_typec_Remove(row); // remove typec from index cdl_h_typec
+    cd_t_typec_Remove(row); // remove typec from index cd_t_typec
 }
 
-// --- atf_amc.FOptG.optg.CopyIn
-// Copy fields in to row
-void atf_amc::optg_CopyIn(atf_amc::FOptG &row, atf_amc::OptG &in) {
-    (void)row;//only to avoid -Wunused-parameter
-    (void)in;//only to avoid -Wunused-parameter
+// --- atf_amc.FTypeC..Print
+// print string representation of atf_amc::FTypeC to string LHS, no header -- cprint:atf_amc.FTypeC.String
+void atf_amc::FTypeC_Print(atf_amc::FTypeC & row, algo::cstring &str) {
+    i32_Print(row.typec, str);
 }
 
-// --- atf_amc.FOptG.typeg.Getary
-// Access optional portion as an array of bytes
-algo::aryptr<u8> atf_amc::typeg_Getary(atf_amc::FOptG& optg) {
-    u8 *end = (u8*)&optg + sizeof(atf_amc::FOptG);
-    return algo::aryptr<u8>(end, i32(optg.length) - ssizeof(atf_amc::FOptG));
+// --- atf_amc.FTypeA.msghdr.CopyOut
+// Copy fields out of row
+void atf_amc::typea_CopyOut(atf_amc::FTypeA &row, atf_amc::TypeA &out) {
+    out.typea = row.typea;
 }
 
-// --- atf_amc.FPerfSortString.orig.Alloc
-// Reserve space. Insert element at the end
-// The new element is initialized to a default value
-atf_amc::Cstr& atf_amc::orig_Alloc(atf_amc::FPerfSortString& parent) {
-    orig_Reserve(parent, 1);
-    int n  = parent.orig_n;
-    int at = n;
-    atf_amc::Cstr *elems = parent.orig_elems;
-    new (elems + at) atf_amc::Cstr(); // construct new element, default initializer
-    parent.orig_n = n+1;
-    return elems[at];
+// --- atf_amc.FTypeA.msghdr.CopyIn
+// Copy fields in to row
+void atf_amc::typea_CopyIn(atf_amc::FTypeA &row, atf_amc::TypeA &in) {
+    row.typea = in.typea;
 }
 
-// --- atf_amc.FPerfSortString.orig.AllocAt
-// Reserve space for new element, reallocating the array if necessary
-// Insert new element at specified index. Index must be in range or a fatal error occurs.
-atf_amc::Cstr& atf_amc::orig_AllocAt(atf_amc::FPerfSortString& parent, int at) {
-    orig_Reserve(parent, 1);
-    int n  = parent.orig_n;
-    if (UNLIKELY(u64(at) >= u64(n+1))) {
-        FatalErrorExit("atf_amc.bad_alloc_at  field:atf_amc.FPerfSortString.orig  comment:'index out of range'");
+// --- atf_amc.FTypeA.typec.Alloc
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FTypeC& atf_amc::typec_Alloc(atf_amc::FTypeA& typea) {
+    atf_amc::FTypeC* row = typec_AllocMaybe(typea);
+    if (UNLIKELY(row == NULL)) {
+        FatalErrorExit("atf_amc.out_of_mem  field:atf_amc.FTypeA.typec  comment:'Alloc failed'");
     }
-    atf_amc::Cstr *elems = parent.orig_elems;
-    memmove(elems + at + 1, elems + at, (n - at) * sizeof(atf_amc::Cstr));
-    new (elems + at) atf_amc::Cstr(); // construct element, default initializer
-    parent.orig_n = n+1;
-    return elems[at];
+    return *row;
 }
 
-// --- atf_amc.FPerfSortString.orig.AllocN
-// Reserve space. Insert N elements at the end of the array, return pointer to array
-algo::aryptr<atf_amc::Cstr> atf_amc::orig_AllocN(atf_amc::FPerfSortString& parent, int n_elems) {
-    orig_Reserve(parent, n_elems);
-    int old_n  = parent.orig_n;
-    int new_n = old_n + n_elems;
-    atf_amc::Cstr *elems = parent.orig_elems;
-    for (int i = old_n; i < new_n; i++) {
-        new (elems + i) atf_amc::Cstr(); // construct new element, default initialize
+// --- atf_amc.FTypeA.typec.AllocMaybe
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FTypeC* atf_amc::typec_AllocMaybe(atf_amc::FTypeA& typea) {
+    atf_amc::FTypeC *row = (atf_amc::FTypeC*)typec_AllocMem(typea);
+    if (row) {
+        new (row) atf_amc::FTypeC; // call constructor
     }
-    parent.orig_n = new_n;
-    return algo::aryptr<atf_amc::Cstr>(elems + old_n, n_elems);
+    return row;
 }
 
-// --- atf_amc.FPerfSortString.orig.Remove
-// Remove item by index. If index outside of range, do nothing.
-void atf_amc::orig_Remove(atf_amc::FPerfSortString& parent, u32 i) {
-    u32 lim = parent.orig_n;
-    atf_amc::Cstr *elems = parent.orig_elems;
-    if (i < lim) {
-        elems[i].~Cstr(); // destroy element
-        memmove(elems + i, elems + (i + 1), sizeof(atf_amc::Cstr) * (lim - (i + 1)));
-        parent.orig_n = lim - 1;
+// --- atf_amc.FTypeA.typec.InsertMaybe
+// Create new row from struct.
+// Return pointer to new element, or NULL if insertion failed (due to out-of-memory, duplicate key, etc)
+atf_amc::FTypeC* atf_amc::typec_InsertMaybe(atf_amc::FTypeA& typea, const atf_amc::TypeC &value) {
+    atf_amc::FTypeC *row = &typec_Alloc(typea); // if out of memory, process dies. if input error, return NULL.
+    typec_CopyIn(*row,const_cast<atf_amc::TypeC&>(value));
+    bool ok = typec_XrefMaybe(*row); // this may return false
+    if (!ok) {
+        typec_RemoveLast(typea); // delete offending row, any existing xrefs are cleared
+        row = NULL; // forget this ever happened
     }
+    return row;
 }
 
-// --- atf_amc.FPerfSortString.orig.RemoveAll
-void atf_amc::orig_RemoveAll(atf_amc::FPerfSortString& parent) {
-    u32 n = parent.orig_n;
-    while (n > 0) {
-        n -= 1;
-        parent.orig_elems[n].~Cstr();
-        parent.orig_n = n;
+// --- atf_amc.FTypeA.typec.RemoveAll
+// Destroy all elements of Inlary
+void atf_amc::typec_RemoveAll(atf_amc::FTypeA& typea) {
+    for (u64 n = typea.typec_n; n>0; ) {
+        n--;
+        reinterpret_cast<atf_amc::FTypeC*>(typea.typec_data)[n].~FTypeC(); // destroy last element
+        typea.typec_n=n;
     }
 }
 
-// --- atf_amc.FPerfSortString.orig.RemoveLast
+// --- atf_amc.FTypeA.typec.RemoveLast
 // Delete last element of array. Do nothing if array is empty.
-void atf_amc::orig_RemoveLast(atf_amc::FPerfSortString& parent) {
-    u64 n = parent.orig_n;
+void atf_amc::typec_RemoveLast(atf_amc::FTypeA& typea) {
+    u64 n = typea.typec_n;
     if (n > 0) {
         n -= 1;
-        orig_qFind(parent, u64(n)).~Cstr();
-        parent.orig_n = n;
-    }
-}
-
-// --- atf_amc.FPerfSortString.orig.AbsReserve
-// Make sure N elements fit in array. Process dies if out of memory
-void atf_amc::orig_AbsReserve(atf_amc::FPerfSortString& parent, int n) {
-    u32 old_max  = parent.orig_max;
-    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
-    void *new_mem = algo_lib::malloc_ReallocMem(parent.orig_elems, old_max * sizeof(atf_amc::Cstr), new_max * sizeof(atf_amc::Cstr));
-    if (UNLIKELY(!new_mem)) {
-        FatalErrorExit("atf_amc.tary_nomem  field:atf_amc.FPerfSortString.orig  comment:'out of memory'");
-    }
-    parent.orig_elems = (atf_amc::Cstr*)new_mem;
-    parent.orig_max = new_max;
-}
-
-// --- atf_amc.FPerfSortString.orig.Setary
-// Copy contents of RHS to PARENT.
-void atf_amc::orig_Setary(atf_amc::FPerfSortString& parent, atf_amc::FPerfSortString &rhs) {
-    orig_RemoveAll(parent);
-    int nnew = rhs.orig_n;
-    orig_Reserve(parent, nnew); // reserve space
-    for (int i = 0; i < nnew; i++) { // copy elements over
-        new (parent.orig_elems + i) atf_amc::Cstr(orig_qFind(rhs, i));
-        parent.orig_n = i + 1;
+        reinterpret_cast<atf_amc::FTypeC*>(typea.typec_data)[n].~FTypeC();
+        typea.typec_n = n;
     }
 }
 
-// --- atf_amc.FPerfSortString.orig.XrefMaybe
+// --- atf_amc.FTypeA.typec.XrefMaybe
 // Insert row into all appropriate indices. If error occurs, store error
 // in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
-bool atf_amc::orig_XrefMaybe(atf_amc::Cstr &row) {
+bool atf_amc::typec_XrefMaybe(atf_amc::FTypeC &row) {
     bool retval = true;
     (void)row;
     return retval;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.Addary
-// Reserve space (this may move memory). Insert N element at the end.
-// Return aryptr to newly inserted block.
-// If the RHS argument aliases the array (refers to the same memory), exit program with fatal error.
-algo::aryptr<atf_amc::Cstr> atf_amc::sorted1_Addary(atf_amc::FPerfSortString& parent, algo::aryptr<atf_amc::Cstr> rhs) {
-    bool overlaps = rhs.n_elems>0 && rhs.elems >= parent.sorted1_elems && rhs.elems < parent.sorted1_elems + parent.sorted1_max;
-    if (UNLIKELY(overlaps)) {
-        FatalErrorExit("atf_amc.tary_alias  field:atf_amc.FPerfSortString.sorted1  comment:'alias error: sub-array is being appended to the whole'");
-    }
-    int nnew = rhs.n_elems;
-    sorted1_Reserve(parent, nnew); // reserve space
-    int at = parent.sorted1_n;
-    for (int i = 0; i < nnew; i++) {
-        new (parent.sorted1_elems + at + i) atf_amc::Cstr(rhs[i]);
-        parent.sorted1_n++;
-    }
-    return algo::aryptr<atf_amc::Cstr>(parent.sorted1_elems + at, nnew);
-}
-
-// --- atf_amc.FPerfSortString.sorted1.Alloc
-// Reserve space. Insert element at the end
-// The new element is initialized to a default value
-atf_amc::Cstr& atf_amc::sorted1_Alloc(atf_amc::FPerfSortString& parent) {
-    sorted1_Reserve(parent, 1);
-    int n  = parent.sorted1_n;
-    int at = n;
-    atf_amc::Cstr *elems = parent.sorted1_elems;
-    new (elems + at) atf_amc::Cstr(); // construct new element, default initializer
-    parent.sorted1_n = n+1;
-    return elems[at];
-}
-
-// --- atf_amc.FPerfSortString.sorted1.AllocAt
-// Reserve space for new element, reallocating the array if necessary
-// Insert new element at specified index. Index must be in range or a fatal error occurs.
-atf_amc::Cstr& atf_amc::sorted1_AllocAt(atf_amc::FPerfSortString& parent, int at) {
-    sorted1_Reserve(parent, 1);
-    int n  = parent.sorted1_n;
-    if (UNLIKELY(u64(at) >= u64(n+1))) {
-        FatalErrorExit("atf_amc.bad_alloc_at  field:atf_amc.FPerfSortString.sorted1  comment:'index out of range'");
+// --- atf_amc.FTypeA.zdl_typeb.Cascdel
+// Delete all elements in the linked list.
+void atf_amc::zdl_typeb_Cascdel(atf_amc::FTypeA& typea) {
+    while (atf_amc::FTypeB *zdl_typeb_first = zdl_typeb_First(typea)) {
+        typeb_Delete(*zdl_typeb_first);
     }
-    atf_amc::Cstr *elems = parent.sorted1_elems;
-    memmove(elems + at + 1, elems + at, (n - at) * sizeof(atf_amc::Cstr));
-    new (elems + at) atf_amc::Cstr(); // construct element, default initializer
-    parent.sorted1_n = n+1;
-    return elems[at];
 }
 
-// --- atf_amc.FPerfSortString.sorted1.AllocN
-// Reserve space. Insert N elements at the end of the array, return pointer to array
-algo::aryptr<atf_amc::Cstr> atf_amc::sorted1_AllocN(atf_amc::FPerfSortString& parent, int n_elems) {
-    sorted1_Reserve(parent, n_elems);
-    int old_n  = parent.sorted1_n;
-    int new_n = old_n + n_elems;
-    atf_amc::Cstr *elems = parent.sorted1_elems;
-    for (int i = old_n; i < new_n; i++) {
-        new (elems + i) atf_amc::Cstr(); // construct new element, default initialize
+// --- atf_amc.FTypeA.zdl_typeb.Insert
+// Insert row into linked list. If row is already in linked list, do nothing.
+void atf_amc::zdl_typeb_Insert(atf_amc::FTypeA& typea, atf_amc::FTypeB& row) {
+    if (!zdl_typeb_InLlistQ(row)) {
+        atf_amc::FTypeB* old_head = typea.zdl_typeb_head;
+        row.zdl_typeb_prev = NULL;
+        row.zdl_typeb_next = old_head;
+        typea.zdl_typeb_head  = &row;
+        atf_amc::FTypeB **new_row_a = &old_head->zdl_typeb_prev;
+        atf_amc::FTypeB **new_row_b = &typea.zdl_typeb_tail;
+        atf_amc::FTypeB **new_row = old_head ? new_row_a : new_row_b;
+        *new_row = &row;
+        typea.zdl_typeb_n++;
     }
-    parent.sorted1_n = new_n;
-    return algo::aryptr<atf_amc::Cstr>(elems + old_n, n_elems);
 }
 
-// --- atf_amc.FPerfSortString.sorted1.Remove
-// Remove item by index. If index outside of range, do nothing.
-void atf_amc::sorted1_Remove(atf_amc::FPerfSortString& parent, u32 i) {
-    u32 lim = parent.sorted1_n;
-    atf_amc::Cstr *elems = parent.sorted1_elems;
-    if (i < lim) {
-        elems[i].~Cstr(); // destroy element
-        memmove(elems + i, elems + (i + 1), sizeof(atf_amc::Cstr) * (lim - (i + 1)));
-        parent.sorted1_n = lim - 1;
+// --- atf_amc.FTypeA.zdl_typeb.Remove
+// Remove element from index. If element is not in index, do nothing.
+void atf_amc::zdl_typeb_Remove(atf_amc::FTypeA& typea, atf_amc::FTypeB& row) {
+    if (zdl_typeb_InLlistQ(row)) {
+        atf_amc::FTypeB* old_head       = typea.zdl_typeb_head;
+        (void)old_head; // in case it's not used
+        atf_amc::FTypeB* prev = row.zdl_typeb_prev;
+        atf_amc::FTypeB* next = row.zdl_typeb_next;
+        // if element is first, adjust list head; otherwise, adjust previous element's next
+        atf_amc::FTypeB **new_next_a = &prev->zdl_typeb_next;
+        atf_amc::FTypeB **new_next_b = &typea.zdl_typeb_head;
+        atf_amc::FTypeB **new_next = prev ? new_next_a : new_next_b;
+        *new_next = next;
+        // if element is last, adjust list tail; otherwise, adjust next element's prev
+        atf_amc::FTypeB **new_prev_a = &next->zdl_typeb_prev;
+        atf_amc::FTypeB **new_prev_b = &typea.zdl_typeb_tail;
+        atf_amc::FTypeB **new_prev = next ? new_prev_a : new_prev_b;
+        *new_prev = prev;
+        typea.zdl_typeb_n--;
+        row.zdl_typeb_next=(atf_amc::FTypeB*)-1; // not-in-list
     }
 }
 
-// --- atf_amc.FPerfSortString.sorted1.RemoveAll
-void atf_amc::sorted1_RemoveAll(atf_amc::FPerfSortString& parent) {
-    u32 n = parent.sorted1_n;
-    while (n > 0) {
-        n -= 1;
-        parent.sorted1_elems[n].~Cstr();
-        parent.sorted1_n = n;
+// --- atf_amc.FTypeA.zdl_typeb.RemoveAll
+// Empty the index. (The rows are not deleted)
+void atf_amc::zdl_typeb_RemoveAll(atf_amc::FTypeA& typea) {
+    atf_amc::FTypeB* row = typea.zdl_typeb_head;
+    typea.zdl_typeb_head = NULL;
+    typea.zdl_typeb_tail = NULL;
+    typea.zdl_typeb_n = 0;
+    while (row) {
+        atf_amc::FTypeB* row_next = row->zdl_typeb_next;
+        row->zdl_typeb_next  = (atf_amc::FTypeB*)-1;
+        row->zdl_typeb_prev  = NULL;
+        row = row_next;
     }
 }
 
-// --- atf_amc.FPerfSortString.sorted1.RemoveLast
-// Delete last element of array. Do nothing if array is empty.
-void atf_amc::sorted1_RemoveLast(atf_amc::FPerfSortString& parent) {
-    u64 n = parent.sorted1_n;
-    if (n > 0) {
-        n -= 1;
-        sorted1_qFind(parent, u64(n)).~Cstr();
-        parent.sorted1_n = n;
+// --- atf_amc.FTypeA.zdl_typeb.RemoveFirst
+// If linked list is empty, return NULL. Otherwise unlink and return pointer to first element.
+atf_amc::FTypeB* atf_amc::zdl_typeb_RemoveFirst(atf_amc::FTypeA& typea) {
+    atf_amc::FTypeB *row = NULL;
+    row = typea.zdl_typeb_head;
+    if (row) {
+        atf_amc::FTypeB *next = row->zdl_typeb_next;
+        typea.zdl_typeb_head = next;
+        atf_amc::FTypeB **new_end_a = &next->zdl_typeb_prev;
+        atf_amc::FTypeB **new_end_b = &typea.zdl_typeb_tail;
+        atf_amc::FTypeB **new_end = next ? new_end_a : new_end_b;
+        *new_end = NULL;
+        typea.zdl_typeb_n--;
+        row->zdl_typeb_next = (atf_amc::FTypeB*)-1; // mark as not-in-list
     }
+    return row;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.AbsReserve
-// Make sure N elements fit in array. Process dies if out of memory
-void atf_amc::sorted1_AbsReserve(atf_amc::FPerfSortString& parent, int n) {
-    u32 old_max  = parent.sorted1_max;
-    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
-    void *new_mem = algo_lib::malloc_ReallocMem(parent.sorted1_elems, old_max * sizeof(atf_amc::Cstr), new_max * sizeof(atf_amc::Cstr));
-    if (UNLIKELY(!new_mem)) {
-        FatalErrorExit("atf_amc.tary_nomem  field:atf_amc.FPerfSortString.sorted1  comment:'out of memory'");
+// --- atf_amc.FTypeA.bh_typeb.Cascdel
+// Delete referred-to items.
+// Delete all elements referenced by the heap.
+void atf_amc::bh_typeb_Cascdel(atf_amc::FTypeA& typea) {
+    i32 n = typea.bh_typeb_n;
+    while (n > 0) {
+        n--;
+        atf_amc::FTypeB &elem = *typea.bh_typeb_elems[n]; // pick cheapest element to remove
+        elem.bh_typeb_idx = -1; // mark not-in-heap
+        typea.bh_typeb_n = n;
+        typeb_Delete(elem);
     }
-    parent.sorted1_elems = (atf_amc::Cstr*)new_mem;
-    parent.sorted1_max = new_max;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.Setary
-// Copy contents of RHS to PARENT.
-void atf_amc::sorted1_Setary(atf_amc::FPerfSortString& parent, atf_amc::FPerfSortString &rhs) {
-    sorted1_RemoveAll(parent);
-    int nnew = rhs.sorted1_n;
-    sorted1_Reserve(parent, nnew); // reserve space
-    for (int i = 0; i < nnew; i++) { // copy elements over
-        new (parent.sorted1_elems + i) atf_amc::Cstr(sorted1_qFind(rhs, i));
-        parent.sorted1_n = i + 1;
-    }
+// --- atf_amc.FTypeA.bh_typeb.Dealloc
+// Remove all elements from heap and free memory used by the array.
+void atf_amc::bh_typeb_Dealloc(atf_amc::FTypeA& typea) {
+    bh_typeb_RemoveAll(typea);
+    algo_lib::malloc_FreeMem(typea.bh_typeb_elems, sizeof(atf_amc::FTypeB*)*typea.bh_typeb_max);
+    typea.bh_typeb_max   = 0;
+    typea.bh_typeb_elems = NULL;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.Setary2
-// Copy specified array into sorted1, discarding previous contents.
-// If the RHS argument aliases the array (refers to the same memory), throw exception.
-void atf_amc::sorted1_Setary(atf_amc::FPerfSortString& parent, const algo::aryptr<atf_amc::Cstr> &rhs) {
-    sorted1_RemoveAll(parent);
-    sorted1_Addary(parent, rhs);
+// --- atf_amc.FTypeA.bh_typeb.Downheap
+// Find new location for ROW starting at IDX
+// NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
+static int atf_amc::bh_typeb_Downheap(atf_amc::FTypeA& typea, atf_amc::FTypeB& row, int idx) {
+    atf_amc::FTypeB* *elems = typea.bh_typeb_elems;
+    int n = typea.bh_typeb_n;
+    int child = idx*2+1;
+    while (child < n) {
+        atf_amc::FTypeB* p = elems[child]; // left child
+        int rchild = child+1;
+        if (rchild < n) {
+            atf_amc::FTypeB* q = elems[rchild]; // right child
+            if (bh_typeb_ElemLt(typea, *q,*p)) {
+                child = rchild;
+                p     = q;
+            }
+        }
+        if (!bh_typeb_ElemLt(typea, *p,row)) {
+            break;
+        }
+        p->bh_typeb_idx   = idx;
+        elems[idx]     = p;
+        idx            = child;
+        child          = idx*2+1;
+    }
+    return idx;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.Swap
-// Swap values elem_a and elem_b
-inline static void atf_amc::sorted1_Swap(atf_amc::Cstr &elem_a, atf_amc::Cstr &elem_b) {
-    u8 temp[sizeof(atf_amc::Cstr)];
-    memcpy(&temp  , &elem_a, sizeof(atf_amc::Cstr));
-    memcpy(&elem_a, &elem_b, sizeof(atf_amc::Cstr));
-    memcpy(&elem_b, &temp  , sizeof(atf_amc::Cstr));
+// --- atf_amc.FTypeA.bh_typeb.Insert
+// Insert row. Row must not already be in index. If row is already in index, do nothing.
+void atf_amc::bh_typeb_Insert(atf_amc::FTypeA& typea, atf_amc::FTypeB& row) {
+    if (LIKELY(row.bh_typeb_idx == -1)) {
+        bh_typeb_Reserve(typea, 1);
+        int n = typea.bh_typeb_n;
+        typea.bh_typeb_n = n + 1;
+        int new_idx = bh_typeb_Upheap(typea, row, n);
+        row.bh_typeb_idx = new_idx;
+        typea.bh_typeb_elems[new_idx] = &row;
+    }
 }
 
-// --- atf_amc.FPerfSortString.sorted1.Rotleft
-// Left circular shift of three-tuple
-inline static void atf_amc::sorted1_Rotleft(atf_amc::Cstr &elem_a, atf_amc::Cstr &elem_b, atf_amc::Cstr &elem_c) {
-    u8 temp[sizeof(atf_amc::Cstr)];
-    memcpy(&temp, &elem_a   , sizeof(atf_amc::Cstr));
-    memcpy(&elem_a   , &elem_b   , sizeof(atf_amc::Cstr));
-    memcpy(&elem_b   , &elem_c   , sizeof(atf_amc::Cstr));
-    memcpy(&elem_c   , &temp, sizeof(atf_amc::Cstr));
+// --- atf_amc.FTypeA.bh_typeb.Reheap
+// If row is in heap, update its position. If row is not in heap, insert it.
+// Return new position of item in the heap (0=top)
+i32 atf_amc::bh_typeb_Reheap(atf_amc::FTypeA& typea, atf_amc::FTypeB& row) {
+    int old_idx = row.bh_typeb_idx;
+    bool isnew = old_idx == -1;
+    if (isnew) {
+        bh_typeb_Reserve(typea, 1);
+        old_idx = typea.bh_typeb_n++;
+    }
+    int new_idx = bh_typeb_Upheap(typea, row, old_idx);
+    if (!isnew && new_idx == old_idx) {
+        new_idx = bh_typeb_Downheap(typea, row, old_idx);
+    }
+    row.bh_typeb_idx = new_idx;
+    typea.bh_typeb_elems[new_idx] = &row;
+    return new_idx;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.Lt
-// Compare values elem_a and elem_b
-// The comparison function must be anti-symmetric: if a>b, then !(b>a).
-// If not, mayhem results.
-static bool atf_amc::sorted1_Lt(atf_amc::Cstr &elem_a, atf_amc::Cstr &elem_b) {
-    bool ret;
-    ret = val_Lt(elem_a, elem_b);
-    return ret;
+// --- atf_amc.FTypeA.bh_typeb.ReheapFirst
+// Key of first element in the heap changed. Move it.
+// This function does not check the insert condition.
+// Return new position of item in the heap (0=top).
+// Heap must be non-empty or behavior is undefined.
+i32 atf_amc::bh_typeb_ReheapFirst(atf_amc::FTypeA& typea) {
+    atf_amc::FTypeB &row = *typea.bh_typeb_elems[0];
+    i32 new_idx = bh_typeb_Downheap(typea, row, 0);
+    row.bh_typeb_idx = new_idx;
+    typea.bh_typeb_elems[new_idx] = &row;
+    return new_idx;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.SortedQ
-// Verify whether array is sorted
-bool atf_amc::sorted1_SortedQ(atf_amc::FPerfSortString& parent) {
-    atf_amc::Cstr *elems = sorted1_Getary(parent).elems;
-    int n = sorted1_N(parent);
-    for (int i = 1; i < n; i++) {
-        if (sorted1_Lt(elems[i], elems[i-1])) {
-            return false;
+// --- atf_amc.FTypeA.bh_typeb.Remove
+// Remove element from index. If element is not in index, do nothing.
+void atf_amc::bh_typeb_Remove(atf_amc::FTypeA& typea, atf_amc::FTypeB& row) {
+    if (bh_typeb_InBheapQ(row)) {
+        int old_idx = row.bh_typeb_idx;
+        if (typea.bh_typeb_elems[old_idx] == &row) { // sanity check: heap points back to row
+            row.bh_typeb_idx = -1;           // mark not in heap
+            i32 n = typea.bh_typeb_n - 1; // index of last element in heap
+            typea.bh_typeb_n = n;         // decrease count
+            if (old_idx != n) {
+                atf_amc::FTypeB *elem = typea.bh_typeb_elems[n];
+                int new_idx = bh_typeb_Upheap(typea, *elem, old_idx);
+                if (new_idx == old_idx) {
+                    new_idx = bh_typeb_Downheap(typea, *elem, old_idx);
+                }
+                elem->bh_typeb_idx = new_idx;
+                typea.bh_typeb_elems[new_idx] = elem;
+            }
         }
     }
-    return true;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.IntInsertionSort
-// Internal insertion sort
-static void atf_amc::sorted1_IntInsertionSort(atf_amc::Cstr *elems, int n) {
-    for (int i = 1; i < n; ++i) {
-        int j = i;
-        // find the spot for ith element.
-        while (j>0 && sorted1_Lt(elems[i], elems[j-1])) {
-            j--;
-        }
-        if (j<i) {
-            u8 tmp[sizeof(atf_amc::Cstr)];
-            memcpy (tmp                       , &elems[i], sizeof(atf_amc::Cstr)      );
-            memmove(&elems[j+1], &elems[j], sizeof(atf_amc::Cstr)*(i-j));
-            memcpy (&elems[j]  , tmp                     , sizeof(atf_amc::Cstr)      );
-        }
+// --- atf_amc.FTypeA.bh_typeb.RemoveAll
+// Remove all elements from binary heap
+void atf_amc::bh_typeb_RemoveAll(atf_amc::FTypeA& typea) {
+    int n = typea.bh_typeb_n;
+    for (int i = n - 1; i>=0; i--) {
+        typea.bh_typeb_elems[i]->bh_typeb_idx = -1; // mark not-in-heap
     }
+    typea.bh_typeb_n = 0;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.IntHeapSort
-// Internal heap sort
-static void atf_amc::sorted1_IntHeapSort(atf_amc::Cstr *elems, int n) {
-    // construct max-heap.
-    // k=current element
-    // j=parent element
-    for (int i = 1; i < n; i++) {
-        int k=i;
-        int j=(i-1)/2;
-        while (sorted1_Lt(elems[j], elems[k])) {
-            sorted1_Swap(elems[k],elems[j]);
-            k=j;
-            j=(k-1)/2;
-        }
-    }
-    // remove elements from heap one-by-one,
-    // deposit them in reverse order starting at the end of ARY.
-    for (int i = n - 1; i>=0; i--) {
-        int k = 0;
-        int l = 1;
-        while (l<i) {
-            l += l<i-1 && sorted1_Lt(elems[l], elems[l+1]);
-            if (sorted1_Lt(elems[l], elems[i])) {
-                break;
-            }
-            sorted1_Swap(elems[k], elems[l]);
-            k = l;
-            l = k*2+1;
-        }
-        if (i != k) {
-            sorted1_Swap(elems[i],elems[k]);
+// --- atf_amc.FTypeA.bh_typeb.RemoveFirst
+// If index is empty, return NULL. Otherwise remove and return first key in index.
+//  Call 'head changed' trigger.
+atf_amc::FTypeB* atf_amc::bh_typeb_RemoveFirst(atf_amc::FTypeA& typea) {
+    atf_amc::FTypeB *row = NULL;
+    if (typea.bh_typeb_n > 0) {
+        row = typea.bh_typeb_elems[0];
+        row->bh_typeb_idx = -1;           // mark not in heap
+        i32 n = typea.bh_typeb_n - 1; // index of last element in heap
+        typea.bh_typeb_n = n;         // decrease count
+        if (n) {
+            atf_amc::FTypeB &elem = *typea.bh_typeb_elems[n];
+            int new_idx = bh_typeb_Downheap(typea, elem, 0);
+            elem.bh_typeb_idx = new_idx;
+            typea.bh_typeb_elems[new_idx] = &elem;
         }
     }
+    return row;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.IntQuickSort
-// Quick sort engine
-static void atf_amc::sorted1_IntQuickSort(atf_amc::Cstr *elems, int n, int depth) {
-    while (n>16) {
-        // detect degenerate case and revert to heap sort
-        if (depth==0) {
-            sorted1_IntHeapSort(elems,n);
-            return;
-        }
-        // elements to sort initially to determine pivot.
-        // choose pp=n/2 in case the input is already sorted.
-        int pi = 0;
-        int pp = n/2;
-        int pj = n-1;
-        // insertion sort for 1st, middle and last element
-        if (sorted1_Lt(elems[pp], elems[pi])) {
-            sorted1_Swap(elems[pi], elems[pp]);
-        }
-        if (sorted1_Lt(elems[pj], elems[pp])) {
-            if (sorted1_Lt(elems[pj], elems[pi])) {
-                sorted1_Rotleft(elems[pi], elems[pj], elems[pp]);
-            } else {
-                sorted1_Swap(elems[pj], elems[pp]);
-            }
-        }
-        // deposit pivot near the end of the array and skip it.
-        sorted1_Swap(elems[--pj], elems[pp]);
-        // reference to pivot
-        atf_amc::Cstr &pivot = elems[pj];
-        for(;;){
-            while (sorted1_Lt(elems[++pi], pivot)) {
-            }
-            while (sorted1_Lt(pivot, elems[--pj])) {
-            }
-            if (pj <= pi) {
-                break;
-            }
-            sorted1_Swap(elems[pi],elems[pj]);
+// --- atf_amc.FTypeA.bh_typeb.Reserve
+// Reserve space in index for N more elements
+void atf_amc::bh_typeb_Reserve(atf_amc::FTypeA& typea, int n) {
+    i32 old_max = typea.bh_typeb_max;
+    if (UNLIKELY(typea.bh_typeb_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(atf_amc::FTypeB*);
+        u32 new_size = new_max * sizeof(atf_amc::FTypeB*);
+        void *new_mem = algo_lib::malloc_ReallocMem(typea.bh_typeb_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FTypeA.bh_typeb");
         }
-        depth -= 1;
-        sorted1_IntQuickSort(elems, pi, depth);
-        elems += pi;
-        n -= pi;
+        typea.bh_typeb_elems = (atf_amc::FTypeB**)new_mem;
+        typea.bh_typeb_max = new_max;
     }
-    // sort the remainder of this section
-    sorted1_IntInsertionSort(elems,n);
 }
 
-// --- atf_amc.FPerfSortString.sorted1.InsertionSort
-// Insertion sort
-void atf_amc::sorted1_InsertionSort(atf_amc::FPerfSortString& parent) {
-    atf_amc::Cstr *elems = sorted1_Getary(parent).elems;
-    int n = sorted1_N(parent);
-    sorted1_IntInsertionSort(elems, n);
+// --- atf_amc.FTypeA.bh_typeb.Upheap
+// Find and return index of new location for element ROW in the heap, starting at index IDX.
+// Move any elements along the way but do not modify ROW.
+static int atf_amc::bh_typeb_Upheap(atf_amc::FTypeA& typea, atf_amc::FTypeB& row, int idx) {
+    atf_amc::FTypeB* *elems = typea.bh_typeb_elems;
+    while (idx>0) {
+        int j = (idx-1)/2;
+        atf_amc::FTypeB* p = elems[j];
+        if (!bh_typeb_ElemLt(typea, row, *p)) {
+            break;
+        }
+        p->bh_typeb_idx = idx;
+        elems[idx] = p;
+        idx = j;
+    }
+    return idx;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.HeapSort
-// Heap sort
-void atf_amc::sorted1_HeapSort(atf_amc::FPerfSortString& parent) {
-    atf_amc::Cstr *elems = sorted1_Getary(parent).elems;
-    int n = sorted1_N(parent);
-    sorted1_IntHeapSort(elems, n);
+// --- atf_amc.FTypeA.bh_typeb.ElemLt
+inline static bool atf_amc::bh_typeb_ElemLt(atf_amc::FTypeA& typea, atf_amc::FTypeB &a, atf_amc::FTypeB &b) {
+    (void)typea;
+    return a.j < b.j;
 }
 
-// --- atf_amc.FPerfSortString.sorted1.QuickSort
-// Quick sort
-void atf_amc::sorted1_QuickSort(atf_amc::FPerfSortString& parent) {
-    // compute max recursion depth based on number of elements in the array
-    int max_depth = CeilingLog2(u32(sorted1_N(parent) + 1)) + 3;
-    atf_amc::Cstr *elems = sorted1_Getary(parent).elems;
-    int n = sorted1_N(parent);
-    sorted1_IntQuickSort(elems, n, max_depth);
+// --- atf_amc.FTypeA..Init
+// Set all fields to initial values.
+void atf_amc::FTypeA_Init(atf_amc::FTypeA& typea) {
+    typea.typea = i32(0);
+    typea.typec_n = 0; // typec: initialize count
+    typea.zdl_typeb_head = NULL; // (atf_amc.FTypeA.zdl_typeb)
+    typea.zdl_typeb_n = 0; // (atf_amc.FTypeA.zdl_typeb)
+    typea.zdl_typeb_tail = NULL; // (atf_amc.FTypeA.zdl_typeb)
+    typea.rowid = i32(0);
+    typea.bh_typeb_max   	= 0; // (atf_amc.FTypeA.bh_typeb)
+    typea.bh_typeb_n     	= 0; // (atf_amc.FTypeA.bh_typeb)
+    typea.bh_typeb_elems 	= NULL; // (atf_amc.FTypeA.bh_typeb)
+    typea.ind_typea_next = (atf_amc::FTypeA*)-1; // (atf_amc.FDb.ind_typea) not-in-hash
 }
 
-// --- atf_amc.FPerfSortString..Uninit
-void atf_amc::FPerfSortString_Uninit(atf_amc::FPerfSortString& parent) {
-    atf_amc::FPerfSortString &row = parent; (void)row;
-
-    // atf_amc.FPerfSortString.sorted1.Uninit (Tary)  //
-    // remove all elements from atf_amc.FPerfSortString.sorted1
-    sorted1_RemoveAll(parent);
-    // free memory for Tary atf_amc.FPerfSortString.sorted1
-    algo_lib::malloc_FreeMem(parent.sorted1_elems, sizeof(atf_amc::Cstr)*parent.sorted1_max); // (atf_amc.FPerfSortString.sorted1)
-
-    // atf_amc.FPerfSortString.orig.Uninit (Tary)  //
-    // remove all elements from atf_amc.FPerfSortString.orig
-    orig_RemoveAll(parent);
-    // free memory for Tary atf_amc.FPerfSortString.orig
-    algo_lib::malloc_FreeMem(parent.orig_elems, sizeof(atf_amc::Cstr)*parent.orig_max); // (atf_amc.FPerfSortString.orig)
+// --- atf_amc.FTypeA.bh_typeb_curs.Add
+static void atf_amc::typea_bh_typeb_curs_Add(typea_bh_typeb_curs &curs, atf_amc::FTypeB& row) {
+    u32 n = curs.temp_n;
+    int i = n;
+    curs.temp_n = n+1;
+    atf_amc::FTypeB* *elems = curs.temp_elems;
+    while (i>0) {
+        int j = (i-1)/2;
+        atf_amc::FTypeB* p = elems[j];
+        if (!bh_typeb_ElemLt((*curs.parent), row,*p)) {
+            break;
+        }
+        elems[i]=p;
+        i=j;
+    }
+    elems[i]=&row;
 }
 
-// --- atf_amc.FTypeC.msghdr.CopyOut
-// Copy fields out of row
-void atf_amc::typec_CopyOut(atf_amc::FTypeC &row, atf_amc::TypeC &out) {
-    out.typec = row.typec;
+// --- atf_amc.FTypeA.bh_typeb_curs.Reserve
+void atf_amc::typea_bh_typeb_curs_Reserve(typea_bh_typeb_curs &curs, int n) {
+    if (n > curs.temp_max) {
+        size_t old_size   = sizeof(void*) * curs.temp_max;
+        size_t new_size   = sizeof(void*) * bh_typeb_N((*curs.parent));
+        curs.temp_elems   = (atf_amc::FTypeB**)algo_lib::malloc_ReallocMem(curs.temp_elems, old_size, new_size);
+        if (!curs.temp_elems) {
+            algo::FatalErrorExit("atf_amc.cursor_out_of_memory  func:atf_amc.FTypeA.bh_typeb_curs.Reserve");
+        }
+        curs.temp_max       = bh_typeb_N((*curs.parent));
+    }
 }
 
-// --- atf_amc.FTypeC.msghdr.CopyIn
-// Copy fields in to row
-void atf_amc::typec_CopyIn(atf_amc::FTypeC &row, atf_amc::TypeC &in) {
-    row.typec = in.typec;
+// --- atf_amc.FTypeA.bh_typeb_curs.Reset
+// Reset cursor. If HEAP is non-empty, add its top element to CURS.
+void atf_amc::typea_bh_typeb_curs_Reset(typea_bh_typeb_curs &curs, atf_amc::FTypeA &parent) {
+    curs.parent       = &parent;
+    typea_bh_typeb_curs_Reserve(curs, bh_typeb_N((*curs.parent)));
+    curs.temp_n = 0;
+    if (parent.bh_typeb_n > 0) {
+        atf_amc::FTypeB &first = *parent.bh_typeb_elems[0];
+        curs.temp_elems[0] = &first; // insert first element in heap
+        curs.temp_n = 1;
+    }
 }
 
-// --- atf_amc.FTypeC..Uninit
-void atf_amc::FTypeC_Uninit(atf_amc::FTypeC& typec) {
-    atf_amc::FTypeC &row = typec; (void)row;
-    zsl_h_typec_Remove(row); // remove typec from index zsl_h_typec
-    zs_t_typec_Remove(row); // remove typec from index zs_t_typec
-    zs_mt_typec_Remove(row); // remove typec from index zs_mt_typec
-    bh_typec_Remove(row); // remove typec from index bh_typec
-    zdl_h_typec_Remove(row); // remove typec from index zdl_h_typec
-    zd_t_typec_Remove(row); // remove typec from index zd_t_typec
-    zdl_hnt_typec_Remove(row); // remove typec from index zdl_hnt_typec
-    csl_h_typec_Remove(row); // remove typec from index csl_h_typec
-    cs_t_typec_Remove(row); // remove typec from index cs_t_typec
-    cdl_h_typec_Remove(row); // remove typec from index cdl_h_typec
-    cd_t_typec_Remove(row); // remove typec from index cd_t_typec
+// --- atf_amc.FTypeA.bh_typeb_curs.Next
+// Advance cursor.
+void atf_amc::typea_bh_typeb_curs_Next(typea_bh_typeb_curs &curs) {
+    atf_amc::FTypeB* *elems = curs.temp_elems;
+    int n = curs.temp_n;
+    if (n > 0) {
+        // remove top element from heap
+        atf_amc::FTypeB* dead = elems[0];
+        int i       = 0;
+        atf_amc::FTypeB* last = curs.temp_elems[n-1];
+        // downheap last elem
+        do {
+            atf_amc::FTypeB* choose = last;
+            int l         = i*2+1;
+            if (l<n) {
+                atf_amc::FTypeB* el = elems[l];
+                int r     = l+1;
+                r        -= r==n;
+                atf_amc::FTypeB* er = elems[r];
+                if (bh_typeb_ElemLt((*curs.parent),*er,*el)) {
+                    el  = er;
+                    l   = r;
+                }
+                bool b = bh_typeb_ElemLt((*curs.parent),*el,*last);
+                if (b) choose = el;
+                if (!b) l = n;
+            }
+            elems[i] = choose;
+            i = l;
+        } while (i < n);
+        curs.temp_n = n-1;
+        int index = dead->bh_typeb_idx;
+        i = (index*2+1);
+        if (i < bh_typeb_N((*curs.parent))) {
+            atf_amc::FTypeB &elem = *curs.parent->bh_typeb_elems[i];
+            typea_bh_typeb_curs_Add(curs, elem);
+        }
+        if (i+1 < bh_typeb_N((*curs.parent))) {
+            atf_amc::FTypeB &elem = *curs.parent->bh_typeb_elems[i + 1];
+            typea_bh_typeb_curs_Add(curs, elem);
+        }
+    }
 }
 
-// --- atf_amc.FTypeC..Print
-// print string representation of atf_amc::FTypeC to string LHS, no header -- cprint:atf_amc.FTypeC.String
-void atf_amc::FTypeC_Print(atf_amc::FTypeC & row, algo::cstring &str) {
-    i32_Print(row.typec, str);
-}
+// --- atf_amc.FTypeA..Uninit
+void atf_amc::FTypeA_Uninit(atf_amc::FTypeA& typea) {
+    atf_amc::FTypeA &row = typea; (void)row;
+    bh_typeb_Cascdel(typea); // dmmeta.cascdel:atf_amc.FTypeA.bh_typeb
+    zdl_typeb_Cascdel(typea); // dmmeta.cascdel:atf_amc.FTypeA.zdl_typeb
+    ind_typea_Remove(row); // remove typea from index ind_typea
 
-// --- atf_amc.FTypeA.msghdr.CopyOut
-// Copy fields out of row
-void atf_amc::typea_CopyOut(atf_amc::FTypeA &row, atf_amc::TypeA &out) {
-    out.typea = row.typea;
-}
+    // atf_amc.FTypeA.bh_typeb.Uninit (Bheap)  //
+    algo_lib::malloc_FreeMem((u8*)typea.bh_typeb_elems, sizeof(atf_amc::FTypeB*)*typea.bh_typeb_max); // (atf_amc.FTypeA.bh_typeb)
 
-// --- atf_amc.FTypeA.msghdr.CopyIn
-// Copy fields in to row
-void atf_amc::typea_CopyIn(atf_amc::FTypeA &row, atf_amc::TypeA &in) {
-    row.typea = in.typea;
+    // atf_amc.FTypeA.typec.Uninit (Inlary)  //
+    typec_RemoveAll(typea);
 }
 
-// --- atf_amc.FTypeA.typec.Alloc
-// Allocate memory for new default row.
-// If out of memory, process is killed.
-atf_amc::FTypeC& atf_amc::typec_Alloc(atf_amc::FTypeA& typea) {
-    atf_amc::FTypeC* row = typec_AllocMaybe(typea);
-    if (UNLIKELY(row == NULL)) {
-        FatalErrorExit("atf_amc.out_of_mem  field:atf_amc.FTypeA.typec  comment:'Alloc failed'");
-    }
-    return *row;
-}
+// --- atf_amc.FTypeA..Print
+// print string representation of atf_amc::FTypeA to string LHS, no header -- cprint:atf_amc.FTypeA.String
+void atf_amc::FTypeA_Print(atf_amc::FTypeA & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "atf_amc.FTypeA";
 
-// --- atf_amc.FTypeA.typec.AllocMaybe
-// Allocate memory for new element. If out of memory, return NULL.
-atf_amc::FTypeC* atf_amc::typec_AllocMaybe(atf_amc::FTypeA& typea) {
-    atf_amc::FTypeC *row = (atf_amc::FTypeC*)typec_AllocMem(typea);
-    if (row) {
-        new (row) atf_amc::FTypeC; // call constructor
-    }
-    return row;
+    i32_Print(row.typea, temp);
+    PrintAttrSpaceReset(str,"typea", temp);
+
+    i32_Print(row.rowid, temp);
+    PrintAttrSpaceReset(str,"rowid", temp);
 }
 
-// --- atf_amc.FTypeA.typec.InsertMaybe
-// Create new row from struct.
-// Return pointer to new element, or NULL if insertion failed (due to out-of-memory, duplicate key, etc)
-atf_amc::FTypeC* atf_amc::typec_InsertMaybe(atf_amc::FTypeA& typea, const atf_amc::TypeC &value) {
-    atf_amc::FTypeC *row = &typec_Alloc(typea); // if out of memory, process dies. if input error, return NULL.
-    typec_CopyIn(*row,const_cast<atf_amc::TypeC&>(value));
-    bool ok = typec_XrefMaybe(*row); // this may return false
-    if (!ok) {
-        typec_RemoveLast(typea); // delete offending row, any existing xrefs are cleared
-        row = NULL; // forget this ever happened
-    }
-    return row;
+// --- atf_amc.FTypeB.msghdr.CopyOut
+// Copy fields out of row
+void atf_amc::typeb_CopyOut(atf_amc::FTypeB &row, atf_amc::TypeB &out) {
+    out.typea = row.typea;
+    out.j = row.j;
+}
+
+// --- atf_amc.FTypeB.msghdr.CopyIn
+// Copy fields in to row
+void atf_amc::typeb_CopyIn(atf_amc::FTypeB &row, atf_amc::TypeB &in) {
+    row.typea = in.typea;
+    row.j = in.j;
 }
 
-// --- atf_amc.FTypeA.typec.RemoveAll
-// Destroy all elements of Inlary
-void atf_amc::typec_RemoveAll(atf_amc::FTypeA& typea) {
-    for (u64 n = typea.typec_n; n>0; ) {
-        n--;
-        reinterpret_cast<atf_amc::FTypeC*>(typea.typec_data)[n].~FTypeC(); // destroy last element
-        typea.typec_n=n;
+// --- atf_amc.FTypeB..Uninit
+void atf_amc::FTypeB_Uninit(atf_amc::FTypeB& typeb) {
+    atf_amc::FTypeB &row = typeb; (void)row;
+    atf_amc::FTypeA* p_typea = atf_amc::ind_typea_Find(row.typea);
+    if (p_typea)  {
+        zdl_typeb_Remove(*p_typea, row);// remove typeb from index zdl_typeb
+    }
+    if (p_typea)  {
+        bh_typeb_Remove(*p_typea, row);// remove typeb from index bh_typeb
     }
 }
 
-// --- atf_amc.FTypeA.typec.RemoveLast
-// Delete last element of array. Do nothing if array is empty.
-void atf_amc::typec_RemoveLast(atf_amc::FTypeA& typea) {
-    u64 n = typea.typec_n;
-    if (n > 0) {
-        n -= 1;
-        reinterpret_cast<atf_amc::FTypeC*>(typea.typec_data)[n].~FTypeC();
-        typea.typec_n = n;
-    }
+// --- atf_amc.FTypeB..Print
+// print string representation of atf_amc::FTypeB to string LHS, no header -- cprint:atf_amc.FTypeB.String
+void atf_amc::FTypeB_Print(atf_amc::FTypeB & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "atf_amc.FTypeB";
+
+    i32_Print(row.typea, temp);
+    PrintAttrSpaceReset(str,"typea", temp);
+
+    i32_Print(row.j, temp);
+    PrintAttrSpaceReset(str,"j", temp);
 }
 
-// --- atf_amc.FTypeA.typec.XrefMaybe
-// Insert row into all appropriate indices. If error occurs, store error
-// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
-bool atf_amc::typec_XrefMaybe(atf_amc::FTypeC &row) {
-    bool retval = true;
-    (void)row;
-    return retval;
+// --- atf_amc.FTypeS.msghdr.CopyOut
+// Copy fields out of row
+void atf_amc::types_CopyOut(atf_amc::FTypeS &row, atf_amc::TypeS &out) {
+    out.types = row.types;
+    out.comment = row.comment;
 }
 
-// --- atf_amc.FTypeA.zdl_typeb.Cascdel
-// Delete all elements in the linked list.
-void atf_amc::zdl_typeb_Cascdel(atf_amc::FTypeA& typea) {
-    while (atf_amc::FTypeB *zdl_typeb_first = zdl_typeb_First(typea)) {
-        typeb_Delete(*zdl_typeb_first);
-    }
+// --- atf_amc.FTypeS.msghdr.CopyIn
+// Copy fields in to row
+void atf_amc::types_CopyIn(atf_amc::FTypeS &row, atf_amc::TypeS &in) {
+    row.types = in.types;
+    row.comment = in.comment;
 }
 
-// --- atf_amc.FTypeA.zdl_typeb.Insert
+// --- atf_amc.FTypeS.zdl_typet.Insert
 // Insert row into linked list. If row is already in linked list, do nothing.
-void atf_amc::zdl_typeb_Insert(atf_amc::FTypeA& typea, atf_amc::FTypeB& row) {
-    if (!zdl_typeb_InLlistQ(row)) {
-        atf_amc::FTypeB* old_head = typea.zdl_typeb_head;
-        row.zdl_typeb_prev = NULL;
-        row.zdl_typeb_next = old_head;
-        typea.zdl_typeb_head  = &row;
-        atf_amc::FTypeB **new_row_a = &old_head->zdl_typeb_prev;
-        atf_amc::FTypeB **new_row_b = &typea.zdl_typeb_tail;
-        atf_amc::FTypeB **new_row = old_head ? new_row_a : new_row_b;
+void atf_amc::zdl_typet_Insert(atf_amc::FTypeS& types, atf_amc::FTypeT& row) {
+    if (!zdl_typet_InLlistQ(row)) {
+        atf_amc::FTypeT* old_head = types.zdl_typet_head;
+        row.zdl_typet_prev = NULL;
+        row.zdl_typet_next = old_head;
+        types.zdl_typet_head  = &row;
+        atf_amc::FTypeT **new_row_a = &old_head->zdl_typet_prev;
+        atf_amc::FTypeT **new_row_b = &types.zdl_typet_tail;
+        atf_amc::FTypeT **new_row = old_head ? new_row_a : new_row_b;
         *new_row = &row;
-        typea.zdl_typeb_n++;
+        types.zdl_typet_n++;
     }
 }
 
-// --- atf_amc.FTypeA.zdl_typeb.Remove
+// --- atf_amc.FTypeS.zdl_typet.Remove
 // Remove element from index. If element is not in index, do nothing.
-void atf_amc::zdl_typeb_Remove(atf_amc::FTypeA& typea, atf_amc::FTypeB& row) {
-    if (zdl_typeb_InLlistQ(row)) {
-        atf_amc::FTypeB* old_head       = typea.zdl_typeb_head;
+void atf_amc::zdl_typet_Remove(atf_amc::FTypeS& types, atf_amc::FTypeT& row) {
+    if (zdl_typet_InLlistQ(row)) {
+        atf_amc::FTypeT* old_head       = types.zdl_typet_head;
         (void)old_head; // in case it's not used
-        atf_amc::FTypeB* prev = row.zdl_typeb_prev;
-        atf_amc::FTypeB* next = row.zdl_typeb_next;
+        atf_amc::FTypeT* prev = row.zdl_typet_prev;
+        atf_amc::FTypeT* next = row.zdl_typet_next;
         // if element is first, adjust list head; otherwise, adjust previous element's next
-        atf_amc::FTypeB **new_next_a = &prev->zdl_typeb_next;
-        atf_amc::FTypeB **new_next_b = &typea.zdl_typeb_head;
-        atf_amc::FTypeB **new_next = prev ? new_next_a : new_next_b;
+        atf_amc::FTypeT **new_next_a = &prev->zdl_typet_next;
+        atf_amc::FTypeT **new_next_b = &types.zdl_typet_head;
+        atf_amc::FTypeT **new_next = prev ? new_next_a : new_next_b;
         *new_next = next;
         // if element is last, adjust list tail; otherwise, adjust next element's prev
-        atf_amc::FTypeB **new_prev_a = &next->zdl_typeb_prev;
-        atf_amc::FTypeB **new_prev_b = &typea.zdl_typeb_tail;
-        atf_amc::FTypeB **new_prev = next ? new_prev_a : new_prev_b;
+        atf_amc::FTypeT **new_prev_a = &next->zdl_typet_prev;
+        atf_amc::FTypeT **new_prev_b = &types.zdl_typet_tail;
+        atf_amc::FTypeT **new_prev = next ? new_prev_a : new_prev_b;
         *new_prev = prev;
-        typea.zdl_typeb_n--;
-        row.zdl_typeb_next=(atf_amc::FTypeB*)-1; // not-in-list
+        types.zdl_typet_n--;
+        row.zdl_typet_next=(atf_amc::FTypeT*)-1; // not-in-list
     }
 }
 
-// --- atf_amc.FTypeA.zdl_typeb.RemoveAll
+// --- atf_amc.FTypeS.zdl_typet.RemoveAll
 // Empty the index. (The rows are not deleted)
-void atf_amc::zdl_typeb_RemoveAll(atf_amc::FTypeA& typea) {
-    atf_amc::FTypeB* row = typea.zdl_typeb_head;
-    typea.zdl_typeb_head = NULL;
-    typea.zdl_typeb_tail = NULL;
-    typea.zdl_typeb_n = 0;
+void atf_amc::zdl_typet_RemoveAll(atf_amc::FTypeS& types) {
+    atf_amc::FTypeT* row = types.zdl_typet_head;
+    types.zdl_typet_head = NULL;
+    types.zdl_typet_tail = NULL;
+    types.zdl_typet_n = 0;
     while (row) {
-        atf_amc::FTypeB* row_next = row->zdl_typeb_next;
-        row->zdl_typeb_next  = (atf_amc::FTypeB*)-1;
-        row->zdl_typeb_prev  = NULL;
+        atf_amc::FTypeT* row_next = row->zdl_typet_next;
+        row->zdl_typet_next  = (atf_amc::FTypeT*)-1;
+        row->zdl_typet_prev  = NULL;
         row = row_next;
     }
 }
 
-// --- atf_amc.FTypeA.zdl_typeb.RemoveFirst
+// --- atf_amc.FTypeS.zdl_typet.RemoveFirst
 // If linked list is empty, return NULL. Otherwise unlink and return pointer to first element.
-atf_amc::FTypeB* atf_amc::zdl_typeb_RemoveFirst(atf_amc::FTypeA& typea) {
-    atf_amc::FTypeB *row = NULL;
-    row = typea.zdl_typeb_head;
+atf_amc::FTypeT* atf_amc::zdl_typet_RemoveFirst(atf_amc::FTypeS& types) {
+    atf_amc::FTypeT *row = NULL;
+    row = types.zdl_typet_head;
     if (row) {
-        atf_amc::FTypeB *next = row->zdl_typeb_next;
-        typea.zdl_typeb_head = next;
-        atf_amc::FTypeB **new_end_a = &next->zdl_typeb_prev;
-        atf_amc::FTypeB **new_end_b = &typea.zdl_typeb_tail;
-        atf_amc::FTypeB **new_end = next ? new_end_a : new_end_b;
+        atf_amc::FTypeT *next = row->zdl_typet_next;
+        types.zdl_typet_head = next;
+        atf_amc::FTypeT **new_end_a = &next->zdl_typet_prev;
+        atf_amc::FTypeT **new_end_b = &types.zdl_typet_tail;
+        atf_amc::FTypeT **new_end = next ? new_end_a : new_end_b;
         *new_end = NULL;
-        typea.zdl_typeb_n--;
-        row->zdl_typeb_next = (atf_amc::FTypeB*)-1; // mark as not-in-list
+        types.zdl_typet_n--;
+        row->zdl_typet_next = (atf_amc::FTypeT*)-1; // mark as not-in-list
     }
     return row;
 }
 
-// --- atf_amc.FTypeA.bh_typeb.Cascdel
-// Delete referred-to items.
-// Delete all elements referenced by the heap.
-void atf_amc::bh_typeb_Cascdel(atf_amc::FTypeA& typea) {
-    i32 n = typea.bh_typeb_n;
-    while (n > 0) {
-        n--;
-        atf_amc::FTypeB &elem = *typea.bh_typeb_elems[n]; // pick cheapest element to remove
-        elem.bh_typeb_idx = -1; // mark not-in-heap
-        typea.bh_typeb_n = n;
-        typeb_Delete(elem);
+// --- atf_amc.FTypeS..Uninit
+void atf_amc::FTypeS_Uninit(atf_amc::FTypeS& types) {
+    atf_amc::FTypeS &row = types; (void)row;
+    ind_types_Remove(row); // remove types from index ind_types
+}
+
+// --- atf_amc.FTypeS..Print
+// print string representation of atf_amc::FTypeS to string LHS, no header -- cprint:atf_amc.FTypeS.String
+void atf_amc::FTypeS_Print(atf_amc::FTypeS & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "atf_amc.FTypeS";
+
+    i32_Print(row.types, temp);
+    PrintAttrSpaceReset(str,"types", temp);
+
+    algo::Comment_Print(row.comment, temp);
+    PrintAttrSpaceReset(str,"comment", temp);
+}
+
+// --- atf_amc.FTypeT.msghdr.CopyOut
+// Copy fields out of row
+void atf_amc::typet_CopyOut(atf_amc::FTypeT &row, atf_amc::TypeT &out) {
+    out.types = row.types;
+    out.j = row.j;
+}
+
+// --- atf_amc.FTypeT.msghdr.CopyIn
+// Copy fields in to row
+void atf_amc::typet_CopyIn(atf_amc::FTypeT &row, atf_amc::TypeT &in) {
+    row.types = in.types;
+    row.j = in.j;
+}
+
+// --- atf_amc.FTypeT..Uninit
+void atf_amc::FTypeT_Uninit(atf_amc::FTypeT& typet) {
+    atf_amc::FTypeT &row = typet; (void)row;
+    atf_amc::FTypeS* p_types = atf_amc::ind_types_Find(row.types);
+    if (p_types)  {
+        zdl_typet_Remove(*p_types, row);// remove typet from index zdl_typet
     }
 }
 
-// --- atf_amc.FTypeA.bh_typeb.Dealloc
-// Remove all elements from heap and free memory used by the array.
-void atf_amc::bh_typeb_Dealloc(atf_amc::FTypeA& typea) {
-    bh_typeb_RemoveAll(typea);
-    algo_lib::malloc_FreeMem(typea.bh_typeb_elems, sizeof(atf_amc::FTypeB*)*typea.bh_typeb_max);
-    typea.bh_typeb_max   = 0;
-    typea.bh_typeb_elems = NULL;
+// --- atf_amc.FTypeT..Print
+// print string representation of atf_amc::FTypeT to string LHS, no header -- cprint:atf_amc.FTypeT.String
+void atf_amc::FTypeT_Print(atf_amc::FTypeT & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "atf_amc.FTypeT";
+
+    i32_Print(row.types, temp);
+    PrintAttrSpaceReset(str,"types", temp);
+
+    i32_Print(row.j, temp);
+    PrintAttrSpaceReset(str,"j", temp);
+}
+
+// --- atf_amc.TypeA..ReadStrptrMaybe
+// Read fields of atf_amc::TypeA from an ascii string.
+// The format of the string is the format of the atf_amc::TypeA's only field
+bool atf_amc::TypeA_ReadStrptrMaybe(atf_amc::TypeA &parent, algo::strptr in_str) {
+    bool retval = true;
+    retval = retval && i32_ReadStrptrMaybe(parent.typea, in_str);
+    return retval;
+}
+
+// --- atf_amc.TypeA..Print
+// print string representation of atf_amc::TypeA to string LHS, no header -- cprint:atf_amc.TypeA.String
+void atf_amc::TypeA_Print(atf_amc::TypeA & row, algo::cstring &str) {
+    i32_Print(row.typea, str);
+}
+
+// --- atf_amc.TypeA..FmtJson
+// Create JSON representation of atf_amc::TypeA under PARENT node -- cprint:atf_amc.TypeA.Json
+lib_json::FNode * atf_amc::TypeA_FmtJson(atf_amc::TypeA & row, lib_json::FNode *parent) {
+    return i32_FmtJson(const_cast<atf_amc::TypeA&>(row).typea,parent);;
+}
+
+// --- atf_amc.FUnitSort.tary.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_amc::TypeA& atf_amc::tary_Alloc(atf_amc::FUnitSort& parent) {
+    tary_Reserve(parent, 1);
+    int n  = parent.tary_n;
+    int at = n;
+    atf_amc::TypeA *elems = parent.tary_elems;
+    new (elems + at) atf_amc::TypeA(); // construct new element, default initializer
+    parent.tary_n = n+1;
+    return elems[at];
 }
 
-// --- atf_amc.FTypeA.bh_typeb.Downheap
-// Find new location for ROW starting at IDX
-// NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
-static int atf_amc::bh_typeb_Downheap(atf_amc::FTypeA& typea, atf_amc::FTypeB& row, int idx) {
-    atf_amc::FTypeB* *elems = typea.bh_typeb_elems;
-    int n = typea.bh_typeb_n;
-    int child = idx*2+1;
-    while (child < n) {
-        atf_amc::FTypeB* p = elems[child]; // left child
-        int rchild = child+1;
-        if (rchild < n) {
-            atf_amc::FTypeB* q = elems[rchild]; // right child
-            if (bh_typeb_ElemLt(typea, *q,*p)) {
-                child = rchild;
-                p     = q;
-            }
-        }
-        if (!bh_typeb_ElemLt(typea, *p,row)) {
-            break;
-        }
-        p->bh_typeb_idx   = idx;
-        elems[idx]     = p;
-        idx            = child;
-        child          = idx*2+1;
+// --- atf_amc.FUnitSort.tary.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_amc::TypeA& atf_amc::tary_AllocAt(atf_amc::FUnitSort& parent, int at) {
+    tary_Reserve(parent, 1);
+    int n  = parent.tary_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("atf_amc.bad_alloc_at  field:atf_amc.FUnitSort.tary  comment:'index out of range'");
     }
-    return idx;
+    atf_amc::TypeA *elems = parent.tary_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(atf_amc::TypeA));
+    new (elems + at) atf_amc::TypeA(); // construct element, default initializer
+    parent.tary_n = n+1;
+    return elems[at];
 }
 
-// --- atf_amc.FTypeA.bh_typeb.Insert
-// Insert row. Row must not already be in index. If row is already in index, do nothing.
-void atf_amc::bh_typeb_Insert(atf_amc::FTypeA& typea, atf_amc::FTypeB& row) {
-    if (LIKELY(row.bh_typeb_idx == -1)) {
-        bh_typeb_Reserve(typea, 1);
-        int n = typea.bh_typeb_n;
-        typea.bh_typeb_n = n + 1;
-        int new_idx = bh_typeb_Upheap(typea, row, n);
-        row.bh_typeb_idx = new_idx;
-        typea.bh_typeb_elems[new_idx] = &row;
+// --- atf_amc.FUnitSort.tary.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_amc::TypeA> atf_amc::tary_AllocN(atf_amc::FUnitSort& parent, int n_elems) {
+    tary_Reserve(parent, n_elems);
+    int old_n  = parent.tary_n;
+    int new_n = old_n + n_elems;
+    atf_amc::TypeA *elems = parent.tary_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) atf_amc::TypeA(); // construct new element, default initialize
     }
+    parent.tary_n = new_n;
+    return algo::aryptr<atf_amc::TypeA>(elems + old_n, n_elems);
 }
 
-// --- atf_amc.FTypeA.bh_typeb.Reheap
-// If row is in heap, update its position. If row is not in heap, insert it.
-// Return new position of item in the heap (0=top)
-i32 atf_amc::bh_typeb_Reheap(atf_amc::FTypeA& typea, atf_amc::FTypeB& row) {
-    int old_idx = row.bh_typeb_idx;
-    bool isnew = old_idx == -1;
-    if (isnew) {
-        bh_typeb_Reserve(typea, 1);
-        old_idx = typea.bh_typeb_n++;
-    }
-    int new_idx = bh_typeb_Upheap(typea, row, old_idx);
-    if (!isnew && new_idx == old_idx) {
-        new_idx = bh_typeb_Downheap(typea, row, old_idx);
+// --- atf_amc.FUnitSort.tary.Remove
+// Remove item by index. If index outside of range, do nothing.
+void atf_amc::tary_Remove(atf_amc::FUnitSort& parent, u32 i) {
+    u32 lim = parent.tary_n;
+    atf_amc::TypeA *elems = parent.tary_elems;
+    if (i < lim) {
+        elems[i].~TypeA(); // destroy element
+        memmove(elems + i, elems + (i + 1), sizeof(atf_amc::TypeA) * (lim - (i + 1)));
+        parent.tary_n = lim - 1;
     }
-    row.bh_typeb_idx = new_idx;
-    typea.bh_typeb_elems[new_idx] = &row;
-    return new_idx;
-}
-
-// --- atf_amc.FTypeA.bh_typeb.ReheapFirst
-// Key of first element in the heap changed. Move it.
-// This function does not check the insert condition.
-// Return new position of item in the heap (0=top).
-// Heap must be non-empty or behavior is undefined.
-i32 atf_amc::bh_typeb_ReheapFirst(atf_amc::FTypeA& typea) {
-    atf_amc::FTypeB &row = *typea.bh_typeb_elems[0];
-    i32 new_idx = bh_typeb_Downheap(typea, row, 0);
-    row.bh_typeb_idx = new_idx;
-    typea.bh_typeb_elems[new_idx] = &row;
-    return new_idx;
 }
 
-// --- atf_amc.FTypeA.bh_typeb.Remove
-// Remove element from index. If element is not in index, do nothing.
-void atf_amc::bh_typeb_Remove(atf_amc::FTypeA& typea, atf_amc::FTypeB& row) {
-    if (bh_typeb_InBheapQ(row)) {
-        int old_idx = row.bh_typeb_idx;
-        if (typea.bh_typeb_elems[old_idx] == &row) { // sanity check: heap points back to row
-            row.bh_typeb_idx = -1;           // mark not in heap
-            i32 n = typea.bh_typeb_n - 1; // index of last element in heap
-            typea.bh_typeb_n = n;         // decrease count
-            if (old_idx != n) {
-                atf_amc::FTypeB *elem = typea.bh_typeb_elems[n];
-                int new_idx = bh_typeb_Upheap(typea, *elem, old_idx);
-                if (new_idx == old_idx) {
-                    new_idx = bh_typeb_Downheap(typea, *elem, old_idx);
-                }
-                elem->bh_typeb_idx = new_idx;
-                typea.bh_typeb_elems[new_idx] = elem;
-            }
-        }
+// --- atf_amc.FUnitSort.tary.RemoveAll
+void atf_amc::tary_RemoveAll(atf_amc::FUnitSort& parent) {
+    u32 n = parent.tary_n;
+    while (n > 0) {
+        n -= 1;
+        parent.tary_elems[n].~TypeA();
+        parent.tary_n = n;
     }
 }
 
-// --- atf_amc.FTypeA.bh_typeb.RemoveAll
-// Remove all elements from binary heap
-void atf_amc::bh_typeb_RemoveAll(atf_amc::FTypeA& typea) {
-    int n = typea.bh_typeb_n;
-    for (int i = n - 1; i>=0; i--) {
-        typea.bh_typeb_elems[i]->bh_typeb_idx = -1; // mark not-in-heap
+// --- atf_amc.FUnitSort.tary.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_amc::tary_RemoveLast(atf_amc::FUnitSort& parent) {
+    u64 n = parent.tary_n;
+    if (n > 0) {
+        n -= 1;
+        tary_qFind(parent, u64(n)).~TypeA();
+        parent.tary_n = n;
     }
-    typea.bh_typeb_n = 0;
 }
 
-// --- atf_amc.FTypeA.bh_typeb.RemoveFirst
-// If index is empty, return NULL. Otherwise remove and return first key in index.
-//  Call 'head changed' trigger.
-atf_amc::FTypeB* atf_amc::bh_typeb_RemoveFirst(atf_amc::FTypeA& typea) {
-    atf_amc::FTypeB *row = NULL;
-    if (typea.bh_typeb_n > 0) {
-        row = typea.bh_typeb_elems[0];
-        row->bh_typeb_idx = -1;           // mark not in heap
-        i32 n = typea.bh_typeb_n - 1; // index of last element in heap
-        typea.bh_typeb_n = n;         // decrease count
-        if (n) {
-            atf_amc::FTypeB &elem = *typea.bh_typeb_elems[n];
-            int new_idx = bh_typeb_Downheap(typea, elem, 0);
-            elem.bh_typeb_idx = new_idx;
-            typea.bh_typeb_elems[new_idx] = &elem;
-        }
+// --- atf_amc.FUnitSort.tary.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void atf_amc::tary_AbsReserve(atf_amc::FUnitSort& parent, int n) {
+    u32 old_max  = parent.tary_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(parent.tary_elems, old_max * sizeof(atf_amc::TypeA), new_max * sizeof(atf_amc::TypeA));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("atf_amc.tary_nomem  field:atf_amc.FUnitSort.tary  comment:'out of memory'");
     }
-    return row;
+    parent.tary_elems = (atf_amc::TypeA*)new_mem;
+    parent.tary_max = new_max;
 }
 
-// --- atf_amc.FTypeA.bh_typeb.Reserve
-// Reserve space in index for N more elements
-void atf_amc::bh_typeb_Reserve(atf_amc::FTypeA& typea, int n) {
-    i32 old_max = typea.bh_typeb_max;
-    if (UNLIKELY(typea.bh_typeb_n + n > old_max)) {
-        u32 new_max  = u32_Max(4, old_max * 2);
-        u32 old_size = old_max * sizeof(atf_amc::FTypeB*);
-        u32 new_size = new_max * sizeof(atf_amc::FTypeB*);
-        void *new_mem = algo_lib::malloc_ReallocMem(typea.bh_typeb_elems, old_size, new_size);
-        if (UNLIKELY(!new_mem)) {
-            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FTypeA.bh_typeb");
-        }
-        typea.bh_typeb_elems = (atf_amc::FTypeB**)new_mem;
-        typea.bh_typeb_max = new_max;
+// --- atf_amc.FUnitSort.tary.Setary
+// Copy contents of RHS to PARENT.
+void atf_amc::tary_Setary(atf_amc::FUnitSort& parent, atf_amc::FUnitSort &rhs) {
+    tary_RemoveAll(parent);
+    int nnew = rhs.tary_n;
+    tary_Reserve(parent, nnew); // reserve space
+    for (int i = 0; i < nnew; i++) { // copy elements over
+        new (parent.tary_elems + i) atf_amc::TypeA(tary_qFind(rhs, i));
+        parent.tary_n = i + 1;
     }
 }
 
-// --- atf_amc.FTypeA.bh_typeb.Upheap
-// Find and return index of new location for element ROW in the heap, starting at index IDX.
-// Move any elements along the way but do not modify ROW.
-static int atf_amc::bh_typeb_Upheap(atf_amc::FTypeA& typea, atf_amc::FTypeB& row, int idx) {
-    atf_amc::FTypeB* *elems = typea.bh_typeb_elems;
-    while (idx>0) {
-        int j = (idx-1)/2;
-        atf_amc::FTypeB* p = elems[j];
-        if (!bh_typeb_ElemLt(typea, row, *p)) {
-            break;
-        }
-        p->bh_typeb_idx = idx;
-        elems[idx] = p;
-        idx = j;
-    }
-    return idx;
+// --- atf_amc.FUnitSort.tary.Swap
+// Swap values elem_a and elem_b
+inline static void atf_amc::tary_Swap(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+    u8 temp[sizeof(atf_amc::TypeA)];
+    memcpy(&temp  , &elem_a, sizeof(atf_amc::TypeA));
+    memcpy(&elem_a, &elem_b, sizeof(atf_amc::TypeA));
+    memcpy(&elem_b, &temp  , sizeof(atf_amc::TypeA));
 }
 
-// --- atf_amc.FTypeA.bh_typeb.ElemLt
-inline static bool atf_amc::bh_typeb_ElemLt(atf_amc::FTypeA& typea, atf_amc::FTypeB &a, atf_amc::FTypeB &b) {
-    (void)typea;
-    return a.j < b.j;
+// --- atf_amc.FUnitSort.tary.Rotleft
+// Left circular shift of three-tuple
+inline static void atf_amc::tary_Rotleft(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b, atf_amc::TypeA &elem_c) {
+    u8 temp[sizeof(atf_amc::TypeA)];
+    memcpy(&temp, &elem_a   , sizeof(atf_amc::TypeA));
+    memcpy(&elem_a   , &elem_b   , sizeof(atf_amc::TypeA));
+    memcpy(&elem_b   , &elem_c   , sizeof(atf_amc::TypeA));
+    memcpy(&elem_c   , &temp, sizeof(atf_amc::TypeA));
 }
 
-// --- atf_amc.FTypeA..Init
-// Set all fields to initial values.
-void atf_amc::FTypeA_Init(atf_amc::FTypeA& typea) {
-    typea.typea = i32(0);
-    typea.typec_n = 0; // typec: initialize count
-    typea.zdl_typeb_head = NULL; // (atf_amc.FTypeA.zdl_typeb)
-    typea.zdl_typeb_n = 0; // (atf_amc.FTypeA.zdl_typeb)
-    typea.zdl_typeb_tail = NULL; // (atf_amc.FTypeA.zdl_typeb)
-    typea.rowid = i32(0);
-    typea.bh_typeb_max   	= 0; // (atf_amc.FTypeA.bh_typeb)
-    typea.bh_typeb_n     	= 0; // (atf_amc.FTypeA.bh_typeb)
-    typea.bh_typeb_elems 	= NULL; // (atf_amc.FTypeA.bh_typeb)
-    typea.ind_typea_next = (atf_amc::FTypeA*)-1; // (atf_amc.FDb.ind_typea) not-in-hash
+// --- atf_amc.FUnitSort.tary.Lt
+// Compare values elem_a and elem_b
+// The comparison function must be anti-symmetric: if a>b, then !(b>a).
+// If not, mayhem results.
+static bool atf_amc::tary_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+    bool ret;
+    ret = elem_a.typea < elem_b.typea;
+    return ret;
 }
 
-// --- atf_amc.FTypeA.bh_typeb_curs.Add
-static void atf_amc::typea_bh_typeb_curs_Add(typea_bh_typeb_curs &curs, atf_amc::FTypeB& row) {
-    u32 n = curs.temp_n;
-    int i = n;
-    curs.temp_n = n+1;
-    atf_amc::FTypeB* *elems = curs.temp_elems;
-    while (i>0) {
-        int j = (i-1)/2;
-        atf_amc::FTypeB* p = elems[j];
-        if (!bh_typeb_ElemLt((*curs.parent), row,*p)) {
-            break;
+// --- atf_amc.FUnitSort.tary.SortedQ
+// Verify whether array is sorted
+bool atf_amc::tary_SortedQ(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = tary_Getary(parent).elems;
+    int n = tary_N(parent);
+    for (int i = 1; i < n; i++) {
+        if (tary_Lt(elems[i], elems[i-1])) {
+            return false;
         }
-        elems[i]=p;
-        i=j;
     }
-    elems[i]=&row;
+    return true;
 }
 
-// --- atf_amc.FTypeA.bh_typeb_curs.Reserve
-void atf_amc::typea_bh_typeb_curs_Reserve(typea_bh_typeb_curs &curs, int n) {
-    if (n > curs.temp_max) {
-        size_t old_size   = sizeof(void*) * curs.temp_max;
-        size_t new_size   = sizeof(void*) * bh_typeb_N((*curs.parent));
-        curs.temp_elems   = (atf_amc::FTypeB**)algo_lib::malloc_ReallocMem(curs.temp_elems, old_size, new_size);
-        if (!curs.temp_elems) {
-            algo::FatalErrorExit("atf_amc.cursor_out_of_memory  func:atf_amc.FTypeA.bh_typeb_curs.Reserve");
+// --- atf_amc.FUnitSort.tary.IntInsertionSort
+// Internal insertion sort
+static void atf_amc::tary_IntInsertionSort(atf_amc::TypeA *elems, int n) {
+    for (int i = 1; i < n; ++i) {
+        int j = i;
+        // find the spot for ith element.
+        while (j>0 && tary_Lt(elems[i], elems[j-1])) {
+            j--;
+        }
+        if (j<i) {
+            u8 tmp[sizeof(atf_amc::TypeA)];
+            memcpy (tmp                       , &elems[i], sizeof(atf_amc::TypeA)      );
+            memmove(&elems[j+1], &elems[j], sizeof(atf_amc::TypeA)*(i-j));
+            memcpy (&elems[j]  , tmp                     , sizeof(atf_amc::TypeA)      );
         }
-        curs.temp_max       = bh_typeb_N((*curs.parent));
     }
 }
 
-// --- atf_amc.FTypeA.bh_typeb_curs.Reset
-// Reset cursor. If HEAP is non-empty, add its top element to CURS.
-void atf_amc::typea_bh_typeb_curs_Reset(typea_bh_typeb_curs &curs, atf_amc::FTypeA &parent) {
-    curs.parent       = &parent;
-    typea_bh_typeb_curs_Reserve(curs, bh_typeb_N((*curs.parent)));
-    curs.temp_n = 0;
-    if (parent.bh_typeb_n > 0) {
-        atf_amc::FTypeB &first = *parent.bh_typeb_elems[0];
-        curs.temp_elems[0] = &first; // insert first element in heap
-        curs.temp_n = 1;
+// --- atf_amc.FUnitSort.tary.IntHeapSort
+// Internal heap sort
+static void atf_amc::tary_IntHeapSort(atf_amc::TypeA *elems, int n) {
+    // construct max-heap.
+    // k=current element
+    // j=parent element
+    for (int i = 1; i < n; i++) {
+        int k=i;
+        int j=(i-1)/2;
+        while (tary_Lt(elems[j], elems[k])) {
+            tary_Swap(elems[k],elems[j]);
+            k=j;
+            j=(k-1)/2;
+        }
+    }
+    // remove elements from heap one-by-one,
+    // deposit them in reverse order starting at the end of ARY.
+    for (int i = n - 1; i>=0; i--) {
+        int k = 0;
+        int l = 1;
+        while (l<i) {
+            l += l<i-1 && tary_Lt(elems[l], elems[l+1]);
+            if (tary_Lt(elems[l], elems[i])) {
+                break;
+            }
+            tary_Swap(elems[k], elems[l]);
+            k = l;
+            l = k*2+1;
+        }
+        if (i != k) {
+            tary_Swap(elems[i],elems[k]);
+        }
     }
 }
 
-// --- atf_amc.FTypeA.bh_typeb_curs.Next
-// Advance cursor.
-void atf_amc::typea_bh_typeb_curs_Next(typea_bh_typeb_curs &curs) {
-    atf_amc::FTypeB* *elems = curs.temp_elems;
-    int n = curs.temp_n;
-    if (n > 0) {
-        // remove top element from heap
-        atf_amc::FTypeB* dead = elems[0];
-        int i       = 0;
-        atf_amc::FTypeB* last = curs.temp_elems[n-1];
-        // downheap last elem
-        do {
-            atf_amc::FTypeB* choose = last;
-            int l         = i*2+1;
-            if (l<n) {
-                atf_amc::FTypeB* el = elems[l];
-                int r     = l+1;
-                r        -= r==n;
-                atf_amc::FTypeB* er = elems[r];
-                if (bh_typeb_ElemLt((*curs.parent),*er,*el)) {
-                    el  = er;
-                    l   = r;
-                }
-                bool b = bh_typeb_ElemLt((*curs.parent),*el,*last);
-                if (b) choose = el;
-                if (!b) l = n;
+// --- atf_amc.FUnitSort.tary.IntQuickSort
+// Quick sort engine
+static void atf_amc::tary_IntQuickSort(atf_amc::TypeA *elems, int n, int depth) {
+    while (n>16) {
+        // detect degenerate case and revert to heap sort
+        if (depth==0) {
+            tary_IntHeapSort(elems,n);
+            return;
+        }
+        // elements to sort initially to determine pivot.
+        // choose pp=n/2 in case the input is already sorted.
+        int pi = 0;
+        int pp = n/2;
+        int pj = n-1;
+        // insertion sort for 1st, middle and last element
+        if (tary_Lt(elems[pp], elems[pi])) {
+            tary_Swap(elems[pi], elems[pp]);
+        }
+        if (tary_Lt(elems[pj], elems[pp])) {
+            if (tary_Lt(elems[pj], elems[pi])) {
+                tary_Rotleft(elems[pi], elems[pj], elems[pp]);
+            } else {
+                tary_Swap(elems[pj], elems[pp]);
             }
-            elems[i] = choose;
-            i = l;
-        } while (i < n);
-        curs.temp_n = n-1;
-        int index = dead->bh_typeb_idx;
-        i = (index*2+1);
-        if (i < bh_typeb_N((*curs.parent))) {
-            atf_amc::FTypeB &elem = *curs.parent->bh_typeb_elems[i];
-            typea_bh_typeb_curs_Add(curs, elem);
         }
-        if (i+1 < bh_typeb_N((*curs.parent))) {
-            atf_amc::FTypeB &elem = *curs.parent->bh_typeb_elems[i + 1];
-            typea_bh_typeb_curs_Add(curs, elem);
+        // deposit pivot near the end of the array and skip it.
+        tary_Swap(elems[--pj], elems[pp]);
+        // reference to pivot
+        atf_amc::TypeA &pivot = elems[pj];
+        for(;;){
+            while (tary_Lt(elems[++pi], pivot)) {
+            }
+            while (tary_Lt(pivot, elems[--pj])) {
+            }
+            if (pj <= pi) {
+                break;
+            }
+            tary_Swap(elems[pi],elems[pj]);
         }
+        depth -= 1;
+        tary_IntQuickSort(elems, pi, depth);
+        elems += pi;
+        n -= pi;
     }
+    // sort the remainder of this section
+    tary_IntInsertionSort(elems,n);
 }
 
-// --- atf_amc.FTypeA..Uninit
-void atf_amc::FTypeA_Uninit(atf_amc::FTypeA& typea) {
-    atf_amc::FTypeA &row = typea; (void)row;
-    bh_typeb_Cascdel(typea); // dmmeta.cascdel:atf_amc.FTypeA.bh_typeb
-    zdl_typeb_Cascdel(typea); // dmmeta.cascdel:atf_amc.FTypeA.zdl_typeb
-    ind_typea_Remove(row); // remove typea from index ind_typea
+// --- atf_amc.FUnitSort.tary.InsertionSort
+// Insertion sort
+void atf_amc::tary_InsertionSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = tary_Getary(parent).elems;
+    int n = tary_N(parent);
+    tary_IntInsertionSort(elems, n);
+}
 
-    // atf_amc.FTypeA.bh_typeb.Uninit (Bheap)  //
-    algo_lib::malloc_FreeMem((u8*)typea.bh_typeb_elems, sizeof(atf_amc::FTypeB*)*typea.bh_typeb_max); // (atf_amc.FTypeA.bh_typeb)
+// --- atf_amc.FUnitSort.tary.HeapSort
+// Heap sort
+void atf_amc::tary_HeapSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = tary_Getary(parent).elems;
+    int n = tary_N(parent);
+    tary_IntHeapSort(elems, n);
+}
 
-    // atf_amc.FTypeA.typec.Uninit (Inlary)  //
-    typec_RemoveAll(typea);
+// --- atf_amc.FUnitSort.tary.QuickSort
+// Quick sort
+void atf_amc::tary_QuickSort(atf_amc::FUnitSort& parent) {
+    // compute max recursion depth based on number of elements in the array
+    int max_depth = CeilingLog2(u32(tary_N(parent) + 1)) + 3;
+    atf_amc::TypeA *elems = tary_Getary(parent).elems;
+    int n = tary_N(parent);
+    tary_IntQuickSort(elems, n, max_depth);
 }
 
-// --- atf_amc.FTypeA..Print
-// print string representation of atf_amc::FTypeA to string LHS, no header -- cprint:atf_amc.FTypeA.String
-void atf_amc::FTypeA_Print(atf_amc::FTypeA & row, algo::cstring &str) {
-    algo::tempstr temp;
-    str << "atf_amc.FTypeA";
+// --- atf_amc.FUnitSort.tary.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool atf_amc::tary_XrefMaybe(atf_amc::TypeA &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
 
-    i32_Print(row.typea, temp);
-    PrintAttrSpaceReset(str,"typea", temp);
+// --- atf_amc.FUnitSort.c_ptrary.Insert
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void atf_amc::c_ptrary_Insert(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) {
+    // reserve space
+    c_ptrary_Reserve(parent, 1);
+    u32 n  = parent.c_ptrary_n;
+    u32 at = n;
+    atf_amc::TypeA* *elems = parent.c_ptrary_elems;
+    elems[at] = &row;
+    parent.c_ptrary_n = n+1;
 
-    i32_Print(row.rowid, temp);
-    PrintAttrSpaceReset(str,"rowid", temp);
 }
 
-// --- atf_amc.FTypeB.msghdr.CopyOut
-// Copy fields out of row
-void atf_amc::typeb_CopyOut(atf_amc::FTypeB &row, atf_amc::TypeB &out) {
-    out.typea = row.typea;
-    out.j = row.j;
+// --- atf_amc.FUnitSort.c_ptrary.ScanInsertMaybe
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool atf_amc::c_ptrary_ScanInsertMaybe(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) {
+    bool retval = true;
+    u32 n  = parent.c_ptrary_n;
+    for (u32 i = 0; i < n; i++) {
+        if (parent.c_ptrary_elems[i] == &row) {
+            retval = false;
+            break;
+        }
+    }
+    if (retval) {
+        // reserve space
+        c_ptrary_Reserve(parent, 1);
+        parent.c_ptrary_elems[n] = &row;
+        parent.c_ptrary_n = n+1;
+    }
+    return retval;
+}
+
+// --- atf_amc.FUnitSort.c_ptrary.Remove
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void atf_amc::c_ptrary_Remove(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) {
+    int lim = parent.c_ptrary_n;
+    atf_amc::TypeA* *elems = parent.c_ptrary_elems;
+    // search backward, so that most recently added element is found first.
+    // if found, shift array.
+    for (int i = lim-1; i>=0; i--) {
+        atf_amc::TypeA* elem = elems[i]; // fetch element
+        if (elem == &row) {
+            int j = i + 1;
+            size_t nbytes = sizeof(atf_amc::TypeA*) * (lim - j);
+            memmove(elems + i, elems + j, nbytes);
+            parent.c_ptrary_n = lim - 1;
+            break;
+        }
+    }
+}
+
+// --- atf_amc.FUnitSort.c_ptrary.Reserve
+// Reserve space in index for N more elements;
+void atf_amc::c_ptrary_Reserve(atf_amc::FUnitSort& parent, u32 n) {
+    u32 old_max = parent.c_ptrary_max;
+    if (UNLIKELY(parent.c_ptrary_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(atf_amc::TypeA*);
+        u32 new_size = new_max * sizeof(atf_amc::TypeA*);
+        void *new_mem = algo_lib::malloc_ReallocMem(parent.c_ptrary_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FUnitSort.c_ptrary");
+        }
+        parent.c_ptrary_elems = (atf_amc::TypeA**)new_mem;
+        parent.c_ptrary_max = new_max;
+    }
 }
 
-// --- atf_amc.FTypeB.msghdr.CopyIn
-// Copy fields in to row
-void atf_amc::typeb_CopyIn(atf_amc::FTypeB &row, atf_amc::TypeB &in) {
-    row.typea = in.typea;
-    row.j = in.j;
+// --- atf_amc.FUnitSort.c_ptrary.Swap
+// Swap values elem_a and elem_b
+inline static void atf_amc::c_ptrary_Swap(atf_amc::TypeA* &elem_a, atf_amc::TypeA* &elem_b) {
+    atf_amc::TypeA *temp = elem_a;
+    elem_a = elem_b;
+    elem_b = temp;
 }
 
-// --- atf_amc.FTypeB..Uninit
-void atf_amc::FTypeB_Uninit(atf_amc::FTypeB& typeb) {
-    atf_amc::FTypeB &row = typeb; (void)row;
-    atf_amc::FTypeA* p_typea = atf_amc::ind_typea_Find(row.typea);
-    if (p_typea)  {
-        zdl_typeb_Remove(*p_typea, row);// remove typeb from index zdl_typeb
-    }
-    if (p_typea)  {
-        bh_typeb_Remove(*p_typea, row);// remove typeb from index bh_typeb
-    }
+// --- atf_amc.FUnitSort.c_ptrary.Rotleft
+// Left circular shift of three-tuple
+inline static void atf_amc::c_ptrary_Rotleft(atf_amc::TypeA* &elem_a, atf_amc::TypeA* &elem_b, atf_amc::TypeA* &elem_c) {
+    atf_amc::TypeA *temp = elem_a;
+    elem_a = elem_b;
+    elem_b = elem_c;
+    elem_c = temp;
 }
 
-// --- atf_amc.FTypeB..Print
-// print string representation of atf_amc::FTypeB to string LHS, no header -- cprint:atf_amc.FTypeB.String
-void atf_amc::FTypeB_Print(atf_amc::FTypeB & row, algo::cstring &str) {
-    algo::tempstr temp;
-    str << "atf_amc.FTypeB";
-
-    i32_Print(row.typea, temp);
-    PrintAttrSpaceReset(str,"typea", temp);
-
-    i32_Print(row.j, temp);
-    PrintAttrSpaceReset(str,"j", temp);
+// --- atf_amc.FUnitSort.c_ptrary.Lt
+// Compare values elem_a and elem_b
+// The comparison function must be anti-symmetric: if a>b, then !(b>a).
+// If not, mayhem results.
+static bool atf_amc::c_ptrary_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+    bool ret;
+    ret = elem_a.typea < elem_b.typea;
+    return ret;
 }
 
-// --- atf_amc.FTypeS.msghdr.CopyOut
-// Copy fields out of row
-void atf_amc::types_CopyOut(atf_amc::FTypeS &row, atf_amc::TypeS &out) {
-    out.types = row.types;
-    out.comment = row.comment;
+// --- atf_amc.FUnitSort.c_ptrary.SortedQ
+// Verify whether array is sorted
+bool atf_amc::c_ptrary_SortedQ(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA* *elems = c_ptrary_Getary(parent).elems;
+    int n = c_ptrary_N(parent);
+    for (int i = 1; i < n; i++) {
+        if (c_ptrary_Lt(*elems[i], *elems[i-1])) {
+            return false;
+        }
+    }
+    return true;
 }
 
-// --- atf_amc.FTypeS.msghdr.CopyIn
-// Copy fields in to row
-void atf_amc::types_CopyIn(atf_amc::FTypeS &row, atf_amc::TypeS &in) {
-    row.types = in.types;
-    row.comment = in.comment;
+// --- atf_amc.FUnitSort.c_ptrary.IntInsertionSort
+// Internal insertion sort
+static void atf_amc::c_ptrary_IntInsertionSort(atf_amc::TypeA* *elems, int n) {
+    for (int i = 1; i < n; ++i) {
+        int j = i;
+        atf_amc::TypeA *tmp = elems[i];
+        // shift elements up by one
+        if (c_ptrary_Lt(*tmp, *elems[j-1])) {
+            do {
+                elems[j] = elems[j-1];
+                j--;
+            } while (j>0 && c_ptrary_Lt(*tmp, *elems[j-1]));
+            elems[j] = tmp;
+        }
+    }
 }
 
-// --- atf_amc.FTypeS.zdl_typet.Insert
-// Insert row into linked list. If row is already in linked list, do nothing.
-void atf_amc::zdl_typet_Insert(atf_amc::FTypeS& types, atf_amc::FTypeT& row) {
-    if (!zdl_typet_InLlistQ(row)) {
-        atf_amc::FTypeT* old_head = types.zdl_typet_head;
-        row.zdl_typet_prev = NULL;
-        row.zdl_typet_next = old_head;
-        types.zdl_typet_head  = &row;
-        atf_amc::FTypeT **new_row_a = &old_head->zdl_typet_prev;
-        atf_amc::FTypeT **new_row_b = &types.zdl_typet_tail;
-        atf_amc::FTypeT **new_row = old_head ? new_row_a : new_row_b;
-        *new_row = &row;
-        types.zdl_typet_n++;
+// --- atf_amc.FUnitSort.c_ptrary.IntHeapSort
+// Internal heap sort
+static void atf_amc::c_ptrary_IntHeapSort(atf_amc::TypeA* *elems, int n) {
+    // construct max-heap.
+    // k=current element
+    // j=parent element
+    for (int i = 1; i < n; i++) {
+        int k=i;
+        int j=(i-1)/2;
+        while (c_ptrary_Lt(*elems[j], *elems[k])) {
+            c_ptrary_Swap(elems[k],elems[j]);
+            k=j;
+            j=(k-1)/2;
+        }
+    }
+    // remove elements from heap one-by-one,
+    // deposit them in reverse order starting at the end of ARY.
+    for (int i = n - 1; i>=0; i--) {
+        int k = 0;
+        int l = 1;
+        while (l<i) {
+            l += l<i-1 && c_ptrary_Lt(*elems[l], *elems[l+1]);
+            if (c_ptrary_Lt(*elems[l], *elems[i])) {
+                break;
+            }
+            c_ptrary_Swap(elems[k], elems[l]);
+            k = l;
+            l = k*2+1;
+        }
+        if (i != k) {
+            c_ptrary_Swap(elems[i],elems[k]);
+        }
     }
 }
 
-// --- atf_amc.FTypeS.zdl_typet.Remove
-// Remove element from index. If element is not in index, do nothing.
-void atf_amc::zdl_typet_Remove(atf_amc::FTypeS& types, atf_amc::FTypeT& row) {
-    if (zdl_typet_InLlistQ(row)) {
-        atf_amc::FTypeT* old_head       = types.zdl_typet_head;
-        (void)old_head; // in case it's not used
-        atf_amc::FTypeT* prev = row.zdl_typet_prev;
-        atf_amc::FTypeT* next = row.zdl_typet_next;
-        // if element is first, adjust list head; otherwise, adjust previous element's next
-        atf_amc::FTypeT **new_next_a = &prev->zdl_typet_next;
-        atf_amc::FTypeT **new_next_b = &types.zdl_typet_head;
-        atf_amc::FTypeT **new_next = prev ? new_next_a : new_next_b;
-        *new_next = next;
-        // if element is last, adjust list tail; otherwise, adjust next element's prev
-        atf_amc::FTypeT **new_prev_a = &next->zdl_typet_prev;
-        atf_amc::FTypeT **new_prev_b = &types.zdl_typet_tail;
-        atf_amc::FTypeT **new_prev = next ? new_prev_a : new_prev_b;
-        *new_prev = prev;
-        types.zdl_typet_n--;
-        row.zdl_typet_next=(atf_amc::FTypeT*)-1; // not-in-list
+// --- atf_amc.FUnitSort.c_ptrary.IntQuickSort
+// Quick sort engine
+static void atf_amc::c_ptrary_IntQuickSort(atf_amc::TypeA* *elems, int n, int depth) {
+    while (n>16) {
+        // detect degenerate case and revert to heap sort
+        if (depth==0) {
+            c_ptrary_IntHeapSort(elems,n);
+            return;
+        }
+        // elements to sort initially to determine pivot.
+        // choose pp=n/2 in case the input is already sorted.
+        int pi = 0;
+        int pp = n/2;
+        int pj = n-1;
+        // insertion sort for 1st, middle and last element
+        if (c_ptrary_Lt(*elems[pp], *elems[pi])) {
+            c_ptrary_Swap(elems[pi], elems[pp]);
+        }
+        if (c_ptrary_Lt(*elems[pj], *elems[pp])) {
+            if (c_ptrary_Lt(*elems[pj], *elems[pi])) {
+                c_ptrary_Rotleft(elems[pi], elems[pj], elems[pp]);
+            } else {
+                c_ptrary_Swap(elems[pj], elems[pp]);
+            }
+        }
+        // deposit pivot near the end of the array and skip it.
+        c_ptrary_Swap(elems[--pj], elems[pp]);
+        // copy pivot into temporary variable
+        atf_amc::TypeA *pivot = elems[pj];
+        for(;;){
+            while (c_ptrary_Lt(*elems[++pi], *pivot)) {
+            }
+            while (c_ptrary_Lt(*pivot, *elems[--pj])) {
+            }
+            if (pj <= pi) {
+                break;
+            }
+            c_ptrary_Swap(elems[pi],elems[pj]);
+        }
+        depth -= 1;
+        c_ptrary_IntQuickSort(elems, pi, depth);
+        elems += pi;
+        n -= pi;
     }
+    // sort the remainder of this section
+    c_ptrary_IntInsertionSort(elems,n);
 }
 
-// --- atf_amc.FTypeS.zdl_typet.RemoveAll
-// Empty the index. (The rows are not deleted)
-void atf_amc::zdl_typet_RemoveAll(atf_amc::FTypeS& types) {
-    atf_amc::FTypeT* row = types.zdl_typet_head;
-    types.zdl_typet_head = NULL;
-    types.zdl_typet_tail = NULL;
-    types.zdl_typet_n = 0;
-    while (row) {
-        atf_amc::FTypeT* row_next = row->zdl_typet_next;
-        row->zdl_typet_next  = (atf_amc::FTypeT*)-1;
-        row->zdl_typet_prev  = NULL;
-        row = row_next;
-    }
+// --- atf_amc.FUnitSort.c_ptrary.InsertionSort
+// Insertion sort
+void atf_amc::c_ptrary_InsertionSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA* *elems = c_ptrary_Getary(parent).elems;
+    int n = c_ptrary_N(parent);
+    c_ptrary_IntInsertionSort(elems, n);
 }
 
-// --- atf_amc.FTypeS.zdl_typet.RemoveFirst
-// If linked list is empty, return NULL. Otherwise unlink and return pointer to first element.
-atf_amc::FTypeT* atf_amc::zdl_typet_RemoveFirst(atf_amc::FTypeS& types) {
-    atf_amc::FTypeT *row = NULL;
-    row = types.zdl_typet_head;
-    if (row) {
-        atf_amc::FTypeT *next = row->zdl_typet_next;
-        types.zdl_typet_head = next;
-        atf_amc::FTypeT **new_end_a = &next->zdl_typet_prev;
-        atf_amc::FTypeT **new_end_b = &types.zdl_typet_tail;
-        atf_amc::FTypeT **new_end = next ? new_end_a : new_end_b;
-        *new_end = NULL;
-        types.zdl_typet_n--;
-        row->zdl_typet_next = (atf_amc::FTypeT*)-1; // mark as not-in-list
-    }
-    return row;
+// --- atf_amc.FUnitSort.c_ptrary.HeapSort
+// Heap sort
+void atf_amc::c_ptrary_HeapSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA* *elems = c_ptrary_Getary(parent).elems;
+    int n = c_ptrary_N(parent);
+    c_ptrary_IntHeapSort(elems, n);
 }
 
-// --- atf_amc.FTypeS..Uninit
-void atf_amc::FTypeS_Uninit(atf_amc::FTypeS& types) {
-    atf_amc::FTypeS &row = types; (void)row;
-    ind_types_Remove(row); // remove types from index ind_types
+// --- atf_amc.FUnitSort.c_ptrary.QuickSort
+// Quick sort
+void atf_amc::c_ptrary_QuickSort(atf_amc::FUnitSort& parent) {
+    // compute max recursion depth based on number of elements in the array
+    int max_depth = CeilingLog2(u32(c_ptrary_N(parent) + 1)) + 3;
+    atf_amc::TypeA* *elems = c_ptrary_Getary(parent).elems;
+    int n = c_ptrary_N(parent);
+    c_ptrary_IntQuickSort(elems, n, max_depth);
 }
 
-// --- atf_amc.FTypeS..Print
-// print string representation of atf_amc::FTypeS to string LHS, no header -- cprint:atf_amc.FTypeS.String
-void atf_amc::FTypeS_Print(atf_amc::FTypeS & row, algo::cstring &str) {
-    algo::tempstr temp;
-    str << "atf_amc.FTypeS";
-
-    i32_Print(row.types, temp);
-    PrintAttrSpaceReset(str,"types", temp);
-
-    algo::Comment_Print(row.comment, temp);
-    PrintAttrSpaceReset(str,"comment", temp);
+// --- atf_amc.FUnitSort.fixary.Swap
+// Swap values elem_a and elem_b
+inline static void atf_amc::fixary_Swap(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+    u8 temp[sizeof(atf_amc::TypeA)];
+    memcpy(&temp  , &elem_a, sizeof(atf_amc::TypeA));
+    memcpy(&elem_a, &elem_b, sizeof(atf_amc::TypeA));
+    memcpy(&elem_b, &temp  , sizeof(atf_amc::TypeA));
 }
 
-// --- atf_amc.FTypeT.msghdr.CopyOut
-// Copy fields out of row
-void atf_amc::typet_CopyOut(atf_amc::FTypeT &row, atf_amc::TypeT &out) {
-    out.types = row.types;
-    out.j = row.j;
+// --- atf_amc.FUnitSort.fixary.Rotleft
+// Left circular shift of three-tuple
+inline static void atf_amc::fixary_Rotleft(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b, atf_amc::TypeA &elem_c) {
+    u8 temp[sizeof(atf_amc::TypeA)];
+    memcpy(&temp, &elem_a   , sizeof(atf_amc::TypeA));
+    memcpy(&elem_a   , &elem_b   , sizeof(atf_amc::TypeA));
+    memcpy(&elem_b   , &elem_c   , sizeof(atf_amc::TypeA));
+    memcpy(&elem_c   , &temp, sizeof(atf_amc::TypeA));
 }
 
-// --- atf_amc.FTypeT.msghdr.CopyIn
-// Copy fields in to row
-void atf_amc::typet_CopyIn(atf_amc::FTypeT &row, atf_amc::TypeT &in) {
-    row.types = in.types;
-    row.j = in.j;
+// --- atf_amc.FUnitSort.fixary.Lt
+// Compare values elem_a and elem_b
+// The comparison function must be anti-symmetric: if a>b, then !(b>a).
+// If not, mayhem results.
+static bool atf_amc::fixary_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+    bool ret;
+    ret = elem_a.typea < elem_b.typea;
+    return ret;
 }
 
-// --- atf_amc.FTypeT..Uninit
-void atf_amc::FTypeT_Uninit(atf_amc::FTypeT& typet) {
-    atf_amc::FTypeT &row = typet; (void)row;
-    atf_amc::FTypeS* p_types = atf_amc::ind_types_Find(row.types);
-    if (p_types)  {
-        zdl_typet_Remove(*p_types, row);// remove typet from index zdl_typet
+// --- atf_amc.FUnitSort.fixary.SortedQ
+// Verify whether array is sorted
+bool atf_amc::fixary_SortedQ(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = fixary_Getary(parent).elems;
+    int n = fixary_N(parent);
+    for (int i = 1; i < n; i++) {
+        if (fixary_Lt(elems[i], elems[i-1])) {
+            return false;
+        }
     }
+    return true;
 }
 
-// --- atf_amc.FTypeT..Print
-// print string representation of atf_amc::FTypeT to string LHS, no header -- cprint:atf_amc.FTypeT.String
-void atf_amc::FTypeT_Print(atf_amc::FTypeT & row, algo::cstring &str) {
-    algo::tempstr temp;
-    str << "atf_amc.FTypeT";
+// --- atf_amc.FUnitSort.fixary.IntInsertionSort
+// Internal insertion sort
+static void atf_amc::fixary_IntInsertionSort(atf_amc::TypeA *elems, int n) {
+    for (int i = 1; i < n; ++i) {
+        int j = i;
+        // find the spot for ith element.
+        while (j>0 && fixary_Lt(elems[i], elems[j-1])) {
+            j--;
+        }
+        if (j<i) {
+            u8 tmp[sizeof(atf_amc::TypeA)];
+            memcpy (tmp                       , &elems[i], sizeof(atf_amc::TypeA)      );
+            memmove(&elems[j+1], &elems[j], sizeof(atf_amc::TypeA)*(i-j));
+            memcpy (&elems[j]  , tmp                     , sizeof(atf_amc::TypeA)      );
+        }
+    }
+}
 
-    i32_Print(row.types, temp);
-    PrintAttrSpaceReset(str,"types", temp);
+// --- atf_amc.FUnitSort.fixary.IntHeapSort
+// Internal heap sort
+static void atf_amc::fixary_IntHeapSort(atf_amc::TypeA *elems, int n) {
+    // construct max-heap.
+    // k=current element
+    // j=parent element
+    for (int i = 1; i < n; i++) {
+        int k=i;
+        int j=(i-1)/2;
+        while (fixary_Lt(elems[j], elems[k])) {
+            fixary_Swap(elems[k],elems[j]);
+            k=j;
+            j=(k-1)/2;
+        }
+    }
+    // remove elements from heap one-by-one,
+    // deposit them in reverse order starting at the end of ARY.
+    for (int i = n - 1; i>=0; i--) {
+        int k = 0;
+        int l = 1;
+        while (l<i) {
+            l += l<i-1 && fixary_Lt(elems[l], elems[l+1]);
+            if (fixary_Lt(elems[l], elems[i])) {
+                break;
+            }
+            fixary_Swap(elems[k], elems[l]);
+            k = l;
+            l = k*2+1;
+        }
+        if (i != k) {
+            fixary_Swap(elems[i],elems[k]);
+        }
+    }
+}
 
-    i32_Print(row.j, temp);
-    PrintAttrSpaceReset(str,"j", temp);
+// --- atf_amc.FUnitSort.fixary.IntQuickSort
+// Quick sort engine
+static void atf_amc::fixary_IntQuickSort(atf_amc::TypeA *elems, int n, int depth) {
+    while (n>16) {
+        // detect degenerate case and revert to heap sort
+        if (depth==0) {
+            fixary_IntHeapSort(elems,n);
+            return;
+        }
+        // elements to sort initially to determine pivot.
+        // choose pp=n/2 in case the input is already sorted.
+        int pi = 0;
+        int pp = n/2;
+        int pj = n-1;
+        // insertion sort for 1st, middle and last element
+        if (fixary_Lt(elems[pp], elems[pi])) {
+            fixary_Swap(elems[pi], elems[pp]);
+        }
+        if (fixary_Lt(elems[pj], elems[pp])) {
+            if (fixary_Lt(elems[pj], elems[pi])) {
+                fixary_Rotleft(elems[pi], elems[pj], elems[pp]);
+            } else {
+                fixary_Swap(elems[pj], elems[pp]);
+            }
+        }
+        // deposit pivot near the end of the array and skip it.
+        fixary_Swap(elems[--pj], elems[pp]);
+        // reference to pivot
+        atf_amc::TypeA &pivot = elems[pj];
+        for(;;){
+            while (fixary_Lt(elems[++pi], pivot)) {
+            }
+            while (fixary_Lt(pivot, elems[--pj])) {
+            }
+            if (pj <= pi) {
+                break;
+            }
+            fixary_Swap(elems[pi],elems[pj]);
+        }
+        depth -= 1;
+        fixary_IntQuickSort(elems, pi, depth);
+        elems += pi;
+        n -= pi;
+    }
+    // sort the remainder of this section
+    fixary_IntInsertionSort(elems,n);
 }
 
-// --- atf_amc.TypeA..ReadStrptrMaybe
-// Read fields of atf_amc::TypeA from an ascii string.
-// The format of the string is the format of the atf_amc::TypeA's only field
-bool atf_amc::TypeA_ReadStrptrMaybe(atf_amc::TypeA &parent, algo::strptr in_str) {
-    bool retval = true;
-    retval = retval && i32_ReadStrptrMaybe(parent.typea, in_str);
-    return retval;
+// --- atf_amc.FUnitSort.fixary.InsertionSort
+// Insertion sort
+void atf_amc::fixary_InsertionSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = fixary_Getary(parent).elems;
+    int n = fixary_N(parent);
+    fixary_IntInsertionSort(elems, n);
 }
 
-// --- atf_amc.TypeA..Print
-// print string representation of atf_amc::TypeA to string LHS, no header -- cprint:atf_amc.TypeA.String
-void atf_amc::TypeA_Print(atf_amc::TypeA & row, algo::cstring &str) {
-    i32_Print(row.typea, str);
+// --- atf_amc.FUnitSort.fixary.HeapSort
+// Heap sort
+void atf_amc::fixary_HeapSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = fixary_Getary(parent).elems;
+    int n = fixary_N(parent);
+    fixary_IntHeapSort(elems, n);
 }
 
-// --- atf_amc.TypeA..FmtJson
-// Create JSON representation of atf_amc::TypeA under PARENT node -- cprint:atf_amc.TypeA.Json
-lib_json::FNode * atf_amc::TypeA_FmtJson(atf_amc::TypeA & row, lib_json::FNode *parent) {
-    return i32_FmtJson(const_cast<atf_amc::TypeA&>(row).typea,parent);;
+// --- atf_amc.FUnitSort.fixary.QuickSort
+// Quick sort
+void atf_amc::fixary_QuickSort(atf_amc::FUnitSort& parent) {
+    // compute max recursion depth based on number of elements in the array
+    int max_depth = CeilingLog2(u32(fixary_N(parent) + 1)) + 3;
+    atf_amc::TypeA *elems = fixary_Getary(parent).elems;
+    int n = fixary_N(parent);
+    fixary_IntQuickSort(elems, n, max_depth);
 }
 
-// --- atf_amc.FUnitSort.tary.Alloc
+// --- atf_amc.FUnitSort.radix.Alloc
 // Reserve space. Insert element at the end
 // The new element is initialized to a default value
-atf_amc::TypeA& atf_amc::tary_Alloc(atf_amc::FUnitSort& parent) {
-    tary_Reserve(parent, 1);
-    int n  = parent.tary_n;
+atf_amc::TypeA& atf_amc::radix_Alloc(atf_amc::FUnitSort& parent) {
+    radix_Reserve(parent, 1);
+    int n  = parent.radix_n;
     int at = n;
-    atf_amc::TypeA *elems = parent.tary_elems;
+    atf_amc::TypeA *elems = parent.radix_elems;
     new (elems + at) atf_amc::TypeA(); // construct new element, default initializer
-    parent.tary_n = n+1;
+    parent.radix_n = n+1;
     return elems[at];
 }
 
-// --- atf_amc.FUnitSort.tary.AllocAt
+// --- atf_amc.FUnitSort.radix.AllocAt
 // Reserve space for new element, reallocating the array if necessary
 // Insert new element at specified index. Index must be in range or a fatal error occurs.
-atf_amc::TypeA& atf_amc::tary_AllocAt(atf_amc::FUnitSort& parent, int at) {
-    tary_Reserve(parent, 1);
-    int n  = parent.tary_n;
+atf_amc::TypeA& atf_amc::radix_AllocAt(atf_amc::FUnitSort& parent, int at) {
+    radix_Reserve(parent, 1);
+    int n  = parent.radix_n;
     if (UNLIKELY(u64(at) >= u64(n+1))) {
-        FatalErrorExit("atf_amc.bad_alloc_at  field:atf_amc.FUnitSort.tary  comment:'index out of range'");
+        FatalErrorExit("atf_amc.bad_alloc_at  field:atf_amc.FUnitSort.radix  comment:'index out of range'");
     }
-    atf_amc::TypeA *elems = parent.tary_elems;
+    atf_amc::TypeA *elems = parent.radix_elems;
     memmove(elems + at + 1, elems + at, (n - at) * sizeof(atf_amc::TypeA));
     new (elems + at) atf_amc::TypeA(); // construct element, default initializer
-    parent.tary_n = n+1;
+    parent.radix_n = n+1;
     return elems[at];
 }
 
-// --- atf_amc.FUnitSort.tary.AllocN
+// --- atf_amc.FUnitSort.radix.AllocN
 // Reserve space. Insert N elements at the end of the array, return pointer to array
-algo::aryptr<atf_amc::TypeA> atf_amc::tary_AllocN(atf_amc::FUnitSort& parent, int n_elems) {
-    tary_Reserve(parent, n_elems);
-    int old_n  = parent.tary_n;
+algo::aryptr<atf_amc::TypeA> atf_amc::radix_AllocN(atf_amc::FUnitSort& parent, int n_elems) {
+    radix_Reserve(parent, n_elems);
+    int old_n  = parent.radix_n;
     int new_n = old_n + n_elems;
-    atf_amc::TypeA *elems = parent.tary_elems;
+    atf_amc::TypeA *elems = parent.radix_elems;
     for (int i = old_n; i < new_n; i++) {
         new (elems + i) atf_amc::TypeA(); // construct new element, default initialize
     }
-    parent.tary_n = new_n;
+    parent.radix_n = new_n;
     return algo::aryptr<atf_amc::TypeA>(elems + old_n, n_elems);
 }
 
-// --- atf_amc.FUnitSort.tary.Remove
+// --- atf_amc.FUnitSort.radix.Remove
 // Remove item by index. If index outside of range, do nothing.
-void atf_amc::tary_Remove(atf_amc::FUnitSort& parent, u32 i) {
-    u32 lim = parent.tary_n;
-    atf_amc::TypeA *elems = parent.tary_elems;
+void atf_amc::radix_Remove(atf_amc::FUnitSort& parent, u32 i) {
+    u32 lim = parent.radix_n;
+    atf_amc::TypeA *elems = parent.radix_elems;
     if (i < lim) {
         elems[i].~TypeA(); // destroy element
         memmove(elems + i, elems + (i + 1), sizeof(atf_amc::TypeA) * (lim - (i + 1)));
-        parent.tary_n = lim - 1;
+        parent.radix_n = lim - 1;
     }
 }
 
-// --- atf_amc.FUnitSort.tary.RemoveAll
-void atf_amc::tary_RemoveAll(atf_amc::FUnitSort& parent) {
-    u32 n = parent.tary_n;
+// --- atf_amc.FUnitSort.radix.RemoveAll
+void atf_amc::radix_RemoveAll(atf_amc::FUnitSort& parent) {
+    u32 n = parent.radix_n;
     while (n > 0) {
         n -= 1;
-        parent.tary_elems[n].~TypeA();
-        parent.tary_n = n;
+        parent.radix_elems[n].~TypeA();
+        parent.radix_n = n;
     }
 }
 
-// --- atf_amc.FUnitSort.tary.RemoveLast
+// --- atf_amc.FUnitSort.radix.RemoveLast
 // Delete last element of array. Do nothing if array is empty.
-void atf_amc::tary_RemoveLast(atf_amc::FUnitSort& parent) {
-    u64 n = parent.tary_n;
+void atf_amc::radix_RemoveLast(atf_amc::FUnitSort& parent) {
+    u64 n = parent.radix_n;
     if (n > 0) {
         n -= 1;
-        tary_qFind(parent, u64(n)).~TypeA();
-        parent.tary_n = n;
+        radix_qFind(parent, u64(n)).~TypeA();
+        parent.radix_n = n;
     }
 }
 
-// --- atf_amc.FUnitSort.tary.AbsReserve
+// --- atf_amc.FUnitSort.radix.AbsReserve
 // Make sure N elements fit in array. Process dies if out of memory
-void atf_amc::tary_AbsReserve(atf_amc::FUnitSort& parent, int n) {
-    u32 old_max  = parent.tary_max;
+void atf_amc::radix_AbsReserve(atf_amc::FUnitSort& parent, int n) {
+    u32 old_max  = parent.radix_max;
     u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
-    void *new_mem = algo_lib::malloc_ReallocMem(parent.tary_elems, old_max * sizeof(atf_amc::TypeA), new_max * sizeof(atf_amc::TypeA));
+    void *new_mem = algo_lib::malloc_ReallocMem(parent.radix_elems, old_max * sizeof(atf_amc::TypeA), new_max * sizeof(atf_amc::TypeA));
     if (UNLIKELY(!new_mem)) {
-        FatalErrorExit("atf_amc.tary_nomem  field:atf_amc.FUnitSort.tary  comment:'out of memory'");
-    }
-    parent.tary_elems = (atf_amc::TypeA*)new_mem;
-    parent.tary_max = new_max;
+        FatalErrorExit("atf_amc.tary_nomem  field:atf_amc.FUnitSort.radix  comment:'out of memory'");
+    }
+    parent.radix_elems = (atf_amc::TypeA*)new_mem;
+    parent.radix_max = new_max;
 }
 
-// --- atf_amc.FUnitSort.tary.Setary
+// --- atf_amc.FUnitSort.radix.Setary
 // Copy contents of RHS to PARENT.
-void atf_amc::tary_Setary(atf_amc::FUnitSort& parent, atf_amc::FUnitSort &rhs) {
-    tary_RemoveAll(parent);
-    int nnew = rhs.tary_n;
-    tary_Reserve(parent, nnew); // reserve space
+void atf_amc::radix_Setary(atf_amc::FUnitSort& parent, atf_amc::FUnitSort &rhs) {
+    radix_RemoveAll(parent);
+    int nnew = rhs.radix_n;
+    radix_Reserve(parent, nnew); // reserve space
     for (int i = 0; i < nnew; i++) { // copy elements over
-        new (parent.tary_elems + i) atf_amc::TypeA(tary_qFind(rhs, i));
-        parent.tary_n = i + 1;
+        new (parent.radix_elems + i) atf_amc::TypeA(radix_qFind(rhs, i));
+        parent.radix_n = i + 1;
     }
 }
 
-// --- atf_amc.FUnitSort.tary.Swap
+// --- atf_amc.FUnitSort.radix.Swap
 // Swap values elem_a and elem_b
-inline static void atf_amc::tary_Swap(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+inline static void atf_amc::radix_Swap(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
     u8 temp[sizeof(atf_amc::TypeA)];
     memcpy(&temp  , &elem_a, sizeof(atf_amc::TypeA));
     memcpy(&elem_a, &elem_b, sizeof(atf_amc::TypeA));
     memcpy(&elem_b, &temp  , sizeof(atf_amc::TypeA));
 }
 
-// --- atf_amc.FUnitSort.tary.Rotleft
+// --- atf_amc.FUnitSort.radix.Rotleft
 // Left circular shift of three-tuple
-inline static void atf_amc::tary_Rotleft(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b, atf_amc::TypeA &elem_c) {
+inline static void atf_amc::radix_Rotleft(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b, atf_amc::TypeA &elem_c) {
     u8 temp[sizeof(atf_amc::TypeA)];
     memcpy(&temp, &elem_a   , sizeof(atf_amc::TypeA));
     memcpy(&elem_a   , &elem_b   , sizeof(atf_amc::TypeA));
@@ -7605,207 +11924,112 @@ inline static void atf_amc::tary_Rotleft(atf_amc::TypeA &elem_a, atf_amc::TypeA
     memcpy(&elem_c   , &temp, sizeof(atf_amc::TypeA));
 }
 
-// --- atf_amc.FUnitSort.tary.Lt
+// --- atf_amc.FUnitSort.radix.Lt
 // Compare values elem_a and elem_b
 // The comparison function must be anti-symmetric: if a>b, then !(b>a).
 // If not, mayhem results.
-static bool atf_amc::tary_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+static bool atf_amc::radix_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
     bool ret;
     ret = elem_a.typea < elem_b.typea;
     return ret;
 }
 
-// --- atf_amc.FUnitSort.tary.SortedQ
+// --- atf_amc.FUnitSort.radix.SortedQ
 // Verify whether array is sorted
-bool atf_amc::tary_SortedQ(atf_amc::FUnitSort& parent) {
-    atf_amc::TypeA *elems = tary_Getary(parent).elems;
-    int n = tary_N(parent);
+bool atf_amc::radix_SortedQ(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = radix_Getary(parent).elems;
+    int n = radix_N(parent);
     for (int i = 1; i < n; i++) {
-        if (tary_Lt(elems[i], elems[i-1])) {
+        if (radix_Lt(elems[i], elems[i-1])) {
             return false;
         }
     }
     return true;
 }
 
-// --- atf_amc.FUnitSort.tary.IntInsertionSort
-// Internal insertion sort
-static void atf_amc::tary_IntInsertionSort(atf_amc::TypeA *elems, int n) {
-    for (int i = 1; i < n; ++i) {
-        int j = i;
-        // find the spot for ith element.
-        while (j>0 && tary_Lt(elems[i], elems[j-1])) {
-            j--;
-        }
-        if (j<i) {
-            u8 tmp[sizeof(atf_amc::TypeA)];
-            memcpy (tmp                       , &elems[i], sizeof(atf_amc::TypeA)      );
-            memmove(&elems[j+1], &elems[j], sizeof(atf_amc::TypeA)*(i-j));
-            memcpy (&elems[j]  , tmp                     , sizeof(atf_amc::TypeA)      );
-        }
-    }
+// --- atf_amc.FUnitSort.radix.RadixKey
+// Extract radix key word WORD (0=most significant) from ELEM.
+// Unsigned comparison of keys gives the same order as radix_Lt.
+inline static u64 atf_amc::radix_RadixKey(atf_amc::TypeA &elem, int word) {
+    (void)word;
+    return u64(i64(elem.typea)) ^ (u64(1) << 63);
 }
 
-// --- atf_amc.FUnitSort.tary.IntHeapSort
-// Internal heap sort
-static void atf_amc::tary_IntHeapSort(atf_amc::TypeA *elems, int n) {
-    // construct max-heap.
-    // k=current element
-    // j=parent element
-    for (int i = 1; i < n; i++) {
-        int k=i;
-        int j=(i-1)/2;
-        while (tary_Lt(elems[j], elems[k])) {
-            tary_Swap(elems[k],elems[j]);
-            k=j;
-            j=(k-1)/2;
-        }
+// --- atf_amc.FUnitSort.radix.RadixSort
+// Radix sort (stable)
+// Keys are extracted into a temp array, sorted with LSD byte radix
+// (one round per key word, least significant first), then elements
+// are moved to their final positions in one pass.
+void atf_amc::radix_RadixSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = radix_Getary(parent).elems;
+    int n = radix_N(parent);
+    if (n < 2) {
+        return;
     }
-    // remove elements from heap one-by-one,
-    // deposit them in reverse order starting at the end of ARY.
-    for (int i = n - 1; i>=0; i--) {
-        int k = 0;
-        int l = 1;
-        while (l<i) {
-            l += l<i-1 && tary_Lt(elems[l], elems[l+1]);
-            if (tary_Lt(elems[l], elems[i])) {
-                break;
-            }
-            tary_Swap(elems[k], elems[l]);
-            k = l;
-            l = k*2+1;
-        }
-        if (i != k) {
-            tary_Swap(elems[i],elems[k]);
-        }
+    algo::RadixKey *buf = (algo::RadixKey*)algo_lib::malloc_AllocMem(sizeof(algo::RadixKey) * n * 2);
+    algo::RadixKey *keys = buf;
+    algo::RadixKey *tmp = buf + n;
+    for (int i = 0; i < n; i++) {
+        keys[i].idx = i;
     }
-}
-
-// --- atf_amc.FUnitSort.tary.IntQuickSort
-// Quick sort engine
-static void atf_amc::tary_IntQuickSort(atf_amc::TypeA *elems, int n, int depth) {
-    while (n>16) {
-        // detect degenerate case and revert to heap sort
-        if (depth==0) {
-            tary_IntHeapSort(elems,n);
-            return;
-        }
-        // elements to sort initially to determine pivot.
-        // choose pp=n/2 in case the input is already sorted.
-        int pi = 0;
-        int pp = n/2;
-        int pj = n-1;
-        // insertion sort for 1st, middle and last element
-        if (tary_Lt(elems[pp], elems[pi])) {
-            tary_Swap(elems[pi], elems[pp]);
-        }
-        if (tary_Lt(elems[pj], elems[pp])) {
-            if (tary_Lt(elems[pj], elems[pi])) {
-                tary_Rotleft(elems[pi], elems[pj], elems[pp]);
-            } else {
-                tary_Swap(elems[pj], elems[pp]);
-            }
-        }
-        // deposit pivot near the end of the array and skip it.
-        tary_Swap(elems[--pj], elems[pp]);
-        // reference to pivot
-        atf_amc::TypeA &pivot = elems[pj];
-        for(;;){
-            while (tary_Lt(elems[++pi], pivot)) {
-            }
-            while (tary_Lt(pivot, elems[--pj])) {
-            }
-            if (pj <= pi) {
-                break;
-            }
-            tary_Swap(elems[pi],elems[pj]);
+    for (int word = 1 - 1; word >= 0; word--) {
+        for (int i = 0; i < n; i++) {
+            keys[i].key = radix_RadixKey(elems[keys[i].idx], word);
         }
-        depth -= 1;
-        tary_IntQuickSort(elems, pi, depth);
-        elems += pi;
-        n -= pi;
+        algo_lib::RadixSortKeys(keys, tmp, n);
     }
-    // sort the remainder of this section
-    tary_IntInsertionSort(elems,n);
-}
-
-// --- atf_amc.FUnitSort.tary.InsertionSort
-// Insertion sort
-void atf_amc::tary_InsertionSort(atf_amc::FUnitSort& parent) {
-    atf_amc::TypeA *elems = tary_Getary(parent).elems;
-    int n = tary_N(parent);
-    tary_IntInsertionSort(elems, n);
-}
-
-// --- atf_amc.FUnitSort.tary.HeapSort
-// Heap sort
-void atf_amc::tary_HeapSort(atf_amc::FUnitSort& parent) {
-    atf_amc::TypeA *elems = tary_Getary(parent).elems;
-    int n = tary_N(parent);
-    tary_IntHeapSort(elems, n);
-}
-
-// --- atf_amc.FUnitSort.tary.QuickSort
-// Quick sort
-void atf_amc::tary_QuickSort(atf_amc::FUnitSort& parent) {
-    // compute max recursion depth based on number of elements in the array
-    int max_depth = CeilingLog2(u32(tary_N(parent) + 1)) + 3;
-    atf_amc::TypeA *elems = tary_Getary(parent).elems;
-    int n = tary_N(parent);
-    tary_IntQuickSort(elems, n, max_depth);
-}
-
-// --- atf_amc.FUnitSort.tary.XrefMaybe
-// Insert row into all appropriate indices. If error occurs, store error
-// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
-bool atf_amc::tary_XrefMaybe(atf_amc::TypeA &row) {
-    bool retval = true;
-    (void)row;
-    return retval;
+    // move elements into place (bitwise, as in Swap)
+    atf_amc::TypeA *copy = (atf_amc::TypeA*)algo_lib::malloc_AllocMem(sizeof(atf_amc::TypeA) * n);
+    memcpy((void*)copy, (void*)elems, sizeof(atf_amc::TypeA) * n);
+    for (int i = 0; i < n; i++) {
+        memcpy((void*)(elems + i), (void*)(copy + keys[i].idx), sizeof(atf_amc::TypeA));
+    }
+    algo_lib::malloc_FreeMem(copy, sizeof(atf_amc::TypeA) * n);
+    algo_lib::malloc_FreeMem(buf, sizeof(algo::RadixKey) * n * 2);
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.Insert
+// --- atf_amc.FUnitSort.c_radix.Insert
 // Insert pointer to row into array. Row must not already be in array.
 // If pointer is already in the array, it may be inserted twice.
-void atf_amc::c_ptrary_Insert(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) {
+void atf_amc::c_radix_Insert(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) {
     // reserve space
-    c_ptrary_Reserve(parent, 1);
-    u32 n  = parent.c_ptrary_n;
+    c_radix_Reserve(parent, 1);
+    u32 n  = parent.c_radix_n;
     u32 at = n;
-    atf_amc::TypeA* *elems = parent.c_ptrary_elems;
+    atf_amc::TypeA* *elems = parent.c_radix_elems;
     elems[at] = &row;
-    parent.c_ptrary_n = n+1;
+    parent.c_radix_n = n+1;
 
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.ScanInsertMaybe
+// --- atf_amc.FUnitSort.c_radix.ScanInsertMaybe
 // Insert pointer to row in array.
 // If row is already in the array, do nothing.
 // Linear search is used to locate the element.
 // Return value: whether element was inserted into array.
-bool atf_amc::c_ptrary_ScanInsertMaybe(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) {
+bool atf_amc::c_radix_ScanInsertMaybe(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) {
     bool retval = true;
-    u32 n  = parent.c_ptrary_n;
+    u32 n  = parent.c_radix_n;
     for (u32 i = 0; i < n; i++) {
-        if (parent.c_ptrary_elems[i] == &row) {
+        if (parent.c_radix_elems[i] == &row) {
             retval = false;
             break;
         }
     }
     if (retval) {
         // reserve space
-        c_ptrary_Reserve(parent, 1);
-        parent.c_ptrary_elems[n] = &row;
-        parent.c_ptrary_n = n+1;
+        c_radix_Reserve(parent, 1);
+        parent.c_radix_elems[n] = &row;
+        parent.c_radix_n = n+1;
     }
     return retval;
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.Remove
+// --- atf_amc.FUnitSort.c_radix.Remove
 // Find element using linear scan. If element is in array, remove, otherwise do nothing
-void atf_amc::c_ptrary_Remove(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) {
-    int lim = parent.c_ptrary_n;
-    atf_amc::TypeA* *elems = parent.c_ptrary_elems;
+void atf_amc::c_radix_Remove(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) {
+    int lim = parent.c_radix_n;
+    atf_amc::TypeA* *elems = parent.c_radix_elems;
     // search backward, so that most recently added element is found first.
     // if found, shift array.
     for (int i = lim-1; i>=0; i--) {
@@ -7814,207 +12038,416 @@ void atf_amc::c_ptrary_Remove(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) {
             int j = i + 1;
             size_t nbytes = sizeof(atf_amc::TypeA*) * (lim - j);
             memmove(elems + i, elems + j, nbytes);
-            parent.c_ptrary_n = lim - 1;
+            parent.c_radix_n = lim - 1;
             break;
         }
     }
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.Reserve
-// Reserve space in index for N more elements;
-void atf_amc::c_ptrary_Reserve(atf_amc::FUnitSort& parent, u32 n) {
-    u32 old_max = parent.c_ptrary_max;
-    if (UNLIKELY(parent.c_ptrary_n + n > old_max)) {
-        u32 new_max  = u32_Max(4, old_max * 2);
-        u32 old_size = old_max * sizeof(atf_amc::TypeA*);
-        u32 new_size = new_max * sizeof(atf_amc::TypeA*);
-        void *new_mem = algo_lib::malloc_ReallocMem(parent.c_ptrary_elems, old_size, new_size);
-        if (UNLIKELY(!new_mem)) {
-            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FUnitSort.c_ptrary");
-        }
-        parent.c_ptrary_elems = (atf_amc::TypeA**)new_mem;
-        parent.c_ptrary_max = new_max;
+// --- atf_amc.FUnitSort.c_radix.Reserve
+// Reserve space in index for N more elements;
+void atf_amc::c_radix_Reserve(atf_amc::FUnitSort& parent, u32 n) {
+    u32 old_max = parent.c_radix_max;
+    if (UNLIKELY(parent.c_radix_n + n > old_max)) {
+        u32 new_max  = u32_Max(4, old_max * 2);
+        u32 old_size = old_max * sizeof(atf_amc::TypeA*);
+        u32 new_size = new_max * sizeof(atf_amc::TypeA*);
+        void *new_mem = algo_lib::malloc_ReallocMem(parent.c_radix_elems, old_size, new_size);
+        if (UNLIKELY(!new_mem)) {
+            FatalErrorExit("atf_amc.out_of_memory  field:atf_amc.FUnitSort.c_radix");
+        }
+        parent.c_radix_elems = (atf_amc::TypeA**)new_mem;
+        parent.c_radix_max = new_max;
+    }
+}
+
+// --- atf_amc.FUnitSort.c_radix.Swap
+// Swap values elem_a and elem_b
+inline static void atf_amc::c_radix_Swap(atf_amc::TypeA* &elem_a, atf_amc::TypeA* &elem_b) {
+    atf_amc::TypeA *temp = elem_a;
+    elem_a = elem_b;
+    elem_b = temp;
+}
+
+// --- atf_amc.FUnitSort.c_radix.Rotleft
+// Left circular shift of three-tuple
+inline static void atf_amc::c_radix_Rotleft(atf_amc::TypeA* &elem_a, atf_amc::TypeA* &elem_b, atf_amc::TypeA* &elem_c) {
+    atf_amc::TypeA *temp = elem_a;
+    elem_a = elem_b;
+    elem_b = elem_c;
+    elem_c = temp;
+}
+
+// --- atf_amc.FUnitSort.c_radix.Lt
+// Compare values elem_a and elem_b
+// The comparison function must be anti-symmetric: if a>b, then !(b>a).
+// If not, mayhem results.
+static bool atf_amc::c_radix_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+    bool ret;
+    ret = elem_a.typea < elem_b.typea;
+    return ret;
+}
+
+// --- atf_amc.FUnitSort.c_radix.SortedQ
+// Verify whether array is sorted
+bool atf_amc::c_radix_SortedQ(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA* *elems = c_radix_Getary(parent).elems;
+    int n = c_radix_N(parent);
+    for (int i = 1; i < n; i++) {
+        if (c_radix_Lt(*elems[i], *elems[i-1])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// --- atf_amc.FUnitSort.c_radix.RadixKey
+// Extract radix key word WORD (0=most significant) from ELEM.
+// Unsigned comparison of keys gives the same order as c_radix_Lt.
+inline static u64 atf_amc::c_radix_RadixKey(atf_amc::TypeA &elem, int word) {
+    (void)word;
+    return u64(i64(elem.typea)) ^ (u64(1) << 63);
+}
+
+// --- atf_amc.FUnitSort.c_radix.RadixSort
+// Radix sort (stable)
+// Keys are extracted into a temp array, sorted with LSD byte radix
+// (one round per key word, least significant first), then elements
+// are moved to their final positions in one pass.
+void atf_amc::c_radix_RadixSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA* *elems = c_radix_Getary(parent).elems;
+    int n = c_radix_N(parent);
+    if (n < 2) {
+        return;
+    }
+    algo::RadixKey *buf = (algo::RadixKey*)algo_lib::malloc_AllocMem(sizeof(algo::RadixKey) * n * 2);
+    algo::RadixKey *keys = buf;
+    algo::RadixKey *tmp = buf + n;
+    for (int i = 0; i < n; i++) {
+        keys[i].idx = i;
+    }
+    for (int word = 1 - 1; word >= 0; word--) {
+        for (int i = 0; i < n; i++) {
+            keys[i].key = c_radix_RadixKey(*elems[keys[i].idx], word);
+        }
+        algo_lib::RadixSortKeys(keys, tmp, n);
+    }
+    // move elements into place (bitwise, as in Swap)
+    atf_amc::TypeA* *copy = (atf_amc::TypeA**)algo_lib::malloc_AllocMem(sizeof(atf_amc::TypeA*) * n);
+    memcpy((void*)copy, (void*)elems, sizeof(atf_amc::TypeA*) * n);
+    for (int i = 0; i < n; i++) {
+        memcpy((void*)(elems + i), (void*)(copy + keys[i].idx), sizeof(atf_amc::TypeA*));
+    }
+    algo_lib::malloc_FreeMem(copy, sizeof(atf_amc::TypeA*) * n);
+    algo_lib::malloc_FreeMem(buf, sizeof(algo::RadixKey) * n * 2);
+}
+
+// --- atf_amc.FUnitSort.strkey.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_amc::Strkey& atf_amc::strkey_Alloc(atf_amc::FUnitSort& parent) {
+    strkey_Reserve(parent, 1);
+    int n  = parent.strkey_n;
+    int at = n;
+    atf_amc::Strkey *elems = parent.strkey_elems;
+    new (elems + at) atf_amc::Strkey(); // construct new element, default initializer
+    parent.strkey_n = n+1;
+    return elems[at];
+}
+
+// --- atf_amc.FUnitSort.strkey.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_amc::Strkey& atf_amc::strkey_AllocAt(atf_amc::FUnitSort& parent, int at) {
+    strkey_Reserve(parent, 1);
+    int n  = parent.strkey_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("atf_amc.bad_alloc_at  field:atf_amc.FUnitSort.strkey  comment:'index out of range'");
+    }
+    atf_amc::Strkey *elems = parent.strkey_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(atf_amc::Strkey));
+    new (elems + at) atf_amc::Strkey(); // construct element, default initializer
+    parent.strkey_n = n+1;
+    return elems[at];
+}
+
+// --- atf_amc.FUnitSort.strkey.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_amc::Strkey> atf_amc::strkey_AllocN(atf_amc::FUnitSort& parent, int n_elems) {
+    strkey_Reserve(parent, n_elems);
+    int old_n  = parent.strkey_n;
+    int new_n = old_n + n_elems;
+    atf_amc::Strkey *elems = parent.strkey_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) atf_amc::Strkey(); // construct new element, default initialize
+    }
+    parent.strkey_n = new_n;
+    return algo::aryptr<atf_amc::Strkey>(elems + old_n, n_elems);
+}
+
+// --- atf_amc.FUnitSort.strkey.Remove
+// Remove item by index. If index outside of range, do nothing.
+void atf_amc::strkey_Remove(atf_amc::FUnitSort& parent, u32 i) {
+    u32 lim = parent.strkey_n;
+    atf_amc::Strkey *elems = parent.strkey_elems;
+    if (i < lim) {
+        elems[i].~Strkey(); // destroy element
+        memmove(elems + i, elems + (i + 1), sizeof(atf_amc::Strkey) * (lim - (i + 1)));
+        parent.strkey_n = lim - 1;
+    }
+}
+
+// --- atf_amc.FUnitSort.strkey.RemoveAll
+void atf_amc::strkey_RemoveAll(atf_amc::FUnitSort& parent) {
+    u32 n = parent.strkey_n;
+    while (n > 0) {
+        n -= 1;
+        parent.strkey_elems[n].~Strkey();
+        parent.strkey_n = n;
+    }
+}
+
+// --- atf_amc.FUnitSort.strkey.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_amc::strkey_RemoveLast(atf_amc::FUnitSort& parent) {
+    u64 n = parent.strkey_n;
+    if (n > 0) {
+        n -= 1;
+        strkey_qFind(parent, u64(n)).~Strkey();
+        parent.strkey_n = n;
+    }
+}
+
+// --- atf_amc.FUnitSort.strkey.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void atf_amc::strkey_AbsReserve(atf_amc::FUnitSort& parent, int n) {
+    u32 old_max  = parent.strkey_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(parent.strkey_elems, old_max * sizeof(atf_amc::Strkey), new_max * sizeof(atf_amc::Strkey));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("atf_amc.tary_nomem  field:atf_amc.FUnitSort.strkey  comment:'out of memory'");
+    }
+    parent.strkey_elems = (atf_amc::Strkey*)new_mem;
+    parent.strkey_max = new_max;
+}
+
+// --- atf_amc.FUnitSort.strkey.Setary
+// Copy contents of RHS to PARENT.
+void atf_amc::strkey_Setary(atf_amc::FUnitSort& parent, atf_amc::FUnitSort &rhs) {
+    strkey_RemoveAll(parent);
+    int nnew = rhs.strkey_n;
+    strkey_Reserve(parent, nnew); // reserve space
+    for (int i = 0; i < nnew; i++) { // copy elements over
+        new (parent.strkey_elems + i) atf_amc::Strkey(strkey_qFind(rhs, i));
+        parent.strkey_n = i + 1;
     }
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.Swap
+// --- atf_amc.FUnitSort.strkey.Swap
 // Swap values elem_a and elem_b
-inline static void atf_amc::c_ptrary_Swap(atf_amc::TypeA* &elem_a, atf_amc::TypeA* &elem_b) {
-    atf_amc::TypeA *temp = elem_a;
-    elem_a = elem_b;
-    elem_b = temp;
+inline static void atf_amc::strkey_Swap(atf_amc::Strkey &elem_a, atf_amc::Strkey &elem_b) {
+    u8 temp[sizeof(atf_amc::Strkey)];
+    memcpy(&temp  , &elem_a, sizeof(atf_amc::Strkey));
+    memcpy(&elem_a, &elem_b, sizeof(atf_amc::Strkey));
+    memcpy(&elem_b, &temp  , sizeof(atf_amc::Strkey));
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.Rotleft
+// --- atf_amc.FUnitSort.strkey.Rotleft
 // Left circular shift of three-tuple
-inline static void atf_amc::c_ptrary_Rotleft(atf_amc::TypeA* &elem_a, atf_amc::TypeA* &elem_b, atf_amc::TypeA* &elem_c) {
-    atf_amc::TypeA *temp = elem_a;
-    elem_a = elem_b;
-    elem_b = elem_c;
-    elem_c = temp;
+inline static void atf_amc::strkey_Rotleft(atf_amc::Strkey &elem_a, atf_amc::Strkey &elem_b, atf_amc::Strkey &elem_c) {
+    u8 temp[sizeof(atf_amc::Strkey)];
+    memcpy(&temp, &elem_a   , sizeof(atf_amc::Strkey));
+    memcpy(&elem_a   , &elem_b   , sizeof(atf_amc::Strkey));
+    memcpy(&elem_b   , &elem_c   , sizeof(atf_amc::Strkey));
+    memcpy(&elem_c   , &temp, sizeof(atf_amc::Strkey));
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.Lt
+// --- atf_amc.FUnitSort.strkey.Lt
 // Compare values elem_a and elem_b
 // The comparison function must be anti-symmetric: if a>b, then !(b>a).
 // If not, mayhem results.
-static bool atf_amc::c_ptrary_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+static bool atf_amc::strkey_Lt(atf_amc::Strkey &elem_a, atf_amc::Strkey &elem_b) {
     bool ret;
-    ret = elem_a.typea < elem_b.typea;
+    ret = elem_a.key < elem_b.key;
     return ret;
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.SortedQ
+// --- atf_amc.FUnitSort.strkey.SortedQ
 // Verify whether array is sorted
-bool atf_amc::c_ptrary_SortedQ(atf_amc::FUnitSort& parent) {
-    atf_amc::TypeA* *elems = c_ptrary_Getary(parent).elems;
-    int n = c_ptrary_N(parent);
+bool atf_amc::strkey_SortedQ(atf_amc::FUnitSort& parent) {
+    atf_amc::Strkey *elems = strkey_Getary(parent).elems;
+    int n = strkey_N(parent);
     for (int i = 1; i < n; i++) {
-        if (c_ptrary_Lt(*elems[i], *elems[i-1])) {
+        if (strkey_Lt(elems[i], elems[i-1])) {
             return false;
         }
     }
     return true;
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.IntInsertionSort
-// Internal insertion sort
-static void atf_amc::c_ptrary_IntInsertionSort(atf_amc::TypeA* *elems, int n) {
-    for (int i = 1; i < n; ++i) {
-        int j = i;
-        atf_amc::TypeA *tmp = elems[i];
-        // shift elements up by one
-        if (c_ptrary_Lt(*tmp, *elems[j-1])) {
-            do {
-                elems[j] = elems[j-1];
-                j--;
-            } while (j>0 && c_ptrary_Lt(*tmp, *elems[j-1]));
-            elems[j] = tmp;
+// --- atf_amc.FUnitSort.strkey.RadixKey
+// Extract radix key word WORD (0=most significant) from ELEM.
+// Unsigned comparison of keys gives the same order as strkey_Lt.
+inline static u64 atf_amc::strkey_RadixKey(atf_amc::Strkey &elem, int word) {
+    algo::strptr str = ch_Getary(elem.key);
+    return word < 7 ? algo_lib::RadixKeyStr(str, word) : u64(str.n_elems);
+}
+
+// --- atf_amc.FUnitSort.strkey.RadixSort
+// Radix sort (stable)
+// Keys are extracted into a temp array, sorted with LSD byte radix
+// (one round per key word, least significant first), then elements
+// are moved to their final positions in one pass.
+void atf_amc::strkey_RadixSort(atf_amc::FUnitSort& parent) {
+    atf_amc::Strkey *elems = strkey_Getary(parent).elems;
+    int n = strkey_N(parent);
+    if (n < 2) {
+        return;
+    }
+    algo::RadixKey *buf = (algo::RadixKey*)algo_lib::malloc_AllocMem(sizeof(algo::RadixKey) * n * 2);
+    algo::RadixKey *keys = buf;
+    algo::RadixKey *tmp = buf + n;
+    for (int i = 0; i < n; i++) {
+        keys[i].idx = i;
+    }
+    for (int word = 8 - 1; word >= 0; word--) {
+        for (int i = 0; i < n; i++) {
+            keys[i].key = strkey_RadixKey(elems[keys[i].idx], word);
         }
+        algo_lib::RadixSortKeys(keys, tmp, n);
+    }
+    // move elements into place (bitwise, as in Swap)
+    atf_amc::Strkey *copy = (atf_amc::Strkey*)algo_lib::malloc_AllocMem(sizeof(atf_amc::Strkey) * n);
+    memcpy((void*)copy, (void*)elems, sizeof(atf_amc::Strkey) * n);
+    for (int i = 0; i < n; i++) {
+        memcpy((void*)(elems + i), (void*)(copy + keys[i].idx), sizeof(atf_amc::Strkey));
     }
+    algo_lib::malloc_FreeMem(copy, sizeof(atf_amc::Strkey) * n);
+    algo_lib::malloc_FreeMem(buf, sizeof(algo::RadixKey) * n * 2);
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.IntHeapSort
-// Internal heap sort
-static void atf_amc::c_ptrary_IntHeapSort(atf_amc::TypeA* *elems, int n) {
-    // construct max-heap.
-    // k=current element
-    // j=parent element
-    for (int i = 1; i < n; i++) {
-        int k=i;
-        int j=(i-1)/2;
-        while (c_ptrary_Lt(*elems[j], *elems[k])) {
-            c_ptrary_Swap(elems[k],elems[j]);
-            k=j;
-            j=(k-1)/2;
-        }
+// --- atf_amc.FUnitSort.strkey.XrefMaybe
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool atf_amc::strkey_XrefMaybe(atf_amc::Strkey &row) {
+    bool retval = true;
+    (void)row;
+    return retval;
+}
+
+// --- atf_amc.FUnitSort.parallel.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_amc::TypeA& atf_amc::parallel_Alloc(atf_amc::FUnitSort& parent) {
+    parallel_Reserve(parent, 1);
+    int n  = parent.parallel_n;
+    int at = n;
+    atf_amc::TypeA *elems = parent.parallel_elems;
+    new (elems + at) atf_amc::TypeA(); // construct new element, default initializer
+    parent.parallel_n = n+1;
+    return elems[at];
+}
+
+// --- atf_amc.FUnitSort.parallel.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_amc::TypeA& atf_amc::parallel_AllocAt(atf_amc::FUnitSort& parent, int at) {
+    parallel_Reserve(parent, 1);
+    int n  = parent.parallel_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("atf_amc.bad_alloc_at  field:atf_amc.FUnitSort.parallel  comment:'index out of range'");
     }
-    // remove elements from heap one-by-one,
-    // deposit them in reverse order starting at the end of ARY.
-    for (int i = n - 1; i>=0; i--) {
-        int k = 0;
-        int l = 1;
-        while (l<i) {
-            l += l<i-1 && c_ptrary_Lt(*elems[l], *elems[l+1]);
-            if (c_ptrary_Lt(*elems[l], *elems[i])) {
-                break;
-            }
-            c_ptrary_Swap(elems[k], elems[l]);
-            k = l;
-            l = k*2+1;
-        }
-        if (i != k) {
-            c_ptrary_Swap(elems[i],elems[k]);
-        }
+    atf_amc::TypeA *elems = parent.parallel_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(atf_amc::TypeA));
+    new (elems + at) atf_amc::TypeA(); // construct element, default initializer
+    parent.parallel_n = n+1;
+    return elems[at];
+}
+
+// --- atf_amc.FUnitSort.parallel.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_amc::TypeA> atf_amc::parallel_AllocN(atf_amc::FUnitSort& parent, int n_elems) {
+    parallel_Reserve(parent, n_elems);
+    int old_n  = parent.parallel_n;
+    int new_n = old_n + n_elems;
+    atf_amc::TypeA *elems = parent.parallel_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) atf_amc::TypeA(); // construct new element, default initialize
     }
+    parent.parallel_n = new_n;
+    return algo::aryptr<atf_amc::TypeA>(elems + old_n, n_elems);
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.IntQuickSort
-// Quick sort engine
-static void atf_amc::c_ptrary_IntQuickSort(atf_amc::TypeA* *elems, int n, int depth) {
-    while (n>16) {
-        // detect degenerate case and revert to heap sort
-        if (depth==0) {
-            c_ptrary_IntHeapSort(elems,n);
-            return;
-        }
-        // elements to sort initially to determine pivot.
-        // choose pp=n/2 in case the input is already sorted.
-        int pi = 0;
-        int pp = n/2;
-        int pj = n-1;
-        // insertion sort for 1st, middle and last element
-        if (c_ptrary_Lt(*elems[pp], *elems[pi])) {
-            c_ptrary_Swap(elems[pi], elems[pp]);
-        }
-        if (c_ptrary_Lt(*elems[pj], *elems[pp])) {
-            if (c_ptrary_Lt(*elems[pj], *elems[pi])) {
-                c_ptrary_Rotleft(elems[pi], elems[pj], elems[pp]);
-            } else {
-                c_ptrary_Swap(elems[pj], elems[pp]);
-            }
-        }
-        // deposit pivot near the end of the array and skip it.
-        c_ptrary_Swap(elems[--pj], elems[pp]);
-        // copy pivot into temporary variable
-        atf_amc::TypeA *pivot = elems[pj];
-        for(;;){
-            while (c_ptrary_Lt(*elems[++pi], *pivot)) {
-            }
-            while (c_ptrary_Lt(*pivot, *elems[--pj])) {
-            }
-            if (pj <= pi) {
-                break;
-            }
-            c_ptrary_Swap(elems[pi],elems[pj]);
-        }
-        depth -= 1;
-        c_ptrary_IntQuickSort(elems, pi, depth);
-        elems += pi;
-        n -= pi;
+// --- atf_amc.FUnitSort.parallel.Remove
+// Remove item by index. If index outside of range, do nothing.
+void atf_amc::parallel_Remove(atf_amc::FUnitSort& parent, u32 i) {
+    u32 lim = parent.parallel_n;
+    atf_amc::TypeA *elems = parent.parallel_elems;
+    if (i < lim) {
+        elems[i].~TypeA(); // destroy element
+        memmove(elems + i, elems + (i + 1), sizeof(atf_amc::TypeA) * (lim - (i + 1)));
+        parent.parallel_n = lim - 1;
     }
-    // sort the remainder of this section
-    c_ptrary_IntInsertionSort(elems,n);
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.InsertionSort
-// Insertion sort
-void atf_amc::c_ptrary_InsertionSort(atf_amc::FUnitSort& parent) {
-    atf_amc::TypeA* *elems = c_ptrary_Getary(parent).elems;
-    int n = c_ptrary_N(parent);
-    c_ptrary_IntInsertionSort(elems, n);
+// --- atf_amc.FUnitSort.parallel.RemoveAll
+void atf_amc::parallel_RemoveAll(atf_amc::FUnitSort& parent) {
+    u32 n = parent.parallel_n;
+    while (n > 0) {
+        n -= 1;
+        parent.parallel_elems[n].~TypeA();
+        parent.parallel_n = n;
+    }
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.HeapSort
-// Heap sort
-void atf_amc::c_ptrary_HeapSort(atf_amc::FUnitSort& parent) {
-    atf_amc::TypeA* *elems = c_ptrary_Getary(parent).elems;
-    int n = c_ptrary_N(parent);
-    c_ptrary_IntHeapSort(elems, n);
+// --- atf_amc.FUnitSort.parallel.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_amc::parallel_RemoveLast(atf_amc::FUnitSort& parent) {
+    u64 n = parent.parallel_n;
+    if (n > 0) {
+        n -= 1;
+        parallel_qFind(parent, u64(n)).~TypeA();
+        parent.parallel_n = n;
+    }
 }
 
-// --- atf_amc.FUnitSort.c_ptrary.QuickSort
-// Quick sort
-void atf_amc::c_ptrary_QuickSort(atf_amc::FUnitSort& parent) {
-    // compute max recursion depth based on number of elements in the array
-    int max_depth = CeilingLog2(u32(c_ptrary_N(parent) + 1)) + 3;
-    atf_amc::TypeA* *elems = c_ptrary_Getary(parent).elems;
-    int n = c_ptrary_N(parent);
-    c_ptrary_IntQuickSort(elems, n, max_depth);
+// --- atf_amc.FUnitSort.parallel.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void atf_amc::parallel_AbsReserve(atf_amc::FUnitSort& parent, int n) {
+    u32 old_max  = parent.parallel_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(parent.parallel_elems, old_max * sizeof(atf_amc::TypeA), new_max * sizeof(atf_amc::TypeA));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("atf_amc.tary_nomem  field:atf_amc.FUnitSort.parallel  comment:'out of memory'");
+    }
+    parent.parallel_elems = (atf_amc::TypeA*)new_mem;
+    parent.parallel_max = new_max;
 }
 
-// --- atf_amc.FUnitSort.fixary.Swap
+// --- atf_amc.FUnitSort.parallel.Setary
+// Copy contents of RHS to PARENT.
+void atf_amc::parallel_Setary(atf_amc::FUnitSort& parent, atf_amc::FUnitSort &rhs) {
+    parallel_RemoveAll(parent);
+    int nnew = rhs.parallel_n;
+    parallel_Reserve(parent, nnew); // reserve space
+    for (int i = 0; i < nnew; i++) { // copy elements over
+        new (parent.parallel_elems + i) atf_amc::TypeA(parallel_qFind(rhs, i));
+        parent.parallel_n = i + 1;
+    }
+}
+
+// --- atf_amc.FUnitSort.parallel.Swap
 // Swap values elem_a and elem_b
-inline static void atf_amc::fixary_Swap(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+inline static void atf_amc::parallel_Swap(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
     u8 temp[sizeof(atf_amc::TypeA)];
     memcpy(&temp  , &elem_a, sizeof(atf_amc::TypeA));
     memcpy(&elem_a, &elem_b, sizeof(atf_amc::TypeA));
     memcpy(&elem_b, &temp  , sizeof(atf_amc::TypeA));
 }
 
-// --- atf_amc.FUnitSort.fixary.Rotleft
+// --- atf_amc.FUnitSort.parallel.Rotleft
 // Left circular shift of three-tuple
-inline static void atf_amc::fixary_Rotleft(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b, atf_amc::TypeA &elem_c) {
+inline static void atf_amc::parallel_Rotleft(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b, atf_amc::TypeA &elem_c) {
     u8 temp[sizeof(atf_amc::TypeA)];
     memcpy(&temp, &elem_a   , sizeof(atf_amc::TypeA));
     memcpy(&elem_a   , &elem_b   , sizeof(atf_amc::TypeA));
@@ -8022,36 +12455,36 @@ inline static void atf_amc::fixary_Rotleft(atf_amc::TypeA &elem_a, atf_amc::Type
     memcpy(&elem_c   , &temp, sizeof(atf_amc::TypeA));
 }
 
-// --- atf_amc.FUnitSort.fixary.Lt
+// --- atf_amc.FUnitSort.parallel.Lt
 // Compare values elem_a and elem_b
 // The comparison function must be anti-symmetric: if a>b, then !(b>a).
 // If not, mayhem results.
-static bool atf_amc::fixary_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
+static bool atf_amc::parallel_Lt(atf_amc::TypeA &elem_a, atf_amc::TypeA &elem_b) {
     bool ret;
     ret = elem_a.typea < elem_b.typea;
     return ret;
 }
 
-// --- atf_amc.FUnitSort.fixary.SortedQ
+// --- atf_amc.FUnitSort.parallel.SortedQ
 // Verify whether array is sorted
-bool atf_amc::fixary_SortedQ(atf_amc::FUnitSort& parent) {
-    atf_amc::TypeA *elems = fixary_Getary(parent).elems;
-    int n = fixary_N(parent);
+bool atf_amc::parallel_SortedQ(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = parallel_Getary(parent).elems;
+    int n = parallel_N(parent);
     for (int i = 1; i < n; i++) {
-        if (fixary_Lt(elems[i], elems[i-1])) {
+        if (parallel_Lt(elems[i], elems[i-1])) {
             return false;
         }
     }
     return true;
 }
 
-// --- atf_amc.FUnitSort.fixary.IntInsertionSort
+// --- atf_amc.FUnitSort.parallel.IntInsertionSort
 // Internal insertion sort
-static void atf_amc::fixary_IntInsertionSort(atf_amc::TypeA *elems, int n) {
+static void atf_amc::parallel_IntInsertionSort(atf_amc::TypeA *elems, int n) {
     for (int i = 1; i < n; ++i) {
         int j = i;
         // find the spot for ith element.
-        while (j>0 && fixary_Lt(elems[i], elems[j-1])) {
+        while (j>0 && parallel_Lt(elems[i], elems[j-1])) {
             j--;
         }
         if (j<i) {
@@ -8063,17 +12496,17 @@ static void atf_amc::fixary_IntInsertionSort(atf_amc::TypeA *elems, int n) {
     }
 }
 
-// --- atf_amc.FUnitSort.fixary.IntHeapSort
+// --- atf_amc.FUnitSort.parallel.IntHeapSort
 // Internal heap sort
-static void atf_amc::fixary_IntHeapSort(atf_amc::TypeA *elems, int n) {
+static void atf_amc::parallel_IntHeapSort(atf_amc::TypeA *elems, int n) {
     // construct max-heap.
     // k=current element
     // j=parent element
     for (int i = 1; i < n; i++) {
         int k=i;
         int j=(i-1)/2;
-        while (fixary_Lt(elems[j], elems[k])) {
-            fixary_Swap(elems[k],elems[j]);
+        while (parallel_Lt(elems[j], elems[k])) {
+            parallel_Swap(elems[k],elems[j]);
             k=j;
             j=(k-1)/2;
         }
@@ -8084,27 +12517,27 @@ static void atf_amc::fixary_IntHeapSort(atf_amc::TypeA *elems, int n) {
         int k = 0;
         int l = 1;
         while (l<i) {
-            l += l<i-1 && fixary_Lt(elems[l], elems[l+1]);
-            if (fixary_Lt(elems[l], elems[i])) {
+            l += l<i-1 && parallel_Lt(elems[l], elems[l+1]);
+            if (parallel_Lt(elems[l], elems[i])) {
                 break;
             }
-            fixary_Swap(elems[k], elems[l]);
+            parallel_Swap(elems[k], elems[l]);
             k = l;
             l = k*2+1;
         }
         if (i != k) {
-            fixary_Swap(elems[i],elems[k]);
+            parallel_Swap(elems[i],elems[k]);
         }
     }
 }
 
-// --- atf_amc.FUnitSort.fixary.IntQuickSort
+// --- atf_amc.FUnitSort.parallel.IntQuickSort
 // Quick sort engine
-static void atf_amc::fixary_IntQuickSort(atf_amc::TypeA *elems, int n, int depth) {
+static void atf_amc::parallel_IntQuickSort(atf_amc::TypeA *elems, int n, int depth) {
     while (n>16) {
         // detect degenerate case and revert to heap sort
         if (depth==0) {
-            fixary_IntHeapSort(elems,n);
+            parallel_IntHeapSort(elems,n);
             return;
         }
         // elements to sort initially to determine pivot.
@@ -8113,69 +12546,130 @@ static void atf_amc::fixary_IntQuickSort(atf_amc::TypeA *elems, int n, int depth
         int pp = n/2;
         int pj = n-1;
         // insertion sort for 1st, middle and last element
-        if (fixary_Lt(elems[pp], elems[pi])) {
-            fixary_Swap(elems[pi], elems[pp]);
+        if (parallel_Lt(elems[pp], elems[pi])) {
+            parallel_Swap(elems[pi], elems[pp]);
         }
-        if (fixary_Lt(elems[pj], elems[pp])) {
-            if (fixary_Lt(elems[pj], elems[pi])) {
-                fixary_Rotleft(elems[pi], elems[pj], elems[pp]);
+        if (parallel_Lt(elems[pj], elems[pp])) {
+            if (parallel_Lt(elems[pj], elems[pi])) {
+                parallel_Rotleft(elems[pi], elems[pj], elems[pp]);
             } else {
-                fixary_Swap(elems[pj], elems[pp]);
+                parallel_Swap(elems[pj], elems[pp]);
             }
         }
         // deposit pivot near the end of the array and skip it.
-        fixary_Swap(elems[--pj], elems[pp]);
+        parallel_Swap(elems[--pj], elems[pp]);
         // reference to pivot
         atf_amc::TypeA &pivot = elems[pj];
         for(;;){
-            while (fixary_Lt(elems[++pi], pivot)) {
+            while (parallel_Lt(elems[++pi], pivot)) {
             }
-            while (fixary_Lt(pivot, elems[--pj])) {
+            while (parallel_Lt(pivot, elems[--pj])) {
             }
             if (pj <= pi) {
                 break;
             }
-            fixary_Swap(elems[pi],elems[pj]);
+            parallel_Swap(elems[pi],elems[pj]);
         }
         depth -= 1;
-        fixary_IntQuickSort(elems, pi, depth);
+        parallel_IntQuickSort(elems, pi, depth);
         elems += pi;
         n -= pi;
     }
     // sort the remainder of this section
-    fixary_IntInsertionSort(elems,n);
+    parallel_IntInsertionSort(elems,n);
 }
 
-// --- atf_amc.FUnitSort.fixary.InsertionSort
+// --- atf_amc.FUnitSort.parallel.InsertionSort
 // Insertion sort
-void atf_amc::fixary_InsertionSort(atf_amc::FUnitSort& parent) {
-    atf_amc::TypeA *elems = fixary_Getary(parent).elems;
-    int n = fixary_N(parent);
-    fixary_IntInsertionSort(elems, n);
+void atf_amc::parallel_InsertionSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = parallel_Getary(parent).elems;
+    int n = parallel_N(parent);
+    parallel_IntInsertionSort(elems, n);
 }
 
-// --- atf_amc.FUnitSort.fixary.HeapSort
+// --- atf_amc.FUnitSort.parallel.HeapSort
 // Heap sort
-void atf_amc::fixary_HeapSort(atf_amc::FUnitSort& parent) {
-    atf_amc::TypeA *elems = fixary_Getary(parent).elems;
-    int n = fixary_N(parent);
-    fixary_IntHeapSort(elems, n);
+void atf_amc::parallel_HeapSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = parallel_Getary(parent).elems;
+    int n = parallel_N(parent);
+    parallel_IntHeapSort(elems, n);
 }
 
-// --- atf_amc.FUnitSort.fixary.QuickSort
+// --- atf_amc.FUnitSort.parallel.QuickSort
 // Quick sort
-void atf_amc::fixary_QuickSort(atf_amc::FUnitSort& parent) {
+void atf_amc::parallel_QuickSort(atf_amc::FUnitSort& parent) {
     // compute max recursion depth based on number of elements in the array
-    int max_depth = CeilingLog2(u32(fixary_N(parent) + 1)) + 3;
-    atf_amc::TypeA *elems = fixary_Getary(parent).elems;
-    int n = fixary_N(parent);
-    fixary_IntQuickSort(elems, n, max_depth);
+    int max_depth = CeilingLog2(u32(parallel_N(parent) + 1)) + 3;
+    atf_amc::TypeA *elems = parallel_Getary(parent).elems;
+    int n = parallel_N(parent);
+    parallel_IntQuickSort(elems, n, max_depth);
+}
+
+// --- atf_amc.FUnitSort.parallel.SortRun
+// Sort one run of elements (callback for algo_lib::ParallelSort)
+static void atf_amc::parallel_SortRun(void *elems, int n) {
+    int max_depth = CeilingLog2(u32(n + 1)) + 3;
+    parallel_IntQuickSort((atf_amc::TypeA*)elems, n, max_depth);
+}
+
+// --- atf_amc.FUnitSort.parallel.MergeRuns
+// Merge sorted runs A and B into DST (callback for algo_lib::ParallelSort)
+// Elements are moved bitwise, as in Swap.
+static void atf_amc::parallel_MergeRuns(void *dst, void *a, int na, void *b, int nb) {
+    atf_amc::TypeA *out = (atf_amc::TypeA*)dst;
+    atf_amc::TypeA *pa = (atf_amc::TypeA*)a;
+    atf_amc::TypeA *pb = (atf_amc::TypeA*)b;
+    atf_amc::TypeA *ea = pa + na;
+    atf_amc::TypeA *eb = pb + nb;
+    while (pa < ea && pb < eb) {
+        // take from A unless B is strictly less -- keeps merge stable
+        if (parallel_Lt(pb[0], pa[0])) {
+            memcpy((void*)out++, (void*)pb++, sizeof(atf_amc::TypeA));
+        } else {
+            memcpy((void*)out++, (void*)pa++, sizeof(atf_amc::TypeA));
+        }
+    }
+    memcpy((void*)out, (void*)pa, (ea - pa) * sizeof(atf_amc::TypeA));
+    out += ea - pa;
+    memcpy((void*)out, (void*)pb, (eb - pb) * sizeof(atf_amc::TypeA));
+}
+
+// --- atf_amc.FUnitSort.parallel.ParallelSort
+// Parallel sort
+// Large arrays are split into runs, which are sorted in separate threads
+// with quick sort, and merged; small arrays are quick-sorted in the calling thread.
+// parallel_Lt must be thread-safe.
+void atf_amc::parallel_ParallelSort(atf_amc::FUnitSort& parent) {
+    atf_amc::TypeA *elems = parallel_Getary(parent).elems;
+    int n = parallel_N(parent);
+    algo_lib::ParallelSort(elems, n, sizeof(atf_amc::TypeA), parallel_SortRun, parallel_MergeRuns);
 }
 
 // --- atf_amc.FUnitSort..Uninit
 void atf_amc::FUnitSort_Uninit(atf_amc::FUnitSort& parent) {
     atf_amc::FUnitSort &row = parent; (void)row;
 
+    // atf_amc.FUnitSort.parallel.Uninit (Tary)  //
+    // remove all elements from atf_amc.FUnitSort.parallel
+    parallel_RemoveAll(parent);
+    // free memory for Tary atf_amc.FUnitSort.parallel
+    algo_lib::malloc_FreeMem(parent.parallel_elems, sizeof(atf_amc::TypeA)*parent.parallel_max); // (atf_amc.FUnitSort.parallel)
+
+    // atf_amc.FUnitSort.strkey.Uninit (Tary)  //
+    // remove all elements from atf_amc.FUnitSort.strkey
+    strkey_RemoveAll(parent);
+    // free memory for Tary atf_amc.FUnitSort.strkey
+    algo_lib::malloc_FreeMem(parent.strkey_elems, sizeof(atf_amc::Strkey)*parent.strkey_max); // (atf_amc.FUnitSort.strkey)
+
+    // atf_amc.FUnitSort.c_radix.Uninit (Ptrary)  //
+    algo_lib::malloc_FreeMem(parent.c_radix_elems, sizeof(atf_amc::TypeA*)*parent.c_radix_max); // (atf_amc.FUnitSort.c_radix)
+
+    // atf_amc.FUnitSort.radix.Uninit (Tary)  //
+    // remove all elements from atf_amc.FUnitSort.radix
+    radix_RemoveAll(parent);
+    // free memory for Tary atf_amc.FUnitSort.radix
+    algo_lib::malloc_FreeMem(parent.radix_elems, sizeof(atf_amc::TypeA)*parent.radix_max); // (atf_amc.FUnitSort.radix)
+
     // atf_amc.FUnitSort.c_ptrary.Uninit (Ptrary)  //
     algo_lib::malloc_FreeMem(parent.c_ptrary_elems, sizeof(atf_amc::TypeA*)*parent.c_ptrary_max); // (atf_amc.FUnitSort.c_ptrary)
 
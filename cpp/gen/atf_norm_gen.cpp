@@ -42,6 +42,10 @@ const char *atf_norm_help =
 "    [normcheck]  string  Normalization checks to run. default: \"%\"\n"
 "    -verbose             Enable verbose mode\n"
 "    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
 "    -version             Show version information\n"
 "    -sig                 Print SHA1 signatures for dispatches\n"
 "    -help                Print this screen and exit\n"
@@ -200,40 +204,59 @@ bool atf_norm::InsertStrptrMaybe(algo::strptr str) {
         case atf_norm_TableId_dmmeta_Ssimfile: { // finput:atf_norm.FDb.ssimfile
             dmmeta::Ssimfile elem;
             retval = dmmeta::Ssimfile_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(atf_norm_TableId_dmmeta_Ssimfile, &elem, sizeof(elem));
+            }
             retval = retval && ssimfile_InputMaybe(elem);
             break;
         }
         case atf_norm_TableId_dev_Scriptfile: { // finput:atf_norm.FDb.scriptfile
             dev::Scriptfile elem;
             retval = dev::Scriptfile_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(atf_norm_TableId_dev_Scriptfile, &elem, sizeof(elem));
+            }
             retval = retval && scriptfile_InputMaybe(elem);
             break;
         }
         case atf_norm_TableId_dmmeta_Ns: { // finput:atf_norm.FDb.ns
             dmmeta::Ns elem;
             retval = dmmeta::Ns_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(atf_norm_TableId_dmmeta_Ns, &elem, sizeof(elem));
+            }
             retval = retval && ns_InputMaybe(elem);
             break;
         }
         case atf_norm_TableId_dev_Readme: { // finput:atf_norm.FDb.readme
             dev::Readme elem;
             retval = dev::Readme_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(atf_norm_TableId_dev_Readme, &elem, sizeof(elem));
+            }
             retval = retval && readme_InputMaybe(elem);
             break;
         }
         case atf_norm_TableId_dev_Builddir: { // finput:atf_norm.FDb.builddir
             dev::Builddir elem;
             retval = dev::Builddir_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(atf_norm_TableId_dev_Builddir, &elem, sizeof(elem));
+            }
             retval = retval && builddir_InputMaybe(elem);
             break;
         }
         case atf_norm_TableId_dev_Cfg: { // finput:atf_norm.FDb.cfg
             dev::Cfg elem;
             retval = dev::Cfg_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(atf_norm_TableId_dev_Cfg, &elem, sizeof(elem));
+            }
             retval = retval && cfg_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -243,6 +266,72 @@ bool atf_norm::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- atf_norm.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool atf_norm::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case atf_norm_TableId_dmmeta_Ssimfile: { // finput:atf_norm.FDb.ssimfile
+            dmmeta::Ssimfile elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ssimfile_InputMaybe(elem);
+            }
+            break;
+        }
+        case atf_norm_TableId_dev_Scriptfile: { // finput:atf_norm.FDb.scriptfile
+            dev::Scriptfile elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = scriptfile_InputMaybe(elem);
+            }
+            break;
+        }
+        case atf_norm_TableId_dmmeta_Ns: { // finput:atf_norm.FDb.ns
+            dmmeta::Ns elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ns_InputMaybe(elem);
+            }
+            break;
+        }
+        case atf_norm_TableId_dev_Readme: { // finput:atf_norm.FDb.readme
+            dev::Readme elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = readme_InputMaybe(elem);
+            }
+            break;
+        }
+        case atf_norm_TableId_dev_Builddir: { // finput:atf_norm.FDb.builddir
+            dev::Builddir elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = builddir_InputMaybe(elem);
+            }
+            break;
+        }
+        case atf_norm_TableId_dev_Cfg: { // finput:atf_norm.FDb.cfg
+            dev::Cfg elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = cfg_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- atf_norm.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool atf_norm::LoadTuplesMaybe(algo::strptr root) {
@@ -251,7 +340,8 @@ bool atf_norm::LoadTuplesMaybe(algo::strptr root) {
         "dev.builddir", "dev.cfg", "dmmeta.ns", "dev.readme"
         , "dev.scriptfile", "dmmeta.ssimfile"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, atf_norm::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "atf_norm", "3cb8129a191a643a1221a134ff6bd02fe1dd96a5"
+        , atf_norm::InsertStrptrMaybe, atf_norm::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -505,7 +595,8 @@ bool atf_norm::ssimfile_XrefMaybe(atf_norm::FSsimfile &row) {
 // --- atf_norm.FDb.ind_ssimfile.Find
 // Find row by key. Return NULL if not found.
 atf_norm::FSsimfile* atf_norm::ind_ssimfile_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ssimfile_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
     atf_norm::FSsimfile* *e = &_db.ind_ssimfile_buckets_elems[index];
     atf_norm::FSsimfile* ret=NULL;
     do {
@@ -547,7 +638,8 @@ bool atf_norm::ind_ssimfile_InsertMaybe(atf_norm::FSsimfile& row) {
     ind_ssimfile_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ssimfile_next == (atf_norm::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         atf_norm::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index];
         do {
             atf_norm::FSsimfile* ret = *prev;
@@ -573,7 +665,8 @@ bool atf_norm::ind_ssimfile_InsertMaybe(atf_norm::FSsimfile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void atf_norm::ind_ssimfile_Remove(atf_norm::FSsimfile& row) {
     if (LIKELY(row.ind_ssimfile_next != (atf_norm::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         atf_norm::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index]; // addr of pointer to current element
         while (atf_norm::FSsimfile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -733,7 +826,8 @@ bool atf_norm::scriptfile_XrefMaybe(atf_norm::FScriptfile &row) {
 // --- atf_norm.FDb.ind_scriptfile.Find
 // Find row by key. Return NULL if not found.
 atf_norm::FScriptfile* atf_norm::ind_scriptfile_Find(const algo::strptr& key) {
-    u32 index = Smallstr200_Hash(0, key) & (_db.ind_scriptfile_buckets_n - 1);
+    u32 hash  = Smallstr200_Hash(0, key);
+    u32 index = hash & (_db.ind_scriptfile_buckets_n - 1);
     atf_norm::FScriptfile* *e = &_db.ind_scriptfile_buckets_elems[index];
     atf_norm::FScriptfile* ret=NULL;
     do {
@@ -775,7 +869,8 @@ bool atf_norm::ind_scriptfile_InsertMaybe(atf_norm::FScriptfile& row) {
     ind_scriptfile_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_scriptfile_next == (atf_norm::FScriptfile*)-1)) {// check if in hash already
-        u32 index = Smallstr200_Hash(0, row.gitfile) & (_db.ind_scriptfile_buckets_n - 1);
+        u32 hash  = Smallstr200_Hash(0, row.gitfile);
+        u32 index = hash & (_db.ind_scriptfile_buckets_n - 1);
         atf_norm::FScriptfile* *prev = &_db.ind_scriptfile_buckets_elems[index];
         do {
             atf_norm::FScriptfile* ret = *prev;
@@ -801,7 +896,8 @@ bool atf_norm::ind_scriptfile_InsertMaybe(atf_norm::FScriptfile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void atf_norm::ind_scriptfile_Remove(atf_norm::FScriptfile& row) {
     if (LIKELY(row.ind_scriptfile_next != (atf_norm::FScriptfile*)-1)) {// check if in hash already
-        u32 index = Smallstr200_Hash(0, row.gitfile) & (_db.ind_scriptfile_buckets_n - 1);
+        u32 hash  = Smallstr200_Hash(0, row.gitfile);
+        u32 index = hash & (_db.ind_scriptfile_buckets_n - 1);
         atf_norm::FScriptfile* *prev = &_db.ind_scriptfile_buckets_elems[index]; // addr of pointer to current element
         while (atf_norm::FScriptfile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -961,7 +1057,8 @@ bool atf_norm::ns_XrefMaybe(atf_norm::FNs &row) {
 // --- atf_norm.FDb.ind_ns.Find
 // Find row by key. Return NULL if not found.
 atf_norm::FNs* atf_norm::ind_ns_Find(const algo::strptr& key) {
-    u32 index = Smallstr16_Hash(0, key) & (_db.ind_ns_buckets_n - 1);
+    u32 hash  = Smallstr16_Hash(0, key);
+    u32 index = hash & (_db.ind_ns_buckets_n - 1);
     atf_norm::FNs* *e = &_db.ind_ns_buckets_elems[index];
     atf_norm::FNs* ret=NULL;
     do {
@@ -1003,7 +1100,8 @@ bool atf_norm::ind_ns_InsertMaybe(atf_norm::FNs& row) {
     ind_ns_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ns_next == (atf_norm::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         atf_norm::FNs* *prev = &_db.ind_ns_buckets_elems[index];
         do {
             atf_norm::FNs* ret = *prev;
@@ -1029,7 +1127,8 @@ bool atf_norm::ind_ns_InsertMaybe(atf_norm::FNs& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void atf_norm::ind_ns_Remove(atf_norm::FNs& row) {
     if (LIKELY(row.ind_ns_next != (atf_norm::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         atf_norm::FNs* *prev = &_db.ind_ns_buckets_elems[index]; // addr of pointer to current element
         while (atf_norm::FNs *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1385,7 +1484,8 @@ bool atf_norm::cfg_XrefMaybe(atf_norm::FCfg &row) {
 // --- atf_norm.FDb.ind_builddir.Find
 // Find row by key. Return NULL if not found.
 atf_norm::FBuilddir* atf_norm::ind_builddir_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_builddir_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_builddir_buckets_n - 1);
     atf_norm::FBuilddir* *e = &_db.ind_builddir_buckets_elems[index];
     atf_norm::FBuilddir* ret=NULL;
     do {
@@ -1427,7 +1527,8 @@ bool atf_norm::ind_builddir_InsertMaybe(atf_norm::FBuilddir& row) {
     ind_builddir_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_builddir_next == (atf_norm::FBuilddir*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.builddir) & (_db.ind_builddir_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.builddir);
+        u32 index = hash & (_db.ind_builddir_buckets_n - 1);
         atf_norm::FBuilddir* *prev = &_db.ind_builddir_buckets_elems[index];
         do {
             atf_norm::FBuilddir* ret = *prev;
@@ -1453,7 +1554,8 @@ bool atf_norm::ind_builddir_InsertMaybe(atf_norm::FBuilddir& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void atf_norm::ind_builddir_Remove(atf_norm::FBuilddir& row) {
     if (LIKELY(row.ind_builddir_next != (atf_norm::FBuilddir*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.builddir) & (_db.ind_builddir_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.builddir);
+        u32 index = hash & (_db.ind_builddir_buckets_n - 1);
         atf_norm::FBuilddir* *prev = &_db.ind_builddir_buckets_elems[index]; // addr of pointer to current element
         while (atf_norm::FBuilddir *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -53,6 +53,10 @@ const char *atf_unit_help =
 "    -pertest_timeout  int     Max runtime of any individual unit test. default: 900\n"
 "    -verbose                  Enable verbose mode\n"
 "    -debug                    Enable debug mode\n"
+"    -unbuffered               Disable buffering of output\n"
+"    -snap                     Load inputs from binary snapshots in temp/\n"
+"    -nommap                   Read input files instead of mapping them\n"
+"    -linebuf          int     Max. read buffer for piped input. default: 1048576\n"
 "    -version                  Show version information\n"
 "    -sig                      Print SHA1 signatures for dispatches\n"
 "    -help                     Print this screen and exit\n"
@@ -102,6 +106,36 @@ namespace atf_unit {
     static void          sorted_IntHeapSort(atf_unit::Dbl *elems, int n) __attribute__((nothrow));
     // Quick sort engine
     static void          sorted_IntQuickSort(atf_unit::Dbl *elems, int n, int depth) __attribute__((nothrow));
+    // Swap values elem_a and elem_b
+    static void          radix_Swap(atf_unit::Dbl &elem_a, atf_unit::Dbl &elem_b) __attribute__((nothrow));
+    // Left circular shift of three-tuple
+    static void          radix_Rotleft(atf_unit::Dbl &elem_a, atf_unit::Dbl &elem_b, atf_unit::Dbl &elem_c) __attribute__((nothrow));
+    // Compare values elem_a and elem_b
+    // The comparison function must be anti-symmetric: if a>b, then !(b>a).
+    // If not, mayhem results.
+    static bool          radix_Lt(atf_unit::Dbl elem_a, atf_unit::Dbl elem_b) __attribute__((nothrow));
+    // Extract radix key word WORD (0=most significant) from ELEM.
+    // Unsigned comparison of keys gives the same order as radix_Lt.
+    static u64           radix_RadixKey(atf_unit::Dbl &elem, int word) __attribute__((nothrow));
+    // Swap values elem_a and elem_b
+    static void          parallel_Swap(atf_unit::Dbl &elem_a, atf_unit::Dbl &elem_b) __attribute__((nothrow));
+    // Left circular shift of three-tuple
+    static void          parallel_Rotleft(atf_unit::Dbl &elem_a, atf_unit::Dbl &elem_b, atf_unit::Dbl &elem_c) __attribute__((nothrow));
+    // Compare values elem_a and elem_b
+    // The comparison function must be anti-symmetric: if a>b, then !(b>a).
+    // If not, mayhem results.
+    static bool          parallel_Lt(atf_unit::Dbl elem_a, atf_unit::Dbl elem_b) __attribute__((nothrow));
+    // Internal insertion sort
+    static void          parallel_IntInsertionSort(atf_unit::Dbl *elems, int n) __attribute__((nothrow));
+    // Internal heap sort
+    static void          parallel_IntHeapSort(atf_unit::Dbl *elems, int n) __attribute__((nothrow));
+    // Quick sort engine
+    static void          parallel_IntQuickSort(atf_unit::Dbl *elems, int n, int depth) __attribute__((nothrow));
+    // Sort one run of elements (callback for algo_lib::ParallelSort)
+    static void          parallel_SortRun(void *elems, int n) __attribute__((nothrow));
+    // Merge sorted runs A and B into DST (callback for algo_lib::ParallelSort)
+    // Elements are moved bitwise, as in Swap.
+    static void          parallel_MergeRuns(void *dst, void *a, int na, void *b, int nb) __attribute__((nothrow));
     static void          SizeCheck();
 } // end namespace atf_unit
 
@@ -728,28 +762,41 @@ static void atf_unit::unittest_LoadStatic() {
         void (*step)();
     } data[] = {
         { "atfdb.unittest  unittest:acr.Check1  comment:\"\"", atf_unit::unittest_acr_Check1 }
+        ,{ "atfdb.unittest  unittest:acr.Check2  comment:\"-check -changed rechecks records affected by a changed ssimfile\"", atf_unit::unittest_acr_Check2 }
+        ,{ "atfdb.unittest  unittest:acr.Check3  comment:\"-check on multiple threads matches a single thread\"", atf_unit::unittest_acr_Check3 }
         ,{ "atfdb.unittest  unittest:acr.Del1  comment:\"\"", atf_unit::unittest_acr_Del1 }
         ,{ "atfdb.unittest  unittest:acr.Field1  comment:\"\"", atf_unit::unittest_acr_Field1 }
         ,{ "atfdb.unittest  unittest:acr.Fldfunc1  comment:\"\"", atf_unit::unittest_acr_Fldfunc1 }
         ,{ "atfdb.unittest  unittest:acr.Insert1  comment:\"\"", atf_unit::unittest_acr_Insert1 }
         ,{ "atfdb.unittest  unittest:acr.Insert2  comment:\"\"", atf_unit::unittest_acr_Insert2 }
+        ,{ "atfdb.unittest  unittest:acr.Lazy1  comment:\"Loading records by pkey matches loading entire ssimfiles\"", atf_unit::unittest_acr_Lazy1 }
+        ,{ "atfdb.unittest  unittest:acr.Lazy2  comment:\"Large -ndown selection loads child ssimfiles in full; output matches -lazy:N\"", atf_unit::unittest_acr_Lazy2 }
+        ,{ "atfdb.unittest  unittest:acr.Maxgroup1  comment:\"Print records in blocks of at most maxgroup+1 lines\"", atf_unit::unittest_acr_Maxgroup1 }
         ,{ "atfdb.unittest  unittest:acr.Merge1  comment:\"\"", atf_unit::unittest_acr_Merge1 }
         ,{ "atfdb.unittest  unittest:acr.Meta1  comment:\"\"", atf_unit::unittest_acr_Meta1 }
+        ,{ "atfdb.unittest  unittest:acr.Meta2  comment:\"-meta on several ctypes runs ctype queries as one batch\"", atf_unit::unittest_acr_Meta2 }
+        ,{ "atfdb.unittest  unittest:acr.Nthread1  comment:\"Parallel ssimfile loading matches sequential loading\"", atf_unit::unittest_acr_Nthread1 }
         ,{ "atfdb.unittest  unittest:acr.Read1  comment:\"\"", atf_unit::unittest_acr_Read1 }
         ,{ "atfdb.unittest  unittest:acr.Read2  comment:\"\"", atf_unit::unittest_acr_Read2 }
         ,{ "atfdb.unittest  unittest:acr.Read3  comment:\"\"", atf_unit::unittest_acr_Read3 }
         ,{ "atfdb.unittest  unittest:acr.Read5  comment:\"\"", atf_unit::unittest_acr_Read5 }
+        ,{ "atfdb.unittest  unittest:acr.Read6  comment:\"Non-pkey selection by prefix and with wildcards\"", atf_unit::unittest_acr_Read6 }
         ,{ "atfdb.unittest  unittest:acr.Regx1  comment:\"\"", atf_unit::unittest_acr_Regx1 }
         ,{ "atfdb.unittest  unittest:acr.Replace1  comment:\"\"", atf_unit::unittest_acr_Replace1 }
         ,{ "atfdb.unittest  unittest:acr.Rowid1  comment:\"\"", atf_unit::unittest_acr_Rowid1 }
+        ,{ "atfdb.unittest  unittest:acr.Serve1  comment:\"Query server answers requests and reloads a changed ssimfile\"", atf_unit::unittest_acr_Serve1 }
+        ,{ "atfdb.unittest  unittest:acr.Stats1  comment:\"Check counters printed by -stats\"", atf_unit::unittest_acr_Stats1 }
         ,{ "atfdb.unittest  unittest:acr.Unused1  comment:\"\"", atf_unit::unittest_acr_Unused1 }
         ,{ "atfdb.unittest  unittest:acr.Write1  comment:\"\"", atf_unit::unittest_acr_Write1 }
         ,{ "atfdb.unittest  unittest:acr.Write2  comment:\"\"", atf_unit::unittest_acr_Write2 }
+        ,{ "atfdb.unittest  unittest:acr.Write3  comment:\"Copying unmodified lines on -write matches printing all records\"", atf_unit::unittest_acr_Write3 }
+        ,{ "atfdb.unittest  unittest:acr.Write4  comment:\"-write normalizes a file without edits\"", atf_unit::unittest_acr_Write4 }
         ,{ "atfdb.unittest  unittest:acr.Xref1  comment:\"\"", atf_unit::unittest_acr_Xref1 }
         ,{ "atfdb.unittest  unittest:acr.Xref2  comment:\"\"", atf_unit::unittest_acr_Xref2 }
         ,{ "atfdb.unittest  unittest:algo_lib.Abs  comment:\"\"", atf_unit::unittest_algo_lib_Abs }
         ,{ "atfdb.unittest  unittest:algo_lib.Aligned  comment:\"\"", atf_unit::unittest_algo_lib_Aligned }
         ,{ "atfdb.unittest  unittest:algo_lib.Argtuple2  comment:\"\"", atf_unit::unittest_algo_lib_Argtuple2 }
+        ,{ "atfdb.unittest  unittest:algo_lib.Argtuple_Linebuf  comment:\"\"", atf_unit::unittest_algo_lib_Argtuple_Linebuf }
         ,{ "atfdb.unittest  unittest:algo_lib.Argtuple_ReadArgv  comment:\"\"", atf_unit::unittest_algo_lib_Argtuple_ReadArgv }
         ,{ "atfdb.unittest  unittest:algo_lib.Argtuple_ReadStrptr  comment:\"\"", atf_unit::unittest_algo_lib_Argtuple_ReadStrptr }
         ,{ "atfdb.unittest  unittest:algo_lib.AvlvsMap  comment:\"\"", atf_unit::unittest_algo_lib_AvlvsMap }
@@ -758,6 +805,7 @@ static void atf_unit::unittest_LoadStatic() {
         ,{ "atfdb.unittest  unittest:algo_lib.CaseConversion  comment:\"\"", atf_unit::unittest_algo_lib_CaseConversion }
         ,{ "atfdb.unittest  unittest:algo_lib.Ceiling  comment:\"\"", atf_unit::unittest_algo_lib_Ceiling }
         ,{ "atfdb.unittest  unittest:algo_lib.Charset  comment:\"\"", atf_unit::unittest_algo_lib_Charset }
+        ,{ "atfdb.unittest  unittest:algo_lib.CharsetFindFirst  comment:\"SIMD charset search vs scalar\"", atf_unit::unittest_algo_lib_CharsetFindFirst }
         ,{ "atfdb.unittest  unittest:algo_lib.CheckIpmask  comment:\"\"", atf_unit::unittest_algo_lib_CheckIpmask }
         ,{ "atfdb.unittest  unittest:algo_lib.CheckShiftMask  comment:\"\"", atf_unit::unittest_algo_lib_CheckShiftMask }
         ,{ "atfdb.unittest  unittest:algo_lib.Clipped  comment:\"\"", atf_unit::unittest_algo_lib_Clipped }
@@ -781,6 +829,7 @@ static void atf_unit::unittest_LoadStatic() {
         ,{ "atfdb.unittest  unittest:algo_lib.ParseHex1  comment:\"\"", atf_unit::unittest_algo_lib_ParseHex1 }
         ,{ "atfdb.unittest  unittest:algo_lib.ParseHex2  comment:\"\"", atf_unit::unittest_algo_lib_ParseHex2 }
         ,{ "atfdb.unittest  unittest:algo_lib.ParseNumber  comment:\"\"", atf_unit::unittest_algo_lib_ParseNumber }
+        ,{ "atfdb.unittest  unittest:algo_lib.ParseNumberExact  comment:\"Number parsing/printing vs strtod and snprintf\"", atf_unit::unittest_algo_lib_ParseNumberExact }
         ,{ "atfdb.unittest  unittest:algo_lib.ParseNumber_Overflow1  comment:\"Test for LnumU32Str7Base36 overflow\"", atf_unit::unittest_algo_lib_ParseNumber_Overflow1 }
         ,{ "atfdb.unittest  unittest:algo_lib.ParseNumber_Overflow2  comment:\"Test for LnumU64Str20 overflow\"", atf_unit::unittest_algo_lib_ParseNumber_Overflow2 }
         ,{ "atfdb.unittest  unittest:algo_lib.ParseNumber_Overflow3  comment:\"Test for LnumU64Str22 overflow\"", atf_unit::unittest_algo_lib_ParseNumber_Overflow3 }
@@ -788,11 +837,13 @@ static void atf_unit::unittest_LoadStatic() {
         ,{ "atfdb.unittest  unittest:algo_lib.ParseOct3  comment:\"\"", atf_unit::unittest_algo_lib_ParseOct3 }
         ,{ "atfdb.unittest  unittest:algo_lib.ParseURL1  comment:\"\"", atf_unit::unittest_algo_lib_ParseURL1 }
         ,{ "atfdb.unittest  unittest:algo_lib.ParseUnTime  comment:\"\"", atf_unit::unittest_algo_lib_ParseUnTime }
+        ,{ "atfdb.unittest  unittest:algo_lib.PerfCharsetScan  comment:\"Throughput of ssim token scanning\"", atf_unit::unittest_algo_lib_PerfCharsetScan }
         ,{ "atfdb.unittest  unittest:algo_lib.PerfIntrinsics  comment:\"\"", atf_unit::unittest_algo_lib_PerfIntrinsics }
         ,{ "atfdb.unittest  unittest:algo_lib.PerfMinMaxAvg  comment:\"\"", atf_unit::unittest_algo_lib_PerfMinMaxAvg }
         ,{ "atfdb.unittest  unittest:algo_lib.PerfParseDouble  comment:\"\"", atf_unit::unittest_algo_lib_PerfParseDouble }
         ,{ "atfdb.unittest  unittest:algo_lib.PerfParseNum  comment:\"\"", atf_unit::unittest_algo_lib_PerfParseNum }
         ,{ "atfdb.unittest  unittest:algo_lib.PerfSort  comment:\"\"", atf_unit::unittest_algo_lib_PerfSort }
+        ,{ "atfdb.unittest  unittest:algo_lib.PerfSsimRead  comment:\"Generated ssim reader vs generic attribute loop\"", atf_unit::unittest_algo_lib_PerfSsimRead }
         ,{ "atfdb.unittest  unittest:algo_lib.PerfTruncVsFtol  comment:\"\"", atf_unit::unittest_algo_lib_PerfTruncVsFtol }
         ,{ "atfdb.unittest  unittest:algo_lib.PopCnt1  comment:\"\"", atf_unit::unittest_algo_lib_PopCnt1 }
         ,{ "atfdb.unittest  unittest:algo_lib.PopCnt2  comment:\"\"", atf_unit::unittest_algo_lib_PopCnt2 }
@@ -804,6 +855,7 @@ static void atf_unit::unittest_LoadStatic() {
         ,{ "atfdb.unittest  unittest:algo_lib.PrintSsim  comment:\"\"", atf_unit::unittest_algo_lib_PrintSsim }
         ,{ "atfdb.unittest  unittest:algo_lib.PrintTime  comment:\"\"", atf_unit::unittest_algo_lib_PrintTime }
         ,{ "atfdb.unittest  unittest:algo_lib.PrintWithCommas  comment:\"\"", atf_unit::unittest_algo_lib_PrintWithCommas }
+        ,{ "atfdb.unittest  unittest:algo_lib.PrlogBuffered  comment:\"Buffered prlog output\"", atf_unit::unittest_algo_lib_PrlogBuffered }
         ,{ "atfdb.unittest  unittest:algo_lib.ReadLine  comment:\"\"", atf_unit::unittest_algo_lib_ReadLine }
         ,{ "atfdb.unittest  unittest:algo_lib.ReadModuleId  comment:\"\"", atf_unit::unittest_algo_lib_ReadModuleId }
         ,{ "atfdb.unittest  unittest:algo_lib.Regx  comment:\"\"", atf_unit::unittest_algo_lib_Regx }
@@ -819,6 +871,8 @@ static void atf_unit::unittest_LoadStatic() {
         ,{ "atfdb.unittest  unittest:algo_lib.SchedTime  comment:\"\"", atf_unit::unittest_algo_lib_SchedTime }
         ,{ "atfdb.unittest  unittest:algo_lib.Sleep  comment:\"\"", atf_unit::unittest_algo_lib_Sleep }
         ,{ "atfdb.unittest  unittest:algo_lib.Smallstr  comment:\"\"", atf_unit::unittest_algo_lib_Smallstr }
+        ,{ "atfdb.unittest  unittest:algo_lib.SsimReadInorder  comment:\"In-order fast path of generated ssim readers\"", atf_unit::unittest_algo_lib_SsimReadInorder }
+        ,{ "atfdb.unittest  unittest:algo_lib.SsimSnapshot  comment:\"Binary ssim input snapshot under temp/\"", atf_unit::unittest_algo_lib_SsimSnapshot }
         ,{ "atfdb.unittest  unittest:algo_lib.Strfind  comment:\"\"", atf_unit::unittest_algo_lib_Strfind }
         ,{ "atfdb.unittest  unittest:algo_lib.StringCase  comment:\"\"", atf_unit::unittest_algo_lib_StringCase }
         ,{ "atfdb.unittest  unittest:algo_lib.StringFind  comment:\"\"", atf_unit::unittest_algo_lib_StringFind }
@@ -829,6 +883,8 @@ static void atf_unit::unittest_LoadStatic() {
         ,{ "atfdb.unittest  unittest:algo_lib.SysEval  comment:\"\"", atf_unit::unittest_algo_lib_SysEval }
         ,{ "atfdb.unittest  unittest:algo_lib.Tabulate  comment:\"\"", atf_unit::unittest_algo_lib_Tabulate }
         ,{ "atfdb.unittest  unittest:algo_lib.Tempfile  comment:\"\"", atf_unit::unittest_algo_lib_Tempfile }
+        ,{ "atfdb.unittest  unittest:algo_lib.TempstrPool  comment:\"tempstr size-class pool and TempstrScope\"", atf_unit::unittest_algo_lib_TempstrPool }
+        ,{ "atfdb.unittest  unittest:algo_lib.TempstrThread  comment:\"Per-thread tempstr pools\"", atf_unit::unittest_algo_lib_TempstrThread }
         ,{ "atfdb.unittest  unittest:algo_lib.TestBitSet  comment:\"Bitset over Tary\"", atf_unit::unittest_algo_lib_TestBitSet }
         ,{ "atfdb.unittest  unittest:algo_lib.TestFbitset  comment:\"Bitset over Inlary u16\"", atf_unit::unittest_algo_lib_TestFbitset }
         ,{ "atfdb.unittest  unittest:algo_lib.TestFbitset2  comment:\"Bitset over single u8\"", atf_unit::unittest_algo_lib_TestFbitset2 }
@@ -1082,7 +1138,8 @@ bool atf_unit::_db_XrefMaybe() {
 // --- atf_unit.FDb.ind_unittest.Find
 // Find row by key. Return NULL if not found.
 atf_unit::FUnittest* atf_unit::ind_unittest_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_unittest_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_unittest_buckets_n - 1);
     atf_unit::FUnittest* *e = &_db.ind_unittest_buckets_elems[index];
     atf_unit::FUnittest* ret=NULL;
     do {
@@ -1124,7 +1181,8 @@ bool atf_unit::ind_unittest_InsertMaybe(atf_unit::FUnittest& row) {
     ind_unittest_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_unittest_next == (atf_unit::FUnittest*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.unittest) & (_db.ind_unittest_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.unittest);
+        u32 index = hash & (_db.ind_unittest_buckets_n - 1);
         atf_unit::FUnittest* *prev = &_db.ind_unittest_buckets_elems[index];
         do {
             atf_unit::FUnittest* ret = *prev;
@@ -1150,7 +1208,8 @@ bool atf_unit::ind_unittest_InsertMaybe(atf_unit::FUnittest& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void atf_unit::ind_unittest_Remove(atf_unit::FUnittest& row) {
     if (LIKELY(row.ind_unittest_next != (atf_unit::FUnittest*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.unittest) & (_db.ind_unittest_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.unittest);
+        u32 index = hash & (_db.ind_unittest_buckets_n - 1);
         atf_unit::FUnittest* *prev = &_db.ind_unittest_buckets_elems[index]; // addr of pointer to current element
         while (atf_unit::FUnittest *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1203,7 +1262,8 @@ void atf_unit::ind_unittest_Reserve(int n) {
 // --- atf_unit.FDb.ind_testrun.Find
 // Find row by key. Return NULL if not found.
 atf_unit::FTestrun* atf_unit::ind_testrun_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_testrun_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_testrun_buckets_n - 1);
     atf_unit::FTestrun* *e = &_db.ind_testrun_buckets_elems[index];
     atf_unit::FTestrun* ret=NULL;
     do {
@@ -1229,7 +1289,8 @@ bool atf_unit::ind_testrun_InsertMaybe(atf_unit::FTestrun& row) {
     ind_testrun_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_testrun_next == (atf_unit::FTestrun*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.testrun) & (_db.ind_testrun_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.testrun);
+        u32 index = hash & (_db.ind_testrun_buckets_n - 1);
         atf_unit::FTestrun* *prev = &_db.ind_testrun_buckets_elems[index];
         do {
             atf_unit::FTestrun* ret = *prev;
@@ -1255,7 +1316,8 @@ bool atf_unit::ind_testrun_InsertMaybe(atf_unit::FTestrun& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void atf_unit::ind_testrun_Remove(atf_unit::FTestrun& row) {
     if (LIKELY(row.ind_testrun_next != (atf_unit::FTestrun*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.testrun) & (_db.ind_testrun_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.testrun);
+        u32 index = hash & (_db.ind_testrun_buckets_n - 1);
         atf_unit::FTestrun* *prev = &_db.ind_testrun_buckets_elems[index]; // addr of pointer to current element
         while (atf_unit::FTestrun *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -2395,10 +2457,544 @@ void atf_unit::index_Setary(atf_unit::FPerfSort& parent, atf_unit::FPerfSort &rh
     }
 }
 
+// --- atf_unit.FPerfSort.radix.Addary
+// Reserve space (this may move memory). Insert N element at the end.
+// Return aryptr to newly inserted block.
+// If the RHS argument aliases the array (refers to the same memory), exit program with fatal error.
+algo::aryptr<atf_unit::Dbl> atf_unit::radix_Addary(atf_unit::FPerfSort& parent, algo::aryptr<atf_unit::Dbl> rhs) {
+    bool overlaps = rhs.n_elems>0 && rhs.elems >= parent.radix_elems && rhs.elems < parent.radix_elems + parent.radix_max;
+    if (UNLIKELY(overlaps)) {
+        FatalErrorExit("atf_unit.tary_alias  field:atf_unit.FPerfSort.radix  comment:'alias error: sub-array is being appended to the whole'");
+    }
+    int nnew = rhs.n_elems;
+    radix_Reserve(parent, nnew); // reserve space
+    int at = parent.radix_n;
+    for (int i = 0; i < nnew; i++) {
+        new (parent.radix_elems + at + i) atf_unit::Dbl(rhs[i]);
+        parent.radix_n++;
+    }
+    return algo::aryptr<atf_unit::Dbl>(parent.radix_elems + at, nnew);
+}
+
+// --- atf_unit.FPerfSort.radix.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_unit::Dbl& atf_unit::radix_Alloc(atf_unit::FPerfSort& parent) {
+    radix_Reserve(parent, 1);
+    int n  = parent.radix_n;
+    int at = n;
+    atf_unit::Dbl *elems = parent.radix_elems;
+    new (elems + at) atf_unit::Dbl(); // construct new element, default initializer
+    parent.radix_n = n+1;
+    return elems[at];
+}
+
+// --- atf_unit.FPerfSort.radix.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_unit::Dbl& atf_unit::radix_AllocAt(atf_unit::FPerfSort& parent, int at) {
+    radix_Reserve(parent, 1);
+    int n  = parent.radix_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("atf_unit.bad_alloc_at  field:atf_unit.FPerfSort.radix  comment:'index out of range'");
+    }
+    atf_unit::Dbl *elems = parent.radix_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(atf_unit::Dbl));
+    new (elems + at) atf_unit::Dbl(); // construct element, default initializer
+    parent.radix_n = n+1;
+    return elems[at];
+}
+
+// --- atf_unit.FPerfSort.radix.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_unit::Dbl> atf_unit::radix_AllocN(atf_unit::FPerfSort& parent, int n_elems) {
+    radix_Reserve(parent, n_elems);
+    int old_n  = parent.radix_n;
+    int new_n = old_n + n_elems;
+    atf_unit::Dbl *elems = parent.radix_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) atf_unit::Dbl(); // construct new element, default initialize
+    }
+    parent.radix_n = new_n;
+    return algo::aryptr<atf_unit::Dbl>(elems + old_n, n_elems);
+}
+
+// --- atf_unit.FPerfSort.radix.Remove
+// Remove item by index. If index outside of range, do nothing.
+void atf_unit::radix_Remove(atf_unit::FPerfSort& parent, u32 i) {
+    u32 lim = parent.radix_n;
+    atf_unit::Dbl *elems = parent.radix_elems;
+    if (i < lim) {
+        memmove(elems + i, elems + (i + 1), sizeof(atf_unit::Dbl) * (lim - (i + 1)));
+        parent.radix_n = lim - 1;
+    }
+}
+
+// --- atf_unit.FPerfSort.radix.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_unit::radix_RemoveLast(atf_unit::FPerfSort& parent) {
+    u64 n = parent.radix_n;
+    if (n > 0) {
+        n -= 1;
+        parent.radix_n = n;
+    }
+}
+
+// --- atf_unit.FPerfSort.radix.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void atf_unit::radix_AbsReserve(atf_unit::FPerfSort& parent, int n) {
+    u32 old_max  = parent.radix_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(parent.radix_elems, old_max * sizeof(atf_unit::Dbl), new_max * sizeof(atf_unit::Dbl));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("atf_unit.tary_nomem  field:atf_unit.FPerfSort.radix  comment:'out of memory'");
+    }
+    parent.radix_elems = (atf_unit::Dbl*)new_mem;
+    parent.radix_max = new_max;
+}
+
+// --- atf_unit.FPerfSort.radix.Setary
+// Copy contents of RHS to PARENT.
+void atf_unit::radix_Setary(atf_unit::FPerfSort& parent, atf_unit::FPerfSort &rhs) {
+    radix_RemoveAll(parent);
+    int nnew = rhs.radix_n;
+    radix_Reserve(parent, nnew); // reserve space
+    for (int i = 0; i < nnew; i++) { // copy elements over
+        new (parent.radix_elems + i) atf_unit::Dbl(radix_qFind(rhs, i));
+        parent.radix_n = i + 1;
+    }
+}
+
+// --- atf_unit.FPerfSort.radix.Setary2
+// Copy specified array into radix, discarding previous contents.
+// If the RHS argument aliases the array (refers to the same memory), throw exception.
+void atf_unit::radix_Setary(atf_unit::FPerfSort& parent, const algo::aryptr<atf_unit::Dbl> &rhs) {
+    radix_RemoveAll(parent);
+    radix_Addary(parent, rhs);
+}
+
+// --- atf_unit.FPerfSort.radix.Swap
+// Swap values elem_a and elem_b
+inline static void atf_unit::radix_Swap(atf_unit::Dbl &elem_a, atf_unit::Dbl &elem_b) {
+    atf_unit::Dbl temp = elem_a;
+    elem_a = elem_b;
+    elem_b = temp;
+}
+
+// --- atf_unit.FPerfSort.radix.Rotleft
+// Left circular shift of three-tuple
+inline static void atf_unit::radix_Rotleft(atf_unit::Dbl &elem_a, atf_unit::Dbl &elem_b, atf_unit::Dbl &elem_c) {
+    atf_unit::Dbl temp = elem_a;
+    elem_a = elem_b;
+    elem_b = elem_c;
+    elem_c = temp;
+}
+
+// --- atf_unit.FPerfSort.radix.Lt
+// Compare values elem_a and elem_b
+// The comparison function must be anti-symmetric: if a>b, then !(b>a).
+// If not, mayhem results.
+static bool atf_unit::radix_Lt(atf_unit::Dbl elem_a, atf_unit::Dbl elem_b) {
+    bool ret;
+    ret = elem_a.val < elem_b.val;
+    return ret;
+}
+
+// --- atf_unit.FPerfSort.radix.SortedQ
+// Verify whether array is sorted
+bool atf_unit::radix_SortedQ(atf_unit::FPerfSort& parent) {
+    atf_unit::Dbl *elems = radix_Getary(parent).elems;
+    int n = radix_N(parent);
+    for (int i = 1; i < n; i++) {
+        if (radix_Lt(elems[i], elems[i-1])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// --- atf_unit.FPerfSort.radix.RadixKey
+// Extract radix key word WORD (0=most significant) from ELEM.
+// Unsigned comparison of keys gives the same order as radix_Lt.
+inline static u64 atf_unit::radix_RadixKey(atf_unit::Dbl &elem, int word) {
+    (void)word;
+    double val = elem.val;
+    u64 bits;
+    memcpy(&bits, &val, sizeof(bits));
+    return bits ^ (u64(i64(bits) >> 63) | (u64(1) << 63));
+}
+
+// --- atf_unit.FPerfSort.radix.RadixSort
+// Radix sort (stable)
+// Keys are extracted into a temp array, sorted with LSD byte radix
+// (one round per key word, least significant first), then elements
+// are moved to their final positions in one pass.
+void atf_unit::radix_RadixSort(atf_unit::FPerfSort& parent) {
+    atf_unit::Dbl *elems = radix_Getary(parent).elems;
+    int n = radix_N(parent);
+    if (n < 2) {
+        return;
+    }
+    algo::RadixKey *buf = (algo::RadixKey*)algo_lib::malloc_AllocMem(sizeof(algo::RadixKey) * n * 2);
+    algo::RadixKey *keys = buf;
+    algo::RadixKey *tmp = buf + n;
+    for (int i = 0; i < n; i++) {
+        keys[i].idx = i;
+    }
+    for (int word = 1 - 1; word >= 0; word--) {
+        for (int i = 0; i < n; i++) {
+            keys[i].key = radix_RadixKey(elems[keys[i].idx], word);
+        }
+        algo_lib::RadixSortKeys(keys, tmp, n);
+    }
+    // move elements into place (bitwise, as in Swap)
+    atf_unit::Dbl *copy = (atf_unit::Dbl*)algo_lib::malloc_AllocMem(sizeof(atf_unit::Dbl) * n);
+    memcpy((void*)copy, (void*)elems, sizeof(atf_unit::Dbl) * n);
+    for (int i = 0; i < n; i++) {
+        memcpy((void*)(elems + i), (void*)(copy + keys[i].idx), sizeof(atf_unit::Dbl));
+    }
+    algo_lib::malloc_FreeMem(copy, sizeof(atf_unit::Dbl) * n);
+    algo_lib::malloc_FreeMem(buf, sizeof(algo::RadixKey) * n * 2);
+}
+
+// --- atf_unit.FPerfSort.parallel.Addary
+// Reserve space (this may move memory). Insert N element at the end.
+// Return aryptr to newly inserted block.
+// If the RHS argument aliases the array (refers to the same memory), exit program with fatal error.
+algo::aryptr<atf_unit::Dbl> atf_unit::parallel_Addary(atf_unit::FPerfSort& parent, algo::aryptr<atf_unit::Dbl> rhs) {
+    bool overlaps = rhs.n_elems>0 && rhs.elems >= parent.parallel_elems && rhs.elems < parent.parallel_elems + parent.parallel_max;
+    if (UNLIKELY(overlaps)) {
+        FatalErrorExit("atf_unit.tary_alias  field:atf_unit.FPerfSort.parallel  comment:'alias error: sub-array is being appended to the whole'");
+    }
+    int nnew = rhs.n_elems;
+    parallel_Reserve(parent, nnew); // reserve space
+    int at = parent.parallel_n;
+    for (int i = 0; i < nnew; i++) {
+        new (parent.parallel_elems + at + i) atf_unit::Dbl(rhs[i]);
+        parent.parallel_n++;
+    }
+    return algo::aryptr<atf_unit::Dbl>(parent.parallel_elems + at, nnew);
+}
+
+// --- atf_unit.FPerfSort.parallel.Alloc
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_unit::Dbl& atf_unit::parallel_Alloc(atf_unit::FPerfSort& parent) {
+    parallel_Reserve(parent, 1);
+    int n  = parent.parallel_n;
+    int at = n;
+    atf_unit::Dbl *elems = parent.parallel_elems;
+    new (elems + at) atf_unit::Dbl(); // construct new element, default initializer
+    parent.parallel_n = n+1;
+    return elems[at];
+}
+
+// --- atf_unit.FPerfSort.parallel.AllocAt
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_unit::Dbl& atf_unit::parallel_AllocAt(atf_unit::FPerfSort& parent, int at) {
+    parallel_Reserve(parent, 1);
+    int n  = parent.parallel_n;
+    if (UNLIKELY(u64(at) >= u64(n+1))) {
+        FatalErrorExit("atf_unit.bad_alloc_at  field:atf_unit.FPerfSort.parallel  comment:'index out of range'");
+    }
+    atf_unit::Dbl *elems = parent.parallel_elems;
+    memmove(elems + at + 1, elems + at, (n - at) * sizeof(atf_unit::Dbl));
+    new (elems + at) atf_unit::Dbl(); // construct element, default initializer
+    parent.parallel_n = n+1;
+    return elems[at];
+}
+
+// --- atf_unit.FPerfSort.parallel.AllocN
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_unit::Dbl> atf_unit::parallel_AllocN(atf_unit::FPerfSort& parent, int n_elems) {
+    parallel_Reserve(parent, n_elems);
+    int old_n  = parent.parallel_n;
+    int new_n = old_n + n_elems;
+    atf_unit::Dbl *elems = parent.parallel_elems;
+    for (int i = old_n; i < new_n; i++) {
+        new (elems + i) atf_unit::Dbl(); // construct new element, default initialize
+    }
+    parent.parallel_n = new_n;
+    return algo::aryptr<atf_unit::Dbl>(elems + old_n, n_elems);
+}
+
+// --- atf_unit.FPerfSort.parallel.Remove
+// Remove item by index. If index outside of range, do nothing.
+void atf_unit::parallel_Remove(atf_unit::FPerfSort& parent, u32 i) {
+    u32 lim = parent.parallel_n;
+    atf_unit::Dbl *elems = parent.parallel_elems;
+    if (i < lim) {
+        memmove(elems + i, elems + (i + 1), sizeof(atf_unit::Dbl) * (lim - (i + 1)));
+        parent.parallel_n = lim - 1;
+    }
+}
+
+// --- atf_unit.FPerfSort.parallel.RemoveLast
+// Delete last element of array. Do nothing if array is empty.
+void atf_unit::parallel_RemoveLast(atf_unit::FPerfSort& parent) {
+    u64 n = parent.parallel_n;
+    if (n > 0) {
+        n -= 1;
+        parent.parallel_n = n;
+    }
+}
+
+// --- atf_unit.FPerfSort.parallel.AbsReserve
+// Make sure N elements fit in array. Process dies if out of memory
+void atf_unit::parallel_AbsReserve(atf_unit::FPerfSort& parent, int n) {
+    u32 old_max  = parent.parallel_max;
+    u32 new_max  = i32_Max(i32_Max(old_max * 2, n), 4);
+    void *new_mem = algo_lib::malloc_ReallocMem(parent.parallel_elems, old_max * sizeof(atf_unit::Dbl), new_max * sizeof(atf_unit::Dbl));
+    if (UNLIKELY(!new_mem)) {
+        FatalErrorExit("atf_unit.tary_nomem  field:atf_unit.FPerfSort.parallel  comment:'out of memory'");
+    }
+    parent.parallel_elems = (atf_unit::Dbl*)new_mem;
+    parent.parallel_max = new_max;
+}
+
+// --- atf_unit.FPerfSort.parallel.Setary
+// Copy contents of RHS to PARENT.
+void atf_unit::parallel_Setary(atf_unit::FPerfSort& parent, atf_unit::FPerfSort &rhs) {
+    parallel_RemoveAll(parent);
+    int nnew = rhs.parallel_n;
+    parallel_Reserve(parent, nnew); // reserve space
+    for (int i = 0; i < nnew; i++) { // copy elements over
+        new (parent.parallel_elems + i) atf_unit::Dbl(parallel_qFind(rhs, i));
+        parent.parallel_n = i + 1;
+    }
+}
+
+// --- atf_unit.FPerfSort.parallel.Setary2
+// Copy specified array into parallel, discarding previous contents.
+// If the RHS argument aliases the array (refers to the same memory), throw exception.
+void atf_unit::parallel_Setary(atf_unit::FPerfSort& parent, const algo::aryptr<atf_unit::Dbl> &rhs) {
+    parallel_RemoveAll(parent);
+    parallel_Addary(parent, rhs);
+}
+
+// --- atf_unit.FPerfSort.parallel.Swap
+// Swap values elem_a and elem_b
+inline static void atf_unit::parallel_Swap(atf_unit::Dbl &elem_a, atf_unit::Dbl &elem_b) {
+    atf_unit::Dbl temp = elem_a;
+    elem_a = elem_b;
+    elem_b = temp;
+}
+
+// --- atf_unit.FPerfSort.parallel.Rotleft
+// Left circular shift of three-tuple
+inline static void atf_unit::parallel_Rotleft(atf_unit::Dbl &elem_a, atf_unit::Dbl &elem_b, atf_unit::Dbl &elem_c) {
+    atf_unit::Dbl temp = elem_a;
+    elem_a = elem_b;
+    elem_b = elem_c;
+    elem_c = temp;
+}
+
+// --- atf_unit.FPerfSort.parallel.Lt
+// Compare values elem_a and elem_b
+// The comparison function must be anti-symmetric: if a>b, then !(b>a).
+// If not, mayhem results.
+static bool atf_unit::parallel_Lt(atf_unit::Dbl elem_a, atf_unit::Dbl elem_b) {
+    bool ret;
+    ret = elem_a.val < elem_b.val;
+    return ret;
+}
+
+// --- atf_unit.FPerfSort.parallel.SortedQ
+// Verify whether array is sorted
+bool atf_unit::parallel_SortedQ(atf_unit::FPerfSort& parent) {
+    atf_unit::Dbl *elems = parallel_Getary(parent).elems;
+    int n = parallel_N(parent);
+    for (int i = 1; i < n; i++) {
+        if (parallel_Lt(elems[i], elems[i-1])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// --- atf_unit.FPerfSort.parallel.IntInsertionSort
+// Internal insertion sort
+static void atf_unit::parallel_IntInsertionSort(atf_unit::Dbl *elems, int n) {
+    for (int i = 1; i < n; ++i) {
+        int j = i;
+        atf_unit::Dbl tmp = elems[i];
+        // shift elements up by one
+        if (parallel_Lt(tmp, elems[j-1])) {
+            do {
+                elems[j] = elems[j-1];
+                j--;
+            } while (j>0 && parallel_Lt(tmp, elems[j-1]));
+            elems[j] = tmp;
+        }
+    }
+}
+
+// --- atf_unit.FPerfSort.parallel.IntHeapSort
+// Internal heap sort
+static void atf_unit::parallel_IntHeapSort(atf_unit::Dbl *elems, int n) {
+    // construct max-heap.
+    // k=current element
+    // j=parent element
+    for (int i = 1; i < n; i++) {
+        int k=i;
+        int j=(i-1)/2;
+        while (parallel_Lt(elems[j], elems[k])) {
+            parallel_Swap(elems[k],elems[j]);
+            k=j;
+            j=(k-1)/2;
+        }
+    }
+    // remove elements from heap one-by-one,
+    // deposit them in reverse order starting at the end of ARY.
+    for (int i = n - 1; i>=0; i--) {
+        int k = 0;
+        int l = 1;
+        while (l<i) {
+            l += l<i-1 && parallel_Lt(elems[l], elems[l+1]);
+            if (parallel_Lt(elems[l], elems[i])) {
+                break;
+            }
+            parallel_Swap(elems[k], elems[l]);
+            k = l;
+            l = k*2+1;
+        }
+        if (i != k) {
+            parallel_Swap(elems[i],elems[k]);
+        }
+    }
+}
+
+// --- atf_unit.FPerfSort.parallel.IntQuickSort
+// Quick sort engine
+static void atf_unit::parallel_IntQuickSort(atf_unit::Dbl *elems, int n, int depth) {
+    while (n>16) {
+        // detect degenerate case and revert to heap sort
+        if (depth==0) {
+            parallel_IntHeapSort(elems,n);
+            return;
+        }
+        // elements to sort initially to determine pivot.
+        // choose pp=n/2 in case the input is already sorted.
+        int pi = 0;
+        int pp = n/2;
+        int pj = n-1;
+        // insertion sort for 1st, middle and last element
+        if (parallel_Lt(elems[pp], elems[pi])) {
+            parallel_Swap(elems[pi], elems[pp]);
+        }
+        if (parallel_Lt(elems[pj], elems[pp])) {
+            if (parallel_Lt(elems[pj], elems[pi])) {
+                parallel_Rotleft(elems[pi], elems[pj], elems[pp]);
+            } else {
+                parallel_Swap(elems[pj], elems[pp]);
+            }
+        }
+        // deposit pivot near the end of the array and skip it.
+        parallel_Swap(elems[--pj], elems[pp]);
+        // copy pivot into temporary variable
+        atf_unit::Dbl pivot = elems[pj];
+        for(;;){
+            while (parallel_Lt(elems[++pi], pivot)) {
+            }
+            while (parallel_Lt(pivot, elems[--pj])) {
+            }
+            if (pj <= pi) {
+                break;
+            }
+            parallel_Swap(elems[pi],elems[pj]);
+        }
+        depth -= 1;
+        parallel_IntQuickSort(elems, pi, depth);
+        elems += pi;
+        n -= pi;
+    }
+    // sort the remainder of this section
+    parallel_IntInsertionSort(elems,n);
+}
+
+// --- atf_unit.FPerfSort.parallel.InsertionSort
+// Insertion sort
+void atf_unit::parallel_InsertionSort(atf_unit::FPerfSort& parent) {
+    atf_unit::Dbl *elems = parallel_Getary(parent).elems;
+    int n = parallel_N(parent);
+    parallel_IntInsertionSort(elems, n);
+}
+
+// --- atf_unit.FPerfSort.parallel.HeapSort
+// Heap sort
+void atf_unit::parallel_HeapSort(atf_unit::FPerfSort& parent) {
+    atf_unit::Dbl *elems = parallel_Getary(parent).elems;
+    int n = parallel_N(parent);
+    parallel_IntHeapSort(elems, n);
+}
+
+// --- atf_unit.FPerfSort.parallel.QuickSort
+// Quick sort
+void atf_unit::parallel_QuickSort(atf_unit::FPerfSort& parent) {
+    // compute max recursion depth based on number of elements in the array
+    int max_depth = CeilingLog2(u32(parallel_N(parent) + 1)) + 3;
+    atf_unit::Dbl *elems = parallel_Getary(parent).elems;
+    int n = parallel_N(parent);
+    parallel_IntQuickSort(elems, n, max_depth);
+}
+
+// --- atf_unit.FPerfSort.parallel.SortRun
+// Sort one run of elements (callback for algo_lib::ParallelSort)
+static void atf_unit::parallel_SortRun(void *elems, int n) {
+    int max_depth = CeilingLog2(u32(n + 1)) + 3;
+    parallel_IntQuickSort((atf_unit::Dbl*)elems, n, max_depth);
+}
+
+// --- atf_unit.FPerfSort.parallel.MergeRuns
+// Merge sorted runs A and B into DST (callback for algo_lib::ParallelSort)
+// Elements are moved bitwise, as in Swap.
+static void atf_unit::parallel_MergeRuns(void *dst, void *a, int na, void *b, int nb) {
+    atf_unit::Dbl *out = (atf_unit::Dbl*)dst;
+    atf_unit::Dbl *pa = (atf_unit::Dbl*)a;
+    atf_unit::Dbl *pb = (atf_unit::Dbl*)b;
+    atf_unit::Dbl *ea = pa + na;
+    atf_unit::Dbl *eb = pb + nb;
+    while (pa < ea && pb < eb) {
+        // take from A unless B is strictly less -- keeps merge stable
+        if (parallel_Lt(pb[0], pa[0])) {
+            memcpy((void*)out++, (void*)pb++, sizeof(atf_unit::Dbl));
+        } else {
+            memcpy((void*)out++, (void*)pa++, sizeof(atf_unit::Dbl));
+        }
+    }
+    memcpy((void*)out, (void*)pa, (ea - pa) * sizeof(atf_unit::Dbl));
+    out += ea - pa;
+    memcpy((void*)out, (void*)pb, (eb - pb) * sizeof(atf_unit::Dbl));
+}
+
+// --- atf_unit.FPerfSort.parallel.ParallelSort
+// Parallel sort
+// Large arrays are split into runs, which are sorted in separate threads
+// with quick sort, and merged; small arrays are quick-sorted in the calling thread.
+// parallel_Lt must be thread-safe.
+void atf_unit::parallel_ParallelSort(atf_unit::FPerfSort& parent) {
+    atf_unit::Dbl *elems = parallel_Getary(parent).elems;
+    int n = parallel_N(parent);
+    algo_lib::ParallelSort(elems, n, sizeof(atf_unit::Dbl), parallel_SortRun, parallel_MergeRuns);
+}
+
 // --- atf_unit.FPerfSort..Uninit
 void atf_unit::FPerfSort_Uninit(atf_unit::FPerfSort& parent) {
     atf_unit::FPerfSort &row = parent; (void)row;
 
+    // atf_unit.FPerfSort.parallel.Uninit (Tary)  //
+    // remove all elements from atf_unit.FPerfSort.parallel
+    parallel_RemoveAll(parent);
+    // free memory for Tary atf_unit.FPerfSort.parallel
+    algo_lib::malloc_FreeMem(parent.parallel_elems, sizeof(atf_unit::Dbl)*parent.parallel_max); // (atf_unit.FPerfSort.parallel)
+
+    // atf_unit.FPerfSort.radix.Uninit (Tary)  //
+    // remove all elements from atf_unit.FPerfSort.radix
+    radix_RemoveAll(parent);
+    // free memory for Tary atf_unit.FPerfSort.radix
+    algo_lib::malloc_FreeMem(parent.radix_elems, sizeof(atf_unit::Dbl)*parent.radix_max); // (atf_unit.FPerfSort.radix)
+
     // atf_unit.FPerfSort.index.Uninit (Tary)  //
     // remove all elements from atf_unit.FPerfSort.index
     index_RemoveAll(parent);
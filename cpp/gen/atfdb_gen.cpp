@@ -24,6 +24,7 @@ bool atfdb::Amctest_ReadFieldMaybe(atfdb::Amctest &parent, algo::strptr field, a
     bool retval = true; // default is no error
     switch(field_id) {
         case atfdb_FieldId_amctest: retval = algo::Smallstr50_ReadStrptrMaybe(parent.amctest, strval); break;
+        case atfdb_FieldId_manual: retval = bool_ReadStrptrMaybe(parent.manual, strval); break;
         case atfdb_FieldId_comment: retval = algo::Comment_ReadStrptrMaybe(parent.comment, strval); break;
         default: break;
     }
@@ -39,9 +40,22 @@ bool atfdb::Amctest_ReadFieldMaybe(atfdb::Amctest &parent, algo::strptr field, a
 bool atfdb::Amctest_ReadStrptrMaybe(atfdb::Amctest &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "atfdb.amctest") || algo::StripTypeTag(in_str, "atfdb.Amctest");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Amctest_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "amctest", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.amctest, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "manual", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.manual, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Amctest_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -54,6 +68,9 @@ void atfdb::Amctest_Print(atfdb::Amctest & row, algo::cstring &str) {
     algo::Smallstr50_Print(row.amctest, temp);
     PrintAttrSpaceReset(str,"amctest", temp);
 
+    bool_Print(row.manual, temp);
+    PrintAttrSpaceReset(str,"manual", temp);
+
     algo::Comment_Print(row.comment, temp);
     PrintAttrSpaceReset(str,"comment", temp);
 }
@@ -65,6 +82,7 @@ const char* atfdb::value_ToCstr(const atfdb::FieldId& parent) {
     const char *ret = NULL;
     switch(value_GetEnum(parent)) {
         case atfdb_FieldId_amctest         : ret = "amctest";  break;
+        case atfdb_FieldId_manual          : ret = "manual";  break;
         case atfdb_FieldId_comment         : ret = "comment";  break;
         case atfdb_FieldId_normcheck       : ret = "normcheck";  break;
         case atfdb_FieldId_unittest        : ret = "unittest";  break;
@@ -104,6 +122,9 @@ bool atfdb::value_SetStrptrMaybe(atfdb::FieldId& parent, algo::strptr rhs) {
         }
         case 6: {
             switch (u64(ReadLE32(rhs.elems))|(u64(ReadLE16(rhs.elems+4))<<32)) {
+                case LE_STR6('m','a','n','u','a','l'): {
+                    value_SetEnum(parent,atfdb_FieldId_manual); ret = true; break;
+                }
                 case LE_STR6('t','a','r','g','e','t'): {
                     value_SetEnum(parent,atfdb_FieldId_target); ret = true; break;
                 }
@@ -200,9 +221,20 @@ bool atfdb::Normcheck_ReadFieldMaybe(atfdb::Normcheck &parent, algo::strptr fiel
 bool atfdb::Normcheck_ReadStrptrMaybe(atfdb::Normcheck &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "atfdb.normcheck") || algo::StripTypeTag(in_str, "atfdb.Normcheck");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Normcheck_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "normcheck", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.normcheck, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Normcheck_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -270,9 +302,20 @@ bool atfdb::Unittest_ReadFieldMaybe(atfdb::Unittest &parent, algo::strptr field,
 bool atfdb::Unittest_ReadStrptrMaybe(atfdb::Unittest &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "atfdb.unittest") || algo::StripTypeTag(in_str, "atfdb.Unittest");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Unittest_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "unittest", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.unittest, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Unittest_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
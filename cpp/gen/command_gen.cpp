@@ -81,6 +81,12 @@ const char* command::value_ToCstr(const command::FieldId& parent) {
         case command_FieldId_field         : ret = "field";  break;
         case command_FieldId_regxof        : ret = "regxof";  break;
         case command_FieldId_meta          : ret = "meta";  break;
+        case command_FieldId_nthread       : ret = "nthread";  break;
+        case command_FieldId_lazy          : ret = "lazy";  break;
+        case command_FieldId_changed       : ret = "changed";  break;
+        case command_FieldId_serve         : ret = "serve";  break;
+        case command_FieldId_server        : ret = "server";  break;
+        case command_FieldId_stats         : ret = "stats";  break;
         case command_FieldId_line          : ret = "line";  break;
         case command_FieldId_point         : ret = "point";  break;
         case command_FieldId_type          : ret = "type";  break;
@@ -341,6 +347,9 @@ bool command::value_SetStrptrMaybe(command::FieldId& parent, algo::strptr rhs) {
                 case LE_STR4('i','f','f','y'): {
                     value_SetEnum(parent,command_FieldId_iffy); ret = true; break;
                 }
+                case LE_STR4('l','a','z','y'): {
+                    value_SetEnum(parent,command_FieldId_lazy); ret = true; break;
+                }
                 case LE_STR4('l','i','n','e'): {
                     value_SetEnum(parent,command_FieldId_line); ret = true; break;
                 }
@@ -448,12 +457,18 @@ bool command::value_SetStrptrMaybe(command::FieldId& parent, algo::strptr rhs) {
                 case LE_STR5('r','o','w','i','d'): {
                     value_SetEnum(parent,command_FieldId_rowid); ret = true; break;
                 }
+                case LE_STR5('s','e','r','v','e'): {
+                    value_SetEnum(parent,command_FieldId_serve); ret = true; break;
+                }
                 case LE_STR5('s','h','e','l','l'): {
                     value_SetEnum(parent,command_FieldId_shell); ret = true; break;
                 }
                 case LE_STR5('s','t','a','r','t'): {
                     value_SetEnum(parent,command_FieldId_start); ret = true; break;
                 }
+                case LE_STR5('s','t','a','t','s'): {
+                    value_SetEnum(parent,command_FieldId_stats); ret = true; break;
+                }
                 case LE_STR5('t','r','a','c','e'): {
                     value_SetEnum(parent,command_FieldId_trace); ret = true; break;
                 }
@@ -543,6 +558,9 @@ bool command::value_SetStrptrMaybe(command::FieldId& parent, algo::strptr rhs) {
                 case LE_STR6('s','e','l','e','c','t'): {
                     value_SetEnum(parent,command_FieldId_select); ret = true; break;
                 }
+                case LE_STR6('s','e','r','v','e','r'): {
+                    value_SetEnum(parent,command_FieldId_server); ret = true; break;
+                }
                 case LE_STR6('s','u','b','s','e','t'): {
                     value_SetEnum(parent,command_FieldId_subset); ret = true; break;
                 }
@@ -575,6 +593,9 @@ bool command::value_SetStrptrMaybe(command::FieldId& parent, algo::strptr rhs) {
                 case LE_STR7('c','a','s','c','d','e','l'): {
                     value_SetEnum(parent,command_FieldId_cascdel); ret = true; break;
                 }
+                case LE_STR7('c','h','a','n','g','e','d'): {
+                    value_SetEnum(parent,command_FieldId_changed); ret = true; break;
+                }
                 case LE_STR7('c','o','m','m','e','n','t'): {
                     value_SetEnum(parent,command_FieldId_comment); ret = true; break;
                 }
@@ -620,6 +641,9 @@ bool command::value_SetStrptrMaybe(command::FieldId& parent, algo::strptr rhs) {
                 case LE_STR7('n','o','i','n','p','u','t'): {
                     value_SetEnum(parent,command_FieldId_noinput); ret = true; break;
                 }
+                case LE_STR7('n','t','h','r','e','a','d'): {
+                    value_SetEnum(parent,command_FieldId_nthread); ret = true; break;
+                }
                 case LE_STR7('o','u','t','_','d','i','r'): {
                     value_SetEnum(parent,command_FieldId_out_dir); ret = true; break;
                 }
@@ -1495,6 +1519,12 @@ bool command::acr_ReadFieldMaybe(command::acr &parent, algo::strptr field, algo:
         case command_FieldId_field: retval = algo::cstring_ReadStrptrMaybe(parent.field, strval); break;
         case command_FieldId_regxof: retval = algo::cstring_ReadStrptrMaybe(parent.regxof, strval); break;
         case command_FieldId_meta: retval = bool_ReadStrptrMaybe(parent.meta, strval); break;
+        case command_FieldId_nthread: retval = i32_ReadStrptrMaybe(parent.nthread, strval); break;
+        case command_FieldId_lazy: retval = bool_ReadStrptrMaybe(parent.lazy, strval); break;
+        case command_FieldId_changed: retval = bool_ReadStrptrMaybe(parent.changed, strval); break;
+        case command_FieldId_serve: retval = algo::cstring_ReadStrptrMaybe(parent.serve, strval); break;
+        case command_FieldId_server: retval = algo::cstring_ReadStrptrMaybe(parent.server, strval); break;
+        case command_FieldId_stats: retval = bool_ReadStrptrMaybe(parent.stats, strval); break;
         default: break;
     }
     if (!retval) {
@@ -1503,6 +1533,22 @@ bool command::acr_ReadFieldMaybe(command::acr &parent, algo::strptr field, algo:
     return retval;
 }
 
+// --- command.acr..ReadStrptrMaybe
+// Read fields of command::acr from an ascii string.
+// The format of the string is an ssim Tuple
+bool command::acr_ReadStrptrMaybe(command::acr &parent, algo::strptr in_str) {
+    bool retval = true;
+    retval = algo::StripTypeTag(in_str, "command.acr");
+    int anon_idx = 0;
+    ind_beg(algo::Attr_curs, attr, in_str) {
+        if (ch_N(attr.name) == 0) {
+            attr.name = acr_GetAnon(parent, anon_idx++);
+        }
+        retval = retval && acr_ReadFieldMaybe(parent, attr.name, attr.value);
+    }ind_end;
+    return retval;
+}
+
 // --- command.acr..ReadTupleMaybe
 // Read fields of command::acr from attributes of ascii tuple TUPLE
 bool command::acr_ReadTupleMaybe(command::acr &parent, algo::Tuple &tuple) {
@@ -1557,6 +1603,12 @@ void command::acr_Init(command::acr& parent) {
     parent.field = algo::strptr("");
     parent.regxof = algo::strptr("");
     parent.meta = bool(false);
+    parent.nthread = i32(0);
+    parent.lazy = bool(false);
+    parent.changed = bool(false);
+    parent.serve = algo::strptr("");
+    parent.server = algo::strptr("");
+    parent.stats = bool(false);
 }
 
 // --- command.acr..PrintArgv
@@ -1768,6 +1820,42 @@ void command::acr_PrintArgv(command::acr & row, algo::cstring &str) {
         str << " -meta:";
         strptr_PrintBash(temp,str);
     }
+    if (!(row.nthread == 0)) {
+        ch_RemoveAll(temp);
+        i32_Print(row.nthread, temp);
+        str << " -nthread:";
+        strptr_PrintBash(temp,str);
+    }
+    if (!(row.lazy == false)) {
+        ch_RemoveAll(temp);
+        bool_Print(row.lazy, temp);
+        str << " -lazy:";
+        strptr_PrintBash(temp,str);
+    }
+    if (!(row.changed == false)) {
+        ch_RemoveAll(temp);
+        bool_Print(row.changed, temp);
+        str << " -changed:";
+        strptr_PrintBash(temp,str);
+    }
+    if (!(row.serve == "")) {
+        ch_RemoveAll(temp);
+        cstring_Print(row.serve, temp);
+        str << " -serve:";
+        strptr_PrintBash(temp,str);
+    }
+    if (!(row.server == "")) {
+        ch_RemoveAll(temp);
+        cstring_Print(row.server, temp);
+        str << " -server:";
+        strptr_PrintBash(temp,str);
+    }
+    if (!(row.stats == false)) {
+        ch_RemoveAll(temp);
+        bool_Print(row.stats, temp);
+        str << " -stats:";
+        strptr_PrintBash(temp,str);
+    }
 }
 
 // --- command.acr..ToCmdline
@@ -1787,6 +1875,133 @@ tempstr command::acr_ToCmdline(command::acr & row) {
     return ret;
 }
 
+// --- command.acr..Print
+// print string representation of command::acr to string LHS, no header -- cprint:command.acr.String
+void command::acr_Print(command::acr & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "command.acr";
+
+    algo::cstring_Print(row.query, temp);
+    PrintAttrSpaceReset(str,"", temp);
+
+    bool_Print(row.select, temp);
+    PrintAttrSpaceReset(str,"select", temp);
+
+    bool_Print(row.del, temp);
+    PrintAttrSpaceReset(str,"del", temp);
+
+    bool_Print(row.insert, temp);
+    PrintAttrSpaceReset(str,"insert", temp);
+
+    bool_Print(row.replace, temp);
+    PrintAttrSpaceReset(str,"replace", temp);
+
+    bool_Print(row.merge, temp);
+    PrintAttrSpaceReset(str,"merge", temp);
+
+    bool_Print(row.unused, temp);
+    PrintAttrSpaceReset(str,"unused", temp);
+
+    bool_Print(row.trunc, temp);
+    PrintAttrSpaceReset(str,"trunc", temp);
+
+    bool_Print(row.check, temp);
+    PrintAttrSpaceReset(str,"check", temp);
+
+    i32_Print(row.maxshow, temp);
+    PrintAttrSpaceReset(str,"maxshow", temp);
+
+    bool_Print(row.write, temp);
+    PrintAttrSpaceReset(str,"write", temp);
+
+    algo::cstring_Print(row.rename, temp);
+    PrintAttrSpaceReset(str,"rename", temp);
+
+    i32_Print(row.nup, temp);
+    PrintAttrSpaceReset(str,"nup", temp);
+
+    i32_Print(row.ndown, temp);
+    PrintAttrSpaceReset(str,"ndown", temp);
+
+    bool_Print(row.xref, temp);
+    PrintAttrSpaceReset(str,"xref", temp);
+
+    bool_Print(row.fldfunc, temp);
+    PrintAttrSpaceReset(str,"fldfunc", temp);
+
+    i32_Print(row.maxgroup, temp);
+    PrintAttrSpaceReset(str,"maxgroup", temp);
+
+    bool_Print(row.pretty, temp);
+    PrintAttrSpaceReset(str,"pretty", temp);
+
+    bool_Print(row.tree, temp);
+    PrintAttrSpaceReset(str,"tree", temp);
+
+    bool_Print(row.loose, temp);
+    PrintAttrSpaceReset(str,"loose", temp);
+
+    bool_Print(row.my, temp);
+    PrintAttrSpaceReset(str,"my", temp);
+
+    algo::cstring_Print(row.schema, temp);
+    PrintAttrSpaceReset(str,"schema", temp);
+
+    bool_Print(row.e, temp);
+    PrintAttrSpaceReset(str,"e", temp);
+
+    bool_Print(row.b, temp);
+    PrintAttrSpaceReset(str,"b", temp);
+
+    bool_Print(row.t, temp);
+    PrintAttrSpaceReset(str,"t", temp);
+
+    bool_Print(row.rowid, temp);
+    PrintAttrSpaceReset(str,"rowid", temp);
+
+    algo::cstring_Print(row.in, temp);
+    PrintAttrSpaceReset(str,"in", temp);
+
+    bool_Print(row.cmt, temp);
+    PrintAttrSpaceReset(str,"cmt", temp);
+
+    bool_Print(row.report, temp);
+    PrintAttrSpaceReset(str,"report", temp);
+
+    bool_Print(row.print, temp);
+    PrintAttrSpaceReset(str,"print", temp);
+
+    algo::cstring_Print(row.cmd, temp);
+    PrintAttrSpaceReset(str,"cmd", temp);
+
+    algo::cstring_Print(row.field, temp);
+    PrintAttrSpaceReset(str,"field", temp);
+
+    algo::cstring_Print(row.regxof, temp);
+    PrintAttrSpaceReset(str,"regxof", temp);
+
+    bool_Print(row.meta, temp);
+    PrintAttrSpaceReset(str,"meta", temp);
+
+    i32_Print(row.nthread, temp);
+    PrintAttrSpaceReset(str,"nthread", temp);
+
+    bool_Print(row.lazy, temp);
+    PrintAttrSpaceReset(str,"lazy", temp);
+
+    bool_Print(row.changed, temp);
+    PrintAttrSpaceReset(str,"changed", temp);
+
+    algo::cstring_Print(row.serve, temp);
+    PrintAttrSpaceReset(str,"serve", temp);
+
+    algo::cstring_Print(row.server, temp);
+    PrintAttrSpaceReset(str,"server", temp);
+
+    bool_Print(row.stats, temp);
+    PrintAttrSpaceReset(str,"stats", temp);
+}
+
 // --- command.acr..GetAnon
 algo::strptr command::acr_GetAnon(command::acr &parent, i32 idx) {
     (void)parent;//only to avoid -Wunused-parameter
@@ -3660,7 +3875,7 @@ void command::acr_ExecX(command::acr_proc& parent) {
 // Call execv()
 // Call execv with specified parameters -- cprint:acr.Argv
 int command::acr_Execv(command::acr_proc& parent) {
-    char *argv[34+2]; // start of first arg (future pointer)
+    char *argv[40+2]; // start of first arg (future pointer)
     algo::tempstr temp;
     int n_argv=0;
     argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
@@ -3904,6 +4119,48 @@ int command::acr_Execv(command::acr_proc& parent) {
         bool_Print(parent.cmd.meta, temp);
         ch_Alloc(temp) = 0;// NUL term for this arg
     }
+
+    if (parent.cmd.nthread != 0) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-nthread:";
+        i32_Print(parent.cmd.nthread, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.cmd.lazy != false) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-lazy:";
+        bool_Print(parent.cmd.lazy, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.cmd.changed != false) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-changed:";
+        bool_Print(parent.cmd.changed, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.cmd.serve != "") {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-serve:";
+        cstring_Print(parent.cmd.serve, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.cmd.server != "") {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-server:";
+        cstring_Print(parent.cmd.server, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
+
+    if (parent.cmd.stats != false) {
+        argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
+        temp << "-stats:";
+        bool_Print(parent.cmd.stats, temp);
+        ch_Alloc(temp) = 0;// NUL term for this arg
+    }
     for (int i=0; i+1 < algo_lib::_db.cmdline.verbose; i++) {
         argv[n_argv++] = (char*)(int_ptr)ch_N(temp);// future pointer
         temp << "-verbose";
@@ -9084,7 +9341,13 @@ inline static void command::SizeCheck() {
     algo_assert(_offset_of(command::acr,field) == 136);
     algo_assert(_offset_of(command::acr,regxof) == 152);
     algo_assert(_offset_of(command::acr,meta) == 168);
-    algo_assert(sizeof(command::acr) == 176);
+    algo_assert(_offset_of(command::acr,nthread) == 172);
+    algo_assert(_offset_of(command::acr,lazy) == 176);
+    algo_assert(_offset_of(command::acr,changed) == 177);
+    algo_assert(_offset_of(command::acr,serve) == 184);
+    algo_assert(_offset_of(command::acr,server) == 200);
+    algo_assert(_offset_of(command::acr,stats) == 216);
+    algo_assert(sizeof(command::acr) == 224);
     algo_assert(_offset_of(command::acr_compl,line) == 0);
     algo_assert(_offset_of(command::acr_compl,point) == 16);
     algo_assert(_offset_of(command::acr_compl,type) == 32);
@@ -85,9 +85,20 @@ bool dev::Arch_ReadFieldMaybe(dev::Arch &parent, algo::strptr field, algo::strpt
 bool dev::Arch_ReadStrptrMaybe(dev::Arch &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.arch") || algo::StripTypeTag(in_str, "dev.Arch");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Arch_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "arch", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.arch, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Arch_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -128,9 +139,24 @@ bool dev::Badline_ReadFieldMaybe(dev::Badline &parent, algo::strptr field, algo:
 bool dev::Badline_ReadStrptrMaybe(dev::Badline &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.badline") || algo::StripTypeTag(in_str, "dev.Badline");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Badline_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "badline", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.badline, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "expr", value, buf);
+    inorder = inorder && algo::Smallstr200_ReadStrptrMaybe(parent.expr, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "targsrc_regx", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.targsrc_regx, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Badline_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -228,9 +254,20 @@ bool dev::Builddir_ReadFieldMaybe(dev::Builddir &parent, algo::strptr field, alg
 bool dev::Builddir_ReadStrptrMaybe(dev::Builddir &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.builddir") || algo::StripTypeTag(in_str, "dev.Builddir");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Builddir_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "builddir", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.builddir, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Builddir_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -269,9 +306,20 @@ bool dev::Cfg_ReadFieldMaybe(dev::Cfg &parent, algo::strptr field, algo::strptr
 bool dev::Cfg_ReadStrptrMaybe(dev::Cfg &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.cfg") || algo::StripTypeTag(in_str, "dev.Cfg");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cfg_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "cfg", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.cfg, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cfg_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -312,9 +360,24 @@ bool dev::Compiler_ReadFieldMaybe(dev::Compiler &parent, algo::strptr field, alg
 bool dev::Compiler_ReadStrptrMaybe(dev::Compiler &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.compiler") || algo::StripTypeTag(in_str, "dev.Compiler");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Compiler_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "compiler", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.compiler, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "ranlib", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ranlib, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "ar", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ar, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Compiler_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -725,9 +788,18 @@ bool dev::Gitfile_ReadFieldMaybe(dev::Gitfile &parent, algo::strptr field, algo:
 bool dev::Gitfile_ReadStrptrMaybe(dev::Gitfile &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.gitfile") || algo::StripTypeTag(in_str, "dev.Gitfile");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Gitfile_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "gitfile", value, buf);
+    inorder = inorder && algo::Smallstr200_ReadStrptrMaybe(parent.gitfile, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Gitfile_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -767,9 +839,28 @@ bool dev::Gitinfo_ReadFieldMaybe(dev::Gitinfo &parent, algo::strptr field, algo:
 bool dev::Gitinfo_ReadStrptrMaybe(dev::Gitinfo &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.gitinfo") || algo::StripTypeTag(in_str, "dev.Gitinfo");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Gitinfo_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "gitinfo", value, buf);
+    inorder = inorder && algo::Smallstr40_ReadStrptrMaybe(parent.gitinfo, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "author", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.author, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "cfg", value, buf);
+    inorder = inorder && algo::Smallstr40_ReadStrptrMaybe(parent.cfg, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "compver", value, buf);
+    inorder = inorder && algo::Smallstr20_ReadStrptrMaybe(parent.compver, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "package", value, buf);
+    inorder = inorder && algo::Smallstr40_ReadStrptrMaybe(parent.package, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Gitinfo_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -901,9 +992,34 @@ bool dev::Linelim_ReadFieldMaybe(dev::Linelim &parent, algo::strptr field, algo:
 bool dev::Linelim_ReadStrptrMaybe(dev::Linelim &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.linelim") || algo::StripTypeTag(in_str, "dev.Linelim");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Linelim_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "gitfile", value, buf);
+    inorder = inorder && algo::Smallstr200_ReadStrptrMaybe(parent.gitfile, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "nlongline", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.nlongline, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "longestline", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.longestline, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "nbadws", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.nbadws, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "maxws", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.maxws, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "nlongfunc", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.nlongfunc, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "longestfunc", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.longestfunc, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "nmysteryfunc", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.nmysteryfunc, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "badness", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.badness, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Linelim_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -964,9 +1080,22 @@ bool dev::OptType_ReadFieldMaybe(dev::OptType &parent, algo::strptr field, algo:
 bool dev::OptType_ReadStrptrMaybe(dev::OptType &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.opt_type") || algo::StripTypeTag(in_str, "dev.OptType");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && OptType_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "opt_type", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.opt_type, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "sep", value, buf);
+    inorder = inorder && algo::RspaceStr4_ReadStrptrMaybe(parent.sep, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && OptType_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1009,9 +1138,22 @@ bool dev::Readme_ReadFieldMaybe(dev::Readme &parent, algo::strptr field, algo::s
 bool dev::Readme_ReadStrptrMaybe(dev::Readme &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.readme") || algo::StripTypeTag(in_str, "dev.Readme");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Readme_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "gitfile", value, buf);
+    inorder = inorder && algo::Smallstr200_ReadStrptrMaybe(parent.gitfile, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "inl", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.inl, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Readme_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1054,9 +1196,22 @@ bool dev::Scriptfile_ReadFieldMaybe(dev::Scriptfile &parent, algo::strptr field,
 bool dev::Scriptfile_ReadStrptrMaybe(dev::Scriptfile &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.scriptfile") || algo::StripTypeTag(in_str, "dev.Scriptfile");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Scriptfile_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "gitfile", value, buf);
+    inorder = inorder && algo::Smallstr200_ReadStrptrMaybe(parent.gitfile, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "args", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.args, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Scriptfile_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1109,9 +1264,18 @@ bool dev::Srcfile_ReadFieldMaybe(dev::Srcfile &parent, algo::strptr field, algo:
 bool dev::Srcfile_ReadStrptrMaybe(dev::Srcfile &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.srcfile") || algo::StripTypeTag(in_str, "dev.Srcfile");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Srcfile_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "srcfile", value, buf);
+    inorder = inorder && algo::Smallstr200_ReadStrptrMaybe(parent.srcfile, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Srcfile_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1253,9 +1417,20 @@ bool dev::Syslib_ReadFieldMaybe(dev::Syslib &parent, algo::strptr field, algo::s
 bool dev::Syslib_ReadStrptrMaybe(dev::Syslib &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.syslib") || algo::StripTypeTag(in_str, "dev.Syslib");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Syslib_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "syslib", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.syslib, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Syslib_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1323,9 +1498,20 @@ bool dev::Targdep_ReadFieldMaybe(dev::Targdep &parent, algo::strptr field, algo:
 bool dev::Targdep_ReadStrptrMaybe(dev::Targdep &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.targdep") || algo::StripTypeTag(in_str, "dev.Targdep");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Targdep_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "targdep", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.targdep, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Targdep_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1363,9 +1549,18 @@ bool dev::Target_ReadFieldMaybe(dev::Target &parent, algo::strptr field, algo::s
 bool dev::Target_ReadStrptrMaybe(dev::Target &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.target") || algo::StripTypeTag(in_str, "dev.Target");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Target_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "target", value, buf);
+    inorder = inorder && algo::Smallstr16_ReadStrptrMaybe(parent.target, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Target_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1442,9 +1637,20 @@ bool dev::Targsrc_ReadFieldMaybe(dev::Targsrc &parent, algo::strptr field, algo:
 bool dev::Targsrc_ReadStrptrMaybe(dev::Targsrc &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.targsrc") || algo::StripTypeTag(in_str, "dev.Targsrc");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Targsrc_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "targsrc", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.targsrc, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Targsrc_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1528,9 +1734,22 @@ bool dev::Targsyslib_ReadFieldMaybe(dev::Targsyslib &parent, algo::strptr field,
 bool dev::Targsyslib_ReadStrptrMaybe(dev::Targsyslib &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.targsyslib") || algo::StripTypeTag(in_str, "dev.Targsyslib");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Targsyslib_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "targsyslib", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.targsyslib, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "uname", value, buf);
+    inorder = inorder && uname_ReadStrptrMaybe(parent, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Targsyslib_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1573,9 +1792,22 @@ bool dev::Timefmt_ReadFieldMaybe(dev::Timefmt &parent, algo::strptr field, algo:
 bool dev::Timefmt_ReadStrptrMaybe(dev::Timefmt &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.timefmt") || algo::StripTypeTag(in_str, "dev.Timefmt");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Timefmt_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "timefmt", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.timefmt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "dirname", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.dirname, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Timefmt_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1624,9 +1856,34 @@ bool dev::ToolOpt_ReadFieldMaybe(dev::ToolOpt &parent, algo::strptr field, algo:
 bool dev::ToolOpt_ReadStrptrMaybe(dev::ToolOpt &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.tool_opt") || algo::StripTypeTag(in_str, "dev.ToolOpt");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && ToolOpt_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "tool_opt", value, buf);
+    inorder = inorder && algo::RspaceStr10_ReadStrptrMaybe(parent.tool_opt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "opt_type", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.opt_type, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "opt", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.opt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "target", value, buf);
+    inorder = inorder && algo::Smallstr16_ReadStrptrMaybe(parent.target, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "uname", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.uname, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "compiler", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.compiler, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "cfg", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.cfg, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "arch", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.arch, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && ToolOpt_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1686,9 +1943,20 @@ bool dev::Uname_ReadFieldMaybe(dev::Uname &parent, algo::strptr field, algo::str
 bool dev::Uname_ReadStrptrMaybe(dev::Uname &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dev.uname") || algo::StripTypeTag(in_str, "dev.Uname");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Uname_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "uname", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.uname, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Uname_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
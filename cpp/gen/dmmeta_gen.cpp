@@ -96,11 +96,13 @@ const char *dmmeta_Printfmt_printfmt_Sep          = "Sep";
 const char *dmmeta_Printfmt_printfmt_Tuple        = "Tuple";
 
 // compile-time string constants for dmmeta.Reftype.reftype
-const char *dmmeta_Reftype_reftype_Atree      = "Atree";
-const char *dmmeta_Reftype_reftype_Base       = "Base";
-const char *dmmeta_Reftype_reftype_Bheap      = "Bheap";
-const char *dmmeta_Reftype_reftype_Bitfld     = "Bitfld";
-const char *dmmeta_Reftype_reftype_Blkpool    = "Blkpool";
+const char *dmmeta_Reftype_reftype_Atree     = "Atree";
+const char *dmmeta_Reftype_reftype_Base      = "Base";
+const char *dmmeta_Reftype_reftype_Bheap     = "Bheap";
+const char *dmmeta_Reftype_reftype_Bitfld    = "Bitfld";
+const char *dmmeta_Reftype_reftype_Blkpool   = "Blkpool";
+const char *dmmeta_Reftype_reftype_Btree     = "Btree";
+
 const char *dmmeta_Reftype_reftype_Charset    = "Charset";
 const char *dmmeta_Reftype_reftype_Count      = "Count";
 const char *dmmeta_Reftype_reftype_Cppstack   = "Cppstack";
@@ -136,6 +138,9 @@ const char *dmmeta_Reftype_reftype_ZSListMT   = "ZSListMT";
 const char *dmmeta_Sorttype_sorttype_QuickSort       = "QuickSort";
 const char *dmmeta_Sorttype_sorttype_InsertionSort   = "InsertionSort";
 const char *dmmeta_Sorttype_sorttype_HeapSort        = "HeapSort";
+const char *dmmeta_Sorttype_sorttype_RadixSort       = "RadixSort";
+
+const char *dmmeta_Sorttype_sorttype_ParallelSort   = "ParallelSort";
 
 // compile-time string constants for dmmeta.Ssimfile.ssimfile
 const char *dmmeta_Ssimfile_ssimfile_amcdb_bltin           = "amcdb.bltin";
@@ -170,6 +175,7 @@ const char *dmmeta_Ssimfile_ssimfile_dev_uname             = "dev.uname";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_anonfld        = "dmmeta.anonfld";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_argvtype       = "dmmeta.argvtype";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_basepool       = "dmmeta.basepool";
+const char *dmmeta_Ssimfile_ssimfile_dmmeta_bheap          = "dmmeta.bheap";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_bitfld         = "dmmeta.bitfld";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_cafter         = "dmmeta.cafter";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_cascdel        = "dmmeta.cascdel";
@@ -208,6 +214,7 @@ const char *dmmeta_Ssimfile_ssimfile_dmmeta_fcmap      = "dmmeta.fcmap";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_fcmdline   = "dmmeta.fcmdline";
 
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_fcmp          = "dmmeta.fcmp";
+const char *dmmeta_Ssimfile_ssimfile_dmmeta_fcolumn       = "dmmeta.fcolumn";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_fcompact      = "dmmeta.fcompact";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_fconst        = "dmmeta.fconst";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_fcurs         = "dmmeta.fcurs";
@@ -237,6 +244,7 @@ const char *dmmeta_Ssimfile_ssimfile_dmmeta_inlary        = "dmmeta.inlary";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_lenfld        = "dmmeta.lenfld";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_listtype      = "dmmeta.listtype";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_llist         = "dmmeta.llist";
+const char *dmmeta_Ssimfile_ssimfile_dmmeta_magazine      = "dmmeta.magazine";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_main          = "dmmeta.main";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_msgtype       = "dmmeta.msgtype";
 const char *dmmeta_Ssimfile_ssimfile_dmmeta_nocascdel     = "dmmeta.nocascdel";
@@ -327,9 +335,20 @@ bool dmmeta::Anonfld_ReadFieldMaybe(dmmeta::Anonfld &parent, algo::strptr field,
 bool dmmeta::Anonfld_ReadStrptrMaybe(dmmeta::Anonfld &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.anonfld") || algo::StripTypeTag(in_str, "dmmeta.Anonfld");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Anonfld_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Anonfld_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -369,9 +388,22 @@ bool dmmeta::Argvtype_ReadFieldMaybe(dmmeta::Argvtype &parent, algo::strptr fiel
 bool dmmeta::Argvtype_ReadStrptrMaybe(dmmeta::Argvtype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.argvtype") || algo::StripTypeTag(in_str, "dmmeta.Argvtype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Argvtype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "argvtype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.argvtype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Argvtype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -413,9 +445,20 @@ bool dmmeta::Basepool_ReadFieldMaybe(dmmeta::Basepool &parent, algo::strptr fiel
 bool dmmeta::Basepool_ReadStrptrMaybe(dmmeta::Basepool &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.basepool") || algo::StripTypeTag(in_str, "dmmeta.Basepool");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Basepool_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "base", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.base, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Basepool_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -432,6 +475,70 @@ void dmmeta::Basepool_Print(dmmeta::Basepool & row, algo::cstring &str) {
     PrintAttrSpaceReset(str,"base", temp);
 }
 
+// --- dmmeta.Bheap..ReadFieldMaybe
+bool dmmeta::Bheap_ReadFieldMaybe(dmmeta::Bheap &parent, algo::strptr field, algo::strptr strval) {
+    dmmeta::FieldId field_id;
+    (void)value_SetStrptrMaybe(field_id,field);
+    bool retval = true; // default is no error
+    switch(field_id) {
+        case dmmeta_FieldId_field: retval = algo::Smallstr100_ReadStrptrMaybe(parent.field, strval); break;
+        case dmmeta_FieldId_arity: retval = u32_ReadStrptrMaybe(parent.arity, strval); break;
+        case dmmeta_FieldId_inlkey: retval = bool_ReadStrptrMaybe(parent.inlkey, strval); break;
+        case dmmeta_FieldId_comment: retval = algo::Comment_ReadStrptrMaybe(parent.comment, strval); break;
+        default: break;
+    }
+    if (!retval) {
+        algo_lib::AppendErrtext("attr",field);
+    }
+    return retval;
+}
+
+// --- dmmeta.Bheap..ReadStrptrMaybe
+// Read fields of dmmeta::Bheap from an ascii string.
+// The format of the string is an ssim Tuple
+bool dmmeta::Bheap_ReadStrptrMaybe(dmmeta::Bheap &parent, algo::strptr in_str) {
+    bool retval = true;
+    retval = algo::StripTypeTag(in_str, "dmmeta.bheap") || algo::StripTypeTag(in_str, "dmmeta.Bheap");
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "arity", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.arity, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "inlkey", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.inlkey, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Bheap_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
+    return retval;
+}
+
+// --- dmmeta.Bheap..Print
+// print string representation of dmmeta::Bheap to string LHS, no header -- cprint:dmmeta.Bheap.String
+void dmmeta::Bheap_Print(dmmeta::Bheap & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "dmmeta.bheap";
+
+    algo::Smallstr100_Print(row.field, temp);
+    PrintAttrSpaceReset(str,"field", temp);
+
+    u32_Print(row.arity, temp);
+    PrintAttrSpaceReset(str,"arity", temp);
+
+    bool_Print(row.inlkey, temp);
+    PrintAttrSpaceReset(str,"inlkey", temp);
+
+    algo::Comment_Print(row.comment, temp);
+    PrintAttrSpaceReset(str,"comment", temp);
+}
+
 // --- dmmeta.Bitfld.name.Get
 algo::Smallstr50 dmmeta::name_Get(dmmeta::Bitfld& parent) {
     algo::Smallstr50 ret(algo::Pathcomp(parent.field, ".RR"));
@@ -469,9 +576,26 @@ bool dmmeta::Bitfld_ReadFieldMaybe(dmmeta::Bitfld &parent, algo::strptr field, a
 bool dmmeta::Bitfld_ReadStrptrMaybe(dmmeta::Bitfld &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.bitfld") || algo::StripTypeTag(in_str, "dmmeta.Bitfld");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Bitfld_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "offset", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.offset, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "width", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.width, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "srcfield", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.srcfield, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Bitfld_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -519,9 +643,20 @@ bool dmmeta::Buftype_ReadFieldMaybe(dmmeta::Buftype &parent, algo::strptr field,
 bool dmmeta::Buftype_ReadStrptrMaybe(dmmeta::Buftype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.pnewtype") || algo::StripTypeTag(in_str, "dmmeta.Buftype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Buftype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "pnewtype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.pnewtype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Buftype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -694,9 +829,20 @@ bool dmmeta::Cafter_ReadFieldMaybe(dmmeta::Cafter &parent, algo::strptr field, a
 bool dmmeta::Cafter_ReadStrptrMaybe(dmmeta::Cafter &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cafter") || algo::StripTypeTag(in_str, "dmmeta.Cafter");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cafter_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "cafter", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.cafter, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cafter_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -735,9 +881,20 @@ bool dmmeta::Cascdel_ReadFieldMaybe(dmmeta::Cascdel &parent, algo::strptr field,
 bool dmmeta::Cascdel_ReadStrptrMaybe(dmmeta::Cascdel &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cascdel") || algo::StripTypeTag(in_str, "dmmeta.Cascdel");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cascdel_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cascdel_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -780,9 +937,28 @@ bool dmmeta::Ccmp_ReadFieldMaybe(dmmeta::Ccmp &parent, algo::strptr field, algo:
 bool dmmeta::Ccmp_ReadStrptrMaybe(dmmeta::Ccmp &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.ccmp") || algo::StripTypeTag(in_str, "dmmeta.Ccmp");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Ccmp_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "extrn", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.extrn, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "genop", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.genop, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "order", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.order, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "minmax", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.minmax, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Ccmp_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -835,9 +1011,24 @@ bool dmmeta::Cdecl_ReadFieldMaybe(dmmeta::Cdecl &parent, algo::strptr field, alg
 bool dmmeta::Cdecl_ReadStrptrMaybe(dmmeta::Cdecl &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cdecl") || algo::StripTypeTag(in_str, "dmmeta.Cdecl");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cdecl_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "fwddecl", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.fwddecl, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "gen_using", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.gen_using, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cdecl_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -900,9 +1091,26 @@ bool dmmeta::Cdflt_ReadFieldMaybe(dmmeta::Cdflt &parent, algo::strptr field, alg
 bool dmmeta::Cdflt_ReadStrptrMaybe(dmmeta::Cdflt &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cdflt") || algo::StripTypeTag(in_str, "dmmeta.Cdflt");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cdflt_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "dflt", value, buf);
+    inorder = inorder && dmmeta::CppExpr_ReadStrptrMaybe(parent.dflt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "cppdflt", value, buf);
+    inorder = inorder && dmmeta::CppExpr_ReadStrptrMaybe(parent.cppdflt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "ssimdflt", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ssimdflt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cdflt_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -950,9 +1158,20 @@ bool dmmeta::Cextern_ReadFieldMaybe(dmmeta::Cextern &parent, algo::strptr field,
 bool dmmeta::Cextern_ReadStrptrMaybe(dmmeta::Cextern &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cextern") || algo::StripTypeTag(in_str, "dmmeta.Cextern");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cextern_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "initmemset", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.initmemset, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cextern_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1025,9 +1244,30 @@ bool dmmeta::Cfmt_ReadFieldMaybe(dmmeta::Cfmt &parent, algo::strptr field, algo:
 bool dmmeta::Cfmt_ReadStrptrMaybe(dmmeta::Cfmt &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cfmt") || algo::StripTypeTag(in_str, "dmmeta.Cfmt");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cfmt_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "cfmt", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.cfmt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "printfmt", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.printfmt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "read", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.read, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "print", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.print, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "sep", value, buf);
+    inorder = inorder && algo::Smallstr20_ReadStrptrMaybe(parent.sep, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "genop", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.genop, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cfmt_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1081,9 +1321,20 @@ bool dmmeta::Cget_ReadFieldMaybe(dmmeta::Cget &parent, algo::strptr field, algo:
 bool dmmeta::Cget_ReadStrptrMaybe(dmmeta::Cget &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cget") || algo::StripTypeTag(in_str, "dmmeta.Cget");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cget_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cget_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1125,9 +1376,26 @@ bool dmmeta::Charset_ReadFieldMaybe(dmmeta::Charset &parent, algo::strptr field,
 bool dmmeta::Charset_ReadStrptrMaybe(dmmeta::Charset &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.charset") || algo::StripTypeTag(in_str, "dmmeta.Charset");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Charset_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "expr", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.expr, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "charrange", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.charrange, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "calc", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.calc, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Charset_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1176,9 +1444,22 @@ bool dmmeta::Chash_ReadFieldMaybe(dmmeta::Chash &parent, algo::strptr field, alg
 bool dmmeta::Chash_ReadStrptrMaybe(dmmeta::Chash &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.chash") || algo::StripTypeTag(in_str, "dmmeta.Chash");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Chash_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "hashtype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.hashtype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Chash_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1220,9 +1501,20 @@ bool dmmeta::Cppfunc_ReadFieldMaybe(dmmeta::Cppfunc &parent, algo::strptr field,
 bool dmmeta::Cppfunc_ReadStrptrMaybe(dmmeta::Cppfunc &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cppfunc") || algo::StripTypeTag(in_str, "dmmeta.Cppfunc");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cppfunc_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "expr", value, buf);
+    inorder = inorder && dmmeta::CppExpr_ReadStrptrMaybe(parent.expr, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cppfunc_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1260,9 +1552,18 @@ bool dmmeta::Cppkeyword_ReadFieldMaybe(dmmeta::Cppkeyword &parent, algo::strptr
 bool dmmeta::Cppkeyword_ReadStrptrMaybe(dmmeta::Cppkeyword &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cppkeyword") || algo::StripTypeTag(in_str, "dmmeta.Cppkeyword");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cppkeyword_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "cppkeyword", value, buf);
+    inorder = inorder && algo::Smallstr20_ReadStrptrMaybe(parent.cppkeyword, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cppkeyword_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1300,9 +1601,24 @@ bool dmmeta::Cpptype_ReadFieldMaybe(dmmeta::Cpptype &parent, algo::strptr field,
 bool dmmeta::Cpptype_ReadStrptrMaybe(dmmeta::Cpptype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cpptype") || algo::StripTypeTag(in_str, "dmmeta.Cpptype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cpptype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctor", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.ctor, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "dtor", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.dtor, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "cheap_copy", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.cheap_copy, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cpptype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1349,9 +1665,24 @@ bool dmmeta::Csize_ReadFieldMaybe(dmmeta::Csize &parent, algo::strptr field, alg
 bool dmmeta::Csize_ReadStrptrMaybe(dmmeta::Csize &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.csize") || algo::StripTypeTag(in_str, "dmmeta.Csize");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Csize_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "size", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.size, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "alignment", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.alignment, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Csize_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1397,9 +1728,22 @@ bool dmmeta::Cstr_ReadFieldMaybe(dmmeta::Cstr &parent, algo::strptr field, algo:
 bool dmmeta::Cstr_ReadStrptrMaybe(dmmeta::Cstr &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.cstr") || algo::StripTypeTag(in_str, "dmmeta.Cstr");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Cstr_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "strequiv", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.strequiv, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Cstr_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1470,9 +1814,20 @@ bool dmmeta::Ctype_ReadFieldMaybe(dmmeta::Ctype &parent, algo::strptr field, alg
 bool dmmeta::Ctype_ReadStrptrMaybe(dmmeta::Ctype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.ctype") || algo::StripTypeTag(in_str, "dmmeta.Ctype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Ctype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Ctype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1513,9 +1868,24 @@ bool dmmeta::Ctypelen_ReadFieldMaybe(dmmeta::Ctypelen &parent, algo::strptr fiel
 bool dmmeta::Ctypelen_ReadStrptrMaybe(dmmeta::Ctypelen &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.ctypelen") || algo::StripTypeTag(in_str, "dmmeta.Ctypelen");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Ctypelen_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "len", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.len, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "alignment", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.alignment, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "padbytes", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.padbytes, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Ctypelen_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1595,9 +1965,32 @@ bool dmmeta::Dispatch_ReadFieldMaybe(dmmeta::Dispatch &parent, algo::strptr fiel
 bool dmmeta::Dispatch_ReadStrptrMaybe(dmmeta::Dispatch &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.dispatch") || algo::StripTypeTag(in_str, "dmmeta.Dispatch");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Dispatch_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "dispatch", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.dispatch, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "unk", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.unk, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "read", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.read, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "print", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.print, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "haslen", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.haslen, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "call", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.call, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "strict", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.strict, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Dispatch_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1694,9 +2087,20 @@ bool dmmeta::DispatchMsg_ReadFieldMaybe(dmmeta::DispatchMsg &parent, algo::strpt
 bool dmmeta::DispatchMsg_ReadStrptrMaybe(dmmeta::DispatchMsg &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.dispatch_msg") || algo::StripTypeTag(in_str, "dmmeta.DispatchMsg");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && DispatchMsg_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "dispatch_msg", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.dispatch_msg, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && DispatchMsg_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1736,9 +2140,22 @@ bool dmmeta::Dispctx_ReadFieldMaybe(dmmeta::Dispctx &parent, algo::strptr field,
 bool dmmeta::Dispctx_ReadStrptrMaybe(dmmeta::Dispctx &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.dispctx") || algo::StripTypeTag(in_str, "dmmeta.Dispctx");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Dispctx_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "dispatch", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.dispatch, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Dispctx_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1781,9 +2198,22 @@ bool dmmeta::Dispfilter_ReadFieldMaybe(dmmeta::Dispfilter &parent, algo::strptr
 bool dmmeta::Dispfilter_ReadStrptrMaybe(dmmeta::Dispfilter &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.dispfilter") || algo::StripTypeTag(in_str, "dmmeta.Dispfilter");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Dispfilter_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "dispatch", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.dispatch, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "match_all", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.match_all, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Dispfilter_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1854,9 +2284,20 @@ bool dmmeta::Dispsig_ReadFieldMaybe(dmmeta::Dispsig &parent, algo::strptr field,
 bool dmmeta::Dispsig_ReadStrptrMaybe(dmmeta::Dispsig &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.dispsig") || algo::StripTypeTag(in_str, "dmmeta.Dispsig");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Dispsig_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "dispsig", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.dispsig, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "signature", value, buf);
+    inorder = inorder && algo::Sha1sig_ReadStrptrMaybe(parent.signature, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Dispsig_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1937,9 +2378,22 @@ bool dmmeta::Disptrace_ReadFieldMaybe(dmmeta::Disptrace &parent, algo::strptr fi
 bool dmmeta::Disptrace_ReadStrptrMaybe(dmmeta::Disptrace &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.disptrace") || algo::StripTypeTag(in_str, "dmmeta.Disptrace");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Disptrace_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "dispatch", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.dispatch, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "cycle", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.cycle, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Disptrace_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -1982,9 +2436,22 @@ bool dmmeta::Fbase_ReadFieldMaybe(dmmeta::Fbase &parent, algo::strptr field, alg
 bool dmmeta::Fbase_ReadStrptrMaybe(dmmeta::Fbase &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fbase") || algo::StripTypeTag(in_str, "dmmeta.Fbase");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fbase_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "stripcomment", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.stripcomment, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fbase_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2026,9 +2493,20 @@ bool dmmeta::Fbigend_ReadFieldMaybe(dmmeta::Fbigend &parent, algo::strptr field,
 bool dmmeta::Fbigend_ReadStrptrMaybe(dmmeta::Fbigend &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fbigend") || algo::StripTypeTag(in_str, "dmmeta.Fbigend");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fbigend_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fbigend_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2067,9 +2545,20 @@ bool dmmeta::Fbitset_ReadFieldMaybe(dmmeta::Fbitset &parent, algo::strptr field,
 bool dmmeta::Fbitset_ReadStrptrMaybe(dmmeta::Fbitset &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fbitset") || algo::StripTypeTag(in_str, "dmmeta.Fbitset");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fbitset_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fbitset_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2124,9 +2613,28 @@ bool dmmeta::Fbuf_ReadFieldMaybe(dmmeta::Fbuf &parent, algo::strptr field, algo:
 bool dmmeta::Fbuf_ReadStrptrMaybe(dmmeta::Fbuf &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fbuf") || algo::StripTypeTag(in_str, "dmmeta.Fbuf");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fbuf_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "max", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.max, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "fbuftype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.fbuftype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "insready", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.insready, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "inseof", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.inseof, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fbuf_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2178,9 +2686,22 @@ bool dmmeta::Fbufdir_ReadFieldMaybe(dmmeta::Fbufdir &parent, algo::strptr field,
 bool dmmeta::Fbufdir_ReadStrptrMaybe(dmmeta::Fbufdir &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fbufdir") || algo::StripTypeTag(in_str, "dmmeta.Fbufdir");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fbufdir_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "fbufdir", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.fbufdir, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "read", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.read, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fbufdir_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2225,9 +2746,26 @@ bool dmmeta::Fbuftype_ReadFieldMaybe(dmmeta::Fbuftype &parent, algo::strptr fiel
 bool dmmeta::Fbuftype_ReadStrptrMaybe(dmmeta::Fbuftype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fbuftype") || algo::StripTypeTag(in_str, "dmmeta.Fbuftype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fbuftype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "fbuftype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.fbuftype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "getmsg", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.getmsg, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "skipbytes", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.skipbytes, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "read", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.read, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fbuftype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2276,9 +2814,22 @@ bool dmmeta::Fcast_ReadFieldMaybe(dmmeta::Fcast &parent, algo::strptr field, alg
 bool dmmeta::Fcast_ReadStrptrMaybe(dmmeta::Fcast &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fcast") || algo::StripTypeTag(in_str, "dmmeta.Fcast");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fcast_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "expr", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.expr, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fcast_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2320,9 +2871,20 @@ bool dmmeta::Fcleanup_ReadFieldMaybe(dmmeta::Fcleanup &parent, algo::strptr fiel
 bool dmmeta::Fcleanup_ReadStrptrMaybe(dmmeta::Fcleanup &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fcleanup") || algo::StripTypeTag(in_str, "dmmeta.Fcleanup");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fcleanup_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fcleanup_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2415,9 +2977,22 @@ bool dmmeta::Fcmap_ReadFieldMaybe(dmmeta::Fcmap &parent, algo::strptr field, alg
 bool dmmeta::Fcmap_ReadStrptrMaybe(dmmeta::Fcmap &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fcmap") || algo::StripTypeTag(in_str, "dmmeta.Fcmap");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fcmap_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "fcmap", value, buf);
+    inorder = inorder && algo::Smallstr250_ReadStrptrMaybe(parent.fcmap, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "bidir", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.bidir, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fcmap_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2460,9 +3035,22 @@ bool dmmeta::Fcmdline_ReadFieldMaybe(dmmeta::Fcmdline &parent, algo::strptr fiel
 bool dmmeta::Fcmdline_ReadStrptrMaybe(dmmeta::Fcmdline &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fcmdline") || algo::StripTypeTag(in_str, "dmmeta.Fcmdline");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fcmdline_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "read", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.read, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fcmdline_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2507,9 +3095,26 @@ bool dmmeta::Fcmp_ReadFieldMaybe(dmmeta::Fcmp &parent, algo::strptr field, algo:
 bool dmmeta::Fcmp_ReadStrptrMaybe(dmmeta::Fcmp &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fcmp") || algo::StripTypeTag(in_str, "dmmeta.Fcmp");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fcmp_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "versionsort", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.versionsort, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "casesens", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.casesens, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "extrn", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.extrn, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fcmp_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2535,6 +3140,58 @@ void dmmeta::Fcmp_Print(dmmeta::Fcmp & row, algo::cstring &str) {
     PrintAttrSpaceReset(str,"comment", temp);
 }
 
+// --- dmmeta.Fcolumn..ReadFieldMaybe
+bool dmmeta::Fcolumn_ReadFieldMaybe(dmmeta::Fcolumn &parent, algo::strptr field, algo::strptr strval) {
+    dmmeta::FieldId field_id;
+    (void)value_SetStrptrMaybe(field_id,field);
+    bool retval = true; // default is no error
+    switch(field_id) {
+        case dmmeta_FieldId_field: retval = algo::Smallstr100_ReadStrptrMaybe(parent.field, strval); break;
+        case dmmeta_FieldId_comment: retval = algo::Comment_ReadStrptrMaybe(parent.comment, strval); break;
+        default: break;
+    }
+    if (!retval) {
+        algo_lib::AppendErrtext("attr",field);
+    }
+    return retval;
+}
+
+// --- dmmeta.Fcolumn..ReadStrptrMaybe
+// Read fields of dmmeta::Fcolumn from an ascii string.
+// The format of the string is an ssim Tuple
+bool dmmeta::Fcolumn_ReadStrptrMaybe(dmmeta::Fcolumn &parent, algo::strptr in_str) {
+    bool retval = true;
+    retval = algo::StripTypeTag(in_str, "dmmeta.fcolumn") || algo::StripTypeTag(in_str, "dmmeta.Fcolumn");
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fcolumn_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
+    return retval;
+}
+
+// --- dmmeta.Fcolumn..Print
+// print string representation of dmmeta::Fcolumn to string LHS, no header -- cprint:dmmeta.Fcolumn.String
+void dmmeta::Fcolumn_Print(dmmeta::Fcolumn & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "dmmeta.fcolumn";
+
+    algo::Smallstr100_Print(row.field, temp);
+    PrintAttrSpaceReset(str,"field", temp);
+
+    algo::Comment_Print(row.comment, temp);
+    PrintAttrSpaceReset(str,"comment", temp);
+}
+
 // --- dmmeta.Fcompact..ReadFieldMaybe
 bool dmmeta::Fcompact_ReadFieldMaybe(dmmeta::Fcompact &parent, algo::strptr field, algo::strptr strval) {
     dmmeta::FieldId field_id;
@@ -2557,9 +3214,20 @@ bool dmmeta::Fcompact_ReadFieldMaybe(dmmeta::Fcompact &parent, algo::strptr fiel
 bool dmmeta::Fcompact_ReadStrptrMaybe(dmmeta::Fcompact &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fcompact") || algo::StripTypeTag(in_str, "dmmeta.Fcompact");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fcompact_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fcompact_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2628,9 +3296,22 @@ bool dmmeta::Fconst_ReadFieldMaybe(dmmeta::Fconst &parent, algo::strptr field, a
 bool dmmeta::Fconst_ReadStrptrMaybe(dmmeta::Fconst &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fconst") || algo::StripTypeTag(in_str, "dmmeta.Fconst");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fconst_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "fconst", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.fconst, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "value", value, buf);
+    inorder = inorder && dmmeta::CppExpr_ReadStrptrMaybe(parent.value, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fconst_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2713,9 +3394,20 @@ bool dmmeta::Fcurs_ReadFieldMaybe(dmmeta::Fcurs &parent, algo::strptr field, alg
 bool dmmeta::Fcurs_ReadStrptrMaybe(dmmeta::Fcurs &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fcurs") || algo::StripTypeTag(in_str, "dmmeta.Fcurs");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fcurs_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "fcurs", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.fcurs, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fcurs_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2756,9 +3448,24 @@ bool dmmeta::Fdec_ReadFieldMaybe(dmmeta::Fdec &parent, algo::strptr field, algo:
 bool dmmeta::Fdec_ReadStrptrMaybe(dmmeta::Fdec &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fdec") || algo::StripTypeTag(in_str, "dmmeta.Fdec");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fdec_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "nplace", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.nplace, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "fixedfmt", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.fixedfmt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fdec_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2805,9 +3512,24 @@ bool dmmeta::Fdelay_ReadFieldMaybe(dmmeta::Fdelay &parent, algo::strptr field, a
 bool dmmeta::Fdelay_ReadStrptrMaybe(dmmeta::Fdelay &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fdelay") || algo::StripTypeTag(in_str, "dmmeta.Fdelay");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fdelay_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "fstep", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.fstep, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "delay", value, buf);
+    inorder = inorder && algo::I64Dec9_ReadStrptrMaybe(parent.delay, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "scale", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.scale, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fdelay_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2896,9 +3618,26 @@ bool dmmeta::Field_ReadFieldMaybe(dmmeta::Field &parent, algo::strptr field, alg
 bool dmmeta::Field_ReadStrptrMaybe(dmmeta::Field &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.field") || algo::StripTypeTag(in_str, "dmmeta.Field");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Field_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "arg", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.arg, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "reftype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.reftype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "dflt", value, buf);
+    inorder = inorder && dmmeta::CppExpr_ReadStrptrMaybe(parent.dflt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Field_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -2935,6 +3674,8 @@ const char* dmmeta::value_ToCstr(const dmmeta::FieldId& parent) {
         case dmmeta_FieldId_ctype          : ret = "ctype";  break;
         case dmmeta_FieldId_argvtype       : ret = "argvtype";  break;
         case dmmeta_FieldId_base           : ret = "base";  break;
+        case dmmeta_FieldId_arity          : ret = "arity";  break;
+        case dmmeta_FieldId_inlkey         : ret = "inlkey";  break;
         case dmmeta_FieldId_name           : ret = "name";  break;
         case dmmeta_FieldId_offset         : ret = "offset";  break;
         case dmmeta_FieldId_width          : ret = "width";  break;
@@ -3074,6 +3815,9 @@ const char* dmmeta::value_ToCstr(const dmmeta::FieldId& parent) {
         case dmmeta_FieldId_ssimns         : ret = "ssimns";  break;
         case dmmeta_FieldId_aliased        : ret = "aliased";  break;
         case dmmeta_FieldId_hashfld        : ret = "hashfld";  break;
+        case dmmeta_FieldId_cachehash      : ret = "cachehash";  break;
+        case dmmeta_FieldId_openaddr       : ret = "openaddr";  break;
+        case dmmeta_FieldId_incremental    : ret = "incremental";  break;
         case dmmeta_FieldId_tracefld       : ret = "tracefld";  break;
         case dmmeta_FieldId_tracerec       : ret = "tracerec";  break;
         case dmmeta_FieldId_inscond        : ret = "inscond";  break;
@@ -3234,6 +3978,9 @@ bool dmmeta::value_SetStrptrMaybe(dmmeta::FieldId& parent, algo::strptr rhs) {
                 case LE_STR5('a','f','t','e','r'): {
                     value_SetEnum(parent,dmmeta_FieldId_after); ret = true; break;
                 }
+                case LE_STR5('a','r','i','t','y'): {
+                    value_SetEnum(parent,dmmeta_FieldId_arity); ret = true; break;
+                }
                 case LE_STR5('b','i','d','i','r'): {
                     value_SetEnum(parent,dmmeta_FieldId_bidir); ret = true; break;
                 }
@@ -3311,6 +4058,9 @@ bool dmmeta::value_SetStrptrMaybe(dmmeta::FieldId& parent, algo::strptr rhs) {
                 case LE_STR6('h','a','s','l','e','n'): {
                     value_SetEnum(parent,dmmeta_FieldId_haslen); ret = true; break;
                 }
+                case LE_STR6('i','n','l','k','e','y'): {
+                    value_SetEnum(parent,dmmeta_FieldId_inlkey); ret = true; break;
+                }
                 case LE_STR6('i','n','s','e','o','f'): {
                     value_SetEnum(parent,dmmeta_FieldId_inseof); ret = true; break;
                 }
@@ -3480,6 +4230,9 @@ bool dmmeta::value_SetStrptrMaybe(dmmeta::FieldId& parent, algo::strptr rhs) {
                 case LE_STR8('l','i','s','t','t','y','p','e'): {
                     value_SetEnum(parent,dmmeta_FieldId_listtype); ret = true; break;
                 }
+                case LE_STR8('o','p','e','n','a','d','d','r'): {
+                    value_SetEnum(parent,dmmeta_FieldId_openaddr); ret = true; break;
+                }
                 case LE_STR8('p','a','d','b','y','t','e','s'): {
                     value_SetEnum(parent,dmmeta_FieldId_padbytes); ret = true; break;
                 }
@@ -3531,6 +4284,10 @@ bool dmmeta::value_SetStrptrMaybe(dmmeta::FieldId& parent, algo::strptr rhs) {
                     if (memcmp(rhs.elems+8,"t",1)==0) { value_SetEnum(parent,dmmeta_FieldId_alignment); ret = true; break; }
                     break;
                 }
+                case LE_STR8('c','a','c','h','e','h','a','s'): {
+                    if (memcmp(rhs.elems+8,"h",1)==0) { value_SetEnum(parent,dmmeta_FieldId_cachehash); ret = true; break; }
+                    break;
+                }
                 case LE_STR8('c','h','a','r','r','a','n','g'): {
                     if (memcmp(rhs.elems+8,"e",1)==0) { value_SetEnum(parent,dmmeta_FieldId_charrange); ret = true; break; }
                     break;
@@ -3593,6 +4350,10 @@ bool dmmeta::value_SetStrptrMaybe(dmmeta::FieldId& parent, algo::strptr rhs) {
         }
         case 11: {
             switch (ReadLE64(rhs.elems)) {
+                case LE_STR8('i','n','c','r','e','m','e','n'): {
+                    if (memcmp(rhs.elems+8,"tal",3)==0) { value_SetEnum(parent,dmmeta_FieldId_incremental); ret = true; break; }
+                    break;
+                }
                 case LE_STR8('n','a','m','e','f','l','d','c'): {
                     if (memcmp(rhs.elems+8,"typ",3)==0) { value_SetEnum(parent,dmmeta_FieldId_namefldctyp); ret = true; break; }
                     break;
@@ -3698,9 +4459,20 @@ bool dmmeta::Findrem_ReadFieldMaybe(dmmeta::Findrem &parent, algo::strptr field,
 bool dmmeta::Findrem_ReadStrptrMaybe(dmmeta::Findrem &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.findrem") || algo::StripTypeTag(in_str, "dmmeta.Findrem");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Findrem_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Findrem_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -3754,9 +4526,26 @@ bool dmmeta::Finput_ReadFieldMaybe(dmmeta::Finput &parent, algo::strptr field, a
 bool dmmeta::Finput_ReadStrptrMaybe(dmmeta::Finput &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.finput") || algo::StripTypeTag(in_str, "dmmeta.Finput");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Finput_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "extrn", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.extrn, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "update", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.update, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "strict", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.strict, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Finput_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -3804,9 +4593,20 @@ bool dmmeta::Fldoffset_ReadFieldMaybe(dmmeta::Fldoffset &parent, algo::strptr fi
 bool dmmeta::Fldoffset_ReadStrptrMaybe(dmmeta::Fldoffset &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fldoffset") || algo::StripTypeTag(in_str, "dmmeta.Fldoffset");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fldoffset_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "offset", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.offset, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fldoffset_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -3857,9 +4657,20 @@ bool dmmeta::Floadtuples_ReadFieldMaybe(dmmeta::Floadtuples &parent, algo::strpt
 bool dmmeta::Floadtuples_ReadStrptrMaybe(dmmeta::Floadtuples &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.floadtuples") || algo::StripTypeTag(in_str, "dmmeta.Floadtuples");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Floadtuples_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Floadtuples_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -3898,9 +4709,20 @@ bool dmmeta::Fnoremove_ReadFieldMaybe(dmmeta::Fnoremove &parent, algo::strptr fi
 bool dmmeta::Fnoremove_ReadStrptrMaybe(dmmeta::Fnoremove &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fnoremove") || algo::StripTypeTag(in_str, "dmmeta.Fnoremove");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fnoremove_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fnoremove_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -3951,9 +4773,20 @@ bool dmmeta::Foutput_ReadFieldMaybe(dmmeta::Foutput &parent, algo::strptr field,
 bool dmmeta::Foutput_ReadStrptrMaybe(dmmeta::Foutput &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.foutput") || algo::StripTypeTag(in_str, "dmmeta.Foutput");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Foutput_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Foutput_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -3993,9 +4826,22 @@ bool dmmeta::Fprefix_ReadFieldMaybe(dmmeta::Fprefix &parent, algo::strptr field,
 bool dmmeta::Fprefix_ReadStrptrMaybe(dmmeta::Fprefix &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fprefix") || algo::StripTypeTag(in_str, "dmmeta.Fprefix");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fprefix_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "fprefix", value, buf);
+    inorder = inorder && algo::Smallstr5_ReadStrptrMaybe(parent.fprefix, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "reftype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.reftype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fprefix_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4038,9 +4884,22 @@ bool dmmeta::Fregx_ReadFieldMaybe(dmmeta::Fregx &parent, algo::strptr field, alg
 bool dmmeta::Fregx_ReadStrptrMaybe(dmmeta::Fregx &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fregx") || algo::StripTypeTag(in_str, "dmmeta.Fregx");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fregx_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "partial", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.partial, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fregx_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4084,9 +4943,24 @@ bool dmmeta::Fsort_ReadFieldMaybe(dmmeta::Fsort &parent, algo::strptr field, alg
 bool dmmeta::Fsort_ReadStrptrMaybe(dmmeta::Fsort &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fsort") || algo::StripTypeTag(in_str, "dmmeta.Fsort");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fsort_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "sorttype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.sorttype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "sortfld", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.sortfld, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fsort_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4173,9 +5047,22 @@ bool dmmeta::Fstep_ReadFieldMaybe(dmmeta::Fstep &parent, algo::strptr field, alg
 bool dmmeta::Fstep_ReadStrptrMaybe(dmmeta::Fstep &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fstep") || algo::StripTypeTag(in_str, "dmmeta.Fstep");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fstep_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "fstep", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.fstep, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "steptype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.steptype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fstep_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4217,9 +5104,20 @@ bool dmmeta::Ftrace_ReadFieldMaybe(dmmeta::Ftrace &parent, algo::strptr field, a
 bool dmmeta::Ftrace_ReadStrptrMaybe(dmmeta::Ftrace &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.ftrace") || algo::StripTypeTag(in_str, "dmmeta.Ftrace");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Ftrace_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Ftrace_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4258,9 +5156,20 @@ bool dmmeta::Ftuple_ReadFieldMaybe(dmmeta::Ftuple &parent, algo::strptr field, a
 bool dmmeta::Ftuple_ReadStrptrMaybe(dmmeta::Ftuple &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.ftuple") || algo::StripTypeTag(in_str, "dmmeta.Ftuple");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Ftuple_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Ftuple_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4440,9 +5349,20 @@ bool dmmeta::Funique_ReadFieldMaybe(dmmeta::Funique &parent, algo::strptr field,
 bool dmmeta::Funique_ReadStrptrMaybe(dmmeta::Funique &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.funique") || algo::StripTypeTag(in_str, "dmmeta.Funique");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Funique_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Funique_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4510,9 +5430,20 @@ bool dmmeta::Fwddecl_ReadFieldMaybe(dmmeta::Fwddecl &parent, algo::strptr field,
 bool dmmeta::Fwddecl_ReadStrptrMaybe(dmmeta::Fwddecl &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.fwddecl") || algo::StripTypeTag(in_str, "dmmeta.Fwddecl");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Fwddecl_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "fwddecl", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.fwddecl, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Fwddecl_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4565,9 +5496,24 @@ bool dmmeta::Gconst_ReadFieldMaybe(dmmeta::Gconst &parent, algo::strptr field, a
 bool dmmeta::Gconst_ReadStrptrMaybe(dmmeta::Gconst &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.gconst") || algo::StripTypeTag(in_str, "dmmeta.Gconst");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Gconst_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "namefld", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.namefld, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "idfld", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.idfld, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "wantenum", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.wantenum, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Gconst_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4624,9 +5570,20 @@ bool dmmeta::Gstatic_ReadFieldMaybe(dmmeta::Gstatic &parent, algo::strptr field,
 bool dmmeta::Gstatic_ReadStrptrMaybe(dmmeta::Gstatic &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.gstatic") || algo::StripTypeTag(in_str, "dmmeta.Gstatic");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Gstatic_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Gstatic_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4695,9 +5652,22 @@ bool dmmeta::Gsymbol_ReadFieldMaybe(dmmeta::Gsymbol &parent, algo::strptr field,
 bool dmmeta::Gsymbol_ReadStrptrMaybe(dmmeta::Gsymbol &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.gsymbol") || algo::StripTypeTag(in_str, "dmmeta.Gsymbol");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Gsymbol_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "gsymbol", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.gsymbol, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "inc", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.inc, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Gsymbol_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4739,9 +5709,20 @@ bool dmmeta::Hashtype_ReadFieldMaybe(dmmeta::Hashtype &parent, algo::strptr fiel
 bool dmmeta::Hashtype_ReadStrptrMaybe(dmmeta::Hashtype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.hashtype") || algo::StripTypeTag(in_str, "dmmeta.Hashtype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Hashtype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "hashtype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.hashtype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Hashtype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4780,9 +5761,20 @@ bool dmmeta::Hook_ReadFieldMaybe(dmmeta::Hook &parent, algo::strptr field, algo:
 bool dmmeta::Hook_ReadStrptrMaybe(dmmeta::Hook &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.hook") || algo::StripTypeTag(in_str, "dmmeta.Hook");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Hook_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Hook_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4823,9 +5815,24 @@ bool dmmeta::Inlary_ReadFieldMaybe(dmmeta::Inlary &parent, algo::strptr field, a
 bool dmmeta::Inlary_ReadStrptrMaybe(dmmeta::Inlary &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.inlary") || algo::StripTypeTag(in_str, "dmmeta.Inlary");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Inlary_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "min", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.min, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "max", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.max, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Inlary_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4882,9 +5889,20 @@ bool dmmeta::Lenfld_ReadFieldMaybe(dmmeta::Lenfld &parent, algo::strptr field, a
 bool dmmeta::Lenfld_ReadStrptrMaybe(dmmeta::Lenfld &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.lenfld") || algo::StripTypeTag(in_str, "dmmeta.Lenfld");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Lenfld_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "extra", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.extra, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Lenfld_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4926,9 +5944,26 @@ bool dmmeta::Listtype_ReadFieldMaybe(dmmeta::Listtype &parent, algo::strptr fiel
 bool dmmeta::Listtype_ReadStrptrMaybe(dmmeta::Listtype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.listtype") || algo::StripTypeTag(in_str, "dmmeta.Listtype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Listtype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "listtype", value, buf);
+    inorder = inorder && algo::Smallstr5_ReadStrptrMaybe(parent.listtype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "circular", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.circular, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "haveprev", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.haveprev, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "instail", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.instail, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Listtype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -4990,9 +6025,24 @@ bool dmmeta::Llist_ReadFieldMaybe(dmmeta::Llist &parent, algo::strptr field, alg
 bool dmmeta::Llist_ReadStrptrMaybe(dmmeta::Llist &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.llist") || algo::StripTypeTag(in_str, "dmmeta.Llist");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Llist_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "havetail", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.havetail, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "havecount", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.havecount, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Llist_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5015,6 +6065,64 @@ void dmmeta::Llist_Print(dmmeta::Llist & row, algo::cstring &str) {
     PrintAttrSpaceReset(str,"comment", temp);
 }
 
+// --- dmmeta.Magazine..ReadFieldMaybe
+bool dmmeta::Magazine_ReadFieldMaybe(dmmeta::Magazine &parent, algo::strptr field, algo::strptr strval) {
+    dmmeta::FieldId field_id;
+    (void)value_SetStrptrMaybe(field_id,field);
+    bool retval = true; // default is no error
+    switch(field_id) {
+        case dmmeta_FieldId_field: retval = algo::Smallstr100_ReadStrptrMaybe(parent.field, strval); break;
+        case dmmeta_FieldId_size: retval = u32_ReadStrptrMaybe(parent.size, strval); break;
+        case dmmeta_FieldId_comment: retval = algo::Comment_ReadStrptrMaybe(parent.comment, strval); break;
+        default: break;
+    }
+    if (!retval) {
+        algo_lib::AppendErrtext("attr",field);
+    }
+    return retval;
+}
+
+// --- dmmeta.Magazine..ReadStrptrMaybe
+// Read fields of dmmeta::Magazine from an ascii string.
+// The format of the string is an ssim Tuple
+bool dmmeta::Magazine_ReadStrptrMaybe(dmmeta::Magazine &parent, algo::strptr in_str) {
+    bool retval = true;
+    retval = algo::StripTypeTag(in_str, "dmmeta.magazine") || algo::StripTypeTag(in_str, "dmmeta.Magazine");
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "size", value, buf);
+    inorder = inorder && u32_ReadStrptrMaybe(parent.size, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Magazine_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
+    return retval;
+}
+
+// --- dmmeta.Magazine..Print
+// print string representation of dmmeta::Magazine to string LHS, no header -- cprint:dmmeta.Magazine.String
+void dmmeta::Magazine_Print(dmmeta::Magazine & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "dmmeta.magazine";
+
+    algo::Smallstr100_Print(row.field, temp);
+    PrintAttrSpaceReset(str,"field", temp);
+
+    u32_Print(row.size, temp);
+    PrintAttrSpaceReset(str,"size", temp);
+
+    algo::Comment_Print(row.comment, temp);
+    PrintAttrSpaceReset(str,"comment", temp);
+}
+
 // --- dmmeta.Main..ReadFieldMaybe
 bool dmmeta::Main_ReadFieldMaybe(dmmeta::Main &parent, algo::strptr field, algo::strptr strval) {
     dmmeta::FieldId field_id;
@@ -5037,9 +6145,20 @@ bool dmmeta::Main_ReadFieldMaybe(dmmeta::Main &parent, algo::strptr field, algo:
 bool dmmeta::Main_ReadStrptrMaybe(dmmeta::Main &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.main") || algo::StripTypeTag(in_str, "dmmeta.Main");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Main_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ns", value, buf);
+    inorder = inorder && algo::Smallstr16_ReadStrptrMaybe(parent.ns, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "ismodule", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.ismodule, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Main_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5078,9 +6197,20 @@ bool dmmeta::Msgtype_ReadFieldMaybe(dmmeta::Msgtype &parent, algo::strptr field,
 bool dmmeta::Msgtype_ReadStrptrMaybe(dmmeta::Msgtype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.msgtype") || algo::StripTypeTag(in_str, "dmmeta.Msgtype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Msgtype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "type", value, buf);
+    inorder = inorder && dmmeta::CppExpr_ReadStrptrMaybe(parent.type, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Msgtype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5119,9 +6249,20 @@ bool dmmeta::Nocascdel_ReadFieldMaybe(dmmeta::Nocascdel &parent, algo::strptr fi
 bool dmmeta::Nocascdel_ReadStrptrMaybe(dmmeta::Nocascdel &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.nocascdel") || algo::StripTypeTag(in_str, "dmmeta.Nocascdel");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Nocascdel_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "xref", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.xref, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Nocascdel_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5160,9 +6301,20 @@ bool dmmeta::Nossimfile_ReadFieldMaybe(dmmeta::Nossimfile &parent, algo::strptr
 bool dmmeta::Nossimfile_ReadStrptrMaybe(dmmeta::Nossimfile &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.nossimfile") || algo::StripTypeTag(in_str, "dmmeta.Nossimfile");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Nossimfile_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Nossimfile_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5201,9 +6353,20 @@ bool dmmeta::Noxref_ReadFieldMaybe(dmmeta::Noxref &parent, algo::strptr field, a
 bool dmmeta::Noxref_ReadStrptrMaybe(dmmeta::Noxref &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.noxref") || algo::StripTypeTag(in_str, "dmmeta.Noxref");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Noxref_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Noxref_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5243,9 +6406,22 @@ bool dmmeta::Ns_ReadFieldMaybe(dmmeta::Ns &parent, algo::strptr field, algo::str
 bool dmmeta::Ns_ReadStrptrMaybe(dmmeta::Ns &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.ns") || algo::StripTypeTag(in_str, "dmmeta.Ns");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Ns_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ns", value, buf);
+    inorder = inorder && algo::Smallstr16_ReadStrptrMaybe(parent.ns, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "nstype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.nstype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Ns_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5287,9 +6463,20 @@ bool dmmeta::Nsdb_ReadFieldMaybe(dmmeta::Nsdb &parent, algo::strptr field, algo:
 bool dmmeta::Nsdb_ReadStrptrMaybe(dmmeta::Nsdb &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.nsdb") || algo::StripTypeTag(in_str, "dmmeta.Nsdb");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Nsdb_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ns", value, buf);
+    inorder = inorder && algo::Smallstr16_ReadStrptrMaybe(parent.ns, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Nsdb_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5358,9 +6545,22 @@ bool dmmeta::Nsinclude_ReadFieldMaybe(dmmeta::Nsinclude &parent, algo::strptr fi
 bool dmmeta::Nsinclude_ReadStrptrMaybe(dmmeta::Nsinclude &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.nsinclude") || algo::StripTypeTag(in_str, "dmmeta.Nsinclude");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Nsinclude_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "nsinclude", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.nsinclude, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "sys", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.sys, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Nsinclude_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5402,9 +6602,20 @@ bool dmmeta::Nsproto_ReadFieldMaybe(dmmeta::Nsproto &parent, algo::strptr field,
 bool dmmeta::Nsproto_ReadStrptrMaybe(dmmeta::Nsproto &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.nsproto") || algo::StripTypeTag(in_str, "dmmeta.Nsproto");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Nsproto_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ns", value, buf);
+    inorder = inorder && algo::Smallstr16_ReadStrptrMaybe(parent.ns, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Nsproto_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5459,9 +6670,22 @@ bool dmmeta::Nsversion_ReadFieldMaybe(dmmeta::Nsversion &parent, algo::strptr fi
 bool dmmeta::Nsversion_ReadStrptrMaybe(dmmeta::Nsversion &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.nsversion") || algo::StripTypeTag(in_str, "dmmeta.Nsversion");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Nsversion_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ns", value, buf);
+    inorder = inorder && algo::Smallstr16_ReadStrptrMaybe(parent.ns, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "version", value, buf);
+    inorder = inorder && algo::Smallstr10_ReadStrptrMaybe(parent.version, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Nsversion_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5509,9 +6733,32 @@ bool dmmeta::Nsx_ReadFieldMaybe(dmmeta::Nsx &parent, algo::strptr field, algo::s
 bool dmmeta::Nsx_ReadStrptrMaybe(dmmeta::Nsx &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.nsx") || algo::StripTypeTag(in_str, "dmmeta.Nsx");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Nsx_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ns", value, buf);
+    inorder = inorder && algo::Smallstr16_ReadStrptrMaybe(parent.ns, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "genthrow", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.genthrow, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "correct_getorcreate", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.correct_getorcreate, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "pool", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.pool, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "sortxref", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.sortxref, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "pack", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.pack, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "fldoffset_asserts", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.fldoffset_asserts, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Nsx_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5570,9 +6817,24 @@ bool dmmeta::Numstr_ReadFieldMaybe(dmmeta::Numstr &parent, algo::strptr field, a
 bool dmmeta::Numstr_ReadStrptrMaybe(dmmeta::Numstr &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.numstr") || algo::StripTypeTag(in_str, "dmmeta.Numstr");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Numstr_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "numtype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.numtype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "base", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.base, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "min_len", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.min_len, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Numstr_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5617,9 +6879,20 @@ bool dmmeta::Pack_ReadFieldMaybe(dmmeta::Pack &parent, algo::strptr field, algo:
 bool dmmeta::Pack_ReadStrptrMaybe(dmmeta::Pack &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.pack") || algo::StripTypeTag(in_str, "dmmeta.Pack");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Pack_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Pack_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5670,9 +6943,20 @@ bool dmmeta::Pmaskfld_ReadFieldMaybe(dmmeta::Pmaskfld &parent, algo::strptr fiel
 bool dmmeta::Pmaskfld_ReadStrptrMaybe(dmmeta::Pmaskfld &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.pmaskfld") || algo::StripTypeTag(in_str, "dmmeta.Pmaskfld");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Pmaskfld_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Pmaskfld_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5752,9 +7036,20 @@ bool dmmeta::Pnew_ReadFieldMaybe(dmmeta::Pnew &parent, algo::strptr field, algo:
 bool dmmeta::Pnew_ReadStrptrMaybe(dmmeta::Pnew &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.pnew") || algo::StripTypeTag(in_str, "dmmeta.Pnew");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Pnew_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "pnew", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.pnew, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Pnew_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5793,9 +7088,20 @@ bool dmmeta::Printfmt_ReadFieldMaybe(dmmeta::Printfmt &parent, algo::strptr fiel
 bool dmmeta::Printfmt_ReadStrptrMaybe(dmmeta::Printfmt &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.printfmt") || algo::StripTypeTag(in_str, "dmmeta.Printfmt");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Printfmt_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "printfmt", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.printfmt, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Printfmt_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5834,9 +7140,20 @@ bool dmmeta::Ptrary_ReadFieldMaybe(dmmeta::Ptrary &parent, algo::strptr field, a
 bool dmmeta::Ptrary_ReadStrptrMaybe(dmmeta::Ptrary &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.ptrary") || algo::StripTypeTag(in_str, "dmmeta.Ptrary");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Ptrary_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "unique", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.unique, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Ptrary_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5885,9 +7202,40 @@ bool dmmeta::Reftype_ReadFieldMaybe(dmmeta::Reftype &parent, algo::strptr field,
 bool dmmeta::Reftype_ReadStrptrMaybe(dmmeta::Reftype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.reftype") || algo::StripTypeTag(in_str, "dmmeta.Reftype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Reftype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "reftype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.reftype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "isval", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.isval, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "cascins", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.cascins, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "usebasepool", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.usebasepool, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "cancopy", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.cancopy, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "isxref", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.isxref, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "del", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.del, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "up", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.up, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "isnew", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.isnew, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "hasalloc", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.hasalloc, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "inst", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.inst, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "varlen", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.varlen, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Reftype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -5962,6 +7310,7 @@ const char* dmmeta::reftype_ToCstr(const dmmeta::ReftypeCase& parent) {
         case dmmeta_ReftypeCase_Bheap      : ret = "Bheap";  break;
         case dmmeta_ReftypeCase_Bitfld     : ret = "Bitfld";  break;
         case dmmeta_ReftypeCase_Blkpool    : ret = "Blkpool";  break;
+        case dmmeta_ReftypeCase_Btree      : ret = "Btree";  break;
         case dmmeta_ReftypeCase_Charset    : ret = "Charset";  break;
         case dmmeta_ReftypeCase_Count      : ret = "Count";  break;
         case dmmeta_ReftypeCase_Cppstack   : ret = "Cppstack";  break;
@@ -6064,6 +7413,9 @@ bool dmmeta::reftype_SetStrptrMaybe(dmmeta::ReftypeCase& parent, algo::strptr rh
                 case LE_STR5('B','h','e','a','p'): {
                     reftype_SetEnum(parent,dmmeta_ReftypeCase_Bheap); ret = true; break;
                 }
+                case LE_STR5('B','t','r','e','e'): {
+                    reftype_SetEnum(parent,dmmeta_ReftypeCase_Btree); ret = true; break;
+                }
                 case LE_STR5('C','o','u','n','t'): {
                     reftype_SetEnum(parent,dmmeta_ReftypeCase_Count); ret = true; break;
                 }
@@ -6164,6 +7516,7 @@ const char* dmmeta::value_ToCstr(const dmmeta::ReftypeId& parent) {
         case dmmeta_ReftypeId_Bheap        : ret = "Bheap";  break;
         case dmmeta_ReftypeId_Bitfld       : ret = "Bitfld";  break;
         case dmmeta_ReftypeId_Blkpool      : ret = "Blkpool";  break;
+        case dmmeta_ReftypeId_Btree        : ret = "Btree";  break;
         case dmmeta_ReftypeId_Charset      : ret = "Charset";  break;
         case dmmeta_ReftypeId_Count        : ret = "Count";  break;
         case dmmeta_ReftypeId_Cppstack     : ret = "Cppstack";  break;
@@ -6266,6 +7619,9 @@ bool dmmeta::value_SetStrptrMaybe(dmmeta::ReftypeId& parent, algo::strptr rhs) {
                 case LE_STR5('B','h','e','a','p'): {
                     value_SetEnum(parent,dmmeta_ReftypeId_Bheap); ret = true; break;
                 }
+                case LE_STR5('B','t','r','e','e'): {
+                    value_SetEnum(parent,dmmeta_ReftypeId_Btree); ret = true; break;
+                }
                 case LE_STR5('C','o','u','n','t'): {
                     value_SetEnum(parent,dmmeta_ReftypeId_Count); ret = true; break;
                 }
@@ -6403,9 +7759,20 @@ bool dmmeta::Rowid_ReadFieldMaybe(dmmeta::Rowid &parent, algo::strptr field, alg
 bool dmmeta::Rowid_ReadStrptrMaybe(dmmeta::Rowid &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.rowid") || algo::StripTypeTag(in_str, "dmmeta.Rowid");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Rowid_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Rowid_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6459,9 +7826,26 @@ bool dmmeta::Smallstr_ReadFieldMaybe(dmmeta::Smallstr &parent, algo::strptr fiel
 bool dmmeta::Smallstr_ReadStrptrMaybe(dmmeta::Smallstr &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.smallstr") || algo::StripTypeTag(in_str, "dmmeta.Smallstr");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Smallstr_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "length", value, buf);
+    inorder = inorder && i32_ReadStrptrMaybe(parent.length, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "strtype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.strtype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "pad", value, buf);
+    inorder = inorder && dmmeta::CppExpr_ReadStrptrMaybe(parent.pad, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "strict", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.strict, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Smallstr_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6509,9 +7893,20 @@ bool dmmeta::Sortfld_ReadFieldMaybe(dmmeta::Sortfld &parent, algo::strptr field,
 bool dmmeta::Sortfld_ReadStrptrMaybe(dmmeta::Sortfld &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.sortfld") || algo::StripTypeTag(in_str, "dmmeta.Sortfld");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Sortfld_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "sortfld", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.sortfld, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Sortfld_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6550,9 +7945,20 @@ bool dmmeta::Sorttype_ReadFieldMaybe(dmmeta::Sorttype &parent, algo::strptr fiel
 bool dmmeta::Sorttype_ReadStrptrMaybe(dmmeta::Sorttype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.sorttype") || algo::StripTypeTag(in_str, "dmmeta.Sorttype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Sorttype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "sorttype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.sorttype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Sorttype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6592,9 +7998,22 @@ bool dmmeta::Sqltype_ReadFieldMaybe(dmmeta::Sqltype &parent, algo::strptr field,
 bool dmmeta::Sqltype_ReadStrptrMaybe(dmmeta::Sqltype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.sqltype") || algo::StripTypeTag(in_str, "dmmeta.Sqltype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Sqltype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "expr", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.expr, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Sqltype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6672,9 +8091,20 @@ bool dmmeta::Ssimfile_ReadFieldMaybe(dmmeta::Ssimfile &parent, algo::strptr fiel
 bool dmmeta::Ssimfile_ReadStrptrMaybe(dmmeta::Ssimfile &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.ssimfile") || algo::StripTypeTag(in_str, "dmmeta.Ssimfile");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Ssimfile_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ssimfile", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ssimfile, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "ctype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ctype, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Ssimfile_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6714,9 +8144,22 @@ bool dmmeta::Ssimsort_ReadFieldMaybe(dmmeta::Ssimsort &parent, algo::strptr fiel
 bool dmmeta::Ssimsort_ReadStrptrMaybe(dmmeta::Ssimsort &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.ssimsort") || algo::StripTypeTag(in_str, "dmmeta.Ssimsort");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Ssimsort_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ssimfile", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ssimfile, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "sortfld", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.sortfld, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Ssimsort_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6758,9 +8201,20 @@ bool dmmeta::Ssimvolatile_ReadFieldMaybe(dmmeta::Ssimvolatile &parent, algo::str
 bool dmmeta::Ssimvolatile_ReadStrptrMaybe(dmmeta::Ssimvolatile &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.ssimvolatile") || algo::StripTypeTag(in_str, "dmmeta.Ssimvolatile");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Ssimvolatile_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "ssimfile", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.ssimfile, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Ssimvolatile_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6799,9 +8253,20 @@ bool dmmeta::Steptype_ReadFieldMaybe(dmmeta::Steptype &parent, algo::strptr fiel
 bool dmmeta::Steptype_ReadStrptrMaybe(dmmeta::Steptype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.steptype") || algo::StripTypeTag(in_str, "dmmeta.Steptype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Steptype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "steptype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.steptype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Steptype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6840,9 +8305,20 @@ bool dmmeta::Strtype_ReadFieldMaybe(dmmeta::Strtype &parent, algo::strptr field,
 bool dmmeta::Strtype_ReadStrptrMaybe(dmmeta::Strtype &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.strtype") || algo::StripTypeTag(in_str, "dmmeta.Strtype");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Strtype_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "strtype", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.strtype, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Strtype_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6882,9 +8358,22 @@ bool dmmeta::Substr_ReadFieldMaybe(dmmeta::Substr &parent, algo::strptr field, a
 bool dmmeta::Substr_ReadStrptrMaybe(dmmeta::Substr &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.substr") || algo::StripTypeTag(in_str, "dmmeta.Substr");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Substr_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "expr", value, buf);
+    inorder = inorder && dmmeta::CppExpr_ReadStrptrMaybe(parent.expr, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "srcfield", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.srcfield, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Substr_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6927,9 +8416,22 @@ bool dmmeta::Tary_ReadFieldMaybe(dmmeta::Tary &parent, algo::strptr field, algo:
 bool dmmeta::Tary_ReadStrptrMaybe(dmmeta::Tary &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.tary") || algo::StripTypeTag(in_str, "dmmeta.Tary");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Tary_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "aliased", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.aliased, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Tary_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6958,6 +8460,9 @@ bool dmmeta::Thash_ReadFieldMaybe(dmmeta::Thash &parent, algo::strptr field, alg
         case dmmeta_FieldId_field: retval = algo::Smallstr100_ReadStrptrMaybe(parent.field, strval); break;
         case dmmeta_FieldId_hashfld: retval = algo::Smallstr100_ReadStrptrMaybe(parent.hashfld, strval); break;
         case dmmeta_FieldId_unique: retval = bool_ReadStrptrMaybe(parent.unique, strval); break;
+        case dmmeta_FieldId_cachehash: retval = bool_ReadStrptrMaybe(parent.cachehash, strval); break;
+        case dmmeta_FieldId_openaddr: retval = bool_ReadStrptrMaybe(parent.openaddr, strval); break;
+        case dmmeta_FieldId_incremental: retval = bool_ReadStrptrMaybe(parent.incremental, strval); break;
         case dmmeta_FieldId_comment: retval = algo::Comment_ReadStrptrMaybe(parent.comment, strval); break;
         default: break;
     }
@@ -6973,9 +8478,30 @@ bool dmmeta::Thash_ReadFieldMaybe(dmmeta::Thash &parent, algo::strptr field, alg
 bool dmmeta::Thash_ReadStrptrMaybe(dmmeta::Thash &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.thash") || algo::StripTypeTag(in_str, "dmmeta.Thash");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Thash_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "hashfld", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.hashfld, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "unique", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.unique, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "cachehash", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.cachehash, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "openaddr", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.openaddr, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "incremental", value, buf);
+    inorder = inorder && bool_ReadStrptrMaybe(parent.incremental, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Thash_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -6994,6 +8520,15 @@ void dmmeta::Thash_Print(dmmeta::Thash & row, algo::cstring &str) {
     bool_Print(row.unique, temp);
     PrintAttrSpaceReset(str,"unique", temp);
 
+    bool_Print(row.cachehash, temp);
+    PrintAttrSpaceReset(str,"cachehash", temp);
+
+    bool_Print(row.openaddr, temp);
+    PrintAttrSpaceReset(str,"openaddr", temp);
+
+    bool_Print(row.incremental, temp);
+    PrintAttrSpaceReset(str,"incremental", temp);
+
     algo::Comment_Print(row.comment, temp);
     PrintAttrSpaceReset(str,"comment", temp);
 }
@@ -7049,9 +8584,20 @@ bool dmmeta::Tracefld_ReadFieldMaybe(dmmeta::Tracefld &parent, algo::strptr fiel
 bool dmmeta::Tracefld_ReadStrptrMaybe(dmmeta::Tracefld &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.tracefld") || algo::StripTypeTag(in_str, "dmmeta.Tracefld");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Tracefld_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "tracefld", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.tracefld, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Tracefld_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -7102,9 +8648,20 @@ bool dmmeta::Tracerec_ReadFieldMaybe(dmmeta::Tracerec &parent, algo::strptr fiel
 bool dmmeta::Tracerec_ReadStrptrMaybe(dmmeta::Tracerec &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.tracerec") || algo::StripTypeTag(in_str, "dmmeta.Tracerec");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Tracerec_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "tracerec", value, buf);
+    inorder = inorder && algo::Smallstr50_ReadStrptrMaybe(parent.tracerec, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Tracerec_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -7155,9 +8712,20 @@ bool dmmeta::Typefld_ReadFieldMaybe(dmmeta::Typefld &parent, algo::strptr field,
 bool dmmeta::Typefld_ReadStrptrMaybe(dmmeta::Typefld &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.typefld") || algo::StripTypeTag(in_str, "dmmeta.Typefld");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Typefld_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Typefld_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -7196,9 +8764,20 @@ bool dmmeta::Usertracefld_ReadFieldMaybe(dmmeta::Usertracefld &parent, algo::str
 bool dmmeta::Usertracefld_ReadStrptrMaybe(dmmeta::Usertracefld &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.usertracefld") || algo::StripTypeTag(in_str, "dmmeta.Usertracefld");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Usertracefld_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "tracefld", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.tracefld, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "comment", value, buf);
+    inorder = inorder && algo::Comment_ReadStrptrMaybe(parent.comment, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Usertracefld_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -7286,9 +8865,22 @@ bool dmmeta::Xref_ReadFieldMaybe(dmmeta::Xref &parent, algo::strptr field, algo:
 bool dmmeta::Xref_ReadStrptrMaybe(dmmeta::Xref &parent, algo::strptr in_str) {
     bool retval = true;
     retval = algo::StripTypeTag(in_str, "dmmeta.xref") || algo::StripTypeTag(in_str, "dmmeta.Xref");
-    ind_beg(algo::Attr_curs, attr, in_str) {
-        retval = retval && Xref_ReadFieldMaybe(parent, attr.name, attr.value);
-    }ind_end;
+    algo::StringIter iter(in_str);
+    algo::strptr value;
+    algo::tempstr buf;
+    bool inorder = retval;
+    inorder = inorder && algo::SsimAttrExpect(iter, "field", value, buf);
+    inorder = inorder && algo::Smallstr100_ReadStrptrMaybe(parent.field, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "inscond", value, buf);
+    inorder = inorder && dmmeta::CppExpr_ReadStrptrMaybe(parent.inscond, value);
+    inorder = inorder && algo::SsimAttrExpect(iter, "via", value, buf);
+    inorder = inorder && algo::Smallstr200_ReadStrptrMaybe(parent.via, value);
+    inorder = inorder && algo::SsimAttrEndQ(iter);
+    if (retval && !inorder) {
+        ind_beg(algo::Attr_curs, attr, in_str) {
+            retval = retval && Xref_ReadFieldMaybe(parent, attr.name, attr.value);
+        }ind_end;
+    }
     return retval;
 }
 
@@ -460,7 +460,8 @@ bool lib_ctype::fconst_XrefMaybe(lib_ctype::FFconst &row) {
 // --- lib_ctype.FDb.ind_fconst_key.Find
 // Find row by key. Return NULL if not found.
 lib_ctype::FFconst* lib_ctype::ind_fconst_key_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_fconst_key_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_fconst_key_buckets_n - 1);
     lib_ctype::FFconst* *e = &_db.ind_fconst_key_buckets_elems[index];
     lib_ctype::FFconst* ret=NULL;
     do {
@@ -486,7 +487,8 @@ bool lib_ctype::ind_fconst_key_InsertMaybe(lib_ctype::FFconst& row) {
     ind_fconst_key_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_fconst_key_next == (lib_ctype::FFconst*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.key) & (_db.ind_fconst_key_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (_db.ind_fconst_key_buckets_n - 1);
         lib_ctype::FFconst* *prev = &_db.ind_fconst_key_buckets_elems[index];
         do {
             lib_ctype::FFconst* ret = *prev;
@@ -512,7 +514,8 @@ bool lib_ctype::ind_fconst_key_InsertMaybe(lib_ctype::FFconst& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void lib_ctype::ind_fconst_key_Remove(lib_ctype::FFconst& row) {
     if (LIKELY(row.ind_fconst_key_next != (lib_ctype::FFconst*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.key) & (_db.ind_fconst_key_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.key);
+        u32 index = hash & (_db.ind_fconst_key_buckets_n - 1);
         lib_ctype::FFconst* *prev = &_db.ind_fconst_key_buckets_elems[index]; // addr of pointer to current element
         while (lib_ctype::FFconst *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -565,7 +568,8 @@ void lib_ctype::ind_fconst_key_Reserve(int n) {
 // --- lib_ctype.FDb.ind_fconst.Find
 // Find row by key. Return NULL if not found.
 lib_ctype::FFconst* lib_ctype::ind_fconst_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_fconst_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_fconst_buckets_n - 1);
     lib_ctype::FFconst* *e = &_db.ind_fconst_buckets_elems[index];
     lib_ctype::FFconst* ret=NULL;
     do {
@@ -591,7 +595,8 @@ bool lib_ctype::ind_fconst_InsertMaybe(lib_ctype::FFconst& row) {
     ind_fconst_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_fconst_next == (lib_ctype::FFconst*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.fconst) & (_db.ind_fconst_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.fconst);
+        u32 index = hash & (_db.ind_fconst_buckets_n - 1);
         lib_ctype::FFconst* *prev = &_db.ind_fconst_buckets_elems[index];
         do {
             lib_ctype::FFconst* ret = *prev;
@@ -617,7 +622,8 @@ bool lib_ctype::ind_fconst_InsertMaybe(lib_ctype::FFconst& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void lib_ctype::ind_fconst_Remove(lib_ctype::FFconst& row) {
     if (LIKELY(row.ind_fconst_next != (lib_ctype::FFconst*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.fconst) & (_db.ind_fconst_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.fconst);
+        u32 index = hash & (_db.ind_fconst_buckets_n - 1);
         lib_ctype::FFconst* *prev = &_db.ind_fconst_buckets_elems[index]; // addr of pointer to current element
         while (lib_ctype::FFconst *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -776,7 +782,8 @@ bool lib_ctype::ssimfile_XrefMaybe(lib_ctype::FSsimfile &row) {
 // --- lib_ctype.FDb.ind_ssimfile.Find
 // Find row by key. Return NULL if not found.
 lib_ctype::FSsimfile* lib_ctype::ind_ssimfile_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ssimfile_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
     lib_ctype::FSsimfile* *e = &_db.ind_ssimfile_buckets_elems[index];
     lib_ctype::FSsimfile* ret=NULL;
     do {
@@ -802,7 +809,8 @@ bool lib_ctype::ind_ssimfile_InsertMaybe(lib_ctype::FSsimfile& row) {
     ind_ssimfile_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ssimfile_next == (lib_ctype::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         lib_ctype::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index];
         do {
             lib_ctype::FSsimfile* ret = *prev;
@@ -828,7 +836,8 @@ bool lib_ctype::ind_ssimfile_InsertMaybe(lib_ctype::FSsimfile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void lib_ctype::ind_ssimfile_Remove(lib_ctype::FSsimfile& row) {
     if (LIKELY(row.ind_ssimfile_next != (lib_ctype::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         lib_ctype::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index]; // addr of pointer to current element
         while (lib_ctype::FSsimfile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1080,7 +1089,8 @@ bool lib_ctype::ctype_XrefMaybe(lib_ctype::FCtype &row) {
 // --- lib_ctype.FDb.ind_ctype.Find
 // Find row by key. Return NULL if not found.
 lib_ctype::FCtype* lib_ctype::ind_ctype_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ctype_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ctype_buckets_n - 1);
     lib_ctype::FCtype* *e = &_db.ind_ctype_buckets_elems[index];
     lib_ctype::FCtype* ret=NULL;
     do {
@@ -1122,7 +1132,8 @@ bool lib_ctype::ind_ctype_InsertMaybe(lib_ctype::FCtype& row) {
     ind_ctype_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ctype_next == (lib_ctype::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         lib_ctype::FCtype* *prev = &_db.ind_ctype_buckets_elems[index];
         do {
             lib_ctype::FCtype* ret = *prev;
@@ -1148,7 +1159,8 @@ bool lib_ctype::ind_ctype_InsertMaybe(lib_ctype::FCtype& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void lib_ctype::ind_ctype_Remove(lib_ctype::FCtype& row) {
     if (LIKELY(row.ind_ctype_next != (lib_ctype::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         lib_ctype::FCtype* *prev = &_db.ind_ctype_buckets_elems[index]; // addr of pointer to current element
         while (lib_ctype::FCtype *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1316,7 +1328,8 @@ bool lib_ctype::field_XrefMaybe(lib_ctype::FField &row) {
 // --- lib_ctype.FDb.ind_field.Find
 // Find row by key. Return NULL if not found.
 lib_ctype::FField* lib_ctype::ind_field_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_field_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_field_buckets_n - 1);
     lib_ctype::FField* *e = &_db.ind_field_buckets_elems[index];
     lib_ctype::FField* ret=NULL;
     do {
@@ -1342,7 +1355,8 @@ bool lib_ctype::ind_field_InsertMaybe(lib_ctype::FField& row) {
     ind_field_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_field_next == (lib_ctype::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         lib_ctype::FField* *prev = &_db.ind_field_buckets_elems[index];
         do {
             lib_ctype::FField* ret = *prev;
@@ -1368,7 +1382,8 @@ bool lib_ctype::ind_field_InsertMaybe(lib_ctype::FField& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void lib_ctype::ind_field_Remove(lib_ctype::FField& row) {
     if (LIKELY(row.ind_field_next != (lib_ctype::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         lib_ctype::FField* *prev = &_db.ind_field_buckets_elems[index]; // addr of pointer to current element
         while (lib_ctype::FField *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1556,58 +1571,86 @@ bool lib_ctype::InsertStrptrMaybe(algo::strptr str) {
         case lib_ctype_TableId_dmmeta_Fconst: { // finput:lib_ctype.FDb.fconst
             dmmeta::Fconst elem;
             retval = dmmeta::Fconst_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(lib_ctype_TableId_dmmeta_Fconst, &elem, sizeof(elem));
+            }
             retval = retval && fconst_InputMaybe(elem);
             break;
         }
         case lib_ctype_TableId_dmmeta_Ssimfile: { // finput:lib_ctype.FDb.ssimfile
             dmmeta::Ssimfile elem;
             retval = dmmeta::Ssimfile_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(lib_ctype_TableId_dmmeta_Ssimfile, &elem, sizeof(elem));
+            }
             retval = retval && ssimfile_InputMaybe(elem);
             break;
         }
         case lib_ctype_TableId_dmmeta_Ftuple: { // finput:lib_ctype.FDb.ftuple
             dmmeta::Ftuple elem;
             retval = dmmeta::Ftuple_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(lib_ctype_TableId_dmmeta_Ftuple, &elem, sizeof(elem));
+            }
             retval = retval && ftuple_InputMaybe(elem);
             break;
         }
         case lib_ctype_TableId_dmmeta_Ctype: { // finput:lib_ctype.FDb.ctype
             dmmeta::Ctype elem;
             retval = dmmeta::Ctype_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(lib_ctype_TableId_dmmeta_Ctype, &elem, sizeof(elem));
+            }
             retval = retval && ctype_InputMaybe(elem);
             break;
         }
         case lib_ctype_TableId_dmmeta_Field: { // finput:lib_ctype.FDb.field
             dmmeta::Field elem;
             retval = dmmeta::Field_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(lib_ctype_TableId_dmmeta_Field, &elem, sizeof(elem));
+            }
             retval = retval && field_InputMaybe(elem);
             break;
         }
         case lib_ctype_TableId_dmmeta_Cdflt: { // finput:lib_ctype.FDb.cdflt
             dmmeta::Cdflt elem;
             retval = dmmeta::Cdflt_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(lib_ctype_TableId_dmmeta_Cdflt, &elem, sizeof(elem));
+            }
             retval = retval && cdflt_InputMaybe(elem);
             break;
         }
         case lib_ctype_TableId_dmmeta_Cfmt: { // finput:lib_ctype.FDb.cfmt
             dmmeta::Cfmt elem;
             retval = dmmeta::Cfmt_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(lib_ctype_TableId_dmmeta_Cfmt, &elem, sizeof(elem));
+            }
             retval = retval && cfmt_InputMaybe(elem);
             break;
         }
         case lib_ctype_TableId_dmmeta_Cppfunc: { // finput:lib_ctype.FDb.cppfunc
             dmmeta::Cppfunc elem;
             retval = dmmeta::Cppfunc_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(lib_ctype_TableId_dmmeta_Cppfunc, &elem, sizeof(elem));
+            }
             retval = retval && cppfunc_InputMaybe(elem);
             break;
         }
         case lib_ctype_TableId_dmmeta_Substr: { // finput:lib_ctype.FDb.substr
             dmmeta::Substr elem;
             retval = dmmeta::Substr_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(lib_ctype_TableId_dmmeta_Substr, &elem, sizeof(elem));
+            }
             retval = retval && substr_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -1617,6 +1660,99 @@ bool lib_ctype::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- lib_ctype.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool lib_ctype::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case lib_ctype_TableId_dmmeta_Fconst: { // finput:lib_ctype.FDb.fconst
+            dmmeta::Fconst elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = fconst_InputMaybe(elem);
+            }
+            break;
+        }
+        case lib_ctype_TableId_dmmeta_Ssimfile: { // finput:lib_ctype.FDb.ssimfile
+            dmmeta::Ssimfile elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ssimfile_InputMaybe(elem);
+            }
+            break;
+        }
+        case lib_ctype_TableId_dmmeta_Ftuple: { // finput:lib_ctype.FDb.ftuple
+            dmmeta::Ftuple elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ftuple_InputMaybe(elem);
+            }
+            break;
+        }
+        case lib_ctype_TableId_dmmeta_Ctype: { // finput:lib_ctype.FDb.ctype
+            dmmeta::Ctype elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ctype_InputMaybe(elem);
+            }
+            break;
+        }
+        case lib_ctype_TableId_dmmeta_Field: { // finput:lib_ctype.FDb.field
+            dmmeta::Field elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = field_InputMaybe(elem);
+            }
+            break;
+        }
+        case lib_ctype_TableId_dmmeta_Cdflt: { // finput:lib_ctype.FDb.cdflt
+            dmmeta::Cdflt elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = cdflt_InputMaybe(elem);
+            }
+            break;
+        }
+        case lib_ctype_TableId_dmmeta_Cfmt: { // finput:lib_ctype.FDb.cfmt
+            dmmeta::Cfmt elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = cfmt_InputMaybe(elem);
+            }
+            break;
+        }
+        case lib_ctype_TableId_dmmeta_Cppfunc: { // finput:lib_ctype.FDb.cppfunc
+            dmmeta::Cppfunc elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = cppfunc_InputMaybe(elem);
+            }
+            break;
+        }
+        case lib_ctype_TableId_dmmeta_Substr: { // finput:lib_ctype.FDb.substr
+            dmmeta::Substr elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = substr_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- lib_ctype.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool lib_ctype::LoadTuplesMaybe(algo::strptr root) {
@@ -1626,7 +1762,8 @@ bool lib_ctype::LoadTuplesMaybe(algo::strptr root) {
         , "dmmeta.cppfunc", "dmmeta.fconst", "dmmeta.ftuple", "dmmeta.ssimfile"
         , "dmmeta.substr"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, lib_ctype::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "lib_ctype", "ab81c986e2e85d3e267eb18d62976fdef0a8ff70"
+        , lib_ctype::InsertStrptrMaybe, lib_ctype::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -1757,7 +1894,8 @@ bool lib_ctype::cfmt_XrefMaybe(lib_ctype::FCfmt &row) {
 // --- lib_ctype.FDb.ind_cfmt.Find
 // Find row by key. Return NULL if not found.
 lib_ctype::FCfmt* lib_ctype::ind_cfmt_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_cfmt_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_cfmt_buckets_n - 1);
     lib_ctype::FCfmt* *e = &_db.ind_cfmt_buckets_elems[index];
     lib_ctype::FCfmt* ret=NULL;
     do {
@@ -1783,7 +1921,8 @@ bool lib_ctype::ind_cfmt_InsertMaybe(lib_ctype::FCfmt& row) {
     ind_cfmt_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_cfmt_next == (lib_ctype::FCfmt*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.cfmt) & (_db.ind_cfmt_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.cfmt);
+        u32 index = hash & (_db.ind_cfmt_buckets_n - 1);
         lib_ctype::FCfmt* *prev = &_db.ind_cfmt_buckets_elems[index];
         do {
             lib_ctype::FCfmt* ret = *prev;
@@ -1809,7 +1948,8 @@ bool lib_ctype::ind_cfmt_InsertMaybe(lib_ctype::FCfmt& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void lib_ctype::ind_cfmt_Remove(lib_ctype::FCfmt& row) {
     if (LIKELY(row.ind_cfmt_next != (lib_ctype::FCfmt*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.cfmt) & (_db.ind_cfmt_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.cfmt);
+        u32 index = hash & (_db.ind_cfmt_buckets_n - 1);
         lib_ctype::FCfmt* *prev = &_db.ind_cfmt_buckets_elems[index]; // addr of pointer to current element
         while (lib_ctype::FCfmt *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -25,15 +25,19 @@ namespace lib_exec {
 const char *lib_exec_help =
 "lib_exec: Build and run a dag of subprocesses with N parallel jobs\n"
 "Usage: lib_exec [options]\n"
-"    -dry_run        . default: false\n"
-"    -q              Do not print node name. default: true\n"
-"    -maxjobs   int  Maximum number of parallel jobs. default: 8\n"
-"    -complooo       . default: false\n"
-"    -verbose        Enable verbose mode\n"
-"    -debug          Enable debug mode\n"
-"    -version        Show version information\n"
-"    -sig            Print SHA1 signatures for dispatches\n"
-"    -help           Print this screen and exit\n"
+"    -dry_run          . default: false\n"
+"    -q                Do not print node name. default: true\n"
+"    -maxjobs     int  Maximum number of parallel jobs. default: 8\n"
+"    -complooo         . default: false\n"
+"    -verbose          Enable verbose mode\n"
+"    -debug            Enable debug mode\n"
+"    -unbuffered       Disable buffering of output\n"
+"    -snap             Load inputs from binary snapshots in temp/\n"
+"    -nommap           Read input files instead of mapping them\n"
+"    -linebuf     int  Max. read buffer for piped input. default: 1048576\n"
+"    -version          Show version information\n"
+"    -sig              Print SHA1 signatures for dispatches\n"
+"    -help             Print this screen and exit\n"
 ;
 
 
@@ -52,14 +56,16 @@ lib_exec::_db_bh_syscmd_curs::~_db_bh_syscmd_curs() {
 namespace lib_exec {
     // Load statically available data into tables, register tables and database.
     static void          InitReflection();
-    // Find new location for ROW starting at IDX
-    // NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
-    static int           bh_syscmd_Downheap(lib_exec::FSyscmd& row, int idx) __attribute__((nothrow));
-    // Find and return index of new location for element ROW in the heap, starting at index IDX.
-    // Move any elements along the way but do not modify ROW.
-    static int           bh_syscmd_Upheap(lib_exec::FSyscmd& row, int idx) __attribute__((nothrow));
+    // Find new location for heap element ELEM starting at IDX
+    // NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.
+    static int           bh_syscmd_Downheap(_db_bh_syscmd_elem elem, int idx) __attribute__((nothrow));
+    // Find and return index of new location for heap element ELEM, starting at index IDX.
+    // Move any elements along the way but do not store ELEM.
+    static int           bh_syscmd_Upheap(_db_bh_syscmd_elem elem, int idx) __attribute__((nothrow));
     static bool          bh_syscmd_ElemLt(lib_exec::FSyscmd &a, lib_exec::FSyscmd &b) __attribute__((nothrow));
     static void          _db_bh_syscmd_curs_Add(_db_bh_syscmd_curs &curs, lib_exec::FSyscmd& row);
+    // Compare two heap elements (dmmeta.bheap heaps only)
+    static bool          bh_syscmd_HeapLt(_db_bh_syscmd_elem a, _db_bh_syscmd_elem b) __attribute__((nothrow));
     // find trace by row id (used to implement reflection)
     static algo::ImrowPtr trace_RowidFind(int t) __attribute__((nothrow));
     // Function return 1
@@ -355,7 +361,8 @@ bool lib_exec::syscmd_XrefMaybe(lib_exec::FSyscmd &row) {
 // --- lib_exec.FDb.ind_running.Find
 // Find row by key. Return NULL if not found.
 lib_exec::FSyscmd* lib_exec::ind_running_Find(i32 key) {
-    u32 index = i32_Hash(0, key) & (_db.ind_running_buckets_n - 1);
+    u32 hash  = i32_Hash(0, key);
+    u32 index = hash & (_db.ind_running_buckets_n - 1);
     lib_exec::FSyscmd* *e = &_db.ind_running_buckets_elems[index];
     lib_exec::FSyscmd* ret=NULL;
     do {
@@ -389,7 +396,8 @@ bool lib_exec::ind_running_InsertMaybe(lib_exec::FSyscmd& row) {
     ind_running_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_running_next == (lib_exec::FSyscmd*)-1)) {// check if in hash already
-        u32 index = i32_Hash(0, row.pid) & (_db.ind_running_buckets_n - 1);
+        u32 hash  = i32_Hash(0, row.pid);
+        u32 index = hash & (_db.ind_running_buckets_n - 1);
         lib_exec::FSyscmd* *prev = &_db.ind_running_buckets_elems[index];
         do {
             lib_exec::FSyscmd* ret = *prev;
@@ -415,7 +423,8 @@ bool lib_exec::ind_running_InsertMaybe(lib_exec::FSyscmd& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void lib_exec::ind_running_Remove(lib_exec::FSyscmd& row) {
     if (LIKELY(row.ind_running_next != (lib_exec::FSyscmd*)-1)) {// check if in hash already
-        u32 index = i32_Hash(0, row.pid) & (_db.ind_running_buckets_n - 1);
+        u32 hash  = i32_Hash(0, row.pid);
+        u32 index = hash & (_db.ind_running_buckets_n - 1);
         lib_exec::FSyscmd* *prev = &_db.ind_running_buckets_elems[index]; // addr of pointer to current element
         while (lib_exec::FSyscmd *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -469,35 +478,32 @@ void lib_exec::ind_running_Reserve(int n) {
 // Remove all elements from heap and free memory used by the array.
 void lib_exec::bh_syscmd_Dealloc() {
     bh_syscmd_RemoveAll();
-    algo_lib::malloc_FreeMem(_db.bh_syscmd_elems, sizeof(lib_exec::FSyscmd*)*_db.bh_syscmd_max);
+    algo_lib::malloc_FreeMem(_db.bh_syscmd_elems, sizeof(_db_bh_syscmd_elem)*_db.bh_syscmd_max);
     _db.bh_syscmd_max   = 0;
     _db.bh_syscmd_elems = NULL;
 }
 
 // --- lib_exec.FDb.bh_syscmd.Downheap
-// Find new location for ROW starting at IDX
-// NOTE: Rest of heap is rearranged, but pointer to ROW is NOT stored in array.
-static int lib_exec::bh_syscmd_Downheap(lib_exec::FSyscmd& row, int idx) {
-    lib_exec::FSyscmd* *elems = _db.bh_syscmd_elems;
+// Find new location for heap element ELEM starting at IDX
+// NOTE: Rest of heap is rearranged, but ELEM is NOT stored in array.
+static int lib_exec::bh_syscmd_Downheap(_db_bh_syscmd_elem elem, int idx) {
+    _db_bh_syscmd_elem *elems = _db.bh_syscmd_elems;
     int n = _db.bh_syscmd_n;
-    int child = idx*2+1;
+    int child = idx*4+1;
     while (child < n) {
-        lib_exec::FSyscmd* p = elems[child]; // left child
-        int rchild = child+1;
-        if (rchild < n) {
-            lib_exec::FSyscmd* q = elems[rchild]; // right child
-            if (bh_syscmd_ElemLt(*q,*p)) {
-                child = rchild;
-                p     = q;
+        int lim = child+4 < n ? child+4 : n;
+        for (int i = child+1; i < lim; i++) { // pick smallest child
+            if (bh_syscmd_HeapLt(elems[i], elems[child])) {
+                child = i;
             }
         }
-        if (!bh_syscmd_ElemLt(*p,row)) {
+        if (!bh_syscmd_HeapLt(elems[child], elem)) {
             break;
         }
-        p->bh_syscmd_idx   = idx;
-        elems[idx]     = p;
-        idx            = child;
-        child          = idx*2+1;
+        elems[idx] = elems[child];
+        elems[idx].row->bh_syscmd_idx = idx;
+        idx        = child;
+        child      = idx*4+1;
     }
     return idx;
 }
@@ -509,9 +515,10 @@ void lib_exec::bh_syscmd_Insert(lib_exec::FSyscmd& row) {
         bh_syscmd_Reserve(1);
         int n = _db.bh_syscmd_n;
         _db.bh_syscmd_n = n + 1;
-        int new_idx = bh_syscmd_Upheap(row, n);
+        _db_bh_syscmd_elem elem = _db_bh_syscmd_elem(execkey_Get(row), &row);
+        int new_idx = bh_syscmd_Upheap(elem, n);
         row.bh_syscmd_idx = new_idx;
-        _db.bh_syscmd_elems[new_idx] = &row;
+        _db.bh_syscmd_elems[new_idx] = elem;
     }
 }
 
@@ -525,12 +532,13 @@ i32 lib_exec::bh_syscmd_Reheap(lib_exec::FSyscmd& row) {
         bh_syscmd_Reserve(1);
         old_idx = _db.bh_syscmd_n++;
     }
-    int new_idx = bh_syscmd_Upheap(row, old_idx);
+    _db_bh_syscmd_elem elem = _db_bh_syscmd_elem(execkey_Get(row), &row);
+    int new_idx = bh_syscmd_Upheap(elem, old_idx);
     if (!isnew && new_idx == old_idx) {
-        new_idx = bh_syscmd_Downheap(row, old_idx);
+        new_idx = bh_syscmd_Downheap(elem, old_idx);
     }
     row.bh_syscmd_idx = new_idx;
-    _db.bh_syscmd_elems[new_idx] = &row;
+    _db.bh_syscmd_elems[new_idx] = elem;
     return new_idx;
 }
 
@@ -540,10 +548,11 @@ i32 lib_exec::bh_syscmd_Reheap(lib_exec::FSyscmd& row) {
 // Return new position of item in the heap (0=top).
 // Heap must be non-empty or behavior is undefined.
 i32 lib_exec::bh_syscmd_ReheapFirst() {
-    lib_exec::FSyscmd &row = *_db.bh_syscmd_elems[0];
-    i32 new_idx = bh_syscmd_Downheap(row, 0);
+    lib_exec::FSyscmd &row = *_db.bh_syscmd_elems[0].row;
+    _db_bh_syscmd_elem elem = _db_bh_syscmd_elem(execkey_Get(row), &row);
+    i32 new_idx = bh_syscmd_Downheap(elem, 0);
     row.bh_syscmd_idx = new_idx;
-    _db.bh_syscmd_elems[new_idx] = &row;
+    _db.bh_syscmd_elems[new_idx] = elem;
     return new_idx;
 }
 
@@ -552,17 +561,17 @@ i32 lib_exec::bh_syscmd_ReheapFirst() {
 void lib_exec::bh_syscmd_Remove(lib_exec::FSyscmd& row) {
     if (bh_syscmd_InBheapQ(row)) {
         int old_idx = row.bh_syscmd_idx;
-        if (_db.bh_syscmd_elems[old_idx] == &row) { // sanity check: heap points back to row
+        if (&row == _db.bh_syscmd_elems[old_idx].row) { // sanity check: heap points back to row
             row.bh_syscmd_idx = -1;           // mark not in heap
             i32 n = _db.bh_syscmd_n - 1; // index of last element in heap
             _db.bh_syscmd_n = n;         // decrease count
             if (old_idx != n) {
-                lib_exec::FSyscmd *elem = _db.bh_syscmd_elems[n];
-                int new_idx = bh_syscmd_Upheap(*elem, old_idx);
+                _db_bh_syscmd_elem elem = _db.bh_syscmd_elems[n];
+                int new_idx = bh_syscmd_Upheap(elem, old_idx);
                 if (new_idx == old_idx) {
-                    new_idx = bh_syscmd_Downheap(*elem, old_idx);
+                    new_idx = bh_syscmd_Downheap(elem, old_idx);
                 }
-                elem->bh_syscmd_idx = new_idx;
+                elem.row->bh_syscmd_idx = new_idx;
                 _db.bh_syscmd_elems[new_idx] = elem;
             }
         }
@@ -574,7 +583,7 @@ void lib_exec::bh_syscmd_Remove(lib_exec::FSyscmd& row) {
 void lib_exec::bh_syscmd_RemoveAll() {
     int n = _db.bh_syscmd_n;
     for (int i = n - 1; i>=0; i--) {
-        _db.bh_syscmd_elems[i]->bh_syscmd_idx = -1; // mark not-in-heap
+        _db.bh_syscmd_elems[i].row->bh_syscmd_idx = -1; // mark not-in-heap
     }
     _db.bh_syscmd_n = 0;
 }
@@ -585,15 +594,15 @@ void lib_exec::bh_syscmd_RemoveAll() {
 lib_exec::FSyscmd* lib_exec::bh_syscmd_RemoveFirst() {
     lib_exec::FSyscmd *row = NULL;
     if (_db.bh_syscmd_n > 0) {
-        row = _db.bh_syscmd_elems[0];
+        row = _db.bh_syscmd_elems[0].row;
         row->bh_syscmd_idx = -1;           // mark not in heap
         i32 n = _db.bh_syscmd_n - 1; // index of last element in heap
         _db.bh_syscmd_n = n;         // decrease count
         if (n) {
-            lib_exec::FSyscmd &elem = *_db.bh_syscmd_elems[n];
+            _db_bh_syscmd_elem elem = _db.bh_syscmd_elems[n];
             int new_idx = bh_syscmd_Downheap(elem, 0);
-            elem.bh_syscmd_idx = new_idx;
-            _db.bh_syscmd_elems[new_idx] = &elem;
+            elem.row->bh_syscmd_idx = new_idx;
+            _db.bh_syscmd_elems[new_idx] = elem;
         }
     }
     return row;
@@ -605,30 +614,29 @@ void lib_exec::bh_syscmd_Reserve(int n) {
     i32 old_max = _db.bh_syscmd_max;
     if (UNLIKELY(_db.bh_syscmd_n + n > old_max)) {
         u32 new_max  = u32_Max(4, old_max * 2);
-        u32 old_size = old_max * sizeof(lib_exec::FSyscmd*);
-        u32 new_size = new_max * sizeof(lib_exec::FSyscmd*);
+        u32 old_size = old_max * sizeof(_db_bh_syscmd_elem);
+        u32 new_size = new_max * sizeof(_db_bh_syscmd_elem);
         void *new_mem = algo_lib::malloc_ReallocMem(_db.bh_syscmd_elems, old_size, new_size);
         if (UNLIKELY(!new_mem)) {
             FatalErrorExit("lib_exec.out_of_memory  field:lib_exec.FDb.bh_syscmd");
         }
-        _db.bh_syscmd_elems = (lib_exec::FSyscmd**)new_mem;
+        _db.bh_syscmd_elems = (_db_bh_syscmd_elem*)new_mem;
         _db.bh_syscmd_max = new_max;
     }
 }
 
 // --- lib_exec.FDb.bh_syscmd.Upheap
-// Find and return index of new location for element ROW in the heap, starting at index IDX.
-// Move any elements along the way but do not modify ROW.
-static int lib_exec::bh_syscmd_Upheap(lib_exec::FSyscmd& row, int idx) {
-    lib_exec::FSyscmd* *elems = _db.bh_syscmd_elems;
+// Find and return index of new location for heap element ELEM, starting at index IDX.
+// Move any elements along the way but do not store ELEM.
+static int lib_exec::bh_syscmd_Upheap(_db_bh_syscmd_elem elem, int idx) {
+    _db_bh_syscmd_elem *elems = _db.bh_syscmd_elems;
     while (idx>0) {
-        int j = (idx-1)/2;
-        lib_exec::FSyscmd* p = elems[j];
-        if (!bh_syscmd_ElemLt(row, *p)) {
+        int j = (idx-1)/4;
+        if (!bh_syscmd_HeapLt(elem, elems[j])) {
             break;
         }
-        p->bh_syscmd_idx = idx;
-        elems[idx] = p;
+        elems[idx] = elems[j];
+        elems[idx].row->bh_syscmd_idx = idx;
         idx = j;
     }
     return idx;
@@ -640,6 +648,13 @@ inline static bool lib_exec::bh_syscmd_ElemLt(lib_exec::FSyscmd &a, lib_exec::FS
     return execkey_Get(a) < execkey_Get(b);
 }
 
+// --- lib_exec.FDb.bh_syscmd.HeapLt
+// Compare two heap elements (dmmeta.bheap heaps only)
+inline static bool lib_exec::bh_syscmd_HeapLt(_db_bh_syscmd_elem a, _db_bh_syscmd_elem b) {
+    (void)_db;
+    return a.key < b.key;
+}
+
 // --- lib_exec.FDb.zd_started.Insert
 // Insert row into linked list. If row is already in linked list, do nothing.
 void lib_exec::zd_started_Insert(lib_exec::FSyscmd& row) {
@@ -762,7 +777,7 @@ void lib_exec::_db_bh_syscmd_curs_Reset(_db_bh_syscmd_curs &curs, lib_exec::FDb
     _db_bh_syscmd_curs_Reserve(curs, bh_syscmd_N());
     curs.temp_n = 0;
     if (parent.bh_syscmd_n > 0) {
-        lib_exec::FSyscmd &first = *parent.bh_syscmd_elems[0];
+        lib_exec::FSyscmd &first = *parent.bh_syscmd_elems[0].row;
         curs.temp_elems[0] = &first; // insert first element in heap
         curs.temp_n = 1;
     }
@@ -800,13 +815,10 @@ void lib_exec::_db_bh_syscmd_curs_Next(_db_bh_syscmd_curs &curs) {
         } while (i < n);
         curs.temp_n = n-1;
         int index = dead->bh_syscmd_idx;
-        i = (index*2+1);
-        if (i < bh_syscmd_N()) {
-            lib_exec::FSyscmd &elem = *curs.parent->bh_syscmd_elems[i];
-            _db_bh_syscmd_curs_Add(curs, elem);
-        }
-        if (i+1 < bh_syscmd_N()) {
-            lib_exec::FSyscmd &elem = *curs.parent->bh_syscmd_elems[i + 1];
+        i = (index*4+1);
+        int lim = i+4 < bh_syscmd_N() ? i+4 : bh_syscmd_N();
+        for (; i < lim; i++) {
+            lib_exec::FSyscmd &elem = *curs.parent->bh_syscmd_elems[i].row;
             _db_bh_syscmd_curs_Add(curs, elem);
         }
     }
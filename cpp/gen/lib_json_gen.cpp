@@ -301,7 +301,8 @@ bool lib_json::node_XrefMaybe(lib_json::FNode &row) {
 // --- lib_json.FDb.ind_objfld.Find
 // Find row by key. Return NULL if not found.
 lib_json::FNode* lib_json::ind_objfld_Find(const lib_json::FldKey& key) {
-    u32 index = FldKey_Hash(0, key) & (_db.ind_objfld_buckets_n - 1);
+    u32 hash  = FldKey_Hash(0, key);
+    u32 index = hash & (_db.ind_objfld_buckets_n - 1);
     lib_json::FNode* *e = &_db.ind_objfld_buckets_elems[index];
     lib_json::FNode* ret=NULL;
     do {
@@ -319,7 +320,8 @@ bool lib_json::ind_objfld_InsertMaybe(lib_json::FNode& row) {
     ind_objfld_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_objfld_next == (lib_json::FNode*)-1)) {// check if in hash already
-        u32 index = FldKey_Hash(0, fldkey_Get(row)) & (_db.ind_objfld_buckets_n - 1);
+        u32 hash  = FldKey_Hash(0, fldkey_Get(row));
+        u32 index = hash & (_db.ind_objfld_buckets_n - 1);
         lib_json::FNode* *prev = &_db.ind_objfld_buckets_elems[index];
         do {
             lib_json::FNode* ret = *prev;
@@ -345,7 +347,8 @@ bool lib_json::ind_objfld_InsertMaybe(lib_json::FNode& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void lib_json::ind_objfld_Remove(lib_json::FNode& row) {
     if (LIKELY(row.ind_objfld_next != (lib_json::FNode*)-1)) {// check if in hash already
-        u32 index = FldKey_Hash(0, fldkey_Get(row)) & (_db.ind_objfld_buckets_n - 1);
+        u32 hash  = FldKey_Hash(0, fldkey_Get(row));
+        u32 index = hash & (_db.ind_objfld_buckets_n - 1);
         lib_json::FNode* *prev = &_db.ind_objfld_buckets_elems[index]; // addr of pointer to current element
         while (lib_json::FNode *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
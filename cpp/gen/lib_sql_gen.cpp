@@ -189,7 +189,8 @@ bool lib_sql::attr_XrefMaybe(lib_sql::FAttr &row) {
 // --- lib_sql.FDb.ind_attr.Find
 // Find row by key. Return NULL if not found.
 lib_sql::FAttr* lib_sql::ind_attr_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_attr_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_attr_buckets_n - 1);
     lib_sql::FAttr* *e = &_db.ind_attr_buckets_elems[index];
     lib_sql::FAttr* ret=NULL;
     do {
@@ -231,7 +232,8 @@ bool lib_sql::ind_attr_InsertMaybe(lib_sql::FAttr& row) {
     ind_attr_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_attr_next == (lib_sql::FAttr*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.attr) & (_db.ind_attr_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.attr);
+        u32 index = hash & (_db.ind_attr_buckets_n - 1);
         lib_sql::FAttr* *prev = &_db.ind_attr_buckets_elems[index];
         do {
             lib_sql::FAttr* ret = *prev;
@@ -257,7 +259,8 @@ bool lib_sql::ind_attr_InsertMaybe(lib_sql::FAttr& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void lib_sql::ind_attr_Remove(lib_sql::FAttr& row) {
     if (LIKELY(row.ind_attr_next != (lib_sql::FAttr*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.attr) & (_db.ind_attr_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.attr);
+        u32 index = hash & (_db.ind_attr_buckets_n - 1);
         lib_sql::FAttr* *prev = &_db.ind_attr_buckets_elems[index]; // addr of pointer to current element
         while (lib_sql::FAttr *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -48,6 +48,10 @@ const char *mdbg_help =
 "    -in            string  Input directory or filename, - for stdin. default: \"data\"\n"
 "    -verbose               Enable verbose mode\n"
 "    -debug                 Enable debug mode\n"
+"    -unbuffered            Disable buffering of output\n"
+"    -snap                  Load inputs from binary snapshots in temp/\n"
+"    -nommap                Read input files instead of mapping them\n"
+"    -linebuf       int     Max. read buffer for piped input. default: 1048576\n"
 "    -version               Show version information\n"
 "    -sig                   Print SHA1 signatures for dispatches\n"
 "    -help                  Print this screen and exit\n"
@@ -376,16 +380,23 @@ bool mdbg::InsertStrptrMaybe(algo::strptr str) {
         case mdbg_TableId_dev_Cfg: { // finput:mdbg.FDb.cfg
             dev::Cfg elem;
             retval = dev::Cfg_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(mdbg_TableId_dev_Cfg, &elem, sizeof(elem));
+            }
             retval = retval && cfg_InputMaybe(elem);
             break;
         }
         case mdbg_TableId_dev_Builddir: { // finput:mdbg.FDb.builddir
             dev::Builddir elem;
             retval = dev::Builddir_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(mdbg_TableId_dev_Builddir, &elem, sizeof(elem));
+            }
             retval = retval && builddir_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -395,6 +406,36 @@ bool mdbg::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- mdbg.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool mdbg::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case mdbg_TableId_dev_Cfg: { // finput:mdbg.FDb.cfg
+            dev::Cfg elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = cfg_InputMaybe(elem);
+            }
+            break;
+        }
+        case mdbg_TableId_dev_Builddir: { // finput:mdbg.FDb.builddir
+            dev::Builddir elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = builddir_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- mdbg.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool mdbg::LoadTuplesMaybe(algo::strptr root) {
@@ -402,7 +443,8 @@ bool mdbg::LoadTuplesMaybe(algo::strptr root) {
     static const char *ssimfiles[] = {
         "dev.cfg", "dev.builddir"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, mdbg::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "mdbg", "aa5e06ab452d862c1bcf55dfd92cdb360fac8740"
+        , mdbg::InsertStrptrMaybe, mdbg::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -534,7 +576,8 @@ bool mdbg::cfg_XrefMaybe(mdbg::FCfg &row) {
 // --- mdbg.FDb.ind_cfg.Find
 // Find row by key. Return NULL if not found.
 mdbg::FCfg* mdbg::ind_cfg_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_cfg_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_cfg_buckets_n - 1);
     mdbg::FCfg* *e = &_db.ind_cfg_buckets_elems[index];
     mdbg::FCfg* ret=NULL;
     do {
@@ -568,7 +611,8 @@ bool mdbg::ind_cfg_InsertMaybe(mdbg::FCfg& row) {
     ind_cfg_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_cfg_next == (mdbg::FCfg*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.cfg) & (_db.ind_cfg_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.cfg);
+        u32 index = hash & (_db.ind_cfg_buckets_n - 1);
         mdbg::FCfg* *prev = &_db.ind_cfg_buckets_elems[index];
         do {
             mdbg::FCfg* ret = *prev;
@@ -594,7 +638,8 @@ bool mdbg::ind_cfg_InsertMaybe(mdbg::FCfg& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void mdbg::ind_cfg_Remove(mdbg::FCfg& row) {
     if (LIKELY(row.ind_cfg_next != (mdbg::FCfg*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.cfg) & (_db.ind_cfg_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.cfg);
+        u32 index = hash & (_db.ind_cfg_buckets_n - 1);
         mdbg::FCfg* *prev = &_db.ind_cfg_buckets_elems[index]; // addr of pointer to current element
         while (mdbg::FCfg *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -30,17 +30,21 @@ orgfile::FDb    orgfile::_db;     // dependency found via dev.targdep
 namespace orgfile {
 const char *orgfile_help =
 "Usage: orgfile [options]\n"
-"    -in       string  Input directory or filename, - for stdin. default: \"data\"\n"
-"    -move     string  Read stdin, rename files based on pattern\n"
-"    -dedup    string  Only allow deleting files that match this regx\n"
-"    -commit           Apply changes. default: false\n"
-"    -undo             Read previous orgfile output, undoing movement. default: false\n"
-"    -hash     string  Hash command to use for deduplication. default: \"sha1\"\n"
-"    -verbose          Enable verbose mode\n"
-"    -debug            Enable debug mode\n"
-"    -version          Show version information\n"
-"    -sig              Print SHA1 signatures for dispatches\n"
-"    -help             Print this screen and exit\n"
+"    -in          string  Input directory or filename, - for stdin. default: \"data\"\n"
+"    -move        string  Read stdin, rename files based on pattern\n"
+"    -dedup       string  Only allow deleting files that match this regx\n"
+"    -commit              Apply changes. default: false\n"
+"    -undo                Read previous orgfile output, undoing movement. default: false\n"
+"    -hash        string  Hash command to use for deduplication. default: \"sha1\"\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -135,10 +139,14 @@ bool orgfile::InsertStrptrMaybe(algo::strptr str) {
         case orgfile_TableId_dev_Timefmt: { // finput:orgfile.FDb.timefmt
             dev::Timefmt elem;
             retval = dev::Timefmt_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(orgfile_TableId_dev_Timefmt, &elem, sizeof(elem));
+            }
             retval = retval && timefmt_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -148,6 +156,27 @@ bool orgfile::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- orgfile.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool orgfile::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case orgfile_TableId_dev_Timefmt: { // finput:orgfile.FDb.timefmt
+            dev::Timefmt elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = timefmt_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- orgfile.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool orgfile::LoadTuplesMaybe(algo::strptr root) {
@@ -155,7 +184,8 @@ bool orgfile::LoadTuplesMaybe(algo::strptr root) {
     static const char *ssimfiles[] = {
         "dev.timefmt"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, orgfile::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "orgfile", "dadfcf8accbcc44f5e5443f439ac4024afc89edf"
+        , orgfile::InsertStrptrMaybe, orgfile::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -297,8 +327,15 @@ bool orgfile::filename_XrefMaybe(orgfile::FFilename &row) {
 // --- orgfile.FDb.ind_filename.Find
 // Find row by key. Return NULL if not found.
 orgfile::FFilename* orgfile::ind_filename_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_filename_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_filename_buckets_n - 1);
     orgfile::FFilename* *e = &_db.ind_filename_buckets_elems[index];
+    if (_db.ind_filename_old_elems) { // incremental rehash in progress
+        u32 old_index = hash & (_db.ind_filename_old_n - 1);
+        if (old_index >= u32(_db.ind_filename_old_pos)) { // bucket not migrated yet
+            e = &_db.ind_filename_old_elems[old_index];
+        }
+    }
     orgfile::FFilename* ret=NULL;
     do {
         ret       = *e;
@@ -321,10 +358,18 @@ orgfile::FFilename& orgfile::ind_filename_FindX(const algo::strptr& key) {
 // Insert row into hash table. Return true if row is reachable through the hash after the function completes.
 bool orgfile::ind_filename_InsertMaybe(orgfile::FFilename& row) {
     ind_filename_Reserve(1);
+    ind_filename_Rehash(2); // migrate old buckets faster than inserts can fill new ones
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_filename_next == (orgfile::FFilename*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.filename) & (_db.ind_filename_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.filename);
+        u32 index = hash & (_db.ind_filename_buckets_n - 1);
         orgfile::FFilename* *prev = &_db.ind_filename_buckets_elems[index];
+        if (_db.ind_filename_old_elems) { // incremental rehash in progress
+            u32 old_index = hash & (_db.ind_filename_old_n - 1);
+            if (old_index >= u32(_db.ind_filename_old_pos)) { // bucket not migrated yet
+                prev = &_db.ind_filename_old_elems[old_index];
+            }
+        }
         do {
             orgfile::FFilename* ret = *prev;
             if (!ret) { // exit condition 1: reached the end of the list
@@ -349,8 +394,15 @@ bool orgfile::ind_filename_InsertMaybe(orgfile::FFilename& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void orgfile::ind_filename_Remove(orgfile::FFilename& row) {
     if (LIKELY(row.ind_filename_next != (orgfile::FFilename*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.filename) & (_db.ind_filename_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.filename);
+        u32 index = hash & (_db.ind_filename_buckets_n - 1);
         orgfile::FFilename* *prev = &_db.ind_filename_buckets_elems[index]; // addr of pointer to current element
+        if (_db.ind_filename_old_elems) { // incremental rehash in progress
+            u32 old_index = hash & (_db.ind_filename_old_n - 1);
+            if (old_index >= u32(_db.ind_filename_old_pos)) { // bucket not migrated yet
+                prev = &_db.ind_filename_old_elems[old_index];
+            }
+        }
         while (orgfile::FFilename *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
                 *prev = next->ind_filename_next; // unlink (singly linked list)
@@ -370,35 +422,50 @@ void orgfile::ind_filename_Reserve(int n) {
     u32 new_nelems   = _db.ind_filename_n + n;
     // # of elements has to be roughly equal to the number of buckets
     if (new_nelems > old_nbuckets) {
+        ind_filename_Rehash(_db.ind_filename_old_n); // complete previous rehash, if any
         int new_nbuckets = i32_Max(BumpToPow2(new_nelems), u32(4));
-        u32 old_size = old_nbuckets * sizeof(orgfile::FFilename*);
         u32 new_size = new_nbuckets * sizeof(orgfile::FFilename*);
-        // allocate new array. we don't use Realloc since copying is not needed and factor of 2 probably
-        // means new memory will have to be allocated anyway
         orgfile::FFilename* *new_buckets = (orgfile::FFilename**)algo_lib::malloc_AllocMem(new_size);
         if (UNLIKELY(!new_buckets)) {
             FatalErrorExit("orgfile.out_of_memory  field:orgfile.FDb.ind_filename");
         }
         memset(new_buckets, 0, new_size); // clear pointers
-        // rehash all entries
-        for (int i = 0; i < _db.ind_filename_buckets_n; i++) {
-            orgfile::FFilename* elem = _db.ind_filename_buckets_elems[i];
-            while (elem) {
-                orgfile::FFilename &row        = *elem;
-                orgfile::FFilename* next       = row.ind_filename_next;
-                u32 index          = cstring_Hash(0, row.filename) & (new_nbuckets-1);
-                row.ind_filename_next     = new_buckets[index];
-                new_buckets[index] = &row;
-                elem               = next;
-            }
-        }
-        // free old array
-        algo_lib::malloc_FreeMem(_db.ind_filename_buckets_elems, old_size);
+        // existing entries stay in the old array and are migrated
+        // a few buckets at a time by subsequent inserts
+        _db.ind_filename_old_elems = _db.ind_filename_buckets_elems;
+        _db.ind_filename_old_n = _db.ind_filename_buckets_n;
+        _db.ind_filename_old_pos = 0;
         _db.ind_filename_buckets_elems = new_buckets;
         _db.ind_filename_buckets_n = new_nbuckets;
     }
 }
 
+// --- orgfile.FDb.ind_filename.Rehash
+// Incremental rehash: migrate up to N buckets from old bucket array to new one
+void orgfile::ind_filename_Rehash(int n) {
+    while (n > 0 && _db.ind_filename_old_elems) {
+        orgfile::FFilename* *bucket = &_db.ind_filename_old_elems[_db.ind_filename_old_pos];
+        orgfile::FFilename* elem = *bucket;
+        while (elem) {
+            orgfile::FFilename &row        = *elem;
+            orgfile::FFilename* next       = row.ind_filename_next;
+            u32 index          = cstring_Hash(0, row.filename) & (_db.ind_filename_buckets_n - 1);
+            row.ind_filename_next     = _db.ind_filename_buckets_elems[index];
+            _db.ind_filename_buckets_elems[index] = &row;
+            elem               = next;
+        }
+        *bucket = NULL;
+        _db.ind_filename_old_pos++;
+        n--;
+        if (_db.ind_filename_old_pos == _db.ind_filename_old_n) { // done, free old array
+            algo_lib::malloc_FreeMem(_db.ind_filename_old_elems, _db.ind_filename_old_n * sizeof(orgfile::FFilename*));
+            _db.ind_filename_old_elems = NULL;
+            _db.ind_filename_old_n = 0;
+            _db.ind_filename_old_pos = 0;
+        }
+    }
+}
+
 // --- orgfile.FDb.filehash.Alloc
 // Allocate memory for new default row.
 // If out of memory, process is killed.
@@ -488,8 +555,15 @@ bool orgfile::filehash_XrefMaybe(orgfile::FFilehash &row) {
 // --- orgfile.FDb.ind_filehash.Find
 // Find row by key. Return NULL if not found.
 orgfile::FFilehash* orgfile::ind_filehash_Find(const algo::strptr& key) {
-    u32 index = Smallstr40_Hash(0, key) & (_db.ind_filehash_buckets_n - 1);
+    u32 hash  = Smallstr40_Hash(0, key);
+    u32 index = hash & (_db.ind_filehash_buckets_n - 1);
     orgfile::FFilehash* *e = &_db.ind_filehash_buckets_elems[index];
+    if (_db.ind_filehash_old_elems) { // incremental rehash in progress
+        u32 old_index = hash & (_db.ind_filehash_old_n - 1);
+        if (old_index >= u32(_db.ind_filehash_old_pos)) { // bucket not migrated yet
+            e = &_db.ind_filehash_old_elems[old_index];
+        }
+    }
     orgfile::FFilehash* ret=NULL;
     do {
         ret       = *e;
@@ -528,10 +602,18 @@ orgfile::FFilehash& orgfile::ind_filehash_GetOrCreate(const algo::strptr& key) {
 // Insert row into hash table. Return true if row is reachable through the hash after the function completes.
 bool orgfile::ind_filehash_InsertMaybe(orgfile::FFilehash& row) {
     ind_filehash_Reserve(1);
+    ind_filehash_Rehash(2); // migrate old buckets faster than inserts can fill new ones
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_filehash_next == (orgfile::FFilehash*)-1)) {// check if in hash already
-        u32 index = Smallstr40_Hash(0, row.filehash) & (_db.ind_filehash_buckets_n - 1);
+        u32 hash  = Smallstr40_Hash(0, row.filehash);
+        u32 index = hash & (_db.ind_filehash_buckets_n - 1);
         orgfile::FFilehash* *prev = &_db.ind_filehash_buckets_elems[index];
+        if (_db.ind_filehash_old_elems) { // incremental rehash in progress
+            u32 old_index = hash & (_db.ind_filehash_old_n - 1);
+            if (old_index >= u32(_db.ind_filehash_old_pos)) { // bucket not migrated yet
+                prev = &_db.ind_filehash_old_elems[old_index];
+            }
+        }
         do {
             orgfile::FFilehash* ret = *prev;
             if (!ret) { // exit condition 1: reached the end of the list
@@ -556,8 +638,15 @@ bool orgfile::ind_filehash_InsertMaybe(orgfile::FFilehash& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void orgfile::ind_filehash_Remove(orgfile::FFilehash& row) {
     if (LIKELY(row.ind_filehash_next != (orgfile::FFilehash*)-1)) {// check if in hash already
-        u32 index = Smallstr40_Hash(0, row.filehash) & (_db.ind_filehash_buckets_n - 1);
+        u32 hash  = Smallstr40_Hash(0, row.filehash);
+        u32 index = hash & (_db.ind_filehash_buckets_n - 1);
         orgfile::FFilehash* *prev = &_db.ind_filehash_buckets_elems[index]; // addr of pointer to current element
+        if (_db.ind_filehash_old_elems) { // incremental rehash in progress
+            u32 old_index = hash & (_db.ind_filehash_old_n - 1);
+            if (old_index >= u32(_db.ind_filehash_old_pos)) { // bucket not migrated yet
+                prev = &_db.ind_filehash_old_elems[old_index];
+            }
+        }
         while (orgfile::FFilehash *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
                 *prev = next->ind_filehash_next; // unlink (singly linked list)
@@ -577,35 +666,50 @@ void orgfile::ind_filehash_Reserve(int n) {
     u32 new_nelems   = _db.ind_filehash_n + n;
     // # of elements has to be roughly equal to the number of buckets
     if (new_nelems > old_nbuckets) {
+        ind_filehash_Rehash(_db.ind_filehash_old_n); // complete previous rehash, if any
         int new_nbuckets = i32_Max(BumpToPow2(new_nelems), u32(4));
-        u32 old_size = old_nbuckets * sizeof(orgfile::FFilehash*);
         u32 new_size = new_nbuckets * sizeof(orgfile::FFilehash*);
-        // allocate new array. we don't use Realloc since copying is not needed and factor of 2 probably
-        // means new memory will have to be allocated anyway
         orgfile::FFilehash* *new_buckets = (orgfile::FFilehash**)algo_lib::malloc_AllocMem(new_size);
         if (UNLIKELY(!new_buckets)) {
             FatalErrorExit("orgfile.out_of_memory  field:orgfile.FDb.ind_filehash");
         }
         memset(new_buckets, 0, new_size); // clear pointers
-        // rehash all entries
-        for (int i = 0; i < _db.ind_filehash_buckets_n; i++) {
-            orgfile::FFilehash* elem = _db.ind_filehash_buckets_elems[i];
-            while (elem) {
-                orgfile::FFilehash &row        = *elem;
-                orgfile::FFilehash* next       = row.ind_filehash_next;
-                u32 index          = Smallstr40_Hash(0, row.filehash) & (new_nbuckets-1);
-                row.ind_filehash_next     = new_buckets[index];
-                new_buckets[index] = &row;
-                elem               = next;
-            }
-        }
-        // free old array
-        algo_lib::malloc_FreeMem(_db.ind_filehash_buckets_elems, old_size);
+        // existing entries stay in the old array and are migrated
+        // a few buckets at a time by subsequent inserts
+        _db.ind_filehash_old_elems = _db.ind_filehash_buckets_elems;
+        _db.ind_filehash_old_n = _db.ind_filehash_buckets_n;
+        _db.ind_filehash_old_pos = 0;
         _db.ind_filehash_buckets_elems = new_buckets;
         _db.ind_filehash_buckets_n = new_nbuckets;
     }
 }
 
+// --- orgfile.FDb.ind_filehash.Rehash
+// Incremental rehash: migrate up to N buckets from old bucket array to new one
+void orgfile::ind_filehash_Rehash(int n) {
+    while (n > 0 && _db.ind_filehash_old_elems) {
+        orgfile::FFilehash* *bucket = &_db.ind_filehash_old_elems[_db.ind_filehash_old_pos];
+        orgfile::FFilehash* elem = *bucket;
+        while (elem) {
+            orgfile::FFilehash &row        = *elem;
+            orgfile::FFilehash* next       = row.ind_filehash_next;
+            u32 index          = Smallstr40_Hash(0, row.filehash) & (_db.ind_filehash_buckets_n - 1);
+            row.ind_filehash_next     = _db.ind_filehash_buckets_elems[index];
+            _db.ind_filehash_buckets_elems[index] = &row;
+            elem               = next;
+        }
+        *bucket = NULL;
+        _db.ind_filehash_old_pos++;
+        n--;
+        if (_db.ind_filehash_old_pos == _db.ind_filehash_old_n) { // done, free old array
+            algo_lib::malloc_FreeMem(_db.ind_filehash_old_elems, _db.ind_filehash_old_n * sizeof(orgfile::FFilehash*));
+            _db.ind_filehash_old_elems = NULL;
+            _db.ind_filehash_old_n = 0;
+            _db.ind_filehash_old_pos = 0;
+        }
+    }
+}
+
 // --- orgfile.FDb.timefmt.Alloc
 // Allocate memory for new default row.
 // If out of memory, process is killed.
@@ -730,6 +834,9 @@ void orgfile::FDb_Init() {
         FatalErrorExit("out of memory"); // (orgfile.FDb.ind_filename)
     }
     memset(_db.ind_filename_buckets_elems, 0, sizeof(orgfile::FFilename*)*_db.ind_filename_buckets_n); // (orgfile.FDb.ind_filename)
+    _db.ind_filename_old_elems 	= NULL; // (orgfile.FDb.ind_filename)
+    _db.ind_filename_old_n     	= 0; // (orgfile.FDb.ind_filename)
+    _db.ind_filename_old_pos   	= 0; // (orgfile.FDb.ind_filename)
     // initialize LAry filehash (orgfile.FDb.filehash)
     _db.filehash_n = 0;
     memset(_db.filehash_lary, 0, sizeof(_db.filehash_lary)); // zero out all level pointers
@@ -749,6 +856,9 @@ void orgfile::FDb_Init() {
         FatalErrorExit("out of memory"); // (orgfile.FDb.ind_filehash)
     }
     memset(_db.ind_filehash_buckets_elems, 0, sizeof(orgfile::FFilehash*)*_db.ind_filehash_buckets_n); // (orgfile.FDb.ind_filehash)
+    _db.ind_filehash_old_elems 	= NULL; // (orgfile.FDb.ind_filehash)
+    _db.ind_filehash_old_n     	= 0; // (orgfile.FDb.ind_filehash)
+    _db.ind_filehash_old_pos   	= 0; // (orgfile.FDb.ind_filehash)
     // initialize LAry timefmt (orgfile.FDb.timefmt)
     _db.timefmt_n = 0;
     memset(_db.timefmt_lary, 0, sizeof(_db.timefmt_lary)); // zero out all level pointers
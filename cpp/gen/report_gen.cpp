@@ -35,9 +35,25 @@ const char* report::value_ToCstr(const report::FieldId& parent) {
         case report_FieldId_n_file_mod     : ret = "n_file_mod";  break;
         case report_FieldId_records        : ret = "records";  break;
         case report_FieldId_errors         : ret = "errors";  break;
+        case report_FieldId_query          : ret = "query";  break;
+        case report_FieldId_n_query        : ret = "n_query";  break;
+        case report_FieldId_n_ctype        : ret = "n_ctype";  break;
+        case report_FieldId_n_index        : ret = "n_index";  break;
+        case report_FieldId_n_scan         : ret = "n_scan";  break;
+        case report_FieldId_n_rec          : ret = "n_rec";  break;
+        case report_FieldId_n_field        : ret = "n_field";  break;
+        case report_FieldId_n_regx         : ret = "n_regx";  break;
+        case report_FieldId_n_xrefrec      : ret = "n_xrefrec";  break;
+        case report_FieldId_n_file         : ret = "n_file";  break;
+        case report_FieldId_n_byte         : ret = "n_byte";  break;
+        case report_FieldId_n_lazyrec      : ret = "n_lazyrec";  break;
+        case report_FieldId_load_time      : ret = "load_time";  break;
+        case report_FieldId_match_time     : ret = "match_time";  break;
+        case report_FieldId_xref_time      : ret = "xref_time";  break;
+        case report_FieldId_print_time     : ret = "print_time";  break;
+        case report_FieldId_write_time     : ret = "write_time";  break;
         case report_FieldId_n_cppfile      : ret = "n_cppfile";  break;
         case report_FieldId_n_cppline      : ret = "n_cppline";  break;
-        case report_FieldId_n_ctype        : ret = "n_ctype";  break;
         case report_FieldId_n_func         : ret = "n_func";  break;
         case report_FieldId_n_xref         : ret = "n_xref";  break;
         case report_FieldId_n_filemod      : ret = "n_filemod";  break;
@@ -51,6 +67,13 @@ const char* report::value_ToCstr(const report::FieldId& parent) {
         case report_FieldId_n_mysteryfunc  : ret = "n_mysteryfunc";  break;
         case report_FieldId_n_baddecl      : ret = "n_baddecl";  break;
         case report_FieldId_comment        : ret = "comment";  break;
+        case report_FieldId_n_hit          : ret = "n_hit";  break;
+        case report_FieldId_n_miss         : ret = "n_miss";  break;
+        case report_FieldId_n_spill        : ret = "n_spill";  break;
+        case report_FieldId_n_drop         : ret = "n_drop";  break;
+        case report_FieldId_pool_bytes     : ret = "pool_bytes";  break;
+        case report_FieldId_peak_bytes     : ret = "peak_bytes";  break;
+        case report_FieldId_max_buf        : ret = "max_buf";  break;
         case report_FieldId_value          : ret = "value";  break;
     }
     return ret;
@@ -91,6 +114,15 @@ bool report::value_SetStrptrMaybe(report::FieldId& parent, algo::strptr rhs) {
                 case LE_STR5('n','_','e','r','r'): {
                     value_SetEnum(parent,report_FieldId_n_err); ret = true; break;
                 }
+                case LE_STR5('n','_','h','i','t'): {
+                    value_SetEnum(parent,report_FieldId_n_hit); ret = true; break;
+                }
+                case LE_STR5('n','_','r','e','c'): {
+                    value_SetEnum(parent,report_FieldId_n_rec); ret = true; break;
+                }
+                case LE_STR5('q','u','e','r','y'): {
+                    value_SetEnum(parent,report_FieldId_query); ret = true; break;
+                }
                 case LE_STR5('v','a','l','u','e'): {
                     value_SetEnum(parent,report_FieldId_value); ret = true; break;
                 }
@@ -102,12 +134,30 @@ bool report::value_SetStrptrMaybe(report::FieldId& parent, algo::strptr rhs) {
                 case LE_STR6('e','r','r','o','r','s'): {
                     value_SetEnum(parent,report_FieldId_errors); ret = true; break;
                 }
+                case LE_STR6('n','_','b','y','t','e'): {
+                    value_SetEnum(parent,report_FieldId_n_byte); ret = true; break;
+                }
+                case LE_STR6('n','_','d','r','o','p'): {
+                    value_SetEnum(parent,report_FieldId_n_drop); ret = true; break;
+                }
+                case LE_STR6('n','_','f','i','l','e'): {
+                    value_SetEnum(parent,report_FieldId_n_file); ret = true; break;
+                }
                 case LE_STR6('n','_','f','u','n','c'): {
                     value_SetEnum(parent,report_FieldId_n_func); ret = true; break;
                 }
                 case LE_STR6('n','_','l','i','n','e'): {
                     value_SetEnum(parent,report_FieldId_n_line); ret = true; break;
                 }
+                case LE_STR6('n','_','m','i','s','s'): {
+                    value_SetEnum(parent,report_FieldId_n_miss); ret = true; break;
+                }
+                case LE_STR6('n','_','r','e','g','x'): {
+                    value_SetEnum(parent,report_FieldId_n_regx); ret = true; break;
+                }
+                case LE_STR6('n','_','s','c','a','n'): {
+                    value_SetEnum(parent,report_FieldId_n_scan); ret = true; break;
+                }
                 case LE_STR6('n','_','w','a','r','n'): {
                     value_SetEnum(parent,report_FieldId_n_warn); ret = true; break;
                 }
@@ -122,9 +172,24 @@ bool report::value_SetStrptrMaybe(report::FieldId& parent, algo::strptr rhs) {
                 case LE_STR7('c','o','m','m','e','n','t'): {
                     value_SetEnum(parent,report_FieldId_comment); ret = true; break;
                 }
+                case LE_STR7('m','a','x','_','b','u','f'): {
+                    value_SetEnum(parent,report_FieldId_max_buf); ret = true; break;
+                }
                 case LE_STR7('n','_','c','t','y','p','e'): {
                     value_SetEnum(parent,report_FieldId_n_ctype); ret = true; break;
                 }
+                case LE_STR7('n','_','f','i','e','l','d'): {
+                    value_SetEnum(parent,report_FieldId_n_field); ret = true; break;
+                }
+                case LE_STR7('n','_','i','n','d','e','x'): {
+                    value_SetEnum(parent,report_FieldId_n_index); ret = true; break;
+                }
+                case LE_STR7('n','_','q','u','e','r','y'): {
+                    value_SetEnum(parent,report_FieldId_n_query); ret = true; break;
+                }
+                case LE_STR7('n','_','s','p','i','l','l'): {
+                    value_SetEnum(parent,report_FieldId_n_spill); ret = true; break;
+                }
                 case LE_STR7('r','e','c','o','r','d','s'): {
                     value_SetEnum(parent,report_FieldId_records); ret = true; break;
                 }
@@ -159,6 +224,10 @@ bool report::value_SetStrptrMaybe(report::FieldId& parent, algo::strptr rhs) {
         }
         case 9: {
             switch (ReadLE64(rhs.elems)) {
+                case LE_STR8('l','o','a','d','_','t','i','m'): {
+                    if (memcmp(rhs.elems+8,"e",1)==0) { value_SetEnum(parent,report_FieldId_load_time); ret = true; break; }
+                    break;
+                }
                 case LE_STR8('n','_','b','a','d','d','e','c'): {
                     if (memcmp(rhs.elems+8,"l",1)==0) { value_SetEnum(parent,report_FieldId_n_baddecl); ret = true; break; }
                     break;
@@ -179,11 +248,27 @@ bool report::value_SetStrptrMaybe(report::FieldId& parent, algo::strptr rhs) {
                     if (memcmp(rhs.elems+8,"l",1)==0) { value_SetEnum(parent,report_FieldId_n_install); ret = true; break; }
                     break;
                 }
+                case LE_STR8('n','_','l','a','z','y','r','e'): {
+                    if (memcmp(rhs.elems+8,"c",1)==0) { value_SetEnum(parent,report_FieldId_n_lazyrec); ret = true; break; }
+                    break;
+                }
+                case LE_STR8('n','_','x','r','e','f','r','e'): {
+                    if (memcmp(rhs.elems+8,"c",1)==0) { value_SetEnum(parent,report_FieldId_n_xrefrec); ret = true; break; }
+                    break;
+                }
+                case LE_STR8('x','r','e','f','_','t','i','m'): {
+                    if (memcmp(rhs.elems+8,"e",1)==0) { value_SetEnum(parent,report_FieldId_xref_time); ret = true; break; }
+                    break;
+                }
             }
             break;
         }
         case 10: {
             switch (ReadLE64(rhs.elems)) {
+                case LE_STR8('m','a','t','c','h','_','t','i'): {
+                    if (memcmp(rhs.elems+8,"me",2)==0) { value_SetEnum(parent,report_FieldId_match_time); ret = true; break; }
+                    break;
+                }
                 case LE_STR8('n','_','f','i','l','e','_','m'): {
                     if (memcmp(rhs.elems+8,"od",2)==0) { value_SetEnum(parent,report_FieldId_n_file_mod); ret = true; break; }
                     break;
@@ -192,6 +277,22 @@ bool report::value_SetStrptrMaybe(report::FieldId& parent, algo::strptr rhs) {
                     if (memcmp(rhs.elems+8,"un",2)==0) { value_SetEnum(parent,report_FieldId_n_test_run); ret = true; break; }
                     break;
                 }
+                case LE_STR8('p','e','a','k','_','b','y','t'): {
+                    if (memcmp(rhs.elems+8,"es",2)==0) { value_SetEnum(parent,report_FieldId_peak_bytes); ret = true; break; }
+                    break;
+                }
+                case LE_STR8('p','o','o','l','_','b','y','t'): {
+                    if (memcmp(rhs.elems+8,"es",2)==0) { value_SetEnum(parent,report_FieldId_pool_bytes); ret = true; break; }
+                    break;
+                }
+                case LE_STR8('p','r','i','n','t','_','t','i'): {
+                    if (memcmp(rhs.elems+8,"me",2)==0) { value_SetEnum(parent,report_FieldId_print_time); ret = true; break; }
+                    break;
+                }
+                case LE_STR8('w','r','i','t','e','_','t','i'): {
+                    if (memcmp(rhs.elems+8,"me",2)==0) { value_SetEnum(parent,report_FieldId_write_time); ret = true; break; }
+                    break;
+                }
             }
             break;
         }
@@ -411,6 +512,128 @@ void report::acr_check_Print(report::acr_check & row, algo::cstring &str) {
     PrintAttrSpaceReset(str,"errors", temp);
 }
 
+// --- report.acr_query..ReadFieldMaybe
+bool report::acr_query_ReadFieldMaybe(report::acr_query &parent, algo::strptr field, algo::strptr strval) {
+    report::FieldId field_id;
+    (void)value_SetStrptrMaybe(field_id,field);
+    bool retval = true; // default is no error
+    switch(field_id) {
+        case report_FieldId_query: retval = algo::cstring_ReadStrptrMaybe(parent.query, strval); break;
+        case report_FieldId_n_query: retval = u32_ReadStrptrMaybe(parent.n_query, strval); break;
+        case report_FieldId_n_ctype: retval = u32_ReadStrptrMaybe(parent.n_ctype, strval); break;
+        case report_FieldId_n_index: retval = u32_ReadStrptrMaybe(parent.n_index, strval); break;
+        case report_FieldId_n_scan: retval = u32_ReadStrptrMaybe(parent.n_scan, strval); break;
+        case report_FieldId_n_rec: retval = u64_ReadStrptrMaybe(parent.n_rec, strval); break;
+        case report_FieldId_n_field: retval = u64_ReadStrptrMaybe(parent.n_field, strval); break;
+        case report_FieldId_n_regx: retval = u64_ReadStrptrMaybe(parent.n_regx, strval); break;
+        case report_FieldId_n_xrefrec: retval = u64_ReadStrptrMaybe(parent.n_xrefrec, strval); break;
+        case report_FieldId_n_file: retval = u32_ReadStrptrMaybe(parent.n_file, strval); break;
+        case report_FieldId_n_byte: retval = u64_ReadStrptrMaybe(parent.n_byte, strval); break;
+        case report_FieldId_n_lazyrec: retval = u64_ReadStrptrMaybe(parent.n_lazyrec, strval); break;
+        case report_FieldId_n_select: retval = u32_ReadStrptrMaybe(parent.n_select, strval); break;
+        case report_FieldId_load_time: retval = algo::UnDiff_ReadStrptrMaybe(parent.load_time, strval); break;
+        case report_FieldId_match_time: retval = algo::UnDiff_ReadStrptrMaybe(parent.match_time, strval); break;
+        case report_FieldId_xref_time: retval = algo::UnDiff_ReadStrptrMaybe(parent.xref_time, strval); break;
+        case report_FieldId_print_time: retval = algo::UnDiff_ReadStrptrMaybe(parent.print_time, strval); break;
+        case report_FieldId_write_time: retval = algo::UnDiff_ReadStrptrMaybe(parent.write_time, strval); break;
+        default: break;
+    }
+    if (!retval) {
+        algo_lib::AppendErrtext("attr",field);
+    }
+    return retval;
+}
+
+// --- report.acr_query..ReadStrptrMaybe
+// Read fields of report::acr_query from an ascii string.
+// The format of the string is an ssim Tuple
+bool report::acr_query_ReadStrptrMaybe(report::acr_query &parent, algo::strptr in_str) {
+    bool retval = true;
+    retval = algo::StripTypeTag(in_str, "report.acr_query");
+    ind_beg(algo::Attr_curs, attr, in_str) {
+        retval = retval && acr_query_ReadFieldMaybe(parent, attr.name, attr.value);
+    }ind_end;
+    return retval;
+}
+
+// --- report.acr_query..Init
+// Set all fields to initial values.
+void report::acr_query_Init(report::acr_query& parent) {
+    parent.n_query = u32(0);
+    parent.n_ctype = u32(0);
+    parent.n_index = u32(0);
+    parent.n_scan = u32(0);
+    parent.n_rec = u64(0);
+    parent.n_field = u64(0);
+    parent.n_regx = u64(0);
+    parent.n_xrefrec = u64(0);
+    parent.n_file = u32(0);
+    parent.n_byte = u64(0);
+    parent.n_lazyrec = u64(0);
+    parent.n_select = u32(0);
+}
+
+// --- report.acr_query..Print
+// print string representation of report::acr_query to string LHS, no header -- cprint:report.acr_query.String
+void report::acr_query_Print(report::acr_query & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "report.acr_query";
+
+    algo::cstring_Print(row.query, temp);
+    PrintAttrSpaceReset(str,"query", temp);
+
+    u32_Print(row.n_query, temp);
+    PrintAttrSpaceReset(str,"n_query", temp);
+
+    u32_Print(row.n_ctype, temp);
+    PrintAttrSpaceReset(str,"n_ctype", temp);
+
+    u32_Print(row.n_index, temp);
+    PrintAttrSpaceReset(str,"n_index", temp);
+
+    u32_Print(row.n_scan, temp);
+    PrintAttrSpaceReset(str,"n_scan", temp);
+
+    u64_Print(row.n_rec, temp);
+    PrintAttrSpaceReset(str,"n_rec", temp);
+
+    u64_Print(row.n_field, temp);
+    PrintAttrSpaceReset(str,"n_field", temp);
+
+    u64_Print(row.n_regx, temp);
+    PrintAttrSpaceReset(str,"n_regx", temp);
+
+    u64_Print(row.n_xrefrec, temp);
+    PrintAttrSpaceReset(str,"n_xrefrec", temp);
+
+    u32_Print(row.n_file, temp);
+    PrintAttrSpaceReset(str,"n_file", temp);
+
+    u64_Print(row.n_byte, temp);
+    PrintAttrSpaceReset(str,"n_byte", temp);
+
+    u64_Print(row.n_lazyrec, temp);
+    PrintAttrSpaceReset(str,"n_lazyrec", temp);
+
+    u32_Print(row.n_select, temp);
+    PrintAttrSpaceReset(str,"n_select", temp);
+
+    algo::UnDiff_Print(row.load_time, temp);
+    PrintAttrSpaceReset(str,"load_time", temp);
+
+    algo::UnDiff_Print(row.match_time, temp);
+    PrintAttrSpaceReset(str,"match_time", temp);
+
+    algo::UnDiff_Print(row.xref_time, temp);
+    PrintAttrSpaceReset(str,"xref_time", temp);
+
+    algo::UnDiff_Print(row.print_time, temp);
+    PrintAttrSpaceReset(str,"print_time", temp);
+
+    algo::UnDiff_Print(row.write_time, temp);
+    PrintAttrSpaceReset(str,"write_time", temp);
+}
+
 // --- report.amc..ReadFieldMaybe
 bool report::amc_ReadFieldMaybe(report::amc &parent, algo::strptr field, algo::strptr strval) {
     report::FieldId field_id;
@@ -586,6 +809,67 @@ void report::src_func_Print(report::src_func & row, algo::cstring &str) {
     PrintAttrSpaceReset(str,"comment", temp);
 }
 
+// --- report.tempstr..ReadFieldMaybe
+bool report::tempstr_ReadFieldMaybe(report::tempstr &parent, algo::strptr field, algo::strptr strval) {
+    report::FieldId field_id;
+    (void)value_SetStrptrMaybe(field_id,field);
+    bool retval = true; // default is no error
+    switch(field_id) {
+        case report_FieldId_n_hit: retval = u64_ReadStrptrMaybe(parent.n_hit, strval); break;
+        case report_FieldId_n_miss: retval = u64_ReadStrptrMaybe(parent.n_miss, strval); break;
+        case report_FieldId_n_spill: retval = u64_ReadStrptrMaybe(parent.n_spill, strval); break;
+        case report_FieldId_n_drop: retval = u64_ReadStrptrMaybe(parent.n_drop, strval); break;
+        case report_FieldId_pool_bytes: retval = u64_ReadStrptrMaybe(parent.pool_bytes, strval); break;
+        case report_FieldId_peak_bytes: retval = u64_ReadStrptrMaybe(parent.peak_bytes, strval); break;
+        case report_FieldId_max_buf: retval = u32_ReadStrptrMaybe(parent.max_buf, strval); break;
+        default: break;
+    }
+    if (!retval) {
+        algo_lib::AppendErrtext("attr",field);
+    }
+    return retval;
+}
+
+// --- report.tempstr..ReadStrptrMaybe
+// Read fields of report::tempstr from an ascii string.
+// The format of the string is an ssim Tuple
+bool report::tempstr_ReadStrptrMaybe(report::tempstr &parent, algo::strptr in_str) {
+    bool retval = true;
+    retval = algo::StripTypeTag(in_str, "report.tempstr");
+    ind_beg(algo::Attr_curs, attr, in_str) {
+        retval = retval && tempstr_ReadFieldMaybe(parent, attr.name, attr.value);
+    }ind_end;
+    return retval;
+}
+
+// --- report.tempstr..Print
+// print string representation of report::tempstr to string LHS, no header -- cprint:report.tempstr.String
+void report::tempstr_Print(report::tempstr & row, algo::cstring &str) {
+    algo::tempstr temp;
+    str << "report.tempstr";
+
+    u64_Print(row.n_hit, temp);
+    PrintAttrSpaceReset(str,"n_hit", temp);
+
+    u64_Print(row.n_miss, temp);
+    PrintAttrSpaceReset(str,"n_miss", temp);
+
+    u64_Print(row.n_spill, temp);
+    PrintAttrSpaceReset(str,"n_spill", temp);
+
+    u64_Print(row.n_drop, temp);
+    PrintAttrSpaceReset(str,"n_drop", temp);
+
+    u64_Print(row.pool_bytes, temp);
+    PrintAttrSpaceReset(str,"pool_bytes", temp);
+
+    u64_Print(row.peak_bytes, temp);
+    PrintAttrSpaceReset(str,"peak_bytes", temp);
+
+    u32_Print(row.max_buf, temp);
+    PrintAttrSpaceReset(str,"max_buf", temp);
+}
+
 // --- report...SizeCheck
 inline static void report::SizeCheck() {
     algo_assert(_offset_of(report::abt,n_target) == 0);
@@ -603,6 +887,25 @@ inline static void report::SizeCheck() {
     algo_assert(_offset_of(report::acr_check,records) == 0);
     algo_assert(_offset_of(report::acr_check,errors) == 4);
     algo_assert(sizeof(report::acr_check) == 8);
+    algo_assert(_offset_of(report::acr_query,query) == 0);
+    algo_assert(_offset_of(report::acr_query,n_query) == 16);
+    algo_assert(_offset_of(report::acr_query,n_ctype) == 20);
+    algo_assert(_offset_of(report::acr_query,n_index) == 24);
+    algo_assert(_offset_of(report::acr_query,n_scan) == 28);
+    algo_assert(_offset_of(report::acr_query,n_rec) == 32);
+    algo_assert(_offset_of(report::acr_query,n_field) == 40);
+    algo_assert(_offset_of(report::acr_query,n_regx) == 48);
+    algo_assert(_offset_of(report::acr_query,n_xrefrec) == 56);
+    algo_assert(_offset_of(report::acr_query,n_file) == 64);
+    algo_assert(_offset_of(report::acr_query,n_byte) == 72);
+    algo_assert(_offset_of(report::acr_query,n_lazyrec) == 80);
+    algo_assert(_offset_of(report::acr_query,n_select) == 88);
+    algo_assert(_offset_of(report::acr_query,load_time) == 92);
+    algo_assert(_offset_of(report::acr_query,match_time) == 100);
+    algo_assert(_offset_of(report::acr_query,xref_time) == 108);
+    algo_assert(_offset_of(report::acr_query,print_time) == 116);
+    algo_assert(_offset_of(report::acr_query,write_time) == 124);
+    algo_assert(sizeof(report::acr_query) == 136);
     algo_assert(_offset_of(report::amc,n_cppfile) == 0);
     algo_assert(_offset_of(report::amc,n_cppline) == 4);
     algo_assert(_offset_of(report::amc,n_ctype) == 8);
@@ -625,4 +928,12 @@ inline static void report::SizeCheck() {
     algo_assert(_offset_of(report::src_func,n_baddecl) == 24);
     algo_assert(_offset_of(report::src_func,comment) == 28);
     algo_assert(sizeof(report::src_func) == 180);
+    algo_assert(_offset_of(report::tempstr,n_hit) == 0);
+    algo_assert(_offset_of(report::tempstr,n_miss) == 8);
+    algo_assert(_offset_of(report::tempstr,n_spill) == 16);
+    algo_assert(_offset_of(report::tempstr,n_drop) == 24);
+    algo_assert(_offset_of(report::tempstr,pool_bytes) == 32);
+    algo_assert(_offset_of(report::tempstr,peak_bytes) == 40);
+    algo_assert(_offset_of(report::tempstr,max_buf) == 48);
+    algo_assert(sizeof(report::tempstr) == 56);
 }
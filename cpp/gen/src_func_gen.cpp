@@ -56,6 +56,10 @@ const char *src_func_help =
 "    -e                    (with -listfunc) Edit found functions. default: false\n"
 "    -verbose              Enable verbose mode\n"
 "    -debug                Enable debug mode\n"
+"    -unbuffered           Disable buffering of output\n"
+"    -snap                 Load inputs from binary snapshots in temp/\n"
+"    -nommap               Read input files instead of mapping them\n"
+"    -linebuf      int     Max. read buffer for piped input. default: 1048576\n"
 "    -version              Show version information\n"
 "    -sig                  Print SHA1 signatures for dispatches\n"
 "    -help                 Print this screen and exit\n"
@@ -321,46 +325,68 @@ bool src_func::InsertStrptrMaybe(algo::strptr str) {
         case src_func_TableId_dev_Targsrc: { // finput:src_func.FDb.targsrc
             dev::Targsrc elem;
             retval = dev::Targsrc_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_func_TableId_dev_Targsrc, &elem, sizeof(elem));
+            }
             retval = retval && targsrc_InputMaybe(elem);
             break;
         }
         case src_func_TableId_dev_Target: { // finput:src_func.FDb.target
             dev::Target elem;
             retval = dev::Target_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_func_TableId_dev_Target, &elem, sizeof(elem));
+            }
             retval = retval && target_InputMaybe(elem);
             break;
         }
         case src_func_TableId_dmmeta_Dispatch: { // finput:src_func.FDb.dispatch
             dmmeta::Dispatch elem;
             retval = dmmeta::Dispatch_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_func_TableId_dmmeta_Dispatch, &elem, sizeof(elem));
+            }
             retval = retval && dispatch_InputMaybe(elem);
             break;
         }
         case src_func_TableId_dmmeta_Fstep: { // finput:src_func.FDb.fstep
             dmmeta::Fstep elem;
             retval = dmmeta::Fstep_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_func_TableId_dmmeta_Fstep, &elem, sizeof(elem));
+            }
             retval = retval && fstep_InputMaybe(elem);
             break;
         }
         case src_func_TableId_dmmeta_Gstatic: { // finput:src_func.FDb.gstatic
             dmmeta::Gstatic elem;
             retval = dmmeta::Gstatic_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_func_TableId_dmmeta_Gstatic, &elem, sizeof(elem));
+            }
             retval = retval && gstatic_InputMaybe(elem);
             break;
         }
         case src_func_TableId_dmmeta_Ctypelen: { // finput:src_func.FDb.ctypelen
             dmmeta::Ctypelen elem;
             retval = dmmeta::Ctypelen_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_func_TableId_dmmeta_Ctypelen, &elem, sizeof(elem));
+            }
             retval = retval && ctypelen_InputMaybe(elem);
             break;
         }
         case src_func_TableId_dev_Badline: { // finput:src_func.FDb.badline
             dev::Badline elem;
             retval = dev::Badline_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_func_TableId_dev_Badline, &elem, sizeof(elem));
+            }
             retval = retval && badline_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -370,6 +396,81 @@ bool src_func::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- src_func.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool src_func::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case src_func_TableId_dev_Targsrc: { // finput:src_func.FDb.targsrc
+            dev::Targsrc elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = targsrc_InputMaybe(elem);
+            }
+            break;
+        }
+        case src_func_TableId_dev_Target: { // finput:src_func.FDb.target
+            dev::Target elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = target_InputMaybe(elem);
+            }
+            break;
+        }
+        case src_func_TableId_dmmeta_Dispatch: { // finput:src_func.FDb.dispatch
+            dmmeta::Dispatch elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = dispatch_InputMaybe(elem);
+            }
+            break;
+        }
+        case src_func_TableId_dmmeta_Fstep: { // finput:src_func.FDb.fstep
+            dmmeta::Fstep elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = fstep_InputMaybe(elem);
+            }
+            break;
+        }
+        case src_func_TableId_dmmeta_Gstatic: { // finput:src_func.FDb.gstatic
+            dmmeta::Gstatic elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = gstatic_InputMaybe(elem);
+            }
+            break;
+        }
+        case src_func_TableId_dmmeta_Ctypelen: { // finput:src_func.FDb.ctypelen
+            dmmeta::Ctypelen elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ctypelen_InputMaybe(elem);
+            }
+            break;
+        }
+        case src_func_TableId_dev_Badline: { // finput:src_func.FDb.badline
+            dev::Badline elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = badline_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- src_func.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool src_func::LoadTuplesMaybe(algo::strptr root) {
@@ -378,7 +479,8 @@ bool src_func::LoadTuplesMaybe(algo::strptr root) {
         "dev.badline", "dmmeta.ctypelen", "dmmeta.dispatch", "dmmeta.fstep"
         , "dev.target", "dev.targsrc", "dmmeta.gstatic"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, src_func::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "src_func", "ed05427e5503605f81d52ef70aa44d1697440397"
+        , src_func::InsertStrptrMaybe, src_func::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -601,7 +703,8 @@ bool src_func::target_XrefMaybe(src_func::FTarget &row) {
 // --- src_func.FDb.ind_target.Find
 // Find row by key. Return NULL if not found.
 src_func::FTarget* src_func::ind_target_Find(const algo::strptr& key) {
-    u32 index = Smallstr16_Hash(0, key) & (_db.ind_target_buckets_n - 1);
+    u32 hash  = Smallstr16_Hash(0, key);
+    u32 index = hash & (_db.ind_target_buckets_n - 1);
     src_func::FTarget* *e = &_db.ind_target_buckets_elems[index];
     src_func::FTarget* ret=NULL;
     do {
@@ -643,7 +746,8 @@ bool src_func::ind_target_InsertMaybe(src_func::FTarget& row) {
     ind_target_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_target_next == (src_func::FTarget*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.target) & (_db.ind_target_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.target);
+        u32 index = hash & (_db.ind_target_buckets_n - 1);
         src_func::FTarget* *prev = &_db.ind_target_buckets_elems[index];
         do {
             src_func::FTarget* ret = *prev;
@@ -669,7 +773,8 @@ bool src_func::ind_target_InsertMaybe(src_func::FTarget& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void src_func::ind_target_Remove(src_func::FTarget& row) {
     if (LIKELY(row.ind_target_next != (src_func::FTarget*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.target) & (_db.ind_target_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.target);
+        u32 index = hash & (_db.ind_target_buckets_n - 1);
         src_func::FTarget* *prev = &_db.ind_target_buckets_elems[index]; // addr of pointer to current element
         while (src_func::FTarget *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -821,7 +926,8 @@ bool src_func::func_XrefMaybe(src_func::FFunc &row) {
 // --- src_func.FDb.ind_func.Find
 // Find row by key. Return NULL if not found.
 src_func::FFunc* src_func::ind_func_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_func_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_func_buckets_n - 1);
     src_func::FFunc* *e = &_db.ind_func_buckets_elems[index];
     src_func::FFunc* ret=NULL;
     do {
@@ -847,7 +953,8 @@ bool src_func::ind_func_InsertMaybe(src_func::FFunc& row) {
     ind_func_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_func_next == (src_func::FFunc*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.func) & (_db.ind_func_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.func);
+        u32 index = hash & (_db.ind_func_buckets_n - 1);
         src_func::FFunc* *prev = &_db.ind_func_buckets_elems[index];
         do {
             src_func::FFunc* ret = *prev;
@@ -873,7 +980,8 @@ bool src_func::ind_func_InsertMaybe(src_func::FFunc& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void src_func::ind_func_Remove(src_func::FFunc& row) {
     if (LIKELY(row.ind_func_next != (src_func::FFunc*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.func) & (_db.ind_func_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.func);
+        u32 index = hash & (_db.ind_func_buckets_n - 1);
         src_func::FFunc* *prev = &_db.ind_func_buckets_elems[index]; // addr of pointer to current element
         while (src_func::FFunc *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1395,7 +1503,8 @@ bool src_func::gstatic_XrefMaybe(src_func::FGstatic &row) {
 // --- src_func.FDb.ind_genprefix.Find
 // Find row by key. Return NULL if not found.
 src_func::FGenprefix* src_func::ind_genprefix_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_genprefix_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_genprefix_buckets_n - 1);
     src_func::FGenprefix* *e = &_db.ind_genprefix_buckets_elems[index];
     src_func::FGenprefix* ret=NULL;
     do {
@@ -1437,7 +1546,8 @@ bool src_func::ind_genprefix_InsertMaybe(src_func::FGenprefix& row) {
     ind_genprefix_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_genprefix_next == (src_func::FGenprefix*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.genprefix) & (_db.ind_genprefix_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.genprefix);
+        u32 index = hash & (_db.ind_genprefix_buckets_n - 1);
         src_func::FGenprefix* *prev = &_db.ind_genprefix_buckets_elems[index];
         do {
             src_func::FGenprefix* ret = *prev;
@@ -1463,7 +1573,8 @@ bool src_func::ind_genprefix_InsertMaybe(src_func::FGenprefix& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void src_func::ind_genprefix_Remove(src_func::FGenprefix& row) {
     if (LIKELY(row.ind_genprefix_next != (src_func::FGenprefix*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.genprefix) & (_db.ind_genprefix_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.genprefix);
+        u32 index = hash & (_db.ind_genprefix_buckets_n - 1);
         src_func::FGenprefix* *prev = &_db.ind_genprefix_buckets_elems[index]; // addr of pointer to current element
         while (src_func::FGenprefix *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1623,7 +1734,8 @@ bool src_func::ctypelen_XrefMaybe(src_func::FCtypelen &row) {
 // --- src_func.FDb.ind_ctypelen.Find
 // Find row by key. Return NULL if not found.
 src_func::FCtypelen* src_func::ind_ctypelen_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ctypelen_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ctypelen_buckets_n - 1);
     src_func::FCtypelen* *e = &_db.ind_ctypelen_buckets_elems[index];
     src_func::FCtypelen* ret=NULL;
     do {
@@ -1665,7 +1777,8 @@ bool src_func::ind_ctypelen_InsertMaybe(src_func::FCtypelen& row) {
     ind_ctypelen_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ctypelen_next == (src_func::FCtypelen*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctypelen_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctypelen_buckets_n - 1);
         src_func::FCtypelen* *prev = &_db.ind_ctypelen_buckets_elems[index];
         do {
             src_func::FCtypelen* ret = *prev;
@@ -1691,7 +1804,8 @@ bool src_func::ind_ctypelen_InsertMaybe(src_func::FCtypelen& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void src_func::ind_ctypelen_Remove(src_func::FCtypelen& row) {
     if (LIKELY(row.ind_ctypelen_next != (src_func::FCtypelen*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctypelen_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctypelen_buckets_n - 1);
         src_func::FCtypelen* *prev = &_db.ind_ctypelen_buckets_elems[index]; // addr of pointer to current element
         while (src_func::FCtypelen *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1851,7 +1965,8 @@ bool src_func::badline_XrefMaybe(src_func::FBadline &row) {
 // --- src_func.FDb.ind_badline.Find
 // Find row by key. Return NULL if not found.
 src_func::FBadline* src_func::ind_badline_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_badline_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_badline_buckets_n - 1);
     src_func::FBadline* *e = &_db.ind_badline_buckets_elems[index];
     src_func::FBadline* ret=NULL;
     do {
@@ -1893,7 +2008,8 @@ bool src_func::ind_badline_InsertMaybe(src_func::FBadline& row) {
     ind_badline_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_badline_next == (src_func::FBadline*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.badline) & (_db.ind_badline_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.badline);
+        u32 index = hash & (_db.ind_badline_buckets_n - 1);
         src_func::FBadline* *prev = &_db.ind_badline_buckets_elems[index];
         do {
             src_func::FBadline* ret = *prev;
@@ -1919,7 +2035,8 @@ bool src_func::ind_badline_InsertMaybe(src_func::FBadline& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void src_func::ind_badline_Remove(src_func::FBadline& row) {
     if (LIKELY(row.ind_badline_next != (src_func::FBadline*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.badline) & (_db.ind_badline_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.badline);
+        u32 index = hash & (_db.ind_badline_buckets_n - 1);
         src_func::FBadline* *prev = &_db.ind_badline_buckets_elems[index]; // addr of pointer to current element
         while (src_func::FBadline *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -40,6 +40,10 @@ const char *src_hdr_help =
 "    -indent                  Indent source files. default: false\n"
 "    -verbose                 Enable verbose mode\n"
 "    -debug                   Enable debug mode\n"
+"    -unbuffered              Disable buffering of output\n"
+"    -snap                    Load inputs from binary snapshots in temp/\n"
+"    -nommap                  Read input files instead of mapping them\n"
+"    -linebuf         int     Max. read buffer for piped input. default: 1048576\n"
 "    -version                 Show version information\n"
 "    -sig                     Print SHA1 signatures for dispatches\n"
 "    -help                    Print this screen and exit\n"
@@ -138,22 +142,32 @@ bool src_hdr::InsertStrptrMaybe(algo::strptr str) {
         case src_hdr_TableId_dev_Targsrc: { // finput:src_hdr.FDb.targsrc
             dev::Targsrc elem;
             retval = dev::Targsrc_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_hdr_TableId_dev_Targsrc, &elem, sizeof(elem));
+            }
             retval = retval && targsrc_InputMaybe(elem);
             break;
         }
         case src_hdr_TableId_dmmeta_Ns: { // finput:src_hdr.FDb.ns
             dmmeta::Ns elem;
             retval = dmmeta::Ns_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_hdr_TableId_dmmeta_Ns, &elem, sizeof(elem));
+            }
             retval = retval && ns_InputMaybe(elem);
             break;
         }
         case src_hdr_TableId_dmmeta_Nsx: { // finput:src_hdr.FDb.nsx
             dmmeta::Nsx elem;
             retval = dmmeta::Nsx_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_hdr_TableId_dmmeta_Nsx, &elem, sizeof(elem));
+            }
             retval = retval && nsx_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -163,6 +177,45 @@ bool src_hdr::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- src_hdr.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool src_hdr::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case src_hdr_TableId_dev_Targsrc: { // finput:src_hdr.FDb.targsrc
+            dev::Targsrc elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = targsrc_InputMaybe(elem);
+            }
+            break;
+        }
+        case src_hdr_TableId_dmmeta_Ns: { // finput:src_hdr.FDb.ns
+            dmmeta::Ns elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ns_InputMaybe(elem);
+            }
+            break;
+        }
+        case src_hdr_TableId_dmmeta_Nsx: { // finput:src_hdr.FDb.nsx
+            dmmeta::Nsx elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = nsx_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- src_hdr.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool src_hdr::LoadTuplesMaybe(algo::strptr root) {
@@ -170,7 +223,8 @@ bool src_hdr::LoadTuplesMaybe(algo::strptr root) {
     static const char *ssimfiles[] = {
         "dmmeta.ns", "dmmeta.nsx", "dev.targsrc"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, src_hdr::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "src_hdr", "a1e7264997d8d742fc7b03d291e743493427663b"
+        , src_hdr::InsertStrptrMaybe, src_hdr::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -393,7 +447,8 @@ bool src_hdr::ns_XrefMaybe(src_hdr::FNs &row) {
 // --- src_hdr.FDb.ind_ns.Find
 // Find row by key. Return NULL if not found.
 src_hdr::FNs* src_hdr::ind_ns_Find(const algo::strptr& key) {
-    u32 index = Smallstr16_Hash(0, key) & (_db.ind_ns_buckets_n - 1);
+    u32 hash  = Smallstr16_Hash(0, key);
+    u32 index = hash & (_db.ind_ns_buckets_n - 1);
     src_hdr::FNs* *e = &_db.ind_ns_buckets_elems[index];
     src_hdr::FNs* ret=NULL;
     do {
@@ -435,7 +490,8 @@ bool src_hdr::ind_ns_InsertMaybe(src_hdr::FNs& row) {
     ind_ns_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ns_next == (src_hdr::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         src_hdr::FNs* *prev = &_db.ind_ns_buckets_elems[index];
         do {
             src_hdr::FNs* ret = *prev;
@@ -461,7 +517,8 @@ bool src_hdr::ind_ns_InsertMaybe(src_hdr::FNs& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void src_hdr::ind_ns_Remove(src_hdr::FNs& row) {
     if (LIKELY(row.ind_ns_next != (src_hdr::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         src_hdr::FNs* *prev = &_db.ind_ns_buckets_elems[index]; // addr of pointer to current element
         while (src_hdr::FNs *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -31,17 +31,21 @@ namespace src_lim {
 const char *src_lim_help =
 "src_lim: Enforce line length, function length, and indentation limits\n"
 "Usage: src_lim [options]\n"
-"    -in         string  Input directory or filename, - for stdin. default: \"data\"\n"
-"    -linelim            Check various file limits (line length, function length, etc). default: false\n"
-"    -srcfile    string  Filter for source files to process. default: \"%\"\n"
-"    -strayfile          Check for unregistered source files. default: false\n"
-"    -capture            Generate new dev.linelim records. default: false\n"
-"    -write              Update ssim database (with -capture). default: false\n"
-"    -verbose            Enable verbose mode\n"
-"    -debug              Enable debug mode\n"
-"    -version            Show version information\n"
-"    -sig                Print SHA1 signatures for dispatches\n"
-"    -help               Print this screen and exit\n"
+"    -in          string  Input directory or filename, - for stdin. default: \"data\"\n"
+"    -linelim             Check various file limits (line length, function length, etc). default: false\n"
+"    -srcfile     string  Filter for source files to process. default: \"%\"\n"
+"    -strayfile           Check for unregistered source files. default: false\n"
+"    -capture             Generate new dev.linelim records. default: false\n"
+"    -write               Update ssim database (with -capture). default: false\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -329,6 +333,9 @@ bool src_lim::InsertStrptrMaybe(algo::strptr str) {
         case src_lim_TableId_dev_Include: { // finput:src_lim.FDb.include
             dev::Include elem;
             retval = dev::Include_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_lim_TableId_dev_Include, &elem, sizeof(elem));
+            }
             retval = retval && include_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -336,6 +343,9 @@ bool src_lim::InsertStrptrMaybe(algo::strptr str) {
         case src_lim_TableId_dev_Linelim: { // finput:src_lim.FDb.linelim
             dev::Linelim elem;
             retval = dev::Linelim_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_lim_TableId_dev_Linelim, &elem, sizeof(elem));
+            }
             retval = retval && linelim_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -343,6 +353,9 @@ bool src_lim::InsertStrptrMaybe(algo::strptr str) {
         case src_lim_TableId_dev_Targsrc: { // finput:src_lim.FDb.targsrc
             dev::Targsrc elem;
             retval = dev::Targsrc_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_lim_TableId_dev_Targsrc, &elem, sizeof(elem));
+            }
             retval = retval && targsrc_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
@@ -350,11 +363,15 @@ bool src_lim::InsertStrptrMaybe(algo::strptr str) {
         case src_lim_TableId_dev_Gitfile: { // finput:src_lim.FDb.gitfile
             dev::Gitfile elem;
             retval = dev::Gitfile_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(src_lim_TableId_dev_Gitfile, &elem, sizeof(elem));
+            }
             retval = retval && gitfile_InputMaybe(elem);
             retval = true; // finput strict:N
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -364,6 +381,58 @@ bool src_lim::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- src_lim.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool src_lim::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case src_lim_TableId_dev_Include: { // finput:src_lim.FDb.include
+            dev::Include elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = include_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case src_lim_TableId_dev_Linelim: { // finput:src_lim.FDb.linelim
+            dev::Linelim elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = linelim_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case src_lim_TableId_dev_Targsrc: { // finput:src_lim.FDb.targsrc
+            dev::Targsrc elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = targsrc_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        case src_lim_TableId_dev_Gitfile: { // finput:src_lim.FDb.gitfile
+            dev::Gitfile elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = gitfile_InputMaybe(elem);
+                retval = true; // finput strict:N
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- src_lim.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool src_lim::LoadTuplesMaybe(algo::strptr root) {
@@ -371,7 +440,8 @@ bool src_lim::LoadTuplesMaybe(algo::strptr root) {
     static const char *ssimfiles[] = {
         "dev.gitfile", "dev.linelim", "dev.targsrc"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, src_lim::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "src_lim", "4d68024a255bb013457d44262892315524185d24"
+        , src_lim::InsertStrptrMaybe, src_lim::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -599,7 +669,8 @@ bool src_lim::gitfile_XrefMaybe(src_lim::FGitfile &row) {
 // --- src_lim.FDb.ind_gitfile.Find
 // Find row by key. Return NULL if not found.
 src_lim::FGitfile* src_lim::ind_gitfile_Find(const algo::strptr& key) {
-    u32 index = Smallstr200_Hash(0, key) & (_db.ind_gitfile_buckets_n - 1);
+    u32 hash  = Smallstr200_Hash(0, key);
+    u32 index = hash & (_db.ind_gitfile_buckets_n - 1);
     src_lim::FGitfile* *e = &_db.ind_gitfile_buckets_elems[index];
     src_lim::FGitfile* ret=NULL;
     do {
@@ -641,7 +712,8 @@ bool src_lim::ind_gitfile_InsertMaybe(src_lim::FGitfile& row) {
     ind_gitfile_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_gitfile_next == (src_lim::FGitfile*)-1)) {// check if in hash already
-        u32 index = Smallstr200_Hash(0, row.gitfile) & (_db.ind_gitfile_buckets_n - 1);
+        u32 hash  = Smallstr200_Hash(0, row.gitfile);
+        u32 index = hash & (_db.ind_gitfile_buckets_n - 1);
         src_lim::FGitfile* *prev = &_db.ind_gitfile_buckets_elems[index];
         do {
             src_lim::FGitfile* ret = *prev;
@@ -667,7 +739,8 @@ bool src_lim::ind_gitfile_InsertMaybe(src_lim::FGitfile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void src_lim::ind_gitfile_Remove(src_lim::FGitfile& row) {
     if (LIKELY(row.ind_gitfile_next != (src_lim::FGitfile*)-1)) {// check if in hash already
-        u32 index = Smallstr200_Hash(0, row.gitfile) & (_db.ind_gitfile_buckets_n - 1);
+        u32 hash  = Smallstr200_Hash(0, row.gitfile);
+        u32 index = hash & (_db.ind_gitfile_buckets_n - 1);
         src_lim::FGitfile* *prev = &_db.ind_gitfile_buckets_elems[index]; // addr of pointer to current element
         while (src_lim::FGitfile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
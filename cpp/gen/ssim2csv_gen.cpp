@@ -33,6 +33,10 @@ const char *ssim2csv_help =
 "    -ignoreQuote          . default: false\n"
 "    -verbose              Enable verbose mode\n"
 "    -debug                Enable debug mode\n"
+"    -unbuffered           Disable buffering of output\n"
+"    -snap                 Load inputs from binary snapshots in temp/\n"
+"    -nommap               Read input files instead of mapping them\n"
+"    -linebuf      int     Max. read buffer for piped input. default: 1048576\n"
 "    -version              Show version information\n"
 "    -sig                  Print SHA1 signatures for dispatches\n"
 "    -help                 Print this screen and exit\n"
@@ -235,7 +239,8 @@ bool ssim2csv::expand_XrefMaybe(ssim2csv::FExpand &row) {
 // --- ssim2csv.FDb.ind_expand.Find
 // Find row by key. Return NULL if not found.
 ssim2csv::FExpand* ssim2csv::ind_expand_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_expand_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_expand_buckets_n - 1);
     ssim2csv::FExpand* *e = &_db.ind_expand_buckets_elems[index];
     ssim2csv::FExpand* ret=NULL;
     do {
@@ -277,7 +282,8 @@ bool ssim2csv::ind_expand_InsertMaybe(ssim2csv::FExpand& row) {
     ind_expand_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_expand_next == (ssim2csv::FExpand*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.expand) & (_db.ind_expand_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.expand);
+        u32 index = hash & (_db.ind_expand_buckets_n - 1);
         ssim2csv::FExpand* *prev = &_db.ind_expand_buckets_elems[index];
         do {
             ssim2csv::FExpand* ret = *prev;
@@ -303,7 +309,8 @@ bool ssim2csv::ind_expand_InsertMaybe(ssim2csv::FExpand& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void ssim2csv::ind_expand_Remove(ssim2csv::FExpand& row) {
     if (LIKELY(row.ind_expand_next != (ssim2csv::FExpand*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.expand) & (_db.ind_expand_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.expand);
+        u32 index = hash & (_db.ind_expand_buckets_n - 1);
         ssim2csv::FExpand* *prev = &_db.ind_expand_buckets_elems[index]; // addr of pointer to current element
         while (ssim2csv::FExpand *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -442,7 +449,8 @@ bool ssim2csv::outfile_XrefMaybe(ssim2csv::FOutfile &row) {
 // --- ssim2csv.FDb.ind_outfile.Find
 // Find row by key. Return NULL if not found.
 ssim2csv::FOutfile* ssim2csv::ind_outfile_Find(const algo::strptr& key) {
-    u32 index = cstring_Hash(0, key) & (_db.ind_outfile_buckets_n - 1);
+    u32 hash  = cstring_Hash(0, key);
+    u32 index = hash & (_db.ind_outfile_buckets_n - 1);
     ssim2csv::FOutfile* *e = &_db.ind_outfile_buckets_elems[index];
     ssim2csv::FOutfile* ret=NULL;
     do {
@@ -484,7 +492,8 @@ bool ssim2csv::ind_outfile_InsertMaybe(ssim2csv::FOutfile& row) {
     ind_outfile_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_outfile_next == (ssim2csv::FOutfile*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.outfile) & (_db.ind_outfile_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.outfile);
+        u32 index = hash & (_db.ind_outfile_buckets_n - 1);
         ssim2csv::FOutfile* *prev = &_db.ind_outfile_buckets_elems[index];
         do {
             ssim2csv::FOutfile* ret = *prev;
@@ -510,7 +519,8 @@ bool ssim2csv::ind_outfile_InsertMaybe(ssim2csv::FOutfile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void ssim2csv::ind_outfile_Remove(ssim2csv::FOutfile& row) {
     if (LIKELY(row.ind_outfile_next != (ssim2csv::FOutfile*)-1)) {// check if in hash already
-        u32 index = cstring_Hash(0, row.outfile) & (_db.ind_outfile_buckets_n - 1);
+        u32 hash  = cstring_Hash(0, row.outfile);
+        u32 index = hash & (_db.ind_outfile_buckets_n - 1);
         ssim2csv::FOutfile* *prev = &_db.ind_outfile_buckets_elems[index]; // addr of pointer to current element
         while (ssim2csv::FOutfile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
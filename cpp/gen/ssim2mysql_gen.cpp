@@ -34,22 +34,26 @@ namespace ssim2mysql {
 const char *ssim2mysql_help =
 "ssim2mysql: Ssim -> mysql\n"
 "Usage: ssim2mysql [options]\n"
-"    -url        string  URL of mysql server. user:pass@hostb or sock://filename; Empty -> stdout\n"
-"    -data_dir   string  Load dmmeta info from this directory. default: \"data\"\n"
-"    -maxpacket  int     Max Mysql packet size. default: 100000\n"
-"    -replace            use REPLACE INTO instead of INSERT INTO. default: true\n"
-"    -trunc              Truncate target table. default: false\n"
-"    -dry_run            Print SQL commands to the stdout. default: false\n"
-"    -fldfunc            create columns for fldfuncs. default: false\n"
-"    -in         string  Input directory or filename, - for stdin. default: \"-\"\n"
-"    -db         string  Optional database name\n"
-"    -createdb           Emit CREATE DATABASE code for namespace specified with <db>. default: false\n"
-"    -fkey               Enable foreign key constraints (uses InnoDB storage engine). default: false\n"
-"    -verbose            Enable verbose mode\n"
-"    -debug              Enable debug mode\n"
-"    -version            Show version information\n"
-"    -sig                Print SHA1 signatures for dispatches\n"
-"    -help               Print this screen and exit\n"
+"    -url         string  URL of mysql server. user:pass@hostb or sock://filename; Empty -> stdout\n"
+"    -data_dir    string  Load dmmeta info from this directory. default: \"data\"\n"
+"    -maxpacket   int     Max Mysql packet size. default: 100000\n"
+"    -replace             use REPLACE INTO instead of INSERT INTO. default: true\n"
+"    -trunc               Truncate target table. default: false\n"
+"    -dry_run             Print SQL commands to the stdout. default: false\n"
+"    -fldfunc             create columns for fldfuncs. default: false\n"
+"    -in          string  Input directory or filename, - for stdin. default: \"-\"\n"
+"    -db          string  Optional database name\n"
+"    -createdb            Emit CREATE DATABASE code for namespace specified with <db>. default: false\n"
+"    -fkey                Enable foreign key constraints (uses InnoDB storage engine). default: false\n"
+"    -verbose             Enable verbose mode\n"
+"    -debug               Enable debug mode\n"
+"    -unbuffered          Disable buffering of output\n"
+"    -snap                Load inputs from binary snapshots in temp/\n"
+"    -nommap              Read input files instead of mapping them\n"
+"    -linebuf     int     Max. read buffer for piped input. default: 1048576\n"
+"    -version             Show version information\n"
+"    -sig                 Print SHA1 signatures for dispatches\n"
+"    -help                Print this screen and exit\n"
 ;
 
 
@@ -298,7 +302,8 @@ void ssim2mysql::trace_Print(ssim2mysql::trace & row, algo::cstring &str) {
 // --- ssim2mysql.FDb.ind_column.Find
 // Find row by key. Return NULL if not found.
 ssim2mysql::FColumn* ssim2mysql::ind_column_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_column_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_column_buckets_n - 1);
     ssim2mysql::FColumn* *e = &_db.ind_column_buckets_elems[index];
     ssim2mysql::FColumn* ret=NULL;
     do {
@@ -340,7 +345,8 @@ bool ssim2mysql::ind_column_InsertMaybe(ssim2mysql::FColumn& row) {
     ind_column_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_column_next == (ssim2mysql::FColumn*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.column) & (_db.ind_column_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.column);
+        u32 index = hash & (_db.ind_column_buckets_n - 1);
         ssim2mysql::FColumn* *prev = &_db.ind_column_buckets_elems[index];
         do {
             ssim2mysql::FColumn* ret = *prev;
@@ -366,7 +372,8 @@ bool ssim2mysql::ind_column_InsertMaybe(ssim2mysql::FColumn& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void ssim2mysql::ind_column_Remove(ssim2mysql::FColumn& row) {
     if (LIKELY(row.ind_column_next != (ssim2mysql::FColumn*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.column) & (_db.ind_column_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.column);
+        u32 index = hash & (_db.ind_column_buckets_n - 1);
         ssim2mysql::FColumn* *prev = &_db.ind_column_buckets_elems[index]; // addr of pointer to current element
         while (ssim2mysql::FColumn *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1101,40 +1108,59 @@ bool ssim2mysql::InsertStrptrMaybe(algo::strptr str) {
         case ssim2mysql_TableId_dmmeta_Ns: { // finput:ssim2mysql.FDb.ns
             dmmeta::Ns elem;
             retval = dmmeta::Ns_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(ssim2mysql_TableId_dmmeta_Ns, &elem, sizeof(elem));
+            }
             retval = retval && ns_InputMaybe(elem);
             break;
         }
         case ssim2mysql_TableId_dmmeta_Ctype: { // finput:ssim2mysql.FDb.ctype
             dmmeta::Ctype elem;
             retval = dmmeta::Ctype_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(ssim2mysql_TableId_dmmeta_Ctype, &elem, sizeof(elem));
+            }
             retval = retval && ctype_InputMaybe(elem);
             break;
         }
         case ssim2mysql_TableId_dmmeta_Field: { // finput:ssim2mysql.FDb.field
             dmmeta::Field elem;
             retval = dmmeta::Field_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(ssim2mysql_TableId_dmmeta_Field, &elem, sizeof(elem));
+            }
             retval = retval && field_InputMaybe(elem);
             break;
         }
         case ssim2mysql_TableId_dmmeta_Sqltype: { // finput:ssim2mysql.FDb.sqltype
             dmmeta::Sqltype elem;
             retval = dmmeta::Sqltype_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(ssim2mysql_TableId_dmmeta_Sqltype, &elem, sizeof(elem));
+            }
             retval = retval && sqltype_InputMaybe(elem);
             break;
         }
         case ssim2mysql_TableId_dmmeta_Substr: { // finput:ssim2mysql.FDb.substr
             dmmeta::Substr elem;
             retval = dmmeta::Substr_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(ssim2mysql_TableId_dmmeta_Substr, &elem, sizeof(elem));
+            }
             retval = retval && substr_InputMaybe(elem);
             break;
         }
         case ssim2mysql_TableId_dmmeta_Ssimfile: { // finput:ssim2mysql.FDb.ssimfile
             dmmeta::Ssimfile elem;
             retval = dmmeta::Ssimfile_ReadStrptrMaybe(elem, str);
+            if (retval && algo_lib::_db.snap_rec) {
+                algo_lib::SnapRecord(ssim2mysql_TableId_dmmeta_Ssimfile, &elem, sizeof(elem));
+            }
             retval = retval && ssimfile_InputMaybe(elem);
             break;
         }
         default:
+        algo_lib::_db.snap_rec = false; // tuple cannot be recorded
         retval = algo_lib::InsertStrptrMaybe(str);
         break;
     } //switch
@@ -1144,6 +1170,72 @@ bool ssim2mysql::InsertStrptrMaybe(algo::strptr str) {
     return retval;
 }
 
+// --- ssim2mysql.FDb._db.InsertSnapMaybe
+// Insert row image from binary input snapshot.
+bool ssim2mysql::InsertSnapMaybe(i32 table_id, algo::memptr row) {
+    bool retval = true;
+    switch (table_id) {
+        case ssim2mysql_TableId_dmmeta_Ns: { // finput:ssim2mysql.FDb.ns
+            dmmeta::Ns elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ns_InputMaybe(elem);
+            }
+            break;
+        }
+        case ssim2mysql_TableId_dmmeta_Ctype: { // finput:ssim2mysql.FDb.ctype
+            dmmeta::Ctype elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ctype_InputMaybe(elem);
+            }
+            break;
+        }
+        case ssim2mysql_TableId_dmmeta_Field: { // finput:ssim2mysql.FDb.field
+            dmmeta::Field elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = field_InputMaybe(elem);
+            }
+            break;
+        }
+        case ssim2mysql_TableId_dmmeta_Sqltype: { // finput:ssim2mysql.FDb.sqltype
+            dmmeta::Sqltype elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = sqltype_InputMaybe(elem);
+            }
+            break;
+        }
+        case ssim2mysql_TableId_dmmeta_Substr: { // finput:ssim2mysql.FDb.substr
+            dmmeta::Substr elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = substr_InputMaybe(elem);
+            }
+            break;
+        }
+        case ssim2mysql_TableId_dmmeta_Ssimfile: { // finput:ssim2mysql.FDb.ssimfile
+            dmmeta::Ssimfile elem;
+            retval = elems_N(row) == i32(sizeof(elem));
+            if (retval) {
+                memcpy((void*)&elem, row.elems, sizeof(elem));
+                retval = ssimfile_InputMaybe(elem);
+            }
+            break;
+        }
+        default:
+        retval = false;
+        break;
+    } //switch
+    return retval;
+}
+
 // --- ssim2mysql.FDb._db.LoadTuplesMaybe
 // Load all finputs from given directory.
 bool ssim2mysql::LoadTuplesMaybe(algo::strptr root) {
@@ -1152,7 +1244,8 @@ bool ssim2mysql::LoadTuplesMaybe(algo::strptr root) {
         "dmmeta.ns", "dmmeta.ctype", "dmmeta.ssimfile", "dmmeta.field"
         , "dmmeta.sqltype", "dmmeta.substr"
         , NULL};
-        retval = algo_lib::DoLoadTuples(root, ssim2mysql::InsertStrptrMaybe, ssimfiles, true);
+        retval = algo_lib::DoLoadTuplesSnap(root, "ssim2mysql", "7abba95113c0af13de74ea1e2904b75056b22891"
+        , ssim2mysql::InsertStrptrMaybe, ssim2mysql::InsertSnapMaybe, ssimfiles, true);
         return retval;
 }
 
@@ -1177,7 +1270,8 @@ bool ssim2mysql::_db_XrefMaybe() {
 // --- ssim2mysql.FDb.ind_ns.Find
 // Find row by key. Return NULL if not found.
 ssim2mysql::FNs* ssim2mysql::ind_ns_Find(const algo::strptr& key) {
-    u32 index = Smallstr16_Hash(0, key) & (_db.ind_ns_buckets_n - 1);
+    u32 hash  = Smallstr16_Hash(0, key);
+    u32 index = hash & (_db.ind_ns_buckets_n - 1);
     ssim2mysql::FNs* *e = &_db.ind_ns_buckets_elems[index];
     ssim2mysql::FNs* ret=NULL;
     do {
@@ -1219,7 +1313,8 @@ bool ssim2mysql::ind_ns_InsertMaybe(ssim2mysql::FNs& row) {
     ind_ns_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ns_next == (ssim2mysql::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         ssim2mysql::FNs* *prev = &_db.ind_ns_buckets_elems[index];
         do {
             ssim2mysql::FNs* ret = *prev;
@@ -1245,7 +1340,8 @@ bool ssim2mysql::ind_ns_InsertMaybe(ssim2mysql::FNs& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void ssim2mysql::ind_ns_Remove(ssim2mysql::FNs& row) {
     if (LIKELY(row.ind_ns_next != (ssim2mysql::FNs*)-1)) {// check if in hash already
-        u32 index = Smallstr16_Hash(0, row.ns) & (_db.ind_ns_buckets_n - 1);
+        u32 hash  = Smallstr16_Hash(0, row.ns);
+        u32 index = hash & (_db.ind_ns_buckets_n - 1);
         ssim2mysql::FNs* *prev = &_db.ind_ns_buckets_elems[index]; // addr of pointer to current element
         while (ssim2mysql::FNs *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1298,7 +1394,8 @@ void ssim2mysql::ind_ns_Reserve(int n) {
 // --- ssim2mysql.FDb.ind_ctype.Find
 // Find row by key. Return NULL if not found.
 ssim2mysql::FCtype* ssim2mysql::ind_ctype_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ctype_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ctype_buckets_n - 1);
     ssim2mysql::FCtype* *e = &_db.ind_ctype_buckets_elems[index];
     ssim2mysql::FCtype* ret=NULL;
     do {
@@ -1340,7 +1437,8 @@ bool ssim2mysql::ind_ctype_InsertMaybe(ssim2mysql::FCtype& row) {
     ind_ctype_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ctype_next == (ssim2mysql::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         ssim2mysql::FCtype* *prev = &_db.ind_ctype_buckets_elems[index];
         do {
             ssim2mysql::FCtype* ret = *prev;
@@ -1366,7 +1464,8 @@ bool ssim2mysql::ind_ctype_InsertMaybe(ssim2mysql::FCtype& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void ssim2mysql::ind_ctype_Remove(ssim2mysql::FCtype& row) {
     if (LIKELY(row.ind_ctype_next != (ssim2mysql::FCtype*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ctype) & (_db.ind_ctype_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ctype);
+        u32 index = hash & (_db.ind_ctype_buckets_n - 1);
         ssim2mysql::FCtype* *prev = &_db.ind_ctype_buckets_elems[index]; // addr of pointer to current element
         while (ssim2mysql::FCtype *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1419,7 +1518,8 @@ void ssim2mysql::ind_ctype_Reserve(int n) {
 // --- ssim2mysql.FDb.ind_field.Find
 // Find row by key. Return NULL if not found.
 ssim2mysql::FField* ssim2mysql::ind_field_Find(const algo::strptr& key) {
-    u32 index = Smallstr100_Hash(0, key) & (_db.ind_field_buckets_n - 1);
+    u32 hash  = Smallstr100_Hash(0, key);
+    u32 index = hash & (_db.ind_field_buckets_n - 1);
     ssim2mysql::FField* *e = &_db.ind_field_buckets_elems[index];
     ssim2mysql::FField* ret=NULL;
     do {
@@ -1461,7 +1561,8 @@ bool ssim2mysql::ind_field_InsertMaybe(ssim2mysql::FField& row) {
     ind_field_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_field_next == (ssim2mysql::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         ssim2mysql::FField* *prev = &_db.ind_field_buckets_elems[index];
         do {
             ssim2mysql::FField* ret = *prev;
@@ -1487,7 +1588,8 @@ bool ssim2mysql::ind_field_InsertMaybe(ssim2mysql::FField& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void ssim2mysql::ind_field_Remove(ssim2mysql::FField& row) {
     if (LIKELY(row.ind_field_next != (ssim2mysql::FField*)-1)) {// check if in hash already
-        u32 index = Smallstr100_Hash(0, row.field) & (_db.ind_field_buckets_n - 1);
+        u32 hash  = Smallstr100_Hash(0, row.field);
+        u32 index = hash & (_db.ind_field_buckets_n - 1);
         ssim2mysql::FField* *prev = &_db.ind_field_buckets_elems[index]; // addr of pointer to current element
         while (ssim2mysql::FField *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -1770,7 +1872,8 @@ bool ssim2mysql::ssimfile_XrefMaybe(ssim2mysql::FSsimfile &row) {
 // --- ssim2mysql.FDb.ind_ssimfile.Find
 // Find row by key. Return NULL if not found.
 ssim2mysql::FSsimfile* ssim2mysql::ind_ssimfile_Find(const algo::strptr& key) {
-    u32 index = Smallstr50_Hash(0, key) & (_db.ind_ssimfile_buckets_n - 1);
+    u32 hash  = Smallstr50_Hash(0, key);
+    u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
     ssim2mysql::FSsimfile* *e = &_db.ind_ssimfile_buckets_elems[index];
     ssim2mysql::FSsimfile* ret=NULL;
     do {
@@ -1812,7 +1915,8 @@ bool ssim2mysql::ind_ssimfile_InsertMaybe(ssim2mysql::FSsimfile& row) {
     ind_ssimfile_Reserve(1);
     bool retval = true; // if already in hash, InsertMaybe returns true
     if (LIKELY(row.ind_ssimfile_next == (ssim2mysql::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         ssim2mysql::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index];
         do {
             ssim2mysql::FSsimfile* ret = *prev;
@@ -1838,7 +1942,8 @@ bool ssim2mysql::ind_ssimfile_InsertMaybe(ssim2mysql::FSsimfile& row) {
 // Remove reference to element from hash index. If element is not in hash, do nothing
 void ssim2mysql::ind_ssimfile_Remove(ssim2mysql::FSsimfile& row) {
     if (LIKELY(row.ind_ssimfile_next != (ssim2mysql::FSsimfile*)-1)) {// check if in hash already
-        u32 index = Smallstr50_Hash(0, row.ssimfile) & (_db.ind_ssimfile_buckets_n - 1);
+        u32 hash  = Smallstr50_Hash(0, row.ssimfile);
+        u32 index = hash & (_db.ind_ssimfile_buckets_n - 1);
         ssim2mysql::FSsimfile* *prev = &_db.ind_ssimfile_buckets_elems[index]; // addr of pointer to current element
         while (ssim2mysql::FSsimfile *next = *prev) {                          // scan the collision chain for our element
             if (next == &row) {        // found it?
@@ -33,6 +33,10 @@ const char *strconv_help =
 "    -in            string  Input directory or filename, - for stdin. default: \"data\"\n"
 "    -verbose               Enable verbose mode\n"
 "    -debug                 Enable debug mode\n"
+"    -unbuffered            Disable buffering of output\n"
+"    -snap                  Load inputs from binary snapshots in temp/\n"
+"    -nommap                Read input files instead of mapping them\n"
+"    -linebuf       int     Max. read buffer for piped input. default: 1048576\n"
 "    -version               Show version information\n"
 "    -sig                   Print SHA1 signatures for dispatches\n"
 "    -help                  Print this screen and exit\n"
@@ -82,7 +82,13 @@ static void ScanSyntax(algo::Argtuple &argtuple, strptr syntax) {
 
 // -----------------------------------------------------------------------------
 
-static bool CheckBuiltinFlag(algo::Argtuple &argtuple, strptr name) {
+// True if built-in option NAME takes a value,
+// which can be given as -name:value or as -name value
+static bool BuiltinArgQ(strptr name) {
+    return name == "-linebuf";
+}
+
+static bool CheckBuiltinFlag(algo::Argtuple &argtuple, strptr name, strptr value) {
     bool found = false;
     if (name == "-debug" || name == "-d") {
         algo_lib::_db.cmdline.debug++;
@@ -103,6 +109,22 @@ static bool CheckBuiltinFlag(algo::Argtuple &argtuple, strptr name) {
     } else if (name == "-verbose" || name == "-v") {
         algo_lib::_db.cmdline.verbose++;
         found = true;
+    } else if (name == "-unbuffered") {
+        algo_lib::_db.cmdline.unbuffered = true;
+        algo_lib::UnbufferLog();
+        found = true;
+    } else if (name == "-snap") {
+        algo_lib::_db.cmdline.snap = true;
+        found = true;
+    } else if (name == "-nommap") {
+        algo_lib::_db.cmdline.nommap = true;
+        found = true;
+    } else if (name == "-linebuf") {
+        found = i32_ReadStrptrMaybe(algo_lib::_db.cmdline.linebuf, value);
+        if (!found) {
+            error_Alloc(argtuple) << "invalid value for option "<<Keyval("",name)<<Keyval("value",value);
+            found = true;
+        }
     }
     return found;
 }
@@ -193,6 +215,7 @@ static void FinalActions(algo::Argtuple &argtuple, strptr help_string) {
     }
 
     if (argtuple.doexit) {
+        algo_lib::FlushLog();
         _exit(argtuple.exitcode);
     }
 }
@@ -210,12 +233,14 @@ static int ReadOption(algo::Argtuple &argtuple, int i, int argc, char **argv) {
     strptr value        = RestFrom(option, R.end);
     ArgProto *arg_proto = FindArgProto(argtuple,name);
 
-    bool need_arg       = arg_proto && R.beg>0 && R.beg == elems_N(option);
+    bool builtin_arg    = !arg_proto && isopt && BuiltinArgQ(name);
+    bool need_arg       = (arg_proto || builtin_arg) && R.beg>0 && R.beg == elems_N(option);
     if (need_arg) {
-        bool read_arg   = arg_proto->type != "flag";
+        bool read_arg   = builtin_arg || arg_proto->type != "flag";
         i              += read_arg;
         if (UNLIKELY(!(i < argc))) {
-            error_Alloc(argtuple) << arg_proto->type<<" value required for option "<<Keyval("",name);
+            error_Alloc(argtuple) << (builtin_arg ? strptr("int") : strptr(arg_proto->type))
+                                  <<" value required for option "<<Keyval("",name);
         }
         value           = read_arg ? argv[i] : "Y";
     }
@@ -225,7 +250,7 @@ static int ReadOption(algo::Argtuple &argtuple, int i, int argc, char **argv) {
     if (found) {
         argtuple.anon_idx += !elems_N(name);
     } else {
-        found = CheckBuiltinFlag(argtuple,name);
+        found = CheckBuiltinFlag(argtuple,name,value);
     }
     if (!found && !argtuple.vararg) {
         if (!elems_N(name)) {
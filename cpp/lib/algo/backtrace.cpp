@@ -249,6 +249,7 @@ void algo::FatalErrorExit(const char *a) NORETURN {
         BacktraceSymbols_Print(aryptr<void*>(addrlist+1,nsyms-1),out);
     }
     PrintTraces();
+    algo_lib::FlushLog();
     fprintf(stderr,"%s\n",Zeroterm(out));// do not use prerr!
     _exit(1);
 }
@@ -318,6 +319,7 @@ static void Signal(int signal, siginfo_t *_si, void *context) {
     PrintTraces();
     // do not use prerr, be safe: this function may be called from a thread
     // that doesn't support prerr.
+    algo_lib::FlushLog();// best effort: show output produced before the crash
     algo::WriteFile(algo::Fildes(2), (u8*)out.ch_elems, out.ch_n);
     algo::WriteFile(algo::Fildes(2), (u8*)"\n", 1);
     // Pass on the signal (so that a core file is produced).
@@ -506,32 +506,19 @@ void algo::Ptr_Print(void *ptr, cstring &out) {
 }
 
 // pads with zeros on the left so that at least 'atleast' characters are output.
+// the minus sign, if any, counts towards 'atleast' and precedes the zeros.
 void algo::i64_PrintPadLeft(i64 num, cstring &out, int atleast) {
-    i64 number=num;
-    char c[32];
-    int ndig = 0;
-    int neg=number<0;
-    number=Abs(number);
-    if (!number) {
-        c[ndig++]='0';
-    } else {
-        while (number!=0) {
-            c[ndig++]=char('0' + number%10);
-            number/=10;
-        }
-    }
-    strptr result(ch_AllocN(out, i32_Max(ndig,atleast)+neg));
+    u8 buf[32];
+    bool neg = num < 0;
+    u32 ndig = u64_FmtBuf(neg ? -u64(num) : u64(num), buf);
+    int npad = i32_Max(atleast - int(ndig) - neg, 0);
+    strptr result(ch_AllocN(out, neg + npad + ndig));
     int i = 0;
     if (neg) {  // minus sign
         result[i++] = '-';
-        atleast--;
-    }
-    for (int k=ndig; k<atleast; k++) {  // pad with zeros from left
-        result[i++]='0';
-    }
-    while (--ndig >= 0) {   // print the rest
-        result[i++]=c[ndig];
     }
+    memset(result.elems + i, '0', npad);  // pad with zeros from left
+    memcpy(result.elems + i + npad, buf, ndig);
 }
 
 // -----------------------------------------------------------------------------
@@ -1776,11 +1763,10 @@ bool algo::cstring_ReadCmdarg(cstring &out, StringIter &S, bool is_value) {
             S.index=elems_N(S.expr);// go to end-of-file
         }
     } else {
-        Charset &breaks=is_value ? algo_lib::_db.SsimBreakValue : algo_lib::_db.SsimBreakName;
+        algo::CharsetNibble &breaks=is_value ? algo_lib::_db.SsimBreakValueNib : algo_lib::_db.SsimBreakNameNib;
         int from=S.index;
-        while (S.index<elems_N(S.expr) && !ch_qGetBit(breaks, (unsigned char)S.expr[S.index])){
-            S.index++;
-        }
+        int len=FindFirstInCharset(RestFrom(S.expr,from), breaks);
+        S.index = len==-1 ? elems_N(S.expr) : from+len;
         strptr result = qGetRegion(S.expr,from,S.index-from);
         out = result;
         ret = true;
@@ -2047,6 +2033,15 @@ void algo::PrintAttrSpaceReset(cstring &str, const char *name, cstring &value) {
 
 // -----------------------------------------------------------------------------
 
+// Decimal digit pairs for 0..99: tens digit in the low byte, ones digit in the high byte.
+static const u16 digit_pairs[100] = {
+#define DIGIT_PAIR_ROW(t) \
+    (t)|0<<8, (t)|1<<8, (t)|2<<8, (t)|3<<8, (t)|4<<8, (t)|5<<8, (t)|6<<8, (t)|7<<8, (t)|8<<8, (t)|9<<8
+    DIGIT_PAIR_ROW(0), DIGIT_PAIR_ROW(1), DIGIT_PAIR_ROW(2), DIGIT_PAIR_ROW(3), DIGIT_PAIR_ROW(4),
+    DIGIT_PAIR_ROW(5), DIGIT_PAIR_ROW(6), DIGIT_PAIR_ROW(7), DIGIT_PAIR_ROW(8), DIGIT_PAIR_ROW(9)
+#undef DIGIT_PAIR_ROW
+};
+
 // Convert VALUE to a string, encoded as a u64.
 // Value must be >=0 and <100000000.
 // Resulting u64 is little-endian -- MSB contains first byte
@@ -2056,30 +2051,10 @@ void algo::PrintAttrSpaceReset(cstring &str, const char *name, cstring &value) {
 u64 algo::u32_CvtLestr8Small(u32 value) {
     u32 l = value % 10000;
     u32 h = value / 10000;
-
-    u32 ll = l % 100;
-    u32 lh = l / 100;
-    u32 hl = h % 100;
-    u32 hh = h / 100;
-
-    u32 lll = ll % 10;
-    u32 llh = ll / 10;
-    u32 lhl = lh % 10;
-    u32 lhh = lh / 10;
-    u32 hll = hl % 10;
-    u32 hlh = hl / 10;
-    u32 hhl = hh % 10;
-    u32 hhh = hh / 10;
-
-    return
-        ( (u64)lll << 56
-          | (u64)llh << 48
-          | (u64)lhl << 40
-          | (u64)lhh << 32
-          | (u64)hll << 24
-          | (u64)hlh << 16
-          | (u64)hhl << 8
-          | (u64)hhh << 0);
+    return u64(digit_pairs[h / 100])
+        | u64(digit_pairs[h % 100]) << 16
+        | u64(digit_pairs[l / 100]) << 32
+        | u64(digit_pairs[l % 100]) << 48;
 }
 
 // -----------------------------------------------------------------------------
@@ -29,6 +29,7 @@
 #include <sys/mman.h>// mmap,mlockall
 #ifdef __linux__
 #include <sys/prctl.h>
+#include <sys/syscall.h>// SYS_getcpu
 #endif
 #include "include/gen/command_gen.h"
 #include "include/gen/command_gen.inl.h"
@@ -446,6 +447,7 @@ bool algo_lib::dispsigcheck_InputMaybe(dmmeta::Dispsigcheck &dispsigcheck) {
               <<Keyval("compiled_sig",sig1)
               <<Keyval("incoming_sig",sig2)
               <<Keyval("comment","signature mismatch -- this program is not compatible with incoming data"));
+        algo_lib::FlushLog();
         _exit(1);// immediately exit
     }
     if (!current) {
@@ -488,6 +490,62 @@ void algo_lib::DieWithParent() {
 #endif
 }
 
+// -----------------------------------------------------------------------------
+
+// Set on threads started with algo_lib::BeginWorker
+static thread_local bool worker_tls;
+
+// Mark the calling thread as a worker thread.
+// Worker threads may allocate strings (algo_lib.FDb.lpool has per-thread magazines),
+// use tempstr (each thread has its own pool; see Temppool in string.cpp),
+// and modify rows that no other thread touches.
+// Everything else in algo_lib::_db, including prlog/prerr/verblog,
+// vrfy/errtext and exit_code, belongs to the main thread.
+// algo::Prlog kills the process if called on a worker thread.
+void algo_lib::BeginWorker() {
+    worker_tls = true;
+}
+
+// Return cached strings to the shared pool; call before the worker thread exits
+void algo_lib::EndWorker() {
+    algo_lib::lpool_FlushMag();
+    worker_tls = false;
+}
+
+// True if the calling thread is between algo_lib::BeginWorker and algo_lib::EndWorker
+bool algo_lib::WorkerQ() {
+    return worker_tls;
+}
+
+// -----------------------------------------------------------------------------
+
+// Configure huge page backing of big sbrk blocks (2MB and up) from environment
+// variable ALGO_HUGEPAGE, a comma-separated list of:
+//   hugetlb   try explicit huge pages (MAP_HUGETLB) first
+//   thp       use transparent huge pages (madvise MADV_HUGEPAGE)
+//   numa      bind big blocks to the NUMA node of the calling cpu
+// If huge pages are not available, blocks are silently backed by regular pages.
+// (called from algo_lib::Init)
+void algo_lib::InitHugepage() {
+    const char *env = getenv("ALGO_HUGEPAGE");// NULL if not set
+    for (strptr opts = env ? env : ""; opts != ""; opts = Pathcomp(opts,",LR")) {
+        strptr opt = Pathcomp(opts,",LL");
+        if (opt == "hugetlb") {
+            algo_lib::_db.sbrk_huge_limit = ULLONG_MAX;
+        } else if (opt == "thp") {
+            algo_lib::_db.sbrk_thp = true;
+        } else if (opt == "numa") {
+            unsigned cpu = 0, node = 0;
+#if defined(__linux__) && defined(SYS_getcpu)
+            if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0) {
+                node = 0;
+            }
+#endif
+            algo_lib::_db.sbrk_numa_node = node;
+        }
+    }
+}
+
 // Create temporary file
 // tempfile.fildes points to the new temp file after this
 // temp file is created under temp/
@@ -662,6 +720,148 @@ bool algo_lib::DoLoadTuples(strptr root, bool (*LoadFunc)(strptr), const char **
 
 // -----------------------------------------------------------------------------
 
+// Append row image of a tuple read by a generated InsertStrptrMaybe
+// to the snapshot being recorded. TABLE_ID -1 means ROW is the tuple text.
+// Records are 8-byte aligned.
+void algo_lib::SnapRecord(i32 table_id, const void *row, int size) {
+    algo_lib::SnapRec rec;
+    rec.table_id = table_id;
+    rec.size     = size;
+    ary_Addary(_db.snapbuf, algo::aryptr<u8>((u8*)&rec, sizeof(rec)));
+    ary_Addary(_db.snapbuf, algo::aryptr<u8>((u8*)row, size));
+    int pad = -ary_N(_db.snapbuf) & 7;
+    memset(ary_AllocN(_db.snapbuf, pad).elems, 0, pad);
+}
+
+// Validation key of a snapshot: namespace, input signature, root,
+// and size + modification time of each ssimfile.
+static tempstr SnapKey(strptr root, strptr ns, strptr signature, const char **ssimfiles) {
+    tempstr ret;
+    ret << ns << " " << signature << " " << root << eol;
+    for (int i=0; ssimfiles && ssimfiles[i]; i++) {
+        struct stat st;
+        ret << ssimfiles[i];
+        if (stat(Zeroterm(tempstr() << SsimFname(root, ssimfiles[i])), &st) == 0) {
+            ret << " " << i64(st.st_size) << " " << i64(st.st_mtim.tv_sec) << "." << i64(st.st_mtim.tv_nsec);
+        }
+        ret << eol;
+    }
+    return ret;
+}
+
+// Load snapshot FNAME if it exists and its key matches KEY.
+// The file is fully validated before the first row is loaded.
+// Row images are passed to SNAPFUNC, tuples recorded as text (table_id -1) to LOADFUNC.
+// Return false if the snapshot cannot be used (caller falls back to text);
+// otherwise, RETVAL receives the load status.
+static bool SnapLoadMaybe(strptr fname, strptr key, bool (*LoadFunc)(strptr), bool (*SnapFunc)(i32, algo::memptr), bool strict, bool &retval) {
+    algo_lib::MmapFile file;
+    bool ok = MmapFile_Load(file, fname);
+    algo::memptr mem = strptr_ToMemptr(file.text);
+    algo_lib::SnapHdr hdr;
+    int off = 0;
+    ok = ok && elems_N(mem) >= i32(sizeof(hdr));
+    if (ok) {
+        memcpy(&hdr, mem.elems, sizeof(hdr));
+        off = sizeof(hdr) + ((hdr.keylen + 7) & ~7);
+        ok = hdr.magic == algo_lib::SnapHdr().magic
+            && hdr.version == algo_lib::SnapHdr().version
+            && i32(hdr.keylen) == elems_N(key)
+            && off <= elems_N(mem)
+            && strptr((char*)mem.elems + sizeof(hdr), hdr.keylen) == key;
+    }
+    // check record framing
+    u32 nrec = 0;
+    for (int i = off; ok && i < elems_N(mem); nrec++) {
+        algo_lib::SnapRec rec;
+        ok = i + i32(sizeof(rec)) <= elems_N(mem);
+        if (ok) {
+            memcpy(&rec, mem.elems + i, sizeof(rec));
+            i += sizeof(rec) + ((rec.size + 7) & ~7);
+            ok = i <= elems_N(mem);
+        }
+    }
+    ok = ok && nrec == hdr.nrec;
+    for (int i = off; ok && i < elems_N(mem); ) {
+        algo_lib::SnapRec rec;
+        memcpy(&rec, mem.elems + i, sizeof(rec));
+        i += sizeof(rec);
+        algo::memptr row(mem.elems + i, rec.size);
+        bool rowok = i32(rec.table_id) == -1
+            ? LoadFunc(algo::memptr_ToStrptr(row))
+            : SnapFunc(rec.table_id, row);
+        if (!rowok) {
+            algo_lib::_db.errtext << eol << fname << ": snapshot row rejected, table_id " << i32(rec.table_id) << eol;
+            retval = false;
+            if (strict) {
+                break;
+            }
+        }
+        i += (rec.size + 7) & ~7;
+    }
+    return ok;
+}
+
+// Write recorded rows to snapshot FNAME, replacing it atomically.
+static void SnapSave(strptr fname, strptr key) {
+    algo_lib::SnapHdr hdr;
+    hdr.keylen = elems_N(key);
+    algo::memptr rows = ary_Getary(algo_lib::_db.snapbuf);
+    for (int i = 0; i < elems_N(rows); hdr.nrec++) {
+        algo_lib::SnapRec rec;
+        memcpy(&rec, rows.elems + i, sizeof(rec));
+        i += sizeof(rec) + ((rec.size + 7) & ~7);
+    }
+    tempstr keypad(key);
+    while (ch_N(keypad) & 7) {
+        keypad << '\0';
+    }
+    tempstr newfile;
+    newfile << fname << "." << getpid();
+    algo_lib::FFildes fildes;
+    fildes.fd = OpenWrite(newfile);
+    bool ok = ValidQ(fildes.fd)
+        && WriteFile(fildes.fd, (u8*)&hdr, sizeof(hdr))
+        && WriteFile(fildes.fd, (u8*)keypad.ch_elems, ch_N(keypad))
+        && WriteFile(fildes.fd, rows.elems, elems_N(rows));
+    ok = ok && rename(Zeroterm(newfile), Zeroterm(tempstr() << fname)) == 0;
+    if (!ok) {
+        (void)unlink(Zeroterm(newfile));
+    }
+}
+
+// Same as DoLoadTuples, but with -snap, when ROOT is a directory and temp/ exists,
+// load inputs from binary snapshot temp/<NS>.<HASH>.ssimsnap instead of parsing text,
+// where HASH is a hash of ROOT (so that alternating data sets don't evict each other).
+// The snapshot is valid for one input SIGNATURE (computed by amc) and one set of
+// ssimfile sizes and modification times; if it's missing or stale, tuples are
+// loaded from text while InsertStrptrMaybe records the parsed rows, and
+// the snapshot is rewritten.
+// SnapFunc is the generated InsertSnapMaybe for the namespace.
+bool algo_lib::DoLoadTuplesSnap(strptr root, strptr ns, strptr signature, bool (*LoadFunc)(strptr), bool (*SnapFunc)(i32, algo::memptr), const char **ssimfiles, bool strict) {
+    bool retval = true;
+    if (_db.cmdline.snap && !FileQ(root) && DirectoryQ(root) && DirectoryQ("temp")) {
+        tempstr fname;
+        fname << "temp/" << ns << "." << strptr_Hash(0, root) << ".ssimsnap";
+        tempstr key(SnapKey(root, ns, signature, ssimfiles));
+        if (!SnapLoadMaybe(fname, key, LoadFunc, SnapFunc, strict, retval)) {
+            _db.snap_rec = true;
+            retval = DoLoadTuples(root, LoadFunc, ssimfiles, strict);
+            if (retval && _db.snap_rec) {
+                SnapSave(fname, key);
+            }
+            _db.snap_rec = false;
+            algo::ByteAry_Uninit(_db.snapbuf);
+            algo::ByteAry_Init(_db.snapbuf);
+        }
+    } else {
+        retval = DoLoadTuples(root, LoadFunc, ssimfiles, strict);
+    }
+    return retval;
+}
+
+// -----------------------------------------------------------------------------
+
 // Return TRUE if current user is root.
 // #AL# is this more correct than checking that effective uid is 0?
 bool algo_lib::RootQ() {
@@ -21,6 +21,7 @@
 //
 
 #include "include/algo.h"
+#include <sys/mman.h>// mmap,madvise
 
 // -----------------------------------------------------------------------------
 
@@ -121,6 +122,49 @@ void algo::Line_curs_Next(Line_curs &curs) {
 
 // -----------------------------------------------------------------------------
 
+// Select input mode for FILE on first read.
+// A regular file is mapped into memory from the current offset to the end,
+// and handed to the line buffer as a single block, so lines are returned
+// as pointers into the mapping. The file offset is moved to the end, as if
+// the whole file had been read. Anything else (pipes, sockets, ttys, or
+// a failed mapping), and any file with -nommap, is read with read(2)
+// into TEMP_BUF, which grows up to -linebuf bytes.
+static void InTextFile_Start(algo_lib::InTextFile &file) {
+    file.started = true;
+    file.bufsize = i32_Max(algo_lib::_db.cmdline.linebuf, 1);
+    struct stat st;
+    int fd = file.file.fd.value;
+    if (!algo_lib::_db.cmdline.nommap && fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        off_t off = lseek(fd, 0, SEEK_CUR);
+        if (off >= 0 && off < st.st_size) {
+            void *addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                (void)madvise(addr, st.st_size, MADV_SEQUENTIAL);
+                file.map.mem = algo::memptr((u8*)addr, st.st_size);
+                (void)lseek(fd, 0, SEEK_END);
+                LinebufBegin(file.line_buf, RestFrom(file.map.mem, off), true);
+            }
+        }
+    }
+}
+
+// Prepare FILE to read from FD, releasing the previous file and mapping,
+// and any buffered partial line. The input mode is selected again on the next read.
+// If OWN_FD is set, FD is closed when FILE is cleaned up or re-opened.
+void algo_lib::InTextFile_Open(algo_lib::InTextFile &file, algo::Fildes fd, bool own_fd) {
+    file_Cleanup(file);// a descriptor that is not owned is not closed
+    fd_Cleanup(file.file);
+    file.file.fd = fd;
+    file.own_fd = own_fd;
+    mem_Cleanup(file.map);
+    file.map.mem = algo::memptr();
+    file.line_buf.buf_n = 0;
+    LinebufBegin(file.line_buf, algo::memptr(), false);
+    file.started = false;
+}
+
+// -----------------------------------------------------------------------------
+
 // Read next line from FILE into RESULT
 // When end of file is reached, return FALSE.
 // If error occurs during reading, return false.
@@ -131,18 +175,33 @@ void algo::Line_curs_Next(Line_curs &curs) {
 //     <do something with LINE>
 // }
 // A partial line at the end of the file is returned.
+// Regular files are mapped into memory (see InTextFile_Start);
+// other inputs are read through a buffer that starts at 64KB and doubles
+// each time a read fills it, up to FILE.BUFSIZE (see -linebuf).
 bool algo_lib::ReadLine(algo_lib::InTextFile &file, algo::strptr &result) {
+    if (!file.started) {
+        InTextFile_Start(file);
+    }
     // attempt to grab a line from in-memory buffer
     bool ret = LinebufNext(file.line_buf,result);
     while (!ret && !file.line_buf.eof) {
-        ssize_t len = read(file.file.fd.value, file.temp_buf_data, ssizeof(file.temp_buf_data));
+        // all incoming data has been consumed at this point, so the buffer can be reallocated.
+        // the previous read filled the buffer if the consumed block ends at the end of the buffer.
+        int bufsize = file.temp_buf_max;
+        bool filled = bufsize > 0 && (u8*)file.line_buf.incoming.elems == file.temp_buf_elems + bufsize;
+        if (bufsize == 0) {
+            temp_buf_AbsReserve(file, i32_Max(i32_Min(64*1024, file.bufsize), 1));
+        } else if (filled && bufsize*2 <= file.bufsize) {
+            temp_buf_AbsReserve(file, bufsize*2);
+        }
+        ssize_t len = read(file.file.fd.value, file.temp_buf_elems, file.temp_buf_max);
         // pipes can return a few bytes at a time, without filling a whole line.
         // keep reading until we get a full line, or end of file is detected
         // if we were passed a non-blocking file descriptor, keep going. it wastes CPU,
         // but that's not our problem, it's the caller's problem.
         if (len >= 0) {
             bool implied_eof = len==0;
-            LinebufBegin(file.line_buf, memptr(file.temp_buf_data,len), implied_eof);
+            LinebufBegin(file.line_buf, memptr(file.temp_buf_elems,len), implied_eof);
             ret = LinebufNext(file.line_buf, result);
         } else if (errno != EAGAIN) {
             ret = false;
@@ -155,8 +214,7 @@ bool algo_lib::ReadLine(algo_lib::InTextFile &file, algo::strptr &result) {
 // -----------------------------------------------------------------------------
 
 static void _FileLine_curs_Reset(algo::FileLine_curs &curs, algo::Fildes fd, bool own) {
-    curs.file.file.fd = fd;
-    curs.file.own_fd = own;
+    algo_lib::InTextFile_Open(curs.file, fd, own);
     curs.line = strptr();
     curs.i=0;// first line is zero, buyer beware
     curs.eof.value = !ReadLine(curs.file, curs.line);
@@ -25,19 +25,104 @@
 //
 // -----------------------------------------------------------------------------
 
+#include <pthread.h>// pthread_atfork
+
+// Write out pending output of LOGBUF (which buffers fd FD)
+static void WriteLogbuf(algo_lib::FLogbuf &logbuf, int fd) {
+    if (ch_N(logbuf.buf) > 0) {
+        WriteFile(algo::Fildes(fd), (u8*)logbuf.buf.ch_elems, ch_N(logbuf.buf));
+        logbuf.n_write++;
+        ch_RemoveAll(logbuf.buf);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Output of prlog/prerr for fd FD.
+// STR is the log buffer; bytes starting at index START are written out,
+// (with a newline appended if EOL is set), after which STR is truncated back to START.
+// If FD has a buffer (see InitLogbuf), output is accumulated and written out
+// when the buffer reaches its threshold. Otherwise, all buffered output is
+// written out first, so that e.g. stdout and stderr stay in order when both
+// go to the same file, and then STR is written directly.
+// The message string (algo_lib::_db.log_str) and the per-fd buffers are process-global
+// and not locked: prlog, prerr, verblog etc. may only be used by the main thread.
+// Worker threads (see algo_lib::BeginWorker) record their results, and the main thread prints them.
 void algo::Prlog(int fd, cstring &str, int start, bool eol) {
+    if (UNLIKELY(algo_lib::WorkerQ())) {
+        algo::FatalErrorExit("algo::Prlog called on a worker thread");
+    }
     try {
         if (eol) {
             str << '\n';
         }
-        // some tools set fd 0 to nonblocking mode,
-        // which in case of a terminal makes output non-blocking too (bug in gnome terminal?)
-        // in any case it causes EAGAIN during fast writes, so we use WriteFile to
-        // write all bytes out.
-        WriteFile(algo::Fildes(fd), (u8*)str.ch_elems + start, i32(str.ch_n - start));
+        algo_lib::FLogbuf *logbuf = algo_lib::logbuf_Find(fd);
+        if (logbuf && logbuf->flush_lim > 0) {
+            logbuf->buf << ch_RestFrom(str, start);
+            if (ch_N(logbuf->buf) >= logbuf->flush_lim) {
+                WriteLogbuf(*logbuf, fd);
+            }
+        } else {
+            algo_lib::FlushLog();
+            // some tools set fd 0 to nonblocking mode,
+            // which in case of a terminal makes output non-blocking too (bug in gnome terminal?)
+            // in any case it causes EAGAIN during fast writes, so we use WriteFile to
+            // write all bytes out.
+            WriteFile(algo::Fildes(fd), (u8*)str.ch_elems + start, i32(str.ch_n - start));
+            if (logbuf) {
+                logbuf->n_write++;
+            }
+        }
         str.ch_n = start;
     } catch (...) {
         // coverity UNCAUGHT_EXCEPT --
         // do not allow this function to throw exception.
     }
 }
+
+// -----------------------------------------------------------------------------
+
+// Write out all pending prlog output.
+// Must be called before any code that writes to fd 1 or 2 bypassing prlog,
+// and before _exit(). Process exit (FDb_Uninit) and fork() do this automatically.
+void algo_lib::FlushLog() {
+    for (int fd = 0; fd < algo_lib::logbuf_N(); fd++) {
+        WriteLogbuf(algo_lib::logbuf_qFind(fd), fd);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Write out pending prlog output and switch all fds to write-through mode.
+// This is the -unbuffered behavior; it is also applied in a child process after fork(),
+// since children typically leave via _exit() and would lose buffered output.
+void algo_lib::UnbufferLog() {
+    algo_lib::FlushLog();
+    for (int fd = 0; fd < algo_lib::logbuf_N(); fd++) {
+        algo_lib::logbuf_qFind(fd).flush_lim = 0;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Set up prlog buffering policy (called from algo_lib::FDb_Init)
+// stdout is fully buffered unless it is a terminal, in which case each
+// line is written out as it's printed.
+// stderr is never buffered.
+void algo_lib::InitLogbuf() {
+    if (!isatty(1)) {
+        algo_lib::logbuf_qFind(1).flush_lim = 64*1024;
+    }
+    static bool atfork_done = false;
+    if (!atfork_done) {
+        pthread_atfork(algo_lib::FlushLog, NULL, algo_lib::UnbufferLog);
+        atfork_done = true;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Flush prlog output at exit
+void algo_lib::logbuf_Cleanup() {
+    algo_lib::FlushLog();
+}
@@ -0,0 +1,205 @@
+// (C) 2017-2019 NYSE | Intercontinental Exchange
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contacting ICE: <https://www.theice.com/contact>
+//
+// Target: algo_lib (lib) -- Support library for all executables
+// Exceptions: NO
+// Source: cpp/lib/algo/sort.cpp -- Radix sort and parallel sort engines
+//
+// These are the type-independent halves of the RadixSort and ParallelSort
+// functions generated by amc (see fsort, cpp/amc/sort.cpp).
+// The generated half extracts keys / compares elements; the code here moves memory.
+
+#include "include/algo.h"
+#include <pthread.h>
+#include <unistd.h>// sysconf
+
+// -----------------------------------------------------------------------------
+
+// Stable LSD radix sort of N keys by KEYS[i].key, 11 bits per pass (6 passes max).
+// TMP is scratch space of the same size as KEYS.
+// Passes in which all keys have the same digit are skipped, so sorting
+// small integers or strings with a common prefix costs few passes.
+// On return, KEYS points to the sorted array and TMP to the other buffer.
+void algo_lib::RadixSortKeys(algo::RadixKey *&keys, algo::RadixKey *&tmp, int n) {
+    enum { nbit = 11, nbucket = 1 << nbit, ndigit = (64 + nbit - 1) / nbit };
+    u32 count[ndigit][nbucket];
+    memset(count, 0, sizeof(count));
+    // one pass to compute histograms of all digits
+    for (int i = 0; i < n; i++) {
+        u64 key = keys[i].key;
+        for (int d = 0; d < ndigit; d++) {
+            count[d][(key >> (d*nbit)) & (nbucket-1)]++;
+        }
+    }
+    for (int d = 0; d < ndigit; d++) {
+        u32 *cnt = count[d];
+        int shift = d*nbit;
+        // this digit is the same for all keys -- nothing to do
+        if (cnt[(keys[0].key >> shift) & (nbucket-1)] == u32(n)) {
+            continue;
+        }
+        u32 pos = 0;
+        for (int b = 0; b < nbucket; b++) {
+            u32 c = cnt[b];
+            cnt[b] = pos;
+            pos += c;
+        }
+        for (int i = 0; i < n; i++) {
+            tmp[cnt[(keys[i].key >> shift) & (nbucket-1)]++] = keys[i];
+        }
+        algo::TSwap(keys, tmp);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Extract 8-byte word WORD of string S as a big-endian radix key.
+// Characters are compared as char (same as strptr_Lt); missing characters
+// are zero. The caller breaks ties between a string and its zero-padded
+// extension by also sorting on the length (as the least significant word).
+u64 algo_lib::RadixKeyStr(algo::strptr s, int word) {
+    u64 ret = 0;
+    int beg = word*8;
+    for (int i = 0; i < 8; i++) {
+        u8 c = beg+i < s.n_elems ? u8(int(s.elems[beg+i]) - CHAR_MIN) : 0;
+        ret = (ret << 8) | c;
+    }
+    return ret;
+}
+
+// -----------------------------------------------------------------------------
+
+// Unit of work for one ParallelSort thread: sort a run in place,
+// or merge runs [beg,mid) and [mid,end) from SRC into DST
+struct ParallelSortTask {
+    algo::SortRunFcn   sortfcn;
+    algo::MergeRunsFcn mergefcn;
+    u8                *src;
+    u8                *dst;
+    int                elemsize;
+    int                beg;
+    int                mid;
+    int                end;
+    pthread_t          thread;
+};
+
+static void *ParallelSortThread(void *arg) {
+    ParallelSortTask &task = *(ParallelSortTask*)arg;
+    if (task.mergefcn) {
+        if (task.mid < task.end) {
+            task.mergefcn(task.dst + size_t(task.beg) * task.elemsize
+                          , task.src + size_t(task.beg) * task.elemsize, task.mid - task.beg
+                          , task.src + size_t(task.mid) * task.elemsize, task.end - task.mid);
+        } else {// odd run out -- carry over
+            memcpy(task.dst + size_t(task.beg) * task.elemsize
+                   , task.src + size_t(task.beg) * task.elemsize
+                   , size_t(task.end - task.beg) * task.elemsize);
+        }
+    } else {
+        task.sortfcn(task.src + size_t(task.beg) * task.elemsize, task.end - task.beg);
+    }
+    return NULL;
+}
+
+// Run NTASK tasks: task 0 in the calling thread, the rest in new threads.
+// If a thread cannot be created, the task runs in the calling thread.
+static void ParallelSortRun(ParallelSortTask *task, int ntask) {
+    bool *started = (bool*)alloca(ntask);
+    for (int i = 1; i < ntask; i++) {
+        started[i] = pthread_create(&task[i].thread, NULL, ParallelSortThread, &task[i]) == 0;
+    }
+    ParallelSortThread(&task[0]);
+    for (int i = 1; i < ntask; i++) {
+        if (started[i]) {
+            pthread_join(task[i].thread, NULL);
+        } else {
+            ParallelSortThread(&task[i]);
+        }
+    }
+}
+
+// Number of threads to use for ParallelSort
+static int ParallelSortNthread() {
+    static int nthread = 0;
+    if (nthread == 0) {
+        nthread = i32_Max(1, i32_Min(int(sysconf(_SC_NPROCESSORS_ONLN)), 16));
+    }
+    return nthread;
+}
+
+// -----------------------------------------------------------------------------
+
+// Sort N elements of size ELEMSIZE at ELEMS using multiple threads.
+// The array is split into one run per thread (runs are at least MIN_RUN elements);
+// each run is sorted with SORTFCN, then runs are merged pairwise with MERGEFCN,
+// each level of merges also executing in parallel, ping-ponging between ELEMS
+// and a scratch buffer. Small arrays are sorted with SORTFCN in the calling thread.
+// SORTFCN and MERGEFCN must not touch any shared state.
+void algo_lib::ParallelSort(void *elems, int n, int elemsize, algo::SortRunFcn sortfcn, algo::MergeRunsFcn mergefcn) {
+    enum { min_run = 1<<14 };
+    int nrun = i32_Min(ParallelSortNthread(), n / min_run);
+    if (nrun <= 1) {
+        sortfcn(elems, n);
+        return;
+    }
+    ParallelSortTask *task = (ParallelSortTask*)alloca(sizeof(ParallelSortTask) * nrun);
+    int *bound = (int*)alloca(sizeof(int) * (nrun + 1));
+    u8 *buf = (u8*)algo_lib::malloc_AllocMem(size_t(n) * elemsize);
+    u8 *src = (u8*)elems;
+    u8 *dst = buf;
+    for (int i = 0; i <= nrun; i++) {
+        bound[i] = int(i64(n) * i / nrun);
+    }
+    // sort runs
+    for (int i = 0; i < nrun; i++) {
+        ParallelSortTask &t = task[i];
+        t.sortfcn  = sortfcn;
+        t.mergefcn = NULL;
+        t.src      = src;
+        t.dst      = NULL;
+        t.elemsize = elemsize;
+        t.beg      = bound[i];
+        t.mid      = bound[i+1];
+        t.end      = bound[i+1];
+    }
+    ParallelSortRun(task, nrun);
+    // merge runs pairwise until one is left
+    while (nrun > 1) {
+        int ntask = (nrun + 1) / 2;
+        for (int i = 0; i < ntask; i++) {
+            ParallelSortTask &t = task[i];
+            t.sortfcn  = NULL;
+            t.mergefcn = mergefcn;
+            t.src      = src;
+            t.dst      = dst;
+            t.elemsize = elemsize;
+            t.beg      = bound[i*2];
+            t.mid      = bound[i32_Min(i*2+1, nrun)];
+            t.end      = bound[i32_Min(i*2+2, nrun)];
+        }
+        ParallelSortRun(task, ntask);
+        for (int i = 0; i <= ntask; i++) {
+            bound[i] = bound[i32_Min(i*2, nrun)];
+        }
+        nrun = ntask;
+        algo::TSwap(src, dst);
+    }
+    if (src != elems) {
+        memcpy(elems, src, size_t(n) * elemsize);
+    }
+    algo_lib::malloc_FreeMem(buf, size_t(n) * elemsize);
+}
@@ -25,6 +25,7 @@
 //
 
 #include "include/algo.h"
+#include <sys/syscall.h>// SYS_gettid
 
 // S         source string
 // EXPR      string in the form (XYZ)*
@@ -227,6 +228,106 @@ int algo::FindFrom(strptr s, char c, int from) {
     return -1;
 }
 
+// Build nibble lookup tables for charset CS.
+// Each high nibble H selects a row: the set of low nibbles L such that H*16+L is in CS.
+// Every distinct non-empty row is given a bit; HI[H] holds the bit of H's row,
+// and LO[L] holds the bits of all rows that contain L.
+// Byte C is in CS iff LO[C&15] & HI[C>>4] is non-zero.
+// There are at most 16 distinct rows; rows 8..15 go to the second table pair.
+void algo::CharsetNibble_Build(algo::CharsetNibble &nib, algo::Charset &cs) {
+    u16 rows[16];
+    int nrow = 0;
+    rep_(i,16) {
+        nib.lo_elems[i]  = 0;
+        nib.hi_elems[i]  = 0;
+        nib.lo2_elems[i] = 0;
+        nib.hi2_elems[i] = 0;
+    }
+    rep_(h,16) {
+        u16 row = 0;
+        rep_(l,16) {
+            if (ch_qGetBit(cs, h*16+l)) {
+                row |= u16(1) << l;
+            }
+        }
+        if (row) {
+            int k = 0;
+            while (k < nrow && rows[k] != row) {
+                k++;
+            }
+            if (k == nrow) {
+                rows[nrow++] = row;
+            }
+            (k < 8 ? nib.hi_elems : nib.hi2_elems)[h] = u8(1 << (k & 7));
+        }
+    }
+    rep_(k,nrow) {
+        rep_(l,16) {
+            if (rows[k] & (u16(1) << l)) {
+                (k < 8 ? nib.lo_elems : nib.lo2_elems)[l] |= u8(1 << (k & 7));
+            }
+        }
+    }
+    nib.wide = nrow > 8;
+}
+
+static inline bool CharsetNibbleQ(algo::CharsetNibble &nib, u8 c) {
+    return (nib.lo_elems[c & 15] & nib.hi_elems[c >> 4])
+        || (nib.lo2_elems[c & 15] & nib.hi2_elems[c >> 4]);
+}
+
+// Return index of first character of S that belongs to the charset
+// described by NIB, or -1 if there is none.
+// With SSE, 16 characters are classified per step using PSHUFB lookups.
+int algo::FindFirstInCharset(strptr s, algo::CharsetNibble &nib) {
+    int i = 0;
+    int n = s.n_elems;
+#ifdef AOS_SSE42
+    __m128i lo   = _mm_loadu_si128((const __m128i*)nib.lo_elems);
+    __m128i hi   = _mm_loadu_si128((const __m128i*)nib.hi_elems);
+    __m128i lo2  = _mm_loadu_si128((const __m128i*)nib.lo2_elems);
+    __m128i hi2  = _mm_loadu_si128((const __m128i*)nib.hi2_elems);
+    __m128i mask = _mm_set1_epi8(0x0f);
+    __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= n; i += 16) {
+        __m128i v  = _mm_loadu_si128((const __m128i*)(s.elems + i));
+        __m128i vl = _mm_and_si128(v, mask);
+        __m128i vh = _mm_and_si128(_mm_srli_epi16(v, 4), mask);
+        __m128i m  = _mm_and_si128(_mm_shuffle_epi8(lo, vl), _mm_shuffle_epi8(hi, vh));
+        if (nib.wide) {
+            m = _mm_or_si128(m, _mm_and_si128(_mm_shuffle_epi8(lo2, vl), _mm_shuffle_epi8(hi2, vh)));
+        }
+        int bits = _mm_movemask_epi8(_mm_cmpeq_epi8(m, zero)) ^ 0xffff;
+        if (bits) {
+            return i + __builtin_ctz(bits);
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (CharsetNibbleQ(nib, s.elems[i])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Return index of first character of S that belongs to CS, or -1 if there is none.
+// Lookup tables are built on each call; to scan with the same charset repeatedly,
+// build an algo::CharsetNibble once and use the overload above.
+int algo::FindFirstInCharset(strptr s, algo::Charset &cs) {
+    if (elems_N(s) < 64) {
+        rep_(i,elems_N(s)) {
+            if (ch_qGetBit(cs, u8(s.elems[i]))) {
+                return i;
+            }
+        }
+        return -1;
+    }
+    algo::CharsetNibble nib;
+    CharsetNibble_Build(nib, cs);
+    return FindFirstInCharset(s, nib);
+}
+
 // Search for character/string from left to right
 // If found, return index where match occurs.
 // If not found, return -1
@@ -622,34 +723,154 @@ tempstr algo_lib::Tuple_Subst(algo_lib::Replscope &R, strptr text) {
     return ret;
 }
 
+// Tempstr buffers larger than this are freed on release instead of being pooled,
+// so that a small temporary never pins a large allocation
+#define TEMPSTR_MAXBUF (64*1024)
+
+// Size class for a tempstr buffer of capacity MAX
+static inline int TempclassIdx(u32 max) {
+    return max <= 1024 ? 0 : max <= 4*1024 ? 1 : max <= 16*1024 ? 2 : 3;
+}
+
+// Move buffer of FROM into TO (TO must be empty). FROM is left empty.
+static inline void TempstrMove(algo::cstring &to, algo::cstring &from) {
+    to.ch_elems   = from.ch_elems;
+    to.ch_n       = 0;
+    to.ch_max     = from.ch_max;
+    from.ch_elems = NULL;
+    from.ch_n     = 0;
+    from.ch_max   = 0;
+}
+
+// Pool of a thread other than the main thread.
+// At thread exit, the pool's buffers are freed first, and then
+// the thread's lpool magazine is flushed, so the memory is not lost.
+struct WorkerTemppool {
+    struct Flush {
+        ~Flush() {
+            algo_lib::lpool_FlushMag();
+        }
+    } flush;
+    algo_lib::FTemppool pool;
+};
+
+static thread_local algo_lib::FTemppool *temppool_tls;
+
+// Tempstr pool of the calling thread, created on first use.
+// The main thread uses algo_lib::_db.temppool.
+static algo_lib::FTemppool &TemppoolInit() {
+    if (syscall(SYS_gettid) == getpid()) {
+        temppool_tls = &algo_lib::_db.temppool;
+    } else {
+        static thread_local WorkerTemppool worker;
+        temppool_tls = &worker.pool;
+    }
+    return *temppool_tls;
+}
+
+static inline algo_lib::FTemppool &Temppool() {
+    algo_lib::FTemppool *pool = temppool_tls;
+    return LIKELY(pool) ? *pool : TemppoolInit();
+}
+
+// Take a buffer from the largest non-empty size class, so that a hot tempstr rarely regrows.
+// The spill list is only consulted once the regular free lists are empty.
 algo::tempstr::tempstr() {
-    int          n = algo_lib::_db.n_temp;
-    if (n > 0) {
-        n--;
-        cstring &str   = algo_lib::temp_strings_qFind(n);
-        algo_lib::_db.n_temp = n;
-        ch_elems          = str.ch_elems;
-        ch_n        = str.ch_n;
-        ch_max      = str.ch_max;
-        str.ch_elems      = NULL;
-        str.ch_n    = 0;
-        str.ch_max  = 0;
+    algo_lib::FTemppool &pool = Temppool();
+    u32 mask = pool.mask;
+    if (mask) {
+        int idx = algo::u32_BitScanReverse(mask);
+        algo_lib::FTempclass &tempclass = tempclass_qFind(pool, idx);
+        tempclass.n--;
+        TempstrMove(*this, str_qFind(tempclass, tempclass.n));
+        if (tempclass.n == 0) {
+            pool.mask = mask & ~(u32(1) << idx);
+        }
+    } else if (spill_N(pool) > 0) {
+        TempstrMove(*this, spill_qLast(pool));
+        spill_RemoveLast(pool);
+    }
+    if (algo_lib::_db.tempstr_stats_on && &pool == &algo_lib::_db.temppool) {
+        report::tempstr &stats = pool.stats;
+        stats.pool_bytes -= ch_max;
+        if (ch_max > 0) {
+            stats.n_hit++;
+        } else {
+            stats.n_miss++;
+        }
     }
 }
 
+// Return buffer to the free list of its size class.
+// If the class is full, park the buffer in the spill list (when a TempstrScope is open),
+// or let ~cstring free it.
 algo::tempstr::~tempstr() {
-    i32        n   = algo_lib::_db.n_temp;
-    if (n < algo_lib::temp_strings_N()) {
-        cstring   &str = algo_lib::temp_strings_qFind(n);
-        // temp strings sitting in the free pool are empty.
-        n++;
-        algo_lib::_db.n_temp = n;
-        str.ch_elems = ch_elems;
-        str.ch_n     = 0;
-        str.ch_max   = ch_max;
-        ch_elems     = NULL;
-        ch_n         = 0;
-        ch_max       = 0;
+    if (ch_max > 0) {
+        algo_lib::FTemppool &pool = Temppool();
+        u32 max = ch_max;
+        int idx = TempclassIdx(max);
+        algo_lib::FTempclass &tempclass = tempclass_qFind(pool, idx);
+        bool parked = false;
+        bool spilled = false;
+        if (max <= TEMPSTR_MAXBUF && tempclass.n < str_N(tempclass)) {
+            TempstrMove(str_qFind(tempclass, tempclass.n), *this);
+            tempclass.n++;
+            pool.mask |= u32(1) << idx;
+            parked = true;
+        } else if (max <= TEMPSTR_MAXBUF && pool.scope > 0) {
+            TempstrMove(spill_Alloc(pool), *this);
+            parked = true;
+            spilled = true;
+        }
+        if (algo_lib::_db.tempstr_stats_on && &pool == &algo_lib::_db.temppool) {
+            report::tempstr &stats = pool.stats;
+            stats.max_buf = u32_Max(stats.max_buf, max);
+            stats.n_spill += spilled;
+            stats.n_drop += !parked;
+            if (parked) {
+                stats.pool_bytes += max;
+                stats.peak_bytes = u64_Max(stats.peak_bytes, stats.pool_bytes);
+            }
+        }
+    }
+}
+
+// Start collecting algo_lib::_db.temppool.stats (tempstr pool of the main thread).
+// Counting is off by default, since tempstr is constructed on every hot path;
+// pool_bytes and peak_bytes start from the bytes parked at this point.
+void algo_lib::TempstrStatsEnable() {
+    if (!algo_lib::_db.tempstr_stats_on) {
+        algo_lib::FTemppool &pool = algo_lib::_db.temppool;
+        u64 pool_bytes = 0;
+        ind_beg(algo_lib::FTemppool_tempclass_curs, tempclass, pool) {
+            for (int i = 0; i < tempclass.n; i++) {
+                pool_bytes += str_qFind(tempclass, i).ch_max;
+            }
+        }ind_end;
+        ind_beg(algo_lib::FTemppool_spill_curs, str, pool) {
+            pool_bytes += str.ch_max;
+        }ind_end;
+        pool.stats.pool_bytes = pool_bytes;
+        pool.stats.peak_bytes = pool_bytes;
+        algo_lib::_db.tempstr_stats_on = true;
+    }
+}
+
+algo::TempstrScope::TempstrScope() {
+    Temppool().scope++;
+}
+
+// Closing the outermost scope frees the spill list
+algo::TempstrScope::~TempstrScope() {
+    algo_lib::FTemppool &pool = Temppool();
+    pool.scope--;
+    if (pool.scope == 0) {
+        if (algo_lib::_db.tempstr_stats_on && &pool == &algo_lib::_db.temppool) {
+            ind_beg(algo_lib::FTemppool_spill_curs, str, pool) {
+                pool.stats.pool_bytes -= str.ch_max;
+            }ind_end;
+        }
+        spill_RemoveAll(pool);
     }
 }
 
@@ -751,6 +972,16 @@ static algo::NumParseFlags ParseNumber(StringIter &S, u64 &result) {
             overflow |= num<prev;
         }
     } else {
+        // 8 digits at a time, while the result cannot overflow
+        while (index + 8 <= elems_N(expr) && num < 184467440737ULL) {
+            u32 ok;
+            u32 val = ParseNum8(ReadBE64(expr.elems + index), ok);
+            if (!ok) {
+                break;
+            }
+            num = num*100000000 + val;
+            index += 8;
+        }
         for (; index < elems_N(expr); index++) {
             c = expr[index];
             if (!algo_lib::DigitCharQ(c)) {
@@ -929,96 +1160,140 @@ bool algo::TryParseFraction(StringIter &S, double &result) {
     return true;
 }
 
+// Powers of 10 that are exactly representable as double
+static const double pow10_exact[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Accumulate a run of decimal digits starting at INDEX into MANT,
+// keeping at most 19 significant digits (NDIG).
+// For fraction digits (FRAC=true), each kept digit decrements EXP10;
+// for integer digits, each dropped digit increments it.
+// A dropped non-zero digit sets INEXACT.
+// Return number of digits scanned.
+static int ScanMantissa(strptr expr, int &index, u64 &mant, int &ndig, int &exp10, bool &inexact, bool frac) {
+    int start = index;
+    int limit = elems_N(expr);
+    while (index + 8 <= limit && ndig <= 11) {
+        u32 ok;
+        u32 val = ParseNum8(ReadBE64(expr.elems + index), ok);
+        if (!ok) {
+            break;
+        }
+        if (mant == 0) {
+            for (u32 v = val; v; v /= 10) {
+                ndig++;
+            }
+        } else {
+            ndig += 8;
+        }
+        mant   = mant*100000000 + val;
+        exp10 -= frac ? 8 : 0;
+        index += 8;
+    }
+    for (; index < limit && algo_lib::DigitCharQ(expr[index]); index++) {
+        int d = expr[index] - '0';
+        if (ndig < 19) {
+            ndig  += (mant || d);
+            mant   = mant*10 + d;
+            exp10 -= frac;
+        } else {
+            inexact |= d != 0;
+            exp10   += !frac;
+        }
+    }
+    return index - start;
+}
+
+// Correctly rounded conversion of unsigned decimal number STR
+static double StrtodStrptr(strptr str) {
+    char buf[64];
+    if (elems_N(str) < int(sizeof(buf))) {
+        memcpy(buf, str.elems, elems_N(str));
+        buf[elems_N(str)] = 0;
+        return strtod(buf, NULL);
+    }
+    return strtod(Zeroterm(tempstr() << str), NULL);
+}
+
+// Parse a decimal floating-point number: [ws][+-]digits[.digits][(e|E)[+-]digits][B|M]
+// Suffix B multiplies the result by 1e9, M by 1e6.
+// Up to 19 significant digits are accumulated into an integer mantissa.
+// When the mantissa fits in 53 bits and the exponent is within [-22,22],
+// the result is computed with a single exactly-rounded multiply or divide;
+// otherwise the scanned text is converted with strtod.
+// Either way, the result is the correctly rounded value.
 bool algo::TryParseDouble(algo::StringIter &iter, double &result) {
-    int limit = elems_N(iter.expr);
+    strptr expr = iter.expr;
+    int limit = elems_N(expr);
     // skip whitespace
-    while(iter.index < limit) {
-        int c = iter.expr[iter.index];
+    while (iter.index < limit) {
+        int c = expr[iter.index];
         if (c==' '||c=='\n'||c=='\r'||c=='\t') {
             iter.index++;
-            continue;
         } else {
             break;
         }
     }
-    char c;
-    int old_index = iter.index;
-    if (iter.index == limit) {
+    int index = iter.index;
+    if (index == limit) {
         return false;
     }
     // skip prefix - or +
-    c = iter.expr[iter.index];
     bool isneg = false;
-    if (c == '-') {
-        isneg=true;
-        iter.index++;
-        if (iter.index == limit) {
-            iter.index = old_index;
-            return false;
+    if (expr[index] == '-' || expr[index] == '+') {
+        isneg = expr[index] == '-';
+        index++;
+    }
+    int numstart = index;
+    u64 mant     = 0;
+    int ndig     = 0;
+    int exp10    = 0;
+    bool inexact = false;
+    int nint     = ScanMantissa(expr, index, mant, ndig, exp10, inexact, false);
+    int nfrac    = 0;
+    if (index < limit && expr[index] == '.') {
+        index++;
+        nfrac = ScanMantissa(expr, index, mant, ndig, exp10, inexact, true);
+    }
+    if (nint == 0 && nfrac == 0) {
+        return false;
+    }
+    if (index < limit && (expr[index] == 'e' || expr[index] == 'E')) {    // e+123 or e-123
+        index++;
+        bool neg = false;
+        if (index < limit && (expr[index] == '+' || expr[index] == '-')) {
+            neg = expr[index] == '-';
+            index++;
         }
-        c = iter.expr[iter.index];
-    } else if (c == '+') {
-        iter.index++;
-        if (iter.index == limit) {
-            iter.index = old_index;
+        if (!(index < limit && algo_lib::DigitCharQ(expr[index]))) {
             return false;
         }
-        c = iter.expr[iter.index];
+        int exp = 0;
+        for (; index < limit && algo_lib::DigitCharQ(expr[index]); index++) {
+            exp = exp < 100000 ? exp*10 + (expr[index] - '0') : exp;
+        }
+        exp10 += neg ? -exp : exp;
     }
     double num;
-    if (TryParseDigits(iter, num)) { // 0123.456
-        if (SkipChar(iter, '.')) {
-            double frac;
-            if (TryParseFraction(iter,frac)) {
-                num+=frac;
-            }
-        }
-    } else if (c=='.') {    // .456
-        iter.index++;
-        if (!TryParseFraction(iter,num)) {
-            iter.index = old_index;
-            return false;
-        }
+    if (mant == 0) {
+        num = 0;
+    } else if (!inexact && mant <= (u64(1) << 53) && exp10 >= -22 && exp10 <= 22) {
+        num = exp10 < 0 ? double(mant) / pow10_exact[-exp10] : double(mant) * pow10_exact[exp10];
     } else {
-        iter.index=old_index;    // error
-        return false;
-    }
-    if (iter.index < limit) {    // e+123 or e-123
-        c = iter.expr[iter.index];
-        if (c == 'e' || c == 'E') {
-            iter.index++;
-            bool neg=false;
-            if (iter.index < limit) {
-                c = iter.expr[iter.index];
-                if (c == '+') {
-                    iter.index++;
-                } else if (c == '-') {
-                    iter.index++;
-                    neg=true;
-                }
-            }
-            if (!algo_lib::DigitCharQ(iter.Peek())) {
-                iter.index = old_index;
-                return false;
-            }
-            double exp;
-            if (TryParseDigits(iter, exp)) {
-                num *= pow(10.,double_NegateIf(exp,neg));
-            } else {
-                iter.index = old_index;
-                return false;
-            }
+        num = StrtodStrptr(qGetRegion(expr, numstart, index - numstart));
+    }
+    if (index < limit) {
+        if (expr[index] == 'B') {
+            num *= 1e9;
+            index++;
+        } else if (expr[index] == 'M') {
+            num *= 1e6;
+            index++;
         }
     }
-    switch (iter.Peek()) {
-    case 'B':
-        num *= 1e9;
-        goto found_scaling_factor;
-    case 'M':
-        num *= 1e6;
-    found_scaling_factor:
-        iter.GetChar();
-    }
+    iter.index = index;
     result = isneg ? -num : num;    // return result (maybe negate)
     return true;
 }
@@ -1239,9 +1514,14 @@ void algo::Word_curs_Next(Word_curs &curs) {
 bool algo::StripTypeTag(strptr &in_str, strptr typetag) {
     StringIter iter(in_str);
     iter.Ws();             // skip leading whitespace
-    strptr w = GetWordCharf(iter); // read next word
-    bool retval = w == typetag;    // compare
+    strptr rest = iter.Rest();
+    int n = elems_N(typetag);
+    // compare next word without scanning it first
+    bool retval = elems_N(rest) >= n
+        && FirstN(rest, n) == typetag
+        && (elems_N(rest) == n || algo_lib::WhiteCharQ(rest[n]));
     if (retval) {
+        iter.index += n;
         iter.Ws();      // skip subsequent whitespace
         in_str = iter.Rest();   // save rest of string
     }
@@ -1396,6 +1676,54 @@ void algo::Attr_curs_Next(Attr_curs &curs) {
 
 // -----------------------------------------------------------------------------
 
+// Read attribute NAME at the current position of ITER, the way Attr_curs would,
+// and return its value in VALUE.
+// Unquoted values and quoted values without escapes are returned as substrings
+// of the input; only escaped values are decoded into BUF.
+// If the next attribute is not NAME, or it's malformed, return false.
+// This is the basis of the in-order fast path of generated ssim readers.
+bool algo::SsimAttrExpect(StringIter &iter, strptr name, strptr &value, cstring &buf) {
+    iter.Ws();
+    strptr rest = iter.Rest();
+    bool ret = elems_N(rest) > elems_N(name)
+        && rest[elems_N(name)] == ':'
+        && FirstN(rest, elems_N(name)) == name;
+    if (ret) {
+        iter.index += elems_N(name) + 1;
+        int from = iter.index;
+        char quote = iter.Peek();
+        if (quote == '"' || quote == '\'') {
+            int i = from + 1;
+            for (; i < elems_N(iter.expr); i++) {
+                char c = iter.expr[i];
+                if (c == quote || c == '\\' || algo_lib::NewLineCharQ(c)) {
+                    break;
+                }
+            }
+            if (i < elems_N(iter.expr) && iter.expr[i] == quote) {
+                value = qGetRegion(iter.expr, from + 1, i - from - 1);
+                iter.index = i + 1;
+            } else {
+                ret = cstring_ReadCmdarg(buf, iter, true);
+                value = buf;
+            }
+        } else {
+            int len = FindFirstInCharset(iter.Rest(), algo_lib::_db.SsimBreakValueNib);
+            iter.index = len == -1 ? elems_N(iter.expr) : from + len;
+            value = qGetRegion(iter.expr, from, iter.index - from);
+        }
+    }
+    return ret;
+}
+
+// True if ITER has no more attributes (only whitespace or a comment remains)
+bool algo::SsimAttrEndQ(StringIter &iter) {
+    iter.Ws();
+    return iter.EofQ() || iter.Peek() == '#';
+}
+
+// -----------------------------------------------------------------------------
+
 // Compare two strings whose start address is 16-byte aligned
 // Do not use this function --
 bool algo::AlignedEqual(strptr a, strptr b) {
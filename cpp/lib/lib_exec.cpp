@@ -70,6 +70,7 @@ static void ShowOutput(lib_exec::FSyscmd &cmd) {
     // Dump stderr.
     // Remove stdout, stderr files
     if (show_out) {
+        algo_lib::FlushLog();
         (void)algo::CopyFd(cmd.stdout_fd.fd, Fildes(1));
         Refurbish(cmd.stdout_fd);
     }
@@ -350,6 +350,7 @@ static void Connect(URL &url, strptr db) {
                                          , 0);
     if (!connect_ok && ER_BAD_DB_ERROR == mysql_errno(lib_mysql::_db.mysql) && mysql2ssim::_db.cmdline.baddbok) {
         // quietly finish with success, nothing to do
+        algo_lib::FlushLog();
         _exit(0);
     }
     vrfy(connect_ok,mysql_error(lib_mysql::_db.mysql));
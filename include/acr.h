@@ -40,6 +40,12 @@ namespace acr { // update-hdr
     // -------------------------------------------------------------------
     // cpp/acr/check.cpp
     //
+
+    // With -check -changed, save stamps of ssimfiles that passed the check
+    // (ssimfiles that were loaded and selected entirely, see FSsimfile.check_all),
+    // for use by the next -changed. A -check without -changed writes nothing.
+    // Called after the -write step (if any), so that rewritten files get their new stamps.
+    void WriteCheckStamps();
     void Main_Check();
 
     // -------------------------------------------------------------------
@@ -79,14 +85,45 @@ namespace acr { // update-hdr
     // I see it is being implemented in three different places
     tempstr EvalAttr(Tuple &tuple, acr::FField &field);
 
+    // Same as above, but the value is written to caller-owned string RET,
+    // whose buffer can be reused from one call to the next.
+    void EvalAttr(Tuple &tuple, acr::FField &field, cstring &ret);
+
     // -------------------------------------------------------------------
     // cpp/acr/load.cpp -- Load files
     //
 
+    // Remember LINE, the input line from which record REC was read,
+    // so that acr::WriteFiles can copy it back if the record is not modified.
+    // The line is kept only if it is what printing the record would produce
+    // (up to quoting and spacing, see CanonAttrsQ).
+    // NATTR is the number of attributes on the line.
+    void SetOrigline(acr::FRec &rec, strptr line, int nattr);
+
     // Load input records for ssimfile SSIMFILE
     // and create an approprate FILE record.
+    // If the ssimfile was parsed by acr::LoadStaged, staged tuples are used.
+    // A partially loaded ssimfile (see acr::LoadPkey) is completed.
     void LoadSsimfile(acr::FSsimfile& ssimfile);
 
+    // Discard records of ssimfile SSIMFILE and unmap the file,
+    // so that the next acr::LoadSsimfile reads it again.
+    // Used by the query server (see acr::Main_Serve) when the file changes.
+    void UnloadSsimfile(acr::FSsimfile &ssimfile);
+
+    // Number of threads to use for N independent units of work (see -nthread)
+    int Nthread(int n);
+
+    // Queue ssimfile SSIMFILE for loading by acr::LoadStaged
+    void StageSsimfile(acr::FSsimfile &ssimfile);
+
+    // Load all ssimfiles queued with acr::StageSsimfile.
+    // With more than one thread (see -nthread), the files are read and parsed
+    // into per-file staging arrays by loader threads; the calling thread
+    // then inserts staged tuples in queue order, so the resulting database
+    // (rowids, file order) is the same as with sequential loading.
+    void LoadStaged();
+
     // Read lines from input text file IN
     // Associate loaded records with record FILE.
     void ReadLines(acr::FFile &file, algo_lib::InTextFile &in);
@@ -111,12 +148,52 @@ namespace acr { // update-hdr
     // cached lookup
     // ignore:ptr_byref
     void LookupField(acr::FRec &rec, strptr fieldname, acr::FCtype *&prev_ctype, acr::FField *&prev_field);
+
+    // Execute command line acr::_db.cmdline.
+    // The schema must already be loaded (see acr::Main).
+    // The query server (see acr::Main_Serve) calls this once per request,
+    // in a child process.
+    void Main_Query();
     void Main();
 
+    // -------------------------------------------------------------------
+    // cpp/acr/pkeyidx.cpp -- Sidecar pkey index, demand-driven load
+    //
+
+    // True if records of SSIMFILE that are not yet in memory
+    // should be loaded one by one using acr::LoadPkey
+    bool LazyLoadQ(acr::FSsimfile &ssimfile);
+
+    // Number of records in SSIMFILE according to its pkey index.
+    // SSIMFILE must have a usable index (e.g. be partially loaded).
+    u32 LazyNrec(acr::FSsimfile &ssimfile);
+
+    // Records of a partially loaded ssimfile are loaded out of order.
+    // Move record REC, which was just loaded, within list of records of its ctype
+    // so that the list is in rowid order -- the same order as with a full load.
+    void PlaceRec(acr::FRec &rec);
+
+    // Find record of CTYPE with primary key PKEY, loading it from disk if necessary.
+    // If the ssimfile has a usable pkey index, only the line defining the record is parsed;
+    // otherwise the whole ssimfile is loaded.
+    acr::FRec *LoadPkey(acr::FCtype &ctype, strptr pkey);
+
+    // Make sure all records of CTYPE whose primary key starts with PREFIX are in memory.
+    void LoadPkeyPrefix(acr::FCtype &ctype, strptr prefix);
+
+    // Make sure all records of FIELD's ctype where FIELD has value VALUE are in memory.
+    // FIELD must reference an ssimfile.
+    void LoadFieldValue(acr::FField &field, strptr value);
+
     // -------------------------------------------------------------------
     // cpp/acr/print.cpp
     //
 
+    // Initialize RANK field for every known ctype, unless already done.
+    // The query server (see acr::Main_Serve) does this before forking,
+    // so that request processes don't have to.
+    void InitCtypeRank();
+
     // Print selected records using formatting options
     // specified on command line.
     void Print(acr::FPrint &print);
@@ -129,6 +206,11 @@ namespace acr { // update-hdr
     // cpp/acr/run.cpp -- Run query
     //
 
+    // Discard value indexes of CTYPE's fields, and resolved references
+    // of CTYPE and of ctypes that reference CTYPE (see XrefBuild).
+    // Must be called whenever a record of CTYPE is created, deleted, or modified.
+    void AttrvalInvalidate(acr::FCtype &ctype);
+
     // Visit all records matching QUERY.
     // Perform actions specified bu QUERY -- rename, delete, select, etc.
     // For selection:
@@ -136,6 +218,19 @@ namespace acr { // update-hdr
     // Matching records are added to zd_all_selrec index;
     // Matching ssimfiles are added to db.c_sel_ctype index.
     void RunQuery(acr::FQuery &query);
+
+    // Add time elapsed since START (value of get_cycles) to T
+    void AddTime(algo::UnDiff &t, u64 start);
+
+    // Print query statistics (see -stats)
+    void PrintStats(report::acr_query &stats);
+
+    // Print statistics of the entire invocation (see -stats)
+    void PrintStatsTotal();
+
+    // Run all scheduled queries (see acr::RunQuery).
+    // Consecutive select queries with identical ssimfile and ctype expressions
+    // (such as those created by -meta) are run as one batch (see RunBatch).
     void RunAllQueries();
 
     // -------------------------------------------------------------------
@@ -159,6 +254,19 @@ namespace acr { // update-hdr
     // Select only records in the error set
     void SelectErrRecs();
 
+    // -------------------------------------------------------------------
+    // cpp/acr/serve.cpp -- Query server and client
+    //
+
+    // Have the query server at -server execute this invocation, if the server
+    // is running and the invocation is servable (see ServableQ).
+    // Return true if the server executed it; exit code is then in algo_lib::_db.exit_code.
+    // If the server cannot be reached, nothing happens and the caller runs the query itself.
+    bool Main_Client();
+
+    // Serve queries on Unix socket -serve until interrupted (see top of file).
+    void Main_Serve();
+
     // -------------------------------------------------------------------
     // cpp/acr/verb.cpp -- Command-line verbs
     //
@@ -173,6 +281,8 @@ namespace acr { // update-hdr
     void Main_Browser();
 
     // Select ctypes of selected records, deselect records themselves
+    // One query is created per ctype, and all of them are run as a batch
+    // (see acr::RunAllQueries)
     void Main_SelectMeta();
     void Main_AcrEdit();
 
@@ -459,8 +459,11 @@ inline algo::SchedTime operator -  (const algo::SchedTime &a, algo::SchedTime d)
 
 
 // move ctor
-inline algo::tempstr::tempstr(const tempstr &rhs) : algo::cstring(rhs) {
+inline algo::tempstr::tempstr(const tempstr &rhs) : algo::cstring() {
     tempstr &r  = (tempstr&) rhs;
+    ch_elems    = r.ch_elems;
+    ch_n        = r.ch_n;
+    ch_max      = r.ch_max;
     r.ch_elems     = 0;
     r.ch_n   = 0;
     r.ch_max = 0;
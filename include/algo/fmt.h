@@ -69,6 +69,7 @@ namespace algo { // update-hdr srcfile:%/algo/fmt.%
     void Ptr_Print(void *ptr, cstring &out);
 
     // pads with zeros on the left so that at least 'atleast' characters are output.
+    // the minus sign, if any, counts towards 'atleast' and precedes the zeros.
     void i64_PrintPadLeft(i64 num, cstring &out, int atleast);
 
     // Assuming SRC is a number, Transfer SRC to OUT, inserting
@@ -73,6 +73,18 @@ namespace algo {
         const char *crange;
     };
 
+    // -----------------------------------------------------------------------------
+    // Radix sort / parallel sort support (see cpp/lib/algo/sort.cpp)
+    // Key extracted from array element IDX, sorted by algo_lib::RadixSortKeys.
+    struct RadixKey {
+        u64 key;
+        u32 idx;
+    };
+    // Sort N elements at ELEMS in place.
+    typedef void (*SortRunFcn)(void *elems, int n);
+    // Merge sorted runs A (NA elements) and B (NB elements) into DST.
+    typedef void (*MergeRunsFcn)(void *dst, void *a, int na, void *b, int nb);
+
     // -----------------------------------------------------------------------------
 
     template<class T>
@@ -465,6 +477,30 @@ namespace algo_lib { // update-hdr
     // Die when parent process dies
     void DieWithParent();
 
+    // Mark the calling thread as a worker thread.
+    // Worker threads may allocate strings (algo_lib.FDb.lpool has per-thread magazines),
+    // use tempstr (each thread has its own pool; see Temppool in string.cpp),
+    // and modify rows that no other thread touches.
+    // Everything else in algo_lib::_db, including prlog/prerr/verblog,
+    // vrfy/errtext and exit_code, belongs to the main thread.
+    // algo::Prlog kills the process if called on a worker thread.
+    void BeginWorker();
+
+    // Return cached strings to the shared pool; call before the worker thread exits
+    void EndWorker();
+
+    // True if the calling thread is between algo_lib::BeginWorker and algo_lib::EndWorker
+    bool WorkerQ();
+
+    // Configure huge page backing of big sbrk blocks (2MB and up) from environment
+    // variable ALGO_HUGEPAGE, a comma-separated list of:
+    // hugetlb   try explicit huge pages (MAP_HUGETLB) first
+    // thp       use transparent huge pages (madvise MADV_HUGEPAGE)
+    // numa      bind big blocks to the NUMA node of the calling cpu
+    // If huge pages are not available, blocks are silently backed by regular pages.
+    // (called from algo_lib::Init)
+    void InitHugepage();
+
     // Create temporary file
     // tempfile.fildes points to the new temp file after this
     // temp file is created under temp/
@@ -507,6 +543,21 @@ namespace algo_lib { // update-hdr
     // This function is used by amc for process startup
     bool DoLoadTuples(strptr root, bool (*LoadFunc)(strptr), const char **ssimfiles, bool strict);
 
+    // Append row image of a tuple read by a generated InsertStrptrMaybe
+    // to the snapshot being recorded. TABLE_ID -1 means ROW is the tuple text.
+    // Records are 8-byte aligned.
+    void SnapRecord(i32 table_id, const void *row, int size);
+
+    // Same as DoLoadTuples, but with -snap, when ROOT is a directory and temp/ exists,
+    // load inputs from binary snapshot temp/<NS>.<HASH>.ssimsnap instead of parsing text,
+    // where HASH is a hash of ROOT (so that alternating data sets don't evict each other).
+    // The snapshot is valid for one input SIGNATURE (computed by amc) and one set of
+    // ssimfile sizes and modification times; if it's missing or stale, tuples are
+    // loaded from text while InsertStrptrMaybe records the parsed rows, and
+    // the snapshot is rewritten.
+    // SnapFunc is the generated InsertSnapMaybe for the namespace.
+    bool DoLoadTuplesSnap(strptr root, strptr ns, strptr signature, bool (*LoadFunc)(strptr), bool (*SnapFunc)(i32, algo::memptr), const char **ssimfiles, bool strict);
+
     // Return TRUE if current user is root.
     // #AL# is this more correct than checking that effective uid is 0?
     bool RootQ();
@@ -523,6 +574,11 @@ namespace algo_lib { // update-hdr
     // cpp/lib/algo/line.cpp -- Line processing
     //
 
+    // Prepare FILE to read from FD, releasing the previous file and mapping,
+    // and any buffered partial line. The input mode is selected again on the next read.
+    // If OWN_FD is set, FD is closed when FILE is cleaned up or re-opened.
+    void InTextFile_Open(algo_lib::InTextFile &file, algo::Fildes fd, bool own_fd);
+
     // Read next line from FILE into RESULT
     // When end of file is reached, return FALSE.
     // If error occurs during reading, return false.
@@ -533,6 +589,9 @@ namespace algo_lib { // update-hdr
     // <do something with LINE>
     // }
     // A partial line at the end of the file is returned.
+    // Regular files are mapped into memory (see InTextFile_Start);
+    // other inputs are read through a buffer that starts at 64KB and doubles
+    // each time a read fills it, up to FILE.BUFSIZE (see -linebuf).
     bool ReadLine(algo_lib::InTextFile &file, algo::strptr &result);
 
     // -------------------------------------------------------------------
@@ -577,6 +636,29 @@ namespace algo_lib { // update-hdr
     // Return success code.
     bool MmapFile_Load(MmapFile &mmapfile, strptr fname);
 
+    // -------------------------------------------------------------------
+    // cpp/lib/algo/prlog.cpp -- prlog macro
+    //
+
+    // Write out all pending prlog output.
+    // Must be called before any code that writes to fd 1 or 2 bypassing prlog,
+    // and before _exit(). Process exit (FDb_Uninit) and fork() do this automatically.
+    void FlushLog();
+
+    // Write out pending prlog output and switch all fds to write-through mode.
+    // This is the -unbuffered behavior; it is also applied in a child process after fork(),
+    // since children typically leave via _exit() and would lose buffered output.
+    void UnbufferLog();
+
+    // Set up prlog buffering policy (called from algo_lib::FDb_Init)
+    // stdout is fully buffered unless it is a terminal, in which case each
+    // line is written out as it's printed.
+    // stderr is never buffered.
+    void InitLogbuf();
+
+    // Flush prlog output at exit
+    void logbuf_Cleanup();
+
     // -------------------------------------------------------------------
     // cpp/lib/algo/regx.cpp -- Sql Regx implementation
     //
@@ -609,6 +691,31 @@ namespace algo_lib { // update-hdr
     // Check if string contains a SQL regular expression
     bool SqlRegxQ(strptr s);
 
+    // -------------------------------------------------------------------
+    // cpp/lib/algo/sort.cpp -- Radix sort and parallel sort engines
+    //
+
+    // Stable LSD radix sort of N keys by KEYS[i].key, 11 bits per pass (6 passes max).
+    // TMP is scratch space of the same size as KEYS.
+    // Passes in which all keys have the same digit are skipped, so sorting
+    // small integers or strings with a common prefix costs few passes.
+    // On return, KEYS points to the sorted array and TMP to the other buffer.
+    void RadixSortKeys(algo::RadixKey *&keys, algo::RadixKey *&tmp, int n);
+
+    // Extract 8-byte word WORD of string S as a big-endian radix key.
+    // Characters are compared as char (same as strptr_Lt); missing characters
+    // are zero. The caller breaks ties between a string and its zero-padded
+    // extension by also sorting on the length (as the least significant word).
+    u64 RadixKeyStr(algo::strptr s, int word);
+
+    // Sort N elements of size ELEMSIZE at ELEMS using multiple threads.
+    // The array is split into one run per thread (runs are at least MIN_RUN elements);
+    // each run is sorted with SORTFCN, then runs are merged pairwise with MERGEFCN,
+    // each level of merges also executing in parallel, ping-ponging between ELEMS
+    // and a scratch buffer. Small arrays are sorted with SORTFCN in the calling thread.
+    // SORTFCN and MERGEFCN must not touch any shared state.
+    void ParallelSort(void *elems, int n, int elemsize, algo::SortRunFcn sortfcn, algo::MergeRunsFcn mergefcn);
+
     // -------------------------------------------------------------------
     // cpp/lib/algo/string.cpp -- cstring functions
     //
@@ -646,6 +753,11 @@ namespace algo_lib { // update-hdr
     // write tuple back.
     // return resulting string
     tempstr Tuple_Subst(algo_lib::Replscope &R, strptr text);
+
+    // Start collecting algo_lib::_db.temppool.stats (tempstr pool of the main thread).
+    // Counting is off by default, since tempstr is constructed on every hot path;
+    // pool_bytes and peak_bytes start from the bytes parked at this point.
+    void TempstrStatsEnable();
     void RunCsvParse(algo_lib::CsvParse &parsecsv);
 
     // -------------------------------------------------------------------
@@ -33,5 +33,16 @@ namespace algo { // update-hdr srcfile:%/algo/prlog.%
     // -------------------------------------------------------------------
     // cpp/lib/algo/prlog.cpp -- prlog macro
     //
+
+    // Output of prlog/prerr for fd FD.
+    // STR is the log buffer; bytes starting at index START are written out,
+    // (with a newline appended if EOL is set), after which STR is truncated back to START.
+    // If FD has a buffer (see InitLogbuf), output is accumulated and written out
+    // when the buffer reaches its threshold. Otherwise, all buffered output is
+    // written out first, so that e.g. stdout and stderr stay in order when both
+    // go to the same file, and then STR is written directly.
+    // The message string (algo_lib::_db.log_str) and the per-fd buffers are process-global
+    // and not locked: prlog, prerr, verblog etc. may only be used by the main thread.
+    // Worker threads (see algo_lib::BeginWorker) record their results, and the main thread prints them.
     void Prlog(int fd, cstring &str, int start, bool eol);
 }
@@ -126,6 +126,21 @@ namespace algo {
         operator strptr() const { return strptr((char*)ch_elems,ch_n); }
     };
 
+    // -----------------------------------------------------------------------------
+    // TempstrScope:
+    // Buffers released by tempstr are parked in per-size-class free lists
+    // of the calling thread's pool (algo_lib::_db.temppool for the main thread;
+    // other threads get their own pool, freed at thread exit).
+    // When a class is full, or the buffer is over 64KB, the buffer is normally freed.
+    // While a TempstrScope is open, such buffers are instead parked in a spill list,
+    // so a hot loop that needs more temporaries than the pool holds
+    // stops allocating after the first iteration.
+    // The spill list is released when the outermost scope closes.
+    struct TempstrScope {
+        TempstrScope();
+        ~TempstrScope();
+    };
+
     // -----------------------------------------------------------------------------
     // string descriptor, used for testing of amc-generated strings
 
@@ -287,6 +302,24 @@ namespace algo { // update-hdr srcfile:'(%/algo/string.%|%/algo/line.%)'
     int FindFrom(strptr s, strptr t, int from, bool case_sensitive);
     int FindFrom(strptr s, char c, int from);
 
+    // Build nibble lookup tables for charset CS.
+    // Each high nibble H selects a row: the set of low nibbles L such that H*16+L is in CS.
+    // Every distinct non-empty row is given a bit; HI[H] holds the bit of H's row,
+    // and LO[L] holds the bits of all rows that contain L.
+    // Byte C is in CS iff LO[C&15] & HI[C>>4] is non-zero.
+    // There are at most 16 distinct rows; rows 8..15 go to the second table pair.
+    void CharsetNibble_Build(algo::CharsetNibble &nib, algo::Charset &cs);
+
+    // Return index of first character of S that belongs to the charset
+    // described by NIB, or -1 if there is none.
+    // With SSE, 16 characters are classified per step using PSHUFB lookups.
+    int FindFirstInCharset(strptr s, algo::CharsetNibble &nib);
+
+    // Return index of first character of S that belongs to CS, or -1 if there is none.
+    // Lookup tables are built on each call; to scan with the same charset repeatedly,
+    // build an algo::CharsetNibble once and use the overload above.
+    int FindFirstInCharset(strptr s, algo::Charset &cs);
+
     // Search for character/string from left to right
     // If found, return index where match occurs.
     // If not found, return -1
@@ -357,6 +390,14 @@ namespace algo { // update-hdr srcfile:'(%/algo/string.%|%/algo/line.%)'
     // Read a series of digits N, returning N / pow(10, length(N))
     // If successful, advance index. Otherwise, leave index where it was.
     bool TryParseFraction(StringIter &S, double &result);
+
+    // Parse a decimal floating-point number: [ws][+-]digits[.digits][(e|E)[+-]digits][B|M]
+    // Suffix B multiplies the result by 1e9, M by 1e6.
+    // Up to 19 significant digits are accumulated into an integer mantissa.
+    // When the mantissa fits in 53 bits and the exponent is within [-22,22],
+    // the result is computed with a single exactly-rounded multiply or divide;
+    // otherwise the scanned text is converted with strtod.
+    // Either way, the result is the correctly rounded value.
     bool TryParseDouble(algo::StringIter &iter, double &result);
 
     // Search for the next occurence of SEP. If not found, assume it occurs at EOF
@@ -439,6 +480,17 @@ namespace algo { // update-hdr srcfile:'(%/algo/string.%|%/algo/line.%)'
     void Attr_curs_Reset(Attr_curs &curs, strptr line);
     void Attr_curs_Next(Attr_curs &curs);
 
+    // Read attribute NAME at the current position of ITER, the way Attr_curs would,
+    // and return its value in VALUE.
+    // Unquoted values and quoted values without escapes are returned as substrings
+    // of the input; only escaped values are decoded into BUF.
+    // If the next attribute is not NAME, or it's malformed, return false.
+    // This is the basis of the in-order fast path of generated ssim readers.
+    bool SsimAttrExpect(StringIter &iter, strptr name, strptr &value, cstring &buf);
+
+    // True if ITER has no more attributes (only whitespace or a comment remains)
+    bool SsimAttrEndQ(StringIter &iter);
+
     // Compare two strings whose start address is 16-byte aligned
     // Do not use this function --
     bool AlignedEqual(strptr a, strptr b);
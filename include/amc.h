@@ -187,6 +187,13 @@ namespace amc { // update-hdr
     // void tfunc_Bheap_Uninit();
     // void tfunc_Bheap_ElemLt();
     // void tfunc_Bheap_ElemLtval();
+
+    // Comparison of heap array elements, used by d-ary heaps.
+    // Inline keys are compared directly without touching the rows.
+    // void tfunc_Bheap_HeapLt();
+
+    // Heap array element with inline copy of the sort key
+    // void tfunc_Bheap_elem();
     // void tfunc_Bheap_unordcurs();
     // void tfunc_Bheap_curs();
 
@@ -235,6 +242,54 @@ namespace amc { // update-hdr
     // void tfunc_Blkpool_FreeMem();
     // void tfunc_Blkpool_Init();
 
+    // -------------------------------------------------------------------
+    // cpp/amc/btree.cpp -- B+tree index
+    //
+    //     (user-implemented function, prototype is in amc-generated header)
+    // void tclass_Btree();
+
+    // Node layout. max_keys is computed by the C++ compiler so that
+    // the node occupies approximately 256 bytes.
+    // void tfunc_Btree_node();
+    // void tfunc_Btree_Init();
+    // void tfunc_Btree_Uninit();
+    // void tfunc_Btree_AllocNode();
+    // void tfunc_Btree_FreeNode();
+
+    // Insert node RIGHT into the parent of LEFT immediately after LEFT,
+    // splitting the parent if it is full. When the root is split, the tree grows by one level.
+    // void tfunc_Btree_InsertChild();
+
+    // Unlink empty node from the leaf list and from its parent, then free it.
+    // A parent left without children is removed in the same way.
+    // void tfunc_Btree_RemoveNode();
+    // void tfunc_Btree_FindLeaf();
+    // void tfunc_Btree_Find();
+    // void tfunc_Btree_LowerBound();
+    // void tfunc_Btree_First();
+    // void tfunc_Btree_Last();
+    // void tfunc_Btree_EmptyQ();
+    // void tfunc_Btree_N();
+    // void tfunc_Btree_InTreeQ();
+
+    // Rows with equal keys are kept in insertion order.
+    // void tfunc_Btree_Insert();
+
+    // The row is located through its leaf pointer, so its key is not consulted.
+    // If the root is left with a single child, the tree shrinks by one level.
+    // void tfunc_Btree_Remove();
+
+    // Detach all rows from the tree, then free the nodes.
+    // Rows are detached before any of them is deleted, so that xref removal
+    // triggered by the deletion finds them already out of the tree.
+    // void tfunc_Btree_RemoveAllImpl();
+    // void tfunc_Btree_Cascdel();
+    // void tfunc_Btree_RemoveAll();
+    // void tfunc_Btree_RemoveFirst();
+    // void tfunc_Btree_Reinsert();
+    // void tfunc_Btree_curs();
+    // void tfunc_Btree_rcurs();
+
     // -------------------------------------------------------------------
     // cpp/amc/cget.cpp
     //
@@ -691,6 +746,12 @@ namespace amc { // update-hdr
     // void tfunc_Global_LoadTuplesMaybe();
     // void tfunc_Global_SaveTuples();
     // void tfunc_Global_InsertStrptrMaybe();
+
+    // Counterpart of InsertStrptrMaybe for binary snapshots:
+    // row image recorded by InsertStrptrMaybe is copied into the base type
+    // and passed to the same input function.
+    // Tables whose base type is not plain are recorded as text and don't appear here.
+    // void tfunc_Global_InsertSnapMaybe();
     // void tfunc_Global_InitReflection();
     // void tfunc_Global_LoadSsimfileMaybe();
     // void tfunc_Global_main();
@@ -821,6 +882,27 @@ namespace amc { // update-hdr
     // -------------------------------------------------------------------
     // cpp/amc/lary.cpp
     //
+
+    // Return Lary pool of CTYPE, or NULL if there is none
+    amc::FField *LaryColumnPool(amc::FCtype &ctype);
+
+    // Return field of CTYPE tagged with dmmeta.rowid, or NULL if there is none
+    amc::FField *LaryRowidField(amc::FCtype &ctype);
+
+    // True if some field of CTYPE is stored in a column (see dmmeta.fcolumn)
+    bool HasColumnQ(amc::FCtype &ctype);
+
+    // Check that column field FIELD can be stored in a separate array of its pool.
+    // The row must be created only through a Lary, must have a rowid field
+    // through which the column is indexed, and the value must be cheap to copy.
+    bool CheckFcolumnQ(amc::FField &field);
+
+    // Member initializer list of the default constructor of CTYPE, binding
+    // each column field (a reference) to its slot in the column arrays.
+    // Rows are constructed only by the Lary's AllocMaybe, after AllocMem has
+    // bumped the element count, so the new row's id is <pool>_N() - 1.
+    // Return empty string if CTYPE has no columns.
+    tempstr LaryColumnCtorInit(amc::FCtype &ctype);
     //     (user-implemented function, prototype is in amc-generated header)
     // void tclass_Lary();
     // void tfunc_Lary_AllocMem();
@@ -877,6 +959,7 @@ namespace amc { // update-hdr
     // void tfunc_Lpool_ReserveBuffers();
     // void tfunc_Lpool_ReallocMem();
     // void tfunc_Lpool_Init();
+    // void tfunc_Lpool_FlushMag();
     // void tfunc_Lpool_N();
 
     // -------------------------------------------------------------------
@@ -904,6 +987,10 @@ namespace amc { // update-hdr
     // True if ctype is instantiated through a memory pool.
     bool HasPoolQ(amc::FCtype &ctype);
     bool HasFinputsQ(amc::FNs &ns);
+
+    // True if values of CTYPE can be saved and restored as raw bytes:
+    // every field is stored in-place and recursively consists of built-in types.
+    bool PlainQ(amc::FCtype &ctype);
     tempstr PkeyCppident(algo::Tuple &tuple);
     amc::FField *FirstInst(amc::FCtype &ctype);
     bool DirectStepQ(amc::FFstep &fstep);
@@ -1317,6 +1404,11 @@ namespace amc { // update-hdr
     // void tfunc_Sort_InsertionSort();
     // void tfunc_Sort_HeapSort();
     // void tfunc_Sort_QuickSort();
+    // void tfunc_Sort_RadixKey();
+    // void tfunc_Sort_RadixSort();
+    // void tfunc_Sort_SortRun();
+    // void tfunc_Sort_MergeRuns();
+    // void tfunc_Sort_ParallelSort();
 
     // -------------------------------------------------------------------
     // cpp/amc/step.cpp
@@ -1416,6 +1508,7 @@ namespace amc { // update-hdr
     // void tfunc_Thash_Find();
     // void tfunc_Thash_FindX();
     // void tfunc_Thash_Reserve();
+    // void tfunc_Thash_Rehash();
     // void tfunc_Thash_GetOrCreate();
     // void tfunc_Thash_N();
     // void tfunc_Thash_EmptyQ();
@@ -1437,6 +1530,7 @@ namespace amc { // update-hdr
     // void tfunc_Tpool_AllocMem();
     // void tfunc_Tpool_FreeMem();
     // void tfunc_Tpool_Init();
+    // void tfunc_Tpool_FlushMag();
 
     // -------------------------------------------------------------------
     // cpp/amc/trace.cpp -- Generate trace code
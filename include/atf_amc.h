@@ -61,6 +61,15 @@ namespace atf_amc { // update-hdr
     // void amctest_BhFirstChanged2();
     // void amctest_BhFirstChanged3();
 
+    // Apply random inserts, removals and key changes to a 4-ary heap
+    // with inline keys and an 8-ary pointer heap, and cross-check them against
+    // the binary heap
+    // void amctest_BheapDary();
+
+    // Time a scheduler-like workload on each heap flavor in turn:
+    // remove first element, assign it a later key and put it back.
+    // void amctest_PerfBheapDary();
+
     // -------------------------------------------------------------------
     // cpp/atf/amc/bigend.cpp
     //
@@ -83,6 +92,14 @@ namespace atf_amc { // update-hdr
     // void amctest_BitfldNet();
     // void amctest_BitfldTuple();
 
+    // -------------------------------------------------------------------
+    // cpp/atf/amc/btree.cpp
+    //
+    //     (user-implemented function, prototype is in amc-generated header)
+    // void amctest_Btree();
+    // void amctest_BtreeCurs();
+    // void amctest_PerfBtree();
+
     // -------------------------------------------------------------------
     // cpp/atf/amc/cascdel.cpp
     //
@@ -125,6 +142,12 @@ namespace atf_amc { // update-hdr
     // bheap
     // void amctest_CascdelAtree();
 
+    // btree
+    // void amctest_CascdelBtree();
+
+    // btree - chain
+    // void amctest_CascdelBtreeChain();
+
     // -------------------------------------------------------------------
     // cpp/atf/amc/cdlist.cpp
     //
@@ -395,6 +418,13 @@ namespace atf_amc { // update-hdr
     //     (user-implemented function, prototype is in amc-generated header)
     // void amctest_Inlary_ReadPrint();
 
+    // -------------------------------------------------------------------
+    // cpp/atf/amc/lary.cpp
+    //
+    //     (user-implemented function, prototype is in amc-generated header)
+    // void amctest_LaryColumn();
+    // void amctest_PerfLaryColumn();
+
     // -------------------------------------------------------------------
     // cpp/atf/amc/lineiter.cpp
     //
@@ -407,6 +437,12 @@ namespace atf_amc { // update-hdr
     //     (user-implemented function, prototype is in amc-generated header)
     // void amctest_Lpool();
 
+    // -------------------------------------------------------------------
+    // cpp/atf/amc/magazine.cpp
+    //
+    //     (user-implemented function, prototype is in amc-generated header)
+    // void amctest_MagazineMT();
+
     // -------------------------------------------------------------------
     // cpp/atf/amc/main.cpp
     //
@@ -521,6 +557,8 @@ namespace atf_amc { // update-hdr
     //     (user-implemented function, prototype is in amc-generated header)
     // void amctest_AmcSort();
     // void amctest_PerfSortString();
+    // void amctest_AmcSortRadix();
+    // void amctest_AmcSortParallel();
 
     // -------------------------------------------------------------------
     // cpp/atf/amc/strconv.cpp
@@ -538,6 +576,23 @@ namespace atf_amc { // update-hdr
     // void amctest_TaryInit4();
     // void amctest_TaryReserve();
 
+    // -------------------------------------------------------------------
+    // cpp/atf/amc/thash.cpp
+    //
+    //     (user-implemented function, prototype is in amc-generated header)
+    // void amctest_ThashCachehash();
+    // void amctest_ThashOpenaddr();
+    // void amctest_PerfThash();
+    // void amctest_ThashIncremental();
+    // void amctest_PerfThashIncremental();
+
+    // Rows [0,n) and their index ind_hugerow are allocated with regular pages,
+    // rows [n,2n) and ind_hugerow_thp with transparent huge pages.
+    // With 32MB of rows and 32MB of buckets per index, lookups with regular pages
+    // miss the TLB on nearly every probe.
+    // To compare whole-process behavior, run atf_amc with ALGO_HUGEPAGE=thp instead.
+    // void amctest_PerfHugepage();
+
     // -------------------------------------------------------------------
     // cpp/atf/amc/varlen.cpp
     //
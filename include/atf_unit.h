@@ -84,12 +84,42 @@ namespace atf_unit { // update-hdr
     // Check that with -print:N, nothing is shown
     // void unittest_acr_Read5();
 
+    // Check counters printed by -stats for an indexed and a scanning query
+    // (times are not compared)
+    // void unittest_acr_Stats1();
+
+    // Check that -maxgroup limits the size of an aligned block
+    // void unittest_acr_Maxgroup1();
+
+    // Check non-pkey selection by prefix and with wildcards (uses value index)
+    // void unittest_acr_Read6();
+
+    // Check that loading ssimfiles on parallel loader threads
+    // gives the same result as sequential loading
+    // void unittest_acr_Nthread1();
+
+    // Check that loading records by pkey (using sidecar index)
+    // gives the same result as loading entire ssimfiles
+    // void unittest_acr_Lazy1();
+
+    // Selecting all records of a ctype loads referencing ssimfiles in full
+    // instead of key by key; output is the same
+    // void unittest_acr_Lazy2();
+
     // Test re-writing a single file specified with -in
     // void unittest_acr_Write1();
 
     // Test re-writing a single file back in tree mode
     // void unittest_acr_Write2();
 
+    // Check that saving a data set, where unmodified records are copied
+    // from the input file, gives the same result as printing every record (-check -write)
+    // void unittest_acr_Write3();
+
+    // Check that -write preserves the spacing of unmodified lines in a file with edits,
+    // and normalizes a file without edits
+    // void unittest_acr_Write4();
+
     // Test that -insert -trunc removes all existing records of a given type
     // upon first insertion
     // void unittest_acr_Insert1();
@@ -100,6 +130,20 @@ namespace atf_unit { // update-hdr
     // Check that acr detects bad references.
     // void unittest_acr_Check1();
 
+    // Check that -check -changed skips ssimfiles that haven't changed since the last
+    // successful check, and checks records that reference a changed ssimfile.
+    // A plain -check leaves no stamps.
+    // void unittest_acr_Check2();
+
+    // Check that -check on multiple threads reports the same records and errors
+    // as a single thread, on the full data set and on a copy with bad references
+    // void unittest_acr_Check3();
+
+    // Start a query server on a copy of data, and check that it answers
+    // (the client doesn't load anything itself) and picks up a changed ssimfile.
+    // The socket is private to the owner, and -check always runs locally.
+    // void unittest_acr_Serve1();
+
     // Check that -unused deselects records that are referred to
     // void unittest_acr_Unused1();
 
@@ -130,6 +174,10 @@ namespace atf_unit { // update-hdr
     // so for this query we use the default data set instead of good old temp/x.
     // void unittest_acr_Meta1();
 
+    // Check -meta on records of several ctypes:
+    // the ctype queries are run as one batch, with the same result as running them one by one
+    // void unittest_acr_Meta2();
+
     // -------------------------------------------------------------------
     // cpp/atf/unit/algo_fmt.cpp
     //
@@ -227,6 +275,11 @@ namespace atf_unit { // update-hdr
     // void unittest_algo_lib_PerfIntrinsics();
     // void unittest_algo_lib_PerfTruncVsFtol();
     // void unittest_algo_lib_PerfParseDouble();
+
+    // Compare number parsing and printing against the C library:
+    // doubles must be bit-identical to strtod (correctly rounded),
+    // integers must round-trip and match snprintf.
+    // void unittest_algo_lib_ParseNumberExact();
     // void unittest_algo_lib_PerfSort();
     // void unittest_algo_lib_Replscope();
     // void unittest_algo_lib_AvlvsMap();
@@ -236,6 +289,24 @@ namespace atf_unit { // update-hdr
     // void unittest_algo_lib_TrimZerosRight();
     // void unittest_algo_lib_PrintWithCommas();
 
+    // Redirect stdout to a temp file, print lines through a buffered logbuf,
+    // check that the output is intact and took few write calls.
+    // void unittest_algo_lib_PrlogBuffered();
+
+    // Check that tempstr buffers are recycled through the size-classed pool,
+    // that a TempstrScope absorbs nesting deeper than the pool,
+    // and that buffers over the size cap are not pooled.
+    // void unittest_algo_lib_TempstrPool();
+
+    // Each thread has its own tempstr pool:
+    // threads don't disturb each other or the main thread's pool
+    // void unittest_algo_lib_TempstrThread();
+
+    // With -snap, a binary input snapshot is written after a text load, replaces the text load
+    // while inputs are unchanged, and is discarded once an input file changes.
+    // Each data set gets its own snapshot; without -snap, everything goes through text.
+    // void unittest_algo_lib_SsimSnapshot();
+
     // -------------------------------------------------------------------
     // cpp/atf/unit/bash.cpp
     //
@@ -248,6 +319,13 @@ namespace atf_unit { // update-hdr
     //     (user-implemented function, prototype is in amc-generated header)
     // void unittest_algo_lib_Charset();
 
+    // Compare SIMD charset search against a plain bit test,
+    // for random charsets of varying density (including ones with >8 distinct nibble rows)
+    // void unittest_algo_lib_CharsetFindFirst();
+
+    // Throughput of ssim token scanning and tuple parsing over a large ssimfile
+    // void unittest_algo_lib_PerfCharsetScan();
+
     // -------------------------------------------------------------------
     // cpp/atf/unit/lib_exec.cpp
     //
@@ -443,6 +521,9 @@ namespace atf_unit { // update-hdr
     //
     //     (user-implemented function, prototype is in amc-generated header)
     // void unittest_algo_lib_Argtuple_ReadArgv();
+
+    // Built-in option -linebuf takes its value as -linebuf:N or as -linebuf N
+    // void unittest_algo_lib_Argtuple_Linebuf();
     // void unittest_algo_lib_Argtuple_ReadStrptr();
     // void unittest_algo_lib_Argtuple2();
     // void unittest_algo_lib_Tuple1();
@@ -450,4 +531,13 @@ namespace atf_unit { // update-hdr
 
     // Check Attr_curs
     // void unittest_algo_lib_Tuple();
+
+    // Generated ssim reader must produce the same result as the generic
+    // attribute loop, whether or not it can take the in-order path
+    // void unittest_algo_lib_SsimReadInorder();
+
+    // Compare generated ssim reader with the generic attribute loop.
+    // Cost of line iteration and row construction is measured separately
+    // and excluded from the reported speedup.
+    // void unittest_algo_lib_PerfSsimRead();
 }
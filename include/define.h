@@ -204,6 +204,8 @@
 #define MULTICHAR_CONST3(b,c,d)   (          (b)<<16 | (c)<<8 | (d))
 #define MULTICHAR_CONST4(a,b,c,d) ((a)<<24 | (b)<<16 | (c)<<8 | (d))
 
+// prlog and friends format into a process-global string and buffer
+// (see algo::Prlog); call them only from the main thread.
 #define log_msg_(fd,x,eol)            {                 \
         algo::cstring &_outstr = algo_lib::_db.log_str; \
         int _saved = ch_N(_outstr);                     \
@@ -114,6 +114,7 @@ namespace abt { struct _db_arch_curs; }
 namespace abt { struct _db_ind_arch_curs; }
 namespace abt { struct _db_bh_syscmd_curs; }
 namespace abt { struct _db_bh_syscmd_unordcurs; }
+namespace abt { struct _db_bh_syscmd_elem; }
 namespace abt { struct _db_zs_srcfile_read_curs; }
 namespace abt { struct _db_zs_sel_target_curs; }
 namespace abt { struct _db_zsl_libdep_visited_curs; }
@@ -242,99 +243,99 @@ void                 trace_Print(abt::trace & row, algo::cstring &str) __attribu
 // --- abt.FDb
 // create: abt.FDb._db (Global)
 struct FDb { // abt.FDb
-    lpool_Lpblock*      lpool_free[31];               // Lpool levels
-    command::abt        cmdline;                      //
-    abt::FSrcfile*      srcfile_lary[32];             // level array
-    i32                 srcfile_n;                    // number of elements in array
-    abt::FTargdep*      targdep_lary[32];             // level array
-    i32                 targdep_n;                    // number of elements in array
-    abt::FToolOpt*      tool_opt_lary[32];            // level array
-    i32                 tool_opt_n;                   // number of elements in array
-    abt::FTarget**      ind_target_buckets_elems;     // pointer to bucket array
-    i32                 ind_target_buckets_n;         // number of elements in bucket array
-    i32                 ind_target_n;                 // number of elements in the hash table
-    abt::FTarget*       target_lary[32];              // level array
-    i32                 target_n;                     // number of elements in array
-    abt::FCompiler*     c_compiler;                   // optional pointer
-    abt::FTargsrc**     ind_targsrc_buckets_elems;    // pointer to bucket array
-    i32                 ind_targsrc_buckets_n;        // number of elements in bucket array
-    i32                 ind_targsrc_n;                // number of elements in the hash table
-    abt::FTargsrc*      targsrc_lary[32];             // level array
-    i32                 targsrc_n;                    // number of elements in array
-    abt::FSyscmddep*    syscmddep_lary[32];           // level array
-    i32                 syscmddep_n;                  // number of elements in array
-    abt::FSyscmd*       syscmd_lary[32];              // level array
-    i32                 syscmd_n;                     // number of elements in array
-    abt::FSyscmd**      ind_syscmd_buckets_elems;     // pointer to bucket array
-    i32                 ind_syscmd_buckets_n;         // number of elements in bucket array
-    i32                 ind_syscmd_n;                 // number of elements in the hash table
-    abt::FSyscmd**      ind_running_buckets_elems;    // pointer to bucket array
-    i32                 ind_running_buckets_n;        // number of elements in bucket array
-    i32                 ind_running_n;                // number of elements in the hash table
-    abt::FSrcfile**     ind_srcfile_buckets_elems;    // pointer to bucket array
-    i32                 ind_srcfile_buckets_n;        // number of elements in bucket array
-    i32                 ind_srcfile_n;                // number of elements in the hash table
-    abt::FCfg*          cfg_lary[32];                 // level array
-    i32                 cfg_n;                        // number of elements in array
-    abt::FCfg**         ind_cfg_buckets_elems;        // pointer to bucket array
-    i32                 ind_cfg_buckets_n;            // number of elements in bucket array
-    i32                 ind_cfg_n;                    // number of elements in the hash table
-    abt::FUname*        uname_lary[32];               // level array
-    i32                 uname_n;                      // number of elements in array
-    abt::FUname**       ind_uname_buckets_elems;      // pointer to bucket array
-    i32                 ind_uname_buckets_n;          // number of elements in bucket array
-    i32                 ind_uname_n;                  // number of elements in the hash table
-    abt::FCompiler*     compiler_lary[32];            // level array
-    i32                 compiler_n;                   // number of elements in array
-    abt::FCompiler**    ind_compiler_buckets_elems;   // pointer to bucket array
-    i32                 ind_compiler_buckets_n;       // number of elements in bucket array
-    i32                 ind_compiler_n;               // number of elements in the hash table
-    abt::FArch*         arch_lary[32];                // level array
-    i32                 arch_n;                       // number of elements in array
-    abt::FArch**        ind_arch_buckets_elems;       // pointer to bucket array
-    i32                 ind_arch_buckets_n;           // number of elements in bucket array
-    i32                 ind_arch_n;                   // number of elements in the hash table
-    abt::FSyscmd**      bh_syscmd_elems;              // binary heap by execkey
-    i32                 bh_syscmd_n;                  // number of elements in the heap
-    i32                 bh_syscmd_max;                // max elements in bh_syscmd_elems
-    abt::FSrcfile*      zs_srcfile_read_head;         // zero-terminated singly linked list
-    abt::FSrcfile*      zs_srcfile_read_tail;         // pointer to last element
-    abt::FTarget*       zs_sel_target_head;           // zero-terminated singly linked list
-    i32                 zs_sel_target_n;              // zero-terminated singly linked list
-    abt::FTarget*       zs_sel_target_tail;           // pointer to last element
-    report::abt         report;                       //
-    abt::FTarget*       zsl_libdep_visited_head;      // zero-terminated singly linked list
-    abt::FTarget*       zsl_libdep_head;              // zero-terminated singly linked list
-    abt::FTargsyslib*   targsyslib_lary[32];          // level array
-    i32                 targsyslib_n;                 // number of elements in array
-    abt::FSyslib*       syslib_lary[32];              // level array
-    i32                 syslib_n;                     // number of elements in array
-    abt::FSyslib**      ind_syslib_buckets_elems;     // pointer to bucket array
-    i32                 ind_syslib_buckets_n;         // number of elements in bucket array
-    i32                 ind_syslib_n;                 // number of elements in the hash table
-    abt::FInclude*      include_lary[32];             // level array
-    i32                 include_n;                    // number of elements in array
-    abt::FInclude**     ind_include_buckets_elems;    // pointer to bucket array
-    i32                 ind_include_buckets_n;        // number of elements in bucket array
-    i32                 ind_include_n;                // number of elements in the hash table
-    algo::cstring*      sysincl_elems;                // pointer to elements
-    u32                 sysincl_n;                    // number of elements in array
-    u32                 sysincl_max;                  // max. capacity of array before realloc
-    abt::FTarget*       zs_origsel_target_head;       // zero-terminated singly linked list
-    abt::FTarget*       zs_origsel_target_tail;       // pointer to last element
-    abt::FNs*           ns_lary[32];                  // level array
-    i32                 ns_n;                         // number of elements in array
-    abt::FNs**          ind_ns_buckets_elems;         // pointer to bucket array
-    i32                 ind_ns_buckets_n;             // number of elements in bucket array
-    i32                 ind_ns_n;                     // number of elements in the hash table
-    bool                ccache;                       //   false
-    bool                gcache;                       //   false
-    abt::FFilestat*     filestat_lary[32];            // level array
-    i32                 filestat_n;                   // number of elements in array
-    abt::FFilestat**    ind_filestat_buckets_elems;   // pointer to bucket array
-    i32                 ind_filestat_buckets_n;       // number of elements in bucket array
-    i32                 ind_filestat_n;               // number of elements in the hash table
-    abt::trace          trace;                        //
+    lpool_Lpblock*        lpool_free[31];               // Lpool levels
+    command::abt          cmdline;                      //
+    abt::FSrcfile*        srcfile_lary[32];             // level array
+    i32                   srcfile_n;                    // number of elements in array
+    abt::FTargdep*        targdep_lary[32];             // level array
+    i32                   targdep_n;                    // number of elements in array
+    abt::FToolOpt*        tool_opt_lary[32];            // level array
+    i32                   tool_opt_n;                   // number of elements in array
+    abt::FTarget**        ind_target_buckets_elems;     // pointer to bucket array
+    i32                   ind_target_buckets_n;         // number of elements in bucket array
+    i32                   ind_target_n;                 // number of elements in the hash table
+    abt::FTarget*         target_lary[32];              // level array
+    i32                   target_n;                     // number of elements in array
+    abt::FCompiler*       c_compiler;                   // optional pointer
+    abt::FTargsrc**       ind_targsrc_buckets_elems;    // pointer to bucket array
+    i32                   ind_targsrc_buckets_n;        // number of elements in bucket array
+    i32                   ind_targsrc_n;                // number of elements in the hash table
+    abt::FTargsrc*        targsrc_lary[32];             // level array
+    i32                   targsrc_n;                    // number of elements in array
+    abt::FSyscmddep*      syscmddep_lary[32];           // level array
+    i32                   syscmddep_n;                  // number of elements in array
+    abt::FSyscmd*         syscmd_lary[32];              // level array
+    i32                   syscmd_n;                     // number of elements in array
+    abt::FSyscmd**        ind_syscmd_buckets_elems;     // pointer to bucket array
+    i32                   ind_syscmd_buckets_n;         // number of elements in bucket array
+    i32                   ind_syscmd_n;                 // number of elements in the hash table
+    abt::FSyscmd**        ind_running_buckets_elems;    // pointer to bucket array
+    i32                   ind_running_buckets_n;        // number of elements in bucket array
+    i32                   ind_running_n;                // number of elements in the hash table
+    abt::FSrcfile**       ind_srcfile_buckets_elems;    // pointer to bucket array
+    i32                   ind_srcfile_buckets_n;        // number of elements in bucket array
+    i32                   ind_srcfile_n;                // number of elements in the hash table
+    abt::FCfg*            cfg_lary[32];                 // level array
+    i32                   cfg_n;                        // number of elements in array
+    abt::FCfg**           ind_cfg_buckets_elems;        // pointer to bucket array
+    i32                   ind_cfg_buckets_n;            // number of elements in bucket array
+    i32                   ind_cfg_n;                    // number of elements in the hash table
+    abt::FUname*          uname_lary[32];               // level array
+    i32                   uname_n;                      // number of elements in array
+    abt::FUname**         ind_uname_buckets_elems;      // pointer to bucket array
+    i32                   ind_uname_buckets_n;          // number of elements in bucket array
+    i32                   ind_uname_n;                  // number of elements in the hash table
+    abt::FCompiler*       compiler_lary[32];            // level array
+    i32                   compiler_n;                   // number of elements in array
+    abt::FCompiler**      ind_compiler_buckets_elems;   // pointer to bucket array
+    i32                   ind_compiler_buckets_n;       // number of elements in bucket array
+    i32                   ind_compiler_n;               // number of elements in the hash table
+    abt::FArch*           arch_lary[32];                // level array
+    i32                   arch_n;                       // number of elements in array
+    abt::FArch**          ind_arch_buckets_elems;       // pointer to bucket array
+    i32                   ind_arch_buckets_n;           // number of elements in bucket array
+    i32                   ind_arch_n;                   // number of elements in the hash table
+    _db_bh_syscmd_elem*   bh_syscmd_elems;              // 4-ary heap by execkey
+    i32                   bh_syscmd_n;                  // number of elements in the heap
+    i32                   bh_syscmd_max;                // max elements in bh_syscmd_elems
+    abt::FSrcfile*        zs_srcfile_read_head;         // zero-terminated singly linked list
+    abt::FSrcfile*        zs_srcfile_read_tail;         // pointer to last element
+    abt::FTarget*         zs_sel_target_head;           // zero-terminated singly linked list
+    i32                   zs_sel_target_n;              // zero-terminated singly linked list
+    abt::FTarget*         zs_sel_target_tail;           // pointer to last element
+    report::abt           report;                       //
+    abt::FTarget*         zsl_libdep_visited_head;      // zero-terminated singly linked list
+    abt::FTarget*         zsl_libdep_head;              // zero-terminated singly linked list
+    abt::FTargsyslib*     targsyslib_lary[32];          // level array
+    i32                   targsyslib_n;                 // number of elements in array
+    abt::FSyslib*         syslib_lary[32];              // level array
+    i32                   syslib_n;                     // number of elements in array
+    abt::FSyslib**        ind_syslib_buckets_elems;     // pointer to bucket array
+    i32                   ind_syslib_buckets_n;         // number of elements in bucket array
+    i32                   ind_syslib_n;                 // number of elements in the hash table
+    abt::FInclude*        include_lary[32];             // level array
+    i32                   include_n;                    // number of elements in array
+    abt::FInclude**       ind_include_buckets_elems;    // pointer to bucket array
+    i32                   ind_include_buckets_n;        // number of elements in bucket array
+    i32                   ind_include_n;                // number of elements in the hash table
+    algo::cstring*        sysincl_elems;                // pointer to elements
+    u32                   sysincl_n;                    // number of elements in array
+    u32                   sysincl_max;                  // max. capacity of array before realloc
+    abt::FTarget*         zs_origsel_target_head;       // zero-terminated singly linked list
+    abt::FTarget*         zs_origsel_target_tail;       // pointer to last element
+    abt::FNs*             ns_lary[32];                  // level array
+    i32                   ns_n;                         // number of elements in array
+    abt::FNs**            ind_ns_buckets_elems;         // pointer to bucket array
+    i32                   ind_ns_buckets_n;             // number of elements in bucket array
+    i32                   ind_ns_n;                     // number of elements in the hash table
+    bool                  ccache;                       //   false
+    bool                  gcache;                       //   false
+    abt::FFilestat*       filestat_lary[32];            // level array
+    i32                   filestat_n;                   // number of elements in array
+    abt::FFilestat**      ind_filestat_buckets_elems;   // pointer to bucket array
+    i32                   ind_filestat_buckets_n;       // number of elements in bucket array
+    i32                   ind_filestat_n;               // number of elements in the hash table
+    abt::trace            trace;                        //
 };
 
 // Free block of memory previously returned by Lpool.
@@ -576,6 +577,8 @@ void                 StaticCheck();
 // Parse strptr into known type and add to database.
 // Return value is true unless an error occurs. If return value is false, algo_lib::_db.errtext has error text
 bool                 InsertStrptrMaybe(algo::strptr str);
+// Insert row image from binary input snapshot.
+bool                 InsertSnapMaybe(i32 table_id, algo::memptr row);
 // Load all finputs from given directory.
 bool                 LoadTuplesMaybe(algo::strptr root) __attribute__((nothrow));
 // Load specified ssimfile.
@@ -2256,6 +2259,14 @@ struct _db_bh_syscmd_curs {
 };
 
 
+struct _db_bh_syscmd_elem {// heap element with inline key (abt.FDb.bh_syscmd)
+    i64 key; // copy of row's execkey
+    abt::FSyscmd* row;
+    _db_bh_syscmd_elem() : row(NULL) {}
+    _db_bh_syscmd_elem(const i64 &in_key, abt::FSyscmd *in_row) : key(in_key), row(in_row) {}
+};
+
+
 struct _db_zs_srcfile_read_curs {// cursor
     typedef abt::FSrcfile ChildType;
     abt::FSrcfile* row;
@@ -642,7 +642,7 @@ inline bool abt::bh_syscmd_EmptyQ() {
 inline abt::FSyscmd* abt::bh_syscmd_First() {
     abt::FSyscmd *row = NULL;
     if (_db.bh_syscmd_n > 0) {
-        row = _db.bh_syscmd_elems[0];
+        row = _db.bh_syscmd_elems[0].row;
     }
     return row;
 }
@@ -363,6 +363,8 @@ void                 StaticCheck();
 // Parse strptr into known type and add to database.
 // Return value is true unless an error occurs. If return value is false, algo_lib::_db.errtext has error text
 bool                 InsertStrptrMaybe(algo::strptr str);
+// Insert row image from binary input snapshot.
+bool                 InsertSnapMaybe(i32 table_id, algo::memptr row);
 // Load all finputs from given directory.
 bool                 LoadTuplesMaybe(algo::strptr root) __attribute__((nothrow));
 // Load specified ssimfile.
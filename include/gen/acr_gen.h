@@ -69,6 +69,7 @@ enum acr_TableIdEnum {                    // acr.TableId.value
 enum { acr_TableIdEnum_N = 22 };
 
 namespace dmmeta { struct Anonfld; }
+namespace acr { struct FField; }
 namespace amcdb { struct Bltin; }
 namespace dmmeta { struct Cdflt; }
 namespace dmmeta { struct Cppfunc; }
@@ -87,6 +88,7 @@ namespace dmmeta { struct Ssimsort; }
 namespace dmmeta { struct Substr; }
 namespace acr { struct CtypeTopoKey; }
 namespace acr { struct FAnonfld; }
+namespace acr { struct FAttrval; }
 namespace acr { struct FBltin; }
 namespace acr { struct FCdflt; }
 namespace acr { struct FCheck; }
@@ -95,25 +97,30 @@ namespace acr { struct trace; }
 namespace acr { struct FDb; }
 namespace acr { struct FErr; }
 namespace acr { struct FEvalattr; }
-namespace acr { struct FField; }
 namespace acr { struct FFunique; }
 namespace acr { struct FPdep; }
+namespace acr { struct FPkeybuild; }
+namespace acr { struct FPkeyent; }
 namespace acr { struct PlineKey; }
 namespace acr { struct FPrintAttr; }
 namespace acr { struct Queryop; }
+namespace acr { struct FRun; }
 namespace acr { struct FQuery; }
 namespace acr { struct RecSortkey; }
-namespace acr { struct FRun; }
 namespace acr { struct FSmallstr; }
 namespace acr { struct FSsimfile; }
 namespace acr { struct FSsimsort; }
+namespace acr { struct FStagerow; }
 namespace acr { struct FSubstr; }
 namespace acr { struct FTempkey; }
 namespace acr { struct FUniqueattr; }
 namespace acr { struct FWrite; }
 namespace acr { struct FieldId; }
+namespace acr { struct PkeyidxEnt; }
+namespace acr { struct PkeyidxFld; }
+namespace acr { struct PkeyidxHdr; }
 namespace acr { struct TableId; }
-namespace acr { struct check_c_bad_rec_curs; }
+namespace acr { struct attrval_c_rec_curs; }
 namespace acr { struct check_ary_name_curs; }
 namespace acr { struct ctype_c_field_curs; }
 namespace acr { struct ctype_zd_trec_curs; }
@@ -121,9 +128,11 @@ namespace acr { struct ctype_ind_rec_curs; }
 namespace acr { struct ctype_zd_selrec_curs; }
 namespace acr { struct ctype_c_child_curs; }
 namespace acr { struct ctype_zd_arg_curs; }
+namespace acr { struct ctype_c_bad_rec_curs; }
 namespace acr { struct _db_zd_pline_curs; }
 namespace acr { struct _db_zd_pdep_curs; }
 namespace acr { struct _db_ctype_curs; }
+namespace acr { struct _db_ctype_check_curs; }
 namespace acr { struct _db_anonfld_curs; }
 namespace acr { struct _db_cdflt_curs; }
 namespace acr { struct _db_field_curs; }
@@ -151,14 +160,27 @@ namespace acr { struct _db_bltin_curs; }
 namespace acr { struct _db_bh_ctype_topo_curs; }
 namespace acr { struct _db_bh_ctype_topo_unordcurs; }
 namespace acr { struct _db_cppfunc_curs; }
+namespace acr { struct _db_c_stage_curs; }
+namespace acr { struct _db_c_check_curs; }
+namespace acr { struct _db_watch_ns_curs; }
+namespace acr { struct field_ind_attrval_curs; }
+namespace acr { struct field_tr_attrval_curs; }
+namespace acr { struct field_c_bad_rec_curs; }
 namespace acr { struct file_zd_frec_curs; }
+namespace acr { struct pkeybuild_ent_curs; }
+namespace acr { struct pkeybuild_ref_curs; }
 namespace acr { struct pline_zd_child_curs; }
 namespace acr { struct print_ind_printattr_curs; }
 namespace acr { struct print_c_pline_curs; }
+namespace acr { struct print_c_ctype_curs; }
 namespace acr { struct run_c_ctype_curs; }
 namespace acr { struct run_c_field_curs; }
 namespace acr { struct run_c_rec_curs; }
 namespace acr { struct run_c_child_curs; }
+namespace acr { struct run_c_query_curs; }
+namespace acr { struct run_c_match_curs; }
+namespace acr { struct rec_c_parent_curs; }
+namespace acr { struct ssimfile_stagerow_curs; }
 namespace acr { struct write_c_cmtrec_curs; }
 namespace acr {
 }//pkey typedefs
@@ -218,6 +240,71 @@ private:
 void                 anonfld_CopyIn(acr::FAnonfld &row, dmmeta::Anonfld &in) __attribute__((nothrow));
 
 
+// --- acr.FAttrval
+// create: acr.FDb.attrval (Tpool)
+// access: acr.FField.ind_attrval (Thash)
+// access: acr.FField.tr_attrval (Atree)
+struct FAttrval { // acr.FAttrval: Secondary index entry: records of one ctype with the same value of one field
+    algo::cstring    value;              // Attribute value, as computed by EvalAttr
+    acr::FField*     p_field;            // reference to parent row
+    acr::FRec**      c_rec_elems;        // array of pointers
+    u32              c_rec_n;            // array of pointers
+    u32              c_rec_max;          // capacity of allocated array
+    acr::FAttrval*   attrval_next;       // Pointer to next free element int tpool
+    acr::FAttrval*   ind_attrval_next;   // hash next
+    acr::FAttrval*   tr_attrval_up;      // pointer to parent
+    acr::FAttrval*   tr_attrval_left;    // Left child
+    acr::FAttrval*   tr_attrval_right;   // Right child
+    i32              tr_attrval_depth;   // Depth
+private:
+    friend acr::FAttrval&       attrval_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend acr::FAttrval*       attrval_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 attrval_Delete(acr::FAttrval &row) __attribute__((nothrow));
+    FAttrval();
+    ~FAttrval();
+    FAttrval(const FAttrval&){ /*disallow copy constructor */}
+    void operator =(const FAttrval&){ /*disallow direct assignment */}
+};
+
+// Compare two fields. Comparison is anti-symmetric: if a>b, then !(b>a).
+bool                 value_Lt(acr::FAttrval& attrval, acr::FAttrval &rhs) __attribute__((nothrow));
+// Compare two fields.
+i32                  value_Cmp(acr::FAttrval& attrval, acr::FAttrval &rhs) __attribute__((nothrow));
+
+// Return true if index is empty
+bool                 c_rec_EmptyQ(acr::FAttrval& attrval) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FRec*           c_rec_Find(acr::FAttrval& attrval, u32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array of pointers
+algo::aryptr<acr::FRec*> c_rec_Getary(acr::FAttrval& attrval) __attribute__((nothrow));
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void                 c_rec_Insert(acr::FAttrval& attrval, acr::FRec& row) __attribute__((nothrow));
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool                 c_rec_ScanInsertMaybe(acr::FAttrval& attrval, acr::FRec& row) __attribute__((nothrow));
+// Return number of items in the pointer array
+i32                  c_rec_N(const acr::FAttrval& attrval) __attribute__((__warn_unused_result__, nothrow, pure));
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void                 c_rec_Remove(acr::FAttrval& attrval, acr::FRec& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 c_rec_RemoveAll(acr::FAttrval& attrval) __attribute__((nothrow));
+// Reserve space in index for N more elements;
+void                 c_rec_Reserve(acr::FAttrval& attrval, u32 n) __attribute__((nothrow));
+
+void                 attrval_c_rec_curs_Reset(attrval_c_rec_curs &curs, acr::FAttrval &parent);
+// cursor points to valid item
+bool                 attrval_c_rec_curs_ValidQ(attrval_c_rec_curs &curs);
+// proceed to next item
+void                 attrval_c_rec_curs_Next(attrval_c_rec_curs &curs);
+// item access
+acr::FRec&           attrval_c_rec_curs_Access(attrval_c_rec_curs &curs);
+// Set all fields to initial values.
+void                 FAttrval_Init(acr::FAttrval& attrval);
+void                 FAttrval_Uninit(acr::FAttrval& attrval) __attribute__((nothrow));
+
 // --- acr.FBltin
 // create: acr.FDb.bltin (Lary)
 // access: acr.FCtype.c_bltin (Ptr)
@@ -269,46 +356,19 @@ void                 FCdflt_Uninit(acr::FCdflt& cdflt) __attribute__((nothrow));
 // --- acr.FCheck
 // create: acr.FDb.check (Cppstack)
 struct FCheck { // acr.FCheck: Function to check for consistency
-    acr::FRec**      c_bad_rec_elems;   // array of pointers
-    u32              c_bad_rec_n;       // array of pointers
-    u32              c_bad_rec_max;     // capacity of allocated array
-    u32              n_record;          //   0
-    i32              n_err;             //   0
-    algo::cstring*   ary_name_elems;    // pointer to elements
-    u32              ary_name_n;        // number of elements in array
-    u32              ary_name_max;      // max. capacity of array before realloc
+    u32              n_record;         //   0
+    i32              n_err;            //   0
+    algo::cstring*   ary_name_elems;   // pointer to elements
+    u32              ary_name_n;       // number of elements in array
+    u32              ary_name_max;     // max. capacity of array before realloc
     FCheck();
     ~FCheck();
 private:
-    // reftype of acr.FCheck.c_bad_rec prohibits copy
     // reftype of acr.FCheck.ary_name prohibits copy
     FCheck(const FCheck&){ /*disallow copy constructor */}
     void operator =(const FCheck&){ /*disallow direct assignment */}
 };
 
-// Return true if index is empty
-bool                 c_bad_rec_EmptyQ(acr::FCheck& check) __attribute__((nothrow));
-// Look up row by row id. Return NULL if out of range
-acr::FRec*           c_bad_rec_Find(acr::FCheck& check, u32 t) __attribute__((__warn_unused_result__, nothrow));
-// Return array of pointers
-algo::aryptr<acr::FRec*> c_bad_rec_Getary(acr::FCheck& check) __attribute__((nothrow));
-// Insert pointer to row into array. Row must not already be in array.
-// If pointer is already in the array, it may be inserted twice.
-void                 c_bad_rec_Insert(acr::FCheck& check, acr::FRec& row) __attribute__((nothrow));
-// Insert pointer to row in array.
-// If row is already in the array, do nothing.
-// Linear search is used to locate the element.
-// Return value: whether element was inserted into array.
-bool                 c_bad_rec_ScanInsertMaybe(acr::FCheck& check, acr::FRec& row) __attribute__((nothrow));
-// Return number of items in the pointer array
-i32                  c_bad_rec_N(const acr::FCheck& check) __attribute__((__warn_unused_result__, nothrow, pure));
-// Find element using linear scan. If element is in array, remove, otherwise do nothing
-void                 c_bad_rec_Remove(acr::FCheck& check, acr::FRec& row) __attribute__((nothrow));
-// Empty the index. (The rows are not deleted)
-void                 c_bad_rec_RemoveAll(acr::FCheck& check) __attribute__((nothrow));
-// Reserve space in index for N more elements;
-void                 c_bad_rec_Reserve(acr::FCheck& check, u32 n) __attribute__((nothrow));
-
 // Reserve space. Insert element at the end
 // The new element is initialized to a default value
 algo::cstring&       ary_name_Alloc(acr::FCheck& check) __attribute__((__warn_unused_result__, nothrow));
@@ -347,13 +407,6 @@ algo::cstring&       ary_name_qLast(acr::FCheck& check) __attribute__((nothrow))
 // Return row id of specified element
 u64                  ary_name_rowid_Get(acr::FCheck& check, algo::cstring &elem) __attribute__((nothrow));
 
-void                 check_c_bad_rec_curs_Reset(check_c_bad_rec_curs &curs, acr::FCheck &parent);
-// cursor points to valid item
-bool                 check_c_bad_rec_curs_ValidQ(check_c_bad_rec_curs &curs);
-// proceed to next item
-void                 check_c_bad_rec_curs_Next(check_c_bad_rec_curs &curs);
-// item access
-acr::FRec&           check_c_bad_rec_curs_Access(check_c_bad_rec_curs &curs);
 // proceed to next item
 void                 check_ary_name_curs_Next(check_ary_name_curs &curs);
 void                 check_ary_name_curs_Reset(check_ary_name_curs &curs, acr::FCheck &parent);
@@ -389,10 +442,12 @@ void                 cppfunc_CopyIn(acr::FCppfunc &row, dmmeta::Cppfunc &in) __a
 // global access: ind_ctype (Thash)
 // global access: zd_sel_ctype (Llist)
 // global access: bh_ctype_topo (Bheap)
+// global access: c_check (Ptrary)
 // access: acr.Err.ctype (Ptr)
 // access: acr.FCtype.c_child (Ptrary)
 // access: acr.FField.p_ctype (Upptr)
 // access: acr.FField.p_arg (Upptr)
+// access: acr.FPrint.c_ctype (Ptrary)
 // access: acr.FRec.p_ctype (Upptr)
 // access: acr.FRun.c_ctype (Ptrary)
 // access: acr.FRun.c_child (Ptrary)
@@ -429,6 +484,13 @@ struct FCtype { // acr.FCtype
     i32                 rowid;                   //   0
     acr::CtypeTopoKey   topokey;                 //
     bool                visit;                   //   false  Temporary flag
+    bool                attrval_built;           //   false  At least one field of this ctype is indexed by value
+    acr::FRec**         c_bad_rec_elems;         // array of pointers
+    u32                 c_bad_rec_n;             // array of pointers
+    u32                 c_bad_rec_max;           // capacity of allocated array
+    bool&               check;                   //   false  Selected records are checked by -check (see -changed) (column)
+    bool                xref_built;              //   false  FRec.c_parent is up to date for all records of this ctype
+    bool                xref_target;             //   false  FRec.c_parent of a child ctype points into this ctype
     bool                run_c_child_in_ary;      //   false  membership flag
     acr::FCtype*        ind_ctype_next;          // hash next
     acr::FCtype*        zd_sel_ctype_next;       // zslist link; -1 means not-in-list
@@ -440,7 +502,7 @@ private:
     friend void                 ctype_RemoveLast() __attribute__((nothrow));
     FCtype();
     ~FCtype();
-    FCtype(const FCtype&){ /*disallow copy constructor */}
+    FCtype(const FCtype&); // disallow copy constructor (not defined)
     void operator =(const FCtype&){ /*disallow direct assignment */}
 };
 
@@ -602,6 +664,29 @@ bool                 topokey_Lt(acr::FCtype& ctype, acr::FCtype &rhs) __attribut
 // Compare two fields.
 i32                  topokey_Cmp(acr::FCtype& ctype, acr::FCtype &rhs) __attribute__((nothrow));
 
+// Return true if index is empty
+bool                 c_bad_rec_EmptyQ(acr::FCtype& ctype) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FRec*           c_bad_rec_Find(acr::FCtype& ctype, u32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array of pointers
+algo::aryptr<acr::FRec*> c_bad_rec_Getary(acr::FCtype& ctype) __attribute__((nothrow));
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void                 c_bad_rec_Insert(acr::FCtype& ctype, acr::FRec& row) __attribute__((nothrow));
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool                 c_bad_rec_ScanInsertMaybe(acr::FCtype& ctype, acr::FRec& row) __attribute__((nothrow));
+// Return number of items in the pointer array
+i32                  c_bad_rec_N(const acr::FCtype& ctype) __attribute__((__warn_unused_result__, nothrow, pure));
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void                 c_bad_rec_Remove(acr::FCtype& ctype, acr::FRec& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 c_bad_rec_RemoveAll(acr::FCtype& ctype) __attribute__((nothrow));
+// Reserve space in index for N more elements;
+void                 c_bad_rec_Reserve(acr::FCtype& ctype, u32 n) __attribute__((nothrow));
+
 void                 ctype_c_field_curs_Reset(ctype_c_field_curs &curs, acr::FCtype &parent);
 // cursor points to valid item
 bool                 ctype_c_field_curs_ValidQ(ctype_c_field_curs &curs);
@@ -647,6 +732,13 @@ bool                 ctype_zd_arg_curs_ValidQ(ctype_zd_arg_curs &curs);
 void                 ctype_zd_arg_curs_Next(ctype_zd_arg_curs &curs);
 // item access
 acr::FField&         ctype_zd_arg_curs_Access(ctype_zd_arg_curs &curs);
+void                 ctype_c_bad_rec_curs_Reset(ctype_c_bad_rec_curs &curs, acr::FCtype &parent);
+// cursor points to valid item
+bool                 ctype_c_bad_rec_curs_ValidQ(ctype_c_bad_rec_curs &curs);
+// proceed to next item
+void                 ctype_c_bad_rec_curs_Next(ctype_c_bad_rec_curs &curs);
+// item access
+acr::FRec&           ctype_c_bad_rec_curs_Access(ctype_c_bad_rec_curs &curs);
 // Set all fields to initial values.
 void                 FCtype_Init(acr::FCtype& ctype);
 void                 FCtype_Uninit(acr::FCtype& ctype) __attribute__((nothrow));
@@ -675,6 +767,7 @@ struct FDb { // acr.FDb
     command::acr         cmdline;                        // command line
     acr::FCtype*         ctype_lary[32];                 // level array
     i32                  ctype_n;                        // number of elements in array
+    bool*                ctype_check_lary[32];           // level array for column check
     u32                  err_blocksize;                  // # bytes per block
     acr::FErr*           err_free;                       //
     acr::FAnonfld*       anonfld_lary[32];               // level array
@@ -750,6 +843,21 @@ struct FDb { // acr.FDb
     i32                  bh_ctype_topo_max;              // max elements in bh_ctype_topo_elems
     acr::FCppfunc*       cppfunc_lary[32];               // level array
     i32                  cppfunc_n;                      // number of elements in array
+    u32                  attrval_blocksize;              // # bytes per block
+    acr::FAttrval*       attrval_free;                   //
+    acr::FSsimfile**     c_stage_elems;                  // array of pointers
+    u32                  c_stage_n;                      // array of pointers
+    u32                  c_stage_max;                    // capacity of allocated array
+    u32                  stage_next;                     //   0  Next index into c_stage to be claimed by a loader thread
+    acr::FCtype**        c_check_elems;                  // array of pointers
+    u32                  c_check_n;                      // array of pointers
+    u32                  c_check_max;                    // capacity of allocated array
+    u32                  check_next;                     //   0  Next index into c_check to be claimed by a check thread
+    algo::cstring*       watch_ns_elems;                 // pointer to elements
+    u32                  watch_ns_n;                     // number of elements in array
+    u32                  watch_ns_max;                   // max. capacity of array before realloc
+    report::acr_query    stats;                          // Statistics of query being run (see -stats)
+    report::acr_query    stats_total;                    // Statistics of all queries, printing and writing
     acr::trace           trace;                          //
 };
 
@@ -869,6 +977,8 @@ i32                  ctype_N() __attribute__((__warn_unused_result__, nothrow, p
 void                 ctype_RemoveLast() __attribute__((nothrow));
 // 'quick' Access row by row id. No bounds checking.
 acr::FCtype&         ctype_qFind(i32 t) __attribute__((nothrow));
+// 'quick' Access value of column check by row id. No bounds checking.
+bool&                ctype_check_qFind(i32 t);
 // Insert row into all appropriate indices. If error occurs, store error
 // in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
 bool                 ctype_XrefMaybe(acr::FCtype &row);
@@ -1079,6 +1189,8 @@ void                 StaticCheck();
 // Parse strptr into known type and add to database.
 // Return value is true unless an error occurs. If return value is false, algo_lib::_db.errtext has error text
 bool                 InsertStrptrMaybe(algo::strptr str);
+// Insert row image from binary input snapshot.
+bool                 InsertSnapMaybe(i32 table_id, algo::memptr row);
 // Load all finputs from given directory.
 bool                 LoadTuplesMaybe(algo::strptr root) __attribute__((nothrow));
 // Load specified ssimfile.
@@ -1582,6 +1694,113 @@ acr::FCppfunc&       cppfunc_qFind(u64 t) __attribute__((nothrow));
 // in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
 bool                 cppfunc_XrefMaybe(acr::FCppfunc &row);
 
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+acr::FAttrval&       attrval_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Allocate memory for new element. If out of memory, return NULL.
+acr::FAttrval*       attrval_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+// Remove row from all global and cross indices, then deallocate row
+void                 attrval_Delete(acr::FAttrval &row) __attribute__((nothrow));
+// Allocate space for one element
+// If no memory available, return NULL.
+void*                attrval_AllocMem() __attribute__((__warn_unused_result__, nothrow));
+// Remove mem from all global and cross indices, then deallocate mem
+void                 attrval_FreeMem(acr::FAttrval &row) __attribute__((nothrow));
+// Preallocate memory for N more elements
+// Return number of elements actually reserved.
+u64                  attrval_Reserve(u64 n_elems) __attribute__((nothrow));
+// Allocate block of given size, break up into small elements and append to free list.
+// Return number of elements reserved.
+u64                  attrval_ReserveMem(u64 size) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 attrval_XrefMaybe(acr::FAttrval &row);
+
+// Return true if index is empty
+bool                 c_stage_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FSsimfile*      c_stage_Find(u32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array of pointers
+algo::aryptr<acr::FSsimfile*> c_stage_Getary() __attribute__((nothrow));
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void                 c_stage_Insert(acr::FSsimfile& row) __attribute__((nothrow));
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Return value: whether element was inserted into array.
+bool                 c_stage_InsertMaybe(acr::FSsimfile& row) __attribute__((nothrow));
+// Return number of items in the pointer array
+i32                  c_stage_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void                 c_stage_Remove(acr::FSsimfile& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 c_stage_RemoveAll() __attribute__((nothrow));
+// Reserve space in index for N more elements;
+void                 c_stage_Reserve(u32 n) __attribute__((nothrow));
+
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 pkeybuild_XrefMaybe(acr::FPkeybuild &row);
+
+// Return true if index is empty
+bool                 c_check_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FCtype*         c_check_Find(u32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array of pointers
+algo::aryptr<acr::FCtype*> c_check_Getary() __attribute__((nothrow));
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void                 c_check_Insert(acr::FCtype& row) __attribute__((nothrow));
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool                 c_check_ScanInsertMaybe(acr::FCtype& row) __attribute__((nothrow));
+// Return number of items in the pointer array
+i32                  c_check_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void                 c_check_Remove(acr::FCtype& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 c_check_RemoveAll() __attribute__((nothrow));
+// Reserve space in index for N more elements;
+void                 c_check_Reserve(u32 n) __attribute__((nothrow));
+
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+algo::cstring&       watch_ns_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+algo::cstring&       watch_ns_AllocAt(int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<algo::cstring> watch_ns_AllocN(int n_elems) __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 watch_ns_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+algo::cstring*       watch_ns_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array pointer by value
+algo::aryptr<algo::cstring> watch_ns_Getary() __attribute__((nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+algo::cstring*       watch_ns_Last() __attribute__((nothrow, pure));
+// Return max. number of items in the array
+i32                  watch_ns_Max() __attribute__((nothrow));
+// Return number of items in the array
+i32                  watch_ns_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove item by index. If index outside of range, do nothing.
+void                 watch_ns_Remove(u32 i) __attribute__((nothrow));
+void                 watch_ns_RemoveAll() __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 watch_ns_RemoveLast() __attribute__((nothrow));
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 watch_ns_Reserve(int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 watch_ns_AbsReserve(int n) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+algo::cstring&       watch_ns_qFind(u64 t) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+algo::cstring&       watch_ns_qLast() __attribute__((nothrow));
+// Return row id of specified element
+u64                  watch_ns_rowid_Get(algo::cstring &elem) __attribute__((nothrow));
+
 // cursor points to valid item
 void                 _db_zd_pline_curs_Reset(_db_zd_pline_curs &curs, acr::FDb &parent);
 // cursor points to valid item
@@ -1606,6 +1825,14 @@ bool                 _db_ctype_curs_ValidQ(_db_ctype_curs &curs);
 void                 _db_ctype_curs_Next(_db_ctype_curs &curs);
 // item access
 acr::FCtype&         _db_ctype_curs_Access(_db_ctype_curs &curs);
+// Position cursor at the value of row 0 in column check
+void                 _db_ctype_check_curs_Reset(_db_ctype_check_curs &curs, acr::FDb &parent);
+// cursor points to valid item
+bool                 _db_ctype_check_curs_ValidQ(_db_ctype_check_curs &curs);
+// proceed to next item
+void                 _db_ctype_check_curs_Next(_db_ctype_check_curs &curs);
+// item access
+bool&                _db_ctype_check_curs_Access(_db_ctype_check_curs &curs);
 // cursor points to valid item
 void                 _db_anonfld_curs_Reset(_db_anonfld_curs &curs, acr::FDb &parent);
 // cursor points to valid item
@@ -1752,6 +1979,27 @@ bool                 _db_cppfunc_curs_ValidQ(_db_cppfunc_curs &curs);
 void                 _db_cppfunc_curs_Next(_db_cppfunc_curs &curs);
 // item access
 acr::FCppfunc&       _db_cppfunc_curs_Access(_db_cppfunc_curs &curs);
+void                 _db_c_stage_curs_Reset(_db_c_stage_curs &curs, acr::FDb &parent);
+// cursor points to valid item
+bool                 _db_c_stage_curs_ValidQ(_db_c_stage_curs &curs);
+// proceed to next item
+void                 _db_c_stage_curs_Next(_db_c_stage_curs &curs);
+// item access
+acr::FSsimfile&      _db_c_stage_curs_Access(_db_c_stage_curs &curs);
+void                 _db_c_check_curs_Reset(_db_c_check_curs &curs, acr::FDb &parent);
+// cursor points to valid item
+bool                 _db_c_check_curs_ValidQ(_db_c_check_curs &curs);
+// proceed to next item
+void                 _db_c_check_curs_Next(_db_c_check_curs &curs);
+// item access
+acr::FCtype&         _db_c_check_curs_Access(_db_c_check_curs &curs);
+// proceed to next item
+void                 _db_watch_ns_curs_Next(_db_watch_ns_curs &curs);
+void                 _db_watch_ns_curs_Reset(_db_watch_ns_curs &curs, acr::FDb &parent);
+// cursor points to valid item
+bool                 _db_watch_ns_curs_ValidQ(_db_watch_ns_curs &curs);
+// item access
+algo::cstring&       _db_watch_ns_curs_Access(_db_watch_ns_curs &curs);
 // Set all fields to initial values.
 void                 FDb_Init();
 void                 FDb_Uninit() __attribute__((nothrow));
@@ -1811,29 +2059,39 @@ void                 FEvalattr_Init(acr::FEvalattr& parent);
 // create: acr.FDb.field (Lary)
 // global access: ind_field (Thash)
 // access: acr.Err.fld (Ptr)
+// access: acr.FAttrval.p_field (Upptr)
 // access: acr.FCtype.c_field (Ptrary)
 // access: acr.FCtype.zd_arg (Llist)
 // access: acr.FEvalattr.field (Ptr)
 // access: acr.FRun.c_field (Ptrary)
 // access: acr.FErr.fld (Ptr)
 struct FField { // acr.FField
-    acr::FField*        zd_arg_next;            // zslist link; -1 means not-in-list
-    acr::FField*        zd_arg_prev;            // previous element
-    acr::FField*        ind_field_next;         // hash next
-    algo::Smallstr100   field;                  //
-    algo::Smallstr50    arg;                    // type of field
-    algo::Smallstr50    reftype;                //   "Val"
-    dmmeta::CppExpr     dflt;                   // default value (c++ expression)
-    algo::Comment       comment;                //
-    acr::FCtype*        p_ctype;                // reference to parent row
-    acr::FCtype*        p_arg;                  // reference to parent row
-    acr::FSubstr*       c_substr;               // optional pointer
-    u32                 max_attr_len;           //   0  Column width in chars
-    u32                 col_width;              //   0  Column width in chars
-    bool                isfldfunc;              //   false
-    bool                anon;                   //   false
-    bool                unique;                 //   false
-    bool                ctype_c_field_in_ary;   //   false  membership flag
+    acr::FField*        zd_arg_next;                 // zslist link; -1 means not-in-list
+    acr::FField*        zd_arg_prev;                 // previous element
+    acr::FField*        ind_field_next;              // hash next
+    algo::Smallstr100   field;                       //
+    algo::Smallstr50    arg;                         // type of field
+    algo::Smallstr50    reftype;                     //   "Val"
+    dmmeta::CppExpr     dflt;                        // default value (c++ expression)
+    algo::Comment       comment;                     //
+    acr::FCtype*        p_ctype;                     // reference to parent row
+    acr::FCtype*        p_arg;                       // reference to parent row
+    acr::FSubstr*       c_substr;                    // optional pointer
+    u32                 max_attr_len;                //   0  Column width in chars
+    u32                 col_width;                   //   0  Column width in chars
+    bool                isfldfunc;                   //   false
+    bool                anon;                        //   false
+    bool                unique;                      //   false
+    acr::FAttrval**     ind_attrval_buckets_elems;   // pointer to bucket array
+    i32                 ind_attrval_buckets_n;       // number of elements in bucket array
+    i32                 ind_attrval_n;               // number of elements in the hash table
+    acr::FAttrval*      tr_attrval_root;             // Root of the tree
+    i32                 tr_attrval_n;                // number of elements in the tree
+    bool                attrval_built;               //   false  ind_attrval and tr_attrval are up to date
+    acr::FRec**         c_bad_rec_elems;             // array of pointers
+    u32                 c_bad_rec_n;                 // array of pointers
+    u32                 c_bad_rec_max;               // capacity of allocated array
+    bool                ctype_c_field_in_ary;        //   false  membership flag
 private:
     friend acr::FField&         field_Alloc() __attribute__((__warn_unused_result__, nothrow));
     friend acr::FField*         field_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
@@ -1860,8 +2118,95 @@ bool                 c_substr_InsertMaybe(acr::FField& field, acr::FSubstr& row)
 // Remove element from index. If element is not in index, do nothing.
 void                 c_substr_Remove(acr::FField& field, acr::FSubstr& row) __attribute__((nothrow));
 
+// Return true if hash is empty
+bool                 ind_attrval_EmptyQ(acr::FField& field) __attribute__((nothrow));
+// Find row by key. Return NULL if not found.
+acr::FAttrval*       ind_attrval_Find(acr::FField& field, const algo::strptr& key) __attribute__((__warn_unused_result__, nothrow));
+// Return number of items in the hash
+i32                  ind_attrval_N(const acr::FField& field) __attribute__((__warn_unused_result__, nothrow, pure));
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool                 ind_attrval_InsertMaybe(acr::FField& field, acr::FAttrval& row) __attribute__((nothrow));
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void                 ind_attrval_Remove(acr::FField& field, acr::FAttrval& row) __attribute__((nothrow));
+// Reserve enough room in the hash for N more elements. Return success code.
+void                 ind_attrval_Reserve(acr::FField& field, int n) __attribute__((nothrow));
+
+// Return true if index is empty
+bool                 tr_attrval_EmptyQ(acr::FField& field) __attribute__((__warn_unused_result__, nothrow));
+acr::FAttrval*       tr_attrval_FirstImpl(acr::FAttrval* root) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to the first(smallest) element in the tree
+acr::FAttrval*       tr_attrval_First(acr::FField& field) __attribute__((__warn_unused_result__, nothrow));
+// Return true if row is in the tree, false otherwise
+bool                 tr_attrval_InTreeQ(acr::FAttrval& row) __attribute__((__warn_unused_result__, nothrow));
+// Insert row into the tree. If row is already in the tree, do nothing.
+void                 tr_attrval_InsertImpl(acr::FField& field, acr::FAttrval* parent, acr::FAttrval& row) __attribute__((nothrow));
+// Insert row into the tree. If row is already in the tree, do nothing.
+void                 tr_attrval_Insert(acr::FField& field, acr::FAttrval& row) __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 tr_attrval_Remove(acr::FField& field, acr::FAttrval& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 tr_attrval_RemoveAll(acr::FField& field) __attribute__((nothrow));
+// If the tree is empty, return NULL. Otherwise unlink and return pointer to first element.
+void                 tr_attrval_RemoveFirst(acr::FField& field) __attribute__((nothrow));
+i32                  tr_attrval_Balance(acr::FAttrval& row) __attribute__((nothrow));
+// Recalculate depth and keep rebalancing if needed
+acr::FAttrval*       tr_attrval_Propagate(acr::FAttrval& pnode) __attribute__((nothrow));
+// Rebalances the node if needed.
+void                 tr_attrval_Rebalance(acr::FAttrval& node) __attribute__((nothrow));
+acr::FAttrval*       tr_attrval_Next(acr::FAttrval& node) __attribute__((__warn_unused_result__, nothrow));
+acr::FAttrval*       tr_attrval_Prev(acr::FAttrval& node) __attribute__((__warn_unused_result__, nothrow));
+acr::FAttrval*       tr_attrval_LastImpl(acr::FAttrval* root) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to the last(largest) element in tree
+acr::FAttrval*       tr_attrval_Last(acr::FField& field) __attribute__((__warn_unused_result__, nothrow));
+// Empty the index. (rows may be deleted if cascdel)
+void                 tr_attrval_RemoveAllImpl(acr::FField& field, acr::FAttrval* root, bool del) __attribute__((nothrow));
+// Reinsert a row with modified key(Reheap semantics)
+void                 tr_attrval_Reinsert(acr::FField& field, acr::FAttrval& node) __attribute__((nothrow));
+// Find the first element that is greater or equal to a sortfld value
+acr::FAttrval*       tr_attrval_FirstGe(acr::FField& field, const algo::cstring& val) __attribute__((nothrow));
+// Find the last element that is smaller or equal to a sortfld value
+acr::FAttrval*       tr_attrval_LastLt(acr::FField& field, const algo::cstring& val) __attribute__((nothrow));
+
+// Return true if index is empty
+bool                 c_bad_rec_EmptyQ(acr::FField& field) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FRec*           c_bad_rec_Find(acr::FField& field, u32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array of pointers
+algo::aryptr<acr::FRec*> c_bad_rec_Getary(acr::FField& field) __attribute__((nothrow));
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void                 c_bad_rec_Insert(acr::FField& field, acr::FRec& row) __attribute__((nothrow));
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool                 c_bad_rec_ScanInsertMaybe(acr::FField& field, acr::FRec& row) __attribute__((nothrow));
+// Return number of items in the pointer array
+i32                  c_bad_rec_N(const acr::FField& field) __attribute__((__warn_unused_result__, nothrow, pure));
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void                 c_bad_rec_Remove(acr::FField& field, acr::FRec& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 c_bad_rec_RemoveAll(acr::FField& field) __attribute__((nothrow));
+// Reserve space in index for N more elements;
+void                 c_bad_rec_Reserve(acr::FField& field, u32 n) __attribute__((nothrow));
+
 // Set all fields to initial values.
 void                 FField_Init(acr::FField& field);
+// cursor points to valid item
+void                 field_tr_attrval_curs_Reset(field_tr_attrval_curs &curs, acr::FField& parent);
+// cursor points to valid item
+bool                 field_tr_attrval_curs_ValidQ(field_tr_attrval_curs &curs);
+// proceed to next item
+void                 field_tr_attrval_curs_Next(field_tr_attrval_curs &curs);
+// item access
+acr::FAttrval&       field_tr_attrval_curs_Access(field_tr_attrval_curs &curs);
+void                 field_c_bad_rec_curs_Reset(field_c_bad_rec_curs &curs, acr::FField &parent);
+// cursor points to valid item
+bool                 field_c_bad_rec_curs_ValidQ(field_c_bad_rec_curs &curs);
+// proceed to next item
+void                 field_c_bad_rec_curs_Next(field_c_bad_rec_curs &curs);
+// item access
+acr::FRec&           field_c_bad_rec_curs_Access(field_c_bad_rec_curs &curs);
 void                 FField_Uninit(acr::FField& field) __attribute__((nothrow));
 
 // --- acr.FFile
@@ -1971,6 +2316,144 @@ private:
 void                 FPdep_Init(acr::FPdep& pdep);
 void                 FPdep_Uninit(acr::FPdep& pdep) __attribute__((nothrow));
 
+// --- acr.FPkeybuild
+// create: acr.FDb.pkeybuild (Cppstack)
+struct FPkeybuild { // acr.FPkeybuild: Build sidecar pkey index
+    acr::FPkeyent*   ent_elems;   // pointer to elements
+    u32              ent_n;       // number of elements in array
+    u32              ent_max;     // max. capacity of array before realloc
+    acr::FPkeyent*   ref_elems;   // pointer to elements
+    u32              ref_n;       // number of elements in array
+    u32              ref_max;     // max. capacity of array before realloc
+    FPkeybuild();
+    ~FPkeybuild();
+private:
+    // reftype of acr.FPkeybuild.ent prohibits copy
+    // reftype of acr.FPkeybuild.ref prohibits copy
+    FPkeybuild(const FPkeybuild&){ /*disallow copy constructor */}
+    void operator =(const FPkeybuild&){ /*disallow direct assignment */}
+};
+
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+acr::FPkeyent&       ent_Alloc(acr::FPkeybuild& pkeybuild) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+acr::FPkeyent&       ent_AllocAt(acr::FPkeybuild& pkeybuild, int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<acr::FPkeyent> ent_AllocN(acr::FPkeybuild& pkeybuild, int n_elems) __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 ent_EmptyQ(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FPkeyent*       ent_Find(acr::FPkeybuild& pkeybuild, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array pointer by value
+algo::aryptr<acr::FPkeyent> ent_Getary(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+acr::FPkeyent*       ent_Last(acr::FPkeybuild& pkeybuild) __attribute__((nothrow, pure));
+// Return max. number of items in the array
+i32                  ent_Max(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Return number of items in the array
+i32                  ent_N(const acr::FPkeybuild& pkeybuild) __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove item by index. If index outside of range, do nothing.
+void                 ent_Remove(acr::FPkeybuild& pkeybuild, u32 i) __attribute__((nothrow));
+void                 ent_RemoveAll(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 ent_RemoveLast(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 ent_Reserve(acr::FPkeybuild& pkeybuild, int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 ent_AbsReserve(acr::FPkeybuild& pkeybuild, int n) __attribute__((nothrow));
+// Copy contents of RHS to PARENT.
+void                 ent_Setary(acr::FPkeybuild& pkeybuild, acr::FPkeybuild &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+acr::FPkeyent&       ent_qFind(acr::FPkeybuild& pkeybuild, u64 t) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+acr::FPkeyent&       ent_qLast(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Return row id of specified element
+u64                  ent_rowid_Get(acr::FPkeybuild& pkeybuild, acr::FPkeyent &elem) __attribute__((nothrow));
+// Verify whether array is sorted
+bool                 ent_SortedQ(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Insertion sort
+void                 ent_InsertionSort(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Heap sort
+void                 ent_HeapSort(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Quick sort
+void                 ent_QuickSort(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 ent_XrefMaybe(acr::FPkeyent &row);
+
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+acr::FPkeyent&       ref_Alloc(acr::FPkeybuild& pkeybuild) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+acr::FPkeyent&       ref_AllocAt(acr::FPkeybuild& pkeybuild, int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<acr::FPkeyent> ref_AllocN(acr::FPkeybuild& pkeybuild, int n_elems) __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 ref_EmptyQ(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FPkeyent*       ref_Find(acr::FPkeybuild& pkeybuild, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array pointer by value
+algo::aryptr<acr::FPkeyent> ref_Getary(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+acr::FPkeyent*       ref_Last(acr::FPkeybuild& pkeybuild) __attribute__((nothrow, pure));
+// Return max. number of items in the array
+i32                  ref_Max(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Return number of items in the array
+i32                  ref_N(const acr::FPkeybuild& pkeybuild) __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove item by index. If index outside of range, do nothing.
+void                 ref_Remove(acr::FPkeybuild& pkeybuild, u32 i) __attribute__((nothrow));
+void                 ref_RemoveAll(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 ref_RemoveLast(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 ref_Reserve(acr::FPkeybuild& pkeybuild, int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 ref_AbsReserve(acr::FPkeybuild& pkeybuild, int n) __attribute__((nothrow));
+// Copy contents of RHS to PARENT.
+void                 ref_Setary(acr::FPkeybuild& pkeybuild, acr::FPkeybuild &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+acr::FPkeyent&       ref_qFind(acr::FPkeybuild& pkeybuild, u64 t) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+acr::FPkeyent&       ref_qLast(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+// Return row id of specified element
+u64                  ref_rowid_Get(acr::FPkeybuild& pkeybuild, acr::FPkeyent &elem) __attribute__((nothrow));
+
+// proceed to next item
+void                 pkeybuild_ent_curs_Next(pkeybuild_ent_curs &curs);
+void                 pkeybuild_ent_curs_Reset(pkeybuild_ent_curs &curs, acr::FPkeybuild &parent);
+// cursor points to valid item
+bool                 pkeybuild_ent_curs_ValidQ(pkeybuild_ent_curs &curs);
+// item access
+acr::FPkeyent&       pkeybuild_ent_curs_Access(pkeybuild_ent_curs &curs);
+// proceed to next item
+void                 pkeybuild_ref_curs_Next(pkeybuild_ref_curs &curs);
+void                 pkeybuild_ref_curs_Reset(pkeybuild_ref_curs &curs, acr::FPkeybuild &parent);
+// cursor points to valid item
+bool                 pkeybuild_ref_curs_ValidQ(pkeybuild_ref_curs &curs);
+// item access
+acr::FPkeyent&       pkeybuild_ref_curs_Access(pkeybuild_ref_curs &curs);
+// Set all fields to initial values.
+void                 FPkeybuild_Init(acr::FPkeybuild& pkeybuild);
+void                 FPkeybuild_Uninit(acr::FPkeybuild& pkeybuild) __attribute__((nothrow));
+
+// --- acr.FPkeyent
+// create: acr.FPkeybuild.ent (Tary)
+// create: acr.FPkeybuild.ref (Tary)
+struct FPkeyent { // acr.FPkeyent: Entry of a sidecar pkey index (while building)
+    algo::cstring   key;       // Primary key, or value of reference field
+    u32             lineoff;   //   0  Offset of line in ssimfile
+    u32             linelen;   //   0  Length of line
+    u32             lineno;    //   0  Line number (1-based)
+    u32             rowid;     //   0  Rowid the record gets when the whole ssimfile is loaded
+    FPkeyent();
+};
+
+// Set all fields to initial values.
+void                 FPkeyent_Init(acr::FPkeyent& ent);
+
 // --- acr.PlineKey
 struct PlineKey { // acr.PlineKey: Key for sorting print-line records
     i32   alldep;       //   0  # Unresolved references
@@ -2083,6 +2566,9 @@ struct FPrint { // acr.FPrint: Print function
     i32                 skip_line;                     //   0
     i32                 this_depth;                    //   0
     i32                 prev_depth;                    //   0
+    acr::FCtype**       c_ctype_elems;                 // array of pointers
+    u32                 c_ctype_n;                     // array of pointers
+    u32                 c_ctype_max;                   // capacity of allocated array
     FPrint();
     ~FPrint();
 private:
@@ -2132,6 +2618,37 @@ void                 c_pline_RemoveAll(acr::FPrint& print) __attribute__((nothro
 // Reserve space in index for N more elements;
 void                 c_pline_Reserve(acr::FPrint& print, u32 n) __attribute__((nothrow));
 
+// Return true if index is empty
+bool                 c_ctype_EmptyQ(acr::FPrint& print) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FCtype*         c_ctype_Find(acr::FPrint& print, u32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array of pointers
+algo::aryptr<acr::FCtype*> c_ctype_Getary(acr::FPrint& print) __attribute__((nothrow));
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void                 c_ctype_Insert(acr::FPrint& print, acr::FCtype& row) __attribute__((nothrow));
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool                 c_ctype_ScanInsertMaybe(acr::FPrint& print, acr::FCtype& row) __attribute__((nothrow));
+// Return number of items in the pointer array
+i32                  c_ctype_N(const acr::FPrint& print) __attribute__((__warn_unused_result__, nothrow, pure));
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void                 c_ctype_Remove(acr::FPrint& print, acr::FCtype& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 c_ctype_RemoveAll(acr::FPrint& print) __attribute__((nothrow));
+// Reserve space in index for N more elements;
+void                 c_ctype_Reserve(acr::FPrint& print, u32 n) __attribute__((nothrow));
+// Verify whether array is sorted
+bool                 c_ctype_SortedQ(acr::FPrint& print) __attribute__((nothrow));
+// Insertion sort
+void                 c_ctype_InsertionSort(acr::FPrint& print) __attribute__((nothrow));
+// Heap sort
+void                 c_ctype_HeapSort(acr::FPrint& print) __attribute__((nothrow));
+// Quick sort
+void                 c_ctype_QuickSort(acr::FPrint& print) __attribute__((nothrow));
+
 void                 print_c_pline_curs_Reset(print_c_pline_curs &curs, acr::FPrint &parent);
 // cursor points to valid item
 bool                 print_c_pline_curs_ValidQ(print_c_pline_curs &curs);
@@ -2139,6 +2656,13 @@ bool                 print_c_pline_curs_ValidQ(print_c_pline_curs &curs);
 void                 print_c_pline_curs_Next(print_c_pline_curs &curs);
 // item access
 acr::FPline&         print_c_pline_curs_Access(print_c_pline_curs &curs);
+void                 print_c_ctype_curs_Reset(print_c_ctype_curs &curs, acr::FPrint &parent);
+// cursor points to valid item
+bool                 print_c_ctype_curs_ValidQ(print_c_ctype_curs &curs);
+// proceed to next item
+void                 print_c_ctype_curs_Next(print_c_ctype_curs &curs);
+// item access
+acr::FCtype&         print_c_ctype_curs_Access(print_c_ctype_curs &curs);
 // Set all fields to initial values.
 void                 FPrint_Init(acr::FPrint& print);
 void                 FPrint_Uninit(acr::FPrint& print) __attribute__((nothrow));
@@ -2197,114 +2721,6 @@ void                 Queryop_Init(acr::Queryop& parent);
 // print string representation of acr::Queryop to string LHS, no header -- cprint:acr.Queryop.String
 void                 Queryop_Print(acr::Queryop & row, algo::cstring &str) __attribute__((nothrow));
 
-// --- acr.FQuery
-// create: acr.FDb.query (Tpool)
-// global access: zs_query (Llist)
-struct FQuery { // acr.FQuery
-    acr::FQuery*    query_next;      // Pointer to next free element int tpool
-    acr::FQuery*    zs_query_next;   // zslist link; -1 means not-in-list
-    algo::cstring   field;           //   ""  Field name (SQL regex as string)
-    algo::cstring   value;           //   ""  Target value (SQL regex as string)
-    acr::Queryop    queryop;         //
-    algo::cstring   new_val;         //   ""
-    bool            pk;              //   false  true if value is primary key, not column
-    i32             nup;             //   0  Number of levels to go up
-    i32             ndown;           //   0  Number of levels to go down
-    bool            unused;          //   false  Only select records which are not referenced.
-    algo::cstring   regx_ssimfile;   //   ""  Full ssimfile name (SQL regex as string)
-    algo::cstring   ctype;           //   ""  Full ctype name (SQL regex as string)
-    bool            delrec;          //   false  Delete matching record
-private:
-    friend acr::FQuery&         query_Alloc() __attribute__((__warn_unused_result__, nothrow));
-    friend acr::FQuery*         query_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
-    friend void                 query_Delete(acr::FQuery &row) __attribute__((nothrow));
-    FQuery();
-    ~FQuery();
-    FQuery(const FQuery&){ /*disallow copy constructor */}
-    void operator =(const FQuery&){ /*disallow direct assignment */}
-};
-
-// Set all fields to initial values.
-void                 FQuery_Init(acr::FQuery& query);
-void                 FQuery_Uninit(acr::FQuery& query) __attribute__((nothrow));
-
-// --- acr.RecSortkey
-struct RecSortkey { // acr.RecSortkey: One record
-    double          num;     //   0.0  Numeric key (if present)
-    algo::cstring   str;     // String key (sort key)
-    float           rowid;   //   0.f  row id
-    bool operator ==(const acr::RecSortkey &rhs) const;
-    bool operator <(const acr::RecSortkey &rhs) const;
-    RecSortkey();
-};
-
-u32                  RecSortkey_Hash(u32 prev, const acr::RecSortkey & rhs) __attribute__((nothrow));
-bool                 RecSortkey_Lt(acr::RecSortkey & lhs, acr::RecSortkey & rhs) __attribute__((nothrow));
-i32                  RecSortkey_Cmp(acr::RecSortkey & lhs, acr::RecSortkey & rhs) __attribute__((nothrow));
-// Set all fields to initial values.
-void                 RecSortkey_Init(acr::RecSortkey& parent);
-bool                 RecSortkey_Eq(const acr::RecSortkey & lhs,const acr::RecSortkey & rhs) __attribute__((nothrow));
-// Set value. Return true if new value is different from old value.
-bool                 RecSortkey_Update(acr::RecSortkey &lhs, acr::RecSortkey & rhs) __attribute__((nothrow));
-// print string representation of acr::RecSortkey to string LHS, no header -- cprint:acr.RecSortkey.String
-void                 RecSortkey_Print(acr::RecSortkey & row, algo::cstring &str) __attribute__((nothrow));
-
-// --- acr.FRec
-// create: acr.FDb.rec (Tpool)
-// global access: zd_all_selrec (Llist)
-// access: acr.Err.rec (Ptr)
-// access: acr.FCheck.c_bad_rec (Ptrary)
-// access: acr.FCtype.zd_trec (Llist)
-// access: acr.FCtype.ind_rec (Thash)
-// access: acr.FCtype.zd_selrec (Llist)
-// access: acr.FFile.zd_frec (Llist)
-// access: acr.FPline.p_rec (Upptr)
-// access: acr.FRun.c_rec (Ptrary)
-// access: acr.FWrite.c_cmtrec (Ptrary)
-// access: acr.FErr.rec (Ptr)
-struct FRec { // acr.FRec
-    acr::FRec*        zd_trec_next;         // zslist link; -1 means not-in-list
-    acr::FRec*        zd_trec_prev;         // previous element
-    acr::FRec*        ind_rec_next;         // hash next
-    acr::FRec*        zd_selrec_next;       // zslist link; -1 means not-in-list
-    acr::FRec*        zd_selrec_prev;       // previous element
-    acr::FRec*        rec_next;             // Pointer to next free element int tpool
-    acr::FRec*        zd_all_selrec_next;   // zslist link; -1 means not-in-list
-    acr::FRec*        zd_all_selrec_prev;   // previous element
-    acr::FRec*        zd_frec_next;         // zslist link; -1 means not-in-list
-    acr::FRec*        zd_frec_prev;         // previous element
-    algo::cstring     pkey;                 // Record key (arbitrary string)
-    algo::Tuple       tuple;                // Data item
-    bool              del;                  //   false  Delete?
-    bool              mod;                  //   false  Record was modified?
-    bool              metasel;              //   false  Select for meta-data
-    bool              isnew;                //   false  Inserted newly
-    i32               seldist;              //   0  Distance to selection. >0 is up, <0 is down
-    acr::RecSortkey   sortkey;              // Output sort key
-    acr::FPline*      c_pline;              // Optional pline. optional pointer
-    acr::FFile*       p_outfile;            // reference to parent row
-    acr::FFile*       p_infile;             // reference to parent row
-    acr::FCtype*      p_ctype;              // reference to parent row
-    i32               lineno;               //   0
-private:
-    friend acr::FRec&           rec_Alloc() __attribute__((__warn_unused_result__, nothrow));
-    friend acr::FRec*           rec_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
-    friend void                 rec_Delete(acr::FRec &row) __attribute__((nothrow));
-    FRec();
-    ~FRec();
-    FRec(const FRec&){ /*disallow copy constructor */}
-    void operator =(const FRec&){ /*disallow direct assignment */}
-};
-
-// Insert row into pointer index. Return final membership status.
-bool                 c_pline_InsertMaybe(acr::FRec& rec, acr::FPline& row) __attribute__((nothrow));
-// Remove element from index. If element is not in index, do nothing.
-void                 c_pline_Remove(acr::FRec& rec, acr::FPline& row) __attribute__((nothrow));
-
-// Set all fields to initial values.
-void                 FRec_Init(acr::FRec& rec);
-void                 FRec_Uninit(acr::FRec& rec) __attribute__((nothrow));
-
 // --- acr.FRun
 // create: acr.FDb.run (Cppstack)
 struct FRun { // acr.FRun: Function to read/process query
@@ -2322,6 +2738,13 @@ struct FRun { // acr.FRun: Function to read/process query
     u32              c_child_max;     // capacity of allocated array
     algo_lib::Regx   field_regx;      //
     algo_lib::Regx   value_regx;      //
+    acr::FQuery**    c_query_elems;   // array of pointers
+    u32              c_query_n;       // array of pointers
+    u32              c_query_max;     // capacity of allocated array
+    acr::FRec**      c_match_elems;   // array of pointers
+    u32              c_match_n;       // array of pointers
+    u32              c_match_max;     // capacity of allocated array
+    bool             scan;            //   false  Batched query scans all records of current ctype
     FRun();
     ~FRun();
 private:
@@ -2424,6 +2847,52 @@ void                 c_child_RemoveAll(acr::FRun& run) __attribute__((nothrow));
 // Reserve space in index for N more elements;
 void                 c_child_Reserve(acr::FRun& run, u32 n) __attribute__((nothrow));
 
+// Return true if index is empty
+bool                 c_query_EmptyQ(acr::FRun& run) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FQuery*         c_query_Find(acr::FRun& run, u32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array of pointers
+algo::aryptr<acr::FQuery*> c_query_Getary(acr::FRun& run) __attribute__((nothrow));
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void                 c_query_Insert(acr::FRun& run, acr::FQuery& row) __attribute__((nothrow));
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool                 c_query_ScanInsertMaybe(acr::FRun& run, acr::FQuery& row) __attribute__((nothrow));
+// Return number of items in the pointer array
+i32                  c_query_N(const acr::FRun& run) __attribute__((__warn_unused_result__, nothrow, pure));
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void                 c_query_Remove(acr::FRun& run, acr::FQuery& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 c_query_RemoveAll(acr::FRun& run) __attribute__((nothrow));
+// Reserve space in index for N more elements;
+void                 c_query_Reserve(acr::FRun& run, u32 n) __attribute__((nothrow));
+
+// Return true if index is empty
+bool                 c_match_EmptyQ(acr::FRun& run) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FRec*           c_match_Find(acr::FRun& run, u32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array of pointers
+algo::aryptr<acr::FRec*> c_match_Getary(acr::FRun& run) __attribute__((nothrow));
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void                 c_match_Insert(acr::FRun& run, acr::FRec& row) __attribute__((nothrow));
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool                 c_match_ScanInsertMaybe(acr::FRun& run, acr::FRec& row) __attribute__((nothrow));
+// Return number of items in the pointer array
+i32                  c_match_N(const acr::FRun& run) __attribute__((__warn_unused_result__, nothrow, pure));
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void                 c_match_Remove(acr::FRun& run, acr::FRec& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 c_match_RemoveAll(acr::FRun& run) __attribute__((nothrow));
+// Reserve space in index for N more elements;
+void                 c_match_Reserve(acr::FRun& run, u32 n) __attribute__((nothrow));
+
 void                 run_c_ctype_curs_Reset(run_c_ctype_curs &curs, acr::FRun &parent);
 // cursor points to valid item
 bool                 run_c_ctype_curs_ValidQ(run_c_ctype_curs &curs);
@@ -2452,10 +2921,172 @@ bool                 run_c_child_curs_ValidQ(run_c_child_curs &curs);
 void                 run_c_child_curs_Next(run_c_child_curs &curs);
 // item access
 acr::FCtype&         run_c_child_curs_Access(run_c_child_curs &curs);
+void                 run_c_query_curs_Reset(run_c_query_curs &curs, acr::FRun &parent);
+// cursor points to valid item
+bool                 run_c_query_curs_ValidQ(run_c_query_curs &curs);
+// proceed to next item
+void                 run_c_query_curs_Next(run_c_query_curs &curs);
+// item access
+acr::FQuery&         run_c_query_curs_Access(run_c_query_curs &curs);
+void                 run_c_match_curs_Reset(run_c_match_curs &curs, acr::FRun &parent);
+// cursor points to valid item
+bool                 run_c_match_curs_ValidQ(run_c_match_curs &curs);
+// proceed to next item
+void                 run_c_match_curs_Next(run_c_match_curs &curs);
+// item access
+acr::FRec&           run_c_match_curs_Access(run_c_match_curs &curs);
 // Set all fields to initial values.
 void                 FRun_Init(acr::FRun& run);
 void                 FRun_Uninit(acr::FRun& run) __attribute__((nothrow));
 
+// --- acr.FQuery
+// create: acr.FDb.query (Tpool)
+// global access: zs_query (Llist)
+// access: acr.FRun.c_query (Ptrary)
+struct FQuery { // acr.FQuery
+    acr::FQuery*    query_next;      // Pointer to next free element int tpool
+    acr::FQuery*    zs_query_next;   // zslist link; -1 means not-in-list
+    algo::cstring   field;           //   ""  Field name (SQL regex as string)
+    algo::cstring   value;           //   ""  Target value (SQL regex as string)
+    acr::Queryop    queryop;         //
+    algo::cstring   new_val;         //   ""
+    bool            pk;              //   false  true if value is primary key, not column
+    i32             nup;             //   0  Number of levels to go up
+    i32             ndown;           //   0  Number of levels to go down
+    bool            unused;          //   false  Only select records which are not referenced.
+    algo::cstring   regx_ssimfile;   //   ""  Full ssimfile name (SQL regex as string)
+    algo::cstring   ctype;           //   ""  Full ctype name (SQL regex as string)
+    bool            delrec;          //   false  Delete matching record
+    acr::FRun       run;             // State of query run as part of a batch
+private:
+    friend acr::FQuery&         query_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend acr::FQuery*         query_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 query_Delete(acr::FQuery &row) __attribute__((nothrow));
+    FQuery();
+    ~FQuery();
+    FQuery(const FQuery&){ /*disallow copy constructor */}
+    void operator =(const FQuery&){ /*disallow direct assignment */}
+};
+
+// Set all fields to initial values.
+void                 FQuery_Init(acr::FQuery& query);
+void                 FQuery_Uninit(acr::FQuery& query) __attribute__((nothrow));
+
+// --- acr.RecSortkey
+struct RecSortkey { // acr.RecSortkey: One record
+    double          num;     //   0.0  Numeric key (if present)
+    algo::cstring   str;     // String key (sort key)
+    float           rowid;   //   0.f  row id
+    bool operator ==(const acr::RecSortkey &rhs) const;
+    bool operator <(const acr::RecSortkey &rhs) const;
+    RecSortkey();
+};
+
+u32                  RecSortkey_Hash(u32 prev, const acr::RecSortkey & rhs) __attribute__((nothrow));
+bool                 RecSortkey_Lt(acr::RecSortkey & lhs, acr::RecSortkey & rhs) __attribute__((nothrow));
+i32                  RecSortkey_Cmp(acr::RecSortkey & lhs, acr::RecSortkey & rhs) __attribute__((nothrow));
+// Set all fields to initial values.
+void                 RecSortkey_Init(acr::RecSortkey& parent);
+bool                 RecSortkey_Eq(const acr::RecSortkey & lhs,const acr::RecSortkey & rhs) __attribute__((nothrow));
+// Set value. Return true if new value is different from old value.
+bool                 RecSortkey_Update(acr::RecSortkey &lhs, acr::RecSortkey & rhs) __attribute__((nothrow));
+// print string representation of acr::RecSortkey to string LHS, no header -- cprint:acr.RecSortkey.String
+void                 RecSortkey_Print(acr::RecSortkey & row, algo::cstring &str) __attribute__((nothrow));
+
+// --- acr.FRec
+// create: acr.FDb.rec (Tpool)
+// global access: zd_all_selrec (Llist)
+// access: acr.Err.rec (Ptr)
+// access: acr.FAttrval.c_rec (Ptrary)
+// access: acr.FCtype.zd_trec (Llist)
+// access: acr.FCtype.ind_rec (Thash)
+// access: acr.FCtype.zd_selrec (Llist)
+// access: acr.FCtype.c_bad_rec (Ptrary)
+// access: acr.FField.c_bad_rec (Ptrary)
+// access: acr.FFile.zd_frec (Llist)
+// access: acr.FPline.p_rec (Upptr)
+// access: acr.FRec.c_parent (Ptrary)
+// access: acr.FRun.c_rec (Ptrary)
+// access: acr.FRun.c_match (Ptrary)
+// access: acr.FWrite.c_cmtrec (Ptrary)
+// access: acr.FErr.rec (Ptr)
+struct FRec { // acr.FRec
+    acr::FRec*        zd_trec_next;         // zslist link; -1 means not-in-list
+    acr::FRec*        zd_trec_prev;         // previous element
+    acr::FRec*        ind_rec_next;         // hash next
+    acr::FRec*        zd_selrec_next;       // zslist link; -1 means not-in-list
+    acr::FRec*        zd_selrec_prev;       // previous element
+    acr::FRec*        rec_next;             // Pointer to next free element int tpool
+    acr::FRec*        zd_all_selrec_next;   // zslist link; -1 means not-in-list
+    acr::FRec*        zd_all_selrec_prev;   // previous element
+    acr::FRec*        zd_frec_next;         // zslist link; -1 means not-in-list
+    acr::FRec*        zd_frec_prev;         // previous element
+    algo::cstring     pkey;                 // Record key (arbitrary string)
+    algo::Tuple       tuple;                // Data item
+    bool              del;                  //   false  Delete?
+    bool              mod;                  //   false  Record was modified?
+    bool              metasel;              //   false  Select for meta-data
+    bool              isnew;                //   false  Inserted newly
+    i32               seldist;              //   0  Distance to selection. >0 is up, <0 is down
+    acr::RecSortkey   sortkey;              // Output sort key
+    acr::FPline*      c_pline;              // Optional pline. optional pointer
+    acr::FFile*       p_outfile;            // reference to parent row
+    acr::FFile*       p_infile;             // reference to parent row
+    acr::FCtype*      p_ctype;              // reference to parent row
+    i32               lineno;               //   0
+    algo::strptr      origline;             // Input line that can be written back if record is not modified
+    acr::FRec**       c_parent_elems;       // array of pointers
+    u32               c_parent_n;           // array of pointers
+    u32               c_parent_max;         // capacity of allocated array
+private:
+    friend acr::FRec&           rec_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend acr::FRec*           rec_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 rec_Delete(acr::FRec &row) __attribute__((nothrow));
+    FRec();
+    ~FRec();
+    FRec(const FRec&){ /*disallow copy constructor */}
+    void operator =(const FRec&){ /*disallow direct assignment */}
+};
+
+// Insert row into pointer index. Return final membership status.
+bool                 c_pline_InsertMaybe(acr::FRec& rec, acr::FPline& row) __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 c_pline_Remove(acr::FRec& rec, acr::FPline& row) __attribute__((nothrow));
+
+// Return true if index is empty
+bool                 c_parent_EmptyQ(acr::FRec& rec) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FRec*           c_parent_Find(acr::FRec& rec, u32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array of pointers
+algo::aryptr<acr::FRec*> c_parent_Getary(acr::FRec& rec) __attribute__((nothrow));
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void                 c_parent_Insert(acr::FRec& rec, acr::FRec& row) __attribute__((nothrow));
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool                 c_parent_ScanInsertMaybe(acr::FRec& rec, acr::FRec& row) __attribute__((nothrow));
+// Return number of items in the pointer array
+i32                  c_parent_N(const acr::FRec& rec) __attribute__((__warn_unused_result__, nothrow, pure));
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void                 c_parent_Remove(acr::FRec& rec, acr::FRec& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 c_parent_RemoveAll(acr::FRec& rec) __attribute__((nothrow));
+// Reserve space in index for N more elements;
+void                 c_parent_Reserve(acr::FRec& rec, u32 n) __attribute__((nothrow));
+
+// Set all fields to initial values.
+void                 FRec_Init(acr::FRec& rec);
+void                 rec_c_parent_curs_Reset(rec_c_parent_curs &curs, acr::FRec &parent);
+// cursor points to valid item
+bool                 rec_c_parent_curs_ValidQ(rec_c_parent_curs &curs);
+// proceed to next item
+void                 rec_c_parent_curs_Next(rec_c_parent_curs &curs);
+// item access
+acr::FRec&           rec_c_parent_curs_Access(rec_c_parent_curs &curs);
+void                 FRec_Uninit(acr::FRec& rec) __attribute__((nothrow));
+
 // --- acr.FSmallstr
 // create: acr.FDb.smallstr (Lary)
 struct FSmallstr { // acr.FSmallstr
@@ -2482,14 +3113,30 @@ void                 FSmallstr_Init(acr::FSmallstr& smallstr);
 // --- acr.FSsimfile
 // create: acr.FDb.ssimfile (Lary)
 // global access: ind_ssimfile (Thash)
+// global access: c_stage (Ptrary)
 // access: acr.FCtype.c_ssimfile (Ptr)
 struct FSsimfile { // acr.FSsimfile: One full table
-    acr::FSsimfile*    ind_ssimfile_next;   // hash next
-    algo::Smallstr50   ssimfile;            //
-    algo::Smallstr50   ctype;               //
-    acr::FFile*        c_file;              // optional!. optional pointer
-    acr::FCtype*       p_ctype;             // reference to parent row
-    acr::FSsimsort*    c_ssimsort;          // Optional sort order. optional pointer
+    acr::FSsimfile*      ind_ssimfile_next;    // hash next
+    algo::Smallstr50     ssimfile;             //
+    algo::Smallstr50     ctype;                //
+    acr::FFile*          c_file;               // optional!. optional pointer
+    acr::FCtype*         p_ctype;              // reference to parent row
+    acr::FSsimsort*      c_ssimsort;           // Optional sort order. optional pointer
+    algo::cstring        stage_fname;          // File to load (set while queued for a loader thread)
+    bool                 stage_ok;             //   false  Loader thread read the file
+    algo::UnTime         stage_modtime;        // File modification time, as seen by loader thread
+    acr::FStagerow*      stagerow_elems;       // pointer to elements
+    u32                  stagerow_n;           // number of elements in array
+    u32                  stagerow_max;         // max. capacity of array before realloc
+    bool                 partial;              //   false  Only some records (loaded by pkey) are in memory
+    bool                 pkeyidx_tried;        //   false  Attempted to open pkey index
+    algo::strptr         pkeyidx;              // Pkey index contents (empty if not usable)
+    algo_lib::MmapFile   pkeyidx_map;          // Mapped sidecar file
+    algo::cstring        pkeyidx_buf;          // Freshly built index
+    algo_lib::MmapFile   mmap;                 // Mapped ssimfile. Loaded records refer to their lines in it
+    bool                 check_all;            //   false  -check selected all records of the ssimfile
+    bool                 unchanged;            //   false  Ssimfile has not changed since the last successful check (see -changed)
+    bool                 _db_c_stage_in_ary;   //   false  membership flag
 private:
     friend acr::FSsimfile&      ssimfile_Alloc() __attribute__((__warn_unused_result__, nothrow));
     friend acr::FSsimfile*      ssimfile_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
@@ -2514,8 +3161,54 @@ bool                 c_ssimsort_InsertMaybe(acr::FSsimfile& ssimfile, acr::FSsim
 // Remove element from index. If element is not in index, do nothing.
 void                 c_ssimsort_Remove(acr::FSsimfile& ssimfile, acr::FSsimsort& row) __attribute__((nothrow));
 
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+acr::FStagerow&      stagerow_Alloc(acr::FSsimfile& ssimfile) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+acr::FStagerow&      stagerow_AllocAt(acr::FSsimfile& ssimfile, int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<acr::FStagerow> stagerow_AllocN(acr::FSsimfile& ssimfile, int n_elems) __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 stagerow_EmptyQ(acr::FSsimfile& ssimfile) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+acr::FStagerow*      stagerow_Find(acr::FSsimfile& ssimfile, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array pointer by value
+algo::aryptr<acr::FStagerow> stagerow_Getary(acr::FSsimfile& ssimfile) __attribute__((nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+acr::FStagerow*      stagerow_Last(acr::FSsimfile& ssimfile) __attribute__((nothrow, pure));
+// Return max. number of items in the array
+i32                  stagerow_Max(acr::FSsimfile& ssimfile) __attribute__((nothrow));
+// Return number of items in the array
+i32                  stagerow_N(const acr::FSsimfile& ssimfile) __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove item by index. If index outside of range, do nothing.
+void                 stagerow_Remove(acr::FSsimfile& ssimfile, u32 i) __attribute__((nothrow));
+void                 stagerow_RemoveAll(acr::FSsimfile& ssimfile) __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 stagerow_RemoveLast(acr::FSsimfile& ssimfile) __attribute__((nothrow));
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 stagerow_Reserve(acr::FSsimfile& ssimfile, int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 stagerow_AbsReserve(acr::FSsimfile& ssimfile, int n) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+acr::FStagerow&      stagerow_qFind(acr::FSsimfile& ssimfile, u64 t) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+acr::FStagerow&      stagerow_qLast(acr::FSsimfile& ssimfile) __attribute__((nothrow));
+// Return row id of specified element
+u64                  stagerow_rowid_Get(acr::FSsimfile& ssimfile, acr::FStagerow &elem) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 stagerow_XrefMaybe(acr::FStagerow &row);
+
 // Set all fields to initial values.
 void                 FSsimfile_Init(acr::FSsimfile& ssimfile);
+// proceed to next item
+void                 ssimfile_stagerow_curs_Next(ssimfile_stagerow_curs &curs);
+void                 ssimfile_stagerow_curs_Reset(ssimfile_stagerow_curs &curs, acr::FSsimfile &parent);
+// cursor points to valid item
+bool                 ssimfile_stagerow_curs_ValidQ(ssimfile_stagerow_curs &curs);
+// item access
+acr::FStagerow&      ssimfile_stagerow_curs_Access(ssimfile_stagerow_curs &curs);
 void                 FSsimfile_Uninit(acr::FSsimfile& ssimfile) __attribute__((nothrow));
 
 // --- acr.FSsimsort
@@ -2543,6 +3236,22 @@ void                 ssimsort_CopyIn(acr::FSsimsort &row, dmmeta::Ssimsort &in)
 void                 FSsimsort_Init(acr::FSsimsort& ssimsort);
 void                 FSsimsort_Uninit(acr::FSsimsort& ssimsort) __attribute__((nothrow));
 
+// --- acr.FStagerow
+// create: acr.FSsimfile.stagerow (Tary)
+struct FStagerow { // acr.FStagerow: Tuple parsed by a loader thread, with its line number
+    u32            lineno;   //   0  Line number in ssimfile
+    algo::Tuple    tuple;    // Parsed line
+    algo::strptr   line;     // Line in ssimfile (points into FSsimfile.mmap)
+    FStagerow();
+private:
+    // value field acr.FStagerow.tuple is not copiable
+    FStagerow(const FStagerow&){ /*disallow copy constructor */}
+    void operator =(const FStagerow&){ /*disallow direct assignment */}
+};
+
+// Set all fields to initial values.
+void                 FStagerow_Init(acr::FStagerow& stagerow);
+
 // --- acr.FSubstr
 // create: acr.FDb.substr (Lary)
 // access: acr.FField.c_substr (Ptr)
@@ -2702,6 +3411,48 @@ void                 FieldId_Init(acr::FieldId& parent);
 // print string representation of acr::FieldId to string LHS, no header -- cprint:acr.FieldId.String
 void                 FieldId_Print(acr::FieldId & row, algo::cstring &str) __attribute__((nothrow));
 
+// --- acr.PkeyidxEnt
+struct PkeyidxEnt { // acr.PkeyidxEnt: Entry of sidecar pkey index
+    u32   keyoff;    //   0  Offset of key in key area
+    u32   keylen;    //   0  Length of key
+    u32   lineoff;   //   0  Offset of line in ssimfile
+    u32   linelen;   //   0  Length of line
+    u32   lineno;    //   0  Line number (1-based)
+    u32   rowid;     //   0  Rowid the record gets when the whole ssimfile is loaded
+    PkeyidxEnt();
+};
+
+// Set all fields to initial values.
+void                 PkeyidxEnt_Init(acr::PkeyidxEnt& parent);
+
+// --- acr.PkeyidxFld
+struct PkeyidxFld { // acr.PkeyidxFld: Reference field section of sidecar pkey index
+    u32   field;   //   0  Index of field in ctype
+    u32   beg;     //   0  First entry of the section
+    u32   n;       //   0  Number of entries, sorted by field value
+    PkeyidxFld();
+};
+
+// Set all fields to initial values.
+void                 PkeyidxFld_Init(acr::PkeyidxFld& parent);
+
+// --- acr.PkeyidxHdr
+struct PkeyidxHdr { // acr.PkeyidxHdr: Header of sidecar pkey index (temp/acr_pkey)
+    u32   magic;       //   0x61637270  Signature
+    u32   version;     //   2  File format version
+    i64   mtime;       //   0  Modification time of ssimfile (ns)
+    u64   size;        //   0  Size of ssimfile
+    u32   nent;        //   0  Number of primary key entries
+    u32   usable;      //   0  1 if records can be loaded individually
+    u32   nref;        //   0  Number of entries for reference fields
+    u32   nfld;        //   0  Number of indexed reference fields
+    u32   signature;   //   0  Hash of field definitions of the ctype
+    PkeyidxHdr();
+};
+
+// Set all fields to initial values.
+void                 PkeyidxHdr_Init(acr::PkeyidxHdr& parent);
+
 // --- acr.TableId
 struct TableId { // acr.TableId: Index of table in this namespace
     i32   value;   //   -1  index of table
@@ -2739,12 +3490,12 @@ void                 TableId_Init(acr::TableId& parent);
 // print string representation of acr::TableId to string LHS, no header -- cprint:acr.TableId.String
 void                 TableId_Print(acr::TableId & row, algo::cstring &str) __attribute__((nothrow));
 
-struct check_c_bad_rec_curs {// cursor
+struct attrval_c_rec_curs {// cursor
     typedef acr::FRec ChildType;
     acr::FRec** elems;
     u32 n_elems;
     u32 index;
-    check_c_bad_rec_curs() { elems=NULL; n_elems=0; index=0; }
+    attrval_c_rec_curs() { elems=NULL; n_elems=0; index=0; }
 };
 
 
@@ -2811,6 +3562,15 @@ struct ctype_zd_arg_curs {// cursor
 };
 
 
+struct ctype_c_bad_rec_curs {// cursor
+    typedef acr::FRec ChildType;
+    acr::FRec** elems;
+    u32 n_elems;
+    u32 index;
+    ctype_c_bad_rec_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
 struct _db_zd_pline_curs {// cursor
     typedef acr::FPline ChildType;
     acr::FPline* row;
@@ -2837,6 +3597,17 @@ struct _db_ctype_curs {// cursor
 };
 
 
+struct _db_ctype_check_curs {// column cursor
+    typedef bool ChildType;
+    acr::FDb *parent;
+    bool *elems; // current level
+    i64 index; // row id of current element
+    i64 i; // index on current level
+    i32 level;
+    _db_ctype_check_curs(){ parent=NULL; elems=NULL; index=0; i=0; level=0; }
+};
+
+
 struct _db_anonfld_curs {// cursor
     typedef acr::FAnonfld ChildType;
     acr::FDb *parent;
@@ -2993,6 +3764,51 @@ struct _db_cppfunc_curs {// cursor
 };
 
 
+struct _db_c_stage_curs {// cursor
+    typedef acr::FSsimfile ChildType;
+    acr::FSsimfile** elems;
+    u32 n_elems;
+    u32 index;
+    _db_c_stage_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct _db_c_check_curs {// cursor
+    typedef acr::FCtype ChildType;
+    acr::FCtype** elems;
+    u32 n_elems;
+    u32 index;
+    _db_c_check_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct _db_watch_ns_curs {// cursor
+    typedef algo::cstring ChildType;
+    algo::cstring* elems;
+    int n_elems;
+    int index;
+    _db_watch_ns_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct field_tr_attrval_curs {// cursor
+    typedef acr::FAttrval ChildType;
+    acr::FAttrval* row;
+    field_tr_attrval_curs() {
+        row = NULL;
+    }
+};
+
+
+struct field_c_bad_rec_curs {// cursor
+    typedef acr::FRec ChildType;
+    acr::FRec** elems;
+    u32 n_elems;
+    u32 index;
+    field_c_bad_rec_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
 struct file_zd_frec_curs {// cursor
     typedef acr::FRec ChildType;
     acr::FRec* row;
@@ -3002,6 +3818,24 @@ struct file_zd_frec_curs {// cursor
 };
 
 
+struct pkeybuild_ent_curs {// cursor
+    typedef acr::FPkeyent ChildType;
+    acr::FPkeyent* elems;
+    int n_elems;
+    int index;
+    pkeybuild_ent_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct pkeybuild_ref_curs {// cursor
+    typedef acr::FPkeyent ChildType;
+    acr::FPkeyent* elems;
+    int n_elems;
+    int index;
+    pkeybuild_ref_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
 struct pline_zd_child_curs {// cursor
     typedef acr::FPdep ChildType;
     acr::FPdep* row;
@@ -3020,6 +3854,15 @@ struct print_c_pline_curs {// cursor
 };
 
 
+struct print_c_ctype_curs {// cursor
+    typedef acr::FCtype ChildType;
+    acr::FCtype** elems;
+    u32 n_elems;
+    u32 index;
+    print_c_ctype_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
 struct run_c_ctype_curs {// cursor
     typedef acr::FCtype ChildType;
     acr::FCtype** elems;
@@ -3056,6 +3899,42 @@ struct run_c_child_curs {// cursor
 };
 
 
+struct run_c_query_curs {// cursor
+    typedef acr::FQuery ChildType;
+    acr::FQuery** elems;
+    u32 n_elems;
+    u32 index;
+    run_c_query_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct run_c_match_curs {// cursor
+    typedef acr::FRec ChildType;
+    acr::FRec** elems;
+    u32 n_elems;
+    u32 index;
+    run_c_match_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct rec_c_parent_curs {// cursor
+    typedef acr::FRec ChildType;
+    acr::FRec** elems;
+    u32 n_elems;
+    u32 index;
+    rec_c_parent_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct ssimfile_stagerow_curs {// cursor
+    typedef acr::FStagerow ChildType;
+    acr::FStagerow* elems;
+    int n_elems;
+    int index;
+    ssimfile_stagerow_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
 struct write_c_cmtrec_curs {// cursor
     typedef acr::FRec ChildType;
     acr::FRec** elems;
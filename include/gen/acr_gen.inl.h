@@ -94,6 +94,104 @@ inline void acr::Err_Init(acr::Err& parent) {
 inline acr::FAnonfld::FAnonfld() {
 }
 
+inline acr::FAttrval::FAttrval() {
+    acr::FAttrval_Init(*this);
+}
+
+inline acr::FAttrval::~FAttrval() {
+    acr::FAttrval_Uninit(*this);
+}
+
+
+// --- acr.FAttrval.value.Lt
+// Compare two fields. Comparison is anti-symmetric: if a>b, then !(b>a).
+inline bool acr::value_Lt(acr::FAttrval& attrval, acr::FAttrval &rhs) {
+    return algo::cstring_Lt(attrval.value,rhs.value);
+}
+
+// --- acr.FAttrval.value.Cmp
+// Compare two fields.
+inline i32 acr::value_Cmp(acr::FAttrval& attrval, acr::FAttrval &rhs) {
+    i32 retval = 0;
+    retval = algo::cstring_Cmp(attrval.value, rhs.value);
+    return retval;
+}
+
+// --- acr.FAttrval.c_rec.EmptyQ
+// Return true if index is empty
+inline bool acr::c_rec_EmptyQ(acr::FAttrval& attrval) {
+    return attrval.c_rec_n == 0;
+}
+
+// --- acr.FAttrval.c_rec.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FRec* acr::c_rec_Find(acr::FAttrval& attrval, u32 t) {
+    acr::FRec *retval = NULL;
+    u64 idx = t;
+    u64 lim = attrval.c_rec_n;
+    if (idx < lim) {
+        retval = attrval.c_rec_elems[idx];
+    }
+    return retval;
+}
+
+// --- acr.FAttrval.c_rec.Getary
+// Return array of pointers
+inline algo::aryptr<acr::FRec*> acr::c_rec_Getary(acr::FAttrval& attrval) {
+    return algo::aryptr<acr::FRec*>(attrval.c_rec_elems, attrval.c_rec_n);
+}
+
+// --- acr.FAttrval.c_rec.N
+// Return number of items in the pointer array
+inline i32 acr::c_rec_N(const acr::FAttrval& attrval) {
+    return attrval.c_rec_n;
+}
+
+// --- acr.FAttrval.c_rec.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void acr::c_rec_RemoveAll(acr::FAttrval& attrval) {
+    attrval.c_rec_n = 0;
+}
+
+// --- acr.FAttrval.c_rec_curs.Reset
+inline void acr::attrval_c_rec_curs_Reset(attrval_c_rec_curs &curs, acr::FAttrval &parent) {
+    curs.elems = parent.c_rec_elems;
+    curs.n_elems = parent.c_rec_n;
+    curs.index = 0;
+}
+
+// --- acr.FAttrval.c_rec_curs.ValidQ
+// cursor points to valid item
+inline bool acr::attrval_c_rec_curs_ValidQ(attrval_c_rec_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FAttrval.c_rec_curs.Next
+// proceed to next item
+inline void acr::attrval_c_rec_curs_Next(attrval_c_rec_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FAttrval.c_rec_curs.Access
+// item access
+inline acr::FRec& acr::attrval_c_rec_curs_Access(attrval_c_rec_curs &curs) {
+    return *curs.elems[curs.index];
+}
+
+// --- acr.FAttrval..Init
+// Set all fields to initial values.
+inline void acr::FAttrval_Init(acr::FAttrval& attrval) {
+    attrval.p_field = NULL;
+    attrval.c_rec_elems = NULL; // (acr.FAttrval.c_rec)
+    attrval.c_rec_n = 0; // (acr.FAttrval.c_rec)
+    attrval.c_rec_max = 0; // (acr.FAttrval.c_rec)
+    attrval.attrval_next = (acr::FAttrval*)-1; // (acr.FDb.attrval) not-in-tpool's freelist
+    attrval.ind_attrval_next = (acr::FAttrval*)-1; // (acr.FField.ind_attrval) not-in-hash
+    attrval.tr_attrval_up = (acr::FAttrval*)-1; // (acr.FField.tr_attrval) not in tree
+    attrval.tr_attrval_left = NULL;
+    attrval.tr_attrval_right = NULL;
+    attrval.tr_attrval_depth = 0;
+}
 inline acr::FBltin::FBltin() {
     acr::FBltin_Init(*this);
 }
@@ -126,42 +224,6 @@ inline acr::FCheck::~FCheck() {
 }
 
 
-// --- acr.FCheck.c_bad_rec.EmptyQ
-// Return true if index is empty
-inline bool acr::c_bad_rec_EmptyQ(acr::FCheck& check) {
-    return check.c_bad_rec_n == 0;
-}
-
-// --- acr.FCheck.c_bad_rec.Find
-// Look up row by row id. Return NULL if out of range
-inline acr::FRec* acr::c_bad_rec_Find(acr::FCheck& check, u32 t) {
-    acr::FRec *retval = NULL;
-    u64 idx = t;
-    u64 lim = check.c_bad_rec_n;
-    if (idx < lim) {
-        retval = check.c_bad_rec_elems[idx];
-    }
-    return retval;
-}
-
-// --- acr.FCheck.c_bad_rec.Getary
-// Return array of pointers
-inline algo::aryptr<acr::FRec*> acr::c_bad_rec_Getary(acr::FCheck& check) {
-    return algo::aryptr<acr::FRec*>(check.c_bad_rec_elems, check.c_bad_rec_n);
-}
-
-// --- acr.FCheck.c_bad_rec.N
-// Return number of items in the pointer array
-inline i32 acr::c_bad_rec_N(const acr::FCheck& check) {
-    return check.c_bad_rec_n;
-}
-
-// --- acr.FCheck.c_bad_rec.RemoveAll
-// Empty the index. (The rows are not deleted)
-inline void acr::c_bad_rec_RemoveAll(acr::FCheck& check) {
-    check.c_bad_rec_n = 0;
-}
-
 // --- acr.FCheck.ary_name.EmptyQ
 // Return true if index is empty
 inline bool acr::ary_name_EmptyQ(acr::FCheck& check) {
@@ -230,31 +292,6 @@ inline u64 acr::ary_name_rowid_Get(acr::FCheck& check, algo::cstring &elem) {
     return u64(id);
 }
 
-// --- acr.FCheck.c_bad_rec_curs.Reset
-inline void acr::check_c_bad_rec_curs_Reset(check_c_bad_rec_curs &curs, acr::FCheck &parent) {
-    curs.elems = parent.c_bad_rec_elems;
-    curs.n_elems = parent.c_bad_rec_n;
-    curs.index = 0;
-}
-
-// --- acr.FCheck.c_bad_rec_curs.ValidQ
-// cursor points to valid item
-inline bool acr::check_c_bad_rec_curs_ValidQ(check_c_bad_rec_curs &curs) {
-    return curs.index < curs.n_elems;
-}
-
-// --- acr.FCheck.c_bad_rec_curs.Next
-// proceed to next item
-inline void acr::check_c_bad_rec_curs_Next(check_c_bad_rec_curs &curs) {
-    curs.index++;
-}
-
-// --- acr.FCheck.c_bad_rec_curs.Access
-// item access
-inline acr::FRec& acr::check_c_bad_rec_curs_Access(check_c_bad_rec_curs &curs) {
-    return *curs.elems[curs.index];
-}
-
 // --- acr.FCheck.ary_name_curs.Next
 // proceed to next item
 inline void acr::check_ary_name_curs_Next(check_ary_name_curs &curs) {
@@ -283,9 +320,6 @@ inline algo::cstring& acr::check_ary_name_curs_Access(check_ary_name_curs &curs)
 // --- acr.FCheck..Init
 // Set all fields to initial values.
 inline void acr::FCheck_Init(acr::FCheck& check) {
-    check.c_bad_rec_elems = NULL; // (acr.FCheck.c_bad_rec)
-    check.c_bad_rec_n = 0; // (acr.FCheck.c_bad_rec)
-    check.c_bad_rec_max = 0; // (acr.FCheck.c_bad_rec)
     check.n_record = u32(0);
     check.n_err = i32(0);
     check.ary_name_elems 	= 0; // (acr.FCheck.ary_name)
@@ -295,7 +329,7 @@ inline void acr::FCheck_Init(acr::FCheck& check) {
 inline acr::FCppfunc::FCppfunc() {
 }
 
-inline acr::FCtype::FCtype() {
+inline acr::FCtype::FCtype() : check(ctype_check_qFind(i32(ctype_N() - 1))) {
     acr::FCtype_Init(*this);
 }
 
@@ -622,6 +656,42 @@ inline i32 acr::topokey_Cmp(acr::FCtype& ctype, acr::FCtype &rhs) {
     return retval;
 }
 
+// --- acr.FCtype.c_bad_rec.EmptyQ
+// Return true if index is empty
+inline bool acr::c_bad_rec_EmptyQ(acr::FCtype& ctype) {
+    return ctype.c_bad_rec_n == 0;
+}
+
+// --- acr.FCtype.c_bad_rec.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FRec* acr::c_bad_rec_Find(acr::FCtype& ctype, u32 t) {
+    acr::FRec *retval = NULL;
+    u64 idx = t;
+    u64 lim = ctype.c_bad_rec_n;
+    if (idx < lim) {
+        retval = ctype.c_bad_rec_elems[idx];
+    }
+    return retval;
+}
+
+// --- acr.FCtype.c_bad_rec.Getary
+// Return array of pointers
+inline algo::aryptr<acr::FRec*> acr::c_bad_rec_Getary(acr::FCtype& ctype) {
+    return algo::aryptr<acr::FRec*>(ctype.c_bad_rec_elems, ctype.c_bad_rec_n);
+}
+
+// --- acr.FCtype.c_bad_rec.N
+// Return number of items in the pointer array
+inline i32 acr::c_bad_rec_N(const acr::FCtype& ctype) {
+    return ctype.c_bad_rec_n;
+}
+
+// --- acr.FCtype.c_bad_rec.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void acr::c_bad_rec_RemoveAll(acr::FCtype& ctype) {
+    ctype.c_bad_rec_n = 0;
+}
+
 // --- acr.FCtype.c_field_curs.Reset
 inline void acr::ctype_c_field_curs_Reset(ctype_c_field_curs &curs, acr::FCtype &parent) {
     curs.elems = parent.c_field_elems;
@@ -766,6 +836,31 @@ inline void acr::ctype_zd_arg_curs_Next(ctype_zd_arg_curs &curs) {
 inline acr::FField& acr::ctype_zd_arg_curs_Access(ctype_zd_arg_curs &curs) {
     return *curs.row;
 }
+
+// --- acr.FCtype.c_bad_rec_curs.Reset
+inline void acr::ctype_c_bad_rec_curs_Reset(ctype_c_bad_rec_curs &curs, acr::FCtype &parent) {
+    curs.elems = parent.c_bad_rec_elems;
+    curs.n_elems = parent.c_bad_rec_n;
+    curs.index = 0;
+}
+
+// --- acr.FCtype.c_bad_rec_curs.ValidQ
+// cursor points to valid item
+inline bool acr::ctype_c_bad_rec_curs_ValidQ(ctype_c_bad_rec_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FCtype.c_bad_rec_curs.Next
+// proceed to next item
+inline void acr::ctype_c_bad_rec_curs_Next(ctype_c_bad_rec_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FCtype.c_bad_rec_curs.Access
+// item access
+inline acr::FRec& acr::ctype_c_bad_rec_curs_Access(ctype_c_bad_rec_curs &curs) {
+    return *curs.elems[curs.index];
+}
 inline acr::trace::trace() {
 }
 
@@ -912,6 +1007,16 @@ inline acr::FCtype& acr::ctype_qFind(i32 t) {
     return _db.ctype_lary[bsr][index];
 }
 
+// --- acr.FDb.ctype.check_qFind
+// 'quick' Access value of column check by row id. No bounds checking.
+inline bool& acr::ctype_check_qFind(i32 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.ctype_check_lary[bsr][index];
+}
+
 // --- acr.FDb.anonfld.EmptyQ
 // Return true if index is empty
 inline bool acr::anonfld_EmptyQ() {
@@ -1766,6 +1871,149 @@ inline acr::FCppfunc& acr::cppfunc_qFind(u64 t) {
     return _db.cppfunc_lary[bsr][index];
 }
 
+// --- acr.FDb.c_stage.EmptyQ
+// Return true if index is empty
+inline bool acr::c_stage_EmptyQ() {
+    return _db.c_stage_n == 0;
+}
+
+// --- acr.FDb.c_stage.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FSsimfile* acr::c_stage_Find(u32 t) {
+    acr::FSsimfile *retval = NULL;
+    u64 idx = t;
+    u64 lim = _db.c_stage_n;
+    if (idx < lim) {
+        retval = _db.c_stage_elems[idx];
+    }
+    return retval;
+}
+
+// --- acr.FDb.c_stage.Getary
+// Return array of pointers
+inline algo::aryptr<acr::FSsimfile*> acr::c_stage_Getary() {
+    return algo::aryptr<acr::FSsimfile*>(_db.c_stage_elems, _db.c_stage_n);
+}
+
+// --- acr.FDb.c_stage.N
+// Return number of items in the pointer array
+inline i32 acr::c_stage_N() {
+    return _db.c_stage_n;
+}
+
+// --- acr.FDb.c_stage.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void acr::c_stage_RemoveAll() {
+    for (u32 i = 0; i < _db.c_stage_n; i++) {
+        // mark all elements as not-in-array
+        _db.c_stage_elems[i]->_db_c_stage_in_ary = false;
+    }
+    _db.c_stage_n = 0;
+}
+
+// --- acr.FDb.c_check.EmptyQ
+// Return true if index is empty
+inline bool acr::c_check_EmptyQ() {
+    return _db.c_check_n == 0;
+}
+
+// --- acr.FDb.c_check.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FCtype* acr::c_check_Find(u32 t) {
+    acr::FCtype *retval = NULL;
+    u64 idx = t;
+    u64 lim = _db.c_check_n;
+    if (idx < lim) {
+        retval = _db.c_check_elems[idx];
+    }
+    return retval;
+}
+
+// --- acr.FDb.c_check.Getary
+// Return array of pointers
+inline algo::aryptr<acr::FCtype*> acr::c_check_Getary() {
+    return algo::aryptr<acr::FCtype*>(_db.c_check_elems, _db.c_check_n);
+}
+
+// --- acr.FDb.c_check.N
+// Return number of items in the pointer array
+inline i32 acr::c_check_N() {
+    return _db.c_check_n;
+}
+
+// --- acr.FDb.c_check.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void acr::c_check_RemoveAll() {
+    _db.c_check_n = 0;
+}
+
+// --- acr.FDb.watch_ns.EmptyQ
+// Return true if index is empty
+inline bool acr::watch_ns_EmptyQ() {
+    return _db.watch_ns_n == 0;
+}
+
+// --- acr.FDb.watch_ns.Find
+// Look up row by row id. Return NULL if out of range
+inline algo::cstring* acr::watch_ns_Find(u64 t) {
+    u64 idx = t;
+    u64 lim = _db.watch_ns_n;
+    if (idx >= lim) return NULL;
+    return _db.watch_ns_elems + idx;
+}
+
+// --- acr.FDb.watch_ns.Getary
+// Return array pointer by value
+inline algo::aryptr<algo::cstring> acr::watch_ns_Getary() {
+    return algo::aryptr<algo::cstring>(_db.watch_ns_elems, _db.watch_ns_n);
+}
+
+// --- acr.FDb.watch_ns.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline algo::cstring* acr::watch_ns_Last() {
+    return watch_ns_Find(u64(_db.watch_ns_n-1));
+}
+
+// --- acr.FDb.watch_ns.Max
+// Return max. number of items in the array
+inline i32 acr::watch_ns_Max() {
+    return _db.watch_ns_max;
+}
+
+// --- acr.FDb.watch_ns.N
+// Return number of items in the array
+inline i32 acr::watch_ns_N() {
+    return _db.watch_ns_n;
+}
+
+// --- acr.FDb.watch_ns.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void acr::watch_ns_Reserve(int n) {
+    u32 new_n = _db.watch_ns_n + n;
+    if (UNLIKELY(new_n > _db.watch_ns_max)) {
+        watch_ns_AbsReserve(new_n);
+    }
+}
+
+// --- acr.FDb.watch_ns.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline algo::cstring& acr::watch_ns_qFind(u64 t) {
+    return _db.watch_ns_elems[t];
+}
+
+// --- acr.FDb.watch_ns.qLast
+// Return reference to last element of array. No bounds checking
+inline algo::cstring& acr::watch_ns_qLast() {
+    return watch_ns_qFind(u64(_db.watch_ns_n-1));
+}
+
+// --- acr.FDb.watch_ns.rowid_Get
+// Return row id of specified element
+inline u64 acr::watch_ns_rowid_Get(algo::cstring &elem) {
+    u64 id = &elem - _db.watch_ns_elems;
+    return u64(id);
+}
+
 // --- acr.FDb.zd_pline_curs.Reset
 // cursor points to valid item
 inline void acr::_db_zd_pline_curs_Reset(_db_zd_pline_curs &curs, acr::FDb &parent) {
@@ -1839,6 +2087,40 @@ inline acr::FCtype& acr::_db_ctype_curs_Access(_db_ctype_curs &curs) {
     return ctype_qFind(i32(curs.index));
 }
 
+// --- acr.FDb.ctype_check_curs.Reset
+// Position cursor at the value of row 0 in column check
+inline void acr::_db_ctype_check_curs_Reset(_db_ctype_check_curs &curs, acr::FDb &parent) {
+    curs.parent = &parent;
+    curs.elems = _db.ctype_check_lary[0];
+    curs.index = 0;
+    curs.i = 0;
+    curs.level = 0;
+}
+
+// --- acr.FDb.ctype_check_curs.ValidQ
+// cursor points to valid item
+inline bool acr::_db_ctype_check_curs_ValidQ(_db_ctype_check_curs &curs) {
+    return curs.index < _db.ctype_n;
+}
+
+// --- acr.FDb.ctype_check_curs.Next
+// proceed to next item
+inline void acr::_db_ctype_check_curs_Next(_db_ctype_check_curs &curs) {
+    curs.index++;
+    curs.i++;
+    if (curs.i == (i64(1) << curs.level)) {// proceed to next level
+        curs.level++;
+        curs.i = 0;
+        curs.elems = _db.ctype_check_lary[curs.level];
+    }
+}
+
+// --- acr.FDb.ctype_check_curs.Access
+// item access
+inline bool& acr::_db_ctype_check_curs_Access(_db_ctype_check_curs &curs) {
+    return curs.elems[curs.i];
+}
+
 // --- acr.FDb.anonfld_curs.Reset
 // cursor points to valid item
 inline void acr::_db_anonfld_curs_Reset(_db_anonfld_curs &curs, acr::FDb &parent) {
@@ -2258,35 +2540,110 @@ inline void acr::_db_cppfunc_curs_Next(_db_cppfunc_curs &curs) {
 inline acr::FCppfunc& acr::_db_cppfunc_curs_Access(_db_cppfunc_curs &curs) {
     return cppfunc_qFind(u64(curs.index));
 }
-inline acr::FErr::FErr() {
-    acr::FErr_Init(*this);
+
+// --- acr.FDb.c_stage_curs.Reset
+inline void acr::_db_c_stage_curs_Reset(_db_c_stage_curs &curs, acr::FDb &parent) {
+    curs.elems = parent.c_stage_elems;
+    curs.n_elems = parent.c_stage_n;
+    curs.index = 0;
 }
 
-inline acr::FErr::~FErr() {
-    acr::FErr_Uninit(*this);
+// --- acr.FDb.c_stage_curs.ValidQ
+// cursor points to valid item
+inline bool acr::_db_c_stage_curs_ValidQ(_db_c_stage_curs &curs) {
+    return curs.index < curs.n_elems;
 }
 
+// --- acr.FDb.c_stage_curs.Next
+// proceed to next item
+inline void acr::_db_c_stage_curs_Next(_db_c_stage_curs &curs) {
+    curs.index++;
+}
 
-// --- acr.FErr..Init
-// Set all fields to initial values.
-inline void acr::FErr_Init(acr::FErr& err) {
-    err.ctype = NULL;
-    err.id = u32(0);
-    err.rec = NULL;
-    err.fld = NULL;
-    err.err_next = (acr::FErr*)-1; // (acr.FDb.err) not-in-tpool's freelist
-    err.zd_all_err_next = (acr::FErr*)-1; // (acr.FDb.zd_all_err) not-in-list
-    err.zd_all_err_prev = NULL; // (acr.FDb.zd_all_err)
+// --- acr.FDb.c_stage_curs.Access
+// item access
+inline acr::FSsimfile& acr::_db_c_stage_curs_Access(_db_c_stage_curs &curs) {
+    return *curs.elems[curs.index];
 }
-inline acr::FEvalattr::FEvalattr(bool                           in_pick_dflt
-        ,bool                           in_normalize
-        ,acr::FField*                   in_field
-        ,algo::Attr*                    in_attr
-        ,const algo::strptr&            in_value
-        ,const algo::i32_Range&         in_val_range)
-    : pick_dflt(in_pick_dflt)
-    , normalize(in_normalize)
-    , field(in_field)
+
+// --- acr.FDb.c_check_curs.Reset
+inline void acr::_db_c_check_curs_Reset(_db_c_check_curs &curs, acr::FDb &parent) {
+    curs.elems = parent.c_check_elems;
+    curs.n_elems = parent.c_check_n;
+    curs.index = 0;
+}
+
+// --- acr.FDb.c_check_curs.ValidQ
+// cursor points to valid item
+inline bool acr::_db_c_check_curs_ValidQ(_db_c_check_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FDb.c_check_curs.Next
+// proceed to next item
+inline void acr::_db_c_check_curs_Next(_db_c_check_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FDb.c_check_curs.Access
+// item access
+inline acr::FCtype& acr::_db_c_check_curs_Access(_db_c_check_curs &curs) {
+    return *curs.elems[curs.index];
+}
+
+// --- acr.FDb.watch_ns_curs.Next
+// proceed to next item
+inline void acr::_db_watch_ns_curs_Next(_db_watch_ns_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FDb.watch_ns_curs.Reset
+inline void acr::_db_watch_ns_curs_Reset(_db_watch_ns_curs &curs, acr::FDb &parent) {
+    curs.elems = parent.watch_ns_elems;
+    curs.n_elems = parent.watch_ns_n;
+    curs.index = 0;
+}
+
+// --- acr.FDb.watch_ns_curs.ValidQ
+// cursor points to valid item
+inline bool acr::_db_watch_ns_curs_ValidQ(_db_watch_ns_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FDb.watch_ns_curs.Access
+// item access
+inline algo::cstring& acr::_db_watch_ns_curs_Access(_db_watch_ns_curs &curs) {
+    return curs.elems[curs.index];
+}
+inline acr::FErr::FErr() {
+    acr::FErr_Init(*this);
+}
+
+inline acr::FErr::~FErr() {
+    acr::FErr_Uninit(*this);
+}
+
+
+// --- acr.FErr..Init
+// Set all fields to initial values.
+inline void acr::FErr_Init(acr::FErr& err) {
+    err.ctype = NULL;
+    err.id = u32(0);
+    err.rec = NULL;
+    err.fld = NULL;
+    err.err_next = (acr::FErr*)-1; // (acr.FDb.err) not-in-tpool's freelist
+    err.zd_all_err_next = (acr::FErr*)-1; // (acr.FDb.zd_all_err) not-in-list
+    err.zd_all_err_prev = NULL; // (acr.FDb.zd_all_err)
+}
+inline acr::FEvalattr::FEvalattr(bool                           in_pick_dflt
+        ,bool                           in_normalize
+        ,acr::FField*                   in_field
+        ,algo::Attr*                    in_attr
+        ,const algo::strptr&            in_value
+        ,const algo::i32_Range&         in_val_range)
+    : pick_dflt(in_pick_dflt)
+    , normalize(in_normalize)
+    , field(in_field)
     , attr(in_attr)
     , value(in_value)
     , val_range(in_val_range)
@@ -2333,6 +2690,123 @@ inline void acr::c_substr_Remove(acr::FField& field, acr::FSubstr& row) {
         field.c_substr = NULL;
     }
 }
+
+// --- acr.FField.ind_attrval.EmptyQ
+// Return true if hash is empty
+inline bool acr::ind_attrval_EmptyQ(acr::FField& field) {
+    return field.ind_attrval_n == 0;
+}
+
+// --- acr.FField.ind_attrval.N
+// Return number of items in the hash
+inline i32 acr::ind_attrval_N(const acr::FField& field) {
+    return field.ind_attrval_n;
+}
+
+// --- acr.FField.tr_attrval.EmptyQ
+// Return true if index is empty
+inline bool acr::tr_attrval_EmptyQ(acr::FField& field) {
+    return field.tr_attrval_root == NULL;
+}
+
+// --- acr.FField.tr_attrval.InTreeQ
+// Return true if row is in the tree, false otherwise
+inline bool acr::tr_attrval_InTreeQ(acr::FAttrval& row) {
+    return row.tr_attrval_up != (acr::FAttrval*)-1;
+}
+
+// --- acr.FField.tr_attrval.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void acr::tr_attrval_RemoveAll(acr::FField& field) {
+    tr_attrval_RemoveAllImpl(field, field.tr_attrval_root, false);
+    field.tr_attrval_root = NULL;
+    field.tr_attrval_n = 0;
+}
+
+// --- acr.FField.c_bad_rec.EmptyQ
+// Return true if index is empty
+inline bool acr::c_bad_rec_EmptyQ(acr::FField& field) {
+    return field.c_bad_rec_n == 0;
+}
+
+// --- acr.FField.c_bad_rec.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FRec* acr::c_bad_rec_Find(acr::FField& field, u32 t) {
+    acr::FRec *retval = NULL;
+    u64 idx = t;
+    u64 lim = field.c_bad_rec_n;
+    if (idx < lim) {
+        retval = field.c_bad_rec_elems[idx];
+    }
+    return retval;
+}
+
+// --- acr.FField.c_bad_rec.Getary
+// Return array of pointers
+inline algo::aryptr<acr::FRec*> acr::c_bad_rec_Getary(acr::FField& field) {
+    return algo::aryptr<acr::FRec*>(field.c_bad_rec_elems, field.c_bad_rec_n);
+}
+
+// --- acr.FField.c_bad_rec.N
+// Return number of items in the pointer array
+inline i32 acr::c_bad_rec_N(const acr::FField& field) {
+    return field.c_bad_rec_n;
+}
+
+// --- acr.FField.c_bad_rec.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void acr::c_bad_rec_RemoveAll(acr::FField& field) {
+    field.c_bad_rec_n = 0;
+}
+
+// --- acr.FField.tr_attrval_curs.Reset
+// cursor points to valid item
+inline void acr::field_tr_attrval_curs_Reset(field_tr_attrval_curs &curs, acr::FField& parent) {
+    curs.row = tr_attrval_First(parent);
+}
+
+// --- acr.FField.tr_attrval_curs.ValidQ
+// cursor points to valid item
+inline bool acr::field_tr_attrval_curs_ValidQ(field_tr_attrval_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- acr.FField.tr_attrval_curs.Next
+// proceed to next item
+inline void acr::field_tr_attrval_curs_Next(field_tr_attrval_curs &curs) {
+    curs.row = tr_attrval_Next(*curs.row);
+}
+
+// --- acr.FField.tr_attrval_curs.Access
+// item access
+inline acr::FAttrval& acr::field_tr_attrval_curs_Access(field_tr_attrval_curs &curs) {
+    return *curs.row;
+}
+
+// --- acr.FField.c_bad_rec_curs.Reset
+inline void acr::field_c_bad_rec_curs_Reset(field_c_bad_rec_curs &curs, acr::FField &parent) {
+    curs.elems = parent.c_bad_rec_elems;
+    curs.n_elems = parent.c_bad_rec_n;
+    curs.index = 0;
+}
+
+// --- acr.FField.c_bad_rec_curs.ValidQ
+// cursor points to valid item
+inline bool acr::field_c_bad_rec_curs_ValidQ(field_c_bad_rec_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FField.c_bad_rec_curs.Next
+// proceed to next item
+inline void acr::field_c_bad_rec_curs_Next(field_c_bad_rec_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FField.c_bad_rec_curs.Access
+// item access
+inline acr::FRec& acr::field_c_bad_rec_curs_Access(field_c_bad_rec_curs &curs) {
+    return *curs.elems[curs.index];
+}
 inline acr::FFile::FFile() {
     acr::FFile_Init(*this);
 }
@@ -2453,6 +2927,224 @@ inline void acr::FPdep_Init(acr::FPdep& pdep) {
     pdep.zd_child_next = (acr::FPdep*)-1; // (acr.FPline.zd_child) not-in-list
     pdep.zd_child_prev = NULL; // (acr.FPline.zd_child)
 }
+inline acr::FPkeybuild::FPkeybuild() {
+    acr::FPkeybuild_Init(*this);
+}
+
+inline acr::FPkeybuild::~FPkeybuild() {
+    acr::FPkeybuild_Uninit(*this);
+}
+
+
+// --- acr.FPkeybuild.ent.EmptyQ
+// Return true if index is empty
+inline bool acr::ent_EmptyQ(acr::FPkeybuild& pkeybuild) {
+    return pkeybuild.ent_n == 0;
+}
+
+// --- acr.FPkeybuild.ent.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FPkeyent* acr::ent_Find(acr::FPkeybuild& pkeybuild, u64 t) {
+    u64 idx = t;
+    u64 lim = pkeybuild.ent_n;
+    if (idx >= lim) return NULL;
+    return pkeybuild.ent_elems + idx;
+}
+
+// --- acr.FPkeybuild.ent.Getary
+// Return array pointer by value
+inline algo::aryptr<acr::FPkeyent> acr::ent_Getary(acr::FPkeybuild& pkeybuild) {
+    return algo::aryptr<acr::FPkeyent>(pkeybuild.ent_elems, pkeybuild.ent_n);
+}
+
+// --- acr.FPkeybuild.ent.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline acr::FPkeyent* acr::ent_Last(acr::FPkeybuild& pkeybuild) {
+    return ent_Find(pkeybuild, u64(pkeybuild.ent_n-1));
+}
+
+// --- acr.FPkeybuild.ent.Max
+// Return max. number of items in the array
+inline i32 acr::ent_Max(acr::FPkeybuild& pkeybuild) {
+    (void)pkeybuild;
+    return pkeybuild.ent_max;
+}
+
+// --- acr.FPkeybuild.ent.N
+// Return number of items in the array
+inline i32 acr::ent_N(const acr::FPkeybuild& pkeybuild) {
+    return pkeybuild.ent_n;
+}
+
+// --- acr.FPkeybuild.ent.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void acr::ent_Reserve(acr::FPkeybuild& pkeybuild, int n) {
+    u32 new_n = pkeybuild.ent_n + n;
+    if (UNLIKELY(new_n > pkeybuild.ent_max)) {
+        ent_AbsReserve(pkeybuild, new_n);
+    }
+}
+
+// --- acr.FPkeybuild.ent.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline acr::FPkeyent& acr::ent_qFind(acr::FPkeybuild& pkeybuild, u64 t) {
+    return pkeybuild.ent_elems[t];
+}
+
+// --- acr.FPkeybuild.ent.qLast
+// Return reference to last element of array. No bounds checking
+inline acr::FPkeyent& acr::ent_qLast(acr::FPkeybuild& pkeybuild) {
+    return ent_qFind(pkeybuild, u64(pkeybuild.ent_n-1));
+}
+
+// --- acr.FPkeybuild.ent.rowid_Get
+// Return row id of specified element
+inline u64 acr::ent_rowid_Get(acr::FPkeybuild& pkeybuild, acr::FPkeyent &elem) {
+    u64 id = &elem - pkeybuild.ent_elems;
+    return u64(id);
+}
+
+// --- acr.FPkeybuild.ref.EmptyQ
+// Return true if index is empty
+inline bool acr::ref_EmptyQ(acr::FPkeybuild& pkeybuild) {
+    return pkeybuild.ref_n == 0;
+}
+
+// --- acr.FPkeybuild.ref.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FPkeyent* acr::ref_Find(acr::FPkeybuild& pkeybuild, u64 t) {
+    u64 idx = t;
+    u64 lim = pkeybuild.ref_n;
+    if (idx >= lim) return NULL;
+    return pkeybuild.ref_elems + idx;
+}
+
+// --- acr.FPkeybuild.ref.Getary
+// Return array pointer by value
+inline algo::aryptr<acr::FPkeyent> acr::ref_Getary(acr::FPkeybuild& pkeybuild) {
+    return algo::aryptr<acr::FPkeyent>(pkeybuild.ref_elems, pkeybuild.ref_n);
+}
+
+// --- acr.FPkeybuild.ref.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline acr::FPkeyent* acr::ref_Last(acr::FPkeybuild& pkeybuild) {
+    return ref_Find(pkeybuild, u64(pkeybuild.ref_n-1));
+}
+
+// --- acr.FPkeybuild.ref.Max
+// Return max. number of items in the array
+inline i32 acr::ref_Max(acr::FPkeybuild& pkeybuild) {
+    (void)pkeybuild;
+    return pkeybuild.ref_max;
+}
+
+// --- acr.FPkeybuild.ref.N
+// Return number of items in the array
+inline i32 acr::ref_N(const acr::FPkeybuild& pkeybuild) {
+    return pkeybuild.ref_n;
+}
+
+// --- acr.FPkeybuild.ref.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void acr::ref_Reserve(acr::FPkeybuild& pkeybuild, int n) {
+    u32 new_n = pkeybuild.ref_n + n;
+    if (UNLIKELY(new_n > pkeybuild.ref_max)) {
+        ref_AbsReserve(pkeybuild, new_n);
+    }
+}
+
+// --- acr.FPkeybuild.ref.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline acr::FPkeyent& acr::ref_qFind(acr::FPkeybuild& pkeybuild, u64 t) {
+    return pkeybuild.ref_elems[t];
+}
+
+// --- acr.FPkeybuild.ref.qLast
+// Return reference to last element of array. No bounds checking
+inline acr::FPkeyent& acr::ref_qLast(acr::FPkeybuild& pkeybuild) {
+    return ref_qFind(pkeybuild, u64(pkeybuild.ref_n-1));
+}
+
+// --- acr.FPkeybuild.ref.rowid_Get
+// Return row id of specified element
+inline u64 acr::ref_rowid_Get(acr::FPkeybuild& pkeybuild, acr::FPkeyent &elem) {
+    u64 id = &elem - pkeybuild.ref_elems;
+    return u64(id);
+}
+
+// --- acr.FPkeybuild.ent_curs.Next
+// proceed to next item
+inline void acr::pkeybuild_ent_curs_Next(pkeybuild_ent_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FPkeybuild.ent_curs.Reset
+inline void acr::pkeybuild_ent_curs_Reset(pkeybuild_ent_curs &curs, acr::FPkeybuild &parent) {
+    curs.elems = parent.ent_elems;
+    curs.n_elems = parent.ent_n;
+    curs.index = 0;
+}
+
+// --- acr.FPkeybuild.ent_curs.ValidQ
+// cursor points to valid item
+inline bool acr::pkeybuild_ent_curs_ValidQ(pkeybuild_ent_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FPkeybuild.ent_curs.Access
+// item access
+inline acr::FPkeyent& acr::pkeybuild_ent_curs_Access(pkeybuild_ent_curs &curs) {
+    return curs.elems[curs.index];
+}
+
+// --- acr.FPkeybuild.ref_curs.Next
+// proceed to next item
+inline void acr::pkeybuild_ref_curs_Next(pkeybuild_ref_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FPkeybuild.ref_curs.Reset
+inline void acr::pkeybuild_ref_curs_Reset(pkeybuild_ref_curs &curs, acr::FPkeybuild &parent) {
+    curs.elems = parent.ref_elems;
+    curs.n_elems = parent.ref_n;
+    curs.index = 0;
+}
+
+// --- acr.FPkeybuild.ref_curs.ValidQ
+// cursor points to valid item
+inline bool acr::pkeybuild_ref_curs_ValidQ(pkeybuild_ref_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FPkeybuild.ref_curs.Access
+// item access
+inline acr::FPkeyent& acr::pkeybuild_ref_curs_Access(pkeybuild_ref_curs &curs) {
+    return curs.elems[curs.index];
+}
+
+// --- acr.FPkeybuild..Init
+// Set all fields to initial values.
+inline void acr::FPkeybuild_Init(acr::FPkeybuild& pkeybuild) {
+    pkeybuild.ent_elems 	= 0; // (acr.FPkeybuild.ent)
+    pkeybuild.ent_n     	= 0; // (acr.FPkeybuild.ent)
+    pkeybuild.ent_max   	= 0; // (acr.FPkeybuild.ent)
+    pkeybuild.ref_elems 	= 0; // (acr.FPkeybuild.ref)
+    pkeybuild.ref_n     	= 0; // (acr.FPkeybuild.ref)
+    pkeybuild.ref_max   	= 0; // (acr.FPkeybuild.ref)
+}
+inline acr::FPkeyent::FPkeyent() {
+    acr::FPkeyent_Init(*this);
+}
+
+
+// --- acr.FPkeyent..Init
+// Set all fields to initial values.
+inline void acr::FPkeyent_Init(acr::FPkeyent& ent) {
+    ent.lineoff = u32(0);
+    ent.linelen = u32(0);
+    ent.lineno = u32(0);
+    ent.rowid = u32(0);
+}
 
 inline bool acr::PlineKey::operator ==(const acr::PlineKey &rhs) const {
     return acr::PlineKey_Eq(const_cast<acr::PlineKey&>(*this),const_cast<acr::PlineKey&>(rhs));
@@ -2663,6 +3355,42 @@ inline void acr::c_pline_RemoveAll(acr::FPrint& print) {
     print.c_pline_n = 0;
 }
 
+// --- acr.FPrint.c_ctype.EmptyQ
+// Return true if index is empty
+inline bool acr::c_ctype_EmptyQ(acr::FPrint& print) {
+    return print.c_ctype_n == 0;
+}
+
+// --- acr.FPrint.c_ctype.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FCtype* acr::c_ctype_Find(acr::FPrint& print, u32 t) {
+    acr::FCtype *retval = NULL;
+    u64 idx = t;
+    u64 lim = print.c_ctype_n;
+    if (idx < lim) {
+        retval = print.c_ctype_elems[idx];
+    }
+    return retval;
+}
+
+// --- acr.FPrint.c_ctype.Getary
+// Return array of pointers
+inline algo::aryptr<acr::FCtype*> acr::c_ctype_Getary(acr::FPrint& print) {
+    return algo::aryptr<acr::FCtype*>(print.c_ctype_elems, print.c_ctype_n);
+}
+
+// --- acr.FPrint.c_ctype.N
+// Return number of items in the pointer array
+inline i32 acr::c_ctype_N(const acr::FPrint& print) {
+    return print.c_ctype_n;
+}
+
+// --- acr.FPrint.c_ctype.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void acr::c_ctype_RemoveAll(acr::FPrint& print) {
+    print.c_ctype_n = 0;
+}
+
 // --- acr.FPrint.c_pline_curs.Reset
 inline void acr::print_c_pline_curs_Reset(print_c_pline_curs &curs, acr::FPrint &parent) {
     curs.elems = parent.c_pline_elems;
@@ -2687,8 +3415,33 @@ inline void acr::print_c_pline_curs_Next(print_c_pline_curs &curs) {
 inline acr::FPline& acr::print_c_pline_curs_Access(print_c_pline_curs &curs) {
     return *curs.elems[curs.index];
 }
-inline acr::FPrintAttr::FPrintAttr() {
-    acr::FPrintAttr_Init(*this);
+
+// --- acr.FPrint.c_ctype_curs.Reset
+inline void acr::print_c_ctype_curs_Reset(print_c_ctype_curs &curs, acr::FPrint &parent) {
+    curs.elems = parent.c_ctype_elems;
+    curs.n_elems = parent.c_ctype_n;
+    curs.index = 0;
+}
+
+// --- acr.FPrint.c_ctype_curs.ValidQ
+// cursor points to valid item
+inline bool acr::print_c_ctype_curs_ValidQ(print_c_ctype_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FPrint.c_ctype_curs.Next
+// proceed to next item
+inline void acr::print_c_ctype_curs_Next(print_c_ctype_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FPrint.c_ctype_curs.Access
+// item access
+inline acr::FCtype& acr::print_c_ctype_curs_Access(print_c_ctype_curs &curs) {
+    return *curs.elems[curs.index];
+}
+inline acr::FPrintAttr::FPrintAttr() {
+    acr::FPrintAttr_Init(*this);
 }
 
 inline acr::FPrintAttr::~FPrintAttr() {
@@ -2736,114 +3489,6 @@ inline acr::Queryop::operator acr_Queryop_value_Enum () const {
 inline void acr::Queryop_Init(acr::Queryop& parent) {
     parent.value = u8(0);
 }
-inline acr::FQuery::FQuery() {
-    acr::FQuery_Init(*this);
-}
-
-inline acr::FQuery::~FQuery() {
-    acr::FQuery_Uninit(*this);
-}
-
-
-inline bool acr::RecSortkey::operator ==(const acr::RecSortkey &rhs) const {
-    return acr::RecSortkey_Eq(const_cast<acr::RecSortkey&>(*this),const_cast<acr::RecSortkey&>(rhs));
-}
-
-inline bool acr::RecSortkey::operator <(const acr::RecSortkey &rhs) const {
-    return acr::RecSortkey_Lt(const_cast<acr::RecSortkey&>(*this),const_cast<acr::RecSortkey&>(rhs));
-}
-inline acr::RecSortkey::RecSortkey() {
-    acr::RecSortkey_Init(*this);
-}
-
-
-// --- acr.RecSortkey..Hash
-inline u32 acr::RecSortkey_Hash(u32 prev, const acr::RecSortkey & rhs) {
-    prev = double_Hash(prev, rhs.num);
-    prev = cstring_Hash(prev, rhs.str);
-    prev = float_Hash(prev, rhs.rowid);
-    return prev;
-}
-
-// --- acr.RecSortkey..Lt
-inline bool acr::RecSortkey_Lt(acr::RecSortkey & lhs, acr::RecSortkey & rhs) {
-    return RecSortkey_Cmp(lhs,rhs) < 0;
-}
-
-// --- acr.RecSortkey..Cmp
-inline i32 acr::RecSortkey_Cmp(acr::RecSortkey & lhs, acr::RecSortkey & rhs) {
-    i32 retval = 0;
-    retval = double_Cmp(lhs.num, rhs.num);
-    if (retval != 0) {
-        return retval;
-    }
-    retval = algo::cstring_Cmp(lhs.str, rhs.str);
-    if (retval != 0) {
-        return retval;
-    }
-    retval = float_Cmp(lhs.rowid, rhs.rowid);
-    return retval;
-}
-
-// --- acr.RecSortkey..Init
-// Set all fields to initial values.
-inline void acr::RecSortkey_Init(acr::RecSortkey& parent) {
-    parent.num = double(0.0);
-    parent.rowid = float(0.f);
-}
-
-// --- acr.RecSortkey..Eq
-inline bool acr::RecSortkey_Eq(const acr::RecSortkey & lhs,const acr::RecSortkey & rhs) {
-    bool retval = true;
-    retval = double_Eq(lhs.num, rhs.num);
-    if (!retval) {
-        return false;
-    }
-    retval = algo::cstring_Eq(lhs.str, rhs.str);
-    if (!retval) {
-        return false;
-    }
-    retval = float_Eq(lhs.rowid, rhs.rowid);
-    return retval;
-}
-
-// --- acr.RecSortkey..Update
-// Set value. Return true if new value is different from old value.
-inline bool acr::RecSortkey_Update(acr::RecSortkey &lhs, acr::RecSortkey & rhs) {
-    bool ret = !RecSortkey_Eq(lhs, rhs); // compare values
-    if (ret) {
-        lhs = rhs; // update
-    }
-    return ret;
-}
-inline acr::FRec::FRec() {
-    acr::FRec_Init(*this);
-}
-
-inline acr::FRec::~FRec() {
-    acr::FRec_Uninit(*this);
-}
-
-
-// --- acr.FRec.c_pline.InsertMaybe
-// Insert row into pointer index. Return final membership status.
-inline bool acr::c_pline_InsertMaybe(acr::FRec& rec, acr::FPline& row) {
-    acr::FPline* ptr = rec.c_pline;
-    bool retval = (ptr == NULL) | (ptr == &row);
-    if (retval) {
-        rec.c_pline = &row;
-    }
-    return retval;
-}
-
-// --- acr.FRec.c_pline.Remove
-// Remove element from index. If element is not in index, do nothing.
-inline void acr::c_pline_Remove(acr::FRec& rec, acr::FPline& row) {
-    acr::FPline *ptr = rec.c_pline;
-    if (LIKELY(ptr == &row)) {
-        rec.c_pline = NULL;
-    }
-}
 inline acr::FRun::FRun() {
     acr::FRun_Init(*this);
 }
@@ -3001,6 +3646,78 @@ inline void acr::c_child_RemoveAll(acr::FRun& run) {
     run.c_child_n = 0;
 }
 
+// --- acr.FRun.c_query.EmptyQ
+// Return true if index is empty
+inline bool acr::c_query_EmptyQ(acr::FRun& run) {
+    return run.c_query_n == 0;
+}
+
+// --- acr.FRun.c_query.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FQuery* acr::c_query_Find(acr::FRun& run, u32 t) {
+    acr::FQuery *retval = NULL;
+    u64 idx = t;
+    u64 lim = run.c_query_n;
+    if (idx < lim) {
+        retval = run.c_query_elems[idx];
+    }
+    return retval;
+}
+
+// --- acr.FRun.c_query.Getary
+// Return array of pointers
+inline algo::aryptr<acr::FQuery*> acr::c_query_Getary(acr::FRun& run) {
+    return algo::aryptr<acr::FQuery*>(run.c_query_elems, run.c_query_n);
+}
+
+// --- acr.FRun.c_query.N
+// Return number of items in the pointer array
+inline i32 acr::c_query_N(const acr::FRun& run) {
+    return run.c_query_n;
+}
+
+// --- acr.FRun.c_query.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void acr::c_query_RemoveAll(acr::FRun& run) {
+    run.c_query_n = 0;
+}
+
+// --- acr.FRun.c_match.EmptyQ
+// Return true if index is empty
+inline bool acr::c_match_EmptyQ(acr::FRun& run) {
+    return run.c_match_n == 0;
+}
+
+// --- acr.FRun.c_match.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FRec* acr::c_match_Find(acr::FRun& run, u32 t) {
+    acr::FRec *retval = NULL;
+    u64 idx = t;
+    u64 lim = run.c_match_n;
+    if (idx < lim) {
+        retval = run.c_match_elems[idx];
+    }
+    return retval;
+}
+
+// --- acr.FRun.c_match.Getary
+// Return array of pointers
+inline algo::aryptr<acr::FRec*> acr::c_match_Getary(acr::FRun& run) {
+    return algo::aryptr<acr::FRec*>(run.c_match_elems, run.c_match_n);
+}
+
+// --- acr.FRun.c_match.N
+// Return number of items in the pointer array
+inline i32 acr::c_match_N(const acr::FRun& run) {
+    return run.c_match_n;
+}
+
+// --- acr.FRun.c_match.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void acr::c_match_RemoveAll(acr::FRun& run) {
+    run.c_match_n = 0;
+}
+
 // --- acr.FRun.c_ctype_curs.Reset
 inline void acr::run_c_ctype_curs_Reset(run_c_ctype_curs &curs, acr::FRun &parent) {
     curs.elems = parent.c_ctype_elems;
@@ -3101,6 +3818,56 @@ inline acr::FCtype& acr::run_c_child_curs_Access(run_c_child_curs &curs) {
     return *curs.elems[curs.index];
 }
 
+// --- acr.FRun.c_query_curs.Reset
+inline void acr::run_c_query_curs_Reset(run_c_query_curs &curs, acr::FRun &parent) {
+    curs.elems = parent.c_query_elems;
+    curs.n_elems = parent.c_query_n;
+    curs.index = 0;
+}
+
+// --- acr.FRun.c_query_curs.ValidQ
+// cursor points to valid item
+inline bool acr::run_c_query_curs_ValidQ(run_c_query_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FRun.c_query_curs.Next
+// proceed to next item
+inline void acr::run_c_query_curs_Next(run_c_query_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FRun.c_query_curs.Access
+// item access
+inline acr::FQuery& acr::run_c_query_curs_Access(run_c_query_curs &curs) {
+    return *curs.elems[curs.index];
+}
+
+// --- acr.FRun.c_match_curs.Reset
+inline void acr::run_c_match_curs_Reset(run_c_match_curs &curs, acr::FRun &parent) {
+    curs.elems = parent.c_match_elems;
+    curs.n_elems = parent.c_match_n;
+    curs.index = 0;
+}
+
+// --- acr.FRun.c_match_curs.ValidQ
+// cursor points to valid item
+inline bool acr::run_c_match_curs_ValidQ(run_c_match_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FRun.c_match_curs.Next
+// proceed to next item
+inline void acr::run_c_match_curs_Next(run_c_match_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FRun.c_match_curs.Access
+// item access
+inline acr::FRec& acr::run_c_match_curs_Access(run_c_match_curs &curs) {
+    return *curs.elems[curs.index];
+}
+
 // --- acr.FRun..Init
 // Set all fields to initial values.
 inline void acr::FRun_Init(acr::FRun& run) {
@@ -3116,6 +3883,182 @@ inline void acr::FRun_Init(acr::FRun& run) {
     run.c_child_elems = NULL; // (acr.FRun.c_child)
     run.c_child_n = 0; // (acr.FRun.c_child)
     run.c_child_max = 0; // (acr.FRun.c_child)
+    run.c_query_elems = NULL; // (acr.FRun.c_query)
+    run.c_query_n = 0; // (acr.FRun.c_query)
+    run.c_query_max = 0; // (acr.FRun.c_query)
+    run.c_match_elems = NULL; // (acr.FRun.c_match)
+    run.c_match_n = 0; // (acr.FRun.c_match)
+    run.c_match_max = 0; // (acr.FRun.c_match)
+    run.scan = bool(false);
+}
+inline acr::FQuery::FQuery() {
+    acr::FQuery_Init(*this);
+}
+
+inline acr::FQuery::~FQuery() {
+    acr::FQuery_Uninit(*this);
+}
+
+
+inline bool acr::RecSortkey::operator ==(const acr::RecSortkey &rhs) const {
+    return acr::RecSortkey_Eq(const_cast<acr::RecSortkey&>(*this),const_cast<acr::RecSortkey&>(rhs));
+}
+
+inline bool acr::RecSortkey::operator <(const acr::RecSortkey &rhs) const {
+    return acr::RecSortkey_Lt(const_cast<acr::RecSortkey&>(*this),const_cast<acr::RecSortkey&>(rhs));
+}
+inline acr::RecSortkey::RecSortkey() {
+    acr::RecSortkey_Init(*this);
+}
+
+
+// --- acr.RecSortkey..Hash
+inline u32 acr::RecSortkey_Hash(u32 prev, const acr::RecSortkey & rhs) {
+    prev = double_Hash(prev, rhs.num);
+    prev = cstring_Hash(prev, rhs.str);
+    prev = float_Hash(prev, rhs.rowid);
+    return prev;
+}
+
+// --- acr.RecSortkey..Lt
+inline bool acr::RecSortkey_Lt(acr::RecSortkey & lhs, acr::RecSortkey & rhs) {
+    return RecSortkey_Cmp(lhs,rhs) < 0;
+}
+
+// --- acr.RecSortkey..Cmp
+inline i32 acr::RecSortkey_Cmp(acr::RecSortkey & lhs, acr::RecSortkey & rhs) {
+    i32 retval = 0;
+    retval = double_Cmp(lhs.num, rhs.num);
+    if (retval != 0) {
+        return retval;
+    }
+    retval = algo::cstring_Cmp(lhs.str, rhs.str);
+    if (retval != 0) {
+        return retval;
+    }
+    retval = float_Cmp(lhs.rowid, rhs.rowid);
+    return retval;
+}
+
+// --- acr.RecSortkey..Init
+// Set all fields to initial values.
+inline void acr::RecSortkey_Init(acr::RecSortkey& parent) {
+    parent.num = double(0.0);
+    parent.rowid = float(0.f);
+}
+
+// --- acr.RecSortkey..Eq
+inline bool acr::RecSortkey_Eq(const acr::RecSortkey & lhs,const acr::RecSortkey & rhs) {
+    bool retval = true;
+    retval = double_Eq(lhs.num, rhs.num);
+    if (!retval) {
+        return false;
+    }
+    retval = algo::cstring_Eq(lhs.str, rhs.str);
+    if (!retval) {
+        return false;
+    }
+    retval = float_Eq(lhs.rowid, rhs.rowid);
+    return retval;
+}
+
+// --- acr.RecSortkey..Update
+// Set value. Return true if new value is different from old value.
+inline bool acr::RecSortkey_Update(acr::RecSortkey &lhs, acr::RecSortkey & rhs) {
+    bool ret = !RecSortkey_Eq(lhs, rhs); // compare values
+    if (ret) {
+        lhs = rhs; // update
+    }
+    return ret;
+}
+inline acr::FRec::FRec() {
+    acr::FRec_Init(*this);
+}
+
+inline acr::FRec::~FRec() {
+    acr::FRec_Uninit(*this);
+}
+
+
+// --- acr.FRec.c_pline.InsertMaybe
+// Insert row into pointer index. Return final membership status.
+inline bool acr::c_pline_InsertMaybe(acr::FRec& rec, acr::FPline& row) {
+    acr::FPline* ptr = rec.c_pline;
+    bool retval = (ptr == NULL) | (ptr == &row);
+    if (retval) {
+        rec.c_pline = &row;
+    }
+    return retval;
+}
+
+// --- acr.FRec.c_pline.Remove
+// Remove element from index. If element is not in index, do nothing.
+inline void acr::c_pline_Remove(acr::FRec& rec, acr::FPline& row) {
+    acr::FPline *ptr = rec.c_pline;
+    if (LIKELY(ptr == &row)) {
+        rec.c_pline = NULL;
+    }
+}
+
+// --- acr.FRec.c_parent.EmptyQ
+// Return true if index is empty
+inline bool acr::c_parent_EmptyQ(acr::FRec& rec) {
+    return rec.c_parent_n == 0;
+}
+
+// --- acr.FRec.c_parent.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FRec* acr::c_parent_Find(acr::FRec& rec, u32 t) {
+    acr::FRec *retval = NULL;
+    u64 idx = t;
+    u64 lim = rec.c_parent_n;
+    if (idx < lim) {
+        retval = rec.c_parent_elems[idx];
+    }
+    return retval;
+}
+
+// --- acr.FRec.c_parent.Getary
+// Return array of pointers
+inline algo::aryptr<acr::FRec*> acr::c_parent_Getary(acr::FRec& rec) {
+    return algo::aryptr<acr::FRec*>(rec.c_parent_elems, rec.c_parent_n);
+}
+
+// --- acr.FRec.c_parent.N
+// Return number of items in the pointer array
+inline i32 acr::c_parent_N(const acr::FRec& rec) {
+    return rec.c_parent_n;
+}
+
+// --- acr.FRec.c_parent.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void acr::c_parent_RemoveAll(acr::FRec& rec) {
+    rec.c_parent_n = 0;
+}
+
+// --- acr.FRec.c_parent_curs.Reset
+inline void acr::rec_c_parent_curs_Reset(rec_c_parent_curs &curs, acr::FRec &parent) {
+    curs.elems = parent.c_parent_elems;
+    curs.n_elems = parent.c_parent_n;
+    curs.index = 0;
+}
+
+// --- acr.FRec.c_parent_curs.ValidQ
+// cursor points to valid item
+inline bool acr::rec_c_parent_curs_ValidQ(rec_c_parent_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FRec.c_parent_curs.Next
+// proceed to next item
+inline void acr::rec_c_parent_curs_Next(rec_c_parent_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FRec.c_parent_curs.Access
+// item access
+inline acr::FRec& acr::rec_c_parent_curs_Access(rec_c_parent_curs &curs) {
+    return *curs.elems[curs.index];
 }
 inline acr::FSmallstr::FSmallstr() {
     acr::FSmallstr_Init(*this);
@@ -3157,13 +4100,97 @@ inline void acr::c_ssimsort_Remove(acr::FSsimfile& ssimfile, acr::FSsimsort& row
     }
 }
 
-// --- acr.FSsimfile..Init
-// Set all fields to initial values.
-inline void acr::FSsimfile_Init(acr::FSsimfile& ssimfile) {
-    ssimfile.c_file = NULL;
-    ssimfile.p_ctype = NULL;
-    ssimfile.c_ssimsort = NULL;
-    ssimfile.ind_ssimfile_next = (acr::FSsimfile*)-1; // (acr.FDb.ind_ssimfile) not-in-hash
+// --- acr.FSsimfile.stagerow.EmptyQ
+// Return true if index is empty
+inline bool acr::stagerow_EmptyQ(acr::FSsimfile& ssimfile) {
+    return ssimfile.stagerow_n == 0;
+}
+
+// --- acr.FSsimfile.stagerow.Find
+// Look up row by row id. Return NULL if out of range
+inline acr::FStagerow* acr::stagerow_Find(acr::FSsimfile& ssimfile, u64 t) {
+    u64 idx = t;
+    u64 lim = ssimfile.stagerow_n;
+    if (idx >= lim) return NULL;
+    return ssimfile.stagerow_elems + idx;
+}
+
+// --- acr.FSsimfile.stagerow.Getary
+// Return array pointer by value
+inline algo::aryptr<acr::FStagerow> acr::stagerow_Getary(acr::FSsimfile& ssimfile) {
+    return algo::aryptr<acr::FStagerow>(ssimfile.stagerow_elems, ssimfile.stagerow_n);
+}
+
+// --- acr.FSsimfile.stagerow.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline acr::FStagerow* acr::stagerow_Last(acr::FSsimfile& ssimfile) {
+    return stagerow_Find(ssimfile, u64(ssimfile.stagerow_n-1));
+}
+
+// --- acr.FSsimfile.stagerow.Max
+// Return max. number of items in the array
+inline i32 acr::stagerow_Max(acr::FSsimfile& ssimfile) {
+    (void)ssimfile;
+    return ssimfile.stagerow_max;
+}
+
+// --- acr.FSsimfile.stagerow.N
+// Return number of items in the array
+inline i32 acr::stagerow_N(const acr::FSsimfile& ssimfile) {
+    return ssimfile.stagerow_n;
+}
+
+// --- acr.FSsimfile.stagerow.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void acr::stagerow_Reserve(acr::FSsimfile& ssimfile, int n) {
+    u32 new_n = ssimfile.stagerow_n + n;
+    if (UNLIKELY(new_n > ssimfile.stagerow_max)) {
+        stagerow_AbsReserve(ssimfile, new_n);
+    }
+}
+
+// --- acr.FSsimfile.stagerow.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline acr::FStagerow& acr::stagerow_qFind(acr::FSsimfile& ssimfile, u64 t) {
+    return ssimfile.stagerow_elems[t];
+}
+
+// --- acr.FSsimfile.stagerow.qLast
+// Return reference to last element of array. No bounds checking
+inline acr::FStagerow& acr::stagerow_qLast(acr::FSsimfile& ssimfile) {
+    return stagerow_qFind(ssimfile, u64(ssimfile.stagerow_n-1));
+}
+
+// --- acr.FSsimfile.stagerow.rowid_Get
+// Return row id of specified element
+inline u64 acr::stagerow_rowid_Get(acr::FSsimfile& ssimfile, acr::FStagerow &elem) {
+    u64 id = &elem - ssimfile.stagerow_elems;
+    return u64(id);
+}
+
+// --- acr.FSsimfile.stagerow_curs.Next
+// proceed to next item
+inline void acr::ssimfile_stagerow_curs_Next(ssimfile_stagerow_curs &curs) {
+    curs.index++;
+}
+
+// --- acr.FSsimfile.stagerow_curs.Reset
+inline void acr::ssimfile_stagerow_curs_Reset(ssimfile_stagerow_curs &curs, acr::FSsimfile &parent) {
+    curs.elems = parent.stagerow_elems;
+    curs.n_elems = parent.stagerow_n;
+    curs.index = 0;
+}
+
+// --- acr.FSsimfile.stagerow_curs.ValidQ
+// cursor points to valid item
+inline bool acr::ssimfile_stagerow_curs_ValidQ(ssimfile_stagerow_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- acr.FSsimfile.stagerow_curs.Access
+// item access
+inline acr::FStagerow& acr::ssimfile_stagerow_curs_Access(ssimfile_stagerow_curs &curs) {
+    return curs.elems[curs.index];
 }
 inline acr::FSsimsort::FSsimsort() {
     acr::FSsimsort_Init(*this);
@@ -3179,6 +4206,16 @@ inline acr::FSsimsort::~FSsimsort() {
 inline void acr::FSsimsort_Init(acr::FSsimsort& ssimsort) {
     ssimsort.ind_ssimsort_next = (acr::FSsimsort*)-1; // (acr.FDb.ind_ssimsort) not-in-hash
 }
+inline acr::FStagerow::FStagerow() {
+    acr::FStagerow_Init(*this);
+}
+
+
+// --- acr.FStagerow..Init
+// Set all fields to initial values.
+inline void acr::FStagerow_Init(acr::FStagerow& stagerow) {
+    stagerow.lineno = u32(0);
+}
 inline acr::FSubstr::FSubstr() {
 }
 
@@ -3324,6 +4361,51 @@ inline acr::FieldId::operator acr_FieldIdEnum () const {
 inline void acr::FieldId_Init(acr::FieldId& parent) {
     parent.value = i32(-1);
 }
+inline acr::PkeyidxEnt::PkeyidxEnt() {
+    acr::PkeyidxEnt_Init(*this);
+}
+
+
+// --- acr.PkeyidxEnt..Init
+// Set all fields to initial values.
+inline void acr::PkeyidxEnt_Init(acr::PkeyidxEnt& parent) {
+    parent.keyoff = u32(0);
+    parent.keylen = u32(0);
+    parent.lineoff = u32(0);
+    parent.linelen = u32(0);
+    parent.lineno = u32(0);
+    parent.rowid = u32(0);
+}
+inline acr::PkeyidxFld::PkeyidxFld() {
+    acr::PkeyidxFld_Init(*this);
+}
+
+
+// --- acr.PkeyidxFld..Init
+// Set all fields to initial values.
+inline void acr::PkeyidxFld_Init(acr::PkeyidxFld& parent) {
+    parent.field = u32(0);
+    parent.beg = u32(0);
+    parent.n = u32(0);
+}
+inline acr::PkeyidxHdr::PkeyidxHdr() {
+    acr::PkeyidxHdr_Init(*this);
+}
+
+
+// --- acr.PkeyidxHdr..Init
+// Set all fields to initial values.
+inline void acr::PkeyidxHdr_Init(acr::PkeyidxHdr& parent) {
+    parent.magic = u32(0x61637270);
+    parent.version = u32(2);
+    parent.mtime = i64(0);
+    parent.size = u64(0);
+    parent.nent = u32(0);
+    parent.usable = u32(0);
+    parent.nref = u32(0);
+    parent.nfld = u32(0);
+    parent.signature = u32(0);
+}
 inline acr::TableId::TableId(i32                            in_value)
     : value(in_value)
 {
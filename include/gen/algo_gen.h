@@ -178,6 +178,7 @@ namespace algo { struct Arrsimp; }
 namespace algo { struct Bool; }
 namespace algo { struct ByteAry; }
 namespace algo { struct Charset; }
+namespace algo { struct CharsetNibble; }
 namespace algo { struct Smallstr150; }
 namespace algo { struct Comment; }
 namespace algo { struct UnTime; }
@@ -192,6 +193,7 @@ namespace algo { struct FailokQ; }
 namespace algo { struct FieldId; }
 namespace algo { struct Fildes; }
 namespace algo { struct FileFlags; }
+namespace algo { struct Hashslot; }
 namespace algo { struct I32Dec1; }
 namespace algo { struct I32Dec2; }
 namespace algo { struct I32Dec3; }
@@ -376,6 +378,10 @@ namespace algo { struct Arrsimp_out_curs; }
 namespace algo { struct Arrsimp_stack_curs; }
 namespace algo { struct ByteAry_ary_curs; }
 namespace algo { struct Charset_ch_curs; }
+namespace algo { struct CharsetNibble_lo_curs; }
+namespace algo { struct CharsetNibble_hi_curs; }
+namespace algo { struct CharsetNibble_lo2_curs; }
+namespace algo { struct CharsetNibble_hi2_curs; }
 namespace algo { struct LineBuf_buf_curs; }
 namespace algo { struct Md5Digest_value_curs; }
 namespace algo { struct NormTxttbl_start_curs; }
@@ -1006,6 +1012,111 @@ bool                 Charset_ReadStrptrMaybe(algo::Charset &parent, algo::strptr
 // Set all fields to initial values.
 void                 Charset_Init(algo::Charset& parent);
 
+// --- algo.CharsetNibble
+struct CharsetNibble { // algo.CharsetNibble: Nibble lookup tables for SIMD charset matching, built from algo.Charset
+    u8     lo_elems[16];    //   0  fixed array
+    u8     hi_elems[16];    //   0  fixed array
+    u8     lo2_elems[16];   //   0  fixed array
+    u8     hi2_elems[16];   //   0  fixed array
+    bool   wide;            //   false  More than 8 distinct rows; second table pair is in use
+    CharsetNibble();
+};
+
+// Set all elements of fixed array to value RHS
+void                 lo_Fill(algo::CharsetNibble& parent, const u8 &rhs) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+u8*                  lo_Find(algo::CharsetNibble& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Access fixed array lo as aryptr.
+algo::aryptr<u8>     lo_Getary(algo::CharsetNibble& parent) __attribute__((nothrow));
+// Return max number of items in the array
+i32                  lo_Max(algo::CharsetNibble& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  lo_N(const algo::CharsetNibble& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+void                 lo_Setary(algo::CharsetNibble& parent, const algo::aryptr<u8> &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking in release.
+u8&                  lo_qFind(algo::CharsetNibble& parent, u64 t) __attribute__((nothrow));
+
+// Set all elements of fixed array to value RHS
+void                 hi_Fill(algo::CharsetNibble& parent, const u8 &rhs) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+u8*                  hi_Find(algo::CharsetNibble& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Access fixed array hi as aryptr.
+algo::aryptr<u8>     hi_Getary(algo::CharsetNibble& parent) __attribute__((nothrow));
+// Return max number of items in the array
+i32                  hi_Max(algo::CharsetNibble& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  hi_N(const algo::CharsetNibble& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+void                 hi_Setary(algo::CharsetNibble& parent, const algo::aryptr<u8> &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking in release.
+u8&                  hi_qFind(algo::CharsetNibble& parent, u64 t) __attribute__((nothrow));
+
+// Set all elements of fixed array to value RHS
+void                 lo2_Fill(algo::CharsetNibble& parent, const u8 &rhs) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+u8*                  lo2_Find(algo::CharsetNibble& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Access fixed array lo2 as aryptr.
+algo::aryptr<u8>     lo2_Getary(algo::CharsetNibble& parent) __attribute__((nothrow));
+// Return max number of items in the array
+i32                  lo2_Max(algo::CharsetNibble& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  lo2_N(const algo::CharsetNibble& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+void                 lo2_Setary(algo::CharsetNibble& parent, const algo::aryptr<u8> &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking in release.
+u8&                  lo2_qFind(algo::CharsetNibble& parent, u64 t) __attribute__((nothrow));
+
+// Set all elements of fixed array to value RHS
+void                 hi2_Fill(algo::CharsetNibble& parent, const u8 &rhs) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+u8*                  hi2_Find(algo::CharsetNibble& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Access fixed array hi2 as aryptr.
+algo::aryptr<u8>     hi2_Getary(algo::CharsetNibble& parent) __attribute__((nothrow));
+// Return max number of items in the array
+i32                  hi2_Max(algo::CharsetNibble& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  hi2_N(const algo::CharsetNibble& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+void                 hi2_Setary(algo::CharsetNibble& parent, const algo::aryptr<u8> &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking in release.
+u8&                  hi2_qFind(algo::CharsetNibble& parent, u64 t) __attribute__((nothrow));
+
+// cursor points to valid item
+void                 CharsetNibble_lo_curs_Reset(CharsetNibble_lo_curs &curs, algo::CharsetNibble &parent);
+// cursor points to valid item
+bool                 CharsetNibble_lo_curs_ValidQ(CharsetNibble_lo_curs &curs);
+// proceed to next item
+void                 CharsetNibble_lo_curs_Next(CharsetNibble_lo_curs &curs);
+// item access
+u8&                  CharsetNibble_lo_curs_Access(CharsetNibble_lo_curs &curs);
+// cursor points to valid item
+void                 CharsetNibble_hi_curs_Reset(CharsetNibble_hi_curs &curs, algo::CharsetNibble &parent);
+// cursor points to valid item
+bool                 CharsetNibble_hi_curs_ValidQ(CharsetNibble_hi_curs &curs);
+// proceed to next item
+void                 CharsetNibble_hi_curs_Next(CharsetNibble_hi_curs &curs);
+// item access
+u8&                  CharsetNibble_hi_curs_Access(CharsetNibble_hi_curs &curs);
+// cursor points to valid item
+void                 CharsetNibble_lo2_curs_Reset(CharsetNibble_lo2_curs &curs, algo::CharsetNibble &parent);
+// cursor points to valid item
+bool                 CharsetNibble_lo2_curs_ValidQ(CharsetNibble_lo2_curs &curs);
+// proceed to next item
+void                 CharsetNibble_lo2_curs_Next(CharsetNibble_lo2_curs &curs);
+// item access
+u8&                  CharsetNibble_lo2_curs_Access(CharsetNibble_lo2_curs &curs);
+// cursor points to valid item
+void                 CharsetNibble_hi2_curs_Reset(CharsetNibble_hi2_curs &curs, algo::CharsetNibble &parent);
+// cursor points to valid item
+bool                 CharsetNibble_hi2_curs_ValidQ(CharsetNibble_hi2_curs &curs);
+// proceed to next item
+void                 CharsetNibble_hi2_curs_Next(CharsetNibble_hi2_curs &curs);
+// item access
+u8&                  CharsetNibble_hi2_curs_Access(CharsetNibble_hi2_curs &curs);
+// Set all fields to initial values.
+void                 CharsetNibble_Init(algo::CharsetNibble& parent);
+
 // --- algo.Smallstr150
 struct Smallstr150 { // algo.Smallstr150
     enum { ch_max = 150 };
@@ -1422,6 +1533,16 @@ void                 FileFlags_Init(algo::FileFlags& parent);
 void                 FileFlags_Print(algo::FileFlags & row, algo::cstring &str) __attribute__((nothrow));
 algo::strptr         FileFlags_GetAnon(algo::FileFlags &parent, i32 idx) __attribute__((nothrow));
 
+// --- algo.Hashslot
+struct Hashslot { // algo.Hashslot: Slot of an open-addressing hash table (dmmeta.thash openaddr:Y)
+    u32   hash;   //   0  Hash value of row's key
+    u8*   row;    // Row pointer, NULL if slot is empty. optional pointer
+    Hashslot();
+};
+
+// Set all fields to initial values.
+void                 Hashslot_Init(algo::Hashslot& parent);
+
 // --- algo.I32Dec1
 struct I32Dec1 { // algo.I32Dec1: signed i32, scale 1e1
     i32   value;   //   0
@@ -9476,6 +9597,38 @@ struct Charset_ch_curs {// cursor
 };
 
 
+struct CharsetNibble_lo_curs {// cursor
+    typedef u8 ChildType;
+    int index;
+    algo::CharsetNibble *parent;
+    CharsetNibble_lo_curs() { parent=NULL; index=0; }
+};
+
+
+struct CharsetNibble_hi_curs {// cursor
+    typedef u8 ChildType;
+    int index;
+    algo::CharsetNibble *parent;
+    CharsetNibble_hi_curs() { parent=NULL; index=0; }
+};
+
+
+struct CharsetNibble_lo2_curs {// cursor
+    typedef u8 ChildType;
+    int index;
+    algo::CharsetNibble *parent;
+    CharsetNibble_lo2_curs() { parent=NULL; index=0; }
+};
+
+
+struct CharsetNibble_hi2_curs {// cursor
+    typedef u8 ChildType;
+    int index;
+    algo::CharsetNibble *parent;
+    CharsetNibble_hi2_curs() { parent=NULL; index=0; }
+};
+
+
 struct LineBuf_buf_curs {// cursor
     typedef char ChildType;
     char* elems;
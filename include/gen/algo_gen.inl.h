@@ -1150,6 +1150,332 @@ inline void algo::Charset_Init(algo::Charset& parent) {
         parent.ch_elems[i] = 0;
     }
 }
+inline algo::CharsetNibble::CharsetNibble() {
+    algo::CharsetNibble_Init(*this);
+}
+
+
+// --- algo.CharsetNibble.lo.Fill
+// Set all elements of fixed array to value RHS
+inline void algo::lo_Fill(algo::CharsetNibble& parent, const u8 &rhs) {
+    for (int i = 0; i < 16; i++) {
+        parent.lo_elems[i] = rhs;
+    }
+}
+
+// --- algo.CharsetNibble.lo.Find
+// Look up row by row id. Return NULL if out of range
+inline u8* algo::lo_Find(algo::CharsetNibble& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = 16;
+    return idx < lim ? parent.lo_elems + idx : NULL; // unsigned comparison with limit
+}
+
+// --- algo.CharsetNibble.lo.Getary
+// Access fixed array lo as aryptr.
+inline algo::aryptr<u8> algo::lo_Getary(algo::CharsetNibble& parent) {
+    return algo::aryptr<u8>(parent.lo_elems, 16);
+}
+
+// --- algo.CharsetNibble.lo.Max
+// Return max number of items in the array
+inline i32 algo::lo_Max(algo::CharsetNibble& parent) {
+    (void)parent;
+    return 16;
+}
+
+// --- algo.CharsetNibble.lo.N
+// Return number of items in the array
+inline i32 algo::lo_N(const algo::CharsetNibble& parent) {
+    (void)parent;//only to avoid -Wunused-parameter
+    return 16;
+}
+
+// --- algo.CharsetNibble.lo.Setary
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+inline void algo::lo_Setary(algo::CharsetNibble& parent, const algo::aryptr<u8> &rhs) {
+    int n = 16 < rhs.n_elems ? 16 : rhs.n_elems;
+    for (int i = 0; i < n; i++) {
+        parent.lo_elems[i] = rhs[i];
+    }
+}
+
+// --- algo.CharsetNibble.lo.qFind
+// 'quick' Access row by row id. No bounds checking in release.
+inline u8& algo::lo_qFind(algo::CharsetNibble& parent, u64 t) {
+    return parent.lo_elems[t];
+}
+
+// --- algo.CharsetNibble.hi.Fill
+// Set all elements of fixed array to value RHS
+inline void algo::hi_Fill(algo::CharsetNibble& parent, const u8 &rhs) {
+    for (int i = 0; i < 16; i++) {
+        parent.hi_elems[i] = rhs;
+    }
+}
+
+// --- algo.CharsetNibble.hi.Find
+// Look up row by row id. Return NULL if out of range
+inline u8* algo::hi_Find(algo::CharsetNibble& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = 16;
+    return idx < lim ? parent.hi_elems + idx : NULL; // unsigned comparison with limit
+}
+
+// --- algo.CharsetNibble.hi.Getary
+// Access fixed array hi as aryptr.
+inline algo::aryptr<u8> algo::hi_Getary(algo::CharsetNibble& parent) {
+    return algo::aryptr<u8>(parent.hi_elems, 16);
+}
+
+// --- algo.CharsetNibble.hi.Max
+// Return max number of items in the array
+inline i32 algo::hi_Max(algo::CharsetNibble& parent) {
+    (void)parent;
+    return 16;
+}
+
+// --- algo.CharsetNibble.hi.N
+// Return number of items in the array
+inline i32 algo::hi_N(const algo::CharsetNibble& parent) {
+    (void)parent;//only to avoid -Wunused-parameter
+    return 16;
+}
+
+// --- algo.CharsetNibble.hi.Setary
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+inline void algo::hi_Setary(algo::CharsetNibble& parent, const algo::aryptr<u8> &rhs) {
+    int n = 16 < rhs.n_elems ? 16 : rhs.n_elems;
+    for (int i = 0; i < n; i++) {
+        parent.hi_elems[i] = rhs[i];
+    }
+}
+
+// --- algo.CharsetNibble.hi.qFind
+// 'quick' Access row by row id. No bounds checking in release.
+inline u8& algo::hi_qFind(algo::CharsetNibble& parent, u64 t) {
+    return parent.hi_elems[t];
+}
+
+// --- algo.CharsetNibble.lo2.Fill
+// Set all elements of fixed array to value RHS
+inline void algo::lo2_Fill(algo::CharsetNibble& parent, const u8 &rhs) {
+    for (int i = 0; i < 16; i++) {
+        parent.lo2_elems[i] = rhs;
+    }
+}
+
+// --- algo.CharsetNibble.lo2.Find
+// Look up row by row id. Return NULL if out of range
+inline u8* algo::lo2_Find(algo::CharsetNibble& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = 16;
+    return idx < lim ? parent.lo2_elems + idx : NULL; // unsigned comparison with limit
+}
+
+// --- algo.CharsetNibble.lo2.Getary
+// Access fixed array lo2 as aryptr.
+inline algo::aryptr<u8> algo::lo2_Getary(algo::CharsetNibble& parent) {
+    return algo::aryptr<u8>(parent.lo2_elems, 16);
+}
+
+// --- algo.CharsetNibble.lo2.Max
+// Return max number of items in the array
+inline i32 algo::lo2_Max(algo::CharsetNibble& parent) {
+    (void)parent;
+    return 16;
+}
+
+// --- algo.CharsetNibble.lo2.N
+// Return number of items in the array
+inline i32 algo::lo2_N(const algo::CharsetNibble& parent) {
+    (void)parent;//only to avoid -Wunused-parameter
+    return 16;
+}
+
+// --- algo.CharsetNibble.lo2.Setary
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+inline void algo::lo2_Setary(algo::CharsetNibble& parent, const algo::aryptr<u8> &rhs) {
+    int n = 16 < rhs.n_elems ? 16 : rhs.n_elems;
+    for (int i = 0; i < n; i++) {
+        parent.lo2_elems[i] = rhs[i];
+    }
+}
+
+// --- algo.CharsetNibble.lo2.qFind
+// 'quick' Access row by row id. No bounds checking in release.
+inline u8& algo::lo2_qFind(algo::CharsetNibble& parent, u64 t) {
+    return parent.lo2_elems[t];
+}
+
+// --- algo.CharsetNibble.hi2.Fill
+// Set all elements of fixed array to value RHS
+inline void algo::hi2_Fill(algo::CharsetNibble& parent, const u8 &rhs) {
+    for (int i = 0; i < 16; i++) {
+        parent.hi2_elems[i] = rhs;
+    }
+}
+
+// --- algo.CharsetNibble.hi2.Find
+// Look up row by row id. Return NULL if out of range
+inline u8* algo::hi2_Find(algo::CharsetNibble& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = 16;
+    return idx < lim ? parent.hi2_elems + idx : NULL; // unsigned comparison with limit
+}
+
+// --- algo.CharsetNibble.hi2.Getary
+// Access fixed array hi2 as aryptr.
+inline algo::aryptr<u8> algo::hi2_Getary(algo::CharsetNibble& parent) {
+    return algo::aryptr<u8>(parent.hi2_elems, 16);
+}
+
+// --- algo.CharsetNibble.hi2.Max
+// Return max number of items in the array
+inline i32 algo::hi2_Max(algo::CharsetNibble& parent) {
+    (void)parent;
+    return 16;
+}
+
+// --- algo.CharsetNibble.hi2.N
+// Return number of items in the array
+inline i32 algo::hi2_N(const algo::CharsetNibble& parent) {
+    (void)parent;//only to avoid -Wunused-parameter
+    return 16;
+}
+
+// --- algo.CharsetNibble.hi2.Setary
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+inline void algo::hi2_Setary(algo::CharsetNibble& parent, const algo::aryptr<u8> &rhs) {
+    int n = 16 < rhs.n_elems ? 16 : rhs.n_elems;
+    for (int i = 0; i < n; i++) {
+        parent.hi2_elems[i] = rhs[i];
+    }
+}
+
+// --- algo.CharsetNibble.hi2.qFind
+// 'quick' Access row by row id. No bounds checking in release.
+inline u8& algo::hi2_qFind(algo::CharsetNibble& parent, u64 t) {
+    return parent.hi2_elems[t];
+}
+
+// --- algo.CharsetNibble.lo_curs.Reset
+// cursor points to valid item
+inline void algo::CharsetNibble_lo_curs_Reset(CharsetNibble_lo_curs &curs, algo::CharsetNibble &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- algo.CharsetNibble.lo_curs.ValidQ
+// cursor points to valid item
+inline bool algo::CharsetNibble_lo_curs_ValidQ(CharsetNibble_lo_curs &curs) {
+    return u64(curs.index) < u64(16);
+}
+
+// --- algo.CharsetNibble.lo_curs.Next
+// proceed to next item
+inline void algo::CharsetNibble_lo_curs_Next(CharsetNibble_lo_curs &curs) {
+    curs.index++;
+}
+
+// --- algo.CharsetNibble.lo_curs.Access
+// item access
+inline u8& algo::CharsetNibble_lo_curs_Access(CharsetNibble_lo_curs &curs) {
+    return lo_qFind((*curs.parent), u64(curs.index));
+}
+
+// --- algo.CharsetNibble.hi_curs.Reset
+// cursor points to valid item
+inline void algo::CharsetNibble_hi_curs_Reset(CharsetNibble_hi_curs &curs, algo::CharsetNibble &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- algo.CharsetNibble.hi_curs.ValidQ
+// cursor points to valid item
+inline bool algo::CharsetNibble_hi_curs_ValidQ(CharsetNibble_hi_curs &curs) {
+    return u64(curs.index) < u64(16);
+}
+
+// --- algo.CharsetNibble.hi_curs.Next
+// proceed to next item
+inline void algo::CharsetNibble_hi_curs_Next(CharsetNibble_hi_curs &curs) {
+    curs.index++;
+}
+
+// --- algo.CharsetNibble.hi_curs.Access
+// item access
+inline u8& algo::CharsetNibble_hi_curs_Access(CharsetNibble_hi_curs &curs) {
+    return hi_qFind((*curs.parent), u64(curs.index));
+}
+
+// --- algo.CharsetNibble.lo2_curs.Reset
+// cursor points to valid item
+inline void algo::CharsetNibble_lo2_curs_Reset(CharsetNibble_lo2_curs &curs, algo::CharsetNibble &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- algo.CharsetNibble.lo2_curs.ValidQ
+// cursor points to valid item
+inline bool algo::CharsetNibble_lo2_curs_ValidQ(CharsetNibble_lo2_curs &curs) {
+    return u64(curs.index) < u64(16);
+}
+
+// --- algo.CharsetNibble.lo2_curs.Next
+// proceed to next item
+inline void algo::CharsetNibble_lo2_curs_Next(CharsetNibble_lo2_curs &curs) {
+    curs.index++;
+}
+
+// --- algo.CharsetNibble.lo2_curs.Access
+// item access
+inline u8& algo::CharsetNibble_lo2_curs_Access(CharsetNibble_lo2_curs &curs) {
+    return lo2_qFind((*curs.parent), u64(curs.index));
+}
+
+// --- algo.CharsetNibble.hi2_curs.Reset
+// cursor points to valid item
+inline void algo::CharsetNibble_hi2_curs_Reset(CharsetNibble_hi2_curs &curs, algo::CharsetNibble &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- algo.CharsetNibble.hi2_curs.ValidQ
+// cursor points to valid item
+inline bool algo::CharsetNibble_hi2_curs_ValidQ(CharsetNibble_hi2_curs &curs) {
+    return u64(curs.index) < u64(16);
+}
+
+// --- algo.CharsetNibble.hi2_curs.Next
+// proceed to next item
+inline void algo::CharsetNibble_hi2_curs_Next(CharsetNibble_hi2_curs &curs) {
+    curs.index++;
+}
+
+// --- algo.CharsetNibble.hi2_curs.Access
+// item access
+inline u8& algo::CharsetNibble_hi2_curs_Access(CharsetNibble_hi2_curs &curs) {
+    return hi2_qFind((*curs.parent), u64(curs.index));
+}
+
+// --- algo.CharsetNibble..Init
+// Set all fields to initial values.
+inline void algo::CharsetNibble_Init(algo::CharsetNibble& parent) {
+    for (int i = 0; i < 16; i++) {
+        parent.lo_elems[i] = 0;
+    }
+    for (int i = 0; i < 16; i++) {
+        parent.hi_elems[i] = 0;
+    }
+    for (int i = 0; i < 16; i++) {
+        parent.lo2_elems[i] = 0;
+    }
+    for (int i = 0; i < 16; i++) {
+        parent.hi2_elems[i] = 0;
+    }
+    parent.wide = bool(false);
+}
 
 inline bool algo::Smallstr150::operator ==(const algo::Smallstr150 &rhs) const {
     return algo::Smallstr150_Eq(const_cast<algo::Smallstr150&>(*this),const_cast<algo::Smallstr150&>(rhs));
@@ -1755,6 +2081,17 @@ inline void algo::_throw_Set(algo::FileFlags& parent, bool rhs) {
 inline void algo::FileFlags_Init(algo::FileFlags& parent) {
     parent.value = u32(0);
 }
+inline algo::Hashslot::Hashslot() {
+    algo::Hashslot_Init(*this);
+}
+
+
+// --- algo.Hashslot..Init
+// Set all fields to initial values.
+inline void algo::Hashslot_Init(algo::Hashslot& parent) {
+    parent.hash = u32(0);
+    parent.row = NULL;
+}
 inline algo::I32Dec1::I32Dec1(i32                            in_value)
     : value(in_value)
 {
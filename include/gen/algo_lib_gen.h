@@ -10,6 +10,7 @@
 #pragma once
 #include "include/gen/algo_gen.h"
 #include "include/gen/dmmeta_gen.h"
+#include "include/gen/report_gen.h"
 //#pragma endinclude
 
 // --- algo_lib_FieldIdEnum
@@ -21,18 +22,22 @@ enum algo_lib_FieldIdEnum {               // algo_lib.FieldId.value
     ,algo_lib_FieldId_version       = 3
     ,algo_lib_FieldId_sig           = 4
     ,algo_lib_FieldId_signature     = 5
-    ,algo_lib_FieldId_expr          = 6
-    ,algo_lib_FieldId_state         = 7
-    ,algo_lib_FieldId_front         = 8
-    ,algo_lib_FieldId_next_front    = 9
-    ,algo_lib_FieldId_accept        = 10
-    ,algo_lib_FieldId_start         = 11
-    ,algo_lib_FieldId_parseerror    = 12
-    ,algo_lib_FieldId_accepts_all   = 13
-    ,algo_lib_FieldId_value         = 14
+    ,algo_lib_FieldId_unbuffered    = 6
+    ,algo_lib_FieldId_nommap        = 7
+    ,algo_lib_FieldId_linebuf       = 8
+    ,algo_lib_FieldId_snap          = 9
+    ,algo_lib_FieldId_expr          = 10
+    ,algo_lib_FieldId_state         = 11
+    ,algo_lib_FieldId_front         = 12
+    ,algo_lib_FieldId_next_front    = 13
+    ,algo_lib_FieldId_accept        = 14
+    ,algo_lib_FieldId_start         = 15
+    ,algo_lib_FieldId_parseerror    = 16
+    ,algo_lib_FieldId_accepts_all   = 17
+    ,algo_lib_FieldId_value         = 18
 };
 
-enum { algo_lib_FieldIdEnum_N = 15 };
+enum { algo_lib_FieldIdEnum_N = 19 };
 
 
 // --- algo_lib_RegxToken_type_Enum
@@ -63,6 +68,9 @@ namespace algo_lib { struct Bitset; }
 namespace algo_lib { struct Cmdline; }
 namespace algo_lib { struct CsvParse; }
 namespace algo_lib { struct ErrorX; }
+namespace algo_lib { struct FTempclass; }
+namespace algo_lib { struct FTemppool; }
+namespace algo_lib { struct FLogbuf; }
 namespace algo_lib { struct FFildes; }
 namespace algo_lib { struct FLockfile; }
 namespace algo_lib { struct FTimehook; }
@@ -76,8 +84,8 @@ namespace algo_lib { struct FReplvar; }
 namespace algo_lib { struct FTempfile; }
 namespace algo_lib { struct FTxtcell; }
 namespace algo_lib { struct FieldId; }
-namespace algo_lib { struct InTextFile; }
 namespace algo_lib { struct Mmap; }
+namespace algo_lib { struct InTextFile; }
 namespace algo_lib { struct MmapFile; }
 namespace algo_lib { struct RegxToken; }
 namespace algo_lib { struct RegxExpr; }
@@ -85,16 +93,22 @@ namespace algo_lib { struct RegxParse; }
 namespace algo_lib { struct RegxState; }
 namespace algo_lib { struct ShHdr; }
 namespace algo_lib { struct ShStream; }
+namespace algo_lib { struct SnapHdr; }
+namespace algo_lib { struct SnapRec; }
 namespace algo_lib { struct Srng; }
 namespace algo_lib { struct TableId; }
 namespace algo_lib { struct Tabulate; }
 namespace algo_lib { struct Bitset_ary_curs; }
 namespace algo_lib { struct parsecsv_ary_tok_curs; }
-namespace algo_lib { struct _db_temp_strings_curs; }
+namespace algo_lib { struct tempclass_str_curs; }
+namespace algo_lib { struct FTemppool_tempclass_curs; }
+namespace algo_lib { struct FTemppool_spill_curs; }
 namespace algo_lib { struct _db_imtable_curs; }
 namespace algo_lib { struct _db_ind_imtable_curs; }
+namespace algo_lib { struct _db_logbuf_curs; }
 namespace algo_lib { struct _db_bh_timehook_curs; }
 namespace algo_lib { struct _db_bh_timehook_unordcurs; }
+namespace algo_lib { struct _db_bh_timehook_elem; }
 namespace algo_lib { struct _db_dispsigcheck_curs; }
 namespace algo_lib { struct _db_ind_dispsigcheck_curs; }
 namespace algo_lib { struct _db_imdb_curs; }
@@ -115,6 +129,11 @@ typedef void (*timehook_hook_hook)(void* userctx, algo_lib::FTimehook& arg);
 struct lpool_Lpblock {
     lpool_Lpblock* next;
 };
+struct lpool_Lpmag {// per-thread cache of free blocks (algo_lib.FDb.lpool)
+    lpool_Lpblock* head[16+1];  // free blocks by size class
+    i32 n[16+1];  // number of blocks in each list
+    u64 n_hit;  // allocations from magazine, not yet added to lpool_n_maghit
+};
 extern FDb _db;
 typedef void (*_db_h_fatalerror_hook)(void* userctx);
 typedef void (*iohook_callback_hook)(void* userctx, algo_lib::FIohook& arg);
@@ -221,12 +240,16 @@ void                 Bitset_Uninit(algo_lib::Bitset& parent) __attribute__((noth
 
 // --- algo_lib.Cmdline
 struct Cmdline { // algo_lib.Cmdline: *can't move this to command namespace because of circular dependency*
-    u8     verbose;     //   0  Verbosity level (0..255)
-    u8     debug;       //   0  Debug level (0..255)
-    bool   help;        //   false  Print help an exit
-    bool   version;     //   false  Print version and exit
-    bool   sig;         //   false  Show signatures and exit
-    bool   signature;   //   false  Alias for -sig
+    u8     verbose;      //   0  Verbosity level (0..255)
+    u8     debug;        //   0  Debug level (0..255)
+    bool   help;         //   false  Print help an exit
+    bool   version;      //   false  Print version and exit
+    bool   sig;          //   false  Show signatures and exit
+    bool   signature;    //   false  Alias for -sig
+    bool   unbuffered;   //   false  Disable buffering of prlog output
+    bool   nommap;       //   false  Read input files with read(2) instead of mapping them
+    i32    linebuf;      //   1048576  Max. size of read buffer for input that is not mapped (e.g. a pipe)
+    bool   snap;         //   false  Load inputs from binary snapshots in temp/ (written when stale)
     Cmdline();
 };
 
@@ -322,6 +345,144 @@ private:
 // Convert algo_lib::ErrorX to a string (user-implemented function)
 void                 ErrorX_Print(algo_lib::ErrorX & row, algo::cstring &str) __attribute__((nothrow));
 
+// --- algo_lib.FTempclass
+// create: algo_lib.FTemppool.tempclass (Inlary)
+struct FTempclass { // algo_lib.FTempclass: Free list of tempstr buffers of one size class
+    i32             n;              //   0  Number of parked buffers
+    algo::cstring   str_elems[8];   // fixed array
+    FTempclass();
+};
+
+// Set all elements of fixed array to value RHS
+void                 str_Fill(algo_lib::FTempclass& tempclass, const algo::cstring &rhs) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+algo::cstring*       str_Find(algo_lib::FTempclass& tempclass, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Access fixed array str as aryptr.
+algo::aryptr<algo::cstring> str_Getary(algo_lib::FTempclass& tempclass) __attribute__((nothrow));
+// Return max number of items in the array
+i32                  str_Max(algo_lib::FTempclass& tempclass) __attribute__((nothrow));
+// Return number of items in the array
+i32                  str_N(const algo_lib::FTempclass& tempclass) __attribute__((__warn_unused_result__, nothrow, pure));
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+void                 str_Setary(algo_lib::FTempclass& tempclass, const algo::aryptr<algo::cstring> &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking in release.
+algo::cstring&       str_qFind(algo_lib::FTempclass& tempclass, u64 t) __attribute__((nothrow));
+
+// cursor points to valid item
+void                 tempclass_str_curs_Reset(tempclass_str_curs &curs, algo_lib::FTempclass &parent);
+// cursor points to valid item
+bool                 tempclass_str_curs_ValidQ(tempclass_str_curs &curs);
+// proceed to next item
+void                 tempclass_str_curs_Next(tempclass_str_curs &curs);
+// item access
+algo::cstring&       tempclass_str_curs_Access(tempclass_str_curs &curs);
+// Set all fields to initial values.
+void                 FTempclass_Init(algo_lib::FTempclass& tempclass);
+
+// --- algo_lib.FTemppool
+struct FTemppool { // algo_lib.FTemppool: tempstr buffer pool of one thread
+    algo_lib::FTempclass   tempclass_elems[4];   // fixed array
+    algo::cstring*         spill_elems;          // pointer to elements
+    u32                    spill_n;              // number of elements in array
+    u32                    spill_max;            // max. capacity of array before realloc
+    u32                    mask;                 //   0  Bit I is set if tempclass I has a parked buffer
+    i32                    scope;                //   0  Nesting depth of open TempstrScope objects
+    report::tempstr        stats;                // Pool statistics (main thread only, see TempstrStatsEnable)
+    FTemppool();
+    ~FTemppool();
+private:
+    // reftype of algo_lib.FTemppool.spill prohibits copy
+    FTemppool(const FTemppool&){ /*disallow copy constructor */}
+    void operator =(const FTemppool&){ /*disallow direct assignment */}
+};
+
+// Set all elements of fixed array to value RHS
+void                 tempclass_Fill(algo_lib::FTemppool& parent, const algo_lib::FTempclass &rhs) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+algo_lib::FTempclass* tempclass_Find(algo_lib::FTemppool& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Access fixed array tempclass as aryptr.
+algo::aryptr<algo_lib::FTempclass> tempclass_Getary(algo_lib::FTemppool& parent) __attribute__((nothrow));
+// Return max number of items in the array
+i32                  tempclass_Max(algo_lib::FTemppool& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  tempclass_N(const algo_lib::FTemppool& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+void                 tempclass_Setary(algo_lib::FTemppool& parent, const algo::aryptr<algo_lib::FTempclass> &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking in release.
+algo_lib::FTempclass& tempclass_qFind(algo_lib::FTemppool& parent, u64 t) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 tempclass_XrefMaybe(algo_lib::FTempclass &row);
+
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+algo::cstring&       spill_Alloc(algo_lib::FTemppool& parent) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+algo::cstring&       spill_AllocAt(algo_lib::FTemppool& parent, int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<algo::cstring> spill_AllocN(algo_lib::FTemppool& parent, int n_elems) __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 spill_EmptyQ(algo_lib::FTemppool& parent) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+algo::cstring*       spill_Find(algo_lib::FTemppool& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array pointer by value
+algo::aryptr<algo::cstring> spill_Getary(algo_lib::FTemppool& parent) __attribute__((nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+algo::cstring*       spill_Last(algo_lib::FTemppool& parent) __attribute__((nothrow, pure));
+// Return max. number of items in the array
+i32                  spill_Max(algo_lib::FTemppool& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  spill_N(const algo_lib::FTemppool& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove item by index. If index outside of range, do nothing.
+void                 spill_Remove(algo_lib::FTemppool& parent, u32 i) __attribute__((nothrow));
+void                 spill_RemoveAll(algo_lib::FTemppool& parent) __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 spill_RemoveLast(algo_lib::FTemppool& parent) __attribute__((nothrow));
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 spill_Reserve(algo_lib::FTemppool& parent, int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 spill_AbsReserve(algo_lib::FTemppool& parent, int n) __attribute__((nothrow));
+// Copy contents of RHS to PARENT.
+void                 spill_Setary(algo_lib::FTemppool& parent, algo_lib::FTemppool &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+algo::cstring&       spill_qFind(algo_lib::FTemppool& parent, u64 t) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+algo::cstring&       spill_qLast(algo_lib::FTemppool& parent) __attribute__((nothrow));
+// Return row id of specified element
+u64                  spill_rowid_Get(algo_lib::FTemppool& parent, algo::cstring &elem) __attribute__((nothrow));
+
+// cursor points to valid item
+void                 FTemppool_tempclass_curs_Reset(FTemppool_tempclass_curs &curs, algo_lib::FTemppool &parent);
+// cursor points to valid item
+bool                 FTemppool_tempclass_curs_ValidQ(FTemppool_tempclass_curs &curs);
+// proceed to next item
+void                 FTemppool_tempclass_curs_Next(FTemppool_tempclass_curs &curs);
+// item access
+algo_lib::FTempclass& FTemppool_tempclass_curs_Access(FTemppool_tempclass_curs &curs);
+// proceed to next item
+void                 FTemppool_spill_curs_Next(FTemppool_spill_curs &curs);
+void                 FTemppool_spill_curs_Reset(FTemppool_spill_curs &curs, algo_lib::FTemppool &parent);
+// cursor points to valid item
+bool                 FTemppool_spill_curs_ValidQ(FTemppool_spill_curs &curs);
+// item access
+algo::cstring&       FTemppool_spill_curs_Access(FTemppool_spill_curs &curs);
+// Set all fields to initial values.
+void                 FTemppool_Init(algo_lib::FTemppool& parent);
+void                 FTemppool_Uninit(algo_lib::FTemppool& parent) __attribute__((nothrow));
+
+// --- algo_lib.FLogbuf
+// create: algo_lib.FDb.logbuf (Inlary)
+struct FLogbuf { // algo_lib.FLogbuf: Output buffer for prlog/prerr on a single file descriptor
+    algo::cstring   buf;         // Pending output
+    i32             flush_lim;   //   0  Write out when buffer reaches this size. 0 = write through
+    u64             n_write;     //   0  Number of write calls issued
+    FLogbuf();
+};
+
+// Set all fields to initial values.
+void                 FLogbuf_Init(algo_lib::FLogbuf& logbuf);
+
 // --- algo_lib.FFildes
 // create: algo_lib.FDb.fildes (Cppstack)
 struct FFildes { // algo_lib.FFildes: Wrapper for unix file descritor, call close() on Uninit
@@ -452,7 +613,14 @@ struct FDb { // algo_lib.FDb
     u64                               sbrk_huge_limit;                           // Huge page limit in bytes -- set to 0 with fork!
     u64                               sbrk_huge_alloc;                           // Huge page bytes allocated
     bool                              sbrk_zeromem;                              // Zero allocated memory
+    bool                              sbrk_thp;                                  // Back big blocks with transparent huge pages (madvise)
+    i32                               sbrk_numa_node;                            // If >= 0, bind big blocks to this NUMA node
+    u64                               sbrk_thp_alloc;                            // Bytes advised as transparent huge pages
     lpool_Lpblock*                    lpool_free[31];                            // Lpool levels
+    pthread_mutex_t                   lpool_lock;                                // Protects lpool_free in multi-threaded use
+    u64                               lpool_n_maghit;                            // Allocations served from per-thread magazines
+    u64                               lpool_n_refill;                            // Number of magazine refills from shared free lists
+    u64                               lpool_n_spill;                             // Number of magazine spills to shared free lists
     algo::SchedTime                   next_loop;                                 //
     algo::SchedTime                   limit;                                     //   0x7fffffffffffffff
     double                            clocks_to_ms;                              //   0.0
@@ -464,24 +632,27 @@ struct FDb { // algo_lib.FDb
     algo::SchedTime                   t_last_signal;                             // Time last async signal was processed
     i32                               exit_code;                                 //   0  Exit code from main program. 0 = success (this is the unix exit code!)
     double                            clocks_to_ns;                              //   0.0
-    u32                               n_temp;                                    //   0  * initialization order is important *
+    bool                              tempstr_stats_on;                          //   false  Collect temppool stats of the main thread (see TempstrStatsEnable)
     u32                               last_signal;                               //   0  Value of last signal (used by SetupExitSignals)
     bool                              eol;                                       //   false
     u64                               cpu_hz;                                    //   0  Cpu HZ, determined at startup
-    algo::cstring                     temp_strings_elems[8];                     // fixed array
+    algo_lib::FTemppool               temppool;                                  // tempstr pool of the main thread. * initialization order is important *
     algo::Charset                     ArgvIdent;                                 //
     algo::Charset                     BashQuotesafe;                             //
     algo::Charset                     RegxSqlSpecial;                            //
     algo::Charset                     SsimBreakName;                             //
     algo::Charset                     SsimBreakValue;                            //
     algo::Charset                     SsimQuotesafe;                             //
+    algo::CharsetNibble               SsimBreakNameNib;                          // Nibble tables for SsimBreakName
+    algo::CharsetNibble               SsimBreakValueNib;                         // Nibble tables for SsimBreakValue
     algo_lib::FImtable*               imtable_lary[32];                          // level array
     i32                               imtable_n;                                 // number of elements in array
     algo_lib::FImtable**              ind_imtable_buckets_elems;                 // pointer to bucket array
     i32                               ind_imtable_buckets_n;                     // number of elements in bucket array
     i32                               ind_imtable_n;                             // number of elements in the hash table
     algo::cstring                     log_str;                                   //
-    algo_lib::FTimehook**             bh_timehook_elems;                         // binary heap by time
+    algo_lib::FLogbuf                 logbuf_elems[3];                           // fixed array
+    _db_bh_timehook_elem*             bh_timehook_elems;                         // 4-ary heap by time
     i32                               bh_timehook_n;                             // number of elements in the heap
     i32                               bh_timehook_max;                           // max elements in bh_timehook_elems
     i32                               epoll_fd;                                  //   -1
@@ -528,6 +699,8 @@ struct FDb { // algo_lib.FDb
     algo::TstampCache                 fixuntimemsec;                             //
     algo::TstampCache                 fixuntimesec;                              //
     algo::Charset                     Urlsafe;                                   //
+    bool                              snap_rec;                                  //   false  Input tuples are being recorded into snapbuf
+    algo::ByteAry                     snapbuf;                                   // Row images recorded during text load
     algo_lib::trace                   trace;                                     //
 };
 
@@ -538,10 +711,12 @@ void*                sbrk_AllocMem(u32 size) __attribute__((__warn_unused_result
 void                 sbrk_FreeMem(void *mem, u32 size) __attribute__((nothrow));
 
 // Free block of memory previously returned by Lpool.
+// Thread-safe: small blocks go to the calling thread's magazine.
 void                 lpool_FreeMem(void *mem, u64 size) __attribute__((nothrow));
 // Allocate new piece of memory at least SIZE bytes long.
 // If not successful, return NULL
 // The allocated block is 16-byte aligned
+// Thread-safe: small blocks come from the calling thread's magazine.
 void*                lpool_AllocMem(u64 size) __attribute__((__warn_unused_result__, nothrow));
 // Add N buffers of some size to the free store
 bool                 lpool_ReserveBuffers(int nbuf, u64 bufsize) __attribute__((nothrow));
@@ -549,26 +724,14 @@ bool                 lpool_ReserveBuffers(int nbuf, u64 bufsize) __attribute__((
 // New memory is always allocated (i.e. size reduction is not a no-op)
 // If no memory, return NULL: old memory untouched
 void*                lpool_ReallocMem(void *oldmem, u64 old_size, u64 new_size) __attribute__((nothrow));
+// Return blocks cached by the calling thread to the shared free lists
+// A thread should call this before exiting; otherwise its cached blocks are lost.
+void                 lpool_FlushMag() __attribute__((nothrow));
 
 // Insert row into all appropriate indices. If error occurs, store error
 // in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
 bool                 fildes_XrefMaybe(algo_lib::FFildes &row);
 
-// Set all elements of fixed array to value RHS
-void                 temp_strings_Fill(const algo::cstring &rhs) __attribute__((nothrow));
-// Look up row by row id. Return NULL if out of range
-algo::cstring*       temp_strings_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
-// Access fixed array temp_strings as aryptr.
-algo::aryptr<algo::cstring> temp_strings_Getary() __attribute__((nothrow));
-// Return max number of items in the array
-i32                  temp_strings_Max() __attribute__((nothrow));
-// Return number of items in the array
-i32                  temp_strings_N() __attribute__((__warn_unused_result__, nothrow, pure));
-// Set contents of fixed array to RHS; Input length is trimmed as necessary
-void                 temp_strings_Setary(const algo::aryptr<algo::cstring> &rhs) __attribute__((nothrow));
-// 'quick' Access row by row id. No bounds checking in release.
-algo::cstring&       temp_strings_qFind(u64 t) __attribute__((nothrow));
-
 bool                 ArgvIdentQ(u32 ch) __attribute__((nothrow));
 
 bool                 BashQuotesafeQ(u32 ch) __attribute__((nothrow));
@@ -587,6 +750,8 @@ void                 StaticCheck();
 // Parse strptr into known type and add to database.
 // Return value is true unless an error occurs. If return value is false, algo_lib::_db.errtext has error text
 bool                 InsertStrptrMaybe(algo::strptr str);
+// Insert row image from binary input snapshot.
+bool                 InsertSnapMaybe(i32 table_id, algo::memptr row);
 // Load all finputs from given directory.
 bool                 LoadTuplesMaybe(algo::strptr root) __attribute__((nothrow));
 void                 Init() __attribute__((nothrow));
@@ -685,6 +850,26 @@ bool                 regx_XrefMaybe(algo_lib::Regx &row);
 // in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
 bool                 tabulate_XrefMaybe(algo_lib::Tabulate &row);
 
+// User-defined cleanup function invoked for field logbuf of algo_lib::FDb
+void                 logbuf_Cleanup() __attribute__((nothrow));
+// Set all elements of fixed array to value RHS
+void                 logbuf_Fill(const algo_lib::FLogbuf &rhs) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+algo_lib::FLogbuf*   logbuf_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Access fixed array logbuf as aryptr.
+algo::aryptr<algo_lib::FLogbuf> logbuf_Getary() __attribute__((nothrow));
+// Return max number of items in the array
+i32                  logbuf_Max() __attribute__((nothrow));
+// Return number of items in the array
+i32                  logbuf_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+void                 logbuf_Setary(const algo::aryptr<algo_lib::FLogbuf> &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking in release.
+algo_lib::FLogbuf&   logbuf_qFind(u64 t) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 logbuf_XrefMaybe(algo_lib::FLogbuf &row);
+
 // Remove all elements from heap and free memory used by the array.
 void                 bh_timehook_Dealloc() __attribute__((nothrow));
 // Return true if index is empty
@@ -953,14 +1138,6 @@ bool                 LowerCharQ(u32 ch) __attribute__((nothrow));
 
 bool                 UrlsafeQ(u32 ch) __attribute__((nothrow));
 
-// cursor points to valid item
-void                 _db_temp_strings_curs_Reset(_db_temp_strings_curs &curs, algo_lib::FDb &parent);
-// cursor points to valid item
-bool                 _db_temp_strings_curs_ValidQ(_db_temp_strings_curs &curs);
-// proceed to next item
-void                 _db_temp_strings_curs_Next(_db_temp_strings_curs &curs);
-// item access
-algo::cstring&       _db_temp_strings_curs_Access(_db_temp_strings_curs &curs);
 // cursor points to valid item
 void                 _db_imtable_curs_Reset(_db_imtable_curs &curs, algo_lib::FDb &parent);
 // cursor points to valid item
@@ -969,6 +1146,14 @@ bool                 _db_imtable_curs_ValidQ(_db_imtable_curs &curs);
 void                 _db_imtable_curs_Next(_db_imtable_curs &curs);
 // item access
 algo_lib::FImtable&  _db_imtable_curs_Access(_db_imtable_curs &curs);
+// cursor points to valid item
+void                 _db_logbuf_curs_Reset(_db_logbuf_curs &curs, algo_lib::FDb &parent);
+// cursor points to valid item
+bool                 _db_logbuf_curs_ValidQ(_db_logbuf_curs &curs);
+// proceed to next item
+void                 _db_logbuf_curs_Next(_db_logbuf_curs &curs);
+// item access
+algo_lib::FLogbuf&   _db_logbuf_curs_Access(_db_logbuf_curs &curs);
 void                 _db_bh_timehook_curs_Reserve(_db_bh_timehook_curs &curs, int n);
 // Reset cursor. If HEAP is non-empty, add its top element to CURS.
 void                 _db_bh_timehook_curs_Reset(_db_bh_timehook_curs &curs, algo_lib::FDb &parent);
@@ -1356,14 +1541,33 @@ void                 FieldId_Init(algo_lib::FieldId& parent);
 // print string representation of algo_lib::FieldId to string LHS, no header -- cprint:algo_lib.FieldId.String
 void                 FieldId_Print(algo_lib::FieldId & row, algo::cstring &str) __attribute__((nothrow));
 
+// --- algo_lib.Mmap
+struct Mmap { // algo_lib.Mmap
+    algo::memptr   mem;   // Memory that has been mmap()ed
+    Mmap();
+    ~Mmap();
+private:
+    // user-defined fcleanup on algo_lib.Mmap.mem prevents copy
+    Mmap(const Mmap&){ /*disallow copy constructor */}
+    void operator =(const Mmap&){ /*disallow direct assignment */}
+};
+
+// User-defined cleanup function invoked for field mem of algo_lib::Mmap
+void                 mem_Cleanup(algo_lib::Mmap& parent) __attribute__((nothrow));
+
+void                 Mmap_Uninit(algo_lib::Mmap& parent) __attribute__((nothrow));
+
 // --- algo_lib.InTextFile
 struct InTextFile { // algo_lib.InTextFile
-    algo_lib::FFildes   file;                               //
-    bool                own_fd;                             //   true
-    algo::LineBuf       line_buf;                           //
-    u8                  temp_buf_data[sizeof(u8) * 8192];   // place for data
-    i32                 temp_buf_n;                         // number of elems current in existence
-    enum { temp_buf_max = 8192 };
+    algo_lib::FFildes   file;             //
+    bool                own_fd;           //   true
+    algo::LineBuf       line_buf;         //
+    u8*                 temp_buf_elems;   // pointer to elements
+    u32                 temp_buf_n;       // number of elements in array
+    u32                 temp_buf_max;     // max. capacity of array before realloc
+    i32                 bufsize;          //   0  Max. size of read buffer (from -linebuf when input mode is selected)
+    algo_lib::Mmap      map;              // Mapping of input file, if mapped
+    bool                started;          //   false  Input mode has been selected
     InTextFile();
     ~InTextFile();
 private:
@@ -1378,55 +1582,55 @@ private:
 // User-defined cleanup function invoked for field file of algo_lib::InTextFile
 void                 file_Cleanup(algo_lib::InTextFile& parent) __attribute__((nothrow));
 
-// Allocate space for one element. If no memory available, return NULL.
-void*                temp_buf_AllocMem(algo_lib::InTextFile& parent) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+u8&                  temp_buf_Alloc(algo_lib::InTextFile& parent) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+u8&                  temp_buf_AllocAt(algo_lib::InTextFile& parent, int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<u8>     temp_buf_AllocN(algo_lib::InTextFile& parent, int n_elems) __attribute__((__warn_unused_result__, nothrow));
 // Return true if index is empty
 bool                 temp_buf_EmptyQ(algo_lib::InTextFile& parent) __attribute__((nothrow));
 // Look up row by row id. Return NULL if out of range
 u8*                  temp_buf_Find(algo_lib::InTextFile& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
 // Return array pointer by value
 algo::aryptr<u8>     temp_buf_Getary(algo_lib::InTextFile& parent) __attribute__((nothrow));
-// Return constant 8192 -- max. number of items in the pool
+// Return pointer to last element of array, or NULL if array is empty
+u8*                  temp_buf_Last(algo_lib::InTextFile& parent) __attribute__((nothrow, pure));
+// Return max. number of items in the array
 i32                  temp_buf_Max(algo_lib::InTextFile& parent) __attribute__((nothrow));
 // Return number of items in the array
 i32                  temp_buf_N(const algo_lib::InTextFile& parent) __attribute__((__warn_unused_result__, nothrow, pure));
-// Destroy all elements of Inlary
+// Remove item by index. If index outside of range, do nothing.
+void                 temp_buf_Remove(algo_lib::InTextFile& parent, u32 i) __attribute__((nothrow));
 void                 temp_buf_RemoveAll(algo_lib::InTextFile& parent) __attribute__((nothrow));
 // Delete last element of array. Do nothing if array is empty.
 void                 temp_buf_RemoveLast(algo_lib::InTextFile& parent) __attribute__((nothrow));
-// 'quick' Access row by row id. No bounds checking in release.
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 temp_buf_Reserve(algo_lib::InTextFile& parent, int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 temp_buf_AbsReserve(algo_lib::InTextFile& parent, int n) __attribute__((nothrow));
+// Copy contents of RHS to PARENT.
+void                 temp_buf_Setary(algo_lib::InTextFile& parent, algo_lib::InTextFile &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
 u8&                  temp_buf_qFind(algo_lib::InTextFile& parent, u64 t) __attribute__((nothrow));
-// Compute row id of element given element's address
-u64                  temp_buf_rowid_Get(algo_lib::InTextFile& parent, u8 &row) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+u8&                  temp_buf_qLast(algo_lib::InTextFile& parent) __attribute__((nothrow));
+// Return row id of specified element
+u64                  temp_buf_rowid_Get(algo_lib::InTextFile& parent, u8 &elem) __attribute__((nothrow));
 
-// cursor points to valid item
+// proceed to next item
+void                 InTextFile_temp_buf_curs_Next(InTextFile_temp_buf_curs &curs);
 void                 InTextFile_temp_buf_curs_Reset(InTextFile_temp_buf_curs &curs, algo_lib::InTextFile &parent);
 // cursor points to valid item
 bool                 InTextFile_temp_buf_curs_ValidQ(InTextFile_temp_buf_curs &curs);
-// proceed to next item
-void                 InTextFile_temp_buf_curs_Next(InTextFile_temp_buf_curs &curs);
 // item access
 u8&                  InTextFile_temp_buf_curs_Access(InTextFile_temp_buf_curs &curs);
 // Set all fields to initial values.
 void                 InTextFile_Init(algo_lib::InTextFile& parent);
 void                 InTextFile_Uninit(algo_lib::InTextFile& parent) __attribute__((nothrow));
 
-// --- algo_lib.Mmap
-struct Mmap { // algo_lib.Mmap
-    algo::memptr   mem;   // Memory that has been mmap()ed
-    Mmap();
-    ~Mmap();
-private:
-    // user-defined fcleanup on algo_lib.Mmap.mem prevents copy
-    Mmap(const Mmap&){ /*disallow copy constructor */}
-    void operator =(const Mmap&){ /*disallow direct assignment */}
-};
-
-// User-defined cleanup function invoked for field mem of algo_lib::Mmap
-void                 mem_Cleanup(algo_lib::Mmap& parent) __attribute__((nothrow));
-
-void                 Mmap_Uninit(algo_lib::Mmap& parent) __attribute__((nothrow));
-
 // --- algo_lib.MmapFile
 struct MmapFile { // algo_lib.MmapFile
     algo_lib::Mmap      map;    // Pointer to shared memory
@@ -1801,6 +2005,28 @@ private:
 // Set all fields to initial values.
 void                 ShStream_Init(algo_lib::ShStream& parent);
 
+// --- algo_lib.SnapHdr
+struct SnapHdr { // algo_lib.SnapHdr: Header of binary ssim input snapshot
+    u32   magic;     //   0x736e6170  Signature
+    u32   version;   //   1  File format version
+    u32   keylen;    //   0  Length of validation key following the header
+    u32   nrec;      //   0  Number of records following the key
+    SnapHdr();
+};
+
+// Set all fields to initial values.
+void                 SnapHdr_Init(algo_lib::SnapHdr& parent);
+
+// --- algo_lib.SnapRec
+struct SnapRec { // algo_lib.SnapRec: Record header in binary ssim snapshot
+    u32   table_id;   //   0  Value of ns TableId
+    u32   size;       //   0  Size of row image that follows
+    SnapRec();
+};
+
+// Set all fields to initial values.
+void                 SnapRec_Init(algo_lib::SnapRec& parent);
+
 // --- algo_lib.Srng
 struct Srng { // algo_lib.Srng: Command function, a single word
     u32   z;   //   123
@@ -1932,11 +2158,28 @@ struct parsecsv_ary_tok_curs {// cursor
 };
 
 
-struct _db_temp_strings_curs {// cursor
+struct tempclass_str_curs {// cursor
     typedef algo::cstring ChildType;
     int index;
-    algo_lib::FDb *parent;
-    _db_temp_strings_curs() { parent=NULL; index=0; }
+    algo_lib::FTempclass *parent;
+    tempclass_str_curs() { parent=NULL; index=0; }
+};
+
+
+struct FTemppool_tempclass_curs {// cursor
+    typedef algo_lib::FTempclass ChildType;
+    int index;
+    algo_lib::FTemppool *parent;
+    FTemppool_tempclass_curs() { parent=NULL; index=0; }
+};
+
+
+struct FTemppool_spill_curs {// cursor
+    typedef algo::cstring ChildType;
+    algo::cstring* elems;
+    int n_elems;
+    int index;
+    FTemppool_spill_curs() { elems=NULL; n_elems=0; index=0; }
 };
 
 
@@ -1947,6 +2190,14 @@ struct _db_imtable_curs {// cursor
     _db_imtable_curs(){ parent=NULL; index=0; }
 };
 
+
+struct _db_logbuf_curs {// cursor
+    typedef algo_lib::FLogbuf ChildType;
+    int index;
+    algo_lib::FDb *parent;
+    _db_logbuf_curs() { parent=NULL; index=0; }
+};
+
 // Non-destructive heap cursor, returns heap elements in sorted order.
 // A running front of potential smallest entries is kept in the helper heap (curs.temp_%)
 struct _db_bh_timehook_curs {
@@ -1960,6 +2211,14 @@ struct _db_bh_timehook_curs {
 };
 
 
+struct _db_bh_timehook_elem {// heap element with inline key (algo_lib.FDb.bh_timehook)
+    algo::SchedTime key; // copy of row's time
+    algo_lib::FTimehook* row;
+    _db_bh_timehook_elem() : row(NULL) {}
+    _db_bh_timehook_elem(const algo::SchedTime &in_key, algo_lib::FTimehook *in_row) : key(in_key), row(in_row) {}
+};
+
+
 struct _db_dispsigcheck_curs {// cursor
     typedef algo_lib::FDispsigcheck ChildType;
     algo_lib::FDb *parent;
@@ -2005,9 +2264,10 @@ struct txttbl_c_txtrow_curs {// cursor
 
 struct InTextFile_temp_buf_curs {// cursor
     typedef u8 ChildType;
+    u8* elems;
+    int n_elems;
     int index;
-    algo_lib::InTextFile *parent;
-    InTextFile_temp_buf_curs() { parent=NULL; index=0; }
+    InTextFile_temp_buf_curs() { elems=NULL; n_elems=0; index=0; }
 };
 
 
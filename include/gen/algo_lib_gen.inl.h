@@ -10,6 +10,7 @@
 #pragma once
 #include "include/gen/algo_gen.inl.h"
 #include "include/gen/dmmeta_gen.inl.h"
+#include "include/gen/report_gen.inl.h"
 //#pragma endinclude
 inline algo_lib::Bitset::Bitset() {
     algo_lib::Bitset_Init(*this);
@@ -288,17 +289,6 @@ inline algo_lib::Cmdline::Cmdline() {
     algo_lib::Cmdline_Init(*this);
 }
 
-
-// --- algo_lib.Cmdline..Init
-// Set all fields to initial values.
-inline void algo_lib::Cmdline_Init(algo_lib::Cmdline& parent) {
-    parent.verbose = u8(0);
-    parent.debug = u8(0);
-    parent.help = bool(false);
-    parent.version = bool(false);
-    parent.sig = bool(false);
-    parent.signature = bool(false);
-}
 inline algo_lib::CsvParse::CsvParse(algo::strptr                   in_input
         ,char                           in_sep)
     : input(in_input)
@@ -429,6 +419,290 @@ inline algo_lib::ErrorX::ErrorX(const algo::strptr&            in_str
 inline algo_lib::ErrorX::ErrorX() {
 }
 
+inline algo_lib::FTempclass::FTempclass() {
+    algo_lib::FTempclass_Init(*this);
+}
+
+
+// --- algo_lib.FTempclass.str.Fill
+// Set all elements of fixed array to value RHS
+inline void algo_lib::str_Fill(algo_lib::FTempclass& tempclass, const algo::cstring &rhs) {
+    for (int i = 0; i < 8; i++) {
+        tempclass.str_elems[i] = rhs;
+    }
+}
+
+// --- algo_lib.FTempclass.str.Find
+// Look up row by row id. Return NULL if out of range
+inline algo::cstring* algo_lib::str_Find(algo_lib::FTempclass& tempclass, u64 t) {
+    u64 idx = t;
+    u64 lim = 8;
+    return idx < lim ? tempclass.str_elems + idx : NULL; // unsigned comparison with limit
+}
+
+// --- algo_lib.FTempclass.str.Getary
+// Access fixed array str as aryptr.
+inline algo::aryptr<algo::cstring> algo_lib::str_Getary(algo_lib::FTempclass& tempclass) {
+    return algo::aryptr<algo::cstring>(tempclass.str_elems, 8);
+}
+
+// --- algo_lib.FTempclass.str.Max
+// Return max number of items in the array
+inline i32 algo_lib::str_Max(algo_lib::FTempclass& tempclass) {
+    (void)tempclass;
+    return 8;
+}
+
+// --- algo_lib.FTempclass.str.N
+// Return number of items in the array
+inline i32 algo_lib::str_N(const algo_lib::FTempclass& tempclass) {
+    (void)tempclass;//only to avoid -Wunused-parameter
+    return 8;
+}
+
+// --- algo_lib.FTempclass.str.Setary
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+inline void algo_lib::str_Setary(algo_lib::FTempclass& tempclass, const algo::aryptr<algo::cstring> &rhs) {
+    int n = 8 < rhs.n_elems ? 8 : rhs.n_elems;
+    for (int i = 0; i < n; i++) {
+        tempclass.str_elems[i] = rhs[i];
+    }
+}
+
+// --- algo_lib.FTempclass.str.qFind
+// 'quick' Access row by row id. No bounds checking in release.
+inline algo::cstring& algo_lib::str_qFind(algo_lib::FTempclass& tempclass, u64 t) {
+    return tempclass.str_elems[t];
+}
+
+// --- algo_lib.FTempclass.str_curs.Reset
+// cursor points to valid item
+inline void algo_lib::tempclass_str_curs_Reset(tempclass_str_curs &curs, algo_lib::FTempclass &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- algo_lib.FTempclass.str_curs.ValidQ
+// cursor points to valid item
+inline bool algo_lib::tempclass_str_curs_ValidQ(tempclass_str_curs &curs) {
+    return u64(curs.index) < u64(8);
+}
+
+// --- algo_lib.FTempclass.str_curs.Next
+// proceed to next item
+inline void algo_lib::tempclass_str_curs_Next(tempclass_str_curs &curs) {
+    curs.index++;
+}
+
+// --- algo_lib.FTempclass.str_curs.Access
+// item access
+inline algo::cstring& algo_lib::tempclass_str_curs_Access(tempclass_str_curs &curs) {
+    return str_qFind((*curs.parent), u64(curs.index));
+}
+
+// --- algo_lib.FTempclass..Init
+// Set all fields to initial values.
+inline void algo_lib::FTempclass_Init(algo_lib::FTempclass& tempclass) {
+    tempclass.n = i32(0);
+}
+inline algo_lib::FTemppool::FTemppool() {
+    algo_lib::FTemppool_Init(*this);
+}
+
+inline algo_lib::FTemppool::~FTemppool() {
+    algo_lib::FTemppool_Uninit(*this);
+}
+
+
+// --- algo_lib.FTemppool.tempclass.Fill
+// Set all elements of fixed array to value RHS
+inline void algo_lib::tempclass_Fill(algo_lib::FTemppool& parent, const algo_lib::FTempclass &rhs) {
+    for (int i = 0; i < 4; i++) {
+        parent.tempclass_elems[i] = rhs;
+    }
+}
+
+// --- algo_lib.FTemppool.tempclass.Find
+// Look up row by row id. Return NULL if out of range
+inline algo_lib::FTempclass* algo_lib::tempclass_Find(algo_lib::FTemppool& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = 4;
+    return idx < lim ? parent.tempclass_elems + idx : NULL; // unsigned comparison with limit
+}
+
+// --- algo_lib.FTemppool.tempclass.Getary
+// Access fixed array tempclass as aryptr.
+inline algo::aryptr<algo_lib::FTempclass> algo_lib::tempclass_Getary(algo_lib::FTemppool& parent) {
+    return algo::aryptr<algo_lib::FTempclass>(parent.tempclass_elems, 4);
+}
+
+// --- algo_lib.FTemppool.tempclass.Max
+// Return max number of items in the array
+inline i32 algo_lib::tempclass_Max(algo_lib::FTemppool& parent) {
+    (void)parent;
+    return 4;
+}
+
+// --- algo_lib.FTemppool.tempclass.N
+// Return number of items in the array
+inline i32 algo_lib::tempclass_N(const algo_lib::FTemppool& parent) {
+    (void)parent;//only to avoid -Wunused-parameter
+    return 4;
+}
+
+// --- algo_lib.FTemppool.tempclass.Setary
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+inline void algo_lib::tempclass_Setary(algo_lib::FTemppool& parent, const algo::aryptr<algo_lib::FTempclass> &rhs) {
+    int n = 4 < rhs.n_elems ? 4 : rhs.n_elems;
+    for (int i = 0; i < n; i++) {
+        parent.tempclass_elems[i] = rhs[i];
+    }
+}
+
+// --- algo_lib.FTemppool.tempclass.qFind
+// 'quick' Access row by row id. No bounds checking in release.
+inline algo_lib::FTempclass& algo_lib::tempclass_qFind(algo_lib::FTemppool& parent, u64 t) {
+    return parent.tempclass_elems[t];
+}
+
+// --- algo_lib.FTemppool.spill.EmptyQ
+// Return true if index is empty
+inline bool algo_lib::spill_EmptyQ(algo_lib::FTemppool& parent) {
+    return parent.spill_n == 0;
+}
+
+// --- algo_lib.FTemppool.spill.Find
+// Look up row by row id. Return NULL if out of range
+inline algo::cstring* algo_lib::spill_Find(algo_lib::FTemppool& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = parent.spill_n;
+    if (idx >= lim) return NULL;
+    return parent.spill_elems + idx;
+}
+
+// --- algo_lib.FTemppool.spill.Getary
+// Return array pointer by value
+inline algo::aryptr<algo::cstring> algo_lib::spill_Getary(algo_lib::FTemppool& parent) {
+    return algo::aryptr<algo::cstring>(parent.spill_elems, parent.spill_n);
+}
+
+// --- algo_lib.FTemppool.spill.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline algo::cstring* algo_lib::spill_Last(algo_lib::FTemppool& parent) {
+    return spill_Find(parent, u64(parent.spill_n-1));
+}
+
+// --- algo_lib.FTemppool.spill.Max
+// Return max. number of items in the array
+inline i32 algo_lib::spill_Max(algo_lib::FTemppool& parent) {
+    (void)parent;
+    return parent.spill_max;
+}
+
+// --- algo_lib.FTemppool.spill.N
+// Return number of items in the array
+inline i32 algo_lib::spill_N(const algo_lib::FTemppool& parent) {
+    return parent.spill_n;
+}
+
+// --- algo_lib.FTemppool.spill.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void algo_lib::spill_Reserve(algo_lib::FTemppool& parent, int n) {
+    u32 new_n = parent.spill_n + n;
+    if (UNLIKELY(new_n > parent.spill_max)) {
+        spill_AbsReserve(parent, new_n);
+    }
+}
+
+// --- algo_lib.FTemppool.spill.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline algo::cstring& algo_lib::spill_qFind(algo_lib::FTemppool& parent, u64 t) {
+    return parent.spill_elems[t];
+}
+
+// --- algo_lib.FTemppool.spill.qLast
+// Return reference to last element of array. No bounds checking
+inline algo::cstring& algo_lib::spill_qLast(algo_lib::FTemppool& parent) {
+    return spill_qFind(parent, u64(parent.spill_n-1));
+}
+
+// --- algo_lib.FTemppool.spill.rowid_Get
+// Return row id of specified element
+inline u64 algo_lib::spill_rowid_Get(algo_lib::FTemppool& parent, algo::cstring &elem) {
+    u64 id = &elem - parent.spill_elems;
+    return u64(id);
+}
+
+// --- algo_lib.FTemppool.tempclass_curs.Reset
+// cursor points to valid item
+inline void algo_lib::FTemppool_tempclass_curs_Reset(FTemppool_tempclass_curs &curs, algo_lib::FTemppool &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- algo_lib.FTemppool.tempclass_curs.ValidQ
+// cursor points to valid item
+inline bool algo_lib::FTemppool_tempclass_curs_ValidQ(FTemppool_tempclass_curs &curs) {
+    return u64(curs.index) < u64(4);
+}
+
+// --- algo_lib.FTemppool.tempclass_curs.Next
+// proceed to next item
+inline void algo_lib::FTemppool_tempclass_curs_Next(FTemppool_tempclass_curs &curs) {
+    curs.index++;
+}
+
+// --- algo_lib.FTemppool.tempclass_curs.Access
+// item access
+inline algo_lib::FTempclass& algo_lib::FTemppool_tempclass_curs_Access(FTemppool_tempclass_curs &curs) {
+    return tempclass_qFind((*curs.parent), u64(curs.index));
+}
+
+// --- algo_lib.FTemppool.spill_curs.Next
+// proceed to next item
+inline void algo_lib::FTemppool_spill_curs_Next(FTemppool_spill_curs &curs) {
+    curs.index++;
+}
+
+// --- algo_lib.FTemppool.spill_curs.Reset
+inline void algo_lib::FTemppool_spill_curs_Reset(FTemppool_spill_curs &curs, algo_lib::FTemppool &parent) {
+    curs.elems = parent.spill_elems;
+    curs.n_elems = parent.spill_n;
+    curs.index = 0;
+}
+
+// --- algo_lib.FTemppool.spill_curs.ValidQ
+// cursor points to valid item
+inline bool algo_lib::FTemppool_spill_curs_ValidQ(FTemppool_spill_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- algo_lib.FTemppool.spill_curs.Access
+// item access
+inline algo::cstring& algo_lib::FTemppool_spill_curs_Access(FTemppool_spill_curs &curs) {
+    return curs.elems[curs.index];
+}
+
+// --- algo_lib.FTemppool..Init
+// Set all fields to initial values.
+inline void algo_lib::FTemppool_Init(algo_lib::FTemppool& parent) {
+    parent.spill_elems 	= 0; // (algo_lib.FTemppool.spill)
+    parent.spill_n     	= 0; // (algo_lib.FTemppool.spill)
+    parent.spill_max   	= 0; // (algo_lib.FTemppool.spill)
+    parent.mask = u32(0);
+    parent.scope = i32(0);
+}
+inline algo_lib::FLogbuf::FLogbuf() {
+    algo_lib::FLogbuf_Init(*this);
+}
+
+
+// --- algo_lib.FLogbuf..Init
+// Set all fields to initial values.
+inline void algo_lib::FLogbuf_Init(algo_lib::FLogbuf& logbuf) {
+    logbuf.flush_lim = i32(0);
+    logbuf.n_write = u64(0);
+}
 inline algo_lib::FFildes::FFildes() {
 }
 
@@ -526,56 +800,6 @@ inline algo_lib::trace::trace() {
 }
 
 
-// --- algo_lib.FDb.temp_strings.Fill
-// Set all elements of fixed array to value RHS
-inline void algo_lib::temp_strings_Fill(const algo::cstring &rhs) {
-    for (int i = 0; i < 8; i++) {
-        _db.temp_strings_elems[i] = rhs;
-    }
-}
-
-// --- algo_lib.FDb.temp_strings.Find
-// Look up row by row id. Return NULL if out of range
-inline algo::cstring* algo_lib::temp_strings_Find(u64 t) {
-    u64 idx = t;
-    u64 lim = 8;
-    return idx < lim ? _db.temp_strings_elems + idx : NULL; // unsigned comparison with limit
-}
-
-// --- algo_lib.FDb.temp_strings.Getary
-// Access fixed array temp_strings as aryptr.
-inline algo::aryptr<algo::cstring> algo_lib::temp_strings_Getary() {
-    return algo::aryptr<algo::cstring>(_db.temp_strings_elems, 8);
-}
-
-// --- algo_lib.FDb.temp_strings.Max
-// Return max number of items in the array
-inline i32 algo_lib::temp_strings_Max() {
-    return 8;
-}
-
-// --- algo_lib.FDb.temp_strings.N
-// Return number of items in the array
-inline i32 algo_lib::temp_strings_N() {
-    (void)_db;//only to avoid -Wunused-parameter
-    return 8;
-}
-
-// --- algo_lib.FDb.temp_strings.Setary
-// Set contents of fixed array to RHS; Input length is trimmed as necessary
-inline void algo_lib::temp_strings_Setary(const algo::aryptr<algo::cstring> &rhs) {
-    int n = 8 < rhs.n_elems ? 8 : rhs.n_elems;
-    for (int i = 0; i < n; i++) {
-        _db.temp_strings_elems[i] = rhs[i];
-    }
-}
-
-// --- algo_lib.FDb.temp_strings.qFind
-// 'quick' Access row by row id. No bounds checking in release.
-inline algo::cstring& algo_lib::temp_strings_qFind(u64 t) {
-    return _db.temp_strings_elems[t];
-}
-
 // --- algo_lib.FDb.ArgvIdent.Match
 inline bool algo_lib::ArgvIdentQ(u32 ch) {
     return ch_GetBit(_db.ArgvIdent, ch);
@@ -660,6 +884,56 @@ inline i32 algo_lib::ind_imtable_N() {
     return _db.ind_imtable_n;
 }
 
+// --- algo_lib.FDb.logbuf.Fill
+// Set all elements of fixed array to value RHS
+inline void algo_lib::logbuf_Fill(const algo_lib::FLogbuf &rhs) {
+    for (int i = 0; i < 3; i++) {
+        _db.logbuf_elems[i] = rhs;
+    }
+}
+
+// --- algo_lib.FDb.logbuf.Find
+// Look up row by row id. Return NULL if out of range
+inline algo_lib::FLogbuf* algo_lib::logbuf_Find(u64 t) {
+    u64 idx = t;
+    u64 lim = 3;
+    return idx < lim ? _db.logbuf_elems + idx : NULL; // unsigned comparison with limit
+}
+
+// --- algo_lib.FDb.logbuf.Getary
+// Access fixed array logbuf as aryptr.
+inline algo::aryptr<algo_lib::FLogbuf> algo_lib::logbuf_Getary() {
+    return algo::aryptr<algo_lib::FLogbuf>(_db.logbuf_elems, 3);
+}
+
+// --- algo_lib.FDb.logbuf.Max
+// Return max number of items in the array
+inline i32 algo_lib::logbuf_Max() {
+    return 3;
+}
+
+// --- algo_lib.FDb.logbuf.N
+// Return number of items in the array
+inline i32 algo_lib::logbuf_N() {
+    (void)_db;//only to avoid -Wunused-parameter
+    return 3;
+}
+
+// --- algo_lib.FDb.logbuf.Setary
+// Set contents of fixed array to RHS; Input length is trimmed as necessary
+inline void algo_lib::logbuf_Setary(const algo::aryptr<algo_lib::FLogbuf> &rhs) {
+    int n = 3 < rhs.n_elems ? 3 : rhs.n_elems;
+    for (int i = 0; i < n; i++) {
+        _db.logbuf_elems[i] = rhs[i];
+    }
+}
+
+// --- algo_lib.FDb.logbuf.qFind
+// 'quick' Access row by row id. No bounds checking in release.
+inline algo_lib::FLogbuf& algo_lib::logbuf_qFind(u64 t) {
+    return _db.logbuf_elems[t];
+}
+
 // --- algo_lib.FDb.bh_timehook.EmptyQ
 // Return true if index is empty
 inline bool algo_lib::bh_timehook_EmptyQ() {
@@ -671,7 +945,7 @@ inline bool algo_lib::bh_timehook_EmptyQ() {
 inline algo_lib::FTimehook* algo_lib::bh_timehook_First() {
     algo_lib::FTimehook *row = NULL;
     if (_db.bh_timehook_n > 0) {
-        row = _db.bh_timehook_elems[0];
+        row = _db.bh_timehook_elems[0].row;
     }
     return row;
 }
@@ -988,54 +1262,54 @@ inline bool algo_lib::UrlsafeQ(u32 ch) {
     return ch_GetBit(_db.Urlsafe, ch);
 }
 
-// --- algo_lib.FDb.temp_strings_curs.Reset
+// --- algo_lib.FDb.imtable_curs.Reset
 // cursor points to valid item
-inline void algo_lib::_db_temp_strings_curs_Reset(_db_temp_strings_curs &curs, algo_lib::FDb &parent) {
+inline void algo_lib::_db_imtable_curs_Reset(_db_imtable_curs &curs, algo_lib::FDb &parent) {
     curs.parent = &parent;
     curs.index = 0;
 }
 
-// --- algo_lib.FDb.temp_strings_curs.ValidQ
+// --- algo_lib.FDb.imtable_curs.ValidQ
 // cursor points to valid item
-inline bool algo_lib::_db_temp_strings_curs_ValidQ(_db_temp_strings_curs &curs) {
-    return u64(curs.index) < u64(8);
+inline bool algo_lib::_db_imtable_curs_ValidQ(_db_imtable_curs &curs) {
+    return curs.index < _db.imtable_n;
 }
 
-// --- algo_lib.FDb.temp_strings_curs.Next
+// --- algo_lib.FDb.imtable_curs.Next
 // proceed to next item
-inline void algo_lib::_db_temp_strings_curs_Next(_db_temp_strings_curs &curs) {
+inline void algo_lib::_db_imtable_curs_Next(_db_imtable_curs &curs) {
     curs.index++;
 }
 
-// --- algo_lib.FDb.temp_strings_curs.Access
+// --- algo_lib.FDb.imtable_curs.Access
 // item access
-inline algo::cstring& algo_lib::_db_temp_strings_curs_Access(_db_temp_strings_curs &curs) {
-    return temp_strings_qFind(u64(curs.index));
+inline algo_lib::FImtable& algo_lib::_db_imtable_curs_Access(_db_imtable_curs &curs) {
+    return imtable_qFind(u64(curs.index));
 }
 
-// --- algo_lib.FDb.imtable_curs.Reset
+// --- algo_lib.FDb.logbuf_curs.Reset
 // cursor points to valid item
-inline void algo_lib::_db_imtable_curs_Reset(_db_imtable_curs &curs, algo_lib::FDb &parent) {
+inline void algo_lib::_db_logbuf_curs_Reset(_db_logbuf_curs &curs, algo_lib::FDb &parent) {
     curs.parent = &parent;
     curs.index = 0;
 }
 
-// --- algo_lib.FDb.imtable_curs.ValidQ
+// --- algo_lib.FDb.logbuf_curs.ValidQ
 // cursor points to valid item
-inline bool algo_lib::_db_imtable_curs_ValidQ(_db_imtable_curs &curs) {
-    return curs.index < _db.imtable_n;
+inline bool algo_lib::_db_logbuf_curs_ValidQ(_db_logbuf_curs &curs) {
+    return u64(curs.index) < u64(3);
 }
 
-// --- algo_lib.FDb.imtable_curs.Next
+// --- algo_lib.FDb.logbuf_curs.Next
 // proceed to next item
-inline void algo_lib::_db_imtable_curs_Next(_db_imtable_curs &curs) {
+inline void algo_lib::_db_logbuf_curs_Next(_db_logbuf_curs &curs) {
     curs.index++;
 }
 
-// --- algo_lib.FDb.imtable_curs.Access
+// --- algo_lib.FDb.logbuf_curs.Access
 // item access
-inline algo_lib::FImtable& algo_lib::_db_imtable_curs_Access(_db_imtable_curs &curs) {
-    return imtable_qFind(u64(curs.index));
+inline algo_lib::FLogbuf& algo_lib::_db_logbuf_curs_Access(_db_logbuf_curs &curs) {
+    return logbuf_qFind(u64(curs.index));
 }
 
 // --- algo_lib.FDb.bh_timehook_curs.Access
@@ -1479,10 +1753,15 @@ inline algo_lib::FieldId::operator algo_lib_FieldIdEnum () const {
 inline void algo_lib::FieldId_Init(algo_lib::FieldId& parent) {
     parent.value = i32(-1);
 }
+inline algo_lib::Mmap::Mmap() {
+}
+
+inline algo_lib::Mmap::~Mmap() {
+    algo_lib::Mmap_Uninit(*this);
+}
+
 inline algo_lib::InTextFile::InTextFile() {
     algo_lib::InTextFile_Init(*this);
-    // added because algo_lib.InTextFile.temp_buf (Inlary) does not need initialization
-    // coverity[uninit_member]
 }
 
 inline algo_lib::InTextFile::~InTextFile() {
@@ -1490,15 +1769,6 @@ inline algo_lib::InTextFile::~InTextFile() {
 }
 
 
-// --- algo_lib.InTextFile.temp_buf.AllocMem
-// Allocate space for one element. If no memory available, return NULL.
-inline void* algo_lib::temp_buf_AllocMem(algo_lib::InTextFile& parent) {
-    void *row = reinterpret_cast<u8*>(parent.temp_buf_data) + parent.temp_buf_n;
-    if (parent.temp_buf_n == 8192) row = NULL;
-    if (row) parent.temp_buf_n++;
-    return row;
-}
-
 // --- algo_lib.InTextFile.temp_buf.EmptyQ
 // Return true if index is empty
 inline bool algo_lib::temp_buf_EmptyQ(algo_lib::InTextFile& parent) {
@@ -1510,74 +1780,103 @@ inline bool algo_lib::temp_buf_EmptyQ(algo_lib::InTextFile& parent) {
 inline u8* algo_lib::temp_buf_Find(algo_lib::InTextFile& parent, u64 t) {
     u64 idx = t;
     u64 lim = parent.temp_buf_n;
-    return idx < lim ? reinterpret_cast<u8*>(parent.temp_buf_data) + idx : NULL; // unsigned comparison with limit
+    if (idx >= lim) return NULL;
+    return parent.temp_buf_elems + idx;
 }
 
 // --- algo_lib.InTextFile.temp_buf.Getary
 // Return array pointer by value
 inline algo::aryptr<u8> algo_lib::temp_buf_Getary(algo_lib::InTextFile& parent) {
-    return algo::aryptr<u8>(reinterpret_cast<u8*>(parent.temp_buf_data), parent.temp_buf_n);
+    return algo::aryptr<u8>(parent.temp_buf_elems, parent.temp_buf_n);
+}
+
+// --- algo_lib.InTextFile.temp_buf.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline u8* algo_lib::temp_buf_Last(algo_lib::InTextFile& parent) {
+    return temp_buf_Find(parent, u64(parent.temp_buf_n-1));
 }
 
 // --- algo_lib.InTextFile.temp_buf.Max
-// Return constant 8192 -- max. number of items in the pool
+// Return max. number of items in the array
 inline i32 algo_lib::temp_buf_Max(algo_lib::InTextFile& parent) {
     (void)parent;
-    return 8192;
+    return parent.temp_buf_max;
 }
 
 // --- algo_lib.InTextFile.temp_buf.N
 // Return number of items in the array
 inline i32 algo_lib::temp_buf_N(const algo_lib::InTextFile& parent) {
-    (void)parent;//only to avoid -Wunused-parameter
     return parent.temp_buf_n;
 }
 
+// --- algo_lib.InTextFile.temp_buf.RemoveAll
+inline void algo_lib::temp_buf_RemoveAll(algo_lib::InTextFile& parent) {
+    parent.temp_buf_n = 0;
+}
+
+// --- algo_lib.InTextFile.temp_buf.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void algo_lib::temp_buf_Reserve(algo_lib::InTextFile& parent, int n) {
+    u32 new_n = parent.temp_buf_n + n;
+    if (UNLIKELY(new_n > parent.temp_buf_max)) {
+        temp_buf_AbsReserve(parent, new_n);
+    }
+}
+
 // --- algo_lib.InTextFile.temp_buf.qFind
-// 'quick' Access row by row id. No bounds checking in release.
+// 'quick' Access row by row id. No bounds checking.
 inline u8& algo_lib::temp_buf_qFind(algo_lib::InTextFile& parent, u64 t) {
-    u64 idx = t;
-    return reinterpret_cast<u8*>(parent.temp_buf_data)[idx];
+    return parent.temp_buf_elems[t];
+}
+
+// --- algo_lib.InTextFile.temp_buf.qLast
+// Return reference to last element of array. No bounds checking
+inline u8& algo_lib::temp_buf_qLast(algo_lib::InTextFile& parent) {
+    return temp_buf_qFind(parent, u64(parent.temp_buf_n-1));
 }
 
 // --- algo_lib.InTextFile.temp_buf.rowid_Get
-// Compute row id of element given element's address
-inline u64 algo_lib::temp_buf_rowid_Get(algo_lib::InTextFile& parent, u8 &row) {
-    u64 ret = u64(&row - reinterpret_cast<u8*>(parent.temp_buf_data));
-    return u64(ret);
+// Return row id of specified element
+inline u64 algo_lib::temp_buf_rowid_Get(algo_lib::InTextFile& parent, u8 &elem) {
+    u64 id = &elem - parent.temp_buf_elems;
+    return u64(id);
+}
+
+// --- algo_lib.InTextFile.temp_buf_curs.Next
+// proceed to next item
+inline void algo_lib::InTextFile_temp_buf_curs_Next(InTextFile_temp_buf_curs &curs) {
+    curs.index++;
 }
 
 // --- algo_lib.InTextFile.temp_buf_curs.Reset
-// cursor points to valid item
 inline void algo_lib::InTextFile_temp_buf_curs_Reset(InTextFile_temp_buf_curs &curs, algo_lib::InTextFile &parent) {
-    curs.parent = &parent;
+    curs.elems = parent.temp_buf_elems;
+    curs.n_elems = parent.temp_buf_n;
     curs.index = 0;
 }
 
 // --- algo_lib.InTextFile.temp_buf_curs.ValidQ
 // cursor points to valid item
 inline bool algo_lib::InTextFile_temp_buf_curs_ValidQ(InTextFile_temp_buf_curs &curs) {
-    return u64(curs.index) < u64(curs.parent->temp_buf_n);
-}
-
-// --- algo_lib.InTextFile.temp_buf_curs.Next
-// proceed to next item
-inline void algo_lib::InTextFile_temp_buf_curs_Next(InTextFile_temp_buf_curs &curs) {
-    curs.index++;
+    return curs.index < curs.n_elems;
 }
 
 // --- algo_lib.InTextFile.temp_buf_curs.Access
 // item access
 inline u8& algo_lib::InTextFile_temp_buf_curs_Access(InTextFile_temp_buf_curs &curs) {
-    return temp_buf_qFind((*curs.parent), u64(curs.index));
-}
-inline algo_lib::Mmap::Mmap() {
+    return curs.elems[curs.index];
 }
 
-inline algo_lib::Mmap::~Mmap() {
-    algo_lib::Mmap_Uninit(*this);
+// --- algo_lib.InTextFile..Init
+// Set all fields to initial values.
+inline void algo_lib::InTextFile_Init(algo_lib::InTextFile& parent) {
+    parent.own_fd = bool(true);
+    parent.temp_buf_elems 	= 0; // (algo_lib.InTextFile.temp_buf)
+    parent.temp_buf_n     	= 0; // (algo_lib.InTextFile.temp_buf)
+    parent.temp_buf_max   	= 0; // (algo_lib.InTextFile.temp_buf)
+    parent.bufsize = i32(0);
+    parent.started = bool(false);
 }
-
 inline algo_lib::MmapFile::MmapFile() {
 }
 
@@ -2033,6 +2332,30 @@ inline void algo_lib::ShStream_Init(algo_lib::ShStream& parent) {
     parent.n_overrun = u64(0);
     parent.n_read = u64(0);
 }
+inline algo_lib::SnapHdr::SnapHdr() {
+    algo_lib::SnapHdr_Init(*this);
+}
+
+
+// --- algo_lib.SnapHdr..Init
+// Set all fields to initial values.
+inline void algo_lib::SnapHdr_Init(algo_lib::SnapHdr& parent) {
+    parent.magic = u32(0x736e6170);
+    parent.version = u32(1);
+    parent.keylen = u32(0);
+    parent.nrec = u32(0);
+}
+inline algo_lib::SnapRec::SnapRec() {
+    algo_lib::SnapRec_Init(*this);
+}
+
+
+// --- algo_lib.SnapRec..Init
+// Set all fields to initial values.
+inline void algo_lib::SnapRec_Init(algo_lib::SnapRec& parent) {
+    parent.table_id = u32(0);
+    parent.size = u32(0);
+}
 inline algo_lib::Srng::Srng() {
     algo_lib::Srng_Init(*this);
 }
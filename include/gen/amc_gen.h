@@ -151,189 +151,196 @@ enum amc_TableIdEnum {                        // amc.TableId.value
     ,amc_TableId_dmmeta_argvtype       = 1    // dmmeta.argvtype -> amc.FArgvtype
     ,amc_TableId_dmmeta_Basepool       = 2    // dmmeta.Basepool -> amc.FBasepool
     ,amc_TableId_dmmeta_basepool       = 2    // dmmeta.basepool -> amc.FBasepool
-    ,amc_TableId_dmmeta_Bitfld         = 3    // dmmeta.Bitfld -> amc.FBitfld
-    ,amc_TableId_dmmeta_bitfld         = 3    // dmmeta.bitfld -> amc.FBitfld
-    ,amc_TableId_amcdb_Bltin           = 4    // amcdb.Bltin -> amc.FBltin
-    ,amc_TableId_amcdb_bltin           = 4    // amcdb.bltin -> amc.FBltin
-    ,amc_TableId_dmmeta_Cafter         = 5    // dmmeta.Cafter -> amc.FCafter
-    ,amc_TableId_dmmeta_cafter         = 5    // dmmeta.cafter -> amc.FCafter
-    ,amc_TableId_dmmeta_Cascdel        = 6    // dmmeta.Cascdel -> amc.FCascdel
-    ,amc_TableId_dmmeta_cascdel        = 6    // dmmeta.cascdel -> amc.FCascdel
-    ,amc_TableId_dmmeta_Ccmp           = 7    // dmmeta.Ccmp -> amc.FCcmp
-    ,amc_TableId_dmmeta_ccmp           = 7    // dmmeta.ccmp -> amc.FCcmp
-    ,amc_TableId_dmmeta_Cdecl          = 8    // dmmeta.Cdecl -> amc.FCdecl
-    ,amc_TableId_dmmeta_cdecl          = 8    // dmmeta.cdecl -> amc.FCdecl
-    ,amc_TableId_dmmeta_Cdflt          = 9    // dmmeta.Cdflt -> amc.FCdflt
-    ,amc_TableId_dmmeta_cdflt          = 9    // dmmeta.cdflt -> amc.FCdflt
-    ,amc_TableId_dmmeta_Cextern        = 10   // dmmeta.Cextern -> amc.FCextern
-    ,amc_TableId_dmmeta_cextern        = 10   // dmmeta.cextern -> amc.FCextern
-    ,amc_TableId_dmmeta_Cfmt           = 11   // dmmeta.Cfmt -> amc.FCfmt
-    ,amc_TableId_dmmeta_cfmt           = 11   // dmmeta.cfmt -> amc.FCfmt
-    ,amc_TableId_dmmeta_Cget           = 12   // dmmeta.Cget -> amc.FCget
-    ,amc_TableId_dmmeta_cget           = 12   // dmmeta.cget -> amc.FCget
-    ,amc_TableId_dmmeta_Charset        = 13   // dmmeta.Charset -> amc.FCharset
-    ,amc_TableId_dmmeta_charset        = 13   // dmmeta.charset -> amc.FCharset
-    ,amc_TableId_dmmeta_Chash          = 14   // dmmeta.Chash -> amc.FChash
-    ,amc_TableId_dmmeta_chash          = 14   // dmmeta.chash -> amc.FChash
-    ,amc_TableId_dmmeta_Cppfunc        = 15   // dmmeta.Cppfunc -> amc.FCppfunc
-    ,amc_TableId_dmmeta_cppfunc        = 15   // dmmeta.cppfunc -> amc.FCppfunc
-    ,amc_TableId_dmmeta_Cpptype        = 16   // dmmeta.Cpptype -> amc.FCpptype
-    ,amc_TableId_dmmeta_cpptype        = 16   // dmmeta.cpptype -> amc.FCpptype
-    ,amc_TableId_dmmeta_Csize          = 17   // dmmeta.Csize -> amc.FCsize
-    ,amc_TableId_dmmeta_csize          = 17   // dmmeta.csize -> amc.FCsize
-    ,amc_TableId_dmmeta_Cstr           = 18   // dmmeta.Cstr -> amc.FCstr
-    ,amc_TableId_dmmeta_cstr           = 18   // dmmeta.cstr -> amc.FCstr
-    ,amc_TableId_dmmeta_Ctype          = 19   // dmmeta.Ctype -> amc.FCtype
-    ,amc_TableId_dmmeta_ctype          = 19   // dmmeta.ctype -> amc.FCtype
-    ,amc_TableId_dmmeta_Dispatch       = 20   // dmmeta.Dispatch -> amc.FDispatch
-    ,amc_TableId_dmmeta_dispatch       = 20   // dmmeta.dispatch -> amc.FDispatch
-    ,amc_TableId_dmmeta_DispatchMsg    = 21   // dmmeta.DispatchMsg -> amc.FDispatchmsg
-    ,amc_TableId_dmmeta_dispatch_msg   = 21   // dmmeta.dispatch_msg -> amc.FDispatchmsg
-    ,amc_TableId_dmmeta_Dispctx        = 22   // dmmeta.Dispctx -> amc.FDispctx
-    ,amc_TableId_dmmeta_dispctx        = 22   // dmmeta.dispctx -> amc.FDispctx
-    ,amc_TableId_dmmeta_Dispfilter     = 23   // dmmeta.Dispfilter -> amc.FDispfilter
-    ,amc_TableId_dmmeta_dispfilter     = 23   // dmmeta.dispfilter -> amc.FDispfilter
-    ,amc_TableId_dmmeta_Disptrace      = 24   // dmmeta.Disptrace -> amc.FDisptrace
-    ,amc_TableId_dmmeta_disptrace      = 24   // dmmeta.disptrace -> amc.FDisptrace
-    ,amc_TableId_dmmeta_Fbase          = 25   // dmmeta.Fbase -> amc.FFbase
-    ,amc_TableId_dmmeta_fbase          = 25   // dmmeta.fbase -> amc.FFbase
-    ,amc_TableId_dmmeta_Fbigend        = 26   // dmmeta.Fbigend -> amc.FFbigend
-    ,amc_TableId_dmmeta_fbigend        = 26   // dmmeta.fbigend -> amc.FFbigend
-    ,amc_TableId_dmmeta_Fbitset        = 27   // dmmeta.Fbitset -> amc.FFbitset
-    ,amc_TableId_dmmeta_fbitset        = 27   // dmmeta.fbitset -> amc.FFbitset
-    ,amc_TableId_dmmeta_Fbuf           = 28   // dmmeta.Fbuf -> amc.FFbuf
-    ,amc_TableId_dmmeta_fbuf           = 28   // dmmeta.fbuf -> amc.FFbuf
-    ,amc_TableId_dmmeta_Fcast          = 29   // dmmeta.Fcast -> amc.FFcast
-    ,amc_TableId_dmmeta_fcast          = 29   // dmmeta.fcast -> amc.FFcast
-    ,amc_TableId_dmmeta_Fcleanup       = 30   // dmmeta.Fcleanup -> amc.FFcleanup
-    ,amc_TableId_dmmeta_fcleanup       = 30   // dmmeta.fcleanup -> amc.FFcleanup
-    ,amc_TableId_dmmeta_Fcmap          = 31   // dmmeta.Fcmap -> amc.FFcmap
-    ,amc_TableId_dmmeta_fcmap          = 31   // dmmeta.fcmap -> amc.FFcmap
-    ,amc_TableId_dmmeta_Fcmdline       = 32   // dmmeta.Fcmdline -> amc.FFcmdline
-    ,amc_TableId_dmmeta_fcmdline       = 32   // dmmeta.fcmdline -> amc.FFcmdline
-    ,amc_TableId_dmmeta_Fcmp           = 33   // dmmeta.Fcmp -> amc.FFcmp
-    ,amc_TableId_dmmeta_fcmp           = 33   // dmmeta.fcmp -> amc.FFcmp
-    ,amc_TableId_dmmeta_Fcompact       = 34   // dmmeta.Fcompact -> amc.FFcompact
-    ,amc_TableId_dmmeta_fcompact       = 34   // dmmeta.fcompact -> amc.FFcompact
-    ,amc_TableId_dmmeta_Fconst         = 35   // dmmeta.Fconst -> amc.FFconst
-    ,amc_TableId_dmmeta_fconst         = 35   // dmmeta.fconst -> amc.FFconst
-    ,amc_TableId_dmmeta_Fcurs          = 36   // dmmeta.Fcurs -> amc.FFcurs
-    ,amc_TableId_dmmeta_fcurs          = 36   // dmmeta.fcurs -> amc.FFcurs
-    ,amc_TableId_dmmeta_Fdec           = 37   // dmmeta.Fdec -> amc.FFdec
-    ,amc_TableId_dmmeta_fdec           = 37   // dmmeta.fdec -> amc.FFdec
-    ,amc_TableId_dmmeta_Fdelay         = 38   // dmmeta.Fdelay -> amc.FFdelay
-    ,amc_TableId_dmmeta_fdelay         = 38   // dmmeta.fdelay -> amc.FFdelay
-    ,amc_TableId_dmmeta_Field          = 39   // dmmeta.Field -> amc.FField
-    ,amc_TableId_dmmeta_field          = 39   // dmmeta.field -> amc.FField
-    ,amc_TableId_dmmeta_Findrem        = 40   // dmmeta.Findrem -> amc.FFindrem
-    ,amc_TableId_dmmeta_findrem        = 40   // dmmeta.findrem -> amc.FFindrem
-    ,amc_TableId_dmmeta_Finput         = 41   // dmmeta.Finput -> amc.FFinput
-    ,amc_TableId_dmmeta_finput         = 41   // dmmeta.finput -> amc.FFinput
-    ,amc_TableId_dmmeta_Fldoffset      = 42   // dmmeta.Fldoffset -> amc.FFldoffset
-    ,amc_TableId_dmmeta_fldoffset      = 42   // dmmeta.fldoffset -> amc.FFldoffset
-    ,amc_TableId_dmmeta_Floadtuples    = 43   // dmmeta.Floadtuples -> amc.FFloadtuples
-    ,amc_TableId_dmmeta_floadtuples    = 43   // dmmeta.floadtuples -> amc.FFloadtuples
-    ,amc_TableId_dmmeta_Fnoremove      = 44   // dmmeta.Fnoremove -> amc.FFnoremove
-    ,amc_TableId_dmmeta_fnoremove      = 44   // dmmeta.fnoremove -> amc.FFnoremove
-    ,amc_TableId_dmmeta_Foutput        = 45   // dmmeta.Foutput -> amc.FFoutput
-    ,amc_TableId_dmmeta_foutput        = 45   // dmmeta.foutput -> amc.FFoutput
-    ,amc_TableId_dmmeta_Fprefix        = 46   // dmmeta.Fprefix -> amc.FFprefix
-    ,amc_TableId_dmmeta_fprefix        = 46   // dmmeta.fprefix -> amc.FFprefix
-    ,amc_TableId_dmmeta_Fregx          = 47   // dmmeta.Fregx -> amc.FFregx
-    ,amc_TableId_dmmeta_fregx          = 47   // dmmeta.fregx -> amc.FFregx
-    ,amc_TableId_dmmeta_Fsort          = 48   // dmmeta.Fsort -> amc.FFsort
-    ,amc_TableId_dmmeta_fsort          = 48   // dmmeta.fsort -> amc.FFsort
-    ,amc_TableId_dmmeta_Fstep          = 49   // dmmeta.Fstep -> amc.FFstep
-    ,amc_TableId_dmmeta_fstep          = 49   // dmmeta.fstep -> amc.FFstep
-    ,amc_TableId_dmmeta_Ftrace         = 50   // dmmeta.Ftrace -> amc.FFtrace
-    ,amc_TableId_dmmeta_ftrace         = 50   // dmmeta.ftrace -> amc.FFtrace
-    ,amc_TableId_dmmeta_Func           = 51   // dmmeta.Func -> amc.FFunc
-    ,amc_TableId_dmmeta_Funique        = 52   // dmmeta.Funique -> amc.FFunique
-    ,amc_TableId_dmmeta_funique        = 52   // dmmeta.funique -> amc.FFunique
-    ,amc_TableId_dmmeta_Fwddecl        = 53   // dmmeta.Fwddecl -> amc.FFwddecl
-    ,amc_TableId_dmmeta_fwddecl        = 53   // dmmeta.fwddecl -> amc.FFwddecl
-    ,amc_TableId_dmmeta_Gconst         = 54   // dmmeta.Gconst -> amc.FGconst
-    ,amc_TableId_dmmeta_gconst         = 54   // dmmeta.gconst -> amc.FGconst
-    ,amc_TableId_dmmeta_Gstatic        = 55   // dmmeta.Gstatic -> amc.FGstatic
-    ,amc_TableId_dmmeta_gstatic        = 55   // dmmeta.gstatic -> amc.FGstatic
-    ,amc_TableId_dmmeta_Gsymbol        = 56   // dmmeta.Gsymbol -> amc.FGsymbol
-    ,amc_TableId_dmmeta_gsymbol        = 56   // dmmeta.gsymbol -> amc.FGsymbol
-    ,amc_TableId_dmmeta_Hook           = 57   // dmmeta.Hook -> amc.FHook
-    ,amc_TableId_dmmeta_hook           = 57   // dmmeta.hook -> amc.FHook
-    ,amc_TableId_dmmeta_Inlary         = 58   // dmmeta.Inlary -> amc.FInlary
-    ,amc_TableId_dmmeta_inlary         = 58   // dmmeta.inlary -> amc.FInlary
-    ,amc_TableId_dmmeta_Lenfld         = 59   // dmmeta.Lenfld -> amc.FLenfld
-    ,amc_TableId_dmmeta_lenfld         = 59   // dmmeta.lenfld -> amc.FLenfld
-    ,amc_TableId_dmmeta_Listtype       = 60   // dmmeta.Listtype -> amc.FListtype
-    ,amc_TableId_dmmeta_listtype       = 60   // dmmeta.listtype -> amc.FListtype
-    ,amc_TableId_dmmeta_Llist          = 61   // dmmeta.Llist -> amc.FLlist
-    ,amc_TableId_dmmeta_llist          = 61   // dmmeta.llist -> amc.FLlist
-    ,amc_TableId_dmmeta_Main           = 62   // dmmeta.Main -> amc.FMain
-    ,amc_TableId_dmmeta_main           = 62   // dmmeta.main -> amc.FMain
-    ,amc_TableId_dmmeta_Msgtype        = 63   // dmmeta.Msgtype -> amc.FMsgtype
-    ,amc_TableId_dmmeta_msgtype        = 63   // dmmeta.msgtype -> amc.FMsgtype
-    ,amc_TableId_dmmeta_Nocascdel      = 64   // dmmeta.Nocascdel -> amc.FNocascdel
-    ,amc_TableId_dmmeta_nocascdel      = 64   // dmmeta.nocascdel -> amc.FNocascdel
-    ,amc_TableId_dmmeta_Nossimfile     = 65   // dmmeta.Nossimfile -> amc.FNossimfile
-    ,amc_TableId_dmmeta_nossimfile     = 65   // dmmeta.nossimfile -> amc.FNossimfile
-    ,amc_TableId_dmmeta_Noxref         = 66   // dmmeta.Noxref -> amc.FNoxref
-    ,amc_TableId_dmmeta_noxref         = 66   // dmmeta.noxref -> amc.FNoxref
-    ,amc_TableId_dmmeta_Ns             = 67   // dmmeta.Ns -> amc.FNs
-    ,amc_TableId_dmmeta_ns             = 67   // dmmeta.ns -> amc.FNs
-    ,amc_TableId_dmmeta_Nsdb           = 68   // dmmeta.Nsdb -> amc.FNsdb
-    ,amc_TableId_dmmeta_nsdb           = 68   // dmmeta.nsdb -> amc.FNsdb
-    ,amc_TableId_dmmeta_Nsinclude      = 69   // dmmeta.Nsinclude -> amc.FNsinclude
-    ,amc_TableId_dmmeta_nsinclude      = 69   // dmmeta.nsinclude -> amc.FNsinclude
-    ,amc_TableId_dmmeta_Nsproto        = 70   // dmmeta.Nsproto -> amc.FNsproto
-    ,amc_TableId_dmmeta_nsproto        = 70   // dmmeta.nsproto -> amc.FNsproto
-    ,amc_TableId_dmmeta_Nsx            = 71   // dmmeta.Nsx -> amc.FNsx
-    ,amc_TableId_dmmeta_nsx            = 71   // dmmeta.nsx -> amc.FNsx
-    ,amc_TableId_dmmeta_Numstr         = 72   // dmmeta.Numstr -> amc.FNumstr
-    ,amc_TableId_dmmeta_numstr         = 72   // dmmeta.numstr -> amc.FNumstr
-    ,amc_TableId_dmmeta_Pack           = 73   // dmmeta.Pack -> amc.FPack
-    ,amc_TableId_dmmeta_pack           = 73   // dmmeta.pack -> amc.FPack
-    ,amc_TableId_dmmeta_Pmaskfld       = 74   // dmmeta.Pmaskfld -> amc.FPmaskfld
-    ,amc_TableId_dmmeta_pmaskfld       = 74   // dmmeta.pmaskfld -> amc.FPmaskfld
-    ,amc_TableId_dmmeta_Pnew           = 75   // dmmeta.Pnew -> amc.FPnew
-    ,amc_TableId_dmmeta_pnew           = 75   // dmmeta.pnew -> amc.FPnew
-    ,amc_TableId_dmmeta_Ptrary         = 76   // dmmeta.Ptrary -> amc.FPtrary
-    ,amc_TableId_dmmeta_ptrary         = 76   // dmmeta.ptrary -> amc.FPtrary
-    ,amc_TableId_dmmeta_Rowid          = 77   // dmmeta.Rowid -> amc.FRowid
-    ,amc_TableId_dmmeta_rowid          = 77   // dmmeta.rowid -> amc.FRowid
-    ,amc_TableId_dmmeta_Smallstr       = 78   // dmmeta.Smallstr -> amc.FSmallstr
-    ,amc_TableId_dmmeta_smallstr       = 78   // dmmeta.smallstr -> amc.FSmallstr
-    ,amc_TableId_dmmeta_Sortfld        = 79   // dmmeta.Sortfld -> amc.FSortfld
-    ,amc_TableId_dmmeta_sortfld        = 79   // dmmeta.sortfld -> amc.FSortfld
-    ,amc_TableId_dmmeta_Ssimfile       = 80   // dmmeta.Ssimfile -> amc.FSsimfile
-    ,amc_TableId_dmmeta_ssimfile       = 80   // dmmeta.ssimfile -> amc.FSsimfile
-    ,amc_TableId_dmmeta_Ssimvolatile   = 81   // dmmeta.Ssimvolatile -> amc.FSsimvolatile
-    ,amc_TableId_dmmeta_ssimvolatile   = 81   // dmmeta.ssimvolatile -> amc.FSsimvolatile
-    ,amc_TableId_dmmeta_Substr         = 82   // dmmeta.Substr -> amc.FSubstr
-    ,amc_TableId_dmmeta_substr         = 82   // dmmeta.substr -> amc.FSubstr
-    ,amc_TableId_dev_Targdep           = 83   // dev.Targdep -> amc.FTargdep
-    ,amc_TableId_dev_targdep           = 83   // dev.targdep -> amc.FTargdep
-    ,amc_TableId_dev_Target            = 84   // dev.Target -> amc.FTarget
-    ,amc_TableId_dev_target            = 84   // dev.target -> amc.FTarget
-    ,amc_TableId_dmmeta_Tary           = 85   // dmmeta.Tary -> amc.FTary
-    ,amc_TableId_dmmeta_tary           = 85   // dmmeta.tary -> amc.FTary
-    ,amc_TableId_amcdb_Tcursor         = 86   // amcdb.Tcursor -> amc.FTcursor
-    ,amc_TableId_amcdb_tcursor         = 86   // amcdb.tcursor -> amc.FTcursor
-    ,amc_TableId_dmmeta_Thash          = 87   // dmmeta.Thash -> amc.FThash
-    ,amc_TableId_dmmeta_thash          = 87   // dmmeta.thash -> amc.FThash
-    ,amc_TableId_dmmeta_Typefld        = 88   // dmmeta.Typefld -> amc.FTypefld
-    ,amc_TableId_dmmeta_typefld        = 88   // dmmeta.typefld -> amc.FTypefld
-    ,amc_TableId_dmmeta_Usertracefld   = 89   // dmmeta.Usertracefld -> amc.FUsertracefld
-    ,amc_TableId_dmmeta_usertracefld   = 89   // dmmeta.usertracefld -> amc.FUsertracefld
-    ,amc_TableId_dmmeta_Xref           = 90   // dmmeta.Xref -> amc.FXref
-    ,amc_TableId_dmmeta_xref           = 90   // dmmeta.xref -> amc.FXref
-};
-
-enum { amc_TableIdEnum_N = 181 };
+    ,amc_TableId_dmmeta_Bheap          = 3    // dmmeta.Bheap -> amc.FBheap
+    ,amc_TableId_dmmeta_bheap          = 3    // dmmeta.bheap -> amc.FBheap
+    ,amc_TableId_dmmeta_Bitfld         = 4    // dmmeta.Bitfld -> amc.FBitfld
+    ,amc_TableId_dmmeta_bitfld         = 4    // dmmeta.bitfld -> amc.FBitfld
+    ,amc_TableId_amcdb_Bltin           = 5    // amcdb.Bltin -> amc.FBltin
+    ,amc_TableId_amcdb_bltin           = 5    // amcdb.bltin -> amc.FBltin
+    ,amc_TableId_dmmeta_Cafter         = 6    // dmmeta.Cafter -> amc.FCafter
+    ,amc_TableId_dmmeta_cafter         = 6    // dmmeta.cafter -> amc.FCafter
+    ,amc_TableId_dmmeta_Cascdel        = 7    // dmmeta.Cascdel -> amc.FCascdel
+    ,amc_TableId_dmmeta_cascdel        = 7    // dmmeta.cascdel -> amc.FCascdel
+    ,amc_TableId_dmmeta_Ccmp           = 8    // dmmeta.Ccmp -> amc.FCcmp
+    ,amc_TableId_dmmeta_ccmp           = 8    // dmmeta.ccmp -> amc.FCcmp
+    ,amc_TableId_dmmeta_Cdecl          = 9    // dmmeta.Cdecl -> amc.FCdecl
+    ,amc_TableId_dmmeta_cdecl          = 9    // dmmeta.cdecl -> amc.FCdecl
+    ,amc_TableId_dmmeta_Cdflt          = 10   // dmmeta.Cdflt -> amc.FCdflt
+    ,amc_TableId_dmmeta_cdflt          = 10   // dmmeta.cdflt -> amc.FCdflt
+    ,amc_TableId_dmmeta_Cextern        = 11   // dmmeta.Cextern -> amc.FCextern
+    ,amc_TableId_dmmeta_cextern        = 11   // dmmeta.cextern -> amc.FCextern
+    ,amc_TableId_dmmeta_Cfmt           = 12   // dmmeta.Cfmt -> amc.FCfmt
+    ,amc_TableId_dmmeta_cfmt           = 12   // dmmeta.cfmt -> amc.FCfmt
+    ,amc_TableId_dmmeta_Cget           = 13   // dmmeta.Cget -> amc.FCget
+    ,amc_TableId_dmmeta_cget           = 13   // dmmeta.cget -> amc.FCget
+    ,amc_TableId_dmmeta_Charset        = 14   // dmmeta.Charset -> amc.FCharset
+    ,amc_TableId_dmmeta_charset        = 14   // dmmeta.charset -> amc.FCharset
+    ,amc_TableId_dmmeta_Chash          = 15   // dmmeta.Chash -> amc.FChash
+    ,amc_TableId_dmmeta_chash          = 15   // dmmeta.chash -> amc.FChash
+    ,amc_TableId_dmmeta_Cppfunc        = 16   // dmmeta.Cppfunc -> amc.FCppfunc
+    ,amc_TableId_dmmeta_cppfunc        = 16   // dmmeta.cppfunc -> amc.FCppfunc
+    ,amc_TableId_dmmeta_Cpptype        = 17   // dmmeta.Cpptype -> amc.FCpptype
+    ,amc_TableId_dmmeta_cpptype        = 17   // dmmeta.cpptype -> amc.FCpptype
+    ,amc_TableId_dmmeta_Csize          = 18   // dmmeta.Csize -> amc.FCsize
+    ,amc_TableId_dmmeta_csize          = 18   // dmmeta.csize -> amc.FCsize
+    ,amc_TableId_dmmeta_Cstr           = 19   // dmmeta.Cstr -> amc.FCstr
+    ,amc_TableId_dmmeta_cstr           = 19   // dmmeta.cstr -> amc.FCstr
+    ,amc_TableId_dmmeta_Ctype          = 20   // dmmeta.Ctype -> amc.FCtype
+    ,amc_TableId_dmmeta_ctype          = 20   // dmmeta.ctype -> amc.FCtype
+    ,amc_TableId_dmmeta_Dispatch       = 21   // dmmeta.Dispatch -> amc.FDispatch
+    ,amc_TableId_dmmeta_dispatch       = 21   // dmmeta.dispatch -> amc.FDispatch
+    ,amc_TableId_dmmeta_DispatchMsg    = 22   // dmmeta.DispatchMsg -> amc.FDispatchmsg
+    ,amc_TableId_dmmeta_dispatch_msg   = 22   // dmmeta.dispatch_msg -> amc.FDispatchmsg
+    ,amc_TableId_dmmeta_Dispctx        = 23   // dmmeta.Dispctx -> amc.FDispctx
+    ,amc_TableId_dmmeta_dispctx        = 23   // dmmeta.dispctx -> amc.FDispctx
+    ,amc_TableId_dmmeta_Dispfilter     = 24   // dmmeta.Dispfilter -> amc.FDispfilter
+    ,amc_TableId_dmmeta_dispfilter     = 24   // dmmeta.dispfilter -> amc.FDispfilter
+    ,amc_TableId_dmmeta_Disptrace      = 25   // dmmeta.Disptrace -> amc.FDisptrace
+    ,amc_TableId_dmmeta_disptrace      = 25   // dmmeta.disptrace -> amc.FDisptrace
+    ,amc_TableId_dmmeta_Fbase          = 26   // dmmeta.Fbase -> amc.FFbase
+    ,amc_TableId_dmmeta_fbase          = 26   // dmmeta.fbase -> amc.FFbase
+    ,amc_TableId_dmmeta_Fbigend        = 27   // dmmeta.Fbigend -> amc.FFbigend
+    ,amc_TableId_dmmeta_fbigend        = 27   // dmmeta.fbigend -> amc.FFbigend
+    ,amc_TableId_dmmeta_Fbitset        = 28   // dmmeta.Fbitset -> amc.FFbitset
+    ,amc_TableId_dmmeta_fbitset        = 28   // dmmeta.fbitset -> amc.FFbitset
+    ,amc_TableId_dmmeta_Fbuf           = 29   // dmmeta.Fbuf -> amc.FFbuf
+    ,amc_TableId_dmmeta_fbuf           = 29   // dmmeta.fbuf -> amc.FFbuf
+    ,amc_TableId_dmmeta_Fcast          = 30   // dmmeta.Fcast -> amc.FFcast
+    ,amc_TableId_dmmeta_fcast          = 30   // dmmeta.fcast -> amc.FFcast
+    ,amc_TableId_dmmeta_Fcleanup       = 31   // dmmeta.Fcleanup -> amc.FFcleanup
+    ,amc_TableId_dmmeta_fcleanup       = 31   // dmmeta.fcleanup -> amc.FFcleanup
+    ,amc_TableId_dmmeta_Fcmap          = 32   // dmmeta.Fcmap -> amc.FFcmap
+    ,amc_TableId_dmmeta_fcmap          = 32   // dmmeta.fcmap -> amc.FFcmap
+    ,amc_TableId_dmmeta_Fcmdline       = 33   // dmmeta.Fcmdline -> amc.FFcmdline
+    ,amc_TableId_dmmeta_fcmdline       = 33   // dmmeta.fcmdline -> amc.FFcmdline
+    ,amc_TableId_dmmeta_Fcmp           = 34   // dmmeta.Fcmp -> amc.FFcmp
+    ,amc_TableId_dmmeta_fcmp           = 34   // dmmeta.fcmp -> amc.FFcmp
+    ,amc_TableId_dmmeta_Fcolumn        = 35   // dmmeta.Fcolumn -> amc.FFcolumn
+    ,amc_TableId_dmmeta_fcolumn        = 35   // dmmeta.fcolumn -> amc.FFcolumn
+    ,amc_TableId_dmmeta_Fcompact       = 36   // dmmeta.Fcompact -> amc.FFcompact
+    ,amc_TableId_dmmeta_fcompact       = 36   // dmmeta.fcompact -> amc.FFcompact
+    ,amc_TableId_dmmeta_Fconst         = 37   // dmmeta.Fconst -> amc.FFconst
+    ,amc_TableId_dmmeta_fconst         = 37   // dmmeta.fconst -> amc.FFconst
+    ,amc_TableId_dmmeta_Fcurs          = 38   // dmmeta.Fcurs -> amc.FFcurs
+    ,amc_TableId_dmmeta_fcurs          = 38   // dmmeta.fcurs -> amc.FFcurs
+    ,amc_TableId_dmmeta_Fdec           = 39   // dmmeta.Fdec -> amc.FFdec
+    ,amc_TableId_dmmeta_fdec           = 39   // dmmeta.fdec -> amc.FFdec
+    ,amc_TableId_dmmeta_Fdelay         = 40   // dmmeta.Fdelay -> amc.FFdelay
+    ,amc_TableId_dmmeta_fdelay         = 40   // dmmeta.fdelay -> amc.FFdelay
+    ,amc_TableId_dmmeta_Field          = 41   // dmmeta.Field -> amc.FField
+    ,amc_TableId_dmmeta_field          = 41   // dmmeta.field -> amc.FField
+    ,amc_TableId_dmmeta_Findrem        = 42   // dmmeta.Findrem -> amc.FFindrem
+    ,amc_TableId_dmmeta_findrem        = 42   // dmmeta.findrem -> amc.FFindrem
+    ,amc_TableId_dmmeta_Finput         = 43   // dmmeta.Finput -> amc.FFinput
+    ,amc_TableId_dmmeta_finput         = 43   // dmmeta.finput -> amc.FFinput
+    ,amc_TableId_dmmeta_Fldoffset      = 44   // dmmeta.Fldoffset -> amc.FFldoffset
+    ,amc_TableId_dmmeta_fldoffset      = 44   // dmmeta.fldoffset -> amc.FFldoffset
+    ,amc_TableId_dmmeta_Floadtuples    = 45   // dmmeta.Floadtuples -> amc.FFloadtuples
+    ,amc_TableId_dmmeta_floadtuples    = 45   // dmmeta.floadtuples -> amc.FFloadtuples
+    ,amc_TableId_dmmeta_Fnoremove      = 46   // dmmeta.Fnoremove -> amc.FFnoremove
+    ,amc_TableId_dmmeta_fnoremove      = 46   // dmmeta.fnoremove -> amc.FFnoremove
+    ,amc_TableId_dmmeta_Foutput        = 47   // dmmeta.Foutput -> amc.FFoutput
+    ,amc_TableId_dmmeta_foutput        = 47   // dmmeta.foutput -> amc.FFoutput
+    ,amc_TableId_dmmeta_Fprefix        = 48   // dmmeta.Fprefix -> amc.FFprefix
+    ,amc_TableId_dmmeta_fprefix        = 48   // dmmeta.fprefix -> amc.FFprefix
+    ,amc_TableId_dmmeta_Fregx          = 49   // dmmeta.Fregx -> amc.FFregx
+    ,amc_TableId_dmmeta_fregx          = 49   // dmmeta.fregx -> amc.FFregx
+    ,amc_TableId_dmmeta_Fsort          = 50   // dmmeta.Fsort -> amc.FFsort
+    ,amc_TableId_dmmeta_fsort          = 50   // dmmeta.fsort -> amc.FFsort
+    ,amc_TableId_dmmeta_Fstep          = 51   // dmmeta.Fstep -> amc.FFstep
+    ,amc_TableId_dmmeta_fstep          = 51   // dmmeta.fstep -> amc.FFstep
+    ,amc_TableId_dmmeta_Ftrace         = 52   // dmmeta.Ftrace -> amc.FFtrace
+    ,amc_TableId_dmmeta_ftrace         = 52   // dmmeta.ftrace -> amc.FFtrace
+    ,amc_TableId_dmmeta_Func           = 53   // dmmeta.Func -> amc.FFunc
+    ,amc_TableId_dmmeta_Funique        = 54   // dmmeta.Funique -> amc.FFunique
+    ,amc_TableId_dmmeta_funique        = 54   // dmmeta.funique -> amc.FFunique
+    ,amc_TableId_dmmeta_Fwddecl        = 55   // dmmeta.Fwddecl -> amc.FFwddecl
+    ,amc_TableId_dmmeta_fwddecl        = 55   // dmmeta.fwddecl -> amc.FFwddecl
+    ,amc_TableId_dmmeta_Gconst         = 56   // dmmeta.Gconst -> amc.FGconst
+    ,amc_TableId_dmmeta_gconst         = 56   // dmmeta.gconst -> amc.FGconst
+    ,amc_TableId_dmmeta_Gstatic        = 57   // dmmeta.Gstatic -> amc.FGstatic
+    ,amc_TableId_dmmeta_gstatic        = 57   // dmmeta.gstatic -> amc.FGstatic
+    ,amc_TableId_dmmeta_Gsymbol        = 58   // dmmeta.Gsymbol -> amc.FGsymbol
+    ,amc_TableId_dmmeta_gsymbol        = 58   // dmmeta.gsymbol -> amc.FGsymbol
+    ,amc_TableId_dmmeta_Hook           = 59   // dmmeta.Hook -> amc.FHook
+    ,amc_TableId_dmmeta_hook           = 59   // dmmeta.hook -> amc.FHook
+    ,amc_TableId_dmmeta_Inlary         = 60   // dmmeta.Inlary -> amc.FInlary
+    ,amc_TableId_dmmeta_inlary         = 60   // dmmeta.inlary -> amc.FInlary
+    ,amc_TableId_dmmeta_Lenfld         = 61   // dmmeta.Lenfld -> amc.FLenfld
+    ,amc_TableId_dmmeta_lenfld         = 61   // dmmeta.lenfld -> amc.FLenfld
+    ,amc_TableId_dmmeta_Listtype       = 62   // dmmeta.Listtype -> amc.FListtype
+    ,amc_TableId_dmmeta_listtype       = 62   // dmmeta.listtype -> amc.FListtype
+    ,amc_TableId_dmmeta_Llist          = 63   // dmmeta.Llist -> amc.FLlist
+    ,amc_TableId_dmmeta_llist          = 63   // dmmeta.llist -> amc.FLlist
+    ,amc_TableId_dmmeta_Magazine       = 64   // dmmeta.Magazine -> amc.FMagazine
+    ,amc_TableId_dmmeta_magazine       = 64   // dmmeta.magazine -> amc.FMagazine
+    ,amc_TableId_dmmeta_Main           = 65   // dmmeta.Main -> amc.FMain
+    ,amc_TableId_dmmeta_main           = 65   // dmmeta.main -> amc.FMain
+    ,amc_TableId_dmmeta_Msgtype        = 66   // dmmeta.Msgtype -> amc.FMsgtype
+    ,amc_TableId_dmmeta_msgtype        = 66   // dmmeta.msgtype -> amc.FMsgtype
+    ,amc_TableId_dmmeta_Nocascdel      = 67   // dmmeta.Nocascdel -> amc.FNocascdel
+    ,amc_TableId_dmmeta_nocascdel      = 67   // dmmeta.nocascdel -> amc.FNocascdel
+    ,amc_TableId_dmmeta_Nossimfile     = 68   // dmmeta.Nossimfile -> amc.FNossimfile
+    ,amc_TableId_dmmeta_nossimfile     = 68   // dmmeta.nossimfile -> amc.FNossimfile
+    ,amc_TableId_dmmeta_Noxref         = 69   // dmmeta.Noxref -> amc.FNoxref
+    ,amc_TableId_dmmeta_noxref         = 69   // dmmeta.noxref -> amc.FNoxref
+    ,amc_TableId_dmmeta_Ns             = 70   // dmmeta.Ns -> amc.FNs
+    ,amc_TableId_dmmeta_ns             = 70   // dmmeta.ns -> amc.FNs
+    ,amc_TableId_dmmeta_Nsdb           = 71   // dmmeta.Nsdb -> amc.FNsdb
+    ,amc_TableId_dmmeta_nsdb           = 71   // dmmeta.nsdb -> amc.FNsdb
+    ,amc_TableId_dmmeta_Nsinclude      = 72   // dmmeta.Nsinclude -> amc.FNsinclude
+    ,amc_TableId_dmmeta_nsinclude      = 72   // dmmeta.nsinclude -> amc.FNsinclude
+    ,amc_TableId_dmmeta_Nsproto        = 73   // dmmeta.Nsproto -> amc.FNsproto
+    ,amc_TableId_dmmeta_nsproto        = 73   // dmmeta.nsproto -> amc.FNsproto
+    ,amc_TableId_dmmeta_Nsx            = 74   // dmmeta.Nsx -> amc.FNsx
+    ,amc_TableId_dmmeta_nsx            = 74   // dmmeta.nsx -> amc.FNsx
+    ,amc_TableId_dmmeta_Numstr         = 75   // dmmeta.Numstr -> amc.FNumstr
+    ,amc_TableId_dmmeta_numstr         = 75   // dmmeta.numstr -> amc.FNumstr
+    ,amc_TableId_dmmeta_Pack           = 76   // dmmeta.Pack -> amc.FPack
+    ,amc_TableId_dmmeta_pack           = 76   // dmmeta.pack -> amc.FPack
+    ,amc_TableId_dmmeta_Pmaskfld       = 77   // dmmeta.Pmaskfld -> amc.FPmaskfld
+    ,amc_TableId_dmmeta_pmaskfld       = 77   // dmmeta.pmaskfld -> amc.FPmaskfld
+    ,amc_TableId_dmmeta_Pnew           = 78   // dmmeta.Pnew -> amc.FPnew
+    ,amc_TableId_dmmeta_pnew           = 78   // dmmeta.pnew -> amc.FPnew
+    ,amc_TableId_dmmeta_Ptrary         = 79   // dmmeta.Ptrary -> amc.FPtrary
+    ,amc_TableId_dmmeta_ptrary         = 79   // dmmeta.ptrary -> amc.FPtrary
+    ,amc_TableId_dmmeta_Rowid          = 80   // dmmeta.Rowid -> amc.FRowid
+    ,amc_TableId_dmmeta_rowid          = 80   // dmmeta.rowid -> amc.FRowid
+    ,amc_TableId_dmmeta_Smallstr       = 81   // dmmeta.Smallstr -> amc.FSmallstr
+    ,amc_TableId_dmmeta_smallstr       = 81   // dmmeta.smallstr -> amc.FSmallstr
+    ,amc_TableId_dmmeta_Sortfld        = 82   // dmmeta.Sortfld -> amc.FSortfld
+    ,amc_TableId_dmmeta_sortfld        = 82   // dmmeta.sortfld -> amc.FSortfld
+    ,amc_TableId_dmmeta_Ssimfile       = 83   // dmmeta.Ssimfile -> amc.FSsimfile
+    ,amc_TableId_dmmeta_ssimfile       = 83   // dmmeta.ssimfile -> amc.FSsimfile
+    ,amc_TableId_dmmeta_Ssimvolatile   = 84   // dmmeta.Ssimvolatile -> amc.FSsimvolatile
+    ,amc_TableId_dmmeta_ssimvolatile   = 84   // dmmeta.ssimvolatile -> amc.FSsimvolatile
+    ,amc_TableId_dmmeta_Substr         = 85   // dmmeta.Substr -> amc.FSubstr
+    ,amc_TableId_dmmeta_substr         = 85   // dmmeta.substr -> amc.FSubstr
+    ,amc_TableId_dev_Targdep           = 86   // dev.Targdep -> amc.FTargdep
+    ,amc_TableId_dev_targdep           = 86   // dev.targdep -> amc.FTargdep
+    ,amc_TableId_dev_Target            = 87   // dev.Target -> amc.FTarget
+    ,amc_TableId_dev_target            = 87   // dev.target -> amc.FTarget
+    ,amc_TableId_dmmeta_Tary           = 88   // dmmeta.Tary -> amc.FTary
+    ,amc_TableId_dmmeta_tary           = 88   // dmmeta.tary -> amc.FTary
+    ,amc_TableId_amcdb_Tcursor         = 89   // amcdb.Tcursor -> amc.FTcursor
+    ,amc_TableId_amcdb_tcursor         = 89   // amcdb.tcursor -> amc.FTcursor
+    ,amc_TableId_dmmeta_Thash          = 90   // dmmeta.Thash -> amc.FThash
+    ,amc_TableId_dmmeta_thash          = 90   // dmmeta.thash -> amc.FThash
+    ,amc_TableId_dmmeta_Typefld        = 91   // dmmeta.Typefld -> amc.FTypefld
+    ,amc_TableId_dmmeta_typefld        = 91   // dmmeta.typefld -> amc.FTypefld
+    ,amc_TableId_dmmeta_Usertracefld   = 92   // dmmeta.Usertracefld -> amc.FUsertracefld
+    ,amc_TableId_dmmeta_usertracefld   = 92   // dmmeta.usertracefld -> amc.FUsertracefld
+    ,amc_TableId_dmmeta_Xref           = 93   // dmmeta.Xref -> amc.FXref
+    ,amc_TableId_dmmeta_xref           = 93   // dmmeta.xref -> amc.FXref
+};
+
+enum { amc_TableIdEnum_N = 187 };
 
 namespace dmmeta { struct Anonfld; }
 namespace dmmeta { struct Argvtype; }
 namespace dmmeta { struct Basepool; }
 namespace amc { struct FField; }
+namespace dmmeta { struct Bheap; }
 namespace dmmeta { struct Bitfld; }
 namespace amcdb { struct Bltin; }
 namespace dmmeta { struct Cafter; }
@@ -370,6 +377,7 @@ namespace dmmeta { struct Fcleanup; }
 namespace dmmeta { struct Fcmap; }
 namespace dmmeta { struct Fcmdline; }
 namespace dmmeta { struct Fcmp; }
+namespace dmmeta { struct Fcolumn; }
 namespace dmmeta { struct Fcompact; }
 namespace dmmeta { struct Fconst; }
 namespace dmmeta { struct Fcurs; }
@@ -401,6 +409,7 @@ namespace dmmeta { struct Lenfld; }
 namespace dmmeta { struct Listtype; }
 namespace dmmeta { struct Llist; }
 namespace amc { struct FListtype; }
+namespace dmmeta { struct Magazine; }
 namespace dmmeta { struct Main; }
 namespace dmmeta { struct Msgtype; }
 namespace dmmeta { struct Nocascdel; }
@@ -445,6 +454,7 @@ namespace amc { struct Enumstr; }
 namespace amc { struct FAnonfld; }
 namespace amc { struct FArgvtype; }
 namespace amc { struct FBasepool; }
+namespace amc { struct FBheap; }
 namespace amc { struct FBitfld; }
 namespace amc { struct FBltin; }
 namespace amc { struct FCafter; }
@@ -481,6 +491,7 @@ namespace amc { struct FFcleanup; }
 namespace amc { struct FFcmap; }
 namespace amc { struct FFcmdline; }
 namespace amc { struct FFcmp; }
+namespace amc { struct FFcolumn; }
 namespace amc { struct FFcompact; }
 namespace amc { struct FFconst; }
 namespace amc { struct FFcurs; }
@@ -509,6 +520,7 @@ namespace amc { struct FHook; }
 namespace amc { struct FInlary; }
 namespace amc { struct FLenfld; }
 namespace amc { struct FLlist; }
+namespace amc { struct FMagazine; }
 namespace amc { struct FMain; }
 namespace amc { struct FMsgtype; }
 namespace amc { struct FNocascdel; }
@@ -708,6 +720,9 @@ namespace amc { struct _db_charset_curs; }
 namespace amc { struct _db_nsinclude_curs; }
 namespace amc { struct _db_ssimvolatile_curs; }
 namespace amc { struct _db_funique_curs; }
+namespace amc { struct _db_fcolumn_curs; }
+namespace amc { struct _db_bheap_curs; }
+namespace amc { struct _db_magazine_curs; }
 namespace amc { struct dispatch_c_dispatch_msg_curs; }
 namespace amc { struct enumstr_c_fconst_curs; }
 namespace amc { struct enumstr_len_bh_enumstr_curs; }
@@ -921,6 +936,34 @@ void                 basepool_CopyIn(amc::FBasepool &row, dmmeta::Basepool &in)
 void                 FBasepool_Init(amc::FBasepool& basepool);
 void                 FBasepool_Uninit(amc::FBasepool& basepool) __attribute__((nothrow));
 
+// --- amc.FBheap
+// create: amc.FDb.bheap (Lary)
+// access: amc.FField.c_bheap (Ptr)
+struct FBheap { // amc.FBheap
+    algo::Smallstr100   field;     //
+    u32                 arity;     //   4  Number of children per heap node
+    bool                inlkey;    //   true  Store copy of sort key next to row pointer in heap array
+    algo::Comment       comment;   //
+private:
+    friend amc::FBheap&         bheap_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend amc::FBheap*         bheap_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 bheap_RemoveAll() __attribute__((nothrow));
+    friend void                 bheap_RemoveLast() __attribute__((nothrow));
+    FBheap();
+    ~FBheap();
+    FBheap(const FBheap&){ /*disallow copy constructor */}
+    void operator =(const FBheap&){ /*disallow direct assignment */}
+};
+
+// Copy fields out of row
+void                 bheap_CopyOut(amc::FBheap &row, dmmeta::Bheap &out) __attribute__((nothrow));
+// Copy fields in to row
+void                 bheap_CopyIn(amc::FBheap &row, dmmeta::Bheap &in) __attribute__((nothrow));
+
+// Set all fields to initial values.
+void                 FBheap_Init(amc::FBheap& bheap);
+void                 FBheap_Uninit(amc::FBheap& bheap) __attribute__((nothrow));
+
 // --- amc.FBitfld
 // create: amc.FDb.bitfld (Lary)
 // access: amc.FField.c_bitfld (Ptr)
@@ -1460,7 +1503,7 @@ struct FCtype { // amc.FCtype
     u32                   c_cdecl_max;                // capacity of allocated array
     bool                  ns_c_ctype_in_ary;          //   false  membership flag
     bool                  ns_c_ctype_ins_in_ary;      //   false  membership flag
-    amc::FCtype*          ind_ctype_next;             // hash next
+    bool                  ind_ctype_in;               // row is in hash
     amc::FCtype*          zsl_ctype_pack_tran_next;   // zslist link; -1 means not-in-list
     amc::FCtype*          zs_sig_visit_next;          // zslist link; -1 means not-in-list
 private:
@@ -2143,8 +2186,8 @@ struct FDb { // amc.FDb
     amc::FBltin**         ind_bltin_buckets_elems;                  // pointer to bucket array
     i32                   ind_bltin_buckets_n;                      // number of elements in bucket array
     i32                   ind_bltin_n;                              // number of elements in the hash table
-    amc::FCtype**         ind_ctype_buckets_elems;                  // pointer to bucket array
-    i32                   ind_ctype_buckets_n;                      // number of elements in bucket array
+    algo::Hashslot*       ind_ctype_slots_elems;                    // pointer to slot array
+    i32                   ind_ctype_slots_n;                        // number of elements in slot array
     i32                   ind_ctype_n;                              // number of elements in the hash table
     amc::FDispatch**      ind_dispatch_buckets_elems;               // pointer to bucket array
     i32                   ind_dispatch_buckets_n;                   // number of elements in bucket array
@@ -2152,8 +2195,8 @@ struct FDb { // amc.FDb
     amc::FFunc**          ind_func_buckets_elems;                   // pointer to bucket array
     i32                   ind_func_buckets_n;                       // number of elements in bucket array
     i32                   ind_func_n;                               // number of elements in the hash table
-    amc::FField**         ind_field_buckets_elems;                  // pointer to bucket array
-    i32                   ind_field_buckets_n;                      // number of elements in bucket array
+    algo::Hashslot*       ind_field_slots_elems;                    // pointer to slot array
+    i32                   ind_field_slots_n;                        // number of elements in slot array
     i32                   ind_field_n;                              // number of elements in the hash table
     amc::FNs**            ind_ns_buckets_elems;                     // pointer to bucket array
     i32                   ind_ns_buckets_n;                         // number of elements in bucket array
@@ -2325,9 +2368,9 @@ struct FDb { // amc.FDb
     amc::FNs*             c_curns;                                  // optional pointer
     amc::FFregx*          fregx_lary[32];                           // level array
     i32                   fregx_n;                                  // number of elements in array
-    u128                  tclass_data[sizeu128(amc::FTclass,49)];   // place for data
+    u128                  tclass_data[sizeu128(amc::FTclass,50)];   // place for data
     i32                   tclass_n;                                 // number of elems current in existence
-    enum { tclass_max = 49 };
+    enum { tclass_max = 50 };
     amc::FTclass**        ind_tclass_buckets_elems;                 // pointer to bucket array
     i32                   ind_tclass_buckets_n;                     // number of elements in bucket array
     i32                   ind_tclass_n;                             // number of elements in the hash table
@@ -2433,6 +2476,12 @@ struct FDb { // amc.FDb
     i32                   ssimvolatile_n;                           // number of elements in array
     amc::FFunique*        funique_lary[32];                         // level array
     i32                   funique_n;                                // number of elements in array
+    amc::FFcolumn*        fcolumn_lary[32];                         // level array
+    i32                   fcolumn_n;                                // number of elements in array
+    amc::FBheap*          bheap_lary[32];                           // level array
+    i32                   bheap_n;                                  // number of elements in array
+    amc::FMagazine*       magazine_lary[32];                        // level array
+    i32                   magazine_n;                               // number of elements in array
     amc::trace            trace;                                    //
 };
 
@@ -3227,6 +3276,8 @@ void                 StaticCheck();
 // Parse strptr into known type and add to database.
 // Return value is true unless an error occurs. If return value is false, algo_lib::_db.errtext has error text
 bool                 InsertStrptrMaybe(algo::strptr str);
+// Insert row image from binary input snapshot.
+bool                 InsertSnapMaybe(i32 table_id, algo::memptr row);
 // Load all finputs from given directory.
 bool                 LoadTuplesMaybe(algo::strptr root) __attribute__((nothrow));
 // Save ssim data to given directory.
@@ -4894,7 +4945,7 @@ bool                 tclass_EmptyQ() __attribute__((nothrow));
 amc::FTclass*        tclass_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
 // Return array pointer by value
 algo::aryptr<amc::FTclass> tclass_Getary() __attribute__((nothrow));
-// Return constant 49 -- max. number of items in the pool
+// Return constant 50 -- max. number of items in the pool
 i32                  tclass_Max() __attribute__((nothrow));
 // Return number of items in the array
 i32                  tclass_N() __attribute__((__warn_unused_result__, nothrow, pure));
@@ -6044,6 +6095,90 @@ amc::FFunique&       funique_qFind(u64 t) __attribute__((nothrow));
 // in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
 bool                 funique_XrefMaybe(amc::FFunique &row);
 
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+amc::FFcolumn&       fcolumn_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Allocate memory for new element. If out of memory, return NULL.
+amc::FFcolumn*       fcolumn_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+// Create new row from struct.
+// Return pointer to new element, or NULL if insertion failed (due to out-of-memory, duplicate key, etc)
+amc::FFcolumn*       fcolumn_InsertMaybe(const dmmeta::Fcolumn &value) __attribute__((nothrow));
+// Allocate space for one element. If no memory available, return NULL.
+void*                fcolumn_AllocMem() __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 fcolumn_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+amc::FFcolumn*       fcolumn_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+amc::FFcolumn*       fcolumn_Last() __attribute__((nothrow, pure));
+// Return number of items in the pool
+i32                  fcolumn_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove all elements from Lary
+void                 fcolumn_RemoveAll() __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 fcolumn_RemoveLast() __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+amc::FFcolumn&       fcolumn_qFind(u64 t) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 fcolumn_XrefMaybe(amc::FFcolumn &row);
+
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+amc::FBheap&         bheap_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Allocate memory for new element. If out of memory, return NULL.
+amc::FBheap*         bheap_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+// Create new row from struct.
+// Return pointer to new element, or NULL if insertion failed (due to out-of-memory, duplicate key, etc)
+amc::FBheap*         bheap_InsertMaybe(const dmmeta::Bheap &value) __attribute__((nothrow));
+// Allocate space for one element. If no memory available, return NULL.
+void*                bheap_AllocMem() __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 bheap_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+amc::FBheap*         bheap_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+amc::FBheap*         bheap_Last() __attribute__((nothrow, pure));
+// Return number of items in the pool
+i32                  bheap_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove all elements from Lary
+void                 bheap_RemoveAll() __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 bheap_RemoveLast() __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+amc::FBheap&         bheap_qFind(u64 t) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 bheap_XrefMaybe(amc::FBheap &row);
+
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+amc::FMagazine&      magazine_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Allocate memory for new element. If out of memory, return NULL.
+amc::FMagazine*      magazine_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+// Create new row from struct.
+// Return pointer to new element, or NULL if insertion failed (due to out-of-memory, duplicate key, etc)
+amc::FMagazine*      magazine_InsertMaybe(const dmmeta::Magazine &value) __attribute__((nothrow));
+// Allocate space for one element. If no memory available, return NULL.
+void*                magazine_AllocMem() __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 magazine_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+amc::FMagazine*      magazine_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+amc::FMagazine*      magazine_Last() __attribute__((nothrow, pure));
+// Return number of items in the pool
+i32                  magazine_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove all elements from Lary
+void                 magazine_RemoveAll() __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 magazine_RemoveLast() __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+amc::FMagazine&      magazine_qFind(u64 t) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 magazine_XrefMaybe(amc::FMagazine &row);
+
 // cursor points to valid item
 void                 _db_fsort_curs_Reset(_db_fsort_curs &curs, amc::FDb &parent);
 // cursor points to valid item
@@ -6959,6 +7094,30 @@ bool                 _db_funique_curs_ValidQ(_db_funique_curs &curs);
 void                 _db_funique_curs_Next(_db_funique_curs &curs);
 // item access
 amc::FFunique&       _db_funique_curs_Access(_db_funique_curs &curs);
+// cursor points to valid item
+void                 _db_fcolumn_curs_Reset(_db_fcolumn_curs &curs, amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_fcolumn_curs_ValidQ(_db_fcolumn_curs &curs);
+// proceed to next item
+void                 _db_fcolumn_curs_Next(_db_fcolumn_curs &curs);
+// item access
+amc::FFcolumn&       _db_fcolumn_curs_Access(_db_fcolumn_curs &curs);
+// cursor points to valid item
+void                 _db_bheap_curs_Reset(_db_bheap_curs &curs, amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_bheap_curs_ValidQ(_db_bheap_curs &curs);
+// proceed to next item
+void                 _db_bheap_curs_Next(_db_bheap_curs &curs);
+// item access
+amc::FBheap&         _db_bheap_curs_Access(_db_bheap_curs &curs);
+// cursor points to valid item
+void                 _db_magazine_curs_Reset(_db_magazine_curs &curs, amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_magazine_curs_ValidQ(_db_magazine_curs &curs);
+// proceed to next item
+void                 _db_magazine_curs_Next(_db_magazine_curs &curs);
+// item access
+amc::FMagazine&      _db_magazine_curs_Access(_db_magazine_curs &curs);
 // Set all fields to initial values.
 void                 FDb_Init();
 void                 FDb_Uninit() __attribute__((nothrow));
@@ -7564,6 +7723,30 @@ void                 fcmp_CopyIn(amc::FFcmp &row, dmmeta::Fcmp &in) __attribute_
 void                 FFcmp_Init(amc::FFcmp& fcmp);
 void                 FFcmp_Uninit(amc::FFcmp& fcmp) __attribute__((nothrow));
 
+// --- amc.FFcolumn
+// create: amc.FDb.fcolumn (Lary)
+// access: amc.FField.c_fcolumn (Ptr)
+struct FFcolumn { // amc.FFcolumn
+    algo::Smallstr100   field;     //
+    algo::Comment       comment;   //
+private:
+    friend amc::FFcolumn&       fcolumn_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend amc::FFcolumn*       fcolumn_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 fcolumn_RemoveAll() __attribute__((nothrow));
+    friend void                 fcolumn_RemoveLast() __attribute__((nothrow));
+    FFcolumn();
+    ~FFcolumn();
+    FFcolumn(const FFcolumn&){ /*disallow copy constructor */}
+    void operator =(const FFcolumn&){ /*disallow direct assignment */}
+};
+
+// Copy fields out of row
+void                 fcolumn_CopyOut(amc::FFcolumn &row, dmmeta::Fcolumn &out) __attribute__((nothrow));
+// Copy fields in to row
+void                 fcolumn_CopyIn(amc::FFcolumn &row, dmmeta::Fcolumn &in) __attribute__((nothrow));
+
+void                 FFcolumn_Uninit(amc::FFcolumn& fcolumn) __attribute__((nothrow));
+
 // --- amc.FFcompact
 // create: amc.FDb.fcompact (Lary)
 // access: amc.FField.c_fcompact (Ptr)
@@ -7772,7 +7955,7 @@ struct FField { // amc.FField
     amc::FField*        zd_inst_prev;             // previous element
     amc::FField*        zd_access_next;           // zslist link; -1 means not-in-list
     amc::FField*        zd_access_prev;           // previous element
-    amc::FField*        ind_field_next;           // hash next
+    bool                ind_field_in;             // row is in hash
     amc::FField*        zs_ordkeyfield_next;      // zslist link; -1 means not-in-list
     algo::Smallstr100   field;                    //
     algo::Smallstr50    arg;                      // type of field
@@ -7849,6 +8032,9 @@ struct FField { // amc.FField
     i32                 bh_bitfld_n;              // number of elements in the heap
     i32                 bh_bitfld_max;            // max elements in bh_bitfld_elems
     amc::FFunique*      c_funique;                // optional pointer
+    amc::FFcolumn*      c_fcolumn;                // optional pointer
+    amc::FBheap*        c_bheap;                  // optional pointer
+    amc::FMagazine*     c_magazine;               // optional pointer
     bool                ctype_c_datafld_in_ary;   //   false  membership flag
     bool                _db_c_tempfield_in_ary;   //   false  membership flag
 private:
@@ -8199,6 +8385,21 @@ bool                 c_funique_InsertMaybe(amc::FField& field, amc::FFunique& ro
 // Remove element from index. If element is not in index, do nothing.
 void                 c_funique_Remove(amc::FField& field, amc::FFunique& row) __attribute__((nothrow));
 
+// Insert row into pointer index. Return final membership status.
+bool                 c_fcolumn_InsertMaybe(amc::FField& field, amc::FFcolumn& row) __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 c_fcolumn_Remove(amc::FField& field, amc::FFcolumn& row) __attribute__((nothrow));
+
+// Insert row into pointer index. Return final membership status.
+bool                 c_bheap_InsertMaybe(amc::FField& field, amc::FBheap& row) __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 c_bheap_Remove(amc::FField& field, amc::FBheap& row) __attribute__((nothrow));
+
+// Insert row into pointer index. Return final membership status.
+bool                 c_magazine_InsertMaybe(amc::FField& field, amc::FMagazine& row) __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 c_magazine_Remove(amc::FField& field, amc::FMagazine& row) __attribute__((nothrow));
+
 // Set all fields to initial values.
 void                 FField_Init(amc::FField& field);
 void                 field_c_ffunc_curs_Reset(field_c_ffunc_curs &curs, amc::FField &parent);
@@ -9061,6 +9262,33 @@ algo::Smallstr5      listtype_Get(amc::FLlist& llist) __attribute__((__warn_unus
 void                 FLlist_Init(amc::FLlist& llist);
 void                 FLlist_Uninit(amc::FLlist& llist) __attribute__((nothrow));
 
+// --- amc.FMagazine
+// create: amc.FDb.magazine (Lary)
+// access: amc.FField.c_magazine (Ptr)
+struct FMagazine { // amc.FMagazine
+    algo::Smallstr100   field;     // Tpool or Lpool field
+    u32                 size;      //   64  Max free elements kept per thread (per size class for Lpool)
+    algo::Comment       comment;   //
+private:
+    friend amc::FMagazine&      magazine_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend amc::FMagazine*      magazine_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 magazine_RemoveAll() __attribute__((nothrow));
+    friend void                 magazine_RemoveLast() __attribute__((nothrow));
+    FMagazine();
+    ~FMagazine();
+    FMagazine(const FMagazine&){ /*disallow copy constructor */}
+    void operator =(const FMagazine&){ /*disallow direct assignment */}
+};
+
+// Copy fields out of row
+void                 magazine_CopyOut(amc::FMagazine &row, dmmeta::Magazine &out) __attribute__((nothrow));
+// Copy fields in to row
+void                 magazine_CopyIn(amc::FMagazine &row, dmmeta::Magazine &in) __attribute__((nothrow));
+
+// Set all fields to initial values.
+void                 FMagazine_Init(amc::FMagazine& magazine);
+void                 FMagazine_Uninit(amc::FMagazine& magazine) __attribute__((nothrow));
+
 // --- amc.FMain
 // create: amc.FDb.main (Lary)
 // global access: ind_main (Thash)
@@ -10610,11 +10838,14 @@ void                 FTfunc_Uninit(amc::FTfunc& tfunc) __attribute__((nothrow));
 // create: amc.FDb.thash (Lary)
 // access: amc.FField.c_thash (Ptr)
 struct FThash { // amc.FThash
-    algo::Smallstr100   field;       //
-    algo::Smallstr100   hashfld;     // Field on which hash function is computed
-    bool                unique;      //   true  Enforce uniqueness of member elements
-    amc::FField*        p_hashfld;   // reference to parent row
-    amc::FField*        p_field;     // reference to parent row
+    algo::Smallstr100   field;         //
+    algo::Smallstr100   hashfld;       // Field on which hash function is computed
+    bool                unique;        //   true  Enforce uniqueness of member elements
+    bool                cachehash;     //   false  Cache 32-bit hash value in the row; compare hash before key
+    bool                openaddr;      //   false  Open addressing: linear probing over contiguous (hash,row) slots
+    bool                incremental;   //   false  Rehash incrementally: migrate a few buckets per insert instead of all at once
+    amc::FField*        p_hashfld;     // reference to parent row
+    amc::FField*        p_field;       // reference to parent row
 private:
     friend amc::FThash&         thash_Alloc() __attribute__((__warn_unused_result__, nothrow));
     friend amc::FThash*         thash_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
@@ -11942,6 +12173,30 @@ struct _db_funique_curs {// cursor
 };
 
 
+struct _db_fcolumn_curs {// cursor
+    typedef amc::FFcolumn ChildType;
+    amc::FDb *parent;
+    i64 index;
+    _db_fcolumn_curs(){ parent=NULL; index=0; }
+};
+
+
+struct _db_bheap_curs {// cursor
+    typedef amc::FBheap ChildType;
+    amc::FDb *parent;
+    i64 index;
+    _db_bheap_curs(){ parent=NULL; index=0; }
+};
+
+
+struct _db_magazine_curs {// cursor
+    typedef amc::FMagazine ChildType;
+    amc::FDb *parent;
+    i64 index;
+    _db_magazine_curs(){ parent=NULL; index=0; }
+};
+
+
 struct dispatch_c_dispatch_msg_curs {// cursor
     typedef amc::FDispatchmsg ChildType;
     amc::FDispatchmsg** elems;
@@ -12229,6 +12484,8 @@ void                 tclass_Bitset();
 // User-implemented function from gstatic:amc.FDb.tclass
 void                 tclass_Blkpool();
 // User-implemented function from gstatic:amc.FDb.tclass
+void                 tclass_Btree();
+// User-implemented function from gstatic:amc.FDb.tclass
 void                 tclass_Charset();
 // User-implemented function from gstatic:amc.FDb.tclass
 void                 tclass_Cmp();
@@ -12429,6 +12686,10 @@ void                 tfunc_Bheap_curs();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Bheap_unordcurs();
 // User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Bheap_HeapLt();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Bheap_elem();
+// User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Bitfld_Get();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Bitfld_Init();
@@ -12483,6 +12744,54 @@ void                 tfunc_Blkpool_FreeMem();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Blkpool_Init();
 // User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_AllocNode();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_Cascdel();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_EmptyQ();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_Find();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_FindLeaf();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_First();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_FreeNode();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_Init();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_InsertChild();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_Insert();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_InTreeQ();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_Last();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_LowerBound();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_N();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_Reinsert();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_Remove();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_RemoveAll();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_RemoveAllImpl();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_RemoveFirst();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_RemoveNode();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_Uninit();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_curs();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_node();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Btree_rcurs();
+// User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Charset_Match();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Cmp_Nextchar();
@@ -12671,6 +12980,8 @@ void                 tfunc_Global_StaticCheck();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Global_InsertStrptrMaybe();
 // User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Global_InsertSnapMaybe();
+// User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Global_LoadTuplesMaybe();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Global_SaveTuples();
@@ -12807,6 +13118,8 @@ void                 tfunc_Lpool_ReallocMem();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Lpool_N();
 // User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Lpool_FlushMag();
+// User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Malloc_AllocMem();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Malloc_FreeMem();
@@ -12953,6 +13266,16 @@ void                 tfunc_Sort_HeapSort();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Sort_QuickSort();
 // User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Sort_RadixKey();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Sort_RadixSort();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Sort_SortRun();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Sort_MergeRuns();
+// User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Sort_ParallelSort();
+// User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Step_FirstChanged();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Step_Init();
@@ -13039,6 +13362,8 @@ void                 tfunc_Thash_Remove();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Thash_Reserve();
 // User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Thash_Rehash();
+// User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Thash_FindRemove();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Thash_Uninit();
@@ -13055,6 +13380,8 @@ void                 tfunc_Tpool_Reserve();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Tpool_ReserveMem();
 // User-implemented function from gstatic:amc.FDb.tfunc
+void                 tfunc_Tpool_FlushMag();
+// User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Upptr_Init();
 // User-implemented function from gstatic:amc.FDb.tfunc
 void                 tfunc_Val_Get();
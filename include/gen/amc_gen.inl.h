@@ -22,49 +22,50 @@ static amc::FTclass &amc_tclass_Bheap      = ((amc::FTclass*)amc::_db.tclass_dat
 static amc::FTclass &amc_tclass_Bitfld     = ((amc::FTclass*)amc::_db.tclass_data)[3];
 static amc::FTclass &amc_tclass_Bitset     = ((amc::FTclass*)amc::_db.tclass_data)[4];
 static amc::FTclass &amc_tclass_Blkpool    = ((amc::FTclass*)amc::_db.tclass_data)[5];
-static amc::FTclass &amc_tclass_Charset    = ((amc::FTclass*)amc::_db.tclass_data)[6];
-static amc::FTclass &amc_tclass_Cmp        = ((amc::FTclass*)amc::_db.tclass_data)[7];
-static amc::FTclass &amc_tclass_Count      = ((amc::FTclass*)amc::_db.tclass_data)[8];
-static amc::FTclass &amc_tclass_Cppfunc    = ((amc::FTclass*)amc::_db.tclass_data)[9];
-static amc::FTclass &amc_tclass_Cppstack   = ((amc::FTclass*)amc::_db.tclass_data)[10];
-static amc::FTclass &amc_tclass_Ctype      = ((amc::FTclass*)amc::_db.tclass_data)[11];
-static amc::FTclass &amc_tclass_Dec        = ((amc::FTclass*)amc::_db.tclass_data)[12];
-static amc::FTclass &amc_tclass_Delptr     = ((amc::FTclass*)amc::_db.tclass_data)[13];
-static amc::FTclass &amc_tclass_Exec       = ((amc::FTclass*)amc::_db.tclass_data)[14];
-static amc::FTclass &amc_tclass_Fbuf       = ((amc::FTclass*)amc::_db.tclass_data)[15];
-static amc::FTclass &amc_tclass_Fcast      = ((amc::FTclass*)amc::_db.tclass_data)[16];
-static amc::FTclass &amc_tclass_Fconst     = ((amc::FTclass*)amc::_db.tclass_data)[17];
-static amc::FTclass &amc_tclass_Field      = ((amc::FTclass*)amc::_db.tclass_data)[18];
-static amc::FTclass &amc_tclass_Field2     = ((amc::FTclass*)amc::_db.tclass_data)[19];
-static amc::FTclass &amc_tclass_Global     = ((amc::FTclass*)amc::_db.tclass_data)[20];
-static amc::FTclass &amc_tclass_Hook       = ((amc::FTclass*)amc::_db.tclass_data)[21];
-static amc::FTclass &amc_tclass_Inlary     = ((amc::FTclass*)amc::_db.tclass_data)[22];
-static amc::FTclass &amc_tclass_Io         = ((amc::FTclass*)amc::_db.tclass_data)[23];
-static amc::FTclass &amc_tclass_Lary       = ((amc::FTclass*)amc::_db.tclass_data)[24];
-static amc::FTclass &amc_tclass_Llist      = ((amc::FTclass*)amc::_db.tclass_data)[25];
-static amc::FTclass &amc_tclass_Lpool      = ((amc::FTclass*)amc::_db.tclass_data)[26];
-static amc::FTclass &amc_tclass_Malloc     = ((amc::FTclass*)amc::_db.tclass_data)[27];
-static amc::FTclass &amc_tclass_Numstr     = ((amc::FTclass*)amc::_db.tclass_data)[28];
-static amc::FTclass &amc_tclass_Opt        = ((amc::FTclass*)amc::_db.tclass_data)[29];
-static amc::FTclass &amc_tclass_Pkey       = ((amc::FTclass*)amc::_db.tclass_data)[30];
-static amc::FTclass &amc_tclass_Pmask      = ((amc::FTclass*)amc::_db.tclass_data)[31];
-static amc::FTclass &amc_tclass_Pool       = ((amc::FTclass*)amc::_db.tclass_data)[32];
-static amc::FTclass &amc_tclass_Protocol   = ((amc::FTclass*)amc::_db.tclass_data)[33];
-static amc::FTclass &amc_tclass_Ptr        = ((amc::FTclass*)amc::_db.tclass_data)[34];
-static amc::FTclass &amc_tclass_Ptrary     = ((amc::FTclass*)amc::_db.tclass_data)[35];
-static amc::FTclass &amc_tclass_RegxSql    = ((amc::FTclass*)amc::_db.tclass_data)[36];
-static amc::FTclass &amc_tclass_Sbrk       = ((amc::FTclass*)amc::_db.tclass_data)[37];
-static amc::FTclass &amc_tclass_Smallstr   = ((amc::FTclass*)amc::_db.tclass_data)[38];
-static amc::FTclass &amc_tclass_Sort       = ((amc::FTclass*)amc::_db.tclass_data)[39];
-static amc::FTclass &amc_tclass_Step       = ((amc::FTclass*)amc::_db.tclass_data)[40];
-static amc::FTclass &amc_tclass_Substr     = ((amc::FTclass*)amc::_db.tclass_data)[41];
-static amc::FTclass &amc_tclass_Tary       = ((amc::FTclass*)amc::_db.tclass_data)[42];
-static amc::FTclass &amc_tclass_Thash      = ((amc::FTclass*)amc::_db.tclass_data)[43];
-static amc::FTclass &amc_tclass_Tpool      = ((amc::FTclass*)amc::_db.tclass_data)[44];
-static amc::FTclass &amc_tclass_Upptr      = ((amc::FTclass*)amc::_db.tclass_data)[45];
-static amc::FTclass &amc_tclass_Val        = ((amc::FTclass*)amc::_db.tclass_data)[46];
-static amc::FTclass &amc_tclass_Varlen     = ((amc::FTclass*)amc::_db.tclass_data)[47];
-static amc::FTclass &amc_tclass_ZSListMT   = ((amc::FTclass*)amc::_db.tclass_data)[48];
+static amc::FTclass &amc_tclass_Btree      = ((amc::FTclass*)amc::_db.tclass_data)[6];
+static amc::FTclass &amc_tclass_Charset    = ((amc::FTclass*)amc::_db.tclass_data)[7];
+static amc::FTclass &amc_tclass_Cmp        = ((amc::FTclass*)amc::_db.tclass_data)[8];
+static amc::FTclass &amc_tclass_Count      = ((amc::FTclass*)amc::_db.tclass_data)[9];
+static amc::FTclass &amc_tclass_Cppfunc    = ((amc::FTclass*)amc::_db.tclass_data)[10];
+static amc::FTclass &amc_tclass_Cppstack   = ((amc::FTclass*)amc::_db.tclass_data)[11];
+static amc::FTclass &amc_tclass_Ctype      = ((amc::FTclass*)amc::_db.tclass_data)[12];
+static amc::FTclass &amc_tclass_Dec        = ((amc::FTclass*)amc::_db.tclass_data)[13];
+static amc::FTclass &amc_tclass_Delptr     = ((amc::FTclass*)amc::_db.tclass_data)[14];
+static amc::FTclass &amc_tclass_Exec       = ((amc::FTclass*)amc::_db.tclass_data)[15];
+static amc::FTclass &amc_tclass_Fbuf       = ((amc::FTclass*)amc::_db.tclass_data)[16];
+static amc::FTclass &amc_tclass_Fcast      = ((amc::FTclass*)amc::_db.tclass_data)[17];
+static amc::FTclass &amc_tclass_Fconst     = ((amc::FTclass*)amc::_db.tclass_data)[18];
+static amc::FTclass &amc_tclass_Field      = ((amc::FTclass*)amc::_db.tclass_data)[19];
+static amc::FTclass &amc_tclass_Field2     = ((amc::FTclass*)amc::_db.tclass_data)[20];
+static amc::FTclass &amc_tclass_Global     = ((amc::FTclass*)amc::_db.tclass_data)[21];
+static amc::FTclass &amc_tclass_Hook       = ((amc::FTclass*)amc::_db.tclass_data)[22];
+static amc::FTclass &amc_tclass_Inlary     = ((amc::FTclass*)amc::_db.tclass_data)[23];
+static amc::FTclass &amc_tclass_Io         = ((amc::FTclass*)amc::_db.tclass_data)[24];
+static amc::FTclass &amc_tclass_Lary       = ((amc::FTclass*)amc::_db.tclass_data)[25];
+static amc::FTclass &amc_tclass_Llist      = ((amc::FTclass*)amc::_db.tclass_data)[26];
+static amc::FTclass &amc_tclass_Lpool      = ((amc::FTclass*)amc::_db.tclass_data)[27];
+static amc::FTclass &amc_tclass_Malloc     = ((amc::FTclass*)amc::_db.tclass_data)[28];
+static amc::FTclass &amc_tclass_Numstr     = ((amc::FTclass*)amc::_db.tclass_data)[29];
+static amc::FTclass &amc_tclass_Opt        = ((amc::FTclass*)amc::_db.tclass_data)[30];
+static amc::FTclass &amc_tclass_Pkey       = ((amc::FTclass*)amc::_db.tclass_data)[31];
+static amc::FTclass &amc_tclass_Pmask      = ((amc::FTclass*)amc::_db.tclass_data)[32];
+static amc::FTclass &amc_tclass_Pool       = ((amc::FTclass*)amc::_db.tclass_data)[33];
+static amc::FTclass &amc_tclass_Protocol   = ((amc::FTclass*)amc::_db.tclass_data)[34];
+static amc::FTclass &amc_tclass_Ptr        = ((amc::FTclass*)amc::_db.tclass_data)[35];
+static amc::FTclass &amc_tclass_Ptrary     = ((amc::FTclass*)amc::_db.tclass_data)[36];
+static amc::FTclass &amc_tclass_RegxSql    = ((amc::FTclass*)amc::_db.tclass_data)[37];
+static amc::FTclass &amc_tclass_Sbrk       = ((amc::FTclass*)amc::_db.tclass_data)[38];
+static amc::FTclass &amc_tclass_Smallstr   = ((amc::FTclass*)amc::_db.tclass_data)[39];
+static amc::FTclass &amc_tclass_Sort       = ((amc::FTclass*)amc::_db.tclass_data)[40];
+static amc::FTclass &amc_tclass_Step       = ((amc::FTclass*)amc::_db.tclass_data)[41];
+static amc::FTclass &amc_tclass_Substr     = ((amc::FTclass*)amc::_db.tclass_data)[42];
+static amc::FTclass &amc_tclass_Tary       = ((amc::FTclass*)amc::_db.tclass_data)[43];
+static amc::FTclass &amc_tclass_Thash      = ((amc::FTclass*)amc::_db.tclass_data)[44];
+static amc::FTclass &amc_tclass_Tpool      = ((amc::FTclass*)amc::_db.tclass_data)[45];
+static amc::FTclass &amc_tclass_Upptr      = ((amc::FTclass*)amc::_db.tclass_data)[46];
+static amc::FTclass &amc_tclass_Val        = ((amc::FTclass*)amc::_db.tclass_data)[47];
+static amc::FTclass &amc_tclass_Varlen     = ((amc::FTclass*)amc::_db.tclass_data)[48];
+static amc::FTclass &amc_tclass_ZSListMT   = ((amc::FTclass*)amc::_db.tclass_data)[49];
 inline amc::BltinId::BltinId(u8                             in_value)
     : value(in_value)
 {
@@ -237,6 +238,21 @@ inline void amc::FBasepool_Init(amc::FBasepool& basepool) {
     basepool.p_field = NULL;
     basepool.p_base = NULL;
 }
+inline amc::FBheap::FBheap() {
+    amc::FBheap_Init(*this);
+}
+
+inline amc::FBheap::~FBheap() {
+    amc::FBheap_Uninit(*this);
+}
+
+
+// --- amc.FBheap..Init
+// Set all fields to initial values.
+inline void amc::FBheap_Init(amc::FBheap& bheap) {
+    bheap.arity = u32(4);
+    bheap.inlkey = bool(true);
+}
 inline amc::FBitfld::FBitfld() {
     amc::FBitfld_Init(*this);
 }
@@ -5259,7 +5275,7 @@ inline amc::FFregx& amc::fregx_qFind(u64 t) {
 // Allocate space for one element. If no memory available, return NULL.
 inline void* amc::tclass_AllocMem() {
     void *row = reinterpret_cast<amc::FTclass*>(_db.tclass_data) + _db.tclass_n;
-    if (_db.tclass_n == 49) row = NULL;
+    if (_db.tclass_n == 50) row = NULL;
     if (row) _db.tclass_n++;
     return row;
 }
@@ -5285,9 +5301,9 @@ inline algo::aryptr<amc::FTclass> amc::tclass_Getary() {
 }
 
 // --- amc.FDb.tclass.Max
-// Return constant 49 -- max. number of items in the pool
+// Return constant 50 -- max. number of items in the pool
 inline i32 amc::tclass_Max() {
-    return 49;
+    return 50;
 }
 
 // --- amc.FDb.tclass.N
@@ -7082,6 +7098,132 @@ inline amc::FFunique& amc::funique_qFind(u64 t) {
     return _db.funique_lary[bsr][index];
 }
 
+// --- amc.FDb.fcolumn.EmptyQ
+// Return true if index is empty
+inline bool amc::fcolumn_EmptyQ() {
+    return _db.fcolumn_n == 0;
+}
+
+// --- amc.FDb.fcolumn.Find
+// Look up row by row id. Return NULL if out of range
+inline amc::FFcolumn* amc::fcolumn_Find(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    amc::FFcolumn *retval = NULL;
+    if (LIKELY(x <= u64(_db.fcolumn_n))) {
+        retval = &_db.fcolumn_lary[bsr][index];
+    }
+    return retval;
+}
+
+// --- amc.FDb.fcolumn.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline amc::FFcolumn* amc::fcolumn_Last() {
+    return fcolumn_Find(u64(_db.fcolumn_n-1));
+}
+
+// --- amc.FDb.fcolumn.N
+// Return number of items in the pool
+inline i32 amc::fcolumn_N() {
+    return _db.fcolumn_n;
+}
+
+// --- amc.FDb.fcolumn.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline amc::FFcolumn& amc::fcolumn_qFind(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.fcolumn_lary[bsr][index];
+}
+
+// --- amc.FDb.bheap.EmptyQ
+// Return true if index is empty
+inline bool amc::bheap_EmptyQ() {
+    return _db.bheap_n == 0;
+}
+
+// --- amc.FDb.bheap.Find
+// Look up row by row id. Return NULL if out of range
+inline amc::FBheap* amc::bheap_Find(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    amc::FBheap *retval = NULL;
+    if (LIKELY(x <= u64(_db.bheap_n))) {
+        retval = &_db.bheap_lary[bsr][index];
+    }
+    return retval;
+}
+
+// --- amc.FDb.bheap.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline amc::FBheap* amc::bheap_Last() {
+    return bheap_Find(u64(_db.bheap_n-1));
+}
+
+// --- amc.FDb.bheap.N
+// Return number of items in the pool
+inline i32 amc::bheap_N() {
+    return _db.bheap_n;
+}
+
+// --- amc.FDb.bheap.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline amc::FBheap& amc::bheap_qFind(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.bheap_lary[bsr][index];
+}
+
+// --- amc.FDb.magazine.EmptyQ
+// Return true if index is empty
+inline bool amc::magazine_EmptyQ() {
+    return _db.magazine_n == 0;
+}
+
+// --- amc.FDb.magazine.Find
+// Look up row by row id. Return NULL if out of range
+inline amc::FMagazine* amc::magazine_Find(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    amc::FMagazine *retval = NULL;
+    if (LIKELY(x <= u64(_db.magazine_n))) {
+        retval = &_db.magazine_lary[bsr][index];
+    }
+    return retval;
+}
+
+// --- amc.FDb.magazine.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline amc::FMagazine* amc::magazine_Last() {
+    return magazine_Find(u64(_db.magazine_n-1));
+}
+
+// --- amc.FDb.magazine.N
+// Return number of items in the pool
+inline i32 amc::magazine_N() {
+    return _db.magazine_n;
+}
+
+// --- amc.FDb.magazine.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline amc::FMagazine& amc::magazine_qFind(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.magazine_lary[bsr][index];
+}
+
 // --- amc.FDb.fsort_curs.Reset
 // cursor points to valid item
 inline void amc::_db_fsort_curs_Reset(_db_fsort_curs &curs, amc::FDb &parent) {
@@ -9941,6 +10083,81 @@ inline void amc::_db_funique_curs_Next(_db_funique_curs &curs) {
 inline amc::FFunique& amc::_db_funique_curs_Access(_db_funique_curs &curs) {
     return funique_qFind(u64(curs.index));
 }
+
+// --- amc.FDb.fcolumn_curs.Reset
+// cursor points to valid item
+inline void amc::_db_fcolumn_curs_Reset(_db_fcolumn_curs &curs, amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- amc.FDb.fcolumn_curs.ValidQ
+// cursor points to valid item
+inline bool amc::_db_fcolumn_curs_ValidQ(_db_fcolumn_curs &curs) {
+    return curs.index < _db.fcolumn_n;
+}
+
+// --- amc.FDb.fcolumn_curs.Next
+// proceed to next item
+inline void amc::_db_fcolumn_curs_Next(_db_fcolumn_curs &curs) {
+    curs.index++;
+}
+
+// --- amc.FDb.fcolumn_curs.Access
+// item access
+inline amc::FFcolumn& amc::_db_fcolumn_curs_Access(_db_fcolumn_curs &curs) {
+    return fcolumn_qFind(u64(curs.index));
+}
+
+// --- amc.FDb.bheap_curs.Reset
+// cursor points to valid item
+inline void amc::_db_bheap_curs_Reset(_db_bheap_curs &curs, amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- amc.FDb.bheap_curs.ValidQ
+// cursor points to valid item
+inline bool amc::_db_bheap_curs_ValidQ(_db_bheap_curs &curs) {
+    return curs.index < _db.bheap_n;
+}
+
+// --- amc.FDb.bheap_curs.Next
+// proceed to next item
+inline void amc::_db_bheap_curs_Next(_db_bheap_curs &curs) {
+    curs.index++;
+}
+
+// --- amc.FDb.bheap_curs.Access
+// item access
+inline amc::FBheap& amc::_db_bheap_curs_Access(_db_bheap_curs &curs) {
+    return bheap_qFind(u64(curs.index));
+}
+
+// --- amc.FDb.magazine_curs.Reset
+// cursor points to valid item
+inline void amc::_db_magazine_curs_Reset(_db_magazine_curs &curs, amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- amc.FDb.magazine_curs.ValidQ
+// cursor points to valid item
+inline bool amc::_db_magazine_curs_ValidQ(_db_magazine_curs &curs) {
+    return curs.index < _db.magazine_n;
+}
+
+// --- amc.FDb.magazine_curs.Next
+// proceed to next item
+inline void amc::_db_magazine_curs_Next(_db_magazine_curs &curs) {
+    curs.index++;
+}
+
+// --- amc.FDb.magazine_curs.Access
+// item access
+inline amc::FMagazine& amc::_db_magazine_curs_Access(_db_magazine_curs &curs) {
+    return magazine_qFind(u64(curs.index));
+}
 inline amc::FDispatch::FDispatch() {
     amc::FDispatch_Init(*this);
 }
@@ -10415,6 +10632,13 @@ inline void amc::FFcmp_Init(amc::FFcmp& fcmp) {
     fcmp.casesens = bool(true);
     fcmp.extrn = bool(false);
 }
+inline amc::FFcolumn::FFcolumn() {
+}
+
+inline amc::FFcolumn::~FFcolumn() {
+    amc::FFcolumn_Uninit(*this);
+}
+
 inline amc::FFcompact::FFcompact() {
 }
 
@@ -11510,6 +11734,66 @@ inline void amc::c_funique_Remove(amc::FField& field, amc::FFunique& row) {
     }
 }
 
+// --- amc.FField.c_fcolumn.InsertMaybe
+// Insert row into pointer index. Return final membership status.
+inline bool amc::c_fcolumn_InsertMaybe(amc::FField& field, amc::FFcolumn& row) {
+    amc::FFcolumn* ptr = field.c_fcolumn;
+    bool retval = (ptr == NULL) | (ptr == &row);
+    if (retval) {
+        field.c_fcolumn = &row;
+    }
+    return retval;
+}
+
+// --- amc.FField.c_fcolumn.Remove
+// Remove element from index. If element is not in index, do nothing.
+inline void amc::c_fcolumn_Remove(amc::FField& field, amc::FFcolumn& row) {
+    amc::FFcolumn *ptr = field.c_fcolumn;
+    if (LIKELY(ptr == &row)) {
+        field.c_fcolumn = NULL;
+    }
+}
+
+// --- amc.FField.c_bheap.InsertMaybe
+// Insert row into pointer index. Return final membership status.
+inline bool amc::c_bheap_InsertMaybe(amc::FField& field, amc::FBheap& row) {
+    amc::FBheap* ptr = field.c_bheap;
+    bool retval = (ptr == NULL) | (ptr == &row);
+    if (retval) {
+        field.c_bheap = &row;
+    }
+    return retval;
+}
+
+// --- amc.FField.c_bheap.Remove
+// Remove element from index. If element is not in index, do nothing.
+inline void amc::c_bheap_Remove(amc::FField& field, amc::FBheap& row) {
+    amc::FBheap *ptr = field.c_bheap;
+    if (LIKELY(ptr == &row)) {
+        field.c_bheap = NULL;
+    }
+}
+
+// --- amc.FField.c_magazine.InsertMaybe
+// Insert row into pointer index. Return final membership status.
+inline bool amc::c_magazine_InsertMaybe(amc::FField& field, amc::FMagazine& row) {
+    amc::FMagazine* ptr = field.c_magazine;
+    bool retval = (ptr == NULL) | (ptr == &row);
+    if (retval) {
+        field.c_magazine = &row;
+    }
+    return retval;
+}
+
+// --- amc.FField.c_magazine.Remove
+// Remove element from index. If element is not in index, do nothing.
+inline void amc::c_magazine_Remove(amc::FField& field, amc::FMagazine& row) {
+    amc::FMagazine *ptr = field.c_magazine;
+    if (LIKELY(ptr == &row)) {
+        field.c_magazine = NULL;
+    }
+}
+
 // --- amc.FField.c_ffunc_curs.Reset
 inline void amc::field_c_ffunc_curs_Reset(field_c_ffunc_curs &curs, amc::FField &parent) {
     curs.elems = parent.c_ffunc_elems;
@@ -12152,6 +12436,20 @@ inline void amc::FLlist_Init(amc::FLlist& llist) {
     llist.havecount = bool(false);
     llist.p_listtype = NULL;
 }
+inline amc::FMagazine::FMagazine() {
+    amc::FMagazine_Init(*this);
+}
+
+inline amc::FMagazine::~FMagazine() {
+    amc::FMagazine_Uninit(*this);
+}
+
+
+// --- amc.FMagazine..Init
+// Set all fields to initial values.
+inline void amc::FMagazine_Init(amc::FMagazine& magazine) {
+    magazine.size = u32(64);
+}
 inline amc::FMain::FMain() {
     amc::FMain_Init(*this);
 }
@@ -14070,6 +14368,9 @@ inline amc::FThash::~FThash() {
 // Set all fields to initial values.
 inline void amc::FThash_Init(amc::FThash& thash) {
     thash.unique = bool(true);
+    thash.cachehash = bool(false);
+    thash.openaddr = bool(false);
+    thash.incremental = bool(false);
     thash.p_hashfld = NULL;
     thash.p_field = NULL;
 }
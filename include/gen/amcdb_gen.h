@@ -45,6 +45,7 @@ extern const char *  amcdb_Tclass_tclass_Bheap;      // Bheap       fconst:amcdb
 extern const char *  amcdb_Tclass_tclass_Bitfld;     // Bitfld      fconst:amcdb.Tclass.tclass/Bitfld
 extern const char *  amcdb_Tclass_tclass_Bitset;     // Bitset      fconst:amcdb.Tclass.tclass/Bitset
 extern const char *  amcdb_Tclass_tclass_Blkpool;    // Blkpool     fconst:amcdb.Tclass.tclass/Blkpool
+extern const char *  amcdb_Tclass_tclass_Btree;      // Btree       fconst:amcdb.Tclass.tclass/Btree
 extern const char *  amcdb_Tclass_tclass_Charset;    // Charset     fconst:amcdb.Tclass.tclass/Charset
 extern const char *  amcdb_Tclass_tclass_Cmp;        // Cmp         fconst:amcdb.Tclass.tclass/Cmp
 extern const char *  amcdb_Tclass_tclass_Count;      // Count       fconst:amcdb.Tclass.tclass/Count
@@ -37,9 +37,10 @@ enum atf_amc_FCascdel_type_Enum {        // atf_amc.FCascdel.type
     ,atf_amc_FCascdel_type_bheap    = 4
     ,atf_amc_FCascdel_type_zdlist   = 6
     ,atf_amc_FCascdel_type_atree    = 6
+    ,atf_amc_FCascdel_type_btree    = 7
 };
 
-enum { atf_amc_FCascdel_type_Enum_N = 7 };
+enum { atf_amc_FCascdel_type_Enum_N = 8 };
 
 
 // --- atf_amc_FieldIdEnum
@@ -262,12 +263,18 @@ namespace atf_amc { struct DispCase; }
 namespace atf_amc { struct DispFilter; }
 namespace atf_amc { struct FAmctest; }
 namespace atf_amc { struct FAvl; }
+namespace atf_amc { struct FColrow; }
 namespace atf_amc { struct FCstring; }
 namespace atf_amc { struct FListtype; }
 namespace atf_amc { struct trace; }
 namespace atf_amc { struct FDb; }
+namespace atf_amc { struct FHashrow; }
+namespace atf_amc { struct FHeaprow; }
+namespace atf_amc { struct FHugerow; }
+namespace atf_amc { struct FMagrow; }
 namespace atf_amc { struct FOptG; }
 namespace atf_amc { struct FPerfSortString; }
+namespace atf_amc { struct FTreerow; }
 namespace atf_amc { struct FTypeC; }
 namespace atf_amc { struct FTypeA; }
 namespace atf_amc { struct FTypeB; }
@@ -293,6 +300,7 @@ namespace atf_amc { struct RpasU32Str6; }
 namespace atf_amc { struct Sep1; }
 namespace atf_amc { struct SortedStr; }
 namespace atf_amc { struct SsimfilesCase; }
+namespace atf_amc { struct Strkey; }
 namespace atf_amc { struct TableId; }
 namespace atf_amc { struct TaryU32; }
 namespace atf_amc { struct TaryU8; }
@@ -315,6 +323,9 @@ namespace atf_amc { struct cascdel_bh_child_bheap_curs; }
 namespace atf_amc { struct cascdel_bh_child_bheap_unordcurs; }
 namespace atf_amc { struct cascdel_zd_childlist_curs; }
 namespace atf_amc { struct cascdel_tr_child_atree_curs; }
+namespace atf_amc { struct cascdel_bt_child_btree_curs; }
+namespace atf_amc { struct cascdel_bt_child_btree_node; }
+namespace atf_amc { struct cascdel_bt_child_btree_rcurs; }
 namespace atf_amc { struct _db_bh_typec_curs; }
 namespace atf_amc { struct _db_bh_typec_unordcurs; }
 namespace atf_amc { struct _db_zdl_h_typec_curs; }
@@ -339,6 +350,30 @@ namespace atf_amc { struct _db_c_typek_curs; }
 namespace atf_amc { struct _db_avl_curs; }
 namespace atf_amc { struct _db_tr_avl_curs; }
 namespace atf_amc { struct _db_listtype_curs; }
+namespace atf_amc { struct _db_hashrow_curs; }
+namespace atf_amc { struct _db_ind_hashrow_curs; }
+namespace atf_amc { struct _db_ind_hashrow_cached_curs; }
+namespace atf_amc { struct _db_ind_hashrow_oa_curs; }
+namespace atf_amc { struct _db_ind_hashrow_incr_curs; }
+namespace atf_amc { struct _db_treerow_curs; }
+namespace atf_amc { struct _db_bt_treerow_curs; }
+namespace atf_amc { struct _db_bt_treerow_node; }
+namespace atf_amc { struct _db_bt_treerow_rcurs; }
+namespace atf_amc { struct _db_tr_treerow_curs; }
+namespace atf_amc { struct _db_colrow_curs; }
+namespace atf_amc { struct _db_colrow_price_curs; }
+namespace atf_amc { struct _db_colrow_qty_curs; }
+namespace atf_amc { struct _db_heaprow_curs; }
+namespace atf_amc { struct _db_bh_heaprow_curs; }
+namespace atf_amc { struct _db_bh_heaprow_unordcurs; }
+namespace atf_amc { struct _db_bh_heaprow_inl_curs; }
+namespace atf_amc { struct _db_bh_heaprow_inl_unordcurs; }
+namespace atf_amc { struct _db_bh_heaprow_inl_elem; }
+namespace atf_amc { struct _db_bh_heaprow_ptr_curs; }
+namespace atf_amc { struct _db_bh_heaprow_ptr_unordcurs; }
+namespace atf_amc { struct _db_hugerow_curs; }
+namespace atf_amc { struct _db_ind_hugerow_curs; }
+namespace atf_amc { struct _db_ind_hugerow_thp_curs; }
 namespace atf_amc { struct FPerfSortString_orig_curs; }
 namespace atf_amc { struct FPerfSortString_sorted1_curs; }
 namespace atf_amc { struct typea_typec_curs; }
@@ -349,6 +384,10 @@ namespace atf_amc { struct types_zdl_typet_curs; }
 namespace atf_amc { struct FUnitSort_tary_curs; }
 namespace atf_amc { struct FUnitSort_c_ptrary_curs; }
 namespace atf_amc { struct FUnitSort_fixary_curs; }
+namespace atf_amc { struct FUnitSort_radix_curs; }
+namespace atf_amc { struct FUnitSort_c_radix_curs; }
+namespace atf_amc { struct FUnitSort_strkey_curs; }
+namespace atf_amc { struct FUnitSort_parallel_curs; }
 namespace atf_amc { struct InlaryPrint_fixary_curs; }
 namespace atf_amc { struct InlaryPrint_inlary_curs; }
 namespace atf_amc { struct PmaskU555_pmask_curs; }
@@ -381,6 +420,19 @@ struct varlenalloc_Lpblock {
 struct optg_Lpblock {
     optg_Lpblock* next;
 };
+struct magrow_Tpmag {// per-thread cache of free elements (atf_amc.FDb.magrow)
+    atf_amc::FMagrow* head;  // linked via magrow_next
+    i32 n;  // number of elements in magazine
+    u64 n_hit;  // allocations from magazine, not yet added to magrow_n_maghit
+};
+struct maglpool_Lpblock {
+    maglpool_Lpblock* next;
+};
+struct maglpool_Lpmag {// per-thread cache of free blocks (atf_amc.FDb.maglpool)
+    maglpool_Lpblock* head[16+1];  // free blocks by size class
+    i32 n[16+1];  // number of blocks in each list
+    u64 n_hit;  // allocations from magazine, not yet added to maglpool_n_maghit
+};
 typedef void (*parent_callback_hook)(void* userctx, atf_amc::Hooktype& arg);
 
 // sizes types appearing as Opt or Varlen; these need to be here
@@ -870,6 +922,7 @@ void                 DispType3_Print(atf_amc::DispType3 & row, algo::cstring &st
 // create: atf_amc.FDb.amctest (Lary)
 struct FAmctest { // atf_amc.FAmctest: Test function
     algo::Smallstr50             amctest;   //
+    bool                         manual;    //   false  Run only when selected by a pattern other than the default %
     algo::Comment                comment;   //
     bool                         select;    //   false  Select test for running?
     atf_amc::amctest_step_hook   step;      //   NULL  Pointer to a function
@@ -930,35 +983,39 @@ void                 FAvl_Uninit(atf_amc::FAvl& avl) __attribute__((nothrow));
 // access: atf_amc.FCascdel.bh_child_bheap (Bheap)
 // access: atf_amc.FCascdel.zd_childlist (Llist)
 // access: atf_amc.FCascdel.tr_child_atree (Atree)
+// access: atf_amc.FCascdel.bt_child_btree (Btree)
 struct FCascdel { // atf_amc.FCascdel: Test type for cascade delete
-    atf_amc::FCascdel*    p_parent;                        // reference to parent row
-    u32                   key;                             //   0
-    u32                   type;                            //   0
-    atf_amc::FCascdel*    child_ptr;                       // optional pointer
-    atf_amc::FCascdel**   c_child_ptrary_elems;            // array of pointers
-    u32                   c_child_ptrary_n;                // array of pointers
-    u32                   c_child_ptrary_max;              // capacity of allocated array
-    atf_amc::FCascdel**   ind_child_thash_buckets_elems;   // pointer to bucket array
-    i32                   ind_child_thash_buckets_n;       // number of elements in bucket array
-    i32                   ind_child_thash_n;               // number of elements in the hash table
-    atf_amc::FCascdel*    ind_child_thash_next;            // hash next
-    atf_amc::FCascdel**   bh_child_bheap_elems;            // binary heap by key
-    i32                   bh_child_bheap_n;                // number of elements in the heap
-    i32                   bh_child_bheap_max;              // max elements in bh_child_bheap_elems
-    i32                   bh_child_bheap_idx;              // index in heap; -1 means not-in-heap
-    atf_amc::FCascdel*    zd_childlist_head;               // zero-terminated doubly linked list
-    i32                   zd_childlist_n;                  // zero-terminated doubly linked list
-    atf_amc::FCascdel*    zd_childlist_tail;               // pointer to last element
-    atf_amc::FCascdel*    zd_childlist_next;               // zslist link; -1 means not-in-list
-    atf_amc::FCascdel*    zd_childlist_prev;               // previous element
-    atf_amc::FCascdel*    tr_child_atree_root;             // Root of the tree
-    i32                   tr_child_atree_n;                // number of elements in the tree
-    atf_amc::FCascdel*    tr_child_atree_up;               // pointer to parent
-    atf_amc::FCascdel*    tr_child_atree_left;             // Left child
-    atf_amc::FCascdel*    tr_child_atree_right;            // Right child
-    i32                   tr_child_atree_depth;            // Depth
-    bool                  cascdel_c_child_ptrary_in_ary;   //   false  membership flag
-    atf_amc::FCascdel*    cascdel_next;                    // Pointer to next free element int tpool
+    atf_amc::FCascdel*             p_parent;                        // reference to parent row
+    u32                            key;                             //   0
+    u32                            type;                            //   0
+    atf_amc::FCascdel*             child_ptr;                       // optional pointer
+    atf_amc::FCascdel**            c_child_ptrary_elems;            // array of pointers
+    u32                            c_child_ptrary_n;                // array of pointers
+    u32                            c_child_ptrary_max;              // capacity of allocated array
+    atf_amc::FCascdel**            ind_child_thash_buckets_elems;   // pointer to bucket array
+    i32                            ind_child_thash_buckets_n;       // number of elements in bucket array
+    i32                            ind_child_thash_n;               // number of elements in the hash table
+    atf_amc::FCascdel*             ind_child_thash_next;            // hash next
+    atf_amc::FCascdel**            bh_child_bheap_elems;            // binary heap by key
+    i32                            bh_child_bheap_n;                // number of elements in the heap
+    i32                            bh_child_bheap_max;              // max elements in bh_child_bheap_elems
+    i32                            bh_child_bheap_idx;              // index in heap; -1 means not-in-heap
+    atf_amc::FCascdel*             zd_childlist_head;               // zero-terminated doubly linked list
+    i32                            zd_childlist_n;                  // zero-terminated doubly linked list
+    atf_amc::FCascdel*             zd_childlist_tail;               // pointer to last element
+    atf_amc::FCascdel*             zd_childlist_next;               // zslist link; -1 means not-in-list
+    atf_amc::FCascdel*             zd_childlist_prev;               // previous element
+    atf_amc::FCascdel*             tr_child_atree_root;             // Root of the tree
+    i32                            tr_child_atree_n;                // number of elements in the tree
+    atf_amc::FCascdel*             tr_child_atree_up;               // pointer to parent
+    atf_amc::FCascdel*             tr_child_atree_left;             // Left child
+    atf_amc::FCascdel*             tr_child_atree_right;            // Right child
+    i32                            tr_child_atree_depth;            // Depth
+    cascdel_bt_child_btree_node*   bt_child_btree_root;             // Root node
+    i32                            bt_child_btree_n;                // Number of elements in the tree
+    cascdel_bt_child_btree_node*   bt_child_btree_leaf;             // Leaf containing the row; NULL if not in tree
+    bool                           cascdel_c_child_ptrary_in_ary;   //   false  membership flag
+    atf_amc::FCascdel*             cascdel_next;                    // Pointer to next free element int tpool
 private:
     friend atf_amc::FCascdel&   cascdel_Alloc() __attribute__((__warn_unused_result__, nothrow));
     friend atf_amc::FCascdel*   cascdel_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
@@ -1142,6 +1199,33 @@ atf_amc::FCascdel*   tr_child_atree_FirstGe(atf_amc::FCascdel& cascdel, const u3
 // Find the last element that is smaller or equal to a sortfld value
 atf_amc::FCascdel*   tr_child_atree_LastLt(atf_amc::FCascdel& cascdel, const u32& val) __attribute__((nothrow));
 
+// Delete all elements in the tree.
+void                 bt_child_btree_Cascdel(atf_amc::FCascdel& cascdel) __attribute__((nothrow));
+// Return true if index is empty
+bool                 bt_child_btree_EmptyQ(atf_amc::FCascdel& cascdel) __attribute__((__warn_unused_result__, nothrow));
+// Return first row whose key is equal to VAL, or NULL if not found
+atf_amc::FCascdel*   bt_child_btree_Find(atf_amc::FCascdel& cascdel, u32 val) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to the first(smallest) element in the tree
+atf_amc::FCascdel*   bt_child_btree_First(atf_amc::FCascdel& cascdel) __attribute__((__warn_unused_result__, nothrow));
+// Insert row into the tree. If row is already in the tree, do nothing.
+void                 bt_child_btree_Insert(atf_amc::FCascdel& cascdel, atf_amc::FCascdel& row) __attribute__((nothrow));
+// Return true if row is in the tree, false otherwise
+bool                 bt_child_btree_InTreeQ(atf_amc::FCascdel& row) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to the last(largest) element in tree
+atf_amc::FCascdel*   bt_child_btree_Last(atf_amc::FCascdel& cascdel) __attribute__((__warn_unused_result__, nothrow));
+// Return first row whose key is >= VAL, or NULL
+atf_amc::FCascdel*   bt_child_btree_LowerBound(atf_amc::FCascdel& cascdel, u32 val) __attribute__((__warn_unused_result__, nothrow));
+// Return number of elements in the tree
+i32                  bt_child_btree_N(const atf_amc::FCascdel& cascdel) __attribute__((__warn_unused_result__, nothrow, pure));
+// Reinsert a row with modified key
+void                 bt_child_btree_Reinsert(atf_amc::FCascdel& cascdel, atf_amc::FCascdel& row) __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 bt_child_btree_Remove(atf_amc::FCascdel& cascdel, atf_amc::FCascdel& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 bt_child_btree_RemoveAll(atf_amc::FCascdel& cascdel) __attribute__((nothrow));
+// If the tree is empty, return NULL. Otherwise unlink and return pointer to first element.
+atf_amc::FCascdel*   bt_child_btree_RemoveFirst(atf_amc::FCascdel& cascdel) __attribute__((nothrow));
+
 void                 cascdel_c_child_ptrary_curs_Reset(cascdel_c_child_ptrary_curs &curs, atf_amc::FCascdel &parent);
 // cursor points to valid item
 bool                 cascdel_c_child_ptrary_curs_ValidQ(cascdel_c_child_ptrary_curs &curs);
@@ -1176,10 +1260,53 @@ bool                 cascdel_tr_child_atree_curs_ValidQ(cascdel_tr_child_atree_c
 void                 cascdel_tr_child_atree_curs_Next(cascdel_tr_child_atree_curs &curs);
 // item access
 atf_amc::FCascdel&   cascdel_tr_child_atree_curs_Access(cascdel_tr_child_atree_curs &curs);
+// position cursor at the first row
+void                 cascdel_bt_child_btree_curs_Reset(cascdel_bt_child_btree_curs &curs, atf_amc::FCascdel& parent);
+// position cursor at the first row with key >= VAL
+void                 cascdel_bt_child_btree_curs_Seek(cascdel_bt_child_btree_curs &curs, atf_amc::FCascdel& parent, u32 val);
+// cursor points to valid item
+bool                 cascdel_bt_child_btree_curs_ValidQ(cascdel_bt_child_btree_curs &curs);
+// proceed to next item
+void                 cascdel_bt_child_btree_curs_Next(cascdel_bt_child_btree_curs &curs);
+// item access
+atf_amc::FCascdel&   cascdel_bt_child_btree_curs_Access(cascdel_bt_child_btree_curs &curs);
+// position cursor at the last row
+void                 cascdel_bt_child_btree_rcurs_Reset(cascdel_bt_child_btree_rcurs &curs, atf_amc::FCascdel& parent);
+// position cursor at the last row with key < VAL
+void                 cascdel_bt_child_btree_rcurs_Seek(cascdel_bt_child_btree_rcurs &curs, atf_amc::FCascdel& parent, u32 val);
+// cursor points to valid item
+bool                 cascdel_bt_child_btree_rcurs_ValidQ(cascdel_bt_child_btree_rcurs &curs);
+// proceed to next item
+void                 cascdel_bt_child_btree_rcurs_Next(cascdel_bt_child_btree_rcurs &curs);
+// item access
+atf_amc::FCascdel&   cascdel_bt_child_btree_rcurs_Access(cascdel_bt_child_btree_rcurs &curs);
 void                 FCascdel_Uninit(atf_amc::FCascdel& cascdel) __attribute__((nothrow));
 // print string representation of atf_amc::FCascdel to string LHS, no header -- cprint:atf_amc.FCascdel.String
 void                 FCascdel_Print(atf_amc::FCascdel & row, algo::cstring &str) __attribute__((nothrow));
 
+// --- atf_amc.FColrow
+// create: atf_amc.FDb.colrow (Lary)
+struct FColrow { // atf_amc.FColrow: Lary row with some fields stored as columns
+    i32                rowid;    //   0  Row id, indexes the columns
+    algo::Smallstr50   key;      // Row payload
+    double             weight;   //   0.0  Stored in the row
+    double&            price;    //   0.0  Stored in a column (column)
+    i32&               qty;      //   1  Stored in a column (column)
+private:
+    friend atf_amc::FColrow&    colrow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend atf_amc::FColrow*    colrow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 colrow_RemoveAll() __attribute__((nothrow));
+    friend void                 colrow_RemoveLast() __attribute__((nothrow));
+    FColrow();
+    // column storage of atf_amc.FColrow.price prevents copy
+    // column storage of atf_amc.FColrow.qty prevents copy
+    FColrow(const FColrow&); // disallow copy constructor (not defined)
+    void operator =(const FColrow&){ /*disallow direct assignment */}
+};
+
+// Set all fields to initial values.
+void                 FColrow_Init(atf_amc::FColrow& colrow);
+
 // --- atf_amc.FCstring
 // create: atf_amc.FDb.cstring (Lary)
 // global access: ind_cstring (Thash)
@@ -1262,90 +1389,147 @@ void                 trace_Print(atf_amc::trace & row, algo::cstring &str) __att
 // --- atf_amc.FDb
 // create: atf_amc.FDb._db (Global)
 struct FDb { // atf_amc.FDb
-    command::atf_amc         cmdline;                                          //
-    atf_amc::FTypeC**        bh_typec_elems;                                   // binary heap by typec
-    i32                      bh_typec_n;                                       // number of elements in the heap
-    i32                      bh_typec_max;                                     // max elements in bh_typec_elems
-    atf_amc::FTypeC*         zdl_h_typec_head;                                 // zero-terminated doubly linked list
-    i32                      zdl_h_typec_n;                                    // zero-terminated doubly linked list
-    atf_amc::FTypeC*         zdl_h_typec_tail;                                 // pointer to last element
-    atf_amc::FTypeC*         zd_t_typec_head;                                  // zero-terminated doubly linked list
-    i32                      zd_t_typec_n;                                     // zero-terminated doubly linked list
-    atf_amc::FTypeC*         zd_t_typec_tail;                                  // pointer to last element
-    atf_amc::FTypeC*         zsl_h_typec_head;                                 // zero-terminated singly linked list
-    i32                      zsl_h_typec_n;                                    // zero-terminated singly linked list
-    atf_amc::FTypeC*         zsl_h_typec_tail;                                 // pointer to last element
-    atf_amc::FTypeC*         zs_t_typec_head;                                  // zero-terminated singly linked list
-    i32                      zs_t_typec_n;                                     // zero-terminated singly linked list
-    atf_amc::FTypeC*         zs_t_typec_tail;                                  // pointer to last element
-
-    atf_amc::FTypeC*         zs_mt_typec_head;                                 // ZSListMT - zero-terminated singly linked list -- read side
-    atf_amc::FTypeC*         zs_mt_typec_mt;                                   // elements inserted here from another thread -- write side
-    atf_amc::FTypeC*         zdl_hnt_typec_head;                               // zero-terminated doubly linked list
-    i32                      zdl_hnt_typec_n;                                  // zero-terminated doubly linked list
-    atf_amc::FTypeC*         cdl_h_typec_head;                                 // zero-terminated doubly linked list
-    i32                      cdl_h_typec_n;                                    // zero-terminated doubly linked list
-    atf_amc::FTypeC*         cd_t_typec_head;                                  // zero-terminated doubly linked list
-    i32                      cd_t_typec_n;                                     // zero-terminated doubly linked list
-    atf_amc::FTypeC*         csl_h_typec_head;                                 // zero-terminated singly linked list
-    i32                      csl_h_typec_n;                                    // zero-terminated singly linked list
-    atf_amc::FTypeC*         csl_h_typec_tail;                                 // pointer to last element
-    atf_amc::FTypeC*         cs_t_typec_head;                                  // zero-terminated singly linked list
-    i32                      cs_t_typec_n;                                     // zero-terminated singly linked list
-    atf_amc::FTypeC*         cs_t_typec_tail;                                  // pointer to last element
-    atf_amc::FTypeA*         typea_lary[32];                                   // level array
-    i32                      typea_n;                                          // number of elements in array
-    atf_amc::FTypeS*         types_lary[32];                                   // level array
-    i32                      types_n;                                          // number of elements in array
-    atf_amc::FTypeS**        ind_types_buckets_elems;                          // pointer to bucket array
-    i32                      ind_types_buckets_n;                              // number of elements in bucket array
-    i32                      ind_types_n;                                      // number of elements in the hash table
-    atf_amc::FTypeA**        ind_typea_buckets_elems;                          // pointer to bucket array
-    i32                      ind_typea_buckets_n;                              // number of elements in bucket array
-    i32                      ind_typea_n;                                      // number of elements in the hash table
-    i32                      cs_h_count;                                       //   0  FirstChanged trigger fire count
-    i32                      cs_t_count;                                       //   0  FirstChanged trigger fire count
-    i32                      zs_h_count;                                       //   0  FirstChanged trigger fire count
-    i32                      zs_t_count;                                       //   0  FirstChanged trigger fire count
-    i32                      zs_mt_count;                                      //   0  FirstChanged trigger fire count
-    i32                      bh_count;                                         //   0  FirstChanged trigger fire count
-    atf_amc::FTypeT*         typet_lary[32];                                   // level array
-    i32                      typet_n;                                          // number of elements in array
-    atf_amc::FCstring*       cstring_lary[32];                                 // level array
-    i32                      cstring_n;                                        // number of elements in array
-    atf_amc::FCstring**      ind_cstring_buckets_elems;                        // pointer to bucket array
-    i32                      ind_cstring_buckets_n;                            // number of elements in bucket array
-    i32                      ind_cstring_n;                                    // number of elements in the hash table
-    atf_amc::Msgbuf*         cd_in_msg_head;                                   // zero-terminated doubly linked list
-    u32                      typeb_blocksize;                                  // # bytes per block
-    atf_amc::FTypeB*         typeb_free;                                       //
-    u32                      pooledbe64_blocksize;                             // # bytes per block
-    atf_amc::PooledBE64*     pooledbe64_free;                                  //
-    i64                      varlen_extern_n;                                  // Number of elements
-    varlen_extern_Lpblock*   varlen_extern_free[31];                           // Lpool levels
-    atf_amc::FAmctest*       amctest_lary[32];                                 // level array
-    i32                      amctest_n;                                        // number of elements in array
-    u32                      cascdel_blocksize;                                // # bytes per block
-    atf_amc::FCascdel*       cascdel_free;                                     //
-    algo_lib::Bitset         cascdel_check;                                    // Bitset of FCascdel records in existence
-    u32                      cascdel_next_key;                                 //   0  Next sequence number for FCascdel record
-    i64                      optalloc_n;                                       // Number of elements
-    optalloc_Lpblock*        optalloc_free[31];                                // Lpool levels
-    i64                      varlenalloc_n;                                    // Number of elements
-    varlenalloc_Lpblock*     varlenalloc_free[31];                             // Lpool levels
-    i64                      optg_n;                                           // Number of elements
-    optg_Lpblock*            optg_free[31];                                    // Lpool levels
-    atf_amc::FTypeK**        c_typek_elems;                                    // array of pointers
-    u32                      c_typek_n;                                        // array of pointers
-    u32                      c_typek_max;                                      // capacity of allocated array
-    atf_amc::FAvl*           avl_lary[32];                                     // level array
-    i32                      avl_n;                                            // number of elements in array
-    atf_amc::FAvl*           tr_avl_root;                                      // Root of the tree
-    i32                      tr_avl_n;                                         // number of elements in the tree
-    u128                     listtype_data[sizeu128(atf_amc::FListtype,10)];   // place for data
-    i32                      listtype_n;                                       // number of elems current in existence
+    command::atf_amc           cmdline;                                          //
+    atf_amc::FTypeC**          bh_typec_elems;                                   // binary heap by typec
+    i32                        bh_typec_n;                                       // number of elements in the heap
+    i32                        bh_typec_max;                                     // max elements in bh_typec_elems
+    atf_amc::FTypeC*           zdl_h_typec_head;                                 // zero-terminated doubly linked list
+    i32                        zdl_h_typec_n;                                    // zero-terminated doubly linked list
+    atf_amc::FTypeC*           zdl_h_typec_tail;                                 // pointer to last element
+    atf_amc::FTypeC*           zd_t_typec_head;                                  // zero-terminated doubly linked list
+    i32                        zd_t_typec_n;                                     // zero-terminated doubly linked list
+    atf_amc::FTypeC*           zd_t_typec_tail;                                  // pointer to last element
+    atf_amc::FTypeC*           zsl_h_typec_head;                                 // zero-terminated singly linked list
+    i32                        zsl_h_typec_n;                                    // zero-terminated singly linked list
+    atf_amc::FTypeC*           zsl_h_typec_tail;                                 // pointer to last element
+    atf_amc::FTypeC*           zs_t_typec_head;                                  // zero-terminated singly linked list
+    i32                        zs_t_typec_n;                                     // zero-terminated singly linked list
+    atf_amc::FTypeC*           zs_t_typec_tail;                                  // pointer to last element
+
+    atf_amc::FTypeC*           zs_mt_typec_head;                                 // ZSListMT - zero-terminated singly linked list -- read side
+    atf_amc::FTypeC*           zs_mt_typec_mt;                                   // elements inserted here from another thread -- write side
+    atf_amc::FTypeC*           zdl_hnt_typec_head;                               // zero-terminated doubly linked list
+    i32                        zdl_hnt_typec_n;                                  // zero-terminated doubly linked list
+    atf_amc::FTypeC*           cdl_h_typec_head;                                 // zero-terminated doubly linked list
+    i32                        cdl_h_typec_n;                                    // zero-terminated doubly linked list
+    atf_amc::FTypeC*           cd_t_typec_head;                                  // zero-terminated doubly linked list
+    i32                        cd_t_typec_n;                                     // zero-terminated doubly linked list
+    atf_amc::FTypeC*           csl_h_typec_head;                                 // zero-terminated singly linked list
+    i32                        csl_h_typec_n;                                    // zero-terminated singly linked list
+    atf_amc::FTypeC*           csl_h_typec_tail;                                 // pointer to last element
+    atf_amc::FTypeC*           cs_t_typec_head;                                  // zero-terminated singly linked list
+    i32                        cs_t_typec_n;                                     // zero-terminated singly linked list
+    atf_amc::FTypeC*           cs_t_typec_tail;                                  // pointer to last element
+    atf_amc::FTypeA*           typea_lary[32];                                   // level array
+    i32                        typea_n;                                          // number of elements in array
+    atf_amc::FTypeS*           types_lary[32];                                   // level array
+    i32                        types_n;                                          // number of elements in array
+    atf_amc::FTypeS**          ind_types_buckets_elems;                          // pointer to bucket array
+    i32                        ind_types_buckets_n;                              // number of elements in bucket array
+    i32                        ind_types_n;                                      // number of elements in the hash table
+    atf_amc::FTypeA**          ind_typea_buckets_elems;                          // pointer to bucket array
+    i32                        ind_typea_buckets_n;                              // number of elements in bucket array
+    i32                        ind_typea_n;                                      // number of elements in the hash table
+    i32                        cs_h_count;                                       //   0  FirstChanged trigger fire count
+    i32                        cs_t_count;                                       //   0  FirstChanged trigger fire count
+    i32                        zs_h_count;                                       //   0  FirstChanged trigger fire count
+    i32                        zs_t_count;                                       //   0  FirstChanged trigger fire count
+    i32                        zs_mt_count;                                      //   0  FirstChanged trigger fire count
+    i32                        bh_count;                                         //   0  FirstChanged trigger fire count
+    atf_amc::FTypeT*           typet_lary[32];                                   // level array
+    i32                        typet_n;                                          // number of elements in array
+    atf_amc::FCstring*         cstring_lary[32];                                 // level array
+    i32                        cstring_n;                                        // number of elements in array
+    atf_amc::FCstring**        ind_cstring_buckets_elems;                        // pointer to bucket array
+    i32                        ind_cstring_buckets_n;                            // number of elements in bucket array
+    i32                        ind_cstring_n;                                    // number of elements in the hash table
+    atf_amc::Msgbuf*           cd_in_msg_head;                                   // zero-terminated doubly linked list
+    u32                        typeb_blocksize;                                  // # bytes per block
+    atf_amc::FTypeB*           typeb_free;                                       //
+    u32                        pooledbe64_blocksize;                             // # bytes per block
+    atf_amc::PooledBE64*       pooledbe64_free;                                  //
+    i64                        varlen_extern_n;                                  // Number of elements
+    varlen_extern_Lpblock*     varlen_extern_free[31];                           // Lpool levels
+    atf_amc::FAmctest*         amctest_lary[32];                                 // level array
+    i32                        amctest_n;                                        // number of elements in array
+    u32                        cascdel_blocksize;                                // # bytes per block
+    atf_amc::FCascdel*         cascdel_free;                                     //
+    algo_lib::Bitset           cascdel_check;                                    // Bitset of FCascdel records in existence
+    u32                        cascdel_next_key;                                 //   0  Next sequence number for FCascdel record
+    i64                        optalloc_n;                                       // Number of elements
+    optalloc_Lpblock*          optalloc_free[31];                                // Lpool levels
+    i64                        varlenalloc_n;                                    // Number of elements
+    varlenalloc_Lpblock*       varlenalloc_free[31];                             // Lpool levels
+    i64                        optg_n;                                           // Number of elements
+    optg_Lpblock*              optg_free[31];                                    // Lpool levels
+    atf_amc::FTypeK**          c_typek_elems;                                    // array of pointers
+    u32                        c_typek_n;                                        // array of pointers
+    u32                        c_typek_max;                                      // capacity of allocated array
+    atf_amc::FAvl*             avl_lary[32];                                     // level array
+    i32                        avl_n;                                            // number of elements in array
+    atf_amc::FAvl*             tr_avl_root;                                      // Root of the tree
+    i32                        tr_avl_n;                                         // number of elements in the tree
+    u128                       listtype_data[sizeu128(atf_amc::FListtype,10)];   // place for data
+    i32                        listtype_n;                                       // number of elems current in existence
     enum { listtype_max = 10 };
-    atf_amc::trace           trace;                                            //
+    atf_amc::FHashrow*         hashrow_lary[32];                                 // level array
+    i32                        hashrow_n;                                        // number of elements in array
+    atf_amc::FHashrow**        ind_hashrow_buckets_elems;                        // pointer to bucket array
+    i32                        ind_hashrow_buckets_n;                            // number of elements in bucket array
+    i32                        ind_hashrow_n;                                    // number of elements in the hash table
+    atf_amc::FHashrow**        ind_hashrow_cached_buckets_elems;                 // pointer to bucket array
+    i32                        ind_hashrow_cached_buckets_n;                     // number of elements in bucket array
+    i32                        ind_hashrow_cached_n;                             // number of elements in the hash table
+    algo::Hashslot*            ind_hashrow_oa_slots_elems;                       // pointer to slot array
+    i32                        ind_hashrow_oa_slots_n;                           // number of elements in slot array
+    i32                        ind_hashrow_oa_n;                                 // number of elements in the hash table
+    atf_amc::FHashrow**        ind_hashrow_incr_buckets_elems;                   // pointer to bucket array
+    i32                        ind_hashrow_incr_buckets_n;                       // number of elements in bucket array
+    i32                        ind_hashrow_incr_n;                               // number of elements in the hash table
+    atf_amc::FHashrow**        ind_hashrow_incr_old_elems;                       // old bucket array during incremental rehash
+    i32                        ind_hashrow_incr_old_n;                           // number of elements in old bucket array
+    i32                        ind_hashrow_incr_old_pos;                         // next old bucket to migrate
+    atf_amc::FTreerow*         treerow_lary[32];                                 // level array
+    i32                        treerow_n;                                        // number of elements in array
+    _db_bt_treerow_node*       bt_treerow_root;                                  // Root node
+    i32                        bt_treerow_n;                                     // Number of elements in the tree
+    atf_amc::FTreerow*         tr_treerow_root;                                  // Root of the tree
+    i32                        tr_treerow_n;                                     // number of elements in the tree
+    atf_amc::FColrow*          colrow_lary[32];                                  // level array
+    i32                        colrow_n;                                         // number of elements in array
+    double*                    colrow_price_lary[32];                            // level array for column price
+    i32*                       colrow_qty_lary[32];                              // level array for column qty
+    atf_amc::FHeaprow*         heaprow_lary[32];                                 // level array
+    i32                        heaprow_n;                                        // number of elements in array
+    atf_amc::FHeaprow**        bh_heaprow_elems;                                 // binary heap by key
+    i32                        bh_heaprow_n;                                     // number of elements in the heap
+    i32                        bh_heaprow_max;                                   // max elements in bh_heaprow_elems
+    _db_bh_heaprow_inl_elem*   bh_heaprow_inl_elems;                             // 4-ary heap by key
+    i32                        bh_heaprow_inl_n;                                 // number of elements in the heap
+    i32                        bh_heaprow_inl_max;                               // max elements in bh_heaprow_inl_elems
+    atf_amc::FHeaprow**        bh_heaprow_ptr_elems;                             // 8-ary heap by key
+    i32                        bh_heaprow_ptr_n;                                 // number of elements in the heap
+    i32                        bh_heaprow_ptr_max;                               // max elements in bh_heaprow_ptr_elems
+    u32                        magrow_blocksize;                                 // # bytes per block
+    atf_amc::FMagrow*          magrow_free;                                      //
+    pthread_mutex_t            magrow_lock;                                      // Protects magrow_free in multi-threaded use
+    u64                        magrow_n_maghit;                                  // Allocations served from per-thread magazines
+    u64                        magrow_n_refill;                                  // Number of magazine refills from shared free list
+    u64                        magrow_n_spill;                                   // Number of magazine spills to shared free list
+    maglpool_Lpblock*          maglpool_free[31];                                // Lpool levels
+    pthread_mutex_t            maglpool_lock;                                    // Protects maglpool_free in multi-threaded use
+    u64                        maglpool_n_maghit;                                // Allocations served from per-thread magazines
+    u64                        maglpool_n_refill;                                // Number of magazine refills from shared free lists
+    u64                        maglpool_n_spill;                                 // Number of magazine spills to shared free lists
+    atf_amc::FHugerow*         hugerow_lary[32];                                 // level array
+    i32                        hugerow_n;                                        // number of elements in array
+    atf_amc::FHugerow**        ind_hugerow_buckets_elems;                        // pointer to bucket array
+    i32                        ind_hugerow_buckets_n;                            // number of elements in bucket array
+    i32                        ind_hugerow_n;                                    // number of elements in the hash table
+    atf_amc::FHugerow**        ind_hugerow_thp_buckets_elems;                    // pointer to bucket array
+    i32                        ind_hugerow_thp_buckets_n;                        // number of elements in bucket array
+    i32                        ind_hugerow_thp_n;                                // number of elements in the hash table
+    atf_amc::trace             trace;                                            //
 };
 
 // Remove all elements from heap and free memory used by the array.
@@ -1762,6 +1946,8 @@ void                 StaticCheck();
 // Parse strptr into known type and add to database.
 // Return value is true unless an error occurs. If return value is false, algo_lib::_db.errtext has error text
 bool                 InsertStrptrMaybe(algo::strptr str);
+// Insert row image from binary input snapshot.
+bool                 InsertSnapMaybe(i32 table_id, algo::memptr row);
 // Load all finputs from given directory.
 bool                 LoadTuplesMaybe(algo::strptr root) __attribute__((nothrow));
 // Load specified ssimfile.
@@ -2210,6 +2396,437 @@ u64                  listtype_rowid_Get(atf_amc::FListtype &row) __attribute__((
 // in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
 bool                 listtype_XrefMaybe(atf_amc::FListtype &row);
 
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FHashrow&   hashrow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FHashrow*   hashrow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+// Allocate space for one element. If no memory available, return NULL.
+void*                hashrow_AllocMem() __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 hashrow_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_amc::FHashrow*   hashrow_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+atf_amc::FHashrow*   hashrow_Last() __attribute__((nothrow, pure));
+// Return number of items in the pool
+i32                  hashrow_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove all elements from Lary
+void                 hashrow_RemoveAll() __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 hashrow_RemoveLast() __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+atf_amc::FHashrow&   hashrow_qFind(u64 t) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 hashrow_XrefMaybe(atf_amc::FHashrow &row);
+
+// Return true if hash is empty
+bool                 ind_hashrow_EmptyQ() __attribute__((nothrow));
+// Find row by key. Return NULL if not found.
+atf_amc::FHashrow*   ind_hashrow_Find(const algo::strptr& key) __attribute__((__warn_unused_result__, nothrow));
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHashrow&   ind_hashrow_GetOrCreate(const algo::strptr& key) __attribute__((nothrow));
+// Return number of items in the hash
+i32                  ind_hashrow_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool                 ind_hashrow_InsertMaybe(atf_amc::FHashrow& row) __attribute__((nothrow));
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void                 ind_hashrow_Remove(atf_amc::FHashrow& row) __attribute__((nothrow));
+// Reserve enough room in the hash for N more elements. Return success code.
+void                 ind_hashrow_Reserve(int n) __attribute__((nothrow));
+
+// Return true if hash is empty
+bool                 ind_hashrow_cached_EmptyQ() __attribute__((nothrow));
+// Find row by key. Return NULL if not found.
+atf_amc::FHashrow*   ind_hashrow_cached_Find(const algo::strptr& key) __attribute__((__warn_unused_result__, nothrow));
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHashrow&   ind_hashrow_cached_GetOrCreate(const algo::strptr& key) __attribute__((nothrow));
+// Return number of items in the hash
+i32                  ind_hashrow_cached_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool                 ind_hashrow_cached_InsertMaybe(atf_amc::FHashrow& row) __attribute__((nothrow));
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void                 ind_hashrow_cached_Remove(atf_amc::FHashrow& row) __attribute__((nothrow));
+// Reserve enough room in the hash for N more elements. Return success code.
+void                 ind_hashrow_cached_Reserve(int n) __attribute__((nothrow));
+
+// Return true if hash is empty
+bool                 ind_hashrow_oa_EmptyQ() __attribute__((nothrow));
+// Find row by key. Return NULL if not found.
+atf_amc::FHashrow*   ind_hashrow_oa_Find(const algo::strptr& key) __attribute__((__warn_unused_result__, nothrow));
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHashrow&   ind_hashrow_oa_GetOrCreate(const algo::strptr& key) __attribute__((nothrow));
+// Return number of items in the hash
+i32                  ind_hashrow_oa_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool                 ind_hashrow_oa_InsertMaybe(atf_amc::FHashrow& row) __attribute__((nothrow));
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void                 ind_hashrow_oa_Remove(atf_amc::FHashrow& row) __attribute__((nothrow));
+// Reserve enough room in the hash for N more elements. Return success code.
+void                 ind_hashrow_oa_Reserve(int n) __attribute__((nothrow));
+
+// Return true if hash is empty
+bool                 ind_hashrow_incr_EmptyQ() __attribute__((nothrow));
+// Find row by key. Return NULL if not found.
+atf_amc::FHashrow*   ind_hashrow_incr_Find(const algo::strptr& key) __attribute__((__warn_unused_result__, nothrow));
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHashrow&   ind_hashrow_incr_GetOrCreate(const algo::strptr& key) __attribute__((nothrow));
+// Return number of items in the hash
+i32                  ind_hashrow_incr_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool                 ind_hashrow_incr_InsertMaybe(atf_amc::FHashrow& row) __attribute__((nothrow));
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void                 ind_hashrow_incr_Remove(atf_amc::FHashrow& row) __attribute__((nothrow));
+// Reserve enough room in the hash for N more elements. Return success code.
+void                 ind_hashrow_incr_Reserve(int n) __attribute__((nothrow));
+// Incremental rehash: migrate up to N buckets from old bucket array to new one
+void                 ind_hashrow_incr_Rehash(int n) __attribute__((nothrow));
+
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FTreerow&   treerow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FTreerow*   treerow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+// Allocate space for one element. If no memory available, return NULL.
+void*                treerow_AllocMem() __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 treerow_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_amc::FTreerow*   treerow_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+atf_amc::FTreerow*   treerow_Last() __attribute__((nothrow, pure));
+// Return number of items in the pool
+i32                  treerow_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove all elements from Lary
+void                 treerow_RemoveAll() __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 treerow_RemoveLast() __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+atf_amc::FTreerow&   treerow_qFind(u64 t) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 treerow_XrefMaybe(atf_amc::FTreerow &row);
+
+// Return true if index is empty
+bool                 bt_treerow_EmptyQ() __attribute__((__warn_unused_result__, nothrow));
+// Return first row whose key is equal to VAL, or NULL if not found
+atf_amc::FTreerow*   bt_treerow_Find(u64 val) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to the first(smallest) element in the tree
+atf_amc::FTreerow*   bt_treerow_First() __attribute__((__warn_unused_result__, nothrow));
+// Insert row into the tree. If row is already in the tree, do nothing.
+void                 bt_treerow_Insert(atf_amc::FTreerow& row) __attribute__((nothrow));
+// Return true if row is in the tree, false otherwise
+bool                 bt_treerow_InTreeQ(atf_amc::FTreerow& row) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to the last(largest) element in tree
+atf_amc::FTreerow*   bt_treerow_Last() __attribute__((__warn_unused_result__, nothrow));
+// Return first row whose key is >= VAL, or NULL
+atf_amc::FTreerow*   bt_treerow_LowerBound(u64 val) __attribute__((__warn_unused_result__, nothrow));
+// Return number of elements in the tree
+i32                  bt_treerow_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Reinsert a row with modified key
+void                 bt_treerow_Reinsert(atf_amc::FTreerow& row) __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 bt_treerow_Remove(atf_amc::FTreerow& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 bt_treerow_RemoveAll() __attribute__((nothrow));
+// If the tree is empty, return NULL. Otherwise unlink and return pointer to first element.
+atf_amc::FTreerow*   bt_treerow_RemoveFirst() __attribute__((nothrow));
+
+// Return true if index is empty
+bool                 tr_treerow_EmptyQ() __attribute__((__warn_unused_result__, nothrow));
+atf_amc::FTreerow*   tr_treerow_FirstImpl(atf_amc::FTreerow* root) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to the first(smallest) element in the tree
+atf_amc::FTreerow*   tr_treerow_First() __attribute__((__warn_unused_result__, nothrow));
+// Return true if row is in the tree, false otherwise
+bool                 tr_treerow_InTreeQ(atf_amc::FTreerow& row) __attribute__((__warn_unused_result__, nothrow));
+// Insert row into the tree. If row is already in the tree, do nothing.
+void                 tr_treerow_InsertImpl(atf_amc::FTreerow* parent, atf_amc::FTreerow& row) __attribute__((nothrow));
+// Insert row into the tree. If row is already in the tree, do nothing.
+void                 tr_treerow_Insert(atf_amc::FTreerow& row) __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 tr_treerow_Remove(atf_amc::FTreerow& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 tr_treerow_RemoveAll() __attribute__((nothrow));
+// If the tree is empty, return NULL. Otherwise unlink and return pointer to first element.
+void                 tr_treerow_RemoveFirst() __attribute__((nothrow));
+i32                  tr_treerow_Balance(atf_amc::FTreerow& row) __attribute__((nothrow));
+// Recalculate depth and keep rebalancing if needed
+atf_amc::FTreerow*   tr_treerow_Propagate(atf_amc::FTreerow& pnode) __attribute__((nothrow));
+// Rebalances the node if needed.
+void                 tr_treerow_Rebalance(atf_amc::FTreerow& node) __attribute__((nothrow));
+atf_amc::FTreerow*   tr_treerow_Next(atf_amc::FTreerow& node) __attribute__((__warn_unused_result__, nothrow));
+atf_amc::FTreerow*   tr_treerow_Prev(atf_amc::FTreerow& node) __attribute__((__warn_unused_result__, nothrow));
+atf_amc::FTreerow*   tr_treerow_LastImpl(atf_amc::FTreerow* root) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to the last(largest) element in tree
+atf_amc::FTreerow*   tr_treerow_Last() __attribute__((__warn_unused_result__, nothrow));
+// Empty the index. (rows may be deleted if cascdel)
+void                 tr_treerow_RemoveAllImpl(atf_amc::FTreerow* root, bool del) __attribute__((nothrow));
+// Reinsert a row with modified key(Reheap semantics)
+void                 tr_treerow_Reinsert(atf_amc::FTreerow& node) __attribute__((nothrow));
+// Find the first element that is greater or equal to a sortfld value
+atf_amc::FTreerow*   tr_treerow_FirstGe(const u64& val) __attribute__((nothrow));
+// Find the last element that is smaller or equal to a sortfld value
+atf_amc::FTreerow*   tr_treerow_LastLt(const u64& val) __attribute__((nothrow));
+
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FColrow&    colrow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FColrow*    colrow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+// Allocate space for one element. If no memory available, return NULL.
+void*                colrow_AllocMem() __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 colrow_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_amc::FColrow*    colrow_Find(i32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+atf_amc::FColrow*    colrow_Last() __attribute__((nothrow, pure));
+// Return number of items in the pool
+i32                  colrow_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove all elements from Lary
+void                 colrow_RemoveAll() __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 colrow_RemoveLast() __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+atf_amc::FColrow&    colrow_qFind(i32 t) __attribute__((nothrow));
+// 'quick' Access value of column price by row id. No bounds checking.
+double&              colrow_price_qFind(i32 t);
+// 'quick' Access value of column qty by row id. No bounds checking.
+i32&                 colrow_qty_qFind(i32 t);
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 colrow_XrefMaybe(atf_amc::FColrow &row);
+
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FHeaprow&   heaprow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FHeaprow*   heaprow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+// Allocate space for one element. If no memory available, return NULL.
+void*                heaprow_AllocMem() __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 heaprow_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_amc::FHeaprow*   heaprow_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+atf_amc::FHeaprow*   heaprow_Last() __attribute__((nothrow, pure));
+// Return number of items in the pool
+i32                  heaprow_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove all elements from Lary
+void                 heaprow_RemoveAll() __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 heaprow_RemoveLast() __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+atf_amc::FHeaprow&   heaprow_qFind(u64 t) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 heaprow_XrefMaybe(atf_amc::FHeaprow &row);
+
+// Remove all elements from heap and free memory used by the array.
+void                 bh_heaprow_Dealloc() __attribute__((nothrow));
+// Return true if index is empty
+bool                 bh_heaprow_EmptyQ() __attribute__((nothrow));
+// If index empty, return NULL. Otherwise return pointer to first element in index
+atf_amc::FHeaprow*   bh_heaprow_First() __attribute__((__warn_unused_result__, nothrow, pure));
+// Return true if row is in index, false otherwise
+bool                 bh_heaprow_InBheapQ(atf_amc::FHeaprow& row) __attribute__((__warn_unused_result__, nothrow));
+// Insert row. Row must not already be in index. If row is already in index, do nothing.
+void                 bh_heaprow_Insert(atf_amc::FHeaprow& row) __attribute__((nothrow));
+// Return number of items in the heap
+i32                  bh_heaprow_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// If row is in heap, update its position. If row is not in heap, insert it.
+// Return new position of item in the heap (0=top)
+i32                  bh_heaprow_Reheap(atf_amc::FHeaprow& row) __attribute__((nothrow));
+// Key of first element in the heap changed. Move it.
+// This function does not check the insert condition.
+// Return new position of item in the heap (0=top).
+// Heap must be non-empty or behavior is undefined.
+i32                  bh_heaprow_ReheapFirst() __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 bh_heaprow_Remove(atf_amc::FHeaprow& row) __attribute__((nothrow));
+// Remove all elements from binary heap
+void                 bh_heaprow_RemoveAll() __attribute__((nothrow));
+// If index is empty, return NULL. Otherwise remove and return first key in index.
+//  Call 'head changed' trigger.
+atf_amc::FHeaprow*   bh_heaprow_RemoveFirst() __attribute__((nothrow));
+// Reserve space in index for N more elements
+void                 bh_heaprow_Reserve(int n) __attribute__((nothrow));
+void                 _db_bh_heaprow_unordcurs_Reset(_db_bh_heaprow_unordcurs &unordcurs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_bh_heaprow_unordcurs_ValidQ(_db_bh_heaprow_unordcurs &unordcurs);
+// proceed to next item
+void                 _db_bh_heaprow_unordcurs_Next(_db_bh_heaprow_unordcurs &unordcurs);
+// item access
+atf_amc::FHeaprow&   _db_bh_heaprow_unordcurs_Access(_db_bh_heaprow_unordcurs &unordcurs);
+
+// Remove all elements from heap and free memory used by the array.
+void                 bh_heaprow_inl_Dealloc() __attribute__((nothrow));
+// Return true if index is empty
+bool                 bh_heaprow_inl_EmptyQ() __attribute__((nothrow));
+// If index empty, return NULL. Otherwise return pointer to first element in index
+atf_amc::FHeaprow*   bh_heaprow_inl_First() __attribute__((__warn_unused_result__, nothrow, pure));
+// Return true if row is in index, false otherwise
+bool                 bh_heaprow_inl_InBheapQ(atf_amc::FHeaprow& row) __attribute__((__warn_unused_result__, nothrow));
+// Insert row. Row must not already be in index. If row is already in index, do nothing.
+void                 bh_heaprow_inl_Insert(atf_amc::FHeaprow& row) __attribute__((nothrow));
+// Return number of items in the heap
+i32                  bh_heaprow_inl_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// If row is in heap, update its position. If row is not in heap, insert it.
+// Return new position of item in the heap (0=top)
+i32                  bh_heaprow_inl_Reheap(atf_amc::FHeaprow& row) __attribute__((nothrow));
+// Key of first element in the heap changed. Move it.
+// This function does not check the insert condition.
+// Return new position of item in the heap (0=top).
+// Heap must be non-empty or behavior is undefined.
+i32                  bh_heaprow_inl_ReheapFirst() __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 bh_heaprow_inl_Remove(atf_amc::FHeaprow& row) __attribute__((nothrow));
+// Remove all elements from binary heap
+void                 bh_heaprow_inl_RemoveAll() __attribute__((nothrow));
+// If index is empty, return NULL. Otherwise remove and return first key in index.
+//  Call 'head changed' trigger.
+atf_amc::FHeaprow*   bh_heaprow_inl_RemoveFirst() __attribute__((nothrow));
+// Reserve space in index for N more elements
+void                 bh_heaprow_inl_Reserve(int n) __attribute__((nothrow));
+void                 _db_bh_heaprow_inl_unordcurs_Reset(_db_bh_heaprow_inl_unordcurs &unordcurs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_bh_heaprow_inl_unordcurs_ValidQ(_db_bh_heaprow_inl_unordcurs &unordcurs);
+// proceed to next item
+void                 _db_bh_heaprow_inl_unordcurs_Next(_db_bh_heaprow_inl_unordcurs &unordcurs);
+// item access
+atf_amc::FHeaprow&   _db_bh_heaprow_inl_unordcurs_Access(_db_bh_heaprow_inl_unordcurs &unordcurs);
+
+// Remove all elements from heap and free memory used by the array.
+void                 bh_heaprow_ptr_Dealloc() __attribute__((nothrow));
+// Return true if index is empty
+bool                 bh_heaprow_ptr_EmptyQ() __attribute__((nothrow));
+// If index empty, return NULL. Otherwise return pointer to first element in index
+atf_amc::FHeaprow*   bh_heaprow_ptr_First() __attribute__((__warn_unused_result__, nothrow, pure));
+// Return true if row is in index, false otherwise
+bool                 bh_heaprow_ptr_InBheapQ(atf_amc::FHeaprow& row) __attribute__((__warn_unused_result__, nothrow));
+// Insert row. Row must not already be in index. If row is already in index, do nothing.
+void                 bh_heaprow_ptr_Insert(atf_amc::FHeaprow& row) __attribute__((nothrow));
+// Return number of items in the heap
+i32                  bh_heaprow_ptr_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// If row is in heap, update its position. If row is not in heap, insert it.
+// Return new position of item in the heap (0=top)
+i32                  bh_heaprow_ptr_Reheap(atf_amc::FHeaprow& row) __attribute__((nothrow));
+// Key of first element in the heap changed. Move it.
+// This function does not check the insert condition.
+// Return new position of item in the heap (0=top).
+// Heap must be non-empty or behavior is undefined.
+i32                  bh_heaprow_ptr_ReheapFirst() __attribute__((nothrow));
+// Remove element from index. If element is not in index, do nothing.
+void                 bh_heaprow_ptr_Remove(atf_amc::FHeaprow& row) __attribute__((nothrow));
+// Remove all elements from binary heap
+void                 bh_heaprow_ptr_RemoveAll() __attribute__((nothrow));
+// If index is empty, return NULL. Otherwise remove and return first key in index.
+//  Call 'head changed' trigger.
+atf_amc::FHeaprow*   bh_heaprow_ptr_RemoveFirst() __attribute__((nothrow));
+// Reserve space in index for N more elements
+void                 bh_heaprow_ptr_Reserve(int n) __attribute__((nothrow));
+
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FMagrow&    magrow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FMagrow*    magrow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+// Remove row from all global and cross indices, then deallocate row
+void                 magrow_Delete(atf_amc::FMagrow &row) __attribute__((nothrow));
+// Allocate space for one element
+// If no memory available, return NULL.
+// Thread-safe: element is taken from the calling thread's magazine.
+void*                magrow_AllocMem() __attribute__((__warn_unused_result__, nothrow));
+// Remove mem from all global and cross indices, then deallocate mem
+// Thread-safe: element goes to the calling thread's magazine.
+void                 magrow_FreeMem(atf_amc::FMagrow &row) __attribute__((nothrow));
+// Preallocate memory for N more elements
+// Return number of elements actually reserved.
+u64                  magrow_Reserve(u64 n_elems) __attribute__((nothrow));
+// Allocate block of given size, break up into small elements and append to free list.
+// Return number of elements reserved.
+u64                  magrow_ReserveMem(u64 size) __attribute__((nothrow));
+// Return elements cached by the calling thread to the shared free list
+// A thread should call this before exiting; otherwise its cached elements are lost.
+void                 magrow_FlushMag() __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 magrow_XrefMaybe(atf_amc::FMagrow &row);
+
+// Free block of memory previously returned by Lpool.
+// Thread-safe: small blocks go to the calling thread's magazine.
+void                 maglpool_FreeMem(void *mem, u64 size) __attribute__((nothrow));
+// Allocate new piece of memory at least SIZE bytes long.
+// If not successful, return NULL
+// The allocated block is 16-byte aligned
+// Thread-safe: small blocks come from the calling thread's magazine.
+void*                maglpool_AllocMem(u64 size) __attribute__((__warn_unused_result__, nothrow));
+// Add N buffers of some size to the free store
+bool                 maglpool_ReserveBuffers(int nbuf, u64 bufsize) __attribute__((nothrow));
+// Allocate new block, copy old to new, delete old.
+// New memory is always allocated (i.e. size reduction is not a no-op)
+// If no memory, return NULL: old memory untouched
+void*                maglpool_ReallocMem(void *oldmem, u64 old_size, u64 new_size) __attribute__((nothrow));
+// Return blocks cached by the calling thread to the shared free lists
+// A thread should call this before exiting; otherwise its cached blocks are lost.
+void                 maglpool_FlushMag() __attribute__((nothrow));
+
+// Allocate memory for new default row.
+// If out of memory, process is killed.
+atf_amc::FHugerow&   hugerow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+// Allocate memory for new element. If out of memory, return NULL.
+atf_amc::FHugerow*   hugerow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+// Allocate space for one element. If no memory available, return NULL.
+void*                hugerow_AllocMem() __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 hugerow_EmptyQ() __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_amc::FHugerow*   hugerow_Find(u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+atf_amc::FHugerow*   hugerow_Last() __attribute__((nothrow, pure));
+// Return number of items in the pool
+i32                  hugerow_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove all elements from Lary
+void                 hugerow_RemoveAll() __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 hugerow_RemoveLast() __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+atf_amc::FHugerow&   hugerow_qFind(u64 t) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 hugerow_XrefMaybe(atf_amc::FHugerow &row);
+
+// Return true if hash is empty
+bool                 ind_hugerow_EmptyQ() __attribute__((nothrow));
+// Find row by key. Return NULL if not found.
+atf_amc::FHugerow*   ind_hugerow_Find(u64 key) __attribute__((__warn_unused_result__, nothrow));
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHugerow&   ind_hugerow_GetOrCreate(u64 key) __attribute__((nothrow));
+// Return number of items in the hash
+i32                  ind_hugerow_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool                 ind_hugerow_InsertMaybe(atf_amc::FHugerow& row) __attribute__((nothrow));
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void                 ind_hugerow_Remove(atf_amc::FHugerow& row) __attribute__((nothrow));
+// Reserve enough room in the hash for N more elements. Return success code.
+void                 ind_hugerow_Reserve(int n) __attribute__((nothrow));
+
+// Return true if hash is empty
+bool                 ind_hugerow_thp_EmptyQ() __attribute__((nothrow));
+// Find row by key. Return NULL if not found.
+atf_amc::FHugerow*   ind_hugerow_thp_Find(u64 key) __attribute__((__warn_unused_result__, nothrow));
+// Find row by key. If not found, create and x-reference a new row with with this key.
+atf_amc::FHugerow&   ind_hugerow_thp_GetOrCreate(u64 key) __attribute__((nothrow));
+// Return number of items in the hash
+i32                  ind_hugerow_thp_N() __attribute__((__warn_unused_result__, nothrow, pure));
+// Insert row into hash table. Return true if row is reachable through the hash after the function completes.
+bool                 ind_hugerow_thp_InsertMaybe(atf_amc::FHugerow& row) __attribute__((nothrow));
+// Remove reference to element from hash index. If element is not in hash, do nothing
+void                 ind_hugerow_thp_Remove(atf_amc::FHugerow& row) __attribute__((nothrow));
+// Reserve enough room in the hash for N more elements. Return success code.
+void                 ind_hugerow_thp_Reserve(int n) __attribute__((nothrow));
+
 void                 _db_bh_typec_curs_Reserve(_db_bh_typec_curs &curs, int n);
 // Reset cursor. If HEAP is non-empty, add its top element to CURS.
 void                 _db_bh_typec_curs_Reset(_db_bh_typec_curs &curs, atf_amc::FDb &parent);
@@ -2370,10 +2987,234 @@ bool                 _db_listtype_curs_ValidQ(_db_listtype_curs &curs);
 void                 _db_listtype_curs_Next(_db_listtype_curs &curs);
 // item access
 atf_amc::FListtype&  _db_listtype_curs_Access(_db_listtype_curs &curs);
+// cursor points to valid item
+void                 _db_hashrow_curs_Reset(_db_hashrow_curs &curs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_hashrow_curs_ValidQ(_db_hashrow_curs &curs);
+// proceed to next item
+void                 _db_hashrow_curs_Next(_db_hashrow_curs &curs);
+// item access
+atf_amc::FHashrow&   _db_hashrow_curs_Access(_db_hashrow_curs &curs);
+void                 _db_ind_hashrow_curs_Reset(_db_ind_hashrow_curs &curs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_ind_hashrow_curs_ValidQ(_db_ind_hashrow_curs &curs);
+// proceed to next item
+void                 _db_ind_hashrow_curs_Next(_db_ind_hashrow_curs &curs);
+// item access
+atf_amc::FHashrow&   _db_ind_hashrow_curs_Access(_db_ind_hashrow_curs &curs);
+void                 _db_ind_hashrow_oa_curs_Reset(_db_ind_hashrow_oa_curs &curs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_ind_hashrow_oa_curs_ValidQ(_db_ind_hashrow_oa_curs &curs);
+// proceed to next item
+void                 _db_ind_hashrow_oa_curs_Next(_db_ind_hashrow_oa_curs &curs);
+// item access
+atf_amc::FHashrow&   _db_ind_hashrow_oa_curs_Access(_db_ind_hashrow_oa_curs &curs);
+void                 _db_ind_hashrow_incr_curs_Reset(_db_ind_hashrow_incr_curs &curs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_ind_hashrow_incr_curs_ValidQ(_db_ind_hashrow_incr_curs &curs);
+// proceed to next item
+void                 _db_ind_hashrow_incr_curs_Next(_db_ind_hashrow_incr_curs &curs);
+// item access
+atf_amc::FHashrow&   _db_ind_hashrow_incr_curs_Access(_db_ind_hashrow_incr_curs &curs);
+// cursor points to valid item
+void                 _db_treerow_curs_Reset(_db_treerow_curs &curs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_treerow_curs_ValidQ(_db_treerow_curs &curs);
+// proceed to next item
+void                 _db_treerow_curs_Next(_db_treerow_curs &curs);
+// item access
+atf_amc::FTreerow&   _db_treerow_curs_Access(_db_treerow_curs &curs);
+// position cursor at the first row
+void                 _db_bt_treerow_curs_Reset(_db_bt_treerow_curs &curs, atf_amc::FDb& parent);
+// position cursor at the first row with key >= VAL
+void                 _db_bt_treerow_curs_Seek(_db_bt_treerow_curs &curs, atf_amc::FDb& parent, u64 val);
+// cursor points to valid item
+bool                 _db_bt_treerow_curs_ValidQ(_db_bt_treerow_curs &curs);
+// proceed to next item
+void                 _db_bt_treerow_curs_Next(_db_bt_treerow_curs &curs);
+// item access
+atf_amc::FTreerow&   _db_bt_treerow_curs_Access(_db_bt_treerow_curs &curs);
+// position cursor at the last row
+void                 _db_bt_treerow_rcurs_Reset(_db_bt_treerow_rcurs &curs, atf_amc::FDb& parent);
+// position cursor at the last row with key < VAL
+void                 _db_bt_treerow_rcurs_Seek(_db_bt_treerow_rcurs &curs, atf_amc::FDb& parent, u64 val);
+// cursor points to valid item
+bool                 _db_bt_treerow_rcurs_ValidQ(_db_bt_treerow_rcurs &curs);
+// proceed to next item
+void                 _db_bt_treerow_rcurs_Next(_db_bt_treerow_rcurs &curs);
+// item access
+atf_amc::FTreerow&   _db_bt_treerow_rcurs_Access(_db_bt_treerow_rcurs &curs);
+// cursor points to valid item
+void                 _db_tr_treerow_curs_Reset(_db_tr_treerow_curs &curs, atf_amc::FDb& );
+// cursor points to valid item
+bool                 _db_tr_treerow_curs_ValidQ(_db_tr_treerow_curs &curs);
+// proceed to next item
+void                 _db_tr_treerow_curs_Next(_db_tr_treerow_curs &curs);
+// item access
+atf_amc::FTreerow&   _db_tr_treerow_curs_Access(_db_tr_treerow_curs &curs);
+// cursor points to valid item
+void                 _db_colrow_curs_Reset(_db_colrow_curs &curs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_colrow_curs_ValidQ(_db_colrow_curs &curs);
+// proceed to next item
+void                 _db_colrow_curs_Next(_db_colrow_curs &curs);
+// item access
+atf_amc::FColrow&    _db_colrow_curs_Access(_db_colrow_curs &curs);
+// Position cursor at the value of row 0 in column price
+void                 _db_colrow_price_curs_Reset(_db_colrow_price_curs &curs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_colrow_price_curs_ValidQ(_db_colrow_price_curs &curs);
+// proceed to next item
+void                 _db_colrow_price_curs_Next(_db_colrow_price_curs &curs);
+// item access
+double&              _db_colrow_price_curs_Access(_db_colrow_price_curs &curs);
+// Position cursor at the value of row 0 in column qty
+void                 _db_colrow_qty_curs_Reset(_db_colrow_qty_curs &curs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_colrow_qty_curs_ValidQ(_db_colrow_qty_curs &curs);
+// proceed to next item
+void                 _db_colrow_qty_curs_Next(_db_colrow_qty_curs &curs);
+// item access
+i32&                 _db_colrow_qty_curs_Access(_db_colrow_qty_curs &curs);
+// cursor points to valid item
+void                 _db_heaprow_curs_Reset(_db_heaprow_curs &curs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_heaprow_curs_ValidQ(_db_heaprow_curs &curs);
+// proceed to next item
+void                 _db_heaprow_curs_Next(_db_heaprow_curs &curs);
+// item access
+atf_amc::FHeaprow&   _db_heaprow_curs_Access(_db_heaprow_curs &curs);
+void                 _db_bh_heaprow_curs_Reserve(_db_bh_heaprow_curs &curs, int n);
+// Reset cursor. If HEAP is non-empty, add its top element to CURS.
+void                 _db_bh_heaprow_curs_Reset(_db_bh_heaprow_curs &curs, atf_amc::FDb &parent);
+// Advance cursor.
+void                 _db_bh_heaprow_curs_Next(_db_bh_heaprow_curs &curs);
+// Access current element. If not more elements, return NULL
+atf_amc::FHeaprow&   _db_bh_heaprow_curs_Access(_db_bh_heaprow_curs &curs);
+// Return true if Access() will return non-NULL.
+bool                 _db_bh_heaprow_curs_ValidQ(_db_bh_heaprow_curs &curs);
+void                 _db_bh_heaprow_inl_curs_Reserve(_db_bh_heaprow_inl_curs &curs, int n);
+// Reset cursor. If HEAP is non-empty, add its top element to CURS.
+void                 _db_bh_heaprow_inl_curs_Reset(_db_bh_heaprow_inl_curs &curs, atf_amc::FDb &parent);
+// Advance cursor.
+void                 _db_bh_heaprow_inl_curs_Next(_db_bh_heaprow_inl_curs &curs);
+// Access current element. If not more elements, return NULL
+atf_amc::FHeaprow&   _db_bh_heaprow_inl_curs_Access(_db_bh_heaprow_inl_curs &curs);
+// Return true if Access() will return non-NULL.
+bool                 _db_bh_heaprow_inl_curs_ValidQ(_db_bh_heaprow_inl_curs &curs);
+void                 _db_bh_heaprow_ptr_curs_Reserve(_db_bh_heaprow_ptr_curs &curs, int n);
+// Reset cursor. If HEAP is non-empty, add its top element to CURS.
+void                 _db_bh_heaprow_ptr_curs_Reset(_db_bh_heaprow_ptr_curs &curs, atf_amc::FDb &parent);
+// Advance cursor.
+void                 _db_bh_heaprow_ptr_curs_Next(_db_bh_heaprow_ptr_curs &curs);
+// Access current element. If not more elements, return NULL
+atf_amc::FHeaprow&   _db_bh_heaprow_ptr_curs_Access(_db_bh_heaprow_ptr_curs &curs);
+// Return true if Access() will return non-NULL.
+bool                 _db_bh_heaprow_ptr_curs_ValidQ(_db_bh_heaprow_ptr_curs &curs);
+// cursor points to valid item
+void                 _db_hugerow_curs_Reset(_db_hugerow_curs &curs, atf_amc::FDb &parent);
+// cursor points to valid item
+bool                 _db_hugerow_curs_ValidQ(_db_hugerow_curs &curs);
+// proceed to next item
+void                 _db_hugerow_curs_Next(_db_hugerow_curs &curs);
+// item access
+atf_amc::FHugerow&   _db_hugerow_curs_Access(_db_hugerow_curs &curs);
 // Set all fields to initial values.
 void                 FDb_Init();
 void                 FDb_Uninit() __attribute__((nothrow));
 
+// --- atf_amc.FHashrow
+// create: atf_amc.FDb.hashrow (Lary)
+// global access: ind_hashrow (Thash)
+// global access: ind_hashrow_cached (Thash)
+// global access: ind_hashrow_oa (Thash)
+// global access: ind_hashrow_incr (Thash)
+struct FHashrow { // atf_amc.FHashrow: Row indexed by several Thash flavors at once
+    atf_amc::FHashrow*   ind_hashrow_next;             // hash next
+    atf_amc::FHashrow*   ind_hashrow_cached_next;      // hash next
+    u32                  ind_hashrow_cached_hashval;   // hash value
+    bool                 ind_hashrow_oa_in;            // row is in hash
+    atf_amc::FHashrow*   ind_hashrow_incr_next;        // hash next
+    algo::cstring        key;                          // Hash key
+private:
+    friend atf_amc::FHashrow&   hashrow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend atf_amc::FHashrow*   hashrow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 hashrow_RemoveAll() __attribute__((nothrow));
+    friend void                 hashrow_RemoveLast() __attribute__((nothrow));
+    FHashrow();
+    ~FHashrow();
+    FHashrow(const FHashrow&){ /*disallow copy constructor */}
+    void operator =(const FHashrow&){ /*disallow direct assignment */}
+};
+
+// Set all fields to initial values.
+void                 FHashrow_Init(atf_amc::FHashrow& hashrow);
+void                 FHashrow_Uninit(atf_amc::FHashrow& hashrow) __attribute__((nothrow));
+
+// --- atf_amc.FHeaprow
+// create: atf_amc.FDb.heaprow (Lary)
+// global access: bh_heaprow (Bheap)
+// global access: bh_heaprow_inl (Bheap)
+// global access: bh_heaprow_ptr (Bheap)
+struct FHeaprow { // atf_amc.FHeaprow: Row in several Bheap flavors at once
+    i32   bh_heaprow_idx;       // index in heap; -1 means not-in-heap
+    i32   bh_heaprow_inl_idx;   // index in heap; -1 means not-in-heap
+    i32   bh_heaprow_ptr_idx;   // index in heap; -1 means not-in-heap
+    u64   key;                  //   0  Sort key
+private:
+    friend atf_amc::FHeaprow&   heaprow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend atf_amc::FHeaprow*   heaprow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 heaprow_RemoveAll() __attribute__((nothrow));
+    friend void                 heaprow_RemoveLast() __attribute__((nothrow));
+    FHeaprow();
+    ~FHeaprow();
+    FHeaprow(const FHeaprow&){ /*disallow copy constructor */}
+    void operator =(const FHeaprow&){ /*disallow direct assignment */}
+};
+
+// Set all fields to initial values.
+void                 FHeaprow_Init(atf_amc::FHeaprow& heaprow);
+void                 FHeaprow_Uninit(atf_amc::FHeaprow& heaprow) __attribute__((nothrow));
+
+// --- atf_amc.FHugerow
+// create: atf_amc.FDb.hugerow (Lary)
+// global access: ind_hugerow (Thash)
+// global access: ind_hugerow_thp (Thash)
+struct FHugerow { // atf_amc.FHugerow: Row in sbrk memory, for huge page benchmark
+    atf_amc::FHugerow*   ind_hugerow_next;       // hash next
+    atf_amc::FHugerow*   ind_hugerow_thp_next;   // hash next
+    u64                  key;                    //   0  Hash key
+private:
+    friend atf_amc::FHugerow&   hugerow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend atf_amc::FHugerow*   hugerow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 hugerow_RemoveAll() __attribute__((nothrow));
+    friend void                 hugerow_RemoveLast() __attribute__((nothrow));
+    FHugerow();
+    ~FHugerow();
+    FHugerow(const FHugerow&){ /*disallow copy constructor */}
+    void operator =(const FHugerow&){ /*disallow direct assignment */}
+};
+
+// Set all fields to initial values.
+void                 FHugerow_Init(atf_amc::FHugerow& hugerow);
+void                 FHugerow_Uninit(atf_amc::FHugerow& hugerow) __attribute__((nothrow));
+
+// --- atf_amc.FMagrow
+// create: atf_amc.FDb.magrow (Tpool)
+struct FMagrow { // atf_amc.FMagrow: Row allocated from a Tpool with per-thread magazines
+    atf_amc::FMagrow*   magrow_next;   // Pointer to next free element int tpool
+    i32                 owner;         //   0  Index of thread that allocated the row
+    i64                 seq;           //   0  Sequence number within the thread
+private:
+    friend atf_amc::FMagrow&    magrow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend atf_amc::FMagrow*    magrow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 magrow_Delete(atf_amc::FMagrow &row) __attribute__((nothrow));
+    FMagrow();
+};
+
+// Set all fields to initial values.
+void                 FMagrow_Init(atf_amc::FMagrow& magrow);
+
 // --- atf_amc.TypeG
 // create: atf_amc.OptAlloc.typeg (Opt)
 // create: atf_amc.OptG.typeg (Opt)
@@ -2558,8 +3399,34 @@ bool                 FPerfSortString_sorted1_curs_ValidQ(FPerfSortString_sorted1
 // item access
 atf_amc::Cstr&       FPerfSortString_sorted1_curs_Access(FPerfSortString_sorted1_curs &curs);
 // Set all fields to initial values.
-void                 FPerfSortString_Init(atf_amc::FPerfSortString& parent);
-void                 FPerfSortString_Uninit(atf_amc::FPerfSortString& parent) __attribute__((nothrow));
+void                 FPerfSortString_Init(atf_amc::FPerfSortString& parent);
+void                 FPerfSortString_Uninit(atf_amc::FPerfSortString& parent) __attribute__((nothrow));
+
+// --- atf_amc.FTreerow
+// create: atf_amc.FDb.treerow (Lary)
+// global access: bt_treerow (Btree)
+// global access: tr_treerow (Atree)
+struct FTreerow { // atf_amc.FTreerow: Row indexed by both Btree and Atree
+    _db_bt_treerow_node*   bt_treerow_leaf;    // Leaf containing the row; NULL if not in tree
+    atf_amc::FTreerow*     tr_treerow_up;      // pointer to parent
+    atf_amc::FTreerow*     tr_treerow_left;    // Left child
+    atf_amc::FTreerow*     tr_treerow_right;   // Right child
+    i32                    tr_treerow_depth;   // Depth
+    u64                    key;                //   0  Sort key
+private:
+    friend atf_amc::FTreerow&   treerow_Alloc() __attribute__((__warn_unused_result__, nothrow));
+    friend atf_amc::FTreerow*   treerow_AllocMaybe() __attribute__((__warn_unused_result__, nothrow));
+    friend void                 treerow_RemoveAll() __attribute__((nothrow));
+    friend void                 treerow_RemoveLast() __attribute__((nothrow));
+    FTreerow();
+    ~FTreerow();
+    FTreerow(const FTreerow&){ /*disallow copy constructor */}
+    void operator =(const FTreerow&){ /*disallow direct assignment */}
+};
+
+// Set all fields to initial values.
+void                 FTreerow_Init(atf_amc::FTreerow& treerow);
+void                 FTreerow_Uninit(atf_amc::FTreerow& treerow) __attribute__((nothrow));
 
 // --- atf_amc.FTypeC
 // create: atf_amc.FTypeA.typec (Inlary)
@@ -2906,8 +3773,11 @@ void                 FTypeT_Print(atf_amc::FTypeT & row, algo::cstring &str) __a
 // --- atf_amc.TypeA
 // create: atf_amc.FUnitSort.tary (Tary)
 // create: atf_amc.FUnitSort.fixary (Inlary)
+// create: atf_amc.FUnitSort.radix (Tary)
+// create: atf_amc.FUnitSort.parallel (Tary)
 // access: atf_amc.FTypeA.msghdr (Base)
 // access: atf_amc.FUnitSort.c_ptrary (Ptrary)
+// access: atf_amc.FUnitSort.c_radix (Ptrary)
 struct TypeA { // atf_amc.TypeA
     i32   typea;   //   0
     bool operator ==(const atf_amc::TypeA &rhs) const;
@@ -2940,11 +3810,25 @@ struct FUnitSort { // atf_amc.FUnitSort
     u32                c_ptrary_n;          // array of pointers
     u32                c_ptrary_max;        // capacity of allocated array
     atf_amc::TypeA     fixary_elems[100];   // fixed array
+    atf_amc::TypeA*    radix_elems;         // pointer to elements
+    u32                radix_n;             // number of elements in array
+    u32                radix_max;           // max. capacity of array before realloc
+    atf_amc::TypeA**   c_radix_elems;       // array of pointers
+    u32                c_radix_n;           // array of pointers
+    u32                c_radix_max;         // capacity of allocated array
+    atf_amc::Strkey*   strkey_elems;        // pointer to elements
+    u32                strkey_n;            // number of elements in array
+    u32                strkey_max;          // max. capacity of array before realloc
+    atf_amc::TypeA*    parallel_elems;      // pointer to elements
+    u32                parallel_n;          // number of elements in array
+    u32                parallel_max;        // max. capacity of array before realloc
     FUnitSort();
     ~FUnitSort();
 private:
     // reftype of atf_amc.FUnitSort.tary prohibits copy
     // reftype of atf_amc.FUnitSort.c_ptrary prohibits copy
+    // reftype of atf_amc.FUnitSort.radix prohibits copy
+    // ... and several other reasons
     FUnitSort(const FUnitSort&){ /*disallow copy constructor */}
     void operator =(const FUnitSort&){ /*disallow direct assignment */}
 };
@@ -3052,6 +3936,180 @@ void                 fixary_HeapSort(atf_amc::FUnitSort& parent) __attribute__((
 // Quick sort
 void                 fixary_QuickSort(atf_amc::FUnitSort& parent) __attribute__((nothrow));
 
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_amc::TypeA&      radix_Alloc(atf_amc::FUnitSort& parent) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_amc::TypeA&      radix_AllocAt(atf_amc::FUnitSort& parent, int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_amc::TypeA> radix_AllocN(atf_amc::FUnitSort& parent, int n_elems) __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 radix_EmptyQ(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_amc::TypeA*      radix_Find(atf_amc::FUnitSort& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array pointer by value
+algo::aryptr<atf_amc::TypeA> radix_Getary(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+atf_amc::TypeA*      radix_Last(atf_amc::FUnitSort& parent) __attribute__((nothrow, pure));
+// Return max. number of items in the array
+i32                  radix_Max(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  radix_N(const atf_amc::FUnitSort& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove item by index. If index outside of range, do nothing.
+void                 radix_Remove(atf_amc::FUnitSort& parent, u32 i) __attribute__((nothrow));
+void                 radix_RemoveAll(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 radix_RemoveLast(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 radix_Reserve(atf_amc::FUnitSort& parent, int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 radix_AbsReserve(atf_amc::FUnitSort& parent, int n) __attribute__((nothrow));
+// Copy contents of RHS to PARENT.
+void                 radix_Setary(atf_amc::FUnitSort& parent, atf_amc::FUnitSort &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+atf_amc::TypeA&      radix_qFind(atf_amc::FUnitSort& parent, u64 t) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+atf_amc::TypeA&      radix_qLast(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Return row id of specified element
+u64                  radix_rowid_Get(atf_amc::FUnitSort& parent, atf_amc::TypeA &elem) __attribute__((nothrow));
+// Verify whether array is sorted
+bool                 radix_SortedQ(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Radix sort (stable)
+// Keys are extracted into a temp array, sorted with LSD byte radix
+// (one round per key word, least significant first), then elements
+// are moved to their final positions in one pass.
+void                 radix_RadixSort(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+
+// Return true if index is empty
+bool                 c_radix_EmptyQ(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_amc::TypeA*      c_radix_Find(atf_amc::FUnitSort& parent, u32 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array of pointers
+algo::aryptr<atf_amc::TypeA*> c_radix_Getary(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Insert pointer to row into array. Row must not already be in array.
+// If pointer is already in the array, it may be inserted twice.
+void                 c_radix_Insert(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) __attribute__((nothrow));
+// Insert pointer to row in array.
+// If row is already in the array, do nothing.
+// Linear search is used to locate the element.
+// Return value: whether element was inserted into array.
+bool                 c_radix_ScanInsertMaybe(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) __attribute__((nothrow));
+// Return number of items in the pointer array
+i32                  c_radix_N(const atf_amc::FUnitSort& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Find element using linear scan. If element is in array, remove, otherwise do nothing
+void                 c_radix_Remove(atf_amc::FUnitSort& parent, atf_amc::TypeA& row) __attribute__((nothrow));
+// Empty the index. (The rows are not deleted)
+void                 c_radix_RemoveAll(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Reserve space in index for N more elements;
+void                 c_radix_Reserve(atf_amc::FUnitSort& parent, u32 n) __attribute__((nothrow));
+// Verify whether array is sorted
+bool                 c_radix_SortedQ(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Radix sort (stable)
+// Keys are extracted into a temp array, sorted with LSD byte radix
+// (one round per key word, least significant first), then elements
+// are moved to their final positions in one pass.
+void                 c_radix_RadixSort(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_amc::Strkey&     strkey_Alloc(atf_amc::FUnitSort& parent) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_amc::Strkey&     strkey_AllocAt(atf_amc::FUnitSort& parent, int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_amc::Strkey> strkey_AllocN(atf_amc::FUnitSort& parent, int n_elems) __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 strkey_EmptyQ(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_amc::Strkey*     strkey_Find(atf_amc::FUnitSort& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array pointer by value
+algo::aryptr<atf_amc::Strkey> strkey_Getary(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+atf_amc::Strkey*     strkey_Last(atf_amc::FUnitSort& parent) __attribute__((nothrow, pure));
+// Return max. number of items in the array
+i32                  strkey_Max(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  strkey_N(const atf_amc::FUnitSort& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove item by index. If index outside of range, do nothing.
+void                 strkey_Remove(atf_amc::FUnitSort& parent, u32 i) __attribute__((nothrow));
+void                 strkey_RemoveAll(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 strkey_RemoveLast(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 strkey_Reserve(atf_amc::FUnitSort& parent, int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 strkey_AbsReserve(atf_amc::FUnitSort& parent, int n) __attribute__((nothrow));
+// Copy contents of RHS to PARENT.
+void                 strkey_Setary(atf_amc::FUnitSort& parent, atf_amc::FUnitSort &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+atf_amc::Strkey&     strkey_qFind(atf_amc::FUnitSort& parent, u64 t) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+atf_amc::Strkey&     strkey_qLast(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Return row id of specified element
+u64                  strkey_rowid_Get(atf_amc::FUnitSort& parent, atf_amc::Strkey &elem) __attribute__((nothrow));
+// Verify whether array is sorted
+bool                 strkey_SortedQ(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Radix sort (stable)
+// Keys are extracted into a temp array, sorted with LSD byte radix
+// (one round per key word, least significant first), then elements
+// are moved to their final positions in one pass.
+void                 strkey_RadixSort(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Insert row into all appropriate indices. If error occurs, store error
+// in algo_lib::_db.errtext and return false. Caller must Delete or Unref such row.
+bool                 strkey_XrefMaybe(atf_amc::Strkey &row);
+
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_amc::TypeA&      parallel_Alloc(atf_amc::FUnitSort& parent) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_amc::TypeA&      parallel_AllocAt(atf_amc::FUnitSort& parent, int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_amc::TypeA> parallel_AllocN(atf_amc::FUnitSort& parent, int n_elems) __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 parallel_EmptyQ(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_amc::TypeA*      parallel_Find(atf_amc::FUnitSort& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array pointer by value
+algo::aryptr<atf_amc::TypeA> parallel_Getary(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+atf_amc::TypeA*      parallel_Last(atf_amc::FUnitSort& parent) __attribute__((nothrow, pure));
+// Return max. number of items in the array
+i32                  parallel_Max(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  parallel_N(const atf_amc::FUnitSort& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove item by index. If index outside of range, do nothing.
+void                 parallel_Remove(atf_amc::FUnitSort& parent, u32 i) __attribute__((nothrow));
+void                 parallel_RemoveAll(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 parallel_RemoveLast(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 parallel_Reserve(atf_amc::FUnitSort& parent, int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 parallel_AbsReserve(atf_amc::FUnitSort& parent, int n) __attribute__((nothrow));
+// Copy contents of RHS to PARENT.
+void                 parallel_Setary(atf_amc::FUnitSort& parent, atf_amc::FUnitSort &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+atf_amc::TypeA&      parallel_qFind(atf_amc::FUnitSort& parent, u64 t) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+atf_amc::TypeA&      parallel_qLast(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Return row id of specified element
+u64                  parallel_rowid_Get(atf_amc::FUnitSort& parent, atf_amc::TypeA &elem) __attribute__((nothrow));
+// Verify whether array is sorted
+bool                 parallel_SortedQ(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Insertion sort
+void                 parallel_InsertionSort(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Heap sort
+void                 parallel_HeapSort(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Quick sort
+void                 parallel_QuickSort(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+// Parallel sort
+// Large arrays are split into runs, which are sorted in separate threads
+// with quick sort, and merged; small arrays are quick-sorted in the calling thread.
+// parallel_Lt must be thread-safe.
+void                 parallel_ParallelSort(atf_amc::FUnitSort& parent) __attribute__((nothrow));
+
 // proceed to next item
 void                 FUnitSort_tary_curs_Next(FUnitSort_tary_curs &curs);
 void                 FUnitSort_tary_curs_Reset(FUnitSort_tary_curs &curs, atf_amc::FUnitSort &parent);
@@ -3074,6 +4132,34 @@ bool                 FUnitSort_fixary_curs_ValidQ(FUnitSort_fixary_curs &curs);
 void                 FUnitSort_fixary_curs_Next(FUnitSort_fixary_curs &curs);
 // item access
 atf_amc::TypeA&      FUnitSort_fixary_curs_Access(FUnitSort_fixary_curs &curs);
+// proceed to next item
+void                 FUnitSort_radix_curs_Next(FUnitSort_radix_curs &curs);
+void                 FUnitSort_radix_curs_Reset(FUnitSort_radix_curs &curs, atf_amc::FUnitSort &parent);
+// cursor points to valid item
+bool                 FUnitSort_radix_curs_ValidQ(FUnitSort_radix_curs &curs);
+// item access
+atf_amc::TypeA&      FUnitSort_radix_curs_Access(FUnitSort_radix_curs &curs);
+void                 FUnitSort_c_radix_curs_Reset(FUnitSort_c_radix_curs &curs, atf_amc::FUnitSort &parent);
+// cursor points to valid item
+bool                 FUnitSort_c_radix_curs_ValidQ(FUnitSort_c_radix_curs &curs);
+// proceed to next item
+void                 FUnitSort_c_radix_curs_Next(FUnitSort_c_radix_curs &curs);
+// item access
+atf_amc::TypeA&      FUnitSort_c_radix_curs_Access(FUnitSort_c_radix_curs &curs);
+// proceed to next item
+void                 FUnitSort_strkey_curs_Next(FUnitSort_strkey_curs &curs);
+void                 FUnitSort_strkey_curs_Reset(FUnitSort_strkey_curs &curs, atf_amc::FUnitSort &parent);
+// cursor points to valid item
+bool                 FUnitSort_strkey_curs_ValidQ(FUnitSort_strkey_curs &curs);
+// item access
+atf_amc::Strkey&     FUnitSort_strkey_curs_Access(FUnitSort_strkey_curs &curs);
+// proceed to next item
+void                 FUnitSort_parallel_curs_Next(FUnitSort_parallel_curs &curs);
+void                 FUnitSort_parallel_curs_Reset(FUnitSort_parallel_curs &curs, atf_amc::FUnitSort &parent);
+// cursor points to valid item
+bool                 FUnitSort_parallel_curs_ValidQ(FUnitSort_parallel_curs &curs);
+// item access
+atf_amc::TypeA&      FUnitSort_parallel_curs_Access(FUnitSort_parallel_curs &curs);
 // Set all fields to initial values.
 void                 FUnitSort_Init(atf_amc::FUnitSort& parent);
 void                 FUnitSort_Uninit(atf_amc::FUnitSort& parent) __attribute__((nothrow));
@@ -4595,6 +5681,14 @@ bool                 SsimfilesCase_ReadStrptrMaybe(atf_amc::SsimfilesCase &paren
 // Set all fields to initial values.
 void                 SsimfilesCase_Init(atf_amc::SsimfilesCase& parent);
 
+// --- atf_amc.Strkey
+// create: atf_amc.FUnitSort.strkey (Tary)
+struct Strkey { // atf_amc.Strkey: Element with a string sort key
+    algo::Smallstr50   key;   //
+    Strkey();
+};
+
+
 // --- atf_amc.TableId
 struct TableId { // atf_amc.TableId: Index of table in this namespace
     i32   value;   //   -1  index of table
@@ -5399,6 +6493,39 @@ struct cascdel_tr_child_atree_curs {// cursor
     }
 };
 
+
+struct cascdel_bt_child_btree_curs {// cursor
+    typedef atf_amc::FCascdel ChildType;
+    cascdel_bt_child_btree_node* node;
+    int index;
+    cascdel_bt_child_btree_curs() { node=NULL; index=0; }
+};
+
+
+struct cascdel_bt_child_btree_node {// B+tree node (atf_amc.FCascdel.bt_child_btree)
+    enum { max_keys = (256 - 32) / (sizeof(u32) + sizeof(void*)) };
+    i32 n;  // number of rows (leaf) or children (internal node)
+    bool leaf;  // row[] is valid in leaves, child[] in internal nodes
+    cascdel_bt_child_btree_node* parent;  // NULL for root
+    cascdel_bt_child_btree_node* next;  // next leaf (leaves only)
+    cascdel_bt_child_btree_node* prev;  // previous leaf (leaves only)
+    // leaf: key of row[i]
+    // internal node: key[i] (i>0) is <= all keys in child[i] and >= all keys in child[i-1]
+    u32 key[max_keys];
+    union {
+        atf_amc::FCascdel* row[max_keys];
+        cascdel_bt_child_btree_node* child[max_keys];
+    };
+};
+
+
+struct cascdel_bt_child_btree_rcurs {// cursor
+    typedef atf_amc::FCascdel ChildType;
+    cascdel_bt_child_btree_node* node;
+    int index;
+    cascdel_bt_child_btree_rcurs() { node=NULL; index=0; }
+};
+
 // Non-destructive heap cursor, returns heap elements in sorted order.
 // A running front of potential smallest entries is kept in the helper heap (curs.temp_%)
 struct _db_bh_typec_curs {
@@ -5586,6 +6713,198 @@ struct _db_listtype_curs {// cursor
 };
 
 
+struct _db_hashrow_curs {// cursor
+    typedef atf_amc::FHashrow ChildType;
+    atf_amc::FDb *parent;
+    i64 index;
+    _db_hashrow_curs(){ parent=NULL; index=0; }
+};
+
+
+struct _db_ind_hashrow_curs {// cursor
+    typedef atf_amc::FHashrow ChildType;
+    atf_amc::FDb *parent;
+    int bucket;
+    atf_amc::FHashrow **prow;
+    _db_ind_hashrow_curs() { parent=NULL; bucket=0; prow=NULL; }
+};
+
+
+struct _db_ind_hashrow_oa_curs {// cursor
+    typedef atf_amc::FHashrow ChildType;
+    atf_amc::FDb *parent;
+    int index;
+    _db_ind_hashrow_oa_curs() { parent=NULL; index=0; }
+};
+
+
+struct _db_ind_hashrow_incr_curs {// cursor
+    typedef atf_amc::FHashrow ChildType;
+    atf_amc::FDb *parent;
+    int bucket;
+    atf_amc::FHashrow **prow;
+    _db_ind_hashrow_incr_curs() { parent=NULL; bucket=0; prow=NULL; }
+};
+
+
+struct _db_treerow_curs {// cursor
+    typedef atf_amc::FTreerow ChildType;
+    atf_amc::FDb *parent;
+    i64 index;
+    _db_treerow_curs(){ parent=NULL; index=0; }
+};
+
+
+struct _db_bt_treerow_curs {// cursor
+    typedef atf_amc::FTreerow ChildType;
+    _db_bt_treerow_node* node;
+    int index;
+    _db_bt_treerow_curs() { node=NULL; index=0; }
+};
+
+
+struct _db_bt_treerow_node {// B+tree node (atf_amc.FDb.bt_treerow)
+    enum { max_keys = (256 - 32) / (sizeof(u64) + sizeof(void*)) };
+    i32 n;  // number of rows (leaf) or children (internal node)
+    bool leaf;  // row[] is valid in leaves, child[] in internal nodes
+    _db_bt_treerow_node* parent;  // NULL for root
+    _db_bt_treerow_node* next;  // next leaf (leaves only)
+    _db_bt_treerow_node* prev;  // previous leaf (leaves only)
+    // leaf: key of row[i]
+    // internal node: key[i] (i>0) is <= all keys in child[i] and >= all keys in child[i-1]
+    u64 key[max_keys];
+    union {
+        atf_amc::FTreerow* row[max_keys];
+        _db_bt_treerow_node* child[max_keys];
+    };
+};
+
+
+struct _db_bt_treerow_rcurs {// cursor
+    typedef atf_amc::FTreerow ChildType;
+    _db_bt_treerow_node* node;
+    int index;
+    _db_bt_treerow_rcurs() { node=NULL; index=0; }
+};
+
+
+struct _db_tr_treerow_curs {// cursor
+    typedef atf_amc::FTreerow ChildType;
+    atf_amc::FTreerow* row;
+    _db_tr_treerow_curs() {
+        row = NULL;
+    }
+};
+
+
+struct _db_colrow_curs {// cursor
+    typedef atf_amc::FColrow ChildType;
+    atf_amc::FDb *parent;
+    i64 index;
+    _db_colrow_curs(){ parent=NULL; index=0; }
+};
+
+
+struct _db_colrow_price_curs {// column cursor
+    typedef double ChildType;
+    atf_amc::FDb *parent;
+    double *elems; // current level
+    i64 index; // row id of current element
+    i64 i; // index on current level
+    i32 level;
+    _db_colrow_price_curs(){ parent=NULL; elems=NULL; index=0; i=0; level=0; }
+};
+
+
+struct _db_colrow_qty_curs {// column cursor
+    typedef i32 ChildType;
+    atf_amc::FDb *parent;
+    i32 *elems; // current level
+    i64 index; // row id of current element
+    i64 i; // index on current level
+    i32 level;
+    _db_colrow_qty_curs(){ parent=NULL; elems=NULL; index=0; i=0; level=0; }
+};
+
+
+struct _db_heaprow_curs {// cursor
+    typedef atf_amc::FHeaprow ChildType;
+    atf_amc::FDb *parent;
+    i64 index;
+    _db_heaprow_curs(){ parent=NULL; index=0; }
+};
+
+// Non-destructive heap cursor, returns heap elements in sorted order.
+// A running front of potential smallest entries is kept in the helper heap (curs.temp_%)
+struct _db_bh_heaprow_curs {
+    typedef atf_amc::FHeaprow ChildType;
+    atf_amc::FDb      *parent;        // parent
+    atf_amc::FHeaprow*     *temp_elems;    // helper heap
+    int            temp_n;        // number of elements heaped in the helper heap
+    int            temp_max;      // max number of elements possible in the helper heap
+    _db_bh_heaprow_curs() : parent(NULL), temp_elems(NULL), temp_n(0), temp_max(0) {}
+    ~_db_bh_heaprow_curs();
+};
+
+
+struct _db_bh_heaprow_unordcurs {// unordered cursor -- iterate over heap in arbitrary order
+    typedef atf_amc::FHeaprow ChildType;
+    atf_amc::FHeaprow** elems;
+    u32 n_elems;
+    u32 index;
+    _db_bh_heaprow_unordcurs() { elems=NULL; n_elems=0; index=0; }
+};
+
+// Non-destructive heap cursor, returns heap elements in sorted order.
+// A running front of potential smallest entries is kept in the helper heap (curs.temp_%)
+struct _db_bh_heaprow_inl_curs {
+    typedef atf_amc::FHeaprow ChildType;
+    atf_amc::FDb      *parent;        // parent
+    atf_amc::FHeaprow*     *temp_elems;    // helper heap
+    int            temp_n;        // number of elements heaped in the helper heap
+    int            temp_max;      // max number of elements possible in the helper heap
+    _db_bh_heaprow_inl_curs() : parent(NULL), temp_elems(NULL), temp_n(0), temp_max(0) {}
+    ~_db_bh_heaprow_inl_curs();
+};
+
+
+struct _db_bh_heaprow_inl_unordcurs {// unordered cursor -- iterate over heap in arbitrary order
+    typedef atf_amc::FHeaprow ChildType;
+    _db_bh_heaprow_inl_elem* elems;
+    u32 n_elems;
+    u32 index;
+    _db_bh_heaprow_inl_unordcurs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct _db_bh_heaprow_inl_elem {// heap element with inline key (atf_amc.FDb.bh_heaprow_inl)
+    u64 key; // copy of row's key
+    atf_amc::FHeaprow* row;
+    _db_bh_heaprow_inl_elem() : row(NULL) {}
+    _db_bh_heaprow_inl_elem(const u64 &in_key, atf_amc::FHeaprow *in_row) : key(in_key), row(in_row) {}
+};
+
+// Non-destructive heap cursor, returns heap elements in sorted order.
+// A running front of potential smallest entries is kept in the helper heap (curs.temp_%)
+struct _db_bh_heaprow_ptr_curs {
+    typedef atf_amc::FHeaprow ChildType;
+    atf_amc::FDb      *parent;        // parent
+    atf_amc::FHeaprow*     *temp_elems;    // helper heap
+    int            temp_n;        // number of elements heaped in the helper heap
+    int            temp_max;      // max number of elements possible in the helper heap
+    _db_bh_heaprow_ptr_curs() : parent(NULL), temp_elems(NULL), temp_n(0), temp_max(0) {}
+    ~_db_bh_heaprow_ptr_curs();
+};
+
+
+struct _db_hugerow_curs {// cursor
+    typedef atf_amc::FHugerow ChildType;
+    atf_amc::FDb *parent;
+    i64 index;
+    _db_hugerow_curs(){ parent=NULL; index=0; }
+};
+
+
 struct FPerfSortString_orig_curs {// cursor
     typedef atf_amc::Cstr ChildType;
     atf_amc::Cstr* elems;
@@ -5668,6 +6987,42 @@ struct FUnitSort_fixary_curs {// cursor
 };
 
 
+struct FUnitSort_radix_curs {// cursor
+    typedef atf_amc::TypeA ChildType;
+    atf_amc::TypeA* elems;
+    int n_elems;
+    int index;
+    FUnitSort_radix_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct FUnitSort_c_radix_curs {// cursor
+    typedef atf_amc::TypeA ChildType;
+    atf_amc::TypeA** elems;
+    u32 n_elems;
+    u32 index;
+    FUnitSort_c_radix_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct FUnitSort_strkey_curs {// cursor
+    typedef atf_amc::Strkey ChildType;
+    atf_amc::Strkey* elems;
+    int n_elems;
+    int index;
+    FUnitSort_strkey_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct FUnitSort_parallel_curs {// cursor
+    typedef atf_amc::TypeA ChildType;
+    atf_amc::TypeA* elems;
+    int n_elems;
+    int index;
+    FUnitSort_parallel_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
 struct InlaryPrint_fixary_curs {// cursor
     typedef u32 ChildType;
     int index;
@@ -5757,6 +7112,10 @@ struct VarlenK_i_curs {// cursor
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_AmcSort();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_AmcSortParallel();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_AmcSortRadix();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_BhFirstChanged1();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_BhFirstChanged2();
@@ -5765,6 +7124,8 @@ void                 amctest_BhFirstChanged3();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_BheapCursor();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_BheapDary();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_BheapInsert100();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_BigEndian();
@@ -5775,12 +7136,20 @@ void                 amctest_BitfldNet();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_BitfldTuple();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_Btree();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_BtreeCurs();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_CascdelAtree();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_CascdelBheap();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_CascdelBheapChain();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_CascdelBtree();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_CascdelBtreeChain();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_CascdelPtr();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_CascdelPtrary();
@@ -5899,10 +7268,14 @@ void                 amctest_ImdXref();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_Inlary_ReadPrint();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_LaryColumn();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_LineIter();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_Lpool();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_MagazineMT();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_Minmax();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_MsgCurs();
@@ -5943,8 +7316,20 @@ void                 amctest_OptOptG8();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_OptOptG9();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_PerfBheapDary();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_PerfBtree();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_PerfHugepage();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_PerfLaryColumn();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_PerfSortString();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_PerfThash();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_PerfThashIncremental();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_PrintBase36();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_PrintRawGconst();
@@ -6023,6 +7408,12 @@ void                 amctest_TestSep2();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_TestString();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_ThashCachehash();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_ThashIncremental();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
+void                 amctest_ThashOpenaddr();
+// User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_Typetag();
 // User-implemented function from gstatic:atf_amc.FDb.amctest
 void                 amctest_VarlenAlloc();
@@ -870,6 +870,7 @@ inline void atf_amc::step_Call(atf_amc::FAmctest& amctest) {
 // --- atf_amc.FAmctest..Init
 // Set all fields to initial values.
 inline void atf_amc::FAmctest_Init(atf_amc::FAmctest& amctest) {
+    amctest.manual = bool(false);
     amctest.select = bool(false);
     amctest.step = NULL;
 }
@@ -1090,6 +1091,44 @@ inline void atf_amc::tr_child_atree_RemoveAll(atf_amc::FCascdel& cascdel) {
     cascdel.tr_child_atree_n = 0;
 }
 
+// --- atf_amc.FCascdel.bt_child_btree.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::bt_child_btree_EmptyQ(atf_amc::FCascdel& cascdel) {
+    return cascdel.bt_child_btree_root == NULL;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.First
+// Return pointer to the first(smallest) element in the tree
+inline atf_amc::FCascdel* atf_amc::bt_child_btree_First(atf_amc::FCascdel& cascdel) {
+    cascdel_bt_child_btree_node *node = cascdel.bt_child_btree_root;
+    while (node && !node->leaf) {
+        node = node->child[0];
+    }
+    return node ? node->row[0] : NULL;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.InTreeQ
+// Return true if row is in the tree, false otherwise
+inline bool atf_amc::bt_child_btree_InTreeQ(atf_amc::FCascdel& row) {
+    return row.bt_child_btree_leaf != NULL;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.Last
+// Return pointer to the last(largest) element in tree
+inline atf_amc::FCascdel* atf_amc::bt_child_btree_Last(atf_amc::FCascdel& cascdel) {
+    cascdel_bt_child_btree_node *node = cascdel.bt_child_btree_root;
+    while (node && !node->leaf) {
+        node = node->child[node->n - 1];
+    }
+    return node ? node->row[node->n - 1] : NULL;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree.N
+// Return number of elements in the tree
+inline i32 atf_amc::bt_child_btree_N(const atf_amc::FCascdel& cascdel) {
+    return cascdel.bt_child_btree_n;
+}
+
 // --- atf_amc.FCascdel.c_child_ptrary_curs.Reset
 inline void atf_amc::cascdel_c_child_ptrary_curs_Reset(cascdel_c_child_ptrary_curs &curs, atf_amc::FCascdel &parent) {
     curs.elems = parent.c_child_ptrary_elems;
@@ -1174,6 +1213,85 @@ inline void atf_amc::cascdel_tr_child_atree_curs_Next(cascdel_tr_child_atree_cur
 inline atf_amc::FCascdel& atf_amc::cascdel_tr_child_atree_curs_Access(cascdel_tr_child_atree_curs &curs) {
     return *curs.row;
 }
+
+// --- atf_amc.FCascdel.bt_child_btree_curs.Reset
+// position cursor at the first row
+inline void atf_amc::cascdel_bt_child_btree_curs_Reset(cascdel_bt_child_btree_curs &curs, atf_amc::FCascdel& parent) {
+    cascdel_bt_child_btree_node *node = parent.bt_child_btree_root;
+    while (node && !node->leaf) {
+        node = node->child[0];
+    }
+    curs.node  = node;
+    curs.index = 0;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::cascdel_bt_child_btree_curs_ValidQ(cascdel_bt_child_btree_curs &curs) {
+    return curs.node != NULL;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree_curs.Next
+// proceed to next item
+inline void atf_amc::cascdel_bt_child_btree_curs_Next(cascdel_bt_child_btree_curs &curs) {
+    curs.index++;
+    if (curs.index == curs.node->n) {
+        curs.node  = curs.node->next;
+        curs.index = 0;
+    }
+}
+
+// --- atf_amc.FCascdel.bt_child_btree_curs.Access
+// item access
+inline atf_amc::FCascdel& atf_amc::cascdel_bt_child_btree_curs_Access(cascdel_bt_child_btree_curs &curs) {
+    return *curs.node->row[curs.index];
+}
+
+// --- atf_amc.FCascdel.bt_child_btree_rcurs.Reset
+// position cursor at the last row
+inline void atf_amc::cascdel_bt_child_btree_rcurs_Reset(cascdel_bt_child_btree_rcurs &curs, atf_amc::FCascdel& parent) {
+    cascdel_bt_child_btree_node *node = parent.bt_child_btree_root;
+    while (node && !node->leaf) {
+        node = node->child[node->n - 1];
+    }
+    curs.node  = node;
+    curs.index = node ? node->n - 1 : 0;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree_rcurs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::cascdel_bt_child_btree_rcurs_ValidQ(cascdel_bt_child_btree_rcurs &curs) {
+    return curs.node != NULL;
+}
+
+// --- atf_amc.FCascdel.bt_child_btree_rcurs.Next
+// proceed to next item
+inline void atf_amc::cascdel_bt_child_btree_rcurs_Next(cascdel_bt_child_btree_rcurs &curs) {
+    curs.index--;
+    if (curs.index < 0) {
+        curs.node  = curs.node->prev;
+        curs.index = curs.node ? curs.node->n - 1 : 0;
+    }
+}
+
+// --- atf_amc.FCascdel.bt_child_btree_rcurs.Access
+// item access
+inline atf_amc::FCascdel& atf_amc::cascdel_bt_child_btree_rcurs_Access(cascdel_bt_child_btree_rcurs &curs) {
+    return *curs.node->row[curs.index];
+}
+inline atf_amc::FColrow::FColrow() : price(colrow_price_qFind(i32(colrow_N() - 1))), qty(colrow_qty_qFind(i32(colrow_N() - 1))) {
+    atf_amc::FColrow_Init(*this);
+}
+
+
+// --- atf_amc.FColrow..Init
+// Set all fields to initial values.
+inline void atf_amc::FColrow_Init(atf_amc::FColrow& colrow) {
+    colrow.rowid = i32(0);
+    colrow.weight = double(0.0);
+    colrow.price = double(0.0);
+    colrow.qty = i32(1);
+}
 inline atf_amc::FCstring::FCstring() {
     atf_amc::FCstring_Init(*this);
 }
@@ -2262,500 +2380,1449 @@ inline u64 atf_amc::listtype_rowid_Get(atf_amc::FListtype &row) {
     return u64(ret);
 }
 
-// --- atf_amc.FDb.bh_typec_curs.Access
-// Access current element. If not more elements, return NULL
-inline atf_amc::FTypeC& atf_amc::_db_bh_typec_curs_Access(_db_bh_typec_curs &curs) {
-    return *curs.temp_elems[0];
-}
-
-// --- atf_amc.FDb.bh_typec_curs.ValidQ
-// Return true if Access() will return non-NULL.
-inline bool atf_amc::_db_bh_typec_curs_ValidQ(_db_bh_typec_curs &curs) {
-    return curs.temp_n > 0;
+// --- atf_amc.FDb.hashrow.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::hashrow_EmptyQ() {
+    return _db.hashrow_n == 0;
 }
 
-// --- atf_amc.FDb.zdl_h_typec_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_zdl_h_typec_curs_Reset(_db_zdl_h_typec_curs &curs, atf_amc::FDb &parent) {
-    curs.row = parent.zdl_h_typec_head;
+// --- atf_amc.FDb.hashrow.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_amc::FHashrow* atf_amc::hashrow_Find(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    atf_amc::FHashrow *retval = NULL;
+    if (LIKELY(x <= u64(_db.hashrow_n))) {
+        retval = &_db.hashrow_lary[bsr][index];
+    }
+    return retval;
 }
 
-// --- atf_amc.FDb.zdl_h_typec_curs.ValidQ
-// cursor points to valid item
-inline bool atf_amc::_db_zdl_h_typec_curs_ValidQ(_db_zdl_h_typec_curs &curs) {
-    return curs.row != NULL;
+// --- atf_amc.FDb.hashrow.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline atf_amc::FHashrow* atf_amc::hashrow_Last() {
+    return hashrow_Find(u64(_db.hashrow_n-1));
 }
 
-// --- atf_amc.FDb.zdl_h_typec_curs.Next
-// proceed to next item
-inline void atf_amc::_db_zdl_h_typec_curs_Next(_db_zdl_h_typec_curs &curs) {
-    curs.row = (*curs.row).zdl_h_typec_next;
+// --- atf_amc.FDb.hashrow.N
+// Return number of items in the pool
+inline i32 atf_amc::hashrow_N() {
+    return _db.hashrow_n;
 }
 
-// --- atf_amc.FDb.zdl_h_typec_curs.Access
-// item access
-inline atf_amc::FTypeC& atf_amc::_db_zdl_h_typec_curs_Access(_db_zdl_h_typec_curs &curs) {
-    return *curs.row;
+// --- atf_amc.FDb.hashrow.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline atf_amc::FHashrow& atf_amc::hashrow_qFind(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.hashrow_lary[bsr][index];
 }
 
-// --- atf_amc.FDb.zd_t_typec_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_zd_t_typec_curs_Reset(_db_zd_t_typec_curs &curs, atf_amc::FDb &parent) {
-    curs.row = parent.zd_t_typec_head;
+// --- atf_amc.FDb.ind_hashrow.EmptyQ
+// Return true if hash is empty
+inline bool atf_amc::ind_hashrow_EmptyQ() {
+    return _db.ind_hashrow_n == 0;
 }
 
-// --- atf_amc.FDb.zd_t_typec_curs.ValidQ
-// cursor points to valid item
-inline bool atf_amc::_db_zd_t_typec_curs_ValidQ(_db_zd_t_typec_curs &curs) {
-    return curs.row != NULL;
+// --- atf_amc.FDb.ind_hashrow.N
+// Return number of items in the hash
+inline i32 atf_amc::ind_hashrow_N() {
+    return _db.ind_hashrow_n;
 }
 
-// --- atf_amc.FDb.zd_t_typec_curs.Next
-// proceed to next item
-inline void atf_amc::_db_zd_t_typec_curs_Next(_db_zd_t_typec_curs &curs) {
-    curs.row = (*curs.row).zd_t_typec_next;
+// --- atf_amc.FDb.ind_hashrow_cached.EmptyQ
+// Return true if hash is empty
+inline bool atf_amc::ind_hashrow_cached_EmptyQ() {
+    return _db.ind_hashrow_cached_n == 0;
 }
 
-// --- atf_amc.FDb.zd_t_typec_curs.Access
-// item access
-inline atf_amc::FTypeC& atf_amc::_db_zd_t_typec_curs_Access(_db_zd_t_typec_curs &curs) {
-    return *curs.row;
+// --- atf_amc.FDb.ind_hashrow_cached.N
+// Return number of items in the hash
+inline i32 atf_amc::ind_hashrow_cached_N() {
+    return _db.ind_hashrow_cached_n;
 }
 
-// --- atf_amc.FDb.zsl_h_typec_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_zsl_h_typec_curs_Reset(_db_zsl_h_typec_curs &curs, atf_amc::FDb &parent) {
-    curs.row = parent.zsl_h_typec_head;
+// --- atf_amc.FDb.ind_hashrow_oa.EmptyQ
+// Return true if hash is empty
+inline bool atf_amc::ind_hashrow_oa_EmptyQ() {
+    return _db.ind_hashrow_oa_n == 0;
 }
 
-// --- atf_amc.FDb.zsl_h_typec_curs.ValidQ
-// cursor points to valid item
-inline bool atf_amc::_db_zsl_h_typec_curs_ValidQ(_db_zsl_h_typec_curs &curs) {
-    return curs.row != NULL;
+// --- atf_amc.FDb.ind_hashrow_oa.N
+// Return number of items in the hash
+inline i32 atf_amc::ind_hashrow_oa_N() {
+    return _db.ind_hashrow_oa_n;
 }
 
-// --- atf_amc.FDb.zsl_h_typec_curs.Next
-// proceed to next item
-inline void atf_amc::_db_zsl_h_typec_curs_Next(_db_zsl_h_typec_curs &curs) {
-    curs.row = (*curs.row).zsl_h_typec_next;
+// --- atf_amc.FDb.ind_hashrow_incr.EmptyQ
+// Return true if hash is empty
+inline bool atf_amc::ind_hashrow_incr_EmptyQ() {
+    return _db.ind_hashrow_incr_n == 0;
 }
 
-// --- atf_amc.FDb.zsl_h_typec_curs.Access
-// item access
-inline atf_amc::FTypeC& atf_amc::_db_zsl_h_typec_curs_Access(_db_zsl_h_typec_curs &curs) {
-    return *curs.row;
+// --- atf_amc.FDb.ind_hashrow_incr.N
+// Return number of items in the hash
+inline i32 atf_amc::ind_hashrow_incr_N() {
+    return _db.ind_hashrow_incr_n;
 }
 
-// --- atf_amc.FDb.zs_t_typec_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_zs_t_typec_curs_Reset(_db_zs_t_typec_curs &curs, atf_amc::FDb &parent) {
-    curs.row = parent.zs_t_typec_head;
+// --- atf_amc.FDb.treerow.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::treerow_EmptyQ() {
+    return _db.treerow_n == 0;
 }
 
-// --- atf_amc.FDb.zs_t_typec_curs.ValidQ
-// cursor points to valid item
-inline bool atf_amc::_db_zs_t_typec_curs_ValidQ(_db_zs_t_typec_curs &curs) {
-    return curs.row != NULL;
+// --- atf_amc.FDb.treerow.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_amc::FTreerow* atf_amc::treerow_Find(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    atf_amc::FTreerow *retval = NULL;
+    if (LIKELY(x <= u64(_db.treerow_n))) {
+        retval = &_db.treerow_lary[bsr][index];
+    }
+    return retval;
 }
 
-// --- atf_amc.FDb.zs_t_typec_curs.Next
-// proceed to next item
-inline void atf_amc::_db_zs_t_typec_curs_Next(_db_zs_t_typec_curs &curs) {
-    curs.row = (*curs.row).zs_t_typec_next;
+// --- atf_amc.FDb.treerow.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline atf_amc::FTreerow* atf_amc::treerow_Last() {
+    return treerow_Find(u64(_db.treerow_n-1));
 }
 
-// --- atf_amc.FDb.zs_t_typec_curs.Access
-// item access
-inline atf_amc::FTypeC& atf_amc::_db_zs_t_typec_curs_Access(_db_zs_t_typec_curs &curs) {
-    return *curs.row;
+// --- atf_amc.FDb.treerow.N
+// Return number of items in the pool
+inline i32 atf_amc::treerow_N() {
+    return _db.treerow_n;
 }
 
-// --- atf_amc.FDb.zdl_hnt_typec_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_zdl_hnt_typec_curs_Reset(_db_zdl_hnt_typec_curs &curs, atf_amc::FDb &parent) {
-    curs.row = parent.zdl_hnt_typec_head;
+// --- atf_amc.FDb.treerow.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline atf_amc::FTreerow& atf_amc::treerow_qFind(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.treerow_lary[bsr][index];
 }
 
-// --- atf_amc.FDb.zdl_hnt_typec_curs.ValidQ
-// cursor points to valid item
-inline bool atf_amc::_db_zdl_hnt_typec_curs_ValidQ(_db_zdl_hnt_typec_curs &curs) {
-    return curs.row != NULL;
+// --- atf_amc.FDb.bt_treerow.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::bt_treerow_EmptyQ() {
+    return _db.bt_treerow_root == NULL;
 }
 
-// --- atf_amc.FDb.zdl_hnt_typec_curs.Next
-// proceed to next item
-inline void atf_amc::_db_zdl_hnt_typec_curs_Next(_db_zdl_hnt_typec_curs &curs) {
-    curs.row = (*curs.row).zdl_hnt_typec_next;
+// --- atf_amc.FDb.bt_treerow.First
+// Return pointer to the first(smallest) element in the tree
+inline atf_amc::FTreerow* atf_amc::bt_treerow_First() {
+    _db_bt_treerow_node *node = _db.bt_treerow_root;
+    while (node && !node->leaf) {
+        node = node->child[0];
+    }
+    return node ? node->row[0] : NULL;
 }
 
-// --- atf_amc.FDb.zdl_hnt_typec_curs.Access
-// item access
-inline atf_amc::FTypeC& atf_amc::_db_zdl_hnt_typec_curs_Access(_db_zdl_hnt_typec_curs &curs) {
-    return *curs.row;
+// --- atf_amc.FDb.bt_treerow.InTreeQ
+// Return true if row is in the tree, false otherwise
+inline bool atf_amc::bt_treerow_InTreeQ(atf_amc::FTreerow& row) {
+    return row.bt_treerow_leaf != NULL;
 }
 
-// --- atf_amc.FDb.cdl_h_typec_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_cdl_h_typec_curs_Reset(_db_cdl_h_typec_curs &curs, atf_amc::FDb &parent) {
-    curs.row = parent.cdl_h_typec_head;
-    curs.head = parent.cdl_h_typec_head;
+// --- atf_amc.FDb.bt_treerow.Last
+// Return pointer to the last(largest) element in tree
+inline atf_amc::FTreerow* atf_amc::bt_treerow_Last() {
+    _db_bt_treerow_node *node = _db.bt_treerow_root;
+    while (node && !node->leaf) {
+        node = node->child[node->n - 1];
+    }
+    return node ? node->row[node->n - 1] : NULL;
 }
 
-// --- atf_amc.FDb.cdl_h_typec_curs.ValidQ
-// cursor points to valid item
-inline bool atf_amc::_db_cdl_h_typec_curs_ValidQ(_db_cdl_h_typec_curs &curs) {
-    return curs.row != NULL;
+// --- atf_amc.FDb.bt_treerow.N
+// Return number of elements in the tree
+inline i32 atf_amc::bt_treerow_N() {
+    return _db.bt_treerow_n;
 }
 
-// --- atf_amc.FDb.cdl_h_typec_curs.Next
-// proceed to next item
-inline void atf_amc::_db_cdl_h_typec_curs_Next(_db_cdl_h_typec_curs &curs) {
-    curs.row = (*curs.row).cdl_h_typec_next;
-    if (curs.row == curs.head) {
-        curs.row = NULL;
-    }
+// --- atf_amc.FDb.tr_treerow.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::tr_treerow_EmptyQ() {
+    return _db.tr_treerow_root == NULL;
 }
 
-// --- atf_amc.FDb.cdl_h_typec_curs.Access
-// item access
-inline atf_amc::FTypeC& atf_amc::_db_cdl_h_typec_curs_Access(_db_cdl_h_typec_curs &curs) {
-    return *curs.row;
+// --- atf_amc.FDb.tr_treerow.InTreeQ
+// Return true if row is in the tree, false otherwise
+inline bool atf_amc::tr_treerow_InTreeQ(atf_amc::FTreerow& row) {
+    return row.tr_treerow_up != (atf_amc::FTreerow*)-1;
 }
 
-// --- atf_amc.FDb.cd_t_typec_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_cd_t_typec_curs_Reset(_db_cd_t_typec_curs &curs, atf_amc::FDb &parent) {
-    curs.row = parent.cd_t_typec_head;
-    curs.head = parent.cd_t_typec_head;
+// --- atf_amc.FDb.tr_treerow.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void atf_amc::tr_treerow_RemoveAll() {
+    tr_treerow_RemoveAllImpl(_db.tr_treerow_root, false);
+    _db.tr_treerow_root = NULL;
+    _db.tr_treerow_n = 0;
 }
 
-// --- atf_amc.FDb.cd_t_typec_curs.ValidQ
-// cursor points to valid item
-inline bool atf_amc::_db_cd_t_typec_curs_ValidQ(_db_cd_t_typec_curs &curs) {
-    return curs.row != NULL;
+// --- atf_amc.FDb.colrow.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::colrow_EmptyQ() {
+    return _db.colrow_n == 0;
 }
 
-// --- atf_amc.FDb.cd_t_typec_curs.Next
-// proceed to next item
-inline void atf_amc::_db_cd_t_typec_curs_Next(_db_cd_t_typec_curs &curs) {
-    curs.row = (*curs.row).cd_t_typec_next;
-    if (curs.row == curs.head) {
-        curs.row = NULL;
+// --- atf_amc.FDb.colrow.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_amc::FColrow* atf_amc::colrow_Find(i32 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    atf_amc::FColrow *retval = NULL;
+    if (LIKELY(x <= u64(_db.colrow_n))) {
+        retval = &_db.colrow_lary[bsr][index];
     }
+    return retval;
 }
 
-// --- atf_amc.FDb.cd_t_typec_curs.Access
-// item access
-inline atf_amc::FTypeC& atf_amc::_db_cd_t_typec_curs_Access(_db_cd_t_typec_curs &curs) {
-    return *curs.row;
+// --- atf_amc.FDb.colrow.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline atf_amc::FColrow* atf_amc::colrow_Last() {
+    return colrow_Find(i32(_db.colrow_n-1));
 }
 
-// --- atf_amc.FDb.csl_h_typec_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_csl_h_typec_curs_Reset(_db_csl_h_typec_curs &curs, atf_amc::FDb &parent) {
-    curs.row = parent.csl_h_typec_head;
-    curs.head = parent.csl_h_typec_head;
+// --- atf_amc.FDb.colrow.N
+// Return number of items in the pool
+inline i32 atf_amc::colrow_N() {
+    return _db.colrow_n;
 }
 
-// --- atf_amc.FDb.csl_h_typec_curs.ValidQ
-// cursor points to valid item
-inline bool atf_amc::_db_csl_h_typec_curs_ValidQ(_db_csl_h_typec_curs &curs) {
-    return curs.row != NULL;
+// --- atf_amc.FDb.colrow.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline atf_amc::FColrow& atf_amc::colrow_qFind(i32 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.colrow_lary[bsr][index];
 }
 
-// --- atf_amc.FDb.csl_h_typec_curs.Next
-// proceed to next item
-inline void atf_amc::_db_csl_h_typec_curs_Next(_db_csl_h_typec_curs &curs) {
-    curs.row = (*curs.row).csl_h_typec_next;
-    if (curs.row == curs.head) {
-        curs.row = NULL;
-    }
+// --- atf_amc.FDb.colrow.price_qFind
+// 'quick' Access value of column price by row id. No bounds checking.
+inline double& atf_amc::colrow_price_qFind(i32 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.colrow_price_lary[bsr][index];
 }
 
-// --- atf_amc.FDb.csl_h_typec_curs.Access
+// --- atf_amc.FDb.colrow.qty_qFind
+// 'quick' Access value of column qty by row id. No bounds checking.
+inline i32& atf_amc::colrow_qty_qFind(i32 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.colrow_qty_lary[bsr][index];
+}
+
+// --- atf_amc.FDb.heaprow.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::heaprow_EmptyQ() {
+    return _db.heaprow_n == 0;
+}
+
+// --- atf_amc.FDb.heaprow.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_amc::FHeaprow* atf_amc::heaprow_Find(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    atf_amc::FHeaprow *retval = NULL;
+    if (LIKELY(x <= u64(_db.heaprow_n))) {
+        retval = &_db.heaprow_lary[bsr][index];
+    }
+    return retval;
+}
+
+// --- atf_amc.FDb.heaprow.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline atf_amc::FHeaprow* atf_amc::heaprow_Last() {
+    return heaprow_Find(u64(_db.heaprow_n-1));
+}
+
+// --- atf_amc.FDb.heaprow.N
+// Return number of items in the pool
+inline i32 atf_amc::heaprow_N() {
+    return _db.heaprow_n;
+}
+
+// --- atf_amc.FDb.heaprow.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline atf_amc::FHeaprow& atf_amc::heaprow_qFind(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.heaprow_lary[bsr][index];
+}
+
+// --- atf_amc.FDb.bh_heaprow.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::bh_heaprow_EmptyQ() {
+    return _db.bh_heaprow_n == 0;
+}
+
+// --- atf_amc.FDb.bh_heaprow.First
+// If index empty, return NULL. Otherwise return pointer to first element in index
+inline atf_amc::FHeaprow* atf_amc::bh_heaprow_First() {
+    atf_amc::FHeaprow *row = NULL;
+    if (_db.bh_heaprow_n > 0) {
+        row = _db.bh_heaprow_elems[0];
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.bh_heaprow.InBheapQ
+// Return true if row is in index, false otherwise
+inline bool atf_amc::bh_heaprow_InBheapQ(atf_amc::FHeaprow& row) {
+    bool result = false;
+    result = row.bh_heaprow_idx != -1;
+    return result;
+}
+
+// --- atf_amc.FDb.bh_heaprow.N
+// Return number of items in the heap
+inline i32 atf_amc::bh_heaprow_N() {
+    return _db.bh_heaprow_n;
+}
+
+// --- atf_amc.FDb.bh_heaprow.unordcurs_Reset
+inline void atf_amc::_db_bh_heaprow_unordcurs_Reset(_db_bh_heaprow_unordcurs &unordcurs, atf_amc::FDb &parent) {
+    unordcurs.elems = parent.bh_heaprow_elems;
+    unordcurs.n_elems = parent.bh_heaprow_n;
+    unordcurs.index = 0;
+}
+
+// --- atf_amc.FDb.bh_heaprow.unordcurs_ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_bh_heaprow_unordcurs_ValidQ(_db_bh_heaprow_unordcurs &unordcurs) {
+    return unordcurs.index < unordcurs.n_elems;
+}
+
+// --- atf_amc.FDb.bh_heaprow.unordcurs_Next
+// proceed to next item
+inline void atf_amc::_db_bh_heaprow_unordcurs_Next(_db_bh_heaprow_unordcurs &unordcurs) {
+    unordcurs.index++;
+}
+
+// --- atf_amc.FDb.bh_heaprow.unordcurs_Access
+// item access
+inline atf_amc::FHeaprow& atf_amc::_db_bh_heaprow_unordcurs_Access(_db_bh_heaprow_unordcurs &unordcurs) {
+    return *unordcurs.elems[unordcurs.index];
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::bh_heaprow_inl_EmptyQ() {
+    return _db.bh_heaprow_inl_n == 0;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.First
+// If index empty, return NULL. Otherwise return pointer to first element in index
+inline atf_amc::FHeaprow* atf_amc::bh_heaprow_inl_First() {
+    atf_amc::FHeaprow *row = NULL;
+    if (_db.bh_heaprow_inl_n > 0) {
+        row = _db.bh_heaprow_inl_elems[0].row;
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.InBheapQ
+// Return true if row is in index, false otherwise
+inline bool atf_amc::bh_heaprow_inl_InBheapQ(atf_amc::FHeaprow& row) {
+    bool result = false;
+    result = row.bh_heaprow_inl_idx != -1;
+    return result;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.N
+// Return number of items in the heap
+inline i32 atf_amc::bh_heaprow_inl_N() {
+    return _db.bh_heaprow_inl_n;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.unordcurs_Reset
+inline void atf_amc::_db_bh_heaprow_inl_unordcurs_Reset(_db_bh_heaprow_inl_unordcurs &unordcurs, atf_amc::FDb &parent) {
+    unordcurs.elems = parent.bh_heaprow_inl_elems;
+    unordcurs.n_elems = parent.bh_heaprow_inl_n;
+    unordcurs.index = 0;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.unordcurs_ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_bh_heaprow_inl_unordcurs_ValidQ(_db_bh_heaprow_inl_unordcurs &unordcurs) {
+    return unordcurs.index < unordcurs.n_elems;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.unordcurs_Next
+// proceed to next item
+inline void atf_amc::_db_bh_heaprow_inl_unordcurs_Next(_db_bh_heaprow_inl_unordcurs &unordcurs) {
+    unordcurs.index++;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl.unordcurs_Access
+// item access
+inline atf_amc::FHeaprow& atf_amc::_db_bh_heaprow_inl_unordcurs_Access(_db_bh_heaprow_inl_unordcurs &unordcurs) {
+    return *unordcurs.elems[unordcurs.index].row;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::bh_heaprow_ptr_EmptyQ() {
+    return _db.bh_heaprow_ptr_n == 0;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.First
+// If index empty, return NULL. Otherwise return pointer to first element in index
+inline atf_amc::FHeaprow* atf_amc::bh_heaprow_ptr_First() {
+    atf_amc::FHeaprow *row = NULL;
+    if (_db.bh_heaprow_ptr_n > 0) {
+        row = _db.bh_heaprow_ptr_elems[0];
+    }
+    return row;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.InBheapQ
+// Return true if row is in index, false otherwise
+inline bool atf_amc::bh_heaprow_ptr_InBheapQ(atf_amc::FHeaprow& row) {
+    bool result = false;
+    result = row.bh_heaprow_ptr_idx != -1;
+    return result;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr.N
+// Return number of items in the heap
+inline i32 atf_amc::bh_heaprow_ptr_N() {
+    return _db.bh_heaprow_ptr_n;
+}
+
+// --- atf_amc.FDb.hugerow.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::hugerow_EmptyQ() {
+    return _db.hugerow_n == 0;
+}
+
+// --- atf_amc.FDb.hugerow.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_amc::FHugerow* atf_amc::hugerow_Find(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    atf_amc::FHugerow *retval = NULL;
+    if (LIKELY(x <= u64(_db.hugerow_n))) {
+        retval = &_db.hugerow_lary[bsr][index];
+    }
+    return retval;
+}
+
+// --- atf_amc.FDb.hugerow.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline atf_amc::FHugerow* atf_amc::hugerow_Last() {
+    return hugerow_Find(u64(_db.hugerow_n-1));
+}
+
+// --- atf_amc.FDb.hugerow.N
+// Return number of items in the pool
+inline i32 atf_amc::hugerow_N() {
+    return _db.hugerow_n;
+}
+
+// --- atf_amc.FDb.hugerow.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline atf_amc::FHugerow& atf_amc::hugerow_qFind(u64 t) {
+    u64 x = t + 1;
+    u64 bsr   = algo::u64_BitScanReverse(x);
+    u64 base  = u64(1)<<bsr;
+    u64 index = x-base;
+    return _db.hugerow_lary[bsr][index];
+}
+
+// --- atf_amc.FDb.ind_hugerow.EmptyQ
+// Return true if hash is empty
+inline bool atf_amc::ind_hugerow_EmptyQ() {
+    return _db.ind_hugerow_n == 0;
+}
+
+// --- atf_amc.FDb.ind_hugerow.N
+// Return number of items in the hash
+inline i32 atf_amc::ind_hugerow_N() {
+    return _db.ind_hugerow_n;
+}
+
+// --- atf_amc.FDb.ind_hugerow_thp.EmptyQ
+// Return true if hash is empty
+inline bool atf_amc::ind_hugerow_thp_EmptyQ() {
+    return _db.ind_hugerow_thp_n == 0;
+}
+
+// --- atf_amc.FDb.ind_hugerow_thp.N
+// Return number of items in the hash
+inline i32 atf_amc::ind_hugerow_thp_N() {
+    return _db.ind_hugerow_thp_n;
+}
+
+// --- atf_amc.FDb.bh_typec_curs.Access
+// Access current element. If not more elements, return NULL
+inline atf_amc::FTypeC& atf_amc::_db_bh_typec_curs_Access(_db_bh_typec_curs &curs) {
+    return *curs.temp_elems[0];
+}
+
+// --- atf_amc.FDb.bh_typec_curs.ValidQ
+// Return true if Access() will return non-NULL.
+inline bool atf_amc::_db_bh_typec_curs_ValidQ(_db_bh_typec_curs &curs) {
+    return curs.temp_n > 0;
+}
+
+// --- atf_amc.FDb.zdl_h_typec_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_zdl_h_typec_curs_Reset(_db_zdl_h_typec_curs &curs, atf_amc::FDb &parent) {
+    curs.row = parent.zdl_h_typec_head;
+}
+
+// --- atf_amc.FDb.zdl_h_typec_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_zdl_h_typec_curs_ValidQ(_db_zdl_h_typec_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- atf_amc.FDb.zdl_h_typec_curs.Next
+// proceed to next item
+inline void atf_amc::_db_zdl_h_typec_curs_Next(_db_zdl_h_typec_curs &curs) {
+    curs.row = (*curs.row).zdl_h_typec_next;
+}
+
+// --- atf_amc.FDb.zdl_h_typec_curs.Access
+// item access
+inline atf_amc::FTypeC& atf_amc::_db_zdl_h_typec_curs_Access(_db_zdl_h_typec_curs &curs) {
+    return *curs.row;
+}
+
+// --- atf_amc.FDb.zd_t_typec_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_zd_t_typec_curs_Reset(_db_zd_t_typec_curs &curs, atf_amc::FDb &parent) {
+    curs.row = parent.zd_t_typec_head;
+}
+
+// --- atf_amc.FDb.zd_t_typec_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_zd_t_typec_curs_ValidQ(_db_zd_t_typec_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- atf_amc.FDb.zd_t_typec_curs.Next
+// proceed to next item
+inline void atf_amc::_db_zd_t_typec_curs_Next(_db_zd_t_typec_curs &curs) {
+    curs.row = (*curs.row).zd_t_typec_next;
+}
+
+// --- atf_amc.FDb.zd_t_typec_curs.Access
+// item access
+inline atf_amc::FTypeC& atf_amc::_db_zd_t_typec_curs_Access(_db_zd_t_typec_curs &curs) {
+    return *curs.row;
+}
+
+// --- atf_amc.FDb.zsl_h_typec_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_zsl_h_typec_curs_Reset(_db_zsl_h_typec_curs &curs, atf_amc::FDb &parent) {
+    curs.row = parent.zsl_h_typec_head;
+}
+
+// --- atf_amc.FDb.zsl_h_typec_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_zsl_h_typec_curs_ValidQ(_db_zsl_h_typec_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- atf_amc.FDb.zsl_h_typec_curs.Next
+// proceed to next item
+inline void atf_amc::_db_zsl_h_typec_curs_Next(_db_zsl_h_typec_curs &curs) {
+    curs.row = (*curs.row).zsl_h_typec_next;
+}
+
+// --- atf_amc.FDb.zsl_h_typec_curs.Access
+// item access
+inline atf_amc::FTypeC& atf_amc::_db_zsl_h_typec_curs_Access(_db_zsl_h_typec_curs &curs) {
+    return *curs.row;
+}
+
+// --- atf_amc.FDb.zs_t_typec_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_zs_t_typec_curs_Reset(_db_zs_t_typec_curs &curs, atf_amc::FDb &parent) {
+    curs.row = parent.zs_t_typec_head;
+}
+
+// --- atf_amc.FDb.zs_t_typec_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_zs_t_typec_curs_ValidQ(_db_zs_t_typec_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- atf_amc.FDb.zs_t_typec_curs.Next
+// proceed to next item
+inline void atf_amc::_db_zs_t_typec_curs_Next(_db_zs_t_typec_curs &curs) {
+    curs.row = (*curs.row).zs_t_typec_next;
+}
+
+// --- atf_amc.FDb.zs_t_typec_curs.Access
+// item access
+inline atf_amc::FTypeC& atf_amc::_db_zs_t_typec_curs_Access(_db_zs_t_typec_curs &curs) {
+    return *curs.row;
+}
+
+// --- atf_amc.FDb.zdl_hnt_typec_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_zdl_hnt_typec_curs_Reset(_db_zdl_hnt_typec_curs &curs, atf_amc::FDb &parent) {
+    curs.row = parent.zdl_hnt_typec_head;
+}
+
+// --- atf_amc.FDb.zdl_hnt_typec_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_zdl_hnt_typec_curs_ValidQ(_db_zdl_hnt_typec_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- atf_amc.FDb.zdl_hnt_typec_curs.Next
+// proceed to next item
+inline void atf_amc::_db_zdl_hnt_typec_curs_Next(_db_zdl_hnt_typec_curs &curs) {
+    curs.row = (*curs.row).zdl_hnt_typec_next;
+}
+
+// --- atf_amc.FDb.zdl_hnt_typec_curs.Access
+// item access
+inline atf_amc::FTypeC& atf_amc::_db_zdl_hnt_typec_curs_Access(_db_zdl_hnt_typec_curs &curs) {
+    return *curs.row;
+}
+
+// --- atf_amc.FDb.cdl_h_typec_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_cdl_h_typec_curs_Reset(_db_cdl_h_typec_curs &curs, atf_amc::FDb &parent) {
+    curs.row = parent.cdl_h_typec_head;
+    curs.head = parent.cdl_h_typec_head;
+}
+
+// --- atf_amc.FDb.cdl_h_typec_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_cdl_h_typec_curs_ValidQ(_db_cdl_h_typec_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- atf_amc.FDb.cdl_h_typec_curs.Next
+// proceed to next item
+inline void atf_amc::_db_cdl_h_typec_curs_Next(_db_cdl_h_typec_curs &curs) {
+    curs.row = (*curs.row).cdl_h_typec_next;
+    if (curs.row == curs.head) {
+        curs.row = NULL;
+    }
+}
+
+// --- atf_amc.FDb.cdl_h_typec_curs.Access
+// item access
+inline atf_amc::FTypeC& atf_amc::_db_cdl_h_typec_curs_Access(_db_cdl_h_typec_curs &curs) {
+    return *curs.row;
+}
+
+// --- atf_amc.FDb.cd_t_typec_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_cd_t_typec_curs_Reset(_db_cd_t_typec_curs &curs, atf_amc::FDb &parent) {
+    curs.row = parent.cd_t_typec_head;
+    curs.head = parent.cd_t_typec_head;
+}
+
+// --- atf_amc.FDb.cd_t_typec_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_cd_t_typec_curs_ValidQ(_db_cd_t_typec_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- atf_amc.FDb.cd_t_typec_curs.Next
+// proceed to next item
+inline void atf_amc::_db_cd_t_typec_curs_Next(_db_cd_t_typec_curs &curs) {
+    curs.row = (*curs.row).cd_t_typec_next;
+    if (curs.row == curs.head) {
+        curs.row = NULL;
+    }
+}
+
+// --- atf_amc.FDb.cd_t_typec_curs.Access
+// item access
+inline atf_amc::FTypeC& atf_amc::_db_cd_t_typec_curs_Access(_db_cd_t_typec_curs &curs) {
+    return *curs.row;
+}
+
+// --- atf_amc.FDb.csl_h_typec_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_csl_h_typec_curs_Reset(_db_csl_h_typec_curs &curs, atf_amc::FDb &parent) {
+    curs.row = parent.csl_h_typec_head;
+    curs.head = parent.csl_h_typec_head;
+}
+
+// --- atf_amc.FDb.csl_h_typec_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_csl_h_typec_curs_ValidQ(_db_csl_h_typec_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- atf_amc.FDb.csl_h_typec_curs.Next
+// proceed to next item
+inline void atf_amc::_db_csl_h_typec_curs_Next(_db_csl_h_typec_curs &curs) {
+    curs.row = (*curs.row).csl_h_typec_next;
+    if (curs.row == curs.head) {
+        curs.row = NULL;
+    }
+}
+
+// --- atf_amc.FDb.csl_h_typec_curs.Access
+// item access
+inline atf_amc::FTypeC& atf_amc::_db_csl_h_typec_curs_Access(_db_csl_h_typec_curs &curs) {
+    return *curs.row;
+}
+
+// --- atf_amc.FDb.cs_t_typec_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_cs_t_typec_curs_Reset(_db_cs_t_typec_curs &curs, atf_amc::FDb &parent) {
+    curs.row = parent.cs_t_typec_head;
+    curs.head = parent.cs_t_typec_head;
+}
+
+// --- atf_amc.FDb.cs_t_typec_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_cs_t_typec_curs_ValidQ(_db_cs_t_typec_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- atf_amc.FDb.cs_t_typec_curs.Next
+// proceed to next item
+inline void atf_amc::_db_cs_t_typec_curs_Next(_db_cs_t_typec_curs &curs) {
+    curs.row = (*curs.row).cs_t_typec_next;
+    if (curs.row == curs.head) {
+        curs.row = NULL;
+    }
+}
+
+// --- atf_amc.FDb.cs_t_typec_curs.Access
+// item access
+inline atf_amc::FTypeC& atf_amc::_db_cs_t_typec_curs_Access(_db_cs_t_typec_curs &curs) {
+    return *curs.row;
+}
+
+// --- atf_amc.FDb.typea_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_typea_curs_Reset(_db_typea_curs &curs, atf_amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- atf_amc.FDb.typea_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_typea_curs_ValidQ(_db_typea_curs &curs) {
+    return curs.index < _db.typea_n;
+}
+
+// --- atf_amc.FDb.typea_curs.Next
+// proceed to next item
+inline void atf_amc::_db_typea_curs_Next(_db_typea_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FDb.typea_curs.Access
+// item access
+inline atf_amc::FTypeA& atf_amc::_db_typea_curs_Access(_db_typea_curs &curs) {
+    return typea_qFind(i32(curs.index));
+}
+
+// --- atf_amc.FDb.types_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_types_curs_Reset(_db_types_curs &curs, atf_amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- atf_amc.FDb.types_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_types_curs_ValidQ(_db_types_curs &curs) {
+    return curs.index < _db.types_n;
+}
+
+// --- atf_amc.FDb.types_curs.Next
+// proceed to next item
+inline void atf_amc::_db_types_curs_Next(_db_types_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FDb.types_curs.Access
+// item access
+inline atf_amc::FTypeS& atf_amc::_db_types_curs_Access(_db_types_curs &curs) {
+    return types_qFind(u64(curs.index));
+}
+
+// --- atf_amc.FDb.typet_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_typet_curs_Reset(_db_typet_curs &curs, atf_amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- atf_amc.FDb.typet_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_typet_curs_ValidQ(_db_typet_curs &curs) {
+    return curs.index < _db.typet_n;
+}
+
+// --- atf_amc.FDb.typet_curs.Next
+// proceed to next item
+inline void atf_amc::_db_typet_curs_Next(_db_typet_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FDb.typet_curs.Access
+// item access
+inline atf_amc::FTypeT& atf_amc::_db_typet_curs_Access(_db_typet_curs &curs) {
+    return typet_qFind(u64(curs.index));
+}
+
+// --- atf_amc.FDb.cstring_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_cstring_curs_Reset(_db_cstring_curs &curs, atf_amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- atf_amc.FDb.cstring_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_cstring_curs_ValidQ(_db_cstring_curs &curs) {
+    return curs.index < _db.cstring_n;
+}
+
+// --- atf_amc.FDb.cstring_curs.Next
+// proceed to next item
+inline void atf_amc::_db_cstring_curs_Next(_db_cstring_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FDb.cstring_curs.Access
+// item access
+inline atf_amc::FCstring& atf_amc::_db_cstring_curs_Access(_db_cstring_curs &curs) {
+    return cstring_qFind(u64(curs.index));
+}
+
+// --- atf_amc.FDb.cd_in_msg_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_cd_in_msg_curs_Reset(_db_cd_in_msg_curs &curs, atf_amc::FDb &parent) {
+    curs.row = parent.cd_in_msg_head;
+    curs.head = parent.cd_in_msg_head;
+}
+
+// --- atf_amc.FDb.cd_in_msg_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_cd_in_msg_curs_ValidQ(_db_cd_in_msg_curs &curs) {
+    return curs.row != NULL;
+}
+
+// --- atf_amc.FDb.cd_in_msg_curs.Next
+// proceed to next item
+inline void atf_amc::_db_cd_in_msg_curs_Next(_db_cd_in_msg_curs &curs) {
+    curs.row = (*curs.row).cd_in_msg_next;
+    if (curs.row == curs.head) {
+        curs.row = NULL;
+    }
+}
+
+// --- atf_amc.FDb.cd_in_msg_curs.Access
+// item access
+inline atf_amc::Msgbuf& atf_amc::_db_cd_in_msg_curs_Access(_db_cd_in_msg_curs &curs) {
+    return *curs.row;
+}
+
+// --- atf_amc.FDb.amctest_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_amctest_curs_Reset(_db_amctest_curs &curs, atf_amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- atf_amc.FDb.amctest_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_amctest_curs_ValidQ(_db_amctest_curs &curs) {
+    return curs.index < _db.amctest_n;
+}
+
+// --- atf_amc.FDb.amctest_curs.Next
+// proceed to next item
+inline void atf_amc::_db_amctest_curs_Next(_db_amctest_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FDb.amctest_curs.Access
+// item access
+inline atf_amc::FAmctest& atf_amc::_db_amctest_curs_Access(_db_amctest_curs &curs) {
+    return amctest_qFind(u64(curs.index));
+}
+
+// --- atf_amc.FDb.c_typek_curs.Reset
+inline void atf_amc::_db_c_typek_curs_Reset(_db_c_typek_curs &curs, atf_amc::FDb &parent) {
+    curs.elems = parent.c_typek_elems;
+    curs.n_elems = parent.c_typek_n;
+    curs.index = 0;
+}
+
+// --- atf_amc.FDb.c_typek_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_c_typek_curs_ValidQ(_db_c_typek_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- atf_amc.FDb.c_typek_curs.Next
+// proceed to next item
+inline void atf_amc::_db_c_typek_curs_Next(_db_c_typek_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FDb.c_typek_curs.Access
 // item access
-inline atf_amc::FTypeC& atf_amc::_db_csl_h_typec_curs_Access(_db_csl_h_typec_curs &curs) {
-    return *curs.row;
+inline atf_amc::FTypeK& atf_amc::_db_c_typek_curs_Access(_db_c_typek_curs &curs) {
+    return *curs.elems[curs.index];
 }
 
-// --- atf_amc.FDb.cs_t_typec_curs.Reset
+// --- atf_amc.FDb.avl_curs.Reset
 // cursor points to valid item
-inline void atf_amc::_db_cs_t_typec_curs_Reset(_db_cs_t_typec_curs &curs, atf_amc::FDb &parent) {
-    curs.row = parent.cs_t_typec_head;
-    curs.head = parent.cs_t_typec_head;
+inline void atf_amc::_db_avl_curs_Reset(_db_avl_curs &curs, atf_amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
 }
 
-// --- atf_amc.FDb.cs_t_typec_curs.ValidQ
+// --- atf_amc.FDb.avl_curs.ValidQ
 // cursor points to valid item
-inline bool atf_amc::_db_cs_t_typec_curs_ValidQ(_db_cs_t_typec_curs &curs) {
+inline bool atf_amc::_db_avl_curs_ValidQ(_db_avl_curs &curs) {
+    return curs.index < _db.avl_n;
+}
+
+// --- atf_amc.FDb.avl_curs.Next
+// proceed to next item
+inline void atf_amc::_db_avl_curs_Next(_db_avl_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FDb.avl_curs.Access
+// item access
+inline atf_amc::FAvl& atf_amc::_db_avl_curs_Access(_db_avl_curs &curs) {
+    return avl_qFind(u64(curs.index));
+}
+
+// --- atf_amc.FDb.tr_avl_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_tr_avl_curs_Reset(_db_tr_avl_curs &curs, atf_amc::FDb& ) {
+    curs.row = tr_avl_First();
+}
+
+// --- atf_amc.FDb.tr_avl_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_tr_avl_curs_ValidQ(_db_tr_avl_curs &curs) {
     return curs.row != NULL;
 }
 
-// --- atf_amc.FDb.cs_t_typec_curs.Next
+// --- atf_amc.FDb.tr_avl_curs.Next
 // proceed to next item
-inline void atf_amc::_db_cs_t_typec_curs_Next(_db_cs_t_typec_curs &curs) {
-    curs.row = (*curs.row).cs_t_typec_next;
-    if (curs.row == curs.head) {
-        curs.row = NULL;
-    }
+inline void atf_amc::_db_tr_avl_curs_Next(_db_tr_avl_curs &curs) {
+    curs.row = tr_avl_Next(*curs.row);
 }
 
-// --- atf_amc.FDb.cs_t_typec_curs.Access
+// --- atf_amc.FDb.tr_avl_curs.Access
 // item access
-inline atf_amc::FTypeC& atf_amc::_db_cs_t_typec_curs_Access(_db_cs_t_typec_curs &curs) {
+inline atf_amc::FAvl& atf_amc::_db_tr_avl_curs_Access(_db_tr_avl_curs &curs) {
     return *curs.row;
 }
 
-// --- atf_amc.FDb.typea_curs.Reset
+// --- atf_amc.FDb.listtype_curs.Reset
 // cursor points to valid item
-inline void atf_amc::_db_typea_curs_Reset(_db_typea_curs &curs, atf_amc::FDb &parent) {
+inline void atf_amc::_db_listtype_curs_Reset(_db_listtype_curs &curs, atf_amc::FDb &parent) {
     curs.parent = &parent;
     curs.index = 0;
 }
 
-// --- atf_amc.FDb.typea_curs.ValidQ
+// --- atf_amc.FDb.listtype_curs.ValidQ
 // cursor points to valid item
-inline bool atf_amc::_db_typea_curs_ValidQ(_db_typea_curs &curs) {
-    return curs.index < _db.typea_n;
+inline bool atf_amc::_db_listtype_curs_ValidQ(_db_listtype_curs &curs) {
+    return u64(curs.index) < u64(curs.parent->listtype_n);
 }
 
-// --- atf_amc.FDb.typea_curs.Next
+// --- atf_amc.FDb.listtype_curs.Next
 // proceed to next item
-inline void atf_amc::_db_typea_curs_Next(_db_typea_curs &curs) {
+inline void atf_amc::_db_listtype_curs_Next(_db_listtype_curs &curs) {
     curs.index++;
 }
 
-// --- atf_amc.FDb.typea_curs.Access
+// --- atf_amc.FDb.listtype_curs.Access
 // item access
-inline atf_amc::FTypeA& atf_amc::_db_typea_curs_Access(_db_typea_curs &curs) {
-    return typea_qFind(i32(curs.index));
+inline atf_amc::FListtype& atf_amc::_db_listtype_curs_Access(_db_listtype_curs &curs) {
+    return listtype_qFind(u64(curs.index));
 }
 
-// --- atf_amc.FDb.types_curs.Reset
+// --- atf_amc.FDb.hashrow_curs.Reset
 // cursor points to valid item
-inline void atf_amc::_db_types_curs_Reset(_db_types_curs &curs, atf_amc::FDb &parent) {
+inline void atf_amc::_db_hashrow_curs_Reset(_db_hashrow_curs &curs, atf_amc::FDb &parent) {
     curs.parent = &parent;
     curs.index = 0;
 }
 
-// --- atf_amc.FDb.types_curs.ValidQ
+// --- atf_amc.FDb.hashrow_curs.ValidQ
 // cursor points to valid item
-inline bool atf_amc::_db_types_curs_ValidQ(_db_types_curs &curs) {
-    return curs.index < _db.types_n;
+inline bool atf_amc::_db_hashrow_curs_ValidQ(_db_hashrow_curs &curs) {
+    return curs.index < _db.hashrow_n;
 }
 
-// --- atf_amc.FDb.types_curs.Next
+// --- atf_amc.FDb.hashrow_curs.Next
 // proceed to next item
-inline void atf_amc::_db_types_curs_Next(_db_types_curs &curs) {
+inline void atf_amc::_db_hashrow_curs_Next(_db_hashrow_curs &curs) {
     curs.index++;
 }
 
-// --- atf_amc.FDb.types_curs.Access
+// --- atf_amc.FDb.hashrow_curs.Access
 // item access
-inline atf_amc::FTypeS& atf_amc::_db_types_curs_Access(_db_types_curs &curs) {
-    return types_qFind(u64(curs.index));
+inline atf_amc::FHashrow& atf_amc::_db_hashrow_curs_Access(_db_hashrow_curs &curs) {
+    return hashrow_qFind(u64(curs.index));
 }
 
-// --- atf_amc.FDb.typet_curs.Reset
+// --- atf_amc.FDb.ind_hashrow_curs.ValidQ
 // cursor points to valid item
-inline void atf_amc::_db_typet_curs_Reset(_db_typet_curs &curs, atf_amc::FDb &parent) {
+inline bool atf_amc::_db_ind_hashrow_curs_ValidQ(_db_ind_hashrow_curs &curs) {
+    return *curs.prow != NULL;
+}
+
+// --- atf_amc.FDb.ind_hashrow_curs.Next
+// proceed to next item
+inline void atf_amc::_db_ind_hashrow_curs_Next(_db_ind_hashrow_curs &curs) {
+    curs.prow = &(*curs.prow)->ind_hashrow_next;
+    while (!*curs.prow) {
+        curs.bucket += 1;
+        if (curs.bucket >= curs.parent->ind_hashrow_buckets_n) break;
+        curs.prow = &curs.parent->ind_hashrow_buckets_elems[curs.bucket];
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_curs.Access
+// item access
+inline atf_amc::FHashrow& atf_amc::_db_ind_hashrow_curs_Access(_db_ind_hashrow_curs &curs) {
+    return **curs.prow;
+}
+
+// --- atf_amc.FDb.ind_hashrow_oa_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_ind_hashrow_oa_curs_ValidQ(_db_ind_hashrow_oa_curs &curs) {
+    return curs.index < curs.parent->ind_hashrow_oa_slots_n;
+}
+
+// --- atf_amc.FDb.ind_hashrow_oa_curs.Next
+// proceed to next item
+inline void atf_amc::_db_ind_hashrow_oa_curs_Next(_db_ind_hashrow_oa_curs &curs) {
+    curs.index += 1;
+    while (curs.index < curs.parent->ind_hashrow_oa_slots_n && !curs.parent->ind_hashrow_oa_slots_elems[curs.index].row) {
+        curs.index += 1;
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_oa_curs.Access
+// item access
+inline atf_amc::FHashrow& atf_amc::_db_ind_hashrow_oa_curs_Access(_db_ind_hashrow_oa_curs &curs) {
+    return *(atf_amc::FHashrow*)curs.parent->ind_hashrow_oa_slots_elems[curs.index].row;
+}
+
+// --- atf_amc.FDb.ind_hashrow_incr_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_ind_hashrow_incr_curs_ValidQ(_db_ind_hashrow_incr_curs &curs) {
+    return *curs.prow != NULL;
+}
+
+// --- atf_amc.FDb.ind_hashrow_incr_curs.Next
+// proceed to next item
+inline void atf_amc::_db_ind_hashrow_incr_curs_Next(_db_ind_hashrow_incr_curs &curs) {
+    curs.prow = &(*curs.prow)->ind_hashrow_incr_next;
+    while (!*curs.prow) {
+        curs.bucket += 1;
+        if (curs.bucket >= curs.parent->ind_hashrow_incr_buckets_n + curs.parent->ind_hashrow_incr_old_n) break;
+        curs.prow = curs.bucket < curs.parent->ind_hashrow_incr_buckets_n ? &curs.parent->ind_hashrow_incr_buckets_elems[curs.bucket] : &curs.parent->ind_hashrow_incr_old_elems[curs.bucket - curs.parent->ind_hashrow_incr_buckets_n];
+    }
+}
+
+// --- atf_amc.FDb.ind_hashrow_incr_curs.Access
+// item access
+inline atf_amc::FHashrow& atf_amc::_db_ind_hashrow_incr_curs_Access(_db_ind_hashrow_incr_curs &curs) {
+    return **curs.prow;
+}
+
+// --- atf_amc.FDb.treerow_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_treerow_curs_Reset(_db_treerow_curs &curs, atf_amc::FDb &parent) {
     curs.parent = &parent;
     curs.index = 0;
 }
 
-// --- atf_amc.FDb.typet_curs.ValidQ
+// --- atf_amc.FDb.treerow_curs.ValidQ
 // cursor points to valid item
-inline bool atf_amc::_db_typet_curs_ValidQ(_db_typet_curs &curs) {
-    return curs.index < _db.typet_n;
+inline bool atf_amc::_db_treerow_curs_ValidQ(_db_treerow_curs &curs) {
+    return curs.index < _db.treerow_n;
 }
 
-// --- atf_amc.FDb.typet_curs.Next
+// --- atf_amc.FDb.treerow_curs.Next
 // proceed to next item
-inline void atf_amc::_db_typet_curs_Next(_db_typet_curs &curs) {
+inline void atf_amc::_db_treerow_curs_Next(_db_treerow_curs &curs) {
     curs.index++;
 }
 
-// --- atf_amc.FDb.typet_curs.Access
+// --- atf_amc.FDb.treerow_curs.Access
 // item access
-inline atf_amc::FTypeT& atf_amc::_db_typet_curs_Access(_db_typet_curs &curs) {
-    return typet_qFind(u64(curs.index));
+inline atf_amc::FTreerow& atf_amc::_db_treerow_curs_Access(_db_treerow_curs &curs) {
+    return treerow_qFind(u64(curs.index));
 }
 
-// --- atf_amc.FDb.cstring_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_cstring_curs_Reset(_db_cstring_curs &curs, atf_amc::FDb &parent) {
-    curs.parent = &parent;
+// --- atf_amc.FDb.bt_treerow_curs.Reset
+// position cursor at the first row
+inline void atf_amc::_db_bt_treerow_curs_Reset(_db_bt_treerow_curs &curs, atf_amc::FDb& parent) {
+    _db_bt_treerow_node *node = parent.bt_treerow_root;
+    while (node && !node->leaf) {
+        node = node->child[0];
+    }
+    curs.node  = node;
     curs.index = 0;
 }
 
-// --- atf_amc.FDb.cstring_curs.ValidQ
+// --- atf_amc.FDb.bt_treerow_curs.ValidQ
 // cursor points to valid item
-inline bool atf_amc::_db_cstring_curs_ValidQ(_db_cstring_curs &curs) {
-    return curs.index < _db.cstring_n;
+inline bool atf_amc::_db_bt_treerow_curs_ValidQ(_db_bt_treerow_curs &curs) {
+    return curs.node != NULL;
 }
 
-// --- atf_amc.FDb.cstring_curs.Next
+// --- atf_amc.FDb.bt_treerow_curs.Next
 // proceed to next item
-inline void atf_amc::_db_cstring_curs_Next(_db_cstring_curs &curs) {
+inline void atf_amc::_db_bt_treerow_curs_Next(_db_bt_treerow_curs &curs) {
     curs.index++;
+    if (curs.index == curs.node->n) {
+        curs.node  = curs.node->next;
+        curs.index = 0;
+    }
 }
 
-// --- atf_amc.FDb.cstring_curs.Access
+// --- atf_amc.FDb.bt_treerow_curs.Access
 // item access
-inline atf_amc::FCstring& atf_amc::_db_cstring_curs_Access(_db_cstring_curs &curs) {
-    return cstring_qFind(u64(curs.index));
+inline atf_amc::FTreerow& atf_amc::_db_bt_treerow_curs_Access(_db_bt_treerow_curs &curs) {
+    return *curs.node->row[curs.index];
 }
 
-// --- atf_amc.FDb.cd_in_msg_curs.Reset
+// --- atf_amc.FDb.bt_treerow_rcurs.Reset
+// position cursor at the last row
+inline void atf_amc::_db_bt_treerow_rcurs_Reset(_db_bt_treerow_rcurs &curs, atf_amc::FDb& parent) {
+    _db_bt_treerow_node *node = parent.bt_treerow_root;
+    while (node && !node->leaf) {
+        node = node->child[node->n - 1];
+    }
+    curs.node  = node;
+    curs.index = node ? node->n - 1 : 0;
+}
+
+// --- atf_amc.FDb.bt_treerow_rcurs.ValidQ
 // cursor points to valid item
-inline void atf_amc::_db_cd_in_msg_curs_Reset(_db_cd_in_msg_curs &curs, atf_amc::FDb &parent) {
-    curs.row = parent.cd_in_msg_head;
-    curs.head = parent.cd_in_msg_head;
+inline bool atf_amc::_db_bt_treerow_rcurs_ValidQ(_db_bt_treerow_rcurs &curs) {
+    return curs.node != NULL;
 }
 
-// --- atf_amc.FDb.cd_in_msg_curs.ValidQ
+// --- atf_amc.FDb.bt_treerow_rcurs.Next
+// proceed to next item
+inline void atf_amc::_db_bt_treerow_rcurs_Next(_db_bt_treerow_rcurs &curs) {
+    curs.index--;
+    if (curs.index < 0) {
+        curs.node  = curs.node->prev;
+        curs.index = curs.node ? curs.node->n - 1 : 0;
+    }
+}
+
+// --- atf_amc.FDb.bt_treerow_rcurs.Access
+// item access
+inline atf_amc::FTreerow& atf_amc::_db_bt_treerow_rcurs_Access(_db_bt_treerow_rcurs &curs) {
+    return *curs.node->row[curs.index];
+}
+
+// --- atf_amc.FDb.tr_treerow_curs.Reset
 // cursor points to valid item
-inline bool atf_amc::_db_cd_in_msg_curs_ValidQ(_db_cd_in_msg_curs &curs) {
+inline void atf_amc::_db_tr_treerow_curs_Reset(_db_tr_treerow_curs &curs, atf_amc::FDb& ) {
+    curs.row = tr_treerow_First();
+}
+
+// --- atf_amc.FDb.tr_treerow_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_tr_treerow_curs_ValidQ(_db_tr_treerow_curs &curs) {
     return curs.row != NULL;
 }
 
-// --- atf_amc.FDb.cd_in_msg_curs.Next
+// --- atf_amc.FDb.tr_treerow_curs.Next
 // proceed to next item
-inline void atf_amc::_db_cd_in_msg_curs_Next(_db_cd_in_msg_curs &curs) {
-    curs.row = (*curs.row).cd_in_msg_next;
-    if (curs.row == curs.head) {
-        curs.row = NULL;
-    }
+inline void atf_amc::_db_tr_treerow_curs_Next(_db_tr_treerow_curs &curs) {
+    curs.row = tr_treerow_Next(*curs.row);
 }
 
-// --- atf_amc.FDb.cd_in_msg_curs.Access
+// --- atf_amc.FDb.tr_treerow_curs.Access
 // item access
-inline atf_amc::Msgbuf& atf_amc::_db_cd_in_msg_curs_Access(_db_cd_in_msg_curs &curs) {
+inline atf_amc::FTreerow& atf_amc::_db_tr_treerow_curs_Access(_db_tr_treerow_curs &curs) {
     return *curs.row;
 }
 
-// --- atf_amc.FDb.amctest_curs.Reset
+// --- atf_amc.FDb.colrow_curs.Reset
 // cursor points to valid item
-inline void atf_amc::_db_amctest_curs_Reset(_db_amctest_curs &curs, atf_amc::FDb &parent) {
+inline void atf_amc::_db_colrow_curs_Reset(_db_colrow_curs &curs, atf_amc::FDb &parent) {
     curs.parent = &parent;
     curs.index = 0;
 }
 
-// --- atf_amc.FDb.amctest_curs.ValidQ
+// --- atf_amc.FDb.colrow_curs.ValidQ
 // cursor points to valid item
-inline bool atf_amc::_db_amctest_curs_ValidQ(_db_amctest_curs &curs) {
-    return curs.index < _db.amctest_n;
+inline bool atf_amc::_db_colrow_curs_ValidQ(_db_colrow_curs &curs) {
+    return curs.index < _db.colrow_n;
 }
 
-// --- atf_amc.FDb.amctest_curs.Next
+// --- atf_amc.FDb.colrow_curs.Next
 // proceed to next item
-inline void atf_amc::_db_amctest_curs_Next(_db_amctest_curs &curs) {
+inline void atf_amc::_db_colrow_curs_Next(_db_colrow_curs &curs) {
     curs.index++;
 }
 
-// --- atf_amc.FDb.amctest_curs.Access
+// --- atf_amc.FDb.colrow_curs.Access
 // item access
-inline atf_amc::FAmctest& atf_amc::_db_amctest_curs_Access(_db_amctest_curs &curs) {
-    return amctest_qFind(u64(curs.index));
+inline atf_amc::FColrow& atf_amc::_db_colrow_curs_Access(_db_colrow_curs &curs) {
+    return colrow_qFind(i32(curs.index));
 }
 
-// --- atf_amc.FDb.c_typek_curs.Reset
-inline void atf_amc::_db_c_typek_curs_Reset(_db_c_typek_curs &curs, atf_amc::FDb &parent) {
-    curs.elems = parent.c_typek_elems;
-    curs.n_elems = parent.c_typek_n;
+// --- atf_amc.FDb.colrow_price_curs.Reset
+// Position cursor at the value of row 0 in column price
+inline void atf_amc::_db_colrow_price_curs_Reset(_db_colrow_price_curs &curs, atf_amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.elems = _db.colrow_price_lary[0];
     curs.index = 0;
+    curs.i = 0;
+    curs.level = 0;
 }
 
-// --- atf_amc.FDb.c_typek_curs.ValidQ
+// --- atf_amc.FDb.colrow_price_curs.ValidQ
 // cursor points to valid item
-inline bool atf_amc::_db_c_typek_curs_ValidQ(_db_c_typek_curs &curs) {
-    return curs.index < curs.n_elems;
+inline bool atf_amc::_db_colrow_price_curs_ValidQ(_db_colrow_price_curs &curs) {
+    return curs.index < _db.colrow_n;
 }
 
-// --- atf_amc.FDb.c_typek_curs.Next
+// --- atf_amc.FDb.colrow_price_curs.Next
 // proceed to next item
-inline void atf_amc::_db_c_typek_curs_Next(_db_c_typek_curs &curs) {
+inline void atf_amc::_db_colrow_price_curs_Next(_db_colrow_price_curs &curs) {
+    curs.index++;
+    curs.i++;
+    if (curs.i == (i64(1) << curs.level)) {// proceed to next level
+        curs.level++;
+        curs.i = 0;
+        curs.elems = _db.colrow_price_lary[curs.level];
+    }
+}
+
+// --- atf_amc.FDb.colrow_price_curs.Access
+// item access
+inline double& atf_amc::_db_colrow_price_curs_Access(_db_colrow_price_curs &curs) {
+    return curs.elems[curs.i];
+}
+
+// --- atf_amc.FDb.colrow_qty_curs.Reset
+// Position cursor at the value of row 0 in column qty
+inline void atf_amc::_db_colrow_qty_curs_Reset(_db_colrow_qty_curs &curs, atf_amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.elems = _db.colrow_qty_lary[0];
+    curs.index = 0;
+    curs.i = 0;
+    curs.level = 0;
+}
+
+// --- atf_amc.FDb.colrow_qty_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_colrow_qty_curs_ValidQ(_db_colrow_qty_curs &curs) {
+    return curs.index < _db.colrow_n;
+}
+
+// --- atf_amc.FDb.colrow_qty_curs.Next
+// proceed to next item
+inline void atf_amc::_db_colrow_qty_curs_Next(_db_colrow_qty_curs &curs) {
+    curs.index++;
+    curs.i++;
+    if (curs.i == (i64(1) << curs.level)) {// proceed to next level
+        curs.level++;
+        curs.i = 0;
+        curs.elems = _db.colrow_qty_lary[curs.level];
+    }
+}
+
+// --- atf_amc.FDb.colrow_qty_curs.Access
+// item access
+inline i32& atf_amc::_db_colrow_qty_curs_Access(_db_colrow_qty_curs &curs) {
+    return curs.elems[curs.i];
+}
+
+// --- atf_amc.FDb.heaprow_curs.Reset
+// cursor points to valid item
+inline void atf_amc::_db_heaprow_curs_Reset(_db_heaprow_curs &curs, atf_amc::FDb &parent) {
+    curs.parent = &parent;
+    curs.index = 0;
+}
+
+// --- atf_amc.FDb.heaprow_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::_db_heaprow_curs_ValidQ(_db_heaprow_curs &curs) {
+    return curs.index < _db.heaprow_n;
+}
+
+// --- atf_amc.FDb.heaprow_curs.Next
+// proceed to next item
+inline void atf_amc::_db_heaprow_curs_Next(_db_heaprow_curs &curs) {
     curs.index++;
 }
 
-// --- atf_amc.FDb.c_typek_curs.Access
-// item access
-inline atf_amc::FTypeK& atf_amc::_db_c_typek_curs_Access(_db_c_typek_curs &curs) {
-    return *curs.elems[curs.index];
+// --- atf_amc.FDb.heaprow_curs.Access
+// item access
+inline atf_amc::FHeaprow& atf_amc::_db_heaprow_curs_Access(_db_heaprow_curs &curs) {
+    return heaprow_qFind(u64(curs.index));
+}
+
+// --- atf_amc.FDb.bh_heaprow_curs.Access
+// Access current element. If not more elements, return NULL
+inline atf_amc::FHeaprow& atf_amc::_db_bh_heaprow_curs_Access(_db_bh_heaprow_curs &curs) {
+    return *curs.temp_elems[0];
+}
+
+// --- atf_amc.FDb.bh_heaprow_curs.ValidQ
+// Return true if Access() will return non-NULL.
+inline bool atf_amc::_db_bh_heaprow_curs_ValidQ(_db_bh_heaprow_curs &curs) {
+    return curs.temp_n > 0;
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl_curs.Access
+// Access current element. If not more elements, return NULL
+inline atf_amc::FHeaprow& atf_amc::_db_bh_heaprow_inl_curs_Access(_db_bh_heaprow_inl_curs &curs) {
+    return *curs.temp_elems[0];
+}
+
+// --- atf_amc.FDb.bh_heaprow_inl_curs.ValidQ
+// Return true if Access() will return non-NULL.
+inline bool atf_amc::_db_bh_heaprow_inl_curs_ValidQ(_db_bh_heaprow_inl_curs &curs) {
+    return curs.temp_n > 0;
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr_curs.Access
+// Access current element. If not more elements, return NULL
+inline atf_amc::FHeaprow& atf_amc::_db_bh_heaprow_ptr_curs_Access(_db_bh_heaprow_ptr_curs &curs) {
+    return *curs.temp_elems[0];
+}
+
+// --- atf_amc.FDb.bh_heaprow_ptr_curs.ValidQ
+// Return true if Access() will return non-NULL.
+inline bool atf_amc::_db_bh_heaprow_ptr_curs_ValidQ(_db_bh_heaprow_ptr_curs &curs) {
+    return curs.temp_n > 0;
 }
 
-// --- atf_amc.FDb.avl_curs.Reset
+// --- atf_amc.FDb.hugerow_curs.Reset
 // cursor points to valid item
-inline void atf_amc::_db_avl_curs_Reset(_db_avl_curs &curs, atf_amc::FDb &parent) {
+inline void atf_amc::_db_hugerow_curs_Reset(_db_hugerow_curs &curs, atf_amc::FDb &parent) {
     curs.parent = &parent;
     curs.index = 0;
 }
 
-// --- atf_amc.FDb.avl_curs.ValidQ
+// --- atf_amc.FDb.hugerow_curs.ValidQ
 // cursor points to valid item
-inline bool atf_amc::_db_avl_curs_ValidQ(_db_avl_curs &curs) {
-    return curs.index < _db.avl_n;
+inline bool atf_amc::_db_hugerow_curs_ValidQ(_db_hugerow_curs &curs) {
+    return curs.index < _db.hugerow_n;
 }
 
-// --- atf_amc.FDb.avl_curs.Next
+// --- atf_amc.FDb.hugerow_curs.Next
 // proceed to next item
-inline void atf_amc::_db_avl_curs_Next(_db_avl_curs &curs) {
+inline void atf_amc::_db_hugerow_curs_Next(_db_hugerow_curs &curs) {
     curs.index++;
 }
 
-// --- atf_amc.FDb.avl_curs.Access
+// --- atf_amc.FDb.hugerow_curs.Access
 // item access
-inline atf_amc::FAvl& atf_amc::_db_avl_curs_Access(_db_avl_curs &curs) {
-    return avl_qFind(u64(curs.index));
+inline atf_amc::FHugerow& atf_amc::_db_hugerow_curs_Access(_db_hugerow_curs &curs) {
+    return hugerow_qFind(u64(curs.index));
 }
-
-// --- atf_amc.FDb.tr_avl_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_tr_avl_curs_Reset(_db_tr_avl_curs &curs, atf_amc::FDb& ) {
-    curs.row = tr_avl_First();
+inline atf_amc::FHashrow::FHashrow() {
+    atf_amc::FHashrow_Init(*this);
 }
 
-// --- atf_amc.FDb.tr_avl_curs.ValidQ
-// cursor points to valid item
-inline bool atf_amc::_db_tr_avl_curs_ValidQ(_db_tr_avl_curs &curs) {
-    return curs.row != NULL;
+inline atf_amc::FHashrow::~FHashrow() {
+    atf_amc::FHashrow_Uninit(*this);
 }
 
-// --- atf_amc.FDb.tr_avl_curs.Next
-// proceed to next item
-inline void atf_amc::_db_tr_avl_curs_Next(_db_tr_avl_curs &curs) {
-    curs.row = tr_avl_Next(*curs.row);
+
+// --- atf_amc.FHashrow..Init
+// Set all fields to initial values.
+inline void atf_amc::FHashrow_Init(atf_amc::FHashrow& hashrow) {
+    hashrow.ind_hashrow_next = (atf_amc::FHashrow*)-1; // (atf_amc.FDb.ind_hashrow) not-in-hash
+    hashrow.ind_hashrow_cached_next = (atf_amc::FHashrow*)-1; // (atf_amc.FDb.ind_hashrow_cached) not-in-hash
+    hashrow.ind_hashrow_cached_hashval = 0; // stored hash value
+    hashrow.ind_hashrow_oa_in = false; // (atf_amc.FDb.ind_hashrow_oa) not-in-hash
+    hashrow.ind_hashrow_incr_next = (atf_amc::FHashrow*)-1; // (atf_amc.FDb.ind_hashrow_incr) not-in-hash
+}
+inline atf_amc::FHeaprow::FHeaprow() {
+    atf_amc::FHeaprow_Init(*this);
 }
 
-// --- atf_amc.FDb.tr_avl_curs.Access
-// item access
-inline atf_amc::FAvl& atf_amc::_db_tr_avl_curs_Access(_db_tr_avl_curs &curs) {
-    return *curs.row;
+inline atf_amc::FHeaprow::~FHeaprow() {
+    atf_amc::FHeaprow_Uninit(*this);
 }
 
-// --- atf_amc.FDb.listtype_curs.Reset
-// cursor points to valid item
-inline void atf_amc::_db_listtype_curs_Reset(_db_listtype_curs &curs, atf_amc::FDb &parent) {
-    curs.parent = &parent;
-    curs.index = 0;
+
+// --- atf_amc.FHeaprow..Init
+// Set all fields to initial values.
+inline void atf_amc::FHeaprow_Init(atf_amc::FHeaprow& heaprow) {
+    heaprow.key = u64(0);
+    heaprow.bh_heaprow_idx = -1; // (atf_amc.FDb.bh_heaprow) not-in-heap
+    heaprow.bh_heaprow_inl_idx = -1; // (atf_amc.FDb.bh_heaprow_inl) not-in-heap
+    heaprow.bh_heaprow_ptr_idx = -1; // (atf_amc.FDb.bh_heaprow_ptr) not-in-heap
+}
+inline atf_amc::FHugerow::FHugerow() {
+    atf_amc::FHugerow_Init(*this);
 }
 
-// --- atf_amc.FDb.listtype_curs.ValidQ
-// cursor points to valid item
-inline bool atf_amc::_db_listtype_curs_ValidQ(_db_listtype_curs &curs) {
-    return u64(curs.index) < u64(curs.parent->listtype_n);
+inline atf_amc::FHugerow::~FHugerow() {
+    atf_amc::FHugerow_Uninit(*this);
 }
 
-// --- atf_amc.FDb.listtype_curs.Next
-// proceed to next item
-inline void atf_amc::_db_listtype_curs_Next(_db_listtype_curs &curs) {
-    curs.index++;
+
+// --- atf_amc.FHugerow..Init
+// Set all fields to initial values.
+inline void atf_amc::FHugerow_Init(atf_amc::FHugerow& hugerow) {
+    hugerow.key = u64(0);
+    hugerow.ind_hugerow_next = (atf_amc::FHugerow*)-1; // (atf_amc.FDb.ind_hugerow) not-in-hash
+    hugerow.ind_hugerow_thp_next = (atf_amc::FHugerow*)-1; // (atf_amc.FDb.ind_hugerow_thp) not-in-hash
+}
+inline atf_amc::FMagrow::FMagrow() {
+    atf_amc::FMagrow_Init(*this);
 }
 
-// --- atf_amc.FDb.listtype_curs.Access
-// item access
-inline atf_amc::FListtype& atf_amc::_db_listtype_curs_Access(_db_listtype_curs &curs) {
-    return listtype_qFind(u64(curs.index));
+
+// --- atf_amc.FMagrow..Init
+// Set all fields to initial values.
+inline void atf_amc::FMagrow_Init(atf_amc::FMagrow& magrow) {
+    magrow.owner = i32(0);
+    magrow.seq = i64(0);
+    magrow.magrow_next = (atf_amc::FMagrow*)-1; // (atf_amc.FDb.magrow) not-in-tpool's freelist
 }
 
 inline bool atf_amc::TypeG::operator ==(const atf_amc::TypeG &rhs) const {
@@ -3049,6 +4116,25 @@ inline void atf_amc::FPerfSortString_Init(atf_amc::FPerfSortString& parent) {
     parent.sorted1_n     	= 0; // (atf_amc.FPerfSortString.sorted1)
     parent.sorted1_max   	= 0; // (atf_amc.FPerfSortString.sorted1)
 }
+inline atf_amc::FTreerow::FTreerow() {
+    atf_amc::FTreerow_Init(*this);
+}
+
+inline atf_amc::FTreerow::~FTreerow() {
+    atf_amc::FTreerow_Uninit(*this);
+}
+
+
+// --- atf_amc.FTreerow..Init
+// Set all fields to initial values.
+inline void atf_amc::FTreerow_Init(atf_amc::FTreerow& treerow) {
+    treerow.key = u64(0);
+    treerow.bt_treerow_leaf = NULL; // (atf_amc.FDb.bt_treerow) not in tree
+    treerow.tr_treerow_up = (atf_amc::FTreerow*)-1; // (atf_amc.FDb.tr_treerow) not in tree
+    treerow.tr_treerow_left = NULL;
+    treerow.tr_treerow_right = NULL;
+    treerow.tr_treerow_depth = 0;
+}
 inline atf_amc::FTypeC::FTypeC() {
     atf_amc::FTypeC_Init(*this);
 }
@@ -3657,6 +4743,246 @@ inline atf_amc::TypeA& atf_amc::fixary_qFind(atf_amc::FUnitSort& parent, u64 t)
     return parent.fixary_elems[t];
 }
 
+// --- atf_amc.FUnitSort.radix.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::radix_EmptyQ(atf_amc::FUnitSort& parent) {
+    return parent.radix_n == 0;
+}
+
+// --- atf_amc.FUnitSort.radix.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_amc::TypeA* atf_amc::radix_Find(atf_amc::FUnitSort& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = parent.radix_n;
+    if (idx >= lim) return NULL;
+    return parent.radix_elems + idx;
+}
+
+// --- atf_amc.FUnitSort.radix.Getary
+// Return array pointer by value
+inline algo::aryptr<atf_amc::TypeA> atf_amc::radix_Getary(atf_amc::FUnitSort& parent) {
+    return algo::aryptr<atf_amc::TypeA>(parent.radix_elems, parent.radix_n);
+}
+
+// --- atf_amc.FUnitSort.radix.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline atf_amc::TypeA* atf_amc::radix_Last(atf_amc::FUnitSort& parent) {
+    return radix_Find(parent, u64(parent.radix_n-1));
+}
+
+// --- atf_amc.FUnitSort.radix.Max
+// Return max. number of items in the array
+inline i32 atf_amc::radix_Max(atf_amc::FUnitSort& parent) {
+    (void)parent;
+    return parent.radix_max;
+}
+
+// --- atf_amc.FUnitSort.radix.N
+// Return number of items in the array
+inline i32 atf_amc::radix_N(const atf_amc::FUnitSort& parent) {
+    return parent.radix_n;
+}
+
+// --- atf_amc.FUnitSort.radix.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void atf_amc::radix_Reserve(atf_amc::FUnitSort& parent, int n) {
+    u32 new_n = parent.radix_n + n;
+    if (UNLIKELY(new_n > parent.radix_max)) {
+        radix_AbsReserve(parent, new_n);
+    }
+}
+
+// --- atf_amc.FUnitSort.radix.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline atf_amc::TypeA& atf_amc::radix_qFind(atf_amc::FUnitSort& parent, u64 t) {
+    return parent.radix_elems[t];
+}
+
+// --- atf_amc.FUnitSort.radix.qLast
+// Return reference to last element of array. No bounds checking
+inline atf_amc::TypeA& atf_amc::radix_qLast(atf_amc::FUnitSort& parent) {
+    return radix_qFind(parent, u64(parent.radix_n-1));
+}
+
+// --- atf_amc.FUnitSort.radix.rowid_Get
+// Return row id of specified element
+inline u64 atf_amc::radix_rowid_Get(atf_amc::FUnitSort& parent, atf_amc::TypeA &elem) {
+    u64 id = &elem - parent.radix_elems;
+    return u64(id);
+}
+
+// --- atf_amc.FUnitSort.c_radix.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::c_radix_EmptyQ(atf_amc::FUnitSort& parent) {
+    return parent.c_radix_n == 0;
+}
+
+// --- atf_amc.FUnitSort.c_radix.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_amc::TypeA* atf_amc::c_radix_Find(atf_amc::FUnitSort& parent, u32 t) {
+    atf_amc::TypeA *retval = NULL;
+    u64 idx = t;
+    u64 lim = parent.c_radix_n;
+    if (idx < lim) {
+        retval = parent.c_radix_elems[idx];
+    }
+    return retval;
+}
+
+// --- atf_amc.FUnitSort.c_radix.Getary
+// Return array of pointers
+inline algo::aryptr<atf_amc::TypeA*> atf_amc::c_radix_Getary(atf_amc::FUnitSort& parent) {
+    return algo::aryptr<atf_amc::TypeA*>(parent.c_radix_elems, parent.c_radix_n);
+}
+
+// --- atf_amc.FUnitSort.c_radix.N
+// Return number of items in the pointer array
+inline i32 atf_amc::c_radix_N(const atf_amc::FUnitSort& parent) {
+    return parent.c_radix_n;
+}
+
+// --- atf_amc.FUnitSort.c_radix.RemoveAll
+// Empty the index. (The rows are not deleted)
+inline void atf_amc::c_radix_RemoveAll(atf_amc::FUnitSort& parent) {
+    parent.c_radix_n = 0;
+}
+
+// --- atf_amc.FUnitSort.strkey.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::strkey_EmptyQ(atf_amc::FUnitSort& parent) {
+    return parent.strkey_n == 0;
+}
+
+// --- atf_amc.FUnitSort.strkey.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_amc::Strkey* atf_amc::strkey_Find(atf_amc::FUnitSort& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = parent.strkey_n;
+    if (idx >= lim) return NULL;
+    return parent.strkey_elems + idx;
+}
+
+// --- atf_amc.FUnitSort.strkey.Getary
+// Return array pointer by value
+inline algo::aryptr<atf_amc::Strkey> atf_amc::strkey_Getary(atf_amc::FUnitSort& parent) {
+    return algo::aryptr<atf_amc::Strkey>(parent.strkey_elems, parent.strkey_n);
+}
+
+// --- atf_amc.FUnitSort.strkey.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline atf_amc::Strkey* atf_amc::strkey_Last(atf_amc::FUnitSort& parent) {
+    return strkey_Find(parent, u64(parent.strkey_n-1));
+}
+
+// --- atf_amc.FUnitSort.strkey.Max
+// Return max. number of items in the array
+inline i32 atf_amc::strkey_Max(atf_amc::FUnitSort& parent) {
+    (void)parent;
+    return parent.strkey_max;
+}
+
+// --- atf_amc.FUnitSort.strkey.N
+// Return number of items in the array
+inline i32 atf_amc::strkey_N(const atf_amc::FUnitSort& parent) {
+    return parent.strkey_n;
+}
+
+// --- atf_amc.FUnitSort.strkey.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void atf_amc::strkey_Reserve(atf_amc::FUnitSort& parent, int n) {
+    u32 new_n = parent.strkey_n + n;
+    if (UNLIKELY(new_n > parent.strkey_max)) {
+        strkey_AbsReserve(parent, new_n);
+    }
+}
+
+// --- atf_amc.FUnitSort.strkey.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline atf_amc::Strkey& atf_amc::strkey_qFind(atf_amc::FUnitSort& parent, u64 t) {
+    return parent.strkey_elems[t];
+}
+
+// --- atf_amc.FUnitSort.strkey.qLast
+// Return reference to last element of array. No bounds checking
+inline atf_amc::Strkey& atf_amc::strkey_qLast(atf_amc::FUnitSort& parent) {
+    return strkey_qFind(parent, u64(parent.strkey_n-1));
+}
+
+// --- atf_amc.FUnitSort.strkey.rowid_Get
+// Return row id of specified element
+inline u64 atf_amc::strkey_rowid_Get(atf_amc::FUnitSort& parent, atf_amc::Strkey &elem) {
+    u64 id = &elem - parent.strkey_elems;
+    return u64(id);
+}
+
+// --- atf_amc.FUnitSort.parallel.EmptyQ
+// Return true if index is empty
+inline bool atf_amc::parallel_EmptyQ(atf_amc::FUnitSort& parent) {
+    return parent.parallel_n == 0;
+}
+
+// --- atf_amc.FUnitSort.parallel.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_amc::TypeA* atf_amc::parallel_Find(atf_amc::FUnitSort& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = parent.parallel_n;
+    if (idx >= lim) return NULL;
+    return parent.parallel_elems + idx;
+}
+
+// --- atf_amc.FUnitSort.parallel.Getary
+// Return array pointer by value
+inline algo::aryptr<atf_amc::TypeA> atf_amc::parallel_Getary(atf_amc::FUnitSort& parent) {
+    return algo::aryptr<atf_amc::TypeA>(parent.parallel_elems, parent.parallel_n);
+}
+
+// --- atf_amc.FUnitSort.parallel.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline atf_amc::TypeA* atf_amc::parallel_Last(atf_amc::FUnitSort& parent) {
+    return parallel_Find(parent, u64(parent.parallel_n-1));
+}
+
+// --- atf_amc.FUnitSort.parallel.Max
+// Return max. number of items in the array
+inline i32 atf_amc::parallel_Max(atf_amc::FUnitSort& parent) {
+    (void)parent;
+    return parent.parallel_max;
+}
+
+// --- atf_amc.FUnitSort.parallel.N
+// Return number of items in the array
+inline i32 atf_amc::parallel_N(const atf_amc::FUnitSort& parent) {
+    return parent.parallel_n;
+}
+
+// --- atf_amc.FUnitSort.parallel.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void atf_amc::parallel_Reserve(atf_amc::FUnitSort& parent, int n) {
+    u32 new_n = parent.parallel_n + n;
+    if (UNLIKELY(new_n > parent.parallel_max)) {
+        parallel_AbsReserve(parent, new_n);
+    }
+}
+
+// --- atf_amc.FUnitSort.parallel.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline atf_amc::TypeA& atf_amc::parallel_qFind(atf_amc::FUnitSort& parent, u64 t) {
+    return parent.parallel_elems[t];
+}
+
+// --- atf_amc.FUnitSort.parallel.qLast
+// Return reference to last element of array. No bounds checking
+inline atf_amc::TypeA& atf_amc::parallel_qLast(atf_amc::FUnitSort& parent) {
+    return parallel_qFind(parent, u64(parent.parallel_n-1));
+}
+
+// --- atf_amc.FUnitSort.parallel.rowid_Get
+// Return row id of specified element
+inline u64 atf_amc::parallel_rowid_Get(atf_amc::FUnitSort& parent, atf_amc::TypeA &elem) {
+    u64 id = &elem - parent.parallel_elems;
+    return u64(id);
+}
+
 // --- atf_amc.FUnitSort.tary_curs.Next
 // proceed to next item
 inline void atf_amc::FUnitSort_tary_curs_Next(FUnitSort_tary_curs &curs) {
@@ -3732,6 +5058,106 @@ inline atf_amc::TypeA& atf_amc::FUnitSort_fixary_curs_Access(FUnitSort_fixary_cu
     return fixary_qFind((*curs.parent), u64(curs.index));
 }
 
+// --- atf_amc.FUnitSort.radix_curs.Next
+// proceed to next item
+inline void atf_amc::FUnitSort_radix_curs_Next(FUnitSort_radix_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FUnitSort.radix_curs.Reset
+inline void atf_amc::FUnitSort_radix_curs_Reset(FUnitSort_radix_curs &curs, atf_amc::FUnitSort &parent) {
+    curs.elems = parent.radix_elems;
+    curs.n_elems = parent.radix_n;
+    curs.index = 0;
+}
+
+// --- atf_amc.FUnitSort.radix_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::FUnitSort_radix_curs_ValidQ(FUnitSort_radix_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- atf_amc.FUnitSort.radix_curs.Access
+// item access
+inline atf_amc::TypeA& atf_amc::FUnitSort_radix_curs_Access(FUnitSort_radix_curs &curs) {
+    return curs.elems[curs.index];
+}
+
+// --- atf_amc.FUnitSort.c_radix_curs.Reset
+inline void atf_amc::FUnitSort_c_radix_curs_Reset(FUnitSort_c_radix_curs &curs, atf_amc::FUnitSort &parent) {
+    curs.elems = parent.c_radix_elems;
+    curs.n_elems = parent.c_radix_n;
+    curs.index = 0;
+}
+
+// --- atf_amc.FUnitSort.c_radix_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::FUnitSort_c_radix_curs_ValidQ(FUnitSort_c_radix_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- atf_amc.FUnitSort.c_radix_curs.Next
+// proceed to next item
+inline void atf_amc::FUnitSort_c_radix_curs_Next(FUnitSort_c_radix_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FUnitSort.c_radix_curs.Access
+// item access
+inline atf_amc::TypeA& atf_amc::FUnitSort_c_radix_curs_Access(FUnitSort_c_radix_curs &curs) {
+    return *curs.elems[curs.index];
+}
+
+// --- atf_amc.FUnitSort.strkey_curs.Next
+// proceed to next item
+inline void atf_amc::FUnitSort_strkey_curs_Next(FUnitSort_strkey_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FUnitSort.strkey_curs.Reset
+inline void atf_amc::FUnitSort_strkey_curs_Reset(FUnitSort_strkey_curs &curs, atf_amc::FUnitSort &parent) {
+    curs.elems = parent.strkey_elems;
+    curs.n_elems = parent.strkey_n;
+    curs.index = 0;
+}
+
+// --- atf_amc.FUnitSort.strkey_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::FUnitSort_strkey_curs_ValidQ(FUnitSort_strkey_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- atf_amc.FUnitSort.strkey_curs.Access
+// item access
+inline atf_amc::Strkey& atf_amc::FUnitSort_strkey_curs_Access(FUnitSort_strkey_curs &curs) {
+    return curs.elems[curs.index];
+}
+
+// --- atf_amc.FUnitSort.parallel_curs.Next
+// proceed to next item
+inline void atf_amc::FUnitSort_parallel_curs_Next(FUnitSort_parallel_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_amc.FUnitSort.parallel_curs.Reset
+inline void atf_amc::FUnitSort_parallel_curs_Reset(FUnitSort_parallel_curs &curs, atf_amc::FUnitSort &parent) {
+    curs.elems = parent.parallel_elems;
+    curs.n_elems = parent.parallel_n;
+    curs.index = 0;
+}
+
+// --- atf_amc.FUnitSort.parallel_curs.ValidQ
+// cursor points to valid item
+inline bool atf_amc::FUnitSort_parallel_curs_ValidQ(FUnitSort_parallel_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- atf_amc.FUnitSort.parallel_curs.Access
+// item access
+inline atf_amc::TypeA& atf_amc::FUnitSort_parallel_curs_Access(FUnitSort_parallel_curs &curs) {
+    return curs.elems[curs.index];
+}
+
 // --- atf_amc.FUnitSort..Init
 // Set all fields to initial values.
 inline void atf_amc::FUnitSort_Init(atf_amc::FUnitSort& parent) {
@@ -3741,6 +5167,18 @@ inline void atf_amc::FUnitSort_Init(atf_amc::FUnitSort& parent) {
     parent.c_ptrary_elems = NULL; // (atf_amc.FUnitSort.c_ptrary)
     parent.c_ptrary_n = 0; // (atf_amc.FUnitSort.c_ptrary)
     parent.c_ptrary_max = 0; // (atf_amc.FUnitSort.c_ptrary)
+    parent.radix_elems 	= 0; // (atf_amc.FUnitSort.radix)
+    parent.radix_n     	= 0; // (atf_amc.FUnitSort.radix)
+    parent.radix_max   	= 0; // (atf_amc.FUnitSort.radix)
+    parent.c_radix_elems = NULL; // (atf_amc.FUnitSort.c_radix)
+    parent.c_radix_n = 0; // (atf_amc.FUnitSort.c_radix)
+    parent.c_radix_max = 0; // (atf_amc.FUnitSort.c_radix)
+    parent.strkey_elems 	= 0; // (atf_amc.FUnitSort.strkey)
+    parent.strkey_n     	= 0; // (atf_amc.FUnitSort.strkey)
+    parent.strkey_max   	= 0; // (atf_amc.FUnitSort.strkey)
+    parent.parallel_elems 	= 0; // (atf_amc.FUnitSort.parallel)
+    parent.parallel_n     	= 0; // (atf_amc.FUnitSort.parallel)
+    parent.parallel_max   	= 0; // (atf_amc.FUnitSort.parallel)
 }
 inline atf_amc::FieldId::FieldId(i32                            in_value)
     : value(in_value)
@@ -6902,6 +8340,9 @@ inline atf_amc::SsimfilesCase::operator atf_amc_SsimfilesCaseEnum () const {
 inline void atf_amc::SsimfilesCase_Init(atf_amc::SsimfilesCase& parent) {
     parent.value = u32(0);
 }
+inline atf_amc::Strkey::Strkey() {
+}
+
 inline atf_amc::TableId::TableId(i32                            in_value)
     : value(in_value)
 {
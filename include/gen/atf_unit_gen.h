@@ -62,6 +62,8 @@ namespace atf_unit { struct _db_testrun_curs; }
 namespace atf_unit { struct FPerfSort_orig_curs; }
 namespace atf_unit { struct FPerfSort_sorted_curs; }
 namespace atf_unit { struct FPerfSort_index_curs; }
+namespace atf_unit { struct FPerfSort_radix_curs; }
+namespace atf_unit { struct FPerfSort_parallel_curs; }
 namespace atf_unit { struct ShStreamAry_shstream_curs; }
 namespace atf_unit {
     typedef i32 TypeAPkey;
@@ -273,6 +275,8 @@ lib_json::FNode *    Cstr_FmtJson(atf_unit::Cstr & row, lib_json::FNode *parent)
 // --- atf_unit.Dbl
 // create: atf_unit.FPerfSort.orig (Tary)
 // create: atf_unit.FPerfSort.sorted (Tary)
+// create: atf_unit.FPerfSort.radix (Tary)
+// create: atf_unit.FPerfSort.parallel (Tary)
 struct Dbl { // atf_unit.Dbl
     double   val;   //   0.0
     inline operator double() const;
@@ -608,15 +612,21 @@ void                 FNumber_Uninit(atf_unit::FNumber& number) __attribute__((no
 
 // --- atf_unit.FPerfSort
 struct FPerfSort { // atf_unit.FPerfSort: Function to test double sorting
-    atf_unit::Dbl*   orig_elems;     // pointer to elements
-    u32              orig_n;         // number of elements in array
-    u32              orig_max;       // max. capacity of array before realloc
-    atf_unit::Dbl*   sorted_elems;   // pointer to elements
-    u32              sorted_n;       // number of elements in array
-    u32              sorted_max;     // max. capacity of array before realloc
-    i32*             index_elems;    // pointer to elements
-    u32              index_n;        // number of elements in array
-    u32              index_max;      // max. capacity of array before realloc
+    atf_unit::Dbl*   orig_elems;       // pointer to elements
+    u32              orig_n;           // number of elements in array
+    u32              orig_max;         // max. capacity of array before realloc
+    atf_unit::Dbl*   sorted_elems;     // pointer to elements
+    u32              sorted_n;         // number of elements in array
+    u32              sorted_max;       // max. capacity of array before realloc
+    i32*             index_elems;      // pointer to elements
+    u32              index_n;          // number of elements in array
+    u32              index_max;        // max. capacity of array before realloc
+    atf_unit::Dbl*   radix_elems;      // pointer to elements
+    u32              radix_n;          // number of elements in array
+    u32              radix_max;        // max. capacity of array before realloc
+    atf_unit::Dbl*   parallel_elems;   // pointer to elements
+    u32              parallel_n;       // number of elements in array
+    u32              parallel_max;     // max. capacity of array before realloc
     FPerfSort();
     ~FPerfSort();
 private:
@@ -760,6 +770,116 @@ i32&                 index_qLast(atf_unit::FPerfSort& parent) __attribute__((not
 // Return row id of specified element
 u64                  index_rowid_Get(atf_unit::FPerfSort& parent, i32 &elem) __attribute__((nothrow));
 
+// Reserve space (this may move memory). Insert N element at the end.
+// Return aryptr to newly inserted block.
+// If the RHS argument aliases the array (refers to the same memory), exit program with fatal error.
+algo::aryptr<atf_unit::Dbl> radix_Addary(atf_unit::FPerfSort& parent, algo::aryptr<atf_unit::Dbl> rhs) __attribute__((nothrow));
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_unit::Dbl&       radix_Alloc(atf_unit::FPerfSort& parent) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_unit::Dbl&       radix_AllocAt(atf_unit::FPerfSort& parent, int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_unit::Dbl> radix_AllocN(atf_unit::FPerfSort& parent, int n_elems) __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 radix_EmptyQ(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_unit::Dbl*       radix_Find(atf_unit::FPerfSort& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array pointer by value
+algo::aryptr<atf_unit::Dbl> radix_Getary(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+atf_unit::Dbl*       radix_Last(atf_unit::FPerfSort& parent) __attribute__((nothrow, pure));
+// Return max. number of items in the array
+i32                  radix_Max(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  radix_N(const atf_unit::FPerfSort& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove item by index. If index outside of range, do nothing.
+void                 radix_Remove(atf_unit::FPerfSort& parent, u32 i) __attribute__((nothrow));
+void                 radix_RemoveAll(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 radix_RemoveLast(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 radix_Reserve(atf_unit::FPerfSort& parent, int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 radix_AbsReserve(atf_unit::FPerfSort& parent, int n) __attribute__((nothrow));
+// Copy contents of RHS to PARENT.
+void                 radix_Setary(atf_unit::FPerfSort& parent, atf_unit::FPerfSort &rhs) __attribute__((nothrow));
+// Copy specified array into radix, discarding previous contents.
+// If the RHS argument aliases the array (refers to the same memory), throw exception.
+void                 radix_Setary(atf_unit::FPerfSort& parent, const algo::aryptr<atf_unit::Dbl> &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+atf_unit::Dbl&       radix_qFind(atf_unit::FPerfSort& parent, u64 t) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+atf_unit::Dbl&       radix_qLast(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Return row id of specified element
+u64                  radix_rowid_Get(atf_unit::FPerfSort& parent, atf_unit::Dbl &elem) __attribute__((nothrow));
+// Verify whether array is sorted
+bool                 radix_SortedQ(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Radix sort (stable)
+// Keys are extracted into a temp array, sorted with LSD byte radix
+// (one round per key word, least significant first), then elements
+// are moved to their final positions in one pass.
+void                 radix_RadixSort(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+
+// Reserve space (this may move memory). Insert N element at the end.
+// Return aryptr to newly inserted block.
+// If the RHS argument aliases the array (refers to the same memory), exit program with fatal error.
+algo::aryptr<atf_unit::Dbl> parallel_Addary(atf_unit::FPerfSort& parent, algo::aryptr<atf_unit::Dbl> rhs) __attribute__((nothrow));
+// Reserve space. Insert element at the end
+// The new element is initialized to a default value
+atf_unit::Dbl&       parallel_Alloc(atf_unit::FPerfSort& parent) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space for new element, reallocating the array if necessary
+// Insert new element at specified index. Index must be in range or a fatal error occurs.
+atf_unit::Dbl&       parallel_AllocAt(atf_unit::FPerfSort& parent, int at) __attribute__((__warn_unused_result__, nothrow));
+// Reserve space. Insert N elements at the end of the array, return pointer to array
+algo::aryptr<atf_unit::Dbl> parallel_AllocN(atf_unit::FPerfSort& parent, int n_elems) __attribute__((__warn_unused_result__, nothrow));
+// Return true if index is empty
+bool                 parallel_EmptyQ(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Look up row by row id. Return NULL if out of range
+atf_unit::Dbl*       parallel_Find(atf_unit::FPerfSort& parent, u64 t) __attribute__((__warn_unused_result__, nothrow));
+// Return array pointer by value
+algo::aryptr<atf_unit::Dbl> parallel_Getary(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Return pointer to last element of array, or NULL if array is empty
+atf_unit::Dbl*       parallel_Last(atf_unit::FPerfSort& parent) __attribute__((nothrow, pure));
+// Return max. number of items in the array
+i32                  parallel_Max(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Return number of items in the array
+i32                  parallel_N(const atf_unit::FPerfSort& parent) __attribute__((__warn_unused_result__, nothrow, pure));
+// Remove item by index. If index outside of range, do nothing.
+void                 parallel_Remove(atf_unit::FPerfSort& parent, u32 i) __attribute__((nothrow));
+void                 parallel_RemoveAll(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Delete last element of array. Do nothing if array is empty.
+void                 parallel_RemoveLast(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+void                 parallel_Reserve(atf_unit::FPerfSort& parent, int n) __attribute__((nothrow));
+// Make sure N elements fit in array. Process dies if out of memory
+void                 parallel_AbsReserve(atf_unit::FPerfSort& parent, int n) __attribute__((nothrow));
+// Copy contents of RHS to PARENT.
+void                 parallel_Setary(atf_unit::FPerfSort& parent, atf_unit::FPerfSort &rhs) __attribute__((nothrow));
+// Copy specified array into parallel, discarding previous contents.
+// If the RHS argument aliases the array (refers to the same memory), throw exception.
+void                 parallel_Setary(atf_unit::FPerfSort& parent, const algo::aryptr<atf_unit::Dbl> &rhs) __attribute__((nothrow));
+// 'quick' Access row by row id. No bounds checking.
+atf_unit::Dbl&       parallel_qFind(atf_unit::FPerfSort& parent, u64 t) __attribute__((nothrow));
+// Return reference to last element of array. No bounds checking
+atf_unit::Dbl&       parallel_qLast(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Return row id of specified element
+u64                  parallel_rowid_Get(atf_unit::FPerfSort& parent, atf_unit::Dbl &elem) __attribute__((nothrow));
+// Verify whether array is sorted
+bool                 parallel_SortedQ(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Insertion sort
+void                 parallel_InsertionSort(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Heap sort
+void                 parallel_HeapSort(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Quick sort
+void                 parallel_QuickSort(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+// Parallel sort
+// Large arrays are split into runs, which are sorted in separate threads
+// with quick sort, and merged; small arrays are quick-sorted in the calling thread.
+// parallel_Lt must be thread-safe.
+void                 parallel_ParallelSort(atf_unit::FPerfSort& parent) __attribute__((nothrow));
+
 // proceed to next item
 void                 FPerfSort_orig_curs_Next(FPerfSort_orig_curs &curs);
 void                 FPerfSort_orig_curs_Reset(FPerfSort_orig_curs &curs, atf_unit::FPerfSort &parent);
@@ -781,6 +901,20 @@ void                 FPerfSort_index_curs_Reset(FPerfSort_index_curs &curs, atf_
 bool                 FPerfSort_index_curs_ValidQ(FPerfSort_index_curs &curs);
 // item access
 i32&                 FPerfSort_index_curs_Access(FPerfSort_index_curs &curs);
+// proceed to next item
+void                 FPerfSort_radix_curs_Next(FPerfSort_radix_curs &curs);
+void                 FPerfSort_radix_curs_Reset(FPerfSort_radix_curs &curs, atf_unit::FPerfSort &parent);
+// cursor points to valid item
+bool                 FPerfSort_radix_curs_ValidQ(FPerfSort_radix_curs &curs);
+// item access
+atf_unit::Dbl&       FPerfSort_radix_curs_Access(FPerfSort_radix_curs &curs);
+// proceed to next item
+void                 FPerfSort_parallel_curs_Next(FPerfSort_parallel_curs &curs);
+void                 FPerfSort_parallel_curs_Reset(FPerfSort_parallel_curs &curs, atf_unit::FPerfSort &parent);
+// cursor points to valid item
+bool                 FPerfSort_parallel_curs_ValidQ(FPerfSort_parallel_curs &curs);
+// item access
+atf_unit::Dbl&       FPerfSort_parallel_curs_Access(FPerfSort_parallel_curs &curs);
 // Set all fields to initial values.
 void                 FPerfSort_Init(atf_unit::FPerfSort& parent);
 void                 FPerfSort_Uninit(atf_unit::FPerfSort& parent) __attribute__((nothrow));
@@ -1120,6 +1254,24 @@ struct FPerfSort_index_curs {// cursor
 };
 
 
+struct FPerfSort_radix_curs {// cursor
+    typedef atf_unit::Dbl ChildType;
+    atf_unit::Dbl* elems;
+    int n_elems;
+    int index;
+    FPerfSort_radix_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
+struct FPerfSort_parallel_curs {// cursor
+    typedef atf_unit::Dbl ChildType;
+    atf_unit::Dbl* elems;
+    int n_elems;
+    int index;
+    FPerfSort_parallel_curs() { elems=NULL; n_elems=0; index=0; }
+};
+
+
 struct ShStreamAry_shstream_curs {// cursor
     typedef atf_unit::ShStream ChildType;
     atf_unit::ShStream* elems;
@@ -1131,6 +1283,10 @@ struct ShStreamAry_shstream_curs {// cursor
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Check1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Check2();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Check3();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Del1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Field1();
@@ -1141,10 +1297,20 @@ void                 unittest_acr_Insert1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Insert2();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Lazy1();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Lazy2();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Maxgroup1();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Merge1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Meta1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Meta2();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Nthread1();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Read1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Read2();
@@ -1153,18 +1319,28 @@ void                 unittest_acr_Read3();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Read5();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Read6();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Regx1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Replace1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Rowid1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Serve1();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Stats1();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Unused1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Write1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Write2();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Write3();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_acr_Write4();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Xref1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_acr_Xref2();
@@ -1175,6 +1351,8 @@ void                 unittest_algo_lib_Aligned();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_Argtuple2();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_algo_lib_Argtuple_Linebuf();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_Argtuple_ReadArgv();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_Argtuple_ReadStrptr();
@@ -1191,6 +1369,8 @@ void                 unittest_algo_lib_Ceiling();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_Charset();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_algo_lib_CharsetFindFirst();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_CheckIpmask();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_CheckShiftMask();
@@ -1237,6 +1417,8 @@ void                 unittest_algo_lib_ParseHex2();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_ParseNumber();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_algo_lib_ParseNumberExact();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_ParseNumber_Overflow1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_ParseNumber_Overflow2();
@@ -1251,6 +1433,8 @@ void                 unittest_algo_lib_ParseURL1();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_ParseUnTime();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_algo_lib_PerfCharsetScan();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_PerfIntrinsics();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_PerfMinMaxAvg();
@@ -1261,6 +1445,8 @@ void                 unittest_algo_lib_PerfParseNum();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_PerfSort();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_algo_lib_PerfSsimRead();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_PerfTruncVsFtol();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_PopCnt1();
@@ -1283,6 +1469,8 @@ void                 unittest_algo_lib_PrintTime();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_PrintWithCommas();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_algo_lib_PrlogBuffered();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_ReadLine();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_ReadModuleId();
@@ -1313,6 +1501,10 @@ void                 unittest_algo_lib_Sleep();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_Smallstr();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_algo_lib_SsimReadInorder();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_algo_lib_SsimSnapshot();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_Strfind();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_StringCase();
@@ -1333,6 +1525,10 @@ void                 unittest_algo_lib_Tabulate();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_Tempfile();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_algo_lib_TempstrPool();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
+void                 unittest_algo_lib_TempstrThread();
+// User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_TestBitSet();
 // User-implemented function from gstatic:atf_unit.FDb.unittest
 void                 unittest_algo_lib_TestFbitset();
@@ -1344,6 +1344,152 @@ inline u64 atf_unit::index_rowid_Get(atf_unit::FPerfSort& parent, i32 &elem) {
     return u64(id);
 }
 
+// --- atf_unit.FPerfSort.radix.EmptyQ
+// Return true if index is empty
+inline bool atf_unit::radix_EmptyQ(atf_unit::FPerfSort& parent) {
+    return parent.radix_n == 0;
+}
+
+// --- atf_unit.FPerfSort.radix.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_unit::Dbl* atf_unit::radix_Find(atf_unit::FPerfSort& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = parent.radix_n;
+    if (idx >= lim) return NULL;
+    return parent.radix_elems + idx;
+}
+
+// --- atf_unit.FPerfSort.radix.Getary
+// Return array pointer by value
+inline algo::aryptr<atf_unit::Dbl> atf_unit::radix_Getary(atf_unit::FPerfSort& parent) {
+    return algo::aryptr<atf_unit::Dbl>(parent.radix_elems, parent.radix_n);
+}
+
+// --- atf_unit.FPerfSort.radix.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline atf_unit::Dbl* atf_unit::radix_Last(atf_unit::FPerfSort& parent) {
+    return radix_Find(parent, u64(parent.radix_n-1));
+}
+
+// --- atf_unit.FPerfSort.radix.Max
+// Return max. number of items in the array
+inline i32 atf_unit::radix_Max(atf_unit::FPerfSort& parent) {
+    (void)parent;
+    return parent.radix_max;
+}
+
+// --- atf_unit.FPerfSort.radix.N
+// Return number of items in the array
+inline i32 atf_unit::radix_N(const atf_unit::FPerfSort& parent) {
+    return parent.radix_n;
+}
+
+// --- atf_unit.FPerfSort.radix.RemoveAll
+inline void atf_unit::radix_RemoveAll(atf_unit::FPerfSort& parent) {
+    parent.radix_n = 0;
+}
+
+// --- atf_unit.FPerfSort.radix.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void atf_unit::radix_Reserve(atf_unit::FPerfSort& parent, int n) {
+    u32 new_n = parent.radix_n + n;
+    if (UNLIKELY(new_n > parent.radix_max)) {
+        radix_AbsReserve(parent, new_n);
+    }
+}
+
+// --- atf_unit.FPerfSort.radix.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline atf_unit::Dbl& atf_unit::radix_qFind(atf_unit::FPerfSort& parent, u64 t) {
+    return parent.radix_elems[t];
+}
+
+// --- atf_unit.FPerfSort.radix.qLast
+// Return reference to last element of array. No bounds checking
+inline atf_unit::Dbl& atf_unit::radix_qLast(atf_unit::FPerfSort& parent) {
+    return radix_qFind(parent, u64(parent.radix_n-1));
+}
+
+// --- atf_unit.FPerfSort.radix.rowid_Get
+// Return row id of specified element
+inline u64 atf_unit::radix_rowid_Get(atf_unit::FPerfSort& parent, atf_unit::Dbl &elem) {
+    u64 id = &elem - parent.radix_elems;
+    return u64(id);
+}
+
+// --- atf_unit.FPerfSort.parallel.EmptyQ
+// Return true if index is empty
+inline bool atf_unit::parallel_EmptyQ(atf_unit::FPerfSort& parent) {
+    return parent.parallel_n == 0;
+}
+
+// --- atf_unit.FPerfSort.parallel.Find
+// Look up row by row id. Return NULL if out of range
+inline atf_unit::Dbl* atf_unit::parallel_Find(atf_unit::FPerfSort& parent, u64 t) {
+    u64 idx = t;
+    u64 lim = parent.parallel_n;
+    if (idx >= lim) return NULL;
+    return parent.parallel_elems + idx;
+}
+
+// --- atf_unit.FPerfSort.parallel.Getary
+// Return array pointer by value
+inline algo::aryptr<atf_unit::Dbl> atf_unit::parallel_Getary(atf_unit::FPerfSort& parent) {
+    return algo::aryptr<atf_unit::Dbl>(parent.parallel_elems, parent.parallel_n);
+}
+
+// --- atf_unit.FPerfSort.parallel.Last
+// Return pointer to last element of array, or NULL if array is empty
+inline atf_unit::Dbl* atf_unit::parallel_Last(atf_unit::FPerfSort& parent) {
+    return parallel_Find(parent, u64(parent.parallel_n-1));
+}
+
+// --- atf_unit.FPerfSort.parallel.Max
+// Return max. number of items in the array
+inline i32 atf_unit::parallel_Max(atf_unit::FPerfSort& parent) {
+    (void)parent;
+    return parent.parallel_max;
+}
+
+// --- atf_unit.FPerfSort.parallel.N
+// Return number of items in the array
+inline i32 atf_unit::parallel_N(const atf_unit::FPerfSort& parent) {
+    return parent.parallel_n;
+}
+
+// --- atf_unit.FPerfSort.parallel.RemoveAll
+inline void atf_unit::parallel_RemoveAll(atf_unit::FPerfSort& parent) {
+    parent.parallel_n = 0;
+}
+
+// --- atf_unit.FPerfSort.parallel.Reserve
+// Make sure N *more* elements will fit in array. Process dies if out of memory
+inline void atf_unit::parallel_Reserve(atf_unit::FPerfSort& parent, int n) {
+    u32 new_n = parent.parallel_n + n;
+    if (UNLIKELY(new_n > parent.parallel_max)) {
+        parallel_AbsReserve(parent, new_n);
+    }
+}
+
+// --- atf_unit.FPerfSort.parallel.qFind
+// 'quick' Access row by row id. No bounds checking.
+inline atf_unit::Dbl& atf_unit::parallel_qFind(atf_unit::FPerfSort& parent, u64 t) {
+    return parent.parallel_elems[t];
+}
+
+// --- atf_unit.FPerfSort.parallel.qLast
+// Return reference to last element of array. No bounds checking
+inline atf_unit::Dbl& atf_unit::parallel_qLast(atf_unit::FPerfSort& parent) {
+    return parallel_qFind(parent, u64(parent.parallel_n-1));
+}
+
+// --- atf_unit.FPerfSort.parallel.rowid_Get
+// Return row id of specified element
+inline u64 atf_unit::parallel_rowid_Get(atf_unit::FPerfSort& parent, atf_unit::Dbl &elem) {
+    u64 id = &elem - parent.parallel_elems;
+    return u64(id);
+}
+
 // --- atf_unit.FPerfSort.orig_curs.Next
 // proceed to next item
 inline void atf_unit::FPerfSort_orig_curs_Next(FPerfSort_orig_curs &curs) {
@@ -1419,6 +1565,56 @@ inline i32& atf_unit::FPerfSort_index_curs_Access(FPerfSort_index_curs &curs) {
     return curs.elems[curs.index];
 }
 
+// --- atf_unit.FPerfSort.radix_curs.Next
+// proceed to next item
+inline void atf_unit::FPerfSort_radix_curs_Next(FPerfSort_radix_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_unit.FPerfSort.radix_curs.Reset
+inline void atf_unit::FPerfSort_radix_curs_Reset(FPerfSort_radix_curs &curs, atf_unit::FPerfSort &parent) {
+    curs.elems = parent.radix_elems;
+    curs.n_elems = parent.radix_n;
+    curs.index = 0;
+}
+
+// --- atf_unit.FPerfSort.radix_curs.ValidQ
+// cursor points to valid item
+inline bool atf_unit::FPerfSort_radix_curs_ValidQ(FPerfSort_radix_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- atf_unit.FPerfSort.radix_curs.Access
+// item access
+inline atf_unit::Dbl& atf_unit::FPerfSort_radix_curs_Access(FPerfSort_radix_curs &curs) {
+    return curs.elems[curs.index];
+}
+
+// --- atf_unit.FPerfSort.parallel_curs.Next
+// proceed to next item
+inline void atf_unit::FPerfSort_parallel_curs_Next(FPerfSort_parallel_curs &curs) {
+    curs.index++;
+}
+
+// --- atf_unit.FPerfSort.parallel_curs.Reset
+inline void atf_unit::FPerfSort_parallel_curs_Reset(FPerfSort_parallel_curs &curs, atf_unit::FPerfSort &parent) {
+    curs.elems = parent.parallel_elems;
+    curs.n_elems = parent.parallel_n;
+    curs.index = 0;
+}
+
+// --- atf_unit.FPerfSort.parallel_curs.ValidQ
+// cursor points to valid item
+inline bool atf_unit::FPerfSort_parallel_curs_ValidQ(FPerfSort_parallel_curs &curs) {
+    return curs.index < curs.n_elems;
+}
+
+// --- atf_unit.FPerfSort.parallel_curs.Access
+// item access
+inline atf_unit::Dbl& atf_unit::FPerfSort_parallel_curs_Access(FPerfSort_parallel_curs &curs) {
+    return curs.elems[curs.index];
+}
+
 // --- atf_unit.FPerfSort..Init
 // Set all fields to initial values.
 inline void atf_unit::FPerfSort_Init(atf_unit::FPerfSort& parent) {
@@ -1431,6 +1627,12 @@ inline void atf_unit::FPerfSort_Init(atf_unit::FPerfSort& parent) {
     parent.index_elems 	= 0; // (atf_unit.FPerfSort.index)
     parent.index_n     	= 0; // (atf_unit.FPerfSort.index)
     parent.index_max   	= 0; // (atf_unit.FPerfSort.index)
+    parent.radix_elems 	= 0; // (atf_unit.FPerfSort.radix)
+    parent.radix_n     	= 0; // (atf_unit.FPerfSort.radix)
+    parent.radix_max   	= 0; // (atf_unit.FPerfSort.radix)
+    parent.parallel_elems 	= 0; // (atf_unit.FPerfSort.parallel)
+    parent.parallel_n     	= 0; // (atf_unit.FPerfSort.parallel)
+    parent.parallel_max   	= 0; // (atf_unit.FPerfSort.parallel)
 }
 inline atf_unit::FTestrun::FTestrun() {
     atf_unit::FTestrun_Init(*this);
@@ -15,15 +15,16 @@
 
 enum atfdb_FieldIdEnum {            // atfdb.FieldId.value
      atfdb_FieldId_amctest     = 0
-    ,atfdb_FieldId_comment     = 1
-    ,atfdb_FieldId_normcheck   = 2
-    ,atfdb_FieldId_unittest    = 3
-    ,atfdb_FieldId_target      = 4
-    ,atfdb_FieldId_testname    = 5
-    ,atfdb_FieldId_value       = 6
+    ,atfdb_FieldId_manual      = 1
+    ,atfdb_FieldId_comment     = 2
+    ,atfdb_FieldId_normcheck   = 3
+    ,atfdb_FieldId_unittest    = 4
+    ,atfdb_FieldId_target      = 5
+    ,atfdb_FieldId_testname    = 6
+    ,atfdb_FieldId_value       = 7
 };
 
-enum { atfdb_FieldIdEnum_N = 7 };
+enum { atfdb_FieldIdEnum_N = 8 };
 
 namespace atfdb { struct Amctest; }
 namespace atfdb { struct FieldId; }
@@ -37,6 +38,7 @@ namespace atfdb {
 // --- atfdb.Amctest
 struct Amctest { // atfdb.Amctest
     algo::Smallstr50   amctest;   //
+    bool               manual;    //   false  Run only when selected by a pattern other than the default %
     algo::Comment      comment;   //
     Amctest();
 };
@@ -45,6 +47,8 @@ bool                 Amctest_ReadFieldMaybe(atfdb::Amctest &parent, algo::strptr
 // Read fields of atfdb::Amctest from an ascii string.
 // The format of the string is an ssim Tuple
 bool                 Amctest_ReadStrptrMaybe(atfdb::Amctest &parent, algo::strptr in_str);
+// Set all fields to initial values.
+void                 Amctest_Init(atfdb::Amctest& parent);
 // print string representation of atfdb::Amctest to string LHS, no header -- cprint:atfdb.Amctest.String
 void                 Amctest_Print(atfdb::Amctest & row, algo::cstring &str) __attribute__((nothrow));
 
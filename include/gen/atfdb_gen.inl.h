@@ -11,8 +11,15 @@
 #include "include/gen/algo_gen.inl.h"
 //#pragma endinclude
 inline atfdb::Amctest::Amctest() {
+    atfdb::Amctest_Init(*this);
 }
 
+
+// --- atfdb.Amctest..Init
+// Set all fields to initial values.
+inline void atfdb::Amctest_Init(atfdb::Amctest& parent) {
+    parent.manual = bool(false);
+}
 inline atfdb::FieldId::FieldId(i32                            in_value)
     : value(in_value)
 {
@@ -70,124 +70,130 @@ enum command_FieldIdEnum {                    // command.FieldId.value
     ,command_FieldId_field             = 53
     ,command_FieldId_regxof            = 54
     ,command_FieldId_meta              = 55
-    ,command_FieldId_line              = 56
-    ,command_FieldId_point             = 57
-    ,command_FieldId_type              = 58
-    ,command_FieldId_create            = 59
-    ,command_FieldId_finput            = 60
-    ,command_FieldId_srcfile           = 61
-    ,command_FieldId_gstatic           = 62
-    ,command_FieldId_indexed           = 63
-    ,command_FieldId_nstype            = 64
-    ,command_FieldId_ctype             = 65
-    ,command_FieldId_pooltype          = 66
-    ,command_FieldId_ssimfile          = 67
-    ,command_FieldId_subset            = 68
-    ,command_FieldId_subset2           = 69
-    ,command_FieldId_separator         = 70
-    ,command_FieldId_arg               = 71
-    ,command_FieldId_dflt              = 72
-    ,command_FieldId_anon              = 73
-    ,command_FieldId_bigend            = 74
-    ,command_FieldId_cascdel           = 75
-    ,command_FieldId_before            = 76
-    ,command_FieldId_substr            = 77
-    ,command_FieldId_srcfield          = 78
-    ,command_FieldId_fstep             = 79
-    ,command_FieldId_inscond           = 80
-    ,command_FieldId_reftype           = 81
-    ,command_FieldId_hashfld           = 82
-    ,command_FieldId_sortfld           = 83
-    ,command_FieldId_unittest          = 84
-    ,command_FieldId_normcheck         = 85
-    ,command_FieldId_cppfunc           = 86
-    ,command_FieldId_via               = 87
-    ,command_FieldId_showcpp           = 88
-    ,command_FieldId_comment           = 89
-    ,command_FieldId_sandbox           = 90
-    ,command_FieldId_ns                = 91
-    ,command_FieldId_data              = 92
-    ,command_FieldId_sigcheck          = 93
-    ,command_FieldId_data_dir          = 94
-    ,command_FieldId_related           = 95
-    ,command_FieldId_notssimfile       = 96
-    ,command_FieldId_checkable         = 97
-    ,command_FieldId_nsdb              = 98
-    ,command_FieldId_fkey              = 99
-    ,command_FieldId_start             = 100
-    ,command_FieldId_stop              = 101
-    ,command_FieldId_abort             = 102
-    ,command_FieldId_shell             = 103
-    ,command_FieldId_serv              = 104
-    ,command_FieldId_in_dir            = 105
-    ,command_FieldId_proto             = 106
-    ,command_FieldId_trace             = 107
-    ,command_FieldId_fconst            = 108
-    ,command_FieldId_gconst            = 109
-    ,command_FieldId_key               = 110
-    ,command_FieldId_include           = 111
-    ,command_FieldId_dot               = 112
-    ,command_FieldId_xns               = 113
-    ,command_FieldId_noinput           = 114
-    ,command_FieldId_render            = 115
-    ,command_FieldId_amctest           = 116
-    ,command_FieldId_nofork            = 117
-    ,command_FieldId_debug             = 118
-    ,command_FieldId_perf_secs         = 119
-    ,command_FieldId_pertest_timeout   = 120
-    ,command_FieldId_q                 = 121
-    ,command_FieldId_complooo          = 122
-    ,command_FieldId_args              = 123
-    ,command_FieldId_manywin           = 124
-    ,command_FieldId_root              = 125
-    ,command_FieldId_attach            = 126
-    ,command_FieldId_catchthrow        = 127
-    ,command_FieldId_tui               = 128
-    ,command_FieldId_bcmd              = 129
-    ,command_FieldId_emacs             = 130
-    ,command_FieldId_follow_child      = 131
-    ,command_FieldId_py                = 132
-    ,command_FieldId_writessimfile     = 133
-    ,command_FieldId_url               = 134
-    ,command_FieldId_tables            = 135
-    ,command_FieldId_nologo            = 136
-    ,command_FieldId_baddbok           = 137
-    ,command_FieldId_move              = 138
-    ,command_FieldId_dedup             = 139
-    ,command_FieldId_commit            = 140
-    ,command_FieldId_undo              = 141
-    ,command_FieldId_hash              = 142
-    ,command_FieldId_targsrc           = 143
-    ,command_FieldId_name              = 144
-    ,command_FieldId_body              = 145
-    ,command_FieldId_func              = 146
-    ,command_FieldId_nextfile          = 147
-    ,command_FieldId_other             = 148
-    ,command_FieldId_updateproto       = 149
-    ,command_FieldId_listfunc          = 150
-    ,command_FieldId_iffy              = 151
-    ,command_FieldId_gen               = 152
-    ,command_FieldId_showloc           = 153
-    ,command_FieldId_showstatic        = 154
-    ,command_FieldId_showsortkey       = 155
-    ,command_FieldId_sortname          = 156
-    ,command_FieldId_update_authors    = 157
-    ,command_FieldId_indent            = 158
-    ,command_FieldId_linelim           = 159
-    ,command_FieldId_strayfile         = 160
-    ,command_FieldId_capture           = 161
-    ,command_FieldId_expand            = 162
-    ,command_FieldId_ignoreQuote       = 163
-    ,command_FieldId_maxpacket         = 164
-    ,command_FieldId_db                = 165
-    ,command_FieldId_createdb          = 166
-    ,command_FieldId_str               = 167
-    ,command_FieldId_tocamelcase       = 168
-    ,command_FieldId_tolowerunder      = 169
-    ,command_FieldId_value             = 170
+    ,command_FieldId_nthread           = 56
+    ,command_FieldId_lazy              = 57
+    ,command_FieldId_changed           = 58
+    ,command_FieldId_serve             = 59
+    ,command_FieldId_server            = 60
+    ,command_FieldId_stats             = 61
+    ,command_FieldId_line              = 62
+    ,command_FieldId_point             = 63
+    ,command_FieldId_type              = 64
+    ,command_FieldId_create            = 65
+    ,command_FieldId_finput            = 66
+    ,command_FieldId_srcfile           = 67
+    ,command_FieldId_gstatic           = 68
+    ,command_FieldId_indexed           = 69
+    ,command_FieldId_nstype            = 70
+    ,command_FieldId_ctype             = 71
+    ,command_FieldId_pooltype          = 72
+    ,command_FieldId_ssimfile          = 73
+    ,command_FieldId_subset            = 74
+    ,command_FieldId_subset2           = 75
+    ,command_FieldId_separator         = 76
+    ,command_FieldId_arg               = 77
+    ,command_FieldId_dflt              = 78
+    ,command_FieldId_anon              = 79
+    ,command_FieldId_bigend            = 80
+    ,command_FieldId_cascdel           = 81
+    ,command_FieldId_before            = 82
+    ,command_FieldId_substr            = 83
+    ,command_FieldId_srcfield          = 84
+    ,command_FieldId_fstep             = 85
+    ,command_FieldId_inscond           = 86
+    ,command_FieldId_reftype           = 87
+    ,command_FieldId_hashfld           = 88
+    ,command_FieldId_sortfld           = 89
+    ,command_FieldId_unittest          = 90
+    ,command_FieldId_normcheck         = 91
+    ,command_FieldId_cppfunc           = 92
+    ,command_FieldId_via               = 93
+    ,command_FieldId_showcpp           = 94
+    ,command_FieldId_comment           = 95
+    ,command_FieldId_sandbox           = 96
+    ,command_FieldId_ns                = 97
+    ,command_FieldId_data              = 98
+    ,command_FieldId_sigcheck          = 99
+    ,command_FieldId_data_dir          = 100
+    ,command_FieldId_related           = 101
+    ,command_FieldId_notssimfile       = 102
+    ,command_FieldId_checkable         = 103
+    ,command_FieldId_nsdb              = 104
+    ,command_FieldId_fkey              = 105
+    ,command_FieldId_start             = 106
+    ,command_FieldId_stop              = 107
+    ,command_FieldId_abort             = 108
+    ,command_FieldId_shell             = 109
+    ,command_FieldId_serv              = 110
+    ,command_FieldId_in_dir            = 111
+    ,command_FieldId_proto             = 112
+    ,command_FieldId_trace             = 113
+    ,command_FieldId_fconst            = 114
+    ,command_FieldId_gconst            = 115
+    ,command_FieldId_key               = 116
+    ,command_FieldId_include           = 117
+    ,command_FieldId_dot               = 118
+    ,command_FieldId_xns               = 119
+    ,command_FieldId_noinput           = 120
+    ,command_FieldId_render            = 121
+    ,command_FieldId_amctest           = 122
+    ,command_FieldId_nofork            = 123
+    ,command_FieldId_debug             = 124
+    ,command_FieldId_perf_secs         = 125
+    ,command_FieldId_pertest_timeout   = 126
+    ,command_FieldId_q                 = 127
+    ,command_FieldId_complooo          = 128
+    ,command_FieldId_args              = 129
+    ,command_FieldId_manywin           = 130
+    ,command_FieldId_root              = 131
+    ,command_FieldId_attach            = 132
+    ,command_FieldId_catchthrow        = 133
+    ,command_FieldId_tui               = 134
+    ,command_FieldId_bcmd              = 135
+    ,command_FieldId_emacs             = 136
+    ,command_FieldId_follow_child      = 137
+    ,command_FieldId_py                = 138
+    ,command_FieldId_writessimfile     = 139
+    ,command_FieldId_url               = 140
+    ,command_FieldId_tables            = 141
+    ,command_FieldId_nologo            = 142
+    ,command_FieldId_baddbok           = 143
+    ,command_FieldId_move              = 144
+    ,command_FieldId_dedup             = 145
+    ,command_FieldId_commit            = 146
+    ,command_FieldId_undo              = 147
+    ,command_FieldId_hash              = 148
+    ,command_FieldId_targsrc           = 149
+    ,command_FieldId_name              = 150
+    ,command_FieldId_body              = 151
+    ,command_FieldId_func              = 152
+    ,command_FieldId_nextfile          = 153
+    ,command_FieldId_other             = 154
+    ,command_FieldId_updateproto       = 155
+    ,command_FieldId_listfunc          = 156
+    ,command_FieldId_iffy              = 157
+    ,command_FieldId_gen               = 158
+    ,command_FieldId_showloc           = 159
+    ,command_FieldId_showstatic        = 160
+    ,command_FieldId_showsortkey       = 161
+    ,command_FieldId_sortname          = 162
+    ,command_FieldId_update_authors    = 163
+    ,command_FieldId_indent            = 164
+    ,command_FieldId_linelim           = 165
+    ,command_FieldId_strayfile         = 166
+    ,command_FieldId_capture           = 167
+    ,command_FieldId_expand            = 168
+    ,command_FieldId_ignoreQuote       = 169
+    ,command_FieldId_maxpacket         = 170
+    ,command_FieldId_db                = 171
+    ,command_FieldId_createdb          = 172
+    ,command_FieldId_str               = 173
+    ,command_FieldId_tocamelcase       = 174
+    ,command_FieldId_tolowerunder      = 175
+    ,command_FieldId_value             = 176
 };
 
-enum { command_FieldIdEnum_N = 171 };
+enum { command_FieldIdEnum_N = 177 };
 
 namespace command { struct FieldId; }
 namespace command { struct Protocol; }
@@ -423,10 +429,19 @@ struct acr { // command.acr
     algo::cstring   field;      //   ""  Comma-separated list of fields to select
     algo::cstring   regxof;     //   ""  Single field: output regx of matching field values
     bool            meta;       //   false  Select meta-data for selected records
+    i32             nthread;    //   0  Number of threads for loading and checking ssimfiles (0=one per core)
+    bool            lazy;       //   false  Load records by primary key when possible (uses sidecar index in temp/acr_pkey)
+    bool            changed;    //   false  With -check: only check ssimfiles changed since last successful check
+    algo::cstring   serve;      //   ""  Serve queries on this Unix socket, keeping the data set in memory
+    algo::cstring   server;     //   ""  Socket of query server to use when one is running
+    bool            stats;      //   false  Print statistics (report.acr_query) for each query
     acr();
 };
 
 bool                 acr_ReadFieldMaybe(command::acr &parent, algo::strptr field, algo::strptr strval) __attribute__((nothrow));
+// Read fields of command::acr from an ascii string.
+// The format of the string is an ssim Tuple
+bool                 acr_ReadStrptrMaybe(command::acr &parent, algo::strptr in_str);
 // Read fields of command::acr from attributes of ascii tuple TUPLE
 bool                 acr_ReadTupleMaybe(command::acr &parent, algo::Tuple &tuple) __attribute__((nothrow));
 // Set all fields to initial values.
@@ -436,6 +451,8 @@ void                 acr_PrintArgv(command::acr & row, algo::cstring &str) __att
 // Convenience function that returns a full command line
 // Assume command is in a directory called bin
 tempstr              acr_ToCmdline(command::acr & row) __attribute__((nothrow));
+// print string representation of command::acr to string LHS, no header -- cprint:command.acr.String
+void                 acr_Print(command::acr & row, algo::cstring &str) __attribute__((nothrow));
 algo::strptr         acr_GetAnon(command::acr &parent, i32 idx) __attribute__((nothrow));
 
 // --- command.acr_compl
@@ -44,154 +44,159 @@ enum dmmeta_FieldIdEnum {                        // dmmeta.FieldId.value
     ,dmmeta_FieldId_ctype                 = 2
     ,dmmeta_FieldId_argvtype              = 3
     ,dmmeta_FieldId_base                  = 4
-    ,dmmeta_FieldId_name                  = 5
-    ,dmmeta_FieldId_offset                = 6
-    ,dmmeta_FieldId_width                 = 7
-    ,dmmeta_FieldId_srcfield              = 8
-    ,dmmeta_FieldId_pnewtype              = 9
-    ,dmmeta_FieldId_value                 = 10
-    ,dmmeta_FieldId_cafter                = 11
-    ,dmmeta_FieldId_after                 = 12
-    ,dmmeta_FieldId_extrn                 = 13
-    ,dmmeta_FieldId_genop                 = 14
-    ,dmmeta_FieldId_order                 = 15
-    ,dmmeta_FieldId_minmax                = 16
-    ,dmmeta_FieldId_fwddecl               = 17
-    ,dmmeta_FieldId_gen_using             = 18
-    ,dmmeta_FieldId_dflt                  = 19
-    ,dmmeta_FieldId_cppdflt               = 20
-    ,dmmeta_FieldId_ssimdflt              = 21
-    ,dmmeta_FieldId_initmemset            = 22
-    ,dmmeta_FieldId_cfmt                  = 23
-    ,dmmeta_FieldId_strfmt                = 24
-    ,dmmeta_FieldId_printfmt              = 25
-    ,dmmeta_FieldId_read                  = 26
-    ,dmmeta_FieldId_print                 = 27
-    ,dmmeta_FieldId_sep                   = 28
-    ,dmmeta_FieldId_expr                  = 29
-    ,dmmeta_FieldId_charrange             = 30
-    ,dmmeta_FieldId_calc                  = 31
-    ,dmmeta_FieldId_hashtype              = 32
-    ,dmmeta_FieldId_cppkeyword            = 33
-    ,dmmeta_FieldId_ctor                  = 34
-    ,dmmeta_FieldId_dtor                  = 35
-    ,dmmeta_FieldId_cheap_copy            = 36
-    ,dmmeta_FieldId_size                  = 37
-    ,dmmeta_FieldId_alignment             = 38
-    ,dmmeta_FieldId_strequiv              = 39
-    ,dmmeta_FieldId_ns                    = 40
-    ,dmmeta_FieldId_len                   = 41
-    ,dmmeta_FieldId_padbytes              = 42
-    ,dmmeta_FieldId_dispatch              = 43
-    ,dmmeta_FieldId_unk                   = 44
-    ,dmmeta_FieldId_haslen                = 45
-    ,dmmeta_FieldId_call                  = 46
-    ,dmmeta_FieldId_strict                = 47
-    ,dmmeta_FieldId_dispatch_msg          = 48
-    ,dmmeta_FieldId_match_all             = 49
-    ,dmmeta_FieldId_dispsig               = 50
-    ,dmmeta_FieldId_signature             = 51
-    ,dmmeta_FieldId_cycle                 = 52
-    ,dmmeta_FieldId_stripcomment          = 53
-    ,dmmeta_FieldId_fbufdir               = 54
-    ,dmmeta_FieldId_max                   = 55
-    ,dmmeta_FieldId_fbuftype              = 56
-    ,dmmeta_FieldId_insready              = 57
-    ,dmmeta_FieldId_inseof                = 58
-    ,dmmeta_FieldId_getmsg                = 59
-    ,dmmeta_FieldId_skipbytes             = 60
-    ,dmmeta_FieldId_fcmap                 = 61
-    ,dmmeta_FieldId_leftField             = 62
-    ,dmmeta_FieldId_leftVal               = 63
-    ,dmmeta_FieldId_rightVal              = 64
-    ,dmmeta_FieldId_rightField            = 65
-    ,dmmeta_FieldId_bidir                 = 66
-    ,dmmeta_FieldId_versionsort           = 67
-    ,dmmeta_FieldId_casesens              = 68
-    ,dmmeta_FieldId_fconst                = 69
-    ,dmmeta_FieldId_fcurs                 = 70
-    ,dmmeta_FieldId_curs                  = 71
-    ,dmmeta_FieldId_nplace                = 72
-    ,dmmeta_FieldId_fixedfmt              = 73
-    ,dmmeta_FieldId_fstep                 = 74
-    ,dmmeta_FieldId_delay                 = 75
-    ,dmmeta_FieldId_scale                 = 76
-    ,dmmeta_FieldId_arg                   = 77
-    ,dmmeta_FieldId_reftype               = 78
-    ,dmmeta_FieldId_update                = 79
-    ,dmmeta_FieldId_fprefix               = 80
-    ,dmmeta_FieldId_partial               = 81
-    ,dmmeta_FieldId_sorttype              = 82
-    ,dmmeta_FieldId_sortfld               = 83
-    ,dmmeta_FieldId_steptype              = 84
-    ,dmmeta_FieldId_func                  = 85
-    ,dmmeta_FieldId_inl                   = 86
-    ,dmmeta_FieldId_proto                 = 87
-    ,dmmeta_FieldId_body                  = 88
-    ,dmmeta_FieldId_deprecate             = 89
-    ,dmmeta_FieldId_ismacro               = 90
-    ,dmmeta_FieldId_glob                  = 91
-    ,dmmeta_FieldId_priv                  = 92
-    ,dmmeta_FieldId_ret                   = 93
-    ,dmmeta_FieldId_namefld               = 94
-    ,dmmeta_FieldId_idfld                 = 95
-    ,dmmeta_FieldId_wantenum              = 96
-    ,dmmeta_FieldId_namefldctyp           = 97
-    ,dmmeta_FieldId_gsymbol               = 98
-    ,dmmeta_FieldId_ssimfile              = 99
-    ,dmmeta_FieldId_inc                   = 100
-    ,dmmeta_FieldId_min                   = 101
-    ,dmmeta_FieldId_extra                 = 102
-    ,dmmeta_FieldId_listtype              = 103
-    ,dmmeta_FieldId_circular              = 104
-    ,dmmeta_FieldId_haveprev              = 105
-    ,dmmeta_FieldId_instail               = 106
-    ,dmmeta_FieldId_havetail              = 107
-    ,dmmeta_FieldId_havecount             = 108
-    ,dmmeta_FieldId_ismodule              = 109
-    ,dmmeta_FieldId_type                  = 110
-    ,dmmeta_FieldId_xref                  = 111
-    ,dmmeta_FieldId_nstype                = 112
-    ,dmmeta_FieldId_nsinclude             = 113
-    ,dmmeta_FieldId_sys                   = 114
-    ,dmmeta_FieldId_version               = 115
-    ,dmmeta_FieldId_genthrow              = 116
-    ,dmmeta_FieldId_correct_getorcreate   = 117
-    ,dmmeta_FieldId_pool                  = 118
-    ,dmmeta_FieldId_sortxref              = 119
-    ,dmmeta_FieldId_pack                  = 120
-    ,dmmeta_FieldId_fldoffset_asserts     = 121
-    ,dmmeta_FieldId_numtype               = 122
-    ,dmmeta_FieldId_min_len               = 123
-    ,dmmeta_FieldId_pnew                  = 124
-    ,dmmeta_FieldId_buftype               = 125
-    ,dmmeta_FieldId_unique                = 126
-    ,dmmeta_FieldId_isval                 = 127
-    ,dmmeta_FieldId_cascins               = 128
-    ,dmmeta_FieldId_usebasepool           = 129
-    ,dmmeta_FieldId_cancopy               = 130
-    ,dmmeta_FieldId_isxref                = 131
-    ,dmmeta_FieldId_del                   = 132
-    ,dmmeta_FieldId_up                    = 133
-    ,dmmeta_FieldId_isnew                 = 134
-    ,dmmeta_FieldId_hasalloc              = 135
-    ,dmmeta_FieldId_inst                  = 136
-    ,dmmeta_FieldId_varlen                = 137
-    ,dmmeta_FieldId_length                = 138
-    ,dmmeta_FieldId_strtype               = 139
-    ,dmmeta_FieldId_pad                   = 140
-    ,dmmeta_FieldId_ssimns                = 141
-    ,dmmeta_FieldId_aliased               = 142
-    ,dmmeta_FieldId_hashfld               = 143
-    ,dmmeta_FieldId_tracefld              = 144
-    ,dmmeta_FieldId_tracerec              = 145
-    ,dmmeta_FieldId_inscond               = 146
-    ,dmmeta_FieldId_via                   = 147
-    ,dmmeta_FieldId_viafld                = 148
-    ,dmmeta_FieldId_keyfld                = 149
-};
-
-enum { dmmeta_FieldIdEnum_N = 150 };
+    ,dmmeta_FieldId_arity                 = 5
+    ,dmmeta_FieldId_inlkey                = 6
+    ,dmmeta_FieldId_name                  = 7
+    ,dmmeta_FieldId_offset                = 8
+    ,dmmeta_FieldId_width                 = 9
+    ,dmmeta_FieldId_srcfield              = 10
+    ,dmmeta_FieldId_pnewtype              = 11
+    ,dmmeta_FieldId_value                 = 12
+    ,dmmeta_FieldId_cafter                = 13
+    ,dmmeta_FieldId_after                 = 14
+    ,dmmeta_FieldId_extrn                 = 15
+    ,dmmeta_FieldId_genop                 = 16
+    ,dmmeta_FieldId_order                 = 17
+    ,dmmeta_FieldId_minmax                = 18
+    ,dmmeta_FieldId_fwddecl               = 19
+    ,dmmeta_FieldId_gen_using             = 20
+    ,dmmeta_FieldId_dflt                  = 21
+    ,dmmeta_FieldId_cppdflt               = 22
+    ,dmmeta_FieldId_ssimdflt              = 23
+    ,dmmeta_FieldId_initmemset            = 24
+    ,dmmeta_FieldId_cfmt                  = 25
+    ,dmmeta_FieldId_strfmt                = 26
+    ,dmmeta_FieldId_printfmt              = 27
+    ,dmmeta_FieldId_read                  = 28
+    ,dmmeta_FieldId_print                 = 29
+    ,dmmeta_FieldId_sep                   = 30
+    ,dmmeta_FieldId_expr                  = 31
+    ,dmmeta_FieldId_charrange             = 32
+    ,dmmeta_FieldId_calc                  = 33
+    ,dmmeta_FieldId_hashtype              = 34
+    ,dmmeta_FieldId_cppkeyword            = 35
+    ,dmmeta_FieldId_ctor                  = 36
+    ,dmmeta_FieldId_dtor                  = 37
+    ,dmmeta_FieldId_cheap_copy            = 38
+    ,dmmeta_FieldId_size                  = 39
+    ,dmmeta_FieldId_alignment             = 40
+    ,dmmeta_FieldId_strequiv              = 41
+    ,dmmeta_FieldId_ns                    = 42
+    ,dmmeta_FieldId_len                   = 43
+    ,dmmeta_FieldId_padbytes              = 44
+    ,dmmeta_FieldId_dispatch              = 45
+    ,dmmeta_FieldId_unk                   = 46
+    ,dmmeta_FieldId_haslen                = 47
+    ,dmmeta_FieldId_call                  = 48
+    ,dmmeta_FieldId_strict                = 49
+    ,dmmeta_FieldId_dispatch_msg          = 50
+    ,dmmeta_FieldId_match_all             = 51
+    ,dmmeta_FieldId_dispsig               = 52
+    ,dmmeta_FieldId_signature             = 53
+    ,dmmeta_FieldId_cycle                 = 54
+    ,dmmeta_FieldId_stripcomment          = 55
+    ,dmmeta_FieldId_fbufdir               = 56
+    ,dmmeta_FieldId_max                   = 57
+    ,dmmeta_FieldId_fbuftype              = 58
+    ,dmmeta_FieldId_insready              = 59
+    ,dmmeta_FieldId_inseof                = 60
+    ,dmmeta_FieldId_getmsg                = 61
+    ,dmmeta_FieldId_skipbytes             = 62
+    ,dmmeta_FieldId_fcmap                 = 63
+    ,dmmeta_FieldId_leftField             = 64
+    ,dmmeta_FieldId_leftVal               = 65
+    ,dmmeta_FieldId_rightVal              = 66
+    ,dmmeta_FieldId_rightField            = 67
+    ,dmmeta_FieldId_bidir                 = 68
+    ,dmmeta_FieldId_versionsort           = 69
+    ,dmmeta_FieldId_casesens              = 70
+    ,dmmeta_FieldId_fconst                = 71
+    ,dmmeta_FieldId_fcurs                 = 72
+    ,dmmeta_FieldId_curs                  = 73
+    ,dmmeta_FieldId_nplace                = 74
+    ,dmmeta_FieldId_fixedfmt              = 75
+    ,dmmeta_FieldId_fstep                 = 76
+    ,dmmeta_FieldId_delay                 = 77
+    ,dmmeta_FieldId_scale                 = 78
+    ,dmmeta_FieldId_arg                   = 79
+    ,dmmeta_FieldId_reftype               = 80
+    ,dmmeta_FieldId_update                = 81
+    ,dmmeta_FieldId_fprefix               = 82
+    ,dmmeta_FieldId_partial               = 83
+    ,dmmeta_FieldId_sorttype              = 84
+    ,dmmeta_FieldId_sortfld               = 85
+    ,dmmeta_FieldId_steptype              = 86
+    ,dmmeta_FieldId_func                  = 87
+    ,dmmeta_FieldId_inl                   = 88
+    ,dmmeta_FieldId_proto                 = 89
+    ,dmmeta_FieldId_body                  = 90
+    ,dmmeta_FieldId_deprecate             = 91
+    ,dmmeta_FieldId_ismacro               = 92
+    ,dmmeta_FieldId_glob                  = 93
+    ,dmmeta_FieldId_priv                  = 94
+    ,dmmeta_FieldId_ret                   = 95
+    ,dmmeta_FieldId_namefld               = 96
+    ,dmmeta_FieldId_idfld                 = 97
+    ,dmmeta_FieldId_wantenum              = 98
+    ,dmmeta_FieldId_namefldctyp           = 99
+    ,dmmeta_FieldId_gsymbol               = 100
+    ,dmmeta_FieldId_ssimfile              = 101
+    ,dmmeta_FieldId_inc                   = 102
+    ,dmmeta_FieldId_min                   = 103
+    ,dmmeta_FieldId_extra                 = 104
+    ,dmmeta_FieldId_listtype              = 105
+    ,dmmeta_FieldId_circular              = 106
+    ,dmmeta_FieldId_haveprev              = 107
+    ,dmmeta_FieldId_instail               = 108
+    ,dmmeta_FieldId_havetail              = 109
+    ,dmmeta_FieldId_havecount             = 110
+    ,dmmeta_FieldId_ismodule              = 111
+    ,dmmeta_FieldId_type                  = 112
+    ,dmmeta_FieldId_xref                  = 113
+    ,dmmeta_FieldId_nstype                = 114
+    ,dmmeta_FieldId_nsinclude             = 115
+    ,dmmeta_FieldId_sys                   = 116
+    ,dmmeta_FieldId_version               = 117
+    ,dmmeta_FieldId_genthrow              = 118
+    ,dmmeta_FieldId_correct_getorcreate   = 119
+    ,dmmeta_FieldId_pool                  = 120
+    ,dmmeta_FieldId_sortxref              = 121
+    ,dmmeta_FieldId_pack                  = 122
+    ,dmmeta_FieldId_fldoffset_asserts     = 123
+    ,dmmeta_FieldId_numtype               = 124
+    ,dmmeta_FieldId_min_len               = 125
+    ,dmmeta_FieldId_pnew                  = 126
+    ,dmmeta_FieldId_buftype               = 127
+    ,dmmeta_FieldId_unique                = 128
+    ,dmmeta_FieldId_isval                 = 129
+    ,dmmeta_FieldId_cascins               = 130
+    ,dmmeta_FieldId_usebasepool           = 131
+    ,dmmeta_FieldId_cancopy               = 132
+    ,dmmeta_FieldId_isxref                = 133
+    ,dmmeta_FieldId_del                   = 134
+    ,dmmeta_FieldId_up                    = 135
+    ,dmmeta_FieldId_isnew                 = 136
+    ,dmmeta_FieldId_hasalloc              = 137
+    ,dmmeta_FieldId_inst                  = 138
+    ,dmmeta_FieldId_varlen                = 139
+    ,dmmeta_FieldId_length                = 140
+    ,dmmeta_FieldId_strtype               = 141
+    ,dmmeta_FieldId_pad                   = 142
+    ,dmmeta_FieldId_ssimns                = 143
+    ,dmmeta_FieldId_aliased               = 144
+    ,dmmeta_FieldId_hashfld               = 145
+    ,dmmeta_FieldId_cachehash             = 146
+    ,dmmeta_FieldId_openaddr              = 147
+    ,dmmeta_FieldId_incremental           = 148
+    ,dmmeta_FieldId_tracefld              = 149
+    ,dmmeta_FieldId_tracerec              = 150
+    ,dmmeta_FieldId_inscond               = 151
+    ,dmmeta_FieldId_via                   = 152
+    ,dmmeta_FieldId_viafld                = 153
+    ,dmmeta_FieldId_keyfld                = 154
+};
+
+enum { dmmeta_FieldIdEnum_N = 155 };
 
 extern const char *  dmmeta_Hashtype_hashtype_Extern;   // Extern    fconst:dmmeta.Hashtype.hashtype/Extern
 extern const char *  dmmeta_Hashtype_hashtype_CRC32;    // CRC32     fconst:dmmeta.Hashtype.hashtype/CRC32
@@ -252,6 +257,7 @@ extern const char *  dmmeta_Reftype_reftype_Base;       // Base        fconst:dm
 extern const char *  dmmeta_Reftype_reftype_Bheap;      // Bheap       fconst:dmmeta.Reftype.reftype/Bheap
 extern const char *  dmmeta_Reftype_reftype_Bitfld;     // Bitfld      fconst:dmmeta.Reftype.reftype/Bitfld
 extern const char *  dmmeta_Reftype_reftype_Blkpool;    // Blkpool     fconst:dmmeta.Reftype.reftype/Blkpool
+extern const char *  dmmeta_Reftype_reftype_Btree;      // Btree       fconst:dmmeta.Reftype.reftype/Btree
 extern const char *  dmmeta_Reftype_reftype_Charset;    // Charset     fconst:dmmeta.Reftype.reftype/Charset
 extern const char *  dmmeta_Reftype_reftype_Count;      // Count       fconst:dmmeta.Reftype.reftype/Count
 extern const char *  dmmeta_Reftype_reftype_Cppstack;   // Cppstack    fconst:dmmeta.Reftype.reftype/Cppstack
@@ -289,37 +295,38 @@ enum dmmeta_ReftypeCaseEnum {            // dmmeta.ReftypeCase.reftype
     ,dmmeta_ReftypeCase_Bheap      = 3
     ,dmmeta_ReftypeCase_Bitfld     = 4
     ,dmmeta_ReftypeCase_Blkpool    = 5
-    ,dmmeta_ReftypeCase_Charset    = 6
-    ,dmmeta_ReftypeCase_Count      = 7
-    ,dmmeta_ReftypeCase_Cppstack   = 8
-    ,dmmeta_ReftypeCase_Delptr     = 9
-    ,dmmeta_ReftypeCase_Exec       = 10
-    ,dmmeta_ReftypeCase_Fbuf       = 11
-    ,dmmeta_ReftypeCase_Global     = 12
-    ,dmmeta_ReftypeCase_Hook       = 13
-    ,dmmeta_ReftypeCase_Inlary     = 14
-    ,dmmeta_ReftypeCase_Lary       = 15
-    ,dmmeta_ReftypeCase_Llist      = 16
-    ,dmmeta_ReftypeCase_Lpool      = 17
-    ,dmmeta_ReftypeCase_Malloc     = 18
-    ,dmmeta_ReftypeCase_Opt        = 19
-    ,dmmeta_ReftypeCase_Pkey       = 20
-    ,dmmeta_ReftypeCase_Protocol   = 21
-    ,dmmeta_ReftypeCase_Ptr        = 22
-    ,dmmeta_ReftypeCase_Ptrary     = 23
-    ,dmmeta_ReftypeCase_RegxSql    = 24
-    ,dmmeta_ReftypeCase_Sbrk       = 25
-    ,dmmeta_ReftypeCase_Smallstr   = 26
-    ,dmmeta_ReftypeCase_Tary       = 27
-    ,dmmeta_ReftypeCase_Thash      = 28
-    ,dmmeta_ReftypeCase_Tpool      = 29
-    ,dmmeta_ReftypeCase_Upptr      = 30
-    ,dmmeta_ReftypeCase_Val        = 31
-    ,dmmeta_ReftypeCase_Varlen     = 32
-    ,dmmeta_ReftypeCase_ZSListMT   = 33
-};
-
-enum { dmmeta_ReftypeCaseEnum_N = 33 };
+    ,dmmeta_ReftypeCase_Btree      = 6
+    ,dmmeta_ReftypeCase_Charset    = 7
+    ,dmmeta_ReftypeCase_Count      = 8
+    ,dmmeta_ReftypeCase_Cppstack   = 9
+    ,dmmeta_ReftypeCase_Delptr     = 10
+    ,dmmeta_ReftypeCase_Exec       = 11
+    ,dmmeta_ReftypeCase_Fbuf       = 12
+    ,dmmeta_ReftypeCase_Global     = 13
+    ,dmmeta_ReftypeCase_Hook       = 14
+    ,dmmeta_ReftypeCase_Inlary     = 15
+    ,dmmeta_ReftypeCase_Lary       = 16
+    ,dmmeta_ReftypeCase_Llist      = 17
+    ,dmmeta_ReftypeCase_Lpool      = 18
+    ,dmmeta_ReftypeCase_Malloc     = 19
+    ,dmmeta_ReftypeCase_Opt        = 20
+    ,dmmeta_ReftypeCase_Pkey       = 21
+    ,dmmeta_ReftypeCase_Protocol   = 22
+    ,dmmeta_ReftypeCase_Ptr        = 23
+    ,dmmeta_ReftypeCase_Ptrary     = 24
+    ,dmmeta_ReftypeCase_RegxSql    = 25
+    ,dmmeta_ReftypeCase_Sbrk       = 26
+    ,dmmeta_ReftypeCase_Smallstr   = 27
+    ,dmmeta_ReftypeCase_Tary       = 28
+    ,dmmeta_ReftypeCase_Thash      = 29
+    ,dmmeta_ReftypeCase_Tpool      = 30
+    ,dmmeta_ReftypeCase_Upptr      = 31
+    ,dmmeta_ReftypeCase_Val        = 32
+    ,dmmeta_ReftypeCase_Varlen     = 33
+    ,dmmeta_ReftypeCase_ZSListMT   = 34
+};
+
+enum { dmmeta_ReftypeCaseEnum_N = 34 };
 
 
 // --- dmmeta_ReftypeIdEnum
@@ -330,41 +337,44 @@ enum dmmeta_ReftypeIdEnum {            // dmmeta.ReftypeId.value
     ,dmmeta_ReftypeId_Bheap      = 2
     ,dmmeta_ReftypeId_Bitfld     = 3
     ,dmmeta_ReftypeId_Blkpool    = 4
-    ,dmmeta_ReftypeId_Charset    = 5
-    ,dmmeta_ReftypeId_Count      = 6
-    ,dmmeta_ReftypeId_Cppstack   = 7
-    ,dmmeta_ReftypeId_Delptr     = 8
-    ,dmmeta_ReftypeId_Exec       = 9
-    ,dmmeta_ReftypeId_Fbuf       = 10
-    ,dmmeta_ReftypeId_Global     = 11
-    ,dmmeta_ReftypeId_Hook       = 12
-    ,dmmeta_ReftypeId_Inlary     = 13
-    ,dmmeta_ReftypeId_Lary       = 14
-    ,dmmeta_ReftypeId_Llist      = 15
-    ,dmmeta_ReftypeId_Lpool      = 16
-    ,dmmeta_ReftypeId_Malloc     = 17
-    ,dmmeta_ReftypeId_Opt        = 18
-    ,dmmeta_ReftypeId_Pkey       = 19
-    ,dmmeta_ReftypeId_Protocol   = 20
-    ,dmmeta_ReftypeId_Ptr        = 21
-    ,dmmeta_ReftypeId_Ptrary     = 22
-    ,dmmeta_ReftypeId_RegxSql    = 23
-    ,dmmeta_ReftypeId_Sbrk       = 24
-    ,dmmeta_ReftypeId_Smallstr   = 25
-    ,dmmeta_ReftypeId_Tary       = 26
-    ,dmmeta_ReftypeId_Thash      = 27
-    ,dmmeta_ReftypeId_Tpool      = 28
-    ,dmmeta_ReftypeId_Upptr      = 29
-    ,dmmeta_ReftypeId_Val        = 30
-    ,dmmeta_ReftypeId_Varlen     = 31
-    ,dmmeta_ReftypeId_ZSListMT   = 32
-};
-
-enum { dmmeta_ReftypeIdEnum_N = 33 };
+    ,dmmeta_ReftypeId_Btree      = 5
+    ,dmmeta_ReftypeId_Charset    = 6
+    ,dmmeta_ReftypeId_Count      = 7
+    ,dmmeta_ReftypeId_Cppstack   = 8
+    ,dmmeta_ReftypeId_Delptr     = 9
+    ,dmmeta_ReftypeId_Exec       = 10
+    ,dmmeta_ReftypeId_Fbuf       = 11
+    ,dmmeta_ReftypeId_Global     = 12
+    ,dmmeta_ReftypeId_Hook       = 13
+    ,dmmeta_ReftypeId_Inlary     = 14
+    ,dmmeta_ReftypeId_Lary       = 15
+    ,dmmeta_ReftypeId_Llist      = 16
+    ,dmmeta_ReftypeId_Lpool      = 17
+    ,dmmeta_ReftypeId_Malloc     = 18
+    ,dmmeta_ReftypeId_Opt        = 19
+    ,dmmeta_ReftypeId_Pkey       = 20
+    ,dmmeta_ReftypeId_Protocol   = 21
+    ,dmmeta_ReftypeId_Ptr        = 22
+    ,dmmeta_ReftypeId_Ptrary     = 23
+    ,dmmeta_ReftypeId_RegxSql    = 24
+    ,dmmeta_ReftypeId_Sbrk       = 25
+    ,dmmeta_ReftypeId_Smallstr   = 26
+    ,dmmeta_ReftypeId_Tary       = 27
+    ,dmmeta_ReftypeId_Thash      = 28
+    ,dmmeta_ReftypeId_Tpool      = 29
+    ,dmmeta_ReftypeId_Upptr      = 30
+    ,dmmeta_ReftypeId_Val        = 31
+    ,dmmeta_ReftypeId_Varlen     = 32
+    ,dmmeta_ReftypeId_ZSListMT   = 33
+};
+
+enum { dmmeta_ReftypeIdEnum_N = 34 };
 
 extern const char *  dmmeta_Sorttype_sorttype_QuickSort;       // QuickSort        fconst:dmmeta.Sorttype.sorttype/QuickSort
 extern const char *  dmmeta_Sorttype_sorttype_InsertionSort;   // InsertionSort    fconst:dmmeta.Sorttype.sorttype/InsertionSort
 extern const char *  dmmeta_Sorttype_sorttype_HeapSort;        // HeapSort         fconst:dmmeta.Sorttype.sorttype/HeapSort
+extern const char *  dmmeta_Sorttype_sorttype_RadixSort;       // RadixSort        fconst:dmmeta.Sorttype.sorttype/RadixSort
+extern const char *  dmmeta_Sorttype_sorttype_ParallelSort;    // ParallelSort     fconst:dmmeta.Sorttype.sorttype/ParallelSort
 extern const char *  dmmeta_Ssimfile_ssimfile_amcdb_bltin;           // amcdb.bltin            fconst:dmmeta.Ssimfile.ssimfile/amcdb.bltin
 extern const char *  dmmeta_Ssimfile_ssimfile_amcdb_curs;            // amcdb.curs             fconst:dmmeta.Ssimfile.ssimfile/amcdb.curs
 extern const char *  dmmeta_Ssimfile_ssimfile_amcdb_gen;             // amcdb.gen              fconst:dmmeta.Ssimfile.ssimfile/amcdb.gen
@@ -397,6 +407,7 @@ extern const char *  dmmeta_Ssimfile_ssimfile_dev_uname;             // dev.unam
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_anonfld;        // dmmeta.anonfld         fconst:dmmeta.Ssimfile.ssimfile/dmmeta.anonfld
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_argvtype;       // dmmeta.argvtype        fconst:dmmeta.Ssimfile.ssimfile/dmmeta.argvtype
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_basepool;       // dmmeta.basepool        fconst:dmmeta.Ssimfile.ssimfile/dmmeta.basepool
+extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_bheap;          // dmmeta.bheap           fconst:dmmeta.Ssimfile.ssimfile/dmmeta.bheap
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_bitfld;         // dmmeta.bitfld          fconst:dmmeta.Ssimfile.ssimfile/dmmeta.bitfld
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_cafter;         // dmmeta.cafter          fconst:dmmeta.Ssimfile.ssimfile/dmmeta.cafter
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_cascdel;        // dmmeta.cascdel         fconst:dmmeta.Ssimfile.ssimfile/dmmeta.cascdel
@@ -432,6 +443,7 @@ extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_fcleanup;       // dmmeta.f
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_fcmap;          // dmmeta.fcmap           fconst:dmmeta.Ssimfile.ssimfile/dmmeta.fcmap
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_fcmdline;       // dmmeta.fcmdline        fconst:dmmeta.Ssimfile.ssimfile/dmmeta.fcmdline
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_fcmp;           // dmmeta.fcmp            fconst:dmmeta.Ssimfile.ssimfile/dmmeta.fcmp
+extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_fcolumn;        // dmmeta.fcolumn         fconst:dmmeta.Ssimfile.ssimfile/dmmeta.fcolumn
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_fcompact;       // dmmeta.fcompact        fconst:dmmeta.Ssimfile.ssimfile/dmmeta.fcompact
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_fconst;         // dmmeta.fconst          fconst:dmmeta.Ssimfile.ssimfile/dmmeta.fconst
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_fcurs;          // dmmeta.fcurs           fconst:dmmeta.Ssimfile.ssimfile/dmmeta.fcurs
@@ -461,6 +473,7 @@ extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_inlary;         // dmmeta.i
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_lenfld;         // dmmeta.lenfld          fconst:dmmeta.Ssimfile.ssimfile/dmmeta.lenfld
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_listtype;       // dmmeta.listtype        fconst:dmmeta.Ssimfile.ssimfile/dmmeta.listtype
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_llist;          // dmmeta.llist           fconst:dmmeta.Ssimfile.ssimfile/dmmeta.llist
+extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_magazine;       // dmmeta.magazine        fconst:dmmeta.Ssimfile.ssimfile/dmmeta.magazine
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_main;           // dmmeta.main            fconst:dmmeta.Ssimfile.ssimfile/dmmeta.main
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_msgtype;        // dmmeta.msgtype         fconst:dmmeta.Ssimfile.ssimfile/dmmeta.msgtype
 extern const char *  dmmeta_Ssimfile_ssimfile_dmmeta_nocascdel;      // dmmeta.nocascdel       fconst:dmmeta.Ssimfile.ssimfile/dmmeta.nocascdel
@@ -517,6 +530,7 @@ extern const char *  dmmeta_Strtype_strtype_leftpad;    // leftpad     fconst:dm
 namespace dmmeta { struct Anonfld; }
 namespace dmmeta { struct Argvtype; }
 namespace dmmeta { struct Basepool; }
+namespace dmmeta { struct Bheap; }
 namespace dmmeta { struct Bitfld; }
 namespace dmmeta { struct Buftype; }
 namespace dmmeta { struct BuftypeId; }
@@ -556,6 +570,7 @@ namespace dmmeta { struct Fcleanup; }
 namespace dmmeta { struct Fcmap; }
 namespace dmmeta { struct Fcmdline; }
 namespace dmmeta { struct Fcmp; }
+namespace dmmeta { struct Fcolumn; }
 namespace dmmeta { struct Fcompact; }
 namespace dmmeta { struct Fconst; }
 namespace dmmeta { struct Fcurs; }
@@ -587,6 +602,7 @@ namespace dmmeta { struct Inlary; }
 namespace dmmeta { struct Lenfld; }
 namespace dmmeta { struct Listtype; }
 namespace dmmeta { struct Llist; }
+namespace dmmeta { struct Magazine; }
 namespace dmmeta { struct Main; }
 namespace dmmeta { struct Msgtype; }
 namespace dmmeta { struct Nocascdel; }
@@ -704,6 +720,24 @@ bool                 Basepool_ReadStrptrMaybe(dmmeta::Basepool &parent, algo::st
 // print string representation of dmmeta::Basepool to string LHS, no header -- cprint:dmmeta.Basepool.String
 void                 Basepool_Print(dmmeta::Basepool & row, algo::cstring &str) __attribute__((nothrow));
 
+// --- dmmeta.Bheap
+struct Bheap { // dmmeta.Bheap: Options for Bheap: arity and inline keys
+    algo::Smallstr100   field;     //
+    u32                 arity;     //   4  Number of children per heap node
+    bool                inlkey;    //   true  Store copy of sort key next to row pointer in heap array
+    algo::Comment       comment;   //
+    Bheap();
+};
+
+bool                 Bheap_ReadFieldMaybe(dmmeta::Bheap &parent, algo::strptr field, algo::strptr strval) __attribute__((nothrow));
+// Read fields of dmmeta::Bheap from an ascii string.
+// The format of the string is an ssim Tuple
+bool                 Bheap_ReadStrptrMaybe(dmmeta::Bheap &parent, algo::strptr in_str);
+// Set all fields to initial values.
+void                 Bheap_Init(dmmeta::Bheap& parent);
+// print string representation of dmmeta::Bheap to string LHS, no header -- cprint:dmmeta.Bheap.String
+void                 Bheap_Print(dmmeta::Bheap & row, algo::cstring &str) __attribute__((nothrow));
+
 // --- dmmeta.Bitfld
 struct Bitfld { // dmmeta.Bitfld
     algo::Smallstr100   field;      //
@@ -1488,6 +1522,20 @@ void                 Fcmp_Init(dmmeta::Fcmp& parent);
 // print string representation of dmmeta::Fcmp to string LHS, no header -- cprint:dmmeta.Fcmp.String
 void                 Fcmp_Print(dmmeta::Fcmp & row, algo::cstring &str) __attribute__((nothrow));
 
+// --- dmmeta.Fcolumn
+struct Fcolumn { // dmmeta.Fcolumn: Store field of a Lary row in a separate column array
+    algo::Smallstr100   field;     //
+    algo::Comment       comment;   //
+    Fcolumn();
+};
+
+bool                 Fcolumn_ReadFieldMaybe(dmmeta::Fcolumn &parent, algo::strptr field, algo::strptr strval) __attribute__((nothrow));
+// Read fields of dmmeta::Fcolumn from an ascii string.
+// The format of the string is an ssim Tuple
+bool                 Fcolumn_ReadStrptrMaybe(dmmeta::Fcolumn &parent, algo::strptr in_str);
+// print string representation of dmmeta::Fcolumn to string LHS, no header -- cprint:dmmeta.Fcolumn.String
+void                 Fcolumn_Print(dmmeta::Fcolumn & row, algo::cstring &str) __attribute__((nothrow));
+
 // --- dmmeta.Fcompact
 struct Fcompact { // dmmeta.Fcompact
     algo::Smallstr100   field;     //
@@ -2125,6 +2173,23 @@ void                 Llist_Init(dmmeta::Llist& parent);
 // print string representation of dmmeta::Llist to string LHS, no header -- cprint:dmmeta.Llist.String
 void                 Llist_Print(dmmeta::Llist & row, algo::cstring &str) __attribute__((nothrow));
 
+// --- dmmeta.Magazine
+struct Magazine { // dmmeta.Magazine: Per-thread cache of free elements for a Tpool or Lpool
+    algo::Smallstr100   field;     // Tpool or Lpool field
+    u32                 size;      //   64  Max free elements kept per thread (per size class for Lpool)
+    algo::Comment       comment;   //
+    Magazine();
+};
+
+bool                 Magazine_ReadFieldMaybe(dmmeta::Magazine &parent, algo::strptr field, algo::strptr strval) __attribute__((nothrow));
+// Read fields of dmmeta::Magazine from an ascii string.
+// The format of the string is an ssim Tuple
+bool                 Magazine_ReadStrptrMaybe(dmmeta::Magazine &parent, algo::strptr in_str);
+// Set all fields to initial values.
+void                 Magazine_Init(dmmeta::Magazine& parent);
+// print string representation of dmmeta::Magazine to string LHS, no header -- cprint:dmmeta.Magazine.String
+void                 Magazine_Print(dmmeta::Magazine & row, algo::cstring &str) __attribute__((nothrow));
+
 // --- dmmeta.Main
 struct Main { // dmmeta.Main
     algo::Smallstr16   ns;         //
@@ -2754,13 +2819,19 @@ void                 Tary_Print(dmmeta::Tary & row, algo::cstring &str) __attrib
 
 // --- dmmeta.Thash
 struct Thash { // dmmeta.Thash
-    algo::Smallstr100   field;     //
-    algo::Smallstr100   hashfld;   // Field on which hash function is computed
-    bool                unique;    //   true  Enforce uniqueness of member elements
-    algo::Comment       comment;   //
+    algo::Smallstr100   field;         //
+    algo::Smallstr100   hashfld;       // Field on which hash function is computed
+    bool                unique;        //   true  Enforce uniqueness of member elements
+    bool                cachehash;     //   false  Cache 32-bit hash value in the row; compare hash before key
+    bool                openaddr;      //   false  Open addressing: linear probing over contiguous (hash,row) slots
+    bool                incremental;   //   false  Rehash incrementally: migrate a few buckets per insert instead of all at once
+    algo::Comment       comment;       //
     explicit Thash(const algo::strptr&            in_field
         ,const algo::strptr&            in_hashfld
         ,bool                           in_unique
+        ,bool                           in_cachehash
+        ,bool                           in_openaddr
+        ,bool                           in_incremental
         ,const algo::Comment&           in_comment);
     Thash();
 };
@@ -2883,6 +2954,7 @@ void                 Xref_Print(dmmeta::Xref & row, algo::cstring &str) __attrib
 } // end namespace dmmeta
 namespace algo {
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Anonfld &row);// cfmt:dmmeta.Anonfld.String
+inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Bheap &row);// cfmt:dmmeta.Bheap.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::BuftypeId &row);// cfmt:dmmeta.BuftypeId.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Cascdel &row);// cfmt:dmmeta.Cascdel.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Cdecl &row);// cfmt:dmmeta.Cdecl.String
@@ -2894,6 +2966,7 @@ inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Ctypelen &ro
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Dispsigcheck &row);// cfmt:dmmeta.Dispsigcheck.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Fbase &row);// cfmt:dmmeta.Fbase.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Fbigend &row);// cfmt:dmmeta.Fbigend.String
+inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Fcolumn &row);// cfmt:dmmeta.Fcolumn.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Fconst &row);// cfmt:dmmeta.Fconst.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Field &row);// cfmt:dmmeta.Field.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::FieldId &row);// cfmt:dmmeta.FieldId.String
@@ -2905,6 +2978,7 @@ inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Gstatic &row
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Gsymbol &row);// cfmt:dmmeta.Gsymbol.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Hook &row);// cfmt:dmmeta.Hook.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Llist &row);// cfmt:dmmeta.Llist.String
+inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Magazine &row);// cfmt:dmmeta.Magazine.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Main &row);// cfmt:dmmeta.Main.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Nossimfile &row);// cfmt:dmmeta.Nossimfile.String
 inline algo::cstring &operator <<(algo::cstring &str, const dmmeta::Ns &row);// cfmt:dmmeta.Ns.String
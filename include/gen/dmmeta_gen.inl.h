@@ -31,6 +31,17 @@ inline dmmeta::Basepool::Basepool(const algo::strptr&            in_field
 inline dmmeta::Basepool::Basepool() {
 }
 
+inline dmmeta::Bheap::Bheap() {
+    dmmeta::Bheap_Init(*this);
+}
+
+
+// --- dmmeta.Bheap..Init
+// Set all fields to initial values.
+inline void dmmeta::Bheap_Init(dmmeta::Bheap& parent) {
+    parent.arity = u32(4);
+    parent.inlkey = bool(true);
+}
 inline dmmeta::Bitfld::Bitfld(const algo::strptr&            in_field
         ,i32                            in_offset
         ,i32                            in_width
@@ -496,6 +507,9 @@ inline void dmmeta::Fcmp_Init(dmmeta::Fcmp& parent) {
     parent.casesens = bool(true);
     parent.extrn = bool(false);
 }
+inline dmmeta::Fcolumn::Fcolumn() {
+}
+
 inline dmmeta::Fcompact::Fcompact() {
 }
 
@@ -794,6 +808,16 @@ inline void dmmeta::Llist_Init(dmmeta::Llist& parent) {
     parent.havetail = bool(true);
     parent.havecount = bool(false);
 }
+inline dmmeta::Magazine::Magazine() {
+    dmmeta::Magazine_Init(*this);
+}
+
+
+// --- dmmeta.Magazine..Init
+// Set all fields to initial values.
+inline void dmmeta::Magazine_Init(dmmeta::Magazine& parent) {
+    parent.size = u32(64);
+}
 inline dmmeta::Main::Main(const algo::strptr&            in_ns
         ,bool                           in_ismodule)
     : ns(in_ns)
@@ -1133,10 +1157,16 @@ inline void dmmeta::Tary_Init(dmmeta::Tary& parent) {
 inline dmmeta::Thash::Thash(const algo::strptr&            in_field
         ,const algo::strptr&            in_hashfld
         ,bool                           in_unique
+        ,bool                           in_cachehash
+        ,bool                           in_openaddr
+        ,bool                           in_incremental
         ,const algo::Comment&           in_comment)
     : field(in_field)
     , hashfld(in_hashfld)
     , unique(in_unique)
+    , cachehash(in_cachehash)
+    , openaddr(in_openaddr)
+    , incremental(in_incremental)
     , comment(in_comment)
 {
 }
@@ -1149,6 +1179,9 @@ inline dmmeta::Thash::Thash() {
 // Set all fields to initial values.
 inline void dmmeta::Thash_Init(dmmeta::Thash& parent) {
     parent.unique = bool(true);
+    parent.cachehash = bool(false);
+    parent.openaddr = bool(false);
+    parent.incremental = bool(false);
 }
 inline dmmeta::Tracefld::Tracefld(const algo::strptr&            in_tracefld
         ,const algo::Comment&           in_comment)
@@ -1204,6 +1237,11 @@ inline algo::cstring &algo::operator <<(algo::cstring &str, const dmmeta::Anonfl
     return str;
 }
 
+inline algo::cstring &algo::operator <<(algo::cstring &str, const dmmeta::Bheap &row) {// cfmt:dmmeta.Bheap.String
+    dmmeta::Bheap_Print(const_cast<dmmeta::Bheap&>(row), str);
+    return str;
+}
+
 inline algo::cstring &algo::operator <<(algo::cstring &str, const dmmeta::BuftypeId &row) {// cfmt:dmmeta.BuftypeId.String
     dmmeta::BuftypeId_Print(const_cast<dmmeta::BuftypeId&>(row), str);
     return str;
@@ -1259,6 +1297,11 @@ inline algo::cstring &algo::operator <<(algo::cstring &str, const dmmeta::Fbigen
     return str;
 }
 
+inline algo::cstring &algo::operator <<(algo::cstring &str, const dmmeta::Fcolumn &row) {// cfmt:dmmeta.Fcolumn.String
+    dmmeta::Fcolumn_Print(const_cast<dmmeta::Fcolumn&>(row), str);
+    return str;
+}
+
 inline algo::cstring &algo::operator <<(algo::cstring &str, const dmmeta::Fconst &row) {// cfmt:dmmeta.Fconst.String
     dmmeta::Fconst_Print(const_cast<dmmeta::Fconst&>(row), str);
     return str;
@@ -1314,6 +1357,11 @@ inline algo::cstring &algo::operator <<(algo::cstring &str, const dmmeta::Llist
     return str;
 }
 
+inline algo::cstring &algo::operator <<(algo::cstring &str, const dmmeta::Magazine &row) {// cfmt:dmmeta.Magazine.String
+    dmmeta::Magazine_Print(const_cast<dmmeta::Magazine&>(row), str);
+    return str;
+}
+
 inline algo::cstring &algo::operator <<(algo::cstring &str, const dmmeta::Main &row) {// cfmt:dmmeta.Main.String
     dmmeta::Main_Print(const_cast<dmmeta::Main&>(row), str);
     return str;
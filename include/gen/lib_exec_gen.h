@@ -32,6 +32,7 @@ namespace lib_exec { struct _db_syscmd_curs; }
 namespace lib_exec { struct _db_ind_running_curs; }
 namespace lib_exec { struct _db_bh_syscmd_curs; }
 namespace lib_exec { struct _db_bh_syscmd_unordcurs; }
+namespace lib_exec { struct _db_bh_syscmd_elem; }
 namespace lib_exec { struct _db_zd_started_curs; }
 namespace lib_exec { struct syscmd_c_prior_curs; }
 namespace lib_exec { struct syscmd_c_next_curs; }
@@ -64,7 +65,7 @@ struct FDb { // lib_exec.FDb
     lib_exec::FSyscmd**     ind_running_buckets_elems;   // pointer to bucket array
     i32                     ind_running_buckets_n;       // number of elements in bucket array
     i32                     ind_running_n;               // number of elements in the hash table
-    lib_exec::FSyscmd**     bh_syscmd_elems;             // binary heap by execkey
+    _db_bh_syscmd_elem*     bh_syscmd_elems;             // 4-ary heap by execkey
     i32                     bh_syscmd_n;                 // number of elements in the heap
     i32                     bh_syscmd_max;               // max elements in bh_syscmd_elems
     lib_exec::FSyscmd*      zd_started_head;             // zero-terminated doubly linked list
@@ -467,6 +468,14 @@ struct _db_bh_syscmd_curs {
 };
 
 
+struct _db_bh_syscmd_elem {// heap element with inline key (lib_exec.FDb.bh_syscmd)
+    i64 key; // copy of row's execkey
+    lib_exec::FSyscmd* row;
+    _db_bh_syscmd_elem() : row(NULL) {}
+    _db_bh_syscmd_elem(const i64 &in_key, lib_exec::FSyscmd *in_row) : key(in_key), row(in_row) {}
+};
+
+
 struct _db_zd_started_curs {// cursor
     typedef lib_exec::FSyscmd ChildType;
     lib_exec::FSyscmd* row;
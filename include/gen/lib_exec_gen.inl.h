@@ -124,7 +124,7 @@ inline bool lib_exec::bh_syscmd_EmptyQ() {
 inline lib_exec::FSyscmd* lib_exec::bh_syscmd_First() {
     lib_exec::FSyscmd *row = NULL;
     if (_db.bh_syscmd_n > 0) {
-        row = _db.bh_syscmd_elems[0];
+        row = _db.bh_syscmd_elems[0].row;
     }
     return row;
 }
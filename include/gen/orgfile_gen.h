@@ -77,11 +77,17 @@ struct FDb { // orgfile.FDb
     orgfile::FFilename**   ind_filename_buckets_elems;   // pointer to bucket array
     i32                    ind_filename_buckets_n;       // number of elements in bucket array
     i32                    ind_filename_n;               // number of elements in the hash table
+    orgfile::FFilename**   ind_filename_old_elems;       // old bucket array during incremental rehash
+    i32                    ind_filename_old_n;           // number of elements in old bucket array
+    i32                    ind_filename_old_pos;         // next old bucket to migrate
     orgfile::FFilehash*    filehash_lary[32];            // level array
     i32                    filehash_n;                   // number of elements in array
     orgfile::FFilehash**   ind_filehash_buckets_elems;   // pointer to bucket array
     i32                    ind_filehash_buckets_n;       // number of elements in bucket array
     i32                    ind_filehash_n;               // number of elements in the hash table
+    orgfile::FFilehash**   ind_filehash_old_elems;       // old bucket array during incremental rehash
+    i32                    ind_filehash_old_n;           // number of elements in old bucket array
+    i32                    ind_filehash_old_pos;         // next old bucket to migrate
     orgfile::FTimefmt*     timefmt_lary[32];             // level array
     i32                    timefmt_n;                    // number of elements in array
     orgfile::trace         trace;                        //
@@ -99,6 +105,8 @@ void                 StaticCheck();
 // Parse strptr into known type and add to database.
 // Return value is true unless an error occurs. If return value is false, algo_lib::_db.errtext has error text
 bool                 InsertStrptrMaybe(algo::strptr str);
+// Insert row image from binary input snapshot.
+bool                 InsertSnapMaybe(i32 table_id, algo::memptr row);
 // Load all finputs from given directory.
 bool                 LoadTuplesMaybe(algo::strptr root) __attribute__((nothrow));
 // Load specified ssimfile.
@@ -143,6 +151,8 @@ bool                 ind_filename_InsertMaybe(orgfile::FFilename& row) __attribu
 void                 ind_filename_Remove(orgfile::FFilename& row) __attribute__((nothrow));
 // Reserve enough room in the hash for N more elements. Return success code.
 void                 ind_filename_Reserve(int n) __attribute__((nothrow));
+// Incremental rehash: migrate up to N buckets from old bucket array to new one
+void                 ind_filename_Rehash(int n) __attribute__((nothrow));
 
 // Allocate memory for new default row.
 // If out of memory, process is killed.
@@ -185,6 +195,8 @@ bool                 ind_filehash_InsertMaybe(orgfile::FFilehash& row) __attribu
 void                 ind_filehash_Remove(orgfile::FFilehash& row) __attribute__((nothrow));
 // Reserve enough room in the hash for N more elements. Return success code.
 void                 ind_filehash_Reserve(int n) __attribute__((nothrow));
+// Incremental rehash: migrate up to N buckets from old bucket array to new one
+void                 ind_filehash_Rehash(int n) __attribute__((nothrow));
 
 // Allocate memory for new default row.
 // If out of memory, process is killed.
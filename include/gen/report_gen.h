@@ -26,35 +26,60 @@ enum report_FieldIdEnum {                 // report.FieldId.value
     ,report_FieldId_n_file_mod      = 9
     ,report_FieldId_records         = 10
     ,report_FieldId_errors          = 11
-    ,report_FieldId_n_cppfile       = 12
-    ,report_FieldId_n_cppline       = 13
+    ,report_FieldId_query           = 12
+    ,report_FieldId_n_query         = 13
     ,report_FieldId_n_ctype         = 14
-    ,report_FieldId_n_func          = 15
-    ,report_FieldId_n_xref          = 16
-    ,report_FieldId_n_filemod       = 17
-    ,report_FieldId_n_test_total    = 18
-    ,report_FieldId_n_test_run      = 19
-    ,report_FieldId_n_test_step     = 20
-    ,report_FieldId_n_cmp           = 21
-    ,report_FieldId_n_line          = 22
-    ,report_FieldId_n_static        = 23
-    ,report_FieldId_n_inline        = 24
-    ,report_FieldId_n_mysteryfunc   = 25
-    ,report_FieldId_n_baddecl       = 26
-    ,report_FieldId_comment         = 27
-    ,report_FieldId_value           = 28
+    ,report_FieldId_n_index         = 15
+    ,report_FieldId_n_scan          = 16
+    ,report_FieldId_n_rec           = 17
+    ,report_FieldId_n_field         = 18
+    ,report_FieldId_n_regx          = 19
+    ,report_FieldId_n_xrefrec       = 20
+    ,report_FieldId_n_file          = 21
+    ,report_FieldId_n_byte          = 22
+    ,report_FieldId_n_lazyrec       = 23
+    ,report_FieldId_load_time       = 24
+    ,report_FieldId_match_time      = 25
+    ,report_FieldId_xref_time       = 26
+    ,report_FieldId_print_time      = 27
+    ,report_FieldId_write_time      = 28
+    ,report_FieldId_n_cppfile       = 29
+    ,report_FieldId_n_cppline       = 30
+    ,report_FieldId_n_func          = 31
+    ,report_FieldId_n_xref          = 32
+    ,report_FieldId_n_filemod       = 33
+    ,report_FieldId_n_test_total    = 34
+    ,report_FieldId_n_test_run      = 35
+    ,report_FieldId_n_test_step     = 36
+    ,report_FieldId_n_cmp           = 37
+    ,report_FieldId_n_line          = 38
+    ,report_FieldId_n_static        = 39
+    ,report_FieldId_n_inline        = 40
+    ,report_FieldId_n_mysteryfunc   = 41
+    ,report_FieldId_n_baddecl       = 42
+    ,report_FieldId_comment         = 43
+    ,report_FieldId_n_hit           = 44
+    ,report_FieldId_n_miss          = 45
+    ,report_FieldId_n_spill         = 46
+    ,report_FieldId_n_drop          = 47
+    ,report_FieldId_pool_bytes      = 48
+    ,report_FieldId_peak_bytes      = 49
+    ,report_FieldId_max_buf         = 50
+    ,report_FieldId_value           = 51
 };
 
-enum { report_FieldIdEnum_N = 29 };
+enum { report_FieldIdEnum_N = 52 };
 
 namespace report { struct FieldId; }
 namespace report { struct Protocol; }
 namespace report { struct abt; }
 namespace report { struct acr; }
 namespace report { struct acr_check; }
+namespace report { struct acr_query; }
 namespace report { struct amc; }
 namespace report { struct atf_unit; }
 namespace report { struct src_func; }
+namespace report { struct tempstr; }
 namespace report {
 }//pkey typedefs
 namespace report {
@@ -170,6 +195,38 @@ void                 acr_check_Init(report::acr_check& parent);
 // print string representation of report::acr_check to string LHS, no header -- cprint:report.acr_check.String
 void                 acr_check_Print(report::acr_check & row, algo::cstring &str) __attribute__((nothrow));
 
+// --- report.acr_query
+struct acr_query { // report.acr_query: Query statistics (see acr -stats)
+    algo::cstring   query;        // Query as ctype.field:value (total: entire invocation)
+    u32             n_query;      //   0  Number of queries run as one batch
+    u32             n_ctype;      //   0  Ctypes matched by query
+    u32             n_index;      //   0  Ctypes whose records were found with an index (pkey or value)
+    u32             n_scan;       //   0  Ctypes whose records were scanned
+    u64             n_rec;        //   0  Records visited to find matches
+    u64             n_field;      //   0  Fields tested
+    u64             n_regx;       //   0  Regx evaluations (names and values)
+    u64             n_xrefrec;    //   0  Records visited while following references
+    u32             n_file;       //   0  Ssimfiles loaded entirely
+    u64             n_byte;       //   0  Size of ssimfiles loaded entirely
+    u64             n_lazyrec;    //   0  Records loaded using pkey index (see -lazy)
+    u32             n_select;     //   0  Records selected
+    algo::UnDiff    load_time;    // Time spent reading and parsing ssimfiles
+    algo::UnDiff    match_time;   // Time spent finding matching records
+    algo::UnDiff    xref_time;    // Time spent following references (including loading)
+    algo::UnDiff    print_time;   // Time spent printing (total only)
+    algo::UnDiff    write_time;   // Time spent saving ssimfiles (total only)
+    acr_query();
+};
+
+bool                 acr_query_ReadFieldMaybe(report::acr_query &parent, algo::strptr field, algo::strptr strval) __attribute__((nothrow));
+// Read fields of report::acr_query from an ascii string.
+// The format of the string is an ssim Tuple
+bool                 acr_query_ReadStrptrMaybe(report::acr_query &parent, algo::strptr in_str);
+// Set all fields to initial values.
+void                 acr_query_Init(report::acr_query& parent);
+// print string representation of report::acr_query to string LHS, no header -- cprint:report.acr_query.String
+void                 acr_query_Print(report::acr_query & row, algo::cstring &str) __attribute__((nothrow));
+
 // --- report.amc
 struct amc { // report.amc
     u32   n_cppfile;   //   0
@@ -230,13 +287,36 @@ bool                 src_func_ReadStrptrMaybe(report::src_func &parent, algo::st
 void                 src_func_Init(report::src_func& parent);
 // print string representation of report::src_func to string LHS, no header -- cprint:report.src_func.String
 void                 src_func_Print(report::src_func & row, algo::cstring &str) __attribute__((nothrow));
+
+// --- report.tempstr
+struct tempstr { // report.tempstr: tempstr pool statistics
+    u64   n_hit;        //   0  tempstr constructed with a pooled buffer
+    u64   n_miss;       //   0  tempstr constructed with no pooled buffer available
+    u64   n_spill;      //   0  Buffers parked in the scope spill list
+    u64   n_drop;       //   0  Buffers freed on release (class full or too large)
+    u64   pool_bytes;   //   0  Bytes currently parked in the pool
+    u64   peak_bytes;   //   0  Peak value of pool_bytes
+    u32   max_buf;      //   0  Largest buffer released by a tempstr
+    tempstr();
+};
+
+bool                 tempstr_ReadFieldMaybe(report::tempstr &parent, algo::strptr field, algo::strptr strval) __attribute__((nothrow));
+// Read fields of report::tempstr from an ascii string.
+// The format of the string is an ssim Tuple
+bool                 tempstr_ReadStrptrMaybe(report::tempstr &parent, algo::strptr in_str);
+// Set all fields to initial values.
+void                 tempstr_Init(report::tempstr& parent);
+// print string representation of report::tempstr to string LHS, no header -- cprint:report.tempstr.String
+void                 tempstr_Print(report::tempstr & row, algo::cstring &str) __attribute__((nothrow));
 } // end namespace report
 namespace algo {
 inline algo::cstring &operator <<(algo::cstring &str, const report::FieldId &row);// cfmt:report.FieldId.String
 inline algo::cstring &operator <<(algo::cstring &str, const report::abt &row);// cfmt:report.abt.String
 inline algo::cstring &operator <<(algo::cstring &str, const report::acr &row);// cfmt:report.acr.String
 inline algo::cstring &operator <<(algo::cstring &str, const report::acr_check &row);// cfmt:report.acr_check.String
+inline algo::cstring &operator <<(algo::cstring &str, const report::acr_query &row);// cfmt:report.acr_query.String
 inline algo::cstring &operator <<(algo::cstring &str, const report::amc &row);// cfmt:report.amc.String
 inline algo::cstring &operator <<(algo::cstring &str, const report::atf_unit &row);// cfmt:report.atf_unit.String
 inline algo::cstring &operator <<(algo::cstring &str, const report::src_func &row);// cfmt:report.src_func.String
+inline algo::cstring &operator <<(algo::cstring &str, const report::tempstr &row);// cfmt:report.tempstr.String
 }
@@ -101,6 +101,10 @@ inline void report::acr_check_Init(report::acr_check& parent) {
     parent.records = u32(0);
     parent.errors = u32(0);
 }
+inline report::acr_query::acr_query() {
+    report::acr_query_Init(*this);
+}
+
 inline report::amc::amc() {
     report::amc_Init(*this);
 }
@@ -146,6 +150,22 @@ inline void report::src_func_Init(report::src_func& parent) {
     parent.n_filemod = u32(0);
     parent.n_baddecl = u32(0);
 }
+inline report::tempstr::tempstr() {
+    report::tempstr_Init(*this);
+}
+
+
+// --- report.tempstr..Init
+// Set all fields to initial values.
+inline void report::tempstr_Init(report::tempstr& parent) {
+    parent.n_hit = u64(0);
+    parent.n_miss = u64(0);
+    parent.n_spill = u64(0);
+    parent.n_drop = u64(0);
+    parent.pool_bytes = u64(0);
+    parent.peak_bytes = u64(0);
+    parent.max_buf = u32(0);
+}
 
 inline algo::cstring &algo::operator <<(algo::cstring &str, const report::FieldId &row) {// cfmt:report.FieldId.String
     report::FieldId_Print(const_cast<report::FieldId&>(row), str);
@@ -167,6 +187,11 @@ inline algo::cstring &algo::operator <<(algo::cstring &str, const report::acr_ch
     return str;
 }
 
+inline algo::cstring &algo::operator <<(algo::cstring &str, const report::acr_query &row) {// cfmt:report.acr_query.String
+    report::acr_query_Print(const_cast<report::acr_query&>(row), str);
+    return str;
+}
+
 inline algo::cstring &algo::operator <<(algo::cstring &str, const report::amc &row) {// cfmt:report.amc.String
     report::amc_Print(const_cast<report::amc&>(row), str);
     return str;
@@ -181,3 +206,8 @@ inline algo::cstring &algo::operator <<(algo::cstring &str, const report::src_fu
     report::src_func_Print(const_cast<report::src_func&>(row), str);
     return str;
 }
+
+inline algo::cstring &algo::operator <<(algo::cstring &str, const report::tempstr &row) {// cfmt:report.tempstr.String
+    report::tempstr_Print(const_cast<report::tempstr&>(row), str);
+    return str;
+}
@@ -47,6 +47,7 @@
 #include <errno.h>
 #include <dirent.h>
 #include <signal.h>
+#include <pthread.h>
 
 #if _linux__
 #include <byteswap.h>